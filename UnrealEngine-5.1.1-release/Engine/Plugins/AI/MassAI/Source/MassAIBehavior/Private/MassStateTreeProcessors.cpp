@@ -34,17 +34,51 @@ struct FCachedExternalDataView
 	FStateTreeDataView DataView;
 };
 
+struct FCachedChunkFragmentView
+{
+	FCachedChunkFragmentView() = default;
+	FCachedChunkFragmentView(const FStateTreeExternalDataHandle InHandle, const UScriptStruct* InStruct, uint8* InFirstEntityMemory)
+		: Handle(InHandle)
+		, Struct(InStruct)
+		, FirstEntityMemory(InFirstEntityMemory)
+		, Stride(InStruct->GetStructureSize())
+	{
+	}
+
+	FStateTreeDataView GetDataView(const int32 EntityIndex) const
+	{
+		return FStateTreeDataView(Struct, FirstEntityMemory + EntityIndex * Stride);
+	}
+
+	FStateTreeExternalDataHandle Handle;
+	const UScriptStruct* Struct = nullptr;
+	/** Fragment of the first entity of the chunk, the fragments of the following entities are stored right after it. */
+	uint8* FirstEntityMemory = nullptr;
+	int32 Stride = 0;
+};
+
+/** External fragments of the entities of the chunk being processed, resolved once per chunk as they all share the same archetype. */
+struct FCachedChunkExternalData
+{
+	TArray<FCachedChunkFragmentView> FragmentViews;
+	TArray<FCachedExternalDataView> SharedFragmentViews;
+};
+
 struct FCachedExternalData
 {
 	TArray<FCachedExternalDataView> DataViews;
+	FCachedChunkExternalData ChunkData;
 	const UStateTree* CachedStateTree = nullptr;
 };
 
-bool SetExternalFragments(FMassStateTreeExecutionContext& Context, const FMassEntityManager& EntityManager)
+bool CollectChunkExternalFragments(const UStateTree& StateTree, const FMassEntityManager& EntityManager, const FMassEntityHandle FirstEntity, FCachedChunkExternalData& ChunkData)
 {
+	ChunkData.FragmentViews.Reset();
+	ChunkData.SharedFragmentViews.Reset();
+
 	bool bFoundAllFragments = true;
-	const FMassEntityView EntityView(EntityManager, Context.GetEntity());
-	for (const FStateTreeExternalDataDesc& DataDesc : Context.GetExternalDataDescs())
+	const FMassEntityView EntityView(EntityManager, FirstEntity);
+	for (const FStateTreeExternalDataDesc& DataDesc : StateTree.GetExternalDataDescs())
 	{
 		if (DataDesc.Struct == nullptr)
 		{
@@ -57,7 +91,7 @@ bool SetExternalFragments(FMassStateTreeExecutionContext& Context, const FMassEn
 			FStructView Fragment = EntityView.GetFragmentDataStruct(ScriptStruct);
 			if (Fragment.IsValid())
 			{
-				Context.SetExternalData(DataDesc.Handle, FStateTreeDataView(Fragment));
+				ChunkData.FragmentViews.Emplace(DataDesc.Handle, ScriptStruct, Fragment.GetMutableMemory());
 			}
 			else
 			{
@@ -74,7 +108,7 @@ bool SetExternalFragments(FMassStateTreeExecutionContext& Context, const FMassEn
 			FConstStructView Fragment = EntityView.GetConstSharedFragmentDataStruct(ScriptStruct);
 			if (Fragment.IsValid())
 			{
-				Context.SetExternalData(DataDesc.Handle, FStateTreeDataView(Fragment.GetScriptStruct(), const_cast<uint8*>(Fragment.GetMemory())));
+				ChunkData.SharedFragmentViews.Emplace(DataDesc.Handle, FStateTreeDataView(Fragment.GetScriptStruct(), const_cast<uint8*>(Fragment.GetMemory())));
 			}
 			else
 			{
@@ -153,6 +187,17 @@ void ForEachEntityInChunk(FCachedExternalData& CachedExternalData, FMassExecutio
 		}
 	}
 
+	// Gather all required fragments, the entities of the chunk share the same archetype so it is done once for the whole chunk.
+	{
+		CSV_SCOPED_TIMING_STAT_EXCLUSIVE(StateTreeProcessorExternalFragments);
+		if (!ensureMsgf(UE::MassBehavior::CollectChunkExternalFragments(*StateTree, EntityManager, Context.GetEntity(0), CachedExternalData.ChunkData), TEXT("StateTree will not execute due to missing required fragments.")))
+		{
+			return;
+		}
+	}
+	const FCachedChunkExternalData& ChunkData = CachedExternalData.ChunkData;
+
+	bool bExternalDataValidated = false;
 	for (int32 EntityIndex = 0; EntityIndex < NumEntities; EntityIndex++)
 	{
 		const FMassEntityHandle Entity = Context.GetEntity(EntityIndex);
@@ -167,24 +212,24 @@ void ForEachEntityInChunk(FCachedExternalData& CachedExternalData, FMassExecutio
 			{
 				StateTreeContext.SetExternalData(DataView.Handle, DataView.DataView);
 			}
-				
-			// Gather all required fragments.
+			for (const FCachedExternalDataView& DataView : ChunkData.SharedFragmentViews)
 			{
-				CSV_SCOPED_TIMING_STAT_EXCLUSIVE(StateTreeProcessorExternalFragments);
-				if (!ensureMsgf(UE::MassBehavior::SetExternalFragments(StateTreeContext, StateTreeContext.GetEntityManager()), TEXT("StateTree will not execute due to missing required fragments.")))
-				{
-					break;
-				}
+				StateTreeContext.SetExternalData(DataView.Handle, DataView.DataView);
+			}
+			for (const FCachedChunkFragmentView& FragmentView : ChunkData.FragmentViews)
+			{
+				StateTreeContext.SetExternalData(FragmentView.Handle, FragmentView.GetDataView(EntityIndex));
 			}
 
-			// Make sure all required external data are set.
+			// Make sure all required external data are set. The same views are set for every entity of the chunk, so validating the first one is enough.
+			if (!bExternalDataValidated)
 			{
 				CSV_SCOPED_TIMING_STAT_EXCLUSIVE(StateTreeProcessorExternalDataValidation);
-				// TODO: disable this when not in debug.
 				if (!ensureMsgf(StateTreeContext.AreExternalDataViewsValid(), TEXT("StateTree will not execute due to missing external data.")))
 				{
 					break;
 				}
+				bExternalDataValidated = true;
 			}
 
 			Callback(StateTreeContext, StateTreeFragment);
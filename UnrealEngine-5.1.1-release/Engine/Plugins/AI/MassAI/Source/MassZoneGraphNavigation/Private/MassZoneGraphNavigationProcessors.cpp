@@ -65,6 +65,22 @@ void UMassZoneGraphLocationInitializer::Execute(FMassEntityManager& EntityManage
 		const TConstArrayView<FTransformFragment> TransformList = Context.GetFragmentView<FTransformFragment>();
 		const FMassZoneGraphNavigationParameters& NavigationParams = Context.GetConstSharedFragment<FMassZoneGraphNavigationParameters>();
 
+		// Find the nearest lanes of the whole chunk at once, nearby agents share the lookups in the zone graph.
+		const FVector QuerySize(NavigationParams.QueryRadius);
+		TArray<FBox, TInlineAllocator<128>> QueryBounds;
+		QueryBounds.Reserve(NumEntities);
+		for (int32 EntityIndex = 0; EntityIndex < NumEntities; ++EntityIndex)
+		{
+			const FVector& AgentLocation = TransformList[EntityIndex].GetTransform().GetLocation();
+			QueryBounds.Emplace(AgentLocation - QuerySize, AgentLocation + QuerySize);
+		}
+
+		TArray<FZoneGraphLaneLocation, TInlineAllocator<128>> NearestLanes;
+		TArray<float, TInlineAllocator<128>> NearestLaneDistancesSqr;
+		NearestLanes.SetNum(NumEntities);
+		NearestLaneDistancesSqr.SetNumZeroed(NumEntities);
+		ZoneGraphSubsystem.FindNearestLanes(QueryBounds, NavigationParams.LaneFilter, NearestLanes, NearestLaneDistancesSqr);
+
 		for (int32 EntityIndex = 0; EntityIndex < NumEntities; ++EntityIndex)
 		{
 			const FTransformFragment& Transform = TransformList[EntityIndex];
@@ -72,13 +88,9 @@ void UMassZoneGraphLocationInitializer::Execute(FMassEntityManager& EntityManage
 			FMassMoveTargetFragment& MoveTarget = MoveTargetList[EntityIndex];
 			FMassZoneGraphLaneLocationFragment& LaneLocation = LaneLocationList[EntityIndex];
 
-			const FVector QuerySize(NavigationParams.QueryRadius);
-			const FBox QueryBounds(AgentLocation - QuerySize, AgentLocation + QuerySize);
-			
-			FZoneGraphLaneLocation NearestLane;
-			float NearestLaneDistSqr = 0;
+			const FZoneGraphLaneLocation& NearestLane = NearestLanes[EntityIndex];
 			
-			if (ZoneGraphSubsystem.FindNearestLane(QueryBounds, NavigationParams.LaneFilter, NearestLane, NearestLaneDistSqr))
+			if (NearestLane.IsValid())
 			{
 				const FZoneGraphStorage* ZoneGraphStorage = ZoneGraphSubsystem.GetZoneGraphStorage(NearestLane.LaneHandle.DataHandle);
 				check(ZoneGraphStorage); // Assume valid storage since we just got result.
@@ -0,0 +1,100 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GauntletComparePerfResultsCommandlet.h"
+#include "Dom/JsonObject.h"
+#include "GauntletModule.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GauntletComparePerfResultsCommandlet)
+
+namespace GauntletComparePerfResults
+{
+	TSharedPtr<FJsonObject> LoadMetrics(const FString& Filename)
+	{
+		FString Json;
+		if (!FFileHelper::LoadFileToString(Json, *Filename))
+		{
+			UE_LOG(LogGauntlet, Error, TEXT("Unable to read performance results %s"), *Filename);
+			return nullptr;
+		}
+
+		TSharedPtr<FJsonObject> RootObject;
+		if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), RootObject) || !RootObject.IsValid())
+		{
+			UE_LOG(LogGauntlet, Error, TEXT("Unable to parse performance results %s"), *Filename);
+			return nullptr;
+		}
+
+		const TSharedPtr<FJsonObject>* MetricsObject = nullptr;
+		if (!RootObject->TryGetObjectField(TEXT("Metrics"), MetricsObject))
+		{
+			UE_LOG(LogGauntlet, Error, TEXT("Performance results %s have no metrics"), *Filename);
+			return nullptr;
+		}
+		return *MetricsObject;
+	}
+}
+
+int32 UGauntletComparePerfResultsCommandlet::Main(const FString& Params)
+{
+	FString BaseFilename;
+	FString TestFilename;
+	if (!FParse::Value(*Params, TEXT("base="), BaseFilename) || !FParse::Value(*Params, TEXT("test="), TestFilename))
+	{
+		UE_LOG(LogGauntlet, Error, TEXT("Usage: -run=GauntletComparePerfResults -base=<Base.json> -test=<Test.json> [-minchange=<percent>] [-significance=<t>]"));
+		return 1;
+	}
+
+	double MinChangePercent = 2.0;
+	double Significance = 1.96;
+	FParse::Value(*Params, TEXT("minchange="), MinChangePercent);
+	FParse::Value(*Params, TEXT("significance="), Significance);
+
+	const TSharedPtr<FJsonObject> BaseMetrics = GauntletComparePerfResults::LoadMetrics(BaseFilename);
+	const TSharedPtr<FJsonObject> TestMetrics = GauntletComparePerfResults::LoadMetrics(TestFilename);
+	if (!BaseMetrics.IsValid() || !TestMetrics.IsValid())
+	{
+		return 1;
+	}
+
+	int32 NumRegressions = 0;
+	UE_LOG(LogGauntlet, Display, TEXT("%-20s %12s %12s %9s %9s"), TEXT("Metric"), TEXT("Base"), TEXT("Test"), TEXT("Change"), TEXT("t"));
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : BaseMetrics->Values)
+	{
+		const TSharedPtr<FJsonObject>* TestMetric = nullptr;
+		if (!TestMetrics->TryGetObjectField(Pair.Key, TestMetric))
+		{
+			UE_LOG(LogGauntlet, Warning, TEXT("%s is missing from %s"), *Pair.Key, *TestFilename);
+			continue;
+		}
+		const TSharedPtr<FJsonObject>& BaseMetric = Pair.Value->AsObject();
+
+		const double BaseMean = BaseMetric->GetNumberField(TEXT("Mean"));
+		const double TestMean = (*TestMetric)->GetNumberField(TEXT("Mean"));
+		const double BaseVariance = FMath::Square(BaseMetric->GetNumberField(TEXT("StdDev")));
+		const double TestVariance = FMath::Square((*TestMetric)->GetNumberField(TEXT("StdDev")));
+		const double BaseCount = FMath::Max(BaseMetric->GetNumberField(TEXT("Count")), 1.0);
+		const double TestCount = FMath::Max((*TestMetric)->GetNumberField(TEXT("Count")), 1.0);
+
+		// Welch's t-test, as the two runs don't have the same sample count nor variance
+		const double StandardError = FMath::Sqrt(BaseVariance / BaseCount + TestVariance / TestCount);
+		const double T = StandardError > 0.0 ? (TestMean - BaseMean) / StandardError : 0.0;
+		const double ChangePercent = BaseMean != 0.0 ? (TestMean - BaseMean) / BaseMean * 100.0 : 0.0;
+
+		const bool bRegressed = ChangePercent > MinChangePercent && T > Significance;
+		NumRegressions += bRegressed ? 1 : 0;
+
+		UE_LOG(LogGauntlet, Display, TEXT("%-20s %12.3f %12.3f %8.2f%% %9.2f%s"), *Pair.Key, BaseMean, TestMean, ChangePercent, T, bRegressed ? TEXT("  REGRESSION") : TEXT(""));
+	}
+
+	if (NumRegressions > 0)
+	{
+		UE_LOG(LogGauntlet, Error, TEXT("%d metric(s) regressed significantly between %s and %s"), NumRegressions, *BaseFilename, *TestFilename);
+		return 1;
+	}
+
+	UE_LOG(LogGauntlet, Display, TEXT("No significant regression between %s and %s"), *BaseFilename, *TestFilename);
+	return 0;
+}
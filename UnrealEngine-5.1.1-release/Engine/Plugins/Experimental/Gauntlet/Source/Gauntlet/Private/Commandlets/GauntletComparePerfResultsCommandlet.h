@@ -0,0 +1,24 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "GauntletComparePerfResultsCommandlet.generated.h"
+
+/**
+ *	Compares two results files written by UGauntletTestControllerPerfTest and fails when a metric regressed.
+ *
+ *	A metric regressed when its mean grew by more than -minchange= percent (default 2) and Welch's t statistic of the
+ *	difference is above -significance= (default 1.96, about 95% confidence for the sample counts of a run).
+ *
+ *	Usage: -run=GauntletComparePerfResults -base=<Base.json> -test=<Test.json> [-minchange=<percent>] [-significance=<t>]
+ */
+UCLASS()
+class UGauntletComparePerfResultsCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,187 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GauntletTestControllerPerfTest.h"
+#include "Dom/JsonObject.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "RenderCore.h"
+#include "RHI.h"
+#include "Serialization/JsonSerializer.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GauntletTestControllerPerfTest)
+
+
+UGauntletTestControllerPerfTest::~UGauntletTestControllerPerfTest()
+{
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+}
+
+void UGauntletTestControllerPerfTest::OnInit()
+{
+	FParse::Value(FCommandLine::Get(), TEXT("gauntlet.perf.warmup="), WarmupSeconds);
+	FParse::Value(FCommandLine::Get(), TEXT("gauntlet.perf.duration="), DurationSeconds);
+	FParse::Value(FCommandLine::Get(), TEXT("gauntlet.perf.start="), StartCommand, false);
+	bCaptureCsv = FParse::Param(FCommandLine::Get(), TEXT("gauntlet.perf.csv"));
+
+	if (!FParse::Value(FCommandLine::Get(), TEXT("gauntlet.perf.output="), OutputFilename))
+	{
+		OutputFilename = FPaths::ProfilingDir() / TEXT("Gauntlet") / TEXT("PerfResults.json");
+	}
+}
+
+void UGauntletTestControllerPerfTest::OnPostMapChange(UWorld* World)
+{
+	// the warm up starts from the first map loaded, later map changes are part of the scenario
+	if (Phase == EPhase::WaitingForMap)
+	{
+		Phase = EPhase::WarmingUp;
+		TimeInPhase = 0.0;
+	}
+}
+
+void UGauntletTestControllerPerfTest::OnTick(float TimeDelta)
+{
+	TimeInPhase += TimeDelta;
+
+	if (Phase == EPhase::WarmingUp && TimeInPhase >= WarmupSeconds)
+	{
+		StartMeasuring();
+	}
+	else if (Phase == EPhase::Measuring)
+	{
+		SampleMemory();
+
+		if (TimeInPhase >= DurationSeconds)
+		{
+			StopMeasuring();
+			EndTest(WriteResults(OutputFilename, StartCommand.IsEmpty() ? GetCurrentMap() : StartCommand, Samples) ? 0 : -1);
+		}
+	}
+}
+
+void UGauntletTestControllerPerfTest::StartMeasuring()
+{
+	UE_LOG(LogGauntlet, Display, TEXT("Starting to measure performance for %.1f seconds"), DurationSeconds);
+
+	Phase = EPhase::Measuring;
+	TimeInPhase = 0.0;
+	Samples.Reset();
+
+	if (!StartCommand.IsEmpty() && GEngine)
+	{
+		GEngine->Exec(GetWorld(), *StartCommand);
+	}
+
+#if CSV_PROFILER
+	if (bCaptureCsv)
+	{
+		FCsvProfiler::Get()->BeginCapture();
+	}
+#endif
+
+	EndFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &UGauntletTestControllerPerfTest::SampleFrame);
+	MarkHeartbeatActive(TEXT("Measuring performance"));
+}
+
+void UGauntletTestControllerPerfTest::StopMeasuring()
+{
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+	EndFrameHandle.Reset();
+
+#if CSV_PROFILER
+	if (bCaptureCsv)
+	{
+		FCsvProfiler::Get()->EndCapture();
+	}
+#endif
+
+	Phase = EPhase::Done;
+}
+
+void UGauntletTestControllerPerfTest::SampleFrame()
+{
+	// the thread times are the ones of the previous frame, as the end of frame is reached before they are updated
+	Samples.FindOrAdd(TEXT("FrameTime")).Add(FApp::GetDeltaTime() * 1000.0);
+	Samples.FindOrAdd(TEXT("GameThreadTime")).Add(FPlatformTime::ToMilliseconds(GGameThreadTime));
+	Samples.FindOrAdd(TEXT("RenderThreadTime")).Add(FPlatformTime::ToMilliseconds(GRenderThreadTime));
+	Samples.FindOrAdd(TEXT("RHIThreadTime")).Add(FPlatformTime::ToMilliseconds(GRHIThreadTime));
+	if (GDynamicRHI)
+	{
+		Samples.FindOrAdd(TEXT("GPUTime")).Add(FPlatformTime::ToMilliseconds(RHIGetGPUFrameCycles()));
+	}
+}
+
+void UGauntletTestControllerPerfTest::SampleMemory()
+{
+	const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+	Samples.FindOrAdd(TEXT("PhysicalMemoryMB")).Add(MemoryStats.UsedPhysical / (1024.0 * 1024.0));
+	Samples.FindOrAdd(TEXT("VirtualMemoryMB")).Add(MemoryStats.UsedVirtual / (1024.0 * 1024.0));
+}
+
+bool UGauntletTestControllerPerfTest::WriteResults(const FString& Filename, const FString& ScenarioName, const FPerfSamples& InSamples)
+{
+	TSharedRef<FJsonObject> MetricsObject = MakeShared<FJsonObject>();
+	for (const TPair<FString, TArray<double>>& Pair : InSamples)
+	{
+		TArray<double> Sorted = Pair.Value;
+		if (Sorted.IsEmpty())
+		{
+			continue;
+		}
+		Sorted.Sort();
+
+		double Sum = 0.0;
+		for (double Value : Sorted)
+		{
+			Sum += Value;
+		}
+		const double Mean = Sum / Sorted.Num();
+
+		double SumSquaredDeviations = 0.0;
+		for (double Value : Sorted)
+		{
+			SumSquaredDeviations += FMath::Square(Value - Mean);
+		}
+		const double StdDev = Sorted.Num() > 1 ? FMath::Sqrt(SumSquaredDeviations / (Sorted.Num() - 1)) : 0.0;
+
+		auto Percentile = [&Sorted](double Fraction)
+		{
+			return Sorted[FMath::Min(FMath::FloorToInt32(Fraction * Sorted.Num()), Sorted.Num() - 1)];
+		};
+
+		TSharedRef<FJsonObject> MetricObject = MakeShared<FJsonObject>();
+		MetricObject->SetNumberField(TEXT("Count"), Sorted.Num());
+		MetricObject->SetNumberField(TEXT("Mean"), Mean);
+		MetricObject->SetNumberField(TEXT("StdDev"), StdDev);
+		MetricObject->SetNumberField(TEXT("Min"), Sorted[0]);
+		MetricObject->SetNumberField(TEXT("Median"), Percentile(0.5));
+		MetricObject->SetNumberField(TEXT("P95"), Percentile(0.95));
+		MetricObject->SetNumberField(TEXT("P99"), Percentile(0.99));
+		MetricObject->SetNumberField(TEXT("Max"), Sorted.Last());
+		MetricsObject->SetObjectField(Pair.Key, MetricObject);
+	}
+
+	TSharedRef<FJsonObject> RootObject = MakeShared<FJsonObject>();
+	RootObject->SetStringField(TEXT("Scenario"), ScenarioName);
+	RootObject->SetStringField(TEXT("Platform"), FPlatformProperties::IniPlatformName());
+	RootObject->SetStringField(TEXT("BuildVersion"), FApp::GetBuildVersion());
+	RootObject->SetObjectField(TEXT("Metrics"), MetricsObject);
+
+	FString Json;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	if (!FJsonSerializer::Serialize(RootObject, Writer) || !FFileHelper::SaveStringToFile(Json, *Filename))
+	{
+		UE_LOG(LogGauntlet, Error, TEXT("Failed to write performance results to %s"), *Filename);
+		return false;
+	}
+
+	UE_LOG(LogGauntlet, Display, TEXT("Wrote performance results to %s"), *Filename);
+	return true;
+}
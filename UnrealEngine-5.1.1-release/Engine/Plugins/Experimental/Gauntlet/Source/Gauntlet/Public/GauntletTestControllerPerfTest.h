@@ -0,0 +1,69 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "GauntletTestController.h"
+#include "GauntletTestControllerPerfTest.generated.h"
+
+/**
+ *	Measures a performance scenario and writes its results to a JSON file that
+ *	UGauntletComparePerfResultsCommandlet can compare between two runs.
+ *
+ *	The scenario is started by the command given by -gauntlet.perf.start= once the
+ *	warm up is over, e.g. "demoplay MyReplay" for a replay or a sequence playing a
+ *	fly-through, and is measured for -gauntlet.perf.duration= seconds. For numbers
+ *	that are repeatable between runs, run with -benchmark -fps=<N> -deterministic.
+ *
+ *	Parameters:
+ *		-gauntlet.perf.warmup=<seconds>		Time to wait after the first map load (default 5)
+ *		-gauntlet.perf.duration=<seconds>	Time to measure for (default 60)
+ *		-gauntlet.perf.start=<command>		Console command starting the scenario
+ *		-gauntlet.perf.output=<path>		Results file (default Saved/Profiling/Gauntlet/PerfResults.json)
+ *		-gauntlet.perf.csv					Also capture a CsvProfiler capture while measuring
+ */
+UCLASS()
+class GAUNTLET_API UGauntletTestControllerPerfTest : public UGauntletTestController
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Samples of each metric, in milliseconds for times of every measured frame, or in megabytes for memory sampled every tick of the controller */
+	using FPerfSamples = TMap<FString, TArray<double>>;
+
+	/** Writes the summary of the samples of every metric as JSON, returns false if the file could not be written */
+	static bool WriteResults(const FString& Filename, const FString& ScenarioName, const FPerfSamples& Samples);
+
+	virtual ~UGauntletTestControllerPerfTest();
+
+protected:
+
+	virtual void	OnInit() override;
+	virtual void	OnPostMapChange(UWorld* World) override;
+	virtual void	OnTick(float TimeDelta) override;
+
+	void			StartMeasuring();
+	void			StopMeasuring();
+	void			SampleFrame();
+	void			SampleMemory();
+
+	enum class EPhase : uint8
+	{
+		WaitingForMap,
+		WarmingUp,
+		Measuring,
+		Done,
+	};
+
+	EPhase			Phase = EPhase::WaitingForMap;
+	double			TimeInPhase = 0.0;
+
+	float			WarmupSeconds = 5.0f;
+	float			DurationSeconds = 60.0f;
+	FString			StartCommand;
+	FString			OutputFilename;
+	bool			bCaptureCsv = false;
+
+	FPerfSamples	Samples;
+	FDelegateHandle	EndFrameHandle;
+};
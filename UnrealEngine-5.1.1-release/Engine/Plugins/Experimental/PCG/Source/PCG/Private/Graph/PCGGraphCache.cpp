@@ -26,11 +26,11 @@ namespace PCGGraphCache
 	}
 }
 
-FPCGGraphCacheEntry::FPCGGraphCacheEntry(const FPCGDataCollection& InInput, const UPCGSettings* InSettings, const UPCGComponent* InComponent, const FPCGDataCollection& InOutput, TWeakObjectPtr<UObject> InOwner, FPCGRootSet& OutRootSet)
+FPCGGraphCacheEntry::FPCGGraphCacheEntry(const FPCGDataCollection& InInput, const UPCGSettings* InSettings, int32 InSettingsCrc32, const UPCGComponent* InComponent, const FPCGDataCollection& InOutput, TWeakObjectPtr<UObject> InOwner, FPCGRootSet& OutRootSet)
 	: Input(InInput)
 	, Output(InOutput)
 {
-	SettingsCrc32 = InSettings ? InSettings->GetCrc32() : PCGGraphCache::NullSettingsCrc32;
+	SettingsCrc32 = InSettingsCrc32;
 	ComponentSeed = PCGGraphCache::GetComponentSeed(InSettings, InComponent);
 
 	Input.AddToRootSet(OutRootSet);
@@ -53,7 +53,13 @@ FPCGGraphCache::~FPCGGraphCache()
 	ClearCache();
 }
 
-bool FPCGGraphCache::GetFromCache(const IPCGElement* InElement, const FPCGDataCollection& InInput, const UPCGSettings* InSettings, const UPCGComponent* InComponent, FPCGDataCollection& OutOutput) const
+int32 FPCGGraphCache::GetSettingsCrc32(const UPCGSettings* InSettings)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FPCGGraphCache::GetSettingsCrc32);
+	return InSettings ? InSettings->GetCrc32() : PCGGraphCache::NullSettingsCrc32;
+}
+
+bool FPCGGraphCache::GetFromCache(const IPCGElement* InElement, const FPCGDataCollection& InInput, const UPCGSettings* InSettings, int32 InSettingsCrc32, const UPCGComponent* InComponent, FPCGDataCollection& OutOutput) const
 {
 	if (!Owner.IsValid())
 	{
@@ -65,7 +71,6 @@ bool FPCGGraphCache::GetFromCache(const IPCGElement* InElement, const FPCGDataCo
 
 	if (const FPCGGraphCacheEntries* Entries = CacheData.Find(InElement))
 	{
-		int32 InSettingsCrc32 = (InSettings ? InSettings->GetCrc32() : PCGGraphCache::NullSettingsCrc32);
 		int32 InComponentSeed = PCGGraphCache::GetComponentSeed(InSettings, InComponent);
 
 		for (const FPCGGraphCacheEntry& Entry : *Entries)
@@ -83,7 +88,7 @@ bool FPCGGraphCache::GetFromCache(const IPCGElement* InElement, const FPCGDataCo
 	return false;
 }
 
-void FPCGGraphCache::StoreInCache(const IPCGElement* InElement, const FPCGDataCollection& InInput, const UPCGSettings* InSettings, const UPCGComponent* InComponent, const FPCGDataCollection& InOutput)
+void FPCGGraphCache::StoreInCache(const IPCGElement* InElement, const FPCGDataCollection& InInput, const UPCGSettings* InSettings, int32 InSettingsCrc32, const UPCGComponent* InComponent, const FPCGDataCollection& InOutput)
 {
 	if (!Owner.IsValid())
 	{
@@ -99,7 +104,7 @@ void FPCGGraphCache::StoreInCache(const IPCGElement* InElement, const FPCGDataCo
 		Entries = &(CacheData.Add(InElement));
 	}
 
-	Entries->Emplace(InInput, InSettings, InComponent, InOutput, Owner, *RootSet);
+	Entries->Emplace(InInput, InSettings, InSettingsCrc32, InComponent, InOutput, Owner, *RootSet);
 }
 
 void FPCGGraphCache::ClearCache()
@@ -13,7 +13,7 @@ class AActor;
 struct FPCGGraphCacheEntry
 {
 	FPCGGraphCacheEntry() = default;
-	FPCGGraphCacheEntry(const FPCGDataCollection& InInput, const UPCGSettings* InSettings, const UPCGComponent* InComponent, const FPCGDataCollection& InOutput, TWeakObjectPtr<UObject> InOwner, FPCGRootSet& OutRootSet);
+	FPCGGraphCacheEntry(const FPCGDataCollection& InInput, const UPCGSettings* InSettings, int32 InSettingsCrc32, const UPCGComponent* InComponent, const FPCGDataCollection& InOutput, TWeakObjectPtr<UObject> InOwner, FPCGRootSet& OutRootSet);
 
 	bool Matches(const FPCGDataCollection& InInput, int32 InSettingsCrc32, int32 InComponentSeed) const;
 
@@ -36,11 +36,14 @@ struct FPCGGraphCache
 	FPCGGraphCache(TWeakObjectPtr<UObject> InOwner, FPCGRootSet* InRootSet);
 	~FPCGGraphCache();
 
+	/** Returns the crc of the settings the cache entries are keyed on. Serializes the settings, so it is computed once per task and passed to GetFromCache and StoreInCache. */
+	static int32 GetSettingsCrc32(const UPCGSettings* InSettings);
+
 	/** Returns true if data was found from the cache, in which case the outputs are written in OutOutput */
-	bool GetFromCache(const IPCGElement* InElement, const FPCGDataCollection& InInput, const UPCGSettings* InSettings, const UPCGComponent* InComponent, FPCGDataCollection& OutOutput) const;
+	bool GetFromCache(const IPCGElement* InElement, const FPCGDataCollection& InInput, const UPCGSettings* InSettings, int32 InSettingsCrc32, const UPCGComponent* InComponent, FPCGDataCollection& OutOutput) const;
 
 	/** Stores data in the cache for later use */
-	void StoreInCache(const IPCGElement* InElement, const FPCGDataCollection& InInput, const UPCGSettings* InSettings, const UPCGComponent* InComponent, const FPCGDataCollection& InOutput);
+	void StoreInCache(const IPCGElement* InElement, const FPCGDataCollection& InInput, const UPCGSettings* InSettings, int32 InSettingsCrc32, const UPCGComponent* InComponent, const FPCGDataCollection& InOutput);
 
 	/** Removes all entries from the cache, unroots data, etc. */
 	void ClearCache();
@@ -336,7 +336,9 @@ void FPCGGraphExecutor::Execute()
 				// there is an execution mode that would prevent us from doing so.
 				const UPCGSettings* TaskSettings = PCGContextHelpers::GetInputSettings<UPCGSettings>(Task.Node, TaskInput);
 				FPCGDataCollection CachedOutput;
-				const bool bResultAlreadyInCache = Task.Element->IsCacheable(TaskSettings) && GraphCache.GetFromCache(Task.Element.Get(), TaskInput, TaskSettings, Task.SourceComponent.Get(), CachedOutput);
+				const bool bIsCacheable = Task.Element->IsCacheable(TaskSettings);
+				const int32 TaskSettingsCrc32 = bIsCacheable ? FPCGGraphCache::GetSettingsCrc32(TaskSettings) : 0;
+				const bool bResultAlreadyInCache = bIsCacheable && GraphCache.GetFromCache(Task.Element.Get(), TaskInput, TaskSettings, TaskSettingsCrc32, Task.SourceComponent.Get(), CachedOutput);
 #if WITH_EDITOR
 				const bool bNeedsToCreateActiveTask = !bResultAlreadyInCache || TaskSettings->ExecutionMode == EPCGSettingsExecutionMode::Debug || TaskSettings->ExecutionMode == EPCGSettingsExecutionMode::Isolated;
 #else
@@ -380,6 +382,7 @@ void FPCGGraphExecutor::Execute()
 					ActiveTask.Element = Task.Element;
 					ActiveTask.NodeId = Task.NodeId;
 					ActiveTask.Context = TUniquePtr<FPCGContext>(Task.Context);
+					ActiveTask.SettingsCrc32 = TaskSettingsCrc32;
 
 #if WITH_EDITOR
 					if (bResultAlreadyInCache)
@@ -464,7 +467,7 @@ void FPCGGraphExecutor::Execute()
 				const UPCGSettings* ActiveTaskSettings = ActiveTask.Context->GetInputSettings<UPCGSettings>();
 				if (ActiveTaskSettings && ActiveTask.Element->IsCacheable(ActiveTaskSettings))
 				{
-					GraphCache.StoreInCache(ActiveTask.Element.Get(), ActiveTask.Context->InputData, ActiveTaskSettings, ActiveTask.Context->SourceComponent.Get(), ActiveTask.Context->OutputData);
+					GraphCache.StoreInCache(ActiveTask.Element.Get(), ActiveTask.Context->InputData, ActiveTaskSettings, ActiveTask.SettingsCrc32, ActiveTask.Context->SourceComponent.Get(), ActiveTask.Context->OutputData);
 				}
 			}
 
@@ -57,6 +57,8 @@ struct FPCGGraphActiveTask
 	FPCGElementPtr Element;
 	TUniquePtr<FPCGContext> Context;
 	FPCGTaskId NodeId = InvalidPCGTaskId;
+	/** Crc of the settings the task was looked up in the cache with, reused when storing its results */
+	int32 SettingsCrc32 = 0;
 #if WITH_EDITOR
 	bool bIsBypassed = false;
 #endif
@@ -4,9 +4,11 @@
 
 #include "NiagaraCommon.h"
 #include "NiagaraScript.h"
+#include "Serialization/BulkData.h"
 #include "NiagaraSimCache.generated.h"
 
 class UNiagaraComponent;
+class IBulkDataIORequest;
 
 UENUM(BlueprintType)
 enum class ENiagaraSimCacheAttributeCaptureMode : uint8
@@ -41,6 +43,7 @@ struct FNiagaraSimCacheCreateParameters
 	FNiagaraSimCacheCreateParameters()
 		: bAllowRebasing(true)
 		, bAllowDataInterfaceCaching(true)
+		, bStreamFrameData(false)
 	{
 	}
 
@@ -65,6 +68,14 @@ struct FNiagaraSimCacheCreateParameters
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="SimCache")
 	uint32 bAllowDataInterfaceCaching : 1;
 
+	/**
+	When enabled the attribute data of each frame is stored as a separate bulk data chunk that is streamed in as the cache plays back,
+	rather than keeping all frames in memory.  Only a few frames around the playhead are resident, see fx.Niagara.SimCache.StreamingResidentFrames.
+	Useful for long caches, reading frames that are not resident yet will stall on the IO.
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="SimCache")
+	uint32 bStreamFrameData : 1;
+
 	/**
 	List of Attributes to force include in the SimCache rebase, they should be the full path to the attribute
 	For example, MyEmitter.Particles.MyQuat would force the particle attribute MyQuat to be included for MyEmitter
@@ -264,6 +275,8 @@ public:
 	DECLARE_MULTICAST_DELEGATE_OneParam(FOnCacheEndWrite, UNiagaraSimCache*)
 
 	// UObject Interface
+	virtual void Serialize(FArchive& Ar) override;
+	virtual void BeginDestroy() override;
 	virtual bool IsReadyForFinishDestroy() override;
 	// UObject Interface
 
@@ -279,6 +292,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category=NiagaraSimCache)
 	ENiagaraSimCacheAttributeCaptureMode GetAttributeCaptureMode() const { return CreateParameters.AttributeCaptureMode; }
 
+	/** Is the frame data streamed in as the cache is read rather than all held in memory. */
+	bool IsStreamingFrameData() const { return CreateParameters.bStreamFrameData && StreamedFrameData.Num() > 0; }
+
 	bool BeginWrite(FNiagaraSimCacheCreateParameters InCreateParameters, UNiagaraComponent* NiagaraComponent);
 	bool WriteFrame(UNiagaraComponent* NiagaraComponent);
 	bool EndWrite();
@@ -413,6 +429,19 @@ public:
 	void ReadQuatAttributeWithRebase(TArray<FQuat>& OutValues, FQuat Quat, FName AttributeName = FName("MeshOrientation"), FName EmitterName = NAME_None, int FrameIndex = 0) const;
 
 private:
+	typedef TSharedPtr<FNiagaraSimCacheFrame, ESPMode::ThreadSafe> FStreamedFramePtr;
+
+	/** Moves the data buffers of all frames into the streamed bulk data. */
+	void BuildStreamedFrameData();
+
+	/**
+	Returns the frame with its data buffers streamed in, waiting on the IO if required, and queues reads for the following frames.
+	The frame is kept alive by the pointer so can be used after it is evicted from the resident frames.
+	*/
+	FStreamedFramePtr StreamInFrame(int32 FrameIndex) const;
+	FStreamedFramePtr DecodeStreamedFrame(int32 FrameIndex, const uint8* Data, int64 DataSize) const;
+	void ReleaseStreamedFrames() const;
+
 	UPROPERTY(VisibleAnywhere, Category=SimCache, meta=(DisplayName="Niagara System"))
 	TSoftObjectPtr<UNiagaraSystem> SoftNiagaraSystem;
 
@@ -446,6 +475,14 @@ private:
 
 	mutable std::atomic<int32> PendingCommandsInFlight;
 
+	/** Per frame data buffers when streaming frame data, CacheFrames then only hold the instance counts and bounds */
+	TIndirectArray<FByteBulkData> StreamedFrameData;
+
+	/** Streamed in frames in least recently used order, and the reads in flight for upcoming frames */
+	mutable FCriticalSection StreamingLock;
+	mutable TArray<TPair<int32, FStreamedFramePtr>> ResidentStreamedFrames;
+	mutable TMap<int32, IBulkDataIORequest*> PendingStreamedFrameRequests;
+
 public:
 	static FOnCacheBeginWrite	OnCacheBeginWrite;
 	static FOnCacheEndWrite		OnCacheEndWrite;
@@ -1375,6 +1375,7 @@ void FNiagaraEmitterInstance::Tick(float DeltaSeconds)
 
 	int32 EventSpawnTotal = (EventInstanceData.IsValid() ? EventInstanceData->EventSpawnTotal : 0);
 	int32 OrigNumParticles = GetNumParticles();
+	FNiagaraGlobalBudget::AddParticles(OrigNumParticles);
 	int32 AllocationEstimate = EmitterData->GetMaxParticleCountEstimate();
 	int32 RequiredSize = OrigNumParticles + SpawnTotal + EventSpawnTotal;
 
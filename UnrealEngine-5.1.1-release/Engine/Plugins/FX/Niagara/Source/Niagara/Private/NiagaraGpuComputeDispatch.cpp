@@ -2,6 +2,7 @@
 
 #include "NiagaraGpuComputeDispatch.h"
 
+#include "Algo/StableSort.h"
 #include "Async/Async.h"
 #include "CanvasTypes.h"
 #include "ClearQuad.h"
@@ -40,6 +41,7 @@ DECLARE_DWORD_COUNTER_STAT(TEXT("# GPU Sorted Particles"), STAT_NiagaraGPUSorted
 DECLARE_DWORD_COUNTER_STAT(TEXT("# GPU Sorted Buffers"), STAT_NiagaraGPUSortedBuffers, STATGROUP_Niagara);
 DECLARE_DWORD_COUNTER_STAT(TEXT("Readback latency (frames)"), STAT_NiagaraReadbackLatency, STATGROUP_Niagara);
 DECLARE_DWORD_COUNTER_STAT(TEXT("# GPU Dispatches"), STAT_NiagaraGPUDispatches, STATGROUP_Niagara);
+DECLARE_DWORD_COUNTER_STAT(TEXT("# GPU Dispatch Groups"), STAT_NiagaraGPUDispatchGroups, STATGROUP_Niagara);
 
 DECLARE_GPU_STAT_NAMED(NiagaraGPU, TEXT("Niagara"));
 DECLARE_GPU_STAT_NAMED(NiagaraGPUSimulation, TEXT("Niagara GPU Simulation"));
@@ -67,6 +69,15 @@ static FAutoConsoleVariableRef CVarNiagaraGpuLowLatencyTranslucencyEnabled(
 	ECVF_Default
 );
 
+int32 GNiagaraGpuSortDispatchesByShader = 1;
+static FAutoConsoleVariableRef CVarNiagaraGpuSortDispatchesByShader(
+	TEXT("fx.NiagaraGpuSortDispatchesByShader"),
+	GNiagaraGpuSortDispatchesByShader,
+	TEXT("When enabled the dispatches of a dispatch group are issued sorted by compute shader, so emitters sharing a compiled script and stage run back to back on the same pipeline state.\n")
+	TEXT("Dispatches inside a group overlap without barriers so their order does not change the results."),
+	ECVF_Default
+);
+
 int32 GNiagaraBatcherFreeBufferEarly = 1;
 static FAutoConsoleVariableRef CVarNiagaraBatcherFreeBufferEarly(
 	TEXT("fx.NiagaraBatcher.FreeBufferEarly"),
@@ -1040,12 +1051,18 @@ void FNiagaraGpuComputeDispatch::ExecuteTicks(FRDGBuilder& GraphBuilder, TConstA
 	NiagaraSceneTextures = &SceneTextures;
 	CurrentPassViews = Views;
 
+	INC_DWORD_STAT_BY(STAT_NiagaraGPUDispatchGroups, DispatchList.DispatchGroups.Num());
+
 	// Loop over dispatches
+	TArray<int32, TInlineAllocator<64>> DispatchOrder;
 	for ( const FNiagaraGpuDispatchGroup& DispatchGroup : DispatchList.DispatchGroups )
 	{
 		const bool bIsFirstGroup = &DispatchGroup == &DispatchList.DispatchGroups[0];
 		const bool bIsLastGroup = &DispatchGroup == &DispatchList.DispatchGroups.Last();
 
+		// Each group is separated from the next by the UAV barriers of its transitions, the event gives the GPU time of the whole group
+		RDG_EVENT_SCOPE(GraphBuilder, "NiagaraDispatchGroup(%d) Dispatches(%d)", int32(&DispatchGroup - DispatchList.DispatchGroups.GetData()), DispatchGroup.DispatchInstances.Num());
+
 		// Consume per tick data from the game thread
 		//-TODO: This does not work currently as some senders assume the data will not be deferred processed
 		//for (FNiagaraGPUSystemTick* Tick : DispatchGroup.TicksWithPerInstanceData)
@@ -1169,8 +1186,28 @@ void FNiagaraGpuComputeDispatch::ExecuteTicks(FRDGBuilder& GraphBuilder, TConstA
 		);
 
 		// Execute Stage
-		for (const FNiagaraGpuDispatchInstance& DispatchInstance : DispatchGroup.DispatchInstances)
+		DispatchOrder.Reset();
+		for (int32 iInstance = 0; iInstance < DispatchGroup.DispatchInstances.Num(); ++iInstance)
+		{
+			DispatchOrder.Add(iInstance);
+		}
+
+		if (GNiagaraGpuSortDispatchesByShader && DispatchOrder.Num() > 1)
+		{
+			const TArray<FNiagaraGpuDispatchInstance>& DispatchInstances = DispatchGroup.DispatchInstances;
+			Algo::StableSortBy(
+				DispatchOrder,
+				[&DispatchInstances](int32 iInstance)
+				{
+					const FNiagaraGpuDispatchInstance& DispatchInstance = DispatchInstances[iInstance];
+					return UPTRINT(DispatchInstance.InstanceData.Context->GPUScript_RT->GetShader(DispatchInstance.SimStageData.StageIndex).GetComputeShader());
+				}
+			);
+		}
+
+		for (int32 iInstance : DispatchOrder)
 		{
+			const FNiagaraGpuDispatchInstance& DispatchInstance = DispatchGroup.DispatchInstances[iInstance];
 			++FNiagaraComputeExecutionContext::TickCounter;
 			if (DispatchInstance.InstanceData.bResetData && DispatchInstance.SimStageData.bFirstStage)
 			{
@@ -2,6 +2,8 @@
 #include "NiagaraScalabilityManager.h"
 #include "NiagaraWorldManager.h"
 #include "NiagaraComponent.h"
+#include "NiagaraModule.h"
+#include "NiagaraStats.h"
 #include "Particles/FXBudget.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(NiagaraScalabilityManager)
@@ -19,6 +21,88 @@ static FAutoConsoleVariableRef CVarScalabilityManParallelThreshold(TEXT("fx.Scal
 static int32 GScalabilityMaxUpdatesPerFrame = 50;
 static FAutoConsoleVariableRef CVarScalabilityMaxUpdatesPerFrame(TEXT("fx.ScalabilityMaxUpdatesPerFrame"), GScalabilityMaxUpdatesPerFrame, TEXT("Number of instances that can be processed per frame when updating scalability state. -1 for all of them. \n"), ECVF_Default);
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Budget Particles"), STAT_NiagaraBudgetParticles, STATGROUP_Niagara);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Budget Spawn Count Scale"), STAT_NiagaraBudgetSpawnCountScale, STATGROUP_Niagara);
+
+static int32 GNiagaraBudgetMaxParticles = 0;
+static FAutoConsoleVariableRef CVarNiagaraBudgetMaxParticles(
+	TEXT("fx.Niagara.Budget.MaxParticles"),
+	GNiagaraBudgetMaxParticles,
+	TEXT("Budget for the combined CPU and GPU particle count of all Niagara systems, 0 to disable.\n")
+	TEXT("The particle count over this budget counts as global budget usage for effect types culling or scaling by global budget, and scales spawn counts down."),
+	ECVF_Scalability
+);
+
+static float GNiagaraBudgetMinSpawnCountScale = 0.1f;
+static FAutoConsoleVariableRef CVarNiagaraBudgetMinSpawnCountScale(
+	TEXT("fx.Niagara.Budget.MinSpawnCountScale"),
+	GNiagaraBudgetMinSpawnCountScale,
+	TEXT("Lowest scale the particle budget applies to spawn counts."),
+	ECVF_Default
+);
+
+static float GNiagaraBudgetSpawnCountScaleRecoveryRate = 0.25f;
+static FAutoConsoleVariableRef CVarNiagaraBudgetSpawnCountScaleRecoveryRate(
+	TEXT("fx.Niagara.Budget.SpawnCountScaleRecoveryRate"),
+	GNiagaraBudgetSpawnCountScaleRecoveryRate,
+	TEXT("Rate per second at which the particle budget spawn count scale goes back up once under budget. Going down is immediate."),
+	ECVF_Default
+);
+
+std::atomic<int32> FNiagaraGlobalBudget::CurrentFrameParticles(0);
+int32 FNiagaraGlobalBudget::LastFrameParticles = 0;
+uint64 FNiagaraGlobalBudget::LastEndFrameCounter = 0;
+float FNiagaraGlobalBudget::ParticleAdjustedUsage = 0.0f;
+float FNiagaraGlobalBudget::SpawnCountScale = 1.0f;
+
+void FNiagaraGlobalBudget::EndFrame(float DeltaSeconds)
+{
+	check(IsInGameThread());
+	if (LastEndFrameCounter == GFrameCounter)
+	{
+		return;
+	}
+	LastEndFrameCounter = GFrameCounter;
+
+	LastFrameParticles = CurrentFrameParticles.exchange(0, std::memory_order_relaxed);
+	if (!IsParticleBudgetEnabled())
+	{
+		ParticleAdjustedUsage = 0.0f;
+		SpawnCountScale = 1.0f;
+		return;
+	}
+
+	static const IConsoleVariable* CVarDecayRate = IConsoleManager::Get().FindConsoleVariable(TEXT("fx.Budget.AdjustedUsageDecayRate"));
+	static const IConsoleVariable* CVarUsageMax = IConsoleManager::Get().FindConsoleVariable(TEXT("fx.Budget.AdjustedUsageMax"));
+	const float DecayRate = CVarDecayRate ? CVarDecayRate->GetFloat() : 0.1f;
+	const float UsageMax = CVarUsageMax ? CVarUsageMax->GetFloat() : 2.0f;
+
+	// Same as the FX time budget, usage rises immediately but only decays slowly so effects don't flip on and off around the cull threshold
+	const float Usage = float(LastFrameParticles) / float(GNiagaraBudgetMaxParticles);
+	ParticleAdjustedUsage = FMath::Min(UsageMax, FMath::Max(Usage, ParticleAdjustedUsage - DecayRate * DeltaSeconds));
+
+	const float TargetSpawnCountScale = Usage > 1.0f ? FMath::Max(GNiagaraBudgetMinSpawnCountScale, 1.0f / Usage) : 1.0f;
+	SpawnCountScale = FMath::Min(TargetSpawnCountScale, SpawnCountScale + GNiagaraBudgetSpawnCountScaleRecoveryRate * DeltaSeconds);
+
+	SET_DWORD_STAT(STAT_NiagaraBudgetParticles, LastFrameParticles);
+	SET_FLOAT_STAT(STAT_NiagaraBudgetSpawnCountScale, SpawnCountScale);
+}
+
+bool FNiagaraGlobalBudget::IsParticleBudgetEnabled()
+{
+	return GNiagaraBudgetMaxParticles > 0 && INiagaraModule::UseGlobalFXBudget();
+}
+
+bool FNiagaraGlobalBudget::IsEnabled()
+{
+	return INiagaraModule::UseGlobalFXBudget() && (FFXBudget::Enabled() || GNiagaraBudgetMaxParticles > 0);
+}
+
+float FNiagaraGlobalBudget::GetWorstAdjustedUsage()
+{
+	return FMath::Max(FFXBudget::GetWorstAdjustedUsage(), ParticleAdjustedUsage);
+}
+
 static float GetScalabilityUpdatePeriod(ENiagaraScalabilityUpdateFrequency Frequency)
 {
 	switch (Frequency)
@@ -479,7 +563,7 @@ void FNiagaraScalabilityManager::Update(FNiagaraWorldManager* WorldMan, float De
 		return;
 	}
 
-	float WorstGlobalBudgetUse = FFXBudget::GetWorstAdjustedUsage();
+	float WorstGlobalBudgetUse = FNiagaraGlobalBudget::GetWorstAdjustedUsage();
 
 	if (bNewOnly)
 	{
@@ -14,6 +14,10 @@
 DECLARE_CYCLE_STAT(TEXT("Register Setup"), STAT_NiagaraSimRegisterSetup, STATGROUP_Niagara);
 DECLARE_CYCLE_STAT(TEXT("Context Ticking"), STAT_NiagaraScriptExecContextTick, STATGROUP_Niagara);
 DECLARE_CYCLE_STAT(TEXT("Rebind DInterface Func Table"), STAT_NiagaraRebindDataInterfaceFunctionTable, STATGROUP_Niagara);
+DECLARE_DWORD_COUNTER_STAT(TEXT("# VM Executions"), STAT_NiagaraVMExecutions, STATGROUP_Niagara);
+DECLARE_DWORD_COUNTER_STAT(TEXT("# VM Instances Executed"), STAT_NiagaraVMInstancesExecuted, STATGROUP_Niagara);
+DECLARE_DWORD_COUNTER_STAT(TEXT("# VM SIMD Lanes Executed"), STAT_NiagaraVMLanesExecuted, STATGROUP_Niagara);
+DECLARE_DWORD_COUNTER_STAT(TEXT("# VM Bytecode KB Executed"), STAT_NiagaraVMBytecodeKBExecuted, STATGROUP_Niagara);
 	//Add previous frame values if we're interpolated spawn.
 	
 	//Internal constants - only needed for non-GPU sim
@@ -190,6 +194,11 @@ bool FNiagaraScriptExecutionContextBase::Execute(uint32 NumInstances, const FScr
 
 		bool bSuccess = true;
 
+		INC_DWORD_STAT(STAT_NiagaraVMExecutions);
+		INC_DWORD_STAT_BY(STAT_NiagaraVMInstancesExecuted, NumInstances);
+		// Instructions run over whole SIMD registers, lanes above the instance count are the vector width wasted by small executions
+		INC_DWORD_STAT_BY(STAT_NiagaraVMLanesExecuted, Align(NumInstances, VECTOR_WIDTH_FLOATS));
+
 #if VECTORVM_SUPPORTS_EXPERIMENTAL && VECTORVM_SUPPORTS_LEGACY
 		if (bUsingExperimentalVM)
 		{
@@ -249,6 +258,9 @@ bool FNiagaraScriptExecutionContextBase::ExecuteInternal_Experimental(uint32 Num
 	if (VectorVMState)
 	{
 		ExecVectorVMState(&ExecCtx, nullptr, nullptr);
+
+		// The bytecode size stands in for the instruction count, which is not kept past optimization
+		INC_DWORD_STAT_BY(STAT_NiagaraVMBytecodeKBExecuted, uint32((uint64(VectorVMState->NumBytecodeBytes) * FMath::DivideAndRoundUp<uint32>(NumInstances, VECTOR_WIDTH_FLOATS)) >> 10));
 	}
 	return true;
 }
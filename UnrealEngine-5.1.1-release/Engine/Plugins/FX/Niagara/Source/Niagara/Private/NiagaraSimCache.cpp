@@ -15,9 +15,66 @@
 #include "NiagaraSimCacheHelper.h"
 #include "NiagaraSystem.h"
 #include "NiagaraSystemInstance.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(NiagaraSimCache)
 
+static int32 GNiagaraSimCacheStreamingResidentFrames = 8;
+static FAutoConsoleVariableRef CVarNiagaraSimCacheStreamingResidentFrames(
+	TEXT("fx.Niagara.SimCache.StreamingResidentFrames"),
+	GNiagaraSimCacheStreamingResidentFrames,
+	TEXT("Maximum number of frames kept in memory per sim cache when the cache streams its frame data."),
+	ECVF_Default
+);
+
+static int32 GNiagaraSimCacheStreamingPrefetchFrames = 4;
+static FAutoConsoleVariableRef CVarNiagaraSimCacheStreamingPrefetchFrames(
+	TEXT("fx.Niagara.SimCache.StreamingPrefetchFrames"),
+	GNiagaraSimCacheStreamingPrefetchFrames,
+	TEXT("Number of frames ahead of the one being read that a streaming sim cache starts reading from disk."),
+	ECVF_Default
+);
+
+namespace NiagaraSimCacheStreaming
+{
+	void SerializeDataBuffers(FArchive& Ar, FNiagaraSimCacheDataBuffers& DataBuffers)
+	{
+		Ar << DataBuffers.FloatData;
+		Ar << DataBuffers.HalfData;
+		Ar << DataBuffers.Int32Data;
+		Ar << DataBuffers.IDToIndexTable;
+	}
+
+	void EmptyDataBuffers(FNiagaraSimCacheDataBuffers& DataBuffers)
+	{
+		DataBuffers.FloatData.Empty();
+		DataBuffers.HalfData.Empty();
+		DataBuffers.Int32Data.Empty();
+		DataBuffers.IDToIndexTable.Empty();
+	}
+
+	void SerializeFrame(FArchive& Ar, FNiagaraSimCacheFrame& CacheFrame)
+	{
+		SerializeDataBuffers(Ar, CacheFrame.SystemData.SystemDataBuffers);
+		for (FNiagaraSimCacheEmitterFrame& EmitterFrame : CacheFrame.EmitterData)
+		{
+			SerializeDataBuffers(Ar, EmitterFrame.ParticleDataBuffers);
+		}
+	}
+
+	void ReleaseRequest(IBulkDataIORequest* Request)
+	{
+		Request->Cancel();
+		Request->WaitCompletion();
+		if (uint8* Data = Request->GetReadResults())
+		{
+			FMemory::Free(Data);
+		}
+		delete Request;
+	}
+}
+
 UNiagaraSimCache::FOnCacheBeginWrite	UNiagaraSimCache::OnCacheBeginWrite;
 UNiagaraSimCache::FOnCacheEndWrite		UNiagaraSimCache::OnCacheEndWrite;
 
@@ -25,6 +82,40 @@ UNiagaraSimCache::UNiagaraSimCache(const FObjectInitializer& ObjectInitializer)
 {
 }
 
+void UNiagaraSimCache::Serialize(FArchive& Ar)
+{
+	Super::Serialize(Ar);
+
+	// Tagged properties are serialized first so the create parameters are valid here when loading
+	if (CreateParameters.bStreamFrameData)
+	{
+		int32 NumStreamedFrames = StreamedFrameData.Num();
+		Ar << NumStreamedFrames;
+
+		if (Ar.IsLoading())
+		{
+			ReleaseStreamedFrames();
+			StreamedFrameData.Empty(NumStreamedFrames);
+			for (int32 i=0; i < NumStreamedFrames; ++i)
+			{
+				StreamedFrameData.Add(new FByteBulkData());
+			}
+		}
+
+		for (int32 i=0; i < NumStreamedFrames; ++i)
+		{
+			StreamedFrameData[i].Serialize(Ar, this, i);
+		}
+	}
+}
+
+void UNiagaraSimCache::BeginDestroy()
+{
+	Super::BeginDestroy();
+
+	ReleaseStreamedFrames();
+}
+
 bool UNiagaraSimCache::IsReadyForFinishDestroy()
 {
 	return PendingCommandsInFlight == 0;
@@ -56,6 +147,9 @@ bool UNiagaraSimCache::BeginWrite(FNiagaraSimCacheCreateParameters InCreateParam
 	CacheFrames.Empty();
 	CaptureTickCount = INDEX_NONE;
 
+	ReleaseStreamedFrames();
+	StreamedFrameData.Empty();
+
 	for ( auto it=DataInterfaceStorage.CreateIterator(); it; ++it )
 	{
 		it->Value->MarkAsGarbage();
@@ -309,10 +403,153 @@ bool UNiagaraSimCache::EndWrite()
 		}
 	}
 
+	if (CreateParameters.bStreamFrameData && IsCacheValid())
+	{
+		BuildStreamedFrameData();
+	}
+
 	OnCacheEndWrite.Broadcast(this);
 	return IsCacheValid();
 }
 
+void UNiagaraSimCache::BuildStreamedFrameData()
+{
+	ReleaseStreamedFrames();
+	StreamedFrameData.Empty(CacheFrames.Num());
+
+	TArray<uint8> FrameBytes;
+	for (FNiagaraSimCacheFrame& CacheFrame : CacheFrames)
+	{
+		FrameBytes.Reset();
+		FMemoryWriter Ar(FrameBytes);
+		NiagaraSimCacheStreaming::SerializeFrame(Ar, CacheFrame);
+
+		FByteBulkData* BulkData = new FByteBulkData();
+		BulkData->SetBulkDataFlags(BULKDATA_Force_NOT_InlinePayload);
+		BulkData->Lock(LOCK_READ_WRITE);
+		FMemory::Memcpy(BulkData->Realloc(FrameBytes.Num()), FrameBytes.GetData(), FrameBytes.Num());
+		BulkData->Unlock();
+		StreamedFrameData.Add(BulkData);
+
+		// Only the instance counts remain in the frame, the data will be streamed back in when read
+		NiagaraSimCacheStreaming::EmptyDataBuffers(CacheFrame.SystemData.SystemDataBuffers);
+		for (FNiagaraSimCacheEmitterFrame& EmitterFrame : CacheFrame.EmitterData)
+		{
+			NiagaraSimCacheStreaming::EmptyDataBuffers(EmitterFrame.ParticleDataBuffers);
+		}
+	}
+}
+
+UNiagaraSimCache::FStreamedFramePtr UNiagaraSimCache::StreamInFrame(int32 FrameIndex) const
+{
+	if (!StreamedFrameData.IsValidIndex(FrameIndex) || !CacheFrames.IsValidIndex(FrameIndex))
+	{
+		return FStreamedFramePtr();
+	}
+
+	//-OPT: The lock is held while waiting on the IO, readers of other frames of the same cache will stall
+	FScopeLock ScopeLock(&StreamingLock);
+
+	FStreamedFramePtr CacheFrame;
+	const int32 ResidentIndex = ResidentStreamedFrames.IndexOfByPredicate([FrameIndex](const TPair<int32, FStreamedFramePtr>& Resident) { return Resident.Key == FrameIndex; });
+	if (ResidentIndex != INDEX_NONE)
+	{
+		CacheFrame = ResidentStreamedFrames[ResidentIndex].Value;
+		ResidentStreamedFrames.RemoveAt(ResidentIndex, 1, false);
+	}
+	else
+	{
+		const FByteBulkData& BulkData = StreamedFrameData[FrameIndex];
+		IBulkDataIORequest* Request = nullptr;
+		PendingStreamedFrameRequests.RemoveAndCopyValue(FrameIndex, Request);
+
+		if (Request == nullptr && BulkData.IsBulkDataLoaded())
+		{
+			// Freshly written or not loaded from a package
+			CacheFrame = DecodeStreamedFrame(FrameIndex, reinterpret_cast<const uint8*>(BulkData.LockReadOnly()), BulkData.GetBulkDataSize());
+			BulkData.Unlock();
+		}
+		else
+		{
+			if (Request == nullptr)
+			{
+				Request = BulkData.CreateStreamingRequest(AIOP_High, nullptr, nullptr);
+			}
+
+			if (Request != nullptr)
+			{
+				Request->WaitCompletion();
+				if (uint8* Data = Request->GetReadResults())
+				{
+					CacheFrame = DecodeStreamedFrame(FrameIndex, Data, Request->GetSize());
+					FMemory::Free(Data);
+				}
+				delete Request;
+			}
+		}
+
+		if (!CacheFrame.IsValid())
+		{
+			UE_LOG(LogNiagara, Warning, TEXT("SimCache(%s) failed to stream in frame %d"), *GetPathName(), FrameIndex);
+			return CacheFrame;
+		}
+	}
+
+	// Most recently used frames are at the end
+	ResidentStreamedFrames.Emplace(FrameIndex, CacheFrame);
+	const int32 MaxResidentFrames = FMath::Max(GNiagaraSimCacheStreamingResidentFrames, 1);
+	if (ResidentStreamedFrames.Num() > MaxResidentFrames)
+	{
+		ResidentStreamedFrames.RemoveAt(0, ResidentStreamedFrames.Num() - MaxResidentFrames, false);
+	}
+
+	// Cancel reads that playback moved away from and start reading the next frames
+	const int32 PrefetchEnd = FMath::Min(FrameIndex + FMath::Max(GNiagaraSimCacheStreamingPrefetchFrames, 0), StreamedFrameData.Num() - 1);
+	for (auto it=PendingStreamedFrameRequests.CreateIterator(); it; ++it)
+	{
+		if (it.Key() <= FrameIndex || it.Key() > PrefetchEnd)
+		{
+			NiagaraSimCacheStreaming::ReleaseRequest(it.Value());
+			it.RemoveCurrent();
+		}
+	}
+
+	for (int32 PrefetchIndex=FrameIndex + 1; PrefetchIndex <= PrefetchEnd; ++PrefetchIndex)
+	{
+		const FByteBulkData& BulkData = StreamedFrameData[PrefetchIndex];
+		if (BulkData.IsBulkDataLoaded() || PendingStreamedFrameRequests.Contains(PrefetchIndex) || ResidentStreamedFrames.ContainsByPredicate([PrefetchIndex](const TPair<int32, FStreamedFramePtr>& Resident) { return Resident.Key == PrefetchIndex; }))
+		{
+			continue;
+		}
+
+		if (IBulkDataIORequest* Request = BulkData.CreateStreamingRequest(AIOP_Normal, nullptr, nullptr))
+		{
+			PendingStreamedFrameRequests.Add(PrefetchIndex, Request);
+		}
+	}
+
+	return CacheFrame;
+}
+
+UNiagaraSimCache::FStreamedFramePtr UNiagaraSimCache::DecodeStreamedFrame(int32 FrameIndex, const uint8* Data, int64 DataSize) const
+{
+	FStreamedFramePtr CacheFrame = MakeShared<FNiagaraSimCacheFrame, ESPMode::ThreadSafe>(CacheFrames[FrameIndex]);
+	FMemoryReaderView Ar(MakeMemoryView(Data, uint64(DataSize)));
+	NiagaraSimCacheStreaming::SerializeFrame(Ar, *CacheFrame);
+	return Ar.IsError() ? FStreamedFramePtr() : CacheFrame;
+}
+
+void UNiagaraSimCache::ReleaseStreamedFrames() const
+{
+	FScopeLock ScopeLock(&StreamingLock);
+	for (const TPair<int32, IBulkDataIORequest*>& PendingRequest : PendingStreamedFrameRequests)
+	{
+		NiagaraSimCacheStreaming::ReleaseRequest(PendingRequest.Value);
+	}
+	PendingStreamedFrameRequests.Empty();
+	ResidentStreamedFrames.Empty();
+}
+
 bool UNiagaraSimCache::CanRead(UNiagaraSystem* NiagaraSystem)
 {
 	check(IsInGameThread());
@@ -414,7 +651,16 @@ bool UNiagaraSimCache::ReadFrame(int32 FrameIndex, float FrameFraction, FNiagara
 		return false;
 	}
 
-	const FNiagaraSimCacheFrame& CacheFrame = CacheFrames[FrameIndex];
+	FStreamedFramePtr StreamedFrame;
+	if (IsStreamingFrameData())
+	{
+		StreamedFrame = StreamInFrame(FrameIndex);
+		if (!StreamedFrame.IsValid())
+		{
+			return false;
+		}
+	}
+	const FNiagaraSimCacheFrame& CacheFrame = StreamedFrame.IsValid() ? *StreamedFrame : CacheFrames[FrameIndex];
 
 	FTransform RebaseTransform = FTransform::Identity;
 	if ( USceneComponent* AttachComponent = SystemInstance->GetAttachComponent() )
@@ -445,6 +691,14 @@ bool UNiagaraSimCache::ReadFrame(int32 FrameIndex, float FrameFraction, FNiagara
 		}
 	}
 
+	// GPU reads reference the streamed frame from the render thread, release it behind them
+	if (StreamedFrame.IsValid())
+	{
+		ENQUEUE_RENDER_COMMAND(NiagaraSimCacheReleaseStreamedFrame)(
+			[StreamedFrame_RT=MoveTemp(StreamedFrame)](FRHICommandListImmediate&) {}
+		);
+	}
+
 	// Store data interface data
 	//-OPT: We shouldn't need to search all the time here
 	if (DataInterfaceStorage.IsEmpty() == false)
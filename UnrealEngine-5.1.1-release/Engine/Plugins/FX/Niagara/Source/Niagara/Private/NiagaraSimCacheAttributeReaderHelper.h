@@ -16,6 +16,7 @@ struct FNiagaraSimCacheAttributeReaderHelper
 	void Initialize(const UNiagaraSimCache* SimCache, FName EmitterName, FName AttributeName, int FrameIndex)
 	{
 		CacheFrame = nullptr;
+		StreamedFrame.Reset();
 		DataBuffers = nullptr;
 		DataBuffersLayout = nullptr;
 		Variable = nullptr;
@@ -29,7 +30,20 @@ struct FNiagaraSimCacheAttributeReaderHelper
 		{
 			return;
 		}
-		CacheFrame = &SimCache->CacheFrames[FrameIndex];
+
+		if (SimCache->IsStreamingFrameData())
+		{
+			StreamedFrame = SimCache->StreamInFrame(FrameIndex);
+			if (StreamedFrame.IsValid() == false)
+			{
+				return;
+			}
+			CacheFrame = StreamedFrame.Get();
+		}
+		else
+		{
+			CacheFrame = &SimCache->CacheFrames[FrameIndex];
+		}
 
 		if ( EmitterName.IsNone() == false )
 		{
@@ -65,6 +79,7 @@ struct FNiagaraSimCacheAttributeReaderHelper
 	void Initialize(const UNiagaraSimCache* SimCache, int EmitterIndex, int AttributeIndex, int FrameIndex)
 	{
 		CacheFrame = nullptr;
+		StreamedFrame.Reset();
 		DataBuffers = nullptr;
 		DataBuffersLayout = nullptr;
 		Variable = nullptr;
@@ -78,7 +93,20 @@ struct FNiagaraSimCacheAttributeReaderHelper
 		{
 			return;
 		}
-		CacheFrame = &SimCache->CacheFrames[FrameIndex];
+
+		if (SimCache->IsStreamingFrameData())
+		{
+			StreamedFrame = SimCache->StreamInFrame(FrameIndex);
+			if (StreamedFrame.IsValid() == false)
+			{
+				return;
+			}
+			CacheFrame = StreamedFrame.Get();
+		}
+		else
+		{
+			CacheFrame = &SimCache->CacheFrames[FrameIndex];
+		}
 
 		if ( EmitterIndex != INDEX_NONE )
 		{
@@ -215,6 +243,7 @@ struct FNiagaraSimCacheAttributeReaderHelper
 	}
 
 	const FNiagaraSimCacheFrame*				CacheFrame = nullptr;
+	UNiagaraSimCache::FStreamedFramePtr			StreamedFrame;
 	const FNiagaraSimCacheDataBuffers*			DataBuffers = nullptr;
 	const FNiagaraSimCacheDataBuffersLayout*	DataBuffersLayout = nullptr;
 	const FNiagaraSimCacheVariable*				Variable = nullptr;
@@ -43,11 +43,24 @@ void FNiagaraSimCacheGpuResource::BuildResource(UNiagaraSimCache* SimCache)
 	const uint32 FrameDataSizeInInts = 4;	//-TODO: Match with shader, this is NumInstances, IntDataOffset, FloatDataOffset, HalfDataOffset
 	uint32 CurrentFrameOffset = 0;
 	uint32 CurrentDataOffset = NumFrames * NumEmitters * FrameDataSizeInInts;
+	// The whole cache is uploaded so streamed caches have all their frames read in here
+	TArray<UNiagaraSimCache::FStreamedFramePtr> StreamedFrames;
+	if (SimCache->IsStreamingFrameData())
+	{
+		StreamedFrames.Reserve(NumFrames);
+		for (int32 FrameIndex=0; FrameIndex < NumFrames; ++FrameIndex)
+		{
+			StreamedFrames.Add(SimCache->StreamInFrame(FrameIndex));
+		}
+	}
+	auto GetCacheFrame = [&](int32 FrameIndex) -> const FNiagaraSimCacheFrame& { return StreamedFrames.IsValidIndex(FrameIndex) && StreamedFrames[FrameIndex].IsValid() ? *StreamedFrames[FrameIndex] : SimCache->CacheFrames[FrameIndex]; };
+
 	TArray<uint32> GpuCacheData;
 	{
 		uint32 RequiredElements = CurrentDataOffset;
-		for (const FNiagaraSimCacheFrame& CacheFrame : SimCache->CacheFrames)
+		for (int32 FrameIndex=0; FrameIndex < NumFrames; ++FrameIndex)
 		{
+			const FNiagaraSimCacheFrame& CacheFrame = GetCacheFrame(FrameIndex);
 			for (const FNiagaraSimCacheEmitterFrame& EmitterFrame : CacheFrame.EmitterData)
 			{
 				RequiredElements += FMath::DivideAndRoundUp<uint32>(EmitterFrame.ParticleDataBuffers.Int32Data.Num(), sizeof(uint32));
@@ -59,8 +72,9 @@ void FNiagaraSimCacheGpuResource::BuildResource(UNiagaraSimCache* SimCache)
 		GpuCacheData.AddUninitialized(RequiredElements);
 	}
 
-	for (const FNiagaraSimCacheFrame& CacheFrame : SimCache->CacheFrames)
+	for (int32 FrameIndex=0; FrameIndex < NumFrames; ++FrameIndex)
 	{
+		const FNiagaraSimCacheFrame& CacheFrame = GetCacheFrame(FrameIndex);
 		for (const FNiagaraSimCacheEmitterFrame& EmitterFrame : CacheFrame.EmitterData)
 		{
 			GpuCacheData[CurrentFrameOffset++] = EmitterFrame.ParticleDataBuffers.NumInstances;
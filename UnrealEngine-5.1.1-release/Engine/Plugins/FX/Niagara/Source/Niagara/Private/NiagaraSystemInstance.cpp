@@ -1933,6 +1933,7 @@ void FNiagaraSystemInstance::TickInstanceParameters_GameThread(float DeltaSecond
 			CurrentEmitterParameters.EmitterInstanceSeed = Emitter->GetInstanceSeed();
 			const FNiagaraEmitterScalabilitySettings& ScalabilitySettings = Emitter->GetScalabilitySettings();
 			CurrentEmitterParameters.EmitterSpawnCountScale = ScalabilitySettings.bScaleSpawnCount ? ScalabilitySettings.SpawnCountScale : 1.0f;
+			CurrentEmitterParameters.EmitterSpawnCountScale *= FNiagaraGlobalBudget::GetSpawnCountScale();
 			++GatheredInstanceParameters.NumAlive;
 		}
 		else
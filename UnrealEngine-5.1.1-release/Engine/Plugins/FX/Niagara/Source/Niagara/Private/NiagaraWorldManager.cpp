@@ -124,7 +124,7 @@ static int GEnableNiagaraGlobalBudgetCulling = 1;
 static FAutoConsoleVariableRef CVarEnableNiagaraGlobalBudgetCulling(
 	TEXT("fx.Niagara.Scalability.GlobalBudgetCulling"),
 	GEnableNiagaraGlobalBudgetCulling,
-	TEXT("When non-zero, high level scalability culling based on global time budget is enabled."),
+	TEXT("When non-zero, high level scalability culling based on the global time and particle budgets is enabled."),
 	ECVF_Default
 );
 
@@ -781,6 +781,7 @@ void FNiagaraWorldManager::DestroyAllSystemSimulations(class UNiagaraSystem* Sys
 
 void FNiagaraWorldManager::TickWorld(UWorld* World, ELevelTick TickType, float DeltaSeconds)
 {
+	FNiagaraGlobalBudget::EndFrame(DeltaSeconds);
 	Get(World)->PostActorTick(DeltaSeconds);
 }
 
@@ -1308,7 +1309,7 @@ bool FNiagaraWorldManager::ShouldPreCull(UNiagaraSystem* System, UNiagaraCompone
 			{
 				FNiagaraScalabilityState State;
 				const FNiagaraSystemScalabilitySettings& ScalabilitySettings = System->GetScalabilitySettings();
-				CalculateScalabilityState(System, ScalabilitySettings, EffectType, Component, true, FFXBudget::GetWorstAdjustedUsage(), State);
+				CalculateScalabilityState(System, ScalabilitySettings, EffectType, Component, true, FNiagaraGlobalBudget::GetWorstAdjustedUsage(), State);
 				return State.bCulled;
 			}
 		}
@@ -1326,7 +1327,7 @@ bool FNiagaraWorldManager::ShouldPreCull(UNiagaraSystem* System, FVector Locatio
 			{
 				FNiagaraScalabilityState State;
 				const FNiagaraSystemScalabilitySettings& ScalabilitySettings = System->GetScalabilitySettings();
-				CalculateScalabilityState(System, ScalabilitySettings, EffectType, Location, true, FFXBudget::GetWorstAdjustedUsage(), State);
+				CalculateScalabilityState(System, ScalabilitySettings, EffectType, Location, true, FNiagaraGlobalBudget::GetWorstAdjustedUsage(), State);
 				//TODO: Tell the debugger about recently PreCulled systems.
 				return State.bCulled;
 			}
@@ -1364,7 +1365,7 @@ void FNiagaraWorldManager::CalculateScalabilityState(UNiagaraSystem* System, con
 	}
 
 	//Cull if any of our budgets are exceeded.
-	bool bEnabled = GEnableNiagaraGlobalBudgetCulling && FFXBudget::Enabled() && INiagaraModule::UseGlobalFXBudget();
+	bool bEnabled = GEnableNiagaraGlobalBudgetCulling && FNiagaraGlobalBudget::IsEnabled();
  	if (!OutState.bCulled && bEnabled && ScalabilitySettings.BudgetScaling.bCullByGlobalBudget)
  	{
  		GlobalBudgetCull(ScalabilitySettings, WorstGlobalBudgetUse, OutState);
@@ -1413,7 +1414,7 @@ void FNiagaraWorldManager::CalculateScalabilityState(UNiagaraSystem* System, con
 		InstanceCountCull(EffectType, System, ScalabilitySettings, OutState);
 	}
 
-	bool bEnabled = GEnableNiagaraGlobalBudgetCulling && FFXBudget::Enabled() && INiagaraModule::UseGlobalFXBudget();
+	bool bEnabled = GEnableNiagaraGlobalBudgetCulling && FNiagaraGlobalBudget::IsEnabled();
  	if (!OutState.bCulled && bEnabled && ScalabilitySettings.BudgetScaling.bCullByGlobalBudget)
 	{
  		GlobalBudgetCull(ScalabilitySettings, WorstGlobalBudgetUse, OutState);
@@ -1441,7 +1442,7 @@ void FNiagaraWorldManager::SortedSignificanceCull(UNiagaraEffectType* EffectType
 		bCull = ScalabilitySettings.bCullMaxInstanceCount && EffectTypeInstCount >= EffectTypeInstanceMax;
 		bCull |= ScalabilitySettings.bCullPerSystemMaxInstanceCount && SystemInstCount >= SystemInstanceMax;
 
-		bool bBudgetCullEnabled = GEnableNiagaraGlobalBudgetCulling && FFXBudget::Enabled() && INiagaraModule::UseGlobalFXBudget();
+		bool bBudgetCullEnabled = GEnableNiagaraGlobalBudgetCulling && FNiagaraGlobalBudget::IsEnabled();
 		if (bCull)
 		{
 #if DEBUG_SCALABILITY_STATE
@@ -1451,7 +1452,7 @@ void FNiagaraWorldManager::SortedSignificanceCull(UNiagaraEffectType* EffectType
 		}
 		else if (bBudgetCullEnabled && ScalabilitySettings.BudgetScaling.bCullByGlobalBudget)
 	 	{
-			float Usage = FFXBudget::GetWorstAdjustedUsage();
+			float Usage = FNiagaraGlobalBudget::GetWorstAdjustedUsage();
 
 			if (ScalabilitySettings.bCullMaxInstanceCount && ScalabilitySettings.BudgetScaling.bScaleMaxInstanceCountByGlobalBudgetUse)
 			{
@@ -1571,7 +1572,7 @@ void FNiagaraWorldManager::InstanceCountCull(UNiagaraEffectType* EffectType, UNi
 	bool bCull = ScalabilitySettings.bCullMaxInstanceCount && EffectType->NumInstances >= EffectTypeInstanceMax;
 	bCull |= ScalabilitySettings.bCullPerSystemMaxInstanceCount && System->GetActiveInstancesCount() >= SystemInstanceMax;
 
-	bool bBudgetCullEnabled = GEnableNiagaraGlobalBudgetCulling && FFXBudget::Enabled() && INiagaraModule::UseGlobalFXBudget();
+	bool bBudgetCullEnabled = GEnableNiagaraGlobalBudgetCulling && FNiagaraGlobalBudget::IsEnabled();
 	//Apply budget based adjustments separately so we can mark this cull as being due to budgetting or not.
 	if (bCull)
 	{
@@ -1582,7 +1583,7 @@ void FNiagaraWorldManager::InstanceCountCull(UNiagaraEffectType* EffectType, UNi
 	}
 	else if (bBudgetCullEnabled && (ScalabilitySettings.BudgetScaling.bScaleMaxInstanceCountByGlobalBudgetUse || ScalabilitySettings.BudgetScaling.bScaleSystemInstanceCountByGlobalBudgetUse))
 	{
-		float Usage = FFXBudget::GetWorstAdjustedUsage();
+		float Usage = FNiagaraGlobalBudget::GetWorstAdjustedUsage();
 
 		if (ScalabilitySettings.BudgetScaling.bScaleMaxInstanceCountByGlobalBudgetUse)
 		{
@@ -1637,7 +1638,7 @@ void FNiagaraWorldManager::DistanceCull(UNiagaraEffectType* EffectType, const FN
 		bool bCull = LODDistance > MaxDist;
 		OutState.bCulled |= bCull;
 
-		bool bBudgetCullEnabled = GEnableNiagaraGlobalBudgetCulling && FFXBudget::Enabled() && INiagaraModule::UseGlobalFXBudget();
+		bool bBudgetCullEnabled = GEnableNiagaraGlobalBudgetCulling && FNiagaraGlobalBudget::IsEnabled();
 		//Check the budget adjusted range separately so we can tell what is down to budgets and what's distance.
 		if (bCull)
 		{
@@ -1648,7 +1649,7 @@ void FNiagaraWorldManager::DistanceCull(UNiagaraEffectType* EffectType, const FN
 		}
 		else if (bBudgetCullEnabled && ScalabilitySettings.BudgetScaling.bScaleMaxDistanceByGlobalBudgetUse)
 		{
-			float Usage = FFXBudget::GetWorstAdjustedUsage();
+			float Usage = FNiagaraGlobalBudget::GetWorstAdjustedUsage();
 			float Scale = ScalabilitySettings.BudgetScaling.MaxDistanceScaleByGlobalBudgetUse.Evaluate(Usage);
 			MaxDist *= Scale;
 
@@ -1682,7 +1683,7 @@ void FNiagaraWorldManager::DistanceCull(UNiagaraEffectType* EffectType, const FN
 			float ClosestDist = FMath::Sqrt(ClosestDistSq);
 			bool bCull = ClosestDist > MaxDist;
 
-			bool bBudgetCullEnabled = GEnableNiagaraGlobalBudgetCulling && FFXBudget::Enabled() && INiagaraModule::UseGlobalFXBudget();
+			bool bBudgetCullEnabled = GEnableNiagaraGlobalBudgetCulling && FNiagaraGlobalBudget::IsEnabled();
 			//Check the budget adjusted range separately so we can tell what is down to budgets and what's distance.
 			if (bCull)
 			{
@@ -1693,7 +1694,7 @@ void FNiagaraWorldManager::DistanceCull(UNiagaraEffectType* EffectType, const FN
 			}
 			else if (bBudgetCullEnabled && ScalabilitySettings.BudgetScaling.bScaleMaxDistanceByGlobalBudgetUse)
 			{
-				float Usage = FFXBudget::GetWorstAdjustedUsage();
+				float Usage = FNiagaraGlobalBudget::GetWorstAdjustedUsage();
 				float Scale = ScalabilitySettings.BudgetScaling.MaxDistanceScaleByGlobalBudgetUse.Evaluate(Usage);
 				MaxDist *= Scale;
 
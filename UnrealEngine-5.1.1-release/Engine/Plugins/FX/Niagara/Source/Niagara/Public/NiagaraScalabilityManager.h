@@ -4,6 +4,7 @@
 
 #include "NiagaraEffectType.h"
 #include "NiagaraCommon.h"
+#include <atomic>
 
 #include "NiagaraScalabilityManager.generated.h"
 
@@ -12,6 +13,43 @@ class UNiagaraSystem;
 class UNiagaraComponent;
 class FReferenceCollector;
 
+/**
+ * Global particle count budget across all Niagara systems, set with fx.Niagara.Budget.MaxParticles.
+ * The particle count of last frame over the budget is fed to scalability as a global budget usage alongside the FX time budgets,
+ * so effects culled or scaled by global budget usage also respond to it, and spawn counts are scaled down while over budget.
+ */
+struct NIAGARA_API FNiagaraGlobalBudget
+{
+	/** Adds the particles of an emitter to this frame's count, can be called concurrently from emitter ticks. */
+	static void AddParticles(int32 NumParticles) { CurrentFrameParticles.fetch_add(NumParticles, std::memory_order_relaxed); }
+
+	/** Closes the frame's particle count and updates the usage and spawn count scale. Called from the game thread, only the first call of a frame has an effect. */
+	static void EndFrame(float DeltaSeconds);
+
+	static bool IsParticleBudgetEnabled();
+
+	/** True if any global budget, time or particle count, is tracked. */
+	static bool IsEnabled();
+
+	/** Worst of the FX time budget adjusted usage and the particle budget adjusted usage. */
+	static float GetWorstAdjustedUsage();
+
+	/** Particle count / particle budget, falling only at fx.Budget.AdjustedUsageDecayRate like the FX time budget usage. */
+	static float GetParticleAdjustedUsage() { return ParticleAdjustedUsage; }
+
+	/** Scale applied to emitter spawn counts to bring the particle count back under the budget. */
+	static float GetSpawnCountScale() { return SpawnCountScale; }
+
+	static int32 GetLastFrameParticles() { return LastFrameParticles; }
+
+private:
+	static std::atomic<int32> CurrentFrameParticles;
+	static int32 LastFrameParticles;
+	static uint64 LastEndFrameCounter;
+	static float ParticleAdjustedUsage;
+	static float SpawnCountScale;
+};
+
 struct FComponentIterationContext
 {
 	TArray<int32> SignificanceIndices;
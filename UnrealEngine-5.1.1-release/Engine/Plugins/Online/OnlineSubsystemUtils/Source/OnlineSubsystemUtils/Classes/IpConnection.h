@@ -16,6 +16,7 @@ class FInternetAddr;
 class ISocketSubsystem;
 class FSocket;
 class FIpConnectionHelper;
+class UIpNetDriver;
 
 namespace UE::Net::Private
 {
@@ -44,6 +45,7 @@ class ONLINESUBSYSTEMUTILS_API UIpConnection : public UNetConnection
 
 	friend FIpConnectionHelper;
 	friend UE::Net::Private::FNetDriverAddressResolution;
+	friend UIpNetDriver;
 
 public:
 	/** This is a non-owning pointer to a socket owned elsewhere, IpConnection will not destroy the socket through this pointer. */
@@ -23,6 +23,7 @@ class Error;
 class FInternetAddr;
 class FNetworkNotify;
 class FSocket;
+class UIpConnection;
 struct FRecvMulti;
 
 namespace UE::Net::Private
@@ -91,6 +92,7 @@ public:
 	virtual bool InitConnect( FNetworkNotify* InNotify, const FURL& ConnectURL, FString& Error ) override;
 	virtual bool InitListen( FNetworkNotify* InNotify, FURL& LocalURL, bool bReuseAddressAndPort, FString& Error ) override;
 	virtual void TickDispatch( float DeltaTime ) override;
+	virtual void TickFlush(float DeltaSeconds) override;
 	virtual void LowLevelSend(TSharedPtr<const FInternetAddr> Address, void* Data, int32 CountBits, FOutPacketTraits& Traits) override;
 	virtual FString LowLevelGetNetworkNumber() override;
 	virtual void LowLevelDestroy() override;
@@ -142,6 +144,20 @@ public:
 	*/
 	void SetSocketAndLocalAddress(const TSharedPtr<FSocket>& SharedSocket);
 
+	/**
+	 * Queues a packet of a connection using the NetDriver socket, to be sent along with all other queued packets by FlushBatchedSends.
+	 * Used by UIpConnection when net.IpConnectionBatchSends is enabled.
+	 *
+	 * @param Connection		The connection sending the packet, send results are reported to it
+	 * @param Data				The packet data, fully processed by the connection PacketHandler
+	 * @param CountBytes		The size of the packet
+	 * @param bNotifyOnSuccess	Whether the connection needs to be notified of a successful send
+	 */
+	void QueueBatchedSend(UIpConnection* Connection, const uint8* Data, int32 CountBytes, bool bNotifyOnSuccess);
+
+	/** Sends all packets queued with QueueBatchedSend, using as few socket calls as the platform allows */
+	void FlushBatchedSends();
+
 	/**
 	 * Returns the port number to use when a client is creating a socket.
 	 * Platforms that can't use the default of 0 (system-selected port) may override
@@ -384,6 +400,13 @@ private:
 	private:
 		bool DispatchPacket(FReceivedPacket&& IncomingPacket, int32 NbBytesRead);
 
+		/**
+		 * Queues all packets received by the last RecvMulti call, stamped with their kernel receive time if available.
+		 *
+		 * @return	Whether all packets fit in the receive queue
+		 */
+		bool DispatchRecvMultiPackets();
+
 		/**
 		 * Execute commands in CommandQueue on the Receive Thread
 		 */
@@ -412,6 +435,9 @@ private:
 
 		/** Shared pointer for the socket, owned by the Game Thread */
 		TSharedPtr<FSocket> Socket;
+
+		/** The preallocated state/buffers for receiving packets with RecvMulti on the receive thread, if enabled */
+		TUniquePtr<FRecvMulti> RecvMultiState;
 	};
 
 	/** Receive thread runnable object. */
@@ -423,6 +449,34 @@ private:
 	/** The preallocated state/buffers, for efficiently executing RecvMulti */
 	TUniquePtr<FRecvMulti> RecvMultiState;
 
+	/** A packet queued by QueueBatchedSend */
+	struct FBatchedSend
+	{
+		/** The connection to report the send result to */
+		TWeakObjectPtr<UIpConnection> Connection;
+
+		/** The address to send the packet to */
+		TSharedPtr<const FInternetAddr> Destination;
+
+		/** Offset of the packet in BatchedSendData */
+		int32 DataOffset = 0;
+
+		/** Size of the packet */
+		int32 Count = 0;
+
+		/** Whether the connection needs to be notified of a successful send */
+		bool bNotifyOnSuccess = false;
+	};
+
+	/** Packets queued by QueueBatchedSend, sent by FlushBatchedSends */
+	TArray<FBatchedSend> BatchedSends;
+
+	/** The data of all packets in BatchedSends */
+	TArray<uint8> BatchedSendData;
+
+	/** Scratch list of packets passed to FSocket::SendToMulti, kept to avoid reallocating it each flush */
+	TArray<FSendToMultiPacket> BatchedSendPackets;
+
 	/** Underlying socket communication */
 	TSharedPtr<FSocket> SocketPrivate;
 
@@ -42,6 +42,11 @@ TAutoConsoleVariable<int32> CVarNetIpConnectionUseSendTasks(
 	0,
 	TEXT("If true, the IpConnection will call the socket's SendTo function in a task graph task so that it can run off the game thread."));
 
+TAutoConsoleVariable<int32> CVarNetIpConnectionBatchSends(
+	TEXT("net.IpConnectionBatchSends"),
+	0,
+	TEXT("If true, packets IpConnections send on the net driver socket are queued and sent together with FSocket::SendToMulti after the net driver TickFlush. Ignored if net.IpConnectionUseSendTasks is true."));
+
 TAutoConsoleVariable<int32> CVarNetIpConnectionDisableResolution(
 	TEXT("net.IpConnectionDisableResolution"),
 	0,
@@ -502,6 +507,7 @@ void UIpConnection::LowLevelSend(void* Data, int32 CountBits, FOutPacketTraits&
 		{
 			const bool bNotifyOnSuccess = (SocketErrorDisconnectDelay > 0.f) && (SocketError_SendDelayStartTime != 0.f);
 			FSocket* CurSocket = GetSocket();
+			UIpNetDriver* const BatchingDriver = (CVarNetIpConnectionBatchSends.GetValueOnAnyThread() != 0) ? Cast<UIpNetDriver>(Driver) : nullptr;
 
 			if (CVarNetIpConnectionUseSendTasks.GetValueOnAnyThread() != 0)
 			{
@@ -555,6 +561,17 @@ void UIpConnection::LowLevelSend(void* Data, int32 CountBits, FOutPacketTraits&
 				NETWORK_PROFILER(GNetworkProfiler.FlushOutgoingBunches(this));
 				NETWORK_PROFILER(GNetworkProfiler.TrackSocketSendTo(CurSocket->GetDescription(), DataToSend, CountBytes, NumPacketIdBits, NumBunchBits, NumAckBits, NumPaddingBits, this));
 			}
+			else if (BatchingDriver != nullptr && CurSocket != nullptr && CurSocket == BatchingDriver->GetSocket())
+			{
+				// Send results are reported by UIpNetDriver::FlushBatchedSends
+				BatchingDriver->QueueBatchedSend(this, DataToSend, CountBytes, bNotifyOnSuccess);
+
+				UNCLOCK_CYCLES(Driver->SendCycles);
+
+				// As with send tasks, flush the profiler data now even though the packet is sent later
+				NETWORK_PROFILER(GNetworkProfiler.FlushOutgoingBunches(this));
+				NETWORK_PROFILER(GNetworkProfiler.TrackSocketSendTo(CurSocket->GetDescription(), DataToSend, CountBytes, NumPacketIdBits, NumBunchBits, NumAckBits, NumPaddingBits, this));
+			}
 			else
 			{
 				bool bWasSendSuccessful = false;
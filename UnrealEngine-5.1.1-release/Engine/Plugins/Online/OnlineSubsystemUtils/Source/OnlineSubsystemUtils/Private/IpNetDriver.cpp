@@ -40,6 +40,7 @@ Notes:
 DECLARE_CYCLE_STAT(TEXT("IpNetDriver Add new connection"), Stat_IpNetDriverAddNewConnection, STATGROUP_Net);
 DECLARE_CYCLE_STAT(TEXT("IpNetDriver Socket RecvFrom"), STAT_IpNetDriver_RecvFromSocket, STATGROUP_Net);
 DECLARE_CYCLE_STAT(TEXT("IpNetDriver Destroy WaitForReceiveThread"), STAT_IpNetDriver_Destroy_WaitForReceiveThread, STATGROUP_Net);
+DECLARE_CYCLE_STAT(TEXT("IpNetDriver Socket SendToMulti"), STAT_IpNetDriver_SendToMultiSocket, STATGROUP_Net);
 
 UIpNetDriver::FOnNetworkProcessingCausingSlowFrame UIpNetDriver::OnNetworkProcessingCausingSlowFrame;
 
@@ -81,7 +82,7 @@ TAutoConsoleVariable<int32> CVarNetUseRecvMulti(
 	TEXT("net.UseRecvMulti"),
 	0,
 	TEXT("If true, and if running on a Unix/Linux platform, multiple packets will be retrieved from the socket with one syscall, ")
-		TEXT("improving performance and also allowing retrieval of timestamp information."));
+		TEXT("improving performance and also allowing retrieval of timestamp information. Also applies to the receive thread, if enabled."));
 
 TAutoConsoleVariable<int32> CVarRecvMultiCapacity(
 	TEXT("net.RecvMultiCapacity"),
@@ -355,6 +356,9 @@ private:
 			CurrentTimestamp.Timestamp = FTimespan::FromSeconds(CurrentPacket.PacketTimestamp);
 			bIsLocalTimestamp = true;
 			bSuccess = true;
+
+			// Only packets from the receive thread have a local timestamp, track how long they waited in the queue
+			ForConnection->AddReceiveQueueLatency((FPlatformTime::Seconds() - CurrentPacket.PacketTimestamp) * 1000.0);
 		}
 
 		if (bSuccess)
@@ -872,6 +876,9 @@ void UIpNetDriver::SetSocketAndLocalAddress(FSocket* NewSocket)
 
 void UIpNetDriver::SetSocketAndLocalAddress(const TSharedPtr<FSocket>& SharedSocket)
 {
+	// Packets queued for the previous socket are sent on it
+	FlushBatchedSends();
+
 	// Must be called even if the current socket is already SharedSocket (for when Net Address Resolution resolves the current socket)
 	SetSocket_Internal(SharedSocket);
 
@@ -941,9 +948,17 @@ bool UIpNetDriver::InitBase( bool bInitAsClient, FNetworkNotify* InNotify, const
 	SetSocketAndLocalAddress(Resolver->GetFirstSocket());
 
 	bool bRecvMultiEnabled = CVarNetUseRecvMulti.GetValueOnAnyThread() != 0;
-	bool bRecvThreadEnabled = CVarNetIpNetDriverUseReceiveThread.GetValueOnAnyThread() != 0;
+	bool bRecvThreadEnabled = SocketReceiveThreadRunnable.IsValid();
 
-	if (bRecvMultiEnabled && !bRecvThreadEnabled)
+	if (bRecvMultiEnabled && bRecvThreadEnabled)
+	{
+		// The receive thread created its own RecvMulti state, the socket only needs to provide timestamps
+		if (SocketSubsystem->IsSocketRecvMultiSupported() && CVarNetUseRecvTimestamps.GetValueOnAnyThread() != 0)
+		{
+			Resolver->SetRetrieveTimestamp(true);
+		}
+	}
+	else if (bRecvMultiEnabled)
 	{
 		bool bSupportsRecvMulti = SocketSubsystem->IsSocketRecvMultiSupported();
 
@@ -973,11 +988,6 @@ bool UIpNetDriver::InitBase( bool bInitAsClient, FNetworkNotify* InNotify, const
 			UE_LOG(LogNet, Warning, TEXT("NetDriver could not enable RecvMulti, as current socket subsystem does not support it."));
 		}
 	}
-	else if (bRecvMultiEnabled && bRecvThreadEnabled)
-	{
-		UE_LOG(LogNet, Warning, TEXT("NetDriver RecvMulti is not yet supported with the Receive Thread enabled."));
-	}
-
 	// Success.
 	return true;
 }
@@ -1325,6 +1335,95 @@ FSocket* UIpNetDriver::GetSocket()
 	return SocketPrivate.Get();
 }
 
+void UIpNetDriver::TickFlush(float DeltaSeconds)
+{
+	Super::TickFlush(DeltaSeconds);
+
+	FlushBatchedSends();
+}
+
+void UIpNetDriver::QueueBatchedSend(UIpConnection* Connection, const uint8* Data, int32 CountBytes, bool bNotifyOnSuccess)
+{
+	FBatchedSend& BatchedSend = BatchedSends.AddDefaulted_GetRef();
+	BatchedSend.Connection = Connection;
+	BatchedSend.Destination = Connection->RemoteAddr;
+	BatchedSend.DataOffset = BatchedSendData.Num();
+	BatchedSend.Count = CountBytes;
+	BatchedSend.bNotifyOnSuccess = bNotifyOnSuccess;
+
+	BatchedSendData.Append(Data, CountBytes);
+}
+
+void UIpNetDriver::FlushBatchedSends()
+{
+	if (BatchedSends.Num() == 0)
+	{
+		return;
+	}
+
+	FSocket* CurrentSocket = GetSocket();
+	ISocketSubsystem* SocketSubsystem = GetSocketSubsystem();
+
+	if (CurrentSocket != nullptr && SocketSubsystem != nullptr)
+	{
+		BatchedSendPackets.Reset(BatchedSends.Num());
+
+		for (const FBatchedSend& BatchedSend : BatchedSends)
+		{
+			FSendToMultiPacket& Packet = BatchedSendPackets.AddDefaulted_GetRef();
+			Packet.Data = BatchedSendData.GetData() + BatchedSend.DataOffset;
+			Packet.Count = BatchedSend.Count;
+			Packet.Destination = BatchedSend.Destination.Get();
+		}
+
+		int32 PacketIndex = 0;
+
+		while (PacketIndex < BatchedSendPackets.Num())
+		{
+			int32 NumPacketsSent = 0;
+			bool bSentAll = false;
+			UIpConnection::FSocketSendResult FailedResult;
+
+			{
+				SCOPE_CYCLE_COUNTER(STAT_IpNetDriver_SendToMultiSocket);
+				bSentAll = CurrentSocket->SendToMulti(MakeArrayView(BatchedSendPackets).Slice(PacketIndex, BatchedSendPackets.Num() - PacketIndex), NumPacketsSent);
+			}
+
+			// Read the error before anything else can overwrite it
+			if (!bSentAll)
+			{
+				FailedResult.Error = SocketSubsystem->GetLastErrorCode();
+			}
+
+			for (const FBatchedSend& BatchedSend : MakeArrayView(BatchedSends).Slice(PacketIndex, NumPacketsSent))
+			{
+				UIpConnection* Connection = BatchedSend.bNotifyOnSuccess ? BatchedSend.Connection.Get() : nullptr;
+				if (Connection != nullptr)
+				{
+					UIpConnection::FSocketSendResult Result;
+					Result.BytesSent = BatchedSend.Count;
+					Connection->HandleSocketSendResult(Result, nullptr);
+				}
+			}
+
+			PacketIndex += NumPacketsSent;
+
+			if (!bSentAll)
+			{
+				if (UIpConnection* Connection = BatchedSends[PacketIndex].Connection.Get())
+				{
+					Connection->HandleSocketSendResult(FailedResult, SocketSubsystem);
+				}
+
+				++PacketIndex;
+			}
+		}
+	}
+
+	BatchedSends.Reset();
+	BatchedSendData.Reset();
+}
+
 UNetConnection* UIpNetDriver::ProcessConnectionlessPacket(FReceivedPacketView& PacketRef, const FPacketBufferView& WorkingBuffer)
 {
 	UNetConnection* ReturnVal = nullptr;
@@ -1574,6 +1673,8 @@ void UIpNetDriver::LowLevelDestroy()
 	FSocket* CurrentSocket = GetSocket();
 	if(CurrentSocket != nullptr && !HasAnyFlags(RF_ClassDefaultObject))
 	{
+		FlushBatchedSends();
+
 		// Wait for send tasks if needed before closing the socket,
 		// since at this point CleanUp() may not have been called on the server connection.
 		UIpConnection* const IpServerConnection = GetServerConnection();
@@ -1999,6 +2100,18 @@ UIpNetDriver::FReceiveThreadRunnable::FReceiveThreadRunnable(UIpNetDriver* InOwn
 	, OwningNetDriver(InOwningNetDriver)
 {
 	SocketSubsystem = OwningNetDriver->GetSocketSubsystem();
+
+	// Created before the thread starts, the receive thread is the only user afterwards
+	if (CVarNetUseRecvMulti.GetValueOnAnyThread() != 0 && SocketSubsystem != nullptr && SocketSubsystem->IsSocketRecvMultiSupported())
+	{
+		const bool bRetrieveTimestamps = CVarNetUseRecvTimestamps.GetValueOnAnyThread() != 0;
+		const ERecvMultiFlags RecvMultiFlags = bRetrieveTimestamps ? ERecvMultiFlags::RetrieveTimestamps : ERecvMultiFlags::None;
+		const int32 MaxRecvMultiPackets = FMath::Max(32, CVarRecvMultiCapacity.GetValueOnAnyThread());
+
+		RecvMultiState = SocketSubsystem->CreateRecvMulti(MaxRecvMultiPackets, MAX_PACKET_SIZE, RecvMultiFlags);
+
+		UE_LOG(LogNet, Log, TEXT("IpNetDriver receive thread using RecvMulti, capacity: %i, Retrieve Timestamps: %i"), MaxRecvMultiPackets, (int32)bRetrieveTimestamps);
+	}
 }
 
 bool UIpNetDriver::FReceiveThreadRunnable::DispatchPacket(FReceivedPacket&& IncomingPacket, int32 NbBytesRead)
@@ -2010,6 +2123,49 @@ bool UIpNetDriver::FReceiveThreadRunnable::DispatchPacket(FReceivedPacket&& Inco
 	return ReceiveQueue.Enqueue(MoveTemp(IncomingPacket));
 }
 
+bool UIpNetDriver::FReceiveThreadRunnable::DispatchRecvMultiPackets()
+{
+	const int32 NumPackets = RecvMultiState->GetNumPackets();
+	const double CurrentTime = FPlatformTime::Seconds();
+
+	for (int32 PacketIdx = 0; PacketIdx < NumPackets; ++PacketIdx)
+	{
+		FReceivedPacketView PacketView;
+		RecvMultiState->GetPacket(PacketIdx, PacketView);
+
+		const int32 BytesRead = PacketView.DataView.NumBytes();
+
+		// Don't even queue empty packets, they can be ignored.
+		if (BytesRead == 0)
+		{
+			continue;
+		}
+
+		FReceivedPacket IncomingPacket;
+
+		// The RecvMulti buffers and addresses are reused by the next call, so the queued packet needs its own copies
+		IncomingPacket.PacketBytes.Append(PacketView.DataView.GetData(), BytesRead);
+		IncomingPacket.FromAddress = PacketView.Address->Clone();
+		IncomingPacket.PlatformTimeSeconds = CurrentTime;
+
+		// Move the receive time back to when the kernel received the packet, which excludes the time the packet waited in the socket buffer from ping
+		FPacketTimestamp KernelTimestamp;
+		if (RecvMultiState->GetPacketTimestamp(PacketIdx, KernelTimestamp))
+		{
+			const double TimeSinceReceive = SocketSubsystem->TranslatePacketTimestamp(KernelTimestamp, ETimestampTranslation::TimeDelta);
+			IncomingPacket.PlatformTimeSeconds -= FMath::Max(TimeSinceReceive, 0.0);
+		}
+
+		// Add packet to queue. Since ReceiveQueue is a TCircularQueue, if the queue is full, this will simply return false without adding anything.
+		if (!ReceiveQueue.Enqueue(MoveTemp(IncomingPacket)))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
 uint32 UIpNetDriver::FReceiveThreadRunnable::Run()
 {
 	using namespace UE::Net::Private;
@@ -2057,25 +2213,39 @@ uint32 UIpNetDriver::FReceiveThreadRunnable::Run()
 			bool bOk = false;
 			int32 BytesRead = 0;
 
-			IncomingPacket.FromAddress = SocketSubsystem->CreateInternetAddr();
-
-			IncomingPacket.PacketBytes.AddUninitialized(MAX_PACKET_SIZE);
-
+			if (RecvMultiState.IsValid())
 			{
-				SCOPE_CYCLE_COUNTER(STAT_IpNetDriver_RecvFromSocket);
-				bOk = Socket->RecvFrom(IncomingPacket.PacketBytes.GetData(), IncomingPacket.PacketBytes.Num(), BytesRead, *IncomingPacket.FromAddress);
-			}
+				{
+					SCOPE_CYCLE_COUNTER(STAT_IpNetDriver_RecvFromSocket);
+					bOk = Socket->RecvMulti(*RecvMultiState);
+				}
 
-			if (bOk)
+				if (bOk)
+				{
+					const bool bSuccess = DispatchRecvMultiPackets();
+					bReceiveQueueFull = !bSuccess;
+				}
+			}
+			else
 			{
+				IncomingPacket.FromAddress = SocketSubsystem->CreateInternetAddr();
+
+				IncomingPacket.PacketBytes.AddUninitialized(MAX_PACKET_SIZE);
+
+				{
+					SCOPE_CYCLE_COUNTER(STAT_IpNetDriver_RecvFromSocket);
+					bOk = Socket->RecvFrom(IncomingPacket.PacketBytes.GetData(), IncomingPacket.PacketBytes.Num(), BytesRead, *IncomingPacket.FromAddress);
+				}
+
 				// Don't even queue empty packets, they can be ignored.
-				if (BytesRead != 0)
+				if (bOk && BytesRead != 0)
 				{
 					const bool bSuccess = DispatchPacket(MoveTemp(IncomingPacket), BytesRead);
 					bReceiveQueueFull = !bSuccess;
 				}
 			}
-			else
+
+			if (!bOk)
 			{
 				// This relies on the platform's implementation using thread-local storage for the last socket error code.
 				ESocketErrors RecvFromError = SocketSubsystem->GetLastErrorCode();
@@ -140,6 +140,7 @@ FPassPacket::FPassPacket(const UE::Trace::IAnalyzer::FOnEventContext& Context)
 	, bParallelExecuteEnd(Context.EventData.GetValue<bool>("IsParallelExecuteEnd"))
 	, bParallelExecute(Context.EventData.GetValue<bool>("IsParallelExecute"))
 	, bParallelExecuteAllowed(Context.EventData.GetValue<bool>("IsParallelExecuteAllowed"))
+	, TransientLiveBytes(Context.EventData.GetValue<uint64>("TransientLiveBytes"))
 {}
 
 static const uint64 PageSize = 1024;
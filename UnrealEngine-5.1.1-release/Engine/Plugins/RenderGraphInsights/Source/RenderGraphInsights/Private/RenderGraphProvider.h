@@ -141,6 +141,7 @@ public:
 	bool bParallelExecuteEnd{};
 	bool bParallelExecute{};
 	bool bParallelExecuteAllowed{};
+	uint64 TransientLiveBytes{};
 
 	FPassPacket(const UE::Trace::IAnalyzer::FOnEventContext& Context);
 };
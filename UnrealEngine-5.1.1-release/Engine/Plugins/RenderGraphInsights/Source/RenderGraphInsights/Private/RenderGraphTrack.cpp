@@ -2284,6 +2284,44 @@ void FRenderGraphTrack::InitTooltip(FTooltipDrawState& Tooltip, const ITimingEve
 			{
 				Tooltip.AddTextLine(TEXT("Merged RenderPass"), FLinearColor::Red);
 			}
+
+			if (Pass.TransientLiveBytes > 0)
+			{
+				uint64 TransientCommitSize = 0;
+				for (const FRHITransientAllocationStats::FMemoryRange& MemoryRange : Pass.Graph->TransientAllocationStats.MemoryRanges)
+				{
+					TransientCommitSize += MemoryRange.CommitSize;
+				}
+
+				const float ToMB = 1.0f / (1024.0f * 1024.0f);
+				Tooltip.AddNameValueTextLine(TEXT("Transient Live Memory:"), FString::Printf(TEXT("%.3fMb"), (float)Pass.TransientLiveBytes * ToMB));
+
+				// Committed memory not holding a resource live during the pass, lost to fragmentation or reserved for other passes.
+				if (TransientCommitSize > Pass.TransientLiveBytes)
+				{
+					Tooltip.AddNameValueTextLine(TEXT("Transient Unused Memory:"), FString::Printf(TEXT("%.3fMb"), (float)(TransientCommitSize - Pass.TransientLiveBytes) * ToMB));
+				}
+			}
+
+			// Graphics work recorded between the fork and join of the async compute interval, which the pass can overlap with
+			if (EnumHasAnyFlags(Pass.Flags, ERDGPassFlags::AsyncCompute) && Pass.GraphicsForkPass.IsValid() && Pass.GraphicsJoinPass.IsValid())
+			{
+				uint32 OverlapPassCount = 0;
+				double OverlapDuration = 0.0;
+
+				for (FRDGPassHandle PassHandle = Pass.GraphicsForkPass + 1; PassHandle < Pass.GraphicsJoinPass; ++PassHandle)
+				{
+					const FPassPacket& OverlapPass = *Pass.Graph->GetPass(PassHandle);
+
+					if (!OverlapPass.bCulled && OverlapPass.Pipeline == ERHIPipeline::Graphics)
+					{
+						OverlapPassCount++;
+						OverlapDuration += OverlapPass.EndTime - OverlapPass.StartTime;
+					}
+				}
+
+				Tooltip.AddNameValueTextLine(TEXT("Estimated Overlap:"), FString::Printf(TEXT("%d graphics passes (%.3f ms recorded)"), OverlapPassCount, OverlapDuration * 1000.0));
+			}
 		}
 		else if (InTooltipEvent.Is<FVisibleTextureEvent>())
 		{
@@ -2602,6 +2602,7 @@ void UGroomComponent::InitResources(bool bIsBindingReloading)
 			HairGroupInstance->HairGroupPublicData->DebugScreenSize = 0.f;
 			HairGroupInstance->HairGroupPublicData->DebugGroupColor = GetHairGroupDebugColor(GroupIt);
 			TArray<float> CPULODScreenSize;
+			TArray<float> LODVertexRatios;
 			TArray<bool> LODVisibility;
 			TArray<EHairGeometryType> LODGeometryTypes;
 			const FHairGroupsLOD& GroupLOD = GroomAsset->HairGroupsLOD[GroupIt];
@@ -2626,6 +2627,7 @@ void UGroomComponent::InitResources(bool bIsBindingReloading)
 				bNeedStrandsData = bNeedStrandsData || GeometryType == EHairGeometryType::Strands;
 
 				CPULODScreenSize.Add(LODSettings.ScreenSize);
+				LODVertexRatios.Add(FMath::Clamp(LODSettings.CurveDecimation, 0.f, 1.f) * FMath::Clamp(LODSettings.VertexDecimation, 0.f, 1.f));
 				LODVisibility.Add(LODSettings.bVisible);
 				LODGeometryTypes.Add(GeometryType);
 				HairGroupInstance->HairGroupPublicData->BindingTypes.Add(BindingType);
@@ -2634,6 +2636,7 @@ void UGroomComponent::InitResources(bool bIsBindingReloading)
 			}
 			HairGroupInstance->HairGroupPublicData->bIsDeformationEnable = GroomAsset->IsDeformationEnable(GroupIt);
 			HairGroupInstance->HairGroupPublicData->SetLODScreenSizes(CPULODScreenSize);
+			HairGroupInstance->HairGroupPublicData->SetLODVertexRatios(LODVertexRatios);
 			HairGroupInstance->HairGroupPublicData->SetLODVisibilities(LODVisibility);
 			HairGroupInstance->HairGroupPublicData->SetLODGeometryTypes(LODGeometryTypes);
 		}
@@ -33,6 +33,15 @@ static FAutoConsoleVariableRef CVarGHairStrands_SwapBufferType(TEXT("r.HairStran
 static int32 GHairStrands_ManualSkinCache = 0;
 static FAutoConsoleVariableRef CVarGHairStrands_ManualSkinCache(TEXT("r.HairStrands.ManualSkinCache"), GHairStrands_ManualSkinCache, TEXT("If skin cache is not enabled, and grooms use skinning method, this enable a simple skin cache mechanisme for groom. Default:disable"));
 
+static int32 GHairStrands_BudgetMaxVertexCount = 0;
+static FAutoConsoleVariableRef CVarHairStrands_BudgetMaxVertexCount(TEXT("r.HairStrands.Budget.MaxVertexCount"), GHairStrands_BudgetMaxVertexCount, TEXT("Max number of strands control points rendered across all grooms. Above it, the grooms covering the least screen space are moved to coarser LODs first. 0 disables the budget. Default:0"), ECVF_Scalability | ECVF_RenderThreadSafe);
+
+static int32 GHairStrands_ProfileGrooms = 0;
+static FAutoConsoleVariableRef CVarHairStrands_ProfileGrooms(TEXT("r.HairStrands.ProfileGrooms"), GHairStrands_ProfileGrooms, TEXT("Add a GPU event with the asset name around the interpolation of each groom, so ProfileGPU and Insights report the cost of each groom. Default:0"), ECVF_RenderThreadSafe);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Hair strands budget vertices"), STAT_HairStrandsBudgetVertexCount, STATGROUP_SceneRendering);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Hair strands budget reduced grooms"), STAT_HairStrandsBudgetReducedGroomCount, STATGROUP_SceneRendering);
+
 static int32 GHairStrands_InterpolationFrustumCullingEnable = 1;
 static FAutoConsoleVariableRef CVarHairStrands_InterpolationFrustumCullingEnable(TEXT("r.HairStrands.Interoplation.FrustumCulling"), GHairStrands_InterpolationFrustumCullingEnable, TEXT("Swap rendering buffer at the end of frame. This is an experimental toggle. Default:1"));
 
@@ -157,6 +166,8 @@ static void RunInternalHairStrandsInterpolation(
 		int32 MeshLODIndex = -1;
 		if (Instance->GeometryType == EHairGeometryType::NoneGeometry)
 			continue;
+
+		RDG_EVENT_SCOPE_CONDITIONAL(GraphBuilder, GHairStrands_ProfileGrooms > 0, "%s", *Instance->Debug.GroomAssetName);
 	
 		check(Instance->HairGroupPublicData);
 
@@ -678,6 +689,93 @@ void AddHairStreamingRequest(FHairGroupInstance* Instance, int32 InLODIndex)
 	}
 }
 
+// Estimated number of strands control points drawn by an instance at a given LOD, 0 if the LOD is not rendered with strands
+static float GetHairInstanceStrandsVertexCount(const FHairGroupInstance* Instance, float LODIndex, EShaderPlatform Platform)
+{
+	const TArray<EHairGeometryType>& LODGeometryTypes = Instance->HairGroupPublicData->GetLODGeometryTypes();
+	const TArray<float>& LODVertexRatios = Instance->HairGroupPublicData->GetLODVertexRatios();
+	const int32 LODCount = LODGeometryTypes.Num();
+	if (LODCount == 0 || LODVertexRatios.Num() != LODCount)
+	{
+		return 0;
+	}
+
+	const int32 IntLODIndex = FMath::Clamp(FMath::FloorToInt(LODIndex), 0, LODCount - 1);
+	const bool bForceCards = GHairStrands_UseCards > 0 || Instance->bForceCards;
+	if (ConvertLODGeometryType(LODGeometryTypes[IntLODIndex], bForceCards, Platform) != EHairGeometryType::Strands || !Instance->HairGroupPublicData->IsVisible(IntLODIndex))
+	{
+		return 0;
+	}
+
+	// The GPU LOD selection blends the vertex count of the two closest LODs
+	const int32 NextLODIndex = FMath::Min(IntLODIndex + 1, LODCount - 1);
+	const float VertexRatio = FMath::Lerp(LODVertexRatios[IntLODIndex], LODVertexRatios[NextLODIndex], FMath::Frac(LODIndex));
+	return Instance->HairGroupPublicData->GetGroupControlPointCount() * VertexRatio;
+}
+
+// Coarsen the LOD of the grooms covering the least screen space until the strands fit in r.HairStrands.Budget.MaxVertexCount
+static void ApplyHairStrandsBudget(
+	const FHairStrandsInstances& Instances,
+	const TArray<float>& ScreenSizes,
+	const TArray<bool>& bCanChangeLOD,
+	EShaderPlatform Platform,
+	TArray<float>& InOutLODIndices)
+{
+	float TotalVertexCount = 0;
+	TArray<int32> Candidates;
+	for (int32 InstanceIt = 0; InstanceIt < Instances.Num(); ++InstanceIt)
+	{
+		const FHairGroupInstance* Instance = static_cast<const FHairGroupInstance*>(Instances[InstanceIt]);
+		const float VertexCount = GetHairInstanceStrandsVertexCount(Instance, InOutLODIndices[InstanceIt], Platform);
+		TotalVertexCount += VertexCount;
+		if (VertexCount > 0 && bCanChangeLOD[InstanceIt])
+		{
+			Candidates.Add(InstanceIt);
+		}
+	}
+
+	const float MaxVertexCount = GHairStrands_BudgetMaxVertexCount;
+	uint32 ReducedGroomCount = 0;
+	if (GHairStrands_BudgetMaxVertexCount > 0 && TotalVertexCount > MaxVertexCount)
+	{
+		Candidates.Sort([&ScreenSizes](int32 A, int32 B) { return ScreenSizes[A] < ScreenSizes[B]; });
+
+		// One LOD step per groom and per round, so the reduction is spread over the smallest grooms rather than dropping a single one to its last LOD
+		TArray<bool> bReduced;
+		bReduced.SetNumZeroed(Instances.Num());
+		bool bChanged = true;
+		while (bChanged && TotalVertexCount > MaxVertexCount)
+		{
+			bChanged = false;
+			for (int32 InstanceIt : Candidates)
+			{
+				const FHairGroupInstance* Instance = static_cast<const FHairGroupInstance*>(Instances[InstanceIt]);
+				const int32 LODCount = Instance->HairGroupPublicData->GetLODVisibilities().Num();
+				const float PrevLODIndex = InOutLODIndices[InstanceIt];
+				if (PrevLODIndex >= LODCount - 1)
+				{
+					continue;
+				}
+
+				const float NewLODIndex = FMath::Min(float(FMath::FloorToInt(PrevLODIndex) + 1), float(LODCount - 1));
+				TotalVertexCount += GetHairInstanceStrandsVertexCount(Instance, NewLODIndex, Platform) - GetHairInstanceStrandsVertexCount(Instance, PrevLODIndex, Platform);
+				InOutLODIndices[InstanceIt] = NewLODIndex;
+				ReducedGroomCount += bReduced[InstanceIt] ? 0 : 1;
+				bReduced[InstanceIt] = true;
+				bChanged = true;
+
+				if (TotalVertexCount <= MaxVertexCount)
+				{
+					break;
+				}
+			}
+		}
+	}
+
+	SET_DWORD_STAT(STAT_HairStrandsBudgetVertexCount, uint32(TotalVertexCount));
+	SET_DWORD_STAT(STAT_HairStrandsBudgetReducedGroomCount, ReducedGroomCount);
+}
+
 static void RunHairLODSelection(
 	FRDGBuilder& GraphBuilder, 
 	const FHairStrandsInstances& Instances, 
@@ -703,9 +801,43 @@ static void RunHairLODSelection(
 	}
 #endif
 
-	for (FHairStrandsInstance* AbstractInstance : Instances)
+	// Screen size based LOD of each instance, using the max screen size across all views
+	const float MinLOD = FMath::Max(0, GHairStrandsMinLOD);
+	TArray<float> ViewLODIndices;
+	TArray<float> MaxScreenSizes;
+	TArray<bool> bCanChangeLOD;
+	ViewLODIndices.SetNumUninitialized(Instances.Num());
+	MaxScreenSizes.SetNumUninitialized(Instances.Num());
+	bCanChangeLOD.SetNumUninitialized(Instances.Num());
+	for (int32 InstanceIt = 0; InstanceIt < Instances.Num(); ++InstanceIt)
 	{
-		FHairGroupInstance* Instance = static_cast<FHairGroupInstance*>(AbstractInstance);
+		const FHairGroupInstance* Instance = static_cast<const FHairGroupInstance*>(Instances[InstanceIt]);
+
+		float MaxScreenSize = 0.f;
+		float LODViewIndex = -1;
+		const FSphere SphereBound = Instance->GetBounds().GetSphere();
+		for (const FSceneView* View : Views)
+		{
+			const float ScreenSize = ComputeBoundsScreenSize(FVector4(SphereBound.Center, 1), SphereBound.W, *View);
+			const float LODBias = Instance->Strands.Modifier.LODBias;
+			const float CurrLODViewIndex = FMath::Max(MinLOD, GetHairInstanceLODIndex(Instance->HairGroupPublicData->GetLODScreenSizes(), ScreenSize, LODBias));
+			MaxScreenSize = FMath::Max(MaxScreenSize, ScreenSize);
+
+			// Select highest LOD accross all views
+			LODViewIndex = LODViewIndex < 0 ? CurrLODViewIndex : FMath::Min(LODViewIndex, CurrLODViewIndex);
+		}
+
+		ViewLODIndices[InstanceIt] = LODViewIndex;
+		MaxScreenSizes[InstanceIt] = MaxScreenSize;
+		// Forced LODs and continuous LOD are left untouched by the budget
+		bCanChangeLOD[InstanceIt] = Instance->Debug.LODForcedIndex < 0 && LODViewIndex >= 0 && !IsHairVisibilityComputeRasterContinuousLODEnabled();
+	}
+
+	ApplyHairStrandsBudget(Instances, MaxScreenSizes, bCanChangeLOD, ShaderPlatform, ViewLODIndices);
+
+	for (int32 InstanceIt = 0; InstanceIt < Instances.Num(); ++InstanceIt)
+	{
+		FHairGroupInstance* Instance = static_cast<FHairGroupInstance*>(Instances[InstanceIt]);
 
 		check(Instance);
 		check(Instance->HairGroupPublicData);
@@ -726,24 +858,13 @@ static void RunHairLODSelection(
 		// Insure that MinLOD is necessary taken into account if a force LOD is request (i.e., LODIndex>=0). If a Force LOD 
 		// is not resquested (i.e., LODIndex<0), the MinLOD is applied after ViewLODIndex has been determined in the codeblock below
 		const int32 LODCount = Instance->HairGroupPublicData->GetLODVisibilities().Num();
-		const float MinLOD = FMath::Max(0, GHairStrandsMinLOD);
 		
 		// If continuous LOD is enabled, we bypass all other type of geometric representation, and only use LOD0
 		float LODIndex = IsHairVisibilityComputeRasterContinuousLODEnabled() ? 0.0 : (Instance->Debug.LODForcedIndex >= 0 ? FMath::Max(Instance->Debug.LODForcedIndex, MinLOD) : -1.0f);
-		float LODViewIndex = -1;
+		const float LODViewIndex = ViewLODIndices[InstanceIt];
 		{
-			float MaxScreenSize = 0.f;
+			const float MaxScreenSize = MaxScreenSizes[InstanceIt];
 			const FSphere SphereBound = Instance->GetBounds().GetSphere();
-			for (const FSceneView* View : Views)
-			{
-				const float ScreenSize = ComputeBoundsScreenSize(FVector4(SphereBound.Center, 1), SphereBound.W, *View);
-				const float LODBias = Instance->Strands.Modifier.LODBias;
-				const float CurrLODViewIndex = FMath::Max(MinLOD, GetHairInstanceLODIndex(Instance->HairGroupPublicData->GetLODScreenSizes(), ScreenSize, LODBias));
-				MaxScreenSize = FMath::Max(MaxScreenSize, ScreenSize);
-
-				// Select highest LOD accross all views
-				LODViewIndex = LODViewIndex < 0 ? CurrLODViewIndex : FMath::Min(LODViewIndex, CurrLODViewIndex);
-			}
 
 			if (LODIndex < 0)
 			{
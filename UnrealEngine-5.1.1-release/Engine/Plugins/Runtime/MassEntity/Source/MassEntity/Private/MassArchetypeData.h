@@ -4,6 +4,7 @@
 
 #include "MassEntityManager.h"
 #include "MassArchetypeTypes.h"
+#include "MassChunkAllocator.h"
 
 struct FMassEntityQuery;
 struct FMassExecutionContext;
@@ -32,7 +33,7 @@ public:
 		, ChunkFragmentData(InChunkFragmentTemplates)
 		, SharedFragmentValues(InSharedFragmentValues)
 	{
-		RawMemory = (uint8*)FMemory::Malloc(AllocSize);
+		RawMemory = UE::Mass::FChunkAllocator::Get().Allocate(AllocSize);
 	}
 
 	~FMassArchetypeChunk()
@@ -40,7 +41,7 @@ public:
 		// Only release memory if it was not done already.
 		if (RawMemory != nullptr)
 		{
-			FMemory::Free(RawMemory);
+			UE::Mass::FChunkAllocator::Get().Free(RawMemory, AllocSize);
 			RawMemory = nullptr;
 		}
 	}
@@ -77,7 +78,7 @@ public:
 		// We are freeing the memory here to save memory
 		if (NumInstances == 0)
 		{
-			FMemory::Free(RawMemory);
+			UE::Mass::FChunkAllocator::Get().Free(RawMemory, AllocSize);
 			RawMemory = nullptr;
 		}
 	}
@@ -117,7 +118,7 @@ public:
 		// If this chunk previously had entity and it does not anymore, we might have to reallocate the memory as it was freed to save memory
 		if (RawMemory == nullptr)
 		{
-			RawMemory = (uint8*)FMemory::Malloc(AllocSize);
+			RawMemory = UE::Mass::FChunkAllocator::Get().Allocate(AllocSize);
 		}
 	}
 
@@ -0,0 +1,106 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "MassChunkAllocator.h"
+#include "MassArchetypeData.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Count.h"
+
+namespace UE::Mass
+{
+	namespace Private
+	{
+		bool bUseChunkAllocator = true;
+		FAutoConsoleVariableRef CVarUseChunkAllocator(TEXT("mass.ChunkAllocator.Enable"), bUseChunkAllocator
+			, TEXT("When enabled archetype chunks are allocated out of large contiguous memory regions rather than individually"), ECVF_Default);
+
+		static_assert(FChunkAllocator::RegionSize % UE::Mass::ChunkSize == 0, "Chunk allocator regions need to hold a whole number of chunks");
+		static_assert(FChunkAllocator::RegionSize / UE::Mass::ChunkSize <= 64, "Chunk allocator tracks the free chunks of a region with a 64 bit mask");
+
+		constexpr int32 NumChunksPerRegion = FChunkAllocator::RegionSize / UE::Mass::ChunkSize;
+		constexpr uint64 AllChunksFreeMask = NumChunksPerRegion == 64 ? ~uint64(0) : ((uint64(1) << NumChunksPerRegion) - 1);
+	}
+
+	FChunkAllocator& FChunkAllocator::Get()
+	{
+		static FChunkAllocator Instance;
+		return Instance;
+	}
+
+	uint8* FChunkAllocator::Allocate(const int32 Size)
+	{
+		if (Size != UE::Mass::ChunkSize || !Private::bUseChunkAllocator)
+		{
+			return (uint8*)FMemory::Malloc(Size);
+		}
+
+		FScopeLock Lock(&CriticalSection);
+
+		// filling the lowest regions first keeps the higher ones free so they can be released
+		FRegion* Region = Regions.FindByPredicate([](const FRegion& Candidate) { return Candidate.FreeChunks != 0; });
+		if (Region == nullptr)
+		{
+			LLM_SCOPE_BYNAME(TEXT("Mass/ChunkAllocator"));
+			FRegion NewRegion;
+			NewRegion.Memory = (uint8*)FMemory::Malloc(RegionSize, RegionSize);
+			NewRegion.FreeChunks = Private::AllChunksFreeMask;
+
+			const int32 InsertIndex = Algo::LowerBoundBy(Regions, NewRegion.Memory, &FRegion::Memory);
+			Regions.Insert(NewRegion, InsertIndex);
+			Region = &Regions[InsertIndex];
+		}
+
+		const int32 ChunkIndex = FMath::CountTrailingZeros64(Region->FreeChunks);
+		Region->FreeChunks &= ~(uint64(1) << ChunkIndex);
+		return Region->Memory + ChunkIndex * UE::Mass::ChunkSize;
+	}
+
+	void FChunkAllocator::Free(uint8* Memory, const int32 Size)
+	{
+		if (Memory == nullptr)
+		{
+			return;
+		}
+
+		if (Size == UE::Mass::ChunkSize)
+		{
+			FScopeLock Lock(&CriticalSection);
+			if (FRegion* Region = FindRegion(Memory))
+			{
+				const int32 ChunkIndex = int32((Memory - Region->Memory) / UE::Mass::ChunkSize);
+				check(Region->Memory + ChunkIndex * UE::Mass::ChunkSize == Memory);
+				checkf((Region->FreeChunks & (uint64(1) << ChunkIndex)) == 0, TEXT("Freeing a Mass chunk that is not allocated"));
+				Region->FreeChunks |= uint64(1) << ChunkIndex;
+
+				if (Region->FreeChunks == Private::AllChunksFreeMask)
+				{
+					const int32 NumFreeRegions = Algo::CountIf(Regions, [](const FRegion& Candidate) { return Candidate.FreeChunks == Private::AllChunksFreeMask; });
+					if (NumFreeRegions > 1)
+					{
+						FMemory::Free(Region->Memory);
+						Regions.RemoveAt(UE_PTRDIFF_TO_INT32(Region - Regions.GetData()));
+					}
+				}
+				return;
+			}
+		}
+
+		// allocated with the chunk allocator disabled
+		FMemory::Free(Memory);
+	}
+
+	SIZE_T FChunkAllocator::GetAllocatedSize() const
+	{
+		FScopeLock Lock(&CriticalSection);
+		return SIZE_T(Regions.Num()) * RegionSize;
+	}
+
+	FChunkAllocator::FRegion* FChunkAllocator::FindRegion(const uint8* Memory)
+	{
+		// regions are aligned to their size
+		uint8* RegionMemory = (uint8*)AlignDown(Memory, RegionSize);
+		const int32 RegionIndex = Algo::BinarySearchBy(Regions, RegionMemory, &FRegion::Memory);
+		return RegionIndex != INDEX_NONE ? &Regions[RegionIndex] : nullptr;
+	}
+} // namespace UE::Mass
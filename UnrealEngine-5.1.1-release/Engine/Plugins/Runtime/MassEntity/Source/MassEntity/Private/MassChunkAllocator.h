@@ -0,0 +1,43 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace UE::Mass
+{
+	/** 
+	 * Hands out archetype chunk memory carved out of large contiguous regions rather than a heap allocation per chunk. 
+	 * Regions are RegionSize bytes aligned to RegionSize, the usual huge page size, so that the OS can back them with 
+	 * huge pages and chunk memory of all archetypes stays packed together. A region is released once all of its chunks
+	 * are freed, except for one that is kept around to avoid churn when chunks get recycled. 
+	 * Memory of other sizes, or when mass.ChunkAllocator.Enable is 0, comes from FMemory. Thread safe.
+	 */
+	class FChunkAllocator
+	{
+	public:
+		static constexpr int32 RegionSize = 2 * 1024 * 1024;
+
+		static FChunkAllocator& Get();
+
+		uint8* Allocate(const int32 Size);
+		void Free(uint8* Memory, const int32 Size);
+
+		/** Total size of the regions currently allocated */
+		SIZE_T GetAllocatedSize() const;
+
+	private:
+		struct FRegion
+		{
+			uint8* Memory = nullptr;
+			/** Bit per chunk, set when the chunk is free */
+			uint64 FreeChunks = 0;
+		};
+
+		FRegion* FindRegion(const uint8* Memory);
+
+		mutable FCriticalSection CriticalSection;
+		/** Regions sorted by address */
+		TArray<FRegion> Regions;
+	};
+} // namespace UE::Mass
@@ -17,13 +17,40 @@
 #include "MassRequirementAccessDetector.h"
 #endif // WITH_MASSENTITY_DEBUG
 
+namespace UE::Mass::Private
+{
+	int32 ParallelQueryMinEntities = 4096;
+	FAutoConsoleVariableRef CVarParallelQueryMinEntities(TEXT("mass.ParallelQueryMinEntities"), ParallelQueryMinEntities
+		, TEXT("Minimum number of entities a query needs to match for ParallelForEachEntityChunk to process its chunks in parallel"), ECVF_Default);
+}
+
 
 //////////////////////////////////////////////////////////////////////
 // FMassEntityQuery
 
+struct FMassEntityQuery::FScopedSubsystemRequirementsRestore
+{
+	FScopedSubsystemRequirementsRestore(FMassExecutionContext& ExecutionContext)
+		: CachedExecutionContext(ExecutionContext)
+	{
+		ConstSubsystemsBitSet = ExecutionContext.ConstSubsystemsBitSet;
+		MutableSubsystemsBitSet = ExecutionContext.MutableSubsystemsBitSet;
+	}
+
+	~FScopedSubsystemRequirementsRestore()
+	{
+		CachedExecutionContext.ConstSubsystemsBitSet = ConstSubsystemsBitSet;
+		CachedExecutionContext.MutableSubsystemsBitSet = MutableSubsystemsBitSet;
+	}
+
+	FMassExecutionContext& CachedExecutionContext;
+	FMassExternalSubsystemBitSet ConstSubsystemsBitSet;
+	FMassExternalSubsystemBitSet MutableSubsystemsBitSet;
+};
+
 FMassEntityQuery::FMassEntityQuery()
 {
-	bAllowParallelExecution = false;
+	bAllowParallelExecution = true;
 	bRequiresGameThreadExecution = false;
 	bRequiresMutatingWorldAccess = false;
 
@@ -156,25 +183,6 @@ void FMassEntityQuery::ForEachEntityChunk(FMassEntityManager& EntityManager, FMa
 	EntityManager.GetRequirementAccessDetector().RequireAccess(*this);
 #endif
 
-	struct FScopedSubsystemRequirementsRestore
-	{
-		FScopedSubsystemRequirementsRestore(FMassExecutionContext& ExecutionContext)
-			: CachedExecutionContext(ExecutionContext)
-		{
-			ConstSubsystemsBitSet = ExecutionContext.ConstSubsystemsBitSet;
-			MutableSubsystemsBitSet = ExecutionContext.MutableSubsystemsBitSet;
-		}
-
-		~FScopedSubsystemRequirementsRestore()
-		{
-			CachedExecutionContext.ConstSubsystemsBitSet = ConstSubsystemsBitSet;
-			CachedExecutionContext.MutableSubsystemsBitSet = MutableSubsystemsBitSet;
-		}
-
-		FMassExecutionContext& CachedExecutionContext;
-		FMassExternalSubsystemBitSet ConstSubsystemsBitSet;
-		FMassExternalSubsystemBitSet MutableSubsystemsBitSet;
-	};
 	FScopedSubsystemRequirementsRestore SubsystemRestore(ExecutionContext);
 
 	ExecutionContext.SetSubsystemRequirements(*this);
@@ -234,6 +242,108 @@ void FMassEntityQuery::ForEachEntityChunk(FMassEntityManager& EntityManager, FMa
 	ExecutionContext.FlushDeferred();
 }
 
+bool FMassEntityQuery::CanProcessChunksInParallel() const
+{
+	if (!bAllowParallelExecution || DoesRequireGameThreadExecution() || !GetRequiredMutableSubsystems().IsEmpty())
+	{
+		return false;
+	}
+
+	for (const FMassFragmentRequirementDescription& Requirement : GetSharedFragmentRequirements())
+	{
+		if (Requirement.AccessMode == EMassFragmentAccess::ReadWrite)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void FMassEntityQuery::ParallelForEachEntityChunk(FMassEntityManager& EntityManager, FMassExecutionContext& ExecutionContext, const FMassExecuteFunction& ExecuteFunction)
+{
+	if (ExecutionContext.GetEntityCollection().IsSet() 
+		|| !CanProcessChunksInParallel() 
+		|| GetNumMatchingEntities(EntityManager) < UE::Mass::Private::ParallelQueryMinEntities)
+	{
+		ForEachEntityChunk(EntityManager, ExecutionContext, ExecuteFunction);
+		return;
+	}
+
+#if WITH_MASSENTITY_DEBUG
+	checkf(ExecutionContext.ExecutionType == ExpectedContextType && (ExpectedContextType == EMassExecutionContextType::Local || bRegistered)
+		, TEXT("ExecutionContextType mismatch, make sure all the queries run as part of processor execution are registered with some processor with a FMassEntityQuery::RegisterWithProcessor call"));
+
+	EntityManager.GetRequirementAccessDetector().RequireAccess(*this);
+#endif
+
+	FScopedSubsystemRequirementsRestore SubsystemRestore(ExecutionContext);
+
+	// archetypes have been cached by GetNumMatchingEntities
+	ExecutionContext.SetSubsystemRequirements(*this);
+	ExecutionContext.SetFragmentRequirements(*this);
+
+	struct FChunkToProcess
+	{
+		int32 ArchetypeIndex;
+		int32 ChunkIndex;
+	};
+	TArray<FChunkToProcess> ChunksToProcess;
+	for (int32 ArchetypeIndex = 0; ArchetypeIndex < ValidArchetypes.Num(); ++ArchetypeIndex)
+	{
+		const FMassArchetypeData& ArchetypeData = FMassArchetypeHelper::ArchetypeDataFromHandleChecked(ValidArchetypes[ArchetypeIndex]);
+		if (ArchetypeData.GetNumEntities() > 0)
+		{
+			for (int32 ChunkIndex = 0; ChunkIndex < ArchetypeData.GetChunkCount(); ++ChunkIndex)
+			{
+				ChunksToProcess.Add({ ArchetypeIndex, ChunkIndex });
+			}
+		}
+	}
+
+	// every worker gets its own copy of the context and command buffer
+	struct FTaskContext
+	{
+		FMassExecutionContext ExecutionContext;
+		TSharedPtr<FMassCommandBuffer> CommandBuffer;
+	};
+	TArray<FTaskContext> TaskContexts;
+
+	ParallelForWithTaskContext(TEXT("Mass ParallelForEachEntityChunk"), TaskContexts, ChunksToProcess.Num(), /*MinBatchSize=*/1
+		, [&ExecutionContext](int32 ContextIndex, int32 NumContexts)
+		{
+			FTaskContext TaskContext{ ExecutionContext, MakeShared<FMassCommandBuffer>() };
+			TaskContext.ExecutionContext.SetDeferredCommandBuffer(TaskContext.CommandBuffer);
+			TaskContext.ExecutionContext.SetFlushDeferredCommands(false);
+			return TaskContext;
+		}
+		, [this, &ChunksToProcess, &ExecuteFunction](FTaskContext& TaskContext, int32 Index)
+		{
+			const FChunkToProcess& Chunk = ChunksToProcess[Index];
+			FMassArchetypeData& ArchetypeData = FMassArchetypeHelper::ArchetypeDataFromHandleChecked(ValidArchetypes[Chunk.ArchetypeIndex]);
+			ArchetypeData.ExecutionFunctionForChunk(TaskContext.ExecutionContext, ExecuteFunction, ArchetypeFragmentMapping[Chunk.ArchetypeIndex]
+				, FMassArchetypeEntityCollection::FArchetypeEntityRange(Chunk.ChunkIndex), ChunkCondition);
+		});
+
+	for (FTaskContext& TaskContext : TaskContexts)
+	{
+		if (TaskContext.CommandBuffer->HasPendingCommands())
+		{
+			ExecutionContext.Defer().MoveAppend(*TaskContext.CommandBuffer);
+		}
+	}
+
+#if WITH_MASSENTITY_DEBUG
+	// Not using VLOG to be thread safe
+	UE_CLOG(!ExecutionContext.DebugGetExecutionDesc().IsEmpty(), LogMass, VeryVerbose,
+		TEXT("%s: %d chunks sent for parallel processing"), *ExecutionContext.DebugGetExecutionDesc(), ChunksToProcess.Num());
+
+	EntityManager.GetRequirementAccessDetector().ReleaseAccess(*this);
+#endif
+
+	ExecutionContext.ClearExecutionData();
+	ExecutionContext.FlushDeferred();
+}
+
 int32 FMassEntityQuery::GetNumMatchingEntities(FMassEntityManager& InEntityManager)
 {
 	CacheArchetypes(InEntityManager);
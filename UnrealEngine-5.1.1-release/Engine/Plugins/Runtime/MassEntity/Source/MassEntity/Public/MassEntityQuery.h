@@ -41,6 +41,21 @@ public:
 	/** Will first verify that the archetype given with Collection matches the query's requirements, and if so will run the other, more generic ForEachEntityChunk implementation */
 	void ForEachEntityChunk(const FMassArchetypeEntityCollection& Collection, FMassEntityManager& EntitySubsystem, FMassExecutionContext& ExecutionContext, const FMassExecuteFunction& ExecuteFunction);
 
+	/** 
+	 * Runs ExecuteFunction on all entities matching Requirements, spreading the chunks over task workers. ExecuteFunction
+	 * needs to be thread safe, commands pushed with Context.Defer() are gathered per worker and appended to ExecutionContext's
+	 * command buffer once all the chunks are done.
+	 * Falls back to ForEachEntityChunk when CanProcessChunksInParallel is false, when an entity collection is set on the context
+	 * or when less than mass.ParallelQueryMinEntities entities match.
+	 */
+	void ParallelForEachEntityChunk(FMassEntityManager& EntityManager, FMassExecutionContext& ExecutionContext, const FMassExecuteFunction& ExecuteFunction);
+
+	/** 
+	 * Chunks can be processed in parallel when they only share read only data, i.e. when the query requires neither the game
+	 * thread, mutable shared fragments nor mutable subsystems. Entity and chunk fragments are stored per chunk so are fine to write.
+	 */
+	bool CanProcessChunksInParallel() const;
+
 	/** Will gather all archetypes from InEntityManager matching this->Requirements.
 	 *  Note that no work will be done if the cached data is up to date (as tracked by EntitySubsystemHash and 
 	 *	ArchetypeDataVersion properties). */
@@ -109,6 +124,8 @@ public:
 protected:
 	void ReadCommandlineParams();
 
+	struct FScopedSubsystemRequirementsRestore;
+
 private:
 	/** 
 	 * This function represents a condition that will be called for every chunk to be processed before the actual 
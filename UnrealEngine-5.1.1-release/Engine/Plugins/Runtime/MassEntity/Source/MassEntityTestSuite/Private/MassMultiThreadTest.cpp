@@ -180,6 +180,56 @@ struct FMTBasic : FMTTestBase
 };
 IMPLEMENT_AI_LATENT_TEST(FMTBasic, "System.Mass.Multithreading.Basic");
 
+
+struct FMTParallelChunks : FMTTestBase
+{
+	using Super = FMTTestBase;
+	const int32 NumToCreate = 10000;
+	std::atomic<int32> NumProcessed = 0;
+
+	virtual bool SetUp() override
+	{
+		if (!Super::SetUp())
+		{
+			return false;
+		}
+
+		EntityManager->BatchCreateEntities(IntsArchetype, NumToCreate, Entities);
+
+		Processors.Reset();
+		{
+			UMassTestProcessorBase* Proc = Processors.Add_GetRef(NewObject<UMassTestProcessor_A>());
+
+			Proc->TestGetQuery().AddRequirement<FTestFragment_Int>(EMassFragmentAccess::ReadWrite);
+			Proc->ExecutionFunction = [this, Proc](FMassEntityManager& InEntitySubsystem, FMassExecutionContext& Context)
+			{
+				Proc->TestGetQuery().ParallelForEachEntityChunk(InEntitySubsystem, Context, [this](FMassExecutionContext& Context)
+					{
+						const TArrayView<FTestFragment_Int> IntsList = Context.GetMutableFragmentView<FTestFragment_Int>();
+						for (int32 i = 0; i < Context.GetNumEntities(); ++i)
+						{
+							IntsList[i].Value += 1;
+						}
+						NumProcessed += Context.GetNumEntities();
+					});
+			};
+		}
+
+		return true;
+	}
+
+	virtual void VerifyResults()
+	{
+		AITEST_EQUAL_LATENT("Expected to process all the created entities.", NumToCreate, NumProcessed.load());
+		for (int i = 0; i < Entities.Num(); ++i)
+		{
+			FMassEntityView View(IntsArchetype, Entities[i]);
+			AITEST_EQUAL_LATENT(TEXT("Every entity should be processed exactly once"), View.GetFragmentData<FTestFragment_Int>().Value, 1);
+		}
+	}
+};
+IMPLEMENT_AI_LATENT_TEST(FMTParallelChunks, "System.Mass.Multithreading.ParallelChunks");
+
 } // FMassMultiThreadingTest
 
 PRAGMA_ENABLE_OPTIMIZATION
@@ -9,6 +9,11 @@ namespace UE::Mass::Replication
 {
 	int32 DebugClientReplicationLOD = -1;
 	FAutoConsoleVariableRef CVarDebugReplicationViewerLOD(TEXT("ai.debug.ClientReplicationLOD"), DebugClientReplicationLOD, TEXT("Debug Replication LOD of the specified client index"), ECVF_Cheat);
+
+	int32 MaxClientsPerFrame = 0;
+	FAutoConsoleVariableRef CVarMaxClientsPerFrame(TEXT("ai.replication.MaxClientsPerFrame"), MaxClientsPerFrame
+		, TEXT("Maximum number of clients whose replication bubbles are updated per frame, going round robin over the clients. 0 updates all clients every frame. ")
+		TEXT("Agents are updated based on their LOD update interval so skipped clients only see their updates delayed by the frames skipped."), ECVF_Default);
 } // UE::Mass::Crowd
 
 //----------------------------------------------------------------------//
@@ -171,8 +176,16 @@ void UMassReplicationProcessor::Execute(FMassEntityManager& EntityManager, FMass
 	const UMassLODSubsystem& LODSubsystem = Context.GetSubsystemChecked<UMassLODSubsystem>(EntityManager.GetWorld());
 	const TArray<FViewerInfo>& AllViewersInfo = LODSubsystem.GetViewers();
 	const TArray<FMassClientHandle>& ClientHandles = ReplicationSubsystem->GetClientReplicationHandles();
-	for (const FMassClientHandle ClientHandle : ClientHandles)
+
+	// Time slice the clients when there are more than we are allowed to process in a frame
+	const int32 NumClients = ClientHandles.Num();
+	const int32 NumClientsToProcess = UE::Mass::Replication::MaxClientsPerFrame > 0 ? FMath::Min(UE::Mass::Replication::MaxClientsPerFrame, NumClients) : NumClients;
+	const int32 FirstClientToProcess = NumClientsToProcess < NumClients ? (NextClientToProcess % NumClients) : 0;
+	NextClientToProcess = NumClients > 0 ? (FirstClientToProcess + NumClientsToProcess) % NumClients : 0;
+
+	for (int32 ClientCount = 0; ClientCount < NumClientsToProcess; ++ClientCount)
 	{
+		const FMassClientHandle ClientHandle = ClientHandles[(FirstClientToProcess + ClientCount) % NumClients];
 		if (ReplicationSubsystem->IsValidClientHandle(ClientHandle) == false)
 		{
 			continue;
@@ -223,6 +236,7 @@ void UMassReplicationProcessor::Execute(FMassEntityManager& EntityManager, FMass
 
 				FMassArchetypeHandle Archetype;
 				TArray<FMassEntityHandle> Entities;
+				FMassArchetypeEntityCollection Collection;
 			};
 			TArray<FEntitySet> EntitySets;
 
@@ -252,6 +266,15 @@ void UMassReplicationProcessor::Execute(FMassEntityManager& EntityManager, FMass
 			BuildEntitySet(ClientReplicationInfo.HandledEntities);
 			BuildEntitySet(EntitiesInRange);
 
+			// Sorting out the entities into chunk ranges is done once as the same collection is used by both passes below
+			for (FEntitySet& Set : EntitySets)
+			{
+				if (Set.Entities.Num() > 0)
+				{
+					Set.Collection = FMassArchetypeEntityCollection(Set.Archetype, Set.Entities, FMassArchetypeEntityCollection::FoldDuplicates);
+				}
+			}
+
 			for (FEntitySet& Set : EntitySets)
 			{
 				if (Set.Entities.Num() == 0)
@@ -259,7 +282,7 @@ void UMassReplicationProcessor::Execute(FMassEntityManager& EntityManager, FMass
 					continue;
 				}
 
-				Context.SetEntityCollection(FMassArchetypeEntityCollection(Set.Archetype, Set.Entities, FMassArchetypeEntityCollection::FoldDuplicates));
+				Context.SetEntityCollection(Set.Collection);
 
 				{
 					QUICK_SCOPE_CYCLE_COUNTER(UMassReplicationProcessor_SyncToMass);
@@ -327,7 +350,7 @@ void UMassReplicationProcessor::Execute(FMassEntityManager& EntityManager, FMass
 				{
 					continue;
 				}
-				Context.SetEntityCollection(FMassArchetypeEntityCollection(Set.Archetype, Set.Entities, FMassArchetypeEntityCollection::FoldDuplicates));
+				Context.SetEntityCollection(Set.Collection);
 
 				{
 					QUICK_SCOPE_CYCLE_COUNTER(UMassReplicationProcessor_LODAdjustLODFromCount);
@@ -46,6 +46,9 @@ protected:
 	FMassEntityQuery CalculateLODQuery;
 	FMassEntityQuery AdjustLODDistancesQuery;
 	FMassEntityQuery EntityQuery;
+
+	/** Index in the client handles of the first client to process next frame when ai.replication.MaxClientsPerFrame limits the clients processed */
+	int32 NextClientToProcess = 0;
 };
 
 
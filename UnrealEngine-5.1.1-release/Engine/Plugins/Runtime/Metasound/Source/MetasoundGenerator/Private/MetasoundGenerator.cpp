@@ -14,6 +14,9 @@
 #include "MetasoundTrace.h"
 #include "MetasoundTrigger.h"
 #include "MetasoundVertexData.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+CSV_DEFINE_CATEGORY(MetaSound, true);
 
 
 namespace Metasound
@@ -21,6 +24,8 @@ namespace Metasound
 	namespace ConsoleVariables
 	{
 		static bool bEnableAsyncMetaSoundGeneratorBuilder = true;
+		static bool bEnableCPUCoreUtilization = true;
+		static float CPUCoreUtilizationSmoothing = 0.1f;
 	}
 }
 
@@ -31,6 +36,20 @@ FAutoConsoleVariableRef CVarMetaSoundEnableAsyncGeneratorBuilder(
 	TEXT("Default: true"),
 	ECVF_Default);
 
+FAutoConsoleVariableRef CVarMetaSoundEnableCPUCoreUtilization(
+	TEXT("au.MetaSound.Profiling.EnableCPUCoreUtilization"),
+	Metasound::ConsoleVariables::bEnableCPUCoreUtilization,
+	TEXT("Measures the CPU core utilization of each MetaSound generator, summed in the MetaSound CSV category\n")
+	TEXT("Default: true"),
+	ECVF_Default);
+
+FAutoConsoleVariableRef CVarMetaSoundCPUCoreUtilizationSmoothing(
+	TEXT("au.MetaSound.Profiling.CPUCoreUtilizationSmoothing"),
+	Metasound::ConsoleVariables::CPUCoreUtilizationSmoothing,
+	TEXT("Weight of the last rendered block in the smoothed CPU core utilization of MetaSound generators, in (0, 1]\n")
+	TEXT("Default: 0.1"),
+	ECVF_Default);
+
 
 namespace Metasound
 {
@@ -202,6 +221,8 @@ namespace Metasound
 		, NumChannels(0)
 		, NumFramesPerExecute(0)
 		, NumSamplesPerExecute(0)
+		, SampleRate(InParams.OperatorSettings.GetSampleRate())
+		, CPUCoreUtilization(0.)
 		, OnPlayTriggerRef(FTriggerWriteRef::CreateNew(InParams.OperatorSettings))
 		, OnFinishedTriggerRef(FTriggerWriteRef::CreateNew(InParams.OperatorSettings))
 		, bPendingGraphTrigger(true)
@@ -338,6 +359,11 @@ namespace Metasound
 		return NumChannels;
 	}
 
+	double FMetasoundGenerator::GetCPUCoreUtilization() const
+	{
+		return CPUCoreUtilization.load(std::memory_order_relaxed);
+	}
+
 	int32 FMetasoundGenerator::OnGenerateAudio(float* OutAudio, int32 NumSamplesRemaining)
 	{
 		METASOUND_TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*FString::Printf(TEXT("MetasoundGenerator::OnGenerateAudio %s"), *MetasoundName));
@@ -382,6 +408,10 @@ namespace Metasound
 			OverflowBuffer.RemoveAtSwap(0 /* Index */, NumSamplesWritten /* Count */, false /* bAllowShrinking */);
 		}
 
+		const bool bMeasureCPUCoreUtilization = ConsoleVariables::bEnableCPUCoreUtilization && SampleRate > 0.f;
+		const uint64 StartCycles = bMeasureCPUCoreUtilization ? FPlatformTime::Cycles64() : 0;
+		int32 NumBlocksExecuted = 0;
+
 		while (NumSamplesRemaining > 0)
 		{
 			// Call metasound graph operator.
@@ -391,6 +421,7 @@ namespace Metasound
 			{
 				GraphAnalyzer->Execute();
 			}
+			++NumBlocksExecuted;
 
 			// Check if generated finished during this execute call
 			if (*OnFinishedTriggerRef)
@@ -421,6 +452,17 @@ namespace Metasound
 			}
 		}
 
+		if (bMeasureCPUCoreUtilization && NumBlocksExecuted > 0)
+		{
+			const double ExecuteSeconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+			const double AudioSeconds = static_cast<double>(NumBlocksExecuted * NumFramesPerExecute) / SampleRate;
+			const double Smoothing = FMath::Clamp(static_cast<double>(ConsoleVariables::CPUCoreUtilizationSmoothing), UE_DOUBLE_SMALL_NUMBER, 1.);
+			const double PreviousUtilization = CPUCoreUtilization.load(std::memory_order_relaxed);
+			CPUCoreUtilization.store(FMath::Lerp(PreviousUtilization, ExecuteSeconds / AudioSeconds, Smoothing), std::memory_order_relaxed);
+
+			CSV_CUSTOM_STAT(MetaSound, GeneratorCPUCoreUtilization, static_cast<float>(ExecuteSeconds / AudioSeconds), ECsvCustomStatOp::Accumulate);
+		}
+
 		return NumSamplesWritten;
 	}
 
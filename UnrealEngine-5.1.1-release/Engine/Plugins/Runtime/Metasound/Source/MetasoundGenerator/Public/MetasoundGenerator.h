@@ -18,6 +18,8 @@
 #include "Sound/SoundGenerator.h"
 #include "Tickable.h"
 
+#include <atomic>
+
 
 namespace Metasound
 {
@@ -142,6 +144,11 @@ namespace Metasound
 		/** Return the number of audio channels. */
 		int32 GetNumChannels() const;
 
+		/** Fraction of a CPU core spent executing the graph relative to the duration of the rendered audio, smoothed over the last blocks.
+		 * Safe to call from any thread. Only updated while au.MetaSound.Profiling.EnableCPUCoreUtilization is set.
+		 */
+		double GetCPUCoreUtilization() const;
+
 		//~ Begin FSoundGenerator
 		virtual int32 OnGenerateAudio(float* OutAudio, int32 NumSamples) override;
 		int32 GetDesiredNumSamplesToRenderPerCallback() const override;
@@ -181,6 +188,9 @@ namespace Metasound
 		int32 NumChannels;
 		int32 NumFramesPerExecute;
 		int32 NumSamplesPerExecute;
+		float SampleRate;
+
+		std::atomic<double> CPUCoreUtilization;
 
 		TArray<FAudioBufferReadRef> GraphOutputAudio;
 
@@ -61,6 +61,7 @@
 #include "Net/NetworkGranularMemoryLogging.h"
 #include "Net/Core/Trace/NetTrace.h"
 #include "Engine/ServerStatReplicator.h"
+#include "Async/ParallelFor.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(ReplicationGraph)
 
@@ -5895,6 +5896,527 @@ void UReplicationGraphNode_GridSpatialization2D::NotifyActorCullDistChange(AActo
 
 // -------------------------------------------------------
 
+int32 CVar_RepGraph_PackedSpatialization_ParallelGather = 0;
+static FAutoConsoleVariableRef CVarRepGraphPackedSpatializationParallelGather(TEXT("Net.RepGraph.PackedSpatialization.ParallelGather"), CVar_RepGraph_PackedSpatialization_ParallelGather,
+	TEXT("When > 0, UReplicationGraphNode_PackedSpatialization2D gathers for all connections in parallel if at least this many connections replicate in the frame."), ECVF_Default);
+
+namespace RepGraphPackedSpatialization
+{
+	// Limits the memory of the cell arrays on very large maps, cells grow instead
+	constexpr int32 MaxCellsPerAxis = 256;
+
+	// The actor arrays are read 4 at a time
+	constexpr int32 NumPadding = 3;
+}
+
+UReplicationGraphNode_PackedSpatialization2D::UReplicationGraphNode_PackedSpatialization2D()
+{
+	bRequiresPrepareForReplicationCall = true;
+}
+
+void UReplicationGraphNode_PackedSpatialization2D::FSortedActors::Reset(int32 NumActors)
+{
+	const int32 NumPadded = NumActors + RepGraphPackedSpatialization::NumPadding;
+
+	Actors.SetNumUninitialized(NumActors, false);
+	StreamingLevelNames.SetNumUninitialized(NumActors, false);
+	X.SetNumZeroed(NumPadded, false);
+	Y.SetNumZeroed(NumPadded, false);
+	Z.SetNumZeroed(NumPadded, false);
+	CullDistSq.SetNumZeroed(NumPadded, false);
+}
+
+void UReplicationGraphNode_PackedSpatialization2D::FSortedActors::CountBytes(FArchive& Ar) const
+{
+	Actors.CountBytes(Ar);
+	StreamingLevelNames.CountBytes(Ar);
+	X.CountBytes(Ar);
+	Y.CountBytes(Ar);
+	Z.CountBytes(Ar);
+	CullDistSq.CountBytes(Ar);
+	CellStart.CountBytes(Ar);
+	CellMaxCullDist.CountBytes(Ar);
+}
+
+void UReplicationGraphNode_PackedSpatialization2D::Serialize(FArchive& Ar)
+{
+	Super::Serialize(Ar);
+
+	if (Ar.IsCountingMemory())
+	{
+		GRANULAR_NETWORK_MEMORY_TRACKING_INIT(Ar, "UReplicationGraphNode_PackedSpatialization2D::Serialize");
+
+		GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("Actors", Actors.CountBytes(Ar));
+		GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("StreamingLevelNames", StreamingLevelNames.CountBytes(Ar));
+		GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("ActorIndices", ActorIndices.CountBytes(Ar));
+		GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("ScratchData",
+			Locations.CountBytes(Ar);
+			CullDistSq.CountBytes(Ar);
+			ActorCells.CountBytes(Ar);
+			CellCursors.CountBytes(Ar);
+		);
+		GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("NoCullActors",
+			NoCullActors.CountBytes(Ar);
+			NoCullStreamingLevelActors.CountBytes(Ar);
+		);
+		GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("Sorted", Sorted.CountBytes(Ar));
+		GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("ConnectionGathers",
+			ConnectionGathers.CountBytes(Ar);
+			for (const FConnectionGather& Gather : ConnectionGathers)
+			{
+				Gather.Viewers.CountBytes(Ar);
+				Gather.ReplicationList.CountBytes(Ar);
+				Gather.StreamingLevelActors.CountBytes(Ar);
+			}
+		);
+		GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("InlineLists",
+			InlineReplicationList.CountBytes(Ar);
+			InlineStreamingLevelActors.CountBytes(Ar);
+			StreamingLevelReplicationList.CountBytes(Ar);
+		);
+	}
+}
+
+void UReplicationGraphNode_PackedSpatialization2D::NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo)
+{
+	UE_CLOG(CVar_RepGraph_LogActorAdd>0, LogReplicationGraph, Display, TEXT("UReplicationGraphNode_PackedSpatialization2D::NotifyAddNetworkActor %s on %s."), *ActorInfo.Actor->GetFullName(), *GetPathName());
+
+	if (ActorIndices.Contains(ActorInfo.Actor))
+	{
+		ensureMsgf(false, TEXT("%s being added to %s twice!"), *GetActorRepListTypeDebugString(ActorInfo.Actor), *GetPathName());
+		return;
+	}
+
+	ActorIndices.Add(ActorInfo.Actor, Actors.Num());
+	Actors.Add(ActorInfo.Actor);
+	StreamingLevelNames.Add(ActorInfo.StreamingLevelName);
+}
+
+bool UReplicationGraphNode_PackedSpatialization2D::NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound)
+{
+	int32 Index = INDEX_NONE;
+	if (!ActorIndices.RemoveAndCopyValue(ActorInfo.Actor, Index))
+	{
+		UE_CLOG(bWarnIfNotFound, LogReplicationGraph, Warning, TEXT("Attempted to remove %s from %s but it was not found."), *GetActorRepListTypeDebugString(ActorInfo.Actor), *GetPathName());
+		return false;
+	}
+
+	Actors.RemoveAtSwap(Index, 1, false);
+	StreamingLevelNames.RemoveAtSwap(Index, 1, false);
+	if (Actors.IsValidIndex(Index))
+	{
+		ActorIndices.FindChecked(Actors[Index]) = Index;
+	}
+
+	// Actors removed during replication are still referenced by the data prepared for this frame
+	UReplicationGraph* RepGraph = GraphGlobals.IsValid() ? GraphGlobals->ReplicationGraph : nullptr;
+	if (RepGraph && RepGraph->GetReplicationGraphFrame() == PreparedFrame)
+	{
+		const int32 SortedIndex = Sorted.Actors.Find(ActorInfo.Actor);
+		if (SortedIndex != INDEX_NONE)
+		{
+			Sorted.CullDistSq[SortedIndex] = -1.f;
+		}
+
+		for (int32 GatherIndex = 0; GatherIndex < NumConnectionGathers; ++GatherIndex)
+		{
+			ConnectionGathers[GatherIndex].ReplicationList.RemoveFast(ActorInfo.Actor);
+			ConnectionGathers[GatherIndex].StreamingLevelActors.RemoveFast(ActorInfo.Actor);
+		}
+		NoCullActors.RemoveFast(ActorInfo.Actor);
+		NoCullStreamingLevelActors.RemoveFast(ActorInfo.Actor);
+	}
+
+	return true;
+}
+
+void UReplicationGraphNode_PackedSpatialization2D::NotifyResetAllNetworkActors()
+{
+	Actors.Reset();
+	StreamingLevelNames.Reset();
+	ActorIndices.Reset();
+	NoCullActors.Reset();
+	NoCullStreamingLevelActors.Reset();
+	Sorted.Reset(0);
+	Sorted.CellStart.Reset();
+	Sorted.CellMaxCullDist.Reset();
+	Sorted.NumCellsX = 0;
+	Sorted.NumCellsY = 0;
+	NumConnectionGathers = 0;
+
+	Super::NotifyResetAllNetworkActors();
+}
+
+void UReplicationGraphNode_PackedSpatialization2D::PrepareForReplication()
+{
+#if WITH_SERVER_CODE
+	RG_QUICK_SCOPE_CYCLE_COUNTER(UReplicationGraphNode_PackedSpatialization2D_PrepareForReplication);
+
+	FGlobalActorReplicationInfoMap* GlobalRepMap = GraphGlobals.IsValid() ? GraphGlobals->GlobalActorReplicationInfoMap : nullptr;
+	if (!GlobalRepMap)
+	{
+		return;
+	}
+
+	NumConnectionGathers = 0;
+	NoCullActors.Reset();
+	NoCullStreamingLevelActors.Reset();
+	PreparedFrame = GraphGlobals->ReplicationGraph->GetReplicationGraphFrame();
+
+	// -------------------------------------------
+	//	Update locations and cull distances
+	// -------------------------------------------
+	const int32 NumActors = Actors.Num();
+	Locations.SetNumUninitialized(NumActors, false);
+	CullDistSq.SetNumUninitialized(NumActors, false);
+	ActorCells.SetNumUninitialized(NumActors, false);
+
+	FVector2f GridMin(UE_BIG_NUMBER);
+	FVector2f GridMax(-UE_BIG_NUMBER);
+	int32 NumGridActors = 0;
+
+	for (int32 Index = 0; Index < NumActors; ++Index)
+	{
+		AActor* Actor = Actors[Index];
+		ActorCells[Index] = INDEX_NONE;
+
+		if (!IsActorValidForReplicationGather(Actor))
+		{
+			continue;
+		}
+
+		FGlobalActorReplicationInfo& ActorRepInfo = GlobalRepMap->Get(Actor);
+		const FVector Location3D = Actor->GetActorLocation();
+		ActorRepInfo.WorldLocation = Location3D;
+
+		const float ActorCullDistSq = ActorRepInfo.Settings.GetCullDistanceSquared();
+		if (ActorCullDistSq <= 0.f)
+		{
+			(StreamingLevelNames[Index] == NAME_None ? NoCullActors : NoCullStreamingLevelActors).Add(Actor);
+			continue;
+		}
+
+		const FVector3f Location(Location3D);
+		Locations[Index] = Location;
+		CullDistSq[Index] = ActorCullDistSq;
+		ActorCells[Index] = 0;
+
+		GridMin = FVector2f::Min(GridMin, FVector2f(Location.X, Location.Y));
+		GridMax = FVector2f::Max(GridMax, FVector2f(Location.X, Location.Y));
+		++NumGridActors;
+	}
+
+	// -------------------------------------------
+	//	Sort the actors by cell
+	// -------------------------------------------
+	{
+		RG_QUICK_SCOPE_CYCLE_COUNTER(UReplicationGraphNode_PackedSpatialization2D_Sort);
+
+		Sorted.Reset(NumGridActors);
+		Sorted.MaxCullDist = 0.f;
+
+		if (NumGridActors == 0)
+		{
+			Sorted.NumCellsX = 0;
+			Sorted.NumCellsY = 0;
+			Sorted.CellStart.Reset();
+			Sorted.CellMaxCullDist.Reset();
+		}
+		else
+		{
+			const FVector2f Extent = GridMax - GridMin;
+			const float MinCellSize = FMath::Max(Extent.X, Extent.Y) / RepGraphPackedSpatialization::MaxCellsPerAxis;
+
+			Sorted.GridOrigin = FVector2D(GridMin);
+			Sorted.GridCellSize = FMath::Max3(CellSize, MinCellSize, 1.f);
+			Sorted.NumCellsX = FMath::Min(FMath::FloorToInt32(Extent.X / Sorted.GridCellSize) + 1, RepGraphPackedSpatialization::MaxCellsPerAxis);
+			Sorted.NumCellsY = FMath::Min(FMath::FloorToInt32(Extent.Y / Sorted.GridCellSize) + 1, RepGraphPackedSpatialization::MaxCellsPerAxis);
+
+			const int32 NumCells = Sorted.NumCellsX * Sorted.NumCellsY;
+			Sorted.CellStart.SetNumZeroed(NumCells + 1, false);
+			Sorted.CellMaxCullDist.SetNumZeroed(NumCells, false);
+
+			const float InvCellSize = 1.f / Sorted.GridCellSize;
+			for (int32 Index = 0; Index < NumActors; ++Index)
+			{
+				if (ActorCells[Index] != INDEX_NONE)
+				{
+					const int32 CellX = FMath::Min(FMath::FloorToInt32((Locations[Index].X - GridMin.X) * InvCellSize), Sorted.NumCellsX - 1);
+					const int32 CellY = FMath::Min(FMath::FloorToInt32((Locations[Index].Y - GridMin.Y) * InvCellSize), Sorted.NumCellsY - 1);
+					const int32 Cell = CellY * Sorted.NumCellsX + CellX;
+					ActorCells[Index] = Cell;
+					++Sorted.CellStart[Cell + 1];
+
+					const float CullDist = FMath::Sqrt(CullDistSq[Index]);
+					Sorted.CellMaxCullDist[Cell] = FMath::Max(Sorted.CellMaxCullDist[Cell], CullDist);
+					Sorted.MaxCullDist = FMath::Max(Sorted.MaxCullDist, CullDist);
+				}
+			}
+
+			for (int32 Cell = 0; Cell < NumCells; ++Cell)
+			{
+				Sorted.CellStart[Cell + 1] += Sorted.CellStart[Cell];
+			}
+
+			CellCursors = Sorted.CellStart;
+			for (int32 Index = 0; Index < NumActors; ++Index)
+			{
+				const int32 Cell = ActorCells[Index];
+				if (Cell != INDEX_NONE)
+				{
+					const int32 SortedIndex = CellCursors[Cell]++;
+					Sorted.Actors[SortedIndex] = Actors[Index];
+					Sorted.StreamingLevelNames[SortedIndex] = StreamingLevelNames[Index];
+					Sorted.X[SortedIndex] = Locations[Index].X;
+					Sorted.Y[SortedIndex] = Locations[Index].Y;
+					Sorted.Z[SortedIndex] = Locations[Index].Z;
+					Sorted.CullDistSq[SortedIndex] = CullDistSq[Index];
+				}
+			}
+		}
+	}
+
+	if (CVar_RepGraph_PackedSpatialization_ParallelGather > 0)
+	{
+		GatherConnectionsInParallel();
+	}
+#endif // WITH_SERVER_CODE
+}
+
+void UReplicationGraphNode_PackedSpatialization2D::GatherConnectionsInParallel()
+{
+	UReplicationGraph* RepGraph = GraphGlobals->ReplicationGraph;
+	if (!RepGraph || RepGraph->Connections.Num() < CVar_RepGraph_PackedSpatialization_ParallelGather)
+	{
+		return;
+	}
+
+	RG_QUICK_SCOPE_CYCLE_COUNTER(UReplicationGraphNode_PackedSpatialization2D_ParallelGather);
+
+	// Viewers are built on the game thread the same way the graph builds them for the gather
+	for (UNetReplicationGraphConnection* ConnectionManager : RepGraph->Connections)
+	{
+		UNetConnection* NetConnection = ConnectionManager->NetConnection;
+
+		// Replays view from all other connections, they are gathered when the graph asks for them
+		if (NetConnection->IsReplay() || !ConnectionManager->PrepareForReplication())
+		{
+			continue;
+		}
+
+		if (ConnectionGathers.Num() <= NumConnectionGathers)
+		{
+			ConnectionGathers.AddDefaulted();
+		}
+
+		FConnectionGather& Gather = ConnectionGathers[NumConnectionGathers++];
+		Gather.ConnectionManager = ConnectionManager;
+		Gather.Viewers.Reset();
+		Gather.Viewers.Emplace(NetConnection, 0.f);
+
+		for (UNetConnection* ChildConnection : NetConnection->Children)
+		{
+			if (ChildConnection && ChildConnection->PlayerController && ChildConnection->ViewTarget)
+			{
+				Gather.Viewers.Emplace(ChildConnection, 0.f);
+			}
+		}
+	}
+
+	if (NumConnectionGathers < CVar_RepGraph_PackedSpatialization_ParallelGather)
+	{
+		NumConnectionGathers = 0;
+		return;
+	}
+
+	ParallelFor(NumConnectionGathers, [this](int32 Index)
+	{
+		FConnectionGather& Gather = ConnectionGathers[Index];
+		GatherActors(Gather.Viewers, Gather.ReplicationList, Gather.StreamingLevelActors);
+	});
+
+}
+
+void UReplicationGraphNode_PackedSpatialization2D::GatherActors(const FNetViewerArray& Viewers, FActorRepListRefView& OutReplicationList, FActorRepListRefView& OutStreamingLevelActors) const
+{
+	OutReplicationList.Reset();
+	OutStreamingLevelActors.Reset();
+
+	if (Sorted.NumCellsX == 0 || Viewers.Num() == 0)
+	{
+		return;
+	}
+
+	const float InvCellSize = 1.f / Sorted.GridCellSize;
+	const FVector2f GridOrigin(Sorted.GridOrigin);
+
+	TArray<FVector3f, FReplicationGraphConnectionsAllocator> ViewLocations;
+	ViewLocations.Reserve(Viewers.Num());
+
+	// Cells outside of this rect are further than the largest cull distance from every viewer
+	int32 MinCellX = MAX_int32;
+	int32 MinCellY = MAX_int32;
+	int32 MaxCellX = MIN_int32;
+	int32 MaxCellY = MIN_int32;
+	for (const FNetViewer& Viewer : Viewers)
+	{
+		const FVector3f ViewLocation(Viewer.ViewLocation);
+		ViewLocations.Add(ViewLocation);
+
+		MinCellX = FMath::Min(MinCellX, FMath::FloorToInt32((ViewLocation.X - Sorted.MaxCullDist - GridOrigin.X) * InvCellSize));
+		MinCellY = FMath::Min(MinCellY, FMath::FloorToInt32((ViewLocation.Y - Sorted.MaxCullDist - GridOrigin.Y) * InvCellSize));
+		MaxCellX = FMath::Max(MaxCellX, FMath::FloorToInt32((ViewLocation.X + Sorted.MaxCullDist - GridOrigin.X) * InvCellSize));
+		MaxCellY = FMath::Max(MaxCellY, FMath::FloorToInt32((ViewLocation.Y + Sorted.MaxCullDist - GridOrigin.Y) * InvCellSize));
+	}
+
+	MinCellX = FMath::Max(MinCellX, 0);
+	MinCellY = FMath::Max(MinCellY, 0);
+	MaxCellX = FMath::Min(MaxCellX, Sorted.NumCellsX - 1);
+	MaxCellY = FMath::Min(MaxCellY, Sorted.NumCellsY - 1);
+
+	const float* RESTRICT SortedX = Sorted.X.GetData();
+	const float* RESTRICT SortedY = Sorted.Y.GetData();
+	const float* RESTRICT SortedZ = Sorted.Z.GetData();
+	const float* RESTRICT SortedCullDistSq = Sorted.CullDistSq.GetData();
+
+	for (int32 CellY = MinCellY; CellY <= MaxCellY; ++CellY)
+	{
+		const float CellMinY = GridOrigin.Y + CellY * Sorted.GridCellSize;
+
+		for (int32 CellX = MinCellX; CellX <= MaxCellX; ++CellX)
+		{
+			const int32 Cell = CellY * Sorted.NumCellsX + CellX;
+			const int32 Start = Sorted.CellStart[Cell];
+			const int32 End = Sorted.CellStart[Cell + 1];
+			if (Start == End)
+			{
+				continue;
+			}
+
+			// Skip the cell if no actor in it can be in range of a viewer
+			const float CellMinX = GridOrigin.X + CellX * Sorted.GridCellSize;
+			const float CellMaxX = CellMinX + Sorted.GridCellSize;
+			const float CellMaxY = CellMinY + Sorted.GridCellSize;
+			const float CellMaxCullDistSq = FMath::Square(Sorted.CellMaxCullDist[Cell]);
+
+			bool bCellInRange = false;
+			for (const FVector3f& ViewLocation : ViewLocations)
+			{
+				const float DeltaX = FMath::Max3(CellMinX - ViewLocation.X, ViewLocation.X - CellMaxX, 0.f);
+				const float DeltaY = FMath::Max3(CellMinY - ViewLocation.Y, ViewLocation.Y - CellMaxY, 0.f);
+				if (DeltaX * DeltaX + DeltaY * DeltaY <= CellMaxCullDistSq)
+				{
+					bCellInRange = true;
+					break;
+				}
+			}
+
+			if (!bCellInRange)
+			{
+				continue;
+			}
+
+			for (int32 Index = Start; Index < End; Index += 4)
+			{
+				const VectorRegister4Float ActorX = VectorLoad(SortedX + Index);
+				const VectorRegister4Float ActorY = VectorLoad(SortedY + Index);
+				const VectorRegister4Float ActorZ = VectorLoad(SortedZ + Index);
+				const VectorRegister4Float ActorCullDistSq = VectorLoad(SortedCullDistSq + Index);
+
+				uint32 InRangeMask = 0;
+				for (const FVector3f& ViewLocation : ViewLocations)
+				{
+					const VectorRegister4Float DeltaX = VectorSubtract(ActorX, VectorSetFloat1(ViewLocation.X));
+					const VectorRegister4Float DeltaY = VectorSubtract(ActorY, VectorSetFloat1(ViewLocation.Y));
+					const VectorRegister4Float DeltaZ = VectorSubtract(ActorZ, VectorSetFloat1(ViewLocation.Z));
+
+					VectorRegister4Float DistSq = VectorMultiply(DeltaX, DeltaX);
+					DistSq = VectorMultiplyAdd(DeltaY, DeltaY, DistSq);
+					DistSq = VectorMultiplyAdd(DeltaZ, DeltaZ, DistSq);
+
+					InRangeMask |= VectorMaskBits(VectorCompareLE(DistSq, ActorCullDistSq));
+				}
+
+				// Discard the lanes past the end of the cell
+				InRangeMask &= (1u << FMath::Min(End - Index, 4)) - 1;
+
+				while (InRangeMask)
+				{
+					const int32 Lane = FMath::CountTrailingZeros(InRangeMask);
+					InRangeMask &= InRangeMask - 1;
+
+					const int32 SortedIndex = Index + Lane;
+					(Sorted.StreamingLevelNames[SortedIndex] == NAME_None ? OutReplicationList : OutStreamingLevelActors).Add(Sorted.Actors[SortedIndex]);
+				}
+			}
+		}
+	}
+}
+
+void UReplicationGraphNode_PackedSpatialization2D::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
+{
+#if WITH_SERVER_CODE
+	RG_QUICK_SCOPE_CYCLE_COUNTER(UReplicationGraphNode_PackedSpatialization2D_GatherActorListsForConnection);
+
+	const FConnectionGather* Gather = nullptr;
+	if (NumConnectionGathers > 0 && PreparedFrame == Params.ReplicationFrameNum)
+	{
+		UNetReplicationGraphConnection* ConnectionManager = &Params.ConnectionManager;
+		Gather = MakeArrayView(ConnectionGathers.GetData(), NumConnectionGathers).FindByPredicate([ConnectionManager](const FConnectionGather& Entry) { return Entry.ConnectionManager == ConnectionManager; });
+
+		// The viewers can only differ if the connection changed between PrepareForReplication and the gather
+		if (Gather && Gather->Viewers.Num() != Params.Viewers.Num())
+		{
+			Gather = nullptr;
+		}
+	}
+
+	const FActorRepListRefView* ReplicationList = &InlineReplicationList;
+	const FActorRepListRefView* StreamingLevelActors = &InlineStreamingLevelActors;
+	if (Gather)
+	{
+		ReplicationList = &Gather->ReplicationList;
+		StreamingLevelActors = &Gather->StreamingLevelActors;
+	}
+	else
+	{
+		GatherActors(Params.Viewers, InlineReplicationList, InlineStreamingLevelActors);
+	}
+
+	Params.OutGatheredReplicationLists.AddReplicationActorList(*ReplicationList);
+	Params.OutGatheredReplicationLists.AddReplicationActorList(NoCullActors);
+
+	StreamingLevelReplicationList.Reset();
+	const FActorRepListRefView* StreamingLevelLists[] = { StreamingLevelActors, &NoCullStreamingLevelActors };
+	for (const FActorRepListRefView* List : StreamingLevelLists)
+	{
+		for (FActorRepListType Actor : *List)
+		{
+			if (Params.CheckClientVisibilityForLevel(FNewReplicatedActorInfo::GetStreamingLevelNameOfActor(Actor)))
+			{
+				StreamingLevelReplicationList.Add(Actor);
+			}
+		}
+	}
+	Params.OutGatheredReplicationLists.AddReplicationActorList(StreamingLevelReplicationList);
+#endif // WITH_SERVER_CODE
+}
+
+void UReplicationGraphNode_PackedSpatialization2D::LogNode(FReplicationGraphDebugInfo& DebugInfo, const FString& NodeName) const
+{
+	DebugInfo.Log(NodeName);
+	DebugInfo.PushIndent();
+	DebugInfo.Log(FString::Printf(TEXT("Actors: %d. Not culled: %d. Cells: %d x %d (%.0f). Max cull distance: %.0f"), Actors.Num(), NoCullActors.Num() + NoCullStreamingLevelActors.Num(), Sorted.NumCellsX, Sorted.NumCellsY, Sorted.GridCellSize, Sorted.MaxCullDist));
+	DebugInfo.PopIndent();
+}
+
+void UReplicationGraphNode_PackedSpatialization2D::GetAllActorsInNode_Debugging(TArray<FActorRepListType>& OutArray) const
+{
+	OutArray.Append(Actors);
+}
+
+// -------------------------------------------------------
+
 UReplicationGraphNode_AlwaysRelevant::UReplicationGraphNode_AlwaysRelevant()
 {
 	bRequiresPrepareForReplicationCall = true;
@@ -769,6 +769,115 @@ private:
 
 // -----------------------------------
 
+/**
+ * Spatialization node for dynamic actors on maps with many connections. Instead of per cell actor lists it keeps the location and
+ * cull distance of every actor in contiguous arrays, sorted by grid cell once per frame in PrepareForReplication. Gathering for a
+ * connection visits the cells around its viewers and tests the actors of each cell 4 at a time.
+ *
+ * When enough connections replicate in a frame (Net.RepGraph.PackedSpatialization.ParallelGather) the gather for all of them
+ * runs in parallel during PrepareForReplication and GatherActorListsForConnection only hands out the result.
+ *
+ * This node does not handle dormancy or static actors, use UReplicationGraphNode_GridSpatialization2D for those.
+ * The coarse cull uses the global cull distance of the actor, connection specific cull distances are still applied afterwards.
+ */
+UCLASS()
+class REPLICATIONGRAPH_API UReplicationGraphNode_PackedSpatialization2D : public UReplicationGraphNode
+{
+	GENERATED_BODY()
+
+public:
+
+	UReplicationGraphNode_PackedSpatialization2D();
+
+	virtual void Serialize(FArchive& Ar) override;
+
+	virtual void NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo) override;
+	virtual bool NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound=true) override;
+	virtual void NotifyResetAllNetworkActors() override;
+	virtual void PrepareForReplication() override;
+	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+	virtual void LogNode(FReplicationGraphDebugInfo& DebugInfo, const FString& NodeName) const override;
+	virtual void GetAllActorsInNode_Debugging(TArray<FActorRepListType>& OutArray) const override;
+
+	/** Size of a grid cell. Should be in the order of the common cull distances, cells much smaller than that only add overhead */
+	float CellSize = 10000.f;
+
+private:
+
+	/** Per frame copy of the actor data, ordered by cell. Arrays are padded so a 4 wide load past the last actor stays in bounds */
+	struct FSortedActors
+	{
+		TArray<FActorRepListType> Actors;
+		TArray<float> X;
+		TArray<float> Y;
+		TArray<float> Z;
+		TArray<float> CullDistSq;
+		TArray<FName> StreamingLevelNames;
+
+		/** First sorted index of each cell, with one extra element for the end of the last cell */
+		TArray<int32> CellStart;
+
+		/** Largest cull distance of the actors in each cell, to reject whole cells */
+		TArray<float> CellMaxCullDist;
+
+		FVector2D GridOrigin = FVector2D::ZeroVector;
+		float GridCellSize = 1.f;
+		int32 NumCellsX = 0;
+		int32 NumCellsY = 0;
+		float MaxCullDist = 0.f;
+
+		void Reset(int32 NumActors);
+		void CountBytes(FArchive& Ar) const;
+	};
+
+	/** Result of the parallel gather for one connection */
+	struct FConnectionGather
+	{
+		UNetReplicationGraphConnection* ConnectionManager = nullptr;
+		FNetViewerArray Viewers;
+
+		/** In range actors of the persistent level */
+		FActorRepListRefView ReplicationList;
+
+		/** In range actors of streaming levels, the level visibility is checked when gathering */
+		FActorRepListRefView StreamingLevelActors;
+	};
+
+	void GatherActors(const FNetViewerArray& Viewers, FActorRepListRefView& OutReplicationList, FActorRepListRefView& OutStreamingLevelActors) const;
+	void GatherConnectionsInParallel();
+
+	// Actor data, removal swaps with the last element
+	TArray<FActorRepListType> Actors;
+	TArray<FName> StreamingLevelNames;
+	TMap<FActorRepListType, int32> ActorIndices;
+
+	// Per frame scratch data of PrepareForReplication, indexed like Actors
+	TArray<FVector3f> Locations;
+	TArray<float> CullDistSq;
+	TArray<int32> ActorCells;
+	TArray<int32> CellCursors;
+
+	/** Actors that are relevant at any distance, they don't go into the grid */
+	FActorRepListRefView NoCullActors;
+	FActorRepListRefView NoCullStreamingLevelActors;
+
+	FSortedActors Sorted;
+
+	/** Entries past NumConnectionGathers are stale and only kept to reuse their allocations */
+	TArray<FConnectionGather> ConnectionGathers;
+	int32 NumConnectionGathers = 0;
+
+	/** Replication graph frame of the last PrepareForReplication */
+	uint32 PreparedFrame = MAX_uint32;
+
+	// Reused by GatherActorListsForConnection when a connection was not gathered in PrepareForReplication
+	FActorRepListRefView InlineReplicationList;
+	FActorRepListRefView InlineStreamingLevelActors;
+	FActorRepListRefView StreamingLevelReplicationList;
+};
+
+// -----------------------------------
+
 
 UCLASS()
 class REPLICATIONGRAPH_API UReplicationGraphNode_AlwaysRelevant : public UReplicationGraphNode
@@ -6,6 +6,9 @@
 #include "GameFramework/HUD.h"
 #include "Engine/Engine.h"
 #include "Async/ParallelFor.h"
+#include "GameFramework/Actor.h"
+#include "Components/SkinnedMeshComponent.h"
+#include "RenderCore.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(SignificanceManager)
 
@@ -23,7 +26,26 @@ DECLARE_CYCLE_STAT(TEXT("Unregister Object"), STAT_SignificanceManager_Unregiste
 DECLARE_CYCLE_STAT(TEXT("Significance Check"), STAT_SignificanceManager_SignificanceCheck, STATGROUP_SignificanceManager);
 DECLARE_CYCLE_STAT(TEXT("Register Object"), STAT_SignificanceManager_RegisterObject, STATGROUP_SignificanceManager);
 DECLARE_CYCLE_STAT(TEXT("Initial Significance Update"), STAT_SignificanceManager_InitialSignificanceUpdate, STATGROUP_SignificanceManager);
+DECLARE_CYCLE_STAT(TEXT("Tick Scaling"), STAT_SignificanceManager_TickScaling, STATGROUP_SignificanceManager);
 DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Num Managed Objects"), STAT_SignificanceManager_NumObjects, STATGROUP_SignificanceManager);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Num Tick Scaled Actors"), STAT_SignificanceManager_NumTickScaledActors, STATGROUP_SignificanceManager);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tick Scaling Bucket Changes"), STAT_SignificanceManager_TickScalingBucketChanges, STATGROUP_SignificanceManager);
+
+static int32 GSignificanceManagerTickScaling = 1;
+static FAutoConsoleVariableRef CVarSignificanceManagerTickScaling(
+	TEXT("SigMan.TickScaling"),
+	GSignificanceManagerTickScaling,
+	TEXT("If true, actors registered with a tick scaled tag have their tick rates scaled by significance.\n"),
+	ECVF_Default
+	);
+
+static float GSignificanceManagerTickScalingBudgetMs = -1.f;
+static FAutoConsoleVariableRef CVarSignificanceManagerTickScalingBudgetMs(
+	TEXT("SigMan.TickScaling.BudgetMs"),
+	GSignificanceManagerTickScalingBudgetMs,
+	TEXT("Overrides the game thread budget in milliseconds of the tick scaling controller when not negative, 0 disables the controller.\n"),
+	ECVF_Default
+	);
 
 DEFINE_LOG_CATEGORY(LogSignificance);
 
@@ -131,6 +153,9 @@ USignificanceManager::USignificanceManager()
 	bCreateOnClient = true;
 	bCreateOnServer = true;
 	bSortSignificanceAscending = false;
+
+	TickScalingBudgetMs = 0.f;
+	TickScalingControllerGain = 0.1f;
 }
 
 void USignificanceManager::BeginDestroy()
@@ -145,6 +170,7 @@ void USignificanceManager::BeginDestroy()
 	ManagedObjectsByTag.Reset();
 	ObjArray.Reset();
 	ObjWithSequentialPostWork.Reset();
+	TickScaledActors.Reset();
 }
 
 UWorld* USignificanceManager::GetWorld()const
@@ -278,6 +304,8 @@ void USignificanceManager::UnregisterObject(UObject* Object)
 			ObjectInfo->PostSignificanceFunction(ObjectInfo, ObjectInfo->Significance, 1.0f, true);
 		}
 
+		StopTickScaling(Object);
+
 		delete ObjectInfo;
 	}
 }
@@ -304,6 +332,8 @@ void USignificanceManager::UnregisterAll(FName Tag)
 				ManagedObj->PostSignificanceFunction(ManagedObj, ManagedObj->Significance, 1.0f, true);
 			}
 
+			StopTickScaling(ManagedObj->GetObject());
+
 			delete ManagedObj;
 		}
 		ManagedObjectsByTag.Remove(Tag);
@@ -466,6 +496,191 @@ void USignificanceManager::Update(TArrayView<const FTransform> InViewpoints)
 			TagToObjectInfoArrayPair.Value.StableSort(PickCompareBySignificance(bSortSignificanceAscending));
 		}
 	}
+
+	UpdateTickScaling();
+}
+
+void USignificanceManager::SetTagTickScaled(FName Tag, bool bTickScaled)
+{
+	if (bTickScaled)
+	{
+		TickScaledTags.AddUnique(Tag);
+	}
+	else if (TickScaledTags.Remove(Tag) > 0)
+	{
+		for (FManagedObjectInfo* ObjectInfo : GetManagedObjects(Tag))
+		{
+			StopTickScaling(ObjectInfo->GetObject());
+		}
+	}
+}
+
+int32 USignificanceManager::GetTickScalingBucketOffset() const
+{
+	return TickScalingBuckets.Num() > 1 ? FMath::FloorToInt(TickScalingPressure * (TickScalingBuckets.Num() - 1) + 0.5f) : 0;
+}
+
+int32 USignificanceManager::GetTickScalingBucketIndex(const float Significance) const
+{
+	for (int32 Index = 0; Index < TickScalingBuckets.Num(); ++Index)
+	{
+		const float BucketSignificance = TickScalingBuckets[Index].Significance;
+		if (bSortSignificanceAscending ? Significance <= BucketSignificance : Significance >= BucketSignificance)
+		{
+			return Index;
+		}
+	}
+	return TickScalingBuckets.Num() - 1;
+}
+
+void USignificanceManager::UpdateTickScaling()
+{
+	if (!GSignificanceManagerTickScaling || TickScaledTags.Num() == 0 || TickScalingBuckets.Num() == 0)
+	{
+		if (TickScaledActors.Num() > 0)
+		{
+			TArray<AActor*> Actors;
+			TickScaledActors.GetKeys(Actors);
+			for (AActor* Actor : Actors)
+			{
+				StopTickScaling(Actor);
+			}
+		}
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_SignificanceManager_TickScaling);
+
+	// Feedback controller, moves actors down the buckets as long as the game thread is over budget and back up once it is under budget
+	const float BudgetMs = GSignificanceManagerTickScalingBudgetMs >= 0.f ? GSignificanceManagerTickScalingBudgetMs : TickScalingBudgetMs;
+	if (BudgetMs > 0.f)
+	{
+		const float GameThreadMs = FPlatformTime::ToMilliseconds(GGameThreadTime);
+		TickScalingSmoothedGameThreadMs = TickScalingSmoothedGameThreadMs > 0.f ? FMath::Lerp(TickScalingSmoothedGameThreadMs, GameThreadMs, 0.1f) : GameThreadMs;
+
+		const float BudgetError = (TickScalingSmoothedGameThreadMs - BudgetMs) / BudgetMs;
+		TickScalingPressure = FMath::Clamp(TickScalingPressure + BudgetError * TickScalingControllerGain, 0.f, 1.f);
+	}
+	else
+	{
+		TickScalingPressure = 0.f;
+	}
+
+	const int32 BucketOffset = GetTickScalingBucketOffset();
+	for (const FName& Tag : TickScaledTags)
+	{
+		for (FManagedObjectInfo* ObjectInfo : GetManagedObjects(Tag))
+		{
+			AActor* Actor = Cast<AActor>(ObjectInfo->GetObject());
+			if (Actor == nullptr)
+			{
+				continue;
+			}
+
+			const int32 BucketIndex = FMath::Min(GetTickScalingBucketIndex(ObjectInfo->GetSignificance()) + BucketOffset, TickScalingBuckets.Num() - 1);
+			FTickScaledActorState* State = TickScaledActors.Find(Actor);
+			if (State == nullptr || State->BucketIndex != BucketIndex)
+			{
+				ApplyTickScaling(Actor, &TickScalingBuckets[BucketIndex]);
+				if (FTickScaledActorState* NewState = TickScaledActors.Find(Actor))
+				{
+					NewState->BucketIndex = BucketIndex;
+				}
+				INC_DWORD_STAT(STAT_SignificanceManager_TickScalingBucketChanges);
+			}
+		}
+	}
+}
+
+void USignificanceManager::StopTickScaling(UObject* Object)
+{
+	if (AActor* Actor = Cast<AActor>(Object))
+	{
+		if (TickScaledActors.Contains(Actor))
+		{
+			ApplyTickScaling(Actor, nullptr);
+		}
+	}
+}
+
+void USignificanceManager::ApplyTickScaling(AActor* Actor, const FSignificanceTickScalingBucket* Bucket)
+{
+	FTickScaledActorState* State = TickScaledActors.Find(Actor);
+	if (Bucket == nullptr)
+	{
+		if (State == nullptr)
+		{
+			return;
+		}
+	}
+	else if (State == nullptr)
+	{
+		// Remember the original tick rates the first time the actor is scaled
+		State = &TickScaledActors.Add(Actor);
+		State->ActorTickInterval = Actor->GetActorTickInterval();
+		State->NetUpdateFrequency = Actor->NetUpdateFrequency;
+		INC_DWORD_STAT(STAT_SignificanceManager_NumTickScaledActors);
+	}
+
+	Actor->SetActorTickInterval(Bucket ? FMath::Max(State->ActorTickInterval, Bucket->TickInterval) : State->ActorTickInterval);
+
+	if (Actor->HasAuthority())
+	{
+		Actor->NetUpdateFrequency = Bucket ? FMath::Max(State->NetUpdateFrequency * Bucket->NetUpdateFrequencyScale, Actor->MinNetUpdateFrequency) : State->NetUpdateFrequency;
+	}
+
+	for (UActorComponent* Component : Actor->GetComponents())
+	{
+		if (Component == nullptr || !Component->PrimaryComponentTick.bCanEverTick)
+		{
+			continue;
+		}
+
+		TPair<TWeakObjectPtr<UActorComponent>, float>* ComponentTickInterval = State->ComponentTickIntervals.FindByPredicate([Component](const TPair<TWeakObjectPtr<UActorComponent>, float>& Pair) { return Pair.Key.Get() == Component; });
+		if (ComponentTickInterval == nullptr)
+		{
+			if (Bucket == nullptr)
+			{
+				continue;
+			}
+			ComponentTickInterval = &State->ComponentTickIntervals.Emplace_GetRef(Component, Component->GetComponentTickInterval());
+		}
+
+		Component->SetComponentTickInterval(Bucket ? FMath::Max(ComponentTickInterval->Value, Bucket->TickInterval) : ComponentTickInterval->Value);
+
+		// Update rate parameters are shared by all the skinned meshes of the actor, throttle them through the LOD map
+		USkinnedMeshComponent* SkinnedMeshComponent = Cast<USkinnedMeshComponent>(Component);
+		if (SkinnedMeshComponent && SkinnedMeshComponent->AnimUpdateRateParams && SkinnedMeshComponent->ShouldUseUpdateRateOptimizations())
+		{
+			FAnimUpdateRateParameters& UpdateRateParams = *SkinnedMeshComponent->AnimUpdateRateParams;
+			if (!State->bSavedAnimUpdateRateParams)
+			{
+				State->bSavedAnimUpdateRateParams = true;
+				State->bShouldUseLodMap = UpdateRateParams.bShouldUseLodMap;
+				State->LODToFrameSkipMap = UpdateRateParams.LODToFrameSkipMap;
+			}
+
+			if (Bucket && Bucket->AnimationFrameSkip > 0)
+			{
+				UpdateRateParams.bShouldUseLodMap = true;
+				for (int32 LODIndex = 0; LODIndex < SkinnedMeshComponent->GetNumLODs(); ++LODIndex)
+				{
+					UpdateRateParams.LODToFrameSkipMap.Add(LODIndex, Bucket->AnimationFrameSkip);
+				}
+			}
+			else
+			{
+				UpdateRateParams.bShouldUseLodMap = State->bShouldUseLodMap;
+				UpdateRateParams.LODToFrameSkipMap = State->LODToFrameSkipMap;
+			}
+		}
+	}
+
+	if (Bucket == nullptr)
+	{
+		TickScaledActors.Remove(Actor);
+		DEC_DWORD_STAT(STAT_SignificanceManager_NumTickScaledActors);
+	}
 }
 
 static int32 GSignificanceManagerObjectsToShow = 15;
@@ -502,6 +717,10 @@ void USignificanceManager::OnShowDebugInfo(AHUD* HUD, UCanvas* Canvas, const FDe
 			DisplayDebugManager.SetFont(GEngine->GetSmallFont());
 			DisplayDebugManager.SetDrawColor(FColor::Red);
 			DisplayDebugManager.DrawString(FString::Printf(TEXT("SIGNIFICANCE MANAGER - %d Managed Objects"), ManagedObjects.Num()));
+			if (TickScaledActors.Num() > 0)
+			{
+				DisplayDebugManager.DrawString(FString::Printf(TEXT("Tick Scaling - %d Actors, Bucket Offset %d, Game Thread %.2fms"), TickScaledActors.Num(), GetTickScalingBucketOffset(), TickScalingSmoothedGameThreadMs));
+			}
 
 			const FName SignificanceManagerTag(*CVarSignificanceManagerFilterTag->GetString());
 			TArray<FManagedObjectInfo*> AllObjects;
@@ -13,7 +13,9 @@
 #include "Engine/World.h"
 #include "SignificanceManager.generated.h"
 
+class AActor;
 class AHUD;
+class UActorComponent;
 class FDebugDisplayInfo;
 class UCanvas;
 class USignificanceManager;
@@ -67,6 +69,29 @@ private:
 	static TSubclassOf<USignificanceManager>  SignificanceManagerClass;
 };
 
+/* Tick rates applied by the significance manager to the actors of a tick scaled tag whose significance falls in this bucket */
+USTRUCT()
+struct FSignificanceTickScalingBucket
+{
+	GENERATED_BODY()
+
+	// Significance an object must at least have to be in this bucket (at most if the significance sort is ascending)
+	UPROPERTY(config, EditAnywhere, Category=TickScaling)
+	float Significance = 0.f;
+
+	// Minimum tick interval in seconds of the actor and its ticking components, 0 leaves their tick interval unchanged
+	UPROPERTY(config, EditAnywhere, Category=TickScaling, meta=(ClampMin=0))
+	float TickInterval = 0.f;
+
+	// Number of frames skipped between animation updates of skinned meshes using update rate optimizations, 0 leaves URO to its default rules
+	UPROPERTY(config, EditAnywhere, Category=TickScaling, meta=(ClampMin=0))
+	int32 AnimationFrameSkip = 0;
+
+	// Scale applied to the net update frequency of replicated actors, never going below their min net update frequency
+	UPROPERTY(config, EditAnywhere, Category=TickScaling, meta=(ClampMin=0, ClampMax=1))
+	float NetUpdateFrequencyScale = 1.f;
+};
+
 /* The significance manager provides a framework for registering objects by tag to each have a significance
  * value calculated from which a game specific subclass and game logic can make decisions about what level
  * of detail objects should be at, tick frequency, whether to spawn effects, and other such functionality
@@ -76,6 +101,10 @@ private:
  *
  * Each user of the significance manager is expected to call the Update function from the appropriate location in the
  * game code.  GameViewportClient::Tick may often serve as a good place to do this.
+ *
+ * Actors registered with one of the TickScaledTags have their tick interval, animation update rate and net update frequency
+ * set by Update from the TickScalingBuckets their significance falls in. When TickScalingBudgetMs is set, a feedback controller
+ * moves actors to less significant buckets while the game thread time is over budget, and back once it is under budget.
  */
 UCLASS(config=Engine, defaultconfig)
 class SIGNIFICANCEMANAGER_API USignificanceManager : public UObject
@@ -206,6 +235,15 @@ public:
 
 	// Returns the list of viewpoints currently being represented by the significance manager
 	const TArray<FTransform>& GetViewpoints() const { return Viewpoints; }
+
+	// Enables or disables tick scaling of the actors registered with the specified tag. Actors stop being scaled when disabled.
+	void SetTagTickScaled(FName Tag, bool bTickScaled);
+
+	// Returns true if the actors registered with the specified tag have their tick rates scaled by significance
+	bool IsTagTickScaled(FName Tag) const { return TickScaledTags.Contains(Tag); }
+
+	// Returns how many buckets the tick scaling budget controller currently moves actors down by
+	int32 GetTickScalingBucketOffset() const;
 	
 	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
 protected:
@@ -225,6 +263,25 @@ protected:
 	// The cached viewpoints for significance for calculating when a new object is registered
 	TArray<FTransform> Viewpoints;
 
+	// Tags whose registered actors have their tick rates scaled by significance
+	UPROPERTY(config, EditAnywhere, Category=TickScaling)
+	TArray<FName> TickScaledTags;
+
+	// Tick rates by significance, ordered from the most to the least significant bucket. Objects less significant than the last bucket use the last bucket.
+	UPROPERTY(config, EditAnywhere, Category=TickScaling)
+	TArray<FSignificanceTickScalingBucket> TickScalingBuckets;
+
+	// Game thread time in milliseconds the tick scaling controller aims for, 0 disables the controller
+	UPROPERTY(config, EditAnywhere, Category=TickScaling, meta=(ClampMin=0))
+	float TickScalingBudgetMs;
+
+	// How fast the tick scaling controller reacts to the game thread time being over or under budget
+	UPROPERTY(config, EditAnywhere, Category=TickScaling, meta=(ClampMin=0))
+	float TickScalingControllerGain;
+
+	// Overridable function to apply a tick scaling bucket to an actor. Original tick rates are restored when passed nullptr.
+	virtual void ApplyTickScaling(AActor* Actor, const FSignificanceTickScalingBucket* Bucket);
+
 private:
 
 	// All objects being managed organized by Tag
@@ -248,6 +305,32 @@ private:
 	// We copy ObjWithSequentialPostWork to this before running update to avoid mutations during the update. To avoid memory allocations, making it a member.
 	TArray<FSequentialPostWorkPair> ObjWithSequentialPostWorkCopy;
 
+	// Tick rates of a tick scaled actor before any bucket was applied to it
+	struct FTickScaledActorState
+	{
+		int32 BucketIndex = INDEX_NONE;
+		float ActorTickInterval = 0.f;
+		float NetUpdateFrequency = 0.f;
+		TArray<TPair<TWeakObjectPtr<UActorComponent>, float>> ComponentTickIntervals;
+		bool bSavedAnimUpdateRateParams = false;
+		bool bShouldUseLodMap = false;
+		TMap<int32, int32> LODToFrameSkipMap;
+	};
+	TMap<AActor*, FTickScaledActorState> TickScaledActors;
+
+	// Smoothed game thread time and current output of the tick scaling controller, from 0 to 1
+	float TickScalingSmoothedGameThreadMs = 0.f;
+	float TickScalingPressure = 0.f;
+
+	// Updates the budget controller and applies the tick rates of their bucket to all tick scaled actors
+	void UpdateTickScaling();
+
+	// Returns the tick scaling bucket for a significance, or INDEX_NONE if there are no buckets
+	int32 GetTickScalingBucketIndex(float Significance) const;
+
+	// Restores the original tick rates of an actor and stops tracking it
+	void StopTickScaling(UObject* Object);
+
 	// Game specific significance class to instantiate
 	UPROPERTY(globalconfig, noclear, EditAnywhere, Category=DefaultClasses, meta=(MetaClass="/Script/SignificanceManager.SignificanceManager", DisplayName="Significance Manager Class"))
 	FSoftClassPath SignificanceManagerClassName;
@@ -902,6 +902,12 @@ void USmartObjectSubsystem::FindSlots(const FSmartObjectHandle Handle, const FSm
 }
 
 void USmartObjectSubsystem::FindSlots(const FSmartObjectRuntime& SmartObjectRuntime, const FSmartObjectRequestFilter& Filter, TArray<FSmartObjectSlotHandle>& OutResults) const
+{
+	FMatchingSlotDefinitionIndicesCache MatchingSlotsCache;
+	FindSlots(SmartObjectRuntime, Filter, OutResults, MatchingSlotsCache);
+}
+
+void USmartObjectSubsystem::FindSlots(const FSmartObjectRuntime& SmartObjectRuntime, const FSmartObjectRequestFilter& Filter, TArray<FSmartObjectSlotHandle>& OutResults, FMatchingSlotDefinitionIndicesCache& MatchingSlotsCache) const
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE_STR("SmartObject_FilterSlots");
 
@@ -929,10 +935,14 @@ void USmartObjectSubsystem::FindSlots(const FSmartObjectRuntime& SmartObjectRunt
 		return;
 	}
 
-	// Apply definition level filtering (Tags and BehaviorDefinition)
-	// This could be improved to cache results between a single query against multiple instances of the same definition
-	TArray<int32> ValidSlotIndices;
-	FindMatchingSlotDefinitionIndices(Definition, Filter, ValidSlotIndices);
+	// Apply definition level filtering (Tags and BehaviorDefinition), only once per definition for the query
+	TArray<int32>* ValidSlotIndicesPtr = MatchingSlotsCache.Find(&Definition);
+	if (ValidSlotIndicesPtr == nullptr)
+	{
+		ValidSlotIndicesPtr = &MatchingSlotsCache.Add(&Definition);
+		FindMatchingSlotDefinitionIndices(Definition, Filter, *ValidSlotIndicesPtr);
+	}
+	const TArray<int32>& ValidSlotIndices = *ValidSlotIndicesPtr;
 
 	// Build list of available slot indices (filter out occupied or reserved slots)
 	for (const int32 SlotIndex : ValidSlotIndices)
@@ -1042,32 +1052,64 @@ bool USmartObjectSubsystem::FindSmartObjects(const FSmartObjectRequest& Request,
 		return false;
 	}
 
-	const FSmartObjectRequestFilter& Filter = Request.Filter;
+	FMatchingSlotDefinitionIndicesCache MatchingSlotsCache;
+	FindSmartObjectsInBox(Request.QueryBox, Request.Filter, MatchingSlotsCache, OutResults);
+
+	return (OutResults.Num() > 0);
+}
+
+bool USmartObjectSubsystem::FindSmartObjects(const FSmartObjectRequestFilter& Filter, TConstArrayView<FBox> QueryBoxes, TArray<TArray<FSmartObjectRequestResult>>& OutResults) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR("SmartObject_FindAllResultsBatch");
+
+	OutResults.SetNum(QueryBoxes.Num());
+
+	if (!bInitialCollectionAddedToSimulation)
+	{
+		// Do not report warning if runtime was explicitly disabled by CVar
+		UE_CVLOG_UELOG(!UE::SmartObject::bDisableRuntime, this, LogSmartObject, Warning,
+			TEXT("Can't find smart objet before runtime gets initialized (i.e. InitializeRuntime gets called)."));
+		return false;
+	}
+
+	// The filter is the same for all the boxes, so is the definition level filtering
+	FMatchingSlotDefinitionIndicesCache MatchingSlotsCache;
+	bool bFoundAny = false;
+	for (int32 BoxIndex = 0; BoxIndex < QueryBoxes.Num(); ++BoxIndex)
+	{
+		FindSmartObjectsInBox(QueryBoxes[BoxIndex], Filter, MatchingSlotsCache, OutResults[BoxIndex]);
+		bFoundAny |= (OutResults[BoxIndex].Num() > 0);
+	}
+
+	return bFoundAny;
+}
+
+void USmartObjectSubsystem::FindSmartObjectsInBox(const FBox& QueryBox, const FSmartObjectRequestFilter& Filter, FMatchingSlotDefinitionIndicesCache& MatchingSlotsCache, TArray<FSmartObjectRequestResult>& OutResults) const
+{
 	TArray<FSmartObjectHandle> QueryResults;
 
 	checkfSlow(SpacePartition != nullptr, TEXT("Space partition is expected to be valid since we use the plugins default in OnWorldComponentsUpdated."));
-	SpacePartition->Find(Request.QueryBox, QueryResults);
+	SpacePartition->Find(QueryBox, QueryResults);
 
+	TArray<FSmartObjectSlotHandle> SlotHandles;
 	for (const FSmartObjectHandle SmartObjectHandle : QueryResults)
 	{
 		const FSmartObjectRuntime* SmartObjectRuntime = RuntimeSmartObjects.Find(SmartObjectHandle);
 		checkf(SmartObjectRuntime != nullptr, TEXT("Results returned by the space partition are expected to be valid."));
 
-		if (!Request.QueryBox.IsInside(SmartObjectRuntime->GetTransform().GetLocation()))
+		if (!QueryBox.IsInside(SmartObjectRuntime->GetTransform().GetLocation()))
 		{
 			continue;
 		}
 
-		TArray<FSmartObjectSlotHandle> SlotHandles;
-		FindSlots(*SmartObjectRuntime, Filter, SlotHandles);
+		SlotHandles.Reset();
+		FindSlots(*SmartObjectRuntime, Filter, SlotHandles, MatchingSlotsCache);
 		OutResults.Reserve(OutResults.Num() + SlotHandles.Num());
 		for (FSmartObjectSlotHandle SlotHandle: SlotHandles)
 		{
 			OutResults.Emplace(SmartObjectHandle, SlotHandle);
 		}
 	}
-
-	return (OutResults.Num() > 0);
 }
 
 void USmartObjectSubsystem::RegisterCollectionInstances()
@@ -216,6 +216,16 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "SmartObject")
 	bool FindSmartObjects(const FSmartObjectRequest& Request, TArray<FSmartObjectRequestResult>& OutResults) const;
 
+	/**
+	 * Spatial lookup of many query boxes sharing the same filter, e.g. for all the entities processed by a Mass processor.
+	 * The definition level filtering is done once per definition for the whole batch instead of once per smart object.
+	 * @param Filter Filter applied to the results of all the boxes.
+	 * @param QueryBoxes Search ranges.
+	 * @param OutResults Valid smart objects in range of each box, in the order of QueryBoxes.
+	 * @return Whether any result was found.
+	 */
+	bool FindSmartObjects(const FSmartObjectRequestFilter& Filter, TConstArrayView<FBox> QueryBoxes, TArray<TArray<FSmartObjectRequestResult>>& OutResults) const;
+
 	/**
 	 * Returns slots of a given smart object matching the filter.
 	 * @param Handle Handle to the smart object.
@@ -548,9 +558,18 @@ protected:
 	void RemoveTagFromInstance(FSmartObjectRuntime& SmartObjectRuntime, const FGameplayTag& Tag);
 	void UpdateRuntimeInstanceStatus(FSmartObjectRuntime& SmartObjectRuntime);
 
+	/** Slot definition indices matching the filter of a query, per definition. */
+	using FMatchingSlotDefinitionIndicesCache = TMap<const USmartObjectDefinition*, TArray<int32>>;
+
 	/** Goes through all defined slots of smart object represented by SmartObjectRuntime and finds the ones matching the filter. */
 	void FindSlots(const FSmartObjectRuntime& SmartObjectRuntime, const FSmartObjectRequestFilter& Filter, TArray<FSmartObjectSlotHandle>& OutResults) const;
 
+	/** Same as above, reusing the definition level filtering cached for Filter in MatchingSlotsCache. */
+	void FindSlots(const FSmartObjectRuntime& SmartObjectRuntime, const FSmartObjectRequestFilter& Filter, TArray<FSmartObjectSlotHandle>& OutResults, FMatchingSlotDefinitionIndicesCache& MatchingSlotsCache) const;
+
+	/** Finds the valid smart objects in range of QueryBox, the definition level filtering of Filter being cached in MatchingSlotsCache. */
+	void FindSmartObjectsInBox(const FBox& QueryBox, const FSmartObjectRequestFilter& Filter, FMatchingSlotDefinitionIndicesCache& MatchingSlotsCache, TArray<FSmartObjectRequestResult>& OutResults) const;
+
 	/** Applies filter on provided definition and fills OutValidIndices with indices of all valid slots. */
 	static void FindMatchingSlotDefinitionIndices(const USmartObjectDefinition& Definition, const FSmartObjectRequestFilter& Filter, TArray<int32>& OutValidIndices);
 
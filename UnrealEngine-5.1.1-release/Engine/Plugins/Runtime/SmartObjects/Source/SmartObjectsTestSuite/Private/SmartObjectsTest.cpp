@@ -182,6 +182,32 @@ struct FFindMultipleSmartObjects : FSmartObjectTestBase
 };
 IMPLEMENT_AI_INSTANT_TEST(FFindMultipleSmartObjects, "System.AI.SmartObjects.Find multiple");
 
+struct FFindSmartObjectsBatch : FSmartObjectTestBase
+{
+	virtual bool InstantTest() override
+	{
+		const FBox EverywhereBox = FBox(EForceInit::ForceInit).ExpandBy(FVector(HALF_WORLD_MAX), FVector(HALF_WORLD_MAX));
+		const FBox NowhereBox = FBox(FVector(HALF_WORLD_MAX - 1.), FVector(HALF_WORLD_MAX));
+		const TArray<FBox> QueryBoxes = { EverywhereBox, NowhereBox, EverywhereBox };
+
+		// Find all candidates of each box
+		TArray<TArray<FSmartObjectRequestResult>> Results;
+		const bool bFoundAny = Subsystem->FindSmartObjects(TestFilter, QueryBoxes, Results);
+		AITEST_TRUE("Found any result", bFoundAny);
+		AITEST_EQUAL("Results.Num()", Results.Num(), QueryBoxes.Num());
+		AITEST_EQUAL("Results[0].Num()", Results[0].Num(), NumCreatedSlots);
+		AITEST_EQUAL("Results[1].Num()", Results[1].Num(), 0);
+		AITEST_EQUAL("Results[2].Num()", Results[2].Num(), NumCreatedSlots);
+
+		// Batched results should match a single request
+		TArray<FSmartObjectRequestResult> SingleResults;
+		Subsystem->FindSmartObjects(FSmartObjectRequest(EverywhereBox, TestFilter), SingleResults);
+		AITEST_TRUE("Batched and single request results match", Results[0] == SingleResults);
+		return true;
+	}
+};
+IMPLEMENT_AI_INSTANT_TEST(FFindSmartObjectsBatch, "System.AI.SmartObjects.Find batch");
+
 struct FClaimAndReleaseSmartObject : FSmartObjectTestBase
 {
 	virtual bool InstantTest() override
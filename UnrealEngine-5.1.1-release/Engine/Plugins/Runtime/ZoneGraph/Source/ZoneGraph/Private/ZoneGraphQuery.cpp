@@ -447,65 +447,78 @@ bool FindNearestLocationOnLane(const FZoneGraphStorage& Storage, const FZoneGrap
 	return FindNearestLocationOnLaneInternal(Storage, LaneHandle.Index, Center, FMath::Square(Range), OutLaneLocation, OutDistanceSqr);
 }
 	
-bool FindNearestLane(const FZoneGraphStorage& Storage, const FBox& Bounds, const FZoneGraphTagFilter TagFilter, FZoneGraphLaneLocation& OutLaneLocation, float& OutDistanceSqr)
+namespace Private
 {
-	struct FQueryResult
-	{
-		float NearestDistanceSqr = 0.0f;
-		int32 NearestLaneIdx = 0;
-		int32 NearestLaneSegment = 0;
-		float NearestLaneSegmentT = 0;
-		FVector NearestLanePosition = FVector::ZeroVector;
-		bool bValid = false;
-	};
-	
-	FQueryResult Result;
-	Result.NearestDistanceSqr = Bounds.GetExtent().SizeSquared();
-
-	FVector Center(Bounds.GetCenter());
+struct FNearestLaneQueryResult
+{
+	float NearestDistanceSqr = 0.0f;
+	int32 NearestLaneIdx = 0;
+	int32 NearestLaneSegment = 0;
+	float NearestLaneSegmentT = 0;
+	FVector NearestLanePosition = FVector::ZeroVector;
+	bool bValid = false;
+};
 
-	Storage.ZoneBVTree.Query(Bounds, [&Storage, &Bounds, &TagFilter, &Center, &Result](const FZoneGraphBVNode& Node)
+void FindNearestLaneInZone(const FZoneGraphStorage& Storage, const FZoneData& Zone, const FBox& Bounds, const FVector& Center, const FZoneGraphTagFilter TagFilter, FNearestLaneQueryResult& Result)
+{
+	for (int32 LaneIdx = Zone.LanesBegin; LaneIdx < Zone.LanesEnd; LaneIdx++)
 	{
-		const FZoneData& Zone = Storage.Zones[Node.Index];
-		for (int32 LaneIdx = Zone.LanesBegin; LaneIdx < Zone.LanesEnd; LaneIdx++)
+		const FZoneLaneData& Lane = Storage.Lanes[LaneIdx];
+		if (TagFilter.Pass(Lane.Tags))
 		{
-			const FZoneLaneData& Lane = Storage.Lanes[LaneIdx];
-			if (TagFilter.Pass(Lane.Tags))
+			for (int32 i = Lane.PointsBegin; i < Lane.PointsEnd - 1; i++)
 			{
-				for (int32 i = Lane.PointsBegin; i < Lane.PointsEnd - 1; i++)
+				const FVector& SegStart = Storage.LanePoints[i];
+				const FVector& SegEnd = Storage.LanePoints[i + 1];
+				const float SegT = ClosestTimeOnSegment(Center, SegStart, SegEnd);
+				const FVector ClosestPt = FMath::Lerp(SegStart, SegEnd, SegT);
+				if (Bounds.IsInside(ClosestPt))
 				{
-					const FVector& SegStart = Storage.LanePoints[i];
-					const FVector& SegEnd = Storage.LanePoints[i + 1];
-					const float SegT = ClosestTimeOnSegment(Center, SegStart, SegEnd);
-					const FVector ClosestPt = FMath::Lerp(SegStart, SegEnd, SegT);
-					if (Bounds.IsInside(ClosestPt))
+					const float DistSqr = FVector::DistSquared(Center, ClosestPt);
+					if (DistSqr < Result.NearestDistanceSqr)
 					{
-						const float DistSqr = FVector::DistSquared(Center, ClosestPt);
-						if (DistSqr < Result.NearestDistanceSqr)
-						{
-							Result.NearestDistanceSqr = DistSqr;
-							Result.NearestLaneIdx = LaneIdx;
-							Result.NearestLaneSegment = i;
-							Result.NearestLaneSegmentT = SegT;
-							Result.NearestLanePosition = ClosestPt;
-							Result.bValid = true;
-						}
+						Result.NearestDistanceSqr = DistSqr;
+						Result.NearestLaneIdx = LaneIdx;
+						Result.NearestLaneSegment = i;
+						Result.NearestLaneSegmentT = SegT;
+						Result.NearestLanePosition = ClosestPt;
+						Result.bValid = true;
 					}
 				}
 			}
 		}
+	}
+}
+
+void MakeNearestLaneLocation(const FZoneGraphStorage& Storage, const FNearestLaneQueryResult& Result, FZoneGraphLaneLocation& OutLaneLocation)
+{
+	check(Result.bValid);
+	OutLaneLocation.LaneHandle.DataHandle = Storage.DataHandle;
+	OutLaneLocation.LaneHandle.Index = uint32(Result.NearestLaneIdx);
+	OutLaneLocation.LaneSegment = Result.NearestLaneSegment;
+	OutLaneLocation.DistanceAlongLane = FMath::Lerp(Storage.LanePointProgressions[Result.NearestLaneSegment], Storage.LanePointProgressions[Result.NearestLaneSegment + 1], Result.NearestLaneSegmentT);
+	OutLaneLocation.Position = Result.NearestLanePosition;
+	OutLaneLocation.Direction = (Storage.LanePoints[Result.NearestLaneSegment + 1] - Storage.LanePoints[Result.NearestLaneSegment]).GetSafeNormal();
+	OutLaneLocation.Tangent = FMath::Lerp(Storage.LaneTangentVectors[Result.NearestLaneSegment], Storage.LaneTangentVectors[Result.NearestLaneSegment + 1], Result.NearestLaneSegmentT).GetSafeNormal();
+	OutLaneLocation.Up = FMath::Lerp(Storage.LaneUpVectors[Result.NearestLaneSegment], Storage.LaneUpVectors[Result.NearestLaneSegment + 1], Result.NearestLaneSegmentT).GetSafeNormal();
+}
+} // Private
+
+bool FindNearestLane(const FZoneGraphStorage& Storage, const FBox& Bounds, const FZoneGraphTagFilter TagFilter, FZoneGraphLaneLocation& OutLaneLocation, float& OutDistanceSqr)
+{
+	Private::FNearestLaneQueryResult Result;
+	Result.NearestDistanceSqr = Bounds.GetExtent().SizeSquared();
+
+	FVector Center(Bounds.GetCenter());
+
+	Storage.ZoneBVTree.Query(Bounds, [&Storage, &Bounds, &TagFilter, &Center, &Result](const FZoneGraphBVNode& Node)
+	{
+		Private::FindNearestLaneInZone(Storage, Storage.Zones[Node.Index], Bounds, Center, TagFilter, Result);
 	});
 
 	if (Result.bValid)
 	{
-		OutLaneLocation.LaneHandle.DataHandle = Storage.DataHandle;
-		OutLaneLocation.LaneHandle.Index = uint32(Result.NearestLaneIdx);
-		OutLaneLocation.LaneSegment = Result.NearestLaneSegment;
-		OutLaneLocation.DistanceAlongLane = FMath::Lerp(Storage.LanePointProgressions[Result.NearestLaneSegment], Storage.LanePointProgressions[Result.NearestLaneSegment + 1], Result.NearestLaneSegmentT);
-		OutLaneLocation.Position = Result.NearestLanePosition;
-		OutLaneLocation.Direction = (Storage.LanePoints[Result.NearestLaneSegment + 1] - Storage.LanePoints[Result.NearestLaneSegment]).GetSafeNormal();
-		OutLaneLocation.Tangent = FMath::Lerp(Storage.LaneTangentVectors[Result.NearestLaneSegment], Storage.LaneTangentVectors[Result.NearestLaneSegment + 1], Result.NearestLaneSegmentT).GetSafeNormal();
-		OutLaneLocation.Up = FMath::Lerp(Storage.LaneUpVectors[Result.NearestLaneSegment], Storage.LaneUpVectors[Result.NearestLaneSegment + 1], Result.NearestLaneSegmentT).GetSafeNormal();
+		Private::MakeNearestLaneLocation(Storage, Result, OutLaneLocation);
 		OutDistanceSqr = Result.NearestDistanceSqr;
 	}
 	else
@@ -517,6 +530,83 @@ bool FindNearestLane(const FZoneGraphStorage& Storage, const FBox& Bounds, const
 	return Result.bValid;
 }
 
+bool FindNearestLanes(const FZoneGraphStorage& Storage, TConstArrayView<FBox> Bounds, const FZoneGraphTagFilter TagFilter, TArrayView<FZoneGraphLaneLocation> InOutLaneLocations, TArrayView<float> InOutDistancesSqr)
+{
+	check(Bounds.Num() == InOutLaneLocations.Num() && Bounds.Num() == InOutDistancesSqr.Num());
+
+	const int32 NumQueries = Bounds.Num();
+	if (NumQueries == 0)
+	{
+		return false;
+	}
+
+	TArray<Private::FNearestLaneQueryResult, TInlineAllocator<64>> Results;
+	Results.SetNum(NumQueries);
+
+	FBox UnionBounds(ForceInit);
+	FVector::FReal SumQueryArea = 0.;
+	for (int32 QueryIndex = 0; QueryIndex < NumQueries; QueryIndex++)
+	{
+		const FBox& QueryBounds = Bounds[QueryIndex];
+		const FVector QuerySize = QueryBounds.GetSize();
+		Results[QueryIndex].NearestDistanceSqr = FMath::Min(QueryBounds.GetExtent().SizeSquared(), InOutDistancesSqr[QueryIndex]);
+		UnionBounds += QueryBounds;
+		SumQueryArea += QuerySize.X * QuerySize.Y;
+	}
+
+	// Queries close to each other share a single traversal of the BV-tree, testing each visited zone against the queries overlapping it.
+	// Spread out queries would visit too many zones that way, and are done one by one.
+	const FVector UnionSize = UnionBounds.GetSize();
+	if (NumQueries > 1 && UnionSize.X * UnionSize.Y <= SumQueryArea)
+	{
+		TArray<FZoneGraphBVNode, TInlineAllocator<64>> QueryNodes;
+		QueryNodes.Reserve(NumQueries);
+		for (const FBox& QueryBounds : Bounds)
+		{
+			QueryNodes.Add(Storage.ZoneBVTree.CalcNodeBounds(QueryBounds));
+		}
+
+		Storage.ZoneBVTree.Query(UnionBounds, [&Storage, &Bounds, &TagFilter, &QueryNodes, &Results, NumQueries](const FZoneGraphBVNode& Node)
+		{
+			const FZoneData& Zone = Storage.Zones[Node.Index];
+			for (int32 QueryIndex = 0; QueryIndex < NumQueries; QueryIndex++)
+			{
+				if (Node.DoesOverlap(QueryNodes[QueryIndex]))
+				{
+					Private::FindNearestLaneInZone(Storage, Zone, Bounds[QueryIndex], Bounds[QueryIndex].GetCenter(), TagFilter, Results[QueryIndex]);
+				}
+			}
+		});
+	}
+	else
+	{
+		for (int32 QueryIndex = 0; QueryIndex < NumQueries; QueryIndex++)
+		{
+			const FBox& QueryBounds = Bounds[QueryIndex];
+			const FVector Center(QueryBounds.GetCenter());
+			Private::FNearestLaneQueryResult& Result = Results[QueryIndex];
+			Storage.ZoneBVTree.Query(QueryBounds, [&Storage, &QueryBounds, &TagFilter, &Center, &Result](const FZoneGraphBVNode& Node)
+			{
+				Private::FindNearestLaneInZone(Storage, Storage.Zones[Node.Index], QueryBounds, Center, TagFilter, Result);
+			});
+		}
+	}
+
+	bool bFoundAny = false;
+	for (int32 QueryIndex = 0; QueryIndex < NumQueries; QueryIndex++)
+	{
+		const Private::FNearestLaneQueryResult& Result = Results[QueryIndex];
+		if (Result.bValid)
+		{
+			Private::MakeNearestLaneLocation(Storage, Result, InOutLaneLocations[QueryIndex]);
+			InOutDistancesSqr[QueryIndex] = Result.NearestDistanceSqr;
+			bFoundAny = true;
+		}
+	}
+
+	return bFoundAny;
+}
+
 bool FindOverlappingLanes(const FZoneGraphStorage& Storage, const FBox& Bounds, const FZoneGraphTagFilter TagFilter, TArray<FZoneGraphLaneHandle>& OutLanes)
 {
 	Storage.ZoneBVTree.Query(Bounds, [&Storage, &Bounds, &OutLanes, &TagFilter](const FZoneGraphBVNode& Node)
@@ -314,6 +314,51 @@ bool UZoneGraphSubsystem::FindNearestLane(const FBox& QueryBounds, const FZoneGr
 	return bResult;
 }
 
+bool UZoneGraphSubsystem::FindNearestLanes(TConstArrayView<FBox> QueryBounds, const FZoneGraphTagFilter TagFilter, TArrayView<FZoneGraphLaneLocation> OutLaneLocations, TArrayView<float> OutDistancesSqr) const
+{
+	check(QueryBounds.Num() == OutLaneLocations.Num() && QueryBounds.Num() == OutDistancesSqr.Num());
+
+	if (QueryBounds.Num() == 0)
+	{
+		return false;
+	}
+
+	FBox UnionBounds(ForceInit);
+	for (int32 QueryIndex = 0; QueryIndex < QueryBounds.Num(); QueryIndex++)
+	{
+		OutLaneLocations[QueryIndex].Reset();
+		OutDistancesSqr[QueryIndex] = QueryBounds[QueryIndex].GetExtent().SizeSquared();
+		UnionBounds += QueryBounds[QueryIndex];
+	}
+
+	bool bResult = false;
+	for (const FRegisteredZoneGraphData& RegisteredData : RegisteredZoneGraphData)
+	{
+		if (RegisteredData.ZoneGraphData)
+		{
+			const FZoneGraphStorage& Storage = RegisteredData.ZoneGraphData->GetStorage();
+			if (UnionBounds.Intersect(Storage.Bounds))
+			{
+				if (UE::ZoneGraph::Query::FindNearestLanes(Storage, QueryBounds, TagFilter, OutLaneLocations, OutDistancesSqr))
+				{
+					bResult = true;
+				}
+			}
+		}
+	}
+
+	// Match FindNearestLane() for the queries without result
+	for (int32 QueryIndex = 0; QueryIndex < QueryBounds.Num(); QueryIndex++)
+	{
+		if (!OutLaneLocations[QueryIndex].IsValid())
+		{
+			OutDistancesSqr[QueryIndex] = 0.0f;
+		}
+	}
+
+	return bResult;
+}
+
 bool UZoneGraphSubsystem::FindOverlappingLanes(const FBox& QueryBounds, const FZoneGraphTagFilter TagFilter, TArray<FZoneGraphLaneHandle>& OutLanes) const
 {
 	bool bResult = false;
@@ -70,6 +70,13 @@ ZONEGRAPH_API bool FindNearestLocationOnLane(const FZoneGraphStorage& Storage, c
 /**  Finds nearest lane in ZoneGraph Storage.  */
 ZONEGRAPH_API bool FindNearestLane(const FZoneGraphStorage& Storage, const FBox& Bounds, const FZoneGraphTagFilter TagFilter, FZoneGraphLaneLocation& OutLaneLocation, float& OutDistanceSqr);
 
+/**
+ * Finds nearest lane in ZoneGraph Storage for each of the query bounds, e.g. for all the agents of a Mass chunk.
+ * Only the results closer than the value already in InOutDistancesSqr are written, so the results of several storages can be accumulated.
+ * @return true if any of the queries found a closer lane.
+ */
+ZONEGRAPH_API bool FindNearestLanes(const FZoneGraphStorage& Storage, TConstArrayView<FBox> Bounds, const FZoneGraphTagFilter TagFilter, TArrayView<FZoneGraphLaneLocation> InOutLaneLocations, TArrayView<float> InOutDistancesSqr);
+
 /**  Finds overlapping lanes in ZoneGraph Storage.  */
 ZONEGRAPH_API bool FindOverlappingLanes(const FZoneGraphStorage& Storage, const FBox& Bounds, const FZoneGraphTagFilter TagFilter, TArray<FZoneGraphLaneHandle>& OutLanes);
 	
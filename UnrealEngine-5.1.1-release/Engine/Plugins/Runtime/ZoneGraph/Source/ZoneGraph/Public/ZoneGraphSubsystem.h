@@ -71,6 +71,9 @@ public:
 	// Find nearest lane that touches the query bounds. Finds results from all registered ZoneGraph data.
 	bool FindNearestLane(const FBox& QueryBounds, const FZoneGraphTagFilter TagFilter, FZoneGraphLaneLocation& OutLaneLocation, float& OutDistanceSqr) const;
 
+	// Find nearest lane that touches the query bounds, for each query bounds. Lane locations that are not found are reset. Finds results from all registered ZoneGraph data.
+	bool FindNearestLanes(TConstArrayView<FBox> QueryBounds, const FZoneGraphTagFilter TagFilter, TArrayView<FZoneGraphLaneLocation> OutLaneLocations, TArrayView<float> OutDistancesSqr) const;
+
 	// Find overlapping lanes that touches the query bounds. Finds results from all registered ZoneGraph data.
 	bool FindOverlappingLanes(const FBox& QueryBounds, const FZoneGraphTagFilter TagFilter, TArray<FZoneGraphLaneHandle>& OutLanes) const;
 
@@ -72,6 +72,14 @@ namespace UE::DerivedData::CookStats
 			}
 		}
 
+		{
+			const FString StatName(TEXT("DDC.Latency"));
+			for (const auto& UsageStatPair : RootNode->ToLegacyUsageMap())
+			{
+				UsageStatPair.Value.LogLatencyStats(AddStat, StatName, UsageStatPair.Key);
+			}
+		}
+
 		TArray<TSharedRef<const FDerivedDataCacheStatsNode>> Nodes;
 		RootNode->ForEachDescendant([&Nodes](TSharedRef<const FDerivedDataCacheStatsNode> Node)
 		{
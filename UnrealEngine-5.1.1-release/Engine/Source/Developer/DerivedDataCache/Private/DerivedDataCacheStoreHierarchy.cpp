@@ -5,7 +5,10 @@
 #include "Algo/Compare.h"
 #include "Algo/Find.h"
 #include "Algo/MinElement.h"
+#include "Algo/Sort.h"
+#include "Compression/CompressedBuffer.h"
 #include "Containers/Array.h"
+#include "Containers/Map.h"
 #include "DerivedDataCache.h"
 #include "DerivedDataCacheStore.h"
 #include "DerivedDataCacheUsageStats.h"
@@ -13,12 +16,15 @@
 #include "DerivedDataRequest.h"
 #include "DerivedDataRequestOwner.h"
 #include "HAL/CriticalSection.h"
+#include "HAL/IConsoleManager.h"
 #include "MemoryCacheStore.h"
 #include "Misc/EnumClassFlags.h"
+#include "Misc/ScopeLock.h"
 #include "Misc/ScopeRWLock.h"
 #include "Serialization/CompactBinary.h"
 #include "Templates/Invoke.h"
 #include "Templates/RefCounting.h"
+#include "Templates/Tuple.h"
 #include "Templates/UniquePtr.h"
 #include <atomic>
 
@@ -27,6 +33,22 @@ namespace UE::DerivedData
 
 ILegacyCacheStore* CreateCacheStoreAsync(ILegacyCacheStore* InnerCache, ECacheStoreFlags InnerFlags, IMemoryCacheStore* MemoryCache);
 
+static int32 GSessionCacheMaxSizeMB = 0;
+static FAutoConsoleVariableRef CVarSessionCacheMaxSizeMB(
+	TEXT("DDC.SessionCache.MaxSizeMB"),
+	GSessionCacheMaxSizeMB,
+	TEXT("Memory budget in MiB of the session cache in front of the cache hierarchy, which serves records and values ")
+	TEXT("fetched or stored earlier in the session without querying the cache stores. 0 disables the session cache."),
+	ECVF_Default);
+
+static int32 GSessionCacheHotHitCount = 2;
+static FAutoConsoleVariableRef CVarSessionCacheHotHitCount(
+	TEXT("DDC.SessionCache.HotHitCount"),
+	GSessionCacheHotHitCount,
+	TEXT("Number of session cache hits after which the values of an entry are kept decompressed, ")
+	TEXT("within the same memory budget as the compressed entries. 0 never decompresses."),
+	ECVF_Default);
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 class FCacheStoreHierarchy final : public ILegacyCacheStore, public ICacheStoreOwner
@@ -86,6 +108,8 @@ private:
 
 	class FGetChunksBatch;
 
+	class FSessionCache;
+
 	enum class ECacheStoreNodeFlags : uint32;
 	FRIEND_ENUM_CLASS_FLAGS(ECacheStoreNodeFlags);
 
@@ -114,6 +138,7 @@ private:
 	ECacheStoreNodeFlags CombinedNodeFlags{};
 	TArray<FCacheStoreNode, TInlineAllocator<8>> Nodes;
 	IMemoryCacheStore* MemoryCache;
+	TUniquePtr<FSessionCache> SessionCache;
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -205,6 +230,7 @@ ENUM_CLASS_FLAGS(FCacheStoreHierarchy::ECacheStoreNodeFlags);
 
 FCacheStoreHierarchy::FCacheStoreHierarchy(IMemoryCacheStore* InMemoryCache)
 	: MemoryCache(InMemoryCache)
+	, SessionCache(MakeUnique<FSessionCache>())
 {
 	if (MemoryCache)
 	{
@@ -319,6 +345,230 @@ bool FCacheStoreHierarchy::CanQueryIfError(const ECachePolicy Policy, const ECac
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+/**
+ * Memory cache of complete records and values, consulted before any cache store in the hierarchy.
+ *
+ * Entries are stored compressed as received and are decompressed in place once they reach the hot hit count,
+ * since repeated requests for a value in the editor otherwise decompress it every time. Compressed and
+ * decompressed entries share one budget and the least recently used entries are evicted first.
+ */
+class FCacheStoreHierarchy::FSessionCache
+{
+public:
+	static bool IsEnabled() { return GSessionCacheMaxSizeMB > 0; }
+
+	bool GetRecord(const FCacheKey& Key, FOptionalCacheRecord& OutRecord);
+	bool GetValue(const FCacheKey& Key, FValue& OutValue);
+
+	/** Records and values are only stored when their data is complete. */
+	void PutRecord(const FOptionalCacheRecord& Record);
+	void PutValue(const FCacheKey& Key, const FValue& Value);
+
+	void LegacyStats(FDerivedDataCacheStatsNode& OutNode);
+
+private:
+	template <typename DataType>
+	struct TEntry
+	{
+		DataType Data;
+		uint64 Size = 0;
+		uint64 LastAccess = 0;
+		uint64 PutSerial = 0;
+		uint32 HitCount = 0;
+		bool bDecompressed = false;
+	};
+
+	static bool HasAllData(const FCacheRecord& Record) { return Algo::AllOf(Record.GetValues(), &FValue::HasData); }
+	static bool HasAllData(const FValue& Value) { return Value.HasData(); }
+	static uint64 GetSize(const FCacheRecord& Record);
+	static uint64 GetSize(const FValue& Value) { return Value.GetData().GetCompressedSize(); }
+	static FValue Decompress(const FValue& Value);
+	static FCacheRecord Decompress(const FCacheRecord& Record);
+
+	template <typename DataType>
+	bool Get(TMap<FCacheKey, TEntry<DataType>>& Entries, const FCacheKey& Key, DataType& OutData);
+	template <typename DataType>
+	void Put(TMap<FCacheKey, TEntry<DataType>>& Entries, const FCacheKey& Key, const DataType& Data);
+
+	// Caller must hold CriticalSection.
+	void Trim();
+
+	FCriticalSection CriticalSection;
+	TMap<FCacheKey, TEntry<FOptionalCacheRecord>> Records;
+	TMap<FCacheKey, TEntry<FValue>> Values;
+	uint64 TotalSize = 0;
+	uint64 AccessSerial = 0;
+	uint64 PutSerial = 0;
+	FDerivedDataCacheUsageStats UsageStats;
+};
+
+uint64 FCacheStoreHierarchy::FSessionCache::GetSize(const FCacheRecord& Record)
+{
+	uint64 Size = Record.GetMeta().GetSize();
+	for (const FValueWithId& Value : Record.GetValues())
+	{
+		Size += Value.GetData().GetCompressedSize();
+	}
+	return Size;
+}
+
+FValue FCacheStoreHierarchy::FSessionCache::Decompress(const FValue& Value)
+{
+	ECompressedBufferCompressor Compressor;
+	ECompressedBufferCompressionLevel CompressionLevel;
+	uint64 BlockSize;
+	if (Value.GetData().TryGetCompressParameters(Compressor, CompressionLevel, BlockSize) && CompressionLevel == ECompressedBufferCompressionLevel::None)
+	{
+		return Value;
+	}
+
+	// A buffer with no compression references the raw data, so reading it later is a copy rather than a decode.
+	const FSharedBuffer RawData = Value.GetData().Decompress();
+	if (RawData.IsNull())
+	{
+		return Value;
+	}
+	return FValue(FCompressedBuffer::Compress(RawData, ECompressedBufferCompressor::NotSet, ECompressedBufferCompressionLevel::None));
+}
+
+FCacheRecord FCacheStoreHierarchy::FSessionCache::Decompress(const FCacheRecord& Record)
+{
+	FCacheRecordBuilder Builder(Record.GetKey());
+	Builder.SetMeta(CopyTemp(Record.GetMeta()));
+	for (const FValueWithId& Value : Record.GetValues())
+	{
+		Builder.AddValue(Value.GetId(), Decompress(Value));
+	}
+	return Builder.Build();
+}
+
+template <typename DataType>
+bool FCacheStoreHierarchy::FSessionCache::Get(TMap<FCacheKey, TEntry<DataType>>& Entries, const FCacheKey& Key, DataType& OutData)
+{
+	COOK_STAT(auto Timer = UsageStats.TimeGet());
+	uint64 EntryPutSerial = 0;
+	{
+		FScopeLock Lock(&CriticalSection);
+		TEntry<DataType>* Entry = Entries.Find(Key);
+		if (!Entry)
+		{
+			return false;
+		}
+
+		Entry->LastAccess = ++AccessSerial;
+		OutData = Entry->Data;
+		COOK_STAT(Timer.AddHit(int64(Entry->Size)));
+		if (Entry->bDecompressed || GSessionCacheHotHitCount <= 0 || ++Entry->HitCount < uint32(GSessionCacheHotHitCount))
+		{
+			return true;
+		}
+		EntryPutSerial = Entry->PutSerial;
+	}
+
+	// Decompress outside of the lock. The entry is only replaced if it was not put again or evicted meanwhile.
+	DataType DecompressedData = Decompress(OutData);
+	const uint64 DecompressedSize = GetSize(DecompressedData);
+
+	FScopeLock Lock(&CriticalSection);
+	if (TEntry<DataType>* Entry = Entries.Find(Key); Entry && Entry->PutSerial == EntryPutSerial && !Entry->bDecompressed)
+	{
+		TotalSize += DecompressedSize - Entry->Size;
+		Entry->Data = DecompressedData;
+		Entry->Size = DecompressedSize;
+		Entry->bDecompressed = true;
+		OutData = MoveTemp(DecompressedData);
+		Trim();
+	}
+	return true;
+}
+
+template <typename DataType>
+void FCacheStoreHierarchy::FSessionCache::Put(TMap<FCacheKey, TEntry<DataType>>& Entries, const FCacheKey& Key, const DataType& Data)
+{
+	if (!HasAllData(Data))
+	{
+		return;
+	}
+
+	COOK_STAT(auto Timer = UsageStats.TimePut());
+	const uint64 Size = GetSize(Data);
+	FScopeLock Lock(&CriticalSection);
+	if (const TEntry<DataType>* Existing = Entries.Find(Key))
+	{
+		TotalSize -= Existing->Size;
+	}
+	Entries.Add(Key, TEntry<DataType>{Data, Size, ++AccessSerial, ++PutSerial});
+	TotalSize += Size;
+	COOK_STAT(Timer.AddHit(int64(Size)));
+	Trim();
+}
+
+void FCacheStoreHierarchy::FSessionCache::Trim()
+{
+	const uint64 MaxSize = uint64(FMath::Max(GSessionCacheMaxSizeMB, 0)) * 1024 * 1024;
+	if (TotalSize <= MaxSize)
+	{
+		return;
+	}
+
+	struct FEvictionCandidate
+	{
+		uint64 LastAccess;
+		FCacheKey Key;
+		bool bRecord;
+	};
+	TArray<FEvictionCandidate> Candidates;
+	Candidates.Reserve(Records.Num() + Values.Num());
+	for (const TPair<FCacheKey, TEntry<FOptionalCacheRecord>>& Pair : Records)
+	{
+		Candidates.Add({Pair.Value.LastAccess, Pair.Key, true});
+	}
+	for (const TPair<FCacheKey, TEntry<FValue>>& Pair : Values)
+	{
+		Candidates.Add({Pair.Value.LastAccess, Pair.Key, false});
+	}
+	Algo::SortBy(Candidates, &FEvictionCandidate::LastAccess);
+
+	// Evict below the budget to avoid sorting again on every put once the budget is reached.
+	const uint64 TargetSize = MaxSize - MaxSize / 8;
+	for (const FEvictionCandidate& Candidate : Candidates)
+	{
+		if (TotalSize <= TargetSize)
+		{
+			break;
+		}
+		TotalSize -= Candidate.bRecord ? Records.FindAndRemoveChecked(Candidate.Key).Size : Values.FindAndRemoveChecked(Candidate.Key).Size;
+	}
+}
+
+bool FCacheStoreHierarchy::FSessionCache::GetRecord(const FCacheKey& Key, FOptionalCacheRecord& OutRecord)
+{
+	return Get(Records, Key, OutRecord);
+}
+
+bool FCacheStoreHierarchy::FSessionCache::GetValue(const FCacheKey& Key, FValue& OutValue)
+{
+	return Get(Values, Key, OutValue);
+}
+
+void FCacheStoreHierarchy::FSessionCache::PutRecord(const FOptionalCacheRecord& Record)
+{
+	Put(Records, Record.GetKey(), Record);
+}
+
+void FCacheStoreHierarchy::FSessionCache::PutValue(const FCacheKey& Key, const FValue& Value)
+{
+	Put(Values, Key, Value);
+}
+
+void FCacheStoreHierarchy::FSessionCache::LegacyStats(FDerivedDataCacheStatsNode& OutNode)
+{
+	OutNode = {TEXT("Memory"), TEXT("Session"), /*bIsLocal*/ true};
+	OutNode.UsageStats.Add(TEXT(""), UsageStats);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 template <typename Params>
 class FCacheStoreHierarchy::TPutBatch final : public FBatchBase, public Params
 {
@@ -966,6 +1216,16 @@ void FCacheStoreHierarchy::Put(
 	IRequestOwner& Owner,
 	FOnCachePutComplete&& OnComplete)
 {
+	if (FSessionCache::IsEnabled())
+	{
+		for (const FCachePutRequest& Request : Requests)
+		{
+			if (EnumHasAnyFlags(Request.Policy.GetRecordPolicy(), ECachePolicy::StoreLocal))
+			{
+				SessionCache->PutRecord(Request.Record);
+			}
+		}
+	}
 	TPutBatch<FCacheRecordBatchParams>::Begin(*this, Requests, Owner, MoveTemp(OnComplete));
 }
 
@@ -974,7 +1234,43 @@ void FCacheStoreHierarchy::Get(
 	IRequestOwner& Owner,
 	FOnCacheGetComplete&& OnComplete)
 {
-	TGetBatch<FCacheRecordBatchParams>::Begin(*this, Requests, Owner, MoveTemp(OnComplete));
+	if (!FSessionCache::IsEnabled())
+	{
+		return TGetBatch<FCacheRecordBatchParams>::Begin(*this, Requests, Owner, MoveTemp(OnComplete));
+	}
+
+	// Requests going to the cache stores are indexed by UserData to restore it and to know whether metadata was skipped.
+	// Responses without metadata are not stored because later requests may need it.
+	TArray<FCacheGetRequest, TInlineAllocator<8>> MissedRequests;
+	TArray<TTuple<uint64, bool>> MissedRequestStates;
+	for (const FCacheGetRequest& Request : Requests)
+	{
+		FOptionalCacheRecord Record;
+		if (EnumHasAnyFlags(Request.Policy.GetRecordPolicy(), ECachePolicy::QueryLocal) && SessionCache->GetRecord(Request.Key, Record))
+		{
+			OnComplete(FCacheRecordBatchParams::FilterResponseByRequest({Request.Name, MoveTemp(Record).Get(), Request.UserData, EStatus::Ok}, Request));
+		}
+		else
+		{
+			MissedRequestStates.Emplace(Request.UserData, !EnumHasAnyFlags(Request.Policy.GetRecordPolicy(), ECachePolicy::SkipMeta));
+			MissedRequests.Add_GetRef(Request).UserData = uint64(MissedRequestStates.Num() - 1);
+		}
+	}
+
+	if (!MissedRequests.IsEmpty())
+	{
+		TGetBatch<FCacheRecordBatchParams>::Begin(*this, MissedRequests, Owner,
+			[this, MissedRequestStates = MoveTemp(MissedRequestStates), OnComplete = MoveTemp(OnComplete)](FCacheGetResponse&& Response)
+			{
+				const TTuple<uint64, bool>& State = MissedRequestStates[int32(Response.UserData)];
+				Response.UserData = State.Get<0>();
+				if (Response.Status == EStatus::Ok && State.Get<1>())
+				{
+					SessionCache->PutRecord(Response.Record);
+				}
+				OnComplete(MoveTemp(Response));
+			});
+	}
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1042,6 +1338,16 @@ void FCacheStoreHierarchy::PutValue(
 	IRequestOwner& Owner,
 	FOnCachePutValueComplete&& OnComplete)
 {
+	if (FSessionCache::IsEnabled())
+	{
+		for (const FCachePutValueRequest& Request : Requests)
+		{
+			if (EnumHasAnyFlags(Request.Policy, ECachePolicy::StoreLocal))
+			{
+				SessionCache->PutValue(Request.Key, Request.Value);
+			}
+		}
+	}
 	TPutBatch<FCacheValueBatchParams>::Begin(*this, Requests, Owner, MoveTemp(OnComplete));
 }
 
@@ -1050,7 +1356,37 @@ void FCacheStoreHierarchy::GetValue(
 	IRequestOwner& Owner,
 	FOnCacheGetValueComplete&& OnComplete)
 {
-	TGetBatch<FCacheValueBatchParams>::Begin(*this, Requests, Owner, MoveTemp(OnComplete));
+	if (!FSessionCache::IsEnabled())
+	{
+		return TGetBatch<FCacheValueBatchParams>::Begin(*this, Requests, Owner, MoveTemp(OnComplete));
+	}
+
+	TArray<FCacheGetValueRequest, TInlineAllocator<8>> MissedRequests;
+	for (const FCacheGetValueRequest& Request : Requests)
+	{
+		FValue Value;
+		if (EnumHasAnyFlags(Request.Policy, ECachePolicy::QueryLocal) && SessionCache->GetValue(Request.Key, Value))
+		{
+			OnComplete(FCacheValueBatchParams::FilterResponseByRequest({Request.Name, Request.Key, MoveTemp(Value), Request.UserData, EStatus::Ok}, Request));
+		}
+		else
+		{
+			MissedRequests.Add(Request);
+		}
+	}
+
+	if (!MissedRequests.IsEmpty())
+	{
+		TGetBatch<FCacheValueBatchParams>::Begin(*this, MissedRequests, Owner,
+			[this, OnComplete = MoveTemp(OnComplete)](FCacheGetValueResponse&& Response)
+			{
+				if (Response.Status == EStatus::Ok)
+				{
+					SessionCache->PutValue(Response.Key, Response.Value);
+				}
+				OnComplete(MoveTemp(Response));
+			});
+	}
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1197,6 +1533,10 @@ void FCacheStoreHierarchy::LegacyStats(FDerivedDataCacheStatsNode& OutNode)
 	{
 		Node.Cache->LegacyStats(OutNode.Children.Add_GetRef(MakeShared<FDerivedDataCacheStatsNode>()).Get());
 	}
+	if (FSessionCache::IsEnabled())
+	{
+		SessionCache->LegacyStats(OutNode.Children.Add_GetRef(MakeShared<FDerivedDataCacheStatsNode>()).Get());
+	}
 }
 
 bool FCacheStoreHierarchy::LegacyDebugOptions(FBackendDebugOptions& Options)
@@ -225,6 +225,8 @@ struct FHttpCacheStoreParams
 	FString OAuthPinnedPublicKeys;
 	bool bResolveHostCanonicalName = true;
 	bool bReadOnly = false;
+	/** Maximum number of records fetched by one request to the batch endpoint. 1 disables batching. */
+	int32 BatchGetMaxRecords = 32;
 
 	void Parse(const TCHAR* NodeName, const TCHAR* Config);
 };
@@ -318,6 +320,9 @@ private:
 
 	bool bIsUsable = false;
 	bool bReadOnly = false;
+	int32 BatchGetMaxRecords = 1;
+	/** Cleared when the service fails a batch request, after which records are fetched one request at a time */
+	std::atomic<bool> bBatchGetSupported = true;
 
 	static inline FHttpCacheStore* AnyInstance = nullptr;
 
@@ -356,6 +361,13 @@ private:
 		uint64 UserData,
 		FOnGetCacheRecordOnlyComplete&& OnComplete);
 
+	/** Fetches the records of multiple requests through the batch endpoint, in as few round trips as BatchGetMaxRecords allows. */
+	using FOnGetCacheRecordOnlyBatchComplete = TUniqueFunction<void(int32 RequestIndex, FGetCacheRecordOnlyResponse&& Response)>;
+	void GetCacheRecordOnlyBatchAsync(
+		IRequestOwner& Owner,
+		TConstArrayView<FCacheGetRequest> Requests,
+		FOnGetCacheRecordOnlyBatchComplete&& OnComplete);
+
 	void GetCacheRecordAsync(
 		IRequestOwner& Owner,
 		const FSharedString& Name,
@@ -803,6 +815,13 @@ public:
 		uint64 UserData,
 		TUniqueFunction<void(FCacheGetResponse&& Response, uint64 BytesReceived)>&& OnComplete);
 
+	/** Performs the operation of GetRecord for multiple records, fetching the records themselves in batches. OnCompletes has one function per request. */
+	static void GetRecords(
+		FHttpCacheStore& CacheStore,
+		IRequestOwner& Owner,
+		TConstArrayView<FCacheGetRequest> Requests,
+		TArray<TUniqueFunction<void(FCacheGetResponse&& Response, uint64 BytesReceived)>>&& OnCompletes);
+
 	struct FGetCachedDataBatchResponse
 	{
 		FSharedString Name;
@@ -1186,6 +1205,29 @@ void FHttpCacheStore::FGetRecordOp::GetRecord(
 	});
 }
 
+void FHttpCacheStore::FGetRecordOp::GetRecords(
+	FHttpCacheStore& CacheStore,
+	IRequestOwner& Owner,
+	TConstArrayView<FCacheGetRequest> Requests,
+	TArray<TUniqueFunction<void(FCacheGetResponse&& Response, uint64 BytesReceived)>>&& OnCompletes)
+{
+	check(Requests.Num() == OnCompletes.Num());
+	TArray<FCacheRecordPolicy> Policies;
+	Policies.Reserve(Requests.Num());
+	for (const FCacheGetRequest& Request : Requests)
+	{
+		Policies.Add(Request.Policy);
+	}
+
+	// Each request completes exactly once, so its function can be moved out of the shared array from any thread
+	CacheStore.GetCacheRecordOnlyBatchAsync(Owner, Requests,
+		[&CacheStore, &Owner, Policies = MoveTemp(Policies), SharedOnCompletes = MakeShared<TArray<TUniqueFunction<void(FCacheGetResponse&& Response, uint64 BytesReceived)>>>(MoveTemp(OnCompletes))]
+		(int32 RequestIndex, FGetCacheRecordOnlyResponse&& Response)
+	{
+		OnOnlyRecordComplete(CacheStore, Owner, Policies[RequestIndex], MoveTemp((*SharedOnCompletes)[RequestIndex]), MoveTemp(Response));
+	});
+}
+
 template <typename ValueType, typename ValueIdGetterType>
 void FHttpCacheStore::FGetRecordOp::GetDataBatch(
 	FHttpCacheStore& CacheStore,
@@ -1536,6 +1578,7 @@ FHttpCacheStore::FHttpCacheStore(const FHttpCacheStoreParams& Params)
 	, OAuthProviderIdentifier(Params.OAuthProviderIdentifier)
 	, OAuthAccessToken(Params.OAuthAccessToken)
 	, bReadOnly(Params.bReadOnly)
+	, BatchGetMaxRecords(FMath::Max(Params.BatchGetMaxRecords, 1))
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(HttpDDC_Construct);
 
@@ -1895,6 +1938,152 @@ void FHttpCacheStore::GetCacheRecordOnlyAsync(
 	});
 }
 
+void FHttpCacheStore::GetCacheRecordOnlyBatchAsync(
+	IRequestOwner& Owner,
+	TConstArrayView<FCacheGetRequest> Requests,
+	FOnGetCacheRecordOnlyBatchComplete&& OnComplete)
+{
+	TSharedRef<FOnGetCacheRecordOnlyBatchComplete> SharedOnComplete = MakeShared<FOnGetCacheRecordOnlyBatchComplete>(MoveTemp(OnComplete));
+	auto GetSingle = [this, &Owner, &Requests, &SharedOnComplete](int32 RequestIndex)
+	{
+		const FCacheGetRequest& Request = Requests[RequestIndex];
+		GetCacheRecordOnlyAsync(Owner, Request.Name, Request.Key, Request.Policy, Request.UserData,
+			[SharedOnComplete, RequestIndex](FGetCacheRecordOnlyResponse&& Response)
+		{
+			SharedOnComplete.Get()(RequestIndex, MoveTemp(Response));
+		});
+	};
+
+	// Requests that are skipped by availability, policy, or debug options go through the single request path to share its logging.
+	TArray<int32> BatchIndices;
+	const bool bBatchGet = BatchGetMaxRecords > 1 && bBatchGetSupported.load(std::memory_order_relaxed) && IsUsable();
+	for (int32 RequestIndex = 0; RequestIndex < Requests.Num(); ++RequestIndex)
+	{
+		const FCacheGetRequest& Request = Requests[RequestIndex];
+		if (bBatchGet && EnumHasAnyFlags(Request.Policy.GetRecordPolicy(), ECachePolicy::QueryRemote) && !DebugOptions.ShouldSimulateGetMiss(Request.Key))
+		{
+			BatchIndices.Add(RequestIndex);
+		}
+		else
+		{
+			GetSingle(RequestIndex);
+		}
+	}
+
+	for (int32 BatchFirst = 0; BatchFirst < BatchIndices.Num(); BatchFirst += BatchGetMaxRecords)
+	{
+		const TConstArrayView<int32> BatchView = MakeArrayView(BatchIndices).Mid(BatchFirst, BatchGetMaxRecords);
+		if (BatchView.Num() == 1)
+		{
+			GetSingle(BatchView[0]);
+			continue;
+		}
+
+		FCbWriter RequestWriter;
+		RequestWriter.BeginObject();
+		RequestWriter.BeginArray(ANSITEXTVIEW("ops"));
+		TArray<FCacheGetRequest> BatchRequests;
+		BatchRequests.Reserve(BatchView.Num());
+		for (int32 RequestIndex : BatchView)
+		{
+			const FCacheKey& Key = Requests[RequestIndex].Key;
+			RequestWriter.BeginObject();
+			RequestWriter.AddInteger(ANSITEXTVIEW("opId"), BatchRequests.Num());
+			RequestWriter.AddString(ANSITEXTVIEW("op"), ANSITEXTVIEW("GET"));
+			TAnsiStringBuilder<64> Bucket;
+			Algo::Transform(Key.Bucket.ToString(), AppendChars(Bucket), FCharAnsi::ToLower);
+			RequestWriter.AddString(ANSITEXTVIEW("bucket"), Bucket);
+			RequestWriter.AddString(ANSITEXTVIEW("key"), LexToString(Key.Hash));
+			RequestWriter.AddBool(ANSITEXTVIEW("resolveAttachments"), false);
+			RequestWriter.EndObject();
+			BatchRequests.Add(Requests[RequestIndex]);
+		}
+		RequestWriter.EndArray();
+		RequestWriter.EndObject();
+		FCbFieldIterator RequestFields = RequestWriter.Save();
+
+		TUniquePtr<FHttpOperation> Operation = WaitForHttpOperation(EOperationCategory::Get, /*bUnboundedOverflow*/ false);
+		FHttpOperation& LocalOperation = *Operation;
+		LocalOperation.SetUri(WriteToAnsiString<256>(EffectiveDomain, ANSITEXTVIEW("/api/v1/refs/"), Namespace));
+		LocalOperation.SetMethod(EHttpMethod::Post);
+		LocalOperation.SetContentType(EHttpMediaType::CbObject);
+		LocalOperation.AddAcceptType(EHttpMediaType::CbObject);
+		LocalOperation.SetBody(FCompositeBuffer(RequestFields.GetOuterBuffer()));
+		LocalOperation.SendAsync(Owner, [Operation = MoveTemp(Operation), this, OpRequestIndices = TArray<int32>(BatchView), BatchRequests = MoveTemp(BatchRequests), SharedOnComplete]
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(HttpDDC_GetCacheRecordOnlyBatchAsync_OnHttpRequestComplete);
+
+			TBitArray<> Completed(false, BatchRequests.Num());
+			auto Complete = [&OpRequestIndices, &BatchRequests, &SharedOnComplete, &Completed](int32 OpIndex, uint64 BytesReceived, FOptionalCacheRecord&& Record, EStatus Status)
+			{
+				const FCacheGetRequest& Request = BatchRequests[OpIndex];
+				Completed[OpIndex] = true;
+				SharedOnComplete.Get()(OpRequestIndices[OpIndex], { Request.Name, Request.Key, Request.UserData, BytesReceived, MoveTemp(Record), Status });
+			};
+
+			const int32 OverallStatusCode = Operation->GetStatusCode();
+			FSharedBuffer Body = Operation->GetBody();
+			if (OverallStatusCode < 200 || OverallStatusCode > 204 || ValidateCompactBinary(Body, ECbValidateMode::Default) != ECbValidateError::None)
+			{
+				// Servers without the batch endpoint fail here once, later gets use one request per record.
+				if (bBatchGetSupported.exchange(false))
+				{
+					UE_LOG(LogDerivedDataCache, Display,
+						TEXT("%s: Batched get of %d records failed with status code %d, records will be fetched one request at a time."),
+						*Domain, BatchRequests.Num(), OverallStatusCode);
+				}
+			}
+			else
+			{
+				const FCbArrayView ResultsArrayView = FCbObjectView(Body.GetData())[ANSITEXTVIEW("results")].AsArrayView();
+				for (FCbFieldView ResultFieldView : ResultsArrayView)
+				{
+					const FCbObjectView ResultObjectView = ResultFieldView.AsObjectView();
+					const uint32 OpId = ResultObjectView[ANSITEXTVIEW("opId")].AsUInt32(MAX_uint32);
+					if (OpId >= uint32(BatchRequests.Num()) || Completed[OpId])
+					{
+						UE_LOG(LogDerivedDataCache, Display, TEXT("%s: Encountered invalid opId %u while getting %d records"),
+							*Domain, OpId, BatchRequests.Num());
+						continue;
+					}
+
+					const FCacheGetRequest& Request = BatchRequests[OpId];
+					const int32 StatusCode = ResultObjectView[ANSITEXTVIEW("statusCode")].AsInt32();
+					const FCbObjectView ResponseObjectView = ResultObjectView[ANSITEXTVIEW("response")].AsObjectView();
+					const uint64 BytesReceived = ResponseObjectView.GetSize();
+					if (StatusCode < 200 || StatusCode > 204)
+					{
+						UE_LOG(LogDerivedDataCache, Verbose, TEXT("%s: Cache miss with missing package for %s from '%s'"),
+							*Domain, *WriteToString<96>(Request.Key), *Request.Name);
+						Complete(OpId, BytesReceived, {}, EStatus::Error);
+					}
+					else if (FOptionalCacheRecord Record = FCacheRecord::Load(FCbPackage(FCbObject::Clone(ResponseObjectView))); Record.IsNull())
+					{
+						UE_LOG(LogDerivedDataCache, Log, TEXT("%s: Cache miss with record load failure for %s from '%s'"),
+							*Domain, *WriteToString<96>(Request.Key), *Request.Name);
+						Complete(OpId, BytesReceived, {}, EStatus::Error);
+					}
+					else
+					{
+						Complete(OpId, BytesReceived, MoveTemp(Record), EStatus::Ok);
+					}
+				}
+			}
+
+			for (int32 OpIndex = 0; OpIndex < BatchRequests.Num(); ++OpIndex)
+			{
+				if (!Completed[OpIndex])
+				{
+					const FCacheGetRequest& Request = BatchRequests[OpIndex];
+					UE_LOG(LogDerivedDataCache, Verbose, TEXT("%s: Cache miss with failed batched HTTP request for %s from '%s'"),
+						*Domain, *WriteToString<96>(Request.Key), *Request.Name);
+					Complete(OpIndex, 0, {}, EStatus::Error);
+				}
+			}
+		});
+	}
+}
+
 void FHttpCacheStore::PutCacheRecordAsync(
 	IRequestOwner& Owner,
 	const FSharedString& Name,
@@ -2287,13 +2476,14 @@ void FHttpCacheStore::Put(
 	for (const FCachePutRequest& Request : Requests)
 	{
 		PutCacheRecordAsync(Owner, Request.Name, Request.Record, Request.Policy, Request.UserData,
-			[COOK_STAT(Timer = UsageStats.TimePut(), ) SharedOnComplete](FCachePutResponse&& Response, uint64 BytesSent) mutable
+			[COOK_STAT(this, Timer = UsageStats.TimePut(), StartTime = FPlatformTime::Seconds(), ) SharedOnComplete](FCachePutResponse&& Response, uint64 BytesSent) mutable
 		{
 			TRACE_COUNTER_ADD(HttpDDC_BytesSent, BytesSent);
 			if (Response.Status == EStatus::Ok)
 			{
 				COOK_STAT(if (BytesSent) { Timer.AddHit(BytesSent); });
 			}
+			COOK_STAT(UsageStats.PutLatency.Add(FPlatformTime::Seconds() - StartTime));
 			SharedOnComplete.Get()(MoveTemp(Response));
 		});
 	}
@@ -2307,19 +2497,22 @@ void FHttpCacheStore::Get(
 	TRACE_CPUPROFILER_EVENT_SCOPE(HttpDDC_Get);
 	FRequestBarrier Barrier(Owner);
 	TSharedRef<FOnCacheGetComplete> SharedOnComplete = MakeShared<FOnCacheGetComplete>(MoveTemp(OnComplete));
-	for (const FCacheGetRequest& Request : Requests)
+	TArray<TUniqueFunction<void(FCacheGetResponse&& Response, uint64 BytesReceived)>> OnCompletes;
+	OnCompletes.Reserve(Requests.Num());
+	for (int32 RequestIndex = 0; RequestIndex < Requests.Num(); ++RequestIndex)
 	{
-		GetCacheRecordAsync(Owner, Request.Name, Request.Key, Request.Policy, Request.UserData,
-			[COOK_STAT(Timer = UsageStats.TimePut(), ) SharedOnComplete](FCacheGetResponse&& Response, uint64 BytesReceived) mutable
+		OnCompletes.Emplace([COOK_STAT(this, Timer = UsageStats.TimeGet(), StartTime = FPlatformTime::Seconds(), ) SharedOnComplete](FCacheGetResponse&& Response, uint64 BytesReceived) mutable
 		{
 			TRACE_COUNTER_ADD(HttpDDC_BytesReceived, BytesReceived);
 			if (Response.Status == EStatus::Ok)
 			{
 				COOK_STAT(Timer.AddHit(BytesReceived););
 			}
+			COOK_STAT(UsageStats.GetLatency.Add(FPlatformTime::Seconds() - StartTime));
 			SharedOnComplete.Get()(MoveTemp(Response));
 		});
 	}
+	FGetRecordOp::GetRecords(*this, Owner, Requests, MoveTemp(OnCompletes));
 }
 
 void FHttpCacheStore::PutValue(
@@ -2383,6 +2576,7 @@ void FHttpCacheStore::GetValue(
 
 			COOK_STAT(const int64 CyclesUsed = int64((FPlatformTime::Seconds() - StartTime) / FPlatformTime::GetSecondsPerCycle()));
 			COOK_STAT(UsageStats.GetStats.Accumulate(FCookStats::CallStats::EHitOrMiss::Hit, FCookStats::CallStats::EStatType::Cycles, CyclesUsed, bIsInGameThread));
+			COOK_STAT(UsageStats.GetLatency.Add(FPlatformTime::Seconds() - StartTime));
 		});
 	}
 	else
@@ -2426,6 +2620,7 @@ void FHttpCacheStore::GetValue(
 				}
 				COOK_STAT(const int64 CyclesUsed = int64((FPlatformTime::Seconds() - StartTime) / FPlatformTime::GetSecondsPerCycle()));
 				COOK_STAT(UsageStats.GetStats.Accumulate(FCookStats::CallStats::EHitOrMiss::Hit, FCookStats::CallStats::EStatType::Cycles, CyclesUsed, bIsInGameThread));
+				COOK_STAT(UsageStats.GetLatency.Add(FPlatformTime::Seconds() - StartTime));
 			});
 		}
 	}
@@ -2722,6 +2917,7 @@ void FHttpCacheStoreParams::Parse(const TCHAR* NodeName, const TCHAR* Config)
 	// Cache Params
 
 	FParse::Bool(Config, TEXT("ReadOnly="), bReadOnly);
+	FParse::Value(Config, TEXT("BatchGetMaxRecords="), BatchGetMaxRecords);
 }
 
 } // UE::DerivedData
@@ -279,6 +279,7 @@ private:
 		UE_LOG(LogDerivedDataCache, Verbose, TEXT("%s: Cache Put complete for %s from '%s'"),
 			*CacheStore.GetName(), *WriteToString<96>(Key), *Request.Name);
 		COOK_STAT(Timer.AddHit(Private::GetCacheRecordCompressedSize(Request.Record)));
+		COOK_STAT(CacheStore.UsageStats.PutLatency.Add(FPlatformTime::Seconds() - StartTime));
 		OnComplete(Request.MakeResponse(EStatus::Ok));
 	};
 
@@ -288,6 +289,7 @@ private:
 		UE_LOG(LogDerivedDataCache, Verbose, TEXT("%s: Cache Put miss for '%s' from '%s'"),
 			*CacheStore.GetName(), *WriteToString<96>(Key), *Request.Name);
 		COOK_STAT(Timer.AddMiss());
+		COOK_STAT(CacheStore.UsageStats.PutLatency.Add(FPlatformTime::Seconds() - StartTime));
 		OnComplete(Request.MakeResponse(EStatus::Error));
 	};
 
@@ -298,6 +300,7 @@ private:
 	TBatchView<const FCachePutRequest> Batches;
 	FOnCachePutComplete OnComplete;
 	COOK_STAT(FCookStats::FScopedStatsCounter Timer = CacheStore.UsageStats.TimePut());
+	COOK_STAT(const double StartTime = FPlatformTime::Seconds());
 };
 
 class FZenCacheStore::FGetOp final : public FThreadSafeRefCountedObject
@@ -417,6 +420,7 @@ private:
 		int64 ReceivedSize = Private::GetCacheRecordCompressedSize(Record);
 		TRACE_COUNTER_ADD(ZenDDC_BytesReceived, ReceivedSize);
 		COOK_STAT(Timer.AddHit(ReceivedSize));
+		COOK_STAT(CacheStore.UsageStats.GetLatency.Add(FPlatformTime::Seconds() - StartTime));
 
 		OnComplete({Request.Name, MoveTemp(Record), Request.UserData, EStatus::Ok});
 	};
@@ -425,6 +429,7 @@ private:
 	{
 		UE_LOG(LogDerivedDataCache, Verbose, TEXT("%s: Cache miss for '%s' from '%s'"),
 			*CacheStore.GetName(), *WriteToString<96>(Request.Key), *Request.Name);
+		COOK_STAT(CacheStore.UsageStats.GetLatency.Add(FPlatformTime::Seconds() - StartTime));
 
 		OnComplete(Request.MakeResponse(EStatus::Error));
 	};
@@ -434,6 +439,7 @@ private:
 	const TArray<FCacheGetRequest, TInlineAllocator<1>> Requests;
 	FOnCacheGetComplete OnComplete;
 	COOK_STAT(FCookStats::FScopedStatsCounter Timer = CacheStore.UsageStats.TimeGet());
+	COOK_STAT(const double StartTime = FPlatformTime::Seconds());
 };
 
 class FZenCacheStore::FPutValueOp final : public FThreadSafeRefCountedObject
@@ -554,6 +560,7 @@ private:
 		UE_LOG(LogDerivedDataCache, Verbose, TEXT("%s: Cache PutValue complete for %s from '%s'"),
 			*CacheStore.GetName(), *WriteToString<96>(Request.Key), *Request.Name);
 		COOK_STAT(Timer.AddHit(Request.Value.GetData().GetCompressedSize()));
+		COOK_STAT(CacheStore.UsageStats.PutLatency.Add(FPlatformTime::Seconds() - StartTime));
 		OnComplete(Request.MakeResponse(EStatus::Ok));
 	};
 
@@ -562,6 +569,7 @@ private:
 		UE_LOG(LogDerivedDataCache, Verbose, TEXT("%s: Cache PutValue miss for '%s' from '%s'"),
 			*CacheStore.GetName(), *WriteToString<96>(Request.Key), *Request.Name);
 		COOK_STAT(Timer.AddMiss());
+		COOK_STAT(CacheStore.UsageStats.PutLatency.Add(FPlatformTime::Seconds() - StartTime));
 		OnComplete(Request.MakeResponse(EStatus::Error));
 	};
 
@@ -572,6 +580,7 @@ private:
 	TBatchView<const FCachePutValueRequest> Batches;
 	FOnCachePutValueComplete OnComplete;
 	COOK_STAT(FCookStats::FScopedStatsCounter Timer = CacheStore.UsageStats.TimePut());
+	COOK_STAT(const double StartTime = FPlatformTime::Seconds());
 };
 
 class FZenCacheStore::FGetValueOp final : public FThreadSafeRefCountedObject
@@ -703,6 +712,7 @@ private:
 		int64 ReceivedSize = Value.GetData().GetCompressedSize();
 					TRACE_COUNTER_ADD(ZenDDC_BytesReceived, ReceivedSize);
 					COOK_STAT(Timer.AddHit(ReceivedSize));
+		COOK_STAT(CacheStore.UsageStats.GetLatency.Add(FPlatformTime::Seconds() - StartTime));
 
 		OnComplete({Request.Name, Request.Key, MoveTemp(Value), Request.UserData, EStatus::Ok});
 	};
@@ -711,6 +721,7 @@ private:
 	{
 		UE_LOG(LogDerivedDataCache, Verbose, TEXT("%s: Cache miss for '%s' from '%s'"),
 			*CacheStore.GetName(), *WriteToString<96>(Request.Key), *Request.Name);
+		COOK_STAT(CacheStore.UsageStats.GetLatency.Add(FPlatformTime::Seconds() - StartTime));
 
 		OnComplete(Request.MakeResponse(EStatus::Error));
 	};
@@ -720,6 +731,7 @@ private:
 	const TArray<FCacheGetValueRequest, TInlineAllocator<1>> Requests;
 	FOnCacheGetValueComplete OnComplete;
 	COOK_STAT(FCookStats::FScopedStatsCounter Timer = CacheStore.UsageStats.TimeGet());
+	COOK_STAT(const double StartTime = FPlatformTime::Seconds());
 };
 
 class FZenCacheStore::FGetChunksOp final : public FThreadSafeRefCountedObject
@@ -6,6 +6,7 @@
 #include "Containers/UnrealString.h"
 #include "CoreMinimal.h"
 #include "HAL/Platform.h"
+#include "HAL/ThreadSafeCounter64.h"
 #include "ProfilingDebugging/CookStats.h"
 #include "Templates/Function.h"
 #include "Templates/SharedPointer.h"
@@ -61,6 +62,75 @@ class FDerivedDataCacheUsageStats
 {
 #if ENABLE_COOK_STATS
 public:
+	/** Histogram of request latencies in quarter octave buckets of microseconds, for percentiles that the accumulated times cannot give. */
+	struct FLatencyHistogram
+	{
+		static constexpr int32 NumBuckets = 128;
+
+		void Add(double Seconds)
+		{
+			const double Microseconds = FMath::Max(Seconds * 1000000.0, 1.0);
+			Buckets[FMath::Clamp(FMath::FloorToInt32(4.0 * FMath::Log2(Microseconds)), 0, NumBuckets - 1)].Increment();
+		}
+
+		int64 GetCount() const
+		{
+			int64 Count = 0;
+			for (const FThreadSafeCounter64& Bucket : Buckets)
+			{
+				Count += Bucket.GetValue();
+			}
+			return Count;
+		}
+
+		/** Returns the latency at the percentile in [0, 1] in milliseconds, at the middle of its bucket. */
+		double GetPercentileMs(double Percentile) const
+		{
+			const int64 Count = GetCount();
+			if (Count == 0)
+			{
+				return 0.0;
+			}
+
+			const int64 Rank = FMath::Max<int64>(FMath::CeilToInt64(Percentile * double(Count)), 1);
+			int64 Accumulated = 0;
+			int32 BucketIndex = 0;
+			for (; BucketIndex < NumBuckets - 1; ++BucketIndex)
+			{
+				Accumulated += Buckets[BucketIndex].GetValue();
+				if (Accumulated >= Rank)
+				{
+					break;
+				}
+			}
+			return FMath::Pow(2.0, (double(BucketIndex) + 0.5) / 4.0) / 1000.0;
+		}
+
+		void Combine(const FLatencyHistogram& Other)
+		{
+			for (int32 BucketIndex = 0; BucketIndex < NumBuckets; ++BucketIndex)
+			{
+				Buckets[BucketIndex].Add(Other.Buckets[BucketIndex].GetValue());
+			}
+		}
+
+		void LogStats(FCookStatsManager::AddStatFuncRef AddStat, const FString& StatName, const FString& NodeName, const TCHAR* CallName) const
+		{
+			if (const int64 Count = GetCount())
+			{
+				AddStat(StatName, FCookStatsManager::CreateKeyValueArray(
+					TEXT("Call"), CallName,
+					TEXT("Count"), Count,
+					TEXT("P50Ms"), GetPercentileMs(0.5),
+					TEXT("P90Ms"), GetPercentileMs(0.9),
+					TEXT("P99Ms"), GetPercentileMs(0.99),
+					TEXT("Node"), NodeName
+					));
+			}
+		}
+
+		FThreadSafeCounter64 Buckets[NumBuckets];
+	};
 
 	/** Call this at the top of the CachedDataProbablyExists override. auto Timer = TimeProbablyExists(); */
 	FCookStats::FScopedStatsCounter TimeProbablyExists()
@@ -94,12 +164,21 @@ public:
 		PrefetchStats.LogStats(AddStat, StatName, NodeName, TEXT("Prefetch"));
 	}
 
+	/** Logs the latency percentiles of the nodes that record them, under a separate stat name as the attributes differ from LogStats. */
+	void LogLatencyStats(FCookStatsManager::AddStatFuncRef AddStat, const FString& StatName, const FString& NodeName) const
+	{
+		GetLatency.LogStats(AddStat, StatName, NodeName, TEXT("Get"));
+		PutLatency.LogStats(AddStat, StatName, NodeName, TEXT("Put"));
+	}
+
 	void Combine(const FDerivedDataCacheUsageStats& Other)
 	{
 		GetStats.Combine(Other.GetStats);
 		PutStats.Combine(Other.PutStats);
 		ExistsStats.Combine(Other.ExistsStats);
 		PrefetchStats.Combine(Other.PrefetchStats);
+		GetLatency.Combine(Other.GetLatency);
+		PutLatency.Combine(Other.PutLatency);
 	}
 
 	// expose these publicly for low level access. These should really never be accessed directly except when finished accumulating them.
@@ -107,6 +186,10 @@ public:
 	FCookStats::CallStats PutStats;
 	FCookStats::CallStats ExistsStats;
 	FCookStats::CallStats PrefetchStats;
+
+	/** Time from issuing a request to its completion, only recorded by the remote cache stores */
+	FLatencyHistogram GetLatency;
+	FLatencyHistogram PutLatency;
 #endif
 };
 
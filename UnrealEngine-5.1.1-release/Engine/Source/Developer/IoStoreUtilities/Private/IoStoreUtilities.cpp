@@ -65,6 +65,10 @@
 #include "ZenFileSystemManifest.h"
 #include "IPlatformFileSandboxWrapper.h"
 #include "Misc/PathViews.h"
+#include "TraceServices/AnalysisService.h"
+#include "TraceServices/ITraceServicesModule.h"
+#include "TraceServices/Model/AnalysisSession.h"
+#include "TraceServices/Model/LoadTimeProfiler.h"
 
 //PRAGMA_DISABLE_OPTIMIZATION
 
@@ -418,6 +422,7 @@ struct FContainerSourceSpec
 	TArray<FContainerSourceFile> SourceFiles;
 	FString PatchTargetFile;
 	TArray<FString> PatchSourceContainerFiles;
+	TArray<FString> DeduplicationSourceContainerFiles;
 	FGuid EncryptionKeyOverrideGuid;
 	bool bGenerateDiffPatch = false;
 };
@@ -895,6 +900,7 @@ struct FIoStoreArguments
 	TArray<FContainerSourceSpec> Containers;
 	FCookedFileStatMap CookedFileStatMap;
 	TArray<FFileOrderMap> OrderMaps;
+	FIoPreloadManifest PreloadManifest;
 	FKeyChain KeyChain;
 	FKeyChain PatchKeyChain;
 	FString DLCPluginPath;
@@ -930,6 +936,7 @@ struct FContainerTargetSpec
 	TSharedPtr<IIoStoreWriter> OptionalSegmentIoStoreWriter;
 	TArray<FContainerTargetFile> TargetFiles;
 	TArray<TUniquePtr<FIoStoreReader>> PatchSourceReaders;
+	TArray<TUniquePtr<FIoStoreReader>> DeduplicationSourceReaders;
 	EIoContainerFlags ContainerFlags = EIoContainerFlags::None;
 	TArray<FLegacyCookedPackage*> Packages;
 	TSet<FShaderInfo*> GlobalShaders;
@@ -1667,6 +1674,21 @@ TArray<TUniquePtr<FIoStoreReader>> CreatePatchSourceReaders(const TArray<FString
 	return Readers;
 }
 
+TArray<TUniquePtr<FIoStoreReader>> CreateDeduplicationSourceReaders(const TArray<FString>& Files, const FIoStoreArguments& Arguments)
+{
+	TArray<TUniquePtr<FIoStoreReader>> Readers;
+	for (const FString& SourceContainerFile : Files)
+	{
+		TUniquePtr<FIoStoreReader> Reader = CreateIoStoreReader(*SourceContainerFile, Arguments.KeyChain);
+		if (Reader.IsValid())
+		{
+			UE_LOG(LogIoStore, Display, TEXT("Loaded deduplication source container '%s'"), *SourceContainerFile);
+			Readers.Add(MoveTemp(Reader));
+		}
+	}
+	return Readers;
+}
+
 bool LoadShaderAssetInfo(const FString& Filename, TMap<FSHAHash, TSet<FName>>& OutShaderCodeToAssets)
 {
 	FString JsonText; 
@@ -2382,6 +2404,7 @@ void InitializeContainerTargetsAndPackages(
 		}
 
 		ContainerTarget->PatchSourceReaders = CreatePatchSourceReaders(ContainerSource.PatchSourceContainerFiles, Arguments);
+		ContainerTarget->DeduplicationSourceReaders = CreateDeduplicationSourceReaders(ContainerSource.DeduplicationSourceContainerFiles, Arguments);
 
 		{
 			IOSTORE_CPU_SCOPE(ProcessSourceFiles);
@@ -2521,6 +2544,14 @@ void LogWriterResults(const TArray<FIoStoreWriterResult>& Results)
 	{
 		UE_LOG(LogIoStore, Display, TEXT("%-30s %16d %16d %16d %16.2lf %16.2lf"), *Result.ContainerName, Result.TocEntryCount, Result.ModifiedChunksCount, Result.AddedChunksCount, Result.ModifiedChunksSize / 1024.0 / 1024.0, Result.AddedChunksSize / 1024.0 / 1024.0);
 	}
+
+	UE_LOG(LogIoStore, Display, TEXT(""));
+	UE_LOG(LogIoStore, Display, TEXT("------------------------------------------- Container Deduplication Report ----------------------------------------------"));
+	UE_LOG(LogIoStore, Display, TEXT("%-30s %16s %16s"), TEXT("Container"), TEXT("Referenced (count)"), TEXT("Referenced (MB)"));
+	for (const FIoStoreWriterResult& Result : Results)
+	{
+		UE_LOG(LogIoStore, Display, TEXT("%-30s %16llu %16.2lf"), *Result.ContainerName, Result.ReferencedChunksCount, Result.ReferencedChunksSize / 1024.0 / 1024.0);
+	}
 }
 
 void LogContainerPackageInfo(const TArray<FContainerTargetSpec*>& ContainerTargets)
@@ -3367,6 +3398,10 @@ int32 CreateTarget(const FIoStoreArguments& Arguments, const FIoStoreWriterSetti
 				ContainerSettings.bGenerateDiffPatch = ContainerTarget->bGenerateDiffPatch;
 				ContainerTarget->IoStoreWriter = IoStoreWriterContext->CreateContainer(*ContainerTarget->OutputPath, ContainerSettings);
 				ContainerTarget->IoStoreWriter->EnableDiskLayoutOrdering(ContainerTarget->PatchSourceReaders);
+				if (ContainerTarget->DeduplicationSourceReaders.Num())
+				{
+					ContainerTarget->IoStoreWriter->EnableChunkDeduplication(ContainerTarget->DeduplicationSourceReaders);
+				}
 				ContainerTarget->IoStoreWriter->SetReferenceChunkDatabase(ChunkDatabase);
 				IoStoreWriters.Add(ContainerTarget->IoStoreWriter);
 				if (!ContainerTarget->OptionalSegmentOutputPath.IsEmpty())
@@ -3576,6 +3611,30 @@ int32 CreateTarget(const FIoStoreArguments& Arguments, const FIoStoreWriterSetti
 		FIoWriteOptions WriteOptions;
 		WriteOptions.DebugName = TEXT("ScriptObjects");
 		GlobalIoStoreWriter->Append(CreateIoChunkId(0, 0, EIoChunkType::ScriptObjects), ScriptObjectsBuffer, WriteOptions);
+
+		if (Arguments.PreloadManifest.ChunkIds.Num())
+		{
+			// Recorded chunks that were removed from the build since the recording can't be preloaded
+			TSet<FIoChunkId> ContainerChunkIds;
+			for (const FContainerTargetSpec* ContainerTarget : ContainerTargets)
+			{
+				for (const FContainerTargetFile& TargetFile : ContainerTarget->TargetFiles)
+				{
+					ContainerChunkIds.Add(TargetFile.ChunkId);
+				}
+			}
+			FIoPreloadManifest PreloadManifest;
+			for (const FIoChunkId& ChunkId : Arguments.PreloadManifest.ChunkIds)
+			{
+				if (ContainerChunkIds.Contains(ChunkId))
+				{
+					PreloadManifest.ChunkIds.Add(ChunkId);
+				}
+			}
+			UE_LOG(LogIoStore, Display, TEXT("Writing preload manifest with %d of %d recorded chunks"), PreloadManifest.ChunkIds.Num(), Arguments.PreloadManifest.ChunkIds.Num());
+			WriteOptions.DebugName = TEXT("PreloadManifest");
+			GlobalIoStoreWriter->Append(CreatePreloadManifestChunkId(), PreloadManifest.Save(), WriteOptions);
+		}
 	}
 
 	UE_LOG(LogIoStore, Display, TEXT("Serializing container(s)..."));
@@ -6165,6 +6224,23 @@ static bool ParseOrderFileArguments(FIoStoreArguments& Arguments)
 	}
 
 	Arguments.bClusterByOrderFilePriority = !FParse::Param(FCommandLine::Get(), TEXT("DoNotClusterByOrderPriority"));
+
+	FString PreloadOrderStr;
+	if (FParse::Value(FCommandLine::Get(), TEXT("PreloadOrder="), PreloadOrderStr, false))
+	{
+		TArray<FString> PreloadOrderPaths;
+		PreloadOrderStr.ParseIntoArray(PreloadOrderPaths, TEXT(","), true);
+		for (const FString& PreloadOrderPath : PreloadOrderPaths)
+		{
+			// Recordings are merged in order, chunks that are already in the manifest keep their position
+			if (!Arguments.PreloadManifest.LoadRecording(*PreloadOrderPath))
+			{
+				UE_LOG(LogIoStore, Error, TEXT("Failed to load IO request order '%s'"), *PreloadOrderPath);
+				return false;
+			}
+			UE_LOG(LogIoStore, Display, TEXT("Loaded IO request order '%s', %d chunks in the preload manifest"), *PreloadOrderPath, Arguments.PreloadManifest.ChunkIds.Num());
+		}
+	}
 	
 	return true;
 }
@@ -6347,6 +6423,24 @@ bool ParseContainerGenerationArguments(FIoStoreArguments& Arguments, FIoStoreWri
 				}
 			}
 
+			FString DeduplicationSourceWildcard;
+			if (FParse::Value(*Command, TEXT("DeduplicateAgainst="), DeduplicationSourceWildcard))
+			{
+				IFileManager::Get().FindFiles(ContainerSpec.DeduplicationSourceContainerFiles, *DeduplicationSourceWildcard, true, false);
+				FString DeduplicationSourceContainersDirectory = FPaths::GetPath(*DeduplicationSourceWildcard);
+				for (FString& DeduplicationSourceContainerFile : ContainerSpec.DeduplicationSourceContainerFiles)
+				{
+					DeduplicationSourceContainerFile = DeduplicationSourceContainersDirectory / DeduplicationSourceContainerFile;
+					FPaths::NormalizeFilename(DeduplicationSourceContainerFile);
+				}
+				// A container can't reference itself
+				const FString OwnTocFile = FPaths::ChangeExtension(ContainerSpec.OutputPath, TEXT(".utoc"));
+				ContainerSpec.DeduplicationSourceContainerFiles.RemoveAll([&OwnTocFile](const FString& DeduplicationSourceContainerFile)
+					{
+						return FPaths::IsSamePath(DeduplicationSourceContainerFile, OwnTocFile);
+					});
+			}
+
 			ContainerSpec.bGenerateDiffPatch = FParse::Param(*Command, TEXT("GenerateDiffPatch"));
 
 			FParse::Value(*Command, TEXT("PatchTarget="), ContainerSpec.PatchTargetFile);
@@ -6394,6 +6488,208 @@ bool ParseContainerGenerationArguments(FIoStoreArguments& Arguments, FIoStoreWri
 	return true;
 }
 
+struct FTracedPackageLoadOrder
+{
+	FString TracePath;
+	// package names in the order they were first loaded or read
+	TArray<FName> Packages;
+};
+
+static bool ReadPackageLoadOrderFromTrace(TraceServices::IAnalysisService& AnalysisService, const FString& TracePath, FTracedPackageLoadOrder& Out)
+{
+	IOSTORE_CPU_SCOPE(ReadPackageLoadOrderFromTrace);
+
+	TSharedPtr<const TraceServices::IAnalysisSession> Session = AnalysisService.StartAnalysis(*TracePath);
+	if (!Session.IsValid())
+	{
+		UE_LOG(LogIoStore, Error, TEXT("Failed to analyze trace '%s'"), *TracePath);
+		return false;
+	}
+	Session->Wait();
+
+	struct FFirstSeen
+	{
+		double Time;
+		int32 Sequence;
+	};
+	TMap<FName, FFirstSeen> FirstSeenMap;
+	int32 NextSequence = 0;
+	auto AddPackage = [&FirstSeenMap, &NextSequence](FName PackageName, double Time)
+	{
+		FFirstSeen* Existing = FirstSeenMap.Find(PackageName);
+		if (!Existing)
+		{
+			FirstSeenMap.Add(PackageName, { Time, NextSequence++ });
+		}
+		else if (Time < Existing->Time)
+		{
+			Existing->Time = Time;
+		}
+	};
+
+	{
+		TraceServices::FAnalysisSessionReadScope _(*Session);
+
+		// requests of the async loader, each request lists the packages that were loaded by it
+		if (const TraceServices::ILoadTimeProfilerProvider* LoadTimeProvider = TraceServices::ReadLoadTimeProfilerProvider(*Session))
+		{
+			TUniquePtr<TraceServices::ITableReader<TraceServices::FLoadRequest>> Reader(LoadTimeProvider->GetRequestsTable().CreateReader());
+			for (; Reader->IsValid(); Reader->NextRow())
+			{
+				const TraceServices::FLoadRequest* Request = Reader->GetCurrentRow();
+				for (const TraceServices::FPackageInfo* Package : Request->Packages)
+				{
+					if (Package && Package->Name)
+					{
+						AddPackage(FName(Package->Name), Request->StartTime);
+					}
+				}
+			}
+		}
+
+		// reads of loose cooked package files, e.g. traces of a staged build that doesn't use IoStore
+		if (const TraceServices::IFileActivityProvider* FileActivityProvider = TraceServices::ReadFileActivityProvider(*Session))
+		{
+			TUniquePtr<TraceServices::ITableReader<TraceServices::FFileActivity>> Reader(FileActivityProvider->GetFileActivityTable().CreateReader());
+			for (; Reader->IsValid(); Reader->NextRow())
+			{
+				const TraceServices::FFileActivity* Activity = Reader->GetCurrentRow();
+				if (Activity->ActivityType != TraceServices::FileActivityType_Read || Activity->Failed || !Activity->File || !Activity->File->Path)
+				{
+					continue;
+				}
+				FStringView Extension = FPathViews::GetExtension(Activity->File->Path);
+				if (Extension != TEXTVIEW("uasset") && Extension != TEXTVIEW("umap") && Extension != TEXTVIEW("uexp") && Extension != TEXTVIEW("ubulk") && Extension != TEXTVIEW("uptnl"))
+				{
+					continue;
+				}
+				FString PackageName;
+				if (FPackageName::TryConvertFilenameToLongPackageName(Activity->File->Path, PackageName))
+				{
+					AddPackage(FName(PackageName), Activity->StartTime);
+				}
+			}
+		}
+	}
+
+	FirstSeenMap.GetKeys(Out.Packages);
+	Algo::StableSort(Out.Packages, [&FirstSeenMap](FName A, FName B)
+	{
+		const FFirstSeen& FirstSeenA = FirstSeenMap.FindChecked(A);
+		const FFirstSeen& FirstSeenB = FirstSeenMap.FindChecked(B);
+		if (FirstSeenA.Time != FirstSeenB.Time)
+		{
+			return FirstSeenA.Time < FirstSeenB.Time;
+		}
+		return FirstSeenA.Sequence < FirstSeenB.Sequence;
+	});
+	Out.TracePath = TracePath;
+
+	UE_LOG(LogIoStore, Display, TEXT("Trace '%s' loaded %d packages"), *TracePath, Out.Packages.Num());
+	return true;
+}
+
+/**
+ * Creates an order file for -Order= from the package loads recorded in one or more Insights traces (-trace=loadtime,file).
+ * Packages are placed in the order they were first loaded, so the chunks that are read together end up next to each other
+ * in the containers and share compression blocks. When several traces are given each package is ranked by its average relative
+ * position in the traces that loaded it, packages that are missing from a trace count as loaded at its end.
+ */
+static int32 CreateOrderFileFromTraces(const FString& OutputPath, const TArray<FString>& TracePaths)
+{
+	IOSTORE_CPU_SCOPE(CreateOrderFileFromTraces);
+
+	ITraceServicesModule& TraceServicesModule = FModuleManager::LoadModuleChecked<ITraceServicesModule>("TraceServices");
+	TSharedPtr<TraceServices::IAnalysisService> AnalysisService = TraceServicesModule.CreateAnalysisService();
+	if (!AnalysisService.IsValid())
+	{
+		UE_LOG(LogIoStore, Error, TEXT("Failed to create trace analysis service"));
+		return -1;
+	}
+
+	TArray<FTracedPackageLoadOrder> Traces;
+	for (const FString& TracePath : TracePaths)
+	{
+		FTracedPackageLoadOrder& Trace = Traces.AddDefaulted_GetRef();
+		if (!ReadPackageLoadOrderFromTrace(*AnalysisService, TracePath, Trace))
+		{
+			return -1;
+		}
+	}
+
+	struct FPackageRank
+	{
+		double RankSum = 0.0;
+		int32 TraceCount = 0;
+		int32 FirstTraceIndex = 0;
+		int32 FirstTraceOrder = 0;
+	};
+	TMap<FName, FPackageRank> Ranks;
+	for (int32 TraceIndex = 0; TraceIndex < Traces.Num(); ++TraceIndex)
+	{
+		const TArray<FName>& Packages = Traces[TraceIndex].Packages;
+		for (int32 Order = 0; Order < Packages.Num(); ++Order)
+		{
+			FPackageRank* Rank = Ranks.Find(Packages[Order]);
+			if (!Rank)
+			{
+				Rank = &Ranks.Add(Packages[Order]);
+				Rank->FirstTraceIndex = TraceIndex;
+				Rank->FirstTraceOrder = Order;
+			}
+			Rank->RankSum += double(Order) / double(FMath::Max(Packages.Num() - 1, 1));
+			++Rank->TraceCount;
+		}
+	}
+	if (Ranks.IsEmpty())
+	{
+		UE_LOG(LogIoStore, Error, TEXT("No package loads found in the traces, they need to be recorded with -trace=loadtime,file"));
+		return -1;
+	}
+
+	TArray<TPair<FName, double>> SortedPackages;
+	SortedPackages.Reserve(Ranks.Num());
+	for (const TPair<FName, FPackageRank>& Pair : Ranks)
+	{
+		const int32 MissingCount = Traces.Num() - Pair.Value.TraceCount;
+		SortedPackages.Emplace(Pair.Key, (Pair.Value.RankSum + MissingCount) / Traces.Num());
+	}
+	Algo::Sort(SortedPackages, [&Ranks](const TPair<FName, double>& A, const TPair<FName, double>& B)
+	{
+		if (A.Value != B.Value)
+		{
+			return A.Value < B.Value;
+		}
+		const FPackageRank& RankA = Ranks.FindChecked(A.Key);
+		const FPackageRank& RankB = Ranks.FindChecked(B.Key);
+		if (RankA.FirstTraceIndex != RankB.FirstTraceIndex)
+		{
+			return RankA.FirstTraceIndex < RankB.FirstTraceIndex;
+		}
+		return RankA.FirstTraceOrder < RankB.FirstTraceOrder;
+	});
+
+	TArray<FString> Lines;
+	Lines.Reserve(SortedPackages.Num() + Traces.Num() + 1);
+	Lines.Add(TEXT("# Generated by IoStore -CreateOrderFileFromTraces from:"));
+	for (const FTracedPackageLoadOrder& Trace : Traces)
+	{
+		Lines.Add(FString::Printf(TEXT("#   %s"), *Trace.TracePath));
+	}
+	for (int32 Order = 0; Order < SortedPackages.Num(); ++Order)
+	{
+		Lines.Add(FString::Printf(TEXT("%s %d"), *SortedPackages[Order].Key.ToString(), Order));
+	}
+	if (!FFileHelper::SaveStringArrayToFile(Lines, *OutputPath))
+	{
+		UE_LOG(LogIoStore, Error, TEXT("Failed to write order file '%s'"), *OutputPath);
+		return -1;
+	}
+
+	UE_LOG(LogIoStore, Display, TEXT("Wrote %d packages from %d trace(s) to order file '%s'"), SortedPackages.Num(), Traces.Num(), *OutputPath);
+	return 0;
+}
+
 int32 CreateIoStoreContainerFiles(const TCHAR* CmdLine)
 {
 	IOSTORE_CPU_SCOPE(CreateIoStoreContainerFiles);
@@ -6536,6 +6832,22 @@ int32 CreateIoStoreContainerFiles(const TCHAR* CmdLine)
 
 		return CreateContentPatch(Arguments, WriterSettings);
 	}
+	else if (FParse::Value(FCommandLine::Get(), TEXT("CreateOrderFileFromTraces="), ArgumentValue))
+	{
+		FString OutputPath = MoveTemp(ArgumentValue);
+		FString TracesArgument;
+		TArray<FString> TracePaths;
+		if (FParse::Value(FCommandLine::Get(), TEXT("Traces="), TracesArgument, false))
+		{
+			TracesArgument.ParseIntoArray(TracePaths, TEXT(","), true);
+		}
+		if (TracePaths.IsEmpty())
+		{
+			UE_LOG(LogIoStore, Error, TEXT("Incorrect arguments. Expected: -CreateOrderFileFromTraces=<order.txt> -Traces=<a.utrace>[,<b.utrace>...]"));
+			return -1;
+		}
+		return CreateOrderFileFromTraces(OutputPath, TracePaths);
+	}
 	else if (FParse::Param(FCommandLine::Get(), TEXT("GenerateZenFileSystemManifest")))
 	{
 		if (!TargetPlatform)
@@ -6611,6 +6923,7 @@ int32 CreateIoStoreContainerFiles(const TCHAR* CmdLine)
 		UE_LOG(LogIoStore, Display, TEXT("Usage:"));
 		UE_LOG(LogIoStore, Display, TEXT(" -List=</path/to/[container.utoc|*.utoc]> -CSV=<list.csv> [-CryptoKeys=</path/to/crypto.json>]"));
 		UE_LOG(LogIoStore, Display, TEXT(" -Describe=</path/to/global.utoc> [-PackageFilter=<PackageName>] [-DumpToFile=<describe.txt>] [-CryptoKeys=</path/to/crypto.json>]"));
+		UE_LOG(LogIoStore, Display, TEXT(" -CreateOrderFileFromTraces=<order.txt> -Traces=<a.utrace>[,<b.utrace>...]"));
 		return -1;
 	}
 
@@ -3049,6 +3049,8 @@ void WritePakFooter(FArchive& PakHandle, FPakFooterInfo& Footer)
 		if (bWritePathHashIndex)
 		{
 			{
+				// Sorted by hash so the runtime can memory map the index and search it in place, see FPakInfo::PakFile_Version_SortedPathHashIndex
+				PathHashIndex.KeySort(TLess<uint64>());
 				FMemoryWriter& SecondaryWriter = PathHashIndexWriter.GetSecondaryWriter();
 				SecondaryWriter << PathHashIndex;
 				SecondaryWriter << PrunedDirectoryIndex;
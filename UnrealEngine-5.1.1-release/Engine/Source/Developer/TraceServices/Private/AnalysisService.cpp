@@ -18,6 +18,7 @@
 #include "Model/NetProfilerProvider.h"
 #include "Model/ScreenshotProviderPrivate.h"
 #include "Model/ThreadsPrivate.h"
+#include "Tasks/Task.h"
 #include "Trace/Analysis.h"
 #include "Trace/Analyzer.h"
 #include "Trace/DataStream.h"
@@ -183,29 +184,95 @@ TSharedPtr<const IAnalysisSession> FAnalysisService::Analyze(const TCHAR* Sessio
 
 TSharedPtr<const IAnalysisSession> FAnalysisService::StartAnalysis(const TCHAR* SessionUri)
 {
+	// Reads the file ahead in large chunks on a background task, so the disk reads of large traces overlap the analysis
+	// of the previously read chunk instead of stalling the analysis thread.
 	struct FFileDataStream
 		: public UE::Trace::IInDataStream
 	{
+		static constexpr uint32 ReadAheadSize = 8 << 20;
+
+		FFileDataStream()
+		{
+			Buffer.SetNumUninitialized(ReadAheadSize);
+			ReadAheadBuffer.SetNumUninitialized(ReadAheadSize);
+		}
+
+		virtual ~FFileDataStream() override
+		{
+			Close();
+		}
+
 		virtual int32 Read(void* Data, uint32 Size) override
 		{
-			if (Remaining <= 0)
+			if (Cursor == Available)
+			{
+				if (!ReadAheadTask.IsValid())
+				{
+					StartReadAhead();
+				}
+				if (!ReadAheadTask.IsValid())
+				{
+					return 0;
+				}
+
+				ReadAheadTask.Wait();
+				ReadAheadTask = UE::Tasks::FTask();
+				Swap(Buffer, ReadAheadBuffer);
+				Available = ReadAheadBytes;
+				Cursor = 0;
+				if (Available == 0)
+				{
+					return 0;
+				}
+
+				StartReadAhead();
+			}
+
+			Size = FMath::Min(Size, Available - Cursor);
+			FMemory::Memcpy(Data, Buffer.GetData() + Cursor, Size);
+			Cursor += Size;
+			return Size;
+		}
+
+		virtual void Close() override
+		{
+			if (ReadAheadTask.IsValid())
 			{
-				return 0;
+				ReadAheadTask.Wait();
 			}
-			if (Size > Remaining)
+		}
+
+		void StartReadAhead()
+		{
+			if (Remaining == 0)
 			{
-				Size = static_cast<uint32>(Remaining);
+				return;
 			}
+
+			const uint32 Size = static_cast<uint32>(FMath::Min<uint64>(Remaining, ReadAheadSize));
 			Remaining -= Size;
-			if (!Handle->Read((uint8*)Data, Size))
+			ReadAheadTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [this, Size]
 			{
-				return 0;
-			}
-			return Size;
+				if (Handle->Read(ReadAheadBuffer.GetData(), Size))
+				{
+					ReadAheadBytes = Size;
+				}
+				else
+				{
+					ReadAheadBytes = 0;
+					Remaining = 0;
+				}
+			});
 		}
 
 		TUniquePtr<IFileHandle> Handle;
-		uint64 Remaining;
+		uint64 Remaining = 0;
+		TArray<uint8> Buffer;
+		TArray<uint8> ReadAheadBuffer;
+		uint32 Cursor = 0;
+		uint32 Available = 0;
+		uint32 ReadAheadBytes = 0;
+		UE::Tasks::FTask ReadAheadTask;
 	};
 
 	IPlatformFile& FileSystem = IPlatformFile::GetPlatformPhysical();
@@ -10513,8 +10513,59 @@ uint32 UCookOnTheFlyServer::CookFullLoadAndSave()
 		}
 		FCriticalSection AssetGeneratorLock;
 
+		// Packages holding objects of classes whose serialization is not safe to run off the game thread are saved one at a time after the parallel batch
+		TArray<int32> ConcurrentPackageIndices;
+		TArray<int32> SerialPackageIndices;
+		ConcurrentPackageIndices.Reserve(PackagesToSave.Num());
+		{
+			TArray<UClass*> ConcurrentSaveUnsafeClasses;
+			if (bSaveConcurrent)
+			{
+				TArray<FString> UnsafeClassPaths;
+				GConfig->GetArray(TEXT("CookSettings"), TEXT("ConcurrentSaveUnsafeClasses"), UnsafeClassPaths, GEditorIni);
+				for (const FString& UnsafeClassPath : UnsafeClassPaths)
+				{
+					if (UClass* UnsafeClass = FSoftClassPath(UnsafeClassPath).ResolveClass())
+					{
+						ConcurrentSaveUnsafeClasses.Add(UnsafeClass);
+					}
+					else
+					{
+						UE_LOG(LogCook, Warning, TEXT("ConcurrentSaveUnsafeClasses: could not find class %s."), *UnsafeClassPath);
+					}
+				}
+			}
+
+			TArray<UObject*> ObjectsInPackage;
+			for (int32 PackageIdx = 0; PackageIdx < PackagesToSave.Num(); ++PackageIdx)
+			{
+				bool bConcurrentSafe = true;
+				if (ConcurrentSaveUnsafeClasses.Num() > 0)
+				{
+					ObjectsInPackage.Reset();
+					GetObjectsWithOuter(PackagesToSave[PackageIdx]->GetPackage(), ObjectsInPackage, true);
+					for (UObject* Object : ObjectsInPackage)
+					{
+						UClass* ObjectClass = Object->GetClass();
+						if (ConcurrentSaveUnsafeClasses.ContainsByPredicate([ObjectClass](UClass* UnsafeClass) { return ObjectClass->IsChildOf(UnsafeClass); }))
+						{
+							bConcurrentSafe = false;
+							break;
+						}
+					}
+				}
+				(bConcurrentSafe ? ConcurrentPackageIndices : SerialPackageIndices).Add(PackageIdx);
+			}
+
+			if (bSaveConcurrent)
+			{
+				UE_LOG(LogCook, Display, TEXT("Saving %d packages concurrently, %d packages with concurrent save unsafe classes serially."),
+					ConcurrentPackageIndices.Num(), SerialPackageIndices.Num());
+			}
+		}
+
 		int64 ParallelSavedPackages = 0;
-		ParallelFor(PackagesToSave.Num(),
+		auto SavePackageForAllPlatforms =
 			[this, &PackagesToSave, &TargetPlatforms, &Generators, &ParallelSavedPackages, SaveFlags, bSaveConcurrent, &AssetGeneratorLock](int32 PackageIdx)
 		{
 			UE::Cook::FPackageData& PackageData = *PackagesToSave[PackageIdx];
@@ -10696,8 +10747,18 @@ uint32 UCookOnTheFlyServer::CookFullLoadAndSave()
 
 				Package->SetPackageFlagsTo(OriginalPackageFlags);
 			}
+		};
+
+		ParallelFor(ConcurrentPackageIndices.Num(), [&ConcurrentPackageIndices, &SavePackageForAllPlatforms](int32 Index)
+		{
+			SavePackageForAllPlatforms(ConcurrentPackageIndices[Index]);
 		}, !bSaveConcurrent);
 
+		for (int32 PackageIdx : SerialPackageIndices)
+		{
+			SavePackageForAllPlatforms(PackageIdx);
+		}
+
 		if (bSaveConcurrent)
 		{
 			GIsSavingPackage = false;
@@ -61,6 +61,12 @@ void FCookDirector::ParseConfig()
 	GConfig->GetInt(TEXT("CookSettings"), TEXT("CookWorkerCount"), RequestedCookWorkerCount, GEditorIni);
 	FParse::Value(CommandLine, TEXT("-CookWorkerCount="), RequestedCookWorkerCount);
 
+	// CookWorkerMaxInFlightAssignments
+	WorkerMaxInFlightAssignments = 64;
+	GConfig->GetInt(TEXT("CookSettings"), TEXT("CookWorkerMaxInFlightAssignments"), WorkerMaxInFlightAssignments, GEditorIni);
+	FParse::Value(CommandLine, TEXT("-CookWorkerMaxInFlight="), WorkerMaxInFlightAssignments);
+	WorkerMaxInFlightAssignments = FMath::Max(WorkerMaxInFlightAssignments, 0);
+
 	// CookDirectorListenPort
 	WorkerConnectPort = Sockets::COOKDIRECTOR_DEFAULT_REQUEST_CONNECTION_PORT;
 	FParse::Value(CommandLine, TEXT("-CookDirectorListenPort="), WorkerConnectPort);
@@ -313,9 +319,80 @@ void FCookDirector::TickFromSchedulerThread()
 	}
 	WorkersWithMessage.Empty();
 
+	StealUnsentAssignments();
 	SetWorkersStalled(bIsStalled);
 }
 
+void FCookDirector::StealUnsentAssignments()
+{
+	if (WorkerMaxInFlightAssignments <= 0)
+	{
+		return;
+	}
+	constexpr double StealPeriodSeconds = 0.5;
+	const double CurrentTime = FPlatformTime::Seconds();
+	if (CurrentTime - LastStealTimeSeconds < StealPeriodSeconds)
+	{
+		return;
+	}
+	LastStealTimeSeconds = CurrentTime;
+
+	TArray<TRefCountPtr<FCookWorkerServer>, TInlineAllocator<16>> Workers;
+	{
+		FScopeLock CommunicationScopeLock(&CommunicationLock);
+		for (TPair<int32, TRefCountPtr<FCookWorkerServer>>& Pair : RemoteWorkers)
+		{
+			Workers.Add(Pair.Value);
+		}
+	}
+
+	TArray<FCookWorkerServer*, TInlineAllocator<16>> StarvingWorkers;
+	TArray<TPair<FCookWorkerServer*, int32>, TInlineAllocator<16>> Donors;
+	for (TRefCountPtr<FCookWorkerServer>& Worker : Workers)
+	{
+		if (Worker->IsStarving())
+		{
+			StarvingWorkers.Add(Worker.GetReference());
+		}
+		else if (int32 NumUnsent = Worker->GetNumUnsentAssignments(); NumUnsent > 0)
+		{
+			Donors.Emplace(Worker.GetReference(), NumUnsent);
+		}
+	}
+
+	TArray<FPackageData*> StolenPackages;
+	for (FCookWorkerServer* StarvingWorker : StarvingWorkers)
+	{
+		Donors.Sort([](const TPair<FCookWorkerServer*, int32>& A, const TPair<FCookWorkerServer*, int32>& B)
+			{ return A.Value > B.Value; });
+		if (Donors.IsEmpty() || Donors[0].Value <= 0)
+		{
+			break;
+		}
+
+		// Split the queue of the most loaded worker, a donor with unsent assignments already has a full in-flight window
+		TPair<FCookWorkerServer*, int32>& Donor = Donors[0];
+		const int32 NumToSteal = FMath::Min(FMath::Max(Donor.Value / 2, 1), WorkerMaxInFlightAssignments);
+		StolenPackages.Reset();
+		Donor.Key->TakeUnsentAssignments(NumToSteal, StolenPackages, ECookDirectorThread::SchedulerThread);
+		if (StolenPackages.IsEmpty())
+		{
+			// Only constrained packages left
+			Donor.Value = 0;
+			continue;
+		}
+		Donor.Value -= StolenPackages.Num();
+
+		for (FPackageData* PackageData : StolenPackages)
+		{
+			PackageData->SetWorkerAssignment(StarvingWorker->GetWorkerId());
+		}
+		StarvingWorker->AppendStolenAssignments(StolenPackages, ECookDirectorThread::SchedulerThread);
+		UE_LOG(LogCook, Verbose, TEXT("CookWorker %d took %d packages from the queue of CookWorker %d."),
+			StarvingWorker->GetWorkerId().GetRemoteIndex(), StolenPackages.Num(), Donor.Key->GetWorkerId().GetRemoteIndex());
+	}
+}
+
 void FCookDirector::TickCommunication(ECookDirectorThread TickThread)
 {
 	bool bHasShutdownWorkers = false;
@@ -387,6 +464,7 @@ void FCookDirector::PumpCookComplete(bool& bCompleted)
 				for (TPair<int32, TRefCountPtr<FCookWorkerServer>>& Pair : RemoteWorkers)
 				{
 					FCookWorkerServer& RemoteWorker = *Pair.Value;
+					RemoteWorker.LogUtilisation();
 					RemoteWorker.SignalCookComplete(ECookDirectorThread::SchedulerThread);
 					check(RemoteWorker.IsShuttingDown());
 				}
@@ -168,6 +168,8 @@ private:
 
 	/** Move the given worker from active workers to the list of workers shutting down. */
 	void AbortWorker(FWorkerId WorkerId, ECookDirectorThread TickThread);
+	/** Move unsent assignments from the CookWorkers with the most queued packages to the CookWorkers running out of work. */
+	void StealUnsentAssignments();
 	/**
 	 * Periodically update whether (1) local server is done and (2) no results from cookworkers have come in.
 	 * Send warning when it goes on too long.
@@ -186,6 +188,7 @@ private:
 	UCookOnTheFlyServer& COTFS;
 	double WorkersStalledStartTimeSeconds = 0.;
 	double WorkersStalledWarnTimeSeconds = 0.;
+	double LastStealTimeSeconds = 0.;
 	bool bWorkersInitialized = false;
 	bool bHasReducedMachineResources = false;
 	bool bIsFirstAssignment = true;
@@ -199,6 +202,8 @@ private:
 	FString WorkerConnectAuthority;
 	FString CommandletExecutablePath;
 	int32 RequestedCookWorkerCount = 0;
+	/** Maximum number of packages sent to a CookWorker at once, the rest stay available for work stealing. 0 sends all assignments. */
+	int32 WorkerMaxInFlightAssignments = 0;
 	int32 WorkerConnectPort = 0;
 	int32 CoreLimit = 0;
 	EShowWorker ShowWorkerOption = EShowWorker::CombinedLogs;
@@ -207,6 +207,7 @@ void FRequestCluster::Initialize(UCookOnTheFlyServer& InCOTFS)
 		bAllowSoftDependencies = false;
 	}
 	bHybridIterativeEnabled = COTFS.bHybridIterativeEnabled;
+	bHybridIterativeDebug = COTFS.bHybridIterativeDebug;
 	if (bErrorOnEngineContentUse)
 	{
 		DLCPath = FPaths::Combine(*COTFS.GetBaseDirectoryForDLC(), TEXT("Content"));
@@ -733,7 +734,18 @@ void FRequestCluster::FGraphSearch::VisitVertex(const FVertexData& VertexData)
 		for (int32 PlatformIndex = 1; PlatformIndex < NumPlatforms; ++PlatformIndex)
 		{
 			const FCookAttachments& PlatformAttachments = VertexData.CookAttachments[PlatformIndex];
-			if (!IsCookAttachmentsValid(PackageName, PlatformAttachments))
+			if (Cluster.bHybridIterativeDebug && !Cluster.bFullBuild && Cluster.bHybridIterativeEnabled)
+			{
+				// Explain why each package has to be cooked again
+				FString InvalidationReason;
+				if (!IsCookAttachmentsValid(PackageName, PlatformAttachments, &InvalidationReason))
+				{
+					UE_LOG(LogCook, Display, TEXT("Iterative cook invalidated %s for %s: %s"), *WriteToString<256>(PackageName),
+						*Cluster.Platforms[PlatformIndex - 1]->PlatformName(), *InvalidationReason);
+					continue;
+				}
+			}
+			else if (!IsCookAttachmentsValid(PackageName, PlatformAttachments))
 			{
 				continue;
 			}
@@ -332,6 +332,7 @@ private:
 	bool bAllowHardDependencies = true;
 	bool bAllowSoftDependencies = true;
 	bool bHybridIterativeEnabled = true;
+	bool bHybridIterativeDebug = false;
 	bool bErrorOnEngineContentUse = false;
 	bool bAllowUncookedAssetReferences = false;
 	bool bPackageNamesComplete = false;
@@ -69,6 +69,70 @@ void FCookWorkerServer::AppendAssignments(TArrayView<FPackageData*> Assignments,
 	PackagesToAssign.Append(Assignments);
 }
 
+void FCookWorkerServer::AppendStolenAssignments(TArrayView<FPackageData*> Assignments, ECookDirectorThread TickThread)
+{
+	FCommunicationScopeLock ScopeLock(this, TickThread, ETickAction::Queue);
+	PackagesToAssign.Append(Assignments);
+	NumPackagesStolen += Assignments.Num();
+}
+
+void FCookWorkerServer::TakeUnsentAssignments(int32 MaxNum, TArray<FPackageData*>& OutPackages, ECookDirectorThread TickThread)
+{
+	FCommunicationScopeLock ScopeLock(this, TickThread, ETickAction::Queue);
+
+	// Take from the end: the queue is sorted from leaf to root, and the Client is loading the dependencies of the front
+	int32 NumTaken = 0;
+	for (int32 Index = PackagesToAssign.Num() - 1; Index >= 0 && NumTaken < MaxNum; --Index)
+	{
+		FPackageData* PackageData = PackagesToAssign[Index];
+		if (PackageData->GetWorkerAssignmentConstraint().IsValid())
+		{
+			// Generated packages have to be cooked on the worker that cooked their generator
+			continue;
+		}
+		OutPackages.Add(PackageData);
+		PackagesToAssign.RemoveAt(Index, 1, false /* bAllowShrinking */);
+		++NumTaken;
+	}
+	NumPackagesDonated += NumTaken;
+}
+
+int32 FCookWorkerServer::GetNumUnsentAssignments() const
+{
+	FScopeLock CommunicationScopeLock(&CommunicationLock);
+	return PackagesToAssign.Num();
+}
+
+bool FCookWorkerServer::IsStarving() const
+{
+	FScopeLock CommunicationScopeLock(&CommunicationLock);
+	return ConnectStatus == EConnectStatus::Connected && PackagesToAssign.IsEmpty()
+		&& PendingPackages.Num() <= Director.WorkerMaxInFlightAssignments / 2;
+}
+
+void FCookWorkerServer::UpdateUtilisation()
+{
+	const double CurrentTime = FPlatformTime::Seconds();
+	if (LastUtilisationTimeSeconds > 0.)
+	{
+		const double DeltaTime = CurrentTime - LastUtilisationTimeSeconds;
+		ConnectedSeconds += DeltaTime;
+		if (!PendingPackages.IsEmpty())
+		{
+			BusySeconds += DeltaTime;
+		}
+	}
+	LastUtilisationTimeSeconds = CurrentTime;
+}
+
+void FCookWorkerServer::LogUtilisation() const
+{
+	FScopeLock CommunicationScopeLock(&CommunicationLock);
+	UE_LOG(LogCook, Display, TEXT("CookWorker %d: %d packages cooked, busy for %.0f%% of %.1f seconds connected, %d packages taken from other CookWorkers, %d packages given to other CookWorkers."),
+		WorkerId.GetRemoteIndex(), NumPackagesCooked, ConnectedSeconds > 0. ? 100. * BusySeconds / ConnectedSeconds : 0.,
+		ConnectedSeconds, NumPackagesStolen, NumPackagesDonated);
+}
+
 void FCookWorkerServer::AbortAssignments(TSet<FPackageData*>& OutPendingPackages, ECookDirectorThread TickThread)
 {
 	FCommunicationScopeLock ScopeLock(this, TickThread, ETickAction::Queue);
@@ -233,6 +297,7 @@ void FCookWorkerServer::TickCommunication(ECookDirectorThread TickThread)
 			}
 			break;
 		case EConnectStatus::Connected:
+			UpdateUtilisation();
 			PumpReceiveMessages();
 			if (ConnectStatus == EConnectStatus::Connected)
 			{
@@ -398,16 +463,28 @@ void FCookWorkerServer::SendPendingPackages()
 		return;
 	}
 
+	// Keep the assignments beyond the in-flight limit on the Director, where idle CookWorkers can take them
+	int32 NumToSend = PackagesToAssign.Num();
+	if (Director.WorkerMaxInFlightAssignments > 0)
+	{
+		NumToSend = FMath::Min(NumToSend, Director.WorkerMaxInFlightAssignments - PendingPackages.Num());
+		if (NumToSend <= 0)
+		{
+			return;
+		}
+	}
+
 	TArray<FAssignPackageData> AssignDatas;
-	AssignDatas.Reserve(PackagesToAssign.Num());
-	for (FPackageData* PackageData : PackagesToAssign)
+	AssignDatas.Reserve(NumToSend);
+	for (int32 Index = 0; Index < NumToSend; ++Index)
 	{
+		FPackageData* PackageData = PackagesToAssign[Index];
 		FAssignPackageData& AssignData = AssignDatas.Emplace_GetRef();
 		AssignData.ConstructData = PackageData->CreateConstructData();
 		AssignData.Instigator = PackageData->GetInstigator();
+		PendingPackages.Add(PackageData);
 	}
-	PendingPackages.Append(PackagesToAssign);
-	PackagesToAssign.Empty();
+	PackagesToAssign.RemoveAt(0, NumToSend);
 	SendMessage(FAssignPackagesMessage(MoveTemp(AssignDatas)));
 }
 
@@ -565,6 +642,7 @@ void FCookWorkerServer::RecordResults(FPackageResultsMessage& Message)
 			continue;
 		}
 		PackageData->SetWorkerAssignment(FWorkerId::Invalid());
+		++NumPackagesCooked;
 
 		// MPCOOKTODO: Refactor FSaveCookedPackageContext::FinishPlatform and ::FinishPackage so we can call them from here
 		// to reduce duplication
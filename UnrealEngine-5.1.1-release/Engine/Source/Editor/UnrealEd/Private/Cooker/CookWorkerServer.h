@@ -43,6 +43,19 @@ public:
 
 	/** Add the given assignments for the CookWorker. They will be sent during Tick */
 	void AppendAssignments(TArrayView<FPackageData*> Assignments, ECookDirectorThread TickThread);
+	/** Add assignments taken from the unsent assignments of another CookWorker. */
+	void AppendStolenAssignments(TArrayView<FPackageData*> Assignments, ECookDirectorThread TickThread);
+	/**
+	 * Remove up to MaxNum assignments that have not yet been sent to the remote Client, from the end of the queue.
+	 * Packages constrained to this worker (generated packages) are kept.
+	 */
+	void TakeUnsentAssignments(int32 MaxNum, TArray<FPackageData*>& OutPackages, ECookDirectorThread TickThread);
+	/** Number of assignments that are queued but have not yet been sent to the remote Client. */
+	int32 GetNumUnsentAssignments() const;
+	/** Is this connected and running out of sent assignments, with none left to send? */
+	bool IsStarving() const;
+	/** Log the number of cooked packages and the fraction of the connected time the remote Client had assignments. */
+	void LogUtilisation() const;
 	/** Remove assignment of the package from local state and from the connected Client. */
 	void AbortAssignment(FPackageData& PackageData, ECookDirectorThread TickThread);
 	/**
@@ -143,6 +156,8 @@ private:
 	void RecordResults(FPackageResultsMessage& Message);
 	void LogInvalidMessage(const TCHAR* MessageTypeName);
 	void AddDiscoveredPackage(FDiscoveredPackage&& DiscoveredPackage);
+	/** Accumulate the connected and busy time since the last call. */
+	void UpdateUtilisation();
 
 	// Lock guarding access to all data on *this
 	mutable FCriticalSection CommunicationLock;
@@ -162,6 +177,12 @@ private:
 	uint32 CookWorkerProcessId = 0;
 	double ConnectStartTimeSeconds = 0.;
 	double ConnectTestStartTimeSeconds = 0.;
+	double LastUtilisationTimeSeconds = 0.;
+	double ConnectedSeconds = 0.;
+	double BusySeconds = 0.;
+	int32 NumPackagesCooked = 0;
+	int32 NumPackagesStolen = 0;
+	int32 NumPackagesDonated = 0;
 	FWorkerId WorkerId = FWorkerId::Invalid();
 	EConnectStatus ConnectStatus = EConnectStatus::Uninitialized;
 	bool bTerminateImmediately = false;
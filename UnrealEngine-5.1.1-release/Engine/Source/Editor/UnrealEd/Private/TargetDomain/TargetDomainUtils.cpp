@@ -75,7 +75,8 @@ private:
 };
 TUniquePtr<FEditorDomainOplog> GEditorDomainOplog;
 
-bool TryCreateKey(FName PackageName, TConstArrayView<FName> SortedBuildDependencies, FIoHash* OutHash, FString* OutErrorMessage)
+bool TryCreateKey(FName PackageName, TConstArrayView<FName> SortedBuildDependencies, FIoHash* OutHash, FString* OutErrorMessage,
+	TArray<FIoHash>* OutDigests)
 {
 	IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
 	if (!AssetRegistry)
@@ -97,10 +98,15 @@ bool TryCreateKey(FName PackageName, TConstArrayView<FName> SortedBuildDependenc
 		return false;
 	}
 	KeyBuilder.Update(&PackageDigest.Hash, sizeof(PackageDigest.Hash));
+	if (OutDigests)
+	{
+		OutDigests->Reset(SortedBuildDependencies.Num() + 1);
+		OutDigests->Add(PackageDigest.Hash);
+	}
 
 	for (FName DependencyName : SortedBuildDependencies)
 	{
-		PackageDigest = EditorDomain->GetPackageDigest(PackageName);
+		PackageDigest = EditorDomain->GetPackageDigest(DependencyName);
 		if (!PackageDigest.IsSuccessful())
 		{
 			if (OutErrorMessage)
@@ -111,6 +117,10 @@ bool TryCreateKey(FName PackageName, TConstArrayView<FName> SortedBuildDependenc
 			return false;
 		}
 		KeyBuilder.Update(&PackageDigest.Hash, sizeof(PackageDigest.Hash));
+		if (OutDigests)
+		{
+			OutDigests->Add(PackageDigest.Hash);
+		}
 	}
 
 	if (OutHash)
@@ -219,6 +229,13 @@ FCbObject CollectDependenciesObject(UPackage* Package, const ITargetPlatform* Ta
 		return FCbObject();
 	}
 
+	// Recording the key of each input lets the next cook report which of them invalidated the package
+	TArray<FIoHash> Digests;
+	if (!TryCreateKey(Package->GetFName(), BuildDependencies, nullptr /* OutHash */, ErrorMessage, &Digests))
+	{
+		return FCbObject();
+	}
+
 	FCbWriter Writer;
 	Writer.BeginObject();
 	Writer << "targetdomainkey" << TargetDomainKey;
@@ -233,6 +250,12 @@ FCbObject CollectDependenciesObject(UPackage* Package, const ITargetPlatform* Ta
 		}
 		Writer.EndArray();
 	}
+	Writer.BeginArray("digests");
+	for (const FIoHash& Digest : Digests)
+	{
+		Writer << Digest;
+	}
+	Writer.EndArray();
 	if (!RuntimeOnlyDependencies.IsEmpty())
 	{
 		Writer.BeginArray("runtimeonlydependencies");
@@ -324,6 +347,15 @@ void FetchCookAttachments(TArrayView<FName> PackageNames, const ITargetPlatform*
 			}
 		}
 
+		for (FCbFieldView DigestObj : DependenciesObj["digests"])
+		{
+			Result.StoredDigests.Add(DigestObj.AsHash());
+		}
+		if (Result.StoredDigests.Num() != Result.BuildDependencies.Num() + 1)
+		{
+			Result.StoredDigests.Empty();
+		}
+
 		const ANSICHAR* BuildDefinitionListKey = "BuildDefinitionList";
 		FCbObject BuildDefinitionListObj;
 		if (TargetPlatform)
@@ -352,21 +384,47 @@ void FetchCookAttachments(TArrayView<FName> PackageNames, const ITargetPlatform*
 	}
 }
 
-bool IsCookAttachmentsValid(FName PackageName, const FCookAttachments& CookAttachments)
+bool IsCookAttachmentsValid(FName PackageName, const FCookAttachments& CookAttachments, FString* OutInvalidationReason)
 {
 	if (!CookAttachments.bValid)
 	{
+		if (OutInvalidationReason) *OutInvalidationReason = TEXT("No dependencies were recorded by the previous cook.");
 		return false;
 	}
 
 	FIoHash CurrentKey;
-	if (!TryCreateKey(PackageName, CookAttachments.BuildDependencies, &CurrentKey, nullptr /* OutErrorMessage */))
+	TArray<FIoHash> CurrentDigests;
+	if (!TryCreateKey(PackageName, CookAttachments.BuildDependencies, &CurrentKey, OutInvalidationReason,
+		OutInvalidationReason ? &CurrentDigests : nullptr))
 	{
 		return false;
 	}
 
 	if (CookAttachments.StoredKey != CurrentKey)
 	{
+		if (OutInvalidationReason)
+		{
+			if (CookAttachments.StoredDigests.Num() != CurrentDigests.Num())
+			{
+				*OutInvalidationReason = TEXT("Inputs changed, the previous cook did not record the key of each input.");
+				return false;
+			}
+
+			TStringBuilder<256> Reason;
+			if (CookAttachments.StoredDigests[0] != CurrentDigests[0])
+			{
+				Reason << TEXT("Package changed.");
+			}
+			for (int32 DependencyIndex = 0; DependencyIndex < CookAttachments.BuildDependencies.Num(); ++DependencyIndex)
+			{
+				if (CookAttachments.StoredDigests[DependencyIndex + 1] != CurrentDigests[DependencyIndex + 1])
+				{
+					Reason << (Reason.Len() > 0 ? TEXT(" ") : TEXT("")) << TEXT("Build dependency ")
+						<< CookAttachments.BuildDependencies[DependencyIndex] << TEXT(" changed.");
+				}
+			}
+			*OutInvalidationReason = Reason.Len() > 0 ? FString(Reason.ToView()) : FString(TEXT("TargetDomainKey changed."));
+		}
 		return false;
 	}
 
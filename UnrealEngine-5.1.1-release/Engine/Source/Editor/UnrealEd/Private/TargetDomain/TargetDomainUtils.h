@@ -21,8 +21,12 @@ namespace UE::TargetDomain
 
 void UtilsInitialize(bool bEditorDomainEnabled);
 
-/** Create the TargetDomainKey based on the EditorDomainKeys of the Package and its dependencies. */
-bool TryCreateKey(FName PackageName, TConstArrayView<FName> SortedBuildDependencies, FIoHash* OutHash, FString* OutErrorMessage);
+/**
+ * Create the TargetDomainKey based on the EditorDomainKeys of the Package and its dependencies.
+ * OutDigests optionally receives the EditorDomainKey of the Package followed by the one of each dependency.
+ */
+bool TryCreateKey(FName PackageName, TConstArrayView<FName> SortedBuildDependencies, FIoHash* OutHash, FString* OutErrorMessage,
+	TArray<FIoHash>* OutDigests = nullptr);
 
 /** Collect the Package's dependencies and the key based on them. */
 bool TryCollectKeyAndDependencies(UPackage* Package, const ITargetPlatform* TargetPlatform,
@@ -38,6 +42,8 @@ struct FCookAttachments
 	TArray<FName> BuildDependencies;
 	TArray<FName> RuntimeOnlyDependencies;
 	TArray<UE::DerivedData::FBuildDefinition> BuildDefinitionList;
+	/** EditorDomainKeys recorded when the package was cooked, the Package's followed by one per BuildDependency. Empty in older oplogs. */
+	TArray<FIoHash> StoredDigests;
 	FIoHash StoredKey;
 	bool bValid = false;
 
@@ -46,6 +52,7 @@ struct FCookAttachments
 		BuildDependencies.Reset();
 		RuntimeOnlyDependencies.Reset();
 		BuildDefinitionList.Reset();
+		StoredDigests.Reset();
 		bValid = false;
 	}
 	void Empty()
@@ -53,13 +60,18 @@ struct FCookAttachments
 		BuildDependencies.Empty();
 		RuntimeOnlyDependencies.Empty();
 		BuildDefinitionList.Empty();
+		StoredDigests.Empty();
 		bValid = false;
 	}
 };
 void FetchCookAttachments(TArrayView<FName> PackageNames, const ITargetPlatform* TargetPlatform, ICookedPackageWriter* PackageWriter,
 	TUniqueFunction<void (FName PackageName, FCookAttachments&& Result)>&& Callback);
 
-bool IsCookAttachmentsValid(FName PackageName, const FCookAttachments& CookAttachments);
+/**
+ * Return whether the recorded inputs of the cooked package are unchanged.
+ * If not, OutInvalidationReason optionally receives a description of the inputs that changed.
+ */
+bool IsCookAttachmentsValid(FName PackageName, const FCookAttachments& CookAttachments, FString* OutInvalidationReason = nullptr);
 
 /** Return whether iterative cook is enabled for the given packagename, based on used-class allowlist/blocklist. */
 bool IsIterativeEnabled(FName PackageName);
@@ -258,6 +258,7 @@ TEST(BP, BroadphaseTests) {
 	ChaosTest::AABBTreeTest();
 	ChaosTest::AABBTreeTestDynamic();
 	ChaosTest::AABBTreeDirtyTreeTest();
+	ChaosTest::AABBTreeDirtyOverflowTreeTest();
 	ChaosTest::AABBTreeDirtyGridTest();
 	ChaosTest::AABBTreeTimesliceTest();
 	ChaosTest::DoForSweepIntersectCellsImpTest();
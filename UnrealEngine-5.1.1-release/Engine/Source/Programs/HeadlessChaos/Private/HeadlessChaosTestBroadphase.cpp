@@ -627,6 +627,49 @@ namespace ChaosTest
 		}
 	}
 
+	void AABBTreeDirtyOverflowTreeTest()
+	{
+		using TreeType = TAABBTree<int32, TAABBTreeLeafArray<int32>>;
+
+		// Save CVARS
+		const int32 SavedMaxDirtyElements = MaxDirtyElements;
+		const int32 SavedDirtyElementOverflowToTree = FAABBTreeDirtyGridCVars::DirtyElementOverflowToTree;
+
+		MaxDirtyElements = 10;
+		FAABBTreeDirtyGridCVars::DirtyElementOverflowToTree = 1;
+
+		// Exceeding the max dirty elements moves them to a dirty tree instead of rebuilding the tree
+		{
+			TUniquePtr<TBox<FReal, 3>> Box;
+			auto Boxes = BuildBoxes(Box);
+			EXPECT_GT((int32)Boxes->Size(), MaxDirtyElements);
+
+			TArray<TSOAView<FGeometryParticles>> EmptyArray;
+			TreeType Spatial(MakeParticleView(MoveTemp(EmptyArray)));
+
+			for (int32 Idx = 0; Idx < (int32)Boxes->Size(); ++Idx)
+			{
+				Spatial.UpdateElement(Idx, Boxes->WorldSpaceInflatedBounds(Idx), true);
+			}
+			EXPECT_EQ(Spatial.NumDirtyElements(), 0);
+			EXPECT_EQ(Spatial.GetNodes().Num(), 0);
+
+			SpatialTestHelper(Spatial, Boxes.Get(), Box);
+
+			// The dirty tree goes away on reset, and the dirty elements use the grid again
+			Spatial.Reset();
+			for (int32 Idx = 0; Idx < MaxDirtyElements; ++Idx)
+			{
+				Spatial.UpdateElement(Idx, Boxes->WorldSpaceInflatedBounds(Idx), true);
+			}
+			EXPECT_EQ(Spatial.NumDirtyElements(), MaxDirtyElements);
+		}
+
+		// Restore CVARS
+		MaxDirtyElements = SavedMaxDirtyElements;
+		FAABBTreeDirtyGridCVars::DirtyElementOverflowToTree = SavedDirtyElementOverflowToTree;
+	}
+
 	void AABBTreeDirtyGridTest()
 	{
 		using TreeType = TAABBTree<int32, TBoundingVolume<int32>>;
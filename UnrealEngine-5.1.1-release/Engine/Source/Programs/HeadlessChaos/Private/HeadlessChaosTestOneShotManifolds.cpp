@@ -22,6 +22,13 @@ namespace Chaos
 			const Chaos::FReal Dt,
 			Chaos::FPBDCollisionConstraint& Constraint);
 
+		void ConstructBoxBoxSATOneShotManifold(
+			const Chaos::FImplicitBox3& Box1,
+			const Chaos::FRigidTransform3& Box1Transform, //world
+			const Chaos::FImplicitBox3& Box2,
+			const Chaos::FRigidTransform3& Box2Transform, //world
+			Chaos::FPBDCollisionConstraint& Constraint);
+
 		template <typename ConvexImplicitType1, typename ConvexImplicitType2>
 		void ConstructConvexConvexOneShotManifold(
 			const ConvexImplicitType1& Implicit1,
@@ -219,6 +226,64 @@ namespace ChaosTest
 
 	}
 
+	// The separating axis box-box manifold should match the GJK based one on the simple cases
+	GTEST_TEST(OneShotManifoldTests, OneShotBoxBoxSAT)
+	{
+		const FReal Dt = 1 / 30.0f;
+
+		// One box on top of another (slightly separated), with a rotation so that either box can be the reference
+		for (const FReal Angle : { 0.0f, 0.1f, -0.1f })
+		{
+			TBox<FReal, 3> Box1(FVec3(-100.0f, -100, -100.0f), FVec3(100.0f, 100.0f, 100.0f));
+			TBox<FReal, 3> Box2(FVec3(-100.0f, -100, -100.0f), FVec3(100.0f, 100.0f, 100.0f));
+			FRigidTransform3 Box1Transform = FRigidTransform3(FVec3(0.0f, 0.0f, 210.0f), FRotation3::FromElements(0.0f, 0.0f, 0.0f, 1.0f));
+			FRigidTransform3 Box2Transform = FRigidTransform3(FVec3(0.0f, 0.0f, 0.0f), FRotation3::FromAxisAngle(FVec3(0.0f, 1.0f, 0.0f), Angle));
+
+			FPBDCollisionConstraint GJKConstraint;
+			Collisions::ConstructBoxBoxOneShotManifold(Box1, Box1Transform, Box2, Box2Transform, Dt, GJKConstraint);
+
+			FPBDCollisionConstraint SATConstraint;
+			Collisions::ConstructBoxBoxSATOneShotManifold(Box1, Box1Transform, Box2, Box2Transform, SATConstraint);
+
+			const int ContactCount = SATConstraint.GetManifoldPoints().Num();
+			EXPECT_EQ(ContactCount, 4);
+			EXPECT_EQ(ContactCount, GJKConstraint.GetManifoldPoints().Num());
+			for (int ConstraintIndex = 0; ConstraintIndex < ContactCount; ConstraintIndex++)
+			{
+				const FContactPoint& ContactPoint = SATConstraint.GetManifoldPoints()[ConstraintIndex].ContactPoint;
+				const FVec3 Location1 = Box1Transform.TransformPosition(FVec3(ContactPoint.ShapeContactPoints[0]));
+				const FVec3 Location2 = Box2Transform.TransformPosition(FVec3(ContactPoint.ShapeContactPoints[1]));
+				const FVec3 Normal = Box2Transform.TransformVector(FVec3(ContactPoint.ShapeContactNormal));
+				EXPECT_NEAR(ContactPoint.Phi, FVec3::DotProduct(Location1 - Location2, Normal), 0.01);
+				EXPECT_GT(Normal.Z, 0.99f);
+				if (Angle == 0.0f)
+				{
+					EXPECT_NEAR(ContactPoint.Phi, 10.0f, 0.01);
+				}
+			}
+		}
+
+		// Two boxes standing on an edge, crossing over each other
+		{
+			const FReal EdgeHeight = 100.0f * UE_SQRT_2;
+			TBox<FReal, 3> Box1(FVec3(-100.0f, -100, -100.0f), FVec3(100.0f, 100.0f, 100.0f));
+			TBox<FReal, 3> Box2(FVec3(-100.0f, -100, -100.0f), FVec3(100.0f, 100.0f, 100.0f));
+			FRigidTransform3 Box1Transform = FRigidTransform3(FVec3(0.0f, 0.0f, 2.0f * EdgeHeight + 10.0f), FRotation3::FromAxisAngle(FVec3(1.0f, 0.0f, 0.0f), PI / 4));
+			FRigidTransform3 Box2Transform = FRigidTransform3(FVec3(0.0f, 0.0f, 0.0f), FRotation3::FromAxisAngle(FVec3(0.0f, 1.0f, 0.0f), PI / 4));
+
+			FPBDCollisionConstraint Constraint;
+			Collisions::ConstructBoxBoxSATOneShotManifold(Box1, Box1Transform, Box2, Box2Transform, Constraint);
+			EXPECT_EQ(Constraint.GetManifoldPoints().Num(), 1);
+			if (Constraint.GetManifoldPoints().Num() == 1)
+			{
+				const FContactPoint& ContactPoint = Constraint.GetManifoldPoints()[0].ContactPoint;
+				EXPECT_EQ(ContactPoint.ContactType, EContactPointType::EdgeEdge);
+				EXPECT_NEAR(ContactPoint.Phi, 10.0f, 0.01);
+				EXPECT_NEAR(Box2Transform.TransformPosition(FVec3(ContactPoint.ShapeContactPoints[1])).Z, EdgeHeight, 0.01);
+			}
+		}
+	}
+
 	// Test that we correctly identify edge-edge contacts and calculate the correct separation
 	// even when we have large margins.
 	GTEST_TEST(OneShotManifoldTests, TestConvexMarginEdgeEdge)
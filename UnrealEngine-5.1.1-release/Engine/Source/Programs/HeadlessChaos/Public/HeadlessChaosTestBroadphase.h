@@ -18,6 +18,7 @@ namespace ChaosTest {
 	void AABBTreeTestDynamic();
 
 	void AABBTreeDirtyTreeTest();
+	void AABBTreeDirtyOverflowTreeTest();
 
 	void AABBTreeDirtyGridTest();
 
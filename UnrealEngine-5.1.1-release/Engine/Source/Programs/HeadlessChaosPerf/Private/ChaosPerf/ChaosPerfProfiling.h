@@ -4,4 +4,4 @@
 #include "CoreMinimal.h"
 #include "ProfilingDebugging/CSVProfiler.h"
 
-CSV_DEFINE_CATEGORY(ChaosPerf, true);
+CSV_DECLARE_CATEGORY_EXTERN(ChaosPerf);
@@ -0,0 +1,93 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ChaosPerf/ChaosPerf.h"
+#include "Chaos/Box.h"
+#include "Chaos/Collision/PBDCollisionConstraint.h"
+#include "Math/RandomStream.h"
+
+namespace Chaos
+{
+	namespace Collisions
+	{
+		// Forward declaration of functions that we need to test but is not part of the public interface
+		void ConstructBoxBoxOneShotManifold(
+			const FImplicitBox3& Box1,
+			const FRigidTransform3& Box1Transform, //world
+			const FImplicitBox3& Box2,
+			const FRigidTransform3& Box2Transform, //world
+			const FReal Dt,
+			FPBDCollisionConstraint& Constraint);
+
+		void ConstructBoxBoxSATOneShotManifold(
+			const FImplicitBox3& Box1,
+			const FRigidTransform3& Box1Transform, //world
+			const FImplicitBox3& Box2,
+			const FRigidTransform3& Box2Transform, //world
+			FPBDCollisionConstraint& Constraint);
+	}
+}
+
+namespace ChaosPerf
+{
+	using namespace Chaos;
+
+	// A pile of boxes resting on each other. Compares the GJK based box-box manifold (p.Chaos.Collision.Manifold.BoxBoxSAT off) with the separating axis one.
+	CHAOSPERF_TEST_BASIC(Collision, BoxBoxManifold)
+	{
+		const int32 NumPairs = 1024;
+		const int32 NumIterations = 200;
+		const FReal Dt = 1 / 30.0f;
+
+		const TBox<FReal, 3> Box(FVec3(-50.0f, -50.0f, -50.0f), FVec3(50.0f, 50.0f, 50.0f));
+
+		// Resting, tilted and crossed pairs, within cull distance
+		FRandomStream Random(1234);
+		TArray<FRigidTransform3> Transforms1;
+		TArray<FRigidTransform3> Transforms2;
+		for (int32 PairIndex = 0; PairIndex < NumPairs; ++PairIndex)
+		{
+			const FVec3 Offset(Random.FRandRange(-40.0f, 40.0f), Random.FRandRange(-40.0f, 40.0f), Random.FRandRange(95.0f, 110.0f));
+			const FRotation3 Rotation1 = FRotation3::FromAxisAngle(FVec3(Random.GetUnitVector()), Random.FRandRange(-0.3f, 0.3f));
+			const FRotation3 Rotation2 = FRotation3::FromAxisAngle(FVec3(0.0f, 0.0f, 1.0f), Random.FRandRange(-PI, PI));
+			Transforms1.Add(FRigidTransform3(Offset, Rotation1));
+			Transforms2.Add(FRigidTransform3(FVec3(0.0f), Rotation2));
+		}
+
+		TArray<FPBDCollisionConstraint> Constraints;
+		Constraints.SetNum(NumPairs);
+
+		int32 NumGJKContacts = 0;
+		{
+			CSV_SCOPED_TIMING_STAT(ChaosPerf, BoxBoxGJK);
+			for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+			{
+				for (int32 PairIndex = 0; PairIndex < NumPairs; ++PairIndex)
+				{
+					Collisions::ConstructBoxBoxOneShotManifold(Box, Transforms1[PairIndex], Box, Transforms2[PairIndex], Dt, Constraints[PairIndex]);
+				}
+			}
+		}
+		for (const FPBDCollisionConstraint& Constraint : Constraints)
+		{
+			NumGJKContacts += Constraint.GetManifoldPoints().Num();
+		}
+
+		int32 NumSATContacts = 0;
+		{
+			CSV_SCOPED_TIMING_STAT(ChaosPerf, BoxBoxSAT);
+			for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+			{
+				for (int32 PairIndex = 0; PairIndex < NumPairs; ++PairIndex)
+				{
+					Collisions::ConstructBoxBoxSATOneShotManifold(Box, Transforms1[PairIndex], Box, Transforms2[PairIndex], Constraints[PairIndex]);
+				}
+			}
+		}
+		for (const FPBDCollisionConstraint& Constraint : Constraints)
+		{
+			NumSATContacts += Constraint.GetManifoldPoints().Num();
+		}
+
+		UE_LOG(LogChaosPerf, Display, TEXT("BoxBoxManifold: %d pairs, %d GJK contacts, %d SAT contacts"), NumPairs, NumGJKContacts, NumSATContacts);
+	}
+}
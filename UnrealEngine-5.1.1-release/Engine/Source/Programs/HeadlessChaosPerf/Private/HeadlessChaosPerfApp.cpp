@@ -8,6 +8,7 @@ IMPLEMENT_APPLICATION(HeadlessChaosPerf, "HeadlessChaosPerf");
 #define LOCTEXT_NAMESPACE "HeadlessChaosPerf"
 
 DEFINE_LOG_CATEGORY(LogChaosPerf);
+CSV_DEFINE_CATEGORY(ChaosPerf, true);
 
 INT32_MAIN_INT32_ARGC_TCHAR_ARGV()
 {
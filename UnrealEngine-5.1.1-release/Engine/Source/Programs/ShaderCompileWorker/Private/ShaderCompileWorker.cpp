@@ -197,6 +197,9 @@ public:
 	// If we have been idle for 20 seconds then exit. Can be overriden from the cmd line with -TimeToLive=N where N is in seconds (and a float value)
 	float TimeToLive = 20.0f;
 
+	// Set with -PersistentWorker, the worker only exits with its parent process instead of after TimeToLive idle seconds
+	bool bPersistent = false;
+
 	FWorkLoop(const TCHAR* ParentProcessIdText,const TCHAR* InWorkingDirectory,const TCHAR* InInputFilename,const TCHAR* InOutputFilename, TMap<FString, uint32>& InFormatVersionMap)
 	:	ParentProcessId(FCString::Atoi(ParentProcessIdText))
 	,	WorkingDirectory(InWorkingDirectory)
@@ -216,9 +219,12 @@ public:
 				if (TokenTime > 0)
 				{
 					TimeToLive = TokenTime;
-					break;
 				}
 			}
+			else if (Switch == TEXT("PersistentWorker"))
+			{
+				bPersistent = true;
+			}
 		}
 	}
 
@@ -322,8 +328,10 @@ private:
 			if(!InputFile && !bFirstOpenTry)
 			{
 				CheckExitConditions();
-				// Give up CPU time while we are waiting
-				FPlatformProcess::Sleep(0.01f);
+				// Give up CPU time while we are waiting. The next batch is usually written as soon as the previous results were read,
+				// so poll at a higher rate right after a job to not add a full sleep to every batch.
+				const bool bRecentlyCompiled = (FPlatformTime::Seconds() - LastCompileTime) < 0.1;
+				FPlatformProcess::Sleep(bRecentlyCompiled ? 0.001f : 0.01f);
 			}
 			bFirstOpenTry = false;
 		}
@@ -848,7 +856,7 @@ private:
 		}
 
 		const double CurrentTime = FPlatformTime::Seconds();
-		if (CurrentTime - LastCompileTime > TimeToLive)
+		if (!bPersistent && CurrentTime - LastCompileTime > TimeToLive)
 		{
 			UE_LOG(LogShaders, Log, TEXT("No jobs found for %f seconds, exiting"), (float)(CurrentTime - LastCompileTime));
 			FPlatformMisc::RequestExit(false);
@@ -889,7 +897,7 @@ private:
 
 			const double CurrentTime = FPlatformTime::Seconds();
 			// If we have been idle for 20 seconds then exit
-			if (CurrentTime - LastCompileTime > TimeToLive)
+			if (!bPersistent && CurrentTime - LastCompileTime > TimeToLive)
 			{
 				UE_LOG(LogShaders, Log, TEXT("No jobs found for %f seconds, exiting"), (float)(CurrentTime - LastCompileTime));
 				FPlatformMisc::RequestExit(false);
@@ -33,6 +33,7 @@
 #include "UObject/TextProperty.h"
 #include "UObject/FieldPathProperty.h"
 #include "Misc/PackageName.h"
+#include "Hash/PerfectHash.h"
 #include "UnrealHeaderToolGlobals.h"
 
 #include "Exceptions.h"
@@ -3887,14 +3888,54 @@ void FNativeClassHeaderGenerator::ExportGeneratedEnumInitCode(FOutputDevice& Out
 
 		StaticDeclarations.Logf(TEXT("\t\tstatic const UECodeGen_Private::FEnumeratorParam Enumerators[];\r\n"));
 		StaticDefinitions.Logf(TEXT("\tconst UECodeGen_Private::FEnumeratorParam %s::Enumerators[] = {\r\n"), *StaticsStructName);
+		TArray<uint32> KeyHashes;
+		bool bCanHashKeys = EnumDef.NumEnums() > 0 && EnumDef.NumEnums() <= (int32)UE::PerfectHash::MaxKeys;
 		for (int32 Index = 0; Index != EnumDef.NumEnums(); ++Index)
 		{
 			const TCHAR* OverridenNameMetaDatakey = TEXT("OverrideName");
 			const FString KeyName = EnumDef.HasMetaData(OverridenNameMetaDatakey, Index) ? EnumDef.GetMetaData(OverridenNameMetaDatakey, Index) : EnumDef.GetNameByIndex(Index).ToString();
 			StaticDefinitions.Logf(TEXT("\t\t{ %s, (int64)%s },\r\n"), *CreateUTF8LiteralString(KeyName), *EnumDef.GetNameByIndex(Index).ToString());
+
+			// The runtime compares the UTF-8 keys against TCHAR strings, which only hash the same for ASCII
+			bCanHashKeys &= FCString::IsPureAnsi(*KeyName);
+			KeyHashes.Add(UE::PerfectHash::HashKey(*KeyName, KeyName.Len()));
 		}
 		StaticDefinitions.Logf(TEXT("\t};\r\n"));
 
+		// Perfect hash of the enumerator names, so that UEnum::GetIndexByNameString doesn't need to search them
+		TArray<uint16> NameHashSeeds;
+		TArray<uint16> NameHashSlots;
+		if (bCanHashKeys)
+		{
+			TArray<uint32> Scratch;
+			NameHashSeeds.SetNumUninitialized(UE::PerfectHash::GetNumBuckets(KeyHashes.Num()));
+			NameHashSlots.SetNumUninitialized(UE::PerfectHash::GetNumSlots(KeyHashes.Num()));
+			Scratch.SetNumUninitialized(UE::PerfectHash::GetBuildScratchSize(KeyHashes.Num()));
+			bCanHashKeys = UE::PerfectHash::Build(KeyHashes.GetData(), KeyHashes.Num(), NameHashSeeds.GetData(), NameHashSlots.GetData(), Scratch.GetData());
+		}
+
+		FString NameHashParam = TEXT("nullptr");
+		if (bCanHashKeys)
+		{
+			auto LogUInt16Array = [&StaticDefinitions](const TCHAR* ArrayName, const TCHAR* StructName, const TArray<uint16>& Values)
+			{
+				StaticDefinitions.Logf(TEXT("\tconst uint16 %s::%s[] = {"), StructName, ArrayName);
+				for (int32 Index = 0; Index < Values.Num(); ++Index)
+				{
+					StaticDefinitions.Logf(TEXT("%s%u,"), Index % 32 == 0 ? TEXT("\r\n\t\t") : TEXT(" "), Values[Index]);
+				}
+				StaticDefinitions.Logf(TEXT("\r\n\t};\r\n"));
+			};
+
+			StaticDeclarations.Logf(TEXT("\t\tstatic const uint16 NameHashSeeds[];\r\n"));
+			StaticDeclarations.Logf(TEXT("\t\tstatic const uint16 NameHashSlots[];\r\n"));
+			StaticDeclarations.Logf(TEXT("\t\tstatic const FPerfectHashTable NameHash;\r\n"));
+			LogUInt16Array(TEXT("NameHashSeeds"), *StaticsStructName, NameHashSeeds);
+			LogUInt16Array(TEXT("NameHashSlots"), *StaticsStructName, NameHashSlots);
+			StaticDefinitions.Logf(TEXT("\tconst FPerfectHashTable %s::NameHash = { %s::NameHashSeeds, %s::NameHashSlots, %d };\r\n"), *StaticsStructName, *StaticsStructName, *StaticsStructName, KeyHashes.Num());
+			NameHashParam = FString::Printf(TEXT("&%s::NameHash"), *StaticsStructName);
+		}
+
 		FString MetaDataParamsName = StaticsStructName + TEXT("::Enum_MetaDataParams");
 		FString MetaDataParams = OutputMetaDataCodeForObject(StaticDeclarations, StaticDefinitions, EnumDef, *MetaDataParamsName, TEXT("\t\t"), TEXT("\t"));
 
@@ -3910,6 +3951,7 @@ void FNativeClassHeaderGenerator::ExportGeneratedEnumInitCode(FOutputDevice& Out
 		StaticDefinitions.Logf(TEXT("\t\t%s,\r\n"), EnumFlags);
 		StaticDefinitions.Logf(TEXT("\t\t(uint8)%s,\r\n"), EnumFormStr);
 		StaticDefinitions.Logf(TEXT("\t\t%s\r\n"), *MetaDataParams);
+		StaticDefinitions.Logf(TEXT("\t\t%s,\r\n"), *NameHashParam);
 		StaticDefinitions.Logf(TEXT("\t};\r\n"));
 
 		StaticDeclarations.Logf(TEXT("\t};\r\n"));
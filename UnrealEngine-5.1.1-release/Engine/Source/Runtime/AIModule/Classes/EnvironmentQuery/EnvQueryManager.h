@@ -289,6 +289,12 @@ class AIMODULE_API UEnvQueryManager : public UAISubsystem, public FSelfRegisteri
 	/** Configure config variables during runtime */
 	void Configure(const FEnvQueryManagerConfig& NewConfig);
 
+	/** Replaces Points by the result of an identical projection made earlier this frame by the same generator, if any. */
+	bool FindSharedProjectedPoints(const UObject& Generator, const UObject* NavData, const FSharedConstNavQueryFilter& NavFilter, TArray<FNavLocation>& InOutPoints);
+
+	/** Stores the result of a generator projection, to share it with the identical projections made by other queries this frame. */
+	void StoreSharedProjectedPoints(const UObject& Generator, const UObject* NavData, const FSharedConstNavQueryFilter& NavFilter, TConstArrayView<FNavLocation> SourcePoints, TConstArrayView<FNavLocation> ProjectedPoints);
+
 protected:
 	friend UEnvQueryInstanceBlueprintWrapper;
 	TSharedPtr<FEnvQueryInstance> FindQueryInstance(const int32 QueryID);
@@ -309,6 +315,21 @@ protected:
 	/** currently running queries */
 	TArray<TSharedPtr<FEnvQueryInstance> > RunningQueries;
 
+	/** Points projected by a generator this frame, shared with the queries projecting the same points with the same generator */
+	struct FSharedProjectedPoints
+	{
+		const UObject* Generator = nullptr;
+		const UObject* NavData = nullptr;
+		/** Kept alive so that a filter instanced for a querier can't be recycled at the same address within the frame */
+		FSharedConstNavQueryFilter NavFilter;
+		TArray<FVector> SourceLocations;
+		TArray<FNavLocation> ProjectedPoints;
+	};
+
+	/** Shared projections keyed by the hash of their source locations, only valid for SharedProjectedPointsFrame */
+	TMultiMap<uint32, FSharedProjectedPoints> SharedProjectedPoints;
+	uint64 SharedProjectedPointsFrame = 0;
+
 	/** count of queries aborted since last update, to be removed. */
 	int32 NumRunningQueriesAbortedSinceLastUpdate;
 
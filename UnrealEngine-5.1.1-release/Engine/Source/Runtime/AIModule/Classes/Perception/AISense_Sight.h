@@ -11,6 +11,8 @@
 class IAISightTargetInterface;
 class UAISense_Sight;
 class UAISenseConfig_Sight;
+struct FTraceDatum;
+struct FTraceHandle;
 
 namespace ESightPerceptionEventName
 {
@@ -154,10 +156,17 @@ public:
 	TArray<FAISightQuery> SightQueriesOutOfRange;
 	TArray<FAISightQuery> SightQueriesInRange;
 
+	/** Queries waiting for the result of their asynchronous line of sight trace, moved back to the in range or out of range queries once processed */
+	TArray<FAISightQuery> SightQueriesPending;
+
 protected:
 	UPROPERTY(EditDefaultsOnly, Category = "AI Perception", config)
 	int32 MaxTracesPerTick;
 
+	/** Max asynchronous traces requested per update when bUseAsynchronousTraceForDefaultSightQueries is set */
+	UPROPERTY(EditDefaultsOnly, Category = "AI Perception", config)
+	int32 MaxAsyncTracesPerTick = 32;
+
 	UPROPERTY(EditDefaultsOnly, Category = "AI Perception", config)
 	int32 MinQueriesPerTimeSliceCheck;
 
@@ -177,6 +186,11 @@ protected:
 
 	ECollisionChannel DefaultSightCollisionChannel;
 
+	/** When set, the default line of sight traces (targets not implementing IAISightTargetInterface) are batched with the world async traces
+	 *  and their result processed the next frame, instead of being traced synchronously during the update */
+	UPROPERTY(EditDefaultsOnly, Category = "AI Perception", config)
+	bool bUseAsynchronousTraceForDefaultSightQueries = false;
+
 public:
 
 	virtual void PostInitProperties() override;
@@ -196,6 +210,10 @@ protected:
 	virtual bool ShouldAutomaticallySeeTarget(const FDigestedSightProperties& PropDigest, FAISightQuery* SightQuery, FPerceptionListener& Listener, AActor* TargetActor, float& OutStimulusStrength) const;
 	void UpdateQueryVisibilityStatus(FAISightQuery& SightQuery, FPerceptionListener& Listener, const bool bIsVisible, const FVector& SeenLocation, const float StimulusStrength, AActor* TargetActor, const FVector& TargetLocation) const;
 
+	/** Requests the line of sight trace of the query asynchronously if its visibility depends on the default trace, returns false if the visibility has to be computed right away */
+	bool RequestAsyncVisibilityTrace(UWorld& World, FAISightQuery& SightQuery, FPerceptionListener& Listener, const AActor* ListenerActor, const FAISightTarget& Target, AActor* TargetActor, const FDigestedSightProperties& PropDigest);
+	void OnPendingTraceQueryProcessed(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum, const FPerceptionListenerID ListenerId, const FAISightTarget::FTargetId TargetId);
+
 	void OnNewListenerImpl(const FPerceptionListener& NewListener);
 	void OnListenerUpdateImpl(const FPerceptionListener& UpdatedListener);
 	void OnListenerRemovedImpl(const FPerceptionListener& RemovedListener);
@@ -415,6 +415,72 @@ bool UEnvQueryManager::AbortQuery(int32 RequestID)
 	return false;
 }
 
+namespace UE::EnvQuery::Private
+{
+	static uint32 HashSourceLocations(TConstArrayView<FNavLocation> Points)
+	{
+		uint32 Hash = GetTypeHash(Points.Num());
+		for (const FNavLocation& Point : Points)
+		{
+			Hash = HashCombine(Hash, GetTypeHash(Point.Location));
+		}
+		return Hash;
+	}
+}
+
+bool UEnvQueryManager::FindSharedProjectedPoints(const UObject& Generator, const UObject* NavData, const FSharedConstNavQueryFilter& NavFilter, TArray<FNavLocation>& InOutPoints)
+{
+	if (SharedProjectedPointsFrame != GFrameCounter)
+	{
+		SharedProjectedPoints.Reset();
+		SharedProjectedPointsFrame = GFrameCounter;
+		return false;
+	}
+
+	const uint32 Hash = UE::EnvQuery::Private::HashSourceLocations(InOutPoints);
+	for (auto It = SharedProjectedPoints.CreateConstKeyIterator(Hash); It; ++It)
+	{
+		const FSharedProjectedPoints& Shared = It.Value();
+		if (Shared.Generator == &Generator && Shared.NavData == NavData && Shared.NavFilter == NavFilter
+			&& Shared.SourceLocations.Num() == InOutPoints.Num())
+		{
+			bool bSameLocations = true;
+			for (int32 Index = 0; bSameLocations && Index < InOutPoints.Num(); ++Index)
+			{
+				bSameLocations = Shared.SourceLocations[Index].Equals(InOutPoints[Index].Location, 0.);
+			}
+
+			if (bSameLocations)
+			{
+				InOutPoints = Shared.ProjectedPoints;
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+void UEnvQueryManager::StoreSharedProjectedPoints(const UObject& Generator, const UObject* NavData, const FSharedConstNavQueryFilter& NavFilter, TConstArrayView<FNavLocation> SourcePoints, TConstArrayView<FNavLocation> ProjectedPoints)
+{
+	if (SharedProjectedPointsFrame != GFrameCounter)
+	{
+		SharedProjectedPoints.Reset();
+		SharedProjectedPointsFrame = GFrameCounter;
+	}
+
+	FSharedProjectedPoints& Shared = SharedProjectedPoints.Add(UE::EnvQuery::Private::HashSourceLocations(SourcePoints));
+	Shared.Generator = &Generator;
+	Shared.NavData = NavData;
+	Shared.NavFilter = NavFilter;
+	Shared.SourceLocations.Reserve(SourcePoints.Num());
+	for (const FNavLocation& Point : SourcePoints)
+	{
+		Shared.SourceLocations.Add(Point.Location);
+	}
+	Shared.ProjectedPoints = ProjectedPoints;
+}
+
 void UEnvQueryManager::Tick(float DeltaTime)
 {
 	SCOPE_TIME_GUARD_MS(TEXT("UEnvQueryManager::Tick"), 10);
@@ -3,9 +3,18 @@
 #include "EnvironmentQuery/Generators/EnvQueryGenerator_ProjectedPoints.h"
 #include "EnvironmentQuery/Items/EnvQueryItemType_Point.h"
 #include "EnvironmentQuery/EnvQueryTraceHelpers.h"
+#include "EnvironmentQuery/EnvQueryManager.h"
+#include "NavFilters/NavigationQueryFilter.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(EnvQueryGenerator_ProjectedPoints)
 
+namespace UE::EnvQuery::Private
+{
+	static bool bShareProjectedPoints = true;
+	static FAutoConsoleVariableRef CVarShareProjectedPoints(TEXT("ai.eqs.ShareProjectedPoints"), bShareProjectedPoints,
+		TEXT("If enabled, generators projecting the same points as another query of the same frame, e.g. grids around the same context, reuse its projection instead of running it again."), ECVF_Default);
+}
+
 UEnvQueryGenerator_ProjectedPoints::UEnvQueryGenerator_ProjectedPoints(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
 	ProjectionData.TraceMode = EEnvQueryTrace::Navigation;
@@ -25,15 +34,43 @@ void UEnvQueryGenerator_ProjectedPoints::ProjectAndFilterNavPoints(TArray<FNavLo
 	}
 
 	const UObject* Querier = QueryInstance.Owner.Get();
-	if (NavData && Querier && (ProjectionData.TraceMode == EEnvQueryTrace::Navigation))
+	const bool bNavProjection = NavData && Querier && (ProjectionData.TraceMode == EEnvQueryTrace::Navigation);
+	const bool bPhysProjection = (ProjectionData.TraceMode == EEnvQueryTrace::GeometryByChannel || ProjectionData.TraceMode == EEnvQueryTrace::GeometryByProfile);
+	if (!bNavProjection && !bPhysProjection)
+	{
+		return;
+	}
+
+	// Queries of the same frame projecting the same points with the same settings share the projection.
+	// The navigation filter is part of the key since it can be instanced per querier.
+	UEnvQueryManager* EnvQueryManager = UE::EnvQuery::Private::bShareProjectedPoints ? UEnvQueryManager::GetCurrent(QueryInstance.World) : nullptr;
+	const UObject* SharedNavData = bNavProjection ? NavData : nullptr;
+	const FSharedConstNavQueryFilter SharedNavFilter = bNavProjection ? UNavigationQueryFilter::GetQueryFilter(*NavData, Querier, ProjectionData.NavigationFilter) : nullptr;
+	if (EnvQueryManager && EnvQueryManager->FindSharedProjectedPoints(*this, SharedNavData, SharedNavFilter, Points))
+	{
+		return;
+	}
+
+	TArray<FNavLocation> SourcePoints;
+	if (EnvQueryManager)
+	{
+		SourcePoints = Points;
+	}
+
+	if (bNavProjection)
 	{
 		FEQSHelpers::RunNavProjection(*NavData, *Querier, ProjectionData, Points, FEQSHelpers::ETraceMode::Discard);
 	}
 
-	if (ProjectionData.TraceMode == EEnvQueryTrace::GeometryByChannel || ProjectionData.TraceMode == EEnvQueryTrace::GeometryByProfile)
+	if (bPhysProjection)
 	{
 		FEQSHelpers::RunPhysProjection(QueryInstance.World, ProjectionData, Points);
 	}
+
+	if (EnvQueryManager)
+	{
+		EnvQueryManager->StoreSharedProjectedPoints(*this, SharedNavData, SharedNavFilter, SourcePoints, Points);
+	}
 }
 
 void UEnvQueryGenerator_ProjectedPoints::StoreNavPoints(const TArray<FNavLocation>& Points, FEnvQueryInstance& QueryInstance) const
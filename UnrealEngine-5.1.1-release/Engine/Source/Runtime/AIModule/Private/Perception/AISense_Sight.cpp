@@ -4,6 +4,7 @@
 #include "EngineDefines.h"
 #include "EngineGlobals.h"
 #include "CollisionQueryParams.h"
+#include "WorldCollision.h"
 #include "Engine/Engine.h"
 #include "AISystem.h"
 #include "AIHelpers.h"
@@ -228,7 +229,7 @@ float UAISense_Sight::Update()
 {
 	SCOPE_CYCLE_COUNTER(STAT_AI_Sense_Sight);
 
-	const UWorld* World = GEngine->GetWorldFromContextObject(GetPerceptionSystem()->GetOuter(), EGetWorldErrorMode::LogAndReturnNull);
+	UWorld* World = GEngine->GetWorldFromContextObject(GetPerceptionSystem()->GetOuter(), EGetWorldErrorMode::LogAndReturnNull);
 
 	if (World == nullptr)
 	{
@@ -259,6 +260,7 @@ float UAISense_Sight::Update()
 	}
 
 	int32 TracesCount = 0;
+	int32 AsyncTracesCount = 0;
 	int32 NumQueriesProcessed = 0;
 	double TimeSliceEnd = FPlatformTime::Seconds() + MaxTimeSlicePerTick;
 	bool bHitTimeSliceLimit = false;
@@ -269,7 +271,8 @@ float UAISense_Sight::Update()
 	enum class EOperationType : uint8
 	{
 		Remove,
-		SwapList
+		SwapList,
+		MoveToPending
 	};
 	struct FQueryOperation
 	{
@@ -296,7 +299,7 @@ float UAISense_Sight::Update()
 			bHitTimeSliceLimit = true;
 		}
 
-		if (bHitTimeSliceLimit || TracesCount >= MaxTracesPerTick)
+		if (bHitTimeSliceLimit || TracesCount >= MaxTracesPerTick || (bUseAsynchronousTraceForDefaultSightQueries && AsyncTracesCount >= MaxAsyncTracesPerTick))
 		{
 			break;
 		}
@@ -336,6 +339,15 @@ float UAISense_Sight::Update()
 		{
 			const FDigestedSightProperties& PropDigest = DigestedProperties[SightQuery->ObserverId];
 			const AActor* ListenerBodyActor = ListenerPtr->GetBodyActor();
+
+			if (RequestAsyncVisibilityTrace(*World, *SightQuery, Listener, ListenerBodyActor, Target, TargetActor, PropDigest))
+			{
+				++AsyncTracesCount;
+				QueryOperations.Add(FQueryOperation(bIsInRangeQuery, EOperationType::MoveToPending, bIsInRangeQuery ? InRangeIndex : OutOfRangeIndex));
+				SightQuery->OnProcessed();
+				continue;
+			}
+
 			float StimulusStrength = 1.f;
 			FVector SeenLocation(0.f);
 			int32 NumberOfLoSChecksPerformed = 0;
@@ -404,6 +416,10 @@ float UAISense_Sight::Update()
 					SightQueriesInRange.Add(SightQueriesOutOfRange[Operation.Index]);
 				}
 			}
+			else if (Operation.OpType == EOperationType::MoveToPending)
+			{
+				SightQueriesPending.Add(Operation.bInRange ? SightQueriesInRange[Operation.Index] : SightQueriesOutOfRange[Operation.Index]);
+			}
 
 			if (Operation.bInRange)
 			{
@@ -499,6 +515,89 @@ bool UAISense_Sight::ComputeVisibility(const UWorld* World, FAISightQuery& Sight
 	}
 }
 
+bool UAISense_Sight::RequestAsyncVisibilityTrace(UWorld& World, FAISightQuery& SightQuery, FPerceptionListener& Listener, const AActor* ListenerActor, const FAISightTarget& Target, AActor* TargetActor, const FDigestedSightProperties& PropDigest)
+{
+	if (!bUseAsynchronousTraceForDefaultSightQueries || Target.SightTargetInterface != nullptr)
+	{
+		return false;
+	}
+
+	// the queries not needing a trace are resolved synchronously by ComputeVisibility
+	float StimulusStrength = 1.f;
+	if (ShouldAutomaticallySeeTarget(PropDigest, &SightQuery, Listener, TargetActor, StimulusStrength))
+	{
+		return false;
+	}
+
+	const FVector TargetLocation = TargetActor->GetActorLocation();
+	const float SightRadiusSq = SightQuery.bLastResult ? PropDigest.LoseSightRadiusSq : PropDigest.SightRadiusSq;
+	if (!FAISystem::CheckIsTargetInSightCone(Listener.CachedLocation, Listener.CachedDirection, PropDigest.PeripheralVisionAngleCos, PropDigest.PointOfViewBackwardOffset, PropDigest.NearClippingRadiusSq, SightRadiusSq, TargetLocation))
+	{
+		return false;
+	}
+
+	FTraceDelegate TraceDelegate = FTraceDelegate::CreateUObject(this, &UAISense_Sight::OnPendingTraceQueryProcessed, SightQuery.ObserverId, SightQuery.TargetId);
+	World.AsyncLineTraceByChannel(EAsyncTraceType::Single, Listener.CachedLocation, TargetLocation, DefaultSightCollisionChannel
+		, FCollisionQueryParams(SCENE_QUERY_STAT(AILineOfSight), true, ListenerActor), FCollisionResponseParams::DefaultResponseParam, &TraceDelegate);
+
+	return true;
+}
+
+void UAISense_Sight::OnPendingTraceQueryProcessed(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum, const FPerceptionListenerID ListenerId, const FAISightTarget::FTargetId TargetId)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AI_Sense_Sight_ProcessPendingQuery);
+
+	const int32 QueryIndex = SightQueriesPending.IndexOfByPredicate([ListenerId, TargetId](const FAISightQuery& Query)
+	{
+		return Query.ObserverId == ListenerId && Query.TargetId == TargetId;
+	});
+
+	// the query has been removed while its trace was pending
+	if (QueryIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	FAISightQuery SightQuery = SightQueriesPending[QueryIndex];
+	SightQueriesPending.RemoveAtSwap(QueryIndex, 1, /*bAllowShrinking*/false);
+
+	FPerceptionListener* Listener = GetListeners()->Find(ListenerId);
+	const FAISightTarget* Target = ObservedTargets.Find(TargetId);
+	AActor* TargetActor = Target ? Target->Target.Get() : nullptr;
+	const FDigestedSightProperties* PropDigest = DigestedProperties.Find(ListenerId);
+	if (Listener == nullptr || !Listener->Listener.IsValid() || TargetActor == nullptr || PropDigest == nullptr)
+	{
+		return;
+	}
+
+	bool bIsVisible = true;
+	for (const FHitResult& HitResult : TraceDatum.OutHits)
+	{
+		if (HitResult.bBlockingHit)
+		{
+			AActor* HitResultActor = HitResult.HitObjectHandle.FetchActor();
+			bIsVisible = HitResultActor && HitResultActor->IsOwnedBy(TargetActor);
+			break;
+		}
+	}
+
+	const bool bWasVisible = SightQuery.bLastResult;
+	const FVector TargetLocation = TargetActor->GetActorLocation();
+	UpdateQueryVisibilityStatus(SightQuery, *Listener, bIsVisible, TraceDatum.End, 1.f, TargetActor, TargetLocation);
+
+	SightQuery.Importance = CalcQueryImportance(*Listener, TargetLocation, bWasVisible ? PropDigest->LoseSightRadiusSq : PropDigest->SightRadiusSq);
+	if (SightQuery.Importance > 0.0f)
+	{
+		SightQueriesInRange.Add(SightQuery);
+	}
+	else
+	{
+		// insert as the last out of range query to process, like the queries swapped during the update
+		SightQueriesOutOfRange.Insert(SightQuery, NextOutOfRangeIndex);
+		++NextOutOfRangeIndex;
+	}
+}
+
 void UAISense_Sight::UpdateQueryVisibilityStatus(FAISightQuery& SightQuery, FPerceptionListener& Listener, const bool bIsVisible, const FVector& SeenLocation, const float StimulusStrength, AActor* TargetActor, const FVector& TargetLocation) const
 {
 	if (bIsVisible)
@@ -538,7 +637,7 @@ void UAISense_Sight::UnregisterSource(AActor& SourceActor)
 	FAISightTarget AsTarget;
 	
 	if (ObservedTargets.RemoveAndCopyValue(AsTargetId, AsTarget) 
-		&& (SightQueriesInRange.Num() + SightQueriesOutOfRange.Num()) > 0)
+		&& (SightQueriesInRange.Num() + SightQueriesOutOfRange.Num() + SightQueriesPending.Num()) > 0)
 	{
 		AActor* TargetActor = AsTarget.Target.Get();
 
@@ -566,6 +665,7 @@ void UAISense_Sight::UnregisterSource(AActor& SourceActor)
 				return EReverseForEachResult::UnTouched;
 			};
 			ReverseForEach(SightQueriesInRange, RemoveQuery);
+			ReverseForEach(SightQueriesPending, RemoveQuery);
 			if (ReverseForEach(SightQueriesOutOfRange, RemoveQuery) == EReverseForEachResult::Modified)
 			{
 				bSightQueriesOutOfRangeDirty = true;
@@ -806,7 +906,7 @@ void UAISense_Sight::RemoveAllQueriesByListener(const FPerceptionListener& Liste
 {
 	SCOPE_CYCLE_COUNTER(STAT_AI_Sense_Sight_RemoveByListener);
 
-	if ((SightQueriesInRange.Num() + SightQueriesOutOfRange.Num()) == 0)
+	if ((SightQueriesInRange.Num() + SightQueriesOutOfRange.Num() + SightQueriesPending.Num()) == 0)
 	{
 		return;
 	}
@@ -829,6 +929,7 @@ void UAISense_Sight::RemoveAllQueriesByListener(const FPerceptionListener& Liste
 		return EReverseForEachResult::UnTouched;
 	};
 	ReverseForEach(SightQueriesInRange, RemoveQuery);
+	ReverseForEach(SightQueriesPending, RemoveQuery);
 	if(ReverseForEach(SightQueriesOutOfRange, RemoveQuery) == EReverseForEachResult::Modified)
 	{
 		bSightQueriesOutOfRangeDirty = true;
@@ -855,6 +956,7 @@ void UAISense_Sight::RemoveAllQueriesToTarget(const FAISightTarget::FTargetId& T
 		return EReverseForEachResult::UnTouched;
 	};
 	ReverseForEach(SightQueriesInRange, RemoveQuery);
+	ReverseForEach(SightQueriesPending, RemoveQuery);
 	if (ReverseForEach(SightQueriesOutOfRange, RemoveQuery) == EReverseForEachResult::Modified)
 	{
 		bSightQueriesOutOfRangeDirty = true;
@@ -877,7 +979,8 @@ void UAISense_Sight::OnListenerForgetsActor(const FPerceptionListener& Listener,
 		return EForEachResult::Continue;
 	};
 
-	if (ForEach(SightQueriesInRange, ForgetPreviousResult) == EForEachResult::Continue)
+	if (ForEach(SightQueriesInRange, ForgetPreviousResult) == EForEachResult::Continue
+		&& ForEach(SightQueriesPending, ForgetPreviousResult) == EForEachResult::Continue)
 	{
 		ForEach(SightQueriesOutOfRange, ForgetPreviousResult);
 	}
@@ -897,6 +1000,7 @@ void UAISense_Sight::OnListenerForgetsAll(const FPerceptionListener& Listener)
 	};
 
 	ForEach(SightQueriesInRange, ForgetPreviousResult);
+	ForEach(SightQueriesPending, ForgetPreviousResult);
 	ForEach(SightQueriesOutOfRange, ForgetPreviousResult);
 }
 
@@ -11,6 +11,7 @@
 #include "Async/MappedFileHandle.h"
 #include "Async/ParallelFor.h"
 #include "Containers/BinaryHeap.h"
+#include "HAL/IConsoleManager.h"
 #include "HAL/PlatformFileManager.h"
 #include "HAL/PlatformProcess.h"
 #include "HAL/RunnableThread.h"
@@ -38,10 +39,18 @@ namespace AssetDataGathererConstants
 	constexpr int32 SingleThreadFilesPerBatch = 3;
 	constexpr int32 ExpectedMaxBatchSize = 100;
 	constexpr int32 MinSecondsToElapseBeforeCacheWrite = 60;
-	static constexpr uint32 CacheSerializationMagic = 0x3339D87B; // Versioning and integrity checking
+	static constexpr uint32 CacheSerializationMagic = 0x3339D87C; // Versioning and integrity checking
 	static constexpr uint64 CurrentVersion = FAssetRegistryVersion::LatestVersion | (uint64(CacheSerializationMagic) << 32);
+	/** Smallest number of assets worth loading on their own task */
+	constexpr int32 MinAssetsPerCacheShard = 4096;
 }
 
+static int32 GAssetDataGathererMaxCacheShards = 16;
+static FAutoConsoleVariableRef CVarAssetDataGathererMaxCacheShards(
+	TEXT("AssetRegistry.MaxCacheShards"),
+	GAssetDataGathererMaxCacheShards,
+	TEXT("Maximum number of independent shards the asset data cache is split into when saved. Shards are loaded in parallel, 1 saves a single shard."));
+
 namespace UE::AssetDataGather::Private
 {
 
@@ -61,8 +70,15 @@ struct FCachePayload
 	}
 };
 
-void SerializeCacheSave(FAssetRegistryWriter& Ar, const TArray<TPair<FName, FDiskCachedAssetData*>>& AssetsToSave);
-FCachePayload SerializeCacheLoad(FAssetRegistryReader& Ar);
+/** Entry of the table at the start of the cache file, each shard is serialized with its own name batch and tag store */
+struct FCacheShardHeader
+{
+	int32 NumAssets = 0;
+	int64 Size = 0;
+};
+
+void SerializeCacheSave(FAssetRegistryWriter& Ar, TConstArrayView<TPair<FName, FDiskCachedAssetData*>> AssetsToSave);
+bool SerializeCacheLoad(FAssetRegistryReader& Ar, int32 NumAssets, FName* OutPackageNames, FDiskCachedAssetData* OutAssetDatas);
 FCachePayload LoadCacheFile(FStringView CacheFilename);
 
 
@@ -3797,13 +3813,45 @@ void FAssetDataGatherer::SaveCacheFileInternal(const FString& CacheFilename, con
 		*FileAr << CurrentVersion;
 
 #if ALLOW_NAME_BATCH_SAVING
+		// Split the assets into shards that can be loaded in parallel. Each shard duplicates the names and tag values
+		// it shares with the others, so keep them large.
+		const int32 MaxNumShards = FMath::Max(GAssetDataGathererMaxCacheShards, 1);
+		int32 NumShards = FMath::Clamp(AssetsToSave.Num() / AssetDataGathererConstants::MinAssetsPerCacheShard, 1, MaxNumShards);
+		TArray<UE::AssetDataGather::Private::FCacheShardHeader> Shards;
+		Shards.SetNum(NumShards);
+		*FileAr << NumShards;
+		const int64 ShardTableOffset = FileAr->Tell();
+		for (UE::AssetDataGather::Private::FCacheShardHeader& Shard : Shards)
+		{
+			*FileAr << Shard.NumAssets << Shard.Size;
+		}
+
+		int32 AssetIndex = 0;
+		for (int32 ShardIndex = 0; ShardIndex < NumShards; ++ShardIndex)
+		{
+			UE::AssetDataGather::Private::FCacheShardHeader& Shard = Shards[ShardIndex];
+			Shard.NumAssets = (AssetsToSave.Num() - AssetIndex) / (NumShards - ShardIndex);
+			const int64 ShardOffset = FileAr->Tell();
+			{
+				// We might be able to reduce load time by using AssetRegistry::SerializationOptions
+				// to save certain common tags as FName.
+				UE::AssetDataGather::Private::FChecksumArchiveWriter ChecksummingWriter(*FileAr);
+				FAssetRegistryWriter Ar(FAssetRegistryWriterOptions(), ChecksummingWriter);
+				UE::AssetDataGather::Private::SerializeCacheSave(Ar, MakeArrayView(AssetsToSave).Mid(AssetIndex, Shard.NumAssets));
+			}
+			Shard.Size = FileAr->Tell() - ShardOffset;
+			AssetIndex += Shard.NumAssets;
+		}
+		check(AssetIndex == AssetsToSave.Num());
+
+		// Patch in the shard sizes now that they are known
+		const int64 EndOffset = FileAr->Tell();
+		FileAr->Seek(ShardTableOffset);
+		for (UE::AssetDataGather::Private::FCacheShardHeader& Shard : Shards)
 		{
-			// We might be able to reduce load time by using AssetRegistry::SerializationOptions
-			// to save certain common tags as FName.
-			UE::AssetDataGather::Private::FChecksumArchiveWriter ChecksummingWriter(*FileAr);
-			FAssetRegistryWriter Ar(FAssetRegistryWriterOptions(), ChecksummingWriter);
-			UE::AssetDataGather::Private::SerializeCacheSave(Ar, AssetsToSave);
+			*FileAr << Shard.NumAssets << Shard.Size;
 		}
+		FileAr->Seek(EndOffset);
 #else		
 		checkf(false, TEXT("Cannot save asset registry cache in this configuration"));
 #endif
@@ -3828,7 +3876,7 @@ void FAssetDataGatherer::SaveCacheFileInternal(const FString& CacheFilename, con
 namespace UE::AssetDataGather::Private
 {
 
-void SerializeCacheSave(FAssetRegistryWriter& Ar, const TArray<TPair<FName,FDiskCachedAssetData*>>& AssetsToSave)
+void SerializeCacheSave(FAssetRegistryWriter& Ar, TConstArrayView<TPair<FName,FDiskCachedAssetData*>> AssetsToSave)
 {
 #if ALLOW_NAME_BATCH_SAVING
 	double SerializeStartTime = FPlatformTime::Seconds();
@@ -3848,83 +3896,116 @@ void SerializeCacheSave(FAssetRegistryWriter& Ar, const TArray<TPair<FName,FDisk
 #endif
 }
 
-FCachePayload SerializeCacheLoad(FAssetRegistryReader& Ar)
+bool SerializeCacheLoad(FAssetRegistryReader& Ar, int32 NumAssets, FName* OutPackageNames, FDiskCachedAssetData* OutAssetDatas)
 {
-	double SerializeStartTime = FPlatformTime::Seconds();
-	ON_SCOPE_EXIT
-	{
-		UE_LOG(LogAssetRegistry, Verbose, TEXT("Asset data gatherer serialized in %0.6f seconds"), FPlatformTime::Seconds() - SerializeStartTime);
-	};
-
 	// serialize number of objects
 	int32 LocalNumAssets = 0;
 	Ar << LocalNumAssets;
 
-	const int32 MinAssetEntrySize = sizeof(int32);
-	const int64 MaxPossibleNumAssets = (Ar.TotalSize() - Ar.Tell()) / MinAssetEntrySize;
-	if (Ar.IsError() || LocalNumAssets < 0 || MaxPossibleNumAssets < LocalNumAssets)
+	if (Ar.IsError() || LocalNumAssets != NumAssets)
 	{
 		Ar.SetError();
-		return FCachePayload();
-	}
-
-	if (LocalNumAssets == 0)
-	{
-		FCachePayload Payload = FCachePayload();
-		Payload.bSucceeded = true;
-		return Payload;
+		return false;
 	}
 
 	FSoftObjectPathSerializationScope SerializationScope(NAME_None, NAME_None, ESoftObjectPathCollectType::NonPackage, ESoftObjectPathSerializeType::AlwaysSerialize);
 
-	// allocate one single block for all asset data structs (to reduce tens of thousands of heap allocations)
-	TUniquePtr<FName[]> PackageNameBlock(new FName[LocalNumAssets]);
-	TUniquePtr<FDiskCachedAssetData[]> AssetDataBlock(new FDiskCachedAssetData[LocalNumAssets]);
 	for (int32 AssetIndex = 0; AssetIndex < LocalNumAssets; ++AssetIndex)
 	{
-		// Load the name first to add the entry to the tmap below
-		// Visual Studio Static Analyzer issues C6385 if we call Ar << PackageNameBlock[AssetIndex] or AssetDataBlock[AssetIndex].SerializeForCache
-		Ar << *(PackageNameBlock.Get() + AssetIndex); // -C6385
-		(AssetDataBlock.Get() + AssetIndex)->SerializeForCache(Ar); // -C6385
+		// Visual Studio Static Analyzer issues C6385 if we call Ar << OutPackageNames[AssetIndex] or OutAssetDatas[AssetIndex].SerializeForCache
+		Ar << *(OutPackageNames + AssetIndex); // -C6385
+		(OutAssetDatas + AssetIndex)->SerializeForCache(Ar); // -C6385
 		if (Ar.IsError())
 		{
 			// There was an error reading the cache. Bail out.
-			break;
+			return false;
 		}
 	}
 
-	if (Ar.IsError())
+	return true;
+}
+
+template<typename T>
+bool TryLoadValue(FArchive& Ar, T& Out)
+{
+	Ar << Out;
+	return !Ar.IsError();
+}
+
+template<typename T>
+bool TryLoadValue(FMemoryViewReader& Reader, T& Out)
+{
+	TOptional<T> Value = Reader.TryLoad<T>();
+	Out = Value.Get(T());
+	return Value.IsSet();
+}
+
+/** Reads the shard table and allocates one single block for all asset data structs (to reduce tens of thousands of heap allocations) */
+template <typename ReaderType>
+bool LoadCacheShardTable(ReaderType& Reader, int64 RemainingSize, TArray<FCacheShardHeader>& OutShards, FCachePayload& OutPayload)
+{
+	int32 NumShards = 0;
+	if (!TryLoadValue(Reader, NumShards))
 	{
-		return FCachePayload();
+		return false;
 	}
-	FCachePayload Result;
-	Result.PackageNames = MoveTemp(PackageNameBlock);
-	Result.AssetDatas = MoveTemp(AssetDataBlock);
-	Result.NumAssets = LocalNumAssets;
-	Result.bSucceeded = true;
-	return Result;
+	const int64 ShardHeaderSize = sizeof(int32) + sizeof(int64);
+	if (NumShards <= 0 || NumShards > (RemainingSize - int64(sizeof(int32))) / ShardHeaderSize)
+	{
+		return false;
+	}
+	RemainingSize -= sizeof(int32) + NumShards * ShardHeaderSize;
+
+	const int32 MinAssetEntrySize = sizeof(int32);
+	int64 TotalNumAssets = 0;
+	OutShards.SetNum(NumShards);
+	for (FCacheShardHeader& Shard : OutShards)
+	{
+		if (!TryLoadValue(Reader, Shard.NumAssets) || !TryLoadValue(Reader, Shard.Size) || Shard.NumAssets < 0 || Shard.Size < 0 || Shard.Size > RemainingSize || Shard.Size / MinAssetEntrySize < Shard.NumAssets)
+		{
+			return false;
+		}
+		RemainingSize -= Shard.Size;
+		TotalNumAssets += Shard.NumAssets;
+	}
+	if (TotalNumAssets > MAX_int32)
+	{
+		return false;
+	}
+
+	if (TotalNumAssets > 0)
+	{
+		OutPayload.PackageNames.Reset(new FName[TotalNumAssets]);
+		OutPayload.AssetDatas.Reset(new FDiskCachedAssetData[TotalNumAssets]);
+	}
+	OutPayload.NumAssets = IntCastChecked<int32>(TotalNumAssets);
+	return true;
 }
 
 FCachePayload LoadCacheFile(FStringView InCacheFilename)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(LoadCacheFile);
 	FString CacheFilename(InCacheFilename);
+	double SerializeStartTime = FPlatformTime::Seconds();
 
-	auto DoLoad = [&](FArchive& ChecksummingReader)
+	// The discovery cache is always serialized with a fixed format.
+	// We discard it before this point if it's not the latest version, and it always includes editor-only data.
+	FAssetRegistryHeader Header;
+	Header.Version = FAssetRegistryVersion::LatestVersion;
+	Header.bFilterEditorOnlyData = false;
+
+	auto DoLoad = [&](FArchive& ChecksummingReader, int32 Parallelism, int32 NumAssets, int64 FirstAssetIndex, FCachePayload& Payload)
 	{
-		int32 WorkerReduction = 2; // Current worker + preload task
-		int32 Parallelism = FMath::Max(FTaskGraphInterface::Get().GetNumWorkerThreads() - WorkerReduction, 0);
-		
-		// The discovery cache is always serialized with a fixed format.
-		// We discard it before this point if it's not the latest version, and it always includes editor-only data.
-		FAssetRegistryHeader Header;
-		Header.Version = FAssetRegistryVersion::LatestVersion;
-		Header.bFilterEditorOnlyData = false;
 		FAssetRegistryReader RegistryReader(ChecksummingReader, Parallelism, Header);
-		return RegistryReader.IsError() ? FCachePayload() : SerializeCacheLoad(RegistryReader);
+		return !RegistryReader.IsError() && SerializeCacheLoad(RegistryReader, NumAssets,
+			Payload.PackageNames.Get() + FirstAssetIndex, Payload.AssetDatas.Get() + FirstAssetIndex);
 	};
 
+	int32 WorkerReduction = 2; // Current worker + preload task
+	int32 Parallelism = FMath::Max(FTaskGraphInterface::Get().GetNumWorkerThreads() - WorkerReduction, 0);
+
 	FCachePayload Payload;
+	TArray<FCacheShardHeader> Shards;
 	if (FPlatformProperties::SupportsMemoryMappedFiles())
 	{
 		FMemoryMappedFile File(*CacheFilename);
@@ -3932,10 +4013,32 @@ FCachePayload LoadCacheFile(FStringView InCacheFilename)
 
 		FMemoryViewReader FileReader(File.View());
 		TOptional<uint64> Version = FileReader.TryLoad<uint64>();
-		if (Version == AssetDataGathererConstants::CurrentVersion)
-		{
-			FChecksumViewReader ChecksummingReader(MoveTemp(FileReader), CacheFilename);
-			Payload = DoLoad(ChecksummingReader);
+		if (Version == AssetDataGathererConstants::CurrentVersion
+			&& LoadCacheShardTable(FileReader, FileReader.GetRemainingSize(), Shards, Payload))
+		{
+			// Shards are independent and located by the table, load them in parallel straight from the mapped view.
+			// A single shard spreads its name batch and tag store loading over the workers instead.
+			TArray<FMemoryView> ShardViews;
+			TArray<int64> FirstAssetIndices;
+			int64 NextAssetIndex = 0;
+			for (const FCacheShardHeader& Shard : Shards)
+			{
+				ShardViews.Add(FileReader.Load(Shard.Size));
+				FirstAssetIndices.Add(NextAssetIndex);
+				NextAssetIndex += Shard.NumAssets;
+			}
+
+			std::atomic<bool> bSucceeded(true);
+			const int32 ShardParallelism = Shards.Num() > 1 ? 0 : Parallelism;
+			ParallelFor(Shards.Num(), [&](int32 ShardIndex)
+			{
+				FChecksumViewReader ChecksummingReader(FMemoryViewReader(ShardViews[ShardIndex]), CacheFilename);
+				if (!DoLoad(ChecksummingReader, ShardParallelism, Shards[ShardIndex].NumAssets, FirstAssetIndices[ShardIndex], Payload))
+				{
+					bSucceeded = false;
+				}
+			}, EParallelForFlags::Unbalanced);
+			Payload.bSucceeded = bSucceeded;
 			UE_CLOG(!Payload.bSucceeded, LogAssetRegistry, Error, TEXT("There was an error loading the asset registry cache using memory mapping"));
 		}
 
@@ -3949,14 +4052,33 @@ FCachePayload LoadCacheFile(FStringView InCacheFilename)
 		{
 			uint64 Version = 0;
 			*FileAr << Version;
-			if (Version == AssetDataGathererConstants::CurrentVersion)
+			if (Version == AssetDataGathererConstants::CurrentVersion
+				&& LoadCacheShardTable(*FileAr, FileAr->TotalSize() - FileAr->Tell(), Shards, Payload))
 			{
-				FChecksumArchiveReader ChecksummingReader(*FileAr);
-				Payload = DoLoad(ChecksummingReader);
+				// Shards are stored back to back, read them in order
+				Payload.bSucceeded = true;
+				int64 NextAssetIndex = 0;
+				for (const FCacheShardHeader& Shard : Shards)
+				{
+					FChecksumArchiveReader ChecksummingReader(*FileAr);
+					if (!DoLoad(ChecksummingReader, Parallelism, Shard.NumAssets, NextAssetIndex, Payload))
+					{
+						Payload.bSucceeded = false;
+						break;
+					}
+					NextAssetIndex += Shard.NumAssets;
+				}
 				UE_CLOG(!Payload.bSucceeded, LogAssetRegistry, Error, TEXT("There was an error loading the asset registry cache"));
 			}
 		}
 	}
+
+	if (!Payload.bSucceeded)
+	{
+		Payload.Reset();
+	}
+	UE_LOG(LogAssetRegistry, Verbose, TEXT("Asset data gatherer serialized %d assets from %d shards in %0.6f seconds"),
+		Payload.NumAssets, Shards.Num(), FPlatformTime::Seconds() - SerializeStartTime);
 	
 	return Payload;
 }
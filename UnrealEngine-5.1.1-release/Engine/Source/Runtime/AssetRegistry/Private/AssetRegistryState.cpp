@@ -657,143 +657,136 @@ bool FAssetRegistryState::EnumerateAssets(const FARCompiledFilter& Filter, const
 	const uint32 FilterWithoutPackageFlags = Filter.WithoutPackageFlags;
 	const uint32 FilterWithPackageFlags = Filter.WithPackageFlags;
 
-	// The assets that match each filter
-	TArray<TArray<FAssetData*>, TInlineAllocator<5>> FilterResults;
-	
-	// On disk package names
-	if (Filter.PackageNames.Num() > 0)
+	auto MatchesTagsAndValues = [&Filter](const FAssetData* AssetData)
 	{
-		FilterResults.Emplace(FindAssets(CachedAssetsByPackageName, Filter.PackageNames));
-	}
+		for (auto FilterTagIt = Filter.TagsAndValues.CreateConstIterator(); FilterTagIt; ++FilterTagIt)
+		{
+			const FName Tag = FilterTagIt.Key();
+			const TOptional<FString>& Value = FilterTagIt.Value();
+			if (Value.IsSet() ? AssetData->TagsAndValues.ContainsKeyValue(Tag, Value.GetValue()) : AssetData->TagsAndValues.Contains(Tag))
+			{
+				return true;
+			}
+		}
+		return false;
+	};
 
-	// On disk package paths
-	if (Filter.PackagePaths.Num() > 0)
+	// Plan the query: gather the candidates from the index with the fewest matches for its filter, then test the
+	// other filters on each candidate directly instead of gathering and intersecting the matches of every filter.
+	// Object paths are exact lookups and always drive the query when present.
+	enum class EFilterIndex : uint8 { ObjectPaths, PackageNames, PackagePaths, ClassPaths, TagsAndValues };
+	EFilterIndex DrivingIndex = EFilterIndex::ObjectPaths;
+	if (Filter.SoftObjectPaths.Num() == 0)
 	{
-		FilterResults.Emplace(FindAssets(CachedAssetsByPath, Filter.PackagePaths));
-	}
+		int32 FewestMatches = MAX_int32;
+		auto ConsiderIndex = [&FewestMatches, &DrivingIndex](EFilterIndex Index, const auto& Map, const auto& Keys)
+		{
+			if (Keys.Num() == 0)
+			{
+				return;
+			}
+			int32 NumMatches = 0;
+			for (const auto& Key : Keys)
+			{
+				if (const auto* Assets = Map.Find(Key))
+				{
+					NumMatches += Assets->Num();
+				}
+			}
+			if (NumMatches < FewestMatches)
+			{
+				FewestMatches = NumMatches;
+				DrivingIndex = Index;
+			}
+		};
 
-	// On disk classes
-	if (Filter.ClassPaths.Num() > 0)
-	{
-		FilterResults.Emplace(FindAssets(CachedAssetsByClass, Filter.ClassPaths));
+		TArray<FName, TInlineAllocator<8>> FilterTags;
+		Filter.TagsAndValues.GetKeys(FilterTags);
+		ConsiderIndex(EFilterIndex::PackageNames, CachedAssetsByPackageName, Filter.PackageNames);
+		ConsiderIndex(EFilterIndex::PackagePaths, CachedAssetsByPath, Filter.PackagePaths);
+		ConsiderIndex(EFilterIndex::ClassPaths, CachedAssetsByClass, Filter.ClassPaths);
+		ConsiderIndex(EFilterIndex::TagsAndValues, CachedAssetsByTag, FilterTags);
 	}
 
-	// On disk object paths
-	if (Filter.SoftObjectPaths.Num() > 0)
+	TArray<FAssetData*> Candidates;
+	switch (DrivingIndex)
 	{
-		TArray<FAssetData*>& ObjectPathsFilter = FilterResults.Emplace_GetRef();
-		ObjectPathsFilter.Reserve(Filter.SoftObjectPaths.Num());
-
+	case EFilterIndex::ObjectPaths:
+		Candidates.Reserve(Filter.SoftObjectPaths.Num());
 		for (const FSoftObjectPath& ObjectPath : Filter.SoftObjectPaths)
 		{
 			if (FAssetData* const* AssetDataPtr = CachedAssets.Find(FCachedAssetKey(ObjectPath)))
 			{
-				ObjectPathsFilter.Add(*AssetDataPtr);
+				Candidates.Add(*AssetDataPtr);
 			}
 		}
-	}
-
-	// On disk tags and values
-	if (Filter.TagsAndValues.Num() > 0)
-	{
-		TArray<FAssetData*>& TagAndValuesFilter = FilterResults.Emplace_GetRef();
-		// Sometimes number of assets matching this filter is correlated to number of assets matching previous filters 
-		if (FilterResults.Num())
-		{
-			TagAndValuesFilter.Reserve(FilterResults[0].Num());
-		}
-
-		for (auto FilterTagIt = Filter.TagsAndValues.CreateConstIterator(); FilterTagIt; ++FilterTagIt)
-		{
-			const FName Tag = FilterTagIt.Key();
-			const TOptional<FString>& Value = FilterTagIt.Value();
-
-			if (const TArray<FAssetData*>* TagAssets = CachedAssetsByTag.Find(Tag))
+		break;
+	case EFilterIndex::PackageNames:
+		Candidates = FindAssets(CachedAssetsByPackageName, Filter.PackageNames);
+		break;
+	case EFilterIndex::PackagePaths:
+		Candidates = FindAssets(CachedAssetsByPath, Filter.PackagePaths);
+		break;
+	case EFilterIndex::ClassPaths:
+		Candidates = FindAssets(CachedAssetsByClass, Filter.ClassPaths);
+		break;
+	case EFilterIndex::TagsAndValues:
+		{
+			// An asset can match several of the tags
+			TSet<FAssetData*> TagCandidates;
+			TArray<FName, TInlineAllocator<8>> FilterTags;
+			Filter.TagsAndValues.GetKeys(FilterTags);
+			for (FName Tag : FilterTags)
 			{
-				for (FAssetData* AssetData : *TagAssets)
+				if (const TArray<FAssetData*>* TagAssets = CachedAssetsByTag.Find(Tag))
 				{
-					if (AssetData != nullptr)
+					TagCandidates.Reserve(TagCandidates.Num() + TagAssets->Num());
+					for (FAssetData* AssetData : *TagAssets)
 					{
-						bool bAccept;
-						if (!Value.IsSet())
-						{
-							bAccept = AssetData->TagsAndValues.Contains(Tag);
-						}
-						else
+						if (AssetData != nullptr && MatchesTagsAndValues(AssetData))
 						{
-							bAccept = AssetData->TagsAndValues.ContainsKeyValue(Tag, Value.GetValue());
-						}
-						if (bAccept)
-						{
-							TagAndValuesFilter.Add(AssetData);
+							TagCandidates.Add(AssetData);
 						}
 					}
 				}
 			}
+			Candidates = TagCandidates.Array();
 		}
+		break;
 	}
 
-	// Perform callback for assets that match all filters
-	if (FilterResults.Num() > 0)
-	{
-		auto SkipAssetData = [&](const FAssetData* AssetData) 
-		{ 
-			if (PackageNamesToSkip.Contains(AssetData->PackageName) |			//-V792
-				AssetData->HasAnyPackageFlags(FilterWithoutPackageFlags) |		//-V792
-				!AssetData->HasAllPackageFlags(FilterWithPackageFlags))			//-V792
-			{
-				return true;
-			}
-
-			return bSkipARFilteredAssets &&
-				UE::AssetRegistry::FFiltering::ShouldSkipAsset(AssetData->AssetClassPath, AssetData->PackageFlags);
-		};
+	auto SkipAssetData = [&](const FAssetData* AssetData) 
+	{ 
+		if (PackageNamesToSkip.Contains(AssetData->PackageName) |			//-V792
+			AssetData->HasAnyPackageFlags(FilterWithoutPackageFlags) |		//-V792
+			!AssetData->HasAllPackageFlags(FilterWithPackageFlags))			//-V792
+		{
+			return true;
+		}
 
-		int32 NumFilterResults = FilterResults.Num();
-		if (NumFilterResults > 1)
+		// The filters not evaluated by the driving index
+		if ((DrivingIndex != EFilterIndex::PackageNames && Filter.PackageNames.Num() > 0 && !Filter.PackageNames.Contains(AssetData->PackageName)) ||
+			(DrivingIndex != EFilterIndex::PackagePaths && Filter.PackagePaths.Num() > 0 && !Filter.PackagePaths.Contains(AssetData->PackagePath)) ||
+			(DrivingIndex != EFilterIndex::ClassPaths && Filter.ClassPaths.Num() > 0 && !Filter.ClassPaths.Contains(AssetData->AssetClassPath)) ||
+			(DrivingIndex != EFilterIndex::TagsAndValues && Filter.TagsAndValues.Num() > 0 && !MatchesTagsAndValues(AssetData)))
 		{
-			// Mark which filters each asset passes
-			uint32 PassAllFiltersValue = (1 << NumFilterResults) - 1; // 1 in every bit for the lowest n bits
-			TMap<FAssetData*, uint32> PassBits;
-			for (int32 FilterIndex = 0; FilterIndex < NumFilterResults; ++FilterIndex)
-			{
-				const TArray<FAssetData*>& FilterEvaluation = FilterResults[FilterIndex];
-				PassBits.Reserve(FilterEvaluation.Num());
-				
-				for (FAssetData* AssetData : FilterEvaluation)
-				{
-					PassBits.FindOrAdd(AssetData) |= (1 << FilterIndex);
-				}
-			}
+			return true;
+		}
 
-			// Include assets that pass all filters
-			for (TPair<FAssetData*, uint32> PassPair : PassBits)
-			{
-				const FAssetData* AssetData = PassPair.Key;
-				if (PassPair.Value != PassAllFiltersValue || SkipAssetData(AssetData))
-				{
-					continue;
-				}
-				else if (!Callback(*AssetData))
-				{
-					return true;
-				}
-			}
+		return bSkipARFilteredAssets &&
+			UE::AssetRegistry::FFiltering::ShouldSkipAsset(AssetData->AssetClassPath, AssetData->PackageFlags);
+	};
+
+	// Perform callback for assets that match all filters
+	for (const FAssetData* AssetData : Candidates)
+	{
+		if (SkipAssetData(AssetData))
+		{
+			continue;
 		}
-		else
+		else if (!Callback(*AssetData))
 		{
-			// All matched assets passed the single filter
-			for (const FAssetData* AssetData : FilterResults[0])
-			{
-				if (SkipAssetData(AssetData))
-				{
-					continue;
-				}
-				else if (!Callback(*AssetData))
-				{
-					return true;
-				}
-			}
+			return true;
 		}
 	}
 
@@ -14,6 +14,7 @@
 #include "SoundFieldRendering.h"
 #include "ProfilingDebugging/CsvProfiler.h"
 #include "Async/Async.h"
+#include "Async/ParallelFor.h"
 #include "ProfilingDebugging/CountersTrace.h"
 #include "Stats/Stats.h"
 
@@ -27,6 +28,21 @@ FAutoConsoleVariableRef CVarDisableParallelSourceProcessing(
 	TEXT("0: Not Disabled, 1: Disabled"),
 	ECVF_Default);
 
+static int32 BalancedParallelSourceProcessingCvar = 1;
+FAutoConsoleVariableRef CVarBalancedParallelSourceProcessing(
+	TEXT("au.BalancedParallelSourceProcessing"),
+	BalancedParallelSourceProcessingCvar,
+	TEXT("When parallel source processing is enabled, splits the busy sources into groups of similar size processed on task workers, instead of fixed source id ranges.\n")
+	TEXT("0: Fixed source workers, 1: Balanced tasks"),
+	ECVF_Default);
+
+static int32 ParallelSourceProcessingMinSourcesPerTaskCvar = 8;
+FAutoConsoleVariableRef CVarParallelSourceProcessingMinSourcesPerTask(
+	TEXT("au.ParallelSourceProcessing.MinSourcesPerTask"),
+	ParallelSourceProcessingMinSourcesPerTaskCvar,
+	TEXT("Min number of busy sources processed by each task with au.BalancedParallelSourceProcessing, fewer busy sources are processed on the audio render thread."),
+	ECVF_Default);
+
 static int32 DisableFilteringCvar = 0;
 FAutoConsoleVariableRef CVarDisableFiltering(
 	TEXT("au.DisableFiltering"),
@@ -2699,7 +2715,50 @@ namespace Audio
 			return;
 		}
 
-		if (NumSourceWorkers > 0 && !DisableParallelSourceProcessingCvar)
+		if (BalancedParallelSourceProcessingCvar && !DisableParallelSourceProcessingCvar)
+		{
+			// Split the source ids in ranges holding about the same number of busy sources, so the tasks are balanced whatever the sources playing.
+			// Each source only writes its own buffers, the mixdown into the submixes stays ordered as it is done afterwards by the submix graph.
+			int32 NumBusySources = 0;
+			for (int32 SourceId = 0; SourceId < NumTotalSources; ++SourceId)
+			{
+				NumBusySources += SourceInfos[SourceId].bIsBusy ? 1 : 0;
+			}
+
+			const int32 MinSourcesPerTask = FMath::Max(ParallelSourceProcessingMinSourcesPerTaskCvar, 1);
+			const int32 NumTasks = FMath::Min(NumBusySources / MinSourcesPerTask, FTaskGraphInterface::Get().GetNumWorkerThreads() + 1);
+			if (NumTasks <= 1)
+			{
+				GenerateSourceAudio(bGenerateBuses, 0, NumTotalSources);
+				return;
+			}
+
+			const int32 NumSourcesPerTask = FMath::DivideAndRoundUp(NumBusySources, NumTasks);
+			BalancedSourceIdRanges.Reset();
+			int32 RangeStartId = 0;
+			int32 NumRangeSources = 0;
+			for (int32 SourceId = 0; SourceId < NumTotalSources; ++SourceId)
+			{
+				if (SourceInfos[SourceId].bIsBusy && ++NumRangeSources == NumSourcesPerTask)
+				{
+					BalancedSourceIdRanges.Emplace(RangeStartId, SourceId + 1);
+					RangeStartId = SourceId + 1;
+					NumRangeSources = 0;
+				}
+			}
+			if (NumRangeSources > 0)
+			{
+				BalancedSourceIdRanges.Emplace(RangeStartId, NumTotalSources);
+			}
+
+			CSV_CUSTOM_STAT(Audio, SourceProcessingTasks, BalancedSourceIdRanges.Num(), ECsvCustomStatOp::Accumulate);
+			ParallelFor(BalancedSourceIdRanges.Num(), [this, bGenerateBuses](int32 RangeIndex)
+			{
+				const FIntPoint& Range = BalancedSourceIdRanges[RangeIndex];
+				GenerateSourceAudio(bGenerateBuses, Range.X, Range.Y);
+			});
+		}
+		else if (NumSourceWorkers > 0 && !DisableParallelSourceProcessingCvar)
 		{
 			AUDIO_MIXER_CHECK(SourceWorkers.Num() == NumSourceWorkers);
 			for (int32 i = 0; i < SourceWorkers.Num(); ++i)
@@ -583,6 +583,9 @@ namespace Audio
 		// Async task workers for processing sources in parallel
 		TArray<FAsyncTask<FAudioMixerSourceWorker>*> SourceWorkers;
 
+		// Source id ranges holding a balanced number of busy sources, rebuilt every block when processing sources in balanced parallel tasks
+		TArray<FIntPoint> BalancedSourceIdRanges;
+
 		// Array of task data waiting to finished. Processed on audio render thread.
 		TArray<TSharedPtr<FMixerSourceBuffer, ESPMode::ThreadSafe>> PendingSourceBuffers;
 
@@ -26,6 +26,7 @@ enum class EIoStoreTocVersion : uint8
 	PartitionSize,
 	PerfectHash,
 	PerfectHashWithOverflow,
+	ReferencedChunks,
 	LatestPlusOne,
 	Latest = LatestPlusOne - 1
 };
@@ -58,7 +59,7 @@ struct FIoStoreTocHeader
 	uint32	TocChunkPerfectHashSeedsCount = 0;
 	uint64	PartitionSize = 0;
 	uint32	TocChunksWithoutPerfectHashCount = 0;
-	uint32	Reserved7 = 0;
+	uint32	TocReferencedChunkCount = 0;
 	uint64	Reserved8[5] = { 0 };
 
 	void MakeMagic()
@@ -141,6 +142,17 @@ struct FIoStoreTocEntryMeta
 	FIoStoreTocEntryMetaFlags Flags;
 };
 
+/**
+ * A chunk that isn't stored in the container but is identical to (same hash as) a chunk in another container.
+ * The source container has to be mounted for the chunk to be resolved at runtime.
+ */
+struct FIoStoreTocReferencedChunk
+{
+	FIoChunkId ChunkId;
+	FIoChunkId SourceChunkId;
+	FIoContainerId SourceContainerId;
+};
+
 /**
  * Compression block entry.
  */
@@ -238,6 +250,8 @@ struct FIoStoreTocResource
 
 	TArray<FName> CompressionMethods;
 
+	TArray<FIoStoreTocReferencedChunk> ReferencedChunks;
+
 	FSHAHash SignatureHash;
 	
 	TArray<FSHAHash> ChunkBlockSignatures;
@@ -4,14 +4,40 @@
 #include "Async/Fundamental/Task.h"
 #include "Async/TaskTrace.h"
 #include "Logging/LogMacros.h"
+#include "HAL/IConsoleManager.h"
 #include "HAL/RunnableThread.h"
 #include "Misc/ScopeLock.h"
 #include "Misc/CommandLine.h"
+#include "Misc/CoreDelegates.h"
 #include "Misc/Fork.h"
+#include "ProfilingDebugging/CsvProfiler.h"
 #include "CoreGlobals.h"
 
 extern CORE_API bool GTaskGraphUseDynamicPrioritization;
 
+static float GBackgroundBudgetFraction = 0.0f;
+static FAutoConsoleVariableRef CVarBackgroundBudgetFraction(
+	TEXT("Tasks.BackgroundBudget.Fraction"),
+	GBackgroundBudgetFraction,
+	TEXT("The fraction of the core time of a frame (the frame time multiplied by the number of cores) background tasks can use. Background workers only execute foreground tasks when the budget is used up, until the next frame starts. 0 disables the budget.")
+);
+
+static float GBackgroundBudgetTargetFrameTimeMs = 0.0f;
+static FAutoConsoleVariableRef CVarBackgroundBudgetTargetFrameTimeMs(
+	TEXT("Tasks.BackgroundBudget.TargetFrameTimeMs"),
+	GBackgroundBudgetTargetFrameTimeMs,
+	TEXT("Frames that take longer than this (in ms) halve the background budget, it recovers gradually over frames within the target. 0 keeps the budget fixed.")
+);
+
+static float GBackgroundBudgetMinScale = 0.25f;
+static FAutoConsoleVariableRef CVarBackgroundBudgetMinScale(
+	TEXT("Tasks.BackgroundBudget.MinScale"),
+	GBackgroundBudgetMinScale,
+	TEXT("The background budget is not reduced below this fraction of Tasks.BackgroundBudget.Fraction for frames over the target frame time, so that background work always makes progress.")
+);
+
+CSV_DEFINE_CATEGORY(BackgroundTasks, true);
+
 namespace LowLevelTasks
 {
 	DEFINE_LOG_CATEGORY(LowLevelTasks);
@@ -21,9 +47,12 @@ namespace LowLevelTasks
 	thread_local FSchedulerTls* FSchedulerTls::ActiveScheduler = nullptr;
 	thread_local FSchedulerTls::EWorkerType FSchedulerTls::WorkerType = FSchedulerTls::EWorkerType::None;
 	thread_local uint32 FSchedulerTls::BusyWaitingDepth = 0;
+	thread_local uint64 FSchedulerTls::ActiveDeadline = 0;
 
 	FScheduler FScheduler::Singleton;
 
+	static FDelegateHandle GBackgroundBudgetFrameHandle;
+
 	FScheduler::FLocalQueueInstaller::FLocalQueueInstaller(FScheduler& Scheduler)
 	{
 		RegisteredLocalQueue = FSchedulerTls::LocalQueue == nullptr;
@@ -44,7 +73,7 @@ namespace LowLevelTasks
 		}
 	}
 
-	TUniquePtr<FThread> FScheduler::CreateWorker(bool bPermitBackgroundWork, FThread::EForkable IsForkable, FSleepEvent* ExternalWorkerEvent, FSchedulerTls::FLocalQueueType* ExternalWorkerLocalQueue, EThreadPriority Priority, uint64 InAffinity)
+	TUniquePtr<FThread> FScheduler::CreateWorker(bool bPermitBackgroundWork, FThread::EForkable IsForkable, FSleepEvent* ExternalWorkerEvent, FSchedulerTls::FLocalQueueType* ExternalWorkerLocalQueue, EThreadPriority Priority, uint64 InAffinity, uint32 NumaNode)
 	{
 		uint32 WorkerId = NextWorkerId++;
 		const uint32 WaitTimes[8] = { 719, 991, 1361, 1237, 1597, 953, 587, 1439 };
@@ -81,6 +110,20 @@ namespace LowLevelTasks
 			}
 			GroupWorkerId -= CpusInGroup;
 		}
+
+		//workers of a NUMA node are kept on the node's processors so that their local queues and the memory they touch stay close
+		if (NumaNode != FSchedulerTls::FQueueRegistry::InvalidNumaNode && !InAffinity)
+		{
+			uint16 NodeGroup = 0;
+			uint64 NodeMask = FPlatformAffinity::GetNumaNodeMask(NumaNode, NodeGroup);
+			if (NodeGroup < CpuGroupCount && (NodeMask & ProcessorGroups.ThreadAffinities[NodeGroup]) != 0)
+			{
+				//keep a narrower mask if it lies within the node, a mask of another processor group doesn't apply
+				const bool bKeepMask = NodeGroup == CpuGroup && (ThreadAffinityMask & NodeMask & ProcessorGroups.ThreadAffinities[NodeGroup]) != 0;
+				ThreadAffinityMask = bKeepMask ? ThreadAffinityMask & NodeMask : NodeMask;
+				CpuGroup = NodeGroup;
+			}
+		}
 		
 		return MakeUnique<FThread>
 		(
@@ -120,6 +163,18 @@ namespace LowLevelTasks
 
 		const bool bSupportsMultithreading = FPlatformProcess::SupportsMultithreading() || FForkProcessHelper::IsForkedMultithreadInstance();
 
+		//on NUMA systems workers are split into one group per node, -NoNumaTaskWorkers keeps a single group that runs anywhere
+		uint32 NewNumNumaNodes = 1;
+		if (!FParse::Param(FCommandLine::Get(), TEXT("NoNumaTaskWorkers")))
+		{
+			NewNumNumaNodes = FMath::Min(FPlatformAffinity::GetNumNumaNodes(), FSchedulerTls::FQueueRegistry::MaxNumaNodes);
+		}
+		auto GetWorkerNumaNode = [NewNumNumaNodes](uint32 WorkerId, uint32 NumWorkers)
+		{
+			//contiguous blocks of workers per node, like the OS enumerates the processors
+			return NewNumNumaNodes > 1 ? uint32(uint64(WorkerId) * NewNumNumaNodes / NumWorkers) : FSchedulerTls::FQueueRegistry::InvalidNumaNode;
+		};
+
 		uint32 OldActiveWorkers = ActiveWorkers.load(std::memory_order_relaxed);
 		if(OldActiveWorkers == 0 && bSupportsMultithreading && ActiveWorkers.compare_exchange_strong(OldActiveWorkers, NumForegroundWorkers + NumBackgroundWorkers, std::memory_order_relaxed))
 		{
@@ -129,28 +184,83 @@ namespace LowLevelTasks
 			check(!WorkerEvents.Num());		
 			check(NextWorkerId == 0);
 
+			NumNumaNodes = NewNumNumaNodes;
+			QueueRegistry.SetNumNumaNodes(NumNumaNodes);
+
 			WorkerThreads.Reserve(NumForegroundWorkers + NumBackgroundWorkers);
 			WorkerLocalQueues.Reserve(NumForegroundWorkers + NumBackgroundWorkers);
 			WorkerEvents.Reserve(NumForegroundWorkers + NumBackgroundWorkers);
 			UE::Trace::ThreadGroupBegin(TEXT("Foreground Workers"));
 			for (uint32 WorkerId = 0; WorkerId < NumForegroundWorkers; ++WorkerId)
 			{
+				const uint32 NumaNode = GetWorkerNumaNode(WorkerId, NumForegroundWorkers);
 				WorkerEvents.Emplace();
-				WorkerLocalQueues.Emplace(QueueRegistry, ELocalQueueType::EForeground, &WorkerEvents.Last());
-				WorkerThreads.Add(CreateWorker(false, IsForkable, &WorkerEvents.Last(), &WorkerLocalQueues.Last(), WorkerPriority, WorkerAffinity));
+				WorkerLocalQueues.Emplace(QueueRegistry, ELocalQueueType::EForeground, &WorkerEvents.Last(), NumaNode);
+				WorkerThreads.Add(CreateWorker(false, IsForkable, &WorkerEvents.Last(), &WorkerLocalQueues.Last(), WorkerPriority, WorkerAffinity, NumaNode));
 			}
 			UE::Trace::ThreadGroupEnd();
 			UE::Trace::ThreadGroupBegin(TEXT("Background Workers"));
 			for (uint32 WorkerId = 0; WorkerId < NumBackgroundWorkers; ++WorkerId)
 			{
+				const uint32 NumaNode = GetWorkerNumaNode(WorkerId, NumBackgroundWorkers);
 				WorkerEvents.Emplace();
-				WorkerLocalQueues.Emplace(QueueRegistry, ELocalQueueType::EBackground, &WorkerEvents.Last());
-				WorkerThreads.Add(CreateWorker(true, IsForkable, &WorkerEvents.Last(), &WorkerLocalQueues.Last(), GTaskGraphUseDynamicPrioritization ? WorkerPriority : BackgroundPriority, BackgroundAffinity));
+				WorkerLocalQueues.Emplace(QueueRegistry, ELocalQueueType::EBackground, &WorkerEvents.Last(), NumaNode);
+				WorkerThreads.Add(CreateWorker(true, IsForkable, &WorkerEvents.Last(), &WorkerLocalQueues.Last(), GTaskGraphUseDynamicPrioritization ? WorkerPriority : BackgroundPriority, BackgroundAffinity, NumaNode));
 			}
 			UE::Trace::ThreadGroupEnd();
+
+			if (!GBackgroundBudgetFrameHandle.IsValid())
+			{
+				GBackgroundBudgetFrameHandle = FCoreDelegates::OnBeginFrame.AddRaw(this, &FScheduler::BeginBackgroundBudgetFrame);
+			}
 		}
 	}
 
+	void FScheduler::BeginBackgroundBudgetFrame()
+	{
+		const uint64 Now = FPlatformTime::Cycles64();
+		const uint64 FrameCycles = BackgroundBudgetFrameStart != 0 ? Now - BackgroundBudgetFrameStart : 0;
+		BackgroundBudgetFrameStart = Now;
+		const uint64 UsedCycles = BackgroundUsedCycles.exchange(0, std::memory_order_relaxed);
+		const bool bWasThrottled = BackgroundBudgetCycles.load(std::memory_order_relaxed) != 0 && UsedCycles >= BackgroundBudgetCycles.load(std::memory_order_relaxed);
+
+		if (GBackgroundBudgetFraction <= 0.0f || FrameCycles == 0)
+		{
+			BackgroundBudgetCycles.store(0, std::memory_order_relaxed);
+			BackgroundBudgetScale = 1.0f;
+		}
+		else
+		{
+			// dynamic adjustment: back off quickly when frames are over the target, recover slowly
+			const double FrameTimeMs = FPlatformTime::ToMilliseconds64(FrameCycles);
+			if (GBackgroundBudgetTargetFrameTimeMs > 0.0f && FrameTimeMs > GBackgroundBudgetTargetFrameTimeMs)
+			{
+				BackgroundBudgetScale = FMath::Max(BackgroundBudgetScale * 0.5f, FMath::Clamp(GBackgroundBudgetMinScale, 0.0f, 1.0f));
+			}
+			else
+			{
+				BackgroundBudgetScale = FMath::Min(BackgroundBudgetScale + 0.05f, 1.0f);
+			}
+
+			// the next frame is expected to be as long as the last one
+			const double CoreCycles = double(FrameCycles) * FPlatformMisc::NumberOfCoresIncludingHyperthreads();
+			const uint64 BudgetCycles = uint64(CoreCycles * FMath::Min(GBackgroundBudgetFraction, 1.0f) * BackgroundBudgetScale);
+			BackgroundBudgetWindowEnd.store(Now + FrameCycles, std::memory_order_relaxed);
+			BackgroundBudgetCycles.store(FMath::Max<uint64>(BudgetCycles, 1), std::memory_order_relaxed);
+		}
+
+		// throttled background workers poll for the budget, but wake up the ones that went to sleep in the meantime
+		if (bWasThrottled)
+		{
+			while (WakeUpWorker(true)) {}
+		}
+
+		CSV_CUSTOM_STAT(BackgroundTasks, UsedMs, float(FPlatformTime::ToMilliseconds64(UsedCycles)), ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(BackgroundTasks, BudgetMs, float(FPlatformTime::ToMilliseconds64(BackgroundBudgetCycles.load(std::memory_order_relaxed))), ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(BackgroundTasks, BudgetScale, BackgroundBudgetScale, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(BackgroundTasks, Throttled, bWasThrottled ? 1 : 0, ECsvCustomStatOp::Set);
+	}
+
 	inline void FScheduler::ExecuteTask(FTask*& InOutTask)
 	{
 		FTask* ParentTask = FTask::ActiveTask;
@@ -181,7 +291,14 @@ namespace LowLevelTasks
 
 			{
 				TRACE_CPUPROFILER_EVENT_SCOPE(ExecuteBackgroundTask);
+				// nested background tasks are accounted by their parent
+				const bool bAccountTime = ParentTask == nullptr || !ParentTask->IsBackgroundTask();
+				const uint64 StartCycles = bAccountTime ? FPlatformTime::Cycles64() : 0;
 				InOutTask = InOutTask->ExecuteTask();
+				if (bAccountTime)
+				{
+					BackgroundUsedCycles.fetch_add(FPlatformTime::Cycles64() - StartCycles, std::memory_order_relaxed);
+				}
 			}
 
 			if (!bSkipPriorityChange)
@@ -237,7 +354,7 @@ namespace LowLevelTasks
 		TemporaryShutdown.store(false, std::memory_order_release);
 	}
 
-	void FScheduler::LaunchInternal(FTask& Task, EQueuePreference QueuePreference, bool bWakeUpWorker)
+	void FScheduler::LaunchInternal(FTask& Task, EQueuePreference QueuePreference, bool bWakeUpWorker, uint32 NumaNode)
 	{
 		if (ActiveWorkers.load(std::memory_order_relaxed) || TemporaryShutdown.load(std::memory_order_acquire))
 		{			
@@ -250,7 +367,28 @@ namespace LowLevelTasks
 
 			bWakeUpWorker |= FSchedulerTls::LocalQueue == nullptr;
 
-			if (FSchedulerTls::LocalQueue && QueuePreference != EQueuePreference::GlobalQueuePreference)
+			const uint64 Deadline = FSchedulerTls::ActiveDeadline;
+			if (Deadline != 0 && !bIsBackgroundTask)
+			{
+				if (QueueRegistry.EnqueueDeadline(&Task, Deadline))
+				{
+					if (bWakeUpWorker && !WakeUpWorker(false))
+					{
+						WakeUpWorker(true);
+					}
+				}
+			}
+			else if (NumNumaNodes > 1 && NumaNode < NumNumaNodes)
+			{
+				if (QueueRegistry.EnqueueNuma(&Task, uint32(Task.GetPriority()), NumaNode))
+				{
+					if (bWakeUpWorker && !WakeUpWorker(bIsBackgroundTask) && !bIsBackgroundTask)
+					{
+						WakeUpWorker(true);
+					}
+				}
+			}
+			else if (FSchedulerTls::LocalQueue && QueuePreference != EQueuePreference::GlobalQueuePreference)
 			{
 				if (FSchedulerTls::LocalQueue->Enqueue(&Task, uint32(Task.GetPriority())))
 				{
@@ -292,6 +430,16 @@ namespace LowLevelTasks
 	}
 #endif
 
+	uint32 FScheduler::GetCurrentNumaNode() const
+	{
+		if (FSchedulerTls::LocalQueue && FSchedulerTls::LocalQueue->GetNumaNode() != FSchedulerTls::FQueueRegistry::InvalidNumaNode)
+		{
+			return FSchedulerTls::LocalQueue->GetNumaNode();
+		}
+		const uint32 NumaNode = NumNumaNodes > 1 ? FPlatformAffinity::GetCurrentNumaNode() : 0;
+		return NumaNode < NumNumaNodes ? NumaNode : 0;
+	}
+
 	bool FSchedulerTls::IsWorkerThread() const
 	{
 		return WorkerType != FSchedulerTls::EWorkerType::None && ActiveScheduler == this;
@@ -302,6 +450,18 @@ namespace LowLevelTasks
 		return BusyWaitingDepth != 0;
 	}
 
+	uint64 FSchedulerTls::GetActiveDeadline()
+	{
+		return ActiveDeadline;
+	}
+
+	uint64 FSchedulerTls::SetActiveDeadline(uint64 Deadline)
+	{
+		const uint64 PreviousDeadline = ActiveDeadline;
+		ActiveDeadline = Deadline;
+		return PreviousDeadline;
+	}
+
 	uint32 FSchedulerTls::GetAffinityIndex()
 	{
 		if (LocalQueue)
@@ -316,6 +476,12 @@ namespace LowLevelTasks
 	{
 		bool AnyExecuted = false;
 
+		if constexpr (!bIsBusyWaiting)
+		{
+			// busy-waiting threads are not throttled, they can wait for the background work
+			bPermitBackgroundWork = bPermitBackgroundWork && !IsBackgroundBudgetExhausted();
+		}
+
 		FTask* Task = (Queue->*DequeueFunction)(bPermitBackgroundWork, bDisableThrottleStealing);
 		while (Task)
 		{
@@ -329,7 +495,15 @@ namespace LowLevelTasks
 					//either the task is not allowed during busy waiting or we have a  
 					//symetric switching task that we do not want to execute during BusyWaiting
 					//in either case we requeue and try again or we exit early with success.
-					QueueRegistry.Enqueue(Task, uint32(InitData.Priority));
+					const uint64 Deadline = Queue->ConsumeDequeuedDeadline();
+					if (Deadline != 0)
+					{
+						QueueRegistry.EnqueueDeadline(Task, Deadline);
+					}
+					else
+					{
+						QueueRegistry.Enqueue(Task, uint32(InitData.Priority));
+					}
 
 					if(AnyExecuted)
 					{
@@ -357,7 +531,11 @@ namespace LowLevelTasks
 				}
 			}
 			
+			// tasks from the deadline queue pass their deadline on to the tasks they launch, all others run without one
+			const uint64 PreviousDeadline = FSchedulerTls::ActiveDeadline;
+			FSchedulerTls::ActiveDeadline = Queue->ConsumeDequeuedDeadline();
 			ExecuteTask(Task);
+			FSchedulerTls::ActiveDeadline = PreviousDeadline;
 			if(Task)
 			{
 				verifySlow(Task->TryPrepareLaunch());
@@ -424,6 +602,13 @@ namespace LowLevelTasks
 				break;
 			}
 
+			if (bPermitBackgroundWork && IsBackgroundBudgetExhausted())
+			{
+				// the background work is picked up again when the next frame starts or the budget window ends
+				FPlatformProcess::SleepNoStats(0.001f);
+				continue;
+			}
+
 			if (WaitCount == 0 && !bDrowsing)
 			{
 				verifySlow(TrySleeping(WorkerEvent, OutOfWork.Start(), false, bPermitBackgroundWork));
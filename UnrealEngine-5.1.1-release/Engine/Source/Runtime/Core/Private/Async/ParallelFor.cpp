@@ -4,10 +4,126 @@
 
 #include "CoreTypes.h"
 #include "HAL/IConsoleManager.h"
+#include "ProfilingDebugging/CountersTrace.h"
 
 CORE_API int32 GParallelForBackgroundYieldingTimeoutMs = 8;
 static FAutoConsoleVariableRef CVarParallelForBackgroundYieldingTimeout(
 	TEXT("Async.ParallelFor.YieldingTimeout"),
 	GParallelForBackgroundYieldingTimeoutMs,
 	TEXT("The timeout (in ms) when background priority parallel for task will yield execution to give higher priority tasks the chance to run.")
-);
\ No newline at end of file
+);
+static bool GParallelForAdaptiveEnabled = true;
+static FAutoConsoleVariableRef CVarParallelForAdaptiveEnabled(
+	TEXT("Async.ParallelFor.Adaptive.Enabled"),
+	GParallelForAdaptiveEnabled,
+	TEXT("If false ParallelFors flagged as Adaptive use the default batching heuristic.")
+);
+
+static float GParallelForAdaptiveTargetBatchUs = 50.0f;
+static FAutoConsoleVariableRef CVarParallelForAdaptiveTargetBatchUs(
+	TEXT("Async.ParallelFor.Adaptive.TargetBatchUs"),
+	GParallelForAdaptiveTargetBatchUs,
+	TEXT("The time (in us) a batch of an adaptive parallel for should take at least so the scheduling overhead is amortized.")
+);
+
+static float GParallelForAdaptiveInlineThresholdUs = 20.0f;
+static FAutoConsoleVariableRef CVarParallelForAdaptiveInlineThresholdUs(
+	TEXT("Async.ParallelFor.Adaptive.InlineThresholdUs"),
+	GParallelForAdaptiveInlineThresholdUs,
+	TEXT("Adaptive parallel fors whose whole workload is expected to take less than this (in us) are executed inline on the calling thread.")
+);
+
+namespace ParallelForImpl
+{
+	// sites are never removed, DebugNames are expected to be literals so their address identifies the call site
+	static constexpr uint32 MaxAdaptiveSites = 1024;
+	static FAdaptiveSite GAdaptiveSites[MaxAdaptiveSites];
+
+	// weight of a new sample in the moving average of the per item cost
+	static constexpr double AdaptiveSampleWeight = 0.25;
+
+	FAdaptiveSite* FindOrAddAdaptiveSite(const TCHAR* DebugName)
+	{
+		if (!GParallelForAdaptiveEnabled || DebugName == nullptr)
+		{
+			return nullptr;
+		}
+
+		const uint32 Hash = PointerHash(DebugName);
+		for (uint32 Probe = 0; Probe < MaxAdaptiveSites; ++Probe)
+		{
+			const uint32 Index = (Hash + Probe) & (MaxAdaptiveSites - 1);
+			const TCHAR* Name = GAdaptiveSites[Index].DebugName.load(std::memory_order_acquire);
+			if (Name == nullptr && GAdaptiveSites[Index].DebugName.compare_exchange_strong(Name, DebugName, std::memory_order_acq_rel))
+			{
+				return &GAdaptiveSites[Index];
+			}
+			// a failed compare_exchange updated Name to the site that was added concurrently
+			if (Name == DebugName)
+			{
+				return &GAdaptiveSites[Index];
+			}
+		}
+		return nullptr;
+	}
+
+	int32 GetAdaptiveMinBatchSize(const FAdaptiveSite& Site, int32 Num, int32 MinBatchSize, bool& bOutRunInline)
+	{
+		bOutRunInline = false;
+		const double CyclesPerItem = Site.CyclesPerItem.load(std::memory_order_relaxed);
+		if (CyclesPerItem <= 0.0)
+		{
+			// nothing learned yet, the default heuristic is measured
+			return MinBatchSize;
+		}
+
+		const double CyclesPerUs = 1e-6 / FPlatformTime::GetSecondsPerCycle64();
+		if (CyclesPerItem * Num < GParallelForAdaptiveInlineThresholdUs * CyclesPerUs)
+		{
+			bOutRunInline = true;
+			return FMath::Max(MinBatchSize, Num);
+		}
+
+		const double ItemsPerBatch = FMath::CeilToDouble(GParallelForAdaptiveTargetBatchUs * CyclesPerUs / CyclesPerItem);
+		return FMath::Max(MinBatchSize, int32(FMath::Min<double>(ItemsPerBatch, Num)));
+	}
+
+	void ReportAdaptiveSample(FAdaptiveSite& Site, int32 Num, int32 BatchSize, int32 NumTasks, uint64 BodyCycles, uint64 WallCycles)
+	{
+		check(Num > 0 && NumTasks > 0);
+		const double Sample = double(BodyCycles) / Num;
+		const double Previous = Site.CyclesPerItem.load(std::memory_order_relaxed);
+		const double CyclesPerItem = Previous > 0.0 ? Previous + (Sample - Previous) * AdaptiveSampleWeight : Sample;
+		// concurrent calls from the same site may overwrite each others samples, which is fine for an average
+		Site.CyclesPerItem.store(FMath::Max(CyclesPerItem, UE_DOUBLE_SMALL_NUMBER), std::memory_order_relaxed);
+
+#if COUNTERSTRACE_ENABLED
+		if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(CountersChannel))
+		{
+			return;
+		}
+
+		uint8 TraceState = Site.TraceState.load(std::memory_order_acquire);
+		if (TraceState == 0 && Site.TraceState.compare_exchange_strong(TraceState, 1, std::memory_order_acq_rel))
+		{
+			Site.ItemCostCounterId = FCountersTrace::OutputInitCounter(*FString::Printf(TEXT("ParallelFor/%s/ItemCostNs"), Site.DebugName.load(std::memory_order_relaxed)), TraceCounterType_Float, TraceCounterDisplayHint_None);
+			Site.BatchSizeCounterId = FCountersTrace::OutputInitCounter(*FString::Printf(TEXT("ParallelFor/%s/BatchSize"), Site.DebugName.load(std::memory_order_relaxed)), TraceCounterType_Int, TraceCounterDisplayHint_None);
+			Site.OverheadCounterId = FCountersTrace::OutputInitCounter(*FString::Printf(TEXT("ParallelFor/%s/OverheadUs"), Site.DebugName.load(std::memory_order_relaxed)), TraceCounterType_Float, TraceCounterDisplayHint_None);
+			Site.InlineCounterId = FCountersTrace::OutputInitCounter(*FString::Printf(TEXT("ParallelFor/%s/Inline"), Site.DebugName.load(std::memory_order_relaxed)), TraceCounterType_Int, TraceCounterDisplayHint_None);
+			TraceState = 2;
+			Site.TraceState.store(TraceState, std::memory_order_release);
+		}
+
+		if (TraceState == 2)
+		{
+			const double SecondsPerCycle = FPlatformTime::GetSecondsPerCycle64();
+			// overhead is the wall time that is not explained by the body time spread evenly over all tasks
+			const double OverheadCycles = FMath::Max(0.0, double(WallCycles) - double(BodyCycles) / NumTasks);
+			FCountersTrace::OutputSetValue(Site.ItemCostCounterId, Sample * SecondsPerCycle * 1e9);
+			FCountersTrace::OutputSetValue(Site.BatchSizeCounterId, int64(BatchSize));
+			FCountersTrace::OutputSetValue(Site.OverheadCounterId, OverheadCycles * SecondsPerCycle * 1e6);
+			FCountersTrace::OutputSetValue(Site.InlineCounterId, int64(NumTasks == 1));
+		}
+#endif
+	}
+}
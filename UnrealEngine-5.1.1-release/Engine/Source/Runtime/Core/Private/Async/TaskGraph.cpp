@@ -109,6 +109,14 @@ static FAutoConsoleVariableRef CVarTaskDynamicPrioritization(
 );
 
 CORE_API int32 GUseNewTaskBackend = 1;
+
+static bool GBoostWaitedTasks = true;
+static FAutoConsoleVariableRef CVarBoostWaitedTasks(
+	TEXT("TaskGraph.BoostWaitedTasks"),
+	GBoostWaitedTasks,
+	TEXT("If enabled named threads and high priority tasks that wait for graph events boost the waited tasks and their prerequisites (priority inheritance).")
+);
+
 CORE_API int32 GNumForegroundWorkers = 2;
 static FAutoConsoleVariableRef CVarNumForegroundWorkers(
 	TEXT("TaskGraph.NumForegroundWorkers"),
@@ -2046,6 +2054,11 @@ private:
 				Priority = LowLevelTasks::ETaskPriority::BackgroundHigh;
 			}
 
+			if (Task->IsBoosted())
+			{
+				Priority = LowLevelTasks::ETaskPriority::High;
+			}
+
 			Task->GetTaskHandle().Init(TEXT("TaskGraphTask"), Priority, [Task, InThreadToExecuteOn, Deleter(LowLevelTasks::TDeleter<FBaseGraphTask, &FBaseGraphTask::DeleteTask>(Task))]()
 			{
 				Task->Execute(NewTasks, InThreadToExecuteOn, false);
@@ -2053,6 +2066,8 @@ private:
 	
 			bWakeUpWorker |= LowLevelTasks::FSchedulerTls::IsBusyWaiting();
 
+			// tasks created inside a deadline scope keep their deadline when they are queued by the completion of their prerequisites
+			LowLevelTasks::FDeadlineScope DeadlineScope(Task->GetLaunchDeadline());
 			verifySlow(LowLevelTasks::TryLaunch(Task->GetTaskHandle(), bWakeUpWorker ? LowLevelTasks::EQueuePreference::GlobalQueuePreference : LowLevelTasks::EQueuePreference::LocalQueuePreference, bWakeUpWorker));
 			return;
 #endif
@@ -2178,6 +2193,25 @@ private:
 			// we don't modify CurrentThread here because it might be a local queue
 		}
 
+#if !TASKGRAPH_NEW_FRONTEND
+		if (GBoostWaitedTasks && FTaskGraphInterface::IsMultithread())
+		{
+			// priority inheritance: a latency sensitive waiter must not be stalled by tasks that sit behind lower priority work
+			const LowLevelTasks::FTask* ActiveTask = LowLevelTasks::FTask::GetActiveTask();
+			const bool bIsNamedThread = CurrentThreadIfKnown != ENamedThreads::AnyThread && CurrentThreadIfKnown < NumNamedThreads;
+			if (bIsNamedThread || (ActiveTask != nullptr && ActiveTask->GetPriority() == LowLevelTasks::ETaskPriority::High))
+			{
+				for (const FGraphEventRef& Task : Tasks)
+				{
+					if (Task.IsValid() && !Task->IsComplete())
+					{
+						Task->Boost();
+					}
+				}
+			}
+		}
+#endif
+
 		if (CurrentThreadIfKnown != ENamedThreads::AnyThread && CurrentThreadIfKnown < NumNamedThreads && !IsThreadProcessingTasks(CurrentThread))
 		{
 			if (Tasks.Num() < 8) // don't bother to check for completion if there are lots of prereqs...too expensive to check
@@ -2590,6 +2624,82 @@ FGraphEvent::~FGraphEvent()
 	TaskTrace::Destroyed(GetTraceId());
 }
 
+namespace TaskGraphBoostImpl
+{
+	// executes a claimed any thread task with high priority instead of waiting for it to be picked from its queue
+	class FBoostTask : public TConcurrentLinearObject<FBoostTask, FTaskGraphBlockAllocationTag>
+	{
+	public:
+		explicit FBoostTask(LowLevelTasks::FTask* InTarget)
+		{
+			Handle.Init(TEXT("TaskGraphBoost"), LowLevelTasks::ETaskPriority::High, [InTarget, Deleter(LowLevelTasks::TDeleter<FBoostTask, &FBoostTask::Delete>(this))]()
+			{
+				verifySlow(InTarget->ExecuteClaimed() == nullptr);
+			});
+		}
+
+		void Launch()
+		{
+			verifySlow(LowLevelTasks::TryLaunch(Handle, LowLevelTasks::EQueuePreference::GlobalQueuePreference));
+		}
+
+	private:
+		void Delete()
+		{
+			delete this;
+		}
+
+		LowLevelTasks::FTask Handle;
+	};
+
+	// bounds the work a single wait can spend on walking the prerequisites graph
+	constexpr int32 MaxBoostedEvents = 64;
+}
+
+void FGraphEvent::Boost()
+{
+	FGraphEventArray Pending;
+	Pending.Add(this);
+
+	for (int32 Budget = TaskGraphBoostImpl::MaxBoostedEvents; Pending.Num() != 0 && Budget != 0; --Budget)
+	{
+		FGraphEventRef Event = Pending.Pop(false);
+		if (Event->IsComplete())
+		{
+			continue;
+		}
+
+		LowLevelTasks::FTask* Claimed = nullptr;
+		{
+			UE::TScopeLock<UE::FSpinLock> Lock(Event->ProducerLock);
+			FBaseGraphTask* Task = Event->Producer;
+			if (Task == nullptr || Task->IsBoosted())
+			{
+				continue;
+			}
+
+			if (Task->NumberOfPrerequistitesOutstanding.GetValue() != 0)
+			{
+				// not queued yet, it will be queued with high priority once its prerequisites are boosted and completed
+				Task->bBoosted.store(true, std::memory_order_relaxed);
+				Task->CollectPendingPrerequisites(Pending);
+			}
+			else if (ENamedThreads::GetThreadIndex(Task->ThreadToExecuteOn) == ENamedThreads::AnyThread
+				&& Task->TaskHandle.GetPriority() != LowLevelTasks::ETaskPriority::High
+				&& Task->TaskHandle.TryClaim())
+			{
+				// the task can't be executed or deleted by anybody else now, so it's safe to use it after releasing the lock
+				Claimed = &Task->TaskHandle;
+			}
+		}
+
+		if (Claimed != nullptr)
+		{
+			(new TaskGraphBoostImpl::FBoostTask(Claimed))->Launch();
+		}
+	}
+}
+
 #endif
 
 DECLARE_CYCLE_STAT(TEXT("FBroadcastTask"), STAT_FBroadcastTask, STATGROUP_TaskGraphTasks);
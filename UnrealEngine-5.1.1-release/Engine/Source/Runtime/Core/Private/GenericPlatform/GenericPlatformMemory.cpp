@@ -42,6 +42,11 @@ DEFINE_STAT(STAT_UsedPhysical);
 DEFINE_STAT(STAT_PeakUsedPhysical);
 DEFINE_STAT(STAT_UsedVirtual);
 DEFINE_STAT(STAT_PeakUsedVirtual);
+DEFINE_STAT(STAT_LargePageRequested);
+DEFINE_STAT(STAT_LargePageBacked);
+
+// OS allocations the platform managed to back with large pages, in the platform tracker
+LLM_DEFINE_TAG(LargePages);
 
 namespace GenericPlatformMemory
 {
@@ -113,6 +118,8 @@ struct FGenericStatsUpdater
 		SET_MEMORY_STAT( STAT_PeakUsedPhysical, MemoryStats.PeakUsedPhysical );
 		SET_MEMORY_STAT( STAT_UsedVirtual, MemoryStats.UsedVirtual );
 		SET_MEMORY_STAT( STAT_PeakUsedVirtual, MemoryStats.PeakUsedVirtual );
+		SET_MEMORY_STAT( STAT_LargePageRequested, MemoryStats.LargePageRequested );
+		SET_MEMORY_STAT( STAT_LargePageBacked, MemoryStats.LargePageBacked );
 
 		TRACE_COUNTER_SET(PlatformMemoryTotalPhysical, MemoryStats.TotalPhysical);
 		TRACE_COUNTER_SET(PlatformMemoryTotalVirtual, MemoryStats.TotalVirtual);
@@ -137,6 +144,8 @@ FGenericPlatformMemoryStats::FGenericPlatformMemoryStats()
 	, PeakUsedPhysical( 0 )
 	, UsedVirtual( 0 )
 	, PeakUsedVirtual( 0 )
+	, LargePageRequested( 0 )
+	, LargePageBacked( 0 )
 {}
 
 FGenericPlatformMemoryStats::EMemoryPressureStatus FGenericPlatformMemoryStats::GetMemoryPressureStatus()
@@ -313,6 +322,11 @@ void FGenericPlatformMemory::DumpStats( class FOutputDevice& Ar )
 		(float)(MemoryStats.TotalPhysical - MemoryStats.AvailablePhysical)*InvMB, (float)MemoryStats.AvailablePhysical*InvMB, (float)MemoryStats.TotalPhysical*InvMB);
 	Ar.CategorizedLogf(CategoryName, ELogVerbosity::Log, TEXT("Virtual Memory: %.2f MB used,  %.2f MB free, %.2f MB total"), 
 		(float)(MemoryStats.TotalVirtual - MemoryStats.AvailableVirtual)*InvMB, (float)MemoryStats.AvailableVirtual*InvMB, (float)MemoryStats.TotalVirtual*InvMB);
+	if (MemoryStats.LargePageRequested > 0)
+	{
+		Ar.CategorizedLogf(CategoryName, ELogVerbosity::Log, TEXT("Large Pages: %.2f MB requested, %.2f MB backed"),
+			(float)MemoryStats.LargePageRequested*InvMB, (float)MemoryStats.LargePageBacked*InvMB);
+	}
 	}
 }
 
@@ -509,6 +523,11 @@ bool FGenericPlatformMemory::UnmapNamedSharedMemoryRegion(FSharedMemoryRegion *
 }
 
 
+SIZE_T FGenericPlatformMemory::AdviseLargePages(void* Ptr, SIZE_T Size)
+{
+	return 0;
+}
+
 void FGenericPlatformMemory::InternalUpdateStats( const FPlatformMemoryStats& MemoryStats )
 {
 	// Generic method is empty. Implement at platform level.
@@ -19,6 +19,7 @@
 #include "Misc/LazySingleton.h"
 #include "Misc/Fork.h"
 #include "ProfilingDebugging/CsvProfiler.h"
+#include "ProfilingDebugging/LockTrace.h"
 #include "Async/TaskGraphInterfaces.h"
 
 #ifndef DEFAULT_NO_THREADING
@@ -445,6 +446,7 @@ bool FPThreadEvent::Wait(uint32 WaitTime, const bool bIgnoreThreadIdleStats /*=
 		// No event signalled yet.
 		else if (WaitTime != 0)  // not just polling, wait on the condition variable.
 		{
+			TRACE_LOCK_WAIT_SCOPE(this, ELockTraceType::Event);
 			WaitingThreads++;
 			if (WaitTime == ((uint32)-1)) // infinite wait?
 			{
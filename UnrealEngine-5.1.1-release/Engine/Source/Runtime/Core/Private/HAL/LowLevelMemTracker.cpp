@@ -410,6 +410,9 @@ namespace LLMPrivate
 
 		int8 PausedCounter[(int32)ELLMAllocType::Count];
 		int64 AllocTypeAmounts[(int32)ELLMAllocType::Count];
+
+		/** Bytes this thread can allocate before its next allocation is sampled, when sampling is enabled */
+		int64 SampleBytesRemaining;
 	};
 
 	/*
@@ -539,6 +542,7 @@ namespace LLMPrivate
 
 		FLLMThreadState* GetOrCreateState();
 		FLLMThreadState* GetState();
+		bool SkipSampledAllocation(const void* Ptr, int64& InOutSize, ELLMTracker Tracker, FLLMThreadState* State) const;
 		void TrackAllocation(const void* Ptr, int64 Size, const FTagData* ActiveTagData, ELLMTracker Tracker, ELLMAllocType AllocType, FLLMThreadState* State, bool bTrackInMemPro);
 
 		FLowLevelMemTracker& LLMRef;
@@ -717,6 +721,7 @@ FLowLevelMemTracker::FLowLevelMemTracker()
 	, ProgramSize(0)
 	, MemoryUsageCurrentOverhead(0)
 	, MemoryUsagePlatformTotalUntracked(0)
+	, SampleBytes(0)
 	, bFirstTimeUpdating(true)
 	, bCanEnable(true)
 	, bCsvWriterEnabled(false)
@@ -1193,6 +1198,13 @@ void FLowLevelMemTracker::ProcessCommandLine(const TCHAR* CmdLine)
 		}
 	}
 
+	// Sampled tracking, to lower the per allocation cost in long running tests; tag sizes are then estimates
+	FParse::Value(CmdLine, TEXT("LLMSampleBytes="), SampleBytes);
+	if (SampleBytes > 0)
+	{
+		UE_LOG(LogInit, Log, TEXT("LLM sampling one allocation every %lld bytes"), SampleBytes);
+	}
+
 	// Commandline overrides for console variables
 	int TrackPeaks = 0;
 	if (FParse::Value(CmdLine, TEXT("LLMTrackPeaks="), TrackPeaks))
@@ -3169,9 +3181,35 @@ namespace LLMPrivate
 	}
 #endif
 
+	bool FLLMTracker::SkipSampledAllocation(const void* Ptr, int64& InOutSize, ELLMTracker Tracker, FLLMThreadState* State) const
+	{
+		// Allocations are sampled by the bytes allocated on each thread rather than by count, so every sampled allocation stands for
+		// SampleBytes bytes and is tracked with that size. Allocations larger than SampleBytes are always sampled, with their real size.
+		// Only the default tracker is sampled, and only tracked pointers; platform allocations and explicit amounts are always exact.
+		const int64 SampleBytes = LLMRef.SampleBytes;
+		if (SampleBytes <= 0 || Ptr == nullptr || Tracker != ELLMTracker::Default)
+		{
+			return false;
+		}
+
+		State->SampleBytesRemaining -= InOutSize;
+		if (State->SampleBytesRemaining > 0)
+		{
+			return true;
+		}
+
+		State->SampleBytesRemaining = SampleBytes;
+		InOutSize = FMath::Max(InOutSize, SampleBytes);
+		return false;
+	}
+
 	void FLLMTracker::TrackAllocation(const void* Ptr, int64 Size, ELLMTag DefaultEnumTag, ELLMTracker Tracker, ELLMAllocType AllocType, bool bTrackInMemPro)
 	{
 		FLLMThreadState* State = GetOrCreateState();
+		if (SkipSampledAllocation(Ptr, Size, Tracker, State))
+		{
+			return;
+		}
 		const FTagData* TagData = State->GetTopTag();
 		if (!TagData)
 		{
@@ -3183,6 +3221,10 @@ namespace LLMPrivate
 	void FLLMTracker::TrackAllocation(const void* Ptr, int64 Size, FName DefaultTag, ELLMTracker Tracker, ELLMAllocType AllocType, bool bTrackInMemPro)
 	{
 		FLLMThreadState* State = GetOrCreateState();
+		if (SkipSampledAllocation(Ptr, Size, Tracker, State))
+		{
+			return;
+		}
 		const FTagData* TagData = State->GetTopTag();
 		if (!TagData)
 		{
@@ -3625,6 +3667,7 @@ namespace LLMPrivate
 	}
 
 	FLLMThreadState::FLLMThreadState()
+		: SampleBytesRemaining(0)
 	{
 		for (int32 Index = 0; Index < static_cast<int32>(ELLMAllocType::Count); ++Index)
 		{
@@ -13,6 +13,7 @@ PRAGMA_DISABLE_UNSAFE_TYPECAST_WARNINGS
 #include "HAL/IConsoleManager.h"
 #include "HAL/MemoryMisc.h"
 #include "HAL/PlatformMisc.h"
+#include "ProfilingDebugging/CsvProfiler.h"
 
 #if USE_CACHED_PAGE_ALLOCATOR_FOR_LARGE_ALLOCS
 #include "HAL/Allocators/CachedOSPageAllocator.h"
@@ -66,6 +67,19 @@ static FAutoConsoleVariableRef GMallocBinned3AllocExtraCVar(
 	TEXT("When we do acquire the lock, how many blocks cached in TLS caches. In no case will we grab more than a page.")
 	);
 
+int32 GMallocBinned3RemoteFreeMailboxBundles = DEFAULT_GMallocBinned3RemoteFreeMailboxBundles;
+static FAutoConsoleVariableRef GMallocBinned3RemoteFreeMailboxBundlesCVar(
+	TEXT("MallocBinned3.RemoteFreeMailboxBundles"),
+	GMallocBinned3RemoteFreeMailboxBundles,
+	TEXT("Max number of freed bundles, per-block size, parked in the lock-free remote free mailbox once the global recycler is full. 0 disables the mailbox.")
+	);
+
+#endif
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(CORE_API, FMemory);
+#if BINNED3_ALLOCATOR_PER_BIN_STATS
+// Per-bin contention stats are a lot of columns, so they are opt-in via -csvCategories=MallocBinned3
+CSV_DEFINE_CATEGORY(MallocBinned3, false);
 #endif
 
 float GMallocBinned3FlushThreadCacheMaxWaitTime = 0.02f;
@@ -570,6 +584,95 @@ struct FMallocBinned3::Private
 
 	static FGlobalRecycler GGlobalRecycler;
 
+	/**
+	 * Lock-free, per-block size overflow for the global recycler.
+	 *
+	 * Producer/consumer workloads (allocate on the game thread, free on a worker) fill the freeing thread's TLS cache and
+	 * the global recycler quickly, after which every further bundle used to be returned under the allocator mutex by the
+	 * freeing thread. Blocks don't carry an owning thread, so rather than routing them back to their allocating thread we
+	 * park whole bundles here and let the next thread that misses its TLS cache for that block size adopt them, which is
+	 * the allocating thread in exactly the workloads that produce the overflow.
+	 *
+	 * Bundles are chained through FBundleNode::NextBundle. Pushes are single CASes and the consumer detaches the whole
+	 * list with one exchange, so there is no ABA hazard.
+	 */
+	struct FRemoteFreeMailbox
+	{
+		bool PushBundle(uint32 InPoolIndex, FBundleNode* InBundle)
+		{
+			FPaddedMailbox& Mailbox = Mailboxes[InPoolIndex];
+			if (Mailbox.NumBundles.Load(EMemoryOrder::Relaxed) >= GMallocBinned3RemoteFreeMailboxBundles)
+			{
+				return false;
+			}
+			Mailbox.NumBundles.IncrementExchange();
+			PushChain(Mailbox, InBundle, InBundle);
+			return true;
+		}
+
+		// detaches every parked bundle for this block size, chained through NextBundle
+		FBundleNode* PopAllBundles(uint32 InPoolIndex)
+		{
+			FPaddedMailbox& Mailbox = Mailboxes[InPoolIndex];
+			if (!Mailbox.Head.Load(EMemoryOrder::Relaxed))
+			{
+				return nullptr;
+			}
+			FBundleNode* Result = Mailbox.Head.Exchange(nullptr);
+			int32 NumPopped = 0;
+			for (FBundleNode* Bundle = Result; Bundle; Bundle = Bundle->NextBundle)
+			{
+				NumPopped++;
+			}
+			Mailbox.NumBundles.SubExchange(NumPopped);
+			return Result;
+		}
+
+		// returns a chain previously detached with PopAllBundles to the mailbox
+		void PushBundles(uint32 InPoolIndex, FBundleNode* InBundles)
+		{
+			FPaddedMailbox& Mailbox = Mailboxes[InPoolIndex];
+			int32 NumPushed = 1;
+			FBundleNode* Tail = InBundles;
+			while (Tail->NextBundle)
+			{
+				Tail = Tail->NextBundle;
+				NumPushed++;
+			}
+			Mailbox.NumBundles.AddExchange(NumPushed);
+			PushChain(Mailbox, InBundles, Tail);
+		}
+
+	private:
+		struct FPaddedMailbox
+		{
+			TAtomic<FBundleNode*> Head;
+			TAtomic<int32> NumBundles;
+			uint8 Padding[PLATFORM_CACHE_LINE_SIZE - sizeof(TAtomic<FBundleNode*>) - sizeof(TAtomic<int32>)];
+
+			FPaddedMailbox()
+				: Head(nullptr)
+				, NumBundles(0)
+			{
+			}
+		};
+		static_assert(sizeof(FPaddedMailbox) == PLATFORM_CACHE_LINE_SIZE, "FPaddedMailbox should be the same size as a cache line");
+
+		static void PushChain(FPaddedMailbox& Mailbox, FBundleNode* First, FBundleNode* Last)
+		{
+			FBundleNode* OldHead = Mailbox.Head.Load(EMemoryOrder::Relaxed);
+			do
+			{
+				Last->NextBundle = OldHead;
+			}
+			while (!Mailbox.Head.CompareExchange(OldHead, First));
+		}
+
+		MS_ALIGN(PLATFORM_CACHE_LINE_SIZE) FPaddedMailbox Mailboxes[BINNED3_SMALL_POOL_COUNT] GCC_ALIGN(PLATFORM_CACHE_LINE_SIZE);
+	};
+
+	static FRemoteFreeMailbox GRemoteFreeMailbox;
+
 	static void FreeBundles(FMallocBinned3& Allocator, FBundleNode* BundlesToRecycle, uint32 InBlockSize, uint32 InPoolIndex)
 	{
 		FPoolTable& Table = Allocator.SmallPoolTables[InPoolIndex];
@@ -668,6 +771,7 @@ struct FMallocBinned3::Private
 };
 
 FMallocBinned3::Private::FGlobalRecycler FMallocBinned3::Private::GGlobalRecycler;
+FMallocBinned3::Private::FRemoteFreeMailbox FMallocBinned3::Private::GRemoteFreeMailbox;
 
 #if BINNED3_ALLOCATOR_STATS
 TAtomic<int64> FMallocBinned3::FPerThreadFreeBlockLists::ConsolidatedMemory;
@@ -769,6 +873,10 @@ FMallocBinned3::FMallocBinned3()
 		SmallPoolTables[Index].TotalRequestedAllocSize.Store(0);
 		SmallPoolTables[Index].TotalAllocCount.Store(0);
 		SmallPoolTables[Index].TotalFreeCount.Store(0);
+		SmallPoolTables[Index].LockedAllocCount.Store(0);
+		SmallPoolTables[Index].LockedFreeCount.Store(0);
+		SmallPoolTables[Index].MailboxPushCount.Store(0);
+		SmallPoolTables[Index].MailboxAdoptCount.Store(0);
 #endif
 
 		int64 TotalNumberOfBlocksOfBlocks = MAX_MEMORY_PER_BLOCK_SIZE / (SizeTable[Index].PagesPlatformForBlockOfBlocks * OsAllocationGranularity);
@@ -846,6 +954,8 @@ FMallocBinned3::FMallocBinned3()
 	Binned3BaseVMPtr = (uint8*)Binned3BaseVMBlock.GetVirtualPointer();
 	check(IsAligned(Binned3BaseVMPtr, OsAllocationGranularity));
 	verify(Binned3BaseVMPtr);
+	// The small pools are dense, long-lived and hot, so they are where large pages pay off against TLB misses
+	FPlatformMemory::AdviseLargePages(Binned3BaseVMPtr, Binned3BaseVMBlock.GetActualSize());
 #else
 
 	for (uint32 Index = 0; Index < BINNED3_SMALL_POOL_COUNT; ++Index)
@@ -854,6 +964,7 @@ FMallocBinned3::FMallocBinned3()
 
 		uint8* NewVM = (uint8*)NewBLock.GetVirtualPointer();
 		check(IsAligned(NewVM, OsAllocationGranularity));
+		FPlatformMemory::AdviseLargePages(NewVM, NewBLock.GetActualSize());
 		// insertion sort
 		if (Index && NewVM < PoolBaseVMPtr[Index - 1])
 		{
@@ -1017,6 +1128,7 @@ void* FMallocBinned3::MallocExternal(SIZE_T Size, uint32 Alignment)
 
 		// Allocate from small object pool.
 		FPoolTable& Table = SmallPoolTables[PoolIndex];
+		Table.LockedAlloc();
 
 		uint32 BlockOfBlocksIndex = MAX_uint32;
 		FPoolInfoSmall* Pool = GetFrontPool(Table, PoolIndex, BlockOfBlocksIndex);
@@ -1235,7 +1347,13 @@ void FMallocBinned3::FreeExternal(void* Ptr)
 		if (BundlesToRecycle)
 		{
 			BundlesToRecycle->NextBundle = nullptr;
+			if (Lists && Private::GRemoteFreeMailbox.PushBundle(PoolIndex, BundlesToRecycle))
+			{
+				SmallPoolTables[PoolIndex].MailboxPush();
+				return;
+			}
 			FScopeLock Lock(&Mutex);
+			SmallPoolTables[PoolIndex].LockedFree();
 			Private::FreeBundles(*this, BundlesToRecycle, BlockSize, PoolIndex);
 #if BINNED3_ALLOCATOR_STATS
 			if (!Lists)
@@ -1360,6 +1478,12 @@ void FMallocBinned3::FlushCurrentThreadCache()
 			{
 				Private::FreeBundles(*this, Bundles, PoolIndexToBlockSize(PoolIndex), PoolIndex);
 			}
+			// parked remote frees are nobody's cache, so a trim returns them as well
+			Bundles = Private::GRemoteFreeMailbox.PopAllBundles(PoolIndex);
+			if (Bundles)
+			{
+				Private::FreeBundles(*this, Bundles, PoolIndexToBlockSize(PoolIndex), PoolIndex);
+			}
 		}
 		WaitForMutexAndTrimTime = FPlatformTime::Seconds() - StartTimeInner;
 	}
@@ -1432,6 +1556,25 @@ bool FMallocBinned3::FFreeBlockList::ObtainPartial(uint32 InPoolIndex)
 			PartialBundle.Head->NextBundle = nullptr;
 			return true;
 		}
+
+		// Adopt a bundle that a remote free couldn't fit in the recycler; the rest go straight back for the next miss.
+		FBundleNode* Bundles = FMallocBinned3::Private::GRemoteFreeMailbox.PopAllBundles(InPoolIndex);
+		if (Bundles)
+		{
+			if (Bundles->NextBundle)
+			{
+				FMallocBinned3::Private::GRemoteFreeMailbox.PushBundles(InPoolIndex, Bundles->NextBundle);
+			}
+			// mailbox bundles are chained through the head's NextBundle, so the count has to be rebuilt
+			Bundles->NextBundle = nullptr;
+			PartialBundle.Head = Bundles;
+			for (FBundleNode* Node = Bundles; Node; Node = Node->NextNodeInCurrentBundle)
+			{
+				PartialBundle.Count++;
+			}
+			FMallocBinned3::MallocBinned3->SmallPoolTables[InPoolIndex].MailboxAdopt();
+			return true;
+		}
 		return false;
 	}
 	return true;
@@ -1631,6 +1774,14 @@ void FMallocBinned3::DumpAllocatorStats(class FOutputDevice& Ar)
 			FullBlocks,
 			PartialBlocks
 			);
+		Ar.Logf(TEXT("Pool %2d   Size %6d   LockedAllocs %8lld  LockedBundleFrees %8lld  MailboxPushes %8lld  MailboxAdopts %8lld"),
+			PoolIndex,
+			PoolIndexToBlockSize(PoolIndex),
+			SmallPoolTables[PoolIndex].LockedAllocCount.Load(),
+			SmallPoolTables[PoolIndex].LockedFreeCount.Load(),
+			SmallPoolTables[PoolIndex].MailboxPushCount.Load(),
+			SmallPoolTables[PoolIndex].MailboxAdoptCount.Load()
+			);
 	}
 #else
 #endif
@@ -1639,6 +1790,74 @@ void FMallocBinned3::DumpAllocatorStats(class FOutputDevice& Ar)
 	Ar.Logf(TEXT("Allocator Stats for Binned3 are not in this build set BINNED3_ALLOCATOR_STATS 1 in MallocBinned3.cpp"));
 #endif
 }
+
+void FMallocBinned3::UpdateStats()
+{
+#if CSV_PROFILER && BINNED3_ALLOCATOR_PER_BIN_STATS
+	// Stats are reported as per-frame deltas so contention shows up as spikes rather than as an ever growing total.
+	static int64 LastLockedAllocCount[BINNED3_SMALL_POOL_COUNT] = {};
+	static int64 LastLockedFreeCount[BINNED3_SMALL_POOL_COUNT] = {};
+	static int64 LastMailboxPushCount[BINNED3_SMALL_POOL_COUNT] = {};
+	static int64 LastMailboxAdoptCount[BINNED3_SMALL_POOL_COUNT] = {};
+
+	const bool bPerBinStats = FCsvProfiler::Get()->IsCategoryEnabled(CSV_CATEGORY_INDEX(MallocBinned3));
+	static FName PerBinStatNames[BINNED3_SMALL_POOL_COUNT][4];
+	if (bPerBinStats && PerBinStatNames[0][0].IsNone())
+	{
+		for (int32 PoolIndex = 0; PoolIndex < BINNED3_SMALL_POOL_COUNT; PoolIndex++)
+		{
+			const uint32 BlockSize = PoolIndexToBlockSize(PoolIndex);
+			PerBinStatNames[PoolIndex][0] = FName(*FString::Printf(TEXT("%u_LockedAllocs"), BlockSize));
+			PerBinStatNames[PoolIndex][1] = FName(*FString::Printf(TEXT("%u_LockedFrees"), BlockSize));
+			PerBinStatNames[PoolIndex][2] = FName(*FString::Printf(TEXT("%u_MailboxPushes"), BlockSize));
+			PerBinStatNames[PoolIndex][3] = FName(*FString::Printf(TEXT("%u_MailboxAdopts"), BlockSize));
+		}
+	}
+
+	int32 TotalLockedAllocs = 0;
+	int32 TotalLockedFrees = 0;
+	int32 TotalMailboxPushes = 0;
+	int32 TotalMailboxAdopts = 0;
+	for (int32 PoolIndex = 0; PoolIndex < BINNED3_SMALL_POOL_COUNT; PoolIndex++)
+	{
+		FPoolTable& Table = SmallPoolTables[PoolIndex];
+		const int64 LockedAllocCount = Table.LockedAllocCount.Load(EMemoryOrder::Relaxed);
+		const int64 LockedFreeCount = Table.LockedFreeCount.Load(EMemoryOrder::Relaxed);
+		const int64 MailboxPushCount = Table.MailboxPushCount.Load(EMemoryOrder::Relaxed);
+		const int64 MailboxAdoptCount = Table.MailboxAdoptCount.Load(EMemoryOrder::Relaxed);
+
+		const int32 LockedAllocs = int32(LockedAllocCount - LastLockedAllocCount[PoolIndex]);
+		const int32 LockedFrees = int32(LockedFreeCount - LastLockedFreeCount[PoolIndex]);
+		const int32 MailboxPushes = int32(MailboxPushCount - LastMailboxPushCount[PoolIndex]);
+		const int32 MailboxAdopts = int32(MailboxAdoptCount - LastMailboxAdoptCount[PoolIndex]);
+
+		LastLockedAllocCount[PoolIndex] = LockedAllocCount;
+		LastLockedFreeCount[PoolIndex] = LockedFreeCount;
+		LastMailboxPushCount[PoolIndex] = MailboxPushCount;
+		LastMailboxAdoptCount[PoolIndex] = MailboxAdoptCount;
+
+		TotalLockedAllocs += LockedAllocs;
+		TotalLockedFrees += LockedFrees;
+		TotalMailboxPushes += MailboxPushes;
+		TotalMailboxAdopts += MailboxAdopts;
+
+		if (bPerBinStats)
+		{
+			FCsvProfiler::RecordCustomStat(PerBinStatNames[PoolIndex][0], CSV_CATEGORY_INDEX(MallocBinned3), LockedAllocs, ECsvCustomStatOp::Set);
+			FCsvProfiler::RecordCustomStat(PerBinStatNames[PoolIndex][1], CSV_CATEGORY_INDEX(MallocBinned3), LockedFrees, ECsvCustomStatOp::Set);
+			FCsvProfiler::RecordCustomStat(PerBinStatNames[PoolIndex][2], CSV_CATEGORY_INDEX(MallocBinned3), MailboxPushes, ECsvCustomStatOp::Set);
+			FCsvProfiler::RecordCustomStat(PerBinStatNames[PoolIndex][3], CSV_CATEGORY_INDEX(MallocBinned3), MailboxAdopts, ECsvCustomStatOp::Set);
+		}
+	}
+
+	CSV_CUSTOM_STAT(FMemory, Binned3LockedAllocs, TotalLockedAllocs, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(FMemory, Binned3LockedFrees, TotalLockedFrees, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(FMemory, Binned3MailboxPushes, TotalMailboxPushes, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(FMemory, Binned3MailboxAdopts, TotalMailboxAdopts, ECsvCustomStatOp::Set);
+#endif
+
+	FMalloc::UpdateStats();
+}
 #if !BINNED3_INLINE
 	#if PLATFORM_USES_FIXED_GMalloc_CLASS && !FORCE_ANSI_ALLOCATOR && USE_MALLOC_BINNED3
 		//#define FMEMORY_INLINE_FUNCTION_DECORATOR  FORCEINLINE
@@ -0,0 +1,389 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "HAL/MallocFrameArena.h"
+
+#include "Containers/Array.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "HAL/UnrealMemory.h"
+#include "Math/UnrealMathUtility.h"
+#include "Misc/ScopeLock.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Stats/Stats.h"
+#include "Templates/AlignmentTemplates.h"
+
+#include <atomic>
+
+LLM_DEFINE_TAG(FrameArena);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(CORE_API, FMemory);
+
+DECLARE_MEMORY_STAT(TEXT("FrameArena Frame Used"), STAT_FrameArenaFrameUsed, STATGROUP_Memory);
+DECLARE_MEMORY_STAT(TEXT("FrameArena High Water Mark"), STAT_FrameArenaHighWaterMark, STATGROUP_Memory);
+DECLARE_MEMORY_STAT(TEXT("FrameArena Committed"), STAT_FrameArenaCommitted, STATGROUP_Memory);
+
+static int32 GFrameArenaChunkSize = 256 * 1024;
+static FAutoConsoleVariableRef CVarFrameArenaChunkSize(
+	TEXT("FrameArena.ChunkSize"),
+	GFrameArenaChunkSize,
+	TEXT("Size in bytes of the chunks each thread bump-allocates frame arena memory from. Larger requests get a dedicated chunk."),
+	ECVF_Default
+	);
+
+static int32 GFrameArenaMaxCachedChunks = 8;
+static FAutoConsoleVariableRef CVarFrameArenaMaxCachedChunks(
+	TEXT("FrameArena.MaxCachedChunks"),
+	GFrameArenaMaxCachedChunks,
+	TEXT("Number of recycled chunks each thread keeps around instead of returning them to the heap."),
+	ECVF_Default
+	);
+
+namespace UE::FrameArena::Private
+{
+	struct FChunk
+	{
+		FChunk* Next;
+		SIZE_T Size;
+
+		uint8* Begin()
+		{
+			return reinterpret_cast<uint8*>(this + 1);
+		}
+
+		uint8* End()
+		{
+			return reinterpret_cast<uint8*>(this) + Size;
+		}
+	};
+
+	/** Stored directly in front of every allocation so Realloc can honour the FMalloc contract without the old size. */
+	struct FAllocationHeader
+	{
+		SIZE_T Size;
+	};
+
+	static FAllocationHeader& GetHeader(void* Ptr)
+	{
+		return reinterpret_cast<FAllocationHeader*>(Ptr)[-1];
+	}
+
+	/** Incremented by EndFrame. Thread arenas compare against it lazily on their next allocation. */
+	static std::atomic<uint64> GEpoch(2);
+
+	static std::atomic<uint64> GCommittedBytes(0);
+	static uint64 GLastFrameBytesUsed = 0;
+	static uint64 GFrameHighWaterMark = 0;
+
+	struct FThreadArena
+	{
+		/** Chunk lists indexed by frame parity. The head of the current parity's list is the chunk being allocated from. */
+		FChunk* Chunks[2] = { nullptr, nullptr };
+
+		/** Recycled standard-sized chunks. */
+		FChunk* FreeChunks = nullptr;
+		int32 NumFreeChunks = 0;
+
+		uint8* Top = nullptr;
+		uint8* End = nullptr;
+
+		/** Most recent allocation and where Top was before it, so it can be rewound or grown in place. */
+		uint8* LastAllocation = nullptr;
+		uint8* LastAllocationPreviousTop = nullptr;
+
+		/** Only written by the owning thread, read by EndFrame for stats. */
+		std::atomic<uint64> Epoch{ 0 };
+		std::atomic<uint64> BytesUsed{ 0 };
+
+		FORCEINLINE void SyncEpoch()
+		{
+			const uint64 CurrentEpoch = GEpoch.load(std::memory_order_acquire);
+			if (UNLIKELY(Epoch.load(std::memory_order_relaxed) != CurrentEpoch))
+			{
+				BeginEpoch(CurrentEpoch);
+			}
+		}
+
+		void BeginEpoch(uint64 NewEpoch)
+		{
+			const uint64 OldEpoch = Epoch.load(std::memory_order_relaxed);
+
+			// The list for the new parity holds allocations that are at least two frames old.
+			RecycleChunks(Chunks[NewEpoch & 1]);
+			Chunks[NewEpoch & 1] = nullptr;
+
+			// If this thread skipped a frame entirely, the other list is stale as well.
+			if (NewEpoch - OldEpoch >= 2)
+			{
+				RecycleChunks(Chunks[(NewEpoch + 1) & 1]);
+				Chunks[(NewEpoch + 1) & 1] = nullptr;
+			}
+
+			Top = nullptr;
+			End = nullptr;
+			LastAllocation = nullptr;
+			LastAllocationPreviousTop = nullptr;
+			BytesUsed.store(0, std::memory_order_relaxed);
+			Epoch.store(NewEpoch, std::memory_order_relaxed);
+		}
+
+		void RecycleChunks(FChunk* Chunk)
+		{
+			while (Chunk)
+			{
+				FChunk* Next = Chunk->Next;
+				if (Chunk->Size == (SIZE_T)GFrameArenaChunkSize && NumFreeChunks < GFrameArenaMaxCachedChunks)
+				{
+					Chunk->Next = FreeChunks;
+					FreeChunks = Chunk;
+					++NumFreeChunks;
+				}
+				else
+				{
+					GCommittedBytes.fetch_sub(Chunk->Size, std::memory_order_relaxed);
+					FMemory::Free(Chunk);
+				}
+				Chunk = Next;
+			}
+		}
+
+		void AllocateChunk(SIZE_T MinDataSize)
+		{
+			FChunk* Chunk = nullptr;
+			const SIZE_T StandardSize = (SIZE_T)FMath::Max(GFrameArenaChunkSize, 4096);
+			if (MinDataSize + sizeof(FChunk) <= StandardSize && FreeChunks && FreeChunks->Size == StandardSize)
+			{
+				Chunk = FreeChunks;
+				FreeChunks = Chunk->Next;
+				--NumFreeChunks;
+			}
+			else
+			{
+				const SIZE_T ChunkSize = FMath::Max(StandardSize, MinDataSize + sizeof(FChunk));
+				LLM_SCOPE_BYTAG(FrameArena);
+				Chunk = (FChunk*)FMemory::Malloc(ChunkSize, PLATFORM_CACHE_LINE_SIZE);
+				Chunk->Size = ChunkSize;
+				GCommittedBytes.fetch_add(ChunkSize, std::memory_order_relaxed);
+			}
+
+			FChunk*& Head = Chunks[Epoch.load(std::memory_order_relaxed) & 1];
+			Chunk->Next = Head;
+			Head = Chunk;
+
+			Top = Chunk->Begin();
+			End = Chunk->End();
+		}
+
+		FORCEINLINE void* Allocate(SIZE_T Size, uint32 Alignment)
+		{
+			SyncEpoch();
+
+			uint8* Result = Align(Top + sizeof(FAllocationHeader), Alignment);
+			if (UNLIKELY(!Top || Result + Size > End))
+			{
+				AllocateChunk(Size + Alignment + sizeof(FAllocationHeader));
+				Result = Align(Top + sizeof(FAllocationHeader), Alignment);
+			}
+
+			GetHeader(Result).Size = Size;
+
+			BytesUsed.store(BytesUsed.load(std::memory_order_relaxed) + (Result + Size - Top), std::memory_order_relaxed);
+			LastAllocationPreviousTop = Top;
+			LastAllocation = Result;
+			Top = Result + Size;
+			return Result;
+		}
+
+		FORCEINLINE bool TryResizeInPlace(uint8* Ptr, SIZE_T NewSize, uint32 Alignment)
+		{
+			if (Ptr == LastAllocation && IsAligned(Ptr, Alignment) && Ptr + NewSize <= End)
+			{
+				uint8* NewTop = Ptr + NewSize;
+				BytesUsed.store(BytesUsed.load(std::memory_order_relaxed) + (NewTop - Top), std::memory_order_relaxed);
+				Top = NewTop;
+				GetHeader(Ptr).Size = NewSize;
+				return true;
+			}
+			return false;
+		}
+
+		FORCEINLINE void Release(uint8* Ptr)
+		{
+			if (Ptr == LastAllocation)
+			{
+				BytesUsed.store(BytesUsed.load(std::memory_order_relaxed) - (Top - LastAllocationPreviousTop), std::memory_order_relaxed);
+				Top = LastAllocationPreviousTop;
+				LastAllocation = nullptr;
+				LastAllocationPreviousTop = nullptr;
+			}
+		}
+	};
+
+	static FCriticalSection& GetRegistryLock()
+	{
+		static FCriticalSection Lock;
+		return Lock;
+	}
+
+	static TArray<FThreadArena*>& GetRegistry()
+	{
+		static TArray<FThreadArena*> Registry;
+		return Registry;
+	}
+
+	static thread_local FThreadArena* TlsThreadArena = nullptr;
+
+	static FThreadArena& GetThreadArena()
+	{
+		if (UNLIKELY(!TlsThreadArena))
+		{
+			LLM_SCOPE_BYTAG(FrameArena);
+			FThreadArena* Arena = new FThreadArena();
+			Arena->Epoch.store(GEpoch.load(std::memory_order_acquire), std::memory_order_relaxed);
+
+			FScopeLock Lock(&GetRegistryLock());
+			GetRegistry().Add(Arena);
+			TlsThreadArena = Arena;
+		}
+		return *TlsThreadArena;
+	}
+
+	static FORCEINLINE uint32 GetEffectiveAlignment(SIZE_T Size, uint32 Alignment)
+	{
+		return FMath::Max<uint32>(Alignment, Size >= 16 ? 16u : 8u);
+	}
+}
+
+void* FFrameArena::Malloc(SIZE_T Size, uint32 Alignment)
+{
+	using namespace UE::FrameArena::Private;
+	return GetThreadArena().Allocate(Size, GetEffectiveAlignment(Size, Alignment));
+}
+
+void* FFrameArena::Realloc(void* Ptr, SIZE_T NewSize, uint32 Alignment)
+{
+	using namespace UE::FrameArena::Private;
+
+	if (!Ptr)
+	{
+		return NewSize ? Malloc(NewSize, Alignment) : nullptr;
+	}
+
+	if (!NewSize)
+	{
+		Free(Ptr);
+		return nullptr;
+	}
+
+	FThreadArena& Arena = GetThreadArena();
+	Arena.SyncEpoch();
+
+	const uint32 EffectiveAlignment = GetEffectiveAlignment(NewSize, Alignment);
+	if (Arena.TryResizeInPlace((uint8*)Ptr, NewSize, EffectiveAlignment))
+	{
+		return Ptr;
+	}
+
+	const SIZE_T OldSize = GetHeader(Ptr).Size;
+	if (NewSize <= OldSize && IsAligned(Ptr, EffectiveAlignment))
+	{
+		GetHeader(Ptr).Size = NewSize;
+		return Ptr;
+	}
+
+	void* Result = Arena.Allocate(NewSize, EffectiveAlignment);
+	FMemory::Memcpy(Result, Ptr, FMath::Min(OldSize, NewSize));
+	return Result;
+}
+
+void FFrameArena::Free(void* Ptr)
+{
+	using namespace UE::FrameArena::Private;
+
+	if (Ptr && TlsThreadArena)
+	{
+		FThreadArena& Arena = *TlsThreadArena;
+		Arena.SyncEpoch();
+		Arena.Release((uint8*)Ptr);
+	}
+}
+
+SIZE_T FFrameArena::GetAllocationSize(void* Ptr)
+{
+	using namespace UE::FrameArena::Private;
+	return Ptr ? GetHeader(Ptr).Size : 0;
+}
+
+void FFrameArena::EndFrame()
+{
+	using namespace UE::FrameArena::Private;
+
+	const uint64 EndingEpoch = GEpoch.load(std::memory_order_relaxed);
+
+	uint64 FrameBytesUsed = 0;
+	{
+		FScopeLock Lock(&GetRegistryLock());
+		for (const FThreadArena* Arena : GetRegistry())
+		{
+			// Threads that did not allocate in the ending frame still report their last active frame; skip them.
+			if (Arena->Epoch.load(std::memory_order_relaxed) == EndingEpoch)
+			{
+				FrameBytesUsed += Arena->BytesUsed.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	GLastFrameBytesUsed = FrameBytesUsed;
+	GFrameHighWaterMark = FMath::Max(GFrameHighWaterMark, FrameBytesUsed);
+
+	GEpoch.store(EndingEpoch + 1, std::memory_order_release);
+
+	SET_MEMORY_STAT(STAT_FrameArenaFrameUsed, FrameBytesUsed);
+	SET_MEMORY_STAT(STAT_FrameArenaHighWaterMark, GFrameHighWaterMark);
+	SET_MEMORY_STAT(STAT_FrameArenaCommitted, GetCommittedBytes());
+
+	CSV_CUSTOM_STAT(FMemory, FrameArenaUsedKB, (int32)(FrameBytesUsed / 1024), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(FMemory, FrameArenaHighWaterKB, (int32)(GFrameHighWaterMark / 1024), ECsvCustomStatOp::Set);
+}
+
+uint64 FFrameArena::GetLastFrameBytesUsed()
+{
+	return UE::FrameArena::Private::GLastFrameBytesUsed;
+}
+
+uint64 FFrameArena::GetFrameHighWaterMark()
+{
+	return UE::FrameArena::Private::GFrameHighWaterMark;
+}
+
+uint64 FFrameArena::GetCommittedBytes()
+{
+	return UE::FrameArena::Private::GCommittedBytes.load(std::memory_order_relaxed);
+}
+
+FMallocFrameArena& FMallocFrameArena::Get()
+{
+	static FMallocFrameArena Instance;
+	return Instance;
+}
+
+void* FMallocFrameArena::Malloc(SIZE_T Size, uint32 Alignment)
+{
+	return FFrameArena::Malloc(Size, Alignment);
+}
+
+void* FMallocFrameArena::Realloc(void* Ptr, SIZE_T NewSize, uint32 Alignment)
+{
+	return FFrameArena::Realloc(Ptr, NewSize, Alignment);
+}
+
+void FMallocFrameArena::Free(void* Ptr)
+{
+	FFrameArena::Free(Ptr);
+}
+
+bool FMallocFrameArena::GetAllocationSize(void* Original, SIZE_T& SizeOut)
+{
+	SizeOut = FFrameArena::GetAllocationSize(Original);
+	return true;
+}
@@ -1,5 +1,6 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
+#include "Async/MappedFileHandle.h"
 #include "HAL/Platform.h"
 #include "HAL/UnrealMemory.h"
 #include "IO/IoDispatcher.h"
@@ -20,6 +21,13 @@ FIoBuffer::BufCore::~BufCore()
 	{
 		FMemory::Free(Data());
 	}
+	else if (Flags & OwnsMappedRegion)
+	{
+		FIoMappedRegion* MappedRegion = reinterpret_cast<FIoMappedRegion*>(Data());
+		delete MappedRegion->MappedFileRegion;
+		delete MappedRegion->MappedFileHandle;
+		delete MappedRegion;
+	}
 }
 
 FIoBuffer::BufCore::BufCore(const uint8* InData, uint64 InSize, bool InOwnsMemory)
@@ -50,6 +58,13 @@ FIoBuffer::BufCore::BufCore(ECloneTag, uint8* InData, uint64 InSize)
 	FMemory::Memcpy(Data(), InData, InSize);
 }
 
+FIoBuffer::BufCore::BufCore(FIoMappedRegion* InMappedRegion)
+{
+	SetDataAndSize(reinterpret_cast<uint8*>(InMappedRegion), sizeof(FIoMappedRegion));
+
+	Flags |= OwnsMappedRegion;
+}
+
 void
 FIoBuffer::BufCore::CheckRefCount() const
 {
@@ -148,6 +163,19 @@ FIoBuffer::FIoBuffer(FIoBuffer::EAssumeOwnershipTag, FMemoryView Memory)
 {
 }
 
+FIoBuffer::FIoBuffer(FIoBuffer::EAssumeOwnershipTag, FIoMappedRegion&& MappedRegion)
+{
+	check(MappedRegion.MappedFileHandle && MappedRegion.MappedFileRegion);
+	const uint8* MappedPtr	= MappedRegion.MappedFileRegion->GetMappedPtr();
+	const uint64 MappedSize	= MappedRegion.MappedFileRegion->GetMappedSize();
+
+	// The region is owned by an outer core so views of the buffer keep it mapped
+	TRefCountPtr<BufCore> MappedRegionCore(new BufCore(new FIoMappedRegion(MappedRegion)));
+	MappedRegion = FIoMappedRegion();
+
+	CorePtr = new BufCore(MappedPtr, MappedSize, MappedRegionCore.GetReference());
+}
+
 FIoBuffer::FIoBuffer(FIoBuffer::ECloneTag, const void* Data, uint64 InSize)
 :	CorePtr(new BufCore(Clone, (uint8*)Data, InSize))
 {
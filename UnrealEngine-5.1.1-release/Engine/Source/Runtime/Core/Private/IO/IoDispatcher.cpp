@@ -21,6 +21,14 @@
 #include "IO/IoDispatcherBackend.h"
 #include "Hash/Blake3.h"
 #include "IO/PackageId.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryWriter.h"
+#include "String/HexToBytes.h"
+
+#include <atomic>
 
 DEFINE_LOG_CATEGORY(LogIoDispatcher);
 
@@ -56,6 +64,22 @@ static const TCHAR* const GetIoErrorText_ErrorCodeTextArray[] =
 
 CORE_API const TCHAR* const* GetIoErrorText_ErrorCodeText = GetIoErrorText_ErrorCodeTextArray;
 
+static float GIoDispatcherPreloadLifetimeSeconds = 30.0f;
+static FAutoConsoleVariableRef CVar_IoDispatcherPreloadLifetimeSeconds(
+	TEXT("s.IoDispatcherPreloadLifetimeSeconds"),
+	GIoDispatcherPreloadLifetimeSeconds,
+	TEXT("Seconds after FIoDispatcher::Preload after which preloaded chunks that were not requested are dropped.")
+);
+
+static int32 GIoDispatcherPreloadMemoryMB = 64;
+static FAutoConsoleVariableRef CVar_IoDispatcherPreloadMemoryMB(
+	TEXT("s.IoDispatcherPreloadMemoryMB"),
+	GIoDispatcherPreloadMemoryMB,
+	TEXT("Memory budget for preloading the chunks of the preload manifest at startup, 0 to disable preloading.")
+);
+
+#define UE_IODISPATCHER_RECORD_REQUEST_ORDER !UE_BUILD_SHIPPING
+
 #if UE_IODISPATCHER_STATS_ENABLED
 class FIoRequestStats
 {
@@ -179,6 +203,99 @@ public:
 };
 #endif
 
+#if UE_IODISPATCHER_RECORD_REQUEST_ORDER
+/**
+ * Records the chunks that are requested during startup in the order they are first requested, enabled with -RecordIoRequestOrder[=Seconds].
+ * The recording is saved to Saved/IoRequestOrder when the recording time is over or at shutdown, see FIoPreloadManifest.
+ */
+class FIoRequestOrderRecorder
+{
+public:
+	FIoRequestOrderRecorder()
+	{
+		float RecordSeconds = 60.0f;
+		if (!FParse::Value(FCommandLine::Get(), TEXT("RecordIoRequestOrder="), RecordSeconds) && !FParse::Param(FCommandLine::Get(), TEXT("RecordIoRequestOrder")))
+		{
+			return;
+		}
+		UE_LOG(LogIoDispatcher, Display, TEXT("Recording the IO request order for %.1f seconds"), RecordSeconds);
+		bIsRecording = true;
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this](float)
+		{
+			Save();
+			return false;
+		}), RecordSeconds);
+	}
+
+	~FIoRequestOrderRecorder()
+	{
+		if (TickerHandle.IsValid())
+		{
+			FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		}
+		Save();
+	}
+
+	void OnRequestStarted(const FIoRequestImpl& Request)
+	{
+		if (bIsRecording.load(std::memory_order_relaxed))
+		{
+			FScopeLock _(&Lock);
+			bool bIsAlreadyRecorded = false;
+			RecordedChunkIds.Add(Request.ChunkId, &bIsAlreadyRecorded);
+			if (!bIsAlreadyRecorded)
+			{
+				ChunkIds.Add(Request.ChunkId);
+			}
+		}
+	}
+
+private:
+	void Save()
+	{
+		TickerHandle.Reset();
+		if (!bIsRecording.exchange(false))
+		{
+			return;
+		}
+
+		TArray<FString> Lines;
+		{
+			FScopeLock _(&Lock);
+			Lines.Reserve(ChunkIds.Num());
+			for (const FIoChunkId& ChunkId : ChunkIds)
+			{
+				Lines.Add(LexToString(ChunkId));
+			}
+			ChunkIds.Empty();
+			RecordedChunkIds.Empty();
+		}
+
+		const FString Filename = FPaths::ProjectSavedDir() / TEXT("IoRequestOrder") / FDateTime::Now().ToString() + TEXT(".iorequestorder");
+		if (FFileHelper::SaveStringArrayToFile(Lines, *Filename))
+		{
+			UE_LOG(LogIoDispatcher, Display, TEXT("Saved the order of %d requested chunks to '%s'"), Lines.Num(), *Filename);
+		}
+		else
+		{
+			UE_LOG(LogIoDispatcher, Warning, TEXT("Failed to save the IO request order to '%s'"), *Filename);
+		}
+	}
+
+	FCriticalSection Lock;
+	TArray<FIoChunkId> ChunkIds;
+	TSet<FIoChunkId> RecordedChunkIds;
+	FTSTicker::FDelegateHandle TickerHandle;
+	std::atomic<bool> bIsRecording{ false };
+};
+#else
+class FIoRequestOrderRecorder
+{
+public:
+	void OnRequestStarted(const FIoRequestImpl& Request) {}
+};
+#endif
+
 template <typename T, uint32 BlockSize = 128>
 class TBlockAllocator
 {
@@ -342,11 +459,16 @@ public:
 		{
 			RequestAllocator->Trim();
 			BatchAllocator.Trim();
+			DropPreloadedChunks();
 		});
 	}
 
 	~FIoDispatcherImpl()
 	{
+		if (PreloadTickerHandle.IsValid())
+		{
+			FTSTicker::GetCoreTicker().RemoveTicker(PreloadTickerHandle);
+		}
 		delete Thread;
 		FPlatformProcess::ReturnSynchEventToPool(DispatcherEvent);
 		RequestAllocator->ReleaseRef();
@@ -590,6 +712,58 @@ public:
 		return TotalLoaded;
 	}
 
+	void Preload(TConstArrayView<FIoChunkId> ChunkIds, uint64 MemoryBudget)
+	{
+		check(IsInGameThread());
+		if (Backends.IsEmpty() || ChunkIds.IsEmpty() || PreloadTickerHandle.IsValid())
+		{
+			return;
+		}
+
+		FIoBatch Batch(*this);
+		FIoBatchImpl* BatchImpl = AllocBatch();
+		uint64 TotalSize = 0;
+		{
+			FScopeLock _(&PreloadLock);
+			for (const FIoChunkId& ChunkId : ChunkIds)
+			{
+				TIoStatusOr<uint64> ChunkSize = GetSizeForChunk(ChunkId);
+				if (!ChunkSize.IsOk() || PreloadedChunks.Contains(ChunkId))
+				{
+					continue;
+				}
+				if (TotalSize + ChunkSize.ValueOrDie() > MemoryBudget)
+				{
+					break;
+				}
+				TotalSize += ChunkSize.ValueOrDie();
+				PreloadedChunks.Add(ChunkId);
+				Batch.ReadWithCallback(ChunkId, FIoReadOptions(), IoDispatcherPriority_Low, [this, ChunkId](TIoStatusOr<FIoBuffer> Result)
+				{
+					OnChunkPreloaded(ChunkId, MoveTemp(Result));
+				});
+			}
+			PreloadBatch = BatchImpl;
+			PreloadedChunksCount.store(PreloadedChunks.Num(), std::memory_order_relaxed);
+		}
+
+		UE_LOG(LogIoDispatcher, Display, TEXT("Preloading %d chunks (%.2f MiB)"), PreloadedChunksCount.load(std::memory_order_relaxed), double(TotalSize) / 1024.0 / 1024.0);
+		const double StartTime = FPlatformTime::Seconds();
+		BatchImpl->Callback = [this, StartTime]()
+		{
+			FScopeLock _(&PreloadLock);
+			PreloadBatch = nullptr;
+			UE_LOG(LogIoDispatcher, Verbose, TEXT("Preloaded %d chunks in %.2f seconds"), PreloadedChunks.Num(), FPlatformTime::Seconds() - StartTime);
+		};
+		PreloadTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this](float)
+		{
+			PreloadTickerHandle.Reset();
+			DropPreloadedChunks();
+			return false;
+		}), GIoDispatcherPreloadLifetimeSeconds);
+		IssueBatchInternal(Batch, BatchImpl);
+	}
+
 	bool HasMountedBackend() const
 	{
 		return Backends.Num() > 0;
@@ -605,6 +779,100 @@ private:
 		Thread = FRunnableThread::Create(this, TEXT("IoDispatcher"), 0, TPri_AboveNormal, FPlatformAffinity::GetIoDispatcherThreadMask());
 	}
 
+	struct FPreloadedChunk
+	{
+		FIoBuffer Buffer;
+		bool bIsReady = false;
+		bool bIsStale = false; // requested while it was being preloaded, dropped when the preload completes
+	};
+
+	void OnChunkPreloaded(const FIoChunkId& ChunkId, TIoStatusOr<FIoBuffer>&& Result)
+	{
+		FScopeLock _(&PreloadLock);
+		FPreloadedChunk* PreloadedChunk = PreloadedChunks.Find(ChunkId);
+		if (!PreloadedChunk)
+		{
+			return;
+		}
+		if (!Result.IsOk() || PreloadedChunk->bIsStale)
+		{
+			PreloadedChunks.Remove(ChunkId);
+			PreloadedChunksCount.store(PreloadedChunks.Num(), std::memory_order_relaxed);
+			return;
+		}
+		PreloadedChunk->Buffer = Result.ConsumeValueOrDie();
+		PreloadedChunk->bIsReady = true;
+	}
+
+	void DropPreloadedChunks()
+	{
+		FScopeLock _(&PreloadLock);
+		int32 DroppedCount = 0;
+		for (auto It = PreloadedChunks.CreateIterator(); It; ++It)
+		{
+			// chunks that are still being read are dropped when they complete
+			if (It->Value.bIsReady)
+			{
+				It.RemoveCurrent();
+				++DroppedCount;
+			}
+			else
+			{
+				It->Value.bIsStale = true;
+			}
+		}
+		PreloadedChunksCount.store(PreloadedChunks.Num(), std::memory_order_relaxed);
+		UE_CLOG(DroppedCount > 0, LogIoDispatcher, Verbose, TEXT("Dropped %d preloaded chunks that were not requested"), DroppedCount);
+	}
+
+	bool TryCompleteFromPreload(FIoRequestImpl* Request)
+	{
+		if (PreloadedChunksCount.load(std::memory_order_relaxed) == 0)
+		{
+			return false;
+		}
+
+		FIoBuffer Source;
+		const uint64 Offset = Request->Options.GetOffset();
+		{
+			FScopeLock _(&PreloadLock);
+			if (PreloadBatch && Request->Batch == PreloadBatch)
+			{
+				return false;
+			}
+			FPreloadedChunk* PreloadedChunk = PreloadedChunks.Find(Request->ChunkId);
+			if (!PreloadedChunk)
+			{
+				return false;
+			}
+			if (!PreloadedChunk->bIsReady)
+			{
+				// the backend merges this request with the pending read
+				PreloadedChunk->bIsStale = true;
+				return false;
+			}
+			Source = PreloadedChunk->Buffer;
+			if (Offset >= Source.DataSize())
+			{
+				return false;
+			}
+			if (Offset == 0 && Request->Options.GetSize() >= Source.DataSize())
+			{
+				PreloadedChunks.Remove(Request->ChunkId);
+				PreloadedChunksCount.store(PreloadedChunks.Num(), std::memory_order_relaxed);
+			}
+		}
+
+		TRACE_CPUPROFILER_EVENT_SCOPE(CompleteFromPreload);
+		const uint64 Size = FMath::Min(Request->Options.GetSize(), Source.DataSize() - Offset);
+		Request->CreateBuffer(Size);
+		FMemory::Memcpy(Request->GetBuffer().Data(), Source.Data() + Offset, Size);
+		FPlatformAtomics::InterlockedAdd(&TotalLoaded, Size);
+		CompleteRequest(Request, EIoErrorCode::Ok);
+		Request->ReleaseRef();
+		return true;
+	}
+
 	void ProcessCompletedRequests()
 	{
 		//TRACE_CPUPROFILER_EVENT_SCOPE(ProcessCompletedRequests);
@@ -756,6 +1024,7 @@ private:
 			}
 
 			RequestStats.OnRequestStarted(*Request);
+			RequestOrderRecorder.OnRequestStarted(*Request);
 			if (Request->bCancelled)
 			{
 				CompleteRequest(Request, EIoErrorCode::Cancelled);
@@ -766,6 +1035,11 @@ private:
 			// Make sure that the FIoChunkId in the request is valid before we try to do anything with it.
 			if (Request->ChunkId.IsValid())
 			{
+				if (TryCompleteFromPreload(Request))
+				{
+					continue;
+				}
+
 				TRACE_CPUPROFILER_EVENT_SCOPE(ResolveRequest);
 				bool bResolved = false;
 				for (const TSharedRef<IIoDispatcherBackend>& Backend : Backends)
@@ -847,6 +1121,12 @@ private:
 	uint64 PendingIoRequestsCount = 0;
 	int64 TotalLoaded = 0;
 	FIoRequestStats RequestStats;
+	FIoRequestOrderRecorder RequestOrderRecorder;
+	FCriticalSection PreloadLock;
+	TMap<FIoChunkId, FPreloadedChunk> PreloadedChunks;
+	std::atomic<int32> PreloadedChunksCount{ 0 };
+	FIoBatchImpl* PreloadBatch = nullptr;
+	FTSTicker::FDelegateHandle PreloadTickerHandle;
 	bool bIsInitialized = false;
 };
 
@@ -897,6 +1177,12 @@ FIoDispatcher::GetTotalLoaded() const
 	return Impl->GetTotalLoaded();
 }
 
+void
+FIoDispatcher::Preload(TConstArrayView<FIoChunkId> ChunkIds, uint64 MemoryBudget)
+{
+	Impl->Preload(ChunkIds, MemoryBudget);
+}
+
 FIoSignatureErrorDelegate&
 FIoDispatcher::OnSignatureError()
 {
@@ -938,6 +1224,29 @@ FIoDispatcher::InitializePostSettings()
 	LLM_SCOPE(ELLMTag::FileSystem);
 	check(GIoDispatcher);
 	GIoDispatcher->Impl->Initialize();
+
+	const FIoChunkId PreloadManifestChunkId = CreatePreloadManifestChunkId();
+	if (GIoDispatcherPreloadMemoryMB > 0 && !FParse::Param(FCommandLine::Get(), TEXT("RecordIoRequestOrder")) && GIoDispatcher->DoesChunkExist(PreloadManifestChunkId))
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(LoadPreloadManifest);
+		FIoBatch Batch = GIoDispatcher->NewBatch();
+		FIoRequest Request = Batch.Read(PreloadManifestChunkId, FIoReadOptions(), IoDispatcherPriority_High);
+		FEvent* Event = FPlatformProcess::GetSynchEventFromPool();
+		Batch.IssueAndTriggerEvent(Event);
+		Event->Wait();
+		FPlatformProcess::ReturnSynchEventToPool(Event);
+
+		FIoPreloadManifest Manifest;
+		const FIoBuffer* Result = Request.GetResult();
+		if (Result && Manifest.Load(*Result))
+		{
+			GIoDispatcher->Preload(Manifest.ChunkIds, uint64(GIoDispatcherPreloadMemoryMB) << 20);
+		}
+		else
+		{
+			UE_LOG(LogIoDispatcher, Warning, TEXT("Failed to load the preload manifest"));
+		}
+	}
 }
 
 void
@@ -1255,3 +1564,87 @@ FIoChunkId CreateExternalFileChunkId(const FStringView Filename)
 
 	return ChunkId;
 }
+
+FIoChunkId CreatePreloadManifestChunkId()
+{
+	return CreateExternalFileChunkId(TEXT("IoDispatcherPreloadManifest"));
+}
+
+static constexpr uint32 PreloadManifestMagic = 0x494F504D; // 'IOPM'
+static constexpr uint32 PreloadManifestVersion = 1;
+
+FIoBuffer FIoPreloadManifest::Save() const
+{
+	TArray<uint8> Data;
+	FMemoryWriter Ar(Data);
+	uint32 Magic = PreloadManifestMagic;
+	uint32 Version = PreloadManifestVersion;
+	int32 ChunkCount = ChunkIds.Num();
+	Ar << Magic;
+	Ar << Version;
+	Ar << ChunkCount;
+	for (FIoChunkId ChunkId : ChunkIds)
+	{
+		Ar << ChunkId;
+	}
+	return FIoBuffer(FIoBuffer::Clone, Data.GetData(), Data.Num());
+}
+
+bool FIoPreloadManifest::Load(const FIoBuffer& Buffer)
+{
+	FLargeMemoryReader Ar(Buffer.Data(), Buffer.DataSize());
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	int32 ChunkCount = 0;
+	Ar << Magic;
+	Ar << Version;
+	Ar << ChunkCount;
+	if (Ar.IsError() || Magic != PreloadManifestMagic || Version != PreloadManifestVersion || ChunkCount < 0 || uint64(ChunkCount) * sizeof(FIoChunkId) > Buffer.DataSize())
+	{
+		return false;
+	}
+	ChunkIds.SetNum(ChunkCount);
+	for (FIoChunkId& ChunkId : ChunkIds)
+	{
+		Ar << ChunkId;
+	}
+	if (Ar.IsError())
+	{
+		ChunkIds.Empty();
+		return false;
+	}
+	return true;
+}
+
+bool FIoPreloadManifest::LoadRecording(const TCHAR* Filename)
+{
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, Filename))
+	{
+		return false;
+	}
+
+	TSet<FIoChunkId> ExistingChunkIds(ChunkIds);
+	for (FString& Line : Lines)
+	{
+		Line.TrimStartAndEndInline();
+		if (Line.Len() != sizeof(FIoChunkId) * 2)
+		{
+			continue;
+		}
+		uint8 Id[sizeof(FIoChunkId)];
+		if (UE::String::HexToBytes(Line, Id) != sizeof(Id))
+		{
+			continue;
+		}
+		FIoChunkId ChunkId;
+		ChunkId.Set(Id, sizeof(Id));
+		bool bIsAlreadyInManifest = false;
+		ExistingChunkIds.Add(ChunkId, &bIsAlreadyInManifest);
+		if (!bIsAlreadyInManifest)
+		{
+			ChunkIds.Add(ChunkId);
+		}
+	}
+	return true;
+}
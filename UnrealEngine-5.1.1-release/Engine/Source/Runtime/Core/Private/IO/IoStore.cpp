@@ -795,6 +795,33 @@ public:
 		LayoutEntriesTail->Prev = PrevEntryLink;
 	}
 
+	virtual void EnableChunkDeduplication(const TArray<TUniquePtr<FIoStoreReader>>& SourceReaders) override
+	{
+		check(!Entries.Num());
+		if (ContainerSettings.IsSigned())
+		{
+			// The referenced chunks are not covered by the block signatures
+			UE_LOG(LogIoStore, Warning, TEXT("Chunk deduplication is not supported for signed container '%s'"), *ContainerPath);
+			return;
+		}
+
+		for (const TUniquePtr<FIoStoreReader>& SourceReader : SourceReaders)
+		{
+			const FIoContainerId SourceContainerId = SourceReader->GetContainerId();
+			SourceReader->EnumerateChunks([this, SourceContainerId](const FIoStoreTocChunkInfo& ChunkInfo)
+				{
+					if (!SourceChunksByHash.Contains(ChunkInfo.Hash))
+					{
+						FSourceChunk& SourceChunk = SourceChunksByHash.Add(ChunkInfo.Hash);
+						SourceChunk.ContainerId = SourceContainerId;
+						SourceChunk.ChunkId = ChunkInfo.Id;
+						SourceChunk.Size = ChunkInfo.Size;
+					}
+					return true;
+				});
+		}
+	}
+
 	virtual void Append(const FIoChunkId& ChunkId, IIoStoreWriteRequest* Request, const FIoWriteOptions& WriteOptions) override
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(AppendWriteRequest);
@@ -1193,6 +1220,8 @@ public:
 		Result.AddedChunksCount = 0;
 		Result.ModifiedChunksSize= 0;
 		Result.AddedChunksSize = 0;
+		Result.ReferencedChunksCount = ReferencedChunksCount;
+		Result.ReferencedChunksSize = ReferencedChunksSize;
 		{
 			TRACE_CPUPROFILER_EVENT_SCOPE(Cleanup);
 			for (FIoStoreWriteQueueEntry* Entry : Entries)
@@ -1246,6 +1275,38 @@ private:
 		int32 PartitionIndex = -1;
 	};
 
+	struct FSourceChunk
+	{
+		FIoContainerId ContainerId;
+		FIoChunkId ChunkId;
+		uint64 Size = 0;
+	};
+
+	void DeduplicateChunks()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(DeduplicateChunks);
+		FIoStoreTocResource& TocResource = Toc.GetTocResource();
+		Entries.RemoveAll([this, &TocResource](FIoStoreWriteQueueEntry* Entry)
+			{
+				// Memory mapped chunks have to be in the container that maps them
+				const FSourceChunk* SourceChunk = Entry->Options.bIsMemoryMapped ? nullptr : SourceChunksByHash.Find(Entry->ChunkHash);
+				if (!SourceChunk)
+				{
+					return false;
+				}
+				FIoStoreTocReferencedChunk& ReferencedChunk = TocResource.ReferencedChunks.AddDefaulted_GetRef();
+				ReferencedChunk.ChunkId = Entry->ChunkId;
+				ReferencedChunk.SourceChunkId = SourceChunk->ChunkId;
+				ReferencedChunk.SourceContainerId = SourceChunk->ContainerId;
+				++ReferencedChunksCount;
+				ReferencedChunksSize += SourceChunk->Size;
+				WriterContext->TotalChunksCount.DecrementExchange();
+				delete Entry->Request;
+				delete Entry;
+				return true;
+			});
+	}
+
 	void FinalizeLayout()
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FinalizeLayout);
@@ -1806,6 +1867,7 @@ private:
 	FLayoutEntry*				LayoutEntriesHead = nullptr;
 	FLayoutEntry*				LayoutEntriesTail = nullptr;
 	TMap<FIoChunkId, FLayoutEntry*> PreviousBuildLayoutEntryByChunkId;
+	TMap<FIoChunkHash, FSourceChunk> SourceChunksByHash;
 	TUniquePtr<FArchive>		CsvArchive;
 	FIoStoreWriterResult		Result;
 	uint64						UncompressedFileOffset = 0;
@@ -1813,6 +1875,8 @@ private:
 	uint64						TotalPaddingSize = 0;
 	uint64						UncompressedContainerSize = 0;
 	uint64						CompressedContainerSize = 0;
+	uint64						ReferencedChunksCount = 0;
+	uint64						ReferencedChunksSize = 0;
 	int32						CurrentPartitionIndex = 0;
 	bool						bHasMemoryMappedEntry = false;
 	bool						bHasFlushed = false;
@@ -1849,6 +1913,10 @@ void FIoStoreWriterContextImpl::Flush()
 	}
 	for (TSharedPtr<FIoStoreWriter> IoStoreWriter : IoStoreWriters)
 	{
+		if (IoStoreWriter->SourceChunksByHash.Num())
+		{
+			IoStoreWriter->DeduplicateChunks();
+		}
 		if (IoStoreWriter->LayoutEntriesHead)
 		{
 			IoStoreWriter->FinalizeLayout();
@@ -2862,6 +2930,14 @@ FIoStatus FIoStoreTocResource::Read(const TCHAR* TocFilePath, EIoStoreTocReadOpt
 	}
 	DataPtr += Header.CompressionMethodNameCount * Header.CompressionMethodNameLength;
 
+	// Referenced chunks
+	if (Header.Version >= static_cast<uint8>(EIoStoreTocVersion::ReferencedChunks) && Header.TocReferencedChunkCount)
+	{
+		const FIoStoreTocReferencedChunk* ReferencedChunks = reinterpret_cast<const FIoStoreTocReferencedChunk*>(DataPtr);
+		OutTocResource.ReferencedChunks = MakeArrayView<FIoStoreTocReferencedChunk const>(ReferencedChunks, Header.TocReferencedChunkCount);
+		DataPtr += Header.TocReferencedChunkCount * sizeof(FIoStoreTocReferencedChunk);
+	}
+
 	// Chunk block signatures
 	const uint8* SignatureBuffer = reinterpret_cast<const uint8*>(DataPtr);
 	const uint8* DirectoryIndexBuffer = SignatureBuffer;
@@ -2964,6 +3040,7 @@ TIoStatusOr<uint64> FIoStoreTocResource::Write(
 	TocHeader.CompressionBlockSize = uint32(WriterSettings.CompressionBlockSize);
 	TocHeader.CompressionMethodNameCount = TocResource.CompressionMethods.Num();
 	TocHeader.CompressionMethodNameLength = FIoStoreTocResource::CompressionMethodNameLen;
+	TocHeader.TocReferencedChunkCount = TocResource.ReferencedChunks.Num();
 	TocHeader.DirectoryIndexSize = TocResource.DirectoryIndexBuffer.Num();
 	TocHeader.ContainerId = ContainerSettings.ContainerId;
 	TocHeader.EncryptionKeyGuid = ContainerSettings.EncryptionKeyGuid;
@@ -3037,6 +3114,12 @@ TIoStatusOr<uint64> FIoStoreTocResource::Write(
 		}
 	}
 
+	// Referenced chunks
+	if (!WriteArray(TocFileHandle.Get(), TocResource.ReferencedChunks))
+	{
+		return FIoStatus(EIoErrorCode::WriteError, TEXT("Failed to write referenced chunks"));
+	}
+
 	// Chunk block signatures
 	if (EnumHasAnyFlags(TocHeader.ContainerFlags, EIoContainerFlags::Signed))
 	{
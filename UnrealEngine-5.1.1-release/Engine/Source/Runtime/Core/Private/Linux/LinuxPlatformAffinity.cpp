@@ -0,0 +1,114 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Linux/LinuxPlatformAffinity.h"
+
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+namespace UE::LinuxPlatformAffinity::Private
+{
+	// enough for any machine the task scheduler distinguishes nodes on
+	static constexpr uint32 MaxNumaNodes = 64;
+
+	struct FNumaTopology
+	{
+		uint32 NumNodes = 1;
+		uint64 NodeMasks[MaxNumaNodes] = {};
+
+		FNumaTopology()
+		{
+			uint32 NumFound = 0;
+			for (uint32 NodeIndex = 0; NodeIndex < MaxNumaNodes; ++NodeIndex)
+			{
+				char Path[64];
+				snprintf(Path, sizeof(Path), "/sys/devices/system/node/node%u/cpulist", NodeIndex);
+				FILE* File = fopen(Path, "r");
+				if (File == nullptr)
+				{
+					break;
+				}
+
+				// cpulist is a comma separated list of ranges, e.g. "0-7,16-23"
+				char Buffer[1024] = {};
+				const size_t BytesRead = fread(Buffer, 1, sizeof(Buffer) - 1, File);
+				fclose(File);
+				Buffer[BytesRead] = 0;
+
+				uint64 Mask = 0;
+				for (const char* Cursor = Buffer; *Cursor != 0 && *Cursor != '\n';)
+				{
+					char* End = nullptr;
+					const unsigned long First = strtoul(Cursor, &End, 10);
+					if (End == Cursor)
+					{
+						break;
+					}
+					unsigned long Last = First;
+					Cursor = End;
+					if (*Cursor == '-')
+					{
+						Last = strtoul(Cursor + 1, &End, 10);
+						Cursor = End;
+					}
+					for (unsigned long Cpu = First; Cpu <= Last && Cpu < 64; ++Cpu)
+					{
+						Mask |= uint64(1) << Cpu;
+					}
+					if (*Cursor == ',')
+					{
+						++Cursor;
+					}
+				}
+
+				NodeMasks[NodeIndex] = Mask;
+				++NumFound;
+			}
+
+			NumNodes = NumFound > 0 ? NumFound : 1;
+		}
+	};
+
+	static const FNumaTopology& GetNumaTopology()
+	{
+		static const FNumaTopology Topology;
+		return Topology;
+	}
+}
+
+uint32 FLinuxPlatformAffinity::GetNumNumaNodes()
+{
+	return UE::LinuxPlatformAffinity::Private::GetNumaTopology().NumNodes;
+}
+
+uint64 FLinuxPlatformAffinity::GetNumaNodeMask(uint32 NodeIndex, uint16& OutProcessorGroup)
+{
+	using namespace UE::LinuxPlatformAffinity::Private;
+
+	const FNumaTopology& Topology = GetNumaTopology();
+	if (Topology.NumNodes > 1 && NodeIndex < Topology.NumNodes && Topology.NodeMasks[NodeIndex] != 0)
+	{
+		OutProcessorGroup = 0;
+		return Topology.NodeMasks[NodeIndex];
+	}
+	return FGenericPlatformAffinity::GetNumaNodeMask(NodeIndex, OutProcessorGroup);
+}
+
+uint32 FLinuxPlatformAffinity::GetCurrentNumaNode()
+{
+	using namespace UE::LinuxPlatformAffinity::Private;
+
+	const FNumaTopology& Topology = GetNumaTopology();
+	const int Cpu = sched_getcpu();
+	if (Topology.NumNodes > 1 && Cpu >= 0 && Cpu < 64)
+	{
+		for (uint32 NodeIndex = 0; NodeIndex < Topology.NumNodes; ++NodeIndex)
+		{
+			if (Topology.NodeMasks[NodeIndex] & (uint64(1) << Cpu))
+			{
+				return NodeIndex;
+			}
+		}
+	}
+	return 0;
+}
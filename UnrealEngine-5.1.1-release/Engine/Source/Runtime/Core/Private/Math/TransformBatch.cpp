@@ -0,0 +1,161 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Math/TransformBatch.h"
+#include "Math/Box.h"
+#include "Math/Transform.h"
+#include "Math/VectorRegister.h"
+#include "Misc/AssertionMacros.h"
+
+namespace UE
+{
+namespace Math
+{
+namespace TransformBatchPrivate
+{
+
+template<typename T>
+FORCEINLINE void TransformPositions(const TTransform<T>& Transform, const TVector<T>* Positions, TVector<T>* OutPositions, int32 Num)
+{
+	Transform.DiagnosticCheckNaN_All();
+
+	const TQuat<T> Quat = Transform.GetRotation();
+	const TVector<T> Translation = Transform.GetTranslation();
+	const TVector<T> Scale = Transform.GetScale3D();
+
+	const TVectorRegisterType<T> RotationReg = VectorLoadAligned(&Quat);
+	const TVectorRegisterType<T> TranslationReg = VectorLoadFloat3_W0(&Translation);
+	const TVectorRegisterType<T> ScaleReg = VectorLoadFloat3_W0(&Scale);
+
+	// QST(P) = Q.Rotate(S*P) + T, same as TTransform<T>::TransformPosition
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		const TVectorRegisterType<T> Position = VectorLoadFloat3_W0(Positions + Index);
+		const TVectorRegisterType<T> Scaled = VectorMultiply(ScaleReg, Position);
+		const TVectorRegisterType<T> Rotated = VectorQuaternionRotateVector(RotationReg, Scaled);
+		VectorStoreFloat3(VectorAdd(Rotated, TranslationReg), OutPositions + Index);
+	}
+}
+
+template<typename T>
+FORCEINLINE void ComposeTransforms(const TTransform<T>* Transforms, const TTransform<T>* ParentTransforms, TTransform<T>* OutTransforms, int32 Num)
+{
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		TTransform<T>::Multiply(OutTransforms + Index, Transforms + Index, ParentTransforms + Index);
+	}
+}
+
+template<typename T>
+FORCEINLINE void ComposeTransforms(const TTransform<T>* Transforms, const TTransform<T>& ParentTransform, TTransform<T>* OutTransforms, int32 Num)
+{
+	// Multiply is inlined, so loads of the parent are hoisted out of the loop
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		TTransform<T>::Multiply(OutTransforms + Index, Transforms + Index, &ParentTransform);
+	}
+}
+
+template<typename T>
+FORCEINLINE void InverseTransforms(const TTransform<T>* Transforms, TTransform<T>* OutTransforms, int32 Num)
+{
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		OutTransforms[Index] = Transforms[Index].Inverse();
+	}
+}
+
+template<typename T>
+FORCEINLINE TBox<T> ComputeBounds(const TVector<T>* Points, int32 Num)
+{
+	if (Num == 0)
+	{
+		return TBox<T>(ForceInit);
+	}
+
+	TVectorRegisterType<T> MinReg = VectorLoadFloat3_W0(Points);
+	TVectorRegisterType<T> MaxReg = MinReg;
+	for (int32 Index = 1; Index < Num; ++Index)
+	{
+		const TVectorRegisterType<T> Point = VectorLoadFloat3_W0(Points + Index);
+		MinReg = VectorMin(MinReg, Point);
+		MaxReg = VectorMax(MaxReg, Point);
+	}
+
+	TVector<T> Min, Max;
+	VectorStoreFloat3(MinReg, &Min);
+	VectorStoreFloat3(MaxReg, &Max);
+	return TBox<T>(Min, Max);
+}
+
+} // namespace TransformBatchPrivate
+
+void TransformPositions(const FTransform3f& Transform, TArrayView<const FVector3f> Positions, TArrayView<FVector3f> OutPositions)
+{
+	check(Positions.Num() == OutPositions.Num());
+	TransformBatchPrivate::TransformPositions(Transform, Positions.GetData(), OutPositions.GetData(), Positions.Num());
+}
+
+void TransformPositions(const FTransform3d& Transform, TArrayView<const FVector3d> Positions, TArrayView<FVector3d> OutPositions)
+{
+	check(Positions.Num() == OutPositions.Num());
+	TransformBatchPrivate::TransformPositions(Transform, Positions.GetData(), OutPositions.GetData(), Positions.Num());
+}
+
+void TransformPositions(const FTransform3f& Transform, TArrayView<FVector3f> Positions)
+{
+	TransformBatchPrivate::TransformPositions(Transform, Positions.GetData(), Positions.GetData(), Positions.Num());
+}
+
+void TransformPositions(const FTransform3d& Transform, TArrayView<FVector3d> Positions)
+{
+	TransformBatchPrivate::TransformPositions(Transform, Positions.GetData(), Positions.GetData(), Positions.Num());
+}
+
+void ComposeTransforms(TArrayView<const FTransform3f> Transforms, TArrayView<const FTransform3f> ParentTransforms, TArrayView<FTransform3f> OutTransforms)
+{
+	check(Transforms.Num() == ParentTransforms.Num() && Transforms.Num() == OutTransforms.Num());
+	TransformBatchPrivate::ComposeTransforms(Transforms.GetData(), ParentTransforms.GetData(), OutTransforms.GetData(), Transforms.Num());
+}
+
+void ComposeTransforms(TArrayView<const FTransform3d> Transforms, TArrayView<const FTransform3d> ParentTransforms, TArrayView<FTransform3d> OutTransforms)
+{
+	check(Transforms.Num() == ParentTransforms.Num() && Transforms.Num() == OutTransforms.Num());
+	TransformBatchPrivate::ComposeTransforms(Transforms.GetData(), ParentTransforms.GetData(), OutTransforms.GetData(), Transforms.Num());
+}
+
+void ComposeTransforms(TArrayView<const FTransform3f> Transforms, const FTransform3f& ParentTransform, TArrayView<FTransform3f> OutTransforms)
+{
+	check(Transforms.Num() == OutTransforms.Num());
+	TransformBatchPrivate::ComposeTransforms(Transforms.GetData(), ParentTransform, OutTransforms.GetData(), Transforms.Num());
+}
+
+void ComposeTransforms(TArrayView<const FTransform3d> Transforms, const FTransform3d& ParentTransform, TArrayView<FTransform3d> OutTransforms)
+{
+	check(Transforms.Num() == OutTransforms.Num());
+	TransformBatchPrivate::ComposeTransforms(Transforms.GetData(), ParentTransform, OutTransforms.GetData(), Transforms.Num());
+}
+
+void InverseTransforms(TArrayView<const FTransform3f> Transforms, TArrayView<FTransform3f> OutTransforms)
+{
+	check(Transforms.Num() == OutTransforms.Num());
+	TransformBatchPrivate::InverseTransforms(Transforms.GetData(), OutTransforms.GetData(), Transforms.Num());
+}
+
+void InverseTransforms(TArrayView<const FTransform3d> Transforms, TArrayView<FTransform3d> OutTransforms)
+{
+	check(Transforms.Num() == OutTransforms.Num());
+	TransformBatchPrivate::InverseTransforms(Transforms.GetData(), OutTransforms.GetData(), Transforms.Num());
+}
+
+FBox3f ComputeBounds(TArrayView<const FVector3f> Points)
+{
+	return TransformBatchPrivate::ComputeBounds(Points.GetData(), Points.Num());
+}
+
+FBox3d ComputeBounds(TArrayView<const FVector3d> Points)
+{
+	return TransformBatchPrivate::ComputeBounds(Points.GetData(), Points.Num());
+}
+
+} // namespace Math
+} // namespace UE
@@ -11,11 +11,19 @@
 #include "Misc/MemStack.h"
 #include "Misc/Crc.h"
 #include "UObject/NameTypes.h"
+#include "HAL/IConsoleManager.h"
 
 #if CPUPROFILERTRACE_ENABLED
 
 UE_TRACE_CHANNEL_DEFINE(CpuChannel)
 
+static int32 GCpuScopeSampling = 1;
+static FAutoConsoleVariableRef CVarCpuScopeSampling(
+	TEXT("Trace.CpuScopeSampling"),
+	GCpuScopeSampling,
+	TEXT("Records one in N top level cpu scopes of each thread, along with all the scopes nested in it, to lower the overhead and bandwidth of always on tracing. 1 records every scope."),
+	ECVF_Default);
+
 UE_TRACE_EVENT_BEGIN(CpuProfiler, EventSpec, NoSync|Important)
 	UE_TRACE_EVENT_FIELD(uint32, Id)
 	UE_TRACE_EVENT_FIELD(UE::Trace::AnsiString, Name)
@@ -105,19 +113,41 @@ struct FCpuProfilerTraceInternal
 	FORCENOINLINE static void FlushThreadBuffer(FThreadBuffer* ThreadBuffer);
 	FORCENOINLINE static void EndCapture(FThreadBuffer* ThreadBuffer);
 
+	/** Whether a begin event isn't recorded because of Trace.CpuScopeSampling, in which case its end event isn't either */
+	FORCEINLINE static bool SampleOutBeginEvent()
+	{
+		if (SampledOutDepth != 0)
+		{
+			++SampledOutDepth;
+			return true;
+		}
+		if (ThreadDepth == 0 && GCpuScopeSampling > 1 && (++TopLevelScopeCount % uint32(GCpuScopeSampling)) != 0)
+		{
+			SampledOutDepth = 1;
+			return true;
+		}
+		return false;
+	}
+
 	struct FSuspendScopes
 	{
 		uint32* TimerScopeDepth;
 		uint32 SavedThreadDepth;
+		uint32 SavedSampledOutDepth;
 	};
 	static thread_local TArray<FSuspendScopes, TInlineAllocator<3>> NestedTimerScopeDepths;
 	static thread_local FThreadBuffer* ThreadBuffer;
 	static thread_local uint32 ThreadDepth;
+	/** Depth of the scopes not being recorded, counted from the top level scope that was sampled out */
+	static thread_local uint32 SampledOutDepth;
+	static thread_local uint32 TopLevelScopeCount;
 };
 
 thread_local TArray<FCpuProfilerTraceInternal::FSuspendScopes, TInlineAllocator<3>> FCpuProfilerTraceInternal::NestedTimerScopeDepths;
 thread_local FCpuProfilerTraceInternal::FThreadBuffer* FCpuProfilerTraceInternal::ThreadBuffer = nullptr;
 thread_local uint32 FCpuProfilerTraceInternal::ThreadDepth = 0;
+thread_local uint32 FCpuProfilerTraceInternal::SampledOutDepth = 0;
+thread_local uint32 FCpuProfilerTraceInternal::TopLevelScopeCount = 0;
 
 FCpuProfilerTraceInternal::FThreadBuffer* FCpuProfilerTraceInternal::CreateThreadBuffer()
 {
@@ -144,6 +174,10 @@ void FCpuProfilerTraceInternal::EndCapture(FThreadBuffer* InThreadBuffer)
 }
 
 #define CPUPROFILERTRACE_OUTPUTBEGINEVENT_PROLOGUE() \
+	if (FCpuProfilerTraceInternal::SampleOutBeginEvent()) \
+	{ \
+		return; \
+	} \
 	++FCpuProfilerTraceInternal::ThreadDepth; \
 	FCpuProfilerTraceInternal::FThreadBuffer* ThreadBuffer = FCpuProfilerTraceInternal::ThreadBuffer; \
 	if (!ThreadBuffer) \
@@ -229,8 +263,10 @@ void FCpuProfilerTrace::OutputBeginDynamicEvent(const FName& Name, const ANSICHA
 
 void FCpuProfilerTrace::OutputResumeEvent(uint64 SpecId, uint32& TimerScopeDepth)
 {
-	FCpuProfilerTraceInternal::NestedTimerScopeDepths.Push({&TimerScopeDepth, FCpuProfilerTraceInternal::ThreadDepth});
+	// The resumed scopes are always recorded, as they were when suspended
+	FCpuProfilerTraceInternal::NestedTimerScopeDepths.Push({&TimerScopeDepth, FCpuProfilerTraceInternal::ThreadDepth, FCpuProfilerTraceInternal::SampledOutDepth});
 	FCpuProfilerTraceInternal::ThreadDepth = FCpuProfilerTraceInternal::ThreadDepth + TimerScopeDepth;
+	FCpuProfilerTraceInternal::SampledOutDepth = 0;
 
 	FCpuProfilerTraceInternal::FThreadBuffer* ThreadBuffer = FCpuProfilerTraceInternal::ThreadBuffer;
 	if (!ThreadBuffer)
@@ -253,9 +289,10 @@ void FCpuProfilerTrace::OutputResumeEvent(uint64 SpecId, uint32& TimerScopeDepth
 
 void FCpuProfilerTrace::OutputSuspendEvent()
 {
-	auto [TimerScopeDepth, SavedThreadDepth] = FCpuProfilerTraceInternal::NestedTimerScopeDepths.Pop();
+	auto [TimerScopeDepth, SavedThreadDepth, SavedSampledOutDepth] = FCpuProfilerTraceInternal::NestedTimerScopeDepths.Pop();
 	*TimerScopeDepth = FCpuProfilerTraceInternal::ThreadDepth - SavedThreadDepth;
 	FCpuProfilerTraceInternal::ThreadDepth = SavedThreadDepth;
+	FCpuProfilerTraceInternal::SampledOutDepth = SavedSampledOutDepth;
 
 	FCpuProfilerTraceInternal::FThreadBuffer* ThreadBuffer = FCpuProfilerTraceInternal::ThreadBuffer;
 	if (!ThreadBuffer)
@@ -280,6 +317,12 @@ void FCpuProfilerTrace::OutputSuspendEvent()
 
 void FCpuProfilerTrace::OutputEndEvent()
 {
+	if (FCpuProfilerTraceInternal::SampledOutDepth != 0)
+	{
+		--FCpuProfilerTraceInternal::SampledOutDepth;
+		return;
+	}
+
 	--FCpuProfilerTraceInternal::ThreadDepth;
 	FCpuProfilerTraceInternal::FThreadBuffer* ThreadBuffer = FCpuProfilerTraceInternal::ThreadBuffer;
 	if (!ThreadBuffer)
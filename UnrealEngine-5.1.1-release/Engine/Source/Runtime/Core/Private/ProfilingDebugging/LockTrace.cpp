@@ -0,0 +1,94 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ProfilingDebugging/LockTrace.h"
+
+#if LOCKTRACE_ENABLED
+
+#include "HAL/PlatformTime.h"
+#include "ProfilingDebugging/CallstackTrace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.inl"
+
+UE_TRACE_CHANNEL(LockChannel)
+
+UE_TRACE_EVENT_BEGIN(Lock, Wait)
+	UE_TRACE_EVENT_FIELD(uint64, StartCycle)
+	UE_TRACE_EVENT_FIELD(uint64, EndCycle)
+	UE_TRACE_EVENT_FIELD(const void*, Lock)
+	UE_TRACE_EVENT_FIELD(uint32, CallstackId)
+	UE_TRACE_EVENT_FIELD(uint8, Type)
+UE_TRACE_EVENT_END()
+
+namespace LockTraceImpl
+{
+	// tracing can wait for locks itself, e.g. allocating the buffer of a new thread
+	static thread_local bool bIsTracing = false;
+
+#if CPUPROFILERTRACE_ENABLED
+	static uint32 GetWaitSpecId(ELockTraceType Type)
+	{
+		static const uint32 SpecIds[] =
+		{
+			FCpuProfilerTrace::OutputEventType("LockWait::CriticalSection"),
+			FCpuProfilerTrace::OutputEventType("LockWait::ReadLock"),
+			FCpuProfilerTrace::OutputEventType("LockWait::WriteLock"),
+			FCpuProfilerTrace::OutputEventType("LockWait::SpinLock"),
+			FCpuProfilerTrace::OutputEventType("LockWait::Event"),
+		};
+		return SpecIds[uint8(Type)];
+	}
+#endif
+}
+
+uint64 FLockTrace::BeginWait(const void* Lock, ELockTraceType Type, bool& bOutCpuEvent)
+{
+	using namespace LockTraceImpl;
+
+	if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(LockChannel) || bIsTracing)
+	{
+		return 0;
+	}
+
+	bIsTracing = true;
+#if CPUPROFILERTRACE_ENABLED
+	bOutCpuEvent = UE_TRACE_CHANNELEXPR_IS_ENABLED(CpuChannel);
+	if (bOutCpuEvent)
+	{
+		FCpuProfilerTrace::OutputBeginEvent(GetWaitSpecId(Type));
+	}
+#endif
+	bIsTracing = false;
+
+	return FPlatformTime::Cycles64();
+}
+
+void FLockTrace::EndWait(const void* Lock, ELockTraceType Type, uint64 StartCycle, bool bCpuEvent)
+{
+	using namespace LockTraceImpl;
+
+	const uint64 EndCycle = FPlatformTime::Cycles64();
+
+	bIsTracing = true;
+#if CPUPROFILERTRACE_ENABLED
+	if (bCpuEvent)
+	{
+		FCpuProfilerTrace::OutputEndEvent();
+	}
+#endif
+
+#if UE_CALLSTACK_TRACE_ENABLED
+	const uint32 CallstackId = CallstackTrace_GetCurrentId();
+#else
+	const uint32 CallstackId = 0;
+#endif
+
+	UE_TRACE_LOG(Lock, Wait, LockChannel)
+		<< Wait.StartCycle(StartCycle)
+		<< Wait.EndCycle(EndCycle)
+		<< Wait.Lock(Lock)
+		<< Wait.CallstackId(CallstackId)
+		<< Wait.Type(uint8(Type));
+	bIsTracing = false;
+}
+
+#endif // LOCKTRACE_ENABLED
@@ -0,0 +1,258 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ProfilingDebugging/PlatformEvents.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformStackWalk.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformTLS.h"
+#include "Logging/LogMacros.h"
+#include "Trace/Trace.h"
+
+#if PLATFORM_SUPPORTS_PLATFORM_EVENTS
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <atomic>
+
+/////////////////////////////////////////////////////////////////////
+
+DEFINE_LOG_CATEGORY_STATIC(LogPlatformEvents, Log, All);
+
+/////////////////////////////////////////////////////////////////////
+
+namespace {
+
+// Samples the callstacks of the running threads of the process at a fixed interval, from a background thread. Each thread is interrupted
+// with the signal FPlatformStackWalk::CaptureThreadStackBackTrace uses, and its callstack is traced with the same event as the ETW stack
+// samples on Windows, so addresses are resolved offline from the modules traced by CallstackTrace. Context switches aren't supported.
+class FPlatformEvents : public FRunnable
+{
+public:
+	FPlatformEvents(uint32 SamplingIntervalUsec);
+	~FPlatformEvents();
+
+	void Enable(EPlatformEvent Event);
+	void Disable(EPlatformEvent Event);
+
+private:
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+	void SampleThreads();
+	static bool IsThreadRunning(const char* ThreadIdString);
+
+	// matches the maximum depth of ETW stack walks
+	static constexpr uint32 MaxStackDepth = 192;
+
+	FRunnableThread* Thread = nullptr;
+	uint32 SamplingIntervalUsec;
+	uint32 SamplerThreadId = 0;
+	std::atomic<bool> bStopping { false };
+	bool bContextSwitchWarned = false;
+
+	EPlatformEvent EnabledEvents = EPlatformEvent::None;
+};
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////
+
+static FPlatformEvents* GPlatformEvents;
+
+/////////////////////////////////////////////////////////////////////
+
+FPlatformEvents::FPlatformEvents(uint32 InSamplingIntervalUsec)
+	// each sample interrupts every running thread of the process, so very small intervals are not useful
+	: SamplingIntervalUsec(FMath::Max<uint32>(InSamplingIntervalUsec, 100))
+{
+}
+
+/////////////////////////////////////////////////////////////////////
+
+FPlatformEvents::~FPlatformEvents()
+{
+	Stop();
+}
+
+/////////////////////////////////////////////////////////////////////
+
+void FPlatformEvents::Enable(EPlatformEvent Event)
+{
+	if (Event == EPlatformEvent::ContextSwitch)
+	{
+		if (!bContextSwitchWarned)
+		{
+			UE_LOG(LogPlatformEvents, Warning, TEXT("Context switch events are not supported on this platform"));
+			bContextSwitchWarned = true;
+		}
+		return;
+	}
+
+	if ((EnabledEvents & Event) != EPlatformEvent::None)
+	{
+		// if event is already enabled, do nothing
+		return;
+	}
+
+	EnumAddFlags(EnabledEvents, Event);
+
+	if (Thread == nullptr)
+	{
+		bStopping = false;
+		Thread = FRunnableThread::Create(this, TEXT("PlatformEvents"), 0, TPri_AboveNormal);
+	}
+}
+
+/////////////////////////////////////////////////////////////////////
+
+void FPlatformEvents::Disable(EPlatformEvent Event)
+{
+	if ((EnabledEvents & Event) == EPlatformEvent::None)
+	{
+		// if event is already disabled, do nothing
+		return;
+	}
+
+	EnumRemoveFlags(EnabledEvents, Event);
+
+	if (EnabledEvents == EPlatformEvent::None)
+	{
+		Stop();
+	}
+}
+
+/////////////////////////////////////////////////////////////////////
+
+uint32 FPlatformEvents::Run()
+{
+	SamplerThreadId = FPlatformTLS::GetCurrentThreadId();
+
+	while (!bStopping)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		SampleThreads();
+
+		// keep the interval between the start of samples, unless sampling all threads took longer than the interval
+		const double SleepTime = SamplingIntervalUsec * 1e-6 - (FPlatformTime::Seconds() - StartTime);
+		FPlatformProcess::SleepNoStats(static_cast<float>(FMath::Max(SleepTime, 0.0)));
+	}
+
+	return 0;
+}
+
+/////////////////////////////////////////////////////////////////////
+
+void FPlatformEvents::Stop()
+{
+	if (Thread)
+	{
+		bStopping = true;
+		Thread->WaitForCompletion();
+		delete Thread;
+		Thread = nullptr;
+	}
+}
+
+/////////////////////////////////////////////////////////////////////
+
+void FPlatformEvents::SampleThreads()
+{
+	DIR* TaskDir = opendir("/proc/self/task");
+	if (TaskDir == nullptr)
+	{
+		return;
+	}
+
+	uint64 BackTrace[MaxStackDepth];
+	while (const dirent* Entry = readdir(TaskDir))
+	{
+		if (Entry->d_name[0] < '0' || Entry->d_name[0] > '9')
+		{
+			continue;
+		}
+
+		const uint32 ThreadId = static_cast<uint32>(atoi(Entry->d_name));
+		if (ThreadId == SamplerThreadId || !IsThreadRunning(Entry->d_name))
+		{
+			continue;
+		}
+
+		const uint64 Time = FPlatformTime::Cycles64();
+		const uint32 Count = FPlatformStackWalk::CaptureThreadStackBackTrace(ThreadId, BackTrace, MaxStackDepth);
+
+		// the first frames are the ones of the signal handler, a callstack with only a few entries is not useful
+		if (Count > 2)
+		{
+			UE_TRACE_LOG(PlatformEvent, StackSample, StackSamplingChannel)
+				<< StackSample.Time(Time)
+				<< StackSample.ThreadId(ThreadId)
+				<< StackSample.Addresses(BackTrace, Count);
+		}
+	}
+
+	closedir(TaskDir);
+}
+
+/////////////////////////////////////////////////////////////////////
+
+bool FPlatformEvents::IsThreadRunning(const char* ThreadIdString)
+{
+	// like the ETW profile samples, only threads that are executing are sampled, the state follows the command name in the stat file
+	char Path[64];
+	snprintf(Path, sizeof(Path), "/proc/self/task/%s/stat", ThreadIdString);
+
+	const int File = open(Path, O_RDONLY);
+	if (File < 0)
+	{
+		return false;
+	}
+
+	char Stat[256];
+	const ssize_t Size = read(File, Stat, sizeof(Stat) - 1);
+	close(File);
+	if (Size <= 0)
+	{
+		return false;
+	}
+	Stat[Size] = '\0';
+
+	const char* CommandEnd = strrchr(Stat, ')');
+	return CommandEnd != nullptr && CommandEnd[1] == ' ' && CommandEnd[2] == 'R';
+}
+
+/////////////////////////////////////////////////////////////////////
+
+void PlatformEvents_Init(uint32 SamplingIntervalUsec)
+{
+	GPlatformEvents = new FPlatformEvents(SamplingIntervalUsec);
+}
+
+void PlatformEvents_Enable(EPlatformEvent Event)
+{
+	if (GPlatformEvents)
+	{
+		GPlatformEvents->Enable(Event);
+	}
+}
+
+void PlatformEvents_Disable(EPlatformEvent Event)
+{
+	if (GPlatformEvents)
+	{
+		GPlatformEvents->Disable(Event);
+	}
+}
+
+void PlatformEvents_Stop()
+{
+	if (GPlatformEvents)
+	{
+		delete GPlatformEvents;
+		GPlatformEvents = nullptr;
+	}
+}
+
+#endif // PLATFORM_SUPPORTS_PLATFORM_EVENTS
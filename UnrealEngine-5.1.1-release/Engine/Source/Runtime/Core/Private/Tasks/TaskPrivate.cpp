@@ -43,6 +43,14 @@ namespace UE::Tasks
 			}
 #endif
 
+			LowLevelTasks::FDeadlineScope DeadlineScope(LaunchDeadline);
+
+			if (ExtendedPriority == EExtendedTaskPriority::LaunchingNumaNode)
+			{
+				LowLevelTasks::FScheduler::Get().TryLaunchOnNumaNode(LowLevelTask, LaunchNumaNode);
+				return;
+			}
+
 			LowLevelTasks::FScheduler::Get().TryLaunch(LowLevelTask, LowLevelTasks::EQueuePreference::GlobalQueuePreference, /*bWakeUpWorker=*/ true);
 		}
 
@@ -341,6 +349,7 @@ namespace UE::Tasks
 			TEXT("None"),
 			TEXT("Inline"),
 			TEXT("TaskEvent"),
+			TEXT("LaunchingNumaNode"),
 
 #if TASKGRAPH_NEW_FRONTEND
 			TEXT("GameThreadNormalPri"),
@@ -374,6 +383,7 @@ namespace UE::Tasks
 		CONVERT_EXTENDED_TASK_PRIORITY(None);
 		CONVERT_EXTENDED_TASK_PRIORITY(Inline);
 		CONVERT_EXTENDED_TASK_PRIORITY(TaskEvent);
+		CONVERT_EXTENDED_TASK_PRIORITY(LaunchingNumaNode);
 
 #if TASKGRAPH_NEW_FRONTEND
 		CONVERT_EXTENDED_TASK_PRIORITY(GameThreadNormalPri);
@@ -0,0 +1,136 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Algo/Accumulate.h"
+#include "Algo/IsSorted.h"
+#include "Algo/ParallelReduce.h"
+#include "Algo/ParallelRemoveIf.h"
+#include "Algo/ParallelScan.h"
+#include "Algo/ParallelSort.h"
+#include "Algo/RemoveIf.h"
+#include "Algo/Sort.h"
+#include "Algo/StableSort.h"
+#include "Containers/Array.h"
+#include "Containers/UnrealString.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FParallelAlgoTest, "System.Core.Algo.Parallel", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FParallelAlgoTest::RunTest(const FString& Parameters)
+{
+	using namespace Algo;
+
+	FRandomStream Random(0x1234);
+	// sizes below, at and above the chunk size, and big enough to be split into many chunks
+	const int32 Sizes[] = { 0, 1, 17, AlgoImpl::FParallelChunks::DefaultMinChunkSize, AlgoImpl::FParallelChunks::DefaultMinChunkSize * 3 + 5, 300000 };
+
+	for (int32 Num : Sizes)
+	{
+		TArray<int32> Ints;
+		TArray<int64> Int64s;
+		TArray<float> Floats;
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			Ints.Add(Random.RandRange(-100000, 100000));
+			Int64s.Add((int64(Random.RandRange(-100000, 100000)) << 24) + Random.RandRange(0, 1000));
+			Floats.Add(Random.FRandRange(-1000.0f, 1000.0f));
+		}
+
+		{
+			TArray<int32> Expected = Ints;
+			Sort(Expected);
+			TArray<int32> Sorted = Ints;
+			ParallelSort(Sorted);
+			TestEqual(TEXT("`ParallelSort` radix sorts integers"), Sorted, Expected);
+
+			TArray<int64> Sorted64 = Int64s;
+			ParallelSort(Sorted64);
+			TestTrue(TEXT("`ParallelSort` radix sorts 64 bit integers"), IsSorted(Sorted64));
+		}
+
+		{
+			TArray<float> Expected = Floats;
+			Sort(Expected);
+			TArray<float> Sorted = Floats;
+			ParallelSort(Sorted);
+			TestEqual(TEXT("`ParallelSort` merge sorts floats"), Sorted, Expected);
+
+			TArray<float> Descending = Floats;
+			ParallelSort(Descending, [](float A, float B) { return A > B; });
+			TestTrue(TEXT("`ParallelSort` supports predicates"), IsSorted(Descending, [](float A, float B) { return A > B; }));
+		}
+
+		{
+			// keys with many duplicates expose unstable sorts, the index tells the original order apart
+			TArray<TPair<int32, int32>> Pairs;
+			for (int32 Index = 0; Index < Num; ++Index)
+			{
+				Pairs.Emplace(Ints[Index] % 50, Index);
+			}
+			TArray<TPair<int32, int32>> Expected = Pairs;
+			StableSortBy(Expected, [](const TPair<int32, int32>& Pair) { return Pair.Key; });
+
+			TArray<TPair<int32, int32>> RadixSorted = Pairs;
+			ParallelRadixSortBy(RadixSorted, [](const TPair<int32, int32>& Pair) { return Pair.Key; });
+			TestTrue(TEXT("`ParallelRadixSortBy` is stable"), RadixSorted == Expected);
+
+			TArray<TPair<int32, int32>> MergeSorted = Pairs;
+			ParallelStableSortBy(MergeSorted, [](const TPair<int32, int32>& Pair) { return Pair.Key; });
+			TestTrue(TEXT("`ParallelStableSortBy` is stable"), MergeSorted == Expected);
+		}
+
+		{
+			TArray<FString> Strings;
+			for (int32 Index = 0; Index < FMath::Min(Num, 20000); ++Index)
+			{
+				Strings.Add(FString::FromInt(Ints[Index]));
+			}
+			TArray<FString> Expected = Strings;
+			Sort(Expected);
+			ParallelSort(Strings);
+			TestTrue(TEXT("`ParallelSort` supports non-trivial types"), Strings == Expected);
+		}
+
+		{
+			const int64 Expected = Accumulate(Ints, int64(0));
+			TestEqual(TEXT("`ParallelReduce` sums integers"), ParallelReduce(Ints, int64(0)), Expected);
+			TestEqual(TEXT("`ParallelTransformReduce` maps before reducing"), ParallelTransformReduce(Ints, int64(7), TPlus<>(), [](int32 Value) { return int64(Value) * 2; }), Expected * 2 + 7);
+
+			const float FloatSum = ParallelReduce(Floats, 0.0f);
+			TestEqual(TEXT("`ParallelReduce` is deterministic"), ParallelReduce(Floats, 0.0f), FloatSum);
+		}
+
+		{
+			TArray<int64> Expected;
+			int64 Sum = 0;
+			for (int32 Value : Ints)
+			{
+				Sum += Value;
+				Expected.Add(Sum);
+			}
+			TArray<int64> Scanned;
+			Scanned.SetNumZeroed(Num);
+			ParallelInclusiveScan(Ints, Scanned, [](int64 A, int64 B) { return A + B; });
+			TestEqual(TEXT("`ParallelInclusiveScan` computes prefix sums"), Scanned, Expected);
+
+			TArray<int64> InPlace(Ints);
+			ParallelInclusiveScanInPlace(InPlace);
+			TestEqual(TEXT("`ParallelInclusiveScanInPlace` computes prefix sums"), InPlace, Expected);
+		}
+
+		{
+			TArray<int32> Expected = Ints;
+			Expected.SetNum(StableRemoveIf(Expected, [](int32 Value) { return Value % 3 == 0; }));
+			TArray<int32> Removed = Ints;
+			Removed.SetNum(ParallelRemoveIf(Removed, [](int32 Value) { return Value % 3 == 0; }));
+			TestEqual(TEXT("`ParallelRemoveIf` keeps the order of the remaining elements"), Removed, Expected);
+		}
+	}
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,83 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Misc/AutomationTest.h"
+#include "Async/ParallelFor.h"
+#include "Containers/Array.h"
+#include "HAL/PlatformAtomics.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FParallelForAdaptiveTest, "System.Core.Async.ParallelFor.Adaptive", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+namespace ParallelForTestImpl
+{
+	// runs an adaptive ParallelFor and checks that every index was visited exactly once
+	bool RunAdaptive(FAutomationTestBase& Test, const TCHAR* DebugName, int32 Num, int32 WorkPerItem)
+	{
+		TArray<int32> Visits;
+		Visits.SetNumZeroed(Num);
+
+		ParallelFor(DebugName, Num, 1, [&Visits, WorkPerItem](int32 Index)
+			{
+				volatile uint32 Hash = 0;
+				for (int32 Work = 0; Work < WorkPerItem; ++Work)
+				{
+					Hash = Hash * 31 + Work;
+				}
+				FPlatformAtomics::InterlockedIncrement(&Visits[Index]);
+			}, EParallelForFlags::Adaptive);
+
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			if (Visits[Index] != 1)
+			{
+				Test.AddError(FString::Printf(TEXT("%s: index %d was visited %d times"), DebugName, Index, Visits[Index]));
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+bool FParallelForAdaptiveTest::RunTest(const FString& Parameters)
+{
+	using namespace ParallelForTestImpl;
+
+	// the first call of a site measures, the following ones use the learned batch size
+	for (int32 Frame = 0; Frame < 8; ++Frame)
+	{
+		RunAdaptive(*this, TEXT("ParallelForAdaptiveTest.Tiny"), 16, 0);
+		RunAdaptive(*this, TEXT("ParallelForAdaptiveTest.Heavy"), 1000, 10000);
+	}
+
+	// a site that ran inline goes wide again once the workload grows
+	for (int32 Frame = 0; Frame < 4; ++Frame)
+	{
+		RunAdaptive(*this, TEXT("ParallelForAdaptiveTest.Growing"), Frame == 0 ? 4 : 4000, 1000);
+	}
+
+	const ParallelForImpl::FAdaptiveSite* Site = ParallelForImpl::FindOrAddAdaptiveSite(TEXT("ParallelForAdaptiveTest.Tiny"));
+	if (Site)
+	{
+		TestTrue(TEXT("Adaptive site learned the per item cost"), Site->CyclesPerItem.load(std::memory_order_relaxed) > 0.0);
+
+		bool bRunInline = false;
+		ParallelForImpl::GetAdaptiveMinBatchSize(*Site, 16, 1, bRunInline);
+		TestTrue(TEXT("Tiny workload runs inline"), bRunInline);
+	}
+
+	// contexts are sized by the default heuristic, adaptive batching may only use fewer of them
+	TArray<int32> Contexts;
+	ParallelForWithTaskContext(TEXT("ParallelForAdaptiveTest.Contexts"), Contexts, 1000, 1, [](int32& Sum, int32 Index) { Sum += Index; }, EParallelForFlags::Adaptive);
+	int32 Sum = 0;
+	for (int32 Context : Contexts)
+	{
+		Sum += Context;
+	}
+	TestEqual(TEXT("Adaptive ParallelFor with contexts visits every index"), Sum, 999 * 1000 / 2);
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -4,6 +4,7 @@
 #include "Misc/AutomationTest.h"
 #include "Async/TaskGraphInterfaces.h"
 #include "Containers/Array.h"
+#include "Containers/BoundedMpmcQueue.h"
 #include "Containers/CircularQueue.h"
 #include "Containers/Queue.h"
 #include "Containers/SpscQueue.h"
@@ -459,6 +460,70 @@ namespace UE { namespace ConcurrentQueuesTests
 			}
 		}
 
+		{	// test `TBoundedMpmcQueue` capacity, FIFO order and destruction with unconsumed items
+			TBoundedMpmcQueue<TUniquePtr<int>> Q(3);
+			check(Q.Capacity() == 4);
+			check(Q.IsEmpty());
+			for (int Index = 0; Index != 4; ++Index)
+			{
+				verify(Q.TryEnqueue(MakeUnique<int>(Index)));
+			}
+			TUniquePtr<int> Rejected = MakeUnique<int>(4);
+			verify(!Q.TryEnqueue(MoveTemp(Rejected)));
+			check(Rejected.IsValid()); // not consumed by the failed attempt
+			check(Q.ApproxNum() == 4);
+			TOptional<TUniquePtr<int>> Res{ Q.TryDequeue() };
+			verify(Res.IsSet() && *Res.GetValue() == 0);
+			verify(Q.TryEnqueue(MoveTemp(Rejected)));
+			for (int Index = 1; Index != 5; ++Index)
+			{
+				Res = Q.TryDequeue();
+				verify(Res.IsSet() && *Res.GetValue() == Index);
+			}
+			check(!Q.TryDequeue().IsSet());
+			Q.TryEnqueue(MakeUnique<int>(5));
+		}
+
+		{	// test `TBoundedMpmcQueue` with concurrent producers and consumers
+			TBoundedMpmcQueue<uint32> Q(64);
+			const int32 NumProducers = FMath::Max(FTaskGraphInterface::Get().GetNumWorkerThreads() / 2, 1);
+			const uint32 NumPerProducer = 100'000;
+			std::atomic<uint64> ConsumedSum{ 0 };
+			std::atomic<uint32> NumConsumed{ 0 };
+			auto ConsumeAll = [&Q, &ConsumedSum, &NumConsumed, NumProducers, NumPerProducer]
+			{
+				while (NumConsumed.load() != NumProducers * NumPerProducer)
+				{
+					if (TOptional<uint32> Value = Q.TryDequeue())
+					{
+						ConsumedSum += Value.GetValue();
+						++NumConsumed;
+					}
+				}
+			};
+			FGraphEventArray Tasks;
+			for (int32 i = 0; i != NumProducers; ++i)
+			{
+				Tasks.Add(FFunctionGraphTask::CreateAndDispatchWhenReady([&Q, NumPerProducer]
+					{
+						for (uint32 Value = 1; Value <= NumPerProducer; ++Value)
+						{
+							while (!Q.TryEnqueue(Value))
+							{
+								FPlatformProcess::Yield();
+							}
+						}
+					}));
+				if (i != 0) // the calling thread is one of consumers, so spinning consumers can't take all workers from producers
+				{
+					Tasks.Add(FFunctionGraphTask::CreateAndDispatchWhenReady(ConsumeAll));
+				}
+			}
+			ConsumeAll();
+			FTaskGraphInterface::Get().WaitUntilTasksComplete(MoveTemp(Tasks), ENamedThreads::GameThread);
+			check(ConsumedSum.load() == uint64(NumProducers) * NumPerProducer * (NumPerProducer + 1) / 2);
+		}
+
 		UE_BENCHMARK(5, TestTCircularQueueSingleThread<5'000'000>);
 		UE_BENCHMARK(5, TestQueueSingleThread<5'000'000, TQueueAdapter<TQueue<uint32, EQueueMode::Spsc>>>);
 		UE_BENCHMARK(5, TestQueueSingleThread<5'000'000, TQueueAdapter<TQueue<uint32, EQueueMode::Mpsc>>>);
@@ -4,8 +4,11 @@
 #include "Misc/AutomationTest.h"
 #include "Tests/Benchmark.h"
 #include "Tasks/Pipe.h"
+#include "Tasks/Channel.h"
+#include "HAL/IConsoleManager.h"
 #include "HAL/Thread.h"
 #include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
 
 #include <atomic>
 
@@ -354,6 +357,78 @@ namespace UE { namespace TasksTests
 			Outer.Wait();
 		}
 
+		{	// a task launched for the launching thread's NUMA node runs on a worker of that node, if there are any. Here only its completion can be checked
+			std::atomic<bool> bExecuted{ false };
+			FTaskEvent Prerequisite{ UE_SOURCE_LOCATION };
+			FTask Task = Launch
+			(
+				UE_SOURCE_LOCATION, 
+				[&bExecuted] { bExecuted = true; }, 
+				Prerequisite,
+				ETaskPriority::Default, 
+				EExtendedTaskPriority::LaunchingNumaNode
+			);
+			Prerequisite.Trigger(); // the task is scheduled by this thread but for the node captured on launch
+			Task.Wait();
+			check(bExecuted);
+			check(LowLevelTasks::FScheduler::Get().GetCurrentNumaNode() < LowLevelTasks::FScheduler::Get().GetNumNumaNodes());
+		}
+
+		{	// tasks launched inside a deadline scope are executed with the deadline, nested scopes keep the earliest one
+			const uint64 Deadline = FPlatformTime::Cycles64() + 1000;
+			std::atomic<uint64> ExecutedDeadline{ 0 };
+			FTask Task;
+			{
+				LowLevelTasks::FDeadlineScope DeadlineScope(Deadline);
+				LowLevelTasks::FDeadlineScope LaterDeadlineScope(Deadline + 1000);
+				check(LowLevelTasks::FSchedulerTls::GetActiveDeadline() == Deadline);
+				Task = Launch(UE_SOURCE_LOCATION, [&ExecutedDeadline] { ExecutedDeadline = LowLevelTasks::FSchedulerTls::GetActiveDeadline(); });
+			}
+			check(LowLevelTasks::FSchedulerTls::GetActiveDeadline() == 0);
+			while (!Task.IsCompleted()) // not `Wait` as a retracted task would be executed outside of the scope
+			{
+				FPlatformProcess::Yield();
+			}
+			check(ExecutedDeadline == Deadline);
+		}
+
+		{	// background tasks exhaust a tiny CPU budget, they are still completed when the budget window ends even if no new frame starts
+			IConsoleVariable* FractionCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("Tasks.BackgroundBudget.Fraction"));
+			check(FractionCVar);
+			const float PrevFraction = FractionCVar->GetFloat();
+			FractionCVar->Set(0.000001f);
+			LowLevelTasks::FScheduler& Scheduler = LowLevelTasks::FScheduler::Get();
+			Scheduler.BeginBackgroundBudgetFrame();
+			FPlatformProcess::Sleep(0.01f);
+			Scheduler.BeginBackgroundBudgetFrame();
+
+			TArray<FTask> BackgroundTasks;
+			for (int32 Index = 0; Index != 10; ++Index)
+			{
+				BackgroundTasks.Add(Launch(UE_SOURCE_LOCATION, [] { FPlatformProcess::Sleep(0.001f); }, ETaskPriority::BackgroundLow));
+			}
+			Wait(BackgroundTasks);
+
+			FractionCVar->Set(PrevFraction);
+			Scheduler.BeginBackgroundBudgetFrame();
+			Scheduler.BeginBackgroundBudgetFrame();
+			check(!Scheduler.IsBackgroundBudgetExhausted() || PrevFraction > 0.0f);
+		}
+
+#if !TASKGRAPH_NEW_FRONTEND
+		{	// boosting a graph event that waits for prerequisites marks its task as boosted, it still executes after the prerequisites
+			FGraphEventRef Prerequisite = FGraphEvent::CreateGraphEvent();
+			FGraphEventArray Prerequisites{ Prerequisite };
+			std::atomic<bool> bExecuted{ false };
+			FGraphEventRef Event = FFunctionGraphTask::CreateAndDispatchWhenReady([&bExecuted] { bExecuted = true; }, TStatId{}, &Prerequisites, ENamedThreads::AnyBackgroundThreadNormalTask);
+			Event->Boost();
+			check(!bExecuted);
+			Prerequisite->DispatchSubsequents();
+			Event->Wait();
+			check(bExecuted);
+		}
+#endif
+
 #if TASKGRAPH_NEW_FRONTEND
 		{	// a basic test for a named thread task
 			FTask GTTask = Launch
@@ -1338,6 +1413,83 @@ namespace UE { namespace TasksTests
 
 		return true;
 	}
+
+	IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTasksChannelTest, "System.Core.Tasks.Channel", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter);
+
+	bool FTasksChannelTest::RunTest(const FString& Parameters)
+	{
+		{	// a single consumer processes items sequentially in the order they were sent
+			TArray<int32> Consumed;
+			{
+				TChannel<int32> Channel(UE_SOURCE_LOCATION, 16, [&Consumed](int32 Value) { Consumed.Add(Value); });
+				for (int32 Index = 0; Index != 1000; ++Index)
+				{
+					verify(Channel.Send(Index)); // backpressure, the channel can't hold all items
+				}
+				Channel.WaitUntilEmpty();
+				check(!Channel.HasWork());
+			}
+			check(Consumed.Num() == 1000);
+			for (int32 Index = 0; Index != 1000; ++Index)
+			{
+				check(Consumed[Index] == Index);
+			}
+		}
+
+		{	// multiple producers and consumers
+			const uint32 NumConsumers = 4;
+			const int32 NumProducers = 8;
+			const int32 NumPerProducer = 10000;
+			std::atomic<int64> Sum{ 0 };
+			std::atomic<uint32> NumConcurrent{ 0 };
+			std::atomic<uint32> MaxConcurrent{ 0 };
+			TChannel<int32> Channel(UE_SOURCE_LOCATION, 64,
+				[&Sum, &NumConcurrent, &MaxConcurrent](int32 Value)
+				{
+					uint32 LocalNumConcurrent = ++NumConcurrent;
+					uint32 LocalMax = MaxConcurrent.load();
+					while (LocalNumConcurrent > LocalMax && !MaxConcurrent.compare_exchange_weak(LocalMax, LocalNumConcurrent))
+					{
+					}
+					Sum += Value;
+					--NumConcurrent;
+				},
+				ETaskPriority::Default, NumConsumers);
+
+			TArray<FTask> Producers;
+			for (int32 ProducerIndex = 0; ProducerIndex != NumProducers; ++ProducerIndex)
+			{
+				Producers.Add(Launch(UE_SOURCE_LOCATION, [&Channel, NumPerProducer]
+					{
+						for (int32 Value = 1; Value <= NumPerProducer; ++Value)
+						{
+							verify(Channel.Send(Value));
+						}
+					}));
+			}
+			Wait(Producers);
+			Channel.WaitUntilEmpty();
+			check(Sum.load() == int64(NumProducers) * NumPerProducer * (NumPerProducer + 1) / 2);
+			check(MaxConcurrent.load() <= NumConsumers);
+		}
+
+		{	// a closed channel rejects new items but consumes already sent ones
+			FTaskEvent Blocker{ UE_SOURCE_LOCATION };
+			std::atomic<int32> NumConsumed{ 0 };
+			TChannel<int32> Channel(UE_SOURCE_LOCATION, 4, [&Blocker, &NumConsumed](int32) { Blocker.Wait(); ++NumConsumed; });
+			verify(Channel.TrySend(1));
+			verify(Channel.TrySend(2));
+			Channel.Close();
+			check(Channel.IsClosed());
+			verify(!Channel.TrySend(3));
+			verify(!Channel.Send(4));
+			Blocker.Trigger();
+			Channel.WaitUntilEmpty();
+			check(NumConsumed.load() == 2);
+		}
+
+		return true;
+	}
 }}
 
 #endif // WITH_DEV_AUTOMATION_TESTS
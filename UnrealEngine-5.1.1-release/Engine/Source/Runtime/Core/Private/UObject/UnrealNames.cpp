@@ -427,6 +427,20 @@ struct FNameSlot
 	bool operator==(FNameSlot Rhs) const { return IdAndHash == Rhs.IdAndHash; }
 
 	bool Used() const { return !!IdAndHash;  }
+
+	/** Reads a slot that a writer holding the shard lock may be claiming concurrently */
+	static FNameSlot LoadAcquire(const FNameSlot& Slot)
+	{
+		FNameSlot Out;
+		Out.IdAndHash = ((const std::atomic<uint32>*)&Slot.IdAndHash)->load(std::memory_order_acquire);
+		return Out;
+	}
+
+	/** Publishes a claimed slot to lock-free readers, after the entry it points to has been written */
+	void StoreRelease(FNameSlot Value)
+	{
+		((std::atomic<uint32>*)&IdAndHash)->store(Value.IdAndHash, std::memory_order_release);
+	}
 private:
 	uint32 IdAndHash = 0;
 };
@@ -714,17 +728,20 @@ private:
 
 // Increasing shards reduces contention but uses more memory and adds cache pressure.
 // Reducing contention matters when multiple threads create FNames in parallel.
-// Contention exists in some tool scenarios, for instance between main thread
-// and asset data gatherer thread during editor startup.
+// Contention exists in some tool scenarios, for instance between main thread,
+// asset data gatherer thread and cooker worker threads during editor startup and cooking.
 // At runtime the async loading thread contends with game thread during asset loading.
+// Finding existing names doesn't take the shard lock, so shards only need to spread out creation.
+// The initial slot count shrinks as the shard count grows to keep initial slot memory unchanged.
 #if WITH_CASE_PRESERVING_NAME
-constexpr uint32 FNamePoolShardBits = 10;
+constexpr uint32 FNamePoolShardBits = 12;
+constexpr uint32 FNamePoolInitialSlotBits = 6;
 #else
-constexpr uint32 FNamePoolShardBits = 8;
+constexpr uint32 FNamePoolShardBits = 10;
+constexpr uint32 FNamePoolInitialSlotBits = 6;
 #endif
 
 constexpr uint32 FNamePoolShards = 1 << FNamePoolShardBits;
-constexpr uint32 FNamePoolInitialSlotBits = 8;
 constexpr uint32 FNamePoolInitialSlotsPerShard = 1 << FNamePoolInitialSlotBits;
 
 /** Hashes name into 64 bits that determines shard and slot index.
@@ -1010,19 +1027,25 @@ public:
 		LLM_SCOPE(ELLMTag::FName);
 		Entries = &InEntries;
 
-		Slots = (FNameSlot*)FMemory::Malloc(FNamePoolInitialSlotsPerShard * sizeof(FNameSlot), alignof(FNameSlot));
-		memset(Slots, 0, FNamePoolInitialSlotsPerShard * sizeof(FNameSlot));
+		Slots = AllocateSlots(FNamePoolInitialSlotsPerShard, nullptr);
 		CapacityMask = FNamePoolInitialSlotsPerShard - 1;
+		PublishedSlots.store(Slots, std::memory_order_release);
 	}
 
 	// This and ~FNamePool() is not called during normal shutdown
 	// but only via explicit FName::TearDown() call
 	~FNamePoolShardBase()
 	{
-		FMemory::Free(Slots);
+		for (FNameSlot* It = Slots; It; )
+		{
+			FNameSlot* Retired = GetSlotsHeader(It).RetiredSlots;
+			FreeSlots(It);
+			It = Retired;
+		}
 		UsedSlots = 0;
 		CapacityMask = 0;
 		Slots = nullptr;
+		PublishedSlots.store(nullptr, std::memory_order_relaxed);
 		NumCreatedEntries = 0;
 		NumCreatedWideEntries = 0;
 	}
@@ -1035,10 +1058,48 @@ public:
 protected:
 	enum { LoadFactorQuotient = 9, LoadFactorDivisor = 10 }; // I.e. realloc slots when 90% full
 
+	/**
+	 * Stored in front of every slot array so lock-free readers get the capacity that matches the slots they loaded.
+	 *
+	 * Lock-free readers may still be probing a slot array after Grow() has replaced it, so replaced arrays are
+	 * chained through RetiredSlots and only freed on teardown. They add up to less than the current slot array.
+	 */
+	struct alignas(16) FSlotsHeader
+	{
+		FNameSlot* RetiredSlots;
+		uint32 CapacityMask;
+	};
+
+	static FNameSlot* AllocateSlots(uint32 Capacity, FNameSlot* RetiredSlots)
+	{
+		uint8* Memory = (uint8*)FMemory::Malloc(sizeof(FSlotsHeader) + Capacity * sizeof(FNameSlot), alignof(FSlotsHeader));
+		new (Memory) FSlotsHeader{ RetiredSlots, Capacity - 1 };
+		FNameSlot* NewSlots = (FNameSlot*)(Memory + sizeof(FSlotsHeader));
+		memset(NewSlots, 0, Capacity * sizeof(FNameSlot));
+		return NewSlots;
+	}
+
+	static FSlotsHeader& GetSlotsHeader(FNameSlot* InSlots)
+	{
+		return *(FSlotsHeader*)((uint8*)InSlots - sizeof(FSlotsHeader));
+	}
+
+	static const FSlotsHeader& GetSlotsHeader(const FNameSlot* InSlots)
+	{
+		return *(const FSlotsHeader*)((const uint8*)InSlots - sizeof(FSlotsHeader));
+	}
+
+	static void FreeSlots(FNameSlot* InSlots)
+	{
+		FMemory::Free(&GetSlotsHeader(InSlots));
+	}
+
 	mutable FRWLock Lock;
 	uint32 UsedSlots = 0;
 	uint32 CapacityMask = 0;
 	FNameSlot* Slots = nullptr;
+	/** Same as Slots, but safe to read without holding Lock */
+	std::atomic<const FNameSlot*> PublishedSlots{ nullptr };
 	FNameEntryAllocator* Entries = nullptr;
 	uint32 NumCreatedEntries = 0;
 	uint32 NumCreatedWideEntries = 0;
@@ -1175,15 +1236,23 @@ public:
 
 	FNameEntryId Find(const FNameValue<Sensitivity>& Value) const
 	{
-		FRWScopeLock _(Lock, FRWScopeLockType::SLT_ReadOnly);
-
-		FNameSlot& Slot = Probe(Value);
-		return Slot.GetId();
+		// A miss is as good as a miss under the read lock, since any concurrent insert could just as well have come later
+		FNameEntryId Id;
+		ProbeLockFree(Value, Id);
+		return Id;
 	}
 
 	template<class ScopeLock = FWriteScopeLock>
 	FORCEINLINE FNameEntryId Insert(const FNameValue<Sensitivity>& Value, bool& bCreatedNewEntry)
 	{
+		// Most inserts are for names that already exist, find those without taking the lock.
+		// Pre-locked batch inserts skip this, they already hold the lock.
+		FNameEntryId ExistingId;
+		if (std::is_same_v<ScopeLock, FWriteScopeLock> && ProbeLockFree(Value, ExistingId))
+		{
+			return ExistingId;
+		}
+
 		ScopeLock _(Lock);
 		FNameSlot& Slot = Probe(Value);
 
@@ -1204,15 +1273,20 @@ public:
 #if UE_FNAME_OUTLINE_NUMBER
 	FNameEntryId FindWithNumber(const FNumberedNameValue<Sensitivity>& Value) const
 	{
-		FRWScopeLock _(Lock, FRWScopeLockType::SLT_ReadOnly);
-
-		FNameSlot& Slot = ProbeWithNumber(Value);
-		return Slot.GetId();
+		FNameEntryId Id;
+		ProbeWithNumberLockFree(Value, Id);
+		return Id;
 	}
 
 	template<class ScopeLock = FWriteScopeLock>
 	FNameEntryId InsertWithNumber(const FNumberedNameValue<Sensitivity>& Value, bool& bCreatedNewEntry)
 	{
+		FNameEntryId ExistingId;
+		if (std::is_same_v<ScopeLock, FWriteScopeLock> && ProbeWithNumberLockFree(Value, ExistingId))
+		{
+			return ExistingId;
+		}
+
 		ScopeLock _(Lock);
 		FNameSlot& Slot = ProbeWithNumber(Value);
 
@@ -1361,7 +1435,7 @@ private:
 	{
 		checkSlow(!UnusedSlot.Used());
 
-		UnusedSlot = NewValue;
+		UnusedSlot.StoreRelease(NewValue);
 
 		++UsedSlots;
 		if (UsedSlots * LoadFactorDivisor > LoadFactorQuotient * Capacity())
@@ -1408,8 +1482,7 @@ private:
 		TArrayView<FNameSlot> OldSlots(Slots, Capacity());
 		const uint32 OldUsedSlots = UsedSlots;
 
-		Slots = (FNameSlot*)FMemory::Malloc(NewCapacity * sizeof(FNameSlot), alignof(FNameSlot));
-		memset(Slots, 0, NewCapacity * sizeof(FNameSlot));
+		Slots = AllocateSlots(NewCapacity, OldSlots.GetData());
 		UsedSlots = 0;
 		CapacityMask = NewCapacity - 1;
 
@@ -1445,7 +1518,8 @@ private:
 
 		check(OldUsedSlots == UsedSlots);
 
-		FMemory::Free(OldSlots.GetData());
+		// The old slots are retired rather than freed, lock-free readers may still be probing them
+		PublishedSlots.store(Slots, std::memory_order_release);
 	}
 
 	void ProbePrefetch(const FNameValue<Sensitivity>& Value) const
@@ -1468,6 +1542,36 @@ private:
 									EntryEqualsValue<Sensitivity>(Entries->Resolve(Slot.GetId()), Value); });
 	}
 
+	/** Find existing entry without taking the lock. Entries are immutable once their slot is published. */
+	FORCEINLINE bool ProbeLockFree(const FNameValue<Sensitivity>& Value, FNameEntryId& OutId) const
+	{
+		return ProbeLockFree(Value.Hash.UnmaskedSlotIndex, OutId,
+			[&](FNameSlot Slot)	{ return Slot.GetProbeHash() == Value.Hash.SlotProbeHash && 
+									EntryEqualsValue<Sensitivity>(Entries->Resolve(Slot.GetId()), Value); });
+	}
+
+	/** Find slot that fulfills predicate without taking the lock, returns false if an unused slot is found first */
+	template<class PredicateFn>
+	FORCEINLINE bool ProbeLockFree(uint32 UnmaskedSlotIndex, FNameEntryId& OutId, PredicateFn Predicate) const
+	{
+		const FNameSlot* CurrentSlots = PublishedSlots.load(std::memory_order_acquire);
+		const uint32 Mask = GetSlotsHeader(CurrentSlots).CapacityMask;
+		for (uint32 I = FNameHash::GetProbeStart(UnmaskedSlotIndex, Mask); true; I = (I + 1) & Mask)
+		{
+			const FNameSlot Slot = FNameSlot::LoadAcquire(CurrentSlots[I]);
+			if (!Slot.Used())
+			{
+				OutId = FNameEntryId();
+				return false;
+			}
+			if (Predicate(Slot))
+			{
+				OutId = Slot.GetId();
+				return true;
+			}
+		}
+	}
+
 	/** Find slot that fulfills predicate or the first free slot  */
 	template<class PredicateFn>
 	FORCEINLINE FNameSlot& Probe(uint32 UnmaskedSlotIndex, PredicateFn Predicate) const
@@ -1491,6 +1595,13 @@ private:
 			[&](FNameSlot Slot) { return Slot.GetProbeHash() == Value.Hash.SlotProbeHash &&
 			EntryEqualsValue(Entries->Resolve(Slot.GetId()), Value); });
 	}
+
+	FORCEINLINE bool ProbeWithNumberLockFree(const FNumberedNameValue<Sensitivity>& Value, FNameEntryId& OutId) const
+	{
+		return ProbeLockFree(Value.Hash.UnmaskedSlotIndex, OutId,
+			[&](FNameSlot Slot) { return Slot.GetProbeHash() == Value.Hash.SlotProbeHash &&
+			EntryEqualsValue(Entries->Resolve(Slot.GetId()), Value); });
+	}
 #endif // UE_FNAME_OUTLINE_NUMBER
 
 	FORCENOINLINE // Doesn't impact performance and makes sampling profiles more informative
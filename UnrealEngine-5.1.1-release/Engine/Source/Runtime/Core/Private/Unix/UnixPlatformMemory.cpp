@@ -19,9 +19,11 @@
 #include "HAL/MallocJemalloc.h"
 #include "HAL/MallocBinned.h"
 #include "HAL/MallocBinned2.h"
+#include "HAL/MallocBinned3.h"
 #include "HAL/MallocReplayProxy.h"
 #include "HAL/MallocStomp.h"
 #include "HAL/PlatformMallocCrash.h"
+#include "HAL/LowLevelMemTracker.h"
 
 #include <sys/sysinfo.h>
 #include <sys/file.h>
@@ -61,6 +63,20 @@ bool CORE_API GFullCrashCallstack = false;
 bool CORE_API GUseKSM = false;
 bool CORE_API GKSMMergeAllPages = false;
 
+// Used to request transparent huge pages (MADV_HUGEPAGE) for large allocator regions, enabled with -largepages
+bool CORE_API GUseLargePages = false;
+
+/** Transparent huge page size on x86-64 and arm64 with 4KB base pages */
+static constexpr SIZE_T UnixLargePageSize = 2 * 1024 * 1024;
+
+/** Bytes currently advised as MADV_HUGEPAGE */
+static int64 GLargePageRequestedBytes = 0;
+
+/** AnonHugePages of the process as of the last GetExtendedStats() call; reading smaps is too slow for GetStats() */
+static int64 GLargePageBackedBytes = 0;
+
+LLM_DECLARE_TAG(LargePages);
+
 // Used to enable or disable timing of ensures. Enabled by default
 bool CORE_API GTimeEnsures = true;
 
@@ -123,6 +139,8 @@ void FUnixPlatformMemory::Init()
 		GMemoryRangeDecommitIsNoOp ? TEXT("be a no-op (re-run with -vmapoolevict to change)") : TEXT("will evict the memory from RAM (re-run with -novmapoolevict to change)"));
 	UE_LOG(LogInit, Log, TEXT(" - PageSize %zu"), MemoryConstants.PageSize);
 	UE_LOG(LogInit, Log, TEXT(" - BinnedPageSize %zu"), MemoryConstants.BinnedPageSize);
+	UE_LOG(LogInit, Log, TEXT(" - Transparent huge pages for allocator regions are %s"),
+		GUseLargePages ? TEXT("requested (see /sys/kernel/mm/transparent_hugepage/enabled)") : TEXT("not requested (re-run with -largepages to change)"));
 }
 
 bool FUnixPlatformMemory::HasForkPageProtectorEnabled()
@@ -206,6 +224,19 @@ class FMalloc* FUnixPlatformMemory::BaseAllocator()
 				break;
 			}
 
+#if PLATFORM_64BITS && PLATFORM_HAS_FPlatformVirtualMemoryBlock
+			if (FCStringAnsi::Stricmp(Arg, "-binnedmalloc3") == 0)
+			{
+				AllocatorToUse = EMemoryAllocatorToUse::Binned3;
+				break;
+			}
+#endif
+
+			if (FCStringAnsi::Stricmp(Arg, "-largepages") == 0)
+			{
+				GUseLargePages = true;
+			}
+
 			if (FCStringAnsi::Stricmp(Arg, "-fullcrashcallstack") == 0)
 			{
 				GFullCrashCallstack = true;
@@ -334,6 +365,12 @@ class FMalloc* FUnixPlatformMemory::BaseAllocator()
 		Allocator = new FMallocBinned2();
 		break;
 
+#if PLATFORM_64BITS && PLATFORM_HAS_FPlatformVirtualMemoryBlock
+	case EMemoryAllocatorToUse::Binned3:
+		Allocator = new FMallocBinned3();
+		break;
+#endif
+
 	default:	// intentional fall-through
 	case EMemoryAllocatorToUse::Binned:
 		Allocator = new FMallocBinned(FPlatformMemory::GetConstants().BinnedPageSize & MAX_uint32, 0x100000000);
@@ -395,6 +432,39 @@ static void MarkMappedMemoryMergable(void* Pointer, SIZE_T Size)
 	}
 }
 
+/** Returns the huge page aligned interior of a range, which is the only part THP can back. */
+static SIZE_T GetLargePageInterior(void* Pointer, SIZE_T Size, void*& OutStart)
+{
+	const UPTRINT Start = Align(reinterpret_cast<UPTRINT>(Pointer), UnixLargePageSize);
+	const UPTRINT End = AlignDown(reinterpret_cast<UPTRINT>(Pointer) + Size, UnixLargePageSize);
+	OutStart = reinterpret_cast<void*>(Start);
+	return End > Start ? End - Start : 0;
+}
+
+SIZE_T FUnixPlatformMemory::AdviseLargePages(void* Ptr, SIZE_T Size)
+{
+	if (!GUseLargePages)
+	{
+		return 0;
+	}
+
+	void* Start;
+	const SIZE_T LargePageBytes = GetLargePageInterior(Ptr, Size, Start);
+	if (LargePageBytes == 0)
+	{
+		return 0;
+	}
+
+	// EINVAL means the kernel was built without THP; that is not fatal, the memory just stays on regular pages
+	if (madvise(Start, LargePageBytes, MADV_HUGEPAGE) != 0)
+	{
+		return 0;
+	}
+
+	FPlatformAtomics::InterlockedAdd(&GLargePageRequestedBytes, (int64)LargePageBytes);
+	return LargePageBytes;
+}
+
 #ifndef MALLOC_LEAKDETECTION
 	#define MALLOC_LEAKDETECTION 0
 #endif
@@ -517,7 +587,15 @@ void* FUnixPlatformMemory::BinnedAllocFromOS(SIZE_T Size)
 		AllocDescriptor->OriginalSizeAsPassed = Size;
 	}
 
-	LLM(FLowLevelMemTracker::Get().OnLowLevelAlloc(ELLMTracker::Platform, Pointer, Size));
+	if (AdviseLargePages(Pointer, SizeInWholePages) > 0)
+	{
+		LLM_PLATFORM_SCOPE_BYTAG(LargePages);
+		LLM(FLowLevelMemTracker::Get().OnLowLevelAlloc(ELLMTracker::Platform, Pointer, Size));
+	}
+	else
+	{
+		LLM(FLowLevelMemTracker::Get().OnLowLevelAlloc(ELLMTracker::Platform, Pointer, Size));
+	}
 	UE::FForkPageProtector::Get().AddMemoryRegion(Pointer, Size);
 
 	return Pointer;
@@ -530,6 +608,16 @@ void FUnixPlatformMemory::BinnedFreeToOS(void* Ptr, SIZE_T Size)
 	static SIZE_T OSPageSize = FPlatformMemory::GetConstants().PageSize;
 	SIZE_T SizeInWholePages = (Size % OSPageSize) ? (Size + OSPageSize - (Size % OSPageSize)) : Size;
 
+	if (GUseLargePages)
+	{
+		// BinnedAllocFromOS advised exactly this interior; a failed madvise there only skews the stat
+		void* LargePageStart;
+		if (const SIZE_T LargePageBytes = GetLargePageInterior(Ptr, SizeInWholePages, LargePageStart))
+		{
+			FPlatformAtomics::InterlockedAdd(&GLargePageRequestedBytes, -(int64)LargePageBytes);
+		}
+	}
+
 	if (UE4_PLATFORM_REDUCE_NUMBER_OF_MAPS || UE4_PLATFORM_SANITY_CHECK_OS_ALLOCATIONS)
 	{
 		const SIZE_T DescriptorSize = OSPageSize;
@@ -827,6 +915,9 @@ FPlatformMemoryStats FUnixPlatformMemory::GetStats()
 		MemoryStats.PeakUsedPhysical = FMath::Max(MemoryStats.PeakUsedPhysical, MemoryStats.UsedPhysical);
 	}
 
+	MemoryStats.LargePageRequested = (uint64)FMath::Max<int64>(FPlatformAtomics::AtomicRead(&GLargePageRequestedBytes), 0);
+	MemoryStats.LargePageBacked = (uint64)FPlatformAtomics::AtomicRead(&GLargePageBackedBytes);
+
 	return MemoryStats;
 }
 
@@ -869,6 +960,7 @@ FExtendedPlatformMemoryStats FUnixPlatformMemory::GetExtendedStats()
 	const ANSICHAR Shared_DirtyStr[]  = "Shared_Dirty:";
 	const ANSICHAR Private_CleanStr[] = "Private_Clean:";
 	const ANSICHAR Private_DirtyStr[] = "Private_Dirty:";
+	const ANSICHAR AnonHugePagesStr[] = "AnonHugePages:";
 
 	FExtendedPlatformMemoryStats MemoryStats = { 0 };
 
@@ -878,6 +970,7 @@ FExtendedPlatformMemoryStats FUnixPlatformMemory::GetExtendedStats()
 		{ Shared_DirtyStr,  (uint64 *)&MemoryStats.Shared_Dirty },
 		{ Private_CleanStr, (uint64 *)&MemoryStats.Private_Clean },
 		{ Private_DirtyStr, (uint64 *)&MemoryStats.Private_Dirty },
+		{ AnonHugePagesStr, (uint64 *)&MemoryStats.AnonHugePages },
 	};
 
 #if USE_PROC_SELF_SMAPS_ROLLUP
@@ -929,6 +1022,8 @@ FExtendedPlatformMemoryStats FUnixPlatformMemory::GetExtendedStats()
 		}
 	}
 
+	FPlatformAtomics::InterlockedExchange(&GLargePageBackedBytes, (int64)MemoryStats.AnonHugePages);
+
 	return MemoryStats;
 }
 
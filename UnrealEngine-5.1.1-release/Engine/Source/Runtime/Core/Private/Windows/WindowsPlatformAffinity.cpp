@@ -0,0 +1,35 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Windows/WindowsPlatformAffinity.h"
+#include "Windows/WindowsHWrapper.h"
+
+uint32 FWindowsPlatformAffinity::GetNumNumaNodes()
+{
+	static const uint32 NumNodes = []() -> uint32
+	{
+		ULONG HighestNodeNumber = 0;
+		return GetNumaHighestNodeNumber(&HighestNodeNumber) ? uint32(HighestNodeNumber) + 1 : 1;
+	}();
+	return NumNodes;
+}
+
+uint64 FWindowsPlatformAffinity::GetNumaNodeMask(uint32 NodeIndex, uint16& OutProcessorGroup)
+{
+	// a node spanning several processor groups reports its processors in the primary group only
+	GROUP_AFFINITY NodeAffinity = {};
+	if (NodeIndex < GetNumNumaNodes() && GetNumaNodeProcessorMaskEx(USHORT(NodeIndex), &NodeAffinity) && NodeAffinity.Mask != 0)
+	{
+		OutProcessorGroup = NodeAffinity.Group;
+		return uint64(NodeAffinity.Mask);
+	}
+	return FGenericPlatformAffinity::GetNumaNodeMask(NodeIndex, OutProcessorGroup);
+}
+
+uint32 FWindowsPlatformAffinity::GetCurrentNumaNode()
+{
+	PROCESSOR_NUMBER ProcessorNumber = {};
+	GetCurrentProcessorNumberEx(&ProcessorNumber);
+
+	USHORT NodeNumber = 0;
+	return GetNumaProcessorNodeEx(&ProcessorNumber, &NodeNumber) ? uint32(NodeNumber) : 0;
+}
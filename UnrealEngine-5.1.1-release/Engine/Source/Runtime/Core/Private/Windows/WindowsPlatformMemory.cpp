@@ -23,6 +23,7 @@
 #include "HAL/MallocStomp2.h"
 #include "HAL/MallocDoubleFreeFinder.h"
 #include "HAL/IConsoleManager.h"
+#include "HAL/LowLevelMemTracker.h"
 #include "Windows/WindowsHWrapper.h"
 
 #pragma warning(disable:6250)
@@ -46,6 +47,53 @@ static FAutoConsoleVariableRef CVarLogPlatformMemoryStats(
 	ECVF_Default);
 
 
+LLM_DECLARE_TAG(LargePages);
+
+namespace WindowsPlatformMemory
+{
+	/** Large page size when -largepages was passed and SeLockMemoryPrivilege could be obtained, 0 otherwise. */
+	static SIZE_T GLargePageSize = 0;
+
+	/** true when -largepages was passed, even if large pages turned out to be unavailable */
+	static bool GLargePagesRequested = false;
+
+	static int64 GLargePageRequestedBytes = 0;
+	static int64 GLargePageBackedBytes = 0;
+
+	/** MEM_LARGE_PAGES needs SeLockMemoryPrivilege ("Lock pages in memory"), which is granted per account but disabled by default. */
+	static bool EnableLockMemoryPrivilege()
+	{
+		HANDLE Token = nullptr;
+		if (!::OpenProcessToken(::GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &Token))
+		{
+			return false;
+		}
+
+		TOKEN_PRIVILEGES Privileges;
+		Privileges.PrivilegeCount = 1;
+		Privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+		bool bEnabled = ::LookupPrivilegeValueW(nullptr, SE_LOCK_MEMORY_NAME, &Privileges.Privileges[0].Luid)
+			&& ::AdjustTokenPrivileges(Token, FALSE, &Privileges, 0, nullptr, nullptr)
+			&& ::GetLastError() == ERROR_SUCCESS; // AdjustTokenPrivileges succeeds with ERROR_NOT_ALL_ASSIGNED if the account lacks the right
+		::CloseHandle(Token);
+		return bEnabled;
+	}
+
+	static void InitLargePages()
+	{
+		GLargePagesRequested = true;
+		if (EnableLockMemoryPrivilege())
+		{
+			GLargePageSize = ::GetLargePageMinimum();
+		}
+	}
+
+	FORCEINLINE bool IsLargePageCandidate(SIZE_T Size)
+	{
+		return GLargePageSize && Size >= GLargePageSize && (Size % GLargePageSize) == 0;
+	}
+}
+
 #if ENABLE_WIN_ALLOC_TRACKING
 // This allows tracking of allocations that don't happen within the engine's wrappers.
 // You will probably want to set conditional breakpoints here to capture specific allocations
@@ -91,6 +139,18 @@ void FWindowsPlatformMemory::Init()
 		MemoryConstants.TotalPhysicalGB );
 #endif //PLATFORM_32BITS
 
+	if (WindowsPlatformMemory::GLargePagesRequested)
+	{
+		if (WindowsPlatformMemory::GLargePageSize)
+		{
+			UE_LOG(LogMemory, Log, TEXT("Large pages of %lluKB enabled for OS allocations that are a multiple of that size"), (uint64)WindowsPlatformMemory::GLargePageSize / 1024);
+		}
+		else
+		{
+			UE_LOG(LogMemory, Warning, TEXT("-largepages was requested but large pages are unavailable; the account needs the 'Lock pages in memory' right"));
+		}
+	}
+
 	// program size is hard to ascertain and isn't so relevant on Windows. For now just set to zero.
 	LLM(FLowLevelMemTracker::Get().SetProgramSize(0));
 
@@ -200,6 +260,12 @@ FMalloc* FWindowsPlatformMemory::BaseAllocator()
 
 #endif // !UE_BUILD_SHIPPING
 
+	// Also honored in shipping, this is mainly meant for dedicated servers with large resident heaps
+	if (FCString::Stristr(::GetCommandLineW(), TEXT("-largepages")))
+	{
+		WindowsPlatformMemory::InitLargePages();
+	}
+
 	switch (AllocatorToUse)
 	{
 	case EMemoryAllocatorToUse::Ansi:
@@ -286,6 +352,9 @@ FPlatformMemoryStats FWindowsPlatformMemory::GetStats()
 	MemoryStats.UsedVirtual = ProcessMemoryCounters.PagefileUsage;
 	MemoryStats.PeakUsedVirtual = ProcessMemoryCounters.PeakPagefileUsage;
 
+	MemoryStats.LargePageRequested = (uint64)FPlatformAtomics::AtomicRead(&WindowsPlatformMemory::GLargePageRequestedBytes);
+	MemoryStats.LargePageBacked = (uint64)FPlatformAtomics::AtomicRead(&WindowsPlatformMemory::GLargePageBackedBytes);
+
 	if ( GWindowsPlatformMemoryGetStatsLimitTotalGB > 0 )
 	{
 		// if GWindowsPlatformMemoryGetStatsLimitTotalGB is set
@@ -394,6 +463,20 @@ bool FWindowsPlatformMemory::PageProtect(void* const Ptr, const SIZE_T Size, con
 }
 void* FWindowsPlatformMemory::BinnedAllocFromOS( SIZE_T Size )
 {
+	// Large pages have to be committed up front and are never paged out, so only whole large-page multiples qualify
+	if (WindowsPlatformMemory::IsLargePageCandidate(Size))
+	{
+		FPlatformAtomics::InterlockedAdd(&WindowsPlatformMemory::GLargePageRequestedBytes, (int64)Size);
+		if (void* Ptr = VirtualAlloc( NULL, Size, MEM_COMMIT | MEM_RESERVE | MEM_LARGE_PAGES, PAGE_READWRITE ))
+		{
+			FPlatformAtomics::InterlockedAdd(&WindowsPlatformMemory::GLargePageBackedBytes, (int64)Size);
+			LLM_PLATFORM_SCOPE_BYTAG(LargePages);
+			LLM(FLowLevelMemTracker::Get().OnLowLevelAlloc(ELLMTracker::Platform, Ptr, Size));
+			return Ptr;
+		}
+		// physical memory too fragmented to find contiguous large pages, fall back to regular pages
+	}
+
 	void* Ptr = VirtualAlloc( NULL, Size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE );
 	LLM(FLowLevelMemTracker::Get().OnLowLevelAlloc(ELLMTracker::Platform, Ptr, Size));
 	return Ptr;
@@ -403,6 +486,19 @@ void FWindowsPlatformMemory::BinnedFreeToOS( void* Ptr, SIZE_T Size )
 {
 	LLM(FLowLevelMemTracker::Get().OnLowLevelFree(ELLMTracker::Platform, Ptr));
 
+	if (WindowsPlatformMemory::IsLargePageCandidate(Size))
+	{
+		FPlatformAtomics::InterlockedAdd(&WindowsPlatformMemory::GLargePageRequestedBytes, -(int64)Size);
+
+		// large pages are locked, so the working set query always has a valid entry for them
+		PSAPI_WORKING_SET_EX_INFORMATION WorkingSetInfo;
+		WorkingSetInfo.VirtualAddress = Ptr;
+		if (::QueryWorkingSetEx(::GetCurrentProcess(), &WorkingSetInfo, sizeof(WorkingSetInfo)) && WorkingSetInfo.VirtualAttributes.Valid && WorkingSetInfo.VirtualAttributes.LargePage)
+		{
+			FPlatformAtomics::InterlockedAdd(&WindowsPlatformMemory::GLargePageBackedBytes, -(int64)Size);
+		}
+	}
+
 	CA_SUPPRESS(6001)
 	// Windows maintains the size of allocation internally, so Size is unused
 	verify(VirtualFree( Ptr, 0, MEM_RELEASE ) != 0);
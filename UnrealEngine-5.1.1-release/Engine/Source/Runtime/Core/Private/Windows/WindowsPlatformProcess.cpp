@@ -26,6 +26,7 @@
 #include "Misc/CoreDelegates.h"
 #include "Misc/Fork.h"
 #include "ProfilingDebugging/CsvProfiler.h"
+#include "ProfilingDebugging/LockTrace.h"
 
 #include "Windows/AllowWindowsPlatformTypes.h"
 	#include <shellapi.h>
@@ -1490,6 +1491,18 @@ bool FEventWin::Wait(uint32 WaitTime, const bool bIgnoreThreadIdleStats /*= fals
 	check(Event);
 
 	FThreadIdleStats::FScopeIdle Scope( bIgnoreThreadIdleStats );
+#if LOCKTRACE_ENABLED
+	if (WaitTime != 0)
+	{
+		// only waits for an event that is not triggered yet are traced
+		if (WaitForSingleObject( Event, 0 ) == WAIT_OBJECT_0)
+		{
+			return true;
+		}
+		TRACE_LOCK_WAIT_SCOPE(this, ELockTraceType::Event);
+		return (WaitForSingleObject( Event, WaitTime ) == WAIT_OBJECT_0);
+	}
+#endif
 	return (WaitForSingleObject( Event, WaitTime ) == WAIT_OBJECT_0);
 }
 
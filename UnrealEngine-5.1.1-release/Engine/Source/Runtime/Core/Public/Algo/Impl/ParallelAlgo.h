@@ -0,0 +1,114 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Async/ParallelFor.h"
+#include "HAL/UnrealMemory.h"
+#include "Math/UnrealMathUtility.h"
+#include "Templates/MemoryOps.h"
+#include "Templates/UnrealTemplate.h"
+
+namespace AlgoImpl
+{
+	/**
+	 * The parallel algorithms split their range into chunks whose boundaries only depend on the number of elements and never on
+	 * the number of workers, so their results are deterministic, e.g. for floating point operations that are not associative.
+	 */
+	struct FParallelChunks
+	{
+		// chunks are never smaller than this, smaller ranges are processed sequentially
+		static constexpr int32 DefaultMinChunkSize = 4096;
+		// enough chunks to keep the workers of big machines busy while they steal from each other
+		static constexpr int32 DefaultMaxNumChunks = 256;
+
+		int32 Num;
+		int32 ChunkSize;
+		int32 NumChunks;
+
+		explicit FParallelChunks(int32 InNum, int32 MinChunkSize = DefaultMinChunkSize, int32 MaxNumChunks = DefaultMaxNumChunks)
+			: Num(InNum)
+		{
+			ChunkSize = FMath::Max(FMath::Max(MinChunkSize, 1), FMath::DivideAndRoundUp(Num, MaxNumChunks));
+			NumChunks = Num > 0 ? FMath::DivideAndRoundUp(Num, ChunkSize) : 0;
+		}
+
+		int32 Begin(int32 ChunkIndex) const
+		{
+			return ChunkIndex * ChunkSize;
+		}
+
+		int32 End(int32 ChunkIndex) const
+		{
+			return FMath::Min(Begin(ChunkIndex) + ChunkSize, Num);
+		}
+	};
+
+	/** Calls Body(ChunkIndex, Begin, End) for all chunks in parallel */
+	template <typename BodyType>
+	void ParallelForChunks(const TCHAR* DebugName, const FParallelChunks& Chunks, const BodyType& Body)
+	{
+		ParallelForTemplate(DebugName, Chunks.NumChunks, 1, [&Chunks, &Body](int32 ChunkIndex)
+		{
+			Body(ChunkIndex, Chunks.Begin(ChunkIndex), Chunks.End(ChunkIndex));
+		}, Chunks.NumChunks > 1 ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+	}
+
+	/** Scratch memory for the out-of-place algorithms, the elements are constructed by the first pass and destructed with the buffer */
+	template <typename T>
+	class TParallelScratchBuffer
+	{
+	public:
+		UE_NONCOPYABLE(TParallelScratchBuffer);
+
+		explicit TParallelScratchBuffer(int32 InNum)
+			: Data((T*)FMemory::Malloc(sizeof(T) * InNum, alignof(T)))
+			, Num(InNum)
+		{
+		}
+
+		~TParallelScratchBuffer()
+		{
+			if (bConstructed)
+			{
+				DestructItems(Data, Num);
+			}
+			FMemory::Free(Data);
+		}
+
+		T* GetData()
+		{
+			return Data;
+		}
+
+		// called once all elements were move constructed
+		void MarkConstructed()
+		{
+			bConstructed = true;
+		}
+
+		bool IsConstructed() const
+		{
+			return bConstructed;
+		}
+
+	private:
+		T* Data;
+		int32 Num;
+		bool bConstructed = false;
+	};
+
+	/** Moves Source into Dest, which is uninitialized memory if bConstruct is true */
+	template <bool bConstruct, typename T>
+	FORCEINLINE void MoveInto(T& Dest, T& Source)
+	{
+		if constexpr (bConstruct)
+		{
+			new (&Dest) T(MoveTemp(Source));
+		}
+		else
+		{
+			Dest = MoveTemp(Source);
+		}
+	}
+}
@@ -0,0 +1,69 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Algo/Accumulate.h"
+#include "Algo/Impl/ParallelAlgo.h"
+#include "Containers/Array.h"
+#include "Templates/IdentityFunctor.h"
+#include "Templates/Invoke.h"
+#include "Templates/UnrealTemplate.h" // For GetData, GetNum, MoveTemp
+
+
+namespace Algo
+{
+	/**
+	 * Reduces a range by applying MapOp to each element and combining the results with ReduceOp on the task system workers.
+	 * ReduceOp must be associative. The elements are combined in order within chunks of a fixed size and the chunk results in
+	 * chunk order, so the result is deterministic, but for non-associative operations (e.g. floating point sums) it may differ from Algo::TransformAccumulate.
+	 *
+	 * @param  Input     The range to reduce.
+	 * @param  Init      The value the results of all elements are combined with, first.
+	 * @param  ReduceOp  The binary operation to combine results with.
+	 * @param  MapOp     The operation that maps an element to the value to reduce.
+	 *
+	 * @return The reduced value, Init for an empty range.
+	 */
+	template <typename T, typename RangeType, typename ReduceOpType, typename MapOpType>
+	T ParallelTransformReduce(const RangeType& Input, T Init, ReduceOpType ReduceOp, MapOpType MapOp)
+	{
+		const auto* First = GetData(Input);
+		const AlgoImpl::FParallelChunks Chunks(GetNum(Input));
+
+		TArray<T> Partials;
+		Partials.Init(Init, Chunks.NumChunks);
+
+		AlgoImpl::ParallelForChunks(TEXT("Algo::ParallelReduce"), Chunks, [First, &Partials, &ReduceOp, &MapOp](int32 ChunkIndex, int32 Begin, int32 End)
+		{
+			T Partial = Invoke(MapOp, First[Begin]);
+			for (int32 Index = Begin + 1; Index < End; ++Index)
+			{
+				Partial = Invoke(ReduceOp, MoveTemp(Partial), Invoke(MapOp, First[Index]));
+			}
+			Partials[ChunkIndex] = MoveTemp(Partial);
+		});
+
+		T Result = MoveTemp(Init);
+		for (T& Partial : Partials)
+		{
+			Result = Invoke(ReduceOp, MoveTemp(Result), MoveTemp(Partial));
+		}
+		return Result;
+	}
+
+	/**
+	 * Reduces a range with ReduceOp on the task system workers. ReduceOp must be associative, see ParallelTransformReduce.
+	 *
+	 * @param  Input     The range to reduce.
+	 * @param  Init      The value the elements are combined with, first.
+	 * @param  ReduceOp  The binary operation to combine elements with (the default is TPlus<>).
+	 *
+	 * @return The reduced value, Init for an empty range.
+	 */
+	template <typename T, typename RangeType, typename ReduceOpType = TPlus<>>
+	T ParallelReduce(const RangeType& Input, T Init, ReduceOpType ReduceOp = ReduceOpType())
+	{
+		return ParallelTransformReduce(Input, MoveTemp(Init), MoveTemp(ReduceOp), FIdentityFunctor());
+	}
+}
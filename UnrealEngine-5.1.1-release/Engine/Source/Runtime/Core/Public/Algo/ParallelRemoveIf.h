@@ -0,0 +1,64 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Algo/Impl/ParallelAlgo.h"
+#include "Algo/RemoveIf.h"
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Templates/UnrealTemplate.h" // For GetData, GetNum, MoveTemp
+
+#include <type_traits>
+
+namespace Algo
+{
+	/**
+	 * Moves all elements which do not match the predicate to the front of the range, while leaving all
+	 * other elements is a constructed but unspecified state. The predicate is evaluated on the task system workers,
+	 * the elements which were not removed are guaranteed to be kept in order (stable).
+	 *
+	 * @param  Range  The range of elements to manipulate.
+	 * @param  Pred   A callable which maps elements to truthy values, specifying elements to be removed. It is called concurrently.
+	 *
+	 * @return The index of the first element after those which were not removed.
+	 */
+	template <typename RangeType, typename Predicate>
+	int32 ParallelRemoveIf(RangeType& Range, Predicate Pred)
+	{
+		auto* First = GetData(Range);
+		const AlgoImpl::FParallelChunks Chunks(GetNum(Range));
+		if (Chunks.NumChunks <= 1)
+		{
+			return StableRemoveIf(Range, MoveTemp(Pred));
+		}
+
+		// every chunk is compacted in place first
+		TArray<int32, TInlineAllocator<AlgoImpl::FParallelChunks::DefaultMaxNumChunks>> NumKept;
+		NumKept.SetNumUninitialized(Chunks.NumChunks);
+		AlgoImpl::ParallelForChunks(TEXT("Algo::ParallelRemoveIf"), Chunks, [First, &NumKept, &Pred](int32 ChunkIndex, int32 Begin, int32 End)
+		{
+			TArrayView<std::remove_pointer_t<decltype(First)>> Chunk(First + Begin, End - Begin);
+			NumKept[ChunkIndex] = StableRemoveIf(Chunk, Pred);
+		});
+
+		// the kept elements of a chunk can overlap the ones of the previous chunk, so they are moved down sequentially
+		int32 Write = NumKept[0];
+		for (int32 ChunkIndex = 1; ChunkIndex < Chunks.NumChunks; ++ChunkIndex)
+		{
+			const int32 Begin = Chunks.Begin(ChunkIndex);
+			if (Write != Begin)
+			{
+				for (int32 Index = Begin, End = Begin + NumKept[ChunkIndex]; Index < End; ++Index)
+				{
+					First[Write++] = MoveTemp(First[Index]);
+				}
+			}
+			else
+			{
+				Write += NumKept[ChunkIndex];
+			}
+		}
+		return Write;
+	}
+}
@@ -0,0 +1,107 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Algo/Accumulate.h"
+#include "Algo/Impl/ParallelAlgo.h"
+#include "Containers/Array.h"
+#include "Templates/Invoke.h"
+#include "Templates/UnrealTemplate.h" // For GetData, GetNum, MoveTemp
+
+#include <type_traits>
+
+namespace AlgoImpl
+{
+	/**
+	 * Three phases: the chunks are summed up in parallel, the chunk sums are scanned sequentially and then every chunk
+	 * is scanned in parallel, starting with the sum of all previous chunks. Input and Output may be the same.
+	 */
+	template <typename InputType, typename OutputType, typename OpType>
+	void ParallelInclusiveScanInternal(const InputType* Input, OutputType* Output, int32 Num, OpType& Op)
+	{
+		using ValueType = std::decay_t<OutputType>;
+
+		const FParallelChunks Chunks(Num);
+		if (Chunks.NumChunks <= 1)
+		{
+			if (Num > 0)
+			{
+				ValueType Sum = Input[0];
+				Output[0] = Sum;
+				for (int32 Index = 1; Index < Num; ++Index)
+				{
+					Sum = Invoke(Op, MoveTemp(Sum), Input[Index]);
+					Output[Index] = Sum;
+				}
+			}
+			return;
+		}
+
+		// the sum of the last chunk is not needed
+		TArray<ValueType> Carries;
+		Carries.Reserve(Chunks.NumChunks);
+		for (int32 ChunkIndex = 0; ChunkIndex < Chunks.NumChunks; ++ChunkIndex)
+		{
+			Carries.Add(Input[Chunks.Begin(ChunkIndex)]);
+		}
+
+		ParallelForTemplate(TEXT("Algo::ParallelInclusiveScan.Sum"), Chunks.NumChunks - 1, 1, [Input, &Chunks, &Carries, &Op](int32 ChunkIndex)
+		{
+			ValueType Sum = Carries[ChunkIndex];
+			for (int32 Index = Chunks.Begin(ChunkIndex) + 1, End = Chunks.End(ChunkIndex); Index < End; ++Index)
+			{
+				Sum = Invoke(Op, MoveTemp(Sum), Input[Index]);
+			}
+			Carries[ChunkIndex] = MoveTemp(Sum);
+		});
+
+		// Carries[ChunkIndex] becomes the sum of all chunks before ChunkIndex, for ChunkIndex > 0
+		for (int32 ChunkIndex = 1; ChunkIndex < Chunks.NumChunks - 1; ++ChunkIndex)
+		{
+			Carries[ChunkIndex] = Invoke(Op, Carries[ChunkIndex - 1], Carries[ChunkIndex]);
+		}
+
+		ParallelForChunks(TEXT("Algo::ParallelInclusiveScan.Scan"), Chunks, [Input, Output, &Carries, &Op](int32 ChunkIndex, int32 Begin, int32 End)
+		{
+			ValueType Sum = ChunkIndex == 0 ? ValueType(Input[Begin]) : ValueType(Invoke(Op, Carries[ChunkIndex - 1], Input[Begin]));
+			Output[Begin] = Sum;
+			for (int32 Index = Begin + 1; Index < End; ++Index)
+			{
+				Sum = Invoke(Op, MoveTemp(Sum), Input[Index]);
+				Output[Index] = Sum;
+			}
+		});
+	}
+}
+
+namespace Algo
+{
+	/**
+	 * Writes the inclusive prefix sums of Input to Output on the task system workers, i.e. Output[i] = Input[0] Op ... Op Input[i].
+	 * Op must be associative. The partial sums are formed in an order that only depends on the number of elements, so the result is deterministic,
+	 * but for non-associative operations (e.g. floating point sums) it may differ from a sequential scan.
+	 *
+	 * @param  Input   The range to scan.
+	 * @param  Output  The range to write the prefix sums to, it must have as many elements as Input. It may be the same range as Input.
+	 * @param  Op      The binary operation to combine elements with (the default is TPlus<>).
+	 */
+	template <typename InputRangeType, typename OutputRangeType, typename OpType = TPlus<>>
+	void ParallelInclusiveScan(const InputRangeType& Input, OutputRangeType&& Output, OpType Op = OpType())
+	{
+		check(GetNum(Input) == GetNum(Output));
+		AlgoImpl::ParallelInclusiveScanInternal(GetData(Input), GetData(Output), GetNum(Input), Op);
+	}
+
+	/**
+	 * Replaces the elements of a range with their inclusive prefix sums on the task system workers, see ParallelInclusiveScan.
+	 *
+	 * @param  Range  The range to scan.
+	 * @param  Op     The binary operation to combine elements with (the default is TPlus<>).
+	 */
+	template <typename RangeType, typename OpType = TPlus<>>
+	void ParallelInclusiveScanInPlace(RangeType&& Range, OpType Op = OpType())
+	{
+		AlgoImpl::ParallelInclusiveScanInternal(GetData(Range), GetData(Range), GetNum(Range), Op);
+	}
+}
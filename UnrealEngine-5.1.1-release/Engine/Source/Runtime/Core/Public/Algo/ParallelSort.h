@@ -0,0 +1,384 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Impl/ParallelAlgo.h"
+#include "Algo/IntroSort.h"
+#include "Algo/StableSort.h"
+#include "Containers/Array.h"
+#include "Templates/IdentityFunctor.h"
+#include "Templates/Invoke.h"
+#include "Templates/IsIntegral.h"
+#include "Templates/IsSigned.h"
+#include "Templates/Less.h"
+#include "Templates/UnrealTemplate.h" // For GetData, GetNum
+
+#include <type_traits>
+
+namespace AlgoImpl
+{
+	/**
+	 * Merges the sorted ranges A and B into Out. Elements of A precede equivalent elements of B, so merging keeps the order of a stable sort.
+	 */
+	template <bool bConstruct, typename T, typename ProjectionType, typename PredicateType>
+	void ParallelMergeRange(T* A, int32 NumA, T* B, int32 NumB, T* Out, ProjectionType& Projection, PredicateType& Predicate)
+	{
+		int32 IndexA = 0;
+		int32 IndexB = 0;
+		while (IndexA < NumA && IndexB < NumB)
+		{
+			if (Invoke(Predicate, Invoke(Projection, B[IndexB]), Invoke(Projection, A[IndexA])))
+			{
+				MoveInto<bConstruct>(*Out++, B[IndexB++]);
+			}
+			else
+			{
+				MoveInto<bConstruct>(*Out++, A[IndexA++]);
+			}
+		}
+		for (; IndexA < NumA; ++IndexA)
+		{
+			MoveInto<bConstruct>(*Out++, A[IndexA]);
+		}
+		for (; IndexB < NumB; ++IndexB)
+		{
+			MoveInto<bConstruct>(*Out++, B[IndexB]);
+		}
+	}
+
+	/**
+	 * Merges all pairs of neighbouring sorted runs of Src into Dst in parallel. The merges of the last levels are split into
+	 * several parts at positions found by binary search, so they don't serialize on a single worker.
+	 */
+	template <bool bConstruct, typename T, typename ProjectionType, typename PredicateType>
+	void ParallelMergeLevel(T* Src, T* Dst, int32 Num, int32 RunSize, int32 TargetNumParts, ProjectionType& Projection, PredicateType& Predicate)
+	{
+		const int32 NumPairs = FMath::DivideAndRoundUp(Num, 2 * RunSize);
+		const int32 PartsPerPair = FMath::Max(1, TargetNumParts / NumPairs);
+
+		ParallelForTemplate(TEXT("Algo::ParallelSort.Merge"), NumPairs * PartsPerPair, 1, [=, &Projection, &Predicate](int32 Index)
+		{
+			const int32 PairBegin = (Index / PartsPerPair) * 2 * RunSize;
+			const int32 Part = Index % PartsPerPair;
+
+			T* A = Src + PairBegin;
+			const int32 NumA = FMath::Min(RunSize, Num - PairBegin);
+			T* B = A + NumA;
+			const int32 NumB = FMath::Min(RunSize, Num - PairBegin - NumA);
+
+			// a part starts at an element of A and at the first element of B that doesn't precede it
+			auto SplitPoint = [&](int32 SplitPart, int32& OutIndexA, int32& OutIndexB)
+			{
+				if (SplitPart == PartsPerPair)
+				{
+					OutIndexA = NumA;
+					OutIndexB = NumB;
+					return;
+				}
+				OutIndexA = (int32)(((int64)SplitPart * NumA) / PartsPerPair);
+				OutIndexB = SplitPart == 0 ? 0 : AlgoImpl::LowerBoundInternal(B, NumB, Invoke(Projection, A[OutIndexA]), Projection, Predicate);
+			};
+
+			int32 BeginA, BeginB, EndA, EndB;
+			SplitPoint(Part, BeginA, BeginB);
+			SplitPoint(Part + 1, EndA, EndB);
+
+			ParallelMergeRange<bConstruct>(A + BeginA, EndA - BeginA, B + BeginB, EndB - BeginB, Dst + PairBegin + BeginA + BeginB, Projection, Predicate);
+		}, NumPairs * PartsPerPair > 1 ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+	}
+
+	/**
+	 * Sorts the chunks of the range in parallel and merges them level by level through a scratch buffer.
+	 * The result only depends on the input and is the same for every run and any number of workers.
+	 */
+	template <bool bStable, typename T, typename ProjectionType, typename PredicateType>
+	void ParallelMergeSortInternal(T* First, int32 Num, ProjectionType Projection, PredicateType Predicate)
+	{
+		const FParallelChunks Chunks(Num);
+		if (Chunks.NumChunks <= 1)
+		{
+			if constexpr (bStable)
+			{
+				StableSortInternal(First, Num, MoveTemp(Projection), MoveTemp(Predicate));
+			}
+			else
+			{
+				IntroSortInternal(First, Num, MoveTemp(Projection), MoveTemp(Predicate));
+			}
+			return;
+		}
+
+		ParallelForChunks(TEXT("Algo::ParallelSort.Chunks"), Chunks, [First, &Projection, &Predicate](int32 ChunkIndex, int32 Begin, int32 End)
+		{
+			if constexpr (bStable)
+			{
+				StableSortInternal(First + Begin, End - Begin, Projection, Predicate);
+			}
+			else
+			{
+				IntroSortInternal(First + Begin, End - Begin, Projection, Predicate);
+			}
+		});
+
+		TParallelScratchBuffer<T> Scratch(Num);
+		T* Src = First;
+		T* Dst = Scratch.GetData();
+		for (int32 RunSize = Chunks.ChunkSize; RunSize < Num; RunSize *= 2)
+		{
+			if (Scratch.IsConstructed())
+			{
+				ParallelMergeLevel<false>(Src, Dst, Num, RunSize, Chunks.NumChunks, Projection, Predicate);
+			}
+			else
+			{
+				ParallelMergeLevel<true>(Src, Dst, Num, RunSize, Chunks.NumChunks, Projection, Predicate);
+				Scratch.MarkConstructed();
+			}
+			Swap(Src, Dst);
+		}
+
+		if (Src != First)
+		{
+			ParallelForChunks(TEXT("Algo::ParallelSort.MoveBack"), Chunks, [First, Src](int32 ChunkIndex, int32 Begin, int32 End)
+			{
+				for (int32 Index = Begin; Index < End; ++Index)
+				{
+					First[Index] = MoveTemp(Src[Index]);
+				}
+			});
+		}
+	}
+
+	/**
+	 * Parallel LSD radix sort on 8 bit digits of an integer key. The histograms are built per chunk and the elements are scattered
+	 * in chunk order, which makes the sort stable. Passes are skipped for digits that are the same for all keys.
+	 */
+	template <typename T, typename ProjectionType>
+	void ParallelRadixSortInternal(T* First, int32 Num, ProjectionType Projection)
+	{
+		using KeyType = std::decay_t<decltype(Invoke(Projection, *First))>;
+		static_assert(TIsIntegral<KeyType>::Value && !std::is_same_v<KeyType, bool>, "ParallelRadixSort requires integer keys");
+		using UnsignedKeyType = std::make_unsigned_t<KeyType>;
+
+		constexpr int32 NumDigits = 256;
+		constexpr int32 NumPasses = sizeof(KeyType);
+
+		auto GetKey = [&Projection](const T& Element) -> UnsignedKeyType
+		{
+			UnsignedKeyType Key = (UnsignedKeyType)Invoke(Projection, Element);
+			if constexpr (TIsSigned<KeyType>::Value)
+			{
+				// negative keys go first
+				Key ^= UnsignedKeyType(1) << (sizeof(KeyType) * 8 - 1);
+			}
+			return Key;
+		};
+
+		const FParallelChunks Chunks(Num);
+		if (Num < 2)
+		{
+			return;
+		}
+
+		TArray<int32> Offsets;
+		Offsets.SetNumUninitialized(Chunks.NumChunks * NumDigits);
+		TParallelScratchBuffer<T> Scratch(Num);
+		T* Src = First;
+		T* Dst = Scratch.GetData();
+
+		for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+		{
+			const int32 Shift = Pass * 8;
+			ParallelForChunks(TEXT("Algo::ParallelRadixSort.Histogram"), Chunks, [&](int32 ChunkIndex, int32 Begin, int32 End)
+			{
+				int32* Histogram = Offsets.GetData() + ChunkIndex * NumDigits;
+				FMemory::Memzero(Histogram, sizeof(int32) * NumDigits);
+				for (int32 Index = Begin; Index < End; ++Index)
+				{
+					++Histogram[(GetKey(Src[Index]) >> Shift) & (NumDigits - 1)];
+				}
+			});
+
+			// turn the counts into the first destination of each chunk and digit, in digit major order so the scatter is stable
+			bool bSingleDigit = false;
+			int32 Offset = 0;
+			for (int32 Digit = 0; Digit < NumDigits; ++Digit)
+			{
+				const int32 DigitBegin = Offset;
+				for (int32 ChunkIndex = 0; ChunkIndex < Chunks.NumChunks; ++ChunkIndex)
+				{
+					int32& Count = Offsets[ChunkIndex * NumDigits + Digit];
+					const int32 ChunkCount = Count;
+					Count = Offset;
+					Offset += ChunkCount;
+				}
+				bSingleDigit |= Offset - DigitBegin == Num;
+			}
+			if (bSingleDigit)
+			{
+				continue;
+			}
+
+			auto Scatter = [&](auto bConstruct)
+			{
+				ParallelForChunks(TEXT("Algo::ParallelRadixSort.Scatter"), Chunks, [&](int32 ChunkIndex, int32 Begin, int32 End)
+				{
+					int32* ChunkOffsets = Offsets.GetData() + ChunkIndex * NumDigits;
+					for (int32 Index = Begin; Index < End; ++Index)
+					{
+						const int32 Destination = ChunkOffsets[(GetKey(Src[Index]) >> Shift) & (NumDigits - 1)]++;
+						MoveInto<decltype(bConstruct)::value>(Dst[Destination], Src[Index]);
+					}
+				});
+			};
+
+			if (Scratch.IsConstructed())
+			{
+				Scatter(std::false_type());
+			}
+			else
+			{
+				Scatter(std::true_type());
+				Scratch.MarkConstructed();
+			}
+			Swap(Src, Dst);
+		}
+
+		if (Src != First)
+		{
+			ParallelForChunks(TEXT("Algo::ParallelRadixSort.MoveBack"), Chunks, [First, Src](int32 ChunkIndex, int32 Begin, int32 End)
+			{
+				for (int32 Index = Begin; Index < End; ++Index)
+				{
+					First[Index] = MoveTemp(Src[Index]);
+				}
+			});
+		}
+	}
+
+	template <typename RangeType>
+	using TParallelSortElementType = std::remove_cv_t<std::remove_pointer_t<decltype(GetData(DeclVal<RangeType&>()))>>;
+
+	template <typename KeyType>
+	constexpr bool TIsRadixSortKey_V = TIsIntegral<KeyType>::Value && !std::is_same_v<KeyType, bool>;
+}
+
+namespace Algo
+{
+	/**
+	 * Sort a range of elements using its operator< on the task system workers. The sort is unstable, but deterministic: the result only
+	 * depends on the input, not on the number of workers or the timing of their execution. Ranges of integers are radix sorted.
+	 *
+	 * @param  Range  The range to sort.
+	 */
+	template <typename RangeType>
+	void ParallelSort(RangeType&& Range)
+	{
+		using ElementType = AlgoImpl::TParallelSortElementType<RangeType>;
+		if constexpr (AlgoImpl::TIsRadixSortKey_V<ElementType>)
+		{
+			AlgoImpl::ParallelRadixSortInternal(GetData(Range), GetNum(Range), FIdentityFunctor());
+		}
+		else
+		{
+			AlgoImpl::ParallelMergeSortInternal<false>(GetData(Range), GetNum(Range), FIdentityFunctor(), TLess<>());
+		}
+	}
+
+	/**
+	 * Sort a range of elements using a user-defined predicate class on the task system workers. The sort is unstable, but deterministic.
+	 *
+	 * @param  Range      The range to sort.
+	 * @param  Predicate  A binary predicate object used to specify if one element should precede another.
+	 */
+	template <typename RangeType, typename PredicateType>
+	void ParallelSort(RangeType&& Range, PredicateType Pred)
+	{
+		AlgoImpl::ParallelMergeSortInternal<false>(GetData(Range), GetNum(Range), FIdentityFunctor(), MoveTemp(Pred));
+	}
+
+	/**
+	 * Sort a range of elements by a projection using the projection's operator< on the task system workers. The sort is unstable, but deterministic.
+	 * Integer projections are radix sorted.
+	 *
+	 * @param  Range  The range to sort.
+	 * @param  Proj   The projection to sort by when applied to the element.
+	 */
+	template <typename RangeType, typename ProjectionType>
+	void ParallelSortBy(RangeType&& Range, ProjectionType Proj)
+	{
+		using ElementType = AlgoImpl::TParallelSortElementType<RangeType>;
+		using KeyType = std::decay_t<decltype(Invoke(Proj, DeclVal<ElementType&>()))>;
+		if constexpr (AlgoImpl::TIsRadixSortKey_V<KeyType>)
+		{
+			AlgoImpl::ParallelRadixSortInternal(GetData(Range), GetNum(Range), MoveTemp(Proj));
+		}
+		else
+		{
+			AlgoImpl::ParallelMergeSortInternal<false>(GetData(Range), GetNum(Range), MoveTemp(Proj), TLess<>());
+		}
+	}
+
+	/**
+	 * Sort a range of elements by a projection using a user-defined predicate class on the task system workers. The sort is unstable, but deterministic.
+	 *
+	 * @param  Range      The range to sort.
+	 * @param  Proj       The projection to sort by when applied to the element.
+	 * @param  Predicate  A binary predicate object, applied to the projection, used to specify if one element should precede another.
+	 */
+	template <typename RangeType, typename ProjectionType, typename PredicateType>
+	void ParallelSortBy(RangeType&& Range, ProjectionType Proj, PredicateType Pred)
+	{
+		AlgoImpl::ParallelMergeSortInternal<false>(GetData(Range), GetNum(Range), MoveTemp(Proj), MoveTemp(Pred));
+	}
+
+	/**
+	 * Sort a range of elements using its operator< on the task system workers. The sort is stable.
+	 *
+	 * @param  Range  The range to sort.
+	 */
+	template <typename RangeType>
+	void ParallelStableSort(RangeType&& Range)
+	{
+		AlgoImpl::ParallelMergeSortInternal<true>(GetData(Range), GetNum(Range), FIdentityFunctor(), TLess<>());
+	}
+
+	/**
+	 * Sort a range of elements using a user-defined predicate class on the task system workers. The sort is stable.
+	 *
+	 * @param  Range      The range to sort.
+	 * @param  Predicate  A binary predicate object used to specify if one element should precede another.
+	 */
+	template <typename RangeType, typename PredicateType>
+	void ParallelStableSort(RangeType&& Range, PredicateType Pred)
+	{
+		AlgoImpl::ParallelMergeSortInternal<true>(GetData(Range), GetNum(Range), FIdentityFunctor(), MoveTemp(Pred));
+	}
+
+	/**
+	 * Sort a range of elements by a projection using a user-defined predicate class on the task system workers. The sort is stable.
+	 *
+	 * @param  Range      The range to sort.
+	 * @param  Proj       The projection to sort by when applied to the element.
+	 * @param  Predicate  A binary predicate object, applied to the projection, used to specify if one element should precede another.
+	 */
+	template <typename RangeType, typename ProjectionType, typename PredicateType = TLess<>>
+	void ParallelStableSortBy(RangeType&& Range, ProjectionType Proj, PredicateType Pred = PredicateType())
+	{
+		AlgoImpl::ParallelMergeSortInternal<true>(GetData(Range), GetNum(Range), MoveTemp(Proj), MoveTemp(Pred));
+	}
+
+	/**
+	 * Sort a range of elements by an integer key on the task system workers with a radix sort. The sort is stable.
+	 *
+	 * @param  Range  The range to sort.
+	 * @param  Proj   The projection that returns the integer key of an element.
+	 */
+	template <typename RangeType, typename ProjectionType>
+	void ParallelRadixSortBy(RangeType&& Range, ProjectionType Proj)
+	{
+		AlgoImpl::ParallelRadixSortInternal(GetData(Range), GetNum(Range), MoveTemp(Proj));
+	}
+}
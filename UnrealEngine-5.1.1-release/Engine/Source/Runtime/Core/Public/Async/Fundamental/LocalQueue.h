@@ -2,7 +2,10 @@
 
 #pragma once
 #include "CoreTypes.h"
+#include "Containers/Array.h"
 #include "Math/RandomStream.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/SpinLock.h"
 #include "Experimental/Containers/FAAArrayQueue.h"
 #include "ProfilingDebugging/CpuProfilerTrace.h"
 #include "Async/Fundamental/Task.h"
@@ -134,6 +137,9 @@ enum class ELocalQueueType
  * or when a Thread has no LocalQueue installed or when the LocalQueue is at capacity. A new LocalQueue is registers itself always.         *
  * A Dequeue Operation can only be done starting from a LocalQueue, than the GlobalQueue will be checked.                                   *
  * Finally Items might get Stolen from other LocalQueues that are registered with the LocalQueueRegistry.                                   *
+ * On NUMA systems LocalQueues can be assigned to a node, they prefer Stealing from the same node and each node has its own OverflowQueue    *
+ * that only the LocalQueues of that node dequeue from, while other LocalQueues only take Items from it when they run out of other work.    *
+ * Items with a deadline go into a single DeadlineQueue ordered Earliest-Deadline-First that is checked before any other queue.           *
  ********************************************************************************************************************************************/
 template<uint32 NumLocalItems = 1024>
 class TLocalQueueRegistry
@@ -141,6 +147,9 @@ class TLocalQueueRegistry
 public:
 	class TLocalQueue;
 
+	static constexpr uint32 InvalidNumaNode = ~0u;
+	static constexpr uint32 MaxNumaNodes = 8;
+
 	// FOutOfWork is used to track the time while a worker is waiting for work
 	// this happens after a worker was unable to aquire any task from the queues and until it finds work again or it goes into drowsing state.
 	class FOutOfWork
@@ -235,6 +244,31 @@ private:
 	};
 	using FStealHazard = THazardPointer<FLocalQueueCollection, true>;
 
+	// FNumaNodeQueues are the OverflowQueues of a NUMA node, they are allocated when the number of nodes is set and live as long as the Registry
+	struct FNumaNodeQueues
+	{
+		FOverflowQueueType OverflowQueues[uint32(ETaskPriority::Count)];
+	};
+
+	// FDeadlineQueue is a min-heap of Items by their deadline, it is expected to hold only a handful of frame critical Items at a time
+	struct FDeadlineItem
+	{
+		uint64 Deadline;
+		FTask* Item;
+
+		bool operator<(const FDeadlineItem& Other) const
+		{
+			return Deadline < Other.Deadline;
+		}
+	};
+
+	struct FDeadlineQueue
+	{
+		UE::FSpinLock Lock;
+		TArray<FDeadlineItem> Heap;
+		std::atomic<int32> Num { 0 };
+	};
+
 public:
 	class TLocalQueue
 	{
@@ -242,22 +276,30 @@ public:
 		friend class TLocalQueueRegistry;
 
 	public:
-		TLocalQueue(TLocalQueueRegistry& InRegistry, ELocalQueueType QueueType, FSleepEvent* InSleepEvent) : Registry(&InRegistry), SleepEvent(InSleepEvent)
+		TLocalQueue(TLocalQueueRegistry& InRegistry, ELocalQueueType InQueueType, FSleepEvent* InSleepEvent, uint32 InNumaNode = InvalidNumaNode) : Registry(&InRegistry), SleepEvent(InSleepEvent), QueueType(InQueueType)
 		{
 			checkSlow(Registry);
+			// the node queues have to exist before queues are assigned to a node, otherwise the queue is not node local
+			NumaNodeQueues = InNumaNode < Registry->NumNumaNodes.load(std::memory_order_acquire) ? Registry->NumaNodeQueues[InNumaNode] : nullptr;
+			NumaNode = NumaNodeQueues ? InNumaNode : InvalidNumaNode;
+
 			StealHazard = FStealHazard(Registry->QueueCollection, Registry->HazardsCollection);
 			AffinityIndex = Registry->AddLocalQueue(StealHazard, this, QueueType);
 			for (int32 PriorityIndex = 0; PriorityIndex < int32(ETaskPriority::Count); PriorityIndex++)
 			{
 				DequeueHazards[PriorityIndex] = Registry->OverflowQueues[PriorityIndex].getHeadHazard();
+				if (NumaNodeQueues)
+				{
+					NumaDequeueHazards[PriorityIndex] = NumaNodeQueues->OverflowQueues[PriorityIndex].getHeadHazard();
+				}
 			}
 			AffinityHazard = AffinityQueue.getHeadHazard();
 		}
 
-		static TLocalQueue* AllocateLocalQueue(TLocalQueueRegistry& InRegistry, ELocalQueueType QueueType, FSleepEvent* InSleepEvent = nullptr)
+		static TLocalQueue* AllocateLocalQueue(TLocalQueueRegistry& InRegistry, ELocalQueueType QueueType, FSleepEvent* InSleepEvent = nullptr, uint32 InNumaNode = InvalidNumaNode)
 		{
 			void* Memory = FMemory::Malloc(sizeof(TLocalQueue), 128u);
-			return new (Memory) TLocalQueue(InRegistry, QueueType, InSleepEvent);
+			return new (Memory) TLocalQueue(InRegistry, QueueType, InSleepEvent, InNumaNode);
 		}
 
 		//delete a queue
@@ -301,6 +343,12 @@ public:
 
 		inline FTask* DequeueLocal(bool GetBackGroundTasks, bool bDisableThrottleStealing)
 		{
+			// Items with a deadline are only queued for foreground priorities and go ahead of everything else
+			if (FTask* Item = Registry->DequeueDeadline(DequeuedDeadline))
+			{
+				return Item;
+			}
+
 			int32 MaxPriority = GetBackGroundTasks ? int32(ETaskPriority::Count) : int32(ETaskPriority::ForegroundCount);
 			for (int32 PriorityIndex = 0; PriorityIndex < MaxPriority; PriorityIndex++)
 			{
@@ -320,6 +368,16 @@ public:
 				int32 MaxPriority = GetBackGroundTasks ? int32(ETaskPriority::Count) : int32(ETaskPriority::ForegroundCount);
 				for (int32 PriorityIndex = 0; PriorityIndex < MaxPriority; PriorityIndex++)
 				{
+					// Items launched for this node come first, they were queued here because their data is close
+					if (NumaNodeQueues)
+					{
+						FTask* Item = NumaNodeQueues->OverflowQueues[PriorityIndex].dequeue(NumaDequeueHazards[PriorityIndex]);
+						if (Item)
+						{
+							return Item;
+						}
+					}
+
 					FTask* Item = Registry->OverflowQueues[PriorityIndex].dequeue(DequeueHazards[PriorityIndex]);
 					if (Item)
 					{
@@ -339,7 +397,14 @@ public:
 					CachedRandomIndex = Random.GetUnsignedInt();
 				}
 
-				FTask* Result = Registry->StealItem(StealHazard, CachedRandomIndex, CachedPriorityIndex, GetBackGroundTasks);
+				FTask* Result = Registry->StealItem(StealHazard, CachedRandomIndex, CachedPriorityIndex, GetBackGroundTasks, NumaNode);
+				if (Result)
+				{
+					return Result;
+				}
+
+				// help out other nodes last, so that node local Items can't starve while all workers of their node are blocked
+				Result = Registry->DequeueRemoteNuma(NumaNode, GetBackGroundTasks);
 				if (Result)
 				{
 					return Result;
@@ -358,36 +423,63 @@ public:
 			return AffinityIndex;
 		}
 
+		// the NUMA node this queue was assigned to or InvalidNumaNode
+		uint32 GetNumaNode() const
+		{
+			return NumaNode;
+		}
+
+		// returns the deadline of the last Item taken from the DeadlineQueue (or 0) and resets it
+		uint64 ConsumeDequeuedDeadline()
+		{
+			const uint64 Deadline = DequeuedDeadline;
+			DequeuedDeadline = 0;
+			return Deadline;
+		}
+
 	private:
 		inline void EnqueueAffinity(FTask* Item)
 		{
 			check(SleepEvent != nullptr);
 			AffinityQueue.enqueue(Item);
-			
+			WakeUp();
+		}
+
+		// wakes the worker owning this queue if it is drowsing or sleeping, returns false if it is (still) running
+		inline bool WakeUp()
+		{
 			ESleepState SleepState = ESleepState::Sleeping;
 			ESleepState DrowsingState = ESleepState::Drowsing;
 			if (SleepEvent->SleepState.compare_exchange_strong(DrowsingState, ESleepState::Affinity, std::memory_order_acquire))
 			{
+				return true;
 			}
 			else if (SleepEvent->SleepState.compare_exchange_strong(SleepState, ESleepState::Drowsing, std::memory_order_acquire))
 			{
 				SleepEvent->SleepEvent->Trigger();
+				return true;
 			}
+			return false;
 		}
 
 	private:
 		static constexpr uint32	InvalidIndex = ~0u;
 		FLocalQueueType			LocalQueues[uint32(ETaskPriority::Count)];
 		DequeueHazard			DequeueHazards[uint32(ETaskPriority::Count)];
+		DequeueHazard			NumaDequeueHazards[uint32(ETaskPriority::Count)];
 		FOverflowQueueType		AffinityQueue;
 		DequeueHazard			AffinityHazard;
 		FStealHazard			StealHazard;
 		TLocalQueueRegistry*	Registry;
 		FSleepEvent*			SleepEvent;
+		FNumaNodeQueues*		NumaNodeQueues = nullptr;
 		FRandomStream			Random;
 		uint32					CachedRandomIndex = InvalidIndex;
 		uint32					CachedPriorityIndex = 0;
 		uint32					AffinityIndex = ~0;
+		uint32					NumaNode = InvalidNumaNode;
+		uint64					DequeuedDeadline = 0;
+		ELocalQueueType			QueueType;
 	};
 
 	TLocalQueueRegistry()
@@ -395,6 +487,39 @@ public:
 		QueueCollection.store(new FLocalQueueCollection(), std::memory_order_relaxed);
 	}
 
+	~TLocalQueueRegistry()
+	{
+		for (FNumaNodeQueues* NodeQueues : NumaNodeQueues)
+		{
+			delete NodeQueues;
+		}
+	}
+
+	// set the number of NUMA nodes LocalQueues can be assigned to, this has to happen before the LocalQueues of the nodes are created
+	// node queues are never freed while the Registry is alive, so this may only grow the number of nodes
+	void SetNumNumaNodes(uint32 InNumNumaNodes)
+	{
+		InNumNumaNodes = FMath::Min(InNumNumaNodes, MaxNumaNodes);
+		if (InNumNumaNodes <= 1 || InNumNumaNodes <= NumNumaNodes.load(std::memory_order_relaxed))
+		{
+			return;
+		}
+
+		for (uint32 NodeIndex = 0; NodeIndex < InNumNumaNodes; NodeIndex++)
+		{
+			if (NumaNodeQueues[NodeIndex] == nullptr)
+			{
+				NumaNodeQueues[NodeIndex] = new FNumaNodeQueues();
+			}
+		}
+		NumNumaNodes.store(InNumNumaNodes, std::memory_order_release);
+	}
+
+	uint32 GetNumNumaNodes() const
+	{
+		return FMath::Max(1u, NumNumaNodes.load(std::memory_order_relaxed));
+	}
+
 private:
 	// add a queue to the Registry
 	uint32 AddLocalQueue(FStealHazard& Hazard, TLocalQueue* QueueToAdd, ELocalQueueType QueueType)
@@ -450,27 +575,35 @@ private:
 	}
 
 	// StealItem tries to steal an Item from a Registered LocalQueue
-	FTask* StealItem(FStealHazard& Hazard, uint32& CachedRandomIndex, uint32& CachedPriorityIndex, bool GetBackGroundTasks)
+	// queues of the same NUMA node are visited first, so that Items only cross the interconnect when the node is out of work
+	FTask* StealItem(FStealHazard& Hazard, uint32& CachedRandomIndex, uint32& CachedPriorityIndex, bool GetBackGroundTasks, uint32 NumaNode)
 	{
 		FLocalQueueCollection* Queues = Hazard.Get();
 		uint32 NumQueues = Queues->LocalQueues.Num();
 		uint32 MaxPriority = GetBackGroundTasks ? int32(ETaskPriority::Count) : int32(ETaskPriority::ForegroundCount);
 		CachedRandomIndex = CachedRandomIndex % NumQueues;
 
-		for(uint32 i = 0; i < NumQueues; i++)
+		const bool bPreferNumaNode = NumaNode != InvalidNumaNode;
+		for(uint32 Pass = bPreferNumaNode ? 0 : 1; Pass < 2; Pass++)
 		{
-			TLocalQueue* LocalQueue = Queues->LocalQueues[CachedRandomIndex];
-			for(uint32 PriorityIndex = 0; PriorityIndex < MaxPriority; PriorityIndex++)
-			{	
-				FTask* Item;
-				if (LocalQueue->LocalQueues[CachedPriorityIndex].Steal(Item))
+			for(uint32 i = 0; i < NumQueues; i++)
+			{
+				TLocalQueue* LocalQueue = Queues->LocalQueues[CachedRandomIndex];
+				if (!bPreferNumaNode || (LocalQueue->NumaNode == NumaNode) == (Pass == 0))
 				{
-					Hazard.Retire();
-					return Item;
+					for(uint32 PriorityIndex = 0; PriorityIndex < MaxPriority; PriorityIndex++)
+					{	
+						FTask* Item;
+						if (LocalQueue->LocalQueues[CachedPriorityIndex].Steal(Item))
+						{
+							Hazard.Retire();
+							return Item;
+						}
+						CachedPriorityIndex = ++CachedPriorityIndex < MaxPriority ? CachedPriorityIndex : 0;
+					}
 				}
-				CachedPriorityIndex = ++CachedPriorityIndex < MaxPriority ? CachedPriorityIndex : 0;
+				CachedRandomIndex = ++CachedRandomIndex < NumQueues ? CachedRandomIndex : 0;
 			}
-			CachedRandomIndex = ++CachedRandomIndex < NumQueues ? CachedRandomIndex : 0;
 		}
 		CachedPriorityIndex = 0;
 		CachedRandomIndex = TLocalQueue::InvalidIndex;
@@ -505,9 +638,77 @@ public:
 		return false;
 	}
 
+	// enqueue an Item into the OverflowQueue of a NUMA node and wake one of the node's workers
+	// falls back to the Global OverflowQueue if the Registry has no queues for the node
+	// returns true if we should wake a worker for stealing
+	bool EnqueueNuma(FTask* Item, uint32 PriorityIndex, uint32 NumaNode)
+	{
+		check(PriorityIndex < int32(ETaskPriority::Count));
+		check(Item != nullptr);
+
+		if (NumaNode >= NumNumaNodes.load(std::memory_order_acquire))
+		{
+			return Enqueue(Item, PriorityIndex);
+		}
+
+		bool bBackgroundTask = Item->IsBackgroundTask();
+		NumaNodeQueues[NumaNode]->OverflowQueues[PriorityIndex].enqueue(Item);
+
+		FStealHazard Hazard(QueueCollection, HazardsCollection);
+		FLocalQueueCollection* Queues = Hazard.Get();
+		for (TLocalQueue* LocalQueue : Queues->LocalQueues)
+		{
+			// foreground workers don't pick up background Items
+			if (LocalQueue->NumaNode == NumaNode && LocalQueue->SleepEvent && (!bBackgroundTask || LocalQueue->QueueType == ELocalQueueType::EBackground) && LocalQueue->WakeUp())
+			{
+				return false;
+			}
+		}
+		return LessThanHalfWorkersLookingForWork(bBackgroundTask);
+	}
+
+	// enqueue an Item into the DeadlineQueue, it will be dequeued before all Items without a deadline and before Items with a later deadline
+	// returns true if we should wake a worker for stealing
+	bool EnqueueDeadline(FTask* Item, uint64 Deadline)
+	{
+		check(Item != nullptr && !Item->IsBackgroundTask());
+		{
+			UE::TScopeLock<UE::FSpinLock> ScopeLock(DeadlineQueue.Lock);
+			DeadlineQueue.Heap.HeapPush(FDeadlineItem { Deadline, Item });
+			DeadlineQueue.Num.store(DeadlineQueue.Heap.Num(), std::memory_order_release);
+		}
+		return LessThanHalfWorkersLookingForWork(false);
+	}
+
+	// grab the Item with the earliest deadline, returns nullptr without locking if the DeadlineQueue is empty
+	FTask* DequeueDeadline(uint64& OutDeadline)
+	{
+		if (DeadlineQueue.Num.load(std::memory_order_relaxed) == 0)
+		{
+			return nullptr;
+		}
+
+		UE::TScopeLock<UE::FSpinLock> ScopeLock(DeadlineQueue.Lock);
+		if (DeadlineQueue.Heap.Num() == 0)
+		{
+			return nullptr;
+		}
+		FDeadlineItem Earliest;
+		DeadlineQueue.Heap.HeapPop(Earliest, false);
+		DeadlineQueue.Num.store(DeadlineQueue.Heap.Num(), std::memory_order_relaxed);
+		OutDeadline = Earliest.Deadline;
+		return Earliest.Item;
+	}
+
 	// grab an Item directy from the Global OverflowQueue
 	FTask* Dequeue()
 	{
+		uint64 Deadline;
+		if (FTask* Result = DequeueDeadline(Deadline))
+		{
+			return Result;
+		}
+
 		for (int32 PriorityIndex = 0; PriorityIndex < int32(ETaskPriority::Count); PriorityIndex++)
 		{
 			FTask* Result = OverflowQueues[PriorityIndex].dequeue();
@@ -516,7 +717,7 @@ public:
 				return Result;
 			}
 		}
-		return nullptr;
+		return DequeueRemoteNuma(InvalidNumaNode, true);
 	}
 
 	inline FOutOfWork GetOutOfWorkScope(ELocalQueueType QueueType)
@@ -525,6 +726,29 @@ public:
 	}
 
 private:
+	// grab an Item from the OverflowQueue of any NUMA node other than the given one
+	FTask* DequeueRemoteNuma(uint32 NumaNode, bool GetBackGroundTasks)
+	{
+		uint32 NumNodes = NumNumaNodes.load(std::memory_order_acquire);
+		int32 MaxPriority = GetBackGroundTasks ? int32(ETaskPriority::Count) : int32(ETaskPriority::ForegroundCount);
+		for (uint32 NodeIndex = 0; NodeIndex < NumNodes; NodeIndex++)
+		{
+			if (NodeIndex == NumaNode)
+			{
+				continue;
+			}
+			for (int32 PriorityIndex = 0; PriorityIndex < MaxPriority; PriorityIndex++)
+			{
+				FTask* Result = NumaNodeQueues[NodeIndex]->OverflowQueues[PriorityIndex].dequeue();
+				if (Result)
+				{
+					return Result;
+				}
+			}
+		}
+		return nullptr;
+	}
+
 	inline bool LessThanHalfWorkersLookingForWork(bool bBackgroundTask) const
 	{
 		if (bBackgroundTask)
@@ -542,6 +766,9 @@ private:
 	std::atomic<FLocalQueueCollection*>	QueueCollection;
 	std::atomic_int NumWorkersLookingForWork[2] = { {0}, {0} };
 	std::atomic_int NumActiveWorkers[2] = { {0}, {0} };
+	FNumaNodeQueues* NumaNodeQueues[MaxNumaNodes] = {};
+	std::atomic<uint32> NumNumaNodes { 0 };
+	FDeadlineQueue DeadlineQueue;
 };
 
 template<uint32 NumLocalItems>
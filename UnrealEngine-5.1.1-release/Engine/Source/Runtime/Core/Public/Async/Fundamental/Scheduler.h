@@ -10,6 +10,7 @@
 #include "HAL/Event.h"
 #include "HAL/PlatformAffinity.h"
 #include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
 #include "HAL/Thread.h"
 #include "LocalQueue.h"
 #include "Misc/AssertionMacros.h"
@@ -116,6 +117,8 @@ namespace LowLevelTasks
 		static thread_local EWorkerType WorkerType;
 		// number of busy-waiting calls in the call-stack
 		static thread_local uint32 BusyWaitingDepth;
+		// deadline (in Cycles64) given to foreground tasks launched from this thread, 0 if there is none
+		static thread_local uint64 ActiveDeadline;
 
 	public:
 		CORE_API bool IsWorkerThread() const;
@@ -123,6 +126,12 @@ namespace LowLevelTasks
 		// returns true if the current thread execution is in the context of busy-waiting
 		CORE_API static bool IsBusyWaiting();
 
+		// returns the deadline of the FDeadlineScope or of the deadline task the current thread executes, 0 if there is none
+		CORE_API static uint64 GetActiveDeadline();
+
+		// sets the deadline given to tasks launched from the current thread and returns the previous one, see FDeadlineScope
+		CORE_API static uint64 SetActiveDeadline(uint64 Deadline);
+
 		// returns the AffinityIndex of the thread LocalQueue
 		CORE_API static uint32 GetAffinityIndex();
 
@@ -166,6 +175,10 @@ namespace LowLevelTasks
 		//try to launch the task on a specific worker ID, the return value will specify if the task was in the ready state and has been launched
 		inline bool TryLaunchAffinity(FTask& Task, uint32 AffinityIndex);	
 
+		//try to launch the task on the workers of a NUMA node, they will pick it up before any other global work. Other workers only take it when they run out of work.
+		//the return value will specify if the task was in the ready state and has been launched
+		inline bool TryLaunchOnNumaNode(FTask& Task, uint32 NumaNode);
+
 		//tries to do some work until the Task is completed
 		template<typename TaskType>
 		inline void BusyWait(const TaskType& Task, bool ForceAllowBackgroundWork = false);
@@ -182,6 +195,12 @@ namespace LowLevelTasks
 		//number of instantiated workers
 		inline uint32 GetNumWorkers() const;
 
+		//number of NUMA nodes the workers are spread across, 1 if the scheduler is not NUMA aware
+		inline uint32 GetNumNumaNodes() const;
+
+		//NUMA node of the calling thread, for workers this is the node they were assigned to
+		CORE_API uint32 GetCurrentNumaNode() const;
+
 		//get the Queue registry to register additonal WorkerQueues for this Scheduler
 		inline FSchedulerTls::FQueueRegistry& GetQueueRegistry();
 
@@ -190,15 +209,21 @@ namespace LowLevelTasks
 
 		//get the background priority set when workers were started
 		inline EThreadPriority GetBackgroundPriority() const { return BackgroundPriority; }
+
+		//starts a new frame of the CPU time budget of background tasks, called at the beginning of every frame (see Tasks.BackgroundBudget.Fraction)
+		CORE_API void BeginBackgroundBudgetFrame();
+
+		//true if background tasks used up their CPU time budget of the current frame, background workers pick up only foreground tasks then
+		inline bool IsBackgroundBudgetExhausted() const;
 	public:
 		FScheduler() = default;
 		~FScheduler();
 
 	private: 
 		void ExecuteTask(FTask*& InOutTask);
-		TUniquePtr<FThread> CreateWorker(bool bPermitBackgroundWork = false, FThread::EForkable IsForkable = FThread::NonForkable, FSleepEvent* ExternalWorkerEvent = nullptr, FSchedulerTls::FLocalQueueType* ExternalWorkerLocalQueue = nullptr, EThreadPriority Priority = EThreadPriority::TPri_Normal, uint64 InAffinity = 0);
+		TUniquePtr<FThread> CreateWorker(bool bPermitBackgroundWork = false, FThread::EForkable IsForkable = FThread::NonForkable, FSleepEvent* ExternalWorkerEvent = nullptr, FSchedulerTls::FLocalQueueType* ExternalWorkerLocalQueue = nullptr, EThreadPriority Priority = EThreadPriority::TPri_Normal, uint64 InAffinity = 0, uint32 NumaNode = FSchedulerTls::FQueueRegistry::InvalidNumaNode);
 		void WorkerMain(struct FSleepEvent* WorkerEvent, FSchedulerTls::FLocalQueueType* ExternalWorkerLocalQueue, uint32 WaitCycles, bool bPermitBackgroundWork);
-		CORE_API void LaunchInternal(FTask& Task, EQueuePreference QueuePreference, bool bWakeUpWorker);
+		CORE_API void LaunchInternal(FTask& Task, EQueuePreference QueuePreference, bool bWakeUpWorker, uint32 NumaNode = FSchedulerTls::FQueueRegistry::InvalidNumaNode);
 		CORE_API void BusyWaitInternal(const FConditional& Conditional, bool ForceAllowBackgroundWork);
 		FORCENOINLINE bool TrySleeping(FSleepEvent* WorkerEvent, bool bStopOutOfWorkScope, bool Drowsing, bool bBackgroundWorker);
 		inline bool WakeUpWorker(bool bBackgroundWorker);
@@ -217,11 +242,46 @@ namespace LowLevelTasks
 		TAlignedArray<FSleepEvent>						WorkerEvents;
 		std::atomic_uint								ActiveWorkers { 0 };
 		std::atomic_uint								NextWorkerId { 0 };
+		uint32											NumNumaNodes = 1;
 		uint64											WorkerAffinity = 0;
 		uint64											BackgroundAffinity = 0;
 		EThreadPriority									WorkerPriority = EThreadPriority::TPri_Normal;
 		EThreadPriority									BackgroundPriority = EThreadPriority::TPri_BelowNormal;
 		std::atomic_bool								TemporaryShutdown{ false };
+
+		//CPU time budget of background tasks, in Cycles64. The budget is lifted at the end of the window even if no new frame started,
+		//so that a thread that blocks the frame while waiting for background work can't starve it
+		std::atomic<uint64>								BackgroundBudgetCycles{ 0 }; // 0 if background tasks are not throttled
+		std::atomic<uint64>								BackgroundUsedCycles{ 0 };
+		std::atomic<uint64>								BackgroundBudgetWindowEnd{ 0 };
+		uint64											BackgroundBudgetFrameStart = 0;
+		float											BackgroundBudgetScale = 1.0f;
+	};
+
+	/*
+	* Foreground tasks launched inside an FDeadlineScope are executed Earliest-Deadline-First ahead of all other tasks,
+	* this is meant for frame critical work (e.g. parallel animation or physics presim) that competes with opportunistic tasks.
+	* A task executed from the deadline queue runs inside a scope with its deadline, so the tasks it launches inherit it.
+	* Nested scopes keep the earliest deadline, a deadline of 0 keeps the current one. Deadlines are in FPlatformTime::Cycles64.
+	*/
+	class FDeadlineScope
+	{
+		uint64 PreviousDeadline;
+
+	public:
+		UE_NONCOPYABLE(FDeadlineScope);
+
+		explicit FDeadlineScope(uint64 Deadline)
+		{
+			const uint64 Current = FSchedulerTls::GetActiveDeadline();
+			const bool bKeepCurrent = Deadline == 0 || (Current != 0 && Current < Deadline);
+			PreviousDeadline = FSchedulerTls::SetActiveDeadline(bKeepCurrent ? Current : Deadline);
+		}
+
+		~FDeadlineScope()
+		{
+			FSchedulerTls::SetActiveDeadline(PreviousDeadline);
+		}
 	};
 
 	FORCEINLINE_DEBUGGABLE bool TryLaunch(FTask& Task, EQueuePreference QueuePreference = EQueuePreference::DefaultPreference, bool bWakeUpWorker = true)
@@ -234,6 +294,11 @@ namespace LowLevelTasks
 		return FScheduler::Get().TryLaunchAffinity(Task, AffinityIndex);
 	}
 
+	FORCEINLINE_DEBUGGABLE bool TryLaunchOnNumaNode(FTask& Task, uint32 NumaNode)
+	{
+		return FScheduler::Get().TryLaunchOnNumaNode(Task, NumaNode);
+	}
+
 	FORCEINLINE_DEBUGGABLE void BusyWaitForTask(const FTask& Task, bool ForceAllowBackgroundWork = false)
 	{
 		FScheduler::Get().BusyWait(Task, ForceAllowBackgroundWork);
@@ -273,11 +338,32 @@ namespace LowLevelTasks
 		return false;
 	}
 
+	inline bool FScheduler::TryLaunchOnNumaNode(FTask& Task, uint32 NumaNode)
+	{
+		if(Task.TryPrepareLaunch())
+		{
+			LaunchInternal(Task, EQueuePreference::GlobalQueuePreference, true, NumaNode);
+			return true;
+		}
+		return false;
+	}
+
 	inline uint32 FScheduler::GetNumWorkers() const
 	{
 		return ActiveWorkers.load(std::memory_order_relaxed);
 	}
 
+	inline uint32 FScheduler::GetNumNumaNodes() const
+	{
+		return NumNumaNodes;
+	}
+
+	inline bool FScheduler::IsBackgroundBudgetExhausted() const
+	{
+		const uint64 Budget = BackgroundBudgetCycles.load(std::memory_order_relaxed);
+		return Budget != 0 && BackgroundUsedCycles.load(std::memory_order_relaxed) >= Budget && FPlatformTime::Cycles64() < BackgroundBudgetWindowEnd.load(std::memory_order_relaxed);
+	}
+
 	template<typename TaskType>
 	inline void FScheduler::BusyWait(const TaskType& Task, bool ForceAllowBackgroundWork)
 	{
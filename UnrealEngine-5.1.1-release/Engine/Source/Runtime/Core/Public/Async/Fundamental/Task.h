@@ -389,6 +389,15 @@ namespace LowLevelTasks
 		inline bool TryExpedite();
 		inline bool TryExpedite(FTask*& Continuation);
 
+		/*
+		* TryExpedite split in two: TryClaim takes a scheduled task away from the scheduler without running it,
+		* if it succeeded ExecuteClaimed has to be called exactly once, it can be called from any thread (e.g. a task launched with a higher priority).
+		* the task cannot complete (and be recycled) before ExecuteClaimed returned.
+		* @return ExecuteClaimed: optional Continuation that needs to be executed or scheduled by the caller
+		*/
+		inline bool TryClaim();
+		inline FTask* ExecuteClaimed();
+
 		/*
 		* try to execute the task if it has not been launched yet the task will execute immediately.
 		* @param Continuation: optional Continuation that needs to be executed or scheduled by the caller (can only be non null if the operation returned true)
@@ -623,14 +632,25 @@ namespace LowLevelTasks
 		}
 	}
 
-	inline bool FTask::TryExpedite(FTask*& OutContinuation)
+	inline bool FTask::TryClaim()
 	{
 		FPackedData LocalPackedData = PackedData.load(std::memory_order_relaxed);
 		FPackedData ScheduledState(LocalPackedData, ETaskState::Scheduled);
-		if(PackedData.compare_exchange_strong(ScheduledState, FPackedData(LocalPackedData, ETaskState::Running), std::memory_order_acquire))
+		return PackedData.compare_exchange_strong(ScheduledState, FPackedData(LocalPackedData, ETaskState::Running), std::memory_order_acquire);
+	}
+
+	inline FTask* FTask::ExecuteClaimed()
+	{
+		FTask* Continuation = Runnable(true);
+		TryFinish<true>();
+		return Continuation;
+	}
+
+	inline bool FTask::TryExpedite(FTask*& OutContinuation)
+	{
+		if(TryClaim())
 		{
-			OutContinuation  = Runnable(true);
-			TryFinish<true>();
+			OutContinuation = ExecuteClaimed();
 			return true;
 		}
 		return false;
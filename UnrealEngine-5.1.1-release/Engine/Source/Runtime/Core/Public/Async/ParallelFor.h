@@ -59,12 +59,37 @@ enum class EParallelForFlags
 
 	// tasks should run on background priority threads
 	BackgroundPriority = 8,
+
+	// learns the batch size from the per item cost measured by previous calls with the same DebugName (which should be a literal unique to the call site),
+	// workloads too small to amortize the scheduling overhead run inline. MinBatchSize is still respected as lower bound.
+	Adaptive = 16,
 };
 
 ENUM_CLASS_FLAGS(EParallelForFlags)
 
 namespace ParallelForImpl
 {
+	// Per call site state of adaptive ParallelFors, see EParallelForFlags::Adaptive
+	struct FAdaptiveSite
+	{
+		std::atomic<const TCHAR*> DebugName { nullptr };
+		// exponential moving average of the cycles one call of Body takes, 0 until the first call was measured
+		std::atomic<double> CyclesPerItem { 0.0 };
+		std::atomic<uint8> TraceState { 0 };
+		uint16 ItemCostCounterId = 0;
+		uint16 BatchSizeCounterId = 0;
+		uint16 OverheadCounterId = 0;
+		uint16 InlineCounterId = 0;
+	};
+
+	// returns nullptr if adaptive ParallelFors are disabled or too many sites are registered already
+	CORE_API FAdaptiveSite* FindOrAddAdaptiveSite(const TCHAR* DebugName);
+
+	// returns the minimum batch size to use for Num items, bOutRunInline is set if the work is too small to go wide
+	CORE_API int32 GetAdaptiveMinBatchSize(const FAdaptiveSite& Site, int32 Num, int32 MinBatchSize, bool& bOutRunInline);
+
+	// feeds the measurement of one call back into the site and its trace counters
+	CORE_API void ReportAdaptiveSample(FAdaptiveSite& Site, int32 Num, int32 BatchSize, int32 NumTasks, uint64 BodyCycles, uint64 WallCycles);
 
 	// Helper to call body with context reference
 	template <typename FunctionType, typename ContextType>
@@ -118,6 +143,18 @@ namespace ParallelForImpl
 		TRACE_CPUPROFILER_EVENT_SCOPE(ParallelFor);
 		check(Num >= 0);
 
+		FAdaptiveSite* AdaptiveSite = nullptr;
+		if ((Flags & EParallelForFlags::Adaptive) != EParallelForFlags::None && Num > 0)
+		{
+			AdaptiveSite = FindOrAddAdaptiveSite(DebugName);
+			if (AdaptiveSite)
+			{
+				bool bRunInline = false;
+				MinBatchSize = GetAdaptiveMinBatchSize(*AdaptiveSite, Num, MinBatchSize, bRunInline);
+				Flags |= bRunInline ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None;
+			}
+		}
+
 		int32 NumWorkers = GetNumberOfThreadTasks(Num, MinBatchSize, Flags);
 
 		if (!Contexts.IsEmpty())
@@ -131,11 +168,17 @@ namespace ParallelForImpl
 		{
 			// do the prework
 			CurrentThreadWorkToDoBeforeHelping();
+			const uint64 StartCycles = AdaptiveSite ? FPlatformTime::Cycles64() : 0;
 			// no threads, just do it and return
 			for(int32 Index = 0; Index < Num; Index++)
 			{
 				CallBody(Body, Contexts, 0, Index);
 			}
+			if (AdaptiveSite)
+			{
+				const uint64 Cycles = FPlatformTime::Cycles64() - StartCycles;
+				ReportAdaptiveSample(*AdaptiveSite, Num, Num, 1, Cycles, Cycles);
+			}
 			return;
 		}
 	
@@ -196,10 +239,11 @@ namespace ParallelForImpl
 		//shared data between tasks
 		struct alignas(PLATFORM_CACHE_LINE_SIZE) FParallelForData : public TConcurrentLinearObject<FParallelForData, FTaskGraphBlockAllocationTag>, public FThreadSafeRefCountedObject
 		{
-			FParallelForData(int32 InNum, int32 InBatchSize, int32 InNumBatches, int32 InNumWorkers, const TArrayView<ContextType>& InContexts, const BodyType& InBody, FEventRef& InFinishedSignal)
+			FParallelForData(int32 InNum, int32 InBatchSize, int32 InNumBatches, int32 InNumWorkers, const TArrayView<ContextType>& InContexts, const BodyType& InBody, FEventRef& InFinishedSignal, bool bInMeasureBody)
 				: Num(InNum)
 				, BatchSize(InBatchSize)
 				, NumBatches(InNumBatches)
+				, bMeasureBody(bInMeasureBody)
 				, Contexts(InContexts)
 				, Body(InBody)
 				, FinishedSignal(InFinishedSignal)
@@ -223,9 +267,12 @@ namespace ParallelForImpl
 
 			std::atomic_int BatchItem  { 0 };
 			std::atomic_int IncompleteBatches { 0 };
+			// cycles spent in Body summed over all threads, only measured for adaptive ParallelFors
+			std::atomic<uint64> BodyCycles { 0 };
 			int32 Num;
 			int32 BatchSize;
 			int32 NumBatches;
+			bool bMeasureBody;
 #if UE_MEMORY_TAGS_TRACE_ENABLED
 			int32 InheritedTraceTag;
 #endif
@@ -337,14 +384,20 @@ namespace ParallelForImpl
 
 					int32 StartIndex = BatchIndex * BatchSize;
 					int32 EndIndex = FMath::Min<int32>(StartIndex + BatchSize, Num);
+					const uint64 BatchStartCycles = Data->bMeasureBody ? FPlatformTime::Cycles64() : 0;
 					for (int32 Index = StartIndex; Index < EndIndex; Index++)
 					{
 						CallBody(Body, Contexts, WorkerIndex, Index);
 					}
+					if (Data->bMeasureBody && StartIndex < EndIndex)
+					{
+						Data->BodyCycles.fetch_add(FPlatformTime::Cycles64() - BatchStartCycles, std::memory_order_relaxed);
+					}
 
 					// we need to decrement IncompleteBatches when processing a Batch because we need to know if we are the last one
 					// so that if the main thread is the last one we can avoid an FEvent call.
-					if (StartIndex < Num && Data->IncompleteBatches.fetch_sub(1, std::memory_order_relaxed) == 1)
+					// acq_rel publishes the BodyCycles of all batches to whoever completes the last one
+					if (StartIndex < Num && Data->IncompleteBatches.fetch_sub(1, std::memory_order_acq_rel) == 1)
 					{
 						if (!bIsMaster)
 						{
@@ -394,8 +447,9 @@ namespace ParallelForImpl
 		};
 
 		//launch all the worker tasks
+		const uint64 StartCycles = AdaptiveSite ? FPlatformTime::Cycles64() : 0;
 		FEventRef FinishedSignal { EEventMode::ManualReset };
-		FDataHandle Data = new FParallelForData(Num, BatchSize, NumBatches, NumWorkers, Contexts, Body, FinishedSignal);
+		FDataHandle Data = new FParallelForData(Num, BatchSize, NumBatches, NumWorkers, Contexts, Body, FinishedSignal, AdaptiveSite != nullptr);
 		for (int32 Worker = 0; Worker < NumWorkers; Worker++)
 		{
 			FParallelExecutor::LaunchTask(DebugName, FDataHandle(Data), Worker, Priority);
@@ -438,6 +492,11 @@ namespace ParallelForImpl
 			}
 		}
 		checkSlow(LocalExecutor.GetData()->BatchItem.load(std::memory_order_relaxed) * LocalExecutor.GetData()->BatchSize >= LocalExecutor.GetData()->Num);
+
+		if (AdaptiveSite)
+		{
+			ReportAdaptiveSample(*AdaptiveSite, Num, BatchSize, NumWorkers + 1, LocalExecutor.GetData()->BodyCycles.load(std::memory_order_relaxed), FPlatformTime::Cycles64() - StartCycles);
+		}
 	}
 }
 
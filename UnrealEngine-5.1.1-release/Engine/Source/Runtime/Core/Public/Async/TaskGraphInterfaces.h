@@ -23,6 +23,8 @@
 #include "Containers/LockFreeFixedSizeAllocator.h"
 #include "Experimental/ConcurrentLinearAllocator.h"
 #include "Misc/MemStack.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/SpinLock.h"
 #include "Templates/Atomic.h"
 #include "ProfilingDebugging/MetadataTrace.h"
 
@@ -824,6 +826,7 @@ protected:
 	FBaseGraphTask(int32 InNumberOfPrerequistitesOutstanding)
 		: ThreadToExecuteOn(ENamedThreads::AnyThread)
 		, NumberOfPrerequistitesOutstanding(InNumberOfPrerequistitesOutstanding + 1) // + 1 is not a prerequisite, it is a lock to prevent it from executing while it is getting prerequisites, one it is safe to execute, call PrerequisitesComplete
+		, LaunchDeadline(LowLevelTasks::FSchedulerTls::GetActiveDeadline())
 	{
 		checkThreadGraph(LifeStage.Increment() == int32(LS_Contructed));
 #if UE_MEMORY_TAGS_TRACE_ENABLED
@@ -909,6 +912,18 @@ protected:
 		return ThreadToExecuteOn;
 	}
 
+	/** true if a waiter boosted the task before it was queued, any thread tasks are then queued with high priority **/
+	bool IsBoosted() const
+	{
+		return bBoosted.load(std::memory_order_relaxed);
+	}
+
+	/** the deadline of the LowLevelTasks::FDeadlineScope the task was created in, 0 if there was none **/
+	uint64 GetLaunchDeadline() const
+	{
+		return LaunchDeadline;
+	}
+
 private:
 	friend class FNamedTaskThread;
 	friend class FTaskThreadBase;
@@ -933,6 +948,12 @@ private:
 	**/
 	virtual void DeleteTask() = 0;
 
+	/**
+	*	Virtual call to collect the prerequisites the task still waits for, used by FGraphEvent::Boost.
+	*	Only legal while holding the ProducerLock of the completion event the task is the producer of.
+	**/
+	virtual void CollectPendingPrerequisites(FGraphEventArray& OutPrerequisites) const = 0;
+
 	// API called from other parts of the system
 
 	/** 
@@ -967,6 +988,10 @@ private:
 	ENamedThreads::Type			ThreadToExecuteOn;
 	/**	Number of prerequisites outstanding. When this drops to zero, the thread is queued for execution.  **/
 	FThreadSafeCounter			NumberOfPrerequistitesOutstanding; 
+	/** Set by FGraphEvent::Boost if the task is waited for by a latency sensitive thread **/
+	std::atomic<bool>			bBoosted{ false };
+	/** Captured from LowLevelTasks::FSchedulerTls on construction, the task is queued inside a FDeadlineScope with it **/
+	uint64						LaunchDeadline;
 
 
 #if DO_GUARD_SLOW || USING_CODE_ANALYSIS
@@ -1090,6 +1115,13 @@ public:
 		FTaskGraphInterface::Get().WaitUntilTaskCompletes(this, CurrentThreadIfKnown);
 	}
 
+	/**
+	 *	Priority inheritance for waiters: if the task that completes this event is already queued for any thread it is taken out of its queue 
+	 *	and executed by a high priority task, if it still waits for prerequisites it will be queued with high priority and its prerequisites are boosted recursively.
+	 *	This is best-effort and bounded, it is called by WaitUntilTasksComplete for named threads and high priority tasks (see TaskGraph.BoostWaitedTasks).
+	**/
+	CORE_API void Boost();
+
 	/**
 	 * Sets a name for the event for debugging purposes.
 	 */
@@ -1140,6 +1172,23 @@ private:
 	**/
 	~FGraphEvent();
 
+	/** Registers the task that completes this event, for Boost **/
+	void SetProducer(FBaseGraphTask* InProducer)
+	{
+		UE::TScopeLock<UE::FSpinLock> Lock(ProducerLock);
+		Producer = InProducer;
+	}
+
+	/** Called by the producer when it starts executing, Boost must not access it afterwards **/
+	void ClearProducer(FBaseGraphTask* InProducer)
+	{
+		UE::TScopeLock<UE::FSpinLock> Lock(ProducerLock);
+		if (Producer == InProducer)
+		{
+			Producer = nullptr;
+		}
+	}
+
 	// Interface for TRefCountPtr
 
 public:
@@ -1182,6 +1231,10 @@ private:
 	/** Number of outstanding references to this graph event **/
 	FThreadSafeCounter														ReferenceCount;
 	ENamedThreads::Type														ThreadToDoGatherOn;
+	/** Protects Producer, which is reset before the producer executes so Boost never sees a dangling task **/
+	UE::FSpinLock															ProducerLock;
+	/** The task that completes this event, if it didn't start executing yet **/
+	FBaseGraphTask*															Producer = nullptr;
 
 #if !UE_BUILD_SHIPPING && !UE_BUILD_TEST
 	const TCHAR* DebugName = nullptr;
@@ -1339,7 +1392,9 @@ private:
 		if (TTask::GetSubsequentsMode() == ESubsequentsMode::TrackSubsequents)
 		{
 			Subsequents->CheckDontCompleteUntilIsEmpty(); // we can only add wait for tasks while executing the task
+			Subsequents->ClearProducer(this);
 		}
+		PendingPrerequisites.Empty();
 		
 		TTask& Task = *(TTask*)&TaskStorage;
 		{
@@ -1369,6 +1424,17 @@ private:
 		delete this;
 	}
 
+	void CollectPendingPrerequisites(FGraphEventArray& OutPrerequisites) const final override
+	{
+		for (const FGraphEventRef& Prerequisite : PendingPrerequisites)
+		{
+			if (!Prerequisite->IsComplete())
+			{
+				OutPrerequisites.Add(Prerequisite);
+			}
+		}
+	}
+
 	// Internals 
 
 	/** 
@@ -1419,8 +1485,17 @@ private:
 				{
 					AlreadyCompletedPrerequisites++;
 				}
+				else
+				{
+					PendingPrerequisites.Add(Prerequisite);
+				}
 			}
 		}
+		if (TTask::GetSubsequentsMode() == ESubsequentsMode::TrackSubsequents)
+		{
+			// the prerequisites must be recorded before the task becomes visible to FGraphEvent::Boost
+			Subsequents->SetProducer(this);
+		}
 		PrerequisitesComplete(CurrentThreadIfKnown, AlreadyCompletedPrerequisites, bUnlock);
 	}
 
@@ -1481,6 +1556,8 @@ private:
 	bool						TaskConstructed;
 	/** A reference counted pointer to the completion event which lists the tasks that have me as a prerequisite. **/
 	FGraphEventRef				Subsequents;
+	/** The prerequisites that were not completed during setup, for FGraphEvent::Boost. Emptied when the task executes **/
+	FGraphEventArray			PendingPrerequisites;
 };
 
 #endif // TASKGRAPH_NEW_FRONTEND
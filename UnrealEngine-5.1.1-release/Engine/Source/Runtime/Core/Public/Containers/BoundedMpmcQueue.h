@@ -0,0 +1,159 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "HAL/UnrealMemory.h"
+#include "Math/UnrealMathUtility.h"
+#include "Misc/AssertionMacros.h"
+#include "Misc/Optional.h"
+#include "Templates/MemoryOps.h"
+#include "Templates/TypeCompatibleBytes.h"
+#include "Templates/UnrealTemplate.h"
+#include <atomic>
+
+/**
+ * Lock-free multi-producer/multi-consumer bounded concurrent queue. The capacity is rounded up to a power of two and nothing is allocated after construction.
+ * Enqueueing into a full queue fails instead of growing it, which lets producers apply backpressure.
+ * Items are dequeued in FIFO order, per producer. Every slot carries a sequence number that tells producers and consumers if it's their turn,
+ * so a thread that is preempted in the middle of an operation only delays the threads that want to use the same slot.
+ * Based on http://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+ */
+template<typename T>
+class TBoundedMpmcQueue final
+{
+public:
+	using ElementType = T;
+
+	UE_NONCOPYABLE(TBoundedMpmcQueue);
+
+	explicit TBoundedMpmcQueue(uint32 InCapacity)
+		: IndexMask(FMath::RoundUpToPowerOfTwo(FMath::Max(InCapacity, 2u)) - 1)
+	{
+		checkf(InCapacity <= (1u << 30), TEXT("Capacity %u is too big"), InCapacity);
+		Slots = (FSlot*)FMemory::Malloc(sizeof(FSlot) * (IndexMask + 1), alignof(FSlot));
+		for (uint32 Index = 0; Index <= IndexMask; ++Index)
+		{
+			new (&Slots[Index]) FSlot;
+			Slots[Index].Sequence.store(Index, std::memory_order_relaxed);
+		}
+	}
+
+	~TBoundedMpmcQueue()
+	{
+		while (TryDequeue().IsSet())
+		{
+		}
+		DestructItems(Slots, IndexMask + 1);
+		FMemory::Free(Slots);
+	}
+
+	/** @return false if the queue is full, Args are not consumed in this case */
+	template <typename... ArgTypes>
+	bool TryEnqueue(ArgTypes&&... Args)
+	{
+		uint32 Position = EnqueuePosition.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			FSlot& Slot = Slots[Position & IndexMask];
+			const uint32 Sequence = Slot.Sequence.load(std::memory_order_acquire);
+			const int32 Difference = int32(Sequence - Position);
+			if (Difference == 0)
+			{
+				// the slot is free, claim it
+				if (EnqueuePosition.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+				{
+					new (&Slot.Value) ElementType(Forward<ArgTypes>(Args)...);
+					Slot.Sequence.store(Position + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (Difference < 0)
+			{
+				// the slot still holds the item of the previous lap, the queue is full
+				return false;
+			}
+			else
+			{
+				// another producer claimed the slot
+				Position = EnqueuePosition.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	/** @return empty TOptional if the queue is empty */
+	TOptional<ElementType> TryDequeue()
+	{
+		uint32 Position = DequeuePosition.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			FSlot& Slot = Slots[Position & IndexMask];
+			const uint32 Sequence = Slot.Sequence.load(std::memory_order_acquire);
+			const int32 Difference = int32(Sequence - (Position + 1));
+			if (Difference == 0)
+			{
+				if (DequeuePosition.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+				{
+					ElementType* Value = (ElementType*)&Slot.Value;
+					TOptional<ElementType> Result{ MoveTemp(*Value) };
+					DestructItem(Value);
+					// the slot is free for the producer of the next lap
+					Slot.Sequence.store(Position + IndexMask + 1, std::memory_order_release);
+					return Result;
+				}
+			}
+			else if (Difference < 0)
+			{
+				// the slot is empty or its producer didn't finish yet
+				return {};
+			}
+			else
+			{
+				Position = DequeuePosition.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	bool TryDequeue(ElementType& OutElem)
+	{
+		TOptional<ElementType> LocalElement = TryDequeue();
+		if (LocalElement.IsSet())
+		{
+			OutElem = MoveTemp(LocalElement.GetValue());
+			return true;
+		}
+		return false;
+	}
+
+	/** The number of items, which can be outdated by the time it's returned if other threads use the queue */
+	uint32 ApproxNum() const
+	{
+		const uint32 Dequeued = DequeuePosition.load(std::memory_order_relaxed);
+		const uint32 Enqueued = EnqueuePosition.load(std::memory_order_relaxed);
+		return FMath::Min(uint32(Enqueued - Dequeued), Capacity());
+	}
+
+	bool IsEmpty() const
+	{
+		return ApproxNum() == 0;
+	}
+
+	uint32 Capacity() const
+	{
+		return IndexMask + 1;
+	}
+
+private:
+	struct FSlot
+	{
+		std::atomic<uint32> Sequence{ 0 };
+		TTypeCompatibleBytes<ElementType> Value;
+	};
+
+	FSlot* Slots;
+	const uint32 IndexMask;
+
+	// producers and consumers contend on different cache lines
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint32> EnqueuePosition{ 0 };
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint32> DequeuePosition{ 0 };
+};
@@ -617,8 +617,8 @@ public:
 	};
 };
 
-template <uint8 IndexSize>
-struct TAllocatorTraits<TSizedHeapAllocator<IndexSize>> : TAllocatorTraitsBase<TSizedHeapAllocator<IndexSize>>
+template <uint8 IndexSize, typename BaseMallocType>
+struct TAllocatorTraits<TSizedHeapAllocator<IndexSize, BaseMallocType>> : TAllocatorTraitsBase<TSizedHeapAllocator<IndexSize, BaseMallocType>>
 {
 	enum { SupportsMove             = true };
 	enum { IsZeroConstruct          = true };
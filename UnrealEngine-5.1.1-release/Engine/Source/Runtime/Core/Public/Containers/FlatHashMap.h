@@ -0,0 +1,945 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "HAL/PlatformMath.h"
+#include "HAL/UnrealMemory.h"
+#include "Math/UnrealMathUtility.h"
+#include "Misc/AssertionMacros.h"
+#include "Templates/ChooseClass.h"
+#include "Templates/IsTriviallyDestructible.h"
+#include "Templates/MemoryOps.h"
+#include "Templates/TypeCompatibleBytes.h"
+#include "Templates/UnrealTemplate.h"
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+	#include <arm_neon.h>
+#elif PLATFORM_ENABLE_VECTORINTRINSICS
+	#include <emmintrin.h>
+#endif
+
+/**
+ * Open-addressing hash map in the style of a Swiss table.
+ *
+ * Every slot has a one byte control word holding either Empty, Deleted or 7 bits of the key's hash.
+ * Lookups load 16 control bytes at once and compare them against the hash bits with a single SIMD compare,
+ * so most lookups touch one control cache line and one element, and misses usually terminate in the first group.
+ *
+ * Two storage layouts are available:
+ *  - bStableIteration = true (default): elements are kept densely in a TArray in insertion order and slots only
+ *    store indices. Iteration is linear without holes and its order only changes when elements are removed
+ *    (the last element is swapped into the removed element's place). Element addresses are not stable.
+ *  - bStableIteration = false: elements are stored in the slots themselves. Lookups skip the index indirection,
+ *    but iteration walks the control bytes and its order changes whenever the table is rehashed.
+ *
+ * KeyFuncs follow the TMap conventions (GetSetKey, Matches, GetKeyHash), so existing key funcs can be reused.
+ * Duplicate keys are not supported.
+ */
+template<typename InKeyType, typename InValueType, typename KeyFuncs = TDefaultMapHashableKeyFuncs<InKeyType, InValueType, false>, bool bStableIteration = true>
+class TFlatHashMap
+{
+	static_assert(!KeyFuncs::bAllowDuplicateKeys, "TFlatHashMap does not support duplicate keys");
+
+public:
+	using KeyType = InKeyType;
+	using ValueType = InValueType;
+	using ElementType = TPair<KeyType, ValueType>;
+	using KeyInitType = typename KeyFuncs::KeyInitType;
+	using SizeType = int32;
+
+private:
+	using FCtrl = int8;
+
+	static constexpr FCtrl CtrlEmpty = -128;
+	static constexpr FCtrl CtrlDeleted = -2;
+	static constexpr int32 GroupWidth = 16;
+	static constexpr int32 MinCapacity = GroupWidth;
+
+	/** Bitmask of matching lanes within a probe group. */
+	struct FBitMask
+	{
+#if PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+		// NEON has no movemask, lanes are narrowed to 4 bits each and only the top bit of every nibble is kept.
+		static constexpr uint32 LaneShift = 2;
+#else
+		static constexpr uint32 LaneShift = 0;
+#endif
+		uint64 Mask;
+
+		explicit operator bool() const
+		{
+			return Mask != 0;
+		}
+
+		int32 Lowest() const
+		{
+			return (int32)(FPlatformMath::CountTrailingZeros64(Mask) >> LaneShift);
+		}
+
+		void ClearLowest()
+		{
+			Mask &= Mask - 1;
+		}
+	};
+
+	/** A group of GroupWidth control bytes loaded from an arbitrary (unaligned) position. */
+	struct FGroup
+	{
+#if PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+		uint8x16_t Ctrl;
+
+		explicit FGroup(const FCtrl* Pos)
+			: Ctrl(vld1q_u8(reinterpret_cast<const uint8*>(Pos)))
+		{
+		}
+
+		static FBitMask ToMask(uint8x16_t Cmp)
+		{
+			const uint64 Narrowed = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(Cmp), 4)), 0);
+			return FBitMask{ Narrowed & 0x8888888888888888ull };
+		}
+
+		FBitMask Match(uint8 H2) const
+		{
+			return ToMask(vceqq_u8(Ctrl, vdupq_n_u8(H2)));
+		}
+
+		FBitMask MatchEmpty() const
+		{
+			return ToMask(vceqq_u8(Ctrl, vdupq_n_u8((uint8)CtrlEmpty)));
+		}
+
+		FBitMask MatchEmptyOrDeleted() const
+		{
+			// Empty and Deleted are the only negative control values.
+			return ToMask(vcltq_s8(vreinterpretq_s8_u8(Ctrl), vdupq_n_s8(0)));
+		}
+#elif PLATFORM_ENABLE_VECTORINTRINSICS
+		__m128i Ctrl;
+
+		explicit FGroup(const FCtrl* Pos)
+			: Ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(Pos)))
+		{
+		}
+
+		FBitMask Match(uint8 H2) const
+		{
+			return FBitMask{ (uint64)(uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(Ctrl, _mm_set1_epi8((char)H2))) };
+		}
+
+		FBitMask MatchEmpty() const
+		{
+			return FBitMask{ (uint64)(uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(Ctrl, _mm_set1_epi8(CtrlEmpty))) };
+		}
+
+		FBitMask MatchEmptyOrDeleted() const
+		{
+			// Empty and Deleted are the only negative control values, so the sign bits are exactly the mask.
+			return FBitMask{ (uint64)(uint32)_mm_movemask_epi8(Ctrl) };
+		}
+#else
+		const FCtrl* Ctrl;
+
+		explicit FGroup(const FCtrl* Pos)
+			: Ctrl(Pos)
+		{
+		}
+
+		template<typename PredicateType>
+		FBitMask MatchIf(PredicateType Predicate) const
+		{
+			uint64 Mask = 0;
+			for (int32 Lane = 0; Lane < GroupWidth; ++Lane)
+			{
+				Mask |= (uint64)Predicate(Ctrl[Lane]) << Lane;
+			}
+			return FBitMask{ Mask };
+		}
+
+		FBitMask Match(uint8 H2) const
+		{
+			return MatchIf([H2](FCtrl Value) { return Value == (FCtrl)H2; });
+		}
+
+		FBitMask MatchEmpty() const
+		{
+			return MatchIf([](FCtrl Value) { return Value == CtrlEmpty; });
+		}
+
+		FBitMask MatchEmptyOrDeleted() const
+		{
+			return MatchIf([](FCtrl Value) { return Value < 0; });
+		}
+#endif
+	};
+
+	/** Slots either hold an index into the dense element array or the element itself. */
+	using SlotType = typename TChooseClass<bStableIteration, int32, TTypeCompatibleBytes<ElementType>>::Result;
+
+	/** Splits a 32-bit key hash into the probe start (H1) and the 7 bits stored in the control byte (H2). */
+	struct FHash
+	{
+		uint64 H1;
+		uint8 H2;
+
+		explicit FHash(uint32 KeyHash)
+		{
+			// KeyHash is frequently the identity for integers, so spread it before splitting it.
+			const uint64 Mixed = (uint64)KeyHash * 0x9E3779B97F4A7C15ull;
+			H1 = Mixed ^ (Mixed >> 32);
+			H2 = (uint8)(Mixed >> 57);
+		}
+	};
+
+public:
+	TFlatHashMap() = default;
+
+	TFlatHashMap(const TFlatHashMap& Other)
+	{
+		*this = Other;
+	}
+
+	TFlatHashMap(TFlatHashMap&& Other)
+	{
+		*this = MoveTemp(Other);
+	}
+
+	TFlatHashMap(std::initializer_list<TPairInitializer<const KeyType&, const ValueType&>> InitList)
+	{
+		Reserve((int32)InitList.size());
+		for (const TPairInitializer<const KeyType&, const ValueType&>& Element : InitList)
+		{
+			Add(Element.Key, Element.Value);
+		}
+	}
+
+	~TFlatHashMap()
+	{
+		DestroyAll();
+	}
+
+	TFlatHashMap& operator=(const TFlatHashMap& Other)
+	{
+		if (this != &Other)
+		{
+			Empty(Other.Num());
+			for (const ElementType& Element : Other)
+			{
+				Add(Element.Key, Element.Value);
+			}
+		}
+		return *this;
+	}
+
+	TFlatHashMap& operator=(TFlatHashMap&& Other)
+	{
+		if (this != &Other)
+		{
+			DestroyAll();
+
+			Ctrl = Other.Ctrl;
+			Slots = Other.Slots;
+			Capacity = Other.Capacity;
+			NumElements = Other.NumElements;
+			GrowthLeft = Other.GrowthLeft;
+			Elements = MoveTemp(Other.Elements);
+
+			Other.Ctrl = nullptr;
+			Other.Slots = nullptr;
+			Other.Capacity = 0;
+			Other.NumElements = 0;
+			Other.GrowthLeft = 0;
+		}
+		return *this;
+	}
+
+	FORCEINLINE int32 Num() const
+	{
+		return NumElements;
+	}
+
+	FORCEINLINE bool IsEmpty() const
+	{
+		return NumElements == 0;
+	}
+
+	/** @return the number of slots; the table rehashes once it is 7/8 full. */
+	FORCEINLINE int32 GetCapacity() const
+	{
+		return Capacity;
+	}
+
+	SIZE_T GetAllocatedSize() const
+	{
+		return (Capacity ? GetAllocationLayoutSize(Capacity) : 0) + Elements.GetAllocatedSize();
+	}
+
+	/** Removes all elements, optionally keeping room for ExpectedNumElements. */
+	void Empty(int32 ExpectedNumElements = 0)
+	{
+		DestroyAll();
+		if (ExpectedNumElements > 0)
+		{
+			Reserve(ExpectedNumElements);
+		}
+	}
+
+	/** Removes all elements but keeps the allocation. */
+	void Reset()
+	{
+		DestructElements();
+		if (Capacity)
+		{
+			FMemory::Memset(Ctrl, (uint8)CtrlEmpty, Capacity + GroupWidth);
+			GrowthLeft = GetMaxLoad(Capacity);
+		}
+		NumElements = 0;
+	}
+
+	/** Makes sure Number elements can be held without rehashing. */
+	void Reserve(int32 Number)
+	{
+		if constexpr (bStableIteration)
+		{
+			Elements.Reserve(Number);
+		}
+
+		if (Number > GetMaxLoad(Capacity))
+		{
+			Rehash(GetCapacityForNum(Number));
+		}
+	}
+
+	/** Sets the value associated with a key, replacing any existing value. */
+	FORCEINLINE ValueType& Add(const KeyType&  InKey, const ValueType&  InValue) { return Emplace(InKey, InValue); }
+	FORCEINLINE ValueType& Add(const KeyType&  InKey,       ValueType&& InValue) { return Emplace(InKey, MoveTemp(InValue)); }
+	FORCEINLINE ValueType& Add(      KeyType&& InKey, const ValueType&  InValue) { return Emplace(MoveTemp(InKey), InValue); }
+	FORCEINLINE ValueType& Add(      KeyType&& InKey,       ValueType&& InValue) { return Emplace(MoveTemp(InKey), MoveTemp(InValue)); }
+
+	/** Sets the value associated with a key, replacing any existing value. */
+	template<typename InitKeyType, typename InitValueType>
+	ValueType& Emplace(InitKeyType&& InKey, InitValueType&& InValue)
+	{
+		const uint32 KeyHash = KeyFuncs::GetKeyHash(InKey);
+		const int32 ExistingSlot = FindSlot(InKey, KeyHash);
+		if (ExistingSlot != INDEX_NONE)
+		{
+			ValueType& Value = GetSlotElement(ExistingSlot).Value;
+			Value = Forward<InitValueType>(InValue);
+			return Value;
+		}
+		return EmplaceNew(KeyHash, Forward<InitKeyType>(InKey), Forward<InitValueType>(InValue)).Value;
+	}
+
+	/** Finds the value associated with a key, adding a default constructed value if there is none. */
+	FORCEINLINE ValueType& FindOrAdd(const KeyType&  Key) { return FindOrAddImpl(Key); }
+	FORCEINLINE ValueType& FindOrAdd(      KeyType&& Key) { return FindOrAddImpl(MoveTemp(Key)); }
+
+	/** Finds the value associated with a key, adding InValue if there is none. */
+	template<typename InitValueType>
+	ValueType& FindOrAdd(const KeyType& Key, InitValueType&& InValue)
+	{
+		const uint32 KeyHash = KeyFuncs::GetKeyHash(Key);
+		const int32 ExistingSlot = FindSlot(Key, KeyHash);
+		if (ExistingSlot != INDEX_NONE)
+		{
+			return GetSlotElement(ExistingSlot).Value;
+		}
+		return EmplaceNew(KeyHash, Key, Forward<InitValueType>(InValue)).Value;
+	}
+
+	/** @return a pointer to the value associated with Key, or nullptr. */
+	FORCEINLINE ValueType* Find(KeyInitType Key)
+	{
+		const int32 Slot = FindSlot(Key, KeyFuncs::GetKeyHash(Key));
+		return Slot != INDEX_NONE ? &GetSlotElement(Slot).Value : nullptr;
+	}
+
+	FORCEINLINE const ValueType* Find(KeyInitType Key) const
+	{
+		return const_cast<TFlatHashMap*>(this)->Find(Key);
+	}
+
+	/** Finds a value by a precomputed hash and a key type comparable with KeyFuncs::Matches. */
+	template<typename ComparableKey>
+	FORCEINLINE ValueType* FindByHash(uint32 KeyHash, const ComparableKey& Key)
+	{
+		const int32 Slot = FindSlot(Key, KeyHash);
+		return Slot != INDEX_NONE ? &GetSlotElement(Slot).Value : nullptr;
+	}
+
+	template<typename ComparableKey>
+	FORCEINLINE const ValueType* FindByHash(uint32 KeyHash, const ComparableKey& Key) const
+	{
+		return const_cast<TFlatHashMap*>(this)->FindByHash(KeyHash, Key);
+	}
+
+	FORCEINLINE ValueType& FindChecked(KeyInitType Key)
+	{
+		ValueType* Value = Find(Key);
+		check(Value != nullptr);
+		return *Value;
+	}
+
+	FORCEINLINE const ValueType& FindChecked(KeyInitType Key) const
+	{
+		const ValueType* Value = Find(Key);
+		check(Value != nullptr);
+		return *Value;
+	}
+
+	FORCEINLINE ValueType FindRef(KeyInitType Key) const
+	{
+		const ValueType* Value = Find(Key);
+		return Value ? *Value : ValueType();
+	}
+
+	FORCEINLINE bool Contains(KeyInitType Key) const
+	{
+		return FindSlot(Key, KeyFuncs::GetKeyHash(Key)) != INDEX_NONE;
+	}
+
+	FORCEINLINE ValueType& operator[](KeyInitType Key)
+	{
+		return FindChecked(Key);
+	}
+
+	FORCEINLINE const ValueType& operator[](KeyInitType Key) const
+	{
+		return FindChecked(Key);
+	}
+
+	/** Removes the element associated with Key. @return the number of elements removed (0 or 1). */
+	int32 Remove(KeyInitType Key)
+	{
+		const int32 Slot = FindSlot(Key, KeyFuncs::GetKeyHash(Key));
+		if (Slot == INDEX_NONE)
+		{
+			return 0;
+		}
+		RemoveSlot(Slot);
+		return 1;
+	}
+
+	/** Removes the element associated with Key, moving its value to OutRemovedValue. */
+	bool RemoveAndCopyValue(KeyInitType Key, ValueType& OutRemovedValue)
+	{
+		const int32 Slot = FindSlot(Key, KeyFuncs::GetKeyHash(Key));
+		if (Slot == INDEX_NONE)
+		{
+			return false;
+		}
+		OutRemovedValue = MoveTemp(GetSlotElement(Slot).Value);
+		RemoveSlot(Slot);
+		return true;
+	}
+
+	/** Removes the element associated with Key and returns its value. The key must exist. */
+	ValueType FindAndRemoveChecked(KeyInitType Key)
+	{
+		const int32 Slot = FindSlot(Key, KeyFuncs::GetKeyHash(Key));
+		check(Slot != INDEX_NONE);
+		ValueType Result = MoveTemp(GetSlotElement(Slot).Value);
+		RemoveSlot(Slot);
+		return Result;
+	}
+
+	template<typename Allocator>
+	int32 GetKeys(TArray<KeyType, Allocator>& OutKeys) const
+	{
+		OutKeys.Reset(NumElements);
+		for (const ElementType& Element : *this)
+		{
+			OutKeys.Add(Element.Key);
+		}
+		return OutKeys.Num();
+	}
+
+	template<typename Allocator>
+	void GenerateValueArray(TArray<ValueType, Allocator>& OutValues) const
+	{
+		OutValues.Reset(NumElements);
+		for (const ElementType& Element : *this)
+		{
+			OutValues.Add(Element.Value);
+		}
+	}
+
+private:
+	template<bool bConst>
+	class TBaseIterator
+	{
+		using MapType = typename TChooseClass<bConst, const TFlatHashMap, TFlatHashMap>::Result;
+		using ItElementType = typename TChooseClass<bConst, const ElementType, ElementType>::Result;
+
+	public:
+		TBaseIterator(MapType& InMap, int32 InIndex)
+			: Map(InMap)
+			, Index(InIndex)
+		{
+			SkipInvalid();
+		}
+
+		FORCEINLINE TBaseIterator& operator++()
+		{
+			++Index;
+			SkipInvalid();
+			return *this;
+		}
+
+		FORCEINLINE explicit operator bool() const
+		{
+			return Index < Map.GetIterationEnd();
+		}
+
+		FORCEINLINE bool operator!() const
+		{
+			return !(bool)*this;
+		}
+
+		FORCEINLINE bool operator!=(const TBaseIterator& Other) const
+		{
+			return Index != Other.Index;
+		}
+
+		FORCEINLINE bool operator==(const TBaseIterator& Other) const
+		{
+			return Index == Other.Index;
+		}
+
+		FORCEINLINE ItElementType& operator*() const
+		{
+			return Map.GetIteratedElement(Index);
+		}
+
+		FORCEINLINE ItElementType* operator->() const
+		{
+			return &Map.GetIteratedElement(Index);
+		}
+
+		FORCEINLINE const KeyType& Key() const
+		{
+			return Map.GetIteratedElement(Index).Key;
+		}
+
+		FORCEINLINE decltype(auto) Value() const
+		{
+			return (Map.GetIteratedElement(Index).Value);
+		}
+
+	protected:
+		FORCEINLINE void SkipInvalid()
+		{
+			if constexpr (!bStableIteration)
+			{
+				while (Index < Map.Capacity && Map.Ctrl[Index] < 0)
+				{
+					++Index;
+				}
+			}
+		}
+
+		MapType& Map;
+		int32 Index;
+	};
+
+public:
+	class TIterator : public TBaseIterator<false>
+	{
+		using Super = TBaseIterator<false>;
+
+	public:
+		TIterator(TFlatHashMap& InMap, int32 InIndex = 0)
+			: Super(InMap, InIndex)
+		{
+		}
+
+		/** Removes the current element. The iterator must be incremented before it is dereferenced again. */
+		void RemoveCurrent()
+		{
+			this->Map.RemoveIterated(this->Index);
+			if constexpr (bStableIteration)
+			{
+				// The last element was swapped into the current position and still has to be visited.
+				--this->Index;
+			}
+		}
+	};
+
+	class TConstIterator : public TBaseIterator<true>
+	{
+		using Super = TBaseIterator<true>;
+
+	public:
+		TConstIterator(const TFlatHashMap& InMap, int32 InIndex = 0)
+			: Super(InMap, InIndex)
+		{
+		}
+	};
+
+	FORCEINLINE TIterator CreateIterator()
+	{
+		return TIterator(*this);
+	}
+
+	FORCEINLINE TConstIterator CreateConstIterator() const
+	{
+		return TConstIterator(*this);
+	}
+
+	FORCEINLINE TIterator      begin()       { return TIterator(*this); }
+	FORCEINLINE TConstIterator begin() const { return TConstIterator(*this); }
+	FORCEINLINE TIterator      end()         { return TIterator(*this, GetIterationEnd()); }
+	FORCEINLINE TConstIterator end() const   { return TConstIterator(*this, GetIterationEnd()); }
+
+private:
+	static FORCEINLINE int32 GetMaxLoad(int32 InCapacity)
+	{
+		return InCapacity - InCapacity / 8;
+	}
+
+	static int32 GetCapacityForNum(int32 Number)
+	{
+		// Smallest power of two whose 7/8 load can hold Number elements.
+		const uint32 MinSlots = (uint32)Number + (uint32)Number / 7 + 1;
+		return FMath::Max<int32>(MinCapacity, (int32)FPlatformMath::RoundUpToPowerOfTwo(MinSlots));
+	}
+
+	static FORCEINLINE SIZE_T GetSlotsOffset(int32 InCapacity)
+	{
+		return Align((SIZE_T)InCapacity + GroupWidth, alignof(SlotType));
+	}
+
+	static FORCEINLINE SIZE_T GetAllocationLayoutSize(int32 InCapacity)
+	{
+		return GetSlotsOffset(InCapacity) + (SIZE_T)InCapacity * sizeof(SlotType);
+	}
+
+	FORCEINLINE int32 GetIterationEnd() const
+	{
+		if constexpr (bStableIteration)
+		{
+			return Elements.Num();
+		}
+		else
+		{
+			return Capacity;
+		}
+	}
+
+	FORCEINLINE ElementType& GetIteratedElement(int32 Index)
+	{
+		if constexpr (bStableIteration)
+		{
+			return Elements[Index];
+		}
+		else
+		{
+			return *Slots[Index].GetTypedPtr();
+		}
+	}
+
+	FORCEINLINE const ElementType& GetIteratedElement(int32 Index) const
+	{
+		return const_cast<TFlatHashMap*>(this)->GetIteratedElement(Index);
+	}
+
+	FORCEINLINE ElementType& GetSlotElement(int32 Slot)
+	{
+		if constexpr (bStableIteration)
+		{
+			return Elements.GetData()[Slots[Slot]];
+		}
+		else
+		{
+			return *Slots[Slot].GetTypedPtr();
+		}
+	}
+
+	FORCEINLINE void SetCtrl(int32 Slot, FCtrl Value)
+	{
+		Ctrl[Slot] = Value;
+		// The first group is mirrored past the end so groups starting near the end can be loaded without wrapping.
+		if (Slot < GroupWidth)
+		{
+			Ctrl[Capacity + Slot] = Value;
+		}
+	}
+
+	template<typename ComparableKey>
+	FORCEINLINE int32 FindSlot(const ComparableKey& Key, uint32 KeyHash) const
+	{
+		if (!Capacity)
+		{
+			return INDEX_NONE;
+		}
+
+		const FHash Hash(KeyHash);
+		const uint32 CapacityMask = (uint32)Capacity - 1;
+		uint32 Pos = (uint32)Hash.H1 & CapacityMask;
+		for (uint32 Step = GroupWidth;; Step += GroupWidth)
+		{
+			const FGroup Group(Ctrl + Pos);
+			for (FBitMask Match = Group.Match(Hash.H2); Match; Match.ClearLowest())
+			{
+				const int32 Slot = (int32)((Pos + Match.Lowest()) & CapacityMask);
+				if (KeyFuncs::Matches(KeyFuncs::GetSetKey(const_cast<TFlatHashMap*>(this)->GetSlotElement(Slot)), Key))
+				{
+					return Slot;
+				}
+			}
+			if (Group.MatchEmpty())
+			{
+				return INDEX_NONE;
+			}
+			// Triangular probing over groups visits every group once for power of two capacities.
+			Pos = (Pos + Step) & CapacityMask;
+		}
+	}
+
+	/** Finds the first empty or deleted slot in the probe sequence of Hash. There must be one. */
+	FORCEINLINE int32 FindInsertSlot(const FHash& Hash) const
+	{
+		const uint32 CapacityMask = (uint32)Capacity - 1;
+		uint32 Pos = (uint32)Hash.H1 & CapacityMask;
+		for (uint32 Step = GroupWidth;; Step += GroupWidth)
+		{
+			const FBitMask Match = FGroup(Ctrl + Pos).MatchEmptyOrDeleted();
+			if (Match)
+			{
+				return (int32)((Pos + Match.Lowest()) & CapacityMask);
+			}
+			Pos = (Pos + Step) & CapacityMask;
+		}
+	}
+
+	/** Claims a slot for a key known not to be in the table and returns it. */
+	int32 PrepareInsert(uint32 KeyHash)
+	{
+		const FHash Hash(KeyHash);
+		int32 Slot = Capacity ? FindInsertSlot(Hash) : INDEX_NONE;
+		if (Slot == INDEX_NONE || (GrowthLeft == 0 && Ctrl[Slot] == CtrlEmpty))
+		{
+			// If at least half of the load is tombstones, rehashing at the same size is enough to make room.
+			const int32 NewCapacity = (Capacity && NumElements <= GetMaxLoad(Capacity) / 2) ? Capacity : GetCapacityForNum(NumElements + 1);
+			Rehash(NewCapacity);
+			Slot = FindInsertSlot(Hash);
+		}
+
+		GrowthLeft -= (Ctrl[Slot] == CtrlEmpty) ? 1 : 0;
+		SetCtrl(Slot, (FCtrl)Hash.H2);
+		++NumElements;
+		return Slot;
+	}
+
+	template<typename InitKeyType, typename... ArgsType>
+	ElementType& EmplaceNew(uint32 KeyHash, InitKeyType&& InKey, ArgsType&&... Args)
+	{
+		const int32 Slot = PrepareInsert(KeyHash);
+		if constexpr (bStableIteration)
+		{
+			Slots[Slot] = Elements.Num();
+			return Elements.Emplace_GetRef(Forward<InitKeyType>(InKey), Forward<ArgsType>(Args)...);
+		}
+		else
+		{
+			return *new (Slots[Slot].GetTypedPtr()) ElementType(Forward<InitKeyType>(InKey), Forward<ArgsType>(Args)...);
+		}
+	}
+
+	template<typename InitKeyType>
+	ValueType& FindOrAddImpl(InitKeyType&& Key)
+	{
+		const uint32 KeyHash = KeyFuncs::GetKeyHash(Key);
+		const int32 ExistingSlot = FindSlot(Key, KeyHash);
+		if (ExistingSlot != INDEX_NONE)
+		{
+			return GetSlotElement(ExistingSlot).Value;
+		}
+		return EmplaceNew(KeyHash, Forward<InitKeyType>(Key), ValueType()).Value;
+	}
+
+	void RemoveSlot(int32 Slot)
+	{
+		if constexpr (bStableIteration)
+		{
+			const int32 RemovedIndex = Slots[Slot];
+			const int32 LastIndex = Elements.Num() - 1;
+			if (RemovedIndex != LastIndex)
+			{
+				// Repoint the slot of the last element before it is swapped into the removed element's place.
+				const ElementType& LastElement = Elements[LastIndex];
+				const FHash LastHash(KeyFuncs::GetKeyHash(KeyFuncs::GetSetKey(LastElement)));
+				const uint32 CapacityMask = (uint32)Capacity - 1;
+				uint32 Pos = (uint32)LastHash.H1 & CapacityMask;
+				for (uint32 Step = GroupWidth;; Step += GroupWidth)
+				{
+					bool bFound = false;
+					for (FBitMask Match = FGroup(Ctrl + Pos).Match(LastHash.H2); Match; Match.ClearLowest())
+					{
+						const int32 LastSlot = (int32)((Pos + Match.Lowest()) & CapacityMask);
+						if (Slots[LastSlot] == LastIndex)
+						{
+							Slots[LastSlot] = RemovedIndex;
+							bFound = true;
+							break;
+						}
+					}
+					if (bFound)
+					{
+						break;
+					}
+					Pos = (Pos + Step) & CapacityMask;
+				}
+			}
+			Elements.RemoveAtSwap(RemovedIndex, 1, false);
+		}
+		else
+		{
+			DestructItem(Slots[Slot].GetTypedPtr());
+		}
+
+		EraseCtrl(Slot);
+		--NumElements;
+	}
+
+	void EraseCtrl(int32 Slot)
+	{
+		// A slot can go straight back to Empty if no probe sequence can have passed over it, which is the case when
+		// the groups directly before and after it together have an empty slot within one group width.
+		const uint32 CapacityMask = (uint32)Capacity - 1;
+		const uint32 IndexBefore = ((uint32)Slot - GroupWidth) & CapacityMask;
+		const FBitMask EmptyAfter = FGroup(Ctrl + Slot).MatchEmpty();
+		const FBitMask EmptyBefore = FGroup(Ctrl + IndexBefore).MatchEmpty();
+
+		const uint32 LeadingEmptyAfter = EmptyAfter ? (uint32)EmptyAfter.Lowest() : (uint32)GroupWidth;
+		const uint32 TrailingEmptyBefore = EmptyBefore ? (uint32)(GroupWidth - 1 - (FPlatformMath::FloorLog2_64(EmptyBefore.Mask) >> FBitMask::LaneShift)) : (uint32)GroupWidth;
+		const bool bWasNeverFull = EmptyAfter && EmptyBefore && (LeadingEmptyAfter + TrailingEmptyBefore) < (uint32)GroupWidth;
+
+		SetCtrl(Slot, bWasNeverFull ? CtrlEmpty : CtrlDeleted);
+		GrowthLeft += bWasNeverFull ? 1 : 0;
+	}
+
+	void RemoveIterated(int32 Index)
+	{
+		if constexpr (bStableIteration)
+		{
+			const ElementType& Element = Elements[Index];
+			const int32 Slot = FindSlot(KeyFuncs::GetSetKey(Element), KeyFuncs::GetKeyHash(KeyFuncs::GetSetKey(Element)));
+			checkSlow(Slot != INDEX_NONE);
+			RemoveSlot(Slot);
+		}
+		else
+		{
+			RemoveSlot(Index);
+		}
+	}
+
+	void Rehash(int32 NewCapacity)
+	{
+		checkSlow(FMath::IsPowerOfTwo(NewCapacity) && NewCapacity >= MinCapacity);
+
+		FCtrl* OldCtrl = Ctrl;
+		SlotType* OldSlots = Slots;
+		const int32 OldCapacity = Capacity;
+
+		const SIZE_T SlotsOffset = GetSlotsOffset(NewCapacity);
+		uint8* Allocation = (uint8*)FMemory::Malloc(GetAllocationLayoutSize(NewCapacity), FMath::Max<uint32>(alignof(SlotType), 16));
+		Ctrl = (FCtrl*)Allocation;
+		Slots = (SlotType*)(Allocation + SlotsOffset);
+		Capacity = NewCapacity;
+		FMemory::Memset(Ctrl, (uint8)CtrlEmpty, NewCapacity + GroupWidth);
+		GrowthLeft = GetMaxLoad(NewCapacity) - NumElements;
+
+		if constexpr (bStableIteration)
+		{
+			for (int32 Index = 0; Index < Elements.Num(); ++Index)
+			{
+				const FHash Hash(KeyFuncs::GetKeyHash(KeyFuncs::GetSetKey(Elements[Index])));
+				const int32 Slot = FindInsertSlot(Hash);
+				SetCtrl(Slot, (FCtrl)Hash.H2);
+				Slots[Slot] = Index;
+			}
+		}
+		else
+		{
+			for (int32 OldSlot = 0; OldSlot < OldCapacity; ++OldSlot)
+			{
+				if (OldCtrl[OldSlot] >= 0)
+				{
+					ElementType* Element = OldSlots[OldSlot].GetTypedPtr();
+					const FHash Hash(KeyFuncs::GetKeyHash(KeyFuncs::GetSetKey(*Element)));
+					const int32 Slot = FindInsertSlot(Hash);
+					SetCtrl(Slot, (FCtrl)Hash.H2);
+					RelocateConstructItems<ElementType>(Slots[Slot].GetTypedPtr(), Element, 1);
+				}
+			}
+		}
+
+		if (OldCtrl)
+		{
+			FMemory::Free(OldCtrl);
+		}
+	}
+
+	void DestructElements()
+	{
+		if constexpr (bStableIteration)
+		{
+			Elements.Reset();
+		}
+		else if constexpr (!TIsTriviallyDestructible<ElementType>::Value)
+		{
+			for (int32 Slot = 0; Slot < Capacity; ++Slot)
+			{
+				if (Ctrl[Slot] >= 0)
+				{
+					DestructItem(Slots[Slot].GetTypedPtr());
+				}
+			}
+		}
+	}
+
+	void DestroyAll()
+	{
+		DestructElements();
+		if constexpr (bStableIteration)
+		{
+			Elements.Empty();
+		}
+		if (Ctrl)
+		{
+			FMemory::Free(Ctrl);
+		}
+		Ctrl = nullptr;
+		Slots = nullptr;
+		Capacity = 0;
+		NumElements = 0;
+		GrowthLeft = 0;
+	}
+
+	/** Control bytes followed by the slots, in a single allocation. */
+	FCtrl* Ctrl = nullptr;
+	SlotType* Slots = nullptr;
+	int32 Capacity = 0;
+	int32 NumElements = 0;
+	/** Number of Empty slots that can still be claimed before the table exceeds its maximum load. */
+	int32 GrowthLeft = 0;
+
+	/** Dense element storage, only used with bStableIteration. */
+	struct FNoElements
+	{
+		FNoElements() = default;
+		FNoElements(FNoElements&&) = default;
+		FNoElements& operator=(FNoElements&&) = default;
+		SIZE_T GetAllocatedSize() const { return 0; }
+	};
+	typename TChooseClass<bStableIteration, TArray<ElementType>, FNoElements>::Result Elements;
+};
+
+/** Flat hash map variant that stores elements in the slots and does not keep iteration order. */
+template<typename KeyType, typename ValueType, typename KeyFuncs = TDefaultMapHashableKeyFuncs<KeyType, ValueType, false>>
+using TUnorderedFlatHashMap = TFlatHashMap<KeyType, ValueType, KeyFuncs, false>;
@@ -0,0 +1,346 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Containers/Array.h"
+#include "Containers/ContainerAllocationPolicies.h"
+#include "Containers/StringFwd.h"
+#include "Containers/StringView.h"
+#include "Containers/UnrealString.h"
+#include "Math/UnrealMathUtility.h"
+#include "Misc/AssertionMacros.h"
+#include "Misc/CString.h"
+#include "Misc/Crc.h"
+#include "Templates/UnrealTemplate.h"
+
+/**
+ * String with inline storage for short strings.
+ *
+ * Behaves like a minimal FString, but keeps up to NumInlineChars - 1 characters (plus the null terminator) inside the
+ * object and only allocates from the heap when the string grows past that. This suits the short strings that are built
+ * and thrown away in hot paths, such as path components, log arguments and console variable names:
+ *
+ *     TInlineString<32> Name(PackageName);
+ *     Name.AppendChar(TEXT('_')).Append(Suffix);
+ *     FindOrAddEntry(Name); // Takes FStringView
+ *
+ * TInlineString is a contiguous range of TCHAR, so it converts implicitly to FStringView and explicitly to FString.
+ * Comparisons and hashing match FString: operators are case-insensitive and GetTypeHash returns the same value as it
+ * does for an equal FString, so the two can be used interchangeably as keys in lookups that take an FStringView.
+ *
+ * Unlike TStringBuilder, a TInlineString can be copied and moved, and is intended to be stored in other objects.
+ */
+template <int32 NumInlineChars>
+class TInlineString
+{
+	static_assert(NumInlineChars > 0, "TInlineString needs room for at least the null terminator");
+
+public:
+	using ElementType = TCHAR;
+	using DataType = TArray<TCHAR, TInlineAllocator<NumInlineChars>>;
+
+	TInlineString() = default;
+	TInlineString(TInlineString&&) = default;
+	TInlineString(const TInlineString&) = default;
+	TInlineString& operator=(TInlineString&&) = default;
+	TInlineString& operator=(const TInlineString&) = default;
+
+	/** Construct from a null-terminated string. */
+	FORCEINLINE TInlineString(const TCHAR* Str)
+	{
+		if (Str && *Str)
+		{
+			Assign(Str, FCString::Strlen(Str));
+		}
+	}
+
+	/** Construct from a string view. */
+	FORCEINLINE explicit TInlineString(FStringView Str)
+	{
+		Assign(Str.GetData(), Str.Len());
+	}
+
+	/** Construct from an FString. */
+	FORCEINLINE explicit TInlineString(const FString& Str)
+	{
+		Assign(*Str, Str.Len());
+	}
+
+	FORCEINLINE TInlineString& operator=(const TCHAR* Str)
+	{
+		Assign(Str, Str ? FCString::Strlen(Str) : 0);
+		return *this;
+	}
+
+	FORCEINLINE TInlineString& operator=(FStringView Str)
+	{
+		Assign(Str.GetData(), Str.Len());
+		return *this;
+	}
+
+	FORCEINLINE TInlineString& operator=(const FString& Str)
+	{
+		Assign(*Str, Str.Len());
+		return *this;
+	}
+
+	/** Returns the string as an FString. This allocates for any non-empty string. */
+	UE_NODISCARD FORCEINLINE FString ToString() const
+	{
+		return FString(ToView());
+	}
+
+	/** Returns a null-terminated pointer to the characters of the string. */
+	UE_NODISCARD FORCEINLINE const TCHAR* operator*() const
+	{
+		return Data.Num() ? Data.GetData() : TEXT("");
+	}
+
+	/** Returns a view of the string, not including the null terminator. */
+	UE_NODISCARD FORCEINLINE FStringView ToView() const
+	{
+		return FStringView(GetData(), Len());
+	}
+
+	/** Returns a pointer to the characters. May be null when the string is empty. */
+	UE_NODISCARD FORCEINLINE TCHAR* GetData()
+	{
+		return Data.GetData();
+	}
+
+	UE_NODISCARD FORCEINLINE const TCHAR* GetData() const
+	{
+		return Data.GetData();
+	}
+
+	/** Returns the number of characters, not including the null terminator. */
+	UE_NODISCARD FORCEINLINE int32 Len() const
+	{
+		return Data.Num() ? Data.Num() - 1 : 0;
+	}
+
+	UE_NODISCARD FORCEINLINE bool IsEmpty() const
+	{
+		return Data.Num() <= 1;
+	}
+
+	/** Returns whether the string currently lives in the inline buffer. */
+	UE_NODISCARD FORCEINLINE bool IsInline() const
+	{
+		return Data.Max() <= NumInlineChars;
+	}
+
+	UE_NODISCARD FORCEINLINE TCHAR& operator[](int32 Index)
+	{
+		checkf(Index >= 0 && Index < Len(), TEXT("String index out of bounds: Index %i from a string with a length of %i"), Index, Len());
+		return Data.GetData()[Index];
+	}
+
+	UE_NODISCARD FORCEINLINE const TCHAR& operator[](int32 Index) const
+	{
+		checkf(Index >= 0 && Index < Len(), TEXT("String index out of bounds: Index %i from a string with a length of %i"), Index, Len());
+		return Data.GetData()[Index];
+	}
+
+	/** Returns the number of heap bytes used by the string, which is 0 while it fits in the inline buffer. */
+	UE_NODISCARD FORCEINLINE SIZE_T GetAllocatedSize() const
+	{
+		return IsInline() ? 0 : Data.GetAllocatedSize();
+	}
+
+	/** Makes sure the string has room for at least NumChars characters, not including the null terminator. */
+	FORCEINLINE void Reserve(int32 NumChars)
+	{
+		checkSlow(NumChars >= 0);
+		Data.Reserve(NumChars + 1);
+	}
+
+	/** Removes all characters but keeps any heap allocation. */
+	FORCEINLINE void Reset(int32 NewReservedSize = 0)
+	{
+		Data.Reset(NewReservedSize ? NewReservedSize + 1 : 0);
+	}
+
+	/** Removes all characters and releases any heap allocation. */
+	FORCEINLINE void Empty()
+	{
+		Data.Empty();
+	}
+
+	/** Append a string and return a reference to this */
+	TInlineString& Append(const TCHAR* Str, int32 Count)
+	{
+		checkSlow(Count >= 0);
+		if (Count)
+		{
+			checkf(Str < Data.GetData() || Str >= Data.GetData() + Data.Max(), TEXT("Appending a TInlineString to itself is not supported"));
+
+			const int32 OldLen = Len();
+			Data.SetNumUninitialized(OldLen + Count + 1, false);
+			TCHAR* Dest = Data.GetData() + OldLen;
+			FMemory::Memcpy(Dest, Str, Count * sizeof(TCHAR));
+			Dest[Count] = TEXT('\0');
+		}
+		return *this;
+	}
+
+	FORCEINLINE TInlineString& Append(const TCHAR* Str)
+	{
+		checkSlow(Str);
+		return Append(Str, FCString::Strlen(Str));
+	}
+
+	FORCEINLINE TInlineString& Append(FStringView Str)
+	{
+		return Append(Str.GetData(), Str.Len());
+	}
+
+	FORCEINLINE TInlineString& Append(const FString& Str)
+	{
+		return Append(*Str, Str.Len());
+	}
+
+	/** Append a single character and return a reference to this */
+	TInlineString& AppendChar(TCHAR InChar)
+	{
+		checkSlow(InChar != TEXT('\0'));
+		if (Data.Num())
+		{
+			Data.Last() = InChar;
+		}
+		else
+		{
+			Data.Add(InChar);
+		}
+		Data.Add(TEXT('\0'));
+		return *this;
+	}
+
+	FORCEINLINE TInlineString& operator+=(const TCHAR* Str)
+	{
+		return Append(Str);
+	}
+
+	FORCEINLINE TInlineString& operator+=(FStringView Str)
+	{
+		return Append(Str);
+	}
+
+	FORCEINLINE TInlineString& operator+=(const FString& Str)
+	{
+		return Append(Str);
+	}
+
+	FORCEINLINE TInlineString& operator+=(TCHAR Char)
+	{
+		return AppendChar(Char);
+	}
+
+	/** Modifies the string such that it is now the left most characters chopping the given number of characters from the end */
+	void LeftChopInline(int32 Count)
+	{
+		const int32 NewLen = FMath::Clamp(Len() - Count, 0, Len());
+		if (NewLen)
+		{
+			Data.SetNum(NewLen + 1, false);
+			Data.Last() = TEXT('\0');
+		}
+		else
+		{
+			Data.Reset();
+		}
+	}
+
+	/** Lexicographically tests whether this string is equivalent to another. */
+	UE_NODISCARD FORCEINLINE bool Equals(FStringView Other, ESearchCase::Type SearchCase = ESearchCase::CaseSensitive) const
+	{
+		return ToView().Equals(Other, SearchCase);
+	}
+
+	/** Lexicographically compares this string with another. */
+	UE_NODISCARD FORCEINLINE int32 Compare(FStringView Other, ESearchCase::Type SearchCase = ESearchCase::CaseSensitive) const
+	{
+		return ToView().Compare(Other, SearchCase);
+	}
+
+	/** Case insensitive equality, matching FString. */
+	UE_NODISCARD FORCEINLINE friend bool operator==(const TInlineString& Lhs, const TInlineString& Rhs)
+	{
+		return Lhs.Equals(Rhs.ToView(), ESearchCase::IgnoreCase);
+	}
+
+	UE_NODISCARD FORCEINLINE friend bool operator==(const TInlineString& Lhs, FStringView Rhs)
+	{
+		return Lhs.Equals(Rhs, ESearchCase::IgnoreCase);
+	}
+
+	UE_NODISCARD FORCEINLINE friend bool operator==(const TInlineString& Lhs, const TCHAR* Rhs)
+	{
+		return Lhs.Equals(Rhs, ESearchCase::IgnoreCase);
+	}
+
+	UE_NODISCARD FORCEINLINE friend bool operator!=(const TInlineString& Lhs, const TInlineString& Rhs)
+	{
+		return !(Lhs == Rhs);
+	}
+
+	UE_NODISCARD FORCEINLINE friend bool operator!=(const TInlineString& Lhs, FStringView Rhs)
+	{
+		return !(Lhs == Rhs);
+	}
+
+	UE_NODISCARD FORCEINLINE friend bool operator!=(const TInlineString& Lhs, const TCHAR* Rhs)
+	{
+		return !(Lhs == Rhs);
+	}
+
+	/** Case insensitive ordering, matching FString. */
+	UE_NODISCARD FORCEINLINE friend bool operator<(const TInlineString& Lhs, const TInlineString& Rhs)
+	{
+		return Lhs.Compare(Rhs.ToView(), ESearchCase::IgnoreCase) < 0;
+	}
+
+	/** Case insensitive string hash, matching GetTypeHash for FString and FStringView. */
+	UE_NODISCARD FORCEINLINE friend uint32 GetTypeHash(const TInlineString& S)
+	{
+		return FCrc::Strihash_DEPRECATED(S.Len(), *S);
+	}
+
+private:
+	void Assign(const TCHAR* Str, int32 Count)
+	{
+		checkSlow(Count >= 0);
+		if (Count)
+		{
+			// Str may point into this string when assigning a view of it
+			Data.SetNumUninitialized(Count + 1, false);
+			FMemory::Memmove(Data.GetData(), Str, Count * sizeof(TCHAR));
+			Data[Count] = TEXT('\0');
+		}
+		else
+		{
+			Data.Reset();
+		}
+	}
+
+	DataType Data;
+};
+
+template <int32 NumInlineChars>
+FORCEINLINE TCHAR* GetData(TInlineString<NumInlineChars>& String)
+{
+	return String.GetData();
+}
+
+template <int32 NumInlineChars>
+FORCEINLINE const TCHAR* GetData(const TInlineString<NumInlineChars>& String)
+{
+	return String.GetData();
+}
+
+template <int32 NumInlineChars>
+FORCEINLINE int32 GetNum(const TInlineString<NumInlineChars>& String)
+{
+	return String.Len();
+}
@@ -0,0 +1,764 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Containers/Array.h"
+#include "Containers/LruCache.h"
+#include "Containers/Set.h"
+#include "Delegates/Delegate.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/AssertionMacros.h"
+#include "Misc/ScopeLock.h"
+#include "Templates/UnrealTemplate.h"
+
+#include <atomic>
+
+
+/**
+ * Default cost function for TSizedLruCache, charging the inline size of the value.
+ *
+ * Values that own heap memory should use a policy that includes it, e.g. for TArray payloads:
+ *
+ *     struct FPayloadCost { static SIZE_T GetCost(const TArray<uint8>& Value) { return Value.GetAllocatedSize(); } };
+ *
+ * @param ValueType The type of cache entry values.
+ */
+template<typename ValueType>
+struct TDefaultLruCacheCost
+{
+	static FORCEINLINE SIZE_T GetCost(const ValueType& Value)
+	{
+		return sizeof(ValueType);
+	}
+};
+
+
+/**
+ * Cost budget that can be shared by several TSizedLruCache instances, e.g. one budget for all decoded asset caches.
+ *
+ * Every cache charges the cost of its entries to the budget. A cache that needs room evicts its own least recently
+ * used entries until both its local limit and the shared budget are met, so a cache that keeps adding pushes out its
+ * own old entries rather than entries of other caches.
+ *
+ * Thread-safe. The budget must outlive the caches that use it.
+ */
+class FLruCacheBudget
+	: FNoncopyable
+{
+public:
+
+	explicit FLruCacheBudget(SIZE_T InMaxCost)
+		: Cost(0)
+		, MaxCost(InMaxCost)
+	{ }
+
+	~FLruCacheBudget()
+	{
+		check(Cost.load(std::memory_order_relaxed) == 0 && "Caches must be destroyed before their shared budget");
+	}
+
+	/** Get the total cost of all entries charged to this budget. */
+	FORCEINLINE SIZE_T GetCost() const
+	{
+		return Cost.load(std::memory_order_relaxed);
+	}
+
+	/** Get the maximum total cost. */
+	FORCEINLINE SIZE_T GetMaxCost() const
+	{
+		return MaxCost.load(std::memory_order_relaxed);
+	}
+
+	/** Change the maximum total cost. Caches trim to the new budget the next time they add an entry or call Trim(). */
+	FORCEINLINE void SetMaxCost(SIZE_T InMaxCost)
+	{
+		MaxCost.store(InMaxCost, std::memory_order_relaxed);
+	}
+
+	/** Check whether an additional cost fits into the budget. */
+	FORCEINLINE bool HasRoomFor(SIZE_T AdditionalCost) const
+	{
+		return GetCost() + AdditionalCost <= GetMaxCost();
+	}
+
+	FORCEINLINE void Charge(SIZE_T InCost)
+	{
+		Cost.fetch_add(InCost, std::memory_order_relaxed);
+	}
+
+	FORCEINLINE void Release(SIZE_T InCost)
+	{
+		checkSlow(GetCost() >= InCost);
+		Cost.fetch_sub(InCost, std::memory_order_relaxed);
+	}
+
+private:
+
+	std::atomic<SIZE_T> Cost;
+	std::atomic<SIZE_T> MaxCost;
+};
+
+
+/**
+ * Implements a Least Recently Used (LRU) cache bounded by the total cost of its entries rather than their number.
+ *
+ * The cost of an entry is computed by CostFuncs::GetCost when the entry is added or updated, typically its size in
+ * bytes. Adding an entry evicts the least recently used entries until the total cost fits into the cache's
+ * maximum cost and, if one is set, into the shared FLruCacheBudget. Evicted entries are passed to the OnEvicted
+ * delegate before they are destroyed.
+ *
+ * Pinned entries are never evicted, so the total cost can temporarily exceed the budget while many entries are pinned.
+ *
+ * Not thread-safe, see TConcurrentSizedLruCache.
+ *
+ * @param KeyType The type of cache entry keys.
+ * @param ValueType The type of cache entry values.
+ * @param CostFuncs Policy with a static SIZE_T GetCost(const ValueType&) function.
+ * @param KeyComp Optional functions for comparing keys (see DefaultKeyComparer in LruCache.h).
+ */
+template<typename KeyType, typename ValueType, typename CostFuncs = TDefaultLruCacheCost<ValueType>, typename KeyComp = DefaultKeyComparer<KeyType>>
+class TSizedLruCache
+	: FNoncopyable
+{
+	/** An entry in the LRU cache. */
+	struct FCacheEntry
+	{
+		/** The entry's lookup key. */
+		KeyType Key;
+
+		/** The less recent entry in the linked list. */
+		FCacheEntry* LessRecent;
+
+		/** The more recent entry in the linked list. */
+		FCacheEntry* MoreRecent;
+
+		/** The entry's value. */
+		ValueType Value;
+
+		/** The cost charged for the entry. */
+		SIZE_T Cost;
+
+		/** Number of outstanding Pin() calls. */
+		int32 PinCount;
+
+		FCacheEntry(const KeyType& InKey, ValueType&& InValue, SIZE_T InCost)
+			: Key(InKey)
+			, LessRecent(nullptr)
+			, MoreRecent(nullptr)
+			, Value(MoveTemp(InValue))
+			, Cost(InCost)
+			, PinCount(0)
+		{ }
+	};
+
+	/** Lookup set key functions. */
+	struct FKeyFuncs : public BaseKeyFuncs<FCacheEntry*, KeyType>
+	{
+		FORCEINLINE static const KeyType& GetSetKey(const FCacheEntry* Entry)
+		{
+			return Entry->Key;
+		}
+
+		FORCEINLINE static bool Matches(KeyType A, KeyType B)
+		{
+			return KeyComp::Matches(A, B);
+		}
+
+		FORCEINLINE static uint32 GetKeyHash(KeyType Key)
+		{
+			return KeyComp::GetKeyHash(Key);
+		}
+	};
+
+public:
+
+	/** Delegate called with every entry evicted to make room, right before it is destroyed. */
+	using FOnEvicted = TDelegate<void(const KeyType& /*Key*/, ValueType& /*Value*/)>;
+
+	/**
+	 * Create and initialize a new instance.
+	 *
+	 * @param InMaxCost The maximum total cost of the entries in this cache.
+	 * @param InSharedBudget Optional budget shared with other caches, which must outlive this cache.
+	 */
+	explicit TSizedLruCache(SIZE_T InMaxCost, FLruCacheBudget* InSharedBudget = nullptr)
+		: LeastRecent(nullptr)
+		, MostRecent(nullptr)
+		, TotalCost(0)
+		, MaxCost(InMaxCost)
+		, SharedBudget(InSharedBudget)
+	{ }
+
+	/** Destructor. */
+	~TSizedLruCache()
+	{
+		Empty();
+	}
+
+public:
+
+	/**
+	 * Add an entry to the cache, evicting least recently used entries to make room.
+	 *
+	 * If an entry with the specified key already exists in the cache, its value and cost are replaced.
+	 * The added or updated entry will be marked as the most recently used one.
+	 *
+	 * @param Key The entry's lookup key.
+	 * @param Value The entry's value.
+	 * @return false if the entry alone costs more than the cache can hold, in which case it is not added and any existing entry with the key is removed.
+	 * @see Find, Pin, Remove
+	 */
+	bool Add(const KeyType& Key, ValueType Value)
+	{
+		const SIZE_T Cost = CostFuncs::GetCost(Value);
+
+		FCacheEntry** EntryPtr = LookupSet.Find(Key);
+		FCacheEntry* Entry = EntryPtr ? *EntryPtr : nullptr;
+
+		if (Cost > MaxCost || (SharedBudget && Cost > SharedBudget->GetMaxCost()))
+		{
+			if (Entry)
+			{
+				Remove(Entry);
+			}
+			return false;
+		}
+
+		if (Entry)
+		{
+			// Update existing entry, it won't be evicted while making room since it is pinned
+			ReleaseCost(Entry->Cost);
+			++Entry->PinCount;
+			MakeRoom(Cost);
+			--Entry->PinCount;
+
+			Entry->Value = MoveTemp(Value);
+			Entry->Cost = Cost;
+			ChargeCost(Cost);
+			MarkAsRecent(*Entry);
+		}
+		else
+		{
+			MakeRoom(Cost);
+
+			FCacheEntry* NewEntry = new FCacheEntry(Key, MoveTemp(Value), Cost);
+			LinkAsMostRecent(*NewEntry);
+			LookupSet.Add(NewEntry);
+			ChargeCost(Cost);
+		}
+
+		return true;
+	}
+
+	/**
+	 * Check whether an entry with the specified key is in the cache.
+	 *
+	 * @param Key The key of the entry to check.
+	 * @return true if the entry is in the cache, false otherwise.
+	 */
+	FORCEINLINE bool Contains(const KeyType& Key) const
+	{
+		return LookupSet.Contains(Key);
+	}
+
+	/**
+	 * Empty the cache. Entries are destroyed without calling the OnEvicted delegate, pins are discarded.
+	 */
+	void Empty()
+	{
+		for (FCacheEntry* Entry : LookupSet)
+		{
+			ReleaseCost(Entry->Cost);
+			delete Entry;
+		}
+
+		LookupSet.Empty();
+
+		MostRecent = nullptr;
+		LeastRecent = nullptr;
+		checkSlow(TotalCost == 0);
+	}
+
+	/**
+	 * Find the value of the entry with the specified key.
+	 *
+	 * @param Key The key of the entry to get.
+	 * @return Pointer to the value, or nullptr if not found.
+	 * @see FindAndTouch
+	 */
+	FORCEINLINE const ValueType* Find(const KeyType& Key) const
+	{
+		FCacheEntry* const* EntryPtr = LookupSet.Find(Key);
+		return EntryPtr ? &(*EntryPtr)->Value : nullptr;
+	}
+
+	/**
+	 * Find the value of the entry with the specified key and mark it as the most recently used.
+	 *
+	 * @param Key The key of the entry to get.
+	 * @return Pointer to the value, or nullptr if not found. Only valid until the next Add, unless the entry is pinned.
+	 * @see Find
+	 */
+	const ValueType* FindAndTouch(const KeyType& Key)
+	{
+		FCacheEntry** EntryPtr = LookupSet.Find(Key);
+
+		if (EntryPtr == nullptr)
+		{
+			return nullptr;
+		}
+
+		MarkAsRecent(**EntryPtr);
+
+		return &(*EntryPtr)->Value;
+	}
+
+	/**
+	 * Find the keys of all cached entries, from most to least recently used.
+	 *
+	 * @param OutKeys Will contain the collection of keys.
+	 */
+	void GetKeys(TArray<KeyType>& OutKeys) const
+	{
+		for (const FCacheEntry* Entry = MostRecent; Entry; Entry = Entry->LessRecent)
+		{
+			OutKeys.Add(Entry->Key);
+		}
+	}
+
+	/**
+	 * Prevent an entry from being evicted until a matching Unpin(). Pins are counted.
+	 *
+	 * @param Key The key of the entry to pin.
+	 * @return Pointer to the pinned value, which stays valid until it is unpinned or removed, or nullptr if not found.
+	 */
+	const ValueType* Pin(const KeyType& Key)
+	{
+		FCacheEntry** EntryPtr = LookupSet.Find(Key);
+
+		if (EntryPtr == nullptr)
+		{
+			return nullptr;
+		}
+
+		++(*EntryPtr)->PinCount;
+		MarkAsRecent(**EntryPtr);
+
+		return &(*EntryPtr)->Value;
+	}
+
+	/**
+	 * Release a pin taken with Pin(). The entry can be evicted again once all its pins are released.
+	 *
+	 * @param Key The key of the entry to unpin.
+	 */
+	void Unpin(const KeyType& Key)
+	{
+		FCacheEntry** EntryPtr = LookupSet.Find(Key);
+
+		if (EntryPtr != nullptr)
+		{
+			check((*EntryPtr)->PinCount > 0);
+			--(*EntryPtr)->PinCount;
+		}
+	}
+
+	/** Check whether the entry with the specified key is pinned. */
+	bool IsPinned(const KeyType& Key) const
+	{
+		FCacheEntry* const* EntryPtr = LookupSet.Find(Key);
+		return EntryPtr && (*EntryPtr)->PinCount > 0;
+	}
+
+	/**
+	 * Remove the entry with the specified key from the cache. The OnEvicted delegate is not called.
+	 *
+	 * @param Key The key of the entry to remove.
+	 */
+	void Remove(const KeyType& Key)
+	{
+		FCacheEntry** EntryPtr = LookupSet.Find(Key);
+
+		if (EntryPtr != nullptr)
+		{
+			Remove(*EntryPtr);
+		}
+	}
+
+	/**
+	 * Evict least recently used entries until the total cost is at most TargetCost and fits the shared budget.
+	 *
+	 * @param TargetCost The total cost to trim the cache down to.
+	 */
+	void Trim(SIZE_T TargetCost)
+	{
+		while ((TotalCost > TargetCost || (SharedBudget && !SharedBudget->HasRoomFor(0))) && EvictLeastRecent())
+		{
+		}
+	}
+
+	/** Get the total cost of the cached entries. */
+	FORCEINLINE SIZE_T GetCost() const
+	{
+		return TotalCost;
+	}
+
+	/** Get the maximum total cost of the cached entries. */
+	FORCEINLINE SIZE_T GetMaxCost() const
+	{
+		return MaxCost;
+	}
+
+	/** Change the maximum total cost, evicting entries if the cache is over the new limit. */
+	void SetMaxCost(SIZE_T InMaxCost)
+	{
+		MaxCost = InMaxCost;
+		Trim(MaxCost);
+	}
+
+	/** Get the number of entries in the cache. */
+	FORCEINLINE int32 Num() const
+	{
+		return LookupSet.Num();
+	}
+
+	/** Returns true if the cache is empty and contains no elements. */
+	FORCEINLINE bool IsEmpty() const
+	{
+		return LookupSet.IsEmpty();
+	}
+
+	/** Delegate called with entries evicted to make room. */
+	FORCEINLINE FOnEvicted& OnEvicted()
+	{
+		return OnEvictedDelegate;
+	}
+
+protected:
+
+	/**
+	 * Evict least recently used unpinned entries until an additional cost fits into both budgets.
+	 */
+	void MakeRoom(SIZE_T AdditionalCost)
+	{
+		while ((TotalCost + AdditionalCost > MaxCost || (SharedBudget && !SharedBudget->HasRoomFor(AdditionalCost))) && EvictLeastRecent())
+		{
+		}
+	}
+
+	/**
+	 * Evict the least recently used entry that isn't pinned.
+	 *
+	 * @return false if there was no entry to evict.
+	 */
+	bool EvictLeastRecent()
+	{
+		FCacheEntry* Entry = LeastRecent;
+		while (Entry && Entry->PinCount > 0)
+		{
+			Entry = Entry->MoreRecent;
+		}
+
+		if (Entry == nullptr)
+		{
+			return false;
+		}
+
+		OnEvictedDelegate.ExecuteIfBound(Entry->Key, Entry->Value);
+		Remove(Entry);
+		return true;
+	}
+
+	/** Mark the given entry as recently used. */
+	FORCEINLINE void MarkAsRecent(FCacheEntry& Entry)
+	{
+		if (&Entry != MostRecent)
+		{
+			Unlink(Entry);
+			LinkAsMostRecent(Entry);
+		}
+	}
+
+	void LinkAsMostRecent(FCacheEntry& Entry)
+	{
+		Entry.LessRecent = MostRecent;
+		Entry.MoreRecent = nullptr;
+
+		if (MostRecent != nullptr)
+		{
+			MostRecent->MoreRecent = &Entry;
+		}
+
+		MostRecent = &Entry;
+
+		if (LeastRecent == nullptr)
+		{
+			LeastRecent = &Entry;
+		}
+	}
+
+	void Unlink(FCacheEntry& Entry)
+	{
+		if (Entry.LessRecent != nullptr)
+		{
+			Entry.LessRecent->MoreRecent = Entry.MoreRecent;
+		}
+		else
+		{
+			LeastRecent = Entry.MoreRecent;
+		}
+
+		if (Entry.MoreRecent != nullptr)
+		{
+			Entry.MoreRecent->LessRecent = Entry.LessRecent;
+		}
+		else
+		{
+			MostRecent = Entry.LessRecent;
+		}
+
+		Entry.LessRecent = nullptr;
+		Entry.MoreRecent = nullptr;
+	}
+
+	/** Remove and delete the given entry. */
+	void Remove(FCacheEntry* Entry)
+	{
+		check(Entry != nullptr);
+
+		Unlink(*Entry);
+		LookupSet.Remove(Entry->Key);
+		ReleaseCost(Entry->Cost);
+
+		delete Entry;
+	}
+
+	FORCEINLINE void ChargeCost(SIZE_T Cost)
+	{
+		TotalCost += Cost;
+		if (SharedBudget)
+		{
+			SharedBudget->Charge(Cost);
+		}
+	}
+
+	FORCEINLINE void ReleaseCost(SIZE_T Cost)
+	{
+		checkSlow(TotalCost >= Cost);
+		TotalCost -= Cost;
+		if (SharedBudget)
+		{
+			SharedBudget->Release(Cost);
+		}
+	}
+
+private:
+
+	/** Set of entries for fast lookup. */
+	TSet<FCacheEntry*, FKeyFuncs> LookupSet;
+
+	/** Least recent item in the cache. */
+	FCacheEntry* LeastRecent;
+
+	/** Most recent item in the cache. */
+	FCacheEntry* MostRecent;
+
+	/** Total cost of the entries in the cache. */
+	SIZE_T TotalCost;
+
+	/** Maximum total cost of the entries in the cache. */
+	SIZE_T MaxCost;
+
+	/** Optional budget shared with other caches. */
+	FLruCacheBudget* SharedBudget;
+
+	/** Called with entries evicted to make room. */
+	FOnEvicted OnEvictedDelegate;
+};
+
+
+/**
+ * Thread-safe TSizedLruCache, sharded by key hash so threads working on different keys rarely contend.
+ *
+ * Each shard is an independent TSizedLruCache with an equal part of the maximum cost, so recency is tracked per shard.
+ * Values are copied out rather than returned by pointer, as another thread may evict them at any time.
+ * The OnEvicted delegate is called with the shard lock held and must not access the cache.
+ *
+ * @param KeyType The type of cache entry keys.
+ * @param ValueType The type of cache entry values.
+ * @param CostFuncs Policy with a static SIZE_T GetCost(const ValueType&) function.
+ * @param KeyComp Optional functions for comparing keys (see DefaultKeyComparer in LruCache.h).
+ * @param NumShards Number of independently locked shards.
+ */
+template<typename KeyType, typename ValueType, typename CostFuncs = TDefaultLruCacheCost<ValueType>, typename KeyComp = DefaultKeyComparer<KeyType>, uint32 NumShards = 16>
+class TConcurrentSizedLruCache
+	: FNoncopyable
+{
+	static_assert(NumShards > 0, "TConcurrentSizedLruCache needs at least one shard");
+
+	using FShardCache = TSizedLruCache<KeyType, ValueType, CostFuncs, KeyComp>;
+
+	struct alignas(PLATFORM_CACHE_LINE_SIZE) FShard
+	{
+		FShard(SIZE_T InMaxCost, FLruCacheBudget* InSharedBudget)
+			: Cache(InMaxCost, InSharedBudget)
+		{ }
+
+		mutable FCriticalSection Lock;
+		FShardCache Cache;
+	};
+
+public:
+
+	using FOnEvicted = typename FShardCache::FOnEvicted;
+
+	/**
+	 * Create and initialize a new instance.
+	 *
+	 * @param InMaxCost The maximum total cost of the entries in this cache, split evenly between shards.
+	 * @param InSharedBudget Optional budget shared with other caches, which must outlive this cache.
+	 */
+	explicit TConcurrentSizedLruCache(SIZE_T InMaxCost, FLruCacheBudget* InSharedBudget = nullptr)
+	{
+		Shards.Reserve(NumShards);
+		for (uint32 ShardIndex = 0; ShardIndex < NumShards; ++ShardIndex)
+		{
+			Shards.Emplace(InMaxCost / NumShards, InSharedBudget);
+		}
+	}
+
+	/** @see TSizedLruCache::Add */
+	bool Add(const KeyType& Key, ValueType Value)
+	{
+		FShard& Shard = GetShard(Key);
+		FScopeLock _(&Shard.Lock);
+		return Shard.Cache.Add(Key, MoveTemp(Value));
+	}
+
+	/** Check whether an entry with the specified key is in the cache. */
+	bool Contains(const KeyType& Key) const
+	{
+		const FShard& Shard = GetShard(Key);
+		FScopeLock _(&Shard.Lock);
+		return Shard.Cache.Contains(Key);
+	}
+
+	/**
+	 * Copy out the value of the entry with the specified key and mark it as the most recently used.
+	 *
+	 * @return false if the key was not found.
+	 */
+	bool FindAndTouch(const KeyType& Key, ValueType& OutValue)
+	{
+		FShard& Shard = GetShard(Key);
+		FScopeLock _(&Shard.Lock);
+		if (const ValueType* Value = Shard.Cache.FindAndTouch(Key))
+		{
+			OutValue = *Value;
+			return true;
+		}
+		return false;
+	}
+
+	/**
+	 * Pin the entry with the specified key and copy out its value. See TSizedLruCache::Pin.
+	 *
+	 * @return false if the key was not found.
+	 */
+	bool Pin(const KeyType& Key, ValueType& OutValue)
+	{
+		FShard& Shard = GetShard(Key);
+		FScopeLock _(&Shard.Lock);
+		if (const ValueType* Value = Shard.Cache.Pin(Key))
+		{
+			OutValue = *Value;
+			return true;
+		}
+		return false;
+	}
+
+	/** @see TSizedLruCache::Unpin */
+	void Unpin(const KeyType& Key)
+	{
+		FShard& Shard = GetShard(Key);
+		FScopeLock _(&Shard.Lock);
+		Shard.Cache.Unpin(Key);
+	}
+
+	/** @see TSizedLruCache::Remove */
+	void Remove(const KeyType& Key)
+	{
+		FShard& Shard = GetShard(Key);
+		FScopeLock _(&Shard.Lock);
+		Shard.Cache.Remove(Key);
+	}
+
+	/** @see TSizedLruCache::Empty */
+	void Empty()
+	{
+		for (FShard& Shard : Shards)
+		{
+			FScopeLock _(&Shard.Lock);
+			Shard.Cache.Empty();
+		}
+	}
+
+	/** Evict entries until every shard is within its part of TargetCost and the shared budget. */
+	void Trim(SIZE_T TargetCost)
+	{
+		for (FShard& Shard : Shards)
+		{
+			FScopeLock _(&Shard.Lock);
+			Shard.Cache.Trim(TargetCost / NumShards);
+		}
+	}
+
+	/** Get the total cost of the cached entries. The result may be stale by the time it is returned. */
+	SIZE_T GetCost() const
+	{
+		SIZE_T Cost = 0;
+		for (const FShard& Shard : Shards)
+		{
+			FScopeLock _(&Shard.Lock);
+			Cost += Shard.Cache.GetCost();
+		}
+		return Cost;
+	}
+
+	/** Get the number of entries in the cache. The result may be stale by the time it is returned. */
+	int32 Num() const
+	{
+		int32 Num = 0;
+		for (const FShard& Shard : Shards)
+		{
+			FScopeLock _(&Shard.Lock);
+			Num += Shard.Cache.Num();
+		}
+		return Num;
+	}
+
+	/** Set the delegate called with entries evicted to make room. */
+	void SetOnEvicted(const FOnEvicted& InOnEvicted)
+	{
+		for (FShard& Shard : Shards)
+		{
+			FScopeLock _(&Shard.Lock);
+			Shard.Cache.OnEvicted() = InOnEvicted;
+		}
+	}
+
+private:
+
+	FORCEINLINE FShard& GetShard(const KeyType& Key)
+	{
+		return Shards[KeyComp::GetKeyHash(Key) % NumShards];
+	}
+
+	FORCEINLINE const FShard& GetShard(const KeyType& Key) const
+	{
+		return Shards[KeyComp::GetKeyHash(Key) % NumShards];
+	}
+
+	TArray<FShard, TInlineAllocator<NumShards>> Shards;
+};
@@ -0,0 +1,460 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Containers/ArrayView.h"
+#include "Containers/ContainerAllocationPolicies.h"
+#include "Containers/StridedView.h"
+#include "Delegates/IntegerSequence.h"
+#include "HAL/UnrealMemory.h"
+#include "Math/UnrealMathUtility.h"
+#include "Misc/AssertionMacros.h"
+#include "Templates/AlignmentTemplates.h"
+#include "Templates/MemoryOps.h"
+#include "Templates/UnrealTemplate.h"
+#include "Templates/UnrealTypeTraits.h"
+
+/**
+ * Structure-of-arrays container.
+ *
+ * Each field type gets its own contiguous column, so a loop that only touches one or two fields streams through just
+ * the memory it needs, and every column can be handed to ISPC or SIMD kernels as a plain array:
+ *
+ *     TSoAArray<FVector3f, FVector3f, float> Particles; // position, velocity, mass
+ *     Particles.Add(Position, Velocity, 1.0f);
+ *     ispc::Integrate(Particles.GetData<0>(), Particles.GetData<1>(), Particles.Num(), DeltaTime);
+ *
+ * All columns live in a single allocation and grow together, with each column aligned to at least 16 bytes.
+ * Fields are addressed by index, in the order they were declared. There is no per-element object, so Add takes one
+ * argument per field and element access goes through Get<FieldIndex>(ElementIndex).
+ */
+template <typename... FieldTypes>
+class TSoAArray
+{
+	static_assert(sizeof...(FieldTypes) > 0, "TSoAArray needs at least one field");
+
+public:
+	using SizeType = int32;
+
+	static constexpr uint32 NumFields = sizeof...(FieldTypes);
+
+	template <uint32 FieldIndex>
+	using TFieldType = typename TNthTypeFromParameterPack<FieldIndex, FieldTypes...>::Type;
+
+private:
+	using FFieldIndices = TMakeIntegerSequence<uint32, NumFields>;
+
+	/** Every column starts on at least this alignment so kernels can use aligned vector loads. */
+	static constexpr SIZE_T MinColumnAlignment = 16;
+
+	static constexpr SIZE_T CalculateAllocationAlignment()
+	{
+		const SIZE_T FieldAlignments[] = { alignof(FieldTypes)... };
+		SIZE_T Result = MinColumnAlignment;
+		for (SIZE_T FieldAlignment : FieldAlignments)
+		{
+			Result = FieldAlignment > Result ? FieldAlignment : Result;
+		}
+		return Result;
+	}
+
+	static constexpr SIZE_T BytesPerElement = (sizeof(FieldTypes) + ...);
+	static constexpr SIZE_T AllocationAlignment = CalculateAllocationAlignment();
+
+public:
+	TSoAArray()
+		: ArrayNum(0)
+		, ArrayMax(0)
+	{
+		ClearColumns();
+	}
+
+	TSoAArray(const TSoAArray& Other)
+		: ArrayNum(0)
+		, ArrayMax(0)
+	{
+		ClearColumns();
+		CopyFrom(Other);
+	}
+
+	TSoAArray(TSoAArray&& Other)
+		: ArrayNum(Other.ArrayNum)
+		, ArrayMax(Other.ArrayMax)
+	{
+		FMemory::Memcpy(Columns, Other.Columns, sizeof(Columns));
+		Other.ArrayNum = 0;
+		Other.ArrayMax = 0;
+		Other.ClearColumns();
+	}
+
+	~TSoAArray()
+	{
+		DestructItemsInAllColumns(0, ArrayNum, FFieldIndices());
+		FMemory::Free(Columns[0]);
+	}
+
+	TSoAArray& operator=(const TSoAArray& Other)
+	{
+		if (this != &Other)
+		{
+			Reset();
+			CopyFrom(Other);
+		}
+		return *this;
+	}
+
+	TSoAArray& operator=(TSoAArray&& Other)
+	{
+		if (this != &Other)
+		{
+			DestructItemsInAllColumns(0, ArrayNum, FFieldIndices());
+			FMemory::Free(Columns[0]);
+
+			ArrayNum = Other.ArrayNum;
+			ArrayMax = Other.ArrayMax;
+			FMemory::Memcpy(Columns, Other.Columns, sizeof(Columns));
+			Other.ArrayNum = 0;
+			Other.ArrayMax = 0;
+			Other.ClearColumns();
+		}
+		return *this;
+	}
+
+	/** Returns the number of elements. */
+	FORCEINLINE SizeType Num() const
+	{
+		return ArrayNum;
+	}
+
+	/** Returns the number of elements the columns have room for without reallocating. */
+	FORCEINLINE SizeType Max() const
+	{
+		return ArrayMax;
+	}
+
+	FORCEINLINE bool IsEmpty() const
+	{
+		return ArrayNum == 0;
+	}
+
+	FORCEINLINE bool IsValidIndex(SizeType Index) const
+	{
+		return Index >= 0 && Index < ArrayNum;
+	}
+
+	/** Returns the number of bytes allocated for all columns, including padding between them. */
+	SIZE_T GetAllocatedSize() const
+	{
+		return ArrayMax ? CalculateLayout(ArrayMax, nullptr) : 0;
+	}
+
+	/** Returns a pointer to the first element of a column. Only valid until the array next grows or shrinks. */
+	template <uint32 FieldIndex>
+	FORCEINLINE TFieldType<FieldIndex>* GetData()
+	{
+		return static_cast<TFieldType<FieldIndex>*>(Columns[FieldIndex]);
+	}
+
+	template <uint32 FieldIndex>
+	FORCEINLINE const TFieldType<FieldIndex>* GetData() const
+	{
+		return static_cast<const TFieldType<FieldIndex>*>(Columns[FieldIndex]);
+	}
+
+	/** Returns one field of one element. */
+	template <uint32 FieldIndex>
+	FORCEINLINE TFieldType<FieldIndex>& Get(SizeType Index)
+	{
+		RangeCheck(Index);
+		return GetData<FieldIndex>()[Index];
+	}
+
+	template <uint32 FieldIndex>
+	FORCEINLINE const TFieldType<FieldIndex>& Get(SizeType Index) const
+	{
+		RangeCheck(Index);
+		return GetData<FieldIndex>()[Index];
+	}
+
+	/** Returns a view of a whole column. */
+	template <uint32 FieldIndex>
+	FORCEINLINE TArrayView<TFieldType<FieldIndex>> GetView()
+	{
+		return TArrayView<TFieldType<FieldIndex>>(GetData<FieldIndex>(), ArrayNum);
+	}
+
+	template <uint32 FieldIndex>
+	FORCEINLINE TArrayView<const TFieldType<FieldIndex>> GetView() const
+	{
+		return TArrayView<const TFieldType<FieldIndex>>(GetData<FieldIndex>(), ArrayNum);
+	}
+
+	/** Returns a column as a strided view, for APIs that take TStridedView so they also accept array-of-structs data. */
+	template <uint32 FieldIndex>
+	FORCEINLINE TStridedView<TFieldType<FieldIndex>> GetStridedView()
+	{
+		return MakeStridedView(GetView<FieldIndex>());
+	}
+
+	template <uint32 FieldIndex>
+	FORCEINLINE TStridedView<const TFieldType<FieldIndex>> GetStridedView() const
+	{
+		return MakeStridedView(GetView<FieldIndex>());
+	}
+
+	/** Returns a strided view of one member of a struct-typed column, e.g. GetStridedView<0>(&FVector3f::Z). */
+	template <uint32 FieldIndex, typename MemberType>
+	FORCEINLINE TStridedView<MemberType> GetStridedView(MemberType TFieldType<FieldIndex>::* Member)
+	{
+		return TStridedView<MemberType>((int32)sizeof(TFieldType<FieldIndex>), ArrayNum ? &(GetData<FieldIndex>()->*Member) : nullptr, ArrayNum);
+	}
+
+	template <uint32 FieldIndex, typename MemberType>
+	FORCEINLINE TStridedView<const MemberType> GetStridedView(MemberType TFieldType<FieldIndex>::* Member) const
+	{
+		return TStridedView<const MemberType>((int32)sizeof(TFieldType<FieldIndex>), ArrayNum ? &(GetData<FieldIndex>()->*Member) : nullptr, ArrayNum);
+	}
+
+	/**
+	 * Adds an element, constructing each field from the matching argument.
+	 * The arguments must not reference elements of this array, as the columns may be reallocated first.
+	 *
+	 * @return the index of the new element
+	 */
+	template <typename... ArgTypes>
+	SizeType Add(ArgTypes&&... Args)
+	{
+		static_assert(sizeof...(ArgTypes) == NumFields, "TSoAArray::Add takes exactly one argument per field");
+		const SizeType Index = AddUninitialized(1);
+		ConstructFields(Index, FFieldIndices(), Forward<ArgTypes>(Args)...);
+		return Index;
+	}
+
+	/**
+	 * Adds elements with default constructed fields.
+	 *
+	 * @return the index of the first new element
+	 */
+	SizeType AddDefaulted(SizeType Count = 1)
+	{
+		const SizeType Index = AddUninitialized(Count);
+		DefaultConstructItemsInAllColumns(Index, Count, FFieldIndices());
+		return Index;
+	}
+
+	/**
+	 * Adds elements without constructing their fields, for columns that are about to be filled by a kernel.
+	 * Only use this with trivially constructible field types.
+	 *
+	 * @return the index of the first new element
+	 */
+	SizeType AddUninitialized(SizeType Count = 1)
+	{
+		checkSlow(Count >= 0);
+		const SizeType OldNum = ArrayNum;
+		const SizeType NewNum = OldNum + Count;
+		if (NewNum > ArrayMax)
+		{
+			ResizeTo(DefaultCalculateSlackGrow(NewNum, ArrayMax, BytesPerElement, false, (uint32)AllocationAlignment));
+		}
+		ArrayNum = NewNum;
+		return OldNum;
+	}
+
+	/**
+	 * Removes elements by moving the last elements of every column into the hole. Order is not preserved.
+	 *
+	 * @param Index index of the first element to remove
+	 * @param Count number of elements to remove
+	 * @param bAllowShrinking whether the columns may be reallocated to release slack
+	 */
+	void RemoveAtSwap(SizeType Index, SizeType Count = 1, bool bAllowShrinking = true)
+	{
+		if (Count)
+		{
+			check((Count >= 0) & (Index >= 0) & (Index + Count <= ArrayNum));
+
+			DestructItemsInAllColumns(Index, Count, FFieldIndices());
+
+			// Fill the hole from the end, without overlapping with the elements being moved
+			const SizeType NumElementsAfterHole = ArrayNum - (Index + Count);
+			const SizeType NumElementsToMoveIntoHole = FMath::Min(Count, NumElementsAfterHole);
+			if (NumElementsToMoveIntoHole)
+			{
+				RelocateItemsInAllColumns(Index, ArrayNum - NumElementsToMoveIntoHole, NumElementsToMoveIntoHole, FFieldIndices());
+			}
+			ArrayNum -= Count;
+
+			if (bAllowShrinking)
+			{
+				ResizeShrink();
+			}
+		}
+	}
+
+	/** Makes sure the columns have room for at least Number elements. */
+	void Reserve(SizeType Number)
+	{
+		checkSlow(Number >= 0);
+		if (Number > ArrayMax)
+		{
+			ResizeTo(Number);
+		}
+	}
+
+	/** Removes all elements but keeps the allocation, growing it to NewSize if it is smaller. */
+	void Reset(SizeType NewSize = 0)
+	{
+		DestructItemsInAllColumns(0, ArrayNum, FFieldIndices());
+		ArrayNum = 0;
+		if (NewSize > ArrayMax)
+		{
+			ResizeTo(NewSize);
+		}
+	}
+
+	/** Removes all elements and resizes the allocation to Slack elements. */
+	void Empty(SizeType Slack = 0)
+	{
+		checkSlow(Slack >= 0);
+		DestructItemsInAllColumns(0, ArrayNum, FFieldIndices());
+		ArrayNum = 0;
+		if (ArrayMax != Slack)
+		{
+			ResizeTo(Slack);
+		}
+	}
+
+	/** Releases all slack. */
+	void Shrink()
+	{
+		if (ArrayMax != ArrayNum)
+		{
+			ResizeTo(ArrayNum);
+		}
+	}
+
+private:
+	FORCEINLINE void RangeCheck(SizeType Index) const
+	{
+		checkf((Index >= 0) & (Index < ArrayNum), TEXT("Array index out of bounds: %i from an array of size %i"), Index, ArrayNum);
+	}
+
+	void ClearColumns()
+	{
+		for (uint32 FieldIndex = 0; FieldIndex < NumFields; ++FieldIndex)
+		{
+			Columns[FieldIndex] = nullptr;
+		}
+	}
+
+	/**
+	 * Computes the byte offset of every column for a capacity and returns the total size of the allocation.
+	 * Column 0 is always at offset 0, so Columns[0] is the allocation itself.
+	 */
+	static SIZE_T CalculateLayout(SizeType Capacity, SIZE_T* OutOffsets)
+	{
+		const SIZE_T FieldSizes[] = { sizeof(FieldTypes)... };
+		const SIZE_T FieldAlignments[] = { FMath::Max<SIZE_T>(alignof(FieldTypes), MinColumnAlignment)... };
+
+		SIZE_T Offset = 0;
+		for (uint32 FieldIndex = 0; FieldIndex < NumFields; ++FieldIndex)
+		{
+			Offset = Align(Offset, FieldAlignments[FieldIndex]);
+			if (OutOffsets)
+			{
+				OutOffsets[FieldIndex] = Offset;
+			}
+			Offset += FieldSizes[FieldIndex] * (SIZE_T)Capacity;
+		}
+		return Offset;
+	}
+
+	void ResizeShrink()
+	{
+		const SizeType NewMax = DefaultCalculateSlackShrink(ArrayNum, ArrayMax, BytesPerElement, false, (uint32)AllocationAlignment);
+		if (NewMax != ArrayMax)
+		{
+			ResizeTo(NewMax);
+		}
+	}
+
+	void ResizeTo(SizeType NewMax)
+	{
+		check(NewMax >= ArrayNum);
+
+		void* OldColumns[NumFields];
+		FMemory::Memcpy(OldColumns, Columns, sizeof(Columns));
+
+		if (NewMax)
+		{
+			SIZE_T Offsets[NumFields];
+			const SIZE_T TotalSize = CalculateLayout(NewMax, Offsets);
+			uint8* NewData = (uint8*)FMemory::Malloc(TotalSize, (uint32)AllocationAlignment);
+			for (uint32 FieldIndex = 0; FieldIndex < NumFields; ++FieldIndex)
+			{
+				Columns[FieldIndex] = NewData + Offsets[FieldIndex];
+			}
+			RelocateColumns(OldColumns, FFieldIndices());
+		}
+		else
+		{
+			ClearColumns();
+		}
+
+		FMemory::Free(OldColumns[0]);
+		ArrayMax = NewMax;
+	}
+
+	void CopyFrom(const TSoAArray& Other)
+	{
+		checkSlow(ArrayNum == 0);
+		if (Other.ArrayNum)
+		{
+			Reserve(Other.ArrayNum);
+			CopyColumns(Other, FFieldIndices());
+			ArrayNum = Other.ArrayNum;
+		}
+	}
+
+	template <uint32... FieldIndices, typename... ArgTypes>
+	FORCEINLINE void ConstructFields(SizeType Index, TIntegerSequence<uint32, FieldIndices...>, ArgTypes&&... Args)
+	{
+		(new (GetData<FieldIndices>() + Index) TFieldType<FieldIndices>(Forward<ArgTypes>(Args)), ...);
+	}
+
+	template <uint32... FieldIndices>
+	FORCEINLINE void DefaultConstructItemsInAllColumns(SizeType Index, SizeType Count, TIntegerSequence<uint32, FieldIndices...>)
+	{
+		(DefaultConstructItems<TFieldType<FieldIndices>>(GetData<FieldIndices>() + Index, Count), ...);
+	}
+
+	template <uint32... FieldIndices>
+	FORCEINLINE void DestructItemsInAllColumns(SizeType Index, SizeType Count, TIntegerSequence<uint32, FieldIndices...>)
+	{
+		(DestructItems(GetData<FieldIndices>() + Index, Count), ...);
+	}
+
+	template <uint32... FieldIndices>
+	FORCEINLINE void RelocateItemsInAllColumns(SizeType DestIndex, SizeType SourceIndex, SizeType Count, TIntegerSequence<uint32, FieldIndices...>)
+	{
+		(RelocateConstructItems<TFieldType<FieldIndices>>(GetData<FieldIndices>() + DestIndex, GetData<FieldIndices>() + SourceIndex, Count), ...);
+	}
+
+	template <uint32... FieldIndices>
+	FORCEINLINE void RelocateColumns(void* const* OldColumns, TIntegerSequence<uint32, FieldIndices...>)
+	{
+		(RelocateConstructItems<TFieldType<FieldIndices>>(GetData<FieldIndices>(), static_cast<TFieldType<FieldIndices>*>(OldColumns[FieldIndices]), ArrayNum), ...);
+	}
+
+	template <uint32... FieldIndices>
+	FORCEINLINE void CopyColumns(const TSoAArray& Other, TIntegerSequence<uint32, FieldIndices...>)
+	{
+		(ConstructItems<TFieldType<FieldIndices>>(GetData<FieldIndices>(), Other.GetData<FieldIndices>(), Other.ArrayNum), ...);
+	}
+
+	void* Columns[NumFields];
+	SizeType ArrayNum;
+	SizeType ArrayMax;
+};
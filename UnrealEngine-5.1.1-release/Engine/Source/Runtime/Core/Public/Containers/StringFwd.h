@@ -36,6 +36,12 @@ template <int32 BufferSize> using TFixedStringBuilder UE_DEPRECATED(4.25, "'TFix
 /** A fixed-size string builder for ANSICHAR. */
 template <int32 BufferSize> using TFixedAnsiStringBuilder UE_DEPRECATED(4.25, "'TFixedAnsiStringBuilder' is deprecated. Please use 'TAnsiStringBuilder' instead!") = TStringBuilderWithBuffer<ANSICHAR, BufferSize>;
 
+// Inline String
+
+template <int32 NumInlineChars> class TInlineString;
+
+template <int32 NumInlineChars> struct TIsContiguousContainer<TInlineString<NumInlineChars>> { static constexpr bool Value = true; };
+
 // String View
 
 template <typename CharType> class TStringView;
@@ -0,0 +1,343 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Coroutine.h"
+#include "Async/Future.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "IO/IoDispatcher.h"
+#include "Tasks/Task.h"
+
+#include <atomic>
+
+/*
+* FCoroResumeOn selects where a Coroutine continues after awaiting one of the Awaitables below
+* by default it is rescheduled on a worker with the priority it was launched with
+*/
+struct FCoroResumeOn
+{
+	ENamedThreads::Type NamedThread = ENamedThreads::AnyThread;
+	LowLevelTasks::ETaskPriority Priority = LowLevelTasks::ETaskPriority::Count;
+
+	static FCoroResumeOn Worker(LowLevelTasks::ETaskPriority InPriority)
+	{
+		FCoroResumeOn ResumeOn;
+		ResumeOn.Priority = InPriority;
+		return ResumeOn;
+	}
+
+	// the Coroutine runs on the named thread until it suspends again, later suspensions resume on workers unless they ask for the named thread as well
+	static FCoroResumeOn Thread(ENamedThreads::Type InNamedThread)
+	{
+		FCoroResumeOn ResumeOn;
+		ResumeOn.NamedThread = InNamedThread;
+		return ResumeOn;
+	}
+
+	bool IsNamedThread() const
+	{
+		return ENamedThreads::GetThreadIndex(NamedThread) != ENamedThreads::AnyThread;
+	}
+};
+
+#if WITH_CPP_COROUTINES
+
+namespace CoroTask_Detail
+{
+	/*
+	* FCoroResumer owns the DummyTask a Coroutine is suspended on while it awaits something outside of the Coroutine system
+	* the completion of the awaited operation calls Resume (on any thread) which unlocks the DummyTask and thereby continues the Coroutine
+	*/
+	class FCoroResumer
+	{
+		FLockedTask DummyTask;
+		FCoroResumeOn ResumeOn;
+
+	public:
+		FCoroResumer() = default;
+
+		FCoroResumer(FCoroResumeOn InResumeOn) : DummyTask(FLockedTask::Create()), ResumeOn(InResumeOn)
+		{
+			// on a named thread the Coroutine is executed inline by the graph task that unlocks it
+			DummyTask.SetResumeTarget(ResumeOn.Priority, ResumeOn.IsNamedThread());
+		}
+
+		FCoroResumer(FCoroResumer&&) = default;
+		FCoroResumer& operator=(FCoroResumer&&) = default;
+
+		const FPromise* GetPromise() const
+		{
+			return DummyTask.GetPromise();
+		}
+
+		// resume the Coroutine, hopping to the requested named thread first if necessary
+		void Resume() &&
+		{
+			if (ResumeOn.IsNamedThread())
+			{
+				const ENamedThreads::Type NamedThread = ResumeOn.NamedThread;
+				FFunctionGraphTask::CreateAndDispatchWhenReady([Resumer = MoveTemp(*this)]() mutable { Resumer.Unlock(); }, TStatId{}, nullptr, NamedThread);
+				return;
+			}
+			Unlock();
+		}
+
+		// resume the Coroutine from a graph task that already runs on the desired thread
+		void Unlock()
+		{
+			while(!DummyTask.HasSubsequent())
+			{
+				//This is only spinning for a very short time because the prerequisite is only set after the Coroutine left await_suspend.
+				FPlatformProcess::Yield();
+			}
+			DummyTask.Unlock();
+		}
+
+		// the awaited operation completed before the Coroutine suspended, nobody waits for the DummyTask
+		void Cancel()
+		{
+			coroCheck(!DummyTask.HasSubsequent());
+			DummyTask.Unlock();
+		}
+	};
+
+	/*
+	* TCoroCompletionAwaitable implements the suspension protocol for operations that signal their completion through a callback
+	* Derived classes implement bool IsReady() and void OnComplete() which registers a callback calling Complete().
+	* The callback may run synchronously, before await_suspend returned, in this case the Coroutine continues without suspending.
+	* The Awaitable lives in the Coroutine frame until await_resume, so callbacks can safely capture it.
+	*/
+	template<typename DerivedType>
+	class TCoroCompletionAwaitable
+	{
+		enum class EState : uint8
+		{
+			Waiting,
+			Suspended,
+			Completed,
+		};
+		std::atomic<EState> State { EState::Waiting };
+		FCoroResumer Resumer;
+
+	protected:
+		FCoroResumeOn ResumeOn;
+
+		explicit TCoroCompletionAwaitable(FCoroResumeOn InResumeOn) : ResumeOn(InResumeOn)
+		{
+		}
+
+		// the thread callbacks should run on, so they don't need another hop for Complete
+		ENamedThreads::Type GetDesiredThread() const
+		{
+			return ResumeOn.IsNamedThread() ? ResumeOn.NamedThread : ENamedThreads::AnyHiPriThreadHiPriTask;
+		}
+
+		void Complete()
+		{
+			// if await_suspend is still running it sees the completion and doesn't suspend
+			if (State.exchange(EState::Completed, std::memory_order_acq_rel) == EState::Suspended)
+			{
+				MoveTemp(Resumer).Resume();
+			}
+		}
+
+		// for callbacks that already run on the thread returned by GetDesiredThread
+		void CompleteOnDesiredThread()
+		{
+			if (State.exchange(EState::Completed, std::memory_order_acq_rel) == EState::Suspended)
+			{
+				FCoroResumer LocalResumer = MoveTemp(Resumer);
+				LocalResumer.Unlock();
+			}
+		}
+
+	public:
+		TCoroCompletionAwaitable(const TCoroCompletionAwaitable&) = delete;
+		TCoroCompletionAwaitable& operator=(const TCoroCompletionAwaitable&) = delete;
+
+		inline bool await_ready() noexcept
+		{
+			return static_cast<DerivedType*>(this)->IsReady();
+		}
+
+		template<typename PromiseType>
+		inline bool await_suspend(coroutine_handle<PromiseType> Continuation) noexcept
+		{
+			Resumer = FCoroResumer(ResumeOn);
+			const FPromise* DummyPromise = Resumer.GetPromise();
+			static_cast<DerivedType*>(this)->OnComplete();
+
+			EState Waiting = EState::Waiting;
+			if (!State.compare_exchange_strong(Waiting, EState::Suspended, std::memory_order_acq_rel))
+			{
+				Resumer.Cancel();
+				return false;
+			}
+			// from here on the callback owns the Resumer, which keeps the DummyTask alive until the Coroutine added itself as its subsequent
+			Continuation.promise().Suspend(DummyPromise);
+			return true;
+		}
+	};
+}
+
+/*
+* TCoroTaskAwaitable suspends a Coroutine until a UE::Tasks::TTask is completed and returns its result
+*/
+template<typename ResultType>
+class TCoroTaskAwaitable final : public CoroTask_Detail::TCoroCompletionAwaitable<TCoroTaskAwaitable<ResultType>>
+{
+	using BaseType = CoroTask_Detail::TCoroCompletionAwaitable<TCoroTaskAwaitable<ResultType>>;
+	friend BaseType;
+
+	UE::Tasks::TTask<ResultType> Task;
+
+	bool IsReady() const
+	{
+		return Task.IsCompleted();
+	}
+
+	void OnComplete()
+	{
+		// executed inline by the thread that completes the task
+		UE::Tasks::Launch(TEXT("CoroTaskAwaitable"), [this] { this->Complete(); }, UE::Tasks::Prerequisites(Task), UE::Tasks::ETaskPriority::High, UE::Tasks::EExtendedTaskPriority::Inline);
+	}
+
+public:
+	explicit TCoroTaskAwaitable(const UE::Tasks::TTask<ResultType>& InTask, FCoroResumeOn InResumeOn = FCoroResumeOn()) : BaseType(InResumeOn), Task(InTask)
+	{
+		coroCheck(Task.IsValid());
+	}
+
+	inline decltype(auto) await_resume() noexcept
+	{
+		return Task.GetResult();
+	}
+};
+
+/*
+* FCoroGraphEventAwaitable suspends a Coroutine until a task graph event is completed
+*/
+class FCoroGraphEventAwaitable final : public CoroTask_Detail::TCoroCompletionAwaitable<FCoroGraphEventAwaitable>
+{
+	using BaseType = CoroTask_Detail::TCoroCompletionAwaitable<FCoroGraphEventAwaitable>;
+	friend BaseType;
+
+	FGraphEventRef Event;
+
+	bool IsReady() const
+	{
+		return !Event.IsValid() || Event->IsComplete();
+	}
+
+	void OnComplete()
+	{
+		// the graph task runs on the desired named thread already, saving a hop
+		FFunctionGraphTask::CreateAndDispatchWhenReady([this] { this->CompleteOnDesiredThread(); }, TStatId{}, Event, this->GetDesiredThread());
+	}
+
+public:
+	explicit FCoroGraphEventAwaitable(FGraphEventRef InEvent, FCoroResumeOn InResumeOn = FCoroResumeOn()) : BaseType(InResumeOn), Event(MoveTemp(InEvent))
+	{
+	}
+
+	inline void await_resume() noexcept
+	{
+	}
+};
+
+/*
+* TCoroFutureAwaitable suspends a Coroutine until a TFuture is ready and returns its result
+*/
+template<typename ResultType>
+class TCoroFutureAwaitable final : public CoroTask_Detail::TCoroCompletionAwaitable<TCoroFutureAwaitable<ResultType>>
+{
+	using BaseType = CoroTask_Detail::TCoroCompletionAwaitable<TCoroFutureAwaitable<ResultType>>;
+	friend BaseType;
+
+	TFuture<ResultType> Future;
+
+	bool IsReady() const
+	{
+		return Future.IsReady();
+	}
+
+	void OnComplete()
+	{
+		// Then invalidates the future, the continuation hands the completed one back
+		Future.Then([this](TFuture<ResultType> CompletedFuture)
+		{
+			Future = MoveTemp(CompletedFuture);
+			this->Complete();
+		});
+	}
+
+public:
+	explicit TCoroFutureAwaitable(TFuture<ResultType>&& InFuture, FCoroResumeOn InResumeOn = FCoroResumeOn()) : BaseType(InResumeOn), Future(MoveTemp(InFuture))
+	{
+		coroCheck(Future.IsValid());
+	}
+
+	inline decltype(auto) await_resume() noexcept
+	{
+		return Future.Get();
+	}
+};
+
+/*
+* FCoroIoBatchAwaitable issues a batch of I/O requests and suspends a Coroutine until all of them are completed
+* the results are read from the FIoRequests returned by the batch, e.g. FIoRequest::GetResult
+*/
+class FCoroIoBatchAwaitable final : public CoroTask_Detail::TCoroCompletionAwaitable<FCoroIoBatchAwaitable>
+{
+	using BaseType = CoroTask_Detail::TCoroCompletionAwaitable<FCoroIoBatchAwaitable>;
+	friend BaseType;
+
+	FIoBatch Batch;
+
+	bool IsReady() const
+	{
+		return false;
+	}
+
+	void OnComplete()
+	{
+		Batch.IssueWithCallback([this] { this->Complete(); });
+	}
+
+public:
+	explicit FCoroIoBatchAwaitable(FIoBatch&& InBatch, FCoroResumeOn InResumeOn = FCoroResumeOn()) : BaseType(InResumeOn), Batch(MoveTemp(InBatch))
+	{
+	}
+
+	inline void await_resume() noexcept
+	{
+	}
+};
+
+/*
+* co_await on task handles, graph events and futures directly resumes on a worker with the priority the Coroutine was launched with
+* e.g. co_await Task; or co_await TCoroTaskAwaitable(Task, FCoroResumeOn::Thread(ENamedThreads::GameThread));
+*/
+template<typename ResultType>
+inline TCoroTaskAwaitable<ResultType> operator co_await(const UE::Tasks::TTask<ResultType>& Task)
+{
+	return TCoroTaskAwaitable<ResultType>(Task);
+}
+
+inline FCoroGraphEventAwaitable operator co_await(const FGraphEventRef& Event)
+{
+	return FCoroGraphEventAwaitable(Event);
+}
+
+template<typename ResultType>
+inline TCoroFutureAwaitable<ResultType> operator co_await(TFuture<ResultType>&& Future)
+{
+	return TCoroFutureAwaitable<ResultType>(MoveTemp(Future));
+}
+
+inline FCoroIoBatchAwaitable operator co_await(FIoBatch&& Batch)
+{
+	return FCoroIoBatchAwaitable(MoveTemp(Batch));
+}
+
+#endif
@@ -140,6 +140,9 @@ namespace CoroTask_Detail
 		COROTASKTRACE(TaskTrace::FId TraceId = ~0);
 		FCoroLocalState ClsData;
 		FMemStack MemStack;
+		//where the Subsequent continues once this Promise completes, see FLockedTask::SetResumeTarget
+		LowLevelTasks::ETaskPriority ResumePriority = LowLevelTasks::ETaskPriority::Count;
+		bool bResumeInline = false;
 
 	public:
 		COROFORCEINLINE bool IsExpeditable() const
@@ -226,6 +229,7 @@ namespace CoroTask_Detail
 			coroCheck(!CoroutineHandle.done());
 
 			Flags = (Prerequisite && !Prerequisite->IsExpeditable()) ? (Flags & ~LowLevelTasks::ETaskFlags::AllowCancellation) : (Flags | LowLevelTasks::ETaskFlags::AllowCancellation);
+			Priority = (Prerequisite && Prerequisite->ResumePriority != LowLevelTasks::ETaskPriority::Count) ? Prerequisite->ResumePriority : Priority;
 			FPromise* NullPromise = nullptr;
 
 			//the coroutine that has a prerequesite try to add itself as a subsequent to it's prerequesite, which might already be completed at this point
@@ -258,6 +262,16 @@ namespace CoroTask_Detail
 			if (FPromise* LocalSubsequent = Subsequent.exchange(reinterpret_cast<FPromise*>(~0ull), std::memory_order_acq_rel))
 			{
 				COROTASKTRACE(TaskTrace::Scheduled(LocalSubsequent->TraceId));
+				if (bResumeInline)
+				{
+					//the Subsequent continues on this thread until it suspends again
+					while(!LocalSubsequent->Task.TryExecute())
+					{
+						FPlatformProcess::Yield();
+					}
+					return;
+				}
+
 				while(!LowLevelTasks::TryLaunch(LocalSubsequent->Task, LowLevelTasks::EQueuePreference::LocalQueuePreference))
 				{
 					FPlatformProcess::Yield();
@@ -763,6 +777,18 @@ public:
 		Reset();
 	}
 
+	/*
+	* Configure how the Task suspended on this one continues when it is unlocked:
+	* at the given priority (Count keeps its own) and either scheduled on a worker or executed inline by the thread calling Unlock.
+	* Has to be set before the Task gets suspended.
+	*/
+	inline void SetResumeTarget(LowLevelTasks::ETaskPriority Priority, bool bInline)
+	{
+		coroCheck(Promise);
+		this->Promise->ResumePriority = Priority;
+		this->Promise->bResumeInline = bInline;
+	}
+
 	static FLockedTask Create()
 	{
 		co_return;
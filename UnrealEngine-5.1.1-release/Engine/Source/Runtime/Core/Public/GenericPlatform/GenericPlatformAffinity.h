@@ -123,6 +123,28 @@ public:
 		return 0xFFFFFFFFFFFFFFFF;
 	}
 
+	/** Returns the number of NUMA nodes in the system, 1 where the platform doesn't expose them. */
+	static uint32 GetNumNumaNodes()
+	{
+		return 1;
+	}
+
+	/**
+	 * Returns the affinity mask of the logical processors belonging to a NUMA node, and the processor group the mask
+	 * applies to. The result can be passed straight to FRunnableThread::SetThreadAffinity.
+	 */
+	static uint64 GetNumaNodeMask(uint32 NodeIndex, uint16& OutProcessorGroup)
+	{
+		OutProcessorGroup = 0;
+		return 0xFFFFFFFFFFFFFFFF;
+	}
+
+	/** Returns the NUMA node of the processor the calling thread is currently running on. */
+	static uint32 GetCurrentNumaNode()
+	{
+		return 0;
+	}
+
 	// @todo what do we think about having this as a function in this class? Should be make a whole new one? 
 	// scrap it and force the priority like before?
 	static CORE_API EThreadPriority GetRenderingThreadPriority()
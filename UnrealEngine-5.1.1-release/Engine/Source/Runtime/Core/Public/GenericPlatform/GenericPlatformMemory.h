@@ -150,6 +150,12 @@ struct CORE_API FGenericPlatformMemoryStats : public FPlatformMemoryConstants
 
 	/** The peak amount of virtual memory used by the process. */
 	uint64 PeakUsedVirtual;
+
+	/** The amount of memory for which large (e.g. 2MB) OS pages have been requested, see FPlatformMemory::AdviseLargePages. */
+	uint64 LargePageRequested;
+
+	/** The amount of process memory the OS has actually backed with large pages. */
+	uint64 LargePageBacked;
 	
 	/** Memory pressure states, useful for platforms in which the available memory estimate
 	 	may not take in to account memory reclaimable from closing inactive processes or resorting to swap. */
@@ -388,6 +394,18 @@ struct CORE_API FGenericPlatformMemory
 	 * @param Size size of the allocation previously passed to BinnedAllocFromOS
 	 */
 	static void BinnedFreeToOS( void* Ptr, SIZE_T Size );
+
+	/**
+	 * Asks the OS to back memory returned by BinnedAllocFromOS or FPlatformVirtualMemoryBlock with large pages (e.g. 2MB),
+	 * which cuts TLB misses on big, long-lived heaps. This is only a hint and does nothing unless large pages were enabled
+	 * with -largepages. Platforms that can only hand out large pages at allocation time (e.g. Windows) do that directly in
+	 * BinnedAllocFromOS instead and return 0 here.
+	 *
+	 * @param Ptr start of the range, need not be large page aligned
+	 * @param Size size of the range in bytes
+	 * @return the number of bytes large pages were requested for
+	 */
+	static SIZE_T AdviseLargePages(void* Ptr, SIZE_T Size);
 	
 	/**
 	 *	Performs initial setup for Nano malloc.
@@ -28,6 +28,8 @@ DECLARE_MEMORY_STAT_EXTERN(TEXT("Used Physical"),		STAT_UsedPhysical,STATGROUP_M
 DECLARE_MEMORY_STAT_EXTERN(TEXT("Peak Used Physical"),	STAT_PeakUsedPhysical,STATGROUP_MemoryPlatform, CORE_API);
 DECLARE_MEMORY_STAT_EXTERN(TEXT("Used Virtual"),		STAT_UsedVirtual,STATGROUP_MemoryPlatform, CORE_API);
 DECLARE_MEMORY_STAT_EXTERN(TEXT("Peak Used Virtual"),	STAT_PeakUsedVirtual,STATGROUP_MemoryPlatform, CORE_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Large Page Requested"),	STAT_LargePageRequested,STATGROUP_MemoryPlatform, CORE_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Large Page Backed"),	STAT_LargePageBacked,STATGROUP_MemoryPlatform, CORE_API);
 
 
 
@@ -677,6 +677,9 @@ private:
 	int64 MemoryUsageCurrentOverhead;
 	int64 MemoryUsagePlatformTotalUntracked;
 
+	/** When non zero, only about one allocation of the default tracker every SampleBytes allocated bytes is tracked, see -LLMSampleBytes */
+	int64 SampleBytes;
+
 	bool ActiveSets[(int32)ELLMTagSet::Max];
 
 	bool bFirstTimeUpdating;
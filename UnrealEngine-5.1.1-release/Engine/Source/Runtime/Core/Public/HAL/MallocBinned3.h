@@ -67,6 +67,7 @@ struct FGenericMemoryStats;
 #define DEFAULT_GMallocBinned3BundleCount 64
 #define DEFAULT_GMallocBinned3AllocExtra 32
 #define BINNED3_MAX_GMallocBinned3MaxBundlesBeforeRecycle 8
+#define DEFAULT_GMallocBinned3RemoteFreeMailboxBundles 16
 
 #if !defined(AGGRESSIVE_MEMORY_SAVING)
 	#error "AGGRESSIVE_MEMORY_SAVING must be defined"
@@ -85,12 +86,14 @@ struct FGenericMemoryStats;
 	extern CORE_API int32 GMallocBinned3BundleCount = DEFAULT_GMallocBinned3BundleCount;
 	extern CORE_API int32 GMallocBinned3MaxBundlesBeforeRecycle = BINNED3_MAX_GMallocBinned3MaxBundlesBeforeRecycle;
 	extern CORE_API int32 GMallocBinned3AllocExtra = DEFAULT_GMallocBinned3AllocExtra;
+	extern CORE_API int32 GMallocBinned3RemoteFreeMailboxBundles;
 #else
 	#define GMallocBinned3PerThreadCaches DEFAULT_GMallocBinned3PerThreadCaches
 	#define GMallocBinned3BundleSize DEFAULT_GMallocBinned3BundleSize
 	#define GMallocBinned3BundleCount DEFAULT_GMallocBinned3BundleCount
 	#define GMallocBinned3MaxBundlesBeforeRecycle BINNED3_MAX_GMallocBinned3MaxBundlesBeforeRecycle
 	#define GMallocBinned3AllocExtra DEFAULT_GMallocBinned3AllocExtra
+	#define GMallocBinned3RemoteFreeMailboxBundles DEFAULT_GMallocBinned3RemoteFreeMailboxBundles
 #endif
 
 
@@ -199,6 +202,12 @@ class CORE_API FMallocBinned3 : public FMalloc
 		TAtomic<int64> TotalAllocCount;
 		TAtomic<int64> TotalFreeCount;
 
+		// contention stats, counted below the TLS cache
+		TAtomic<int64> LockedAllocCount;   // allocations that had to take the allocator mutex
+		TAtomic<int64> LockedFreeCount;    // bundle frees that had to take the allocator mutex
+		TAtomic<int64> MailboxPushCount;   // bundles parked in the remote free mailbox instead of taking the mutex
+		TAtomic<int64> MailboxAdoptCount;  // bundles adopted from the remote free mailbox by an allocating thread
+
 		FORCEINLINE void HeadEndAlloc(SIZE_T Size)
 		{
 			check(Size >= 0 && Size <= BlockSize);
@@ -209,6 +218,22 @@ class CORE_API FMallocBinned3 : public FMalloc
 		{
 			TotalFreeCount++;
 		}
+		FORCEINLINE void LockedAlloc()
+		{
+			LockedAllocCount++;
+		}
+		FORCEINLINE void LockedFree()
+		{
+			LockedFreeCount++;
+		}
+		FORCEINLINE void MailboxPush()
+		{
+			MailboxPushCount++;
+		}
+		FORCEINLINE void MailboxAdopt()
+		{
+			MailboxAdoptCount++;
+		}
 #else
 		FORCEINLINE void HeadEndAlloc(SIZE_T Size)
 		{
@@ -216,6 +241,18 @@ class CORE_API FMallocBinned3 : public FMalloc
 		FORCEINLINE void HeadEndFree()
 		{
 		}
+		FORCEINLINE void LockedAlloc()
+		{
+		}
+		FORCEINLINE void LockedFree()
+		{
+		}
+		FORCEINLINE void MailboxPush()
+		{
+		}
+		FORCEINLINE void MailboxAdopt()
+		{
+		}
 #endif
 	};
 
@@ -682,6 +719,7 @@ public:
 	virtual void SetupTLSCachesOnCurrentThread() override;
 	virtual void ClearAndDisableTLSCachesOnCurrentThread() override;
 	virtual const TCHAR* GetDescriptiveName() override;
+	virtual void UpdateStats() override;
 	// End FMalloc interface.
 
 	void FlushCurrentThreadCache();
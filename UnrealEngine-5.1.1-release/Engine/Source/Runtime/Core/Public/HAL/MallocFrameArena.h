@@ -0,0 +1,83 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Containers/ContainerAllocationPolicies.h"
+#include "HAL/MemoryBase.h"
+
+/**
+ * Frame-scoped linear allocator.
+ *
+ * Memory is bump-allocated from chunks owned by the calling thread, so allocation never takes a lock and workers never
+ * contend with each other or with the game thread. Nothing is returned to the system on Free(); instead each thread
+ * recycles its chunks en masse once the frame that made the allocations is old enough:
+ *
+ *   A pointer returned during frame N stays valid until the end of frame N+1.
+ *
+ * The extra frame of lifetime covers work that straddles the frame boundary (render thread lagging one frame behind,
+ * tasks kicked late in the frame). Anything that must live longer has to use the regular heap.
+ *
+ * Free() of the most recent allocation on the calling thread rewinds it, and Realloc() of the most recent allocation
+ * grows in place when the chunk has room, which makes TArray growth patterns cheap. Memory may be freed or reallocated
+ * from another thread; it is then simply abandoned until its owning thread recycles the chunk.
+ *
+ * FFrameArena::EndFrame() is called once per engine tick by FEngineLoop::Tick.
+ */
+class CORE_API FFrameArena
+{
+public:
+	/** Allocates Size bytes from the calling thread's arena. Never returns nullptr for non-zero sizes. */
+	static void* Malloc(SIZE_T Size, uint32 Alignment = DEFAULT_ALIGNMENT);
+
+	/** Resizes an arena allocation, in place if it is the most recent allocation of the calling thread. */
+	static void* Realloc(void* Ptr, SIZE_T NewSize, uint32 Alignment = DEFAULT_ALIGNMENT);
+
+	/** Releases an arena allocation. Only the most recent allocation of the calling thread is actually reclaimed. */
+	static void Free(void* Ptr);
+
+	/** Returns the requested size of an arena allocation. */
+	static SIZE_T GetAllocationSize(void* Ptr);
+
+	/** Advances the arena frame. Must be called once per frame from the thread that owns the frame loop. */
+	static void EndFrame();
+
+	/** Returns the number of bytes handed out across all threads during the last completed frame. */
+	static uint64 GetLastFrameBytesUsed();
+
+	/** Returns the highest number of bytes handed out across all threads in a single frame since startup. */
+	static uint64 GetFrameHighWaterMark();
+
+	/** Returns the number of bytes currently held in chunks by all thread arenas, including cached free chunks. */
+	static uint64 GetCommittedBytes();
+};
+
+/**
+ * FMalloc front-end for FFrameArena, for systems that take an FMalloc* (e.g. scratch buffers handed to
+ * third party libraries). The same lifetime rules as FFrameArena apply.
+ */
+class CORE_API FMallocFrameArena final : public FMalloc
+{
+public:
+	static FMallocFrameArena& Get();
+
+	// FMalloc interface.
+	virtual void* Malloc(SIZE_T Size, uint32 Alignment) override;
+	virtual void* Realloc(void* Ptr, SIZE_T NewSize, uint32 Alignment) override;
+	virtual void Free(void* Ptr) override;
+	virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override;
+	virtual bool IsInternallyThreadSafe() const override
+	{
+		return true;
+	}
+	virtual const TCHAR* GetDescriptiveName() override
+	{
+		return TEXT("FrameArena");
+	}
+};
+
+/** Container allocator policy that allocates from the frame arena. See FFrameArena for lifetime rules. */
+using FFrameArenaAllocator = TSizedHeapAllocator<32, FFrameArena>;
+
+/** Set/map allocator policy that allocates elements, bit arrays and hash buckets from the frame arena. */
+using FFrameArenaSetAllocator = TSetAllocator<TSparseArrayAllocator<FFrameArenaAllocator, TInlineAllocator<4, FFrameArenaAllocator>>, TInlineAllocator<1, FFrameArenaAllocator>>;
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreTypes.h"
+#include "ProfilingDebugging/LockTrace.h"
 #include <pthread.h>
 #include <errno.h>
 
@@ -46,6 +47,13 @@ public:
 	 */
 	FORCEINLINE void Lock(void)
 	{
+#if LOCKTRACE_ENABLED
+		if (pthread_mutex_trylock(&Mutex) == 0)
+		{
+			return;
+		}
+		TRACE_LOCK_WAIT_SCOPE(this, ELockTraceType::CriticalSection);
+#endif
 		pthread_mutex_lock(&Mutex);
 	}
 	
@@ -4,6 +4,7 @@
 
 #include "CoreTypes.h"
 #include "Misc/AssertionMacros.h"
+#include "ProfilingDebugging/LockTrace.h"
 #include <pthread.h>
 #include <errno.h>
 
@@ -31,12 +32,26 @@ public:
 
 	void ReadLock()
 	{
+#if LOCKTRACE_ENABLED
+		if (pthread_rwlock_tryrdlock(&Mutex) == 0)
+		{
+			return;
+		}
+		TRACE_LOCK_WAIT_SCOPE(this, ELockTraceType::ReadLock);
+#endif
 		int Err = pthread_rwlock_rdlock(&Mutex);
 		checkf(Err == 0, TEXT("pthread_rwlock_rdlock failed with error: %d"), Err);
 	}
 
 	void WriteLock()
 	{
+#if LOCKTRACE_ENABLED
+		if (pthread_rwlock_trywrlock(&Mutex) == 0)
+		{
+			return;
+		}
+		TRACE_LOCK_WAIT_SCOPE(this, ELockTraceType::WriteLock);
+#endif
 		int Err = pthread_rwlock_wrlock(&Mutex);
 		checkf(Err == 0, TEXT("pthread_rwlock_wrlock failed with error: %d"), Err);
 	}
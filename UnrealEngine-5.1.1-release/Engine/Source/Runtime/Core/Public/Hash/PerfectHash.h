@@ -0,0 +1,340 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Containers/StringView.h"
+
+/**
+ * Perfect hashing of a fixed set of string keys, e.g. enumerator names.
+ *
+ * Keys are hashed ignoring ASCII case and distributed into buckets. Every bucket gets a seed that maps all of its keys
+ * to distinct slots, so finding a key hashes it once, reads one seed and one slot, and compares against at most one
+ * key. Tables are built either at compile time with TStaticPerfectHash, or by a code generator calling
+ * UE::PerfectHash::Build and emitting the seeds and slots as static data for FPerfectHashTable.
+ */
+namespace UE::PerfectHash
+{
+	/** Value of unused slots. */
+	constexpr uint16 EmptySlot = 0xFFFF;
+
+	/** Maximum number of keys in a table, as slots hold 16-bit key indices. */
+	constexpr uint32 MaxKeys = EmptySlot;
+
+	constexpr uint32 RoundUpToPowerOfTwo(uint32 Value)
+	{
+		uint32 Result = 1;
+		while (Result < Value)
+		{
+			Result <<= 1;
+		}
+		return Result;
+	}
+
+	/** Number of buckets that keeps them at about four keys each. */
+	constexpr uint32 GetNumBuckets(uint32 NumKeys)
+	{
+		return RoundUpToPowerOfTwo((NumKeys + 3) / 4);
+	}
+
+	/** Number of slots that keeps the table at most half full, so seeds are quick to find. */
+	constexpr uint32 GetNumSlots(uint32 NumKeys)
+	{
+		return RoundUpToPowerOfTwo(NumKeys * 2);
+	}
+
+	constexpr uint32 Mix(uint32 Hash)
+	{
+		Hash ^= Hash >> 16;
+		Hash *= 0x85ebca6bu;
+		Hash ^= Hash >> 13;
+		Hash *= 0xc2b2ae35u;
+		Hash ^= Hash >> 16;
+		return Hash;
+	}
+
+	/** Code unit of a character with ASCII upper case letters turned into lower case. */
+	template <typename CharType>
+	constexpr uint32 ToLowerAscii(CharType Char)
+	{
+		const uint32 CodeUnit = sizeof(CharType) == 1 ? (uint32)(uint8)Char : (uint32)Char;
+		return CodeUnit >= 'A' && CodeUnit <= 'Z' ? CodeUnit + ('a' - 'A') : CodeUnit;
+	}
+
+	/** FNV-1a of the key, ignoring ASCII case. */
+	template <typename CharType>
+	constexpr uint32 HashKey(const CharType* Key, int32 Len)
+	{
+		uint32 Hash = 0x811c9dc5u;
+		for (int32 Index = 0; Index < Len; ++Index)
+		{
+			Hash = (Hash ^ ToLowerAscii(Key[Index])) * 0x01000193u;
+		}
+		return Hash;
+	}
+
+	constexpr uint32 GetBucket(uint32 KeyHash, uint32 NumBuckets)
+	{
+		return Mix(KeyHash) & (NumBuckets - 1);
+	}
+
+	constexpr uint32 GetSlot(uint32 KeyHash, uint16 Seed, uint32 NumSlots)
+	{
+		return Mix(KeyHash ^ (Seed * 0x9e3779b9u)) & (NumSlots - 1);
+	}
+
+	/** Number of uint32 Build() needs for sorting keys into buckets. */
+	constexpr uint32 GetBuildScratchSize(uint32 NumKeys)
+	{
+		return GetNumBuckets(NumKeys) + 1 + NumKeys;
+	}
+
+	/**
+	 * Find bucket seeds that map every key to its own slot.
+	 *
+	 * Usable in constant expressions and at runtime. Buckets are placed largest first, each trying seeds until its keys
+	 * all land in free slots.
+	 *
+	 * @param KeyHashes HashKey() of every key.
+	 * @param NumKeys Number of keys, at most MaxKeys.
+	 * @param OutSeeds Receives GetNumBuckets(NumKeys) seeds.
+	 * @param OutSlots Receives GetNumSlots(NumKeys) key indices, EmptySlot for unused slots.
+	 * @param Scratch GetBuildScratchSize(NumKeys) temporary values.
+	 * @return false if no table was found, which happens when two keys are equal ignoring case.
+	 */
+	constexpr bool Build(const uint32* KeyHashes, uint32 NumKeys, uint16* OutSeeds, uint16* OutSlots, uint32* Scratch)
+	{
+		if (NumKeys > MaxKeys)
+		{
+			return false;
+		}
+
+		const uint32 NumBuckets = GetNumBuckets(NumKeys);
+		const uint32 NumSlots = GetNumSlots(NumKeys);
+
+		// Sort keys by bucket, the keys of bucket B are BucketKeys[BucketStarts[B]] to BucketKeys[BucketStarts[B + 1] - 1]
+		uint32* BucketStarts = Scratch;
+		uint32* BucketKeys = Scratch + NumBuckets + 1;
+		for (uint32 Bucket = 0; Bucket <= NumBuckets; ++Bucket)
+		{
+			BucketStarts[Bucket] = 0;
+		}
+		for (uint32 Key = 0; Key < NumKeys; ++Key)
+		{
+			++BucketStarts[GetBucket(KeyHashes[Key], NumBuckets) + 1];
+		}
+		uint32 MaxBucketSize = 0;
+		for (uint32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+		{
+			MaxBucketSize = BucketStarts[Bucket + 1] > MaxBucketSize ? BucketStarts[Bucket + 1] : MaxBucketSize;
+			BucketStarts[Bucket + 1] += BucketStarts[Bucket];
+		}
+		for (uint32 Key = 0; Key < NumKeys; ++Key)
+		{
+			// Uses the start of the next bucket as the insertion cursor, shifted back below
+			BucketKeys[BucketStarts[GetBucket(KeyHashes[Key], NumBuckets)]++] = Key;
+		}
+		for (uint32 Bucket = NumBuckets; Bucket > 0; --Bucket)
+		{
+			BucketStarts[Bucket] = BucketStarts[Bucket - 1];
+		}
+		BucketStarts[0] = 0;
+
+		for (uint32 Slot = 0; Slot < NumSlots; ++Slot)
+		{
+			OutSlots[Slot] = EmptySlot;
+		}
+
+		// Empty buckets keep seed zero, as any seed works for them
+		for (uint32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+		{
+			OutSeeds[Bucket] = 0;
+		}
+
+		// Place larger buckets first while there is more room
+		for (uint32 BucketSize = MaxBucketSize; BucketSize > 0; --BucketSize)
+		{
+			for (uint32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+			{
+				const uint32 First = BucketStarts[Bucket];
+				const uint32 Last = BucketStarts[Bucket + 1];
+				if (Last - First != BucketSize)
+				{
+					continue;
+				}
+
+				bool bPlaced = false;
+				for (uint32 Seed = 1; Seed <= 0xFFFF && !bPlaced; ++Seed)
+				{
+					// Claim slots for the bucket's keys, releasing them again if any is taken
+					bPlaced = true;
+					for (uint32 Index = First; Index < Last && bPlaced; ++Index)
+					{
+						const uint32 Slot = GetSlot(KeyHashes[BucketKeys[Index]], (uint16)Seed, NumSlots);
+						if (OutSlots[Slot] == EmptySlot)
+						{
+							OutSlots[Slot] = (uint16)BucketKeys[Index];
+						}
+						else
+						{
+							bPlaced = false;
+							for (uint32 Claimed = First; Claimed < Index; ++Claimed)
+							{
+								OutSlots[GetSlot(KeyHashes[BucketKeys[Claimed]], (uint16)Seed, NumSlots)] = EmptySlot;
+							}
+						}
+					}
+
+					if (bPlaced)
+					{
+						OutSeeds[Bucket] = (uint16)Seed;
+					}
+				}
+
+				if (!bPlaced)
+				{
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	/** Compare a key against a table key, optionally ignoring ASCII case like HashKey(). */
+	template <typename CharType>
+	inline bool KeyEquals(TStringView<CharType> Key, const char* TableKey, ESearchCase::Type SearchCase)
+	{
+		const int32 Len = Key.Len();
+		for (int32 Index = 0; Index < Len; ++Index)
+		{
+			if (TableKey[Index] == 0)
+			{
+				return false;
+			}
+
+			const bool bEqual = SearchCase == ESearchCase::IgnoreCase
+				? ToLowerAscii(Key[Index]) == ToLowerAscii(TableKey[Index])
+				: (sizeof(CharType) == 1 ? (uint32)(uint8)Key[Index] : (uint32)Key[Index]) == (uint32)(uint8)TableKey[Index];
+			if (!bEqual)
+			{
+				return false;
+			}
+		}
+		return TableKey[Len] == 0;
+	}
+}
+
+/**
+ * Runtime view of a perfect hash table whose seeds and slots are static data, e.g. emitted by a code generator.
+ *
+ * FindCandidate() only narrows a key down to one index, callers must compare that key since keys that aren't in the
+ * table still map to some slot.
+ */
+struct FPerfectHashTable
+{
+	/** One seed per bucket. */
+	const uint16* Seeds;
+
+	/** Key index of every slot, UE::PerfectHash::EmptySlot for unused ones. */
+	const uint16* Slots;
+
+	/** Number of keys the table was built for. */
+	uint32 NumKeys;
+
+	/**
+	 * Find the only key index the given key can have.
+	 *
+	 * @return Key index to compare against, or INDEX_NONE when the key definitely isn't in the table.
+	 */
+	template <typename CharType>
+	int32 FindCandidate(TStringView<CharType> Key) const
+	{
+		const uint32 KeyHash = UE::PerfectHash::HashKey(Key.GetData(), Key.Len());
+		const uint16 Seed = Seeds[UE::PerfectHash::GetBucket(KeyHash, UE::PerfectHash::GetNumBuckets(NumKeys))];
+		const uint16 KeyIndex = Slots[UE::PerfectHash::GetSlot(KeyHash, Seed, UE::PerfectHash::GetNumSlots(NumKeys))];
+		return KeyIndex == UE::PerfectHash::EmptySlot ? INDEX_NONE : (int32)KeyIndex;
+	}
+};
+
+/**
+ * Perfect hash table built at compile time from a fixed array of keys.
+ *
+ *     static constexpr const char* Keys[] = { "Red", "Green", "Blue" };
+ *     static constexpr TStaticPerfectHash<UE_ARRAY_COUNT(Keys)> KeyHash(Keys);
+ *     static_assert(KeyHash.IsValid(), "Keys must be unique ignoring case");
+ *
+ *     int32 Index = KeyHash.Find(TEXTVIEW("green")); // 1
+ *
+ * @param NumKeys Number of keys.
+ */
+template <uint32 NumKeys>
+class TStaticPerfectHash
+{
+	static_assert(NumKeys > 0 && NumKeys <= UE::PerfectHash::MaxKeys, "TStaticPerfectHash needs between 1 and 65535 keys");
+
+	static constexpr uint32 NumBuckets = UE::PerfectHash::GetNumBuckets(NumKeys);
+	static constexpr uint32 NumSlots = UE::PerfectHash::GetNumSlots(NumKeys);
+
+public:
+
+	/** Build the table. Keys must outlive it, which string literals do. */
+	constexpr explicit TStaticPerfectHash(const char* const (&InKeys)[NumKeys])
+		: Keys(InKeys)
+		, Seeds()
+		, Slots()
+		, bValid(false)
+	{
+		uint32 KeyHashes[NumKeys] = {};
+		uint32 Scratch[UE::PerfectHash::GetBuildScratchSize(NumKeys)] = {};
+		for (uint32 Index = 0; Index < NumKeys; ++Index)
+		{
+			int32 Len = 0;
+			while (InKeys[Index][Len] != 0)
+			{
+				++Len;
+			}
+			KeyHashes[Index] = UE::PerfectHash::HashKey(InKeys[Index], Len);
+		}
+
+		bValid = UE::PerfectHash::Build(KeyHashes, NumKeys, Seeds, Slots, Scratch);
+	}
+
+	/** Whether every key got its own slot, false when two keys are equal ignoring case. */
+	constexpr bool IsValid() const
+	{
+		return bValid;
+	}
+
+	/**
+	 * Find the index of a key.
+	 *
+	 * @param Key The key to find.
+	 * @param SearchCase Whether to compare keys ignoring ASCII case.
+	 * @return The index of the key in the array the table was built from, or INDEX_NONE.
+	 */
+	template <typename CharType>
+	int32 Find(TStringView<CharType> Key, ESearchCase::Type SearchCase = ESearchCase::IgnoreCase) const
+	{
+		if (!bValid)
+		{
+			return INDEX_NONE;
+		}
+
+		const int32 Index = GetTable().FindCandidate(Key);
+		return Index != INDEX_NONE && UE::PerfectHash::KeyEquals(Key, Keys[Index], SearchCase) ? Index : INDEX_NONE;
+	}
+
+	/** Get a runtime view of the table, which stays valid as long as this table. */
+	FPerfectHashTable GetTable() const
+	{
+		return FPerfectHashTable{ Seeds, Slots, NumKeys };
+	}
+
+private:
+
+	const char* const* Keys;
+	uint16 Seeds[NumBuckets];
+	uint16 Slots[NumSlots];
+	bool bValid;
+};
@@ -59,6 +59,7 @@ class FPackageId;
 class IMappedFileHandle;
 class IMappedFileRegion;
 struct FFileRegion;
+struct FIoMappedRegion;
 struct IIoDispatcherBackend;
 template <typename CharType> class TStringBuilderBase;
 
@@ -461,6 +462,8 @@ public:
 	CORE_API			FIoBuffer(ECloneTag,			FMemoryView Memory);
 	CORE_API			FIoBuffer(EWrapTag,				const void* Data, uint64 InSize);
 	CORE_API			FIoBuffer(EWrapTag,				FMemoryView Memory);
+	/** Takes ownership of a mapped region, the buffer is read only and the region is unmapped when the last reference is released. */
+	CORE_API			FIoBuffer(EAssumeOwnershipTag,	FIoMappedRegion&& MappedRegion);
 
 	// Note: we currently rely on implicit move constructor, thus we do not declare any
 	//		 destructor or copy/assignment operators or copy constructors
@@ -512,6 +515,7 @@ private:
 					BufCore(const uint8* InData, uint64 InSize, bool InOwnsMemory);
 					BufCore(const uint8* InData, uint64 InSize, const BufCore* InOuter);
 					BufCore(ECloneTag, uint8* InData, uint64 InSize);
+		explicit	BufCore(FIoMappedRegion* InMappedRegion);
 
 					BufCore(const BufCore& Rhs) = delete;
 		
@@ -589,8 +593,9 @@ private:
 		{
 			OwnsMemory		= 1 << 0,	// Buffer memory is owned by this instance
 			ReadOnlyBuffer	= 1 << 1,	// Buffer memory is immutable
+			OwnsMappedRegion = 1 << 2,	// DataPtr is an owned FIoMappedRegion, used as the outer core of mapped buffers
 			
-			FlagsMask		= (1 << 2) - 1
+			FlagsMask		= (1 << 3) - 1
 		};
 
 		void EnsureDataIsResident() {}
@@ -792,8 +797,37 @@ static FIoChunkId CreateIoChunkId(uint64 ChunkId, uint16 ChunkIndex, EIoChunkTyp
 CORE_API FIoChunkId CreatePackageDataChunkId(const FPackageId& PackageId);
 CORE_API FIoChunkId CreateExternalFileChunkId(const FStringView Filename);
 
+/** Creates the chunk ID of the preload manifest in the global container, see FIoPreloadManifest. */
+CORE_API FIoChunkId CreatePreloadManifestChunkId();
+
+/**
+ * Chunks that were requested during startup of recorded sessions, in the order they were first requested.
+ * Sessions are recorded with -RecordIoRequestOrder[=Seconds], the recordings are baked into the global container
+ * by IoStore staging with -PreloadOrder=<File> and the chunks are preloaded with FIoDispatcher::Preload at startup.
+ */
+struct FIoPreloadManifest
+{
+	TArray<FIoChunkId> ChunkIds;
+
+	CORE_API FIoBuffer Save() const;
+	CORE_API bool Load(const FIoBuffer& Buffer);
+	/** Appends the chunks of a recorded session that are not in the manifest yet, a recording has one chunk ID per line. */
+	CORE_API bool LoadRecording(const TCHAR* Filename);
+};
+
 //////////////////////////////////////////////////////////////////////////
 
+enum class EIoReadOptionsFlags : uint32
+{
+	None = 0,
+	/**
+	 * The read can be completed with a read only view of the memory mapped container file instead of a copy, if the chunk
+	 * is stored uncompressed and unencrypted and the platform supports memory mapping. Ignored if a target VA is set.
+	 */
+	AllowMemoryMapping = 1 << 0,
+};
+ENUM_CLASS_FLAGS(EIoReadOptionsFlags);
+
 class FIoReadOptions
 {
 public:
@@ -838,10 +872,21 @@ public:
 		return TargetVa;
 	}
 
+	void SetFlags(EIoReadOptionsFlags InFlags)
+	{
+		Flags = InFlags;
+	}
+
+	EIoReadOptionsFlags GetFlags() const
+	{
+		return Flags;
+	}
+
 private:
 	uint64	RequestedOffset = 0;
 	uint64	RequestedSize = ~uint64(0);
 	void* TargetVa = nullptr;
+	EIoReadOptionsFlags Flags = EIoReadOptionsFlags::None;
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -990,6 +1035,13 @@ public:
 	CORE_API TIoStatusOr<uint64>	GetSizeForChunk(const FIoChunkId& ChunkId) const;
 	CORE_API int64					GetTotalLoaded() const;
 
+	/**
+	 * Reads the chunks in the background at low priority, in order, until their total size exceeds MemoryBudget.
+	 * Requests for a preloaded chunk are completed from memory. Preloaded chunks that are not requested
+	 * are dropped after s.IoDispatcherPreloadLifetimeSeconds or when memory is trimmed.
+	 */
+	CORE_API void					Preload(TConstArrayView<FIoChunkId> ChunkIds, uint64 MemoryBudget);
+
 
 	// Events
 	CORE_API FIoSignatureErrorDelegate& OnSignatureError();
@@ -1165,6 +1217,8 @@ struct FIoStoreWriterResult
 	uint64 AddedChunksSize = 0;
 	uint64 ModifiedChunksCount = 0;
 	uint64 ModifiedChunksSize = 0;
+	uint64 ReferencedChunksCount = 0;
+	uint64 ReferencedChunksSize = 0;
 	FName CompressionMethod = NAME_None;
 	EIoContainerFlags ContainerFlags;
 };
@@ -1304,6 +1358,12 @@ public:
 	*/
 	CORE_API virtual void SetReferenceChunkDatabase(TSharedPtr<IIoStoreWriterReferenceChunkDatabase> ReferenceChunkDatabase) = 0;
 	CORE_API virtual void EnableDiskLayoutOrdering(const TArray<TUniquePtr<FIoStoreReader>>& PatchSourceReaders = TArray<TUniquePtr<FIoStoreReader>>()) = 0;
+	/**
+	*	Chunks with the same hash as a chunk in one of the source containers are not written but referenced from the TOC,
+	*	the source containers have to be mounted for the chunks to be resolved at runtime. Not supported for signed containers.
+	*	This must be set before any writes are appended.
+	*/
+	CORE_API virtual void EnableChunkDeduplication(const TArray<TUniquePtr<FIoStoreReader>>& SourceReaders) = 0;
 	CORE_API virtual void Append(const FIoChunkId& ChunkId, FIoBuffer Chunk, const FIoWriteOptions& WriteOptions, uint64 OrderHint = MAX_uint64) = 0;
 	CORE_API virtual void Append(const FIoChunkId& ChunkId, IIoStoreWriteRequest* Request, const FIoWriteOptions& WriteOptions) = 0;
 	CORE_API virtual TIoStatusOr<FIoStoreWriterResult> GetResult() = 0;
@@ -11,3 +11,6 @@
 #define PLATFORM_GLOBAL_LOG_CATEGORY			LogLinux
 
 #define PLATFORM_SUPPORTS_BORDERLESS_WINDOW		1
+
+// Stack sampling for the StackSamplingChannel trace channel, see UnixPlatformEvents.cpp
+#define PLATFORM_SUPPORTS_PLATFORM_EVENTS		1
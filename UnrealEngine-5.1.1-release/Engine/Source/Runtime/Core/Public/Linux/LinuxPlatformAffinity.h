@@ -3,4 +3,14 @@
 #pragma once
 
 #include "GenericPlatform/GenericPlatformAffinity.h" // IWYU pragma: export
-typedef FGenericPlatformAffinity FPlatformAffinity;
+
+class FLinuxPlatformAffinity : public FGenericPlatformAffinity
+{
+public:
+	/** NUMA topology is read from sysfs, only the first 64 logical processors can be represented in a node mask. */
+	static CORE_API uint32 GetNumNumaNodes();
+	static CORE_API uint64 GetNumaNodeMask(uint32 NodeIndex, uint16& OutProcessorGroup);
+	static CORE_API uint32 GetCurrentNumaNode();
+};
+
+typedef FLinuxPlatformAffinity FPlatformAffinity;
@@ -0,0 +1,44 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Containers/ArrayView.h"
+#include "Math/MathFwd.h"
+
+/**
+ * Batched transform math.
+ *
+ * These apply the same operation to every element of an array using the VectorRegister intrinsics, loading the
+ * shared operands into registers once per batch instead of once per element. They are the bulk equivalents of
+ * FTransform::TransformPosition, operator*, Inverse and FBox::operator+=, and produce the same results.
+ *
+ * Input and output views must have the same number of elements. Outputs may alias inputs for in-place operation,
+ * as long as they alias exactly.
+ */
+namespace UE::Math
+{
+	/** OutPositions[i] = Transform.TransformPosition(Positions[i]) */
+	CORE_API void TransformPositions(const FTransform3f& Transform, TArrayView<const FVector3f> Positions, TArrayView<FVector3f> OutPositions);
+	CORE_API void TransformPositions(const FTransform3d& Transform, TArrayView<const FVector3d> Positions, TArrayView<FVector3d> OutPositions);
+
+	/** Positions[i] = Transform.TransformPosition(Positions[i]) */
+	CORE_API void TransformPositions(const FTransform3f& Transform, TArrayView<FVector3f> Positions);
+	CORE_API void TransformPositions(const FTransform3d& Transform, TArrayView<FVector3d> Positions);
+
+	/** OutTransforms[i] = Transforms[i] * ParentTransforms[i] */
+	CORE_API void ComposeTransforms(TArrayView<const FTransform3f> Transforms, TArrayView<const FTransform3f> ParentTransforms, TArrayView<FTransform3f> OutTransforms);
+	CORE_API void ComposeTransforms(TArrayView<const FTransform3d> Transforms, TArrayView<const FTransform3d> ParentTransforms, TArrayView<FTransform3d> OutTransforms);
+
+	/** OutTransforms[i] = Transforms[i] * ParentTransform, e.g. to move component space bone transforms to world space */
+	CORE_API void ComposeTransforms(TArrayView<const FTransform3f> Transforms, const FTransform3f& ParentTransform, TArrayView<FTransform3f> OutTransforms);
+	CORE_API void ComposeTransforms(TArrayView<const FTransform3d> Transforms, const FTransform3d& ParentTransform, TArrayView<FTransform3d> OutTransforms);
+
+	/** OutTransforms[i] = Transforms[i].Inverse() */
+	CORE_API void InverseTransforms(TArrayView<const FTransform3f> Transforms, TArrayView<FTransform3f> OutTransforms);
+	CORE_API void InverseTransforms(TArrayView<const FTransform3d> Transforms, TArrayView<FTransform3d> OutTransforms);
+
+	/** Returns the bounding box of the points, which is invalid when there are none. */
+	CORE_API FBox3f ComputeBounds(TArrayView<const FVector3f> Points);
+	CORE_API FBox3d ComputeBounds(TArrayView<const FVector3d> Points);
+}
@@ -4,6 +4,7 @@
 
 #include "CoreTypes.h"
 #include "HAL/PlatformProcess.h"
+#include "ProfilingDebugging/LockTrace.h"
 #include <atomic>
 
 namespace UE
@@ -20,6 +21,13 @@ namespace UE
 
 		void Lock()
 		{
+#if LOCKTRACE_ENABLED
+			if (TryLock())
+			{
+				return;
+			}
+			TRACE_LOCK_WAIT_SCOPE(this, ELockTraceType::SpinLock);
+#endif
 			while (true)
 			{
 				if (!bFlag.exchange(true, std::memory_order_acquire))
@@ -0,0 +1,76 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "HAL/PreprocessorHelpers.h"
+#include "Misc/Build.h"
+#include "Trace/Config.h"
+
+#if !defined(LOCKTRACE_ENABLED)
+#if UE_TRACE_ENABLED && !UE_BUILD_SHIPPING
+#define LOCKTRACE_ENABLED 1
+#else
+#define LOCKTRACE_ENABLED 0
+#endif
+#endif
+
+enum class ELockTraceType : uint8
+{
+	CriticalSection,
+	ReadLock,
+	WriteLock,
+	SpinLock,
+	Event,
+};
+
+#if LOCKTRACE_ENABLED
+
+/*
+ * Traces waits for contended locks and events into the Lock channel: the lock address, the wait time and the callstack of the waiting thread.
+ * If the Cpu channel is enabled too, every wait is shown as a "LockWait" region in the thread's track in Timing Insights.
+ * Only waits are traced: acquiring a lock that is not contended costs a single try-lock, so this can be left on in development builds.
+ */
+struct FLockTrace
+{
+	// starts a wait for a lock or event, returns the start cycle to pass to `EndWait`, 0 if the wait is not traced
+	CORE_API static uint64 BeginWait(const void* Lock, ELockTraceType Type, bool& bOutCpuEvent);
+
+	CORE_API static void EndWait(const void* Lock, ELockTraceType Type, uint64 StartCycle, bool bCpuEvent);
+
+	class FWaitScope
+	{
+	public:
+		UE_NONCOPYABLE(FWaitScope);
+
+		FORCEINLINE FWaitScope(const void* InLock, ELockTraceType InType)
+			: Lock(InLock)
+			, StartCycle(BeginWait(InLock, InType, bCpuEvent))
+			, Type(InType)
+		{
+		}
+
+		FORCEINLINE ~FWaitScope()
+		{
+			if (StartCycle != 0)
+			{
+				EndWait(Lock, Type, StartCycle, bCpuEvent);
+			}
+		}
+
+	private:
+		const void* Lock;
+		bool bCpuEvent = false; // declared before StartCycle, BeginWait sets it
+		uint64 StartCycle;
+		ELockTraceType Type;
+	};
+};
+
+// Traces the rest of the scope as a wait for the given lock, should be used only if the lock was found contended
+#define TRACE_LOCK_WAIT_SCOPE(Lock, Type) FLockTrace::FWaitScope PREPROCESSOR_JOIN(__LockWaitScope, __LINE__)(Lock, Type)
+
+#else
+
+#define TRACE_LOCK_WAIT_SCOPE(Lock, Type)
+
+#endif
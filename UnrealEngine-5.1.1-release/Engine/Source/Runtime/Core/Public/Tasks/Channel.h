@@ -0,0 +1,183 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Async/Fundamental/Scheduler.h"
+#include "Containers/BoundedMpmcQueue.h"
+#include "CoreTypes.h"
+#include "HAL/PlatformProcess.h"
+#include "Math/UnrealMathUtility.h"
+#include "Misc/AssertionMacros.h"
+#include "Templates/Function.h"
+#include "Templates/UnrealTemplate.h"
+#include "Tasks/Task.h"
+
+#include <atomic>
+
+namespace UE::Tasks
+{
+	// A bounded channel that connects any number of producers with a consumer callable. Instead of a thread polling or waiting for
+	// items, consumer tasks are launched on demand when items arrive and finish when the channel is drained, up to `MaxConsumers`
+	// of them run concurrently. The consumer is called once per item, concurrently if `MaxConsumers` > 1.
+	// Sending to a full channel fails (`TrySend`) or waits until there's room (`Send`), which applies backpressure to producers.
+	// A channel must be alive until all sent items are consumed, the destructor waits for that.
+	// See `FTasksChannelTest` for tests and examples.
+	template<typename T>
+	class TChannel
+	{
+	public:
+		UE_NONCOPYABLE(TChannel);
+
+		// @param InDebugName helps to identify consumer tasks in debugger and profiler
+		// @param Capacity the maximum number of items that were sent and not consumed yet, rounded up to a power of two
+		// @param InConsumer a callable that takes an item by value or reference
+		// @param InPriority the priority of consumer tasks
+		// @param InMaxConsumers the maximum number of consumer tasks that run concurrently
+		template<typename ConsumerType>
+		TChannel(const TCHAR* InDebugName, uint32 Capacity, ConsumerType&& InConsumer, ETaskPriority InPriority = ETaskPriority::Default, uint32 InMaxConsumers = 1)
+			: Queue(Capacity)
+			, Consumer(Forward<ConsumerType>(InConsumer))
+			, DebugName(InDebugName)
+			, Priority(InPriority)
+			, MaxConsumers(FMath::Max(InMaxConsumers, 1u))
+		{
+		}
+
+		~TChannel()
+		{
+			Close();
+			WaitUntilEmpty();
+		}
+
+		// sends an item constructed from given arguments, if the channel is not full or closed
+		// @return false if the item was not sent, the arguments are not consumed in this case
+		template<typename... ArgTypes>
+		bool TrySend(ArgTypes&&... Args)
+		{
+			if (bClosed.load(std::memory_order_relaxed))
+			{
+				return false;
+			}
+
+			// counted before it's enqueued so a consumer can never consume an item that is not counted yet
+			NumPending.fetch_add(1);
+			if (!Queue.TryEnqueue(Forward<ArgTypes>(Args)...))
+			{
+				NumPending.fetch_sub(1);
+				return false;
+			}
+
+			TryLaunchConsumer();
+			return true;
+		}
+
+		// sends an item constructed from given arguments, waits while the channel is full. Waiting threads help executing other tasks,
+		// e.g. the consumer of the channel, so it's safe to send from worker threads
+		// @return false if the channel is closed
+		template<typename... ArgTypes>
+		bool Send(ArgTypes&&... Args)
+		{
+			if (TrySend(Forward<ArgTypes>(Args)...))
+			{
+				return true;
+			}
+
+			bool bSent = false;
+			LowLevelTasks::BusyWaitUntil([this, &bSent, &Args...]
+				{
+					// arguments are only consumed by a successful attempt
+					bSent = TrySend(Forward<ArgTypes>(Args)...);
+					return bSent || IsClosed();
+				});
+			return bSent;
+		}
+
+		// rejects all items sent after this call, already sent items are still consumed
+		void Close()
+		{
+			bClosed.store(true, std::memory_order_relaxed);
+		}
+
+		bool IsClosed() const
+		{
+			return bClosed.load(std::memory_order_relaxed);
+		}
+
+		// returns `true` if there are items that were not consumed yet
+		bool HasWork() const
+		{
+			return NumPending.load(std::memory_order_relaxed) != 0 || NumConsumers.load(std::memory_order_relaxed) != 0;
+		}
+
+		// waits until all sent items are consumed, helping with other tasks while waiting
+		// should be used when no more items are sent, e.g. preparing for the channel destruction
+		void WaitUntilEmpty()
+		{
+			LowLevelTasks::BusyWaitUntil([this] { return !HasWork(); });
+		}
+
+		// the number of items that were sent but not consumed yet, can be outdated by the time it's returned
+		uint32 ApproxNum() const
+		{
+			return (uint32)FMath::Max(NumPending.load(std::memory_order_relaxed), 0);
+		}
+
+	private:
+		void TryLaunchConsumer()
+		{
+			uint32 LocalNumConsumers = NumConsumers.load();
+			do
+			{
+				if (LocalNumConsumers >= MaxConsumers || int32(LocalNumConsumers) >= NumPending.load())
+				{
+					return;
+				}
+			} while (!NumConsumers.compare_exchange_weak(LocalNumConsumers, LocalNumConsumers + 1));
+
+			Launch(DebugName, [this] { Consume(); }, Priority);
+		}
+
+		void Consume()
+		{
+			for (;;)
+			{
+				while (TOptional<T> Item = Queue.TryDequeue())
+				{
+					Consumer(*Item);
+					NumPending.fetch_sub(1);
+				}
+
+				// a producer that sent an item after the queue was found empty either sees that this consumer left,
+				// or this consumer sees the item and stays
+				NumConsumers.fetch_sub(1);
+				if (NumPending.load() <= 0)
+				{
+					return;
+				}
+
+				uint32 LocalNumConsumers = NumConsumers.load();
+				do
+				{
+					if (LocalNumConsumers >= MaxConsumers)
+					{
+						return;
+					}
+				} while (!NumConsumers.compare_exchange_weak(LocalNumConsumers, LocalNumConsumers + 1));
+
+				// the pending item can belong to a producer that didn't finish sending yet, or that fails to send it as the channel is full
+				FPlatformProcess::Yield();
+			}
+		}
+
+	private:
+		TBoundedMpmcQueue<T> Queue;
+		TFunction<void(T&)> Consumer;
+		const TCHAR* DebugName;
+		ETaskPriority Priority;
+		uint32 MaxConsumers;
+
+		std::atomic<int32> NumPending{ 0 }; // sent (or being sent) but not consumed items
+		std::atomic<uint32> NumConsumers{ 0 }; // running consumer tasks
+		std::atomic<bool> bClosed{ false };
+	};
+}
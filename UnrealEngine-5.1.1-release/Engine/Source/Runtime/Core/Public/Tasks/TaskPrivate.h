@@ -50,6 +50,7 @@ namespace UE::Tasks
 		None,
 		Inline, // a task priority for "inline" task execution - a task is executed "inline" by the thread that unlocked it, w/o scheduling
 		TaskEvent, // a task priority used by task events, allows to shortcut task execution
+		LaunchingNumaNode, // a task is scheduled to the workers of the NUMA node of the thread that launched it, e.g. to keep it close to the data the launching thread prepared
 
 #if TASKGRAPH_NEW_FRONTEND
 		// for integration with named threads
@@ -297,6 +298,13 @@ namespace UE::Tasks
 			bool TryLaunch()
 			{
 				TaskTrace::Launched(GetTraceId(), LowLevelTask.GetDebugName(), true, (ENamedThreads::Type)0xff);
+				if (ExtendedPriority == EExtendedTaskPriority::LaunchingNumaNode)
+				{
+					// the task can be unlocked and scheduled by any thread, so the node is captured here
+					LaunchNumaNode = LowLevelTasks::FScheduler::Get().GetCurrentNumaNode();
+				}
+				// same for the deadline of the launching thread, see `LowLevelTasks::FDeadlineScope`
+				LaunchDeadline = LowLevelTasks::FSchedulerTls::GetActiveDeadline();
 				return TryUnlock();
 			}
 
@@ -596,6 +604,8 @@ namespace UE::Tasks
 
 		private:
 			EExtendedTaskPriority ExtendedPriority; // internal priorities, if any
+			uint32 LaunchNumaNode = 0; // the NUMA node of the launching thread, for `EExtendedTaskPriority::LaunchingNumaNode`
+			uint64 LaunchDeadline = 0; // the deadline of the launching thread, 0 if it had none
 
 			LowLevelTasks::FTask LowLevelTask;
 
@@ -40,6 +40,9 @@ struct FExtendedPlatformMemoryStats
 
 	/** Private memory used */
 	SIZE_T Private_Dirty;
+
+	/** Anonymous memory backed by transparent huge pages */
+	SIZE_T AnonHugePages;
 };
 
 /**
@@ -82,6 +85,7 @@ struct CORE_API FUnixPlatformMemory : public FGenericPlatformMemory
 	static bool PageProtect(void* const Ptr, const SIZE_T Size, const bool bCanRead, const bool bCanWrite);
 	static void* BinnedAllocFromOS(SIZE_T Size);
 	static void BinnedFreeToOS(void* Ptr, SIZE_T Size);
+	static SIZE_T AdviseLargePages(void* Ptr, SIZE_T Size);
 
 	class FPlatformVirtualMemoryBlock : public FBasicVirtualMemoryBlock
 	{
@@ -5,6 +5,7 @@
 #include "CoreTypes.h"
 #include "Misc/Timespan.h"
 #include "HAL/PlatformMemory.h"
+#include "ProfilingDebugging/LockTrace.h"
 
 class FString;
 
@@ -41,6 +42,13 @@ public:
 	 */
 	FORCEINLINE void Lock()
 	{
+#if LOCKTRACE_ENABLED
+		if (Windows::TryEnterCriticalSection(&CriticalSection))
+		{
+			return;
+		}
+		TRACE_LOCK_WAIT_SCOPE(this, ELockTraceType::CriticalSection);
+#endif
 		Windows::EnterCriticalSection(&CriticalSection);
 	}
 
@@ -124,11 +132,25 @@ public:
 
 	FORCEINLINE void ReadLock()
 	{
+#if LOCKTRACE_ENABLED
+		if (Windows::TryAcquireSRWLockShared(&Mutex))
+		{
+			return;
+		}
+		TRACE_LOCK_WAIT_SCOPE(this, ELockTraceType::ReadLock);
+#endif
 		Windows::AcquireSRWLockShared(&Mutex);
 	}
 
 	FORCEINLINE void WriteLock()
 	{
+#if LOCKTRACE_ENABLED
+		if (Windows::TryAcquireSRWLockExclusive(&Mutex))
+		{
+			return;
+		}
+		TRACE_LOCK_WAIT_SCOPE(this, ELockTraceType::WriteLock);
+#endif
 		Windows::AcquireSRWLockExclusive(&Mutex);
 	}
 
@@ -3,4 +3,13 @@
 #pragma once
 
 #include "GenericPlatform/GenericPlatformAffinity.h"
-typedef FGenericPlatformAffinity FPlatformAffinity;
+
+class FWindowsPlatformAffinity : public FGenericPlatformAffinity
+{
+public:
+	static CORE_API uint32 GetNumNumaNodes();
+	static CORE_API uint64 GetNumaNodeMask(uint32 NodeIndex, uint16& OutProcessorGroup);
+	static CORE_API uint32 GetCurrentNumaNode();
+};
+
+typedef FWindowsPlatformAffinity FPlatformAffinity;
@@ -0,0 +1,180 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#if WITH_TESTS
+
+#include "Containers/FlatHashMap.h"
+#include "Containers/Map.h"
+#include "Containers/SortedMap.h"
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+#include "Tests/Benchmark.h"
+
+#include "Tests/TestHarness.h"
+
+namespace FlatHashMap
+{
+namespace Test
+{
+template <typename MapType>
+void RandomOperationsMatchTMap()
+{
+	MapType Map;
+	TMap<int32, int32> Reference;
+	FRandomStream Random(0x1234);
+
+	for (int32 Iteration = 0; Iteration < 100000; ++Iteration)
+	{
+		const int32 Key = Random.RandRange(0, 2000);
+		switch (Random.RandRange(0, 2))
+		{
+		case 0:
+			Map.Add(Key, Iteration);
+			Reference.Add(Key, Iteration);
+			break;
+		case 1:
+			CHECK(Map.Remove(Key) == Reference.Remove(Key));
+			break;
+		default:
+		{
+			const int32* Found = Map.Find(Key);
+			const int32* Expected = Reference.Find(Key);
+			CHECK((Found != nullptr) == (Expected != nullptr));
+			if (Found && Expected)
+			{
+				CHECK(*Found == *Expected);
+			}
+		}
+		}
+	}
+
+	CHECK(Map.Num() == Reference.Num());
+	int32 NumIterated = 0;
+	for (const TPair<int32, int32>& Element : Map)
+	{
+		CHECK(Reference.FindChecked(Element.Key) == Element.Value);
+		++NumIterated;
+	}
+	CHECK(NumIterated == Reference.Num());
+}
+
+template <typename MapType>
+void RemoveDuringIteration()
+{
+	MapType Map;
+	for (int32 Index = 0; Index < 1000; ++Index)
+	{
+		Map.Add(Index, Index);
+	}
+
+	for (typename MapType::TIterator It = Map.CreateIterator(); It; ++It)
+	{
+		if (It.Key() % 2)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	CHECK(Map.Num() == 500);
+	for (int32 Index = 0; Index < 1000; ++Index)
+	{
+		CHECK(Map.Contains(Index) == (Index % 2 == 0));
+	}
+}
+} // namespace Test
+
+TEST_CASE("System::Core::Containers::TFlatHashMap::Stable iteration matches TMap", "[SmokeFilter][Core][Containers][FlatHashMap]")
+{
+	Test::RandomOperationsMatchTMap<TFlatHashMap<int32, int32>>();
+	Test::RemoveDuringIteration<TFlatHashMap<int32, int32>>();
+}
+
+TEST_CASE("System::Core::Containers::TFlatHashMap::Unordered matches TMap", "[SmokeFilter][Core][Containers][FlatHashMap]")
+{
+	Test::RandomOperationsMatchTMap<TUnorderedFlatHashMap<int32, int32>>();
+	Test::RemoveDuringIteration<TUnorderedFlatHashMap<int32, int32>>();
+}
+
+TEST_CASE("System::Core::Containers::TFlatHashMap::Insertion order", "[SmokeFilter][Core][Containers][FlatHashMap]")
+{
+	TFlatHashMap<FString, int32> Map;
+	Map.Add(TEXT("C"), 0);
+	Map.Add(TEXT("A"), 1);
+	Map.Add(TEXT("B"), 2);
+	Map.Add(TEXT("A"), 3);
+
+	TArray<FString> Keys;
+	Map.GetKeys(Keys);
+	CHECK(Keys == TArray<FString>({ TEXT("C"), TEXT("A"), TEXT("B") }));
+	CHECK(Map.FindChecked(TEXT("A")) == 3);
+	CHECK(Map.FindOrAdd(TEXT("D")) == 0);
+	CHECK(Map.Num() == 4);
+}
+
+TEST_CASE("System::Core::Containers::TFlatHashMap::Copy and move", "[SmokeFilter][Core][Containers][FlatHashMap]")
+{
+	TUnorderedFlatHashMap<int32, FString> Map;
+	for (int32 Index = 0; Index < 100; ++Index)
+	{
+		Map.Add(Index, FString::FromInt(Index));
+	}
+
+	TUnorderedFlatHashMap<int32, FString> Copy(Map);
+	CHECK(Copy.Num() == 100);
+	CHECK(Copy.FindChecked(42) == TEXT("42"));
+
+	TUnorderedFlatHashMap<int32, FString> Moved(MoveTemp(Copy));
+	CHECK(Moved.Num() == 100);
+	CHECK(Copy.IsEmpty());
+
+	Moved.Reset();
+	CHECK(Moved.IsEmpty());
+	CHECK(Moved.Find(42) == nullptr);
+}
+
+namespace Test
+{
+template <typename MapType, int32 NumElements>
+void BenchmarkLookup()
+{
+	MapType Map;
+	for (int32 Index = 0; Index < NumElements; ++Index)
+	{
+		Map.Add(Index * 7919, Index);
+	}
+
+	int64 Sum = 0;
+	for (int32 Repeat = 0; Repeat < (4'000'000 / NumElements); ++Repeat)
+	{
+		for (int32 Index = 0; Index < NumElements; ++Index)
+		{
+			// Half hits, half misses.
+			if (const int32* Value = Map.Find(Index * 7919 + (Index & 1)))
+			{
+				Sum += *Value;
+			}
+		}
+	}
+	CHECK(Sum >= 0);
+}
+} // namespace Test
+
+TEST_CASE("System::Core::Containers::TFlatHashMap::Benchmark", "[.][Perf][Core][Containers][FlatHashMap]")
+{
+	UE_BENCHMARK(5, Test::BenchmarkLookup<TMap<int32, int32>, 16>);
+	UE_BENCHMARK(5, Test::BenchmarkLookup<TSortedMap<int32, int32>, 16>);
+	UE_BENCHMARK(5, Test::BenchmarkLookup<TFlatHashMap<int32, int32>, 16>);
+	UE_BENCHMARK(5, Test::BenchmarkLookup<TUnorderedFlatHashMap<int32, int32>, 16>);
+
+	UE_BENCHMARK(5, Test::BenchmarkLookup<TMap<int32, int32>, 1024>);
+	UE_BENCHMARK(5, Test::BenchmarkLookup<TSortedMap<int32, int32>, 1024>);
+	UE_BENCHMARK(5, Test::BenchmarkLookup<TFlatHashMap<int32, int32>, 1024>);
+	UE_BENCHMARK(5, Test::BenchmarkLookup<TUnorderedFlatHashMap<int32, int32>, 1024>);
+
+	UE_BENCHMARK(5, Test::BenchmarkLookup<TMap<int32, int32>, 1'000'000>);
+	UE_BENCHMARK(5, Test::BenchmarkLookup<TSortedMap<int32, int32>, 1'000'000>);
+	UE_BENCHMARK(5, Test::BenchmarkLookup<TFlatHashMap<int32, int32>, 1'000'000>);
+	UE_BENCHMARK(5, Test::BenchmarkLookup<TUnorderedFlatHashMap<int32, int32>, 1'000'000>);
+}
+} // namespace FlatHashMap
+
+#endif // WITH_TESTS
@@ -0,0 +1,133 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#if WITH_TESTS
+
+#include "Containers/InlineString.h"
+#include "Containers/Map.h"
+#include "Containers/StringView.h"
+#include "Containers/UnrealString.h"
+#include "CoreMinimal.h"
+#include "Tests/Benchmark.h"
+
+#include "Tests/TestHarness.h"
+
+namespace InlineString
+{
+namespace Test
+{
+template <typename StringType>
+void BenchmarkShortStrings()
+{
+	const TCHAR* Components[] = { TEXT("Game"), TEXT("Maps"), TEXT("Environment"), TEXT("Props"), TEXT("SM_Rock_01") };
+	uint32 Hash = 0;
+	for (int32 Iteration = 0; Iteration < 1'000'000; ++Iteration)
+	{
+		StringType String(Components[Iteration % UE_ARRAY_COUNT(Components)]);
+		String += TEXT('_');
+		String += TEXT("LOD0");
+		Hash ^= GetTypeHash(String);
+	}
+	CHECK(Hash != 0xDEADBEEF);
+}
+}
+
+TEST_CASE("System::Core::Containers::TInlineString::Construct", "[SmokeFilter][Core][Containers][InlineString]")
+{
+	TInlineString<16> Empty;
+	CHECK(Empty.IsEmpty());
+	CHECK(Empty.Len() == 0);
+	CHECK(FCString::Strcmp(*Empty, TEXT("")) == 0);
+
+	TInlineString<16> Short(TEXT("Short"));
+	CHECK(Short.Len() == 5);
+	CHECK(Short.IsInline());
+	CHECK(Short.GetAllocatedSize() == 0);
+	CHECK(FCString::Strcmp(*Short, TEXT("Short")) == 0);
+
+	TInlineString<16> FromView(TEXTVIEW("ViewString"));
+	CHECK(FromView == TEXT("ViewString"));
+
+	const FString Long(TEXT("A string that does not fit inline"));
+	TInlineString<16> FromString(Long);
+	CHECK(!FromString.IsInline());
+	CHECK(FromString.GetAllocatedSize() > 0);
+	CHECK(FromString.ToString() == Long);
+
+	TInlineString<16> Copy(Short);
+	CHECK(Copy == Short);
+	TInlineString<16> Moved(MoveTemp(FromString));
+	CHECK(Moved == Long);
+
+	Copy = TEXT("Other");
+	CHECK(Copy == TEXT("Other"));
+	Copy = Long;
+	CHECK(Copy == Long);
+	Copy = FStringView(*Copy + 2, 6);
+	CHECK(Copy == TEXT("string"));
+}
+
+TEST_CASE("System::Core::Containers::TInlineString::Append", "[SmokeFilter][Core][Containers][InlineString]")
+{
+	TInlineString<8> String;
+	String.AppendChar(TEXT('A'));
+	String += TEXT("BC");
+	String.Append(TEXTVIEW("DEF"));
+	CHECK(String == TEXT("ABCDEF"));
+	CHECK(String.IsInline());
+
+	// Growing past the inline buffer moves the string to the heap
+	String.Append(FString(TEXT("GHIJ")));
+	CHECK(String == TEXT("ABCDEFGHIJ"));
+	CHECK(!String.IsInline());
+	CHECK(String.Len() == 10);
+	CHECK(String[9] == TEXT('J'));
+
+	String.LeftChopInline(3);
+	CHECK(String == TEXT("ABCDEFG"));
+	String.LeftChopInline(100);
+	CHECK(String.IsEmpty());
+
+	String.Reset();
+	CHECK(String.Len() == 0);
+	String.Empty();
+	CHECK(String.IsInline());
+}
+
+TEST_CASE("System::Core::Containers::TInlineString::Interop", "[SmokeFilter][Core][Containers][InlineString]")
+{
+	const TInlineString<32> String(TEXT("Engine/Content"));
+	const FString Equivalent(TEXT("ENGINE/content"));
+
+	// Comparisons are case-insensitive, matching FString
+	CHECK(String == Equivalent);
+	CHECK(String == TEXTVIEW("engine/CONTENT"));
+	CHECK(TEXTVIEW("engine/CONTENT") == String);
+	CHECK(String.Equals(TEXTVIEW("Engine/Content"), ESearchCase::CaseSensitive));
+	CHECK(!String.Equals(Equivalent, ESearchCase::CaseSensitive));
+	CHECK(String != TEXT("Engine"));
+	CHECK(TInlineString<32>(TEXT("A")) < TInlineString<32>(TEXT("b")));
+
+	// Hashes match FString so either can be used to look up the other
+	CHECK(GetTypeHash(String) == GetTypeHash(Equivalent));
+	CHECK(GetTypeHash(String) == GetTypeHash(FStringView(String)));
+
+	TMap<FString, int32> Map;
+	Map.Add(Equivalent, 1);
+	CHECK(Map.FindByHash(GetTypeHash(String), FStringView(String)) != nullptr);
+
+	const FStringView View = String;
+	CHECK(View.Len() == String.Len());
+	CHECK(View.GetData() == String.GetData());
+
+	const FString Converted(String);
+	CHECK(Converted.Equals(TEXT("Engine/Content"), ESearchCase::CaseSensitive));
+}
+
+TEST_CASE("System::Core::Containers::TInlineString::Benchmark", "[.][Perf][Core][Containers][InlineString]")
+{
+	UE_BENCHMARK(5, Test::BenchmarkShortStrings<FString>);
+	UE_BENCHMARK(5, Test::BenchmarkShortStrings<TInlineString<32>>);
+}
+} // namespace InlineString
+
+#endif // WITH_TESTS
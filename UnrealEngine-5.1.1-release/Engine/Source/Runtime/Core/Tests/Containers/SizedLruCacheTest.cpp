@@ -0,0 +1,158 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#if WITH_TESTS
+
+#include "Containers/SizedLruCache.h"
+#include "Containers/Array.h"
+
+#include "Tests/TestHarness.h"
+
+namespace SizedLruCache
+{
+namespace Test
+{
+struct FPayloadCost
+{
+	static SIZE_T GetCost(const TArray<uint8>& Value)
+	{
+		return Value.Num();
+	}
+};
+
+using FPayloadCache = TSizedLruCache<int32, TArray<uint8>, FPayloadCost>;
+
+TArray<uint8> MakePayload(int32 Size)
+{
+	TArray<uint8> Payload;
+	Payload.SetNumZeroed(Size);
+	return Payload;
+}
+}
+}
+
+TEST_CASE("System::Core::Containers::SizedLruCache::Budget", "[SmokeFilter][Core][Containers]")
+{
+	using namespace SizedLruCache::Test;
+
+	FPayloadCache Cache(100);
+	CHECK(Cache.Add(1, MakePayload(40)));
+	CHECK(Cache.Add(2, MakePayload(40)));
+	CHECK(Cache.GetCost() == 80);
+
+	// Touching 1 makes 2 the least recently used entry
+	CHECK(Cache.FindAndTouch(1) != nullptr);
+	CHECK(Cache.Add(3, MakePayload(40)));
+	CHECK(Cache.Contains(1));
+	CHECK(!Cache.Contains(2));
+	CHECK(Cache.Contains(3));
+	CHECK(Cache.GetCost() == 80);
+
+	// Updating an entry replaces its cost
+	CHECK(Cache.Add(1, MakePayload(10)));
+	CHECK(Cache.GetCost() == 50);
+	CHECK(Cache.Num() == 2);
+
+	// Entries larger than the whole cache are refused
+	CHECK(!Cache.Add(4, MakePayload(101)));
+	CHECK(!Cache.Contains(4));
+	CHECK(Cache.Num() == 2);
+
+	// 3 is now the least recently used entry
+	Cache.SetMaxCost(40);
+	CHECK(Cache.GetCost() == 10);
+	CHECK(Cache.Contains(1));
+	CHECK(!Cache.Contains(3));
+
+	Cache.Empty();
+	CHECK(Cache.IsEmpty());
+	CHECK(Cache.GetCost() == 0);
+}
+
+TEST_CASE("System::Core::Containers::SizedLruCache::PinAndEvict", "[SmokeFilter][Core][Containers]")
+{
+	using namespace SizedLruCache::Test;
+
+	FPayloadCache Cache(100);
+	TArray<int32> Evicted;
+	Cache.OnEvicted().BindLambda([&Evicted](const int32& Key, TArray<uint8>& Value) { Evicted.Add(Key); });
+
+	Cache.Add(1, MakePayload(50));
+	Cache.Add(2, MakePayload(50));
+	CHECK(Cache.Pin(1) != nullptr);
+	CHECK(Cache.IsPinned(1));
+
+	// Pinning touches 1, so updating 2 makes 1 the least recently used entry
+	Cache.Add(2, MakePayload(50));
+	Cache.Add(3, MakePayload(50));
+	CHECK(Cache.Contains(1));
+	CHECK(!Cache.Contains(2));
+	CHECK(Evicted == TArray<int32>({ 2 }));
+
+	// Nothing left to evict, so the cache goes over budget rather than dropping a pinned entry
+	CHECK(Cache.Pin(3) != nullptr);
+	CHECK(Cache.Add(4, MakePayload(50)));
+	CHECK(Cache.GetCost() == 150);
+
+	Cache.Unpin(1);
+	Cache.Unpin(3);
+	Cache.Trim(100);
+	CHECK(Cache.GetCost() == 100);
+	CHECK(!Cache.Contains(1));
+
+	// Explicit removal doesn't count as an eviction
+	Evicted.Reset();
+	Cache.Remove(3);
+	Cache.Empty();
+	CHECK(Evicted.IsEmpty());
+}
+
+TEST_CASE("System::Core::Containers::SizedLruCache::SharedBudget", "[SmokeFilter][Core][Containers]")
+{
+	using namespace SizedLruCache::Test;
+
+	FLruCacheBudget Budget(100);
+	{
+		FPayloadCache CacheA(100, &Budget);
+		FPayloadCache CacheB(100, &Budget);
+
+		CacheA.Add(1, MakePayload(60));
+		CacheB.Add(1, MakePayload(30));
+		CHECK(Budget.GetCost() == 90);
+
+		// B makes room by evicting its own entries, and the budget stays over while only A holds memory
+		CacheB.Add(2, MakePayload(30));
+		CHECK(CacheA.Contains(1));
+		CHECK(!CacheB.Contains(1));
+		CHECK(Budget.GetCost() == 90);
+
+		// Shrinking the shared budget makes A trim itself to fit
+		Budget.SetMaxCost(50);
+		CacheA.Trim(CacheA.GetMaxCost());
+		CHECK(CacheA.IsEmpty());
+		CHECK(Budget.GetCost() == 30);
+	}
+	CHECK(Budget.GetCost() == 0);
+}
+
+TEST_CASE("System::Core::Containers::SizedLruCache::Concurrent", "[SmokeFilter][Core][Containers]")
+{
+	using namespace SizedLruCache::Test;
+
+	TConcurrentSizedLruCache<int32, TArray<uint8>, FPayloadCost, DefaultKeyComparer<int32>, 4> Cache(400);
+	for (int32 Key = 0; Key < 100; ++Key)
+	{
+		Cache.Add(Key, MakePayload(10));
+	}
+	CHECK(Cache.GetCost() <= 400);
+	CHECK(Cache.Num() == 40);
+
+	TArray<uint8> Value;
+	CHECK(Cache.FindAndTouch(99, Value));
+	CHECK(Value.Num() == 10);
+	CHECK(!Cache.FindAndTouch(1000, Value));
+
+	Cache.Empty();
+	CHECK(Cache.Num() == 0);
+}
+
+#endif // WITH_TESTS
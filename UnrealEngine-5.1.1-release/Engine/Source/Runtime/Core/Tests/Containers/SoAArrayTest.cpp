@@ -0,0 +1,160 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#if WITH_TESTS
+
+#include "Containers/SoAArray.h"
+#include "Containers/UnrealString.h"
+#include "CoreMinimal.h"
+
+#include "Tests/TestHarness.h"
+
+namespace SoAArray
+{
+namespace Test
+{
+using FParticleArray = TSoAArray<FVector3f, uint8, FString, double>;
+
+void AddParticles(FParticleArray& Particles, int32 Count)
+{
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		Particles.Add(FVector3f((float)Index, 0.0f, (float)-Index), (uint8)Index, FString::FromInt(Index), Index * 2.0);
+	}
+}
+
+bool IsColumnAligned(const void* Column)
+{
+	return IsAligned(Column, 16);
+}
+}
+}
+
+TEST_CASE("System::Core::Containers::SoAArray::AddAndGet", "[SmokeFilter][Core][Containers]")
+{
+	using namespace SoAArray::Test;
+
+	FParticleArray Particles;
+	CHECK(Particles.IsEmpty());
+	CHECK(Particles.GetAllocatedSize() == 0);
+
+	AddParticles(Particles, 100);
+	REQUIRE(Particles.Num() == 100);
+	for (int32 Index = 0; Index < Particles.Num(); ++Index)
+	{
+		CHECK(Particles.Get<0>(Index).X == (float)Index);
+		CHECK(Particles.Get<1>(Index) == (uint8)Index);
+		CHECK(Particles.Get<2>(Index) == FString::FromInt(Index));
+		CHECK(Particles.Get<3>(Index) == Index * 2.0);
+	}
+
+	CHECK(IsColumnAligned(Particles.GetData<0>()));
+	CHECK(IsColumnAligned(Particles.GetData<1>()));
+	CHECK(IsColumnAligned(Particles.GetData<2>()));
+	CHECK(IsColumnAligned(Particles.GetData<3>()));
+
+	const int32 First = Particles.AddDefaulted(2);
+	CHECK(First == 100);
+	CHECK(Particles.Get<2>(101).IsEmpty());
+	CHECK(Particles.Get<3>(101) == 0.0);
+}
+
+TEST_CASE("System::Core::Containers::SoAArray::RemoveAtSwap", "[SmokeFilter][Core][Containers]")
+{
+	using namespace SoAArray::Test;
+
+	FParticleArray Particles;
+	AddParticles(Particles, 20);
+
+	// Removing a range moves the last elements of every column into the hole
+	Particles.RemoveAtSwap(2, 3, false);
+	REQUIRE(Particles.Num() == 17);
+	CHECK(Particles.Get<2>(2) == TEXT("17"));
+	CHECK(Particles.Get<2>(3) == TEXT("18"));
+	CHECK(Particles.Get<2>(4) == TEXT("19"));
+	CHECK(Particles.Get<3>(4) == 38.0);
+	CHECK(Particles.Get<2>(5) == TEXT("5"));
+
+	// Removing the tail moves nothing
+	Particles.RemoveAtSwap(15, 2);
+	REQUIRE(Particles.Num() == 15);
+	CHECK(Particles.Get<2>(14) == TEXT("14"));
+}
+
+TEST_CASE("System::Core::Containers::SoAArray::Capacity", "[SmokeFilter][Core][Containers]")
+{
+	using namespace SoAArray::Test;
+
+	FParticleArray Particles;
+	Particles.Reserve(37);
+	CHECK(Particles.Max() >= 37);
+	CHECK(Particles.Num() == 0);
+
+	AddParticles(Particles, 37);
+	Particles.Shrink();
+	CHECK(Particles.Max() == 37);
+	CHECK(IsColumnAligned(Particles.GetData<1>()));
+	CHECK(IsColumnAligned(Particles.GetData<2>()));
+	CHECK(IsColumnAligned(Particles.GetData<3>()));
+	CHECK(Particles.Get<2>(36) == TEXT("36"));
+
+	Particles.Reset();
+	CHECK(Particles.Num() == 0);
+	CHECK(Particles.Max() == 37);
+
+	Particles.Empty();
+	CHECK(Particles.Max() == 0);
+	CHECK(Particles.GetAllocatedSize() == 0);
+}
+
+TEST_CASE("System::Core::Containers::SoAArray::CopyAndMove", "[SmokeFilter][Core][Containers]")
+{
+	using namespace SoAArray::Test;
+
+	FParticleArray Particles;
+	AddParticles(Particles, 10);
+
+	FParticleArray Copy(Particles);
+	REQUIRE(Copy.Num() == 10);
+	CHECK(Copy.Get<2>(9) == TEXT("9"));
+	CHECK(Copy.GetData<2>() != Particles.GetData<2>());
+
+	FParticleArray Moved(MoveTemp(Copy));
+	CHECK(Copy.Num() == 0);
+	REQUIRE(Moved.Num() == 10);
+	CHECK(Moved.Get<2>(9) == TEXT("9"));
+
+	Copy = Moved;
+	CHECK(Copy.Num() == 10);
+	Moved = MoveTemp(Copy);
+	CHECK(Copy.Num() == 0);
+	CHECK(Moved.Get<3>(5) == 10.0);
+}
+
+TEST_CASE("System::Core::Containers::SoAArray::Views", "[SmokeFilter][Core][Containers]")
+{
+	using namespace SoAArray::Test;
+
+	FParticleArray Particles;
+	{
+		TStridedView<float> EmptyView = Particles.GetStridedView<0>(&FVector3f::Z);
+		CHECK(EmptyView.Num() == 0);
+	}
+
+	AddParticles(Particles, 8);
+
+	TArrayView<double> Doubles = Particles.GetView<3>();
+	REQUIRE(Doubles.Num() == 8);
+	CHECK(Doubles[7] == 14.0);
+
+	TStridedView<float> Z = Particles.GetStridedView<0>(&FVector3f::Z);
+	REQUIRE(Z.Num() == 8);
+	CHECK(Z[3] == -3.0f);
+	Z[3] = 42.0f;
+	CHECK(Particles.Get<0>(3).Z == 42.0f);
+
+	const FParticleArray& ConstParticles = Particles;
+	TStridedView<const uint8> Bytes = ConstParticles.GetStridedView<1>();
+	CHECK(Bytes[5] == 5);
+}
+
+#endif // WITH_TESTS
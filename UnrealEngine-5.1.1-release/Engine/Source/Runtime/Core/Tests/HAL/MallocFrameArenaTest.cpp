@@ -0,0 +1,83 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#if WITH_TESTS
+
+#include "HAL/MallocFrameArena.h"
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "Templates/AlignmentTemplates.h"
+
+#include "Tests/TestHarness.h"
+
+TEST_CASE("System::Core::HAL::FrameArena::Alignment", "[SmokeFilter][Core][HAL][FrameArena]")
+{
+	for (uint32 Alignment : { 8u, 16u, 64u, 256u })
+	{
+		void* Ptr = FFrameArena::Malloc(24, Alignment);
+		CHECK(IsAligned(Ptr, Alignment));
+		CHECK(FFrameArena::GetAllocationSize(Ptr) == 24);
+	}
+}
+
+TEST_CASE("System::Core::HAL::FrameArena::Realloc last allocation in place", "[SmokeFilter][Core][HAL][FrameArena]")
+{
+	uint8* Ptr = (uint8*)FFrameArena::Malloc(32);
+	for (int32 Index = 0; Index < 32; ++Index)
+	{
+		Ptr[Index] = (uint8)Index;
+	}
+
+	uint8* Grown = (uint8*)FFrameArena::Realloc(Ptr, 128);
+	CHECK(Grown == Ptr);
+	CHECK(FFrameArena::GetAllocationSize(Grown) == 128);
+
+	// Once another allocation follows, growing has to move but must preserve the contents.
+	void* Other = FFrameArena::Malloc(16);
+	uint8* Moved = (uint8*)FFrameArena::Realloc(Grown, 256);
+	CHECK(Moved != Grown);
+	CHECK(Moved != Other);
+	bool bContentsPreserved = true;
+	for (int32 Index = 0; Index < 32; ++Index)
+	{
+		bContentsPreserved &= Moved[Index] == (uint8)Index;
+	}
+	CHECK(bContentsPreserved);
+}
+
+TEST_CASE("System::Core::HAL::FrameArena::Free last allocation rewinds", "[SmokeFilter][Core][HAL][FrameArena]")
+{
+	void* First = FFrameArena::Malloc(64);
+	FFrameArena::Free(First);
+	void* Second = FFrameArena::Malloc(64);
+	CHECK(First == Second);
+}
+
+TEST_CASE("System::Core::HAL::FrameArena::Large allocations", "[SmokeFilter][Core][HAL][FrameArena]")
+{
+	const SIZE_T Size = 4 * 1024 * 1024;
+	uint8* Ptr = (uint8*)FFrameArena::Malloc(Size);
+	Ptr[0] = 1;
+	Ptr[Size - 1] = 2;
+	CHECK(FFrameArena::GetAllocationSize(Ptr) == Size);
+}
+
+TEST_CASE("System::Core::HAL::FrameArena::Containers", "[SmokeFilter][Core][HAL][FrameArena]")
+{
+	TArray<int32, FFrameArenaAllocator> Array;
+	for (int32 Index = 0; Index < 1000; ++Index)
+	{
+		Array.Add(Index);
+	}
+	CHECK(Array.Num() == 1000);
+	CHECK(Array[999] == 999);
+
+	TMap<int32, int32, FFrameArenaSetAllocator> Map;
+	for (int32 Index = 0; Index < 1000; ++Index)
+	{
+		Map.Add(Index, Index * 2);
+	}
+	CHECK(Map.Num() == 1000);
+	CHECK(Map.FindChecked(500) == 1000);
+}
+
+#endif // WITH_TESTS
@@ -0,0 +1,69 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#if WITH_LOW_LEVEL_TESTS
+
+#include "Hash/PerfectHash.h"
+
+#include "Containers/Array.h"
+#include "Containers/UnrealString.h"
+#include "TestHarness.h"
+
+namespace PerfectHashTest
+{
+static constexpr const char* Colors[] = { "Red", "Green", "Blue", "ECollisionChannel::ECC_WorldStatic", "ECollisionChannel::ECC_WorldDynamic" };
+static constexpr TStaticPerfectHash<UE_ARRAY_COUNT(Colors)> ColorHash(Colors);
+static_assert(ColorHash.IsValid(), "Unique keys must get a perfect hash");
+
+static constexpr const char* DuplicateKeys[] = { "Red", "RED" };
+static_assert(!TStaticPerfectHash<UE_ARRAY_COUNT(DuplicateKeys)>(DuplicateKeys).IsValid(), "Keys equal ignoring case can't be told apart");
+}
+
+TEST_CASE("Core::Hash::PerfectHash", "[Core][Hash][Smoke]")
+{
+	using namespace PerfectHashTest;
+
+	SECTION("Static")
+	{
+		for (int32 Index = 0; Index < UE_ARRAY_COUNT(Colors); ++Index)
+		{
+			CHECK(ColorHash.Find(FAnsiStringView(Colors[Index])) == Index);
+		}
+
+		CHECK(ColorHash.Find(TEXTVIEW("green")) == 1);
+		CHECK(ColorHash.Find(TEXTVIEW("green"), ESearchCase::CaseSensitive) == INDEX_NONE);
+		CHECK(ColorHash.Find(TEXTVIEW("Green"), ESearchCase::CaseSensitive) == 1);
+		CHECK(ColorHash.Find(TEXTVIEW("Gree")) == INDEX_NONE);
+		CHECK(ColorHash.Find(TEXTVIEW("Greens")) == INDEX_NONE);
+		CHECK(ColorHash.Find(TEXTVIEW("")) == INDEX_NONE);
+		CHECK(ColorHash.Find(TEXTVIEW("ECC_WorldStatic")) == INDEX_NONE);
+	}
+
+	SECTION("Runtime")
+	{
+		constexpr int32 NumKeys = 1000;
+		TArray<FString> Keys;
+		TArray<uint32> KeyHashes;
+		for (int32 Index = 0; Index < NumKeys; ++Index)
+		{
+			Keys.Add(FString::Printf(TEXT("EMyEnum::Value%d"), Index));
+			KeyHashes.Add(UE::PerfectHash::HashKey(*Keys.Last(), Keys.Last().Len()));
+		}
+
+		TArray<uint16> Seeds, Slots;
+		TArray<uint32> Scratch;
+		Seeds.SetNumUninitialized(UE::PerfectHash::GetNumBuckets(NumKeys));
+		Slots.SetNumUninitialized(UE::PerfectHash::GetNumSlots(NumKeys));
+		Scratch.SetNumUninitialized(UE::PerfectHash::GetBuildScratchSize(NumKeys));
+		REQUIRE(UE::PerfectHash::Build(KeyHashes.GetData(), NumKeys, Seeds.GetData(), Slots.GetData(), Scratch.GetData()));
+
+		const FPerfectHashTable Table{ Seeds.GetData(), Slots.GetData(), NumKeys };
+		bool bAllFound = true;
+		for (int32 Index = 0; Index < NumKeys; ++Index)
+		{
+			bAllFound &= Table.FindCandidate(FStringView(Keys[Index])) == Index;
+		}
+		CHECK(bAllFound);
+	}
+}
+
+#endif // WITH_LOW_LEVEL_TESTS
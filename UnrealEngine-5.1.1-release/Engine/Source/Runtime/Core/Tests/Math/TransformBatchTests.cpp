@@ -0,0 +1,126 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#if WITH_LOW_LEVEL_TESTS
+
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+#include "Math/TransformBatch.h"
+#include "TestHarness.h"
+
+namespace TransformBatchTests
+{
+FTransform MakeRandomTransform(FRandomStream& Random)
+{
+	const FQuat Rotation = FRotator(Random.FRandRange(-180.0, 180.0), Random.FRandRange(-180.0, 180.0), Random.FRandRange(-180.0, 180.0)).Quaternion();
+	const FVector Translation(Random.FRandRange(-1000.0, 1000.0), Random.FRandRange(-1000.0, 1000.0), Random.FRandRange(-1000.0, 1000.0));
+	const FVector Scale(Random.FRandRange(0.5, 2.0), Random.FRandRange(0.5, 2.0), Random.FRandRange(0.5, 2.0));
+	return FTransform(Rotation, Translation, Scale);
+}
+
+FVector MakeRandomPoint(FRandomStream& Random)
+{
+	return FVector(Random.FRandRange(-100.0, 100.0), Random.FRandRange(-100.0, 100.0), Random.FRandRange(-100.0, 100.0));
+}
+}
+
+TEST_CASE("Core::Math::TransformBatch::Smoke Test", "[Core][Math][Smoke]")
+{
+	using namespace TransformBatchTests;
+
+	FRandomStream Random(0x5eed);
+	constexpr int32 Num = 67;
+
+	SECTION("TransformPositions")
+	{
+		const FTransform Transform = MakeRandomTransform(Random);
+		TArray<FVector> Points;
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			Points.Add(MakeRandomPoint(Random));
+		}
+
+		TArray<FVector> Transformed;
+		Transformed.SetNumUninitialized(Num);
+		UE::Math::TransformPositions(Transform, Points, Transformed);
+
+		TArray<FVector> InPlace = Points;
+		UE::Math::TransformPositions(Transform, InPlace);
+
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			const FVector Expected = Transform.TransformPosition(Points[Index]);
+			CHECK(Transformed[Index].Equals(Expected, 1e-6));
+			CHECK(InPlace[Index].Equals(Expected, 1e-6));
+		}
+
+		const FTransform3f Transform3f(Transform);
+		const FVector3f Point3f(Points[0]);
+		FVector3f Transformed3f;
+		UE::Math::TransformPositions(Transform3f, MakeArrayView(&Point3f, 1), MakeArrayView(&Transformed3f, 1));
+		CHECK(Transformed3f.Equals(Transform3f.TransformPosition(Point3f), 1e-3f));
+	}
+
+	SECTION("ComposeTransforms")
+	{
+		TArray<FTransform> Children, Parents;
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			Children.Add(MakeRandomTransform(Random));
+			Parents.Add(MakeRandomTransform(Random));
+		}
+		// Negative scale takes the matrix path in FTransform::Multiply
+		Children[3].SetScale3D(FVector(-1.0, 1.0, 2.0));
+
+		TArray<FTransform> Composed;
+		Composed.SetNumUninitialized(Num);
+		UE::Math::ComposeTransforms(Children, Parents, Composed);
+
+		TArray<FTransform> ComposedWithParent;
+		ComposedWithParent.SetNumUninitialized(Num);
+		UE::Math::ComposeTransforms(Children, Parents[0], ComposedWithParent);
+
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			CHECK(Composed[Index].Equals(Children[Index] * Parents[Index], 1e-6));
+			CHECK(ComposedWithParent[Index].Equals(Children[Index] * Parents[0], 1e-6));
+		}
+	}
+
+	SECTION("InverseTransforms")
+	{
+		TArray<FTransform> Transforms;
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			Transforms.Add(MakeRandomTransform(Random));
+		}
+
+		TArray<FTransform> Inverted;
+		Inverted.SetNumUninitialized(Num);
+		UE::Math::InverseTransforms(Transforms, Inverted);
+
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			CHECK(Inverted[Index].Equals(Transforms[Index].Inverse(), 1e-6));
+		}
+	}
+
+	SECTION("ComputeBounds")
+	{
+		CHECK(!UE::Math::ComputeBounds(TArrayView<const FVector>()).IsValid);
+
+		TArray<FVector> Points;
+		FBox Expected(ForceInit);
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			Points.Add(MakeRandomPoint(Random));
+			Expected += Points.Last();
+		}
+
+		const FBox Bounds = UE::Math::ComputeBounds(Points);
+		CHECK(Bounds.IsValid);
+		CHECK(Bounds.Min == Expected.Min);
+		CHECK(Bounds.Max == Expected.Max);
+	}
+}
+
+#endif // WITH_LOW_LEVEL_TESTS
@@ -0,0 +1,96 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#if WITH_TESTS
+
+#include "UObject/NameTypes.h"
+#include "Containers/Array.h"
+#include "HAL/Thread.h"
+#include "Misc/StringBuilder.h"
+#include "Tests/Benchmark.h"
+
+#include "Tests/TestHarness.h"
+
+namespace NamePool
+{
+namespace Test
+{
+constexpr int32 NumStressThreads = 32;
+
+/**
+ * Every thread creates the same names in a different order, so most calls find a name another thread created
+ * while the rest race to create it. Returns the names created by each thread.
+ */
+TArray<TArray<FName>> CreateNamesConcurrently(const TCHAR* Prefix, int32 NumNames, int32 NumThreads)
+{
+	TArray<TArray<FName>> NamesPerThread;
+	NamesPerThread.SetNum(NumThreads);
+
+	TArray<FThread> Threads;
+	for (int32 ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+	{
+		Threads.Emplace(TEXT("NamePoolStress"), [Prefix, NumNames, NumThreads, ThreadIndex, &Names = NamesPerThread[ThreadIndex]]()
+		{
+			Names.SetNum(NumNames);
+			const int32 Offset = ThreadIndex * NumNames / NumThreads;
+			for (int32 Index = 0; Index < NumNames; ++Index)
+			{
+				const int32 NameIndex = (Index + Offset) % NumNames;
+				TStringBuilder<64> Builder;
+				Builder << Prefix << TEXT('_') << NameIndex;
+				Names[NameIndex] = FName(Builder.Len(), Builder.GetData(), NAME_NO_NUMBER_INTERNAL);
+			}
+		});
+	}
+
+	for (FThread& Thread : Threads)
+	{
+		Thread.Join();
+	}
+
+	return NamesPerThread;
+}
+
+void BenchmarkConcurrentCreation()
+{
+	static int32 Run = 0;
+	TStringBuilder<64> Prefix;
+	Prefix << TEXT("NamePoolBenchmark") << Run++;
+	CreateNamesConcurrently(*Prefix, 100'000, NumStressThreads);
+}
+
+void BenchmarkConcurrentFind()
+{
+	static const TArray<TArray<FName>> Warmup = CreateNamesConcurrently(TEXT("NamePoolFindBenchmark"), 100'000, 1);
+	CreateNamesConcurrently(TEXT("NamePoolFindBenchmark"), 100'000, NumStressThreads);
+}
+}
+
+TEST_CASE("System::Core::UObject::NamePool::Concurrent creation", "[SmokeFilter][Core][UObject][NamePool]")
+{
+	const int32 NumNames = 4096;
+	TArray<TArray<FName>> NamesPerThread = Test::CreateNamesConcurrently(TEXT("NamePoolStressTest"), NumNames, Test::NumStressThreads);
+
+	// All threads must agree on every name, whichever of them created it
+	bool bAllEqual = true;
+	for (const TArray<FName>& Names : NamesPerThread)
+	{
+		for (int32 Index = 0; Index < NumNames; ++Index)
+		{
+			bAllEqual &= Names[Index].IsEqual(NamesPerThread[0][Index], ENameCase::CaseSensitive, true);
+		}
+	}
+	CHECK(bAllEqual);
+
+	TStringBuilder<64> Builder;
+	Builder << TEXT("NamePoolStressTest_") << (NumNames - 1);
+	CHECK(FName(Builder.Len(), Builder.GetData(), NAME_NO_NUMBER_INTERNAL, FNAME_Find) == NamesPerThread[0].Last());
+}
+
+TEST_CASE("System::Core::UObject::NamePool::Benchmark", "[.][Perf][Core][UObject][NamePool]")
+{
+	UE_BENCHMARK(5, Test::BenchmarkConcurrentCreation);
+	UE_BENCHMARK(5, Test::BenchmarkConcurrentFind);
+}
+} // namespace NamePool
+
+#endif // WITH_TESTS
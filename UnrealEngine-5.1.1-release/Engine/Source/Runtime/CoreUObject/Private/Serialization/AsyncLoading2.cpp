@@ -338,6 +338,14 @@ static FAutoConsoleVariableRef CVarGOnlyProcessRequiredPackagesWhenSyncLoading(
 	ECVF_Default
 );
 
+static int32 GParallelPostLoadMinBatchSize = 0;
+static FAutoConsoleVariableRef CVarGParallelPostLoadMinBatchSize(
+	TEXT("s.ParallelPostLoadMinBatchSize"),
+	GParallelPostLoadMinBatchSize,
+	TEXT("Minimum number of thread safe objects in an export bundle to PostLoad them in parallel on task workers instead of the async loading thread, 0 to disable."),
+	ECVF_Default
+);
+
 CSV_DECLARE_CATEGORY_MODULE_EXTERN(CORE_API, Basic);
 CSV_DECLARE_CATEGORY_MODULE_EXTERN(CORE_API, FileIO);
 
@@ -346,6 +354,11 @@ TRACE_DECLARE_INT_COUNTER(AsyncLoadingLoadingPackages, TEXT("AsyncLoading/Packag
 TRACE_DECLARE_INT_COUNTER(AsyncLoadingPackagesWithRemainingWork, TEXT("AsyncLoading/PackagesWithRemainingWork"));
 TRACE_DECLARE_INT_COUNTER(AsyncLoadingPendingIoRequests, TEXT("AsyncLoading/PendingIoRequests"));
 TRACE_DECLARE_MEMORY_COUNTER(AsyncLoadingTotalLoaded, TEXT("AsyncLoading/TotalLoaded"));
+TRACE_DECLARE_INT_COUNTER(AsyncLoadingCreatedExports, TEXT("AsyncLoading/ExportsCreated"));
+TRACE_DECLARE_INT_COUNTER(AsyncLoadingSerializedExports, TEXT("AsyncLoading/ExportsSerialized"));
+TRACE_DECLARE_INT_COUNTER(AsyncLoadingPostLoadsOnAsyncLoadingThread, TEXT("AsyncLoading/PostLoadsOnAsyncLoadingThread"));
+TRACE_DECLARE_INT_COUNTER(AsyncLoadingPostLoadsOnWorkers, TEXT("AsyncLoading/PostLoadsOnWorkers"));
+TRACE_DECLARE_INT_COUNTER(AsyncLoadingDeferredPostLoads, TEXT("AsyncLoading/DeferredPostLoads"));
 
 struct FAsyncPackage2;
 class FAsyncLoadingThread2;
@@ -5256,6 +5269,14 @@ EEventLoadNodeExecutionResult FAsyncPackage2::Event_ProcessExportBundle(FAsyncLo
 			}
 		}
 
+		int32 CreatedExportsCount = 0;
+		int32 SerializedExportsCount = 0;
+		ON_SCOPE_EXIT
+		{
+			TRACE_COUNTER_ADD(AsyncLoadingCreatedExports, CreatedExportsCount);
+			TRACE_COUNTER_ADD(AsyncLoadingSerializedExports, SerializedExportsCount);
+		};
+
 		while (Package->ExportBundleEntryIndex < int32(ExportBundle->EntryCount))
 		{
 			const FExportBundleEntry& BundleEntry = HeaderData->ExportBundleEntries[ExportBundle->FirstEntryIndex + Package->ExportBundleEntryIndex];
@@ -5270,6 +5291,7 @@ EEventLoadNodeExecutionResult FAsyncPackage2::Event_ProcessExportBundle(FAsyncLo
 			if (BundleEntry.CommandType == FExportBundleEntry::ExportCommandType_Create)
 			{
 				Package->EventDrivenCreateExport(*HeaderData, Exports, BundleEntry.LocalExportIndex);
+				++CreatedExportsCount;
 			}
 			else
 			{
@@ -5294,6 +5316,10 @@ EEventLoadNodeExecutionResult FAsyncPackage2::Event_ProcessExportBundle(FAsyncLo
 				{
 					Ar.Skip(CookedSerialSize);
 				}
+				else
+				{
+					++SerializedExportsCount;
+				}
 				UE_ASYNC_PACKAGE_CLOG(
 					CookedSerialSize != uint64(Ar.Tell() - Pos), Fatal, Package->Desc, TEXT("ObjectSerializationError"),
 					TEXT("%s: Serial size mismatch: Expected read size %d, Actual read size %d"),
@@ -5930,6 +5956,62 @@ void FAsyncPackage2::ConditionalFinishLoading(FAsyncLoadingThreadState2& ThreadS
 		});
 }
 
+/**
+ * Thread safe objects can be PostLoaded on task workers if everything ConditionalPostLoad routes to first is PostLoaded already,
+ * so objects that are PostLoaded in parallel don't PostLoad each other.
+ */
+static bool CanPostLoadOnWorker(UObject* Object)
+{
+	if (!Object->HasAnyFlags(RF_NeedPostLoad) || Object->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject) || Object->IsA<UClass>() || !Object->IsPostLoadThreadSafe() || !Object->IsReadyForAsyncPostLoad())
+	{
+		return false;
+	}
+	for (UObject* Outer = Object->GetOuter(); Outer; Outer = Outer->GetOuter())
+	{
+		if (Outer->HasAnyFlags(RF_NeedPostLoad))
+		{
+			return false;
+		}
+	}
+	UObject* Archetype = Object->GetArchetype();
+	return !Archetype || !Archetype->HasAnyFlags(RF_NeedPostLoad);
+}
+
+/** PostLoads the objects of an export bundle that can be PostLoaded on task workers, if there are at least MinBatchSize of them */
+static int32 PostLoadExportBundleOnWorkers(const FAsyncPackageHeaderData& HeaderData, const FExportBundleHeader& ExportBundle, TArrayView<FExportObject> Exports, int32 MinBatchSize)
+{
+	TArray<UObject*, TInlineAllocator<64>> Objects;
+	for (uint32 EntryIndex = 0; EntryIndex < ExportBundle.EntryCount; ++EntryIndex)
+	{
+		const FExportBundleEntry& BundleEntry = HeaderData.ExportBundleEntries[ExportBundle.FirstEntryIndex + EntryIndex];
+		if (BundleEntry.CommandType != FExportBundleEntry::ExportCommandType_Serialize)
+		{
+			continue;
+		}
+		const FExportObject& Export = Exports[BundleEntry.LocalExportIndex];
+		if (!(Export.bFiltered | Export.bExportLoadFailed) && CanPostLoadOnWorker(Export.Object))
+		{
+			Objects.Add(Export.Object);
+		}
+	}
+	if (Objects.Num() < MinBatchSize)
+	{
+		return 0;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(PostLoadOnWorkers);
+	ParallelFor(TEXT("PostLoadOnWorkers.PF"), Objects.Num(), 1, [&Objects](int32 Index)
+	{
+		UObject* Object = Objects[Index];
+		FUObjectThreadContext& ThreadContext = FUObjectThreadContext::Get();
+		TGuardValue<bool> GuardIsRoutingPostLoad(ThreadContext.IsRoutingPostLoad, true);
+		TGuardValue<UObject*> GuardCurrentlyPostLoadedObject(ThreadContext.CurrentlyPostLoadedObjectByALT, Object);
+		TRACE_LOADTIME_POSTLOAD_EXPORT_SCOPE(Object);
+		Object->ConditionalPostLoad();
+	});
+	return Objects.Num();
+}
+
 EEventLoadNodeExecutionResult FAsyncPackage2::Event_PostLoadExportBundle(FAsyncLoadingThreadState2& ThreadState, FAsyncPackage2* Package, int32 InExportBundleIndex)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(Event_PostLoad);
@@ -6010,6 +6092,14 @@ EEventLoadNodeExecutionResult FAsyncPackage2::Event_PostLoadExportBundle(FAsyncL
 		const TArrayView<FExportObject>& Exports = Package->Data.Exports;
 #endif
 
+		if (GParallelPostLoadMinBatchSize > 0 && bIsMultithreaded && bAsyncPostLoadEnabled && Package->ExportBundleEntryIndex == 0)
+		{
+			// Objects that are PostLoaded on workers are skipped below since they don't need PostLoad anymore
+			const int32 PostLoadsOnWorkersCount = PostLoadExportBundleOnWorkers(*HeaderData, *ExportBundle, Exports, GParallelPostLoadMinBatchSize);
+			TRACE_COUNTER_ADD(AsyncLoadingPostLoadsOnWorkers, PostLoadsOnWorkersCount);
+		}
+
+		int32 PostLoadsCount = 0;
 		while (Package->ExportBundleEntryIndex < int32(ExportBundle->EntryCount))
 		{
 			const FExportBundleEntry& BundleEntry = HeaderData->ExportBundleEntries[ExportBundle->FirstEntryIndex + Package->ExportBundleEntryIndex];
@@ -6046,11 +6136,13 @@ EEventLoadNodeExecutionResult FAsyncPackage2::Event_PostLoadExportBundle(FAsyncL
 							Object->ConditionalPostLoad();
 						}
 						ThreadContext.CurrentlyPostLoadedObjectByALT = nullptr;
+						++PostLoadsCount;
 					}
 				} while (false);
 			}
 			++Package->ExportBundleEntryIndex;
 		}
+		TRACE_COUNTER_ADD(AsyncLoadingPostLoadsOnAsyncLoadingThread, PostLoadsCount);
 
 		// End async loading, simulates EndLoad
 		Package->EndAsyncLoad();
@@ -6138,6 +6230,7 @@ EEventLoadNodeExecutionResult FAsyncPackage2::Event_DeferredPostLoadExportBundle
 		const TArrayView<FExportObject>& Exports = Package->Data.Exports;
 #endif
 
+		int32 DeferredPostLoadsCount = 0;
 		while (Package->ExportBundleEntryIndex < int32(ExportBundle->EntryCount))
 		{
 			const FExportBundleEntry& BundleEntry = HeaderData->ExportBundleEntries[ExportBundle->FirstEntryIndex + Package->ExportBundleEntryIndex];
@@ -6169,11 +6262,13 @@ EEventLoadNodeExecutionResult FAsyncPackage2::Event_DeferredPostLoadExportBundle
 							Object->ConditionalPostLoad();
 						}
 						PackageScope.ThreadContext.CurrentlyPostLoadedObjectByALT = nullptr;
+						++DeferredPostLoadsCount;
 					}
 				} while (false);
 			}
 			++Package->ExportBundleEntryIndex;
 		}
+		TRACE_COUNTER_ADD(AsyncLoadingDeferredPostLoads, DeferredPostLoadsCount);
 	}
 
 	if (LoadingState == EEventLoadNodeExecutionResult::Timeout)
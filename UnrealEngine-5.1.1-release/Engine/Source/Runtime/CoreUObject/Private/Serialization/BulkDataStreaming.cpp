@@ -1594,6 +1594,44 @@ FBulkDataBatchRequest::FBatchBuilder& FBulkDataBatchRequest::FBatchBuilder::Read
 	return *this;
 }
 
+FBulkDataBatchRequest::FBatchBuilder& FBulkDataBatchRequest::FBatchBuilder::ReadMapped(
+	const FBulkData& BulkData,
+	uint64 Offset,
+	uint64 Size,
+	EAsyncIOPriorityAndFlags Priority,
+	FIoBuffer& Dst,
+	FBulkDataBatchReadRequest* OutRequest)
+{
+	check(Size == MAX_uint64 || Size <= uint64(BulkData.GetBulkDataSize()));
+
+	const uint64 ReadOffset = BulkData.GetBulkDataOffsetInFile() + Offset;
+	const uint64 ReadSize	= FMath::Min(uint64(BulkData.GetBulkDataSize()), Size);
+
+	check(BatchMax == -1 || BatchCount < BatchMax);
+	check(Dst.GetSize() == 0);
+
+	FIoReadOptions ReadOptions(ReadOffset, ReadSize);
+	ReadOptions.SetFlags(EIoReadOptionsFlags::AllowMemoryMapping);
+
+	GetBatch(BulkData).Read(
+		BulkData.BulkMeta,
+		BulkData.BulkChunkId,
+		ReadOptions,
+		Priority,
+		[Dst = &Dst](TIoStatusOr<FIoBuffer> Status)
+		{
+			if (Status.IsOk())
+			{
+				*Dst = Status.ConsumeValueOrDie();
+			}
+		},
+		OutRequest);
+
+	++BatchCount;
+
+	return *this;
+}
+
 FBulkDataRequest::EStatus FBulkDataBatchRequest::FBatchBuilder::Issue(FBulkDataBatchRequest& OutRequest)
 {
 	if (NumLoaded > 0 && BatchCount == 0)
@@ -147,6 +147,42 @@ public:
 		return Property->Identical(GetValue(Data), GetDefaultValue(Defaults), PortFlags);
 	}
 
+#if CACHE_UNVERSIONED_PROPERTY_SCHEMA
+	// Number of integer values starting with this one that are adjacent in memory and can be serialized as one block
+	uint32 GetIntegerRunNum() const
+	{
+		return IntegerRunNum;
+	}
+
+	// Serializes the values of this and the subsequent adjacent integer serializers, only valid if the archive doesn't swap bytes
+	FORCEINLINE void SerializeIntegerRun(FStructuredArchive::FSlot Slot, uint8* Data, uint32 Num) const
+	{
+		check(Num <= IntegerRunNum);
+		const FUnversionedPropertySerializer& Last = this[Num - 1];
+		Slot.Serialize(GetValue(Data), Last.Offset + GetSizeOf(Last.IntType) - Offset);
+	}
+
+	// Builds the integer runs of a schema, called once when the schema is created
+	static void InitIntegerRuns(FUnversionedPropertySerializer* Serializers, uint32 Num)
+	{
+		for (uint32 Idx = Num; Idx-- > 0; )
+		{
+			FUnversionedPropertySerializer& Serializer = Serializers[Idx];
+			const bool bCanRun = Serializer.bSerializeAsInteger && GetSizeOf(Serializer.IntType) == (uint32)Serializer.Property->ElementSize;
+			Serializer.IntegerRunNum = bCanRun ? 1 : 0;
+
+			if (bCanRun && Idx + 1 < Num)
+			{
+				const FUnversionedPropertySerializer& Next = Serializers[Idx + 1];
+				if (Next.IntegerRunNum > 0 && Next.IntegerRunNum < MAX_uint8 && Next.Offset == Serializer.Offset + GetSizeOf(Serializer.IntType))
+				{
+					Serializer.IntegerRunNum = Next.IntegerRunNum + 1;
+				}
+			}
+		}
+	}
+#endif
+
 private:
 	enum class EIntegerType : uint8 { Uint8, Uint16, Uint32, Uint64 };
 
@@ -274,11 +310,100 @@ private:
 	bool bSerializeAsInteger;
 	EIntegerType IntType;
 	uint8 FastZeroIntNum;
+	uint8 IntegerRunNum = 0;
 #else
 	uint32 ArrayIndex;
 #endif
 };
 
+// Calculates a non-zero hash of the memory layout of a struct whose instances can be saved and loaded as raw memory,
+// or returns 0 if any property needs to be serialized on its own. Such structs only contain numeric, enum and native bool
+// properties or nested structs that can be bulk serialized, and every byte that isn't alignment padding belongs to a property.
+static uint32 CalculateBulkStructLayout(const UStruct* Struct, bool bSkipEditorOnly)
+{
+#if PLATFORM_LITTLE_ENDIAN
+	const UScriptStruct* ScriptStruct = Cast<const UScriptStruct>(Struct);
+	if (!ScriptStruct || !Struct->PropertyLink || ScriptStruct->UseNativeSerialization() || (ScriptStruct->StructFlags & STRUCT_PostSerializeNative))
+	{
+		return 0;
+	}
+
+	static constexpr EPropertyFlags SkippedPropertyFlags = CPF_Transient | CPF_DuplicateTransient | CPF_NonPIEDuplicateTransient | CPF_NonTransactional | CPF_Deprecated | CPF_DevelopmentAssets | CPF_SkipSerialization;
+
+	struct FRange
+	{
+		int32 Offset;
+		int32 Size;
+		int32 Alignment;
+	};
+	TArray<FRange, TInlineAllocator<32>> Ranges;
+
+	const int32 StructSize = Struct->GetPropertiesSize();
+	uint32 Layout = FCrc::MemCrc32(&StructSize, sizeof(StructSize));
+	for (FProperty* Property = Struct->PropertyLink; Property; Property = Property->PropertyLinkNext)
+	{
+		if (Property->HasAnyPropertyFlags(SkippedPropertyFlags))
+		{
+			return 0;
+		}
+#if WITH_EDITORONLY_DATA
+		if (bSkipEditorOnly && Property->IsEditorOnlyProperty())
+		{
+			return 0;
+		}
+#endif
+
+		uint32 InnerLayout = 0;
+		uint64 CastFlags = Property->GetClass()->GetCastFlags();
+		if ((CastFlags & CASTCLASS_FBoolProperty) != 0)
+		{
+			if (!static_cast<const FBoolProperty*>(Property)->IsNativeBool())
+			{
+				return 0;
+			}
+		}
+		else if ((CastFlags & CASTCLASS_FStructProperty) != 0)
+		{
+			InnerLayout = GetUnversionedBulkStructLayout(static_cast<const FStructProperty*>(Property)->Struct, bSkipEditorOnly);
+			if (InnerLayout == 0)
+			{
+				return 0;
+			}
+		}
+		else if ((CastFlags & (CASTCLASS_FNumericProperty | CASTCLASS_FEnumProperty)) == 0)
+		{
+			return 0;
+		}
+
+		FRange Range = { Property->GetOffset_ForInternal(), Property->ElementSize * Property->ArrayDim, Property->GetMinAlignment() };
+		Ranges.Add(Range);
+
+		Layout = FCrc::MemCrc32(&Range, sizeof(Range), Layout);
+		Layout = FCrc::MemCrc32(&InnerLayout, sizeof(InnerLayout), Layout);
+	}
+
+	// Reject non-reflected members, they would be copied too
+	Ranges.Sort([](const FRange& A, const FRange& B) { return A.Offset < B.Offset; });
+	int32 End = 0;
+	for (const FRange& Range : Ranges)
+	{
+		if (Range.Offset < End || Range.Offset - End >= Range.Alignment)
+		{
+			return 0;
+		}
+		End = Range.Offset + Range.Size;
+	}
+	if (StructSize - End >= Struct->GetMinAlignment())
+	{
+		return 0;
+	}
+
+	return Layout != 0 ? Layout : 1;
+#else
+	return 0;
+#endif
+}
+
 #if CACHE_UNVERSIONED_PROPERTY_SCHEMA
 
 // Serialization is based on indices into this property array
@@ -287,6 +412,7 @@ struct FUnversionedStructSchema
 #if WITH_EDITORONLY_DATA
 	FBlake3Hash SchemaHash;
 #endif
+	uint32 BulkStructLayout;
 	uint32 Num;
 	FUnversionedPropertySerializer Serializers[0];
 
@@ -324,8 +450,10 @@ struct FUnversionedStructSchema
 		}
 		Schema->SchemaHash = HashBuilder.Finalize();
 #endif
+		Schema->BulkStructLayout = CalculateBulkStructLayout(Struct, bSkipEditorOnly);
 		Schema->Num = Serializers.Num();
 		FMemory::Memcpy(Schema->Serializers, Serializers.GetData(), Serializers.Num() * sizeof(FUnversionedPropertySerializer));
+		FUnversionedPropertySerializer::InitIntegerRuns(Schema->Serializers, Schema->Num);
 
 		return Schema;
 	}
@@ -681,6 +809,20 @@ public:
 			return !FragmentIt->bHasAnyZeroes || !ZeroMask[ZeroMaskIndex];
 		}
 
+#if CACHE_UNVERSIONED_PROPERTY_SCHEMA
+		// Number of subsequent non-zero values whose serializers are adjacent in the schema, at least 1 if IsNonZero()
+		uint32 GetNonZeroRunNum() const
+		{
+			return FragmentIt->bHasAnyZeroes ? 1 : RemainingFragmentValues;
+		}
+
+		const FUnversionedPropertySerializer& GetSerializerRef() const
+		{
+			check(SchemaIt != SchemaEnd);
+			return *SchemaIt;
+		}
+#endif
+
 	private:
 		FUnversionedSchemaIterator SchemaIt;
 		const FZeroMask& ZeroMask;
@@ -824,6 +966,15 @@ bool CanUseUnversionedPropertySerialization(const ITargetPlatform* Target)
 	return bTargetValue;
 }
 
+uint32 GetUnversionedBulkStructLayout(const UStruct* Struct, bool bSkipEditorOnly)
+{
+#if CACHE_UNVERSIONED_PROPERTY_SCHEMA
+	return GetOrCreateUnversionedSchema(Struct, bSkipEditorOnly).BulkStructLayout;
+#else
+	return CalculateBulkStructLayout(Struct, bSkipEditorOnly);
+#endif
+}
+
 void DestroyUnversionedSchema(const UStruct* Struct)
 {
 #if CACHE_UNVERSIONED_PROPERTY_SCHEMA
@@ -842,6 +993,32 @@ static bool SkipEditorOnlyFields(FArchive& Ar) { return Ar.IsFilterEditorOnly();
 static constexpr bool SkipEditorOnlyFields(FArchive& Ar) { return true; }
 #endif
 
+#if CACHE_UNVERSIONED_PROPERTY_SCHEMA
+// Adjacent integer values are serialized as one block when that produces the same bytes as serializing them one by one
+static bool CanSerializeIntegerRuns(FArchive& Ar)
+{
+	return !Ar.IsByteSwapping();
+}
+
+// Serializes a run of adjacent non-zero integer values and leaves the iterator at the last one, returns false if there is no run
+static FORCEINLINE bool TrySerializeIntegerRun(FUnversionedHeader::FIterator& It, FStructuredArchive::FStream& ValueStream, uint8* Data)
+{
+	const FUnversionedPropertySerializer& Serializer = It.GetSerializerRef();
+	const uint32 RunNum = FMath::Min(Serializer.GetIntegerRunNum(), It.GetNonZeroRunNum());
+	if (RunNum < 2 || !It.IsNonZero())
+	{
+		return false;
+	}
+
+	Serializer.SerializeIntegerRun(ValueStream.EnterElement(), Data, RunNum);
+	for (uint32 Idx = 1; Idx < RunNum; ++Idx)
+	{
+		It.Next();
+	}
+	return true;
+}
+#endif
+
 void SerializeUnversionedProperties(const UStruct* Struct, FStructuredArchive::FSlot Slot, uint8* Data, UStruct* DefaultsStruct, uint8* DefaultsData)
 {
 	FArchive& UnderlyingArchive = Slot.GetUnderlyingArchive();
@@ -863,8 +1040,18 @@ void SerializeUnversionedProperties(const UStruct* Struct, FStructuredArchive::F
 				FDefaultStruct Defaults(DefaultsData, DefaultsStruct);
 
 				FStructuredArchive::FStream ValueStream = StructRecord.EnterStream(TEXT("Values"));
+#if CACHE_UNVERSIONED_PROPERTY_SCHEMA
+				const bool bCanSerializeIntegerRuns = CanSerializeIntegerRuns(UnderlyingArchive);
+#endif
 				for (FUnversionedHeader::FIterator It(Header, Schema); It; It.Next())
 				{
+#if CACHE_UNVERSIONED_PROPERTY_SCHEMA
+					if (bCanSerializeIntegerRuns && TrySerializeIntegerRun(It, ValueStream, Data))
+					{
+						continue;
+					}
+#endif
+
 					if (It.IsNonZero())
 					{
 #if WITH_EDITOR // Skip this scope to save time in the runtime; it is only needed for reference collection in editor
@@ -920,8 +1107,18 @@ void SerializeUnversionedProperties(const UStruct* Struct, FStructuredArchive::F
 		if (Header.HasNonZeroValues())
 		{
 			FStructuredArchive::FStream ValueStream = StructRecord.EnterStream(TEXT("Values"));
+#if CACHE_UNVERSIONED_PROPERTY_SCHEMA
+			const bool bCanSerializeIntegerRuns = CanSerializeIntegerRuns(UnderlyingArchive);
+#endif
 			for (FUnversionedHeader::FIterator It(Header, Schema); It; It.Next())
 			{
+#if CACHE_UNVERSIONED_PROPERTY_SCHEMA
+				if (bCanSerializeIntegerRuns && TrySerializeIntegerRun(It, ValueStream, Data))
+				{
+					continue;
+				}
+#endif
+
 				if (It.IsNonZero())
 				{
 					FSerializedPropertyScope SerializedProperty(UnderlyingArchive, It.GetSerializer().GetProperty());
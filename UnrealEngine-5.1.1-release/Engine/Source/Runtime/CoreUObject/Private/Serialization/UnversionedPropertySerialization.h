@@ -12,6 +12,12 @@ bool CanUseUnversionedPropertySerialization(const ITargetPlatform* Target);
 // Serialize sparse unversioned properties for a particular struct
 void SerializeUnversionedProperties(const UStruct* Struct, FStructuredArchive::FSlot Slot, uint8* Data, UStruct* DefaultsStruct, uint8* Defaults);
 
+/**
+ * Returns a non-zero hash of the memory layout if instances of Struct can be serialized as raw memory, e.g. in arrays, or 0 otherwise.
+ * The hash is saved with bulk serialized data and must match when it's loaded.
+ */
+uint32 GetUnversionedBulkStructLayout(const UStruct* Struct, bool bSkipEditorOnly);
+
 void DestroyUnversionedSchema(const UStruct* Struct);
 
 #if WITH_EDITORONLY_DATA
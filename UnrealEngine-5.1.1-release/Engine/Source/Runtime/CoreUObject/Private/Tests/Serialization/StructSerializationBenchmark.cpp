@@ -0,0 +1,156 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "HAL/PlatformTime.h"
+#include "Math/InterpCurvePoint.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/StructuredArchiveAdapters.h"
+#include "Serialization/UnversionedPropertySerialization.h"
+#include "UObject/Class.h"
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace UE::Serialization
+{
+
+constexpr const uint32 BenchmarkTestFlags = EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter;
+
+constexpr int32 BenchmarkNumObjects = 100000;
+
+/** Serializes BenchmarkNumObjects instances of a struct with SerializeBin() or unversioned property serialization and reports objects/s */
+class FStructSerializationBenchmark
+{
+public:
+	FStructSerializationBenchmark(FAutomationTestBase& InTest, UScriptStruct* InStruct)
+		: Test(InTest)
+		, Struct(InStruct)
+	{
+		const int32 Stride = Struct->GetStructureSize();
+		Source.SetNumZeroed(BenchmarkNumObjects * Stride);
+		Loaded.SetNumZeroed(BenchmarkNumObjects * Stride);
+		for (int32 Idx = 0; Idx < BenchmarkNumObjects; ++Idx)
+		{
+			uint8* Data = Source.GetData() + Idx * Stride;
+			Struct->InitializeStruct(Data);
+			Struct->InitializeStruct(Loaded.GetData() + Idx * Stride);
+
+			// Fill numeric properties with non-zero values so unversioned serialization can't skip them
+			for (TFieldIterator<FNumericProperty> It(Struct); It; ++It)
+			{
+				if (It->IsInteger() && !It->IsEnum())
+				{
+					It->SetIntPropertyValue(It->ContainerPtrToValuePtr<void>(Data), (uint64)(Idx + 1));
+				}
+				else if (It->IsFloatingPoint())
+				{
+					It->SetFloatingPointPropertyValue(It->ContainerPtrToValuePtr<void>(Data), Idx + 0.5);
+				}
+			}
+		}
+	}
+
+	~FStructSerializationBenchmark()
+	{
+		const int32 Stride = Struct->GetStructureSize();
+		for (int32 Idx = 0; Idx < BenchmarkNumObjects; ++Idx)
+		{
+			Struct->DestroyStruct(Source.GetData() + Idx * Stride);
+			Struct->DestroyStruct(Loaded.GetData() + Idx * Stride);
+		}
+	}
+
+	bool Run(bool bUnversioned)
+	{
+		const int32 Stride = Struct->GetStructureSize();
+		const TCHAR* Path = bUnversioned ? TEXT("unversioned") : TEXT("SerializeBin");
+
+		TArray<uint8> Bytes;
+		double SaveSeconds = 0.0;
+		{
+			FMemoryWriter Writer(Bytes);
+			Writer.SetUseUnversionedPropertySerialization(bUnversioned);
+			FStructuredArchiveFromArchive Adapter(Writer);
+			FStructuredArchive::FStream Stream = Adapter.GetSlot().EnterStream();
+
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 Idx = 0; Idx < BenchmarkNumObjects; ++Idx)
+			{
+				Serialize(Stream.EnterElement(), Source.GetData() + Idx * Stride, bUnversioned);
+			}
+			SaveSeconds = FPlatformTime::Seconds() - StartTime;
+		}
+
+		double LoadSeconds = 0.0;
+		{
+			FMemoryReader Reader(Bytes);
+			Reader.SetUseUnversionedPropertySerialization(bUnversioned);
+			FStructuredArchiveFromArchive Adapter(Reader);
+			FStructuredArchive::FStream Stream = Adapter.GetSlot().EnterStream();
+
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 Idx = 0; Idx < BenchmarkNumObjects; ++Idx)
+			{
+				Serialize(Stream.EnterElement(), Loaded.GetData() + Idx * Stride, bUnversioned);
+			}
+			LoadSeconds = FPlatformTime::Seconds() - StartTime;
+		}
+
+		for (int32 Idx = 0; Idx < BenchmarkNumObjects; ++Idx)
+		{
+			if (!Struct->CompareScriptStruct(Source.GetData() + Idx * Stride, Loaded.GetData() + Idx * Stride, 0))
+			{
+				Test.AddError(FString::Printf(TEXT("%s: %s instance %d doesn't match after a round trip"), Path, *Struct->GetName(), Idx));
+				return false;
+			}
+		}
+
+		Test.AddInfo(FString::Printf(TEXT("%s: %s, %d bytes, save %.0f objects/s, load %.0f objects/s"), Path, *Struct->GetName(), Bytes.Num(),
+			BenchmarkNumObjects / FMath::Max(SaveSeconds, UE_DOUBLE_SMALL_NUMBER), BenchmarkNumObjects / FMath::Max(LoadSeconds, UE_DOUBLE_SMALL_NUMBER)));
+		return true;
+	}
+
+private:
+	void Serialize(FStructuredArchive::FSlot Slot, uint8* Data, bool bUnversioned) const
+	{
+		if (bUnversioned)
+		{
+			SerializeUnversionedProperties(Struct, Slot, Data, nullptr, nullptr);
+		}
+		else
+		{
+			Struct->SerializeBin(Slot, Data);
+		}
+	}
+
+	FAutomationTestBase& Test;
+	UScriptStruct* Struct;
+	TArray<uint8> Source;
+	TArray<uint8> Loaded;
+};
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStructSerializationBenchmarkTest, TEXT("System.CoreUObject.Serialization.StructSerializationBenchmark"), BenchmarkTestFlags)
+bool FStructSerializationBenchmarkTest::RunTest(const FString& Parameters)
+{
+	UScriptStruct* Structs[] = { TBaseStructure<FLinearColor>::Get(), TBaseStructure<FIntVector>::Get(), TBaseStructure<FInterpCurvePointVector>::Get() };
+
+	// Loading unversioned properties asserts if it isn't enabled for the current platform
+	const bool bTestUnversioned = CanUseUnversionedPropertySerialization(nullptr);
+
+	for (UScriptStruct* Struct : Structs)
+	{
+		FStructSerializationBenchmark Benchmark(*this, Struct);
+		Benchmark.Run(/* bUnversioned */ false);
+		if (bTestUnversioned)
+		{
+			Benchmark.Run(/* bUnversioned */ true);
+		}
+	}
+
+	return true;
+}
+
+} // namespace UE::Serialization
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -754,8 +754,12 @@ void UStruct::PreloadChildren(FArchive& Ar)
 	}
 }
 
+static void DestroyBinarySerializationPlan(const UStruct* Struct);
+
 void UStruct::Link(FArchive& Ar, bool bRelinkExistingProperties)
 {
+	DestroyBinarySerializationPlan(this);
+
 	if (bRelinkExistingProperties)
 	{
 		// Preload everything before we calculate size, as the preload may end up recursively linking things
@@ -1068,6 +1072,100 @@ void UStruct::DestroyStruct(void* Dest, int32 ArrayDim) const
 	}
 }
 
+/**
+ * Flat list of serialization ops for UStruct::SerializeBin(). Runs of numeric properties that are adjacent in memory
+ * and in PropertyLink order are merged into one op that is serialized as a single block, all other properties are
+ * serialized on their own, nested structs and containers through their own SerializeItem() and plans.
+ */
+struct FBinarySerializationPlan
+{
+	struct FOp
+	{
+		FProperty* Property; // First property of the op
+		uint32 NumProperties;
+		uint32 Offset;
+		uint32 Size; // Bytes of all properties of a run, 0 for ops that serialize a single property
+	};
+
+	TArray<FOp> Ops;
+
+	static bool CanBeInRun(const FProperty* Property)
+	{
+		static constexpr EPropertyFlags SkipFlags = CPF_Transient | CPF_DuplicateTransient | CPF_NonPIEDuplicateTransient | CPF_NonTransactional | CPF_Deprecated | CPF_DevelopmentAssets | CPF_SkipSerialization;
+
+		// All numeric properties except TEnumAsByte, see FByteProperty::SerializeItem()
+		const uint64 CastFlags = Property->GetClass()->GetCastFlags();
+		if ((CastFlags & CASTCLASS_FNumericProperty) == 0 || ((CastFlags & CASTCLASS_FByteProperty) != 0 && static_cast<const FByteProperty*>(Property)->Enum))
+		{
+			return false;
+		}
+
+		return !Property->HasAnyPropertyFlags(SkipFlags);
+	}
+
+	explicit FBinarySerializationPlan(const UStruct* Struct)
+	{
+		for (FProperty* Property = Struct->PropertyLink; Property; Property = Property->PropertyLinkNext)
+		{
+			const uint32 Offset = Property->GetOffset_ForInternal();
+			const uint32 Size = Property->ElementSize * Property->ArrayDim;
+			if (CanBeInRun(Property))
+			{
+				if (Ops.Num() > 0 && Ops.Last().Size > 0 && Ops.Last().Offset + Ops.Last().Size == Offset)
+				{
+					++Ops.Last().NumProperties;
+					Ops.Last().Size += Size;
+					continue;
+				}
+
+				Ops.Add({ Property, 1, Offset, Size });
+			}
+			else
+			{
+				Ops.Add({ Property, 1, Offset, 0 });
+			}
+		}
+	}
+};
+
+static const FBinarySerializationPlan& GetOrCreateBinarySerializationPlan(const UStruct* Struct)
+{
+	if (const FBinarySerializationPlan* ExistingPlan = Struct->BinarySerializationPlan)
+	{
+		return *ExistingPlan;
+	}
+
+	FBinarySerializationPlan* CreatedPlan = new FBinarySerializationPlan(Struct);
+
+	void** CachedPlanPtr = reinterpret_cast<void**>(const_cast<FBinarySerializationPlan**>(&Struct->BinarySerializationPlan));
+	if (const FBinarySerializationPlan* ExistingPlan = reinterpret_cast<const FBinarySerializationPlan*>(FPlatformAtomics::InterlockedCompareExchangePointer(CachedPlanPtr, CreatedPlan, nullptr)))
+	{
+		delete CreatedPlan;
+		return *ExistingPlan;
+	}
+
+	return *CreatedPlan;
+}
+
+static void DestroyBinarySerializationPlan(const UStruct* Struct)
+{
+	delete Struct->BinarySerializationPlan;
+	Struct->BinarySerializationPlan = nullptr;
+}
+
+static bool ShouldSerializeRun(FArchive& Ar, const FBinarySerializationPlan::FOp& Op)
+{
+	FProperty* Property = Op.Property;
+	for (uint32 Idx = 0; Idx < Op.NumProperties; ++Idx, Property = Property->PropertyLinkNext)
+	{
+		if (Ar.ShouldSkipProperty(Property))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
 //
 // Serialize all of the class's data that belongs in a particular
 // bin and resides in Data.
@@ -1103,6 +1201,29 @@ void UStruct::SerializeBin( FStructuredArchive::FSlot Slot, void* Data ) const
 			}
 		}
 	}
+	else if (!UnderlyingArchive.IsTextFormat() && !UnderlyingArchive.IsByteSwapping() && !UnderlyingArchive.IsSaveGame())
+	{
+		// Runs produce the same bytes as serializing their properties one by one in binary archives that don't swap bytes
+		for (const FBinarySerializationPlan::FOp& Op : GetOrCreateBinarySerializationPlan(this).Ops)
+		{
+			if (Op.Size == 0)
+			{
+				Op.Property->SerializeBinProperty(PropertyStream.EnterElement(), Data);
+			}
+			else if (ShouldSerializeRun(UnderlyingArchive, Op))
+			{
+				PropertyStream.EnterElement().Serialize(static_cast<uint8*>(Data) + Op.Offset, Op.Size);
+			}
+			else
+			{
+				FProperty* Property = Op.Property;
+				for (uint32 Idx = 0; Idx < Op.NumProperties; ++Idx, Property = Property->PropertyLinkNext)
+				{
+					Property->SerializeBinProperty(PropertyStream.EnterElement(), Data);
+				}
+			}
+		}
+	}
 	else
 	{
 		for (FProperty* Property = PropertyLink; Property != NULL; Property = Property->PropertyLinkNext)
@@ -1623,6 +1744,7 @@ void UStruct::SerializeVersionedTaggedProperties(FStructuredArchive::FSlot Slot,
 void UStruct::FinishDestroy()
 {
 	DestroyUnversionedSchema(this);
+	DestroyBinarySerializationPlan(this);
 	Script.Empty();
 	Super::FinishDestroy();
 }
@@ -1651,6 +1773,7 @@ void UStruct::DestroyChildPropertiesAndResetPropertyLinks()
 	bHasAssetRegistrySearchableProperties = false;
 #endif // WITH_EDITORONLY_DATA
 	DestroyUnversionedSchema(this);
+	DestroyBinarySerializationPlan(this);
 }
 
 UStruct::~UStruct()
@@ -4134,6 +4257,8 @@ UObject* UClass::CreateDefaultObject()
 					InitOptions |= EObjectInitializerOptions::InitializeProperties;
 				}
 				(*ClassConstructor)(FObjectInitializer(ClassDefaultObject, ParentDefaultObject, InitOptions));
+				// All objects of this class are created after the CDO so this is where the class level destruction thread safety is sampled
+				bIsDestructionThreadSafe = ClassDefaultObject->IsDestructionThreadSafe();
 				if (GetOutermost()->HasAnyPackageFlags(PKG_CompiledIn) && !GetOutermost()->HasAnyPackageFlags(PKG_RuntimeGenerated))
 				{
 					TCHAR PackageName[FName::StringBufferSize];
@@ -5370,6 +5495,7 @@ void UClass::PurgeClass(bool bRecompilingOnLoad)
 #endif // WITH_EDITORONLY_DATA
 
 	DestroyUnversionedSchema(this);
+	DestroyBinarySerializationPlan(this);
 }
 
 #if WITH_EDITORONLY_DATA
@@ -5440,6 +5566,7 @@ UClass::UClass(const FObjectInitializer& ObjectInitializer)
 ,	ClassUnique(0)
 ,	bCooked(false)
 ,	bLayoutChanging(false)
+,	bIsDestructionThreadSafe(false)
 ,	ClassFlags(CLASS_None)
 ,	ClassCastFlags(CASTCLASS_None)
 ,	ClassWithin( UObject::StaticClass() )
@@ -5465,6 +5592,7 @@ UClass::UClass(const FObjectInitializer& ObjectInitializer, UClass* InBaseClass)
 ,	ClassUnique(0)
 ,	bCooked(false)
 ,	bLayoutChanging(false)
+,	bIsDestructionThreadSafe(false)
 ,	ClassFlags(CLASS_None)
 ,	ClassCastFlags(CASTCLASS_None)
 ,	ClassWithin(UObject::StaticClass())
@@ -5524,6 +5652,7 @@ UClass::UClass
 ,	ClassUnique				( 0 )
 ,	bCooked					( false )
 ,	bLayoutChanging			( false )
+,	bIsDestructionThreadSafe( false )
 ,	ClassFlags				( InClassFlags | CLASS_Native )
 ,	ClassCastFlags			( InClassCastFlags )
 ,	ClassWithin				( nullptr )
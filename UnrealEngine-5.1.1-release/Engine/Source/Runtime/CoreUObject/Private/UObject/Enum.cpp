@@ -13,6 +13,7 @@
 #include "UObject/CoreObjectVersion.h"
 #include "UObject/CoreRedirects.h"
 #include "UObject/LinkerLoad.h"
+#include "Hash/PerfectHash.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogEnum, Log, All);
 
@@ -28,6 +29,7 @@ UEnum::UEnum(const FObjectInitializer& ObjectInitializer)
 	, CppType()
 	, CppForm(ECppForm::Regular)
 	, EnumDisplayNameFn( nullptr )
+	, NameHash( nullptr )
 {
 }
 
@@ -648,6 +650,21 @@ int32 UEnum::GetIndexByNameString(const FString& InSearchString, EGetByNameFlags
 		SearchEnumEntryString = GenerateFullEnumName(*ModifiedEnumEntryString);
 	}
 
+	// Generated enums can find names without creating FNames or comparing against every entry
+	if (NameHash)
+	{
+		int32 Result = GetIndexByNameHash(SearchEnumEntryString, StringComparisonMethod);
+		if (Result == INDEX_NONE)
+		{
+			Result = GetIndexByNameHash(ModifiedEnumEntryString, StringComparisonMethod);
+		}
+
+		if (Result != INDEX_NONE)
+		{
+			return Result;
+		}
+	}
+
 	// Search for names both with and without namespace
 	FName SearchName = FName(*SearchEnumEntryString, FNAME_Find);
 	FName ModifiedName = FName(*ModifiedEnumEntryString, FNAME_Find);
@@ -700,6 +717,23 @@ int32 UEnum::GetIndexByNameString(const FString& InSearchString, EGetByNameFlags
 	return INDEX_NONE;
 }
 
+int32 UEnum::GetIndexByNameHash(FStringView InName, ESearchCase::Type SearchCase) const
+{
+	const int32 Index = NameHash->FindCandidate(InName);
+
+	// The table only narrows the name down to one entry, which still has to match
+	if (Index != INDEX_NONE && Index < Names.Num())
+	{
+		FNameBuilder NameString(Names[Index].Key);
+		if (NameString.ToView().Equals(InName, SearchCase))
+		{
+			return Index;
+		}
+	}
+
+	return INDEX_NONE;
+}
+
 int64 UEnum::GetValueByNameString(const FString& SearchString, EGetByNameFlags Flags) const
 {
 	int32 Index = GetIndexByNameString(SearchString, Flags);
@@ -737,6 +771,7 @@ bool UEnum::SetEnums(TArray<TPair<FName, int64>>& InNames, UEnum::ECppForm InCpp
 	Names     = InNames;
 	CppForm   = InCppForm;
 	EnumFlags = InFlags;
+	NameHash  = nullptr;
 
 	if (bAddMaxKeyIfMissing)
 	{
@@ -33,6 +33,7 @@
 #include "HAL/RunnableThread.h"
 #include "UObject/FieldPathProperty.h"
 #include "UObject/GarbageCollectionHistory.h"
+#include "ProfilingDebugging/CountersTrace.h"
 
 /*-----------------------------------------------------------------------------
    Garbage collection.
@@ -237,11 +238,41 @@ static FAutoConsoleVariableRef CIncrementalBeginDestroyEnabled(
 	ECVF_Default
 );
 
-int32 GMultithreadedDestructionEnabled = 0;
+static int32 GAllowIncrementalReachability = 0;
+static FAutoConsoleVariableRef CVarAllowIncrementalReachability(
+	TEXT("gc.AllowIncrementalReachability"),
+	GAllowIncrementalReachability,
+	TEXT("If true, reachability analysis is time sliced across frames (see PerformIncrementalReachabilityAnalysis). ")
+	TEXT("Requires the GC write barrier (UE_WITH_OBJECT_PTR_GC_BARRIER) and is only used when GC clusters are disabled and no full purge is requested."),
+	ECVF_Default
+);
+
+static int32 GGenerationalGC = 0;
+static FAutoConsoleVariableRef CVarGenerationalGC(
+	TEXT("gc.Generational"),
+	GGenerationalGC,
+	TEXT("If true, objects that survive garbage collection are tenured and most collections only scan young objects and the remembered set. ")
+	TEXT("Requires the GC write barrier (UE_WITH_OBJECT_PTR_GC_BARRIER) and is only used when GC clusters are disabled and no full purge is requested."),
+	ECVF_Default
+);
+
+static int32 GGenerationalMajorInterval = 10;
+static FAutoConsoleVariableRef CVarGenerationalMajorInterval(
+	TEXT("gc.GenerationalMajorInterval"),
+	GGenerationalMajorInterval,
+	TEXT("Number of minor collections after which generational GC performs a major collection that also reclaims tenured objects."),
+	ECVF_Default
+);
+
+/** Number of minor collections since the last major collection */
+static int32 GNumMinorGCsSinceLastMajorGC = 0;
+
+int32 GMultithreadedDestructionEnabled = 1;
 static FAutoConsoleVariableRef CMultithreadedDestructionEnabled(
 	TEXT("gc.MultithreadedDestructionEnabled"),
 	GMultithreadedDestructionEnabled,
-	TEXT("If true, the engine will free objects' memory from a worker thread"),
+	TEXT("If true, the engine will destroy objects of classes with thread safe destructors (see UObject::IsDestructionThreadSafe) on worker threads in parallel, ")
+	TEXT("the remaining objects are destroyed on the game thread"),
 	ECVF_Default
 );
 
@@ -358,10 +389,13 @@ static void LogClassCountInfo( const TCHAR* LogText, TMap<const FName,uint32>& C
 #endif
 
 /**
- * Helper class for destroying UObjects on a worker thread
+ * Helper class for destroying UObjects on worker threads
  */
 class FAsyncPurge : public FRunnable
 {
+	/** True while a task graph worker destroys objects on behalf of the purge thread */
+	static thread_local bool bIsInParallelPurgeTask;
+
 	/** Thread to run the worker FRunnable on. Destroys objects. */
 	volatile FRunnableThread* Thread;
 	/** Id of the worker thread */
@@ -385,8 +419,13 @@ class FAsyncPurge : public FRunnable
 	/** Stats for the number of objects destroyed */
 	int32 ObjectsDestroyedSinceLastMarkPhase;
 
-	/** [PURGE/GAME THREAD] Destroys objects that are unreachable */
-	template <bool bMultithreaded> // Having this template argument lets the compiler strip unnecessary checks
+	/** Number of objects destroyed by a single parallel task */
+	static constexpr int32 ObjectsPerDestroyBatch = 256;
+
+	/** [PURGE THREAD] Class level destruction thread safety of each unreachable object, gathered before any object is destroyed */
+	TArray<bool> ThreadSafeDestruction;
+
+	/** [GAME THREAD] Destroys objects that are unreachable when running single-threaded */
 	bool TickDestroyObjects(bool bUseTimeLimit, float TimeLimit, double StartTime)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FAsyncPurge::TickDestroyObjects);
@@ -401,26 +440,19 @@ class FAsyncPurge : public FRunnable
 
 			UObject* Object = (UObject*)ObjectItem->Object;
 			check(Object->HasAllFlags(RF_FinishDestroyed | RF_BeginDestroyed));
-			if (!bMultithreaded || Object->IsDestructionThreadSafe())
-			{
-				// Can't lock once for the entire batch here as it could hold the lock for too long
-				GUObjectArray.LockInternalArray();
-				Object->~UObject();
-				GUObjectArray.UnlockInternalArray();
-				GUObjectAllocator.FreeUObject(Object);
-				GUnreachableObjects[ObjCurrentPurgeObjectIndex] = nullptr;
-			}
-			else
-			{
-				FPlatformMisc::MemoryBarrier();
-				++NumObjectsToDestroyOnGameThread;
-			}
+			// Can't lock once for the entire batch here as it could hold the lock for too long
+			GUObjectArray.LockInternalArray();
+			Object->~UObject();
+			GUObjectArray.UnlockInternalArray();
+			GUObjectAllocator.FreeUObject(Object);
+			GUnreachableObjects[ObjCurrentPurgeObjectIndex] = nullptr;
+
 			++ProcessedObjectsCount;
 			++ObjectsDestroyedSinceLastMarkPhase;
 			++ObjCurrentPurgeObjectIndex;
 
 			// Time slicing when running on the game thread
-			if (!bMultithreaded && bUseTimeLimit && (ProcessedObjectsCount == TimeLimitEnforcementGranularityForDeletion) && (ObjCurrentPurgeObjectIndex < GUnreachableObjects.Num()))
+			if (bUseTimeLimit && (ProcessedObjectsCount == TimeLimitEnforcementGranularityForDeletion) && (ObjCurrentPurgeObjectIndex < GUnreachableObjects.Num()))
 			{
 				ProcessedObjectsCount = 0;
 				if ((FPlatformTime::Seconds() - StartTime) > TimeLimit)
@@ -433,6 +465,69 @@ class FAsyncPurge : public FRunnable
 		return bFinishedDestroyingObjects;
 	}
 
+	/** [PURGE THREAD] Destroys objects of classes with thread safe destructors on task graph workers, the rest is deferred to the game thread */
+	void TickDestroyObjectsInParallel()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FAsyncPurge::TickDestroyObjectsInParallel);
+		const int32 NumObjects = GUnreachableObjects.Num();
+		const int32 NumBatches = FMath::DivideAndRoundUp(NumObjects, ObjectsPerDestroyBatch);
+
+		// Classes are unreachable objects too and the game thread may destroy them while objects of these classes are still being processed
+		// here, so their destruction thread safety is gathered before anything is destroyed
+		ThreadSafeDestruction.SetNumUninitialized(NumObjects, false);
+		ParallelFor(TEXT("GarbageCollection.GatherThreadSafeDestruction.PF"), NumBatches, 1, [this, NumObjects](int32 BatchIndex)
+		{
+			const int32 FirstObjectIndex = BatchIndex * ObjectsPerDestroyBatch;
+			const int32 LastObjectIndex = FMath::Min(NumObjects, FirstObjectIndex + ObjectsPerDestroyBatch);
+			for (int32 ObjectIndex = FirstObjectIndex; ObjectIndex < LastObjectIndex; ++ObjectIndex)
+			{
+				FUObjectItem* ObjectItem = GUnreachableObjects[ObjectIndex];
+				check(ObjectItem->IsUnreachable());
+				UObject* Object = (UObject*)ObjectItem->Object;
+				check(Object->HasAllFlags(RF_FinishDestroyed | RF_BeginDestroyed));
+				ThreadSafeDestruction[ObjectIndex] = Object->GetClass()->bIsDestructionThreadSafe;
+			}
+		});
+
+		// Objects are destroyed in waves so that the game thread can already destroy the objects that were deferred to it in the previous waves
+		const int32 BatchesPerWave = FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads()) * 4;
+		for (int32 FirstBatchIndex = 0; FirstBatchIndex < NumBatches; FirstBatchIndex += BatchesPerWave)
+		{
+			const int32 NumBatchesInWave = FMath::Min(BatchesPerWave, NumBatches - FirstBatchIndex);
+			FThreadSafeCounter NumObjectsDeferredInWave;
+			ParallelFor(TEXT("GarbageCollection.DestroyObjects.PF"), NumBatchesInWave, 1, [this, NumObjects, FirstBatchIndex, &NumObjectsDeferredInWave](int32 BatchIndex)
+			{
+				TGuardValue<bool> GuardIsInParallelPurgeTask(bIsInParallelPurgeTask, true);
+				const int32 FirstObjectIndex = (FirstBatchIndex + BatchIndex) * ObjectsPerDestroyBatch;
+				const int32 LastObjectIndex = FMath::Min(NumObjects, FirstObjectIndex + ObjectsPerDestroyBatch);
+				int32 NumObjectsDeferred = 0;
+				for (int32 ObjectIndex = FirstObjectIndex; ObjectIndex < LastObjectIndex; ++ObjectIndex)
+				{
+					if (ThreadSafeDestruction[ObjectIndex])
+					{
+						// The internal object array is only locked while the object index is freed so destructors run in parallel
+						UObject* Object = (UObject*)GUnreachableObjects[ObjectIndex]->Object;
+						Object->~UObject();
+						GUObjectAllocator.FreeUObject(Object);
+						GUnreachableObjects[ObjectIndex] = nullptr;
+					}
+					else
+					{
+						++NumObjectsDeferred;
+					}
+				}
+				NumObjectsDeferredInWave.Add(NumObjectsDeferred);
+			});
+
+			const int32 LastObjectIndexInWave = FMath::Min(NumObjects, (FirstBatchIndex + NumBatchesInWave) * ObjectsPerDestroyBatch);
+			ObjectsDestroyedSinceLastMarkPhase += LastObjectIndexInWave - ObjCurrentPurgeObjectIndex;
+			ObjCurrentPurgeObjectIndex = LastObjectIndexInWave;
+			// The game thread may only look at objects of waves that have been completely processed
+			FPlatformMisc::MemoryBarrier();
+			NumObjectsToDestroyOnGameThread += NumObjectsDeferredInWave.GetValue();
+		}
+	}
+
 	/** [GAME THREAD] Destroys objects that are unreachable and couldn't be destroyed on the worker thread */
 	bool TickDestroyGameThreadObjects(bool bUseTimeLimit, float TimeLimit, double StartTime)
 	{
@@ -570,7 +665,7 @@ public:
 		{
 			// If we're running single-threaded we need to tick the main loop here too
 			LastUnreachableObjectsCount = GUnreachableObjects.Num();
-			bCanStartDestroyingGameThreadObjects = TickDestroyObjects<false>(bUseTimeLimit, TimeLimit, StartTime);
+			bCanStartDestroyingGameThreadObjects = TickDestroyObjects(bUseTimeLimit, TimeLimit, StartTime);
 		}
 		if (bCanStartDestroyingGameThreadObjects)
 		{
@@ -605,7 +700,7 @@ public:
 	  */
 	bool IsInAsyncPurgeThread() const
 	{
-		return AsyncPurgeThreadId == FPlatformTLS::GetCurrentThreadId();
+		return AsyncPurgeThreadId == FPlatformTLS::GetCurrentThreadId() || bIsInParallelPurgeTask;
 	}
 
 	/* Returns true if it can run multi-threaded destruction */
@@ -629,7 +724,7 @@ public:
 			if (BeginPurgeEvent->Wait(15, true))
 			{
 				BeginPurgeEvent->Reset();
-				TickDestroyObjects<true>(/* bUseTimeLimit = */ false, /* TimeLimit = */ 0.0f, /* StartTime = */ 0.0);
+				TickDestroyObjectsInParallel();
 				FinishedPurgeEvent->Trigger();
 			}
 		}
@@ -651,6 +746,7 @@ public:
 		}
 	}
 };
+thread_local bool FAsyncPurge::bIsInParallelPurgeTask = false;
 static FAsyncPurge* GAsyncPurge = nullptr;
 
 /**
@@ -687,6 +783,8 @@ class FGCReferenceProcessor
 #if ENABLE_GC_HISTORY
 	const bool bWithHistory;
 #endif // ENABLE_GC_HISTORY
+	/** Time at which incremental reachability analysis suspends */
+	double SuspendTime = MAX_dbl;
 
 public:
 
@@ -702,6 +800,15 @@ public:
 	{
 		return !!(Options & EFastReferenceCollectorOptions::WithPendingKill);
 	}
+	constexpr static FORCEINLINE bool IsIncremental()
+	{
+		return !!(Options & EFastReferenceCollectorOptions::Incremental);
+	}
+	/** Incremental reachability analysis marks objects that haven't been reached yet with a separate flag so that the Unreachable flag stays meaningful between time slices */
+	constexpr static FORCEINLINE EInternalObjectFlags GetUnreachableFlag()
+	{
+		return IsIncremental() ? EInternalObjectFlags::MaybeUnreachable : EInternalObjectFlags::Unreachable;
+	}
 
 	FGCReferenceProcessor()
 		: MinDesiredObjectsPerSubTask(GMinDesiredObjectsPerSubTask)
@@ -717,6 +824,17 @@ public:
 		return MinDesiredObjectsPerSubTask;
 	}
 
+	/** Sets the time (in seconds, see FPlatformTime::Seconds()) at which incremental reachability analysis suspends */
+	void SetSuspendTime(double InSuspendTime)
+	{
+		SuspendTime = InSuspendTime;
+	}
+
+	FORCEINLINE bool IsTimeLimitExceeded() const
+	{
+		return FPlatformTime::Seconds() >= SuspendTime;
+	}
+
 	void UpdateDetailedStats(UObject* CurrentObject, uint32 DeltaCycles)
 	{
 #if PERF_DETAILED_PER_CLASS_GC_STATS
@@ -1020,7 +1138,7 @@ public:
 			Object = nullptr;
 		}
 		// Add encountered object reference to list of to be serialized objects if it hasn't already been added.
-		else if (ObjectItem->IsUnreachable())
+		else if (ObjectItem->HasAnyFlags(GetUnreachableFlag()))
 		{
 			if (IsParallel())
 			{
@@ -1073,7 +1191,7 @@ public:
 #endif // ENABLE_GC_HISTORY
 
 				// Mark it as reachable.
-				ObjectItem->ClearUnreachable();
+				ObjectItem->ThisThreadAtomicallyClearedFlag(GetUnreachableFlag());
 
 				// Objects that are part of a GC cluster should never have the unreachable flag set!
 				checkSlow(ObjectItem->GetOwnerIndex() <= 0);
@@ -1301,6 +1419,129 @@ void FGarbageCollectionTracer::PerformReachabilityAnalysisOnObjects(FGCArrayStru
 
 #if UE_WITH_GC
 
+TRACE_DECLARE_INT_COUNTER(GCIncrementalReachabilityPendingObjects, TEXT("GC/IncrementalReachability/PendingObjects"));
+TRACE_DECLARE_INT_COUNTER(GCIncrementalReachabilitySlices, TEXT("GC/IncrementalReachability/Slices"));
+
+/**
+ * State of incremental reachability analysis that is kept between time slices.
+ * Objects that haven't been reached yet are marked with EInternalObjectFlags::MaybeUnreachable which is only turned into
+ * EInternalObjectFlags::Unreachable when the analysis completes, objects created in the meantime are never marked.
+ */
+class FIncrementalReachabilityState : public FUObjectArray::FUObjectCreateListener
+{
+public:
+	/** Objects that have been reached but whose references haven't been processed yet */
+	FGCArrayStruct* ObjectsToSerialize = nullptr;
+	/** Objects that were kept alive by flags or the root set when the analysis started, they are processed again when it completes */
+	TArray<UObject*> InitialRoots;
+	EObjectFlags KeepFlags = RF_NoFlags;
+	EFastReferenceCollectorOptions Options = EFastReferenceCollectorOptions::None;
+	double StartTime = 0.0;
+	int32 NumSlices = 0;
+
+	/** Called by the write barrier, can be called from any thread */
+	void AddBarrierObject(UObject* Object)
+	{
+		FScopeLock BarrierLock(&BarrierObjectsCritical);
+		BarrierObjects.Add(Object);
+	}
+
+	void MoveBarrierObjects(TArray<UObject*>& OutObjects)
+	{
+		FScopeLock BarrierLock(&BarrierObjectsCritical);
+		OutObjects.Append(BarrierObjects);
+		BarrierObjects.Reset();
+	}
+
+	/** Moves objects created since the analysis started that still exist to OutObjects */
+	void MoveNewObjects(TArray<UObject*>& OutObjects)
+	{
+		FScopeLock NewObjectsLock(&NewObjectsCritical);
+		for (const TPair<const UObjectBase*, int32>& NewObject : NewObjects)
+		{
+			const FUObjectItem* ObjectItem = GUObjectArray.IndexToObject(NewObject.Value);
+			if (ObjectItem && ObjectItem->Object == NewObject.Key)
+			{
+				OutObjects.Add(static_cast<UObject*>(ObjectItem->Object));
+			}
+		}
+		NewObjects.Empty();
+	}
+
+	//~ Begin FUObjectArray::FUObjectCreateListener interface
+	virtual void NotifyUObjectCreated(const UObjectBase* Object, int32 Index) override
+	{
+		FScopeLock NewObjectsLock(&NewObjectsCritical);
+		NewObjects.Emplace(Object, Index);
+	}
+	virtual void OnUObjectArrayShutdown() override
+	{
+		if (UE::GC::GIsIncrementalReachabilityPending)
+		{
+			GUObjectArray.RemoveUObjectCreateListener(this);
+		}
+	}
+	//~ End FUObjectArray::FUObjectCreateListener interface
+
+private:
+	FCriticalSection BarrierObjectsCritical;
+	TArray<UObject*> BarrierObjects;
+	FCriticalSection NewObjectsCritical;
+	TArray<TPair<const UObjectBase*, int32>> NewObjects;
+};
+static FIncrementalReachabilityState GIncrementalReachability;
+
+#endif // UE_WITH_GC
+
+namespace UE::GC
+{
+	bool GIsIncrementalReachabilityPending = false;
+	bool GIsGenerationalGCEnabled = false;
+
+	void OnObjectReferenceWritten(const UObject* Object)
+	{
+#if UE_WITH_GC
+		if (GUObjectAllocator.ResidesInPermanentPool(Object))
+		{
+			return;
+		}
+
+		if (GIsIncrementalReachabilityPending)
+		{
+			MarkAsReachable(Object);
+		}
+		if (GIsGenerationalGCEnabled)
+		{
+			// Tenured objects aren't reclaimed by minor collections so only young objects need to be remembered
+			FUObjectItem* ObjectItem = GUObjectArray.IndexToObjectUnsafeForGC(GUObjectArray.ObjectToIndex(Object));
+			if (!ObjectItem->HasAnyFlags(EInternalObjectFlags::Tenured | EInternalObjectFlags::Remembered))
+			{
+				ObjectItem->ThisThreadAtomicallySetFlag(EInternalObjectFlags::Remembered);
+			}
+		}
+#endif // UE_WITH_GC
+	}
+
+	void MarkAsReachable(const UObject* Object)
+	{
+#if UE_WITH_GC
+		if (GUObjectAllocator.ResidesInPermanentPool(Object))
+		{
+			return;
+		}
+
+		FUObjectItem* ObjectItem = GUObjectArray.IndexToObjectUnsafeForGC(GUObjectArray.ObjectToIndex(Object));
+		if (ObjectItem->ThisThreadAtomicallyClearedFlag(EInternalObjectFlags::MaybeUnreachable))
+		{
+			// The object is now reachable but it hasn't been processed yet so its references are processed in the next time slice
+			GIncrementalReachability.AddBarrierObject(const_cast<UObject*>(Object));
+		}
+#endif // UE_WITH_GC
+	}
+}
+
+#if UE_WITH_GC
+
 class FRealtimeGC : public FGarbageCollectionTracer
 {
 	typedef void(FRealtimeGC::*MarkObjectsFn)(TArray<UObject*>&, const EObjectFlags);
@@ -1360,7 +1601,7 @@ public:
 	 * Marks all objects that don't have KeepFlags and EInternalObjectFlags::GarbageCollectionKeepFlags as unreachable
 	 * This function is a template to speed up the case where we don't need to assemble the token stream (saves about 6ms on PS4)
 	 */
-	template <bool bParallel, bool bWithClusters>
+	template <bool bParallel, bool bWithClusters, EInternalObjectFlags UnreachableFlag = EInternalObjectFlags::Unreachable>
 	void MarkObjectsAsUnreachable(TArray<UObject*>& ObjectsToSerialize, const EObjectFlags KeepFlags)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(MarkObjectsAsUnreachable);
@@ -1396,7 +1637,7 @@ public:
 					UObject* Object = (UObject*)ObjectItem->Object;
 
 					// We can't collect garbage during an async load operation and by now all unreachable objects should've been purged.
-					checkf(!ObjectItem->HasAnyFlags(EInternalObjectFlags::Unreachable|EInternalObjectFlags::PendingConstruction|EInternalObjectFlags::PersistentGarbage),
+					checkf(!ObjectItem->HasAnyFlags(EInternalObjectFlags::Unreachable|EInternalObjectFlags::MaybeUnreachable|EInternalObjectFlags::PendingConstruction|EInternalObjectFlags::PersistentGarbage),
 							TEXT("Object: '%s' with ObjectFlags=0x%08x and InternalObjectFlags=0x%08x. ")
 							TEXT("State: IsEngineExitRequested=%d, GIsCriticalError=%d, GExitPurge=%d, GObjPurgeIsRequired=%d, GObjIncrementalPurgeIsInProgress=%d, GObjFinishDestroyHasBeenRoutedToAllObjects=%d, GGCObjectsPendingDestructionCount=%d"),
 							*Object->GetFullName(),
@@ -1484,7 +1725,7 @@ public:
 						}
 						else
 						{
-							ObjectItem->SetFlags(EInternalObjectFlags::Unreachable);
+							ObjectItem->SetFlags(UnreachableFlag);
 						}
 					}					
 				}
@@ -1562,12 +1803,96 @@ public:
 		}
 	}
 
+	/**
+	 * Marks young objects that don't have KeepFlags and EInternalObjectFlags::GarbageCollectionKeepFlags and aren't remembered as unreachable.
+	 * Tenured objects are never marked, only the ones that are remembered or kept by flags have their references processed by a minor collection.
+	 * Clusters are not supported.
+	 */
+	template <bool bParallel>
+	void MarkYoungObjectsAsUnreachable(TArray<UObject*>& ObjectsToSerialize, const EObjectFlags KeepFlags)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(MarkYoungObjectsAsUnreachable);
+		const EInternalObjectFlags FastKeepFlags = EInternalObjectFlags::GarbageCollectionKeepFlags;
+		const int32 MaxNumberOfObjects = GUObjectArray.GetObjectArrayNum() - GUObjectArray.GetFirstGCIndex();
+		const int32 NumThreads = FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads());
+		const int32 NumberOfObjectsPerThread = (MaxNumberOfObjects / NumThreads) + 1;
+
+		FGCArrayStruct** ObjectsToSerializeArrays = new FGCArrayStruct*[NumThreads];
+		for (int32 ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+		{
+			ObjectsToSerializeArrays[ThreadIndex] = FGCArrayPool::Get().GetArrayStructFromPool();
+		}
+
+		ParallelFor(TEXT("GarbageCollection.PF"), NumThreads, 1, [ObjectsToSerializeArrays, FastKeepFlags, KeepFlags, NumberOfObjectsPerThread, NumThreads, MaxNumberOfObjects](int32 ThreadIndex)
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(MarkYoungObjectsAsUnreachableTask);
+			int32 FirstObjectIndex = ThreadIndex * NumberOfObjectsPerThread + GUObjectArray.GetFirstGCIndex();
+			int32 NumObjects = (ThreadIndex < (NumThreads - 1)) ? NumberOfObjectsPerThread : (MaxNumberOfObjects - (NumThreads - 1) * NumberOfObjectsPerThread);
+			int32 LastObjectIndex = FMath::Min(GUObjectArray.GetObjectArrayNum() - 1, FirstObjectIndex + NumObjects - 1);
+			int32 ObjectCountDuringMarkPhase = 0;
+			TArray<UObject*>& LocalObjectsToSerialize = ObjectsToSerializeArrays[ThreadIndex]->ObjectsToSerialize;
+
+			for (int32 ObjectIndex = FirstObjectIndex; ObjectIndex <= LastObjectIndex; ++ObjectIndex)
+			{
+				FUObjectItem* ObjectItem = &GUObjectArray.GetObjectItemArrayUnsafe()[ObjectIndex];
+				if (ObjectItem->Object)
+				{
+					UObject* Object = (UObject*)ObjectItem->Object;
+					checkSlow(!ObjectItem->HasAnyFlags(EInternalObjectFlags::Unreachable | EInternalObjectFlags::MaybeUnreachable | EInternalObjectFlags::PendingConstruction));
+
+					// Keep track of how many objects are around.
+					ObjectCountDuringMarkPhase++;
+
+					if (ObjectItem->HasAnyFlags(EInternalObjectFlags::Tenured))
+					{
+						// Tenured objects are reachable by definition, their references only need to be processed if they can't be tracked by the write barrier
+						// or if they're being loaded and their references may be written directly by serialization
+						if (ObjectItem->HasAnyFlags(EInternalObjectFlags::Remembered | FastKeepFlags))
+						{
+							LocalObjectsToSerialize.Add(Object);
+						}
+					}
+					else if (ObjectItem->IsRootSet() || ObjectItem->HasAnyFlags(FastKeepFlags | EInternalObjectFlags::Remembered))
+					{
+						LocalObjectsToSerialize.Add(Object);
+					}
+					// If KeepFlags is non zero this is going to be very slow due to cache misses
+					else if (!ObjectItem->IsPendingKill() && KeepFlags != RF_NoFlags && Object->HasAnyFlags(KeepFlags))
+					{
+						LocalObjectsToSerialize.Add(Object);
+					}
+					else
+					{
+						ObjectItem->SetFlags(EInternalObjectFlags::Unreachable);
+					}
+				}
+			}
+
+			GObjectCountDuringLastMarkPhase.Add(ObjectCountDuringMarkPhase);
+		}, !bParallel ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+		// Collect all objects to serialize from all threads and put them into a single array
+		int32 NumObjectsToSerialize = 0;
+		for (int32 ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+		{
+			NumObjectsToSerialize += ObjectsToSerializeArrays[ThreadIndex]->ObjectsToSerialize.Num();
+		}
+		ObjectsToSerialize.Reserve(NumObjectsToSerialize);
+		for (int32 ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+		{
+			ObjectsToSerialize.Append(ObjectsToSerializeArrays[ThreadIndex]->ObjectsToSerialize);
+			FGCArrayPool::Get().ReturnToPool(ObjectsToSerializeArrays[ThreadIndex]);
+		}
+		delete[] ObjectsToSerializeArrays;
+	}
+
 	/**
 	 * Performs reachability analysis.
 	 *
-	 * @param KeepFlags		Objects with these flags will be kept regardless of being referenced or not
+	 * @param KeepFlags			Objects with these flags will be kept regardless of being referenced or not
+	 * @param bMinorCollection	If true, only young objects can be marked as unreachable, see MarkYoungObjectsAsUnreachable
 	 */
-	void PerformReachabilityAnalysis(EObjectFlags KeepFlags, const EFastReferenceCollectorOptions InOptions)
+	void PerformReachabilityAnalysis(EObjectFlags KeepFlags, const EFastReferenceCollectorOptions InOptions, bool bMinorCollection = false)
 	{
 		LLM_SCOPE(ELLMTag::GC);
 
@@ -1591,7 +1916,22 @@ public:
 			const double StartTime = FPlatformTime::Seconds();
 			// Mark phase doesn't care about PendingKill being enabled or not so there's just fewer compiled in functions
 			const EFastReferenceCollectorOptions OptionsForMarkPhase = InOptions & ~EFastReferenceCollectorOptions::WithPendingKill;
-			(this->*MarkObjectsFunctions[GetGCFunctionIndex(OptionsForMarkPhase)])(ObjectsToSerialize, KeepFlags);
+			if (bMinorCollection)
+			{
+				check(!(InOptions & EFastReferenceCollectorOptions::WithClusters));
+				if (!!(InOptions & EFastReferenceCollectorOptions::Parallel))
+				{
+					MarkYoungObjectsAsUnreachable<true>(ObjectsToSerialize, KeepFlags);
+				}
+				else
+				{
+					MarkYoungObjectsAsUnreachable<false>(ObjectsToSerialize, KeepFlags);
+				}
+			}
+			else
+			{
+				(this->*MarkObjectsFunctions[GetGCFunctionIndex(OptionsForMarkPhase)])(ObjectsToSerialize, KeepFlags);
+			}
 			UE_LOG(LogGarbage, Verbose, TEXT("%f ms for MarkObjectsAsUnreachable Phase (%d Objects To Serialize)"), (FPlatformTime::Seconds() - StartTime) * 1000, ObjectsToSerialize.Num());
 		}
 
@@ -1616,6 +1956,200 @@ public:
 	{
 		(this->*ReachabilityAnalysisFunctions[GetGCFunctionIndex(InOptions)])(ArrayStruct);
 	}
+
+	/**
+	 * Starts time sliced reachability analysis: marks all objects that aren't kept alive by flags or the root set as maybe unreachable
+	 * and gathers the roots. The references are processed by ContinueIncrementalReachabilityAnalysis.
+	 *
+	 * @param KeepFlags		Objects with these flags will be kept regardless of being referenced or not
+	 */
+	void StartIncrementalReachabilityAnalysis(EObjectFlags KeepFlags, const EFastReferenceCollectorOptions InOptions)
+	{
+		LLM_SCOPE(ELLMTag::GC);
+		TRACE_CPUPROFILER_EVENT_SCOPE(StartIncrementalReachabilityAnalysis);
+		check(!UE::GC::GIsIncrementalReachabilityPending);
+		check(!(InOptions & EFastReferenceCollectorOptions::WithClusters));
+
+		FIncrementalReachabilityState& State = GIncrementalReachability;
+		State.ObjectsToSerialize = FGCArrayPool::Get().GetArrayStructFromPool();
+		State.KeepFlags = KeepFlags;
+		State.Options = InOptions;
+		State.StartTime = FPlatformTime::Seconds();
+		State.NumSlices = 0;
+		TArray<UObject*>& ObjectsToSerialize = State.ObjectsToSerialize->ObjectsToSerialize;
+
+		// Reset object count.
+		GObjectCountDuringLastMarkPhase.Reset();
+
+		// Make sure GC referencer object is checked for references to other objects even if it resides in permanent object pool
+		if (FPlatformProperties::RequiresCookedData() && FGCObject::GGCObjectReferencer && GUObjectArray.IsDisregardForGC(FGCObject::GGCObjectReferencer))
+		{
+			ObjectsToSerialize.Add(FGCObject::GGCObjectReferencer);
+		}
+
+		if (!!(InOptions & EFastReferenceCollectorOptions::Parallel))
+		{
+			MarkObjectsAsUnreachable<true, false, EInternalObjectFlags::MaybeUnreachable>(ObjectsToSerialize, KeepFlags);
+		}
+		else
+		{
+			MarkObjectsAsUnreachable<false, false, EInternalObjectFlags::MaybeUnreachable>(ObjectsToSerialize, KeepFlags);
+		}
+		State.InitialRoots = ObjectsToSerialize;
+
+		// Objects created from now on are reachable for this analysis but their references still need to be processed when it completes
+		GUObjectArray.AddUObjectCreateListener(&State);
+		UE::GC::GIsIncrementalReachabilityPending = true;
+
+		TRACE_COUNTER_SET(GCIncrementalReachabilityPendingObjects, ObjectsToSerialize.Num());
+		TRACE_COUNTER_SET(GCIncrementalReachabilitySlices, 0);
+		UE_LOG(LogGarbage, Log, TEXT("%f ms for starting incremental reachability analysis (%d roots)"), (FPlatformTime::Seconds() - State.StartTime) * 1000, ObjectsToSerialize.Num());
+	}
+
+	/**
+	 * Processes the references of reached objects until the time limit is exceeded. When there are no more objects to process
+	 * the analysis is completed in one go.
+	 *
+	 * @param TimeLimit		Time limit in seconds, zero to complete the analysis without a time limit
+	 * @return true if reachability analysis has completed and all unreachable objects have been marked as such
+	 */
+	bool ContinueIncrementalReachabilityAnalysis(double TimeLimit)
+	{
+		LLM_SCOPE(ELLMTag::GC);
+		TRACE_CPUPROFILER_EVENT_SCOPE(IncrementalReachabilityAnalysis);
+		check(UE::GC::GIsIncrementalReachabilityPending);
+
+		FIncrementalReachabilityState& State = GIncrementalReachability;
+		TArray<UObject*>& ObjectsToSerialize = State.ObjectsToSerialize->ObjectsToSerialize;
+		State.NumSlices++;
+		TRACE_COUNTER_SET(GCIncrementalReachabilitySlices, State.NumSlices);
+
+		State.MoveBarrierObjects(ObjectsToSerialize);
+		if (TimeLimit > 0.0)
+		{
+			const double SuspendTime = FPlatformTime::Seconds() + TimeLimit;
+			if (!!(State.Options & EFastReferenceCollectorOptions::WithPendingKill))
+			{
+				PerformIncrementalReachabilityAnalysisOnObjectsInternal<EFastReferenceCollectorOptions::Incremental | EFastReferenceCollectorOptions::WithPendingKill>(State.ObjectsToSerialize, SuspendTime);
+			}
+			else
+			{
+				PerformIncrementalReachabilityAnalysisOnObjectsInternal<EFastReferenceCollectorOptions::Incremental>(State.ObjectsToSerialize, SuspendTime);
+			}
+			TRACE_COUNTER_SET(GCIncrementalReachabilityPendingObjects, ObjectsToSerialize.Num());
+
+			if (ObjectsToSerialize.Num())
+			{
+				return false;
+			}
+		}
+
+		FinishIncrementalReachabilityAnalysis();
+		return true;
+	}
+
+private:
+
+	template <EFastReferenceCollectorOptions CollectorOptions>
+	void PerformIncrementalReachabilityAnalysisOnObjectsInternal(FGCArrayStruct* ArrayStruct, double SuspendTime)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PerformIncrementalReachabilityAnalysisOnObjectsInternal);
+		FGCReferenceProcessor<CollectorOptions> ReferenceProcessor;
+		ReferenceProcessor.SetSuspendTime(SuspendTime);
+		TFastReferenceCollector<
+			FGCReferenceProcessor<CollectorOptions>,
+			FGCCollector<CollectorOptions>,
+			FGCArrayPool,
+			CollectorOptions
+			>  ReferenceCollector(ReferenceProcessor, FGCArrayPool::Get());
+		ReferenceCollector.CollectReferences(*ArrayStruct);
+	}
+
+	/**
+	 * Completes incremental reachability analysis without a time limit. Objects that haven't been reached are marked as unreachable,
+	 * unless they were added to the root set or got keep flags in the meantime, and the objects the game may have changed without
+	 * the write barrier seeing it (roots, new objects) are processed again with regular reachability analysis.
+	 */
+	void FinishIncrementalReachabilityAnalysis()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FinishIncrementalReachabilityAnalysis);
+		const double StartTime = FPlatformTime::Seconds();
+
+		FIncrementalReachabilityState& State = GIncrementalReachability;
+		GUObjectArray.RemoveUObjectCreateListener(&State);
+		UE::GC::GIsIncrementalReachabilityPending = false;
+
+		// This can happen if someone enabled clusters from the console while the analysis was in progress
+		if (GUObjectClusters.GetNumAllocatedClusters())
+		{
+			GUObjectClusters.DissolveClusters(true);
+		}
+
+		TArray<UObject*>& ObjectsToSerialize = State.ObjectsToSerialize->ObjectsToSerialize;
+		State.MoveBarrierObjects(ObjectsToSerialize);
+		State.MoveNewObjects(ObjectsToSerialize);
+		ObjectsToSerialize.Append(State.InitialRoots);
+		State.InitialRoots.Empty();
+
+		// Turn the objects that haven't been reached into unreachable objects so that regular reachability analysis can process what's left
+		{
+			const EInternalObjectFlags FastKeepFlags = EInternalObjectFlags::GarbageCollectionKeepFlags | EInternalObjectFlags::RootSet;
+			const EObjectFlags KeepFlags = State.KeepFlags;
+			const int32 FirstObjectIndex = GUObjectArray.GetFirstGCIndex();
+			const int32 MaxNumberOfObjects = GUObjectArray.GetObjectArrayNum() - FirstObjectIndex;
+			const int32 NumThreads = !!(State.Options & EFastReferenceCollectorOptions::Parallel) ? FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads()) : 1;
+			const int32 NumberOfObjectsPerThread = (MaxNumberOfObjects / NumThreads) + 1;
+			TArray<TArray<UObject*>> NewRootsPerThread;
+			NewRootsPerThread.SetNum(NumThreads);
+
+			ParallelFor(TEXT("GarbageCollection.FinishIncrementalReachability.PF"), NumThreads, 1, [&NewRootsPerThread, FastKeepFlags, KeepFlags, FirstObjectIndex, MaxNumberOfObjects, NumberOfObjectsPerThread](int32 ThreadIndex)
+			{
+				const int32 StartIndex = FirstObjectIndex + ThreadIndex * NumberOfObjectsPerThread;
+				const int32 EndIndex = FMath::Min(FirstObjectIndex + MaxNumberOfObjects, StartIndex + NumberOfObjectsPerThread);
+				for (int32 ObjectIndex = StartIndex; ObjectIndex < EndIndex; ++ObjectIndex)
+				{
+					FUObjectItem* ObjectItem = &GUObjectArray.GetObjectItemArrayUnsafe()[ObjectIndex];
+					if (ObjectItem->Object && ObjectItem->HasAnyFlags(EInternalObjectFlags::MaybeUnreachable))
+					{
+						UObject* Object = static_cast<UObject*>(ObjectItem->Object);
+						ObjectItem->ClearFlags(EInternalObjectFlags::MaybeUnreachable);
+						if (ObjectItem->HasAnyFlags(FastKeepFlags) || (!ObjectItem->IsPendingKill() && KeepFlags != RF_NoFlags && Object->HasAnyFlags(KeepFlags)))
+						{
+							NewRootsPerThread[ThreadIndex].Add(Object);
+						}
+						else
+						{
+							ObjectItem->SetFlags(EInternalObjectFlags::Unreachable);
+						}
+					}
+				}
+			}, NumThreads == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+			for (const TArray<UObject*>& NewRoots : NewRootsPerThread)
+			{
+				ObjectsToSerialize.Append(NewRoots);
+			}
+		}
+
+		// Everything left is processed under the GC lock so there's no need to keep track of changes anymore
+		PerformReachabilityAnalysisOnObjects(State.ObjectsToSerialize, State.Options);
+
+		// Allowing external systems to add object roots. This can't be done through AddReferencedObjects
+		// because it may require tracing objects (via FGarbageCollectionTracer) multiple times
+		FCoreUObjectDelegates::TraceExternalRootsForReachabilityAnalysis.Broadcast(*this, State.KeepFlags, !(State.Options & EFastReferenceCollectorOptions::Parallel));
+
+		FGCArrayPool::Get().ReturnToPool(State.ObjectsToSerialize);
+		State.ObjectsToSerialize = nullptr;
+
+#if UE_BUILD_DEBUG
+		FGCArrayPool::Get().CheckLeaks();
+#endif
+
+		const double EndTime = FPlatformTime::Seconds();
+		TRACE_COUNTER_SET(GCIncrementalReachabilityPendingObjects, 0);
+		UE_LOG(LogGarbage, Log, TEXT("%f ms for completing incremental reachability analysis, %f ms since it started (%d time slices)"),
+			(EndTime - StartTime) * 1000, (EndTime - State.StartTime) * 1000, State.NumSlices);
+	}
 };
 #endif // UE_WITH_GC
 
@@ -2126,6 +2660,11 @@ bool IsIncrementalPurgePending()
 	return GObjIncrementalPurgeIsInProgress || GObjPurgeIsRequired;
 }
 
+bool IsIncrementalReachabilityAnalysisPending()
+{
+	return UE::GC::GIsIncrementalReachabilityPending;
+}
+
 bool IsGarbageCollectingAndLockingUObjectHashTables()
 {
 	return GIsGarbageCollectingAndLockingUObjectHashTables;
@@ -2236,13 +2775,101 @@ void GatherUnreachableObjects(bool bForceSingleThreaded)
 		ClusterItemsToDestroy.Num());
 }
 
+#if UE_WITH_GC
+/** Returns true if the next reachability analysis can be time sliced */
+static bool ShouldStartIncrementalReachabilityAnalysis(bool bPerformFullPurge)
+{
+#if UE_WITH_OBJECT_PTR_GC_BARRIER
+	// Clustered objects are marked as reachable through their cluster root which the write barrier doesn't know about
+	return GAllowIncrementalReachability && !bPerformFullPurge && !GCreateGCClusters && !GUObjectClusters.GetNumAllocatedClusters();
+#else
+	// References written while the analysis is suspended can't be tracked without the write barrier
+	return false;
+#endif
+}
+
+/** Returns true if the next reachability analysis only needs to process young objects and the remembered set */
+static bool ShouldPerformMinorCollection(bool bPerformFullPurge)
+{
+	// The write barrier has to be active since the end of the last collection for the remembered set to be complete
+	return UE::GC::GIsGenerationalGCEnabled && GGenerationalGC && !bPerformFullPurge && !GCreateGCClusters && !GUObjectClusters.GetNumAllocatedClusters()
+		&& GNumMinorGCsSinceLastMajorGC < GGenerationalMajorInterval;
+}
+
+/** Tenures all objects that survived the collection and (re)enables the generational write barrier */
+static void PromoteReachableObjects(bool bForceSingleThreaded)
+{
+#if UE_WITH_OBJECT_PTR_GC_BARRIER
+	UE::GC::GIsGenerationalGCEnabled = GGenerationalGC && !GCreateGCClusters;
+#else
+	UE::GC::GIsGenerationalGCEnabled = false;
+#endif
+	if (!UE::GC::GIsGenerationalGCEnabled)
+	{
+		// Flags left over from when generational GC was enabled are ignored, the first collection after enabling it again is a major one
+		GNumMinorGCsSinceLastMajorGC = 0;
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(PromoteReachableObjects);
+	const double StartTime = FPlatformTime::Seconds();
+	const int32 MaxNumberOfObjects = GUObjectArray.GetObjectArrayNum() - GUObjectArray.GetFirstGCIndex();
+	const int32 NumThreads = FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads());
+	const int32 NumberOfObjectsPerThread = (MaxNumberOfObjects / NumThreads) + 1;
+	FThreadSafeCounter NumPromotedObjects;
+
+	ParallelFor(TEXT("GarbageCollection.PromoteReachableObjects.PF"), NumThreads, 1, [NumberOfObjectsPerThread, NumThreads, MaxNumberOfObjects, &NumPromotedObjects](int32 ThreadIndex)
+	{
+		int32 FirstObjectIndex = ThreadIndex * NumberOfObjectsPerThread + GUObjectArray.GetFirstGCIndex();
+		int32 NumObjects = (ThreadIndex < (NumThreads - 1)) ? NumberOfObjectsPerThread : (MaxNumberOfObjects - (NumThreads - 1) * NumberOfObjectsPerThread);
+		int32 LastObjectIndex = FMath::Min(GUObjectArray.GetObjectArrayNum() - 1, FirstObjectIndex + NumObjects - 1);
+		int32 NumPromotedObjectsThisThread = 0;
+
+		for (int32 ObjectIndex = FirstObjectIndex; ObjectIndex <= LastObjectIndex; ++ObjectIndex)
+		{
+			FUObjectItem* ObjectItem = &GUObjectArray.GetObjectItemArrayUnsafe()[ObjectIndex];
+			if (ObjectItem->Object && !ObjectItem->HasAnyFlags(EInternalObjectFlags::Tenured | EInternalObjectFlags::Unreachable))
+			{
+				UObject* Object = (UObject*)ObjectItem->Object;
+				// References reported by AddReferencedObjects aren't written through TObjectPtr so the write barrier can't track them
+				const bool bHasAddReferencedObjects = Object->GetClass()->CppClassStaticFunctions.GetAddReferencedObjects() != &UObject::AddReferencedObjects;
+				if (bHasAddReferencedObjects)
+				{
+					ObjectItem->SetFlags(EInternalObjectFlags::Tenured | EInternalObjectFlags::Remembered);
+				}
+				else
+				{
+					ObjectItem->ClearFlags(EInternalObjectFlags::Remembered);
+					ObjectItem->SetFlags(EInternalObjectFlags::Tenured);
+				}
+				NumPromotedObjectsThisThread++;
+			}
+		}
+		NumPromotedObjects.Add(NumPromotedObjectsThisThread);
+	}, bForceSingleThreaded ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	UE_LOG(LogGarbage, Log, TEXT("%f ms for promoting %d objects"), (FPlatformTime::Seconds() - StartTime) * 1000, NumPromotedObjects.GetValue());
+}
+
+/** Lets async loading and other threads perform UObject operations until incremental reachability analysis is resumed */
+static void SuspendIncrementalReachabilityAnalysis()
+{
+	if (GGCLockBehavior == FGCLockBehavior::Default)
+	{
+		ReleaseGCLock();
+	}
+	// The old FGCLockBehavior::Legacy behavior releases the GC lock when CollectGarbageInternal returns
+}
+#endif // UE_WITH_GC
+
 /** 
  * Deletes all unreferenced objects, keeping objects that have any of the passed in KeepFlags set
  *
  * @param	KeepFlags			objects with those flags will be kept regardless of being referenced or not
  * @param	bPerformFullPurge	if true, perform a full purge after the mark pass
+ * @param	IncrementalReachabilityTimeLimit	time limit for resuming incremental reachability analysis, zero to complete it
  */
-void CollectGarbageInternal(EObjectFlags KeepFlags, bool bPerformFullPurge)
+void CollectGarbageInternal(EObjectFlags KeepFlags, bool bPerformFullPurge, double IncrementalReachabilityTimeLimit = 0.0)
 {
 #if UE_WITH_GC
 	SCOPE_TIME_GUARD(TEXT("Collect Garbage"));
@@ -2264,25 +2891,34 @@ void CollectGarbageInternal(EObjectFlags KeepFlags, bool bPerformFullPurge)
 	// We can't collect garbage while there's a load in progress. E.g. one potential issue is Import.XObject
 	check(!IsLoading());
 
-	// Reset GC skip counter
-	GNumAttemptsSinceLastGC = 0;
-
-	// Flush streaming before GC if requested
-	if (GFlushStreamingOnGC && IsAsyncLoading())
+	// When resuming time sliced reachability analysis everything up to marking objects has already been done by the call that started it
+	const bool bContinueIncrementalReachability = UE::GC::GIsIncrementalReachabilityPending;
+	if (bContinueIncrementalReachability)
 	{
-		UE_LOG(LogGarbage, Log, TEXT("CollectGarbageInternal() is flushing async loading"));
-		ReleaseGCLock();
-		FlushAsyncLoading();
-		AcquireGCLock();
+		KeepFlags = GIncrementalReachability.KeepFlags;
 	}
-
-	// Route callbacks so we can ensure that we are e.g. not in the middle of loading something by flushing
-	// the async loading, etc...
+	else
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(BroadcastPreGarbageCollect);
-		FCoreUObjectDelegates::GetPreGarbageCollectDelegate().Broadcast();
+		// Reset GC skip counter
+		GNumAttemptsSinceLastGC = 0;
+
+		// Flush streaming before GC if requested
+		if (GFlushStreamingOnGC && IsAsyncLoading())
+		{
+			UE_LOG(LogGarbage, Log, TEXT("CollectGarbageInternal() is flushing async loading"));
+			ReleaseGCLock();
+			FlushAsyncLoading();
+			AcquireGCLock();
+		}
+
+		// Route callbacks so we can ensure that we are e.g. not in the middle of loading something by flushing
+		// the async loading, etc...
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(BroadcastPreGarbageCollect);
+			FCoreUObjectDelegates::GetPreGarbageCollectDelegate().Broadcast();
+		}
+		GLastGCFrame = GFrameCounter;
 	}
-	GLastGCFrame = GFrameCounter;
 
 	{
 		// Set 'I'm garbage collecting' flag - might be checked inside various functions.
@@ -2290,16 +2926,19 @@ void CollectGarbageInternal(EObjectFlags KeepFlags, bool bPerformFullPurge)
 		FGCLegacyHashTableScopeLock GCLegacyHashTableLock;
 		TGuardValue<bool> GuardIsGarbageCollecting(GIsGarbageCollecting, true);
 
-		UE_LOG(LogGarbage, Log, TEXT("Collecting garbage%s"), IsAsyncLoading() ? TEXT(" while async loading") : TEXT(""));
-
-		// Make sure previous incremental purge has finished or we do a full purge pass in case we haven't kicked one
-		// off yet since the last call to garbage collection.
-		if (GObjIncrementalPurgeIsInProgress || GObjPurgeIsRequired)
+		if (!bContinueIncrementalReachability)
 		{
-			IncrementalPurgeGarbage(false);
-			if (!bPerformFullPurge)
+			UE_LOG(LogGarbage, Log, TEXT("Collecting garbage%s"), IsAsyncLoading() ? TEXT(" while async loading") : TEXT(""));
+
+			// Make sure previous incremental purge has finished or we do a full purge pass in case we haven't kicked one
+			// off yet since the last call to garbage collection.
+			if (GObjIncrementalPurgeIsInProgress || GObjPurgeIsRequired)
 			{
-				FMemory::Trim();
+				IncrementalPurgeGarbage(false);
+				if (!bPerformFullPurge)
+				{
+					FMemory::Trim();
+				}
 			}
 		}
 
@@ -2313,14 +2952,14 @@ void CollectGarbageInternal(EObjectFlags KeepFlags, bool bPerformFullPurge)
 			check(!GObjPurgeIsRequired);
 
 			// This can happen if someone disables clusters from the console (gc.CreateGCClusters)
-			if (!GCreateGCClusters && GUObjectClusters.GetNumAllocatedClusters())
+			if (!bContinueIncrementalReachability && !GCreateGCClusters && GUObjectClusters.GetNumAllocatedClusters())
 			{
 				GUObjectClusters.DissolveClusters(true);
 			}
 
 #if VERIFY_DISREGARD_GC_ASSUMPTIONS
 			// Only verify assumptions if option is enabled. This avoids false positives in the Editor or commandlets.
-			if (GShouldVerifyGCAssumptions)
+			if (GShouldVerifyGCAssumptions && !bContinueIncrementalReachability)
 			{
 				DECLARE_SCOPE_CYCLE_COUNTER(TEXT("CollectGarbageInternal.VerifyGCAssumptions"), STAT_CollectGarbageInternal_VerifyGCAssumptions, STATGROUP_GC);
 				const double StartTime = FPlatformTime::Seconds();
@@ -2337,7 +2976,7 @@ void CollectGarbageInternal(EObjectFlags KeepFlags, bool bPerformFullPurge)
 			}
 #endif
 
-			const EFastReferenceCollectorOptions Options = 
+			const EFastReferenceCollectorOptions Options = bContinueIncrementalReachability ? GIncrementalReachability.Options :
 				// Fall back to single threaded GC if processor count is 1 or parallel GC is disabled
 				// or detailed per class gc stats are enabled (not thread safe)
 				(ShouldForceSingleThreadedGC() ? EFastReferenceCollectorOptions::None : EFastReferenceCollectorOptions::Parallel) |
@@ -2351,8 +2990,35 @@ void CollectGarbageInternal(EObjectFlags KeepFlags, bool bPerformFullPurge)
 				const double StartTime = FPlatformTime::Seconds();
 				FRealtimeGC TagUsedRealtimeGC;
 
-				TagUsedRealtimeGC.PerformReachabilityAnalysis(KeepFlags, Options);
-				UE_LOG(LogGarbage, Log, TEXT("%f ms for GC"), (FPlatformTime::Seconds() - StartTime) * 1000);
+				if (bContinueIncrementalReachability)
+				{
+					// A full purge can't wait for the remaining time slices
+					if (!TagUsedRealtimeGC.ContinueIncrementalReachabilityAnalysis(bPerformFullPurge ? 0.0 : IncrementalReachabilityTimeLimit))
+					{
+						SuspendIncrementalReachabilityAnalysis();
+						return;
+					}
+				}
+				else if (ShouldPerformMinorCollection(bPerformFullPurge))
+				{
+					GNumMinorGCsSinceLastMajorGC++;
+					TagUsedRealtimeGC.PerformReachabilityAnalysis(KeepFlags, Options, true);
+					UE_LOG(LogGarbage, Log, TEXT("%f ms for GC (minor collection)"), (FPlatformTime::Seconds() - StartTime) * 1000);
+				}
+				else if (ShouldStartIncrementalReachabilityAnalysis(bPerformFullPurge))
+				{
+					// Only marking objects as maybe unreachable happens in a single step, their references are processed in the next frames
+					GNumMinorGCsSinceLastMajorGC = 0;
+					TagUsedRealtimeGC.StartIncrementalReachabilityAnalysis(KeepFlags, Options);
+					SuspendIncrementalReachabilityAnalysis();
+					return;
+				}
+				else
+				{
+					GNumMinorGCsSinceLastMajorGC = 0;
+					TagUsedRealtimeGC.PerformReachabilityAnalysis(KeepFlags, Options);
+					UE_LOG(LogGarbage, Log, TEXT("%f ms for GC"), (FPlatformTime::Seconds() - StartTime) * 1000);
+				}
 			}
 
 			FGCArrayPool& ArrayPool = FGCArrayPool::Get();
@@ -2373,6 +3039,9 @@ void CollectGarbageInternal(EObjectFlags KeepFlags, bool bPerformFullPurge)
 
 			GatherUnreachableObjects(!(Options & EFastReferenceCollectorOptions::Parallel));
 
+			// Everything that is still reachable now becomes tenured for the next minor collections
+			PromoteReachableObjects(!(Options & EFastReferenceCollectorOptions::Parallel));
+
 			// This needs to happen after GatherUnreachableObjects since it can mark more objects as unreachable
 			ArrayPool.ClearWeakReferences(AllArrays);
 
@@ -2723,6 +3392,40 @@ bool TryCollectGarbage(EObjectFlags KeepFlags, bool bPerformFullPurge)
 #endif
 }
 
+bool PerformIncrementalReachabilityAnalysis(double TimeLimit)
+{
+#if !UE_WITH_GC
+	return false;
+#else
+	if (!UE::GC::GIsIncrementalReachabilityPending)
+	{
+		return false;
+	}
+
+	// Don't wait for other threads performing UObject operations, the analysis will be resumed next time
+	if (TimeLimit > 0.0 && !FGCCSyncObject::Get().TryGCLock())
+	{
+		return true;
+	}
+	else if (TimeLimit <= 0.0)
+	{
+		AcquireGCLock();
+	}
+
+	// Resumes reachability analysis and performs the rest of garbage collection if it completes
+	CollectGarbageInternal(GIncrementalReachability.KeepFlags, /*bPerformFullPurge = */ false, TimeLimit);
+
+	if (GGCLockBehavior == FGCLockBehavior::Legacy)
+	{
+		// Release the GC lock to allow async loading and other threads to perform UObject operations under the FGCScopeGuard.
+		ReleaseGCLock();
+	}
+	// With the new FGCLockBehavior::Default behavior the lock was released inside CollectGarbageInternal
+
+	return UE::GC::GIsIncrementalReachabilityPending;
+#endif
+}
+
 void UObject::CallAddReferencedObjects(FReferenceCollector& Collector)
 {
 	GetClass()->CallAddReferencedObjects(this, Collector);
@@ -8,6 +8,7 @@
 #include "UObject/UnrealTypePrivate.h"
 #include "UObject/LinkerLoad.h"
 #include "UObject/PropertyHelper.h"
+#include "Serialization/UnversionedPropertySerialization.h"
 
 /*-----------------------------------------------------------------------------
 	FArrayProperty.
@@ -115,6 +116,117 @@ static bool CanBulkSerialize(FProperty* Property)
 	return false;
 }
 
+static bool SkipEditorOnlyFields(FArchive& Ar)
+{
+#if WITH_EDITORONLY_DATA
+	return Ar.IsFilterEditorOnly();
+#else
+	return true;
+#endif
+}
+
+// Checks that no property of a bulk serializable struct is skipped by the archive, e.g. by ShouldSkipProperty()
+static bool ShouldSerializeAllValues(const UStruct* Struct, FArchive& Ar)
+{
+	for (FProperty* Property = Struct->PropertyLink; Property; Property = Property->PropertyLinkNext)
+	{
+		if (!Property->ShouldSerializeValue(Ar))
+		{
+			return false;
+		}
+
+		if (FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			if (!ShouldSerializeAllValues(StructProperty->Struct, Ar))
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+// Copies property values of a bulk serializable struct and leaves the padding as is, so saved data is deterministic
+static void CopyBulkStructValues(const UStruct* Struct, uint8* Dest, const uint8* Src)
+{
+	for (FProperty* Property = Struct->PropertyLink; Property; Property = Property->PropertyLinkNext)
+	{
+		const int32 Offset = Property->GetOffset_ForInternal();
+		if (FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			for (int32 Idx = 0; Idx < Property->ArrayDim; ++Idx)
+			{
+				const int32 ElementOffset = Offset + Idx * Property->ElementSize;
+				CopyBulkStructValues(StructProperty->Struct, Dest + ElementOffset, Src + ElementOffset);
+			}
+		}
+		else
+		{
+			FMemory::Memcpy(Dest + Offset, Src + Offset, Property->ElementSize * Property->ArrayDim);
+		}
+	}
+}
+
+/**
+ * Arrays of structs that can be serialized as raw memory, see GetUnversionedBulkStructLayout(), are saved as one block.
+ * A flag says whether the block or separate elements follow, the block is prefixed with the struct layout that is validated on load.
+ */
+static void SerializeStructArrayUnversioned(FStructuredArchive::FSlot Slot, FScriptArrayHelper& ArrayHelper, const FStructProperty* Inner, const FArrayProperty* ArrayProperty)
+{
+	FArchive& UnderlyingArchive = Slot.GetUnderlyingArchive();
+	const uint32 RuntimeLayout = GetUnversionedBulkStructLayout(Inner->Struct, SkipEditorOnlyFields(UnderlyingArchive));
+
+	FStructuredArchiveStream Stream = Slot.EnterStream();
+
+	int32 Num = ArrayHelper.Num();
+	Stream.EnterElement() << Num;
+
+	uint8 bBulk = UnderlyingArchive.IsSaving() && Num > 0 && RuntimeLayout != 0 && ShouldSerializeAllValues(Inner->Struct, UnderlyingArchive);
+	Stream.EnterElement() << bBulk;
+
+	if (UnderlyingArchive.IsLoading())
+	{
+		ArrayHelper.EmptyAndAddValues(Num);
+	}
+
+	if (bBulk)
+	{
+		uint32 Layout = RuntimeLayout;
+		Stream.EnterElement() << Layout;
+
+		const int64 NumBytes = (int64)Num * Inner->ElementSize;
+		if (UnderlyingArchive.IsLoading())
+		{
+			if (Layout != RuntimeLayout)
+			{
+				UE_LOG(LogProperty, Fatal, TEXT("Struct %s in array property %s was saved with a different memory layout, cooked data doesn't match the executable"), *Inner->Struct->GetPathName(), *ArrayProperty->GetFullName());
+			}
+
+			Stream.EnterElement().Serialize(ArrayHelper.GetRawPtr(), NumBytes);
+		}
+		else
+		{
+			TArray64<uint8> Image;
+			Image.AddZeroed(NumBytes);
+			for (int32 Idx = 0; Idx < Num; ++Idx)
+			{
+				CopyBulkStructValues(Inner->Struct, Image.GetData() + (int64)Idx * Inner->ElementSize, ArrayHelper.GetRawPtr(Idx));
+			}
+
+			Stream.EnterElement().Serialize(Image.GetData(), NumBytes);
+		}
+	}
+	else
+	{
+		FSerializedPropertyScope SerializedProperty(UnderlyingArchive, const_cast<FStructProperty*>(Inner), ArrayProperty);
+		for (int32 Idx = 0; Idx < Num; ++Idx)
+		{
+			Inner->SerializeItem(Stream.EnterElement(), ArrayHelper.GetRawPtr(Idx));
+		}
+	}
+}
+
 void FArrayProperty::SerializeItem(FStructuredArchive::FSlot Slot, void* Value, void const* Defaults) const
 {
 	check(Inner);
@@ -150,6 +262,10 @@ void FArrayProperty::SerializeItem(FStructuredArchive::FSlot Slot, void* Value,
 
 			Stream.EnterElement().Serialize(ArrayHelper.GetRawPtr(), n * Inner->ElementSize);
 		}
+		else if (FStructProperty* InnerStruct = CastField<FStructProperty>(Inner))
+		{
+			SerializeStructArrayUnversioned(Slot, ArrayHelper, InnerStruct, this);
+		}
 		else
 		{
 			FStructuredArchiveArray Array = Slot.EnterArray(n);
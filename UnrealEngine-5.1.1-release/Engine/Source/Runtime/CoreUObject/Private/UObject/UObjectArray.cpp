@@ -286,7 +286,11 @@ void FUObjectArray::FreeUObjectIndex(UObjectBase* Object)
 	// This should only be happening on the game thread (GC runs only on game thread when it's freeing objects)
 	check(IsInGameThread() || IsInGarbageCollectorThread());
 
-	// No need to call LockInternalArray(); here as it should already be locked by GC
+#if THREADSAFE_UOBJECTS
+	// Objects with thread safe destructors are destroyed by GC on multiple threads in parallel.
+	// The lock is recursive so it's fine if the game thread already locked the internal array for a batch of objects.
+	FScopeLock ObjObjectsLock(&ObjObjectsCritical);
+#endif
 
 	int32 Index = Object->InternalIndex;
 	FUObjectItem* ObjectItem = IndexToObject(Index);
@@ -451,6 +451,17 @@ UObject* StaticFindObject( UClass* ObjectClass, UObject* InObjectPackage, const
 	}
 #endif	//#if !WITH_EDITOR
 
+	// Full paths can be resolved by the path index without resolving every outer
+	const bool bIsFullPath = !bAnyPackage && !ObjectPackage;
+	if (bIsFullPath)
+	{
+		MatchingObject = FindObjectInPathIndex(OrigInName, ObjectClass, bExactClass);
+		if (MatchingObject)
+		{
+			return MatchingObject;
+		}
+	}
+
 	FName ObjectName;
 
 	// Don't resolve the name if we're searching in any package
@@ -471,8 +482,14 @@ UObject* StaticFindObject( UClass* ObjectClass, UObject* InObjectPackage, const
 		ObjectName = FName(*InName, FNAME_Add);
 	}
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	return StaticFindObjectFast(ObjectClass, ObjectPackage, ObjectName, bExactClass, bAnyPackage);
+	MatchingObject = StaticFindObjectFast(ObjectClass, ObjectPackage, ObjectName, bExactClass, bAnyPackage);
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
+
+	if (bIsFullPath && MatchingObject)
+	{
+		AddObjectToPathIndex(OrigInName, MatchingObject);
+	}
+	return MatchingObject;
 }
 
 //
@@ -5458,6 +5475,11 @@ namespace UECodeGen_Private
 			NewEnum->SetEnumDisplayNameFn(Params.DisplayNameFunc);
 		}
 
+		if (Params.NameHash)
+		{
+			NewEnum->SetNameHash(Params.NameHash);
+		}
+
 #if WITH_METADATA
 		AddMetaData(NewEnum, Params.MetaDataArray, Params.NumMetaData);
 #endif
@@ -5,6 +5,7 @@
 =============================================================================*/
 
 #include "UObject/UObjectHash.h"
+#include "UObject/UObjectHashPrivate.h"
 #include "UObject/Class.h"
 #include "UObject/Package.h"
 #include "Misc/AsciiSet.h"
@@ -13,6 +14,11 @@
 #include "HAL/IConsoleManager.h"
 #include "HAL/LowLevelMemStats.h"
 #include "UObject/AnyPackagePrivate.h"
+#include "Hash/CityHash.h"
+#include "Misc/StringBuilder.h"
+#include "Misc/ScopeRWLock.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include <atomic>
 
 DEFINE_LOG_CATEGORY_STATIC(LogUObjectHash, Log, All);
 
@@ -27,8 +33,22 @@ DECLARE_CYCLE_STAT( TEXT( "UnhashObject" ), STAT_Hash_UnhashObject, STATGROUP_UO
 DEFINE_STAT( STAT_Hash_NumObjects );
 #endif
 
+DECLARE_DWORD_COUNTER_STAT( TEXT( "PathIndex Hits" ), STAT_Hash_PathIndexHits, STATGROUP_UObjectHash );
+DECLARE_DWORD_COUNTER_STAT( TEXT( "PathIndex Misses" ), STAT_Hash_PathIndexMisses, STATGROUP_UObjectHash );
+
 LLM_DEFINE_TAG(UObjectHash, TEXT("UObject hashtables"));
 
+TRACE_DECLARE_INT_COUNTER(UObjectHashLockContention, TEXT("UObject/HashTableLockContention"));
+
+/** Number of times a UObject hash table lock was already taken by another thread, reported as a counter to Insights */
+static std::atomic<int64> GUObjectHashLockContentionCount{ 0 };
+
+static FORCENOINLINE void OnUObjectHashLockContention()
+{
+	const int64 Count = ++GUObjectHashLockContentionCount;
+	TRACE_COUNTER_SET(UObjectHashLockContention, Count);
+}
+
 // Global UObject array instance
 FUObjectArray GUObjectArray;
 
@@ -346,14 +366,32 @@ struct TBucketMapLock
 
 class FUObjectHashTables
 {
-	/** Critical section that guards against concurrent adds from multiple threads */
+	/** Critical section that guards against concurrent adds from multiple threads, guards everything except the name hashes */
 	FCriticalSection CriticalSection;
 
 public:
 
-	/** Hash sets */
-	TBucketMap<int32> Hash;
-	TMultiMap<int32, uint32> HashOuter;
+	/**
+	 * The name hashes are split into shards by object name, each guarded by its own lock. Lookups by name only take the read lock
+	 * of a single shard, so they don't serialize against each other or against objects that are hashed into other shards.
+	 */
+	struct FNameHashShard
+	{
+		FRWLock Lock;
+		TBucketMap<int32> Hash;
+		TMultiMap<int32, uint32> HashOuter;
+	};
+
+	static constexpr uint32 NameHashShardBits = 5;
+	static constexpr int32 NumNameHashShards = 1 << NameHashShardBits;
+	FNameHashShard NameHashShards[NumNameHashShards];
+
+	/** Returns the shard that holds objects with the given name in Hash and HashOuter */
+	FORCEINLINE FNameHashShard& GetNameHashShard(FName ObjectName)
+	{
+		// Fibonacci hashing takes the high bits, so the shard doesn't correlate with the buckets of Hash which use the low bits of the name hash
+		return NameHashShards[(GetTypeHash(ObjectName) * 0x9E3779B9u) >> (32 - NameHashShardBits)];
+	}
 
 	/** Map of object to their outers, used to avoid an object iterator to find such things. **/
 	TBucketMap<UObjectBase*> ObjectOuterMap;
@@ -381,14 +419,20 @@ public:
 			switch (Index)
 			{
 			case 0:
-				Hash.Compact();
-				for (auto& Pair : Hash)
+				for (FNameHashShard& Shard : NameHashShards)
 				{
-					Pair.Value.Compact();
+					Shard.Hash.Compact();
+					for (auto& Pair : Shard.Hash)
+					{
+						Pair.Value.Compact();
+					}
 				}
 				break;
 			case 1:
-				HashOuter.Compact();
+				for (FNameHashShard& Shard : NameHashShards)
+				{
+					Shard.HashOuter.Compact();
+				}
 				break;
 			case 2:
 				ObjectOuterMap.Compact();
@@ -427,10 +471,10 @@ public:
 	}
 
 	/** Checks if the Hash/Object pair exists in the FName hash table */
-	FORCEINLINE bool PairExistsInHash(int32 InHash, UObjectBase* Object)
+	static FORCEINLINE bool PairExistsInHash(FNameHashShard& Shard, int32 InHash, UObjectBase* Object)
 	{
 		bool bResult = false;
-		FHashBucket* Bucket = Hash.Find(InHash);
+		FHashBucket* Bucket = Shard.Hash.Find(InHash);
 		if (Bucket)
 		{
 			bResult = Bucket->Contains(Object);
@@ -438,22 +482,22 @@ public:
 		return bResult;
 	}
 	/** Adds the Hash/Object pair to the FName hash table */
-	FORCEINLINE void AddToHash(int32 InHash, UObjectBase* Object)
+	static FORCEINLINE void AddToHash(FNameHashShard& Shard, int32 InHash, UObjectBase* Object)
 	{
-		FHashBucket& Bucket = Hash.FindOrAdd(InHash);
+		FHashBucket& Bucket = Shard.Hash.FindOrAdd(InHash);
 		Bucket.Add(Object);
 	}
 	/** Removes the Hash/Object pair from the FName hash table */
-	FORCEINLINE int32 RemoveFromHash(int32 InHash, UObjectBase* Object)
+	static FORCEINLINE int32 RemoveFromHash(FNameHashShard& Shard, int32 InHash, UObjectBase* Object)
 	{
 		int32 NumRemoved = 0;
-		FHashBucket* Bucket = Hash.Find(InHash);
+		FHashBucket* Bucket = Shard.Hash.Find(InHash);
 		if (Bucket)
 		{
 			NumRemoved = Bucket->Remove(Object);
 			if (Bucket->Num() == 0)
 			{
-				Hash.Remove(InHash);
+				Shard.Hash.Remove(InHash);
 			}
 		}
 		return NumRemoved;
@@ -461,7 +505,11 @@ public:
 
 	FORCEINLINE void Lock()
 	{
-		CriticalSection.Lock();
+		if (!CriticalSection.TryLock())
+		{
+			OnUObjectHashLockContention();
+			CriticalSection.Lock();
+		}
 	}
 
 	FORCEINLINE void Unlock()
@@ -469,6 +517,43 @@ public:
 		CriticalSection.Unlock();
 	}
 
+	/** Locks everything, including all name hash shards. Can be called recursively like Lock(). */
+	void LockAll()
+	{
+		Lock();
+		if (ThreadLockAllDepth++ == 0)
+		{
+			for (FNameHashShard& Shard : NameHashShards)
+			{
+				Shard.Lock.WriteLock();
+			}
+		}
+	}
+
+	void UnlockAll()
+	{
+		check(ThreadLockAllDepth > 0);
+		if (--ThreadLockAllDepth == 0)
+		{
+			for (int32 ShardIndex = NumNameHashShards - 1; ShardIndex >= 0; --ShardIndex)
+			{
+				NameHashShards[ShardIndex].Lock.WriteUnlock();
+			}
+		}
+		Unlock();
+	}
+
+	/** True if the calling thread holds all locks through LockAll(), shards don't need to be locked again then */
+	static FORCEINLINE bool ThreadHoldsAllLocks()
+	{
+		return ThreadLockAllDepth > 0;
+	}
+
+private:
+	static thread_local int32 ThreadLockAllDepth;
+
+public:
+
 	static FUObjectHashTables& Get()
 	{
 		static FUObjectHashTables Singleton;
@@ -476,6 +561,8 @@ public:
 	}
 };
 
+thread_local int32 FUObjectHashTables::ThreadLockAllDepth = 0;
+
 class FHashTableLock
 {
 #if THREADSAFE_UOBJECTS
@@ -509,6 +596,48 @@ public:
 	}
 };
 
+/** Locks a single name hash shard, for reading if only Hash and HashOuter of the shard are searched */
+template <bool bWrite>
+class TNameHashShardLock
+{
+#if THREADSAFE_UOBJECTS
+	FRWLock* Lock;
+#endif
+public:
+	FORCEINLINE TNameHashShardLock(FUObjectHashTables::FNameHashShard& Shard)
+	{
+#if THREADSAFE_UOBJECTS
+		if (!(IsGarbageCollectingAndLockingUObjectHashTables() && IsInGameThread()) && !FUObjectHashTables::ThreadHoldsAllLocks())
+		{
+			Lock = &Shard.Lock;
+			if (bWrite ? !Lock->TryWriteLock() : !Lock->TryReadLock())
+			{
+				OnUObjectHashLockContention();
+				bWrite ? Lock->WriteLock() : Lock->ReadLock();
+			}
+		}
+		else
+		{
+			Lock = nullptr;
+		}
+#else
+		check(IsInGameThread());
+#endif
+	}
+	FORCEINLINE ~TNameHashShardLock()
+	{
+#if THREADSAFE_UOBJECTS
+		if (Lock)
+		{
+			bWrite ? Lock->WriteUnlock() : Lock->ReadUnlock();
+		}
+#endif
+	}
+};
+
+using FNameHashReadLock = TNameHashShardLock<false>;
+using FNameHashWriteLock = TNameHashShardLock<true>;
+
 /**
  * Calculates the object's hash just using the object's name index
  *
@@ -539,8 +668,9 @@ UObject* StaticFindObjectFastExplicitThreadSafe(FUObjectHashTables& ThreadHash,
 
 	// Find an object with the specified name and (optional) class, in any package; if bAnyPackage is false, only matches top-level packages
 	int32 Hash = GetObjectHash(ObjectName);
-	FHashTableLock HashLock(ThreadHash);
-	FHashBucket* Bucket = ThreadHash.Hash.Find(Hash);
+	FUObjectHashTables::FNameHashShard& Shard = ThreadHash.GetNameHashShard(ObjectName);
+	FNameHashReadLock HashLock(Shard);
+	FHashBucket* Bucket = Shard.Hash.Find(Hash);
 	if (Bucket)
 	{
 		for (FHashBucketIterator It(*Bucket); It; ++It)
@@ -595,6 +725,113 @@ UObject* StaticFindObjectFastExplicit( const UClass* ObjectClass, FName ObjectNa
 	return Result;
 }
 
+static int32 GPathIndexSize = 0;
+static FAutoConsoleVariableRef CVarPathIndexSize(
+	TEXT("UObject.PathIndexSize"),
+	GPathIndexSize,
+	TEXT("Number of slots (rounded up to a power of two) of the full path index used by FindObject and soft object path resolution, 0 disables it. Read when the index is first used."),
+	ECVF_Default
+);
+
+/**
+ * Direct-mapped cache of full object paths to objects, used to resolve full paths without walking the outer chain and
+ * creating FNames for every path element. Each slot packs the index and serial number of an object in GUObjectArray, so
+ * readers never lock. Entries are validated when they're read: destroyed objects fail the serial number check and renamed
+ * objects (or objects with a renamed outer) fail the path check, so renames and destruction don't need to update the index.
+ */
+class FObjectPathIndex
+{
+public:
+	static FObjectPathIndex* Get()
+	{
+		static FObjectPathIndex* Singleton = GPathIndexSize > 0 ? new FObjectPathIndex(GPathIndexSize) : nullptr;
+		return Singleton;
+	}
+
+	UObject* Find(const TCHAR* PathName, const UClass* ObjectClass, bool bExactClass) const
+	{
+		const uint64 Packed = GetSlot(PathName).load(std::memory_order_acquire);
+		const int32 ObjectIndex = (int32)(Packed >> 32);
+		const int32 SerialNumber = (int32)(Packed & 0xffffffff);
+
+		if (SerialNumber != 0 && ObjectIndex < GUObjectArray.GetObjectArrayNum())
+		{
+			const FUObjectItem* ObjectItem = GUObjectArray.IndexToObject(ObjectIndex);
+			UObject* Object = ObjectItem ? static_cast<UObject*>(ObjectItem->Object) : nullptr;
+			if (Object && ObjectItem->GetSerialNumber() == SerialNumber && !ObjectItem->IsUnreachable()
+				&& (ObjectClass == nullptr || (bExactClass ? Object->GetClass() == ObjectClass : Object->IsA(ObjectClass)))
+				&& HasPathName(Object, PathName))
+			{
+				return Object;
+			}
+		}
+
+		return nullptr;
+	}
+
+	void Add(const TCHAR* PathName, UObject* Object)
+	{
+		// Only index objects by their canonical path, so that hits can be validated with a plain string compare
+		if (!HasPathName(Object, PathName))
+		{
+			return;
+		}
+
+		const int32 ObjectIndex = GUObjectArray.ObjectToIndex(Object);
+		const int32 SerialNumber = GUObjectArray.AllocateSerialNumber(ObjectIndex);
+		GetSlot(PathName).store(((uint64)ObjectIndex << 32) | (uint32)SerialNumber, std::memory_order_release);
+	}
+
+private:
+	explicit FObjectPathIndex(int32 InSize)
+		: NumSlots(FMath::RoundUpToPowerOfTwo(InSize))
+		, Slots(new std::atomic<uint64>[NumSlots])
+	{
+		for (uint32 Idx = 0; Idx < NumSlots; ++Idx)
+		{
+			Slots[Idx].store(0, std::memory_order_relaxed);
+		}
+	}
+
+	std::atomic<uint64>& GetSlot(const TCHAR* PathName) const
+	{
+		const uint64 Hash = CityHash64(reinterpret_cast<const char*>(PathName), FCString::Strlen(PathName) * sizeof(TCHAR));
+		return Slots[Hash & (NumSlots - 1)];
+	}
+
+	static bool HasPathName(const UObject* Object, const TCHAR* PathName)
+	{
+		TStringBuilder<FName::StringBufferSize> ObjectPathName;
+		Object->GetPathName(nullptr, ObjectPathName);
+		return FCString::Strcmp(*ObjectPathName, PathName) == 0;
+	}
+
+	const uint32 NumSlots;
+	TUniquePtr<std::atomic<uint64>[]> Slots;
+};
+
+UObject* FindObjectInPathIndex(const TCHAR* PathName, const UClass* ObjectClass, bool bExactClass)
+{
+	if (const FObjectPathIndex* PathIndex = FObjectPathIndex::Get())
+	{
+		if (UObject* Object = PathIndex->Find(PathName, ObjectClass, bExactClass))
+		{
+			INC_DWORD_STAT(STAT_Hash_PathIndexHits);
+			return Object;
+		}
+		INC_DWORD_STAT(STAT_Hash_PathIndexMisses);
+	}
+	return nullptr;
+}
+
+void AddObjectToPathIndex(const TCHAR* PathName, UObject* Object)
+{
+	if (FObjectPathIndex* PathIndex = FObjectPathIndex::Get())
+	{
+		PathIndex->Add(PathName, Object);
+	}
+}
+
 static bool NameEndsWith(FName Name, FName Suffix)
 {
 	if (Name == Suffix)
@@ -706,39 +943,42 @@ UObject* StaticFindObjectFastInternalThreadSafe(FUObjectHashTables& ThreadHash,
 	if (ObjectPackage != nullptr)
 	{
 		int32 Hash = GetObjectOuterHash(ObjectName, (PTRINT)ObjectPackage);
-		FHashTableLock HashLock(ThreadHash);
-		for (TMultiMap<int32, uint32>::TConstKeyIterator HashIt(ThreadHash.HashOuter, Hash); HashIt; ++HashIt)
 		{
-			uint32 InternalIndex = HashIt.Value();
-			UObject* Object = static_cast<UObject*>(GUObjectArray.IndexToObject(InternalIndex)->Object);
-			if
-				/* check that the name matches the name we're searching for */
-				((Object->GetFName() == ObjectName)
+			FUObjectHashTables::FNameHashShard& Shard = ThreadHash.GetNameHashShard(ObjectName);
+			FNameHashReadLock HashLock(Shard);
+			for (TMultiMap<int32, uint32>::TConstKeyIterator HashIt(Shard.HashOuter, Hash); HashIt; ++HashIt)
+			{
+				uint32 InternalIndex = HashIt.Value();
+				UObject* Object = static_cast<UObject*>(GUObjectArray.IndexToObject(InternalIndex)->Object);
+				if
+					/* check that the name matches the name we're searching for */
+					((Object->GetFName() == ObjectName)
 
-				/* Don't return objects that have any of the exclusive flags set */
-				&& !Object->HasAnyFlags(ExcludeFlags)
+					/* Don't return objects that have any of the exclusive flags set */
+					&& !Object->HasAnyFlags(ExcludeFlags)
 
-				/* check that the object has the correct Outer */
-				&& Object->GetOuter() == ObjectPackage
+					/* check that the object has the correct Outer */
+					&& Object->GetOuter() == ObjectPackage
 
-				/** If a class was specified, check that the object is of the correct class */
-				&& (ObjectClass == nullptr || (bExactClass ? Object->GetClass() == ObjectClass : Object->IsA(ObjectClass)))
+					/** If a class was specified, check that the object is of the correct class */
+					&& (ObjectClass == nullptr || (bExactClass ? Object->GetClass() == ObjectClass : Object->IsA(ObjectClass)))
 				
-				/** Include (or not) pending kill objects */
-				&& !Object->HasAnyInternalFlags(ExclusiveInternalFlags))
-			{
-				checkf(!Object->IsUnreachable(), TEXT("%s"), *Object->GetFullName());
-				if (Result)
-				{
-					UE_LOG(LogUObjectHash, Warning, TEXT("Ambiguous search, could be %s or %s"), *GetFullNameSafe(Result), *GetFullNameSafe(Object));
-				}
-				else
+					/** Include (or not) pending kill objects */
+					&& !Object->HasAnyInternalFlags(ExclusiveInternalFlags))
 				{
-					Result = Object;
-				}
+					checkf(!Object->IsUnreachable(), TEXT("%s"), *Object->GetFullName());
+					if (Result)
+					{
+						UE_LOG(LogUObjectHash, Warning, TEXT("Ambiguous search, could be %s or %s"), *GetFullNameSafe(Result), *GetFullNameSafe(Object));
+					}
+					else
+					{
+						Result = Object;
+					}
 #if (UE_BUILD_SHIPPING || UE_BUILD_TEST)
-				break;
+					break;
 #endif
+				}
 			}
 		}
 
@@ -746,6 +986,7 @@ UObject* StaticFindObjectFastInternalThreadSafe(FUObjectHashTables& ThreadHash,
 		// if the search fail and the OuterPackage is a UPackage, lookup potential external package
 		if (Result == nullptr && ObjectPackage->IsA(UPackage::StaticClass()))
 		{
+			FHashTableLock HashLock(ThreadHash);
 			Result = StaticFindObjectInPackageInternal(ThreadHash, ObjectClass, static_cast<const UPackage*>(ObjectPackage), ObjectName, bExactClass, ExcludeFlags, ExclusiveInternalFlags);
 		}
 #endif
@@ -755,9 +996,10 @@ UObject* StaticFindObjectFastInternalThreadSafe(FUObjectHashTables& ThreadHash,
 		FObjectSearchPath SearchPath(ObjectName);
 
 		const int32 Hash = GetObjectHash(SearchPath.Inner);
-		FHashTableLock HashLock(ThreadHash);
+		FUObjectHashTables::FNameHashShard& Shard = ThreadHash.GetNameHashShard(SearchPath.Inner);
+		FNameHashReadLock HashLock(Shard);
 
-		FHashBucket* Bucket = ThreadHash.Hash.Find(Hash);
+		FHashBucket* Bucket = Shard.Hash.Find(Hash);
 		if (Bucket)
 		{
 			for (FHashBucketIterator It(*Bucket); It; ++It)
@@ -834,9 +1076,10 @@ bool DoesObjectPossiblyExist(const UObject* InOuter, FName ObjectName)
 	FUObjectHashTables& ThreadHash = FUObjectHashTables::Get();
 	check(InOuter != nullptr);
 	int32 Hash = GetObjectOuterHash(ObjectName, (PTRINT)InOuter);
-	FHashTableLock HashLock(ThreadHash);
+	FUObjectHashTables::FNameHashShard& Shard = ThreadHash.GetNameHashShard(ObjectName);
+	FNameHashReadLock HashLock(Shard);
 	// We don't need to iterate the multimap here as we are happy with false positives.
-	return ThreadHash.HashOuter.Contains(Hash);
+	return Shard.HashOuter.Contains(Hash);
 }
 
 bool StaticFindAllObjectsFastInternal(TArray<UObject*>& OutFoundObjects, const UClass* ObjectClass, FName ObjectName, bool bExactClass, EObjectFlags ExcludeFlags, EInternalObjectFlags ExclusiveInternalFlags)
@@ -850,9 +1093,10 @@ bool StaticFindAllObjectsFastInternal(TArray<UObject*>& OutFoundObjects, const U
 	uint32 NumFoundObjects = 0; // Keeping track of the number of objects foundn. We allow OutFoundObjects to not be empty
 
 	FUObjectHashTables& ThreadHash = FUObjectHashTables::Get();
-	FHashTableLock HashLock(ThreadHash);
+	FUObjectHashTables::FNameHashShard& Shard = ThreadHash.GetNameHashShard(SearchPath.Inner);
+	FNameHashReadLock HashLock(Shard);
 
-	FHashBucket* Bucket = ThreadHash.Hash.Find(Hash);
+	FHashBucket* Bucket = Shard.Hash.Find(Hash);
 	if (Bucket)
 	{
 		for (FHashBucketIterator It(*Bucket); It; ++It)
@@ -895,9 +1139,10 @@ UObject* StaticFindFirstObjectFastInternal(const UClass* ObjectClass, FName Obje
 	uint32 NumFoundObjects = 0; // Keeping track of the number of objects found. We allow OutFoundObjects to not be empty
 
 	FUObjectHashTables& ThreadHash = FUObjectHashTables::Get();
-	FHashTableLock HashLock(ThreadHash);
+	FUObjectHashTables::FNameHashShard& Shard = ThreadHash.GetNameHashShard(SearchPath.Inner);
+	FNameHashReadLock HashLock(Shard);
 
-	FHashBucket* Bucket = ThreadHash.Hash.Find(Hash);
+	FHashBucket* Bucket = Shard.Hash.Find(Hash);
 	if (Bucket)
 	{
 		for (FHashBucketIterator It(*Bucket); It; ++It)
@@ -1061,9 +1306,8 @@ void ShrinkUObjectHashTables()
 {
 	LLM_SCOPE_BYTAG(UObjectHash);
 	TRACE_CPUPROFILER_EVENT_SCOPE(ShrinkUObjectHashTables);
-	FUObjectHashTables& ThreadHash = FUObjectHashTables::Get();
-	FHashTableLock HashLock(ThreadHash);
-	ThreadHash.ShrinkMaps();
+	FScopedUObjectHashTablesLock HashTablesLock;
+	FUObjectHashTables::Get().ShrinkMaps();
 }
 
 uint64 GetRegisteredClassesVersionNumber()
@@ -1483,23 +1727,31 @@ void HashObject(UObjectBase* Object)
 		FUObjectHashTables& ThreadHash = FUObjectHashTables::Get();
 		FHashTableLock HashLock(ThreadHash);
 
-		Hash = GetObjectHash(Name);
+		{
+			FUObjectHashTables::FNameHashShard& Shard = ThreadHash.GetNameHashShard(Name);
+			FNameHashWriteLock ShardLock(Shard);
+
+			Hash = GetObjectHash(Name);
 #if !UE_BUILD_TEST && !UE_BUILD_SHIPPING
-		// if it already exists, something is wrong with the external code
-		UE_CLOG(ThreadHash.PairExistsInHash(Hash, Object), LogUObjectHash, Fatal, TEXT("%s already exists in UObject hash!"), *GetFullNameSafe((UObjectBaseUtility*)Object));
+			// if it already exists, something is wrong with the external code
+			UE_CLOG(FUObjectHashTables::PairExistsInHash(Shard, Hash, Object), LogUObjectHash, Fatal, TEXT("%s already exists in UObject hash!"), *GetFullNameSafe((UObjectBaseUtility*)Object));
 #endif
-		ThreadHash.AddToHash(Hash, Object);
+			FUObjectHashTables::AddToHash(Shard, Hash, Object);
 
-		if (PTRINT Outer = (PTRINT)Object->GetOuter())
-		{
-			Hash = GetObjectOuterHash(Name, Outer);
-			checkSlow(!ThreadHash.HashOuter.FindPair(Hash, Object->GetUniqueID()));
+			if (PTRINT Outer = (PTRINT)Object->GetOuter())
+			{
+				Hash = GetObjectOuterHash(Name, Outer);
+				checkSlow(!Shard.HashOuter.FindPair(Hash, Object->GetUniqueID()));
 #if !UE_BUILD_TEST && !UE_BUILD_SHIPPING
-			// if it already exists, something is wrong with the external code
-			UE_CLOG(ThreadHash.HashOuter.FindPair(Hash, Object->GetUniqueID()), LogUObjectHash, Fatal, TEXT("%s already exists in UObject Outer hash!"), *GetFullNameSafe((UObjectBaseUtility*)Object));
+				// if it already exists, something is wrong with the external code
+				UE_CLOG(Shard.HashOuter.FindPair(Hash, Object->GetUniqueID()), LogUObjectHash, Fatal, TEXT("%s already exists in UObject Outer hash!"), *GetFullNameSafe((UObjectBaseUtility*)Object));
 #endif
-			ThreadHash.HashOuter.Add(Hash, Object->GetUniqueID());
+				Shard.HashOuter.Add(Hash, Object->GetUniqueID());
+			}
+		}
 
+		if (Object->GetOuter())
+		{
 			AddToOuterMap(ThreadHash, Object);
 		}
 
@@ -1527,20 +1779,28 @@ void UnhashObject(UObjectBase* Object)
 		FUObjectHashTables& ThreadHash = FUObjectHashTables::Get();
 		FHashTableLock LockHash(ThreadHash);
 
-		Hash = GetObjectHash(Name);
-		NumRemoved = ThreadHash.RemoveFromHash(Hash, Object);
-
-		// must have existed, else something is wrong with the external code
-		UE_CLOG(NumRemoved != 1, LogUObjectHash, Fatal, TEXT("Internal Error: RemoveFromHash NumRemoved = %d  for %s"), NumRemoved, *GetFullNameSafe((UObjectBaseUtility*)Object));
-
-		if (PTRINT Outer = (PTRINT)Object->GetOuter())
 		{
-			Hash = GetObjectOuterHash(Name, Outer);
-			NumRemoved = ThreadHash.HashOuter.RemoveSingle(Hash, Object->GetUniqueID());
+			FUObjectHashTables::FNameHashShard& Shard = ThreadHash.GetNameHashShard(Name);
+			FNameHashWriteLock ShardLock(Shard);
+
+			Hash = GetObjectHash(Name);
+			NumRemoved = FUObjectHashTables::RemoveFromHash(Shard, Hash, Object);
 
 			// must have existed, else something is wrong with the external code
-			UE_CLOG(NumRemoved != 1, LogUObjectHash, Fatal, TEXT("Internal Error: Remove from HashOuter NumRemoved = %d  for %s"), NumRemoved, *GetFullNameSafe((UObjectBaseUtility*)Object));
+			UE_CLOG(NumRemoved != 1, LogUObjectHash, Fatal, TEXT("Internal Error: RemoveFromHash NumRemoved = %d  for %s"), NumRemoved, *GetFullNameSafe((UObjectBaseUtility*)Object));
+
+			if (PTRINT Outer = (PTRINT)Object->GetOuter())
+			{
+				Hash = GetObjectOuterHash(Name, Outer);
+				NumRemoved = Shard.HashOuter.RemoveSingle(Hash, Object->GetUniqueID());
+
+				// must have existed, else something is wrong with the external code
+				UE_CLOG(NumRemoved != 1, LogUObjectHash, Fatal, TEXT("Internal Error: Remove from HashOuter NumRemoved = %d  for %s"), NumRemoved, *GetFullNameSafe((UObjectBaseUtility*)Object));
+			}
+		}
 
+		if (Object->GetOuter())
+		{
 			RemoveFromOuterMap(ThreadHash, Object);
 		}
 
@@ -1602,7 +1862,7 @@ UPackage* GetObjectExternalPackageInternal(const UObjectBase* Object)
 void LockUObjectHashTables()
 {
 #if THREADSAFE_UOBJECTS
-	FUObjectHashTables::Get().Lock();
+	FUObjectHashTables::Get().LockAll();
 #else
 	check(IsInGameThread());
 #endif
@@ -1614,7 +1874,7 @@ void LockUObjectHashTables()
 void UnlockUObjectHashTables()
 {
 #if THREADSAFE_UOBJECTS
-	FUObjectHashTables::Get().Unlock();
+	FUObjectHashTables::Get().UnlockAll();
 #else
 	check(IsInGameThread());
 #endif
@@ -1761,9 +2021,12 @@ void LogHashStatistics(FOutputDevice& Ar, const bool bShowHashBucketCollisionInf
 	Ar.Logf(TEXT("Hash efficiency statistics for the Object Hash"));
 	Ar.Logf(TEXT("-------------------------------------------------"));
 	Ar.Logf(TEXT(""));
-	FHashTableLock HashLock(FUObjectHashTables::Get());
-	LogHashStatisticsInternal(FUObjectHashTables::Get().Hash, Ar, bShowHashBucketCollisionInfo);
-	Ar.Logf(TEXT(""));
+	for (FUObjectHashTables::FNameHashShard& Shard : FUObjectHashTables::Get().NameHashShards)
+	{
+		FNameHashReadLock HashLock(Shard);
+		LogHashStatisticsInternal(Shard.Hash, Ar, bShowHashBucketCollisionInfo);
+		Ar.Logf(TEXT(""));
+	}
 }
 
 void LogHashOuterStatistics(FOutputDevice& Ar, const bool bShowHashBucketCollisionInfo)
@@ -1771,9 +2034,14 @@ void LogHashOuterStatistics(FOutputDevice& Ar, const bool bShowHashBucketCollisi
 	Ar.Logf(TEXT("Hash efficiency statistics for the Outer Object Hash"));
 	Ar.Logf(TEXT("-------------------------------------------------"));
 	Ar.Logf(TEXT(""));
+	for (FUObjectHashTables::FNameHashShard& Shard : FUObjectHashTables::Get().NameHashShards)
+	{
+		FNameHashReadLock HashLock(Shard);
+		LogHashStatisticsInternal(Shard.HashOuter, Ar, bShowHashBucketCollisionInfo);
+		Ar.Logf(TEXT(""));
+	}
+
 	FHashTableLock HashLock(FUObjectHashTables::Get());
-	LogHashStatisticsInternal(FUObjectHashTables::Get().HashOuter, Ar, bShowHashBucketCollisionInfo);
-	Ar.Logf(TEXT(""));
 
 	uint32 HashOuterMapSize = 0;
 	for (TPair<UObjectBase*, FHashBucket>& OuterMapEntry : FUObjectHashTables::Get().ObjectOuterMap)
@@ -1795,10 +2063,15 @@ void LogHashMemoryOverheadStatistics(FOutputDevice& Ar, const bool bShowIndividu
 	int64 TotalSize = 0;
 	
 	{
-		int64 Size = HashTables.Hash.GetAllocatedSize();
-		for (const TPair<int32, FHashBucket>& Pair : HashTables.Hash)
+		int64 Size = 0;
+		for (FUObjectHashTables::FNameHashShard& Shard : HashTables.NameHashShards)
 		{
-			Size += Pair.Value.GetItemsSize();
+			FNameHashReadLock ShardLock(Shard);
+			Size += Shard.Hash.GetAllocatedSize();
+			for (const TPair<int32, FHashBucket>& Pair : Shard.Hash)
+			{
+				Size += Pair.Value.GetItemsSize();
+			}
 		}
 		if (bShowIndividualStats)
 		{
@@ -1808,7 +2081,12 @@ void LogHashMemoryOverheadStatistics(FOutputDevice& Ar, const bool bShowIndividu
 	}
 
 	{
-		int64 Size = HashTables.HashOuter.GetAllocatedSize();
+		int64 Size = 0;
+		for (FUObjectHashTables::FNameHashShard& Shard : HashTables.NameHashShards)
+		{
+			FNameHashReadLock ShardLock(Shard);
+			Size += Shard.HashOuter.GetAllocatedSize();
+		}
 		if (bShowIndividualStats)
 		{
 			Ar.Logf(TEXT("Memory used by UObject Outer Hash: %lld bytes."), Size);
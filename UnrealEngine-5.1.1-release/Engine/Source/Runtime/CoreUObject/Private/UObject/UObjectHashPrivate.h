@@ -17,3 +17,18 @@
  * @return	Returns a true if the object may possibly exist, false if it definitely does not exist.
  */
 bool DoesObjectPossiblyExist(const UObject* InOuter, FName ObjectName);
+
+/**
+ * Looks up an object by its full path name in the optional path index, see UObject.PathIndexSize.
+ *
+ * @param	PathName		Full path name of the object, as returned by GetPathName()
+ * @param	ObjectClass		The to be found object's class
+ * @param	bExactClass		Whether to require an exact match with the passed in class
+ * @return	Returns a pointer to the found object or NULL if the path isn't indexed
+ */
+UObject* FindObjectInPathIndex(const TCHAR* PathName, const UClass* ObjectClass, bool bExactClass);
+
+/**
+ * Adds an object that was found by its full path name to the optional path index, ignored if PathName isn't the object's path name.
+ */
+void AddObjectToPathIndex(const TCHAR* PathName, UObject* Object);
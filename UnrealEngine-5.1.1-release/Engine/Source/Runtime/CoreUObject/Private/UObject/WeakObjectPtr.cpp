@@ -104,6 +104,39 @@ UObject* FWeakObjectPtr::GetEvenIfUnreachable() const
 	return Result;
 }
 
+void FWeakObjectPtr::GetBatch(TArrayView<const FWeakObjectPtr> WeakObjectPtrs, TArrayView<UObject*> OutObjects)
+{
+	check(OutObjects.Num() >= WeakObjectPtrs.Num());
+
+	// Far enough ahead to hide the object item cache miss behind resolving the weak pointers in between
+	constexpr int32 PrefetchDistance = 8;
+
+	auto PrefetchObjectItem = [](const FWeakObjectPtr& WeakObjectPtr)
+	{
+		if (WeakObjectPtr.ObjectSerialNumber != 0 && WeakObjectPtr.ObjectIndex >= 0)
+		{
+			if (FUObjectItem* ObjectItem = GUObjectArray.IndexToObject(WeakObjectPtr.ObjectIndex))
+			{
+				FPlatformMisc::Prefetch(ObjectItem);
+			}
+		}
+	};
+
+	const int32 Num = WeakObjectPtrs.Num();
+	for (int32 Index = 0; Index < FMath::Min(Num, PrefetchDistance); ++Index)
+	{
+		PrefetchObjectItem(WeakObjectPtrs[Index]);
+	}
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		if (Index + PrefetchDistance < Num)
+		{
+			PrefetchObjectItem(WeakObjectPtrs[Index + PrefetchDistance]);
+		}
+		OutObjects[Index] = WeakObjectPtrs[Index].Internal_Get(false);
+	}
+}
+
 void FWeakObjectPtr::Serialize(FArchive& Ar)
 {
 	FArchiveUObject::SerializeWeakObjectPtr(Ar, *this);
@@ -1507,6 +1507,33 @@ public:
 		{
 			return Read(BulkData, Offset, Size, Priority, Dst, &OutRequest);
 		}
+		/**
+		 * Read the bulk data from the specified offset and size without copying it where possible. If the bulk data is
+		 * stored uncompressed and unencrypted in a container the result is a read only view of the memory mapped container
+		 * file, otherwise it's read into a new buffer.
+		 * @param BulkData		The bulk data instance.
+		 * @param Offset		Offset relative to the bulk data.
+		 * @param Size			Number of bytes to read. Use MAX_uint64 to read the entire bulk data.
+		 * @param Priority		The I/O priority.
+		 * @param Dst			An empty I/O buffer that is assigned when the read is complete, it's valid to access once the batch is complete.
+		 */
+		FBatchBuilder& ReadMapped(const FBulkData& BulkData, uint64 Offset, uint64 Size, EAsyncIOPriorityAndFlags Priority, FIoBuffer& Dst)
+		{
+			return ReadMapped(BulkData, Offset, Size, Priority, Dst, nullptr);
+		}
+		/**
+		 * Read the bulk data from the specified offset and size without copying it where possible.
+		 * @param BulkData		The bulk data instance.
+		 * @param Offset		Offset relative to the bulk data.
+		 * @param Size			Number of bytes to read. Use MAX_uint64 to read the entire bulk data.
+		 * @param Priority		The I/O priority.
+		 * @param Dst			An empty I/O buffer that is assigned when the read is complete, it's valid to access once the batch is complete.
+		 * @param OutRequest	A handle to the read request.
+		 */
+		FBatchBuilder& ReadMapped(const FBulkData& BulkData, uint64 Offset, uint64 Size, EAsyncIOPriorityAndFlags Priority, FIoBuffer& Dst, FBulkDataBatchReadRequest& OutRequest)
+		{
+			return ReadMapped(BulkData, Offset, Size, Priority, Dst, &OutRequest);
+		}
 
 		/**
 		 * Issue the batch.
@@ -1524,6 +1551,7 @@ public:
 
 	private:
 		FBatchBuilder& Read(const FBulkData& BulkData, uint64 Offset, uint64 Size, EAsyncIOPriorityAndFlags Priority, FIoBuffer& Dst, FBulkDataBatchReadRequest* OutRequest);
+		FBatchBuilder& ReadMapped(const FBulkData& BulkData, uint64 Offset, uint64 Size, EAsyncIOPriorityAndFlags Priority, FIoBuffer& Dst, FBulkDataBatchReadRequest* OutRequest);
 	};
 
 	/** Reads one or more bulk data and copies the result into a single I/O buffer. */
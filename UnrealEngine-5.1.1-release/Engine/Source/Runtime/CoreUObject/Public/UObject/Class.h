@@ -93,6 +93,7 @@ struct FFloatInterval;
 struct FFloatRange;
 struct FFloatRangeBound;
 struct FFrame;
+struct FPerfectHashTable;
 struct FInt32Interval;
 struct FInt32Range;
 struct FInt32RangeBound;
@@ -411,6 +412,8 @@ public:
 
 	/** Cached schema for optimized unversioned and filtereditoronly property serialization, owned by this. */
 	mutable const struct FUnversionedStructSchema* UnversionedGameSchema = nullptr;
+	/** Cached plan for binary serialization of this struct's properties, built on first use after linking, owned by this. */
+	mutable const struct FBinarySerializationPlan* BinarySerializationPlan = nullptr;
 #if WITH_EDITORONLY_DATA
 	/** Cached schema for optimized unversioned property serialization, with editor data, owned by this. */
 	mutable const struct FUnversionedStructSchema* UnversionedEditorSchema = nullptr;
@@ -2060,6 +2063,15 @@ public:
 		EnumDisplayNameFn = InEnumDisplayNameFn;
 	}
 
+	/**
+	 * Associate a perfect hash table of the enum names for use by GetIndexByNameString, only intended for use by generated code.
+	 * The table must map the names passed to the last SetEnums call, in order, and is discarded by the next one.
+	 */
+	void SetNameHash(const FPerfectHashTable* InNameHash)
+	{
+		NameHash = InNameHash;
+	}
+
 	/**
 	 * Returns the type of enum: whether it's a regular enum, namespaced enum or C++11 enum class.
 	 *
@@ -2379,6 +2391,9 @@ protected:
 	/** pointer to function used to look up the enum's display name. Currently only assigned for UEnums generated for nativized blueprints */
 	FEnumDisplayNameFn EnumDisplayNameFn;
 
+	/** Optional perfect hash table of Names generated by UHT, turning name string lookups into a single compare */
+	const FPerfectHashTable* NameHash;
+
 	/** Package name this enum was in when its names were being added to the primary list */
 	FName EnumPackage;
 
@@ -2398,6 +2413,9 @@ protected:
 	/** adds the Names in this enum to the primary AllEnumNames list */
 	void AddNamesToPrimaryList();
 
+	/** Gets the index of the name using NameHash, returns INDEX_NONE if not found */
+	int32 GetIndexByNameHash(FStringView InName, ESearchCase::Type SearchCase) const;
+
 private:
 
 	/**
@@ -2599,6 +2617,9 @@ public:
 	/** Used to check if the class layout is currently changing and therefore is not ready for a CDO to be created */
 	bool bLayoutChanging;
 
+	/** True if objects of this class can be destroyed on worker threads, see UObject::IsDestructionThreadSafe. Initialized when the CDO is created */
+	bool bIsDestructionThreadSafe;
+
 	/** Class flags; See EClassFlags for more information */
 	EClassFlags ClassFlags;
 
@@ -322,6 +322,13 @@ private:
 	{
 		return !!(Options & EFastReferenceCollectorOptions::ProcessWeakReferences);
 	}
+	static constexpr FORCEINLINE bool IsIncremental()
+	{
+		return !!(Options & EFastReferenceCollectorOptions::Incremental);
+	}
+
+	/** Number of objects processed between time limit checks when processing incrementally */
+	static constexpr int32 IncrementalTimeCheckInterval = 64;
 	
 	class FCollectorTaskQueue
 	{
@@ -721,11 +728,29 @@ private:
 		// Keep serializing objects till we reach the end of the growing array at which point
 		// we are done.
 		int32 CurrentIndex = 0;
+		int32 NumObjectsUntilTimeCheck = IncrementalTimeCheckInterval;
 		do
 		{
 			CollectorType ReferenceCollector(ReferenceProcessor, NewObjectsToSerializeStruct);
 			while (CurrentIndex < ObjectsToSerialize.Num())
 			{
+				if constexpr (IsIncremental())
+				{
+					static_assert(!(Options & EFastReferenceCollectorOptions::Parallel), "Incremental reference collection is single threaded.");
+					if (--NumObjectsUntilTimeCheck == 0)
+					{
+						NumObjectsUntilTimeCheck = IncrementalTimeCheckInterval;
+						if (ReferenceProcessor.IsTimeLimitExceeded())
+						{
+							// Leave all objects that haven't been processed yet in the input array so that the caller can resume later
+							ObjectsToSerialize.RemoveAt(0, CurrentIndex, false);
+							ObjectsToSerialize.Append(NewObjectsToSerialize);
+							ArrayPool.ReturnToPool(&NewObjectsToSerializeStruct);
+							return;
+						}
+					}
+				}
+
 #if PERF_DETAILED_PER_CLASS_GC_STATS
 				uint32 StartCycles = FPlatformTime::Cycles();
 #endif
@@ -1371,6 +1396,12 @@ EndLoop:
 		}
 		while (CurrentIndex < ObjectsToSerialize.Num());
 
+		if constexpr (IsIncremental())
+		{
+			// An empty input array tells the caller that there's nothing left to resume
+			ObjectsToSerialize.Reset();
+		}
+
 #if PERF_DETAILED_PER_CLASS_GC_STATS
 		// Detailed per class stats should not be performed when parallel GC is running
 		check(!IsParallel());
@@ -17,5 +17,6 @@ enum class EFastReferenceCollectorOptions : uint32
 	WithClusters = 1 << 3, 
 	ProcessWeakReferences = 1 << 4,
 	WithPendingKill = 1 << 5,
+	Incremental = 1 << 6, ///< Stops processing when the reference processor's time limit is exceeded, the remaining objects are left in the array to be resumed later
 };
 ENUM_CLASS_FLAGS(EFastReferenceCollectorOptions);
@@ -670,6 +670,11 @@ public:
 	}
 	virtual bool MarkWeakObjectReferenceForClearing(UObject** WeakReference) override
 	{
+		// The referencing memory may be reallocated between the time slices of incremental reachability analysis so weak references are kept alive instead
+		if (!!(Options & EFastReferenceCollectorOptions::Incremental))
+		{
+			return false;
+		}
 		// Track this references for later destruction if necessary. These should be relatively rare
 		ObjectArrayStruct.WeakReferences.Add(WeakReference);
 		return true;
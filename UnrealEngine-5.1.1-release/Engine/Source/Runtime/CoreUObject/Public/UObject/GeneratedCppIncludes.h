@@ -13,3 +13,4 @@
 #include "UObject/EnumProperty.h"
 #include "UObject/TextProperty.h"
 #include "UObject/FieldPathProperty.h"
+#include "Hash/PerfectHash.h"
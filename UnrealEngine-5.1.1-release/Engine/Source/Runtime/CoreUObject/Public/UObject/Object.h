@@ -597,6 +597,8 @@ public:
 
 	/**
 	* Called during garbage collection to determine if an object can have its destructor called on a worker thread.
+	* This is a class level property: it's queried once on the class default object and cached in UClass::bIsDestructionThreadSafe,
+	* so overrides must return the same value for all objects of the class.
 	*
 	* @return	true if this object's destructor is thread safe
 	*/
@@ -584,6 +584,9 @@ enum class EInternalObjectFlags : int32
 {
 	None = 0,
 
+	Remembered = 1 << 17, ///< Young object that was referenced through the write barrier, or tenured object whose references can't be tracked by it. Scanned by minor collections
+	Tenured = 1 << 18, ///< Object survived a generational garbage collection and is only reclaimed by major collections
+	MaybeUnreachable = 1 << 19, ///< Object has not been reached yet by an incremental reachability analysis that is still in progress
 	LoaderImport = 1 << 20, ///< Object is ready to be imported by another package during loading
 	Garbage = 1 << 21, ///< Garbage from logical point of view and should not be referenced. This flag is mirrored in EObjectFlags as RF_Garbage for performance
 	PersistentGarbage = 1 << 22, ///< Same as above but referenced through a persistent reference so it can't be GC'd
@@ -602,7 +605,7 @@ enum class EInternalObjectFlags : int32
 	MirroredFlags = Garbage | PendingKill, /// Flags mirrored in EObjectFlags
 
 	//~ Make sure this is up to date!
-	AllFlags = LoaderImport | Garbage | PersistentGarbage | ReachableInCluster | ClusterRoot | Native | Async | AsyncLoading | Unreachable | PendingKill | RootSet | PendingConstruction
+	AllFlags = Remembered | Tenured | MaybeUnreachable | LoaderImport | Garbage | PersistentGarbage | ReachableInCluster | ClusterRoot | Native | Async | AsyncLoading | Unreachable | PendingKill | RootSet | PendingConstruction
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
 };
 ENUM_CLASS_FLAGS(EInternalObjectFlags);
@@ -17,6 +17,15 @@
 	#define UE_OBJPTR_DEPRECATED(Version, Message) 
 #endif
 
+/**
+ * Compiles the garbage collector write barrier into FObjectPtr/TObjectPtr construction and assignment, which is required for
+ * incremental reachability analysis (gc.AllowIncrementalReachability). Copying an object pointer is no longer trivial with the barrier
+ * so it's disabled unless a target opts in.
+ */
+#ifndef UE_WITH_OBJECT_PTR_GC_BARRIER
+	#define UE_WITH_OBJECT_PTR_GC_BARRIER 0
+#endif
+
 /** 
  * Wrapper macro for use in places where code needs to allow for a pointer type that could be a TObjectPtr<T> or a raw object pointer during a transitional period.
  * The coding standard disallows general use of the auto keyword, but in wrapping it in this macro, we have a record
@@ -47,6 +56,31 @@
 template <typename T>
 struct TObjectPtr;
 
+namespace UE::GC
+{
+	/** True while incremental reachability analysis is in progress and object references written by the game have to be reported to the garbage collector */
+	extern COREUOBJECT_API bool GIsIncrementalReachabilityPending;
+
+	/** Marks an object as reachable if it hasn't been reached yet by the incremental reachability analysis that is in progress */
+	COREUOBJECT_API void MarkAsReachable(const UObject* Object);
+
+	/** True while generational garbage collection is enabled and references to young objects have to be remembered for minor collections */
+	extern COREUOBJECT_API bool GIsGenerationalGCEnabled;
+
+	/** Reports a written object reference to the incremental reachability analysis and the remembered set of minor collections */
+	COREUOBJECT_API void OnObjectReferenceWritten(const UObject* Object);
+
+	/** Write barrier for object references, reports the referenced object to the garbage collector while incremental reachability analysis is in progress or generational GC is enabled */
+	FORCEINLINE void ObjectHandleWriteBarrier(FObjectHandle Handle)
+	{
+		// Unresolved handles reference objects that aren't loaded yet so they can't be reclaimed by the current analysis
+		if ((GIsIncrementalReachabilityPending || GIsGenerationalGCEnabled) && !IsObjectHandleNull(Handle) && IsObjectHandleResolved(Handle))
+		{
+			OnObjectReferenceWritten(ReadObjectHandlePointerNoCheck(Handle));
+		}
+	}
+}
+
 /**
  * FObjectPtr is the basic, minimally typed version of TObjectPtr
  */
@@ -70,12 +104,18 @@ public:
 	explicit FORCEINLINE FObjectPtr(UObject* Object)
 		: Handle(MakeObjectHandle(Object))
 	{
+#if UE_WITH_OBJECT_PTR_GC_BARRIER
+		UE::GC::ObjectHandleWriteBarrier(Handle);
+#endif
 	}
 
 	UE_OBJPTR_DEPRECATED(5.0, "Construction with incomplete type pointer is deprecated.  Please update this code to use MakeObjectPtrUnsafe.")
 	explicit FORCEINLINE FObjectPtr(void* IncompleteObject)
 		: Handle(MakeObjectHandle(reinterpret_cast<UObject*>(IncompleteObject)))
 	{
+#if UE_WITH_OBJECT_PTR_GC_BARRIER
+		UE::GC::ObjectHandleWriteBarrier(Handle);
+#endif
 	}
 
 	explicit FORCEINLINE FObjectPtr(const FObjectRef& ObjectRef)
@@ -98,14 +138,42 @@ public:
 		return ResolveObjectHandleClass(Handle);
 	}
 
+#if UE_WITH_OBJECT_PTR_GC_BARRIER
+	FORCEINLINE FObjectPtr(FObjectPtr&& Other)
+		: Handle(Other.Handle)
+	{
+		UE::GC::ObjectHandleWriteBarrier(Handle);
+	}
+	FORCEINLINE FObjectPtr(const FObjectPtr& Other)
+		: Handle(Other.Handle)
+	{
+		UE::GC::ObjectHandleWriteBarrier(Handle);
+	}
+	FORCEINLINE FObjectPtr& operator=(FObjectPtr&& Other)
+	{
+		Handle = Other.Handle;
+		UE::GC::ObjectHandleWriteBarrier(Handle);
+		return *this;
+	}
+	FORCEINLINE FObjectPtr& operator=(const FObjectPtr& Other)
+	{
+		Handle = Other.Handle;
+		UE::GC::ObjectHandleWriteBarrier(Handle);
+		return *this;
+	}
+#else
 	FObjectPtr(FObjectPtr&&) = default;
 	FObjectPtr(const FObjectPtr&) = default;
 	FObjectPtr& operator=(FObjectPtr&&) = default;
 	FObjectPtr& operator=(const FObjectPtr&) = default;
+#endif
 
 	FObjectPtr& operator=(UObject* Other)
 	{
 		Handle = MakeObjectHandle(Other);
+#if UE_WITH_OBJECT_PTR_GC_BARRIER
+		UE::GC::ObjectHandleWriteBarrier(Handle);
+#endif
 		return *this;
 	}
 
@@ -113,6 +181,9 @@ public:
 	FObjectPtr& operator=(void* IncompleteOther)
 	{
 		Handle = MakeObjectHandle(reinterpret_cast<UObject*>(IncompleteOther));
+#if UE_WITH_OBJECT_PTR_GC_BARRIER
+		UE::GC::ObjectHandleWriteBarrier(Handle);
+#endif
 		return *this;
 	}
 
@@ -266,8 +337,20 @@ public:
 	{
 	}
 
+#if UE_WITH_OBJECT_PTR_GC_BARRIER
+	// The copy of FObjectPtr isn't trivial with the write barrier so the union member can't be copied by defaulted functions
+	FORCEINLINE TObjectPtr(TObjectPtr<T>&& Other)
+		: ObjectPtr(Other.ObjectPtr)
+	{
+	}
+	FORCEINLINE TObjectPtr(const TObjectPtr<T>& Other)
+		: ObjectPtr(Other.ObjectPtr)
+	{
+	}
+#else
 	TObjectPtr(TObjectPtr<T>&& Other) = default;
 	TObjectPtr(const TObjectPtr<T>& Other) = default;
+#endif
 
 	explicit FORCEINLINE TObjectPtr(ENoInit)
 		: ObjectPtr(NoInit)
@@ -305,8 +388,21 @@ public:
 	{
 	}
 
+#if UE_WITH_OBJECT_PTR_GC_BARRIER
+	FORCEINLINE TObjectPtr<T>& operator=(TObjectPtr<T>&& Other)
+	{
+		ObjectPtr = Other.ObjectPtr;
+		return *this;
+	}
+	FORCEINLINE TObjectPtr<T>& operator=(const TObjectPtr<T>& Other)
+	{
+		ObjectPtr = Other.ObjectPtr;
+		return *this;
+	}
+#else
 	TObjectPtr<T>& operator=(TObjectPtr<T>&&) = default;
 	TObjectPtr<T>& operator=(const TObjectPtr<T>&) = default;
+#endif
 
 	FORCEINLINE TObjectPtr<T>& operator=(TYPE_OF_NULLPTR)
 	{
@@ -749,11 +845,11 @@ struct TIsZeroConstructType<TObjectPtr<T>>
 	enum { Value = true };
 };
 
-// Trait which allows TObjectPtr to be memcpy'able from pointers.
+// Trait which allows TObjectPtr to be memcpy'able from pointers, unless every construction has to go through the GC write barrier.
 template <typename T>
 struct TIsBitwiseConstructible<TObjectPtr<T>, T*>
 {
-	enum { Value = true };
+	enum { Value = !UE_WITH_OBJECT_PTR_GC_BARRIER };
 };
 
 template <typename T, class PREDICATE_CLASS>
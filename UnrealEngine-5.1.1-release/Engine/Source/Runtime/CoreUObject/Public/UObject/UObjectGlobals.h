@@ -66,6 +66,7 @@ struct FGuid;
 struct FObjectInstancingGraph;
 struct FObjectPostCDOCompiledContext;
 struct FObjectPtr;
+struct FPerfectHashTable;
 struct FPrimaryAssetId;
 struct FStaticConstructObjectParameters;
 struct FUObjectSerializeContext;
@@ -786,6 +787,21 @@ COREUOBJECT_API bool IsIncrementalUnhashPending();
  */
 COREUOBJECT_API bool IsIncrementalPurgePending();
 
+/**
+ * Returns whether time sliced reachability analysis has been started by CollectGarbage and still needs to be completed
+ * by PerformIncrementalReachabilityAnalysis (see gc.AllowIncrementalReachability).
+ */
+COREUOBJECT_API bool IsIncrementalReachabilityAnalysisPending();
+
+/**
+ * Resumes time sliced reachability analysis. When it completes the rest of garbage collection is performed as if CollectGarbage
+ * was called, unreachable objects are then purged by IncrementalPurgeGarbage.
+ *
+ * @param	TimeLimit	soft time limit in seconds, zero to complete reachability analysis without a time limit
+ * @return	true if reachability analysis is still pending
+ */
+COREUOBJECT_API bool PerformIncrementalReachabilityAnalysis(double TimeLimit);
+
 /**
  * Gathers unreachable objects for IncrementalPurgeGarbage.
  *
@@ -3442,6 +3458,7 @@ namespace UECodeGen_Private
 		const FMetaDataPairParam*   MetaDataArray;
 		int32                       NumMetaData;
 #endif
+		const FPerfectHashTable*    NameHash; // optional, last so that generated code without it leaves it null
 	};
 
 	struct FStructParams
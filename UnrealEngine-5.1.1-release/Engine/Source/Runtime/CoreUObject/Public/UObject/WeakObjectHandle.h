@@ -0,0 +1,209 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	WeakObjectHandle.h: Weak reference to UObject for hot lookups
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
+#include "UObject/UObjectArray.h"
+
+class UObject;
+
+/**
+ * FWeakObjectHandle is a weak reference to a UObject meant for lookups on hot gameplay paths (targeting, perception, ...).
+ * Unlike FWeakObjectPtr it caches the object pointer and its FUObjectItem next to the serial number, so resolving it only
+ * reads the handle and the object item, without going through the chunk table of GUObjectArray.
+ * Object items never move while the engine is running, and their serial number changes when the object is destroyed, so
+ * the cached object pointer is only returned while the object it was created from is alive.
+ *
+ * It is twice the size of a FWeakObjectPtr, prefer FWeakObjectPtr for references that are not resolved often.
+ */
+struct FWeakObjectHandle
+{
+public:
+	FWeakObjectHandle() = default;
+
+	FORCEINLINE FWeakObjectHandle(TYPE_OF_NULLPTR)
+	{
+	}
+
+	/**
+	 * Construct from an object pointer
+	 * @param InObject object to create a handle to
+	 */
+	FORCEINLINE explicit FWeakObjectHandle(const UObject* InObject)
+	{
+		(*this) = InObject;
+	}
+
+	/**
+	 * Copy from an object pointer
+	 * @param InObject object to create a handle to
+	 */
+	FORCEINLINE void operator=(const UObject* InObject)
+	{
+		if (InObject)
+		{
+			const int32 ObjectIndex = GUObjectArray.ObjectToIndex((const UObjectBase*)InObject);
+			Object = const_cast<UObject*>(InObject);
+			SerialNumber = GUObjectArray.AllocateSerialNumber(ObjectIndex);
+			ObjectItem = GUObjectArray.IndexToObject(ObjectIndex);
+		}
+		else
+		{
+			Reset();
+		}
+	}
+
+	/** Reset the handle back to the null state */
+	FORCEINLINE void Reset()
+	{
+		Object = nullptr;
+		ObjectItem = nullptr;
+		SerialNumber = 0;
+	}
+
+	/**
+	 * Dereference the handle, implying bEvenIfPendingKill=false.
+	 * @return nullptr if this object is gone or the handle is explicitly null, otherwise a valid uobject pointer
+	 */
+	FORCEINLINE UObject* Get() const
+	{
+		return (ObjectItem && ObjectItem->GetSerialNumber() == SerialNumber && GUObjectArray.IsValid(ObjectItem, false)) ? Object : nullptr;
+	}
+
+	/**
+	 * Test if this points to a live UObject
+	 * @return true if Get() would return a valid non-null pointer
+	 */
+	FORCEINLINE bool IsValid() const
+	{
+		return Get() != nullptr;
+	}
+
+	/** Returns true if this handle was explicitly assigned to null, was reset, or was never initialized */
+	FORCEINLINE bool IsExplicitlyNull() const
+	{
+		return ObjectItem == nullptr;
+	}
+
+	/** Returns true if two handles were originally set to the same object, even if they are now stale */
+	FORCEINLINE bool HasSameObject(const FWeakObjectHandle& Other) const
+	{
+		return ObjectItem == Other.ObjectItem && SerialNumber == Other.SerialNumber;
+	}
+
+	/**
+	 * Dereference a batch of handles. The object items of later handles are prefetched while earlier ones are resolved.
+	 * @param Handles handles to dereference
+	 * @param OutObjects receives the result of Get() for each handle, must have at least as many elements as Handles
+	 */
+	static void GetBatch(TArrayView<const FWeakObjectHandle> Handles, TArrayView<UObject*> OutObjects)
+	{
+		check(OutObjects.Num() >= Handles.Num());
+
+		// Far enough ahead to hide the object item cache miss behind resolving the handles in between
+		constexpr int32 PrefetchDistance = 8;
+
+		const int32 Num = Handles.Num();
+		for (int32 Index = 0; Index < FMath::Min(Num, PrefetchDistance); ++Index)
+		{
+			FPlatformMisc::Prefetch(Handles[Index].ObjectItem);
+		}
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			if (Index + PrefetchDistance < Num)
+			{
+				FPlatformMisc::Prefetch(Handles[Index + PrefetchDistance].ObjectItem);
+			}
+			OutObjects[Index] = Handles[Index].Get();
+		}
+	}
+
+private:
+	UObject* Object = nullptr;
+	FUObjectItem* ObjectItem = nullptr;
+	int32 SerialNumber = 0;
+};
+
+template<> struct TIsPODType<FWeakObjectHandle> { enum { Value = true }; };
+template<> struct TIsZeroConstructType<FWeakObjectHandle> { enum { Value = true }; };
+template<> struct TIsWeakPointerType<FWeakObjectHandle> { enum { Value = true }; };
+
+/** Typed wrapper around FWeakObjectHandle */
+template<typename T>
+struct TWeakObjectHandle
+{
+public:
+	TWeakObjectHandle() = default;
+
+	FORCEINLINE TWeakObjectHandle(TYPE_OF_NULLPTR)
+	{
+	}
+
+	FORCEINLINE explicit TWeakObjectHandle(const T* InObject)
+		: Handle((const UObject*)InObject)
+	{
+	}
+
+	FORCEINLINE void operator=(const T* InObject)
+	{
+		Handle = (const UObject*)InObject;
+	}
+
+	FORCEINLINE void Reset()
+	{
+		Handle.Reset();
+	}
+
+	FORCEINLINE T* Get() const
+	{
+		return (T*)Handle.Get();
+	}
+
+	FORCEINLINE bool IsValid() const
+	{
+		return Handle.IsValid();
+	}
+
+	FORCEINLINE bool IsExplicitlyNull() const
+	{
+		return Handle.IsExplicitlyNull();
+	}
+
+	/**
+	 * Dereference an array of handles with FWeakObjectHandle::GetBatch
+	 * @param Handles handles to dereference
+	 * @param OutObjects receives the result of Get() for each handle
+	 */
+	template<typename InAllocatorType, typename OutAllocatorType>
+	static void GetBatch(const TArray<TWeakObjectHandle, InAllocatorType>& Handles, TArray<T*, OutAllocatorType>& OutObjects)
+	{
+		static_assert(sizeof(TWeakObjectHandle) == sizeof(FWeakObjectHandle), "TWeakObjectHandle is expected to be a plain FWeakObjectHandle");
+
+		const FWeakObjectHandle* Source = (const FWeakObjectHandle*)Handles.GetData();
+		const int32 Num = Handles.Num();
+		OutObjects.SetNumUninitialized(Num);
+
+		UObject* Resolved[64];
+		for (int32 Start = 0; Start < Num; Start += UE_ARRAY_COUNT(Resolved))
+		{
+			const int32 Count = FMath::Min<int32>(Num - Start, UE_ARRAY_COUNT(Resolved));
+			FWeakObjectHandle::GetBatch(MakeArrayView(Source + Start, Count), MakeArrayView(Resolved, Count));
+			for (int32 Index = 0; Index < Count; ++Index)
+			{
+				OutObjects[Start + Index] = (T*)Resolved[Index];
+			}
+		}
+	}
+
+private:
+	FWeakObjectHandle Handle;
+};
+
+template<typename T> struct TIsPODType<TWeakObjectHandle<T>> { enum { Value = true }; };
+template<typename T> struct TIsZeroConstructType<TWeakObjectHandle<T>> { enum { Value = true }; };
+template<typename T> struct TIsWeakPointerType<TWeakObjectHandle<T>> { enum { Value = true }; };
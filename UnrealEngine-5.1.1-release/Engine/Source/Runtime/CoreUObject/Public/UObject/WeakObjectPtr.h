@@ -8,6 +8,7 @@
 
 #include "CoreMinimal.h"
 #include "CoreTypes.h"
+#include "Containers/ArrayView.h"
 #include "Misc/AssertionMacros.h"
 #include "Templates/UnrealTemplate.h"
 #include "UObject/FastReferenceCollectorOptions.h"
@@ -165,6 +166,14 @@ public:
 	/** Dereference the weak pointer even if it is RF_PendingKill or RF_Unreachable */
 	COREUOBJECT_API class UObject* GetEvenIfUnreachable() const;
 
+	/**
+	 * Dereference a batch of weak pointers, implying bEvenIfPendingKill=false. Faster than calling Get() on each of them, the
+	 * object items of later weak pointers are prefetched while earlier ones are resolved.
+	 * @param WeakObjectPtrs weak pointers to dereference
+	 * @param OutObjects receives the result of Get() for each weak pointer, must have at least as many elements as WeakObjectPtrs
+	 */
+	static COREUOBJECT_API void GetBatch(TArrayView<const FWeakObjectPtr> WeakObjectPtrs, TArrayView<UObject*> OutObjects);
+
 	/**  
 	 * Test if this points to a live UObject
 	 * @param bEvenIfPendingKill if this is true, pendingkill are not considered invalid
@@ -318,6 +327,32 @@ template<> struct TIsPODType<FWeakObjectPtr> { enum { Value = true }; };
 template<> struct TIsZeroConstructType<FWeakObjectPtr> { enum { Value = true }; };
 template<> struct TIsWeakPointerType<FWeakObjectPtr> { enum { Value = true }; };
 
+/**
+ * Dereference an array of weak pointers with FWeakObjectPtr::GetBatch.
+ * @param WeakObjectPtrs weak pointers to dereference
+ * @param OutObjects receives the result of Get() for each weak pointer
+ */
+template<typename T, typename InAllocatorType, typename OutAllocatorType>
+void GetWeakObjectPtrsBatch(const TArray<TWeakObjectPtr<T>, InAllocatorType>& WeakObjectPtrs, TArray<T*, OutAllocatorType>& OutObjects)
+{
+	static_assert(sizeof(TWeakObjectPtr<T>) == sizeof(FWeakObjectPtr), "TWeakObjectPtr is expected to be a plain FWeakObjectPtr");
+
+	const FWeakObjectPtr* Source = (const FWeakObjectPtr*)WeakObjectPtrs.GetData();
+	const int32 Num = WeakObjectPtrs.Num();
+	OutObjects.SetNumUninitialized(Num);
+
+	UObject* Resolved[64];
+	for (int32 Start = 0; Start < Num; Start += UE_ARRAY_COUNT(Resolved))
+	{
+		const int32 Count = FMath::Min<int32>(Num - Start, UE_ARRAY_COUNT(Resolved));
+		FWeakObjectPtr::GetBatch(MakeArrayView(Source + Start, Count), MakeArrayView(Resolved, Count));
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			OutObjects[Start + Index] = (T*)Resolved[Index];
+		}
+	}
+}
+
 // Typedef script delegates for convenience.
 typedef TScriptDelegate<> FScriptDelegate;
 typedef TMulticastScriptDelegate<> FMulticastScriptDelegate;
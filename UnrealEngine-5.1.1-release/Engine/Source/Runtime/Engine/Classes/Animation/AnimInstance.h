@@ -431,6 +431,14 @@ class ENGINE_API UAnimInstance : public UObject
 	UPROPERTY(EditDefaultsOnly, Category = "Montage")
 	uint8 bUseMainInstanceMontageEvaluationData: 1;
 
+	/**
+	 * If true and a.CrowdPoseSharing is enabled, instances of this class playing the same assets at the same play positions,
+	 * blend weights and blend space positions (within the a.CrowdPoseSharing tolerances) on the same mesh and LOD reuse the
+	 * pose evaluated first this frame. Only enable for graphs whose pose depends on nothing else, e.g. no IK or look-at.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = Optimization)
+	uint8 bShareCrowdPoses : 1;
+
 private:
 	/** True when Montages are being ticked, and Montage Events should be queued. 
 	 * When Montage are being ticked, we queue AnimNotifies and Events. We trigger notifies first, then Montage events. */
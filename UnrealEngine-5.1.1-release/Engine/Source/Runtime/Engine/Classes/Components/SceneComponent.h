@@ -967,6 +967,15 @@ private:
 	void PropagateTransformUpdate(bool bTransformChanged, EUpdateTransformFlags UpdateTransformFlags = EUpdateTransformFlags::None, ETeleportType Teleport = ETeleportType::None);
 	void UpdateComponentToWorldWithParent(USceneComponent* Parent, FName SocketName, EUpdateTransformFlags UpdateTransformFlags, const FQuat& RelativeRotationQuat, ETeleportType Teleport = ETeleportType::None);
 
+	/**
+	 * Updates the transforms and bounds of the whole attachment subtree in parallel, one depth at a time, then notifies subsystems on the game thread.
+	 * @return false if the subtree is too small or has components that must be updated one after the other (socket attachments, deferred movement)
+	 */
+	bool UpdateChildTransformsParallel(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+	/** Same as PropagateTransformUpdate for a component whose transform and bounds were already updated by UpdateChildTransformsParallel */
+	void PropagateParallelTransformUpdate(bool bTransformChanged, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport, TFunctionRef<void()> UpdateChildren);
+
 public:
 
 	/** Queries world and updates overlap tracking state for this component */
@@ -0,0 +1,125 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/Interface.h"
+#include "Engine/EngineTypes.h"
+#include "Stats/Stats.h"
+
+#include "ActorPoolSubsystem.generated.h"
+
+class AActor;
+class ULevel;
+struct FActorSpawnParameters;
+
+UINTERFACE(meta = (CannotImplementInterfaceInBlueprint))
+class ENGINE_API UPooledActorInterface : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Optional interface for actors of pooled classes, used to reset their state when they go in and out of the pool.
+ */
+class ENGINE_API IPooledActorInterface
+{
+	GENERATED_BODY()
+
+public:
+	/** Called after the actor ended play and had its components unregistered, when it is put back in the pool instead of being destroyed */
+	virtual void OnReturnedToPool() {}
+
+	/** Called when SpawnActor reuses the actor, after its components are registered again and before it begins play */
+	virtual void OnTakenFromPool() {}
+};
+
+/** Inactive actors of a pooled class */
+USTRUCT()
+struct FPooledActorList
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<AActor>> Actors;
+
+	/** Maximum number of inactive actors kept for this class */
+	int32 MaxPooledActors = 0;
+};
+
+/**
+ * The actor pool subsystem keeps destroyed actors of opted in classes alive so SpawnActor can reuse them.
+ * UWorld::DestroyActor ends play on a pooled actor, unregisters its components and removes it from its level instead of
+ * destroying it. UWorld::SpawnActor then takes an inactive actor of the class if there is one, moves it to the spawn
+ * transform, registers its components again and begins play, skipping construction.
+ *
+ * Only actors of the exact registered class spawned in the persistent level of a game world are pooled. Spawns that
+ * need a template, a name, deferred construction or collision adjustment always create a new actor.
+ * Replicated actors are only pooled on the authority. Their channels are closed and their NetGUIDs are released when
+ * they are returned to the pool, so clients see a new actor when they are reused.
+ *
+ * A pooled actor stays a valid object, code holding on to an actor it destroyed must not keep using it.
+ */
+UCLASS()
+class ENGINE_API UActorPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/**
+	 * Opts a class in to pooling.
+	 *
+	 * @param ActorClass		Class whose destroyed actors are kept for reuse. Subclasses need to be registered separately.
+	 * @param MaxPooledActors	Maximum number of inactive actors kept for this class, actors destroyed past that are destroyed normally.
+	 */
+	void RegisterPooledClass(TSubclassOf<AActor> ActorClass, int32 MaxPooledActors);
+
+	/** Stops pooling a class and destroys its inactive actors */
+	void UnregisterPooledClass(TSubclassOf<AActor> ActorClass);
+
+	/** Returns true if destroyed actors of this class can be pooled */
+	bool IsClassPooled(const UClass* ActorClass) const;
+
+	/** Returns the number of inactive actors currently kept for this class */
+	int32 GetNumPooledActors(const UClass* ActorClass) const;
+
+	/**
+	 * Called by UWorld::DestroyActor, puts the actor back in the pool if its class is pooled and the pool is not full.
+	 *
+	 * @return True if the actor was pooled and must not be destroyed
+	 */
+	bool TryReturnActor(AActor* Actor);
+
+	/**
+	 * Called by UWorld::SpawnActor, reuses an inactive actor of the class if the spawn can be satisfied by one.
+	 *
+	 * @param CollisionHandlingMethod	Collision handling resolved by SpawnActor, blocking geometry has already been checked if needed
+	 * @return The reused actor, already initialized at UserTransform, or nullptr if a new actor has to be spawned
+	 */
+	AActor* TryTakeActor(UClass* ActorClass, ULevel* LevelToSpawnIn, const FTransform& UserTransform, const FActorSpawnParameters& SpawnParameters, ESpawnActorCollisionHandlingMethod CollisionHandlingMethod);
+
+	//~USubsystem interface
+	virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+protected:
+	//~UWorldSubsystem interface
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	//~End of UWorldSubsystem interface
+
+private:
+
+	/** Closes the actor channels of the actor and releases its NetGUIDs on all net drivers replicating it */
+	void ReleaseNetworkState(AActor* Actor) const;
+
+	/** Inactive actors by class */
+	UPROPERTY()
+	TMap<TObjectPtr<UClass>, FPooledActorList> Pools;
+
+	/** Actor being returned to the pool, DestroyActor calls made for it from EndPlay are ignored */
+	AActor* ReturningActor = nullptr;
+
+	/** Set while destroying inactive actors, so DestroyActor does not put them back */
+	bool bDestroyingPooledActors = false;
+};
@@ -137,12 +137,16 @@ extern ENGINE_API float GPriorityLevelStreamingActorsUpdateExtraTime;
 extern ENGINE_API int32 GLevelStreamingComponentsRegistrationGranularity;
 /** Batching granularity used to add primitives to scene in parallel when registering actor components during level streaming. */
 extern ENGINE_API int32 GLevelStreamingAddPrimitiveGranularity;
+/** Batching granularity used to create deferred physics states in parallel when registering actor components during level streaming. If this is zero, they are created after each registration batch. */
+extern ENGINE_API int32 GLevelStreamingDeferredPhysicsStateGranularity;
 /** Batching granularity used to unregister actor components during level streaming.  */
 extern ENGINE_API int32 GLevelStreamingComponentsUnregistrationGranularity;
 /** Batching granularity used to initialize actors during level streaming. If this is zero, we process all actors and stages in one pass. */
 extern ENGINE_API int32 GLevelStreamingRouteActorInitializationGranularity;
 /** Maximum allowed time to spend for actor unregistration steps during level streaming (ms per frame). If this is 0.0 then we don't timeslice.*/
 extern ENGINE_API float GLevelStreamingUnregisterComponentsTimeLimit;
+/** Maximum allowed time shared by actor registration and unregistration steps during level streaming (ms per frame). If this is 0.0, each uses its own time limit. */
+extern ENGINE_API float GLevelStreamingVisibilityTimeLimit;
 /** Whether to force a GC after levels are streamed out to instantly reclaim the memory at the expensive of a hitch. */
 extern ENGINE_API int32 GLevelStreamingForceGCAfterLevelStreamedOut;
 /** Whether to kick off incremental GC when there are over the specified amount of levels still waiting to be purged. */
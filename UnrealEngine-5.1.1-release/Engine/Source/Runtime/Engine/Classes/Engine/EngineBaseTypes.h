@@ -384,6 +384,21 @@ private:
 	 */
 	void QueueTickFunction(class FTickTaskSequencer& TTS, const FTickContext& TickContext);
 
+	/**
+	 * Queues a tick function for execution from the game thread, using prerequisites resolved in a previous frame
+	 * @param TickContext - context to tick in
+	 * @param CachedPrerequisites - registered prerequisites of this tick function
+	 */
+	void QueueTickFunctionCached(class FTickTaskSequencer& TTS, const FTickContext& TickContext, TArrayView<FTickFunction* const> CachedPrerequisites);
+
+	/**
+	 * Computes the actual tick groups of this tick function and queues its task
+	 * @param TickContext - context to tick in
+	 * @param TaskPrerequisites - completion handles of the queued prerequisites
+	 * @param MaxPrerequisiteTickGroup - latest actual start tick group of the queued prerequisites
+	 */
+	void QueueTickFunctionWithPrerequisites(class FTickTaskSequencer& TTS, const FTickContext& TickContext, const FGraphEventArray& TaskPrerequisites, ETickingGroup MaxPrerequisiteTickGroup);
+
 	/**
 	 * Queues a tick function for execution from the game thread
 	 * @param TickContext - context to tick in
@@ -414,6 +429,15 @@ private:
 	{
 		return NAME_None;
 	}
+	/**
+	 * Key used to group this tick function with similar ones into a single task when tick.AllowBatchedTicks is enabled.
+	 * Tick functions returning the same key, in the same tick group and on the same thread, can be executed one after the other by one task.
+	 * @return nullptr if this tick function must always be executed by its own task
+	 */
+	virtual const UObject* GetTickBatchKey() const
+	{
+		return nullptr;
+	}
 	
 	friend class FTickTaskSequencer;
 	friend class FTickTaskManager;
@@ -456,6 +480,7 @@ struct FActorTickFunction : public FTickFunction
 	/** Abstract function to describe this tick. Used to print messages about illegal cycles in the dependency graph **/
 	ENGINE_API virtual FString DiagnosticMessage() override;
 	ENGINE_API virtual FName DiagnosticContext(bool bDetailed) override;
+	ENGINE_API virtual const UObject* GetTickBatchKey() const override;
 };
 
 template<>
@@ -489,6 +514,7 @@ struct FActorComponentTickFunction : public FTickFunction
 	/** Abstract function to describe this tick. Used to print messages about illegal cycles in the dependency graph **/
 	ENGINE_API virtual FString DiagnosticMessage() override;
 	ENGINE_API virtual FName DiagnosticContext(bool bDetailed) override;
+	ENGINE_API virtual const UObject* GetTickBatchKey() const override;
 
 	/**
 	 * Conditionally calls ExecuteTickFunc if registered and a bunch of other criteria are met
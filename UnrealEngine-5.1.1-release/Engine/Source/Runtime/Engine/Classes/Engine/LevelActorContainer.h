@@ -29,3 +29,12 @@ public:
 	virtual void CreateCluster() override;
 	virtual void OnClusterMarkedAsPendingKill() override;
 };
+
+/**
+ * Creates a GC cluster from an actor spawned at runtime and the objects it owns (see gc.SpawnedActorClusteringEnabled), so GC walks them as a unit.
+ * Only actors that can be in clusters are clustered, references to objects outside of the actor are tracked as the cluster's mutable objects.
+ */
+ENGINE_API void CreateSpawnedActorCluster(AActor* Actor);
+
+/** Dissolves the cluster created by CreateSpawnedActorCluster, e.g. because the objects owned by the actor changed */
+ENGINE_API void DissolveSpawnedActorCluster(AActor* Actor);
@@ -1230,6 +1230,16 @@ public:
 
 	FORCEINLINE FHistogram GetNetHistogram() const { return NetConnectionHistogram; }
 
+	/** Histogram of the time in ms received packets waited between the net driver receive thread and game thread processing */
+	const FHistogram& GetReceiveQueueLatencyHistogram() const { return ReceiveQueueLatencyHistogram; }
+
+	/**
+	 * Records how long a packet received by a net driver receive thread waited before being processed on the game thread
+	 *
+	 * @param LatencyInMs	Time between the packet leaving the socket and the game thread processing it
+	 */
+	void AddReceiveQueueLatency(double LatencyInMs) { ReceiveQueueLatencyHistogram.AddMeasurement(LatencyInMs); }
+
 	/** Whether or not a client packet has been received - used serverside, to delay any packet sends */
 	FORCEINLINE bool HasReceivedClientPacket()
 	{
@@ -1470,6 +1480,9 @@ private:
 	/** Histogram of the received packet time */
 	FHistogram NetConnectionHistogram;
 
+	/** Histogram of the receive thread to game thread latency of received packets */
+	FHistogram ReceiveQueueLatencyHistogram;
+
 	/** Online platform ID of remote player on this connection. Only valid on client connections (server side).*/
 	FName PlayerOnlinePlatformName;
 
@@ -600,6 +600,20 @@ struct FActorPriority
 	FActorPriority(class UNetConnection* InConnection, FActorDestructionInfo * DestructInfo, const TArray<struct FNetViewer>& Viewers );
 };
 
+/** Actors prioritized for one connection on a worker thread, see net.ParallelPrioritizeActors */
+struct FNetParallelPrioritizedConnection
+{
+	class UNetConnection* Connection = nullptr;
+	TArray<struct FNetViewer> Viewers;
+	TArray<FActorPriority> PriorityList;
+	TArray<FActorPriority*> PriorityActors;
+	int32 NumDeletedActors = 0;
+
+	// Side effects of prioritization that are applied on the game thread once all connections are prioritized
+	TArray<class UActorChannel*> ChannelsToClose;
+	TArray<class UActorChannel*> ChannelsToStartDormancy;
+};
+
 struct FCompareFActorPriority
 {
 	FORCEINLINE bool operator()( const FActorPriority& A, const FActorPriority& B ) const
@@ -1797,6 +1811,7 @@ protected:
 	int32 ServerReplicateActors_PrepConnections( const float DeltaSeconds );
 	void ServerReplicateActors_BuildConsiderList( TArray<FNetworkObjectInfo*>& OutConsiderList, const float ServerTickTime );
 	int32 ServerReplicateActors_PrioritizeActors( UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, const TArray<FNetworkObjectInfo*>& ConsiderList, const bool bCPUSaturated, FActorPriority*& OutPriorityList, FActorPriority**& OutPriorityActors );
+	void ServerReplicateActors_PrioritizeActorsParallel( FNetParallelPrioritizedConnection& Prioritized, const TArray<FNetworkObjectInfo*>& ConsiderList ) const;
 	int32 ServerReplicateActors_ProcessPrioritizedActors( UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, FActorPriority** PriorityActors, const int32 FinalSortedCount, int32& OutUpdated );
 #endif
 
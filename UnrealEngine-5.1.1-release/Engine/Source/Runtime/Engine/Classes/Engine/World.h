@@ -1359,6 +1359,9 @@ private:
 	/** Epoch updated every time BlockTillLevelStreamingCompleted() is called. */
 	int32 BlockTillLevelStreamingCompletedEpoch;
 
+	/** Collects the primitives registered by actors spawned in a SpawnActorsBatch() call, so they are added to the scene in one batch */
+	FRegisterComponentContext* SpawnActorsBatchRegisterContext = nullptr;
+
 	/** The world's navigation data manager */
 	UPROPERTY(Transient)
 	TObjectPtr<class UNavigationSystemBase>				NavigationSystem;
@@ -2033,6 +2036,34 @@ public:
 	 */
 	bool SweepSingleByChannel(struct FHitResult& OutHit, const FVector& Start, const FVector& End, const FQuat& Rot, ECollisionChannel TraceChannel, const FCollisionShape& CollisionShape, const FCollisionQueryParams& Params = FCollisionQueryParams::DefaultQueryParam, const FCollisionResponseParams& ResponseParam = FCollisionResponseParams::DefaultResponseParam) const;
 
+	/**
+	 *  Trace a batch of rays against the world using a specific channel and return the first blocking hit of each.
+	 *  The rays are traced in parallel on the task workers in an order that keeps nearby rays together, which is faster than
+	 *  tracing them one by one for large batches such as AI visibility checks or audio occlusion. Blocks until every ray is traced.
+	 *  @param  OutHits         One result per ray, in the order of Starts. bBlockingHit is false when the ray hit nothing
+	 *  @param  Starts          Start location of each ray
+	 *  @param  Ends            End location of each ray, same count as Starts
+	 *  @param  TraceChannel    The 'channel' that these rays are in, used to determine which components to hit
+	 *  @param  Params          Additional parameters used for every trace of the batch
+	 * 	@param 	ResponseParam	ResponseContainer to be used for every trace of the batch
+	 *  @return Number of rays with a blocking hit
+	 */
+	int32 LineTraceSingleByChannelBatched(TArray<struct FHitResult>& OutHits, TArrayView<const FVector> Starts, TArrayView<const FVector> Ends, ECollisionChannel TraceChannel, const FCollisionQueryParams& Params = FCollisionQueryParams::DefaultQueryParam, const FCollisionResponseParams& ResponseParam = FCollisionResponseParams::DefaultResponseParam) const;
+
+	/**
+	 *  Sweep a batch of shapes against the world using a specific channel and return the first blocking hit of each.
+	 *  Same as LineTraceSingleByChannelBatched, with every sweep of the batch using the same shape and rotation.
+	 *  @param  OutHits         One result per sweep, in the order of Starts. bBlockingHit is false when the sweep hit nothing
+	 *  @param  Starts          Start location of each sweep
+	 *  @param  Ends            End location of each sweep, same count as Starts
+	 *  @param  TraceChannel    The 'channel' that these sweeps are in, used to determine which components to hit
+	 *  @param	CollisionShape	CollisionShape - supports Box, Sphere, Capsule
+	 *  @param  Params          Additional parameters used for every sweep of the batch
+	 * 	@param 	ResponseParam	ResponseContainer to be used for every sweep of the batch
+	 *  @return Number of sweeps with a blocking hit
+	 */
+	int32 SweepSingleByChannelBatched(TArray<struct FHitResult>& OutHits, TArrayView<const FVector> Starts, TArrayView<const FVector> Ends, const FQuat& Rot, ECollisionChannel TraceChannel, const FCollisionShape& CollisionShape, const FCollisionQueryParams& Params = FCollisionQueryParams::DefaultQueryParam, const FCollisionResponseParams& ResponseParam = FCollisionResponseParams::DefaultResponseParam) const;
+
 	/**
 	 *  Sweep a shape against the world and return the first blocking hit using object types
 	 *  @param  OutHit          First blocking hit found
@@ -3487,6 +3518,27 @@ public:
 	 */
 	AActor* SpawnActorAbsolute( UClass* Class, FTransform const& AbsoluteTransform, const FActorSpawnParameters& SpawnParameters = FActorSpawnParameters());
 
+	/**
+	 * Spawn one actor of the given class for each transform. Cheaper than calling SpawnActor in a loop: the level's actor lists
+	 * and tick lists are grown once for the whole batch, and the primitives of native components are added to the scene in one
+	 * parallel batch once every actor has been created. Construction scripts, BeginPlay and collision handling run for each
+	 * actor after that, in order, unless SpawnParameters.bDeferConstruction is set and the caller calls FinishSpawning itself.
+	 *
+	 * @param	Class					Class to Spawn
+	 * @param	Transforms				World Transform of each actor to spawn
+	 * @param	OutActors				Receives the spawned actors, failed spawns are left out
+	 * @param	SpawnParameters			Spawn Parameters, shared by all actors. Name must be None.
+	 *
+	 * @return	Number of actors that were spawned
+	 */
+	int32 SpawnActorsBatch( UClass* Class, TArrayView<const FTransform> Transforms, TArray<AActor*>& OutActors, const FActorSpawnParameters& SpawnParameters = FActorSpawnParameters());
+
+	/** Returns the context components register with while actors are created by SpawnActorsBatch(), or nullptr */
+	FRegisterComponentContext* GetSpawnActorsBatchRegisterContext() const
+	{
+		return SpawnActorsBatchRegisterContext;
+	}
+
 	/** Templated version of SpawnActor that allows you to specify a class type via the template type */
 	template< class T >
 	T* SpawnActor( const FActorSpawnParameters& SpawnParameters = FActorSpawnParameters() )
@@ -174,6 +174,7 @@ protected:
 	// This is the most recent async state from simulated. Only safe for access on physics thread.
 	TSharedPtr<FCharacterMovementComponentAsyncOutput, ESPMode::ThreadSafe> AsyncSimState;
 	bool bMovementModeDirty = false; // Gamethread changed movement mode, need to update sim.
+	bool bUsingAsyncMovementThisFrame = false; // Set in TickComponent, movement for this frame is simulated on physics thread.
 private:
 
 	/**
@@ -2097,6 +2098,12 @@ protected:
 	/* Register async callback with physics system. */
 	virtual void RegisterAsyncCallback();
 	virtual bool IsAsyncCallbackRegistered() const;
+
+	/**
+	 * Whether movement should be simulated on the physics thread this frame.
+	 * Only locally controlled characters with authority are supported, other roles and root motion sources fall back to game thread movement.
+	 */
+	virtual bool ShouldUseAsyncMovement() const;
 	
 public:
 
@@ -27,6 +27,7 @@
 #include "ContentStreaming.h"
 #include "DrawDebugHelpers.h"
 #include "Engine/InputDelegateBinding.h"
+#include "Engine/LevelActorContainer.h"
 #include "Engine/LevelStreamingPersistent.h"
 #include "PhysicsPublic.h"
 #include "Logging/MessageLog.h"
@@ -243,6 +244,11 @@ FName FActorTickFunction::DiagnosticContext(bool bDetailed)
 	}
 }
 
+const UObject* FActorTickFunction::GetTickBatchKey() const
+{
+	return Target ? Target->GetClass() : nullptr;
+}
+
 bool AActor::CheckDefaultSubobjectsInternal() const
 {
 	bool Result = Super::CheckDefaultSubobjectsInternal();
@@ -1311,6 +1317,7 @@ bool AActor::Rename( const TCHAR* InName, UObject* NewOuter, ERenameFlags Flags
 	{
 		RegisterAllActorTickFunctions(false, true); // unregister all tick functions
 		UnregisterAllComponents();
+		DissolveSpawnedActorCluster(this);
 
 		if (ULevel* MyLevel = GetLevel())
 		{
@@ -3182,6 +3189,9 @@ void AActor::AddOwnedComponent(UActorComponent* Component)
 
 	if (!bAlreadyInSet)
 	{
+		// The new component isn't part of the GC cluster created when the actor was spawned
+		DissolveSpawnedActorCluster(this);
+
 		if (Component->GetIsReplicated())
 		{
 			ReplicatedComponents.AddUnique(Component);
@@ -3210,6 +3220,9 @@ void AActor::RemoveOwnedComponent(UActorComponent* Component)
 
 	if (OwnedComponents.Remove(Component) > 0)
 	{
+		// The removed component would be kept alive by the GC cluster created when the actor was spawned
+		DissolveSpawnedActorCluster(this);
+
 		ReplicatedComponents.RemoveSingleSwap(Component);
 		RemoveReplicatedComponent(Component);
 
@@ -3849,6 +3862,12 @@ void AActor::PostActorConstruction()
 					SCOPE_CYCLE_COUNTER(STAT_ActorBeginPlay);
 					DispatchBeginPlay();
 				}
+
+				if (IsValidChecked(this))
+				{
+					// The actor and its components are fully set up now so they can be walked by GC as a unit
+					CreateSpawnedActorCluster(this);
+				}
 			}
 		}
 	}
@@ -5189,8 +5208,9 @@ void AActor::RegisterAllComponents()
 	
 	PreRegisterAllComponents();
 
-	// 0 - means register all components
-	bool bAllRegistered = IncrementalRegisterComponents(0);
+	// 0 - means register all components. Actors spawned by UWorld::SpawnActorsBatch defer adding their primitives to the scene to the end of the batch.
+	UWorld* const World = GetWorld();
+	bool bAllRegistered = IncrementalRegisterComponents(0, World ? World->GetSpawnActorsBatchRegisterContext() : nullptr);
 	check(bAllRegistered);
 
 	// Clear this flag as it's no longer deferred
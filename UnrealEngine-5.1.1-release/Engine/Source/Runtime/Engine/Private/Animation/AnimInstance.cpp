@@ -123,6 +123,7 @@ UAnimInstance::UAnimInstance(const FObjectInitializer& ObjectInitializer)
 	bReceiveNotifiesFromLinkedInstances = false;
 	bPropagateNotifiesToLinkedInstances = false;
 	bUseMainInstanceMontageEvaluationData = false;
+	bShareCrowdPoses = false;
 
 #if DO_CHECK
 	bInitializing = false;
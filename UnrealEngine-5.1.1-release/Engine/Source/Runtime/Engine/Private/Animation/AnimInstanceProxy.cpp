@@ -28,6 +28,7 @@
 #include "Animation/AnimBlueprintGeneratedClass.h"
 #include "Animation/AnimStateMachineTypes.h"
 #include "Animation/AnimTrace.h"
+#include "Hash/CityHash.h"
 #if WITH_EDITOR
 #include "Engine/PoseWatchRenderData.h"
 #include "Engine/PoseWatch.h"
@@ -51,6 +52,120 @@ const FName NAME_Evaluate(TEXT("Evaluate"));
 const FName NAME_Update(TEXT("Update"));
 const FName NAME_AnimGraph(TEXT("AnimGraph"));
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Crowd Pose Cache Hits"), STAT_AnimCrowdPoseCacheHits, STATGROUP_Anim);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Crowd Pose Cache Misses"), STAT_AnimCrowdPoseCacheMisses, STATGROUP_Anim);
+
+static bool GAnimCrowdPoseSharing = false;
+static FAutoConsoleVariableRef CVarAnimCrowdPoseSharing(
+	TEXT("a.CrowdPoseSharing"),
+	GAnimCrowdPoseSharing,
+	TEXT("If true, anim instances with bShareCrowdPoses reuse the pose of an instance with matching quantized asset players evaluated the same frame."));
+
+static float GAnimCrowdPoseSharingTimeTolerance = 1.f / 30.f;
+static FAutoConsoleVariableRef CVarAnimCrowdPoseSharingTimeTolerance(
+	TEXT("a.CrowdPoseSharing.TimeTolerance"),
+	GAnimCrowdPoseSharingTimeTolerance,
+	TEXT("Play positions are quantized to this many seconds when matching crowd poses. 0 requires exact matches."));
+
+static float GAnimCrowdPoseSharingWeightTolerance = 0.05f;
+static FAutoConsoleVariableRef CVarAnimCrowdPoseSharingWeightTolerance(
+	TEXT("a.CrowdPoseSharing.WeightTolerance"),
+	GAnimCrowdPoseSharingWeightTolerance,
+	TEXT("Blend weights are quantized to this step when matching crowd poses. 0 requires exact matches."));
+
+static float GAnimCrowdPoseSharingBlendSpaceTolerance = 1.f;
+static FAutoConsoleVariableRef CVarAnimCrowdPoseSharingBlendSpaceTolerance(
+	TEXT("a.CrowdPoseSharing.BlendSpaceTolerance"),
+	GAnimCrowdPoseSharingBlendSpaceTolerance,
+	TEXT("Blend space positions are quantized to this step, in blend parameter units, when matching crowd poses. 0 requires exact matches."));
+
+namespace UE::Anim
+{
+
+static uint32 QuantizeForCrowdPose(float Value, float Tolerance)
+{
+	if (Tolerance > 0.f)
+	{
+		return (uint32)FMath::RoundToInt(Value / Tolerance);
+	}
+
+	uint32 Bits;
+	FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+	return Bits;
+}
+
+/** Poses evaluated this frame by anim instances sharing crowd poses, keyed by FAnimInstanceProxy::GetCrowdPoseKey */
+class FCrowdPoseCache
+{
+public:
+	bool Find(uint64 Key, FPoseContext& Output)
+	{
+		FScopeLock Lock(&CriticalSection);
+		ResetIfStale();
+
+		const FEntry* Entry = Entries.Find(Key);
+		if (Entry == nullptr
+			|| Entry->Mesh != Output.Pose.GetBoneContainer().GetSkeletalMeshAsset()
+			|| Entry->Bones.Num() != Output.Pose.GetNumBones()
+			|| Entry->CurveWeights.Num() != Output.Curve.CurveWeights.Num())
+		{
+			return false;
+		}
+
+		CopyAssignItems(Output.Pose.GetMutableBones().GetData(), Entry->Bones.GetData(), Entry->Bones.Num());
+		Output.Curve.CurveWeights = Entry->CurveWeights;
+		Output.Curve.ValidCurveWeights = Entry->ValidCurveWeights;
+		return true;
+	}
+
+	void Add(uint64 Key, const FPoseContext& Output)
+	{
+		// Attributes are not shared, instances producing any keep evaluating their own graph
+		if (Output.CustomAttributes.ContainsData())
+		{
+			return;
+		}
+
+		FScopeLock Lock(&CriticalSection);
+		ResetIfStale();
+
+		if (!Entries.Contains(Key))
+		{
+			FEntry& Entry = Entries.Add(Key);
+			Entry.Mesh = Output.Pose.GetBoneContainer().GetSkeletalMeshAsset();
+			Entry.Bones = Output.Pose.GetBones();
+			Entry.CurveWeights = Output.Curve.CurveWeights;
+			Entry.ValidCurveWeights = Output.Curve.ValidCurveWeights;
+		}
+	}
+
+private:
+	struct FEntry
+	{
+		const USkeletalMesh* Mesh = nullptr;
+		TArray<FTransform> Bones;
+		TArray<float> CurveWeights;
+		TBitArray<FDefaultAllocator> ValidCurveWeights;
+	};
+
+	void ResetIfStale()
+	{
+		if (FrameCounter != GFrameCounter)
+		{
+			FrameCounter = GFrameCounter;
+			Entries.Reset();
+		}
+	}
+
+	FCriticalSection CriticalSection;
+	TMap<uint64, FEntry> Entries;
+	uint64 FrameCounter = 0;
+};
+
+static FCrowdPoseCache GCrowdPoseCache;
+
+} // namespace UE::Anim
+
 FAnimInstanceProxy::FAnimInstanceProxy()
 	: AnimInstanceObject(nullptr)
 	, AnimClassInterface(nullptr)
@@ -75,6 +190,7 @@ FAnimInstanceProxy::FAnimInstanceProxy()
 #endif
 	, bInitializeSubsystems(false)
 	, bUseMainInstanceMontageEvaluationData(false)
+	, bShareCrowdPoses(false)
 {
 }
 
@@ -102,6 +218,7 @@ FAnimInstanceProxy::FAnimInstanceProxy(UAnimInstance* Instance)
 #endif
 	, bInitializeSubsystems(false)
 	, bUseMainInstanceMontageEvaluationData(false)
+	, bShareCrowdPoses(false)
 {
 }
 
@@ -668,6 +785,7 @@ void FAnimInstanceProxy::InitializeObjects(UAnimInstance* InAnimInstance)
 		MainInstanceProxy = &MainAnimInstance->GetProxyOnAnyThread<FAnimInstanceProxy>();
 		bUseMainInstanceMontageEvaluationData = InAnimInstance->IsUsingMainInstanceMontageEvaluationData();
 	}
+	bShareCrowdPoses = InAnimInstance->bShareCrowdPoses;
 
 	if (SkeletalMeshComponent->GetSkeletalMeshAsset() != nullptr)
 	{
@@ -1284,7 +1402,68 @@ void FAnimInstanceProxy::PreEvaluateAnimation(UAnimInstance* InAnimInstance)
 
 void FAnimInstanceProxy::EvaluateAnimation(FPoseContext& Output)
 {
+	const uint64 CrowdPoseKey = GetCrowdPoseKey();
+	if (CrowdPoseKey != 0)
+	{
+		if (UE::Anim::GCrowdPoseCache.Find(CrowdPoseKey, Output))
+		{
+			INC_DWORD_STAT(STAT_AnimCrowdPoseCacheHits);
+			return;
+		}
+		INC_DWORD_STAT(STAT_AnimCrowdPoseCacheMisses);
+	}
+
 	EvaluateAnimation_WithRoot(Output, RootNode);
+
+	if (CrowdPoseKey != 0)
+	{
+		UE::Anim::GCrowdPoseCache.Add(CrowdPoseKey, Output);
+	}
+}
+
+uint64 FAnimInstanceProxy::GetCrowdPoseKey()
+{
+	if (!GAnimCrowdPoseSharing || !bShareCrowdPoses || !RequiredBones.IsValid() || MontageEvaluationData.Num() > 0
+		|| (SkeletalMeshComponent && SkeletalMeshComponent->GetLinkedAnimInstances().Num() > 0))
+	{
+		return 0;
+	}
+
+	TArray<uint32, TInlineAllocator<64>> KeyData;
+	const UPTRINT ClassPtr = (UPTRINT)AnimClassInterface;
+	const UPTRINT MeshPtr = (UPTRINT)RequiredBones.GetSkeletalMeshAsset();
+	KeyData.Add((uint32)ClassPtr);
+	KeyData.Add((uint32)((uint64)ClassPtr >> 32));
+	KeyData.Add((uint32)MeshPtr);
+	KeyData.Add((uint32)((uint64)MeshPtr >> 32));
+	KeyData.Add((uint32)LODLevel);
+	KeyData.Add((uint32)RequiredBones.GetBoneIndicesArray().Num());
+
+	auto AddTickRecords = [&KeyData](const TArray<FAnimTickRecord>& TickRecords)
+	{
+		for (const FAnimTickRecord& TickRecord : TickRecords)
+		{
+			const UPTRINT AssetPtr = (UPTRINT)TickRecord.SourceAsset.Get();
+			KeyData.Add((uint32)AssetPtr);
+			KeyData.Add((uint32)((uint64)AssetPtr >> 32));
+			KeyData.Add(TickRecord.TimeAccumulator ? UE::Anim::QuantizeForCrowdPose(*TickRecord.TimeAccumulator, GAnimCrowdPoseSharingTimeTolerance) : 0);
+			KeyData.Add(UE::Anim::QuantizeForCrowdPose(TickRecord.EffectiveBlendWeight, GAnimCrowdPoseSharingWeightTolerance));
+			if (Cast<UBlendSpace>(TickRecord.SourceAsset))
+			{
+				KeyData.Add(UE::Anim::QuantizeForCrowdPose(TickRecord.BlendSpace.BlendSpacePositionX, GAnimCrowdPoseSharingBlendSpaceTolerance));
+				KeyData.Add(UE::Anim::QuantizeForCrowdPose(TickRecord.BlendSpace.BlendSpacePositionY, GAnimCrowdPoseSharingBlendSpaceTolerance));
+			}
+		}
+	};
+
+	for (const TPair<FName, FAnimGroupInstance>& SyncGroupPair : GetSyncGroupMapRead())
+	{
+		AddTickRecords(SyncGroupPair.Value.ActivePlayers);
+	}
+	AddTickRecords(GetUngroupedActivePlayersRead());
+
+	// 0 is reserved for poses that are not shared
+	return FMath::Max<uint64>(CityHash64((const char*)KeyData.GetData(), KeyData.Num() * sizeof(uint32)), 1);
 }
 
 void FAnimInstanceProxy::EvaluateAnimation_WithRoot(FPoseContext& Output, FAnimNode_Base* InRootNode)
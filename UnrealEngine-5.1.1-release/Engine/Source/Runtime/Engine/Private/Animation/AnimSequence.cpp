@@ -110,6 +110,96 @@ static FAutoConsoleVariableRef CVarOddFrameStripping(
 	GPerformFrameStrippingOddFramedAnimations,
 	TEXT("1 = When frame stripping apply to animations with an odd number of frames too. 0 = only even framed animations"));
 
+static bool GAnimDecompressionCache = false;
+static FAutoConsoleVariableRef CVarAnimDecompressionCache(
+	TEXT("a.DecompressionCache"),
+	GAnimDecompressionCache,
+	TEXT("If true, poses decompressed from a sequence are shared with every component sampling it on the same mesh at a nearby time within the frame."));
+
+static float GAnimDecompressionCacheTimeTolerance = 1.f / 60.f;
+static FAutoConsoleVariableRef CVarAnimDecompressionCacheTimeTolerance(
+	TEXT("a.DecompressionCache.TimeTolerance"),
+	GAnimDecompressionCacheTimeTolerance,
+	TEXT("Sample times are quantized to this many seconds when looking up the decompression cache. 0 requires exact matches."));
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Decompression Cache Hits"), STAT_AnimDecompressionCacheHits, STATGROUP_Anim);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Decompression Cache Misses"), STAT_AnimDecompressionCacheMisses, STATGROUP_Anim);
+
+namespace UE::Anim
+{
+
+/** Compressed poses decompressed this frame, keyed by sequence, quantized time and everything else that changes the decompressed pose */
+class FDecompressionCache
+{
+public:
+	struct FKey
+	{
+		const UAnimSequence* Sequence = nullptr;
+		const UObject* Asset = nullptr;
+		int32 QuantizedTime = 0;
+		int32 NumBones = 0;
+		bool bExtractRootMotion = false;
+		bool bDisableRetargeting = false;
+		bool bIsBakedAdditive = false;
+
+		bool operator==(const FKey& Other) const
+		{
+			return Sequence == Other.Sequence && Asset == Other.Asset && QuantizedTime == Other.QuantizedTime && NumBones == Other.NumBones
+				&& bExtractRootMotion == Other.bExtractRootMotion && bDisableRetargeting == Other.bDisableRetargeting && bIsBakedAdditive == Other.bIsBakedAdditive;
+		}
+
+		friend uint32 GetTypeHash(const FKey& Key)
+		{
+			uint32 Hash = HashCombine(GetTypeHash(Key.Sequence), GetTypeHash(Key.Asset));
+			Hash = HashCombine(Hash, GetTypeHash(Key.QuantizedTime));
+			const uint32 Flags = (uint32)Key.bExtractRootMotion | ((uint32)Key.bDisableRetargeting << 1) | ((uint32)Key.bIsBakedAdditive << 2);
+			return HashCombine(Hash, HashCombine(GetTypeHash(Key.NumBones), Flags));
+		}
+	};
+
+	bool Find(const FKey& Key, FCompactPose& OutPose)
+	{
+		FReadScopeLock ReadLock(Lock);
+		if (FrameCounter != GFrameCounter)
+		{
+			return false;
+		}
+
+		const TArray<FTransform>* Bones = Entries.Find(Key);
+		if (Bones == nullptr || Bones->Num() != OutPose.GetNumBones())
+		{
+			return false;
+		}
+
+		CopyAssignItems(OutPose.GetMutableBones().GetData(), Bones->GetData(), Bones->Num());
+		return true;
+	}
+
+	void Add(const FKey& Key, const FCompactPose& Pose)
+	{
+		FWriteScopeLock WriteLock(Lock);
+		if (FrameCounter != GFrameCounter)
+		{
+			FrameCounter = GFrameCounter;
+			Entries.Reset();
+		}
+
+		if (!Entries.Contains(Key))
+		{
+			Entries.Add(Key, Pose.GetBones());
+		}
+	}
+
+private:
+	FRWLock Lock;
+	TMap<FKey, TArray<FTransform>> Entries;
+	uint64 FrameCounter = 0;
+};
+
+static FDecompressionCache GDecompressionCache;
+
+} // namespace UE::Anim
+
 int32 GStripAdditiveRefPose = 0;
 static FAutoConsoleVariableRef CVarStripAdditiveRefPose(
 	TEXT("a.StripAdditiveRefPose"),
@@ -1629,7 +1719,41 @@ void UAnimSequence::GetBonePose(FAnimationPoseData& OutAnimationPoseData, const
 	}
 #endif // WITH_EDITOR
 
-	DecompressPose(OutPose, CompressedData, ExtractionContext, GetSkeleton(), GetPlayLength(), Interpolation, bIsBakedAdditive, GetRetargetTransforms(), GetRetargetTransformsSourceName(), RootMotionReset);
+	// Partial and pose curve driven extractions depend on more than the sample time, they are never shared
+	const bool bUseDecompressionCache = GAnimDecompressionCache && ExtractionContext.BonesRequired.Num() == 0 && ExtractionContext.PoseCurves.Num() == 0;
+	UE::Anim::FDecompressionCache::FKey DecompressionCacheKey;
+	if (bUseDecompressionCache)
+	{
+		DecompressionCacheKey.Sequence = this;
+		DecompressionCacheKey.Asset = RequiredBones.GetAsset();
+		if (GAnimDecompressionCacheTimeTolerance > 0.f)
+		{
+			DecompressionCacheKey.QuantizedTime = FMath::RoundToInt(ExtractionContext.CurrentTime / GAnimDecompressionCacheTimeTolerance);
+		}
+		else
+		{
+			FMemory::Memcpy(&DecompressionCacheKey.QuantizedTime, &ExtractionContext.CurrentTime, sizeof(int32));
+		}
+		DecompressionCacheKey.NumBones = OutPose.GetNumBones();
+		DecompressionCacheKey.bExtractRootMotion = ExtractionContext.bExtractRootMotion;
+		DecompressionCacheKey.bDisableRetargeting = bDisableRetargeting;
+		DecompressionCacheKey.bIsBakedAdditive = bIsBakedAdditive;
+	}
+
+	if (bUseDecompressionCache && UE::Anim::GDecompressionCache.Find(DecompressionCacheKey, OutPose))
+	{
+		INC_DWORD_STAT(STAT_AnimDecompressionCacheHits);
+	}
+	else
+	{
+		DecompressPose(OutPose, CompressedData, ExtractionContext, GetSkeleton(), GetPlayLength(), Interpolation, bIsBakedAdditive, GetRetargetTransforms(), GetRetargetTransformsSourceName(), RootMotionReset);
+
+		if (bUseDecompressionCache)
+		{
+			INC_DWORD_STAT(STAT_AnimDecompressionCacheMisses);
+			UE::Anim::GDecompressionCache.Add(DecompressionCacheKey, OutPose);
+		}
+	}
 
 	EvaluateAttributes(OutAnimationPoseData, ExtractionContext, false);
 }
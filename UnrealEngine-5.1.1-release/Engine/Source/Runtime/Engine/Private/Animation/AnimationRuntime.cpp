@@ -67,6 +67,14 @@ static_assert(sizeof(ispc::FPerBoneBlendWeight) == sizeof(FPerBoneBlendWeight),
 #define ANIM_BLEND_POSES_PER_BONE_FILTER_ISPC_ENABLED_DEFAULT 1
 #endif
 
+#if !defined(ANIM_BLEND_TWO_POSES_PER_BONE_ISPC_ENABLED_DEFAULT)
+#define ANIM_BLEND_TWO_POSES_PER_BONE_ISPC_ENABLED_DEFAULT 1
+#endif
+
+#if !defined(ANIM_LERP_POSES_PER_BONE_ISPC_ENABLED_DEFAULT)
+#define ANIM_LERP_POSES_PER_BONE_ISPC_ENABLED_DEFAULT 1
+#endif
+
 #if UE_BUILD_SHIPPING
 static constexpr bool bAnim_BlendPoseOverwrite_ISPC_Enabled = ANIM_BLEND_POSE_OVERWRITE_ISPC_ENABLED_DEFAULT;
 static constexpr bool bAnim_BlendPoseAccumulate_ISPC_Enabled = ANIM_BLEND_POSE_ACCUMULATE_ISPC_ENABLED_DEFAULT;
@@ -76,6 +84,8 @@ static constexpr bool bAnim_ConvertPoseToMeshRotation_ISPC_Enabled = ANIM_CONVER
 static constexpr bool bAnim_ConvertMeshRotationPoseToLocalSpace_ISPC_Enabled = ANIM_CONVERT_MESH_ROTATION_TO_LOCAL_SPACE_ISPC_ENABLED_DEFAULT;
 static constexpr bool bAnim_AccumulateLocalSpaceAdditivePose_ISPC_Enabled = ANIM_ACCUMULATE_LOCAL_SPACE_ADDITIVE_POSE_ISPC_ENABLED_DEFAULT;
 static constexpr bool bAnim_BlendPosesPerBoneFilter_ISPC_Enabled = ANIM_BLEND_POSES_PER_BONE_FILTER_ISPC_ENABLED_DEFAULT;
+static constexpr bool bAnim_BlendTwoPosesPerBone_ISPC_Enabled = ANIM_BLEND_TWO_POSES_PER_BONE_ISPC_ENABLED_DEFAULT;
+static constexpr bool bAnim_LerpPosesPerBone_ISPC_Enabled = ANIM_LERP_POSES_PER_BONE_ISPC_ENABLED_DEFAULT;
 #else
 static bool bAnim_BlendPoseOverwrite_ISPC_Enabled = ANIM_BLEND_POSE_OVERWRITE_ISPC_ENABLED_DEFAULT;
 static FAutoConsoleVariableRef CVarBlendPoseOverwriteISPCEnabled(TEXT("a.BlendPoseOverwrite.ISPC"), bAnim_BlendPoseOverwrite_ISPC_Enabled, TEXT("Whether to use ISPC optimizations for over-write pose blending"));
@@ -93,6 +103,10 @@ static bool bAnim_AccumulateLocalSpaceAdditivePose_ISPC_Enabled = ANIM_ACCUMULAT
 static FAutoConsoleVariableRef CVarAccumulateLocalSpaceAdditivePose(TEXT("a.AccumulateLocalSpaceAdditivePose.ISPC"), bAnim_AccumulateLocalSpaceAdditivePose_ISPC_Enabled, TEXT("Whether to use ISPC optimizations for accumulating local space additive pose"));
 static bool bAnim_BlendPosesPerBoneFilter_ISPC_Enabled = ANIM_BLEND_POSES_PER_BONE_FILTER_ISPC_ENABLED_DEFAULT;
 static FAutoConsoleVariableRef CVarBlendPosesPerBoneFilter(TEXT("a.BlendPosesPerBoneFilter.ISPC"), bAnim_BlendPosesPerBoneFilter_ISPC_Enabled, TEXT("Whether to use ISPC optimizations for blending poses with a per-bone filter"));
+static bool bAnim_BlendTwoPosesPerBone_ISPC_Enabled = ANIM_BLEND_TWO_POSES_PER_BONE_ISPC_ENABLED_DEFAULT;
+static FAutoConsoleVariableRef CVarBlendTwoPosesPerBone(TEXT("a.BlendTwoPosesPerBone.ISPC"), bAnim_BlendTwoPosesPerBone_ISPC_Enabled, TEXT("Whether to use ISPC optimizations for blending two poses with per-bone weights"));
+static bool bAnim_LerpPosesPerBone_ISPC_Enabled = ANIM_LERP_POSES_PER_BONE_ISPC_ENABLED_DEFAULT;
+static FAutoConsoleVariableRef CVarLerpPosesPerBone(TEXT("a.LerpPosesPerBone.ISPC"), bAnim_LerpPosesPerBone_ISPC_Enabled, TEXT("Whether to use ISPC optimizations for interpolating poses with per-bone weights"));
 #endif // UE_BUILD_SHIPPING
 
 #endif // INTEL_ISPC
@@ -527,27 +541,44 @@ void FAnimationRuntime::BlendTwoPosesTogetherPerBone(const FAnimationPoseData& S
 	const FCompactPose& SourcePoseOne = SourcePoseOneData.GetPose();
 	const FCompactPose& SourcePoseTwo = SourcePoseTwoData.GetPose();
 
-	for (FCompactPoseBoneIndex BoneIndex : OutPose.ForEachBoneIndex())
+#if INTEL_ISPC
+	if (bAnim_BlendTwoPosesPerBone_ISPC_Enabled && OutPose.GetNumBones() > 0)
 	{
-		const float BlendWeight = WeightsOfSource2[BoneIndex.GetInt()];
-		if (FAnimationRuntime::IsFullWeight(BlendWeight))
-		{
-			OutPose[BoneIndex] = SourcePoseTwo[BoneIndex];
-		}
-		// if it doesn't have weight, take source pose 1
-		else if (FAnimationRuntime::HasWeight(BlendWeight))
-		{
-			BlendTransform<ETransformBlendMode::Overwrite>(SourcePoseOne[BoneIndex], OutPose[BoneIndex], 1.f - BlendWeight);
-			BlendTransform<ETransformBlendMode::Accumulate>(SourcePoseTwo[BoneIndex], OutPose[BoneIndex], BlendWeight);
-		}
-		else
+		check(WeightsOfSource2.Num() >= OutPose.GetNumBones());
+
+		// Also normalizes the resulting rotations
+		ispc::BlendTwoPosesTogetherPerBone(
+			(ispc::FTransform*)SourcePoseOne.GetBones().GetData(),
+			(ispc::FTransform*)SourcePoseTwo.GetBones().GetData(),
+			WeightsOfSource2.GetData(),
+			(ispc::FTransform*)OutPose.GetMutableBones().GetData(),
+			OutPose.GetNumBones());
+	}
+	else
+#endif
+	{
+		for (FCompactPoseBoneIndex BoneIndex : OutPose.ForEachBoneIndex())
 		{
-			OutPose[BoneIndex] = SourcePoseOne[BoneIndex];
+			const float BlendWeight = WeightsOfSource2[BoneIndex.GetInt()];
+			if (FAnimationRuntime::IsFullWeight(BlendWeight))
+			{
+				OutPose[BoneIndex] = SourcePoseTwo[BoneIndex];
+			}
+			// if it doesn't have weight, take source pose 1
+			else if (FAnimationRuntime::HasWeight(BlendWeight))
+			{
+				BlendTransform<ETransformBlendMode::Overwrite>(SourcePoseOne[BoneIndex], OutPose[BoneIndex], 1.f - BlendWeight);
+				BlendTransform<ETransformBlendMode::Accumulate>(SourcePoseTwo[BoneIndex], OutPose[BoneIndex], BlendWeight);
+			}
+			else
+			{
+				OutPose[BoneIndex] = SourcePoseOne[BoneIndex];
+			}
 		}
-	}
 
-	// Ensure that all of the resulting rotations are normalized
-	OutPose.NormalizeRotations();
+		// Ensure that all of the resulting rotations are normalized
+		OutPose.NormalizeRotations();
+	}
 
 	// @note : This isn't perfect as curve can link to joint, and it would be the best to use that information
 	// but that is very expensive option as we have to have another indirect look up table to search. 
@@ -819,21 +850,37 @@ void FAnimationRuntime::LerpPosesPerBone(FCompactPose& PoseA, const FCompactPose
 		// Make sure poses are compatible with each other.
 		check(&PoseA.GetBoneContainer() == &PoseB.GetBoneContainer());
 
-		for (FCompactPoseBoneIndex BoneIndex : PoseA.ForEachBoneIndex())
+#if INTEL_ISPC
+		if (bAnim_LerpPosesPerBone_ISPC_Enabled && PoseA.GetNumBones() > 0)
 		{
-			const float BoneAlpha = Alpha * PerBoneWeights[BoneIndex.GetInt()];
-			if (FAnimWeight::IsRelevant(BoneAlpha))
+			check(PerBoneWeights.Num() >= PoseA.GetNumBones());
+
+			ispc::LerpPosesPerBone(
+				(ispc::FTransform*)PoseA.GetMutableBones().GetData(),
+				(ispc::FTransform*)PoseB.GetBones().GetData(),
+				Alpha,
+				PerBoneWeights.GetData(),
+				PoseA.GetNumBones());
+		}
+		else
+#endif
+		{
+			for (FCompactPoseBoneIndex BoneIndex : PoseA.ForEachBoneIndex())
 			{
-				const ScalarRegister VWeightOfPose1(1.f - BoneAlpha);
-				const ScalarRegister VWeightOfPose2(BoneAlpha);
+				const float BoneAlpha = Alpha * PerBoneWeights[BoneIndex.GetInt()];
+				if (FAnimWeight::IsRelevant(BoneAlpha))
+				{
+					const ScalarRegister VWeightOfPose1(1.f - BoneAlpha);
+					const ScalarRegister VWeightOfPose2(BoneAlpha);
 
-				FTransform& InOutBoneTransform1 = PoseA[BoneIndex];
-				InOutBoneTransform1 *= VWeightOfPose1;
+					FTransform& InOutBoneTransform1 = PoseA[BoneIndex];
+					InOutBoneTransform1 *= VWeightOfPose1;
 
-				const FTransform& BoneTransform2 = PoseB[BoneIndex];
-				InOutBoneTransform1.AccumulateWithShortestRotation(BoneTransform2, VWeightOfPose2);
+					const FTransform& BoneTransform2 = PoseB[BoneIndex];
+					InOutBoneTransform1.AccumulateWithShortestRotation(BoneTransform2, VWeightOfPose2);
 
-				InOutBoneTransform1.NormalizeRotation();
+					InOutBoneTransform1.NormalizeRotation();
+				}
 			}
 		}
 
@@ -4,6 +4,8 @@
 #include "ActiveSound.h"
 #include "Audio/AudioDebug.h"
 #include "AudioDevice.h"
+#include "AudioThread.h"
+#include "Kismet/GameplayStatics.h"
 #include "Sound/SoundBase.h"
 
 
@@ -42,12 +44,21 @@ FAutoConsoleVariableRef CVarVirtualLoopsUpdateRateMax(
 	TEXT("Sets maximum rate to check if sound becomes audible again (at beyond sound's max audible distance + perf scaling distance).\n"),
 	ECVF_Default);
 
+static float VirtualLoopsPrefetchDistanceCVar = 1000.0f;
+FAutoConsoleVariableRef CVarVirtualLoopsPrefetchDistance(
+	TEXT("au.VirtualLoops.PrefetchDistance"),
+	VirtualLoopsPrefetchDistanceCVar,
+	TEXT("Distance beyond the max audible distance of a virtualized loop at which its streamed chunks are requested, so they are loaded when it realizes.\n")
+	TEXT("0: Disabled"),
+	ECVF_Default);
+
 
 FAudioVirtualLoop::FAudioVirtualLoop()
 	: TimeSinceLastUpdate(0.0f)
 	, TimeVirtualized(0.0f)
 	, UpdateInterval(0.0f)
 	, ActiveSound(nullptr)
+	, bIsPrimed(false)
 {
 }
 
@@ -134,7 +145,7 @@ bool FAudioVirtualLoop::IsEnabled()
 	return bVirtualLoopsEnabledCVar != 0;
 }
 
-bool FAudioVirtualLoop::IsInAudibleRange(const FActiveSound& InActiveSound, const FAudioDevice* InAudioDevice)
+bool FAudioVirtualLoop::IsInAudibleRange(const FActiveSound& InActiveSound, const FAudioDevice* InAudioDevice, float InRangeExtension)
 {
 	if (!InActiveSound.bAllowSpatialization)
 	{
@@ -167,7 +178,27 @@ bool FAudioVirtualLoop::IsInAudibleRange(const FActiveSound& InActiveSound, cons
 
 	DistanceScale = FMath::Max(DistanceScale, UE_KINDA_SMALL_NUMBER);
 	const FVector Location = InActiveSound.Transform.GetLocation();
-	return AudioDevice->LocationIsAudible(Location, InActiveSound.MaxDistance / DistanceScale);
+	return AudioDevice->LocationIsAudible(Location, InActiveSound.MaxDistance / DistanceScale + InRangeExtension);
+}
+
+void FAudioVirtualLoop::PrimeIfApproachingAudibleRange()
+{
+	check(ActiveSound);
+
+	if (bIsPrimed || VirtualLoopsPrefetchDistanceCVar <= 0.0f || !IsInAudibleRange(*ActiveSound, nullptr, VirtualLoopsPrefetchDistanceCVar))
+	{
+		return;
+	}
+
+	bIsPrimed = true;
+
+	// Priming reads the sound wave data to build its proxy, so it is done on the game thread
+	TWeakObjectPtr<USoundBase> WeakSound(ActiveSound->GetSound());
+	DECLARE_CYCLE_STAT(TEXT("FGameThreadAudioTask.PrimeVirtualLoop"), STAT_AudioPrimeVirtualLoop, STATGROUP_TaskGraphTasks);
+	FAudioThread::RunCommandOnGameThread([WeakSound]()
+	{
+		UGameplayStatics::PrimeSound(WeakSound.Get());
+	}, GET_STATID(STAT_AudioPrimeVirtualLoop));
 }
 
 void FAudioVirtualLoop::UpdateFocusData(float DeltaTime)
@@ -226,6 +257,7 @@ bool FAudioVirtualLoop::Update(float DeltaTime, bool bForceUpdate)
 	// If not audible, update when will be checked again and return false
 	if (!IsInAudibleRange(*ActiveSound))
 	{
+		PrimeIfApproachingAudibleRange();
 		CalculateUpdateInterval();
 		return false;
 	}
@@ -60,7 +60,7 @@ void FCharacterMovementComponentAsyncInput::Simulate(const float DeltaSeconds, F
 		{
 			AdjustProxyCapsuleSize();
 		}*/
-		ensure(false);
+		// Simulated proxies are not simulated asynchronously, see UCharacterMovementComponent::ShouldUseAsyncMovement.
 		//SimulatedTick(DeltaSeconds);
 	}
 
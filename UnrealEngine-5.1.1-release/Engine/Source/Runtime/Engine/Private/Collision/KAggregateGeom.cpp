@@ -14,6 +14,7 @@
 #include "PhysicsEngine/SphylElem.h"
 #include "PhysicsEngine/AggregateGeom.h"
 #include "Engine/Polys.h"
+#include "Math/TransformBatch.h"
 #include "PhysXIncludes.h"
 #include "Chaos/Convex.h"
 #include "Chaos/Levelset.h"
@@ -735,11 +736,7 @@ void FKConvexElem::UpdateElemBox()
 		ComputeChaosConvexIndices();
 	}
 
-	ElemBox.Init();
-	for(int32 j=0; j<VertexData.Num(); j++)
-	{
-		ElemBox += VertexData[j];
-	}
+	ElemBox = UE::Math::ComputeBounds(VertexData);
 }
 
 bool FKConvexElem::HullFromPlanes(const TArray<FPlane>& InPlanes, const TArray<FVector>& SnapVerts, float InSnapDistance)
@@ -946,10 +943,7 @@ void FKConvexElem::ConvexFromBoxElem(const FKBoxElem& InBox)
 
 void FKConvexElem::BakeTransformToVerts()
 {
-	for (int32 VertIdx = 0; VertIdx < VertexData.Num(); VertIdx++)
-	{
-		VertexData[VertIdx] = Transform.TransformPosition(VertexData[VertIdx]);
-	}
+	UE::Math::TransformPositions(Transform, VertexData);
 
 	Transform = FTransform::Identity;
 	UpdateElemBox();
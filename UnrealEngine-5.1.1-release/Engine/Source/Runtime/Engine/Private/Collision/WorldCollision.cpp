@@ -16,6 +16,10 @@
 #include "PhysXPublic.h"
 #include "Physics/PhysicsInterfaceTypes.h"
 #include "Chaos/ImplicitObject.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+#include "GameFramework/PlayerController.h"
+#include "Math/RandomStream.h"
 
 using namespace PhysicsInterfaceTypes;
 
@@ -37,6 +41,7 @@ DEFINE_STAT(STAT_Collision_GeomOverlapAny);
 DEFINE_STAT(STAT_Collision_FBodyInstance_OverlapMulti);
 DEFINE_STAT(STAT_Collision_FBodyInstance_OverlapTest);
 DEFINE_STAT(STAT_Collision_FBodyInstance_LineTrace);
+DEFINE_STAT(STAT_Collision_BatchedTraceSingle);
 DEFINE_STAT(STAT_Collision_PreFilter);
 
 /** default collision response container - to be used without reconstructing every time**/
@@ -52,6 +57,112 @@ FCollisionShape					FCollisionShape::LineShape;
 // default being the 0. That isn't invalid, but ObjectQuery param overrides this 
 ECollisionChannel DefaultCollisionChannel = (ECollisionChannel) 0;
 
+static int32 GBatchedTraceMinPerTask = 32;
+static FAutoConsoleVariableRef CVarBatchedTraceMinPerTask(
+	TEXT("p.BatchedTrace.MinPerTask"),
+	GBatchedTraceMinPerTask,
+	TEXT("Minimum number of traces of a batched scene query run by each task. Batches smaller than this are traced on the calling thread. 0 traces every batch on the calling thread."),
+	ECVF_Default);
+
+static bool GBatchedTraceSortRays = true;
+static FAutoConsoleVariableRef CVarBatchedTraceSortRays(
+	TEXT("p.BatchedTrace.SortRays"),
+	GBatchedTraceSortRays,
+	TEXT("Whether the traces of a batched scene query are traced along a Morton order of their start and direction, so that each task walks the same parts of the acceleration structure."),
+	ECVF_Default);
+
+namespace BatchedTrace
+{
+	/** Spreads the low 10 bits of Value so that there are two zero bits between each */
+	static uint32 SpreadBits(uint32 Value)
+	{
+		Value &= 0x3ff;
+		Value = (Value | (Value << 16)) & 0x030000ff;
+		Value = (Value | (Value << 8)) & 0x0300f00f;
+		Value = (Value | (Value << 4)) & 0x030c30c3;
+		Value = (Value | (Value << 2)) & 0x09249249;
+		return Value;
+	}
+
+	/** Morton code of the start within the bounds of the batch, then of the direction, so coherent rays end up next to each other */
+	static uint64 GetSortKey(const FVector& Start, const FVector& End, const FBox& Bounds)
+	{
+		const FVector Extent = (Bounds.Max - Bounds.Min).ComponentMax(FVector(UE_KINDA_SMALL_NUMBER));
+		const FVector Position = (Start - Bounds.Min) / Extent * 1023.0;
+		const FVector Direction = ((End - Start).GetSafeNormal() + FVector::OneVector) * (0.5 * 1023.0);
+
+		const uint64 PositionKey = SpreadBits((uint32)Position.X) | (SpreadBits((uint32)Position.Y) << 1) | (SpreadBits((uint32)Position.Z) << 2);
+		const uint64 DirectionKey = SpreadBits((uint32)Direction.X >> 7) | (SpreadBits((uint32)Direction.Y >> 7) << 1) | (SpreadBits((uint32)Direction.Z >> 7) << 2);
+		return (PositionKey << 9) | (DirectionKey & 0x1ff);
+	}
+
+	/** Traces every ray of the batch with TraceFunc(Start, End, OutHit), on the task workers for large batches */
+	template<typename TraceFuncType>
+	static int32 Run(TArray<FHitResult>& OutHits, TArrayView<const FVector> Starts, TArrayView<const FVector> Ends, const TraceFuncType& TraceFunc)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_Collision_BatchedTraceSingle);
+
+		const int32 NumTraces = Starts.Num();
+		check(Ends.Num() == NumTraces);
+
+		OutHits.Reset(NumTraces);
+		OutHits.AddDefaulted(NumTraces);
+		if (NumTraces == 0)
+		{
+			return 0;
+		}
+
+		TArray<int32> Order;
+		Order.SetNumUninitialized(NumTraces);
+		for (int32 Index = 0; Index < NumTraces; ++Index)
+		{
+			Order[Index] = Index;
+		}
+
+		if (GBatchedTraceSortRays && NumTraces > 1)
+		{
+			FBox Bounds(ForceInit);
+			for (const FVector& Start : Starts)
+			{
+				Bounds += Start;
+			}
+
+			TArray<uint64> Keys;
+			Keys.SetNumUninitialized(NumTraces);
+			for (int32 Index = 0; Index < NumTraces; ++Index)
+			{
+				Keys[Index] = GetSortKey(Starts[Index], Ends[Index], Bounds);
+			}
+			Order.Sort([&Keys](int32 A, int32 B) { return Keys[A] < Keys[B]; });
+		}
+
+		const bool bParallel = GBatchedTraceMinPerTask > 0 && NumTraces >= 2 * GBatchedTraceMinPerTask && FApp::ShouldUseThreadingForPerformance();
+		const int32 NumTasks = bParallel ? FMath::Min(NumTraces / GBatchedTraceMinPerTask, FTaskGraphInterface::Get().GetNumWorkerThreads() + 1) : 1;
+		const int32 TracesPerTask = FMath::DivideAndRoundUp(NumTraces, NumTasks);
+
+		std::atomic<int32> NumBlockingHits{ 0 };
+		ParallelFor(NumTasks, [&](int32 TaskIndex)
+		{
+			const int32 First = TaskIndex * TracesPerTask;
+			const int32 Last = FMath::Min(First + TracesPerTask, NumTraces);
+
+			int32 TaskBlockingHits = 0;
+			for (int32 SortedIndex = First; SortedIndex < Last; ++SortedIndex)
+			{
+				// Each trace writes to its own slot, the results stay in the order of the inputs
+				const int32 TraceIndex = Order[SortedIndex];
+				if (TraceFunc(Starts[TraceIndex], Ends[TraceIndex], OutHits[TraceIndex]))
+				{
+					++TaskBlockingHits;
+				}
+			}
+			NumBlockingHits += TaskBlockingHits;
+		}, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+
+		return NumBlockingHits.load();
+	}
+}
+
 
 /* Set functions for each Shape type */
 void FBaseTraceDatum::Set(UWorld * World, const FCollisionShape& InCollisionShape, const FCollisionQueryParams& Param, const struct FCollisionResponseParams &InResponseParam, const struct FCollisionObjectQueryParams& InObjectQueryParam,
@@ -99,6 +210,88 @@ bool UWorld::SweepTestByChannel(const FVector& Start, const FVector& End, const
 	}
 }
 
+int32 UWorld::LineTraceSingleByChannelBatched(TArray<struct FHitResult>& OutHits, TArrayView<const FVector> Starts, TArrayView<const FVector> Ends, ECollisionChannel TraceChannel, const FCollisionQueryParams& Params /* = FCollisionQueryParams::DefaultQueryParam */, const FCollisionResponseParams& ResponseParam /* = FCollisionResponseParams::DefaultResponseParam */) const
+{
+	return BatchedTrace::Run(OutHits, Starts, Ends, [this, TraceChannel, &Params, &ResponseParam](const FVector& Start, const FVector& End, FHitResult& OutHit)
+	{
+		return FPhysicsInterface::RaycastSingle(this, OutHit, Start, End, TraceChannel, Params, ResponseParam, FCollisionObjectQueryParams::DefaultObjectQueryParam);
+	});
+}
+
+int32 UWorld::SweepSingleByChannelBatched(TArray<struct FHitResult>& OutHits, TArrayView<const FVector> Starts, TArrayView<const FVector> Ends, const FQuat& Rot, ECollisionChannel TraceChannel, const FCollisionShape& CollisionShape, const FCollisionQueryParams& Params /* = FCollisionQueryParams::DefaultQueryParam */, const FCollisionResponseParams& ResponseParam /* = FCollisionResponseParams::DefaultResponseParam */) const
+{
+	if (CollisionShape.IsNearlyZero())
+	{
+		return LineTraceSingleByChannelBatched(OutHits, Starts, Ends, TraceChannel, Params, ResponseParam);
+	}
+
+	return BatchedTrace::Run(OutHits, Starts, Ends, [this, &Rot, TraceChannel, &CollisionShape, &Params, &ResponseParam](const FVector& Start, const FVector& End, FHitResult& OutHit)
+	{
+		return FPhysicsInterface::GeomSweepSingle(this, CollisionShape, Rot, OutHit, Start, End, TraceChannel, Params, ResponseParam, FCollisionObjectQueryParams::DefaultObjectQueryParam);
+	});
+}
+
+#if !UE_BUILD_SHIPPING
+namespace BatchedTrace
+{
+	/** Traces the same random rays one by one then as a batch, and logs both timings */
+	static void Benchmark(const TArray<FString>& Args, UWorld* World)
+	{
+		if (World == nullptr)
+		{
+			return;
+		}
+
+		const int32 NumRays = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 4096;
+		const double RayLength = Args.Num() > 1 ? FCString::Atod(*Args[1]) : 10000.0;
+
+		FVector Origin = FVector::ZeroVector;
+		if (APlayerController* PlayerController = World->GetFirstPlayerController())
+		{
+			FRotator Unused;
+			PlayerController->GetPlayerViewPoint(Origin, Unused);
+		}
+
+		FRandomStream RandomStream(NumRays);
+		TArray<FVector> Starts;
+		TArray<FVector> Ends;
+		Starts.Reserve(NumRays);
+		Ends.Reserve(NumRays);
+		for (int32 Index = 0; Index < NumRays; ++Index)
+		{
+			const FVector Start = Origin + RandomStream.VRand() * RandomStream.FRandRange(0.0, 0.1 * RayLength);
+			Starts.Add(Start);
+			Ends.Add(Start + RandomStream.VRand() * RayLength);
+		}
+
+		const FCollisionQueryParams Params(SCENE_QUERY_STAT(BatchedTraceBenchmark), false);
+
+		const double SingleStartTime = FPlatformTime::Seconds();
+		int32 NumSingleHits = 0;
+		FHitResult Hit;
+		for (int32 Index = 0; Index < NumRays; ++Index)
+		{
+			NumSingleHits += World->LineTraceSingleByChannel(Hit, Starts[Index], Ends[Index], ECC_Visibility, Params) ? 1 : 0;
+		}
+		const double SingleTime = FPlatformTime::Seconds() - SingleStartTime;
+
+		const double BatchedStartTime = FPlatformTime::Seconds();
+		TArray<FHitResult> Hits;
+		const int32 NumBatchedHits = World->LineTraceSingleByChannelBatched(Hits, Starts, Ends, ECC_Visibility, Params);
+		const double BatchedTime = FPlatformTime::Seconds() - BatchedStartTime;
+
+		UE_LOG(LogCollision, Display, TEXT("Batched trace benchmark, %d rays of length %.0f: single %.3f ms (%d hits), batched %.3f ms (%d hits), %.2fx"),
+			NumRays, RayLength, SingleTime * 1000.0, NumSingleHits, BatchedTime * 1000.0, NumBatchedHits, BatchedTime > 0.0 ? SingleTime / BatchedTime : 0.0);
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs BenchmarkCommand(
+		TEXT("p.BatchedTrace.Benchmark"),
+		TEXT("Traces random rays around the view one by one then with LineTraceSingleByChannelBatched and logs the timings. Args: [NumRays=4096] [RayLength=10000]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(Benchmark)
+	);
+}
+#endif // !UE_BUILD_SHIPPING
+
 bool UWorld::SweepSingleByChannel(struct FHitResult& OutHit, const FVector& Start, const FVector& End, const FQuat& Rot, ECollisionChannel TraceChannel, const FCollisionShape& CollisionShape, const FCollisionQueryParams& Params /* = FCollisionQueryParams::DefaultQueryParam */, const FCollisionResponseParams& ResponseParam /* = FCollisionResponseParams::DefaultResponseParam */) const
 {
 	if (CollisionShape.IsNearlyZero())
@@ -1134,6 +1134,11 @@ FName FActorComponentTickFunction::DiagnosticContext(bool bDetailed)
 	}
 }
 
+const UObject* FActorComponentTickFunction::GetTickBatchKey() const
+{
+	return Target ? Target->GetClass() : nullptr;
+}
+
 
 bool UActorComponent::SetupActorComponentTickFunction(struct FTickFunction* TickFunction)
 {
@@ -114,11 +114,14 @@ UAudioComponent::UAudioComponent(const FObjectInitializer& ObjectInitializer)
 
 	RandomStream.Initialize(FApp::bUseFixedSeed ? GetFName() : NAME_None);
 
+	// Server targets never have an audio device calling back into components, don't pay for the lock and map entry of every component
+#if !UE_SERVER
 	{
 		// TODO: Consider only putting played/active components in to the map
 		FScopeLock Lock(&AudioIDToComponentMapLock);
 		AudioIDToComponentMap.Add(AudioComponentID, this);
 	}
+#endif
 }
 
 UAudioComponent* UAudioComponent::GetAudioComponentFromID(uint64 AudioComponentID)
@@ -140,10 +143,12 @@ void UAudioComponent::BeginDestroy()
 
 	ResetParameters();
 
+#if !UE_SERVER
 	{
 		FScopeLock Lock(&AudioIDToComponentMapLock);
 		AudioIDToComponentMap.Remove(AudioComponentID);
 	}
+#endif
 
 	Super::BeginDestroy();
 }
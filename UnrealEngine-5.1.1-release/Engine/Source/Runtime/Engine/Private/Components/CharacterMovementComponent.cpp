@@ -1407,7 +1407,8 @@ void UCharacterMovementComponent::TickComponent(float DeltaTime, enum ELevelTick
 	CSV_SCOPED_TIMING_STAT_EXCLUSIVE(CharacterMovement);
 
 	FVector InputVector = FVector::ZeroVector;
-	bool bUsingAsyncTick = (CharacterMovementCVars::AsyncCharacterMovement == 1) && IsAsyncCallbackRegistered();
+	bUsingAsyncMovementThisFrame = ShouldUseAsyncMovement();
+	const bool bUsingAsyncTick = bUsingAsyncMovementThisFrame;
 	if (!bUsingAsyncTick)
 	{
 		// Do not consume input if simulating asynchronously, we will consume input when filling out async inputs.
@@ -1553,7 +1554,7 @@ void UCharacterMovementComponent::PostPhysicsTickComponent(float DeltaTime, FCha
 
 	if (bDeferUpdateBasedMovement)
 	{
-		if(CharacterMovementCVars::AsyncCharacterMovement == 1)
+		if (AsyncSimState.IsValid())
 		{
 			ensure(false); // Not supported
 		}
@@ -12717,6 +12718,14 @@ void UCharacterMovementComponent::FillAsyncInput(const FVector& InputVector, FCh
 
 void UCharacterMovementComponent::BuildAsyncInput()
 {
+	if (!bUsingAsyncMovementThisFrame)
+	{
+		// Movement ran on game thread this frame. Drop the async state so it is initialized again from the game thread state
+		// if we go back to simulating asynchronously, the physics thread keeps its own reference until it is done with it.
+		AsyncSimState.Reset();
+		return;
+	}
+
 	if (CharacterMovementCVars::AsyncCharacterMovement == 1  && IsAsyncCallbackRegistered())
 	{
 		FCharacterMovementComponentAsyncInput* Input = AsyncCallback->GetProducerInputData_External();
@@ -12855,7 +12864,11 @@ void UCharacterMovementComponent::ProcessAsyncOutput()
 	{
 		while (auto Output = AsyncCallback->PopOutputData_External())
 		{
-			ApplyAsyncOutput(*Output);
+			// Outputs still in flight after falling back to game thread movement are stale, game thread state is authoritative.
+			if (AsyncSimState.IsValid())
+			{
+				ApplyAsyncOutput(*Output);
+			}
 		}
 	}
 }
@@ -12879,3 +12892,26 @@ bool UCharacterMovementComponent::IsAsyncCallbackRegistered() const
 	return AsyncCallback != nullptr;
 }
 
+bool UCharacterMovementComponent::ShouldUseAsyncMovement() const
+{
+	if (CharacterMovementCVars::AsyncCharacterMovement != 1 || !IsAsyncCallbackRegistered() || !CharacterOwner)
+	{
+		return false;
+	}
+
+	// Autonomous proxies and characters driven by a remote client go through FSavedMove_Character and ServerMove, simulated proxies
+	// are smoothed from replicated movement. None of those are simulated asynchronously yet so they keep moving on game thread.
+	if (CharacterOwner->GetLocalRole() != ROLE_Authority || !CharacterOwner->IsLocallyControlled())
+	{
+		return false;
+	}
+
+	// Root motion sources are not passed on to the physics thread, only animation root motion is.
+	if (CurrentRootMotion.HasActiveRootMotionSources())
+	{
+		return false;
+	}
+
+	return true;
+}
+
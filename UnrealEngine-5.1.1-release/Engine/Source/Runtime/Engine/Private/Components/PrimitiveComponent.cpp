@@ -39,6 +39,7 @@
 #include "Engine/OverlapInfo.h"
 #include "Engine/DamageEvents.h"
 #include "Engine/ScopedMovementUpdate.h"
+#include "Async/ParallelFor.h"
 
 #if WITH_EDITOR
 #include "Engine/LODActor.h"
@@ -116,6 +117,138 @@ DECLARE_CYCLE_STAT(TEXT("MoveComponent FastOverlap"), STAT_MoveComponent_FastOve
 DECLARE_CYCLE_STAT(TEXT("BeginComponentOverlap"), STAT_BeginComponentOverlap, STATGROUP_Game);
 DECLARE_CYCLE_STAT(TEXT("EndComponentOverlap"), STAT_EndComponentOverlap, STATGROUP_Game);
 DECLARE_CYCLE_STAT(TEXT("PrimComp DispatchBlockingHit"), STAT_DispatchBlockingHit, STATGROUP_Game);
+DECLARE_CYCLE_STAT(TEXT("UpdateOverlaps BatchChildQueries"), STAT_UpdateOverlaps_BatchChildQueries, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("UpdateOverlaps batched queries used"), STAT_UpdateOverlaps_BatchedQueriesUsed, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("UpdateOverlaps batched queries discarded"), STAT_UpdateOverlaps_BatchedQueriesDiscarded, STATGROUP_Game);
+
+static int32 GBatchChildOverlapQueriesMinChildren = 0;
+static FAutoConsoleVariableRef CVarBatchChildOverlapQueriesMinChildren(
+	TEXT("p.BatchChildOverlapQueriesMinChildren"),
+	GBatchChildOverlapQueriesMinChildren,
+	TEXT("When a component updates the overlaps of at least this many attached primitives, their overlap queries are run in parallel up front\n")
+	TEXT("and overlap events are then dispatched child by child in attachment order as before. A batched result is only used if the child did not move in between.\n")
+	TEXT("0: disabled (default)"),
+	ECVF_Default);
+
+namespace PrimitiveComponentOverlapBatch
+{
+	/** Overlap query run ahead of UpdateOverlapsImpl for an attached child */
+	struct FBatchedQuery
+	{
+		UPrimitiveComponent* Component = nullptr;
+		FTransform Transform;
+		TArray<FOverlapResult> Overlaps;
+	};
+
+	/** Results of the batches currently being consumed on the game thread, keyed by the component they were queried for */
+	static TMap<const UPrimitiveComponent*, FBatchedQuery*> PendingQueries;
+
+	/** Runs the overlap query UpdateOverlapsImpl uses to find the current overlaps of a component */
+	static void QueryOverlaps(const UPrimitiveComponent& Component, const AActor* Owner, const FTransform& Transform, TArray<FOverlapResult>& OutOverlaps)
+	{
+		// If we are the root component we ignore child components. Those children will update their overlaps when we descend into the child tree.
+		const bool bIgnoreChildren = (Owner->GetRootComponent() == &Component);
+
+		// note this will optionally include overlaps with components in the same actor (depending on bIgnoreChildren). 
+		FComponentQueryParams Params(SCENE_QUERY_STAT(UpdateOverlaps), bIgnoreChildren ? Owner : nullptr);
+		Params.bIgnoreBlocks = true;	//We don't care about blockers since we only route overlap events to real overlaps
+		FCollisionResponseParams ResponseParam;
+		Component.InitSweepCollisionParams(Params, ResponseParam);
+		Component.ComponentOverlapMulti(OutOverlaps, Component.GetWorld(), Transform.GetLocation(), Transform.GetRotation(), Component.GetCollisionObjectType(), Params);
+	}
+
+	/** Whether UpdateOverlapsImpl on this component would run an overlap query */
+	static bool WillQueryOverlaps(const UPrimitiveComponent& Component)
+	{
+		const AActor* Owner = Component.GetOwner();
+		return Owner && (Owner->HasActorBegunPlay() || Owner->IsActorBeginningPlay())
+			&& IsValid(&Component) && Component.GetGenerateOverlapEvents() && Component.IsQueryCollisionEnabled();
+	}
+
+	/** Runs the overlap queries of the given children in parallel and makes them available to UpdateOverlapsImpl until it goes out of scope */
+	struct FScopedBatch
+	{
+		TArray<FBatchedQuery> Queries;
+
+		explicit FScopedBatch(TArrayView<USceneComponent* const> Children)
+		{
+			if (GBatchChildOverlapQueriesMinChildren <= 0 || Children.Num() < GBatchChildOverlapQueriesMinChildren || !IsInGameThread())
+			{
+				return;
+			}
+
+			for (USceneComponent* Child : Children)
+			{
+				UPrimitiveComponent* ChildPrimitive = Cast<UPrimitiveComponent>(Child);
+				if (ChildPrimitive && WillQueryOverlaps(*ChildPrimitive) && !PendingQueries.Contains(ChildPrimitive))
+				{
+					FBatchedQuery& Query = Queries.AddDefaulted_GetRef();
+					Query.Component = ChildPrimitive;
+					Query.Transform = ChildPrimitive->GetComponentTransform();
+				}
+			}
+
+			if (Queries.Num() < GBatchChildOverlapQueriesMinChildren)
+			{
+				Queries.Reset();
+				return;
+			}
+
+			{
+				SCOPE_CYCLE_COUNTER(STAT_UpdateOverlaps_BatchChildQueries);
+				ParallelFor(Queries.Num(), [this](int32 Index)
+				{
+					FBatchedQuery& Query = Queries[Index];
+					QueryOverlaps(*Query.Component, Query.Component->GetOwner(), Query.Transform, Query.Overlaps);
+				});
+			}
+
+			for (FBatchedQuery& Query : Queries)
+			{
+				PendingQueries.Add(Query.Component, &Query);
+			}
+		}
+
+		~FScopedBatch()
+		{
+			int32 NumDiscarded = 0;
+			for (FBatchedQuery& Query : Queries)
+			{
+				FBatchedQuery* Pending = nullptr;
+				if (PendingQueries.RemoveAndCopyValue(Query.Component, Pending))
+				{
+					++NumDiscarded;
+				}
+			}
+			INC_DWORD_STAT_BY(STAT_UpdateOverlaps_BatchedQueriesDiscarded, NumDiscarded);
+		}
+	};
+
+	/** Takes the batched result for this component if there is one and it was queried at its current transform */
+	static bool ConsumeQuery(const UPrimitiveComponent& Component, TArray<FOverlapResult>& OutOverlaps)
+	{
+		if (PendingQueries.Num() == 0 || !IsInGameThread())
+		{
+			return false;
+		}
+
+		FBatchedQuery* Query = nullptr;
+		if (!PendingQueries.RemoveAndCopyValue(&Component, Query))
+		{
+			return false;
+		}
+
+		if (!Query->Transform.Equals(Component.GetComponentTransform()))
+		{
+			INC_DWORD_STAT(STAT_UpdateOverlaps_BatchedQueriesDiscarded);
+			return false;
+		}
+
+		INC_DWORD_STAT(STAT_UpdateOverlaps_BatchedQueriesUsed);
+		OutOverlaps = MoveTemp(Query->Overlaps);
+		return true;
+	}
+}
 
 FOverlapInfo::FOverlapInfo(UPrimitiveComponent* InComponent, int32 InBodyIndex)
 	: bFromSweep(false)
@@ -668,7 +801,8 @@ void UPrimitiveComponent::OnRegister()
 void UPrimitiveComponent::OnUnregister()
 {
 	// If this is being garbage collected we don't really need to worry about clearing this
-	if (!HasAnyFlags(RF_BeginDestroyed) && !IsUnreachable())
+	// Nothing was ever added to the scene of an application that can't render, this compiles out on server targets
+	if (FApp::CanEverRender() && !HasAnyFlags(RF_BeginDestroyed) && !IsUnreachable())
 	{
 		UWorld* World = GetWorld();
 		if (World && World->Scene)
@@ -3547,12 +3681,10 @@ bool UPrimitiveComponent::UpdateOverlapsImpl(const TOverlapArrayView* NewPending
 					UE_LOG(LogPrimitiveComponent, VeryVerbose, TEXT("%s->%s Performing overlaps!"), *GetNameSafe(GetOwner()), *GetName());
 					UWorld* const MyWorld = GetWorld();
 					TArray<FOverlapResult> Overlaps;
-					// note this will optionally include overlaps with components in the same actor (depending on bIgnoreChildren). 
-					FComponentQueryParams Params(SCENE_QUERY_STAT(UpdateOverlaps), bIgnoreChildren ? MyActor : nullptr);
-					Params.bIgnoreBlocks = true;	//We don't care about blockers since we only route overlap events to real overlaps
-					FCollisionResponseParams ResponseParam;
-					InitSweepCollisionParams(Params, ResponseParam);
-					ComponentOverlapMulti(Overlaps, MyWorld, GetComponentLocation(), GetComponentQuat(), GetCollisionObjectType(), Params);
+					if (!PrimitiveComponentOverlapBatch::ConsumeQuery(*this, Overlaps))
+					{
+						PrimitiveComponentOverlapBatch::QueryOverlaps(*this, MyActor, GetComponentTransform(), Overlaps);
+					}
 
 					for (int32 ResultIdx=0; ResultIdx < Overlaps.Num(); ResultIdx++)
 					{
@@ -3667,6 +3799,9 @@ bool UPrimitiveComponent::UpdateOverlapsImpl(const TOverlapArrayView* NewPending
 	TInlineComponentArray<USceneComponent*> AttachedChildren;
 	AttachedChildren.Append(GetAttachChildren());
 
+	// Run the children's overlap queries up front if there are enough of them, events are still dispatched in order below.
+	PrimitiveComponentOverlapBatch::FScopedBatch ChildOverlapBatch(AttachedChildren);
+
 	for (USceneComponent* const ChildComp : AttachedChildren)
 	{
 		if (ChildComp)
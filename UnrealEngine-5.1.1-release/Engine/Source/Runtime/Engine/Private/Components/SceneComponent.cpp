@@ -36,6 +36,7 @@
 #include "DeviceProfiles/DeviceProfile.h"
 #include "Net/Core/PushModel/PushModel.h"
 #include "Engine/ScopedMovementUpdate.h"
+#include "Async/ParallelFor.h"
 
 #define LOCTEXT_NAMESPACE "SceneComponent"
 
@@ -51,6 +52,7 @@ DEFINE_LOG_CATEGORY_STATIC(LogSceneComponent, Log, All);
 
 DECLARE_CYCLE_STAT(TEXT("UpdateComponentToWorld"), STAT_UpdateComponentToWorld, STATGROUP_Component);
 DECLARE_CYCLE_STAT(TEXT("UpdateChildTransforms"), STAT_UpdateChildTransforms, STATGROUP_Component);
+DECLARE_CYCLE_STAT(TEXT("UpdateChildTransforms Parallel"), STAT_UpdateChildTransformsParallel, STATGROUP_Component);
 DECLARE_CYCLE_STAT(TEXT("Component CalcBounds"), STAT_ComponentCalcBounds, STATGROUP_Component);
 DECLARE_CYCLE_STAT(TEXT("Component UpdateNavData"), STAT_ComponentUpdateNavData, STATGROUP_Component);
 DECLARE_CYCLE_STAT(TEXT("Component PostUpdateNavData"), STAT_ComponentPostUpdateNavData, STATGROUP_Component);
@@ -2483,6 +2485,189 @@ FBox USceneComponent::GetStreamingBounds() const
 }
 #endif
 
+static int32 GParallelChildTransformUpdateMinComponents = 0;
+static FAutoConsoleVariableRef CVarParallelChildTransformUpdateMinComponents(
+	TEXT("p.ParallelChildTransformUpdateMinComponents"),
+	GParallelChildTransformUpdateMinComponents,
+	TEXT("If > 0, attachment subtrees of at least this many components update their transforms and bounds in parallel, one attachment depth at a time, before their transform update notifications run on the game thread. 0 disables it."),
+	ECVF_Default);
+
+namespace SceneComponentParallelTransformUpdate
+{
+	/** A component of an attachment subtree updated by UpdateChildTransformsParallel */
+	struct FNode
+	{
+		USceneComponent* Component;
+		int32 ParentIndex;
+		int32 FirstChild;
+		int32 NumChildren;
+		EUpdateTransformFlags UpdateTransformFlags;
+		ETeleportType Teleport;
+		bool bTransformChanged;
+	};
+}
+
+bool USceneComponent::UpdateChildTransformsParallel(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	using namespace SceneComponentParallelTransformUpdate;
+
+	// Socket transforms may depend on state that the parent only updates in OnUpdateTransform, and the legacy path skips most children in that mode anyway
+	if (GParallelChildTransformUpdateMinComponents <= 0 || !!(UpdateTransformFlags & EUpdateTransformFlags::OnlyUpdateIfUsingSocket) || !IsInGameThread() || GIsEditor)
+	{
+		return false;
+	}
+
+	// Gather the subtree breadth first, so the children of a component are contiguous and components are sorted by depth
+	TArray<FNode, TInlineAllocator<64>> Nodes;
+	auto GatherChildren = [&Nodes](const USceneComponent* Parent, int32 ParentIndex) -> bool
+	{
+		for (USceneComponent* ChildComp : Parent->GetAttachChildren())
+		{
+			if (ChildComp == nullptr)
+			{
+				continue;
+			}
+			// Same rule as UpdateChildTransforms: don't update children using a completely absolute (world-relative) scheme.
+			if (ChildComp->bComponentToWorldUpdated && ChildComp->IsUsingAbsoluteLocation() && ChildComp->IsUsingAbsoluteRotation() && ChildComp->IsUsingAbsoluteScale())
+			{
+				continue;
+			}
+			if (ChildComp->GetAttachSocketName() != NAME_None || ChildComp->IsDeferringMovementUpdates())
+			{
+				return false;
+			}
+			Nodes.Add(FNode{ ChildComp, ParentIndex, 0, 0, EUpdateTransformFlags::None, ETeleportType::None, false });
+		}
+		return true;
+	};
+
+	if (!GatherChildren(this, INDEX_NONE))
+	{
+		return false;
+	}
+	const int32 NumDirectChildren = Nodes.Num();
+	for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+	{
+		Nodes[Index].FirstChild = Nodes.Num();
+		if (!GatherChildren(Nodes[Index].Component, Index))
+		{
+			return false;
+		}
+		Nodes[Index].NumChildren = Nodes.Num() - Nodes[Index].FirstChild;
+	}
+	if (Nodes.Num() < GParallelChildTransformUpdateMinComponents)
+	{
+		return false;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_UpdateChildTransformsParallel);
+
+	// Update transforms and bounds in parallel, components only read the transform and bounds of their parent, which is one depth above
+	const EUpdateTransformFlags UpdateTransformFlagsFromParent = UpdateTransformFlags | EUpdateTransformFlags::PropagateFromParent;
+	int32 DepthStart = 0;
+	while (DepthStart < Nodes.Num())
+	{
+		// The first component of the next depth is the first child of any component of this depth
+		int32 DepthEnd = Nodes.Num();
+		for (int32 Index = DepthStart; Index < DepthEnd; ++Index)
+		{
+			if (Nodes[Index].NumChildren > 0)
+			{
+				DepthEnd = Nodes[Index].FirstChild;
+				break;
+			}
+		}
+
+		ParallelFor(DepthEnd - DepthStart, [&Nodes, DepthStart, UpdateTransformFlagsFromParent, Teleport](int32 Offset)
+		{
+			FNode& Node = Nodes[DepthStart + Offset];
+			USceneComponent* Component = Node.Component;
+
+			// Flags and teleport type PropagateTransformUpdate would have passed down from the parent
+			if (Node.ParentIndex == INDEX_NONE)
+			{
+				Node.UpdateTransformFlags = UpdateTransformFlagsFromParent;
+				Node.Teleport = Teleport;
+			}
+			else
+			{
+				const FNode& ParentNode = Nodes[Node.ParentIndex];
+				Node.UpdateTransformFlags = (ParentNode.bTransformChanged ? (~EUpdateTransformFlags::SkipPhysicsUpdate & ~EUpdateTransformFlags::OnlyUpdateIfUsingSocket & ParentNode.UpdateTransformFlags) : EUpdateTransformFlags::None) | EUpdateTransformFlags::PropagateFromParent;
+				Node.Teleport = ParentNode.bTransformChanged ? ParentNode.Teleport : ETeleportType::None;
+			}
+
+			Component->bComponentToWorldUpdated = true;
+
+			const FTransform RelativeTransform(Component->RelativeRotationCache.RotatorToQuat(Component->GetRelativeRotation()), Component->GetRelativeLocation(), Component->GetRelativeScale3D());
+			const FTransform NewTransform = Component->CalcNewComponentToWorld(RelativeTransform, Component->GetAttachParent());
+			Node.bTransformChanged = !Component->GetComponentTransform().Equals(NewTransform, UE_SMALL_NUMBER) || Node.Teleport != ETeleportType::None;
+			if (Node.bTransformChanged)
+			{
+				Component->ComponentToWorld = NewTransform;
+			}
+			Component->UpdateBounds();
+		}, (DepthEnd - DepthStart) < 2 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+		DepthStart = DepthEnd;
+	}
+
+	// Notify subsystems on the game thread, in the order the recursive update would have
+	TFunction<void(int32, int32)> NotifyNodes = [&Nodes, &NotifyNodes](int32 First, int32 Num)
+	{
+		for (int32 Index = First; Index < First + Num; ++Index)
+		{
+			const FNode& Node = Nodes[Index];
+			Node.Component->PropagateParallelTransformUpdate(Node.bTransformChanged, Node.UpdateTransformFlags, Node.Teleport, [&NotifyNodes, &Node]()
+			{
+				NotifyNodes(Node.FirstChild, Node.NumChildren);
+			});
+		}
+	};
+	NotifyNodes(0, NumDirectChildren);
+
+	return true;
+}
+
+void USceneComponent::PropagateParallelTransformUpdate(bool bTransformChanged, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport, TFunctionRef<void()> UpdateChildren)
+{
+	if (bTransformChanged)
+	{
+		if (bRegistered)
+		{
+			if (bWantsOnUpdateTransform)
+			{
+				OnUpdateTransform(UpdateTransformFlags, Teleport);
+			}
+			TransformUpdated.Broadcast(this, UpdateTransformFlags, Teleport);
+
+			MarkRenderTransformDirty();
+		}
+
+		UpdateChildren();
+
+#if WITH_EDITOR
+		if (!IsTemplate())
+		{
+			GEngine->BroadcastOnComponentTransformChanged(this, Teleport);
+		}
+#endif // WITH_EDITOR
+
+		if (bNavigationRelevant && bRegistered)
+		{
+			UpdateNavigationData();
+		}
+	}
+	else
+	{
+		UpdateChildren();
+
+		if (bRegistered)
+		{
+			MarkRenderTransformDirty();
+		}
+	}
+}
+
 void USceneComponent::UpdateChildTransforms(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
 {
 	SCOPE_CYCLE_COUNTER(STAT_UpdateChildTransforms);
@@ -2494,6 +2679,11 @@ void USceneComponent::UpdateChildTransforms(EUpdateTransformFlags UpdateTransfor
 	}
 #endif
 
+	if (AttachChildren.Num() > 0 && UpdateChildTransformsParallel(UpdateTransformFlags, Teleport))
+	{
+		return;
+	}
+
 	if (AttachChildren.Num() > 0)
 	{
 		const bool bOnlyUpdateIfUsingSocket = !!(UpdateTransformFlags & EUpdateTransformFlags::OnlyUpdateIfUsingSocket);
@@ -100,6 +100,20 @@ static FAutoConsoleVariableRef CVarParallelAnimCompletionTaskHighPriority(
 	ECVF_Default
 );
 
+static bool GBatchParallelAnimCompletion = false;
+static FAutoConsoleVariableRef CVarBatchParallelAnimCompletion(
+	TEXT("a.ParallelAnimCompletion.Batched"),
+	GBatchParallelAnimCompletion,
+	TEXT("If true, the first parallel anim completion task to run on the game thread also completes every other component whose evaluation already finished,\n")
+	TEXT("so the game thread handles completed evaluations in batches rather than switching to one task per component."),
+	ECVF_Default
+);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Batched Anim Completions"), STAT_AnimBatchedCompletions, STATGROUP_Anim);
+
+/** Components with a parallel evaluation in flight, when a.ParallelAnimCompletion.Batched is set. Game thread only. */
+static TArray<TWeakObjectPtr<USkeletalMeshComponent>> GPendingParallelAnimCompletions;
+
 FAutoConsoleTaskPriority CPrio_ParallelAnimationEvaluationTask(
 	TEXT("TaskGraph.TaskPriorities.ParallelAnimationEvaluationTask"),
 	TEXT("Task and thread priority for FParallelAnimationEvaluationTask"),
@@ -196,6 +210,46 @@ public:
 				Comp->CompleteParallelAnimationEvaluation(bPerformPostAnimEvaluation);
 			}
 		}
+
+		// Completions can wait on tasks and run other completion tasks, only the outermost one goes through the pending components
+		static bool bCompletingFinishedEvaluations = false;
+		if (GPendingParallelAnimCompletions.Num() > 0 && !bCompletingFinishedEvaluations)
+		{
+			TGuardValue<bool> CompletingGuard(bCompletingFinishedEvaluations, true);
+			CompleteFinishedEvaluations();
+		}
+	}
+
+private:
+	/** Completes the other components whose evaluation finished, their own completion task then has nothing left to do */
+	static void CompleteFinishedEvaluations()
+	{
+		SCOPED_NAMED_EVENT(FParallelAnimationCompletionTask_CompleteFinishedEvaluations, FColor::Yellow);
+
+		for (int32 Index = GPendingParallelAnimCompletions.Num() - 1; Index >= 0; --Index)
+		{
+			if (Index >= GPendingParallelAnimCompletions.Num())
+			{
+				continue;
+			}
+
+			USkeletalMeshComponent* Comp = GPendingParallelAnimCompletions[Index].Get();
+			if (Comp == nullptr || !IsValidRef(Comp->ParallelAnimationEvaluationTask))
+			{
+				GPendingParallelAnimCompletions.RemoveAtSwap(Index, 1, false);
+			}
+			else if (Comp->ParallelAnimationEvaluationTask->IsComplete())
+			{
+				GPendingParallelAnimCompletions.RemoveAtSwap(Index, 1, false);
+
+				FScopeCycleCounterUObject ComponentScope(Comp);
+				FScopeCycleCounterUObject MeshScope(Comp->GetSkeletalMeshAsset());
+
+				const bool bPerformPostAnimEvaluation = true;
+				Comp->CompleteParallelAnimationEvaluation(bPerformPostAnimEvaluation);
+				INC_DWORD_STAT(STAT_AnimBatchedCompletions);
+			}
+		}
 	}
 };
 
@@ -2518,6 +2572,11 @@ void USkeletalMeshComponent::DispatchParallelEvaluationTasks(FActorComponentTick
 	Prerequistes.Add(ParallelAnimationEvaluationTask);
 	FGraphEventRef TickCompletionEvent = TGraphTask<FParallelAnimationCompletionTask>::CreateTask(&Prerequistes).ConstructAndDispatchWhenReady(this);
 
+	if (GBatchParallelAnimCompletion)
+	{
+		GPendingParallelAnimCompletions.Add(this);
+	}
+
 	if ( TickFunction )
 	{
 		TickFunction->GetCompletionHandle()->DontCompleteUntil(TickCompletionEvent);
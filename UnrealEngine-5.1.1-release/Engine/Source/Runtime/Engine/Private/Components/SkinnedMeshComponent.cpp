@@ -194,6 +194,17 @@ namespace FAnimUpdateRateManager
 		0,
 		TEXT("Set to 1 to disable interpolation"));
 
+	static TAutoConsoleVariable<int32> CVarURODistantCrowdMinLOD(
+		TEXT("a.URO.DistantCrowd.MinLOD"),
+		-1,
+		TEXT("If >= 0, visible meshes at this LOD or beyond evaluate their animation at most every a.URO.DistantCrowd.EvaluationRate frames,\n")
+		TEXT("without interpolating the skipped frames so their bone buffers are not updated in between. -1 disables."));
+
+	static TAutoConsoleVariable<int32> CVarURODistantCrowdEvaluationRate(
+		TEXT("a.URO.DistantCrowd.EvaluationRate"),
+		4,
+		TEXT("Evaluation rate in frames of meshes beyond a.URO.DistantCrowd.MinLOD."));
+
 	void AnimUpdateRateSetParams(FAnimUpdateRateParametersTracker* Tracker, float DeltaTime, bool bRecentlyRendered, float MaxDistanceFactor, int32 MinLod, bool bNeedsValidRootMotion, bool bUsingRootMotionFromEverything)
 	{
 		// default rules for setting update rates
@@ -271,6 +282,15 @@ namespace FAnimUpdateRateManager
 				DesiredEvaluationRate = ForceAnimRate;
 			}
 
+			// Distant crowds hold their last pose between evaluations, skipping the interpolation and the bone buffer updates it would cause
+			bool bInterpolateSkippedFrames = true;
+			const int32 DistantCrowdMinLOD = CVarURODistantCrowdMinLOD.GetValueOnGameThread();
+			if (DistantCrowdMinLOD >= 0 && MinLod >= DistantCrowdMinLOD && MinLod != MAX_int32)
+			{
+				DesiredEvaluationRate = FMath::Max(DesiredEvaluationRate, CVarURODistantCrowdEvaluationRate.GetValueOnGameThread());
+				bInterpolateSkippedFrames = false;
+			}
+
 			if (bUsingRootMotionFromEverything && DesiredEvaluationRate > 1)
 			{
 				//Use look ahead mode that allows us to rate limit updates even when using root motion
@@ -278,7 +298,7 @@ namespace FAnimUpdateRateManager
 			}
 			else
 			{
-				Tracker->UpdateRateParameters.SetTrailMode(DeltaTime, Tracker->GetAnimUpdateRateShiftTag(Tracker->UpdateRateParameters.ShiftBucket), DesiredEvaluationRate, DesiredEvaluationRate, true);
+				Tracker->UpdateRateParameters.SetTrailMode(DeltaTime, Tracker->GetAnimUpdateRateShiftTag(Tracker->UpdateRateParameters.ShiftBucket), DesiredEvaluationRate, DesiredEvaluationRate, bInterpolateSkippedFrames);
 			}
 		}
 	}
@@ -19,8 +19,10 @@ float GPriorityAsyncLoadingExtraTime = 15.0f;
 float GLevelStreamingActorsUpdateTimeLimit = 5.0f;
 float GPriorityLevelStreamingActorsUpdateExtraTime = 5.0f;
 float GLevelStreamingUnregisterComponentsTimeLimit = 1.0f;
+float GLevelStreamingVisibilityTimeLimit = 0.0f;
 int32 GLevelStreamingComponentsRegistrationGranularity = 10;
 int32 GLevelStreamingAddPrimitiveGranularity = 120;
+int32 GLevelStreamingDeferredPhysicsStateGranularity = 0;
 int32 GLevelStreamingComponentsUnregistrationGranularity = 5;
 int32 GLevelStreamingRouteActorInitializationGranularity = 10;
 int32 GLevelStreamingForceGCAfterLevelStreamedOut = 1;
@@ -80,6 +82,14 @@ static FAutoConsoleVariableRef CVarLevelStreamingUnregisterComponentsTimeLimit(
 	ECVF_Default
 );
 
+static FAutoConsoleVariableRef CVarLevelStreamingVisibilityTimeLimit(
+	TEXT("s.LevelStreamingVisibilityTimeLimit"),
+	GLevelStreamingVisibilityTimeLimit,
+	TEXT("Maximum allowed time shared by the actor registration and unregistration steps of all levels being made visible or invisible (ms per frame).\n")
+	TEXT("Caps s.LevelStreamingActorsUpdateTimeLimit and s.UnregisterComponentsTimeLimit so both together fit a single budget. If this is zero, each uses its own time limit."),
+	ECVF_Default
+);
+
 static FAutoConsoleVariableRef CVarLevelStreamingComponentsRegistrationGranularity(
 	TEXT("s.LevelStreamingComponentsRegistrationGranularity"),
 	GLevelStreamingComponentsRegistrationGranularity,
@@ -94,6 +104,14 @@ static FAutoConsoleVariableRef CVarLevelStreamingAddPrimitiveGranularity(
 	ECVF_Default
 );
 
+static FAutoConsoleVariableRef CVarLevelStreamingDeferredPhysicsStateGranularity(
+	TEXT("s.LevelStreamingDeferredPhysicsStateGranularity"),
+	GLevelStreamingDeferredPhysicsStateGranularity,
+	TEXT("Batching granularity used to create deferred physics states (p.EnableDeferredPhysicsCreation) in parallel when registering actor components during level streaming.\n")
+	TEXT("0: create them after each registration batch (default)"),
+	ECVF_Default
+);
+
 static FAutoConsoleVariableRef CVarLevelStreamingComponentsUnregistrationGranularity(
 	TEXT("s.LevelStreamingComponentsUnregistrationGranularity"),
 	GLevelStreamingComponentsUnregistrationGranularity,
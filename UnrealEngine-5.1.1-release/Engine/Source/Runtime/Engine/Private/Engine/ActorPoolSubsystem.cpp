@@ -0,0 +1,287 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Engine/ActorPoolSubsystem.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "Engine/NetDriver.h"
+#include "Engine/PackageMapClient.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/Pawn.h"
+#include "TimerManager.h"
+#include "UObject/UObjectHash.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(ActorPoolSubsystem)
+
+DECLARE_LOG_CATEGORY_EXTERN(LogActorPool, Log, All);
+DEFINE_LOG_CATEGORY(LogActorPool);
+
+DECLARE_CYCLE_STAT(TEXT("ActorPool ReturnActor"), STAT_ActorPoolReturnActor, STATGROUP_Game);
+DECLARE_CYCLE_STAT(TEXT("ActorPool TakeActor"), STAT_ActorPoolTakeActor, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("ActorPool actors returned"), STAT_ActorPoolActorsReturned, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("ActorPool actors reused"), STAT_ActorPoolActorsReused, STATGROUP_Game);
+
+void UActorPoolSubsystem::RegisterPooledClass(TSubclassOf<AActor> ActorClass, int32 MaxPooledActors)
+{
+	if (!ActorClass || ActorClass->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated))
+	{
+		UE_LOG(LogActorPool, Warning, TEXT("RegisterPooledClass failed because %s is not a spawnable actor class"), *GetNameSafe(ActorClass));
+		return;
+	}
+
+	FPooledActorList& Pool = Pools.FindOrAdd(ActorClass);
+	Pool.MaxPooledActors = FMath::Max(MaxPooledActors, 0);
+	Pool.Actors.Reserve(Pool.MaxPooledActors);
+}
+
+void UActorPoolSubsystem::UnregisterPooledClass(TSubclassOf<AActor> ActorClass)
+{
+	FPooledActorList Pool;
+	if (Pools.RemoveAndCopyValue(ActorClass, Pool))
+	{
+		TGuardValue<bool> DestroyingPooledActors(bDestroyingPooledActors, true);
+		for (AActor* Actor : Pool.Actors)
+		{
+			if (IsValid(Actor))
+			{
+				Actor->Destroy();
+			}
+		}
+	}
+}
+
+bool UActorPoolSubsystem::IsClassPooled(const UClass* ActorClass) const
+{
+	return Pools.Contains(ActorClass);
+}
+
+int32 UActorPoolSubsystem::GetNumPooledActors(const UClass* ActorClass) const
+{
+	const FPooledActorList* Pool = Pools.Find(ActorClass);
+	return Pool ? Pool->Actors.Num() : 0;
+}
+
+bool UActorPoolSubsystem::TryReturnActor(AActor* Actor)
+{
+	if (Pools.Num() == 0 || bDestroyingPooledActors)
+	{
+		return false;
+	}
+
+	if (Actor == ReturningActor)
+	{
+		// Destroyed again from its own EndPlay, it is already on its way to the pool
+		return true;
+	}
+
+	FPooledActorList* Pool = Pools.Find(Actor->GetClass());
+	if (!Pool)
+	{
+		return false;
+	}
+
+	// An inactive actor being destroyed for good, forget about it
+	if (Pool->Actors.RemoveSwap(Actor) > 0)
+	{
+		return false;
+	}
+
+	UWorld* World = GetWorld();
+	if (Pool->Actors.Num() >= Pool->MaxPooledActors || !World || World->bIsTearingDown || Actor->GetWorld() != World || Actor->GetLevel() != World->PersistentLevel)
+	{
+		return false;
+	}
+
+	// Startup actors are referenced by path, and clients own their copy of replicated actors
+	if (Actor->IsNetStartupActor() || Actor->IsChildActor() || (Actor->GetIsReplicated() && Actor->GetLocalRole() != ROLE_Authority))
+	{
+		return false;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_ActorPoolReturnActor);
+	TGuardValue<AActor*> GuardReturningActor(ReturningActor, Actor);
+
+	// End play the same way DestroyActor does, code listening to EndPlay can't tell the actor is pooled
+	Actor->RouteEndPlay(EEndPlayReason::Destroyed);
+
+	// Detach this actor's children and detach from anything we were attached to
+	TArray<AActor*> AttachedActors;
+	Actor->GetAttachedActors(AttachedActors);
+	if (AttachedActors.Num() > 0)
+	{
+		TInlineComponentArray<USceneComponent*> SceneComponents;
+		Actor->GetComponents(SceneComponents);
+
+		for (AActor* ChildActor : AttachedActors)
+		{
+			if (ChildActor)
+			{
+				for (USceneComponent* SceneComponent : SceneComponents)
+				{
+					ChildActor->DetachAllSceneComponents(SceneComponent, FDetachmentTransformRules::KeepWorldTransform);
+				}
+			}
+		}
+	}
+	Actor->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+
+	Actor->ClearComponentOverlaps();
+	Actor->SetOwner(nullptr);
+	Actor->SetInstigator(nullptr);
+
+	ReleaseNetworkState(Actor);
+
+	World->GetTimerManager().ClearAllTimersForObject(Actor);
+
+	// Take the actor out of its level so actor lists and the network actor list no longer see it
+	World->RemoveActor(Actor, false);
+
+	Actor->UnregisterAllComponents();
+	const bool bRegisterTickFunctions = false;
+	const bool bIncludeComponents = true;
+	Actor->RegisterAllActorTickFunctions(bRegisterTickFunctions, bIncludeComponents);
+
+	if (IPooledActorInterface* PooledActor = Cast<IPooledActorInterface>(Actor))
+	{
+		PooledActor->OnReturnedToPool();
+	}
+
+	Pool->Actors.Add(Actor);
+	INC_DWORD_STAT(STAT_ActorPoolActorsReturned);
+	return true;
+}
+
+AActor* UActorPoolSubsystem::TryTakeActor(UClass* ActorClass, ULevel* LevelToSpawnIn, const FTransform& UserTransform, const FActorSpawnParameters& SpawnParameters, ESpawnActorCollisionHandlingMethod CollisionHandlingMethod)
+{
+	if (Pools.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	FPooledActorList* Pool = Pools.Find(ActorClass);
+	UWorld* World = GetWorld();
+	if (!Pool || Pool->Actors.Num() == 0 || !World || LevelToSpawnIn != World->PersistentLevel)
+	{
+		return nullptr;
+	}
+
+	// Anything that changes how the actor is constructed needs a new actor
+	if (SpawnParameters.Template || !SpawnParameters.Name.IsNone() || SpawnParameters.bDeferConstruction || SpawnParameters.OverrideParentComponent || SpawnParameters.CustomPreSpawnInitalization)
+	{
+		return nullptr;
+	}
+
+	// Adjusting the spawn location requires the CDO components, which PostSpawnInitialize handles
+	if (CollisionHandlingMethod != ESpawnActorCollisionHandlingMethod::AlwaysSpawn && CollisionHandlingMethod != ESpawnActorCollisionHandlingMethod::DontSpawnIfColliding)
+	{
+		return nullptr;
+	}
+
+	AActor* Actor = nullptr;
+	while (!Actor && Pool->Actors.Num() > 0)
+	{
+		AActor* Candidate = Pool->Actors.Pop(false);
+		if (IsValid(Candidate))
+		{
+			Actor = Candidate;
+		}
+	}
+
+	if (!Actor)
+	{
+		return nullptr;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_ActorPoolTakeActor);
+
+	LevelToSpawnIn->Actors.Add(Actor);
+	LevelToSpawnIn->ActorsForGC.Add(Actor);
+
+	Actor->SpawnCollisionHandlingMethod = CollisionHandlingMethod;
+	Actor->SetOwner(SpawnParameters.Owner);
+	Actor->SetInstigator(SpawnParameters.Instigator);
+
+	// Respect the initial transform of the root component from the CDO, as PostSpawnInitialize does
+	if (USceneComponent* SceneRootComponent = Actor->GetRootComponent())
+	{
+		const USceneComponent* DefaultRootComponent = ActorClass->GetDefaultObject<AActor>()->GetRootComponent();
+		const FTransform RootTransform = DefaultRootComponent
+			? FTransform(DefaultRootComponent->GetRelativeRotation(), DefaultRootComponent->GetRelativeLocation(), DefaultRootComponent->GetRelativeScale3D())
+			: FTransform::Identity;
+		SceneRootComponent->SetWorldTransform(RootTransform * UserTransform, false, nullptr, ETeleportType::ResetPhysics);
+	}
+
+	Actor->RegisterAllComponents();
+	Actor->InitializeComponents();
+
+	if (IPooledActorInterface* PooledActor = Cast<IPooledActorInterface>(Actor))
+	{
+		PooledActor->OnTakenFromPool();
+	}
+
+	if (World->HasBegunPlay() && IsValid(Actor))
+	{
+		Actor->DispatchBeginPlay();
+	}
+
+	INC_DWORD_STAT(STAT_ActorPoolActorsReused);
+	return Actor;
+}
+
+void UActorPoolSubsystem::ReleaseNetworkState(AActor* Actor) const
+{
+	if (!Actor->GetIsReplicated())
+	{
+		return;
+	}
+
+	FWorldContext* Context = GEngine->GetWorldContextFromWorld(GetWorld());
+	if (!Context)
+	{
+		return;
+	}
+
+	TArray<UObject*> SubObjects;
+	GetObjectsWithOuter(Actor, SubObjects, true);
+
+	for (FNamedNetDriver& Driver : Context->ActiveNetDrivers)
+	{
+		if (Driver.NetDriver != nullptr && Driver.NetDriver->ShouldReplicateActor(Actor))
+		{
+			// Closes the actor channels, clients destroy their copy of the actor
+			Driver.NetDriver->NotifyActorDestroyed(Actor);
+
+			// Forget the NetGUIDs of the actor and its subobjects so a reused actor is assigned new ones, as a new actor would be
+			if (FNetGUIDCache* GuidCache = Driver.NetDriver->GuidCache.Get())
+			{
+				auto ReleaseNetGUID = [GuidCache](UObject* Object)
+				{
+					FNetworkGUID NetGUID;
+					if (GuidCache->NetGUIDLookup.RemoveAndCopyValue(Object, NetGUID))
+					{
+						GuidCache->ObjectLookup.Remove(NetGUID);
+					}
+				};
+
+				ReleaseNetGUID(Actor);
+				for (UObject* SubObject : SubObjects)
+				{
+					ReleaseNetGUID(SubObject);
+				}
+			}
+		}
+	}
+}
+
+void UActorPoolSubsystem::Deinitialize()
+{
+	// Inactive actors are no longer in their level, dropping our references is enough for them to be collected with the world
+	Pools.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UActorPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -32,6 +32,9 @@ DEFINE_STAT(STAT_GPUSkinCache_NumTrianglesForRecomputeTangents);
 DEFINE_STAT(STAT_GPUSkinCache_NumSectionsProcessed);
 DEFINE_STAT(STAT_GPUSkinCache_NumSetVertexStreams);
 DEFINE_STAT(STAT_GPUSkinCache_NumPreGDME);
+DEFINE_STAT(STAT_GPUSkinCache_PooledMemUsed);
+DEFINE_STAT(STAT_GPUSkinCache_NumPooledReused);
+DEFINE_STAT(STAT_GPUSkinCache_NumFallbacks);
 DEFINE_LOG_CATEGORY_STATIC(LogSkinCache, Log, All);
 
 /** Exec helper to handle GPU Skin Cache related commands. */
@@ -149,6 +152,16 @@ static TAutoConsoleVariable<float> CVarGPUSkinCacheSceneMemoryLimitInMB(
 	ECVF_RenderThreadSafe
 );
 
+static int32 GSkinCachePoolReleaseFrames = 30;
+FAutoConsoleVariableRef CVarGPUSkinCachePoolReleaseFrames(
+	TEXT("r.SkinCache.PoolReleaseFrames"),
+	GSkinCachePoolReleaseFrames,
+	TEXT("Number of frames the buffers of a released skin cache entry are kept to be reused by an entry of the same size, e.g. a mesh coming back in view.\n")
+	TEXT("Pooled buffers count towards r.SkinCache.SceneMemoryLimitInMB and are released first, oldest first, when an allocation does not fit.\n")
+	TEXT("0: release the buffers right away"),
+	ECVF_RenderThreadSafe
+);
+
 static int32 GAllowDupedVertsForRecomputeTangents = 0;
 FAutoConsoleVariableRef CVarGPUSkinCacheAllowDupedVertesForRecomputeTangents(
 	TEXT("r.SkinCache.AllowDupedVertsForRecomputeTangents"),
@@ -859,6 +872,34 @@ void FGPUSkinCache::Cleanup()
 		Release(Entries.Last());
 	}
 	ensure(Allocations.Num() == 0);
+
+	while (PooledAllocations.Num() > 0)
+	{
+		ReleasePooledAllocation(PooledAllocations.Num() - 1);
+	}
+}
+
+void FGPUSkinCache::ReleasePooledAllocation(int32 PoolIndex)
+{
+	FRWBuffersAllocation* Allocation = PooledAllocations[PoolIndex].Allocation;
+	PooledAllocations.RemoveAt(PoolIndex);
+
+	const uint64 NumBytes = Allocation->GetNumBytes();
+	PooledMemoryInBytes -= NumBytes;
+	DEC_MEMORY_STAT_BY(STAT_GPUSkinCache_PooledMemUsed, NumBytes);
+	DEC_MEMORY_STAT_BY(STAT_GPUSkinCache_TotalMemUsed, NumBytes);
+
+	delete Allocation;
+}
+
+void FGPUSkinCache::ReleaseUnusedPooledAllocations()
+{
+	// Oldest first
+	const uint32 FrameNumber = GFrameNumberRenderThread;
+	while (PooledAllocations.Num() > 0 && FrameNumber - PooledAllocations[0].ReleasedFrame >= (uint32)FMath::Max(GSkinCachePoolReleaseFrames, 0))
+	{
+		ReleasePooledAllocation(0);
+	}
 }
 
 void FGPUSkinCache::TransitionAllToReadable(FRHICommandList& RHICmdList, const TSet<FSkinCacheRWBuffer*>& BuffersToTransitionToRead)
@@ -1243,12 +1284,40 @@ FGPUSkinCache::FRWBuffersAllocation* FGPUSkinCache::TryAllocBuffer(uint32 NumVer
 {
 	uint64 MaxSizeInBytes = (uint64)(GSkinCacheSceneMemoryLimitInMB * 1024.0f * 1024.0f);
 	uint64 RequiredMemInBytes = FRWBuffersAllocation::CalculateRequiredMemory(NumVertices, WithTangnents, UseIntermediateTangents, NumTriangles);
-	if (bRequiresMemoryLimit && UsedMemoryInBytes + RequiredMemInBytes >= MaxSizeInBytes)
+
+	// Oldest first, it is the closest to being released
+	for (int32 PoolIndex = 0; PoolIndex < PooledAllocations.Num(); ++PoolIndex)
 	{
-		ExtraRequiredMemory += RequiredMemInBytes;
+		FRWBuffersAllocation* PooledAllocation = PooledAllocations[PoolIndex].Allocation;
+		if (PooledAllocation->HasSameLayout(NumVertices, WithTangnents, UseIntermediateTangents, NumTriangles))
+		{
+			PooledAllocations.RemoveAt(PoolIndex);
+			PooledMemoryInBytes -= RequiredMemInBytes;
+			DEC_MEMORY_STAT_BY(STAT_GPUSkinCache_PooledMemUsed, RequiredMemInBytes);
+			INC_DWORD_STAT(STAT_GPUSkinCache_NumPooledReused);
+
+			Allocations.Add(PooledAllocation);
+			UsedMemoryInBytes += RequiredMemInBytes;
+			return PooledAllocation;
+		}
+	}
+
+	if (bRequiresMemoryLimit)
+	{
+		// Idle pooled buffers have the lowest priority, evict them before giving up on the allocation
+		while (PooledAllocations.Num() > 0 && UsedMemoryInBytes + PooledMemoryInBytes + RequiredMemInBytes >= MaxSizeInBytes)
+		{
+			ReleasePooledAllocation(0);
+		}
+
+		if (UsedMemoryInBytes + RequiredMemInBytes >= MaxSizeInBytes)
+		{
+			ExtraRequiredMemory += RequiredMemInBytes;
+			INC_DWORD_STAT(STAT_GPUSkinCache_NumFallbacks);
 
-		// Can't fit
-		return nullptr;
+			// Can't fit
+			return nullptr;
+		}
 	}
 
 	FRWBuffersAllocation* NewAllocation = new FRWBuffersAllocation(NumVertices, WithTangnents, UseIntermediateTangents, NumTriangles, RHICmdList);
@@ -1709,6 +1778,8 @@ void FGPUSkinCache::BeginBatchDispatch(FRHICommandListImmediate& RHICmdList)
 	check(BatchDispatches.Num() == 0);
 	bShouldBatchDispatches = true;
 	DispatchCounter = 0;
+
+	ReleaseUnusedPooledAllocations();
 }
 
 void FGPUSkinCache::EndBatchDispatch(FRHICommandListImmediate& RHICmdList)
@@ -2009,11 +2080,21 @@ void FGPUSkinCache::ReleaseSkinCacheEntry(FGPUSkinCacheEntry* SkinCacheEntry)
 	{
 		uint64 RequiredMemInBytes = PositionAllocation->GetNumBytes();
 		SkinCache->UsedMemoryInBytes -= RequiredMemInBytes;
-		DEC_MEMORY_STAT_BY(STAT_GPUSkinCache_TotalMemUsed, RequiredMemInBytes);
 
 		SkinCache->Allocations.Remove(PositionAllocation);
 
-		delete PositionAllocation;
+		if (GSkinCachePoolReleaseFrames > 0)
+		{
+			// Still counted in the total memory used while pooled
+			SkinCache->PooledAllocations.Add({ PositionAllocation, GFrameNumberRenderThread });
+			SkinCache->PooledMemoryInBytes += RequiredMemInBytes;
+			INC_MEMORY_STAT_BY(STAT_GPUSkinCache_PooledMemUsed, RequiredMemInBytes);
+		}
+		else
+		{
+			DEC_MEMORY_STAT_BY(STAT_GPUSkinCache_TotalMemUsed, RequiredMemInBytes);
+			delete PositionAllocation;
+		}
 
 		SkinCacheEntry->PositionAllocation = nullptr;
 	}
@@ -2215,6 +2296,7 @@ void FGPUSkinCache::PrintMemorySummary() const
 	uint64 UnusedSizeInBytes = MaxSizeInBytes - UsedMemoryInBytes;
 
 	UE_LOG(LogSkinCache, Display, TEXT("Used: %.3fMB"), UsedMemoryInBytes / MBSize);
+	UE_LOG(LogSkinCache, Display, TEXT("Pooled: %.3fMB in %d allocations"), PooledMemoryInBytes / MBSize, PooledAllocations.Num());
 	UE_LOG(LogSkinCache, Display, TEXT("Available: %.3fMB"), UnusedSizeInBytes / MBSize);
 	UE_LOG(LogSkinCache, Display, TEXT("Total limit: %.3fMB"), GSkinCacheSceneMemoryLimitInMB);
 	UE_LOG(LogSkinCache, Display, TEXT("Extra required: %.3fMB"), ExtraRequiredMemory / MBSize);
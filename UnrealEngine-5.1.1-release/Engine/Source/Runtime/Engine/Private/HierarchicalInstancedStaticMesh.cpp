@@ -102,6 +102,13 @@ TAutoConsoleVariable<float> CVarRandomLODRange(
 	0.0f,
 	TEXT("Random distance added to each instance distance to compute LOD."));
 
+static TAutoConsoleVariable<int32> CVarFoliageGPULODSelection(
+	TEXT("foliage.GPULODSelection"),
+	0,
+	TEXT("If greater than zero and GPU Scene is used, the LOD of each built instance is selected by GPU instance culling from its screen size, instead of traversing the cluster tree on the CPU.\n")
+	TEXT("Shadow and orthographic views keep using the cluster tree, as do views with foliage.ForceLOD, foliage.MinLOD or foliage.CullAll set."),
+	ECVF_RenderThreadSafe);
+
 static TAutoConsoleVariable<int32> CVarMinVertsToSplitNode(
 	TEXT("foliage.MinVertsToSplitNode"),
 	8192,
@@ -1246,6 +1253,10 @@ struct FFoliageElementParams
 	ERHIFeatureLevel::Type FeatureLevel;
 	bool ShadowFrustum;
 	float FinalCullDistance;
+	/** If set, every instance is emitted for each LOD and GPU instance culling keeps the ones within [LODScreenSizeMin, LODScreenSizeMax) */
+	bool bGPULODSelection;
+	float LODScreenSizeMin[MAX_STATIC_MESH_LODS];
+	float LODScreenSizeMax[MAX_STATIC_MESH_LODS];
 };
 
 void FHierarchicalStaticMeshSceneProxy::FillDynamicMeshElements(FMeshElementCollector& Collector, const FFoliageElementParams& ElementParams, const FFoliageRenderInstanceParams& Params) const
@@ -1303,6 +1314,13 @@ void FHierarchicalStaticMeshSceneProxy::FillDynamicMeshElements(FMeshElementColl
 					MeshBatchElement.InstancedLODIndex = LODIndex;
 					MeshBatchElement.InstancedLODRange = bDitherLODEnabled ? 1 : 0;
 					MeshBatchElement.PrimitiveUniformBuffer = GetUniformBuffer();
+					if (ElementParams.bGPULODSelection)
+					{
+						MeshBatchElement.MaxScreenSize = ElementParams.LODScreenSizeMax[LODIndex];
+						MeshBatchElement.MinScreenSize = ElementParams.LODScreenSizeMin[LODIndex];
+						MeshBatchElement.bGPULODSelection = true;
+						MeshBatchElement.bForceInstanceCulling = true;
+					}
 
 					int32 TotalInstances = bDitherLODEnabled ? Params.TotalMultipleLODInstances[LODIndex] : Params.TotalSingleLODInstances[LODIndex];
 					{
@@ -1520,6 +1538,13 @@ void FHierarchicalStaticMeshSceneProxy::GetDynamicMeshElements(const TArray<cons
 
 	int32 MinVertsToSplitNode = CVarMinVertsToSplitNode.GetValueOnRenderThread();
 
+	const bool bAllowGPULODSelection = CVarFoliageGPULODSelection.GetValueOnRenderThread() > 0
+		&& InstancedRenderData.FeatureLevel > ERHIFeatureLevel::ES3_1
+		&& UseGPUScene(GetScene().GetShaderPlatform(), GetScene().GetFeatureLevel())
+		&& CVarForceLOD.GetValueOnRenderThread() < 0
+		&& CVarMinLOD.GetValueOnRenderThread() < 0
+		&& CVarCullAll.GetValueOnRenderThread() < 1;
+
 	for (int32 ViewIndex = 0; ViewIndex < Views.Num(); ViewIndex++)
 	{
 		if (VisibilityMap & (1 << ViewIndex))
@@ -1539,6 +1564,7 @@ void FHierarchicalStaticMeshSceneProxy::GetDynamicMeshElements(const TArray<cons
 			ElementParams.FeatureLevel = InstancedRenderData.FeatureLevel;
 			ElementParams.ViewIndex = ViewIndex;
 			ElementParams.View = View;
+			ElementParams.bGPULODSelection = false;
 
 			// Render built instances
 			if (ClusterTree.Num())
@@ -1683,119 +1709,152 @@ void FHierarchicalStaticMeshSceneProxy::GetDynamicMeshElements(const TArray<cons
 				check(InstanceParams.LODs <= 8);
 				check(RenderData != nullptr);
 			
-				for (int32 LODIndex = 0; LODIndex < InstanceParams.LODs; LODIndex++)
+				if (bAllowGPULODSelection && !ElementParams.ShadowFrustum && !bIsOrtho)
 				{
-					InstanceParams.MinInstancesToSplit[LODIndex] = 2;
+					// GPU instance culling selects the LOD of each instance from its screen size, so every built instance is emitted once per LOD without traversing the cluster tree
+					FFoliageRenderInstanceParams& GPULODInstanceParams = Collector.AllocateOneFrameResource<FFoliageRenderInstanceParams>(true, false, false);
 
-					// Added assert guard to track issue UE-53944
-					check(RenderData->LODResources.IsValidIndex(LODIndex));
+					ElementParams.bBlendLODs = false;
+					ElementParams.bGPULODSelection = true;
 
-					int32 NumVerts = RenderData->LODResources[LODIndex].VertexBuffers.StaticMeshVertexBuffer.GetNumVertices();
-					if (NumVerts)
+					const FMatrix& ProjectionMatrix = View->ViewMatrices.GetProjectionMatrix();
+					auto DistanceToScreenSize = [SphereRadius, &ProjectionMatrix](float Distance)
 					{
-						InstanceParams.MinInstancesToSplit[LODIndex] = MinVertsToSplitNode / NumVerts;
-					}
-				}
+						return Distance < MAX_flt ? ComputeBoundsScreenSize(FVector4(0, 0, 0, 1), SphereRadius, FVector4(0, 0, Distance, 1), ProjectionMatrix) : 0.0f;
+					};
 
-				if (FirstOcclusionNode >= 0 && LastOcclusionNode >= 0 && FirstOcclusionNode <= LastOcclusionNode)
-				{
-					uint32 ViewId = View->GetViewKey();
-					const FFoliageOcclusionResults* OldResults = OcclusionResults.Find(ViewId);
-					if (OldResults &&
-						OldResults->FrameNumberRenderThread == GFrameNumberRenderThread &&
-						1 + LastOcclusionNode - FirstOcclusionNode == OldResults->NumResults &&
-						// OcclusionResultsArray[Params.OcclusionResultsStart + Index - Params.FirstOcclusionNode]
-
-						OldResults->Results.IsValidIndex(OldResults->ResultsStart) &&
-						OldResults->Results.IsValidIndex(OldResults->ResultsStart + LastOcclusionNode - FirstOcclusionNode)
-						)
+					const int32 FirstLODIndex = FMath::Min<int32>(ClampedMinLOD, InstanceParams.LODs - 1);
+					for (int32 LODIndex = FirstLODIndex; LODIndex < InstanceParams.LODs; LODIndex++)
 					{
-						InstanceParams.FirstOcclusionNode = FirstOcclusionNode;
-						InstanceParams.LastOcclusionNode = LastOcclusionNode;
-						InstanceParams.OcclusionResults = &OldResults->Results;
-						InstanceParams.OcclusionResultsStart = OldResults->ResultsStart;
-					}
-				}
+						// Largest value a half can hold, for the LOD drawn up close
+						ElementParams.LODScreenSizeMax[LODIndex] = LODIndex == FirstLODIndex ? 65504.0f : DistanceToScreenSize(InstanceParams.LODPlanesMax[LODIndex - 1]);
+						ElementParams.LODScreenSizeMin[LODIndex] = DistanceToScreenSize(InstanceParams.LODPlanesMax[LODIndex]);
 
-				INC_DWORD_STAT(STAT_FoliageTraversals);
-#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
-				if (GCaptureDebugRuns == GDebugTag && CaptureTag == GDebugTag)
-				{
-					for (int32 LODIndex = 0; LODIndex < InstanceParams.LODs; LODIndex++)
-					{
-						for (int32 Run = 0; Run < SingleDebugRuns[LODIndex].Num(); Run++)
-						{
-							InstanceParams.SingleLODRuns[LODIndex].Add(SingleDebugRuns[LODIndex][Run]);
-						}
-						InstanceParams.TotalSingleLODInstances[LODIndex] = SingleDebugTotalInstances[LODIndex];
-						for (int32 Run = 0; Run < MultipleDebugRuns[LODIndex].Num(); Run++)
+						if (FirstUnbuiltIndex > 0)
 						{
-							InstanceParams.MultipleLODRuns[LODIndex].Add(MultipleDebugRuns[LODIndex][Run]);
+							GPULODInstanceParams.AddRun(LODIndex, LODIndex, 0, FirstUnbuiltIndex - 1);
 						}
-						InstanceParams.TotalMultipleLODInstances[LODIndex] = MultipleDebugTotalInstances[LODIndex];
 					}
+
+					FillDynamicMeshElements(Collector, ElementParams, GPULODInstanceParams);
+					ElementParams.bGPULODSelection = false;
 				}
 				else
-#endif
 				{
-					SCOPE_CYCLE_COUNTER(STAT_FoliageTraversalTime);
+					for (int32 LODIndex = 0; LODIndex < InstanceParams.LODs; LODIndex++)
+					{
+						InstanceParams.MinInstancesToSplit[LODIndex] = 2;
 
-					// validate that the bounding box is layed out correctly in memory
-					check((const FVector4f*)&ClusterTree[0].BoundMin + 1 == (const FVector4f*)&ClusterTree[0].BoundMax); //-V594
-					//check(UPTRINT(&ClusterTree[0].BoundMin) % 16 == 0);
-					//check(UPTRINT(&ClusterTree[0].BoundMax) % 16 == 0);
+						// Added assert guard to track issue UE-53944
+						check(RenderData->LODResources.IsValidIndex(LODIndex));
 
-					int32 UseMinLOD = ClampedMinLOD;
+						int32 NumVerts = RenderData->LODResources[LODIndex].VertexBuffers.StaticMeshVertexBuffer.GetNumVertices();
+						if (NumVerts)
+						{
+							InstanceParams.MinInstancesToSplit[LODIndex] = MinVertsToSplitNode / NumVerts;
+						}
+					}
 
-					int32 DebugMin = FMath::Min(CVarMinLOD.GetValueOnRenderThread(), InstanceParams.LODs - 1);
-					if (DebugMin >= 0)
+					if (FirstOcclusionNode >= 0 && LastOcclusionNode >= 0 && FirstOcclusionNode <= LastOcclusionNode)
 					{
-						UseMinLOD = FMath::Max(UseMinLOD, DebugMin);
+						uint32 ViewId = View->GetViewKey();
+						const FFoliageOcclusionResults* OldResults = OcclusionResults.Find(ViewId);
+						if (OldResults &&
+							OldResults->FrameNumberRenderThread == GFrameNumberRenderThread &&
+							1 + LastOcclusionNode - FirstOcclusionNode == OldResults->NumResults &&
+							// OcclusionResultsArray[Params.OcclusionResultsStart + Index - Params.FirstOcclusionNode]
+
+							OldResults->Results.IsValidIndex(OldResults->ResultsStart) &&
+							OldResults->Results.IsValidIndex(OldResults->ResultsStart + LastOcclusionNode - FirstOcclusionNode)
+							)
+						{
+							InstanceParams.FirstOcclusionNode = FirstOcclusionNode;
+							InstanceParams.LastOcclusionNode = LastOcclusionNode;
+							InstanceParams.OcclusionResults = &OldResults->Results;
+							InstanceParams.OcclusionResultsStart = OldResults->ResultsStart;
+						}
 					}
-					int32 UseMaxLOD = InstanceParams.LODs;
 
-					int32 Force = CVarForceLOD.GetValueOnRenderThread();
-					if (Force >= 0)
+					INC_DWORD_STAT(STAT_FoliageTraversals);
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+					if (GCaptureDebugRuns == GDebugTag && CaptureTag == GDebugTag)
 					{
-						UseMinLOD = FMath::Clamp(Force, 0, InstanceParams.LODs - 1);
-						UseMaxLOD = FMath::Clamp(Force, 0, InstanceParams.LODs - 1);
+						for (int32 LODIndex = 0; LODIndex < InstanceParams.LODs; LODIndex++)
+						{
+							for (int32 Run = 0; Run < SingleDebugRuns[LODIndex].Num(); Run++)
+							{
+								InstanceParams.SingleLODRuns[LODIndex].Add(SingleDebugRuns[LODIndex][Run]);
+							}
+							InstanceParams.TotalSingleLODInstances[LODIndex] = SingleDebugTotalInstances[LODIndex];
+							for (int32 Run = 0; Run < MultipleDebugRuns[LODIndex].Num(); Run++)
+							{
+								InstanceParams.MultipleLODRuns[LODIndex].Add(MultipleDebugRuns[LODIndex][Run]);
+							}
+							InstanceParams.TotalMultipleLODInstances[LODIndex] = MultipleDebugTotalInstances[LODIndex];
+						}
 					}
-
-					if (CVarCullAll.GetValueOnRenderThread() < 1)
+					else
+#endif
 					{
-						if (bUseVectorCull)
+						SCOPE_CYCLE_COUNTER(STAT_FoliageTraversalTime);
+
+						// validate that the bounding box is layed out correctly in memory
+						check((const FVector4f*)&ClusterTree[0].BoundMin + 1 == (const FVector4f*)&ClusterTree[0].BoundMax); //-V594
+						//check(UPTRINT(&ClusterTree[0].BoundMin) % 16 == 0);
+						//check(UPTRINT(&ClusterTree[0].BoundMax) % 16 == 0);
+
+						int32 UseMinLOD = ClampedMinLOD;
+
+						int32 DebugMin = FMath::Min(CVarMinLOD.GetValueOnRenderThread(), InstanceParams.LODs - 1);
+						if (DebugMin >= 0)
 						{
-							Traverse<true>(InstanceParams, 0, UseMinLOD, UseMaxLOD, bDisableCull);
+							UseMinLOD = FMath::Max(UseMinLOD, DebugMin);
 						}
-						else
+						int32 UseMaxLOD = InstanceParams.LODs;
+
+						int32 Force = CVarForceLOD.GetValueOnRenderThread();
+						if (Force >= 0)
 						{
-							Traverse<false>(InstanceParams, 0, UseMinLOD, UseMaxLOD, bDisableCull);
+							UseMinLOD = FMath::Clamp(Force, 0, InstanceParams.LODs - 1);
+							UseMaxLOD = FMath::Clamp(Force, 0, InstanceParams.LODs - 1);
 						}
-					}
-#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
-					if (GCaptureDebugRuns == GDebugTag && CaptureTag != GDebugTag)
-					{
-						CaptureTag = GDebugTag;
-						for (int32 LODIndex = 0; LODIndex < InstanceParams.LODs; LODIndex++)
+
+						if (CVarCullAll.GetValueOnRenderThread() < 1)
 						{
-							SingleDebugRuns[LODIndex].Empty();
-							SingleDebugTotalInstances[LODIndex] = InstanceParams.TotalSingleLODInstances[LODIndex];
-							for (int32 Run = 0; Run < InstanceParams.SingleLODRuns[LODIndex].Num(); Run++)
+							if (bUseVectorCull)
 							{
-								SingleDebugRuns[LODIndex].Add(InstanceParams.SingleLODRuns[LODIndex][Run]);
+								Traverse<true>(InstanceParams, 0, UseMinLOD, UseMaxLOD, bDisableCull);
 							}
-							MultipleDebugRuns[LODIndex].Empty();
-							MultipleDebugTotalInstances[LODIndex] = InstanceParams.TotalMultipleLODInstances[LODIndex];
-							for (int32 Run = 0; Run < InstanceParams.MultipleLODRuns[LODIndex].Num(); Run++)
+							else
 							{
-								MultipleDebugRuns[LODIndex].Add(InstanceParams.MultipleLODRuns[LODIndex][Run]);
+								Traverse<false>(InstanceParams, 0, UseMinLOD, UseMaxLOD, bDisableCull);
+							}
+						}
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+						if (GCaptureDebugRuns == GDebugTag && CaptureTag != GDebugTag)
+						{
+							CaptureTag = GDebugTag;
+							for (int32 LODIndex = 0; LODIndex < InstanceParams.LODs; LODIndex++)
+							{
+								SingleDebugRuns[LODIndex].Empty();
+								SingleDebugTotalInstances[LODIndex] = InstanceParams.TotalSingleLODInstances[LODIndex];
+								for (int32 Run = 0; Run < InstanceParams.SingleLODRuns[LODIndex].Num(); Run++)
+								{
+									SingleDebugRuns[LODIndex].Add(InstanceParams.SingleLODRuns[LODIndex][Run]);
+								}
+								MultipleDebugRuns[LODIndex].Empty();
+								MultipleDebugTotalInstances[LODIndex] = InstanceParams.TotalMultipleLODInstances[LODIndex];
+								for (int32 Run = 0; Run < InstanceParams.MultipleLODRuns[LODIndex].Num(); Run++)
+								{
+									MultipleDebugRuns[LODIndex].Add(InstanceParams.MultipleLODRuns[LODIndex][Run]);
+								}
 							}
 						}
-					}
 #endif
-				}
+					}
 
-				FillDynamicMeshElements(Collector, ElementParams, InstanceParams);
+					FillDynamicMeshElements(Collector, ElementParams, InstanceParams);
+				}
 			}
 
 			int32 UnbuiltInstanceCount = InstanceCountToRender - FirstUnbuiltIndex;
@@ -1694,8 +1694,8 @@ void FInstancedStaticMeshSceneProxy::SetupInstancedMeshBatch(int32 LODIndex, int
 	
 	if (OutMeshBatch.MaterialRenderProxy)
 	{
-		// If the material on the mesh batch is translucent, then preserve the instance draw order to prevent flickering
-		// TODO: This should use depth sorting of instances instead, once that is implemented for GPU Scene instances
+		// If the material on the mesh batch is translucent, then preserve the instance draw order to prevent flickering.
+		// The visible instances are then sorted back to front by the instance culling, see r.InstanceCulling.SortTranslucentInstances
 		const ERHIFeatureLevel::Type FeatureLevel = GetScene().GetFeatureLevel();
 		
 		// NOTE: For now, this feature is not supported for mobile platforms
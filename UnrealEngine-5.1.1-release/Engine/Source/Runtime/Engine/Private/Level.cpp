@@ -50,6 +50,7 @@ Level.cpp: Level-related functions
 #include "PhysicsEngine/BodySetup.h"
 #include "EngineGlobals.h"
 #include "Engine/LevelBounds.h"
+#include "Engine/CoreSettings.h"
 #include "Async/ParallelFor.h"
 #include "UnrealEngine.h"
 #include "Misc/ArchiveMD5.h"
@@ -1653,7 +1654,13 @@ void ULevel::IncrementalUpdateComponents(int32 NumComponentsToUpdate, bool bReru
 		FPhysScene* PhysScene = OwningWorld->GetPhysicsScene();
 		if (PhysScene)
 		{
-			PhysScene->ProcessDeferredCreatePhysicsState();
+			// When streaming incrementally, let deferred physics states accumulate over several registration batches so their
+			// physics meshes are created in larger parallel batches. UWorld::AddToWorld processes what is left at the end of each step.
+			const bool bBatchDeferredPhysicsStates = !bFullyUpdateComponents && !bAreComponentsCurrentlyRegistered && GLevelStreamingDeferredPhysicsStateGranularity > 0;
+			if (!bBatchDeferredPhysicsStates || PhysScene->GetNumDeferredPhysicsStateCreations() >= GLevelStreamingDeferredPhysicsStateGranularity)
+			{
+				PhysScene->ProcessDeferredCreatePhysicsState();
+			}
 		}
 	}
 }
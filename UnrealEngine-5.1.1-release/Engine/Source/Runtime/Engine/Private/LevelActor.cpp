@@ -39,6 +39,7 @@
 #include "GameFramework/WorldSettings.h"
 #include "Engine/NetDriver.h"
 #include "Engine/DemoNetDriver.h"
+#include "Engine/ActorPoolSubsystem.h"
 #include "Engine/Player.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Net/Core/PropertyConditions/PropertyConditions.h"
@@ -48,6 +49,7 @@
 
 #include "Misc/TimeGuard.h"
 #include "ProfilingDebugging/CsvProfiler.h"
+#include "TickTaskManagerInterface.h"
 
 #define LOCTEXT_NAMESPACE "LevelActor"
 
@@ -654,6 +656,18 @@ AActor* UWorld::SpawnActor( UClass* Class, FTransform const* UserTransformPtr, c
 		}
 	}
 
+	// Reuse an inactive actor if the class is pooled
+	UActorPoolSubsystem* ActorPool = ExternalPackage ? nullptr : GetSubsystem<UActorPoolSubsystem>();
+	if (ActorPool)
+	{
+		if (AActor* PooledActor = ActorPool->TryTakeActor(Class, LevelToSpawnIn, UserTransform, SpawnParameters, CollisionHandlingMethod))
+		{
+			OnActorSpawned.Broadcast(PooledActor);
+			AddNetworkActor(PooledActor);
+			return PooledActor;
+		}
+	}
+
 	EObjectFlags ActorFlags = SpawnParameters.ObjectFlags;
 
 	// actually make the actor object
@@ -755,6 +769,102 @@ AActor* UWorld::SpawnActor( UClass* Class, FTransform const* UserTransformPtr, c
 	return Actor;
 }
 
+int32 UWorld::SpawnActorsBatch( UClass* Class, TArrayView<const FTransform> Transforms, TArray<AActor*>& OutActors, const FActorSpawnParameters& SpawnParameters )
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UWorld::SpawnActorsBatch);
+
+	OutActors.Reset(Transforms.Num());
+
+	if (!Class || Transforms.Num() == 0)
+	{
+		return 0;
+	}
+	if (!SpawnParameters.Name.IsNone())
+	{
+		UE_LOG(LogSpawn, Warning, TEXT("SpawnActorsBatch failed because a name (%s) was specified for a batch of %d actors of class %s"), *SpawnParameters.Name.ToString(), Transforms.Num(), *Class->GetName());
+		return 0;
+	}
+	if (bIsTearingDown)
+	{
+		UE_LOG(LogSpawn, Warning, TEXT("SpawnActorsBatch failed because we are in the process of tearing down the world"));
+		return 0;
+	}
+
+#if !WITH_EDITORONLY_DATA
+	ULevel* CurrentLevel = PersistentLevel;
+#endif
+
+	// Same level selection as SpawnActor, grow the level's actor lists once for the whole batch
+	ULevel* LevelToSpawnIn = SpawnParameters.OverrideLevel;
+	if (LevelToSpawnIn == nullptr)
+	{
+		LevelToSpawnIn = (SpawnParameters.Owner != nullptr) ? SpawnParameters.Owner->GetLevel() : ToRawPtr(CurrentLevel);
+	}
+	if (LevelToSpawnIn)
+	{
+		LevelToSpawnIn->Actors.Reserve(LevelToSpawnIn->Actors.Num() + Transforms.Num());
+		LevelToSpawnIn->ActorsForGC.Reserve(LevelToSpawnIn->ActorsForGC.Num() + Transforms.Num());
+	}
+
+	// Create all actors with construction deferred. Components registered by PostSpawnInitialize only queue their primitives
+	// in the context, which adds all of them to the scene at once below.
+	FActorSpawnParameters BatchSpawnParameters = SpawnParameters;
+	BatchSpawnParameters.bDeferConstruction = true;
+
+	TArray<int32, TInlineAllocator<64>> TransformIndices;
+	TransformIndices.Reserve(Transforms.Num());
+	{
+		FRegisterComponentContext Context(this);
+		{
+			TGuardValue<FRegisterComponentContext*> ContextGuard(SpawnActorsBatchRegisterContext, &Context);
+			for (int32 Index = 0; Index < Transforms.Num(); ++Index)
+			{
+				if (AActor* Actor = SpawnActor(Class, &Transforms[Index], BatchSpawnParameters))
+				{
+					OutActors.Add(Actor);
+					TransformIndices.Add(Index);
+				}
+			}
+		}
+		Context.Process();
+	}
+
+	if (!SpawnParameters.bDeferConstruction && OutActors.Num() > 0)
+	{
+		// Tick functions are registered while the actors finish spawning, make room for all of them up front.
+		// Components created by construction scripts aren't known yet, so this is only an estimate based on the native components.
+		if (ULevel* TickLevel = OutActors[0]->GetLevel())
+		{
+			int32 NumTickFunctionsPerActor = OutActors[0]->PrimaryActorTick.bCanEverTick ? 1 : 0;
+			for (UActorComponent* Component : OutActors[0]->GetComponents())
+			{
+				if (Component && Component->PrimaryComponentTick.bCanEverTick)
+				{
+					++NumTickFunctionsPerActor;
+				}
+			}
+			FTickTaskManagerInterface::Get().ReserveTickFunctions(TickLevel, NumTickFunctionsPerActor * OutActors.Num());
+		}
+
+		for (int32 Index = 0; Index < OutActors.Num(); ++Index)
+		{
+			AActor* Actor = OutActors[Index];
+			if (IsValid(Actor))
+			{
+				Actor->FinishSpawning(Transforms[TransformIndices[Index]]);
+			}
+		}
+
+		if (!SpawnParameters.bNoFail)
+		{
+			// Collision handling can destroy actors while they finish spawning, the same way SpawnActor returns null for them
+			OutActors.RemoveAll([](AActor* Actor) { return !IsValid(Actor); });
+		}
+	}
+
+	return OutActors.Num();
+}
+
 ABrush* UWorld::SpawnBrush()
 {
 	FActorSpawnParameters SpawnInfo;
@@ -854,6 +964,15 @@ bool UWorld::DestroyActor( AActor* ThisActor, bool bNetForce, bool bShouldModify
 			FSetActorWantsDestroyDuringBeginPlay SetActorWantsDestroyDuringBeginPlay(ThisActor);
 			return true; // while we didn't actually destroy it now, we are going to, so tell the calling code it succeeded
 		}
+
+		// Pooled actors are kept for reuse by SpawnActor instead of being destroyed
+		if (UActorPoolSubsystem* ActorPool = GetSubsystem<UActorPoolSubsystem>())
+		{
+			if (ActorPool->TryReturnActor(ThisActor))
+			{
+				return true;
+			}
+		}
 	}
 	else
 	{
@@ -7,6 +7,8 @@ Level.cpp: Level-related functions
 #include "Engine/LevelActorContainer.h"
 #include "Engine/Level.h"
 #include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/GarbageCollection.h"
 #include "UObject/FastReferenceCollector.h"
 #include "UObject/UObjectArray.h"
 #include "UObject/Package.h"
@@ -16,6 +18,20 @@ Level.cpp: Level-related functions
 
 DEFINE_LOG_CATEGORY_STATIC(LogLevelActorContainer, Log, All);
 
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Spawned Actor Cluster Attempts"), STAT_SpawnedActorClusterAttempts, STATGROUP_GC);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Spawned Actor Clusters Created"), STAT_SpawnedActorClustersCreated, STATGROUP_GC);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Spawned Actor Clusters Dissolved"), STAT_SpawnedActorClustersDissolved, STATGROUP_GC);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Spawned Actor Clustered Objects (Total)"), STAT_SpawnedActorClusteredObjects, STATGROUP_GC);
+
+int32 GSpawnedActorClusteringEnabled = 0;
+static FAutoConsoleVariableRef CVarSpawnedActorClusteringEnabled(
+	TEXT("gc.SpawnedActorClusteringEnabled"),
+	GSpawnedActorClusteringEnabled,
+	TEXT("Whether actors spawned at runtime that can be in clusters create a GC cluster from themselves and the objects they own. ")
+	TEXT("Like level actor clusters, this assumes their references to objects outside of the actor don't change after spawning."),
+	ECVF_Default
+);
+
 /**
 * Handles UObject references found by TFastReferenceCollector
 */
@@ -25,13 +41,16 @@ class FActorClusterReferenceProcessor : public FSimpleReferenceProcessorBase
 	FUObjectCluster& Cluster;
 	ULevel* ParentLevel;
 	UPackage* ParentLevelPackage;
+	/** If set, only this object and the objects inside of it can be added to the cluster */
+	UObject* ClusterOuter;
 
 public:
 
-	FActorClusterReferenceProcessor(int32 InClusterRootIndex, FUObjectCluster& InCluster, ULevel* InParentLevel)
+	FActorClusterReferenceProcessor(int32 InClusterRootIndex, FUObjectCluster& InCluster, ULevel* InParentLevel, UObject* InClusterOuter = nullptr)
 		: ClusterRootIndex(InClusterRootIndex)
 		, Cluster(InCluster)
 		, ParentLevel(InParentLevel)
+		, ClusterOuter(InClusterOuter)
 	{
 		ParentLevelPackage = ParentLevel->GetOutermost();
 	}
@@ -53,6 +72,11 @@ public:
 			// And generally, no levels or worlds
 			return false;
 		}
+		if (ClusterOuter && Object != ClusterOuter && !Object->IsIn(ClusterOuter))
+		{
+			// Spawned actor clusters only contain the objects owned by the actor
+			return false;
+		}
 		return Object->CanBeInCluster();
 	}
 
@@ -162,26 +186,33 @@ public:
 	}
 };
 
-void ULevelActorContainer::CreateCluster()
+/**
+ * Creates a cluster rooted at ClusterRoot from all objects it references that can be added to it
+ *
+ * @param ClusterRoot The object to create the cluster from
+ * @param ParentLevel The level all objects in the cluster have to be in
+ * @param ClusterOuter If set, only this object and the objects inside of it can be added to the cluster
+ * @return Number of objects in the created cluster or 0 if no cluster was created
+ */
+static int32 CreateActorCluster(UObject* ClusterRoot, ULevel* ParentLevel, UObject* ClusterOuter)
 {
-
-	int32 ContainerInternalIndex = GUObjectArray.ObjectToIndex(this);
+	int32 ContainerInternalIndex = GUObjectArray.ObjectToIndex(ClusterRoot);
 	FUObjectItem* RootItem = GUObjectArray.IndexToObject(ContainerInternalIndex);
 	if (RootItem->GetOwnerIndex() != 0 || RootItem->HasAnyFlags(EInternalObjectFlags::ClusterRoot))
 	{
-		return;
+		return 0;
 	}
 
 	// If we haven't finished loading, we can't be sure we know all the references
-	check(!HasAnyFlags(RF_NeedLoad));
+	check(!ClusterRoot->HasAnyFlags(RF_NeedLoad));
 
 	// Create a new cluster, reserve an arbitrary amount of memory for it.
-	const int32 ClusterIndex = GUObjectClusters.AllocateCluster(GUObjectArray.ObjectToIndex(this));
+	const int32 ClusterIndex = GUObjectClusters.AllocateCluster(ContainerInternalIndex);
 	FUObjectCluster& Cluster = GUObjectClusters[ClusterIndex];
 	Cluster.Objects.Reserve(64);
 
 	// Collect all objects referenced by cluster root and by all objects it's referencing
-	FActorClusterReferenceProcessor Processor(ContainerInternalIndex, Cluster, CastChecked<ULevel>(GetOuter()));
+	FActorClusterReferenceProcessor Processor(ContainerInternalIndex, Cluster, ParentLevel, ClusterOuter);
 	TFastReferenceCollector<
 		FActorClusterReferenceProcessor, 
 		TDefaultReferenceCollector<FActorClusterReferenceProcessor>, 
@@ -190,7 +221,7 @@ void ULevelActorContainer::CreateCluster()
 	> ReferenceCollector(Processor, FGCArrayPool::Get());
 	FGCArrayStruct ArrayStruct;
 	TArray<UObject*>& ObjectsToProcess = ArrayStruct.ObjectsToSerialize;
-	ObjectsToProcess.Add(static_cast<UObject*>(this));
+	ObjectsToProcess.Add(ClusterRoot);
 	ReferenceCollector.CollectReferences(ArrayStruct);
 #if UE_BUILD_DEBUG
 	FGCArrayPool::Get().CheckLeaks();
@@ -207,12 +238,13 @@ void ULevelActorContainer::CreateCluster()
 		Cluster.ReferencedClusters.Sort();
 		Cluster.MutableObjects.Sort();
 
-		UE_LOG(LogLevelActorContainer, Verbose, TEXT("Created LevelActorCluster (%d) for %s with %d objects, %d referenced clusters and %d mutable objects."),
-			ClusterIndex, *GetOuter()->GetPathName(), Cluster.Objects.Num(), Cluster.ReferencedClusters.Num(), Cluster.MutableObjects.Num());
+		UE_LOG(LogLevelActorContainer, Verbose, TEXT("Created actor cluster (%d) for %s with %d objects, %d referenced clusters and %d mutable objects."),
+			ClusterIndex, *ClusterRoot->GetPathName(), Cluster.Objects.Num(), Cluster.ReferencedClusters.Num(), Cluster.MutableObjects.Num());
 
 #if UE_GCCLUSTER_VERBOSE_LOGGING
 		DumpClusterToLog(Cluster, true, false);
 #endif
+		return Cluster.Objects.Num();
 	}
 	else
 	{
@@ -224,9 +256,15 @@ void ULevelActorContainer::CreateCluster()
 		GUObjectClusters.FreeCluster(ClusterIndex);
 		check(RootItem->GetOwnerIndex() == 0);
 		check(!RootItem->HasAnyFlags(EInternalObjectFlags::ClusterRoot));
+		return 0;
 	}
 }
 
+void ULevelActorContainer::CreateCluster()
+{
+	CreateActorCluster(this, CastChecked<ULevel>(GetOuter()), nullptr);
+}
+
 void ULevelActorContainer::OnClusterMarkedAsPendingKill()
 {
 	ULevel* Level = CastChecked<ULevel>(GetOuter());
@@ -236,3 +274,35 @@ void ULevelActorContainer::OnClusterMarkedAsPendingKill()
 	Super::OnClusterMarkedAsPendingKill();
 }
 
+void CreateSpawnedActorCluster(AActor* Actor)
+{
+	check(Actor);
+	if (!FPlatformProperties::RequiresCookedData() || !GCreateGCClusters || !GSpawnedActorClusteringEnabled || !Actor->CanBeInCluster())
+	{
+		return;
+	}
+	// Actors that are rooted or already part of a level cluster are referenced on their own
+	ULevel* Level = Actor->GetLevel();
+	if (!Level || Actor->IsRooted() || GUObjectArray.IsDisregardForGC(Actor) || GUObjectClusters.GetObjectCluster(Actor))
+	{
+		return;
+	}
+
+	INC_DWORD_STAT(STAT_SpawnedActorClusterAttempts);
+	if (const int32 NumClusteredObjects = CreateActorCluster(Actor, Level, Actor))
+	{
+		INC_DWORD_STAT(STAT_SpawnedActorClustersCreated);
+		INC_DWORD_STAT_BY(STAT_SpawnedActorClusteredObjects, NumClusteredObjects);
+	}
+}
+
+void DissolveSpawnedActorCluster(AActor* Actor)
+{
+	check(Actor);
+	const FUObjectItem* ActorItem = GUObjectArray.ObjectToObjectItem(Actor);
+	if (ActorItem->HasAnyFlags(EInternalObjectFlags::ClusterRoot))
+	{
+		GUObjectClusters.DissolveCluster(Actor);
+		INC_DWORD_STAT(STAT_SpawnedActorClustersDissolved);
+	}
+}
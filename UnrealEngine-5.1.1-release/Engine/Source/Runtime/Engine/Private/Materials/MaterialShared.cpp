@@ -61,6 +61,7 @@
 #include "ODSC/ODSCManager.h"
 #endif
 #include "ProfilingDebugging/CountersTrace.h"
+#include "Containers/LruCache.h"
 
 #define LOCTEXT_NAMESPACE "MaterialShared"
 
@@ -2964,6 +2965,81 @@ bool FMaterial::Translate_New(const FMaterialShaderMapId& ShaderMapId,
 #endif
 }
 
+#if WITH_EDITOR
+static int32 GMaterialTranslationCacheMaxEntries = 512;
+static FAutoConsoleVariableRef CVarMaterialTranslationCacheMaxEntries(
+	TEXT("r.MaterialTranslationCache.MaxEntries"),
+	GMaterialTranslationCacheMaxEntries,
+	TEXT("Number of successful material translations kept in memory, so a shader map that has to be compiled again for an unchanged material graph,\n")
+	TEXT("static parameter set and feature level (for example after a shader change, or when the shader map was evicted) skips the translation. 0 disables the cache."),
+	ECVF_Default
+);
+
+/** Editor session cache of the output of the material translators, keyed by the material specific part of the shader map Id */
+namespace MaterialTranslationCache
+{
+	struct FEntry
+	{
+		FMaterialCompilationOutput CompilationOutput;
+		FShaderCompilerEnvironment MaterialEnvironment;
+	};
+
+	using FEntryPtr = TSharedPtr<const FEntry, ESPMode::ThreadSafe>;
+
+	static FCriticalSection CacheLock;
+	static TLruCache<FSHAHash, FEntryPtr> Entries;
+
+	static FSHAHash GetKey(const FMaterial& Material, const FMaterialShaderMapId& ShaderMapId, EShaderPlatform Platform, const ITargetPlatform* TargetPlatform)
+	{
+		FSHAHash MaterialHash;
+		ShaderMapId.GetMaterialHash(MaterialHash);
+
+		// Project settings and the material template feed the translation but are only part of the shader type dependencies of the shader map Id
+		FString KeyString;
+		ShaderMapAppendKeyString(Platform, KeyString);
+		if (TargetPlatform)
+		{
+			KeyString += TargetPlatform->PlatformName();
+		}
+		const FSHAHash& MaterialTemplateHash = GetShaderFileHash(TEXT("/Engine/Private/MaterialTemplate.ush"), Platform);
+		const bool bAllowDevelopmentShaderCompile = Material.GetAllowDevelopmentShaderCompile();
+
+		FSHA1 HashState;
+		HashState.Update(MaterialHash.Hash, sizeof(MaterialHash.Hash));
+		HashState.Update(MaterialTemplateHash.Hash, sizeof(MaterialTemplateHash.Hash));
+		HashState.Update((const uint8*)&Platform, sizeof(Platform));
+		HashState.Update((const uint8*)&bAllowDevelopmentShaderCompile, sizeof(bAllowDevelopmentShaderCompile));
+		HashState.UpdateWithString(*KeyString, KeyString.Len());
+		HashState.Final();
+
+		FSHAHash Key;
+		HashState.GetHash(&Key.Hash[0]);
+		return Key;
+	}
+
+	static FEntryPtr Find(const FSHAHash& Key)
+	{
+		FScopeLock Lock(&CacheLock);
+		const FEntryPtr* Entry = Entries.FindAndTouch(Key);
+		return Entry ? *Entry : FEntryPtr();
+	}
+
+	static void Add(const FSHAHash& Key, const FMaterialCompilationOutput& CompilationOutput, const FSharedShaderCompilerEnvironment& MaterialEnvironment)
+	{
+		TSharedPtr<FEntry, ESPMode::ThreadSafe> Entry = MakeShared<FEntry, ESPMode::ThreadSafe>();
+		Entry->CompilationOutput = CompilationOutput;
+		Entry->MaterialEnvironment = MaterialEnvironment;
+
+		FScopeLock Lock(&CacheLock);
+		if (Entries.Max() != GMaterialTranslationCacheMaxEntries)
+		{
+			Entries.Empty(GMaterialTranslationCacheMaxEntries);
+		}
+		Entries.Add(Key, Entry);
+	}
+}
+#endif // WITH_EDITOR
+
 bool FMaterial::Translate(const FMaterialShaderMapId& InShaderMapId,
 	const FStaticParameterSet& InStaticParameters,
 	EShaderPlatform InPlatform,
@@ -2972,14 +3048,42 @@ bool FMaterial::Translate(const FMaterialShaderMapId& InShaderMapId,
 	TRefCountPtr<FSharedShaderCompilerEnvironment>& OutMaterialEnvironment)
 {
 #if WITH_EDITOR
+	// Preview materials are edited in place without always changing their Id
+	const bool bUseTranslationCache = GMaterialTranslationCacheMaxEntries > 0 && !IsPreview();
+	FSHAHash TranslationCacheKey;
+	if (bUseTranslationCache)
+	{
+		TranslationCacheKey = MaterialTranslationCache::GetKey(*this, InShaderMapId, InPlatform, InTargetPlatform);
+		if (MaterialTranslationCache::FEntryPtr Entry = MaterialTranslationCache::Find(TranslationCacheKey))
+		{
+			// Only successful translations are cached, clear the errors of a previous failed compile like the translators do
+			CompileErrors.Empty();
+			ErrorExpressions.Empty();
+
+			OutCompilationOutput = Entry->CompilationOutput;
+			OutMaterialEnvironment = new FSharedShaderCompilerEnvironment();
+			static_cast<FShaderCompilerEnvironment&>(*OutMaterialEnvironment) = Entry->MaterialEnvironment;
+			OutMaterialEnvironment->TargetPlatform = InTargetPlatform;
+			return true;
+		}
+	}
+
+	bool bSuccess;
 	if (InShaderMapId.bUsingNewHLSLGenerator)
 	{
-		return Translate_New(InShaderMapId, InStaticParameters, InPlatform, InTargetPlatform, OutCompilationOutput, OutMaterialEnvironment);
+		bSuccess = Translate_New(InShaderMapId, InStaticParameters, InPlatform, InTargetPlatform, OutCompilationOutput, OutMaterialEnvironment);
 	}
 	else
 	{
-		return Translate_Legacy(InShaderMapId, InStaticParameters, InPlatform, InTargetPlatform, OutCompilationOutput, OutMaterialEnvironment);
+		bSuccess = Translate_Legacy(InShaderMapId, InStaticParameters, InPlatform, InTargetPlatform, OutCompilationOutput, OutMaterialEnvironment);
 	}
+
+	// The environment is modified by the caller once translated, cache it as is
+	if (bSuccess && bUseTranslationCache && OutMaterialEnvironment.IsValid())
+	{
+		MaterialTranslationCache::Add(TranslationCacheKey, OutCompilationOutput, *OutMaterialEnvironment);
+	}
+	return bSuccess;
 #else
 	checkNoEntry();
 	return false;
@@ -0,0 +1,303 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Net/ReplicationBenchmarkActor.h"
+
+#include "Net/UnrealNetwork.h"
+#include "Engine/Engine.h"
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "UObject/Package.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(ReplicationBenchmarkActor)
+
+extern bool CVar_NetDriver_ReportGameTickFlushTime;
+extern double GTickFlushGameDriverTimeSeconds;
+extern double GServerReplicateActorsPrepConnectionsSeconds;
+extern double GServerReplicateActorsBuildConsiderListSeconds;
+extern double GServerReplicateActorsPrioritizeSeconds;
+extern double GServerReplicateActorsProcessPrioritizedSeconds;
+
+//-----------------------------------------------------------------------------
+//
+AReplicationBenchmarkActor::AReplicationBenchmarkActor()
+{
+	bReplicates = true;
+	SetReplicatingMovement(false);
+
+	NetDormancy = DORM_Never;
+
+	PrimaryActorTick.bCanEverTick = true;
+}
+
+void AReplicationBenchmarkActor::GetLifetimeReplicatedProps(TArray< FLifetimeProperty > & OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(AReplicationBenchmarkActor, IntValue);
+	DOREPLIFETIME(AReplicationBenchmarkActor, FloatValue);
+	DOREPLIFETIME(AReplicationBenchmarkActor, VectorValue);
+	DOREPLIFETIME(AReplicationBenchmarkActor, ArrayValue);
+}
+
+void AReplicationBenchmarkActor::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	if (!HasAuthority() || ChurnRatio <= 0.0f)
+	{
+		return;
+	}
+
+	if (FMath::FRand() < ChurnRatio)
+	{
+		++IntValue;
+	}
+
+	if (FMath::FRand() < ChurnRatio)
+	{
+		FloatValue += DeltaSeconds;
+	}
+
+	if (FMath::FRand() < ChurnRatio)
+	{
+		VectorValue = FMath::VRand() * 1000.0;
+	}
+
+	if (FMath::FRand() < ChurnRatio)
+	{
+		ArrayValue.SetNum(FMath::RandRange(0, 16));
+		for (int32& Value : ArrayValue)
+		{
+			Value = FMath::Rand();
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+//
+/**
+ * Runs the game net driver with simulated client connections and a population of AReplicationBenchmarkActor,
+ * and reports the average server cost and traffic of replicating them.
+ */
+struct FReplicationBenchmark
+{
+	/** Frames skipped before sampling, so the initial replication of all actors isn't measured */
+	static constexpr int32 NumWarmupFrames = 30;
+
+	TWeakObjectPtr<UNetDriver> NetDriver;
+	TArray<TWeakObjectPtr<USimulatedClientNetConnection>> Connections;
+	TArray<TWeakObjectPtr<AReplicationBenchmarkActor>> Actors;
+	FDelegateHandle PostTickFlushHandle;
+
+	int32 NumFramesToSample = 0;
+	int32 NumFramesRun = 0;
+	bool bPreviousReportGameTickFlushTime = false;
+
+	double TickFlushSeconds = 0.0;
+	double PrepConnectionsSeconds = 0.0;
+	double BuildConsiderListSeconds = 0.0;
+	double PrioritizeSeconds = 0.0;
+	double ProcessPrioritizedSeconds = 0.0;
+	int64 StartOutBytes = 0;
+
+	static TUniquePtr<FReplicationBenchmark> Current;
+
+	static const TCHAR* GetReplicationPathName(const UNetDriver* Driver)
+	{
+		if (Driver == nullptr)
+		{
+			return TEXT("None");
+		}
+		if (Driver->IsUsingIrisReplication())
+		{
+			return TEXT("Iris");
+		}
+		return Driver->GetReplicationDriver() ? TEXT("ReplicationDriver") : TEXT("Built-in replication");
+	}
+
+	static void Start(const TArray<FString>& Args, UWorld* World)
+	{
+		if (Current.IsValid())
+		{
+			UE_LOG(LogNet, Display, TEXT("A replication benchmark is already running, use Net.ReplicationBenchmark.Stop to stop it"));
+			return;
+		}
+
+		UNetDriver* Driver = World ? World->GetNetDriver() : nullptr;
+		if (Driver == nullptr || !Driver->IsServer())
+		{
+			UE_LOG(LogNet, Display, TEXT("The replication benchmark needs a world with a server game net driver"));
+			return;
+		}
+
+		int32 NumConnections = 50;
+		int32 NumActors = 1000;
+		float ChurnPercent = 10.0f;
+		int32 NumFrames = 300;
+
+		if (Args.Num() > 0) { LexTryParseString<int32>(NumConnections, *Args[0]); }
+		if (Args.Num() > 1) { LexTryParseString<int32>(NumActors, *Args[1]); }
+		if (Args.Num() > 2) { LexTryParseString<float>(ChurnPercent, *Args[2]); }
+		if (Args.Num() > 3) { LexTryParseString<int32>(NumFrames, *Args[3]); }
+
+		NumConnections = FMath::Max(NumConnections, 1);
+		NumActors = FMath::Max(NumActors, 1);
+
+		Current = MakeUnique<FReplicationBenchmark>();
+		Current->Run(World, Driver, NumConnections, NumActors, FMath::Clamp(ChurnPercent / 100.0f, 0.0f, 1.0f), FMath::Max(NumFrames, 1));
+	}
+
+	static void Stop()
+	{
+		if (Current.IsValid())
+		{
+			Current->Report();
+			Current->Shutdown();
+			Current.Reset();
+		}
+	}
+
+	void Run(UWorld* World, UNetDriver* Driver, int32 NumConnections, int32 NumActors, float ChurnRatio, int32 NumFrames)
+	{
+		NetDriver = Driver;
+		NumFramesToSample = NumFrames;
+
+		// Lay the actors out on a grid around the origin, where all the simulated connections are viewing from
+		const int32 GridSize = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(NumActors)));
+		const double Spacing = 200.0;
+		for (int32 ActorIndex = 0; ActorIndex < NumActors; ++ActorIndex)
+		{
+			const FVector Location(((ActorIndex % GridSize) - GridSize / 2) * Spacing, ((ActorIndex / GridSize) - GridSize / 2) * Spacing, 0.0);
+			AReplicationBenchmarkActor* Actor = World->SpawnActor<AReplicationBenchmarkActor>(Location, FRotator::ZeroRotator);
+			if (Actor)
+			{
+				Actor->ChurnRatio = ChurnRatio;
+				Actors.Add(Actor);
+			}
+		}
+
+		AActor* Viewer = Actors.Num() > 0 ? Actors[0].Get() : nullptr;
+		if (Viewer == nullptr)
+		{
+			return;
+		}
+
+		for (int32 ConnectionIndex = 0; ConnectionIndex < NumConnections; ++ConnectionIndex)
+		{
+			USimulatedClientNetConnection* Connection = NewObject<USimulatedClientNetConnection>();
+			Connection->InitConnection(Driver, USOCK_Open, World->URL, 1000000);
+			Connection->InitSendBuffer();
+			Driver->AddClientConnection(Connection);
+			Connection->OwningActor = Viewer;
+			Connection->SetClientWorldPackageName(Driver->GetWorldPackage()->GetFName());
+			Connections.Add(Connection);
+		}
+
+		// Enables GTickFlushGameDriverTimeSeconds and the ServerReplicateActors phase timers in all build configurations
+		bPreviousReportGameTickFlushTime = CVar_NetDriver_ReportGameTickFlushTime;
+		CVar_NetDriver_ReportGameTickFlushTime = true;
+
+		PostTickFlushHandle = World->OnPostTickFlush().AddRaw(this, &FReplicationBenchmark::OnPostTickFlush);
+
+		UE_LOG(LogNet, Display, TEXT("Replication benchmark started with %d connections, %d actors, %.1f%% property churn, sampling %d frames (%s)"),
+			Connections.Num(), Actors.Num(), ChurnRatio * 100.0f, NumFramesToSample, GetReplicationPathName(Driver));
+	}
+
+	void OnPostTickFlush()
+	{
+		++NumFramesRun;
+
+		if (NumFramesRun == NumWarmupFrames)
+		{
+			StartOutBytes = GetConnectionsOutBytes();
+		}
+		else if (NumFramesRun > NumWarmupFrames)
+		{
+			TickFlushSeconds += GTickFlushGameDriverTimeSeconds;
+			PrepConnectionsSeconds += GServerReplicateActorsPrepConnectionsSeconds;
+			BuildConsiderListSeconds += GServerReplicateActorsBuildConsiderListSeconds;
+			PrioritizeSeconds += GServerReplicateActorsPrioritizeSeconds;
+			ProcessPrioritizedSeconds += GServerReplicateActorsProcessPrioritizedSeconds;
+
+			if (NumFramesRun - NumWarmupFrames >= NumFramesToSample)
+			{
+				// Resetting Current destroys this, don't touch any member afterwards
+				Stop();
+			}
+		}
+	}
+
+	int64 GetConnectionsOutBytes() const
+	{
+		int64 OutBytes = 0;
+		for (const TWeakObjectPtr<USimulatedClientNetConnection>& Connection : Connections)
+		{
+			if (Connection.IsValid())
+			{
+				OutBytes += Connection->OutTotalBytes;
+			}
+		}
+		return OutBytes;
+	}
+
+	void Report() const
+	{
+		const int32 NumFramesSampled = NumFramesRun - NumWarmupFrames;
+		if (NumFramesSampled <= 0 || Connections.Num() == 0)
+		{
+			UE_LOG(LogNet, Display, TEXT("Replication benchmark stopped before sampling any frame"));
+			return;
+		}
+
+		const double MsPerFrame = 1000.0 / NumFramesSampled;
+		const double BytesPerConnectionPerFrame = static_cast<double>(GetConnectionsOutBytes() - StartOutBytes) / (NumFramesSampled * Connections.Num());
+
+		UE_LOG(LogNet, Display, TEXT("Replication benchmark results over %d frames, %d connections, %d actors (%s):"),
+			NumFramesSampled, Connections.Num(), Actors.Num(), GetReplicationPathName(NetDriver.Get()));
+		UE_LOG(LogNet, Display, TEXT("  TickFlush: %.3f ms per frame"), TickFlushSeconds * MsPerFrame);
+		UE_LOG(LogNet, Display, TEXT("  ServerReplicateActors PrepConnections: %.3f ms, BuildConsiderList: %.3f ms, PrioritizeActors: %.3f ms, ProcessPrioritizedActors: %.3f ms per frame"),
+			PrepConnectionsSeconds * MsPerFrame, BuildConsiderListSeconds * MsPerFrame, PrioritizeSeconds * MsPerFrame, ProcessPrioritizedSeconds * MsPerFrame);
+		UE_LOG(LogNet, Display, TEXT("  Sent: %.1f bytes per connection per frame"), BytesPerConnectionPerFrame);
+	}
+
+	void Shutdown()
+	{
+		CVar_NetDriver_ReportGameTickFlushTime = bPreviousReportGameTickFlushTime;
+
+		UWorld* World = NetDriver.IsValid() ? NetDriver->GetWorld() : nullptr;
+		if (World)
+		{
+			World->OnPostTickFlush().Remove(PostTickFlushHandle);
+		}
+
+		for (const TWeakObjectPtr<USimulatedClientNetConnection>& Connection : Connections)
+		{
+			if (Connection.IsValid())
+			{
+				Connection->Close();
+				Connection->MarkAsGarbage();
+			}
+		}
+
+		for (const TWeakObjectPtr<AReplicationBenchmarkActor>& Actor : Actors)
+		{
+			if (Actor.IsValid())
+			{
+				Actor->Destroy();
+			}
+		}
+	}
+};
+
+TUniquePtr<FReplicationBenchmark> FReplicationBenchmark::Current;
+
+FAutoConsoleCommandWithWorldAndArgs ReplicationBenchmarkStart(TEXT("Net.ReplicationBenchmark.Start"),
+															  TEXT("Adds simulated connections and replicated actors to the server game net driver and logs the average replication cost once done." \
+																   "\nThe ServerReplicateActors phases are only measured for the built-in replication, not for replication drivers or Iris." \
+																   "\nUsage:" \
+																   "\nNet.ReplicationBenchmark.Start NumConnections NumActors ChurnPercent NumFrames"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&FReplicationBenchmark::Start));
+
+FAutoConsoleCommand ReplicationBenchmarkStop(TEXT("Net.ReplicationBenchmark.Stop"), TEXT("Stops the running replication benchmark, logs its results so far and removes its connections and actors."),
+	FConsoleCommandDelegate::CreateStatic(&FReplicationBenchmark::Stop));
@@ -431,6 +431,7 @@ void UNetConnection::InitBase(UNetDriver* InDriver,class FSocket* InSocket, cons
 	}
 
 	NetConnectionHistogram.InitHitchTracking();
+	ReceiveQueueLatencyHistogram.InitFromArray({ 0.0, 1.0, 2.0, 5.0, 10.0, 20.0, 33.0, 50.0, 100.0 });
 
 	// Current state
 	SetConnectionState(InState);
@@ -5451,6 +5452,33 @@ static void	PrintActorReportFunc(const TArray<FString>& Args, UWorld* InWorld)
 
 FAutoConsoleCommandWithWorldAndArgs PrintActorReportCmd(TEXT("net.ActorReport"), TEXT(""),	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(PrintActorReportFunc) );
 
+static void DumpReceiveQueueLatency(UWorld* InWorld)
+{
+	UNetDriver* NetDriver = InWorld ? InWorld->GetNetDriver() : nullptr;
+	if (NetDriver == nullptr)
+	{
+		return;
+	}
+
+	TArray<UNetConnection*, TInlineAllocator<32>> Connections;
+	if (NetDriver->ServerConnection)
+	{
+		Connections.Add(NetDriver->ServerConnection);
+	}
+	Connections.Append(NetDriver->ClientConnections);
+
+	for (UNetConnection* Connection : Connections)
+	{
+		if (Connection && Connection->GetReceiveQueueLatencyHistogram().GetNumMeasurements() > 0)
+		{
+			FHistogram Histogram = Connection->GetReceiveQueueLatencyHistogram();
+			Histogram.DumpToLog(FString::Printf(TEXT("Receive queue latency (ms) %s"), *Connection->LowLevelDescribe()));
+		}
+	}
+}
+
+FAutoConsoleCommandWithWorld DumpReceiveQueueLatencyCmd(TEXT("net.DumpReceiveQueueLatency"), TEXT("Logs the histogram of the time packets waited between the net driver receive thread and the game thread, for each connection"), FConsoleCommandWithWorldDelegate::CreateStatic(DumpReceiveQueueLatency));
+
 /*-----------------------------------------------------------------------------
 	FChannelRecordImpl
 -----------------------------------------------------------------------------*/
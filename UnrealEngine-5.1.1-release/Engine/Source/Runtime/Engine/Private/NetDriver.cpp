@@ -67,6 +67,7 @@
 #include "Stats/StatsMisc.h"
 #include "Engine/ReplicationDriver.h"
 #include "ProfilingDebugging/CsvProfiler.h"
+#include "Async/ParallelFor.h"
 #include "Engine/LevelScriptActor.h"
 #include "Engine/NetworkSettings.h"
 #include "Engine/NetworkDelegates.h"
@@ -347,6 +348,57 @@ static FAutoConsoleVariableRef CVarNetReuseReplicatorsForDormantObjects(
 	TEXT("When true, Server's will persist and attempt to reuse replicators for Dormant Actors and Objects. This can cut down on bandwidth by preventing redundant information from being sent when waking objects from Dormancy."),
 	ECVF_Default);
 
+int32 GNetParallelPrioritizeActors = 0;
+static FAutoConsoleVariableRef CVarNetParallelPrioritizeActors(
+	TEXT("net.ParallelPrioritizeActors"),
+	GNetParallelPrioritizeActors,
+	TEXT("When set to N > 0, ServerReplicateActors prioritizes the actors of each connection on worker threads when at least N connections are ticked this frame.\n")
+	TEXT("Relevancy, dormancy and priority are then evaluated for all connections before any actor is replicated, so IsNetRelevantFor, GetNetDormancy and GetNetPriority overrides must not modify game state."),
+	ECVF_Default);
+
+int32 GNetConnectionAdaptiveUpdateRate = 0;
+static FAutoConsoleVariableRef CVarNetConnectionAdaptiveUpdateRate(
+	TEXT("net.ConnectionAdaptiveUpdateRate"),
+	GNetConnectionAdaptiveUpdateRate,
+	TEXT("When enabled, ServerReplicateActors lowers how often an actor is replicated to a connection based on its distance to the connection's viewers, whether it is in their view cone, and how saturated the connection is.\n")
+	TEXT("The interval never exceeds 1 / MinNetUpdateFrequency, and actors owned by the connection or always relevant are never throttled."),
+	ECVF_Default);
+
+float GNetConnectionAdaptiveUpdateRateMaxDistanceScale = 3.0f;
+static FAutoConsoleVariableRef CVarNetConnectionAdaptiveUpdateRateMaxDistanceScale(
+	TEXT("net.ConnectionAdaptiveUpdateRate.MaxDistanceScale"),
+	GNetConnectionAdaptiveUpdateRateMaxDistanceScale,
+	TEXT("Scale applied to the update interval of an actor at its net cull distance, actors closer to the viewer are interpolated down to 1."),
+	ECVF_Default);
+
+float GNetConnectionAdaptiveUpdateRateOutOfViewScale = 2.0f;
+static FAutoConsoleVariableRef CVarNetConnectionAdaptiveUpdateRateOutOfViewScale(
+	TEXT("net.ConnectionAdaptiveUpdateRate.OutOfViewScale"),
+	GNetConnectionAdaptiveUpdateRateOutOfViewScale,
+	TEXT("Scale applied to the update interval of an actor outside the view cone of all the connection's viewers."),
+	ECVF_Default);
+
+float GNetConnectionAdaptiveUpdateRateViewConeCos = 0.5f;
+static FAutoConsoleVariableRef CVarNetConnectionAdaptiveUpdateRateViewConeCos(
+	TEXT("net.ConnectionAdaptiveUpdateRate.ViewConeCos"),
+	GNetConnectionAdaptiveUpdateRateViewConeCos,
+	TEXT("Cosine of the half angle of the view cone used by net.ConnectionAdaptiveUpdateRate."),
+	ECVF_Default);
+
+float GNetConnectionAdaptiveUpdateRateMaxSaturationScale = 4.0f;
+static FAutoConsoleVariableRef CVarNetConnectionAdaptiveUpdateRateMaxSaturationScale(
+	TEXT("net.ConnectionAdaptiveUpdateRate.MaxSaturationScale"),
+	GNetConnectionAdaptiveUpdateRateMaxSaturationScale,
+	TEXT("Scale applied to the update interval of all throttled actors once the connection has a full saturation window of bits queued past its bandwidth."),
+	ECVF_Default);
+
+float GNetConnectionAdaptiveUpdateRateSaturationWindow = 0.1f;
+static FAutoConsoleVariableRef CVarNetConnectionAdaptiveUpdateRateSaturationWindow(
+	TEXT("net.ConnectionAdaptiveUpdateRate.SaturationWindow"),
+	GNetConnectionAdaptiveUpdateRateSaturationWindow,
+	TEXT("Seconds of the connection's bandwidth that must be queued for it to be considered fully saturated."),
+	ECVF_Default);
+
 static TAutoConsoleVariable<int32> CVarNetDebugDraw(
 	TEXT("net.DebugDraw"),
 	0,
@@ -836,6 +888,12 @@ static FAutoConsoleVariableRef CVarNetDriverReportTickFlushTime(TEXT("net.Report
 /** Accounts for the network time we spent in the game driver. */
 double GTickFlushGameDriverTimeSeconds = 0.0;
 
+/** Accounts for the time the game driver spent in each phase of the built-in ServerReplicateActors on the last frame. */
+double GServerReplicateActorsPrepConnectionsSeconds = 0.0;
+double GServerReplicateActorsBuildConsiderListSeconds = 0.0;
+double GServerReplicateActorsPrioritizeSeconds = 0.0;
+double GServerReplicateActorsProcessPrioritizedSeconds = 0.0;
+
 bool ShouldEnableScopeSecondsTimers()
 {
 #if STATS
@@ -4428,6 +4486,72 @@ static FORCEINLINE_DEBUGGABLE bool ShouldActorGoDormant( AActor* Actor, const TA
 	return true;
 }
 
+// Returns true if an actor that already has a channel on this connection was replicated to it too recently
+// for its distance, visibility and the connection's saturation. See net.ConnectionAdaptiveUpdateRate.
+static FORCEINLINE_DEBUGGABLE bool IsActorUpdateThrottledForConnection( const AActor* Actor, const UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, const UActorChannel* Channel, const double Time )
+{
+	if ( GNetConnectionAdaptiveUpdateRate == 0 || !Channel || Channel->LastUpdateTime <= 0.0 || Actor->bAlwaysRelevant || Actor->bOnlyRelevantToOwner || Actor->NetUpdateFrequency <= 0.0f )
+	{
+		return false;
+	}
+
+	// Take the most favorable viewer, the actor is replicated as often as its closest visible viewer needs it
+	float RelevanceScale = FLT_MAX;
+	for ( const FNetViewer& Viewer : ConnectionViewers )
+	{
+		if ( Actor == Viewer.ViewTarget.Get() || Actor == Viewer.InViewer.Get() || Actor->IsOwnedBy( Viewer.InViewer.Get() ) )
+		{
+			return false;
+		}
+
+		const FVector Dir = Actor->GetActorLocation() - Viewer.ViewLocation;
+		const double DistSq = Dir.SizeSquared();
+		const float DistanceRatio = Actor->NetCullDistanceSquared > 0.0f ? FMath::Min( (float)FMath::Sqrt( DistSq / Actor->NetCullDistanceSquared ), 1.0f ) : 0.0f;
+
+		float ViewerScale = FMath::Lerp( 1.0f, FMath::Max( GNetConnectionAdaptiveUpdateRateMaxDistanceScale, 1.0f ), DistanceRatio );
+		if ( DistSq > UE_SMALL_NUMBER && ( Viewer.ViewDir | Dir ) < GNetConnectionAdaptiveUpdateRateViewConeCos * FMath::Sqrt( DistSq ) )
+		{
+			ViewerScale *= FMath::Max( GNetConnectionAdaptiveUpdateRateOutOfViewScale, 1.0f );
+		}
+
+		RelevanceScale = FMath::Min( RelevanceScale, ViewerScale );
+	}
+
+	if ( RelevanceScale == FLT_MAX )
+	{
+		return false;
+	}
+
+	// Bits queued past the connection's bandwidth, QueuedBits goes negative while there is spare bandwidth
+	float SaturationRatio = 0.0f;
+	const float SaturationBits = Connection->CurrentNetSpeed * 8.0f * GNetConnectionAdaptiveUpdateRateSaturationWindow;
+	if ( SaturationBits > 0.0f )
+	{
+		SaturationRatio = FMath::Clamp( ( Connection->QueuedBits + Connection->SendBuffer.GetNumBits() ) / SaturationBits, 0.0f, 1.0f );
+	}
+	const float SaturationScale = FMath::Lerp( 1.0f, FMath::Max( GNetConnectionAdaptiveUpdateRateMaxSaturationScale, 1.0f ), SaturationRatio );
+
+	const double MinInterval = 1.0 / Actor->NetUpdateFrequency;
+	const double MaxInterval = Actor->MinNetUpdateFrequency > 0.0f ? FMath::Max( 1.0 / Actor->MinNetUpdateFrequency, MinInterval ) : MinInterval;
+	const double Interval = FMath::Min( MinInterval * RelevanceScale * SaturationScale, MaxInterval );
+
+	return Time - Channel->LastUpdateTime < Interval;
+}
+
+// Makes a list of viewers a connection should consider (the connection and its children)
+static void GatherConnectionViewers( UNetConnection* Connection, const float DeltaSeconds, TArray<FNetViewer>& OutConnectionViewers )
+{
+	OutConnectionViewers.Reset();
+	new( OutConnectionViewers )FNetViewer( Connection, DeltaSeconds );
+	for ( int32 ViewerIndex = 0; ViewerIndex < Connection->Children.Num(); ViewerIndex++ )
+	{
+		if ( Connection->Children[ViewerIndex]->ViewTarget != NULL )
+		{
+			new( OutConnectionViewers )FNetViewer( Connection->Children[ViewerIndex], DeltaSeconds );
+		}
+	}
+}
+
 int32 UNetDriver::ServerReplicateActors_PrioritizeActors( UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, const TArray<FNetworkObjectInfo*>& ConsiderList, const bool bCPUSaturated, FActorPriority*& OutPriorityList, FActorPriority**& OutPriorityActors )
 {
 	SCOPE_CYCLE_COUNTER( STAT_NetPrioritizeActorsTime );
@@ -4526,6 +4650,11 @@ int32 UNetDriver::ServerReplicateActors_PrioritizeActors( UNetConnection* Connec
 				}
 			}
 
+			if ( IsActorUpdateThrottledForConnection( Actor, Connection, ConnectionViewers, Channel, ElapsedTime ) )
+			{
+				continue;
+			}
+
 			// Actor is relevant to this connection, add it to the list
 			// NOTE - We use NetTag to make sure SentTemporaries didn't already mark this actor to be skipped
 			if ( Actor->NetTag != NetTag )
@@ -4571,6 +4700,101 @@ int32 UNetDriver::ServerReplicateActors_PrioritizeActors( UNetConnection* Connec
 	return FinalSortedCount;
 }
 
+// Same as ServerReplicateActors_PrioritizeActors, but safe to run for several connections at once.
+// Actors are not tagged with NetTag and channel state changes are recorded in Prioritized instead of applied.
+void UNetDriver::ServerReplicateActors_PrioritizeActorsParallel( FNetParallelPrioritizedConnection& Prioritized, const TArray<FNetworkObjectInfo*>& ConsiderList ) const
+{
+	UNetConnection* Connection = Prioritized.Connection;
+	const TArray<FNetViewer>& ConnectionViewers = Prioritized.Viewers;
+
+	// Make weak ptr once for IsActorDormant call
+	TWeakObjectPtr<UNetConnection> WeakConnection(Connection);
+
+	const int32 MaxSortedActors = ConsiderList.Num() + DestroyedStartupOrDormantActors.Num();
+	if ( MaxSortedActors == 0 )
+	{
+		return;
+	}
+
+	// PriorityActors points into PriorityList, so it must not grow past this
+	Prioritized.PriorityList.Reset( MaxSortedActors );
+	Prioritized.PriorityActors.Reset( MaxSortedActors );
+
+	AGameNetworkManager* const NetworkManager = World->NetworkManager;
+	const bool bLowNetBandwidth = NetworkManager ? NetworkManager->IsInLowBandwidthMode() : false;
+
+	for ( FNetworkObjectInfo* ActorInfo : ConsiderList )
+	{
+		AActor* Actor = ActorInfo->Actor;
+
+		// Skip temporary actors that were already sent
+		if ( Connection->SentTemporaries.Num() > 0 && Connection->SentTemporaries.Contains( Actor ) )
+		{
+			continue;
+		}
+
+		UActorChannel* Channel = Connection->FindActorChannelRef( ActorInfo->WeakActor );
+
+		if ( !Channel )
+		{
+			if ( !IsLevelInitializedForActor( Actor, Connection ) || !IsActorRelevantToConnection( Actor, ConnectionViewers ) )
+			{
+				continue;
+			}
+		}
+
+		UNetConnection* PriorityConnection = Connection;
+
+		if ( Actor->bOnlyRelevantToOwner )
+		{
+			bool bHasNullViewTarget = false;
+
+			PriorityConnection = IsActorOwnedByAndRelevantToConnection( Actor, ConnectionViewers, bHasNullViewTarget );
+
+			if ( PriorityConnection == nullptr )
+			{
+				if ( !bHasNullViewTarget && Channel != NULL && ElapsedTime - Channel->RelevantTime >= RelevantTimeout )
+				{
+					Prioritized.ChannelsToClose.Add( Channel );
+				}
+				continue;
+			}
+		}
+		else if ( GSetNetDormancyEnabled != 0 )
+		{
+			if ( IsActorDormant( ActorInfo, WeakConnection ) )
+			{
+				continue;
+			}
+
+			if ( ShouldActorGoDormant( Actor, ConnectionViewers, Channel, ElapsedTime, bLowNetBandwidth ) )
+			{
+				Prioritized.ChannelsToStartDormancy.Add( Channel );
+			}
+		}
+
+		if ( IsActorUpdateThrottledForConnection( Actor, Connection, ConnectionViewers, Channel, ElapsedTime ) )
+		{
+			continue;
+		}
+
+		FActorPriority& Priority = Prioritized.PriorityList.Emplace_GetRef( PriorityConnection, Channel, ActorInfo, ConnectionViewers, bLowNetBandwidth );
+		Prioritized.PriorityActors.Add( &Priority );
+	}
+
+	// Add in deleted actors
+	for ( auto It = Connection->GetDestroyedStartupOrDormantActorGUIDs().CreateConstIterator(); It; ++It )
+	{
+		FActorDestructionInfo& DInfo = *DestroyedStartupOrDormantActors.FindChecked( *It );
+		FActorPriority& Priority = Prioritized.PriorityList.Emplace_GetRef( Connection, &DInfo, ConnectionViewers );
+		Prioritized.PriorityActors.Add( &Priority );
+		Prioritized.NumDeletedActors++;
+	}
+
+	// Sort by priority
+	Prioritized.PriorityActors.Sort( FCompareFActorPriority() );
+}
+
 int32 UNetDriver::ServerReplicateActors_ProcessPrioritizedActors( UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, FActorPriority** PriorityActors, const int32 FinalSortedCount, int32& OutUpdated )
 {
 	SCOPE_CYCLE_COUNTER(STAT_NetProcessPrioritizedActorsTime);
@@ -5075,7 +5299,20 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 
 	int32 Updated = 0;
 
-	const int32 NumClientsToTick = ServerReplicateActors_PrepConnections( DeltaSeconds );
+	const bool bEnablePhaseTimers = (NetDriverName == NAME_GameNetDriver) && ShouldEnableScopeSecondsTimers();
+	if ( bEnablePhaseTimers )
+	{
+		GServerReplicateActorsPrepConnectionsSeconds = 0.0;
+		GServerReplicateActorsBuildConsiderListSeconds = 0.0;
+		GServerReplicateActorsPrioritizeSeconds = 0.0;
+		GServerReplicateActorsProcessPrioritizedSeconds = 0.0;
+	}
+
+	int32 NumClientsToTick = 0;
+	{
+		FSimpleScopeSecondsCounter PhaseTimer( GServerReplicateActorsPrepConnectionsSeconds, bEnablePhaseTimers );
+		NumClientsToTick = ServerReplicateActors_PrepConnections( DeltaSeconds );
+	}
 
 	if ( NumClientsToTick == 0 )
 	{
@@ -5101,10 +5338,60 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 	ConsiderList.Reserve( GetNetworkObjectList().GetActiveObjects().Num() );
 
 	// Build the consider list (actors that are ready to replicate)
-	ServerReplicateActors_BuildConsiderList( ConsiderList, ServerTickTime );
+	{
+		FSimpleScopeSecondsCounter PhaseTimer( GServerReplicateActorsBuildConsiderListSeconds, bEnablePhaseTimers );
+		ServerReplicateActors_BuildConsiderList( ConsiderList, ServerTickTime );
+	}
 
 	TSet<UNetConnection*> ConnectionsToClose;
 
+	// Prioritize the actors of all connections ticked this frame in parallel, their actors are still replicated one connection at a time below
+	TArray<FNetParallelPrioritizedConnection> ParallelPrioritizedConnections;
+	bool bParallelPrioritize = GNetParallelPrioritizeActors > 0 && NumClientsToTick >= GNetParallelPrioritizeActors && FApp::ShouldUseThreadingForPerformance();
+#if NET_DEBUG_RELEVANT_ACTORS
+	bParallelPrioritize &= !DebugRelevantActors;
+#endif
+	if ( bParallelPrioritize )
+	{
+		SCOPE_CYCLE_COUNTER( STAT_NetPrioritizeActorsTime );
+		FSimpleScopeSecondsCounter PhaseTimer( GServerReplicateActorsPrioritizeSeconds, bEnablePhaseTimers );
+
+		ParallelPrioritizedConnections.SetNum( NumClientsToTick );
+		for ( int32 i = 0; i < NumClientsToTick; i++ )
+		{
+			UNetConnection* Connection = ClientConnections[i];
+			if ( Connection->ViewTarget )
+			{
+				check( World == Connection->OwningActor->GetWorld() );
+				check( World == Connection->ViewTarget->GetWorld() );
+
+				ParallelPrioritizedConnections[i].Connection = Connection;
+				GatherConnectionViewers( Connection, DeltaSeconds, ParallelPrioritizedConnections[i].Viewers );
+			}
+		}
+
+		ParallelFor( ParallelPrioritizedConnections.Num(), [this, &ParallelPrioritizedConnections, &ConsiderList]( int32 Index )
+		{
+			if ( ParallelPrioritizedConnections[Index].Connection )
+			{
+				ServerReplicateActors_PrioritizeActorsParallel( ParallelPrioritizedConnections[Index], ConsiderList );
+			}
+		});
+
+		for ( FNetParallelPrioritizedConnection& Prioritized : ParallelPrioritizedConnections )
+		{
+			for ( UActorChannel* Channel : Prioritized.ChannelsToClose )
+			{
+				Channel->Close( EChannelCloseReason::Relevancy );
+			}
+			for ( UActorChannel* Channel : Prioritized.ChannelsToStartDormancy )
+			{
+				// Channel is marked to go dormant now once all properties have been replicated (but is not dormant yet)
+				Channel->StartBecomingDormant();
+			}
+		}
+	}
+
 	FMemMark Mark( FMemStack::Get() );
 
 	for ( int32 i=0; i < ClientConnections.Num(); i++ )
@@ -5162,14 +5449,14 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 			// Make a list of viewers this connection should consider (this connection and children of this connection)
 			TArray<FNetViewer>& ConnectionViewers = WorldSettings->ReplicationViewers;
 
-			ConnectionViewers.Reset();
-			new( ConnectionViewers )FNetViewer( Connection, DeltaSeconds );
-			for ( int32 ViewerIndex = 0; ViewerIndex < Connection->Children.Num(); ViewerIndex++ )
+			FNetParallelPrioritizedConnection* Prioritized = bParallelPrioritize ? &ParallelPrioritizedConnections[i] : nullptr;
+			if ( Prioritized )
 			{
-				if ( Connection->Children[ViewerIndex]->ViewTarget != NULL )
-				{
-					new( ConnectionViewers )FNetViewer( Connection->Children[ViewerIndex], DeltaSeconds );
-				}
+				ConnectionViewers = MoveTemp( Prioritized->Viewers );
+			}
+			else
+			{
+				GatherConnectionViewers( Connection, DeltaSeconds, ConnectionViewers );
 			}
 
 			// send ClientAdjustment if necessary
@@ -5193,10 +5480,27 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 			FActorPriority** PriorityActors = NULL;
 
 			// Get a sorted list of actors for this connection
-			const int32 FinalSortedCount = ServerReplicateActors_PrioritizeActors( Connection, ConnectionViewers, ConsiderList, bCPUSaturated, PriorityList, PriorityActors );
+			int32 FinalSortedCount = 0;
+			if ( Prioritized )
+			{
+				PriorityActors = Prioritized->PriorityActors.GetData();
+				FinalSortedCount = Prioritized->PriorityActors.Num();
+
+				SET_DWORD_STAT( STAT_PrioritizedActors, FinalSortedCount );
+				SET_DWORD_STAT( STAT_NumRelevantDeletedActors, Prioritized->NumDeletedActors );
+			}
+			else
+			{
+				FSimpleScopeSecondsCounter PhaseTimer( GServerReplicateActorsPrioritizeSeconds, bEnablePhaseTimers );
+				FinalSortedCount = ServerReplicateActors_PrioritizeActors( Connection, ConnectionViewers, ConsiderList, bCPUSaturated, PriorityList, PriorityActors );
+			}
 
 			// Process the sorted list of actors for this connection
-			const int32 LastProcessedActor = ServerReplicateActors_ProcessPrioritizedActors( Connection, ConnectionViewers, PriorityActors, FinalSortedCount, Updated );
+			int32 LastProcessedActor = 0;
+			{
+				FSimpleScopeSecondsCounter PhaseTimer( GServerReplicateActorsProcessPrioritizedSeconds, bEnablePhaseTimers );
+				LastProcessedActor = ServerReplicateActors_ProcessPrioritizedActors( Connection, ConnectionViewers, PriorityActors, FinalSortedCount, Updated );
+			}
 
 			// relevant actors that could not be processed this frame are marked to be considered for next frame
 			for ( int32 k=LastProcessedActor; k<FinalSortedCount; k++ )
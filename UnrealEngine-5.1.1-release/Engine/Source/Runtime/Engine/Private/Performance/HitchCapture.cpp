@@ -0,0 +1,267 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/DateTime.h"
+#include "Misc/DelayedAutoRegister.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Performance/EnginePerformanceTargets.h"
+#include "ProfilingDebugging/MiscTrace.h"
+#include "ProfilingDebugging/TraceAuxiliary.h"
+#include "RHI.h"
+#include "RenderCore.h"
+#include "Trace/Trace.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+#if UE_TRACE_ENABLED && !UE_BUILD_SHIPPING
+
+DEFINE_LOG_CATEGORY_STATIC(LogHitchCapture, Log, All);
+
+//////////////////////////////////////////////////////////////////////
+
+static bool GHitchCaptureEnable = false;
+static FAutoConsoleVariableRef GHitchCaptureEnableCVar(
+	TEXT("HitchCapture.Enable"),
+	GHitchCaptureEnable,
+	TEXT("When enabled, the trace channels in HitchCapture.Channels are kept in the in-memory trace tail buffer (sized with -tracetailmb=),\n")
+	TEXT("and a snapshot of it is written to Saved/Profiling/Hitches with a summary of the frame each time a frame is longer than HitchCapture.ThresholdMs"),
+	ECVF_Default);
+
+static float GHitchCaptureThresholdMs = 0.0f;
+static FAutoConsoleVariableRef GHitchCaptureThresholdMsCVar(
+	TEXT("HitchCapture.ThresholdMs"),
+	GHitchCaptureThresholdMs,
+	TEXT("Frame time (in ms) above which a hitch is captured, 0 uses t.HitchFrameTimeThreshold"),
+	ECVF_Default);
+
+static float GHitchCaptureMinSecondsBetweenCaptures = 30.0f;
+static FAutoConsoleVariableRef GHitchCaptureMinSecondsBetweenCapturesCVar(
+	TEXT("HitchCapture.MinSecondsBetweenCaptures"),
+	GHitchCaptureMinSecondsBetweenCaptures,
+	TEXT("Minimum time between two captures, hitches in between are only counted in the summary of the next capture"),
+	ECVF_Default);
+
+static int32 GHitchCaptureMaxCaptures = 10;
+static FAutoConsoleVariableRef GHitchCaptureMaxCapturesCVar(
+	TEXT("HitchCapture.MaxCaptures"),
+	GHitchCaptureMaxCaptures,
+	TEXT("Maximum number of captures written in a session, 0 is unlimited"),
+	ECVF_Default);
+
+static FString GHitchCaptureChannels = TEXT("cpu,frame,loadtime,bookmark");
+static FAutoConsoleVariableRef GHitchCaptureChannelsCVar(
+	TEXT("HitchCapture.Channels"),
+	GHitchCaptureChannels,
+	TEXT("Comma separated list of the trace channels enabled for the captures"),
+	ECVF_Default);
+
+//////////////////////////////////////////////////////////////////////
+
+/**
+ * Watches the duration of the frames on the game thread, and writes the trace tail buffer, which holds the last few seconds of events
+ * of the enabled channels, to disk when a frame is over the threshold. The summary written next to it lists what is known of the frame
+ * without analysing the trace: the thread times, the garbage collections and the packages that finished loading during the frame.
+ * The offending scopes are found by opening the snapshot in Unreal Insights, at the bookmark emitted for the hitch.
+ */
+class FHitchCapture
+{
+public:
+	void Initialize()
+	{
+		FCoreDelegates::OnEndFrame.AddRaw(this, &FHitchCapture::OnEndFrame);
+		FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddRaw(this, &FHitchCapture::OnPreGarbageCollect);
+		FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(this, &FHitchCapture::OnPostGarbageCollect);
+		FCoreUObjectDelegates::OnEndLoadPackage.AddRaw(this, &FHitchCapture::OnEndLoadPackage);
+	}
+
+private:
+	void OnEndFrame();
+	void OnPreGarbageCollect();
+	void OnPostGarbageCollect();
+	void OnEndLoadPackage(const FEndLoadPackageContext& Context);
+
+	void EnableChannels();
+	void WriteCapture(double FrameSeconds);
+	void ResetFrame();
+
+	// the package names listed in the summary are capped, the count is not
+	static constexpr int32 MaxListedPackages = 64;
+
+	double LastEndFrameTime = 0.0;
+	double LastCaptureTime = -DBL_MAX;
+	int32 NumCaptures = 0;
+	int32 NumHitchesSinceLastCapture = 0;
+	bool bChannelsEnabled = false;
+
+	double GarbageCollectStartTime = 0.0;
+	double FrameGarbageCollectSeconds = 0.0;
+	int32 FrameNumGarbageCollects = 0;
+	int32 FrameNumLoadedPackages = 0;
+	TArray<FString> FrameLoadedPackages;
+};
+
+static FHitchCapture GHitchCapture;
+
+static FDelayedAutoRegisterHelper GHitchCaptureRegistration(EDelayedRegisterRunPhase::EndOfEngineInit, []()
+{
+	GHitchCapture.Initialize();
+});
+
+//////////////////////////////////////////////////////////////////////
+
+void FHitchCapture::OnEndFrame()
+{
+	const double CurrentTime = FPlatformTime::Seconds();
+	const double FrameSeconds = LastEndFrameTime > 0.0 ? CurrentTime - LastEndFrameTime : 0.0;
+	LastEndFrameTime = CurrentTime;
+
+	if (!GHitchCaptureEnable)
+	{
+		ResetFrame();
+		return;
+	}
+
+	// the channels are only enabled once the capture is, they would otherwise fill the tail buffer for nothing
+	if (!bChannelsEnabled)
+	{
+		EnableChannels();
+	}
+
+	const float ThresholdMs = GHitchCaptureThresholdMs > 0.0f ? GHitchCaptureThresholdMs : FEnginePerformanceTargets::GetHitchFrameTimeThresholdMS();
+	if (FrameSeconds * 1000.0 > ThresholdMs)
+	{
+		++NumHitchesSinceLastCapture;
+		TRACE_BOOKMARK(TEXT("Hitch %.1f ms"), FrameSeconds * 1000.0);
+
+		const bool bUnderMaxCaptures = GHitchCaptureMaxCaptures <= 0 || NumCaptures < GHitchCaptureMaxCaptures;
+		if (bUnderMaxCaptures && CurrentTime - LastCaptureTime >= GHitchCaptureMinSecondsBetweenCaptures)
+		{
+			WriteCapture(FrameSeconds);
+			LastCaptureTime = CurrentTime;
+			NumHitchesSinceLastCapture = 0;
+			++NumCaptures;
+
+			// writing the capture is not part of the next frame
+			LastEndFrameTime = FPlatformTime::Seconds();
+		}
+	}
+
+	ResetFrame();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void FHitchCapture::OnPreGarbageCollect()
+{
+	GarbageCollectStartTime = FPlatformTime::Seconds();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void FHitchCapture::OnPostGarbageCollect()
+{
+	FrameGarbageCollectSeconds += FPlatformTime::Seconds() - GarbageCollectStartTime;
+	++FrameNumGarbageCollects;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void FHitchCapture::OnEndLoadPackage(const FEndLoadPackageContext& Context)
+{
+	if (!GHitchCaptureEnable)
+	{
+		return;
+	}
+
+	FrameNumLoadedPackages += Context.LoadedPackages.Num();
+	for (const UPackage* Package : Context.LoadedPackages)
+	{
+		if (FrameLoadedPackages.Num() >= MaxListedPackages)
+		{
+			break;
+		}
+		if (Package)
+		{
+			FrameLoadedPackages.Add(Package->GetName());
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void FHitchCapture::EnableChannels()
+{
+	TArray<FString> Channels;
+	GHitchCaptureChannels.ParseIntoArray(Channels, TEXT(","));
+	for (const FString& Channel : Channels)
+	{
+		if (!UE::Trace::ToggleChannel(*Channel.TrimStartAndEnd(), true))
+		{
+			UE_LOG(LogHitchCapture, Warning, TEXT("Unable to enable trace channel '%s' for hitch captures"), *Channel);
+		}
+	}
+	bChannelsEnabled = true;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void FHitchCapture::WriteCapture(double FrameSeconds)
+{
+	const FString BaseFilename = FPaths::ConvertRelativePathToFull(FPaths::ProfilingDir() / TEXT("Hitches")
+		/ FString::Printf(TEXT("Hitch_%s_%dms"), *FDateTime::Now().ToString(), FMath::RoundToInt32(FrameSeconds * 1000.0)));
+
+	const FString TraceFilename = BaseFilename + TEXT(".utrace");
+	const bool bSnapshotWritten = FTraceAuxiliary::WriteSnapshot(*TraceFilename);
+
+	TStringBuilder<2048> Summary;
+	Summary.Appendf(TEXT("Frame %llu took %.2f ms\n"), (uint64)GFrameCounter, FrameSeconds * 1000.0);
+	Summary.Appendf(TEXT("Hitches since the previous capture: %d\n"), NumHitchesSinceLastCapture);
+	Summary.Appendf(TEXT("Trace snapshot: %s\n\n"), bSnapshotWritten ? *TraceFilename : TEXT("not written, the trace tail buffer is disabled or a snapshot failed"));
+
+	// the thread times are the ones of the previous frame, as the end of frame is reached before they are updated
+	Summary.Appendf(TEXT("Previous frame thread times:\n"));
+	Summary.Appendf(TEXT("    Game    %.2f ms\n"), FPlatformTime::ToMilliseconds(GGameThreadTime));
+	Summary.Appendf(TEXT("    Render  %.2f ms\n"), FPlatformTime::ToMilliseconds(GRenderThreadTime));
+	Summary.Appendf(TEXT("    RHI     %.2f ms\n"), FPlatformTime::ToMilliseconds(GRHIThreadTime));
+	if (GDynamicRHI)
+	{
+		Summary.Appendf(TEXT("    GPU     %.2f ms\n"), FPlatformTime::ToMilliseconds(RHIGetGPUFrameCycles()));
+	}
+
+	Summary.Appendf(TEXT("\nGarbage collections: %d, %.2f ms\n"), FrameNumGarbageCollects, FrameGarbageCollectSeconds * 1000.0);
+	Summary.Appendf(TEXT("Packages still loading asynchronously: %d\n"), GetNumAsyncPackages());
+	Summary.Appendf(TEXT("Packages finished loading: %d\n"), FrameNumLoadedPackages);
+	for (const FString& PackageName : FrameLoadedPackages)
+	{
+		Summary.Appendf(TEXT("    %s\n"), *PackageName);
+	}
+	if (FrameNumLoadedPackages > FrameLoadedPackages.Num())
+	{
+		Summary.Appendf(TEXT("    ... and %d more\n"), FrameNumLoadedPackages - FrameLoadedPackages.Num());
+	}
+
+	const FString SummaryFilename = BaseFilename + TEXT(".txt");
+	if (FFileHelper::SaveStringToFile(Summary.ToView(), *SummaryFilename))
+	{
+		UE_LOG(LogHitchCapture, Display, TEXT("Captured a %.2f ms hitch to %s"), FrameSeconds * 1000.0, *SummaryFilename);
+	}
+	else
+	{
+		UE_LOG(LogHitchCapture, Warning, TEXT("Failed to write the summary of a %.2f ms hitch to %s"), FrameSeconds * 1000.0, *SummaryFilename);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void FHitchCapture::ResetFrame()
+{
+	FrameGarbageCollectSeconds = 0.0;
+	FrameNumGarbageCollects = 0;
+	FrameNumLoadedPackages = 0;
+	FrameLoadedPackages.Reset();
+}
+
+#endif // UE_TRACE_ENABLED && !UE_BUILD_SHIPPING
@@ -25,6 +25,7 @@
 #include "PhysicsEngine/BodySetup.h"
 #include "PhysicsEngine/BodyUtils.h"
 #include "HAL/LowLevelMemTracker.h"
+#include "Async/ParallelFor.h"
 #include "HAL/IConsoleManager.h"
 #include "Logging/TokenizedMessage.h"
 #include "Logging/MessageLog.h"
@@ -1083,6 +1084,9 @@ void FBodyInstance::UpdatePhysicsFilterData()
 
 TAutoConsoleVariable<int32> CDisableQueryOnlyActors(TEXT("p.DisableQueryOnlyActors"), 0, TEXT("If QueryOnly is used, actors are marked as simulation disabled. This is NOT compatible with origin shifting at the moment."));
 
+int32 GInitBodiesParallelMinBodies = 64;
+FAutoConsoleVariableRef CVarInitBodiesParallelMinBodies(TEXT("p.InitBodies.ParallelMinBodies"), GInitBodiesParallelMinBodies, TEXT("Minimum number of bodies initialized together, such as the instances of an instanced static mesh, for their physics actors and shapes to be created on the task workers. 0 always creates them on the game thread."));
+
 #if USE_BODYINSTANCE_DEBUG_NAMES
 TSharedPtr<TArray<ANSICHAR>> GetDebugDebugName(const UPrimitiveComponent* PrimitiveComp, const UBodySetup* BodySetup, FString& DebugName)
 {
@@ -1232,7 +1236,7 @@ bool FInitBodiesHelperBase::CreateShapes_AssumesLocked(FBodyInstance* Instance)
 	// #PHYS2 Call interface AddGeometry
 	BodySetup->AddShapesToRigidActor_AssumesLocked(Instance, Instance->Scale3D, SimplePhysMat, ComplexPhysMats, ComplexPhysMatMasks, BodyCollisionData, FTransform::Identity);
 
-	FPhysicsInterface::SetIgnoreAnalyticCollisions_AssumesLocked(Instance->ActorHandle, CVarIgnoreAnalyticCollisionsOverride.GetValueOnGameThread() ? true : Instance->bIgnoreAnalyticCollisions);
+	FPhysicsInterface::SetIgnoreAnalyticCollisions_AssumesLocked(Instance->ActorHandle, CVarIgnoreAnalyticCollisionsOverride.GetValueOnAnyThread() ? true : Instance->bIgnoreAnalyticCollisions);
 
 	const int32 NumShapes = FPhysicsInterface::GetNumShapes(Instance->ActorHandle);
 	bInitFail |= NumShapes == 0;
@@ -1261,6 +1265,16 @@ bool FInitBodiesHelperBase::CreateShapesAndActors()
 	// Ensure we have the AggGeom inside the body setup so we can calculate the number of shapes
 	BodySetup->CreatePhysicsMeshes();
 
+	struct FBodyToCreate
+	{
+		FBodyInstance* Instance;
+		FTransform Transform;
+		int32 BodyIdx;
+		bool bInitFail = false;
+	};
+	TArray<FBodyToCreate> BodiesToCreate;
+	BodiesToCreate.Reserve(NumBodies);
+
 	for (int32 BodyIdx = NumBodies - 1; BodyIdx >= 0; BodyIdx--)   // iterate in reverse since list might shrink
 	{
 		FBodyInstance* Instance = Bodies[BodyIdx];
@@ -1326,16 +1340,51 @@ bool FInitBodiesHelperBase::CreateShapesAndActors()
 		// Init user data structure to point back at this instance
 		Instance->PhysicsUserData = FPhysicsUserData(Instance);
 
-		CreateActor_AssumesLocked(Instance, Transform);
-		const bool bInitFail = CreateShapes_AssumesLocked(Instance);
-		if (bInitFail)
+		BodiesToCreate.Add({ Instance, Transform, BodyIdx });
+	}
+
+	// The particles and shapes are not visible to the solver until they are added to the scene in one batch by InitBodies,
+	// so large batches create them on the task workers
+	const bool bParallel = GInitBodiesParallelMinBodies > 0 && BodiesToCreate.Num() >= GInitBodiesParallelMinBodies && FApp::ShouldUseThreadingForPerformance();
+	if (bParallel)
+	{
+		// Physical materials create their physics handle on first use
+		for (const FBodyToCreate& BodyToCreate : BodiesToCreate)
+		{
+			if (UPhysicalMaterial* SimplePhysMat = BodyToCreate.Instance->GetSimplePhysicalMaterial())
+			{
+				SimplePhysMat->GetPhysicsMaterial();
+			}
+
+			TArray<FPhysicalMaterialMaskParams> ComplexPhysMatMasks;
+			for (UPhysicalMaterial* ComplexPhysMat : BodyToCreate.Instance->GetComplexPhysicalMaterials(ComplexPhysMatMasks))
+			{
+				if (ComplexPhysMat)
+				{
+					ComplexPhysMat->GetPhysicsMaterial();
+				}
+			}
+		}
+	}
+
+	ParallelFor(BodiesToCreate.Num(), [this, &BodiesToCreate](int32 Index)
+	{
+		FBodyToCreate& BodyToCreate = BodiesToCreate[Index];
+		CreateActor_AssumesLocked(BodyToCreate.Instance, BodyToCreate.Transform);
+		BodyToCreate.bInitFail = CreateShapes_AssumesLocked(BodyToCreate.Instance);
+	}, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+
+	for (const FBodyToCreate& BodyToCreate : BodiesToCreate)
+	{
+		FBodyInstance* Instance = BodyToCreate.Instance;
+		if (BodyToCreate.bInitFail)
 		{
 #if WITH_EDITOR
 			//In the editor we may have ended up here because of world trace ignoring our EnableCollision. Since we can't get at the data in that function we check for it here
 			if(!PrimitiveComp || PrimitiveComp->IsCollisionEnabled())
 #endif
 			{
-				UE_LOG(LogPhysics, Log, TEXT("Init Instance %d of Primitive Component %s failed. Does it have collision data available?"), BodyIdx, *PrimitiveComp->GetReadableName());
+				UE_LOG(LogPhysics, Log, TEXT("Init Instance %d of Primitive Component %s failed. Does it have collision data available?"), BodyToCreate.BodyIdx, *PrimitiveComp->GetReadableName());
 			}
 
 			FPhysicsInterface::ReleaseActor(Instance->ActorHandle, PhysScene);
@@ -4046,7 +4095,7 @@ void FBodyInstance::BuildBodyFilterData(FBodyCollisionFilterData& OutFilterData,
 	//        should configure the bodies to reflect this desired behavior.
 	if(USkeletalMeshComponent* SkelMeshComp = Cast<USkeletalMeshComponent>(OwnerComponentInst))
 	{
-		if (CVarEnableDynamicPerBodyFilterHacks.GetValueOnGameThread() && bHACK_DisableCollisionResponse)
+		if (CVarEnableDynamicPerBodyFilterHacks.GetValueOnAnyThread() && bHACK_DisableCollisionResponse)
 		{
 			UseResponse.SetAllChannels(ECR_Ignore);
 			UseCollisionEnabled = ECollisionEnabled::PhysicsOnly;
@@ -4061,7 +4110,7 @@ void FBodyInstance::BuildBodyFilterData(FBodyCollisionFilterData& OutFilterData,
 			UseCollisionEnabled = ECollisionEnabled::PhysicsOnly;		// this will prevent object traces hitting this as well
 		}
 
-		const bool bDisableSkelComponentOverride = CVarEnableDynamicPerBodyFilterHacks.GetValueOnGameThread() && bHACK_DisableSkelComponentFilterOverriding;
+		const bool bDisableSkelComponentOverride = CVarEnableDynamicPerBodyFilterHacks.GetValueOnAnyThread() && bHACK_DisableSkelComponentFilterOverriding;
 		if (bDisableSkelComponentOverride)
 		{
 			// if we are disabling the skeletal component override, we want the original body instance collision response
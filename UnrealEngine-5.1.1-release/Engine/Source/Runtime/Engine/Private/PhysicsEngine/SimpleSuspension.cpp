@@ -2,6 +2,7 @@
 
 #include "Physics/SimpleSuspension.h"
 #include "Chaos/Real.h"
+#include "Math/TransformBatch.h"
 
 
 // Some calculations are expected to exceed the engine's SMALL_NUMBER threshold
@@ -441,10 +442,7 @@ void FSimpleSuspensionHelpers::ComputeWorldSuspensionCoordinates(const FVector&
 	ensure(OutWorldSuspensionOrigins.Num() == Count);
 	OutWorldCenterOfMass = LocalToWorld.TransformPosition(LocalCenterOfMass);
 	OutWorldSuspensionNormal = LocalToWorld.TransformVector(LocalSuspensionNormal);
-	for (int32 Index = 0; Index < Count; ++Index)
-	{
-		OutWorldSuspensionOrigins[Index] = LocalToWorld.TransformPosition(LocalSuspensionOrigins[Index]);
-	}
+	UE::Math::TransformPositions(LocalToWorld, MakeArrayView(LocalSuspensionOrigins), MakeArrayView(OutWorldSuspensionOrigins.GetData(), Count));
 }
 
 void FSimpleSuspensionHelpers::ComputeWorldSuspensionCoordinates(const FSimpleSuspensionParams& SuspensionParams, const FTransform& LocalToWorld, FSimpleSuspensionState& OutSuspensionState)
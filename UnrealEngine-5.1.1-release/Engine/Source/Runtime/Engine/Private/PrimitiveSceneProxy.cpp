@@ -163,6 +163,13 @@ bool SupportsNaniteRendering(const FVertexFactoryType* RESTRICT VertexFactoryTyp
 }
 
 
+/** Returns a revision number for FPrimitiveSceneProxy::DynamicMeshElementsRevision that no other proxy uses, proxies are created on several threads. */
+static uint32 GetNextDynamicMeshElementsRevision()
+{
+	static volatile int32 DynamicMeshElementsRevisionCounter = 0;
+	return (uint32)FPlatformAtomics::InterlockedIncrement(&DynamicMeshElementsRevisionCounter);
+}
+
 static bool VertexDeformationOutputsVelocity()
 {
 	static const auto CVarVelocityOutputPass = IConsoleManager::Get().FindConsoleVariable(TEXT("r.VelocityOutputPass"));
@@ -419,6 +426,14 @@ FPrimitiveSceneProxy::FPrimitiveSceneProxy(const UPrimitiveComponent* InComponen
 	{
 		bHasWorldPositionOffsetVelocity = true;
 	}
+
+	DynamicMeshElementsRevision = GetNextDynamicMeshElementsRevision();
+}
+
+void FPrimitiveSceneProxy::MarkDynamicMeshElementsDirty()
+{
+	check(IsInRenderingThread());
+	DynamicMeshElementsRevision = GetNextDynamicMeshElementsRevision();
 }
 
 bool FPrimitiveSceneProxy::OnLevelAddedToWorld_RenderThread()
@@ -629,6 +644,9 @@ void FPrimitiveSceneProxy::SetTransform(const FMatrix& InLocalToWorld, const FBo
 	}
 	
 	UpdateUniformBuffer();
+
+	// Cull mode and bindings of the cached dynamic mesh draw commands may depend on the transform
+	MarkDynamicMeshElementsDirty();
 	
 	// Notify the proxy's implementation of the change.
 	OnTransformChanged();
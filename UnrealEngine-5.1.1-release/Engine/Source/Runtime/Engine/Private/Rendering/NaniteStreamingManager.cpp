@@ -12,6 +12,7 @@
 #include "RenderGraphUtils.h"
 #include "Logging/LogMacros.h"
 #include "Async/ParallelFor.h"
+#include "ContentStreaming.h"
 #include "Misc/Compression.h"
 
 #if WITH_EDITOR
@@ -132,11 +133,26 @@ static FAutoConsoleVariableRef CVarNaniteStreamingPrefetch(
 	TEXT("Process resource prefetch requests from calls to PrefetchResource().")
 );
 
+static int32 GNaniteStreamingPredictionMaxPages = 32;
+static FAutoConsoleVariableRef CVarNaniteStreamingPredictionMaxPages(
+	TEXT("r.Nanite.Streaming.Prediction.MaxPagesPerFrame"),
+	GNaniteStreamingPredictionMaxPages,
+	TEXT("Maximum number of pages requested per frame from calls to PredictResource(), highest priority resources first.")
+);
+
+static float GNaniteStreamingPredictionPriorityScale = 0.5f;
+static FAutoConsoleVariableRef CVarNaniteStreamingPredictionPriorityScale(
+	TEXT("r.Nanite.Streaming.Prediction.PriorityScale"),
+	GNaniteStreamingPredictionPriorityScale,
+	TEXT("Scale applied to the priority of predicted requests before they are merged with the GPU requests. Lower values favor what is currently visible.")
+);
+
 static_assert(NANITE_MAX_GPU_PAGES_BITS + MAX_RUNTIME_RESOURCE_VERSIONS_BITS + NANITE_STREAMING_REQUEST_MAGIC_BITS <= 32,	"Streaming request member RuntimeResourceID_Magic doesn't fit in 32 bits");
 static_assert(NANITE_MAX_RESOURCE_PAGES_BITS + NANITE_MAX_GROUP_PARTS_BITS + NANITE_STREAMING_REQUEST_MAGIC_BITS <= 32,			"Streaming request member PageIndex_NumPages_Magic doesn't fit in 32 bits");
 
 DECLARE_DWORD_COUNTER_STAT(		TEXT("Explicit Requests"),			STAT_NaniteExplicitRequests,				STATGROUP_Nanite );
 DECLARE_DWORD_COUNTER_STAT(		TEXT("GPU Requests"),				STAT_NaniteGPURequests,						STATGROUP_Nanite );
+DECLARE_DWORD_COUNTER_STAT(		TEXT("Predicted Requests"),			STAT_NanitePredictedRequests,				STATGROUP_Nanite );
 DECLARE_DWORD_COUNTER_STAT(		TEXT("Unique Requests"),			STAT_NaniteUniqueRequests,					STATGROUP_Nanite );
 
 DECLARE_DWORD_COUNTER_STAT(		TEXT("Unique New Requests"),			STAT_NaniteUniqueNewRequests,			STATGROUP_Nanite );
@@ -566,6 +582,7 @@ void FStreamingManager::InitRHI()
 
 	MaxStreamingPages = (uint32)((uint64)GNaniteStreamingPoolSize * 1024 * 1024 / NANITE_STREAMING_PAGE_GPU_SIZE);
 	check(MaxStreamingPages + GNaniteStreamingNumInitialRootPages <= NANITE_MAX_GPU_PAGES);
+	SetStreamingGPUPoolSize(EStreamingGPUPool::Nanite, (int64)MaxStreamingPages * NANITE_STREAMING_PAGE_GPU_SIZE);
 
 	MaxPendingPages = GNaniteStreamingMaxPendingPages;
 	MaxPageInstallsPerUpdate = (uint32)FMath::Min(GNaniteStreamingMaxPageInstallsPerFrame, GNaniteStreamingMaxPendingPages);
@@ -632,6 +649,8 @@ void FStreamingManager::ReleaseRHI()
 #endif
 
 	LLM_SCOPE_BYTAG(Nanite);
+	SetStreamingGPUPoolSize(EStreamingGPUPool::Nanite, 0);
+
 	for (FRHIGPUBufferReadback*& ReadbackBuffer : StreamingRequestReadbackBuffers)
 	{
 		if (ReadbackBuffer != nullptr)
@@ -1340,6 +1359,7 @@ void FStreamingManager::ProcessNewResources( FRDGBuilder& GraphBuilder)
 
 	FRDGBuffer* ClusterPageDataBuffer = ResizeByteAddressBufferIfNeeded(GraphBuilder, ClusterPageData.DataBuffer, AllocatedPagesSize, TEXT("Nanite.StreamingManager.ClusterPageData"));
 	RootPageInfos.SetNum( NumAllocatedRootPages );
+	SetStreamingGPUPoolSize(EStreamingGPUPool::Nanite, AllocatedPagesSize);
 
 	check( AllocatedPagesSize <= ( 1u << 31 ) );	// 2GB seems to be some sort of limit.
 													// TODO: Is it a GPU/API limit or is it a signed integer bug on our end?
@@ -1646,6 +1666,52 @@ void FStreamingManager::AddPendingResourcePrefetchRequests()
 	PendingResourcePrefetches.RemoveAll([](const FResourcePrefetch& Prefetch) { return Prefetch.NumFramesUntilRender == 0; });
 }
 
+void FStreamingManager::AddPendingResourcePredictionRequests()
+{
+	if (PendingResourcePredictions.Num() == 0)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(AddPendingResourcePredictionRequests);
+
+	// Spend the page budget on the most important resources first
+	PendingResourcePredictions.Sort([](const FResourcePrediction& A, const FResourcePrediction& B) { return A.Priority > B.Priority; });
+
+	uint32 NumPagesLeft = (uint32)FMath::Max(GNaniteStreamingPredictionMaxPages, 0);
+	for (const FResourcePrediction& Prediction : PendingResourcePredictions)
+	{
+		if (NumPagesLeft == 0)
+		{
+			break;
+		}
+
+		FResources** Resources = RuntimeResourceMap.Find(Prediction.RuntimeResourceID);
+		if (Resources)
+		{
+			// Request the first streaming pages of the resource, like prefetching, but blended with the GPU requests instead of overriding them
+			const uint32 NumRootPages = (*Resources)->NumRootPages;
+			const uint32 NumPages = (*Resources)->PageStreamingStates.Num();
+			const uint32 EndPage = FMath::Min3(NumPages, NumRootPages + MAX_RESOURCE_PREFETCH_PAGES, NumRootPages + NumPagesLeft);
+
+			const float Priority = FMath::Max(Prediction.Priority * GNaniteStreamingPredictionPriorityScale, 0.0f);
+			for (uint32 PageIndex = NumRootPages; PageIndex < EndPage; PageIndex++)
+			{
+				FStreamingRequest Request;
+				Request.Key.RuntimeResourceID	= Prediction.RuntimeResourceID;
+				Request.Key.PageIndex			= PageIndex;
+				Request.Priority				= *(const uint32*)&Priority;	// Positive floats sort like their bits, same encoding as the explicit requests
+				RequestsHashTable->AddRequest(Request);
+				INC_DWORD_STAT(STAT_NanitePredictedRequests);
+			}
+
+			NumPagesLeft -= (EndPage > NumRootPages) ? EndPage - NumRootPages : 0;
+		}
+	}
+
+	PendingResourcePredictions.Empty();
+}
+
 void FStreamingManager::BeginAsyncUpdate(FRDGBuilder& GraphBuilder)
 {
 	check(IsInRenderingThread());
@@ -1842,6 +1908,9 @@ void FStreamingManager::AsyncUpdate()
 
 	// Add any requests coming from pending resource prefetch hints
 	AddPendingResourcePrefetchRequests();
+
+	// Add any requests coming from camera movement prediction
+	AddPendingResourcePredictionRequests();
 	
 	const uint32 NumUniqueRequests = RequestsHashTable->GetNumElements();
 	INC_DWORD_STAT_BY(STAT_NaniteUniqueRequests, NumUniqueRequests);
@@ -2232,6 +2301,19 @@ void FStreamingManager::PrefetchResource(const FResources* Resources, uint32 Num
 	}
 }
 
+void FStreamingManager::PredictResource(uint32 RuntimeResourceID, float Priority)
+{
+	check(IsInRenderingThread());
+	check(!AsyncState.bUpdateActive);
+	if (GNaniteStreamingPrefetch)
+	{
+		FResourcePrediction Prediction;
+		Prediction.RuntimeResourceID	= RuntimeResourceID;
+		Prediction.Priority				= Priority;
+		PendingResourcePredictions.Add(Prediction);
+	}
+}
+
 void FStreamingManager::RequestNanitePages(TArrayView<uint32> RequestData)
 {
 	check(IsInRenderingThread());
@@ -58,6 +58,10 @@ int32 GNetSharedSerializedData = 1;
 static FAutoConsoleVariableRef CVarNetShareSerializedData(TEXT("net.ShareSerializedData"), GNetSharedSerializedData,
 	TEXT("If true, enable shared serialization system used by replication to reduce CPU usage when multiple clients need the same data"));
 
+int32 GNetShareSerializedDataOnMiss = 1;
+static FAutoConsoleVariableRef CVarNetShareSerializedDataOnMiss(TEXT("net.ShareSerializedDataOnMiss"), GNetShareSerializedDataOnMiss,
+	TEXT("If true, properties that are missing from the shared serialization data (because the connection that built it had a different changelist) are added to it when another connection sends them, so the remaining connections can copy them"));
+
 int32 GNetVerifyShareSerializedData = 0;
 static FAutoConsoleVariableRef CVarNetVerifyShareSerializedData(TEXT("net.VerifyShareSerializedData"), GNetVerifyShareSerializedData,
 	TEXT("Debug option to verify shared serialization data during replication"));
@@ -2639,6 +2643,7 @@ void FRepSerializationSharedInfo::CountBytes(FArchive& Ar) const
 	GRANULAR_NETWORK_MEMORY_TRACKING_INIT(Ar, "FRepSerializationSharedInfo::CountBytes");
 
 	GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("SharedPropertyInfo", SharedPropertyInfo.CountBytes(Ar));
+	GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("SharedPropertyIndices", SharedPropertyIndices.CountBytes(Ar));
 
 	GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("SerializedProperties",
 		if (FNetBitWriter const* const LocalSerializedProperties = SerializedProperties.Get())
@@ -2672,14 +2677,12 @@ const FRepSerializedPropertyInfo* FRepSerializationSharedInfo::WriteSharedProper
 	const bool bWriteHandle,
 	const bool bDoChecksum)
 {
+	check(SerializedProperties.IsValid());
+
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
-	check(!SharedPropertyInfo.ContainsByPredicate([PropertyKey](const FRepSerializedPropertyInfo& Info)
-	{ 
-		return (Info.PropertyKey == PropertyKey);
-	}));
+	check(!SharedPropertyIndices.Contains(PropertyKey));
 #endif
-
-	check(SerializedProperties.IsValid());
+	SharedPropertyIndices.Add(PropertyKey, SharedPropertyInfo.Num());
 
 	FRepSerializedPropertyInfo& SharedPropInfo = SharedPropertyInfo.Emplace_GetRef();
 
@@ -2721,11 +2724,14 @@ void FRepLayout::SendProperties_r(
 	FRepHandleIterator& HandleIterator,
 	const FConstRepObjectDataBuffer SourceData,
 	const int32 ArrayDepth,
-	const FRepSerializationSharedInfo* const RESTRICT SharedInfo,
+	FRepSerializationSharedInfo* const RESTRICT SharedInfo,
 	const ESerializePropertyType SerializePropertyType) const
 {
 	const bool bDoSharedSerialization = SharedInfo && !!GNetSharedSerializedData;
 
+	// The shared data is built with handles, so properties can only be added to it when sending by handle
+	const bool bShareOnMiss = bDoSharedSerialization && !!GNetShareSerializedDataOnMiss && SharedInfo->IsValid() && (SerializePropertyType == ESerializePropertyType::Handle);
+
 	while (HandleIterator.NextHandle())
 	{
 		const FRepLayoutCmd& Cmd = Cmds[HandleIterator.CmdIndex];
@@ -2788,10 +2794,14 @@ void FRepLayout::SendProperties_r(
 		{
 			FRepSharedPropertyKey PropertyKey(HandleIterator.CmdIndex, HandleIterator.ArrayIndex, ArrayDepth, (void*)Data.Data);
 
-			SharedPropInfo = SharedInfo->SharedPropertyInfo.FindByPredicate([PropertyKey](const FRepSerializedPropertyInfo& Info)
-			{ 
-				return (Info.PropertyKey == PropertyKey);
-			});
+			SharedPropInfo = SharedInfo->FindSharedProperty(PropertyKey);
+
+			// Not in the changelist the shared data was built from, serialize it once for all connections that send it this frame.
+			// Custom delta properties are excluded the same way BuildSharedSerialization excludes them.
+			if (!SharedPropInfo && bShareOnMiss && !EnumHasAnyFlags(ParentCmd.Flags, ERepParentFlags::IsCustomDelta))
+			{
+				SharedPropInfo = SharedInfo->WriteSharedProperty(Cmd, PropertyKey, HandleIterator.CmdIndex, HandleIterator.Handle, Data, /*bWriteHandle=*/ true, bDoChecksum);
+			}
 		}
 
 		// Use shared serialization if was found
@@ -2895,7 +2905,7 @@ void FRepLayout::SendProperties(
 	UClass* ObjectClass,
 	FNetBitWriter& Writer,
 	TArray<uint16>& Changed,
-	const FRepSerializationSharedInfo& SharedInfo,
+	FRepSerializationSharedInfo& SharedInfo,
 	const ESerializePropertyType SerializePropertyType) const
 {
 	SCOPE_CYCLE_COUNTER(STAT_NetReplicateDynamicPropSendTime);
@@ -6597,10 +6607,7 @@ void FRepLayout::SerializeProperties_r(
 		{
 			FRepSharedPropertyKey PropertyKey(CmdIndex, ArrayIndex, ArrayDepth, (void*)(Data + Cmd).Data);
 
-			SharedPropInfo = SharedInfo.SharedPropertyInfo.FindByPredicate([PropertyKey](const FRepSerializedPropertyInfo& Info) 
-			{ 
-				return (Info.PropertyKey == PropertyKey);
-			});
+			SharedPropInfo = SharedInfo.FindSharedProperty(PropertyKey);
 		}
 
 		if (Ar.IsLoading() && Map)
@@ -19,6 +19,8 @@
 #include "EngineUtils.h"
 #include "ReplayNetConnection.h"
 #include "Engine/DemoNetDriver.h"
+#include "Async/Async.h"
+#include "Serialization/MemoryWriter.h"
 
 extern TAutoConsoleVariable<int32> CVarWithLevelStreamingFixes;
 extern TAutoConsoleVariable<int32> CVarWithDeltaCheckpoints;
@@ -26,6 +28,7 @@ extern TAutoConsoleVariable<int32> CVarWithGameSpecificFrameData;
 extern TAutoConsoleVariable<int32> CVarEnableCheckpoints;
 extern TAutoConsoleVariable<float> CVarCheckpointUploadDelayInSeconds;
 extern TAutoConsoleVariable<float> CVarCheckpointSaveMaxMSPerFrameOverride;
+extern TAutoConsoleVariable<int32> CVarCheckpointAsyncGuidCache;
 extern TAutoConsoleVariable<int32> CVarDemoUseNetRelevancy;
 extern TAutoConsoleVariable<int32> CVarDemoClientRecordAsyncEndOfFrame;
 extern TAutoConsoleVariable<float> CVarDemoRecordHz;
@@ -57,6 +60,8 @@ FReplayHelper::FReplayHelper()
 
 FReplayHelper::~FReplayHelper()
 {
+	WaitForAsyncCheckpointTasks();
+
 	FWorldDelegates::LevelRemovedFromWorld.RemoveAll(this);
 	FWorldDelegates::LevelAddedToWorld.RemoveAll(this);
 }
@@ -182,6 +187,8 @@ void FReplayHelper::StartRecording(UNetConnection* Connection)
 
 void FReplayHelper::StopReplay()
 {
+	WaitForAsyncCheckpointTasks();
+
 	FNetworkReplayDelegates::OnReplayRecordingComplete.Broadcast(World.Get());
 
 	if (ReplayStreamer.IsValid())
@@ -1059,6 +1066,31 @@ bool FReplayHelper::SerializeGuidCache(UNetConnection* Connection, const FRepAct
 {
 	check(Connection);
 
+	if (CheckpointSaveContext.AsyncGuidCacheTask.IsValid())
+	{
+		if (!CheckpointSaveContext.AsyncGuidCacheTask.IsReady())
+		{
+			return false;
+		}
+
+		CheckpointSaveContext.AsyncGuidCacheTask.Reset();
+
+		*CheckpointArchive << CheckpointSaveContext.NumNetGuidsForRecording;
+		CheckpointArchive->Serialize(CheckpointSaveContext.AsyncGuidCacheData.GetData(), CheckpointSaveContext.AsyncGuidCacheData.Num());
+
+		CheckpointSaveContext.AsyncGuidCacheData.Empty();
+		CheckpointSaveContext.NextAmortizedItem = CheckpointSaveContext.NetGuidCacheSnapshot.Num();
+
+		return true;
+	}
+
+	// Path names are remapped while writing in the editor, which needs the game thread
+	if (CheckpointSaveContext.NextAmortizedItem == 0 && CheckpointSaveContext.NetGuidCacheSnapshot.Num() > 0 && CVarCheckpointAsyncGuidCache.GetValueOnGameThread() != 0 && !GIsEditor)
+	{
+		SerializeGuidCacheAsync(*CheckpointArchive);
+		return false;
+	}
+
 	if (CheckpointSaveContext.NextAmortizedItem == 0) // is the first iteration?
 	{
 		CheckpointSaveContext.NetGuidsCountPos = CheckpointArchive->Tell();
@@ -1137,6 +1169,72 @@ bool FReplayHelper::SerializeGuidCache(UNetConnection* Connection, const FRepAct
 	return bCompleted;
 }
 
+// Same output as SerializeGuidCache without path remapping, written to AsyncGuidCacheData by a background task.
+// The snapshot only holds objects that were valid and stable when it was taken, so they aren't checked again off the game thread.
+void FReplayHelper::SerializeGuidCacheAsync(FArchive& CheckpointArchive)
+{
+	check(!CheckpointSaveContext.AsyncGuidCacheTask.IsValid());
+
+	CheckpointSaveContext.AsyncGuidCacheData.Reset();
+	CheckpointSaveContext.NumNetGuidsForRecording = 0;
+
+	const bool bForceUnicode = CheckpointArchive.IsForcingUnicode();
+	const bool bByteSwapping = CheckpointArchive.IsByteSwapping();
+
+	CheckpointSaveContext.AsyncGuidCacheTask = Async(EAsyncExecution::TaskGraph, [Context = &CheckpointSaveContext, bForceUnicode, bByteSwapping]()
+	{
+		SCOPED_NAMED_EVENT(FReplayHelper_SerializeGuidCacheAsync, FColor::Green);
+
+		FMemoryWriter Writer(Context->AsyncGuidCacheData);
+		Writer.SetForceUnicode(bForceUnicode);
+		Writer.SetByteSwapping(bByteSwapping);
+
+		for (FNetGuidCacheItem& Item : Context->NetGuidCacheSnapshot)
+		{
+			FNetGuidCacheObject& CacheObject = Item.NetGuidCacheObject;
+
+			Writer << Item.NetGuid;
+			Writer << CacheObject.OuterGUID;
+
+			uint32* NametableIndex = Context->NameTableMap.Find(CacheObject.PathName);
+			if (NametableIndex == nullptr)
+			{
+				uint8 bExported = 1;
+				Writer << bExported;
+
+				FString PathName = CacheObject.PathName.ToString();
+				Writer << PathName;
+
+				Context->NameTableMap.Add(CacheObject.PathName, Context->NameTableMap.Num());
+			}
+			else
+			{
+				uint8 bExported = 0;
+				Writer << bExported;
+
+				uint32 TableIndex = *NametableIndex;
+				Writer.SerializeIntPacked(TableIndex);
+			}
+
+			uint8 Flags = 0;
+			Flags |= CacheObject.bNoLoad ? (1 << 0) : 0;
+			Flags |= CacheObject.bIgnoreWhenMissing ? (1 << 1) : 0;
+
+			Writer << Flags;
+
+			++Context->NumNetGuidsForRecording;
+		}
+	});
+}
+
+void FReplayHelper::WaitForAsyncCheckpointTasks()
+{
+	if (CheckpointSaveContext.AsyncGuidCacheTask.IsValid())
+	{
+		CheckpointSaveContext.AsyncGuidCacheTask.Wait();
+	}
+}
+
 bool FReplayHelper::SerializeDeletedStartupActors(UNetConnection* Connection, const FRepActorsCheckpointParams& Params, FArchive* CheckpointArchive)
 {
 	check(Connection);
@@ -1706,7 +1804,13 @@ void FReplayHelper::FCheckpointSaveStateContext::CountBytes(FArchive& Ar) const
 	GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("DeltaChannelCloseKeys", DeltaChannelCloseKeys.CountBytes(Ar));
 	GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("NetGuidCacheSnapshot", NetGuidCacheSnapshot.CountBytes(Ar));
 	GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("CheckpointDeletedNetStartupActors", CheckpointDeletedNetStartupActors.CountBytes(Ar));
-	GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("NameTableMap", NameTableMap.CountBytes(Ar));
+
+	// The async guid cache task writes to these while it runs
+	if (!AsyncGuidCacheTask.IsValid() || AsyncGuidCacheTask.IsReady())
+	{
+		GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("NameTableMap", NameTableMap.CountBytes(Ar));
+		GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("AsyncGuidCacheData", AsyncGuidCacheData.CountBytes(Ar));
+	}
 }
 
 void FReplayHelper::Serialize(FArchive& Ar)
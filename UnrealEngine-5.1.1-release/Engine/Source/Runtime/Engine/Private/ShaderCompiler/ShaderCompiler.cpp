@@ -642,6 +642,8 @@ void FShaderCompileJobCollection::SubmitJobs(const TArray<FShaderCommonCompileJo
 						FMemoryReader MemReader(*ExistingOutput);
 						Job->SerializeOutput(MemReader);
 
+						GShaderCompilerStats->RegisterJobCacheResult(*Job, FShaderCompilerStats::EJobCacheResult::Cached);
+
 						// finish the job instantly
 						ProcessFinishedJob(Job, true);
 
@@ -663,11 +665,13 @@ void FShaderCompileJobCollection::SubmitJobs(const TArray<FShaderCommonCompileJo
 							DuplicateJobsWaitList.Add(InputHash, Job);
 						}
 						bNewJob = false;
+						GShaderCompilerStats->RegisterJobCacheResult(*Job, FShaderCompilerStats::EJobCacheResult::InFlightDuplicate);
 					}
 					else
 					{
 						// track new jobs so we can dedupe them
 						JobsInFlight.Add(InputHash, Job);
+						GShaderCompilerStats->RegisterJobCacheResult(*Job, FShaderCompilerStats::EJobCacheResult::NewJob);
 					}
 				}
 
@@ -917,6 +921,24 @@ FShaderPipelineCompileJob* FShaderCompileJobCollection::PrepareJob(uint32 InId,
 static float GRegularWorkerTimeToLive = 20.0f;
 static float GBuildWorkerTimeToLive = 600.0f;
 
+static int32 GShaderCompilerPersistentWorkers = 0;
+static FAutoConsoleVariableRef CVarShaderCompilerPersistentWorkers(
+	TEXT("r.ShaderCompiler.PersistentWorkers"),
+	GShaderCompilerPersistentWorkers,
+	TEXT("If 1, ShaderCompileWorkers are kept running until the editor exits instead of timing out after WorkerTimeToLive idle seconds,\n")
+	TEXT("so their startup cost (module loading, shader format initialization) is only paid once per session. Applies to workers launched after the change."),
+	ECVF_Default
+);
+
+static float GShaderCompilerWorkerPollInterval = 0.1f;
+static FAutoConsoleVariableRef CVarShaderCompilerWorkerPollInterval(
+	TEXT("r.ShaderCompiler.WorkerPollInterval"),
+	GShaderCompilerWorkerPollInterval,
+	TEXT("Seconds to wait between checks for the output of the ShaderCompileWorkers while waiting for results (0.1 by default).\n")
+	TEXT("Lower values reduce the latency of small batches at the cost of more file system queries."),
+	ECVF_Default
+);
+
 // Configuration to retry shader compile through workers after a worker has been abandoned
 static constexpr int32 GSingleThreadedRunsIdle = -1;
 static constexpr int32 GSingleThreadedRunsDisabled = -2;
@@ -2986,7 +3008,7 @@ int32 FShaderCompileThreadRunnable::CompilingLoop()
 			if (NumProcessedResults == 0)
 			{
 				// Reduce filesystem query rate while actively waiting for results.
-				FPlatformProcess::Sleep(0.1f);
+				FPlatformProcess::Sleep(FMath::Max(GShaderCompilerWorkerPollInterval, 0.0f));
 			}
 		}
 	}
@@ -3213,6 +3235,42 @@ void FShaderCompilerStats::WriteStatSummary()
 		UE_LOG(LogShaderCompilers, Display, TEXT("Average processing rate: %.2f jobs/sec"), JobsCompleted / TotalTimeAtLeastOneJobWasInFlight);
 	}
 
+	if (ShaderDeduplication.Num())
+	{
+		uint64 TotalSubmitted = 0;
+		uint64 TotalCached = 0;
+		uint64 TotalInFlightDuplicates = 0;
+		for (const TPair<FString, FShaderDeduplication>& Pair : ShaderDeduplication)
+		{
+			TotalSubmitted += Pair.Value.NumSubmitted;
+			TotalCached += Pair.Value.NumCached;
+			TotalInFlightDuplicates += Pair.Value.NumInFlightDuplicates;
+		}
+
+		UE_LOG(LogShaderCompilers, Display, TEXT("Job cache: %llu jobs submitted, %llu found in the cache, %llu duplicates of jobs in flight, %.2f%% not compiled"),
+			TotalSubmitted, TotalCached, TotalInFlightDuplicates, TotalSubmitted > 0 ? 100.0 * double(TotalCached + TotalInFlightDuplicates) / double(TotalSubmitted) : 0.0);
+
+		// sort by number of jobs not compiled
+		ShaderDeduplication.ValueSort([](const FShaderDeduplication& A, const FShaderDeduplication& B) { return A.NumCached + A.NumInFlightDuplicates > B.NumCached + B.NumInFlightDuplicates; });
+
+		const int32 MaxShadersToPrint = FMath::Min(ShaderDeduplication.Num(), 5);
+		UE_LOG(LogShaderCompilers, Display, TEXT("Top %d shader types by jobs deduplicated by the job cache:"), MaxShadersToPrint);
+
+		int32 Idx = 0;
+		for (TMap<FString, FShaderDeduplication>::TConstIterator Iter(ShaderDeduplication); Iter; ++Iter)
+		{
+			const FShaderDeduplication& Deduplication = Iter.Value();
+
+			UE_LOG(LogShaderCompilers, Display, TEXT("%60s (submitted %5u, cached %5u, in flight duplicates %5u, %.2f%% not compiled)"), *Iter.Key(),
+				Deduplication.NumSubmitted, Deduplication.NumCached, Deduplication.NumInFlightDuplicates,
+				Deduplication.NumSubmitted > 0 ? 100.0 * double(Deduplication.NumCached + Deduplication.NumInFlightDuplicates) / double(Deduplication.NumSubmitted) : 0.0);
+			if (++Idx >= MaxShadersToPrint)
+			{
+				break;
+			}
+		}
+	}
+
 	if (ShaderTimings.Num())
 	{
 		// calculate effective parallelization (total time needed to compile all shaders divided by actual wall clock time spent processing at least 1 shader)
@@ -3293,6 +3351,29 @@ void FShaderCompilerStats::RegisterLocalWorkerIdleTime(double IdleTime)
 	TimesLocalWorkersWereIdle++;
 }
 
+void FShaderCompilerStats::RegisterJobCacheResult(const FShaderCommonCompileJob& Job, EJobCacheResult Result)
+{
+	const TCHAR* TypeName = TEXT("Unknown");
+	if (const FShaderCompileJob* SingleJob = Job.GetSingleShaderJob())
+	{
+		TypeName = SingleJob->Key.ShaderType ? SingleJob->Key.ShaderType->GetName() : TypeName;
+	}
+	else if (const FShaderPipelineCompileJob* PipelineJob = Job.GetShaderPipelineJob())
+	{
+		TypeName = PipelineJob->Key.ShaderPipeline ? PipelineJob->Key.ShaderPipeline->GetName() : TypeName;
+	}
+
+	FScopeLock Lock(&CompileStatsLock);
+	FShaderDeduplication& Deduplication = ShaderDeduplication.FindOrAdd(TypeName);
+	Deduplication.NumSubmitted++;
+	switch (Result)
+	{
+	case EJobCacheResult::Cached:				Deduplication.NumCached++; break;
+	case EJobCacheResult::InFlightDuplicate:	Deduplication.NumInFlightDuplicates++; break;
+	default: break;
+	}
+}
+
 void FShaderCompilerStats::RegisterNewPendingJob(FShaderCommonCompileJob& Job)
 {
 	// accessing job timestamps isn't arbitrated by any lock. It is assumed that the registration of a job at one of the stages
@@ -4135,6 +4216,10 @@ FProcHandle FShaderCompilingManager::LaunchWorker(const FString& WorkingDirector
 	{
 		WorkerParameters += FString::Printf(TEXT(" -TimeToLive=%f"), GRegularWorkerTimeToLive);
 	}
+	if (GShaderCompilerPersistentWorkers)
+	{
+		WorkerParameters += FString(TEXT(" -PersistentWorker"));
+	}
 	if (PLATFORM_LINUX) //-V560
 	{
 		// suppress log generation as much as possible
@@ -28,6 +28,14 @@ namespace DistributedShaderCompilerVariables
 		TEXT("Maximum number of seconds we expect to pass between getting distributed controller complete a task (this is used to detect problems with the distribution controllers).")
 	);
 
+	static int32 GDistributedResubmitHungTasks = 1;
+	static FAutoConsoleVariableRef CVarDistributedResubmitHungTasks(
+		TEXT("r.ShaderCompiler.DistributedResubmitHungTasks"),
+		GDistributedResubmitHungTasks,
+		TEXT("When the distributed controller is hung (see r.ShaderCompiler.DistributedControllerTimeout), give the jobs of its dispatched tasks back to the compile queue\n")
+		TEXT("so local workers compile them, and stop dispatching new jobs until it completes a task again."),
+		ECVF_Default);
+
 }
 
 bool FShaderCompileDistributedThreadRunnable_Interface::IsSupported()
@@ -167,7 +175,8 @@ TArray<FString> FShaderCompileDistributedThreadRunnable_Interface::GetDependency
 int32 FShaderCompileDistributedThreadRunnable_Interface::CompilingLoop()
 {
 	TArray<FShaderCommonCompileJobPtr> PendingJobs;
-	//if (LIKELY(!bIsHung))	// stop accepting jobs if we're hung - TODO: re-enable this after lockup detection logic is proved reliable and/or we have job resubmission in place
+	const bool bAcceptJobs = !bIsHung || !DistributedShaderCompilerVariables::GDistributedResubmitHungTasks;
+	if (LIKELY(bAcceptJobs))	// stop accepting jobs if we're hung, the local workers take them
 	{
 		for (int32 PriorityIndex = MaxPriorityIndex; PriorityIndex >= MinPriorityIndex; --PriorityIndex)
 		{
@@ -357,24 +366,28 @@ int32 FShaderCompileDistributedThreadRunnable_Interface::CompilingLoop()
 			Manager->AllJobs.SubmitJobs(Task->ShaderJobs);
 		}
 
-		// Delete input and output files, if they exist.
-		while (!IFileManager::Get().Delete(*Task->InputFilePath, false, true, true))
-		{
-			FPlatformProcess::Sleep(0.01f);
-		}
-
-		if (!bOutputFileReadFailed)
-		{
-			while (!IFileManager::Get().Delete(*Task->OutputFilePath, false, true, true))
-			{
-				FPlatformProcess::Sleep(0.01f);
-			}
-		}
+		DeleteTaskFiles(*Task, !bOutputFileReadFailed);
 
 		Iter.RemoveCurrent();
 		delete Task;
 	}
 
+	for (int32 Index = 0; Index < AbandonedTasks.Num(); Index++)
+	{
+		FDistributedShaderCompilerTask* Task = AbandonedTasks[Index];
+		if (Task->Future.IsReady())
+		{
+			// The controller is responsive again, the jobs were already compiled elsewhere
+			UE_CLOG(bIsHung, LogShaderCompilers, Display, TEXT("Distributed compilation controller completed a task again, resuming dispatch."));
+			bIsHung = false;
+			LastTimeTaskCompleted = FPlatformTime::Seconds();
+
+			DeleteTaskFiles(*Task, IFileManager::Get().FileExists(*Task->OutputFilePath));
+			AbandonedTasks.RemoveAtSwap(Index--);
+			delete Task;
+		}
+	}
+
 	// Yield for a short while to stop this thread continuously polling the disk.
 	FPlatformProcess::Sleep(0.01f);
 
@@ -386,10 +399,49 @@ int32 FShaderCompileDistributedThreadRunnable_Interface::CompilingLoop()
 		{
 			UE_LOG(LogShaderCompilers, Warning, TEXT("Distributed compilation controller didn't receive a completed task in %f seconds!"), TimeSinceLastCompletedTask);
 			bIsHung = true;
-			// TODO: resubmit the hung jobs
+
+			if (DistributedShaderCompilerVariables::GDistributedResubmitHungTasks)
+			{
+				ResubmitHungTasks();
+			}
 		}
 	}
 
 	// Return true if there is more work to be done.
 	return Manager->AllJobs.GetNumOutstandingJobs() > 0;
 }
+
+void FShaderCompileDistributedThreadRunnable_Interface::ResubmitHungTasks()
+{
+	int32 NumResubmittedJobs = 0;
+	for (FDistributedShaderCompilerTask* Task : DispatchedTasks)
+	{
+		NumDispatchedJobs -= Task->ShaderJobs.Num();
+		NumResubmittedJobs += Task->ShaderJobs.Num();
+
+		// Same as a canceled task, the jobs go back to the queue and the task only waits for its future to clean up its files
+		Manager->AllJobs.SubmitJobs(Task->ShaderJobs);
+		Task->ShaderJobs.Empty();
+		AbandonedTasks.Add(Task);
+	}
+	DispatchedTasks.Empty();
+
+	UE_LOG(LogShaderCompilers, Warning, TEXT("Resubmitted %d shader compile jobs of the hung distributed compilation controller to the compile queue."), NumResubmittedJobs);
+}
+
+void FShaderCompileDistributedThreadRunnable_Interface::DeleteTaskFiles(const FDistributedShaderCompilerTask& Task, bool bDeleteOutputFile)
+{
+	// Delete input and output files, if they exist.
+	while (!IFileManager::Get().Delete(*Task.InputFilePath, false, true, true))
+	{
+		FPlatformProcess::Sleep(0.01f);
+	}
+
+	if (bDeleteOutputFile)
+	{
+		while (!IFileManager::Get().Delete(*Task.OutputFilePath, false, true, true))
+		{
+			FPlatformProcess::Sleep(0.01f);
+		}
+	}
+}
@@ -29,10 +29,26 @@
 #include "Interfaces/ITargetPlatformManagerModule.h"
 #include "Interfaces/ITargetPlatform.h"
 #include "Async/ParallelFor.h"
+#include <atomic>
 
 CSV_DECLARE_CATEGORY_MODULE_EXTERN(CORE_API, Basic);
 
 CSV_DEFINE_CATEGORY(TextureStreaming, true);
+CSV_DEFINE_CATEGORY(StreamingPools, true);
+
+static std::atomic<int64> GStreamingGPUPoolSizes[(int32)EStreamingGPUPool::Num];
+
+void SetStreamingGPUPoolSize(EStreamingGPUPool Pool, int64 SizeInBytes)
+{
+	check(Pool < EStreamingGPUPool::Num);
+	GStreamingGPUPoolSizes[(int32)Pool].store(SizeInBytes, std::memory_order_relaxed);
+}
+
+int64 GetStreamingGPUPoolSize(EStreamingGPUPool Pool)
+{
+	check(Pool < EStreamingGPUPool::Num);
+	return GStreamingGPUPoolSizes[(int32)Pool].load(std::memory_order_relaxed);
+}
 
 #ifndef UE_STREAMINGRENDERASSETS_ARRAY_DEFAULT_RESERVED_SIZE
 // The default size will reserve ~4MB, the element size is ~208 bytes.
@@ -1475,9 +1491,21 @@ void FRenderAssetStreamingManager::CheckUserSettings()
 	if (CVarStreamingUseFixedPoolSize.GetValueOnGameThread() == 0)
 	{
 		const int32 PoolSizeSetting = CVarStreamingPoolSize.GetValueOnGameThread();
+		const int32 GPUMemoryBudget = CVarStreamingGPUMemoryBudget.GetValueOnGameThread();
 
 		int64 TexturePoolSize = GTexturePoolSize;
-		if (PoolSizeSetting == -1)
+		if (GPUMemoryBudget > 0)
+		{
+			// Textures and meshes compete for their pool by screen size already, they get whatever the other pools leave of the budget
+			int64 OtherPoolsSize = 0;
+			for (int32 PoolIndex = 0; PoolIndex < (int32)EStreamingGPUPool::Num; ++PoolIndex)
+			{
+				OtherPoolsSize += GetStreamingGPUPoolSize((EStreamingGPUPool)PoolIndex);
+			}
+			const int64 MinPoolSize = int64(FMath::Max(CVarStreamingGPUMemoryBudgetMinPoolSize.GetValueOnGameThread(), 0)) * 1024ll * 1024ll;
+			TexturePoolSize = FMath::Max(int64(GPUMemoryBudget) * 1024ll * 1024ll - OtherPoolsSize, MinPoolSize);
+		}
+		else if (PoolSizeSetting == -1)
 		{
 			FTextureMemoryStats Stats;
 			RHIGetTextureMemoryStats(Stats);
@@ -1642,6 +1670,11 @@ void FRenderAssetStreamingManager::UpdateResourceStreaming( float DeltaTime, boo
 	CSV_CUSTOM_STAT(TextureStreaming, ResidentMeshMem, ((float)DisplayedStats.ResidentMeshMem) / (1024.0f * 1024.0f), ECsvCustomStatOp::Set);
 	CSV_CUSTOM_STAT(TextureStreaming, StreamedMeshMem, ((float)DisplayedStats.StreamedMeshMem) / (1024.0f * 1024.0f), ECsvCustomStatOp::Set);
 
+	CSV_CUSTOM_STAT(StreamingPools, TexturesAndMeshes, ((float)GTexturePoolSize) / (1024.0f * 1024.0f), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(StreamingPools, Nanite, ((float)GetStreamingGPUPoolSize(EStreamingGPUPool::Nanite)) / (1024.0f * 1024.0f), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(StreamingPools, VirtualTexture, ((float)GetStreamingGPUPoolSize(EStreamingGPUPool::VirtualTexture)) / (1024.0f * 1024.0f), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(StreamingPools, Budget, (float)CVarStreamingGPUMemoryBudget.GetValueOnGameThread(), ECsvCustomStatOp::Set);
+
 	RenderAssetInstanceAsyncWork->EnsureCompletion();
 
 	if (NumRenderAssetProcessingStages <= 0 || bProcessEverything)
@@ -1738,9 +1771,30 @@ void FRenderAssetStreamingManager::UpdateResourceStreaming( float DeltaTime, boo
 		STAT(GatheredStats.StreamRenderAssetsCycles = -(int32)FPlatformTime::Cycles();)
 
 		// Since this step is lightweight, tick each texture inflight here, to accelerate the state changes.
-		for (int32 TextureIndex : InflightRenderAssets)
+#if !STATS
+		if (GAllowParallelUpdateStreamingRenderAssets)
 		{
-			StreamingRenderAssets[TextureIndex].UpdateStreamingStatus(DeltaTime > 0);
+			// The mip level change callbacks are not thread safe, they get deferred to TickDeferredMipLevelChangeCallbacks() below.
+			TArray<TArray<UStreamableRenderAsset*>> LocalDeferredTickCBAssets;
+			ParallelForWithTaskContext(TEXT("UpdateInflightRenderAssets"), LocalDeferredTickCBAssets, InflightRenderAssets.Num(), 64,
+				[this, &StreamingRenderAssets, DeltaTime](TArray<UStreamableRenderAsset*>& TaskDeferredTickCBAssets, int32 Index)
+			{
+				FOptionalTaskTagScope Scope(ETaskTag::EParallelGameThread);
+				StreamingRenderAssets[InflightRenderAssets[Index]].UpdateStreamingStatus(DeltaTime > 0, &TaskDeferredTickCBAssets);
+			});
+
+			for (const TArray<UStreamableRenderAsset*>& TaskDeferredTickCBAssets : LocalDeferredTickCBAssets)
+			{
+				DeferredTickCBAssets.Append(TaskDeferredTickCBAssets);
+			}
+		}
+		else
+#endif
+		{
+			for (int32 TextureIndex : InflightRenderAssets)
+			{
+				StreamingRenderAssets[TextureIndex].UpdateStreamingStatus(DeltaTime > 0);
+			}
 		}
 
 		TickFastResponseAssets();
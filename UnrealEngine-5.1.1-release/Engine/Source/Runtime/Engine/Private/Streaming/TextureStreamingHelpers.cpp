@@ -110,6 +110,19 @@ TAutoConsoleVariable<int32> CVarStreamingPoolSize(
 	TEXT("-1: Default texture pool size, otherwise the size in MB"),
 	ECVF_Scalability);
 
+TAutoConsoleVariable<int32> CVarStreamingGPUMemoryBudget(
+	TEXT("r.Streaming.GPUMemoryBudget"),
+	0,
+	TEXT("If > 0, GPU memory budget in MB shared by all streaming pools, overriding r.Streaming.PoolSize.\n")
+	TEXT("The Nanite streaming and virtual texture pools are taken out of it and textures and meshes get the rest."),
+	ECVF_Scalability);
+
+TAutoConsoleVariable<int32> CVarStreamingGPUMemoryBudgetMinPoolSize(
+	TEXT("r.Streaming.GPUMemoryBudget.MinPoolSize"),
+	100,
+	TEXT("Minimum size in MB of the texture and mesh streaming pool when r.Streaming.GPUMemoryBudget is used."),
+	ECVF_Scalability);
+
 static TAutoConsoleVariable<int32> CVarStreamingPoolSizeForMeshes(
 	TEXT("r.Streaming.PoolSizeForMeshes"),
 	-1,
@@ -55,6 +55,8 @@ extern TAutoConsoleVariable<float> CVarStreamingBoost;
 extern TAutoConsoleVariable<float> CVarStreamingMinBoost;
 extern TAutoConsoleVariable<int32> CVarStreamingUseFixedPoolSize;
 extern TAutoConsoleVariable<int32> CVarStreamingPoolSize;
+extern TAutoConsoleVariable<int32> CVarStreamingGPUMemoryBudget;
+extern TAutoConsoleVariable<int32> CVarStreamingGPUMemoryBudgetMinPoolSize;
 extern TAutoConsoleVariable<int32> CVarStreamingCheckBuildStatus;
 extern TAutoConsoleVariable<int32> CVarStreamingUseMaterialData;
 extern TAutoConsoleVariable<int32> CVarStreamingNumStaticComponentsProcessedPerFrame;
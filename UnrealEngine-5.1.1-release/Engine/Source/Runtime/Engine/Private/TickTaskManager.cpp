@@ -12,6 +12,7 @@
 #include "UObject/Class.h"
 #include "UObject/Package.h"
 #include "Containers/SortedMap.h"
+#include "Containers/IndirectArray.h"
 #include "Async/TaskGraphInterfaces.h"
 #include "Engine/EngineBaseTypes.h"
 #include "Engine/EngineTypes.h"
@@ -19,6 +20,7 @@
 #include "TickTaskManagerInterface.h"
 #include "Async/ParallelFor.h"
 #include "Misc/TimeGuard.h"
+#include "Misc/ScopeLock.h"
 #include "ProfilingDebugging/CsvProfiler.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogTick, Log, All);
@@ -30,7 +32,11 @@ DECLARE_CYCLE_STAT(TEXT("Post Queue Tick Task"),STAT_PostTickTask,STATGROUP_Game
 DECLARE_CYCLE_STAT(TEXT("Finalize Parallel Queue"),STAT_FinalizeParallelQueue,STATGROUP_Game);
 DECLARE_CYCLE_STAT(TEXT("Do Deferred Removes"),STAT_DoDeferredRemoves,STATGROUP_Game);
 DECLARE_CYCLE_STAT(TEXT("Schedule cooldowns"), STAT_ScheduleCooldowns,STATGROUP_Game);
+DECLARE_CYCLE_STAT(TEXT("Tick Function Task"), STAT_TickFunctionTask, STATGROUP_Game);
+DECLARE_CYCLE_STAT(TEXT("Batched Tick Task"), STAT_BatchedTickTask, STATGROUP_Game);
 DECLARE_DWORD_COUNTER_STAT(TEXT("Ticks Queued"),STAT_TicksQueued,STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ticks Batched"),STAT_TicksBatched,STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tick Batches"),STAT_TickBatches,STATGROUP_Game);
 DECLARE_CYCLE_STAT(TEXT("TG_NewlySpawned"), STAT_TG_NewlySpawned, STATGROUP_TickGroups);
 DECLARE_CYCLE_STAT(TEXT("ReleaseTickGroup"), STAT_ReleaseTickGroup, STATGROUP_TickGroups);
 DECLARE_CYCLE_STAT(TEXT("ReleaseTickGroup Block"), STAT_ReleaseTickGroup_Block, STATGROUP_TickGroups);
@@ -73,6 +79,24 @@ static TAutoConsoleVariable<int32> CVarAllowAsyncTickCleanup(
 	0,
 	TEXT("If true, ticks are cleaned up in a task thread."));
 
+static TAutoConsoleVariable<int32> CVarAllowBatchedTicks(
+	TEXT("tick.AllowBatchedTicks"),
+	0,
+	TEXT("If true, tick functions without prerequisites that share a batch key (their actor or component class), tick group and thread are executed one after the other by a single task."));
+
+static TAutoConsoleVariable<int32> CVarMaxTickBatchSize(
+	TEXT("tick.MaxTickBatchSize"),
+	128,
+	TEXT("Maximum number of tick functions executed by a single batched tick task, see tick.AllowBatchedTicks."));
+
+static TAutoConsoleVariable<int32> CVarCacheTickQueueOrder(
+	TEXT("tick.CacheQueueOrder"),
+	0,
+	TEXT("If true, each level caches the order of its enabled tick functions and their resolved prerequisites, and reuses them to queue ticks until tick functions or prerequisites change. Only used when ticks are not queued concurrently."));
+
+/** Incremented each time a tick function is added to or removed from a level, used to validate cached queue orders referencing tick functions of other levels */
+static uint32 GTickFunctionRegistrationSerial = 0;
+
 static float GTimeguardThresholdMS = 0.0f;
 static FAutoConsoleVariableRef CVarLightweightTimeguardThresholdMS(
 	TEXT("tick.LightweightTimeguardThresholdMS"), 
@@ -219,6 +243,15 @@ struct FTickContext
 
 
 
+/** Tick functions of the same batch key, tick group and thread that are executed by a single task **/
+struct FTickFunctionBatch
+{
+	/** Tick functions to execute, in queue order **/
+	TArray<FTickFunction*> TickFunctions;
+	/** Task executing the batch, the completion handle of every tick function in it **/
+	FBaseGraphTask* Task = nullptr;
+};
+
 /**
  * Class that handles the actual tick tasks and starting and completing tick groups
  */
@@ -233,16 +266,20 @@ class FTickFunctionTask
 	bool					bLogTick;
 	/** If true, log prereqs **/
 	bool					bLogTicksShowPrerequistes;
+	/** If not null, the batch of tick functions to execute instead of only Target **/
+	FTickFunctionBatch*		Batch;
 public:
 	/** Constructor
 		* @param InTarget - Function to tick
 		* @param InContext - context to tick in, here thread is desired execution thread
+		* @param InBatch - if not null, batch of tick functions, starting with InTarget, to tick one after the other
 	**/
-	FORCEINLINE FTickFunctionTask(FTickFunction* InTarget, const FTickContext* InContext, bool InbLogTick, bool bInLogTicksShowPrerequistes)
+	FORCEINLINE FTickFunctionTask(FTickFunction* InTarget, const FTickContext* InContext, bool InbLogTick, bool bInLogTicksShowPrerequistes, FTickFunctionBatch* InBatch = nullptr)
 		: Target(InTarget)
 		, Context(*InContext)
 		, bLogTick(InbLogTick)
 	, bLogTicksShowPrerequistes(bInLogTicksShowPrerequistes)
+	, Batch(InBatch)
 	{
 	}
 	static FORCEINLINE TStatId GetStatId()
@@ -265,26 +302,48 @@ public:
 		*	However, MyCompletionGraphEvent can be useful for passing to other routines or when it is handy to set up subsequents before you actually do work.
 		**/
 	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+	{
+		if (Batch)
+		{
+			SCOPE_CYCLE_COUNTER(STAT_BatchedTickTask);
+			TArray<FTickFunction*>& TickFunctions = Batch->TickFunctions;
+			for (int32 Index = 0; Index < TickFunctions.Num(); Index++)
+			{
+				if (Index + 1 < TickFunctions.Num())
+				{
+					FPlatformMisc::Prefetch(TickFunctions[Index + 1]);
+				}
+				ExecuteTickFunction(TickFunctions[Index], CurrentThread, MyCompletionGraphEvent);
+			}
+		}
+		else
+		{
+			SCOPE_CYCLE_COUNTER(STAT_TickFunctionTask);
+			ExecuteTickFunction(Target, CurrentThread, MyCompletionGraphEvent);
+		}
+	}
+private:
+	void ExecuteTickFunction(FTickFunction* TickFunction, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
 	{
 		if (bLogTick)
 		{
-			UE_LOG(LogTick, Log, TEXT("tick %s [%1d, %1d] %6llu %2d %s"), Target->bHighPriority ? TEXT("*") : TEXT(" "), (int32)Target->GetActualTickGroup(), (int32)Target->GetActualEndTickGroup(), (uint64)GFrameCounter, (int32)CurrentThread, *Target->DiagnosticMessage());
+			UE_LOG(LogTick, Log, TEXT("tick %s [%1d, %1d] %6llu %2d %s"), TickFunction->bHighPriority ? TEXT("*") : TEXT(" "), (int32)TickFunction->GetActualTickGroup(), (int32)TickFunction->GetActualEndTickGroup(), (uint64)GFrameCounter, (int32)CurrentThread, *TickFunction->DiagnosticMessage());
 			if (bLogTicksShowPrerequistes)
 			{
-				Target->ShowPrerequistes();
+				TickFunction->ShowPrerequistes();
 			}
 		}
-		if (Target->IsTickFunctionEnabled())
+		if (TickFunction->IsTickFunctionEnabled())
 		{
 #if DO_TIMEGUARD
-			FTimerNameDelegate NameFunction = FTimerNameDelegate::CreateLambda( [&]{ return FString::Printf(TEXT("Slowtick %s "), *Target->DiagnosticMessage()); } );
+			FTimerNameDelegate NameFunction = FTimerNameDelegate::CreateLambda( [&]{ return FString::Printf(TEXT("Slowtick %s "), *TickFunction->DiagnosticMessage()); } );
 			SCOPE_TIME_GUARD_DELEGATE_MS(NameFunction, 4);
 #endif
 			LIGHTWEIGHT_TIME_GUARD_BEGIN(FTickFunctionTask, GTimeguardThresholdMS);
-			Target->ExecuteTick(Target->CalculateDeltaTime(Context), Context.TickType, CurrentThread, MyCompletionGraphEvent);
-			LIGHTWEIGHT_TIME_GUARD_END(FTickFunctionTask, Target->DiagnosticMessage());
+			TickFunction->ExecuteTick(TickFunction->CalculateDeltaTime(Context), Context.TickType, CurrentThread, MyCompletionGraphEvent);
+			LIGHTWEIGHT_TIME_GUARD_END(FTickFunctionTask, TickFunction->DiagnosticMessage());
 		}
-		Target->InternalData->TaskPointer = nullptr;  // This is stale and a good time to clear it for safety
+		TickFunction->InternalData->TaskPointer = nullptr;  // This is stale and a good time to clear it for safety
 	}
 };
 
@@ -390,6 +449,37 @@ class FTickTaskSequencer
 	/** If true, log each tick **/
 	bool				bLogTicksShowPrerequistes;
 
+	/** If true, tick functions can be grouped into batches **/
+	bool				bAllowBatchedTicks;
+	/** Maximum number of tick functions in a batch **/
+	int32				MaxTickBatchSize;
+
+	/** Key of a batch within a tick group **/
+	struct FTickBatchKey
+	{
+		const UObject* BatchKey;
+		ENamedThreads::Type Thread;
+
+		bool operator==(const FTickBatchKey& Other) const
+		{
+			return BatchKey == Other.BatchKey && Thread == Other.Thread;
+		}
+		friend uint32 GetTypeHash(const FTickBatchKey& Key)
+		{
+			return HashCombine(GetTypeHash(Key.BatchKey), GetTypeHash((int32)Key.Thread));
+		}
+	};
+
+	/** Batches that still accept tick functions for each start tick group, they are closed when the tick group is released. */
+	TMap<FTickBatchKey, FTickFunctionBatch*> OpenTickBatches[TG_MAX];
+
+	/** Batches of the frame, reused from frame to frame to keep their arrays allocated. */
+	TIndirectArray<FTickFunctionBatch> TickBatchPool;
+	int32 NumTickBatchesUsed;
+
+	/** Protects the batches when ticks are queued in parallel. */
+	FCriticalSection TickBatchCritical;
+
 public:
 
 	/**
@@ -430,26 +520,89 @@ public:
 		checkSlow(TickFunction->InternalData->ActualStartTickGroup >=0 && TickFunction->InternalData->ActualStartTickGroup < TG_MAX);
 
 		FTickContext UseContext = TickContext;
+		UseContext.Thread = GetTickTaskThread(TickFunction);
 
+		TickFunction->InternalData->TaskPointer = TGraphTask<FTickFunctionTask>::CreateTask(Prerequisites, TickContext.Thread).ConstructAndHold(TickFunction, &UseContext, bLogTicks, bLogTicksShowPrerequistes);
+	}
+
+	/** Return the thread a tick function will be executed on **/
+	FORCEINLINE ENamedThreads::Type GetTickTaskThread(const FTickFunction* TickFunction) const
+	{
 		bool bIsOriginalTickGroup = (TickFunction->InternalData->ActualStartTickGroup == TickFunction->TickGroup);
 
 		if (TickFunction->bRunOnAnyThread && bAllowConcurrentTicks && bIsOriginalTickGroup)
 		{
 			if (TickFunction->bHighPriority)
 			{
-				UseContext.Thread = CPrio_HiPriAsyncTickTaskPriority.Get();
+				return CPrio_HiPriAsyncTickTaskPriority.Get();
 			}
 			else
 			{
-				UseContext.Thread = CPrio_NormalAsyncTickTaskPriority.Get();
+				return CPrio_NormalAsyncTickTaskPriority.Get();
 			}
 		}
-		else
+		return ENamedThreads::SetTaskPriority(ENamedThreads::GameThread, TickFunction->bHighPriority ? ENamedThreads::HighTaskPriority : ENamedThreads::NormalTaskPriority);
+	}
+
+	/**
+	 * Add a tick function to the open batch of its batch key, tick group and thread, starting a new batch task if there is none
+	 *
+	 * @param	InPrerequisites - prerequisites that must be completed before this tick can begin, only tick functions without any can be batched
+	 * @param	TickFunction - the tick function to queue
+	 * @param	Context - tick context to tick in. Thread here is the current thread.
+	 * @param	bParallel - true if ticks are being queued from several threads
+	 * @return	true if the tick function was queued in a batch, false if it needs its own task
+	 */
+	bool QueueBatchedTickTask(const FGraphEventArray* Prerequisites, FTickFunction* TickFunction, const FTickContext& TickContext, bool bParallel)
+	{
+		const ETickingGroup StartTickGroup = TickFunction->InternalData->ActualStartTickGroup;
+		if ((Prerequisites && Prerequisites->Num()) || StartTickGroup != TickFunction->TickGroup || StartTickGroup != TickFunction->InternalData->ActualEndTickGroup)
 		{
-			UseContext.Thread = ENamedThreads::SetTaskPriority(ENamedThreads::GameThread, TickFunction->bHighPriority ? ENamedThreads::HighTaskPriority : ENamedThreads::NormalTaskPriority);
+			return false;
 		}
 
-		TickFunction->InternalData->TaskPointer = TGraphTask<FTickFunctionTask>::CreateTask(Prerequisites, TickContext.Thread).ConstructAndHold(TickFunction, &UseContext, bLogTicks, bLogTicksShowPrerequistes);
+		const UObject* BatchKey = TickFunction->GetTickBatchKey();
+		if (!BatchKey)
+		{
+			return false;
+		}
+
+		FTickContext UseContext = TickContext;
+		UseContext.Thread = GetTickTaskThread(TickFunction);
+
+		FScopeLock Lock(&TickBatchCritical);
+		FTickFunctionBatch*& Batch = OpenTickBatches[StartTickGroup].FindOrAdd(FTickBatchKey{ BatchKey, UseContext.Thread });
+		if (Batch && Batch->TickFunctions.Num() < MaxTickBatchSize)
+		{
+			// the batch task is held until the tick group is released, so it is still safe to add to it
+			Batch->TickFunctions.Add(TickFunction);
+			TickFunction->InternalData->TaskPointer = Batch->Task;
+			INC_DWORD_STAT(STAT_TicksBatched);
+			return true;
+		}
+
+		if (NumTickBatchesUsed == TickBatchPool.Num())
+		{
+			TickBatchPool.Add(new FTickFunctionBatch);
+		}
+		Batch = &TickBatchPool[NumTickBatchesUsed++];
+		Batch->TickFunctions.Reset();
+		Batch->TickFunctions.Add(TickFunction);
+
+		TGraphTask<FTickFunctionTask>* Task = TGraphTask<FTickFunctionTask>::CreateTask(nullptr, TickContext.Thread).ConstructAndHold(TickFunction, &UseContext, bLogTicks, bLogTicksShowPrerequistes, Batch);
+		Batch->Task = Task;
+		TickFunction->InternalData->TaskPointer = Task;
+		if (bParallel)
+		{
+			AddTickTaskCompletionParallel(StartTickGroup, StartTickGroup, Task, TickFunction->bHighPriority);
+		}
+		else
+		{
+			AddTickTaskCompletion(StartTickGroup, StartTickGroup, Task, TickFunction->bHighPriority);
+		}
+		INC_DWORD_STAT(STAT_TickBatches);
+		INC_DWORD_STAT(STAT_TicksBatched);
+		return true;
 	}
 
 	/** Add a completion handle to a tick group **/
@@ -504,6 +657,10 @@ public:
 	{
 		checkSlow(TickFunction->InternalData);
 		checkSlow(TickContext.Thread == ENamedThreads::GameThread);
+		if (bAllowBatchedTicks && QueueBatchedTickTask(Prerequisites, TickFunction, TickContext, false))
+		{
+			return;
+		}
 		StartTickTask(Prerequisites, TickFunction, TickContext);
 		TGraphTask<FTickFunctionTask>* Task = (TGraphTask<FTickFunctionTask>*)TickFunction->InternalData->TaskPointer;
 		AddTickTaskCompletion(TickFunction->InternalData->ActualStartTickGroup, TickFunction->InternalData->ActualEndTickGroup, Task, TickFunction->bHighPriority);
@@ -520,6 +677,10 @@ public:
 	{
 		checkSlow(TickFunction->InternalData);
 		checkSlow(TickContext.Thread == ENamedThreads::GameThread);
+		if (bAllowBatchedTicks && QueueBatchedTickTask(Prerequisites, TickFunction, TickContext, true))
+		{
+			return;
+		}
 		StartTickTask(Prerequisites, TickFunction, TickContext);
 		TGraphTask<FTickFunctionTask>* Task = (TGraphTask<FTickFunctionTask>*)TickFunction->InternalData->TaskPointer;
 		AddTickTaskCompletionParallel(TickFunction->InternalData->ActualStartTickGroup, TickFunction->InternalData->ActualEndTickGroup, Task, TickFunction->bHighPriority);
@@ -538,6 +699,9 @@ public:
 		}
 		checkSlow(WorldTickGroup >= 0 && WorldTickGroup < TG_MAX);
 
+		// close the batches of this tick group, tick functions queued from now on (newly spawned ones) start new batches
+		OpenTickBatches[WorldTickGroup].Reset();
+
 		{
 			SCOPE_CYCLE_COUNTER(STAT_ReleaseTickGroup);
 			if (SingleThreadedMode() || CVarAllowAsyncTickDispatch.GetValueOnGameThread() == 0)
@@ -605,8 +769,14 @@ public:
 			bAllowConcurrentTicks = !!CVarAllowAsyncComponentTicks.GetValueOnGameThread();
 		}
 
+		bAllowBatchedTicks = !!CVarAllowBatchedTicks.GetValueOnGameThread();
+		MaxTickBatchSize = FMath::Max(CVarMaxTickBatchSize.GetValueOnGameThread(), 1);
+
 		WaitForCleanup();
 
+		// the batch tasks of the previous frame are all complete, their batches can be reused
+		NumTickBatchesUsed = 0;
+
 		for (int32 Index = 0; Index < TG_MAX; Index++)
 		{
 			check(!TickCompletionEvents[Index].Num());  // we should not be adding to these outside of a ticking proper and they were already cleared after they were ticked
@@ -617,6 +787,7 @@ public:
 				TickTasks[Index][IndexInner].Reset();
 				HiPriTickTasks[Index][IndexInner].Reset();
 			}
+			OpenTickBatches[Index].Reset();
 		}
 		WaitForTickGroup = (ETickingGroup)0;
 	}
@@ -636,6 +807,9 @@ private:
 		: bAllowConcurrentTicks(false)
 		, bLogTicks(false)
 		, bLogTicksShowPrerequistes(false)
+		, bAllowBatchedTicks(false)
+		, MaxTickBatchSize(1)
+		, NumTickBatchesUsed(0)
 	{
 		TFunction<void()> ShutdownCallback([this](){WaitForCleanup();});
 		FTaskGraphInterface::Get().AddShutdownCallback(ShutdownCallback);
@@ -711,6 +885,9 @@ public:
 	FTickTaskLevel()
 		: TickTaskSequencer(FTickTaskSequencer::Get())
 		, bTickNewlySpawned(false)
+		, CachedQueueOrderSerial(0)
+		, bCachedQueueOrderValid(false)
+		, bCachedQueueOrderUsesOtherLevels(false)
 	{
 	}
 	~FTickTaskLevel()
@@ -881,6 +1058,7 @@ public:
 				if (TickDetails.bDeferredRemove && TickDetails.TickFunction->TickState != FTickFunction::ETickState::Disabled)
 				{
 					verify(AllEnabledTickFunctions.Remove(TickDetails.TickFunction) == 1);
+					InvalidateCachedQueueOrder();
 				}
 			}
 		}
@@ -971,15 +1149,40 @@ public:
 	void QueueAllTicks()
 	{
 		FTickTaskSequencer& TTS = FTickTaskSequencer::Get();
-		for (TSet<FTickFunction*>::TIterator It(AllEnabledTickFunctions); It; ++It)
+		const bool bCacheQueueOrder = !!CVarCacheTickQueueOrder.GetValueOnGameThread();
+		if (bCacheQueueOrder && IsCachedQueueOrderValid())
 		{
-			FTickFunction* TickFunction = *It;
-			TickFunction->QueueTickFunction(TTS, Context);
+			for (const FCachedQueuedTick& CachedTick : CachedQueueOrder)
+			{
+				FTickFunction* TickFunction = CachedTick.TickFunction;
+				TickFunction->QueueTickFunctionCached(TTS, Context, MakeArrayView(CachedPrerequisites.GetData() + CachedTick.FirstPrerequisite, CachedTick.NumPrerequisites));
 
-			if (TickFunction->TickInterval > 0.f)
+				if (TickFunction->TickInterval > 0.f)
+				{
+					AllEnabledTickFunctions.Remove(TickFunction);
+					RescheduleForInterval(TickFunction, TickFunction->TickInterval);
+					InvalidateCachedQueueOrder();
+				}
+			}
+		}
+		else
+		{
+			for (TSet<FTickFunction*>::TIterator It(AllEnabledTickFunctions); It; ++It)
 			{
-				It.RemoveCurrent();
-				RescheduleForInterval(TickFunction, TickFunction->TickInterval);
+				FTickFunction* TickFunction = *It;
+				TickFunction->QueueTickFunction(TTS, Context);
+
+				if (TickFunction->TickInterval > 0.f)
+				{
+					It.RemoveCurrent();
+					RescheduleForInterval(TickFunction, TickFunction->TickInterval);
+					InvalidateCachedQueueOrder();
+				}
+			}
+
+			if (bCacheQueueOrder)
+			{
+				BuildCachedQueueOrder();
 			}
 		}
 		int32 EnabledCooldownTicks = 0;
@@ -1022,6 +1225,7 @@ public:
 				{
 					AllEnabledTickFunctions.Remove(TickFunction);
 					RescheduleForInterval(TickFunction, TickFunction->TickInterval);
+					InvalidateCachedQueueOrder();
 				}
 			}
 			NewlySpawnedTickFunctions.Empty();
@@ -1044,6 +1248,7 @@ public:
 			{
 				AllEnabledTickFunctions.Remove(TickFunction);
 				RescheduleForInterval(TickFunction, TickFunction->TickInterval);
+				InvalidateCachedQueueOrder();
 			}
 		}
 		NewlySpawnedTickFunctions.Empty();
@@ -1115,6 +1320,7 @@ public:
 				{
 					It.RemoveCurrent();
 					RescheduleForInterval(TickFunction, TickFunction->TickInterval);
+					InvalidateCachedQueueOrder();
 				}
 			}
 		}
@@ -1158,10 +1364,22 @@ public:
 		return AllEnabledTickFunctions.Contains(TickFunction) || AllDisabledTickFunctions.Contains(TickFunction) || AllCoolingDownTickFunctions.Contains(TickFunction);
 	}
 
+	/** Reserve room for a number of tick functions that are about to be added to the primary list **/
+	void ReserveTickFunctions(int32 NumTickFunctions)
+	{
+		AllEnabledTickFunctions.Reserve(AllEnabledTickFunctions.Num() + NumTickFunctions);
+		if (bTickNewlySpawned)
+		{
+			NewlySpawnedTickFunctions.Reserve(NewlySpawnedTickFunctions.Num() + NumTickFunctions);
+		}
+	}
+
 	/** Add the tick function to the primary list **/
 	void AddTickFunction(FTickFunction* TickFunction)
 	{
 		check(!HasTickFunction(TickFunction));
+		InvalidateCachedQueueOrder();
+		GTickFunctionRegistrationSerial++;
 		if (TickFunction->TickState == FTickFunction::ETickState::Enabled)
 		{
 			AllEnabledTickFunctions.Add(TickFunction);
@@ -1281,6 +1499,9 @@ public:
 	/** Remove the tick function from the primary list **/
 	void RemoveTickFunction(FTickFunction* TickFunction)
 	{
+		InvalidateCachedQueueOrder();
+		GTickFunctionRegistrationSerial++;
+
 		switch(TickFunction->TickState)
 		{
 		case FTickFunction::ETickState::Enabled:
@@ -1384,8 +1605,85 @@ public:
 		}
 	}
 
+	/** Discard the cached queue order, it is rebuilt the next time all ticks are queued **/
+	FORCEINLINE void InvalidateCachedQueueOrder()
+	{
+		bCachedQueueOrderValid = false;
+	}
+
 private:
 
+	/** Return true if the cached queue order still matches the enabled tick functions and their prerequisites **/
+	bool IsCachedQueueOrderValid() const
+	{
+		return bCachedQueueOrderValid && (!bCachedQueueOrderUsesOtherLevels || CachedQueueOrderSerial == GTickFunctionRegistrationSerial);
+	}
+
+	/** Rebuild the cached queue order from the enabled tick functions, prerequisites of this level are placed before their dependents **/
+	void BuildCachedQueueOrder()
+	{
+		CachedQueueOrder.Reset(AllEnabledTickFunctions.Num());
+		CachedPrerequisites.Reset();
+		bCachedQueueOrderUsesOtherLevels = false;
+
+		TSet<FTickFunction*> Visited;
+		Visited.Reserve(AllEnabledTickFunctions.Num());
+		for (FTickFunction* TickFunction : AllEnabledTickFunctions)
+		{
+			AddToCachedQueueOrder(TickFunction, Visited);
+		}
+
+		CachedQueueOrderSerial = GTickFunctionRegistrationSerial;
+		bCachedQueueOrderValid = true;
+	}
+
+	void AddToCachedQueueOrder(FTickFunction* TickFunction, TSet<FTickFunction*>& Visited)
+	{
+		bool bAlreadyVisited = false;
+		Visited.Add(TickFunction, &bAlreadyVisited);
+		if (bAlreadyVisited)
+		{
+			return;
+		}
+
+		for (FTickPrerequisite& Prerequisite : TickFunction->Prerequisites)
+		{
+			FTickFunction* Prereq = Prerequisite.Get();
+			if (Prereq && Prereq->IsTickFunctionRegistered() && Prereq->InternalData->TickTaskLevel == this && AllEnabledTickFunctions.Contains(Prereq))
+			{
+				AddToCachedQueueOrder(Prereq, Visited);
+			}
+		}
+
+		FCachedQueuedTick& CachedTick = CachedQueueOrder.AddDefaulted_GetRef();
+		CachedTick.TickFunction = TickFunction;
+		CachedTick.FirstPrerequisite = CachedPrerequisites.Num();
+		for (FTickPrerequisite& Prerequisite : TickFunction->Prerequisites)
+		{
+			if (FTickFunction* Prereq = Prerequisite.Get())
+			{
+				// a prerequisite that is not registered or lives in another level can change without this level knowing, validate against the registration serial
+				if (!Prereq->IsTickFunctionRegistered() || Prereq->InternalData->TickTaskLevel != this)
+				{
+					bCachedQueueOrderUsesOtherLevels = true;
+				}
+				if (Prereq->IsTickFunctionRegistered())
+				{
+					CachedPrerequisites.Add(Prereq);
+				}
+			}
+		}
+		CachedTick.NumPrerequisites = CachedPrerequisites.Num() - CachedTick.FirstPrerequisite;
+	}
+
+	/** An enabled tick function of the cached queue order and the range of its resolved prerequisites in CachedPrerequisites **/
+	struct FCachedQueuedTick
+	{
+		FTickFunction* TickFunction;
+		int32 FirstPrerequisite;
+		int32 NumPrerequisites;
+	};
+
 	struct FCoolingDownTickFunctionList
 	{
 		FCoolingDownTickFunctionList()
@@ -1426,6 +1724,16 @@ private:
 	FTickContext								Context;
 	/** true during the tick phase, when true, tick function adds also go to the newly spawned list. **/
 	bool										bTickNewlySpawned;
+	/** Enabled tick functions in the order they are queued when tick.CacheQueueOrder is enabled **/
+	TArray<FCachedQueuedTick>					CachedQueueOrder;
+	/** Resolved prerequisites of the cached tick functions **/
+	TArray<FTickFunction*>						CachedPrerequisites;
+	/** Value of GTickFunctionRegistrationSerial when the queue order was cached **/
+	uint32										CachedQueueOrderSerial;
+	/** true if the cached queue order can be used **/
+	bool										bCachedQueueOrderValid;
+	/** true if the cached queue order references tick functions that are not registered in this level **/
+	bool										bCachedQueueOrderUsesOtherLevels;
 };
 
 /** Helper struct to hold completion items from parallel task. They are moved into a separate place for cache coherency **/
@@ -1468,6 +1776,16 @@ public:
 		delete TickTaskLevel;
 	}
 
+	/** Reserve room for NumTickFunctions additional enabled tick functions in a level **/
+	virtual void ReserveTickFunctions(ULevel* InLevel, int32 NumTickFunctions) override
+	{
+		check(InLevel);
+		if (InLevel->TickTaskLevel && NumTickFunctions > 0)
+		{
+			InLevel->TickTaskLevel->ReserveTickFunctions(NumTickFunctions);
+		}
+	}
+
 	/**
 	 * Ticks the dynamic actors in the given levels based upon their tick group. This function
 	 * is called once for each ticking group
@@ -1930,12 +2248,19 @@ void FTickFunction::AddPrerequisite(UObject* TargetObject, struct FTickFunction&
 	if (bThisCanTick && bTargetCanTick)
 	{
 		Prerequisites.AddUnique(FTickPrerequisite(TargetObject, TargetTickFunction));
+		if (IsTickFunctionRegistered())
+		{
+			InternalData->TickTaskLevel->InvalidateCachedQueueOrder();
+		}
 	}
 }
 
 void FTickFunction::RemovePrerequisite(UObject* TargetObject, struct FTickFunction& TargetTickFunction)
 {
-	Prerequisites.RemoveSwap(FTickPrerequisite(TargetObject, TargetTickFunction));
+	if (Prerequisites.RemoveSwap(FTickPrerequisite(TargetObject, TargetTickFunction)) && IsTickFunctionRegistered())
+	{
+		InternalData->TickTaskLevel->InvalidateCachedQueueOrder();
+	}
 }
 
 void FTickFunction::SetPriorityIncludingPrerequisites(bool bInHighPriority)
@@ -2015,38 +2340,82 @@ void FTickFunction::QueueTickFunction(FTickTaskSequencer& TTS, const struct FTic
 				}
 			}
 
-			// tick group is the max of the prerequisites, the current tick group, and the desired tick group
-			ETickingGroup MyActualTickGroup =  FMath::Max<ETickingGroup>(MaxPrerequisiteTickGroup, FMath::Max<ETickingGroup>(TickGroup.GetValue(),TickContext.TickGroup));
-			if (MyActualTickGroup != TickGroup)
-			{
-				// if the tick was "demoted", make sure it ends up in an ordinary tick group.
-				while (!CanDemoteIntoTickGroup(MyActualTickGroup))
-				{
-					MyActualTickGroup = ETickingGroup(MyActualTickGroup + 1);
-				}
-			}
-			InternalData->ActualStartTickGroup = MyActualTickGroup;
-			InternalData->ActualEndTickGroup = MyActualTickGroup;
-			if (EndTickGroup > MyActualTickGroup)
+			QueueTickFunctionWithPrerequisites(TTS, TickContext, TaskPrerequisites, MaxPrerequisiteTickGroup);
+		}
+		InternalData->TickQueuedGFrameCounter = GFrameCounter;
+	}
+}
+
+void FTickFunction::QueueTickFunctionCached(FTickTaskSequencer& TTS, const struct FTickContext& TickContext, TArrayView<FTickFunction* const> CachedPrerequisites)
+{
+	checkSlow(TickContext.Thread == ENamedThreads::GameThread); // we assume same thread here
+	checkSlow(IsTickFunctionRegistered());
+
+	if (InternalData->TickVisitedGFrameCounter != GFrameCounter)
+	{
+		InternalData->TickVisitedGFrameCounter = GFrameCounter;
+		if (TickState != FTickFunction::ETickState::Disabled)
+		{
+			ETickingGroup MaxPrerequisiteTickGroup =  ETickingGroup(0);
+
+			FGraphEventArray TaskPrerequisites;
+			for (FTickFunction* Prereq : CachedPrerequisites)
 			{
-				check(EndTickGroup <= TG_NewlySpawned);
-				ETickingGroup TestTickGroup = ETickingGroup(MyActualTickGroup + 1);
-				while (TestTickGroup <= EndTickGroup)
+				if (Prereq->InternalData->TickQueuedGFrameCounter != GFrameCounter)
 				{
-					if (CanDemoteIntoTickGroup(TestTickGroup))
+					// prerequisites of other levels, or cooling down ones, are not queued yet
+					Prereq->QueueTickFunction(TTS, TickContext);
+					if (Prereq->InternalData->TickQueuedGFrameCounter != GFrameCounter)
 					{
-						InternalData->ActualEndTickGroup = TestTickGroup;
+						// this must be up the call stack, therefore this is a cycle
+						UE_LOG(LogTick, Warning, TEXT("While processing prerequisites for %s, could use %s because it would form a cycle."),*DiagnosticMessage(), *Prereq->DiagnosticMessage());
+						continue;
 					}
-					TestTickGroup = ETickingGroup(TestTickGroup + 1);
+				}
+				if (Prereq->InternalData->TaskPointer)
+				{
+					MaxPrerequisiteTickGroup =  FMath::Max<ETickingGroup>(MaxPrerequisiteTickGroup, Prereq->InternalData->ActualStartTickGroup.GetValue());
+					TaskPrerequisites.Add(Prereq->GetCompletionHandle());
 				}
 			}
 
-			if (TickState == FTickFunction::ETickState::Enabled)
+			QueueTickFunctionWithPrerequisites(TTS, TickContext, TaskPrerequisites, MaxPrerequisiteTickGroup);
+		}
+		InternalData->TickQueuedGFrameCounter = GFrameCounter;
+	}
+}
+
+void FTickFunction::QueueTickFunctionWithPrerequisites(FTickTaskSequencer& TTS, const struct FTickContext& TickContext, const FGraphEventArray& TaskPrerequisites, ETickingGroup MaxPrerequisiteTickGroup)
+{
+	// tick group is the max of the prerequisites, the current tick group, and the desired tick group
+	ETickingGroup MyActualTickGroup =  FMath::Max<ETickingGroup>(MaxPrerequisiteTickGroup, FMath::Max<ETickingGroup>(TickGroup.GetValue(),TickContext.TickGroup));
+	if (MyActualTickGroup != TickGroup)
+	{
+		// if the tick was "demoted", make sure it ends up in an ordinary tick group.
+		while (!CanDemoteIntoTickGroup(MyActualTickGroup))
+		{
+			MyActualTickGroup = ETickingGroup(MyActualTickGroup + 1);
+		}
+	}
+	InternalData->ActualStartTickGroup = MyActualTickGroup;
+	InternalData->ActualEndTickGroup = MyActualTickGroup;
+	if (EndTickGroup > MyActualTickGroup)
+	{
+		check(EndTickGroup <= TG_NewlySpawned);
+		ETickingGroup TestTickGroup = ETickingGroup(MyActualTickGroup + 1);
+		while (TestTickGroup <= EndTickGroup)
+		{
+			if (CanDemoteIntoTickGroup(TestTickGroup))
 			{
-				TTS.QueueTickTask(&TaskPrerequisites, this, TickContext);
+				InternalData->ActualEndTickGroup = TestTickGroup;
 			}
+			TestTickGroup = ETickingGroup(TestTickGroup + 1);
 		}
-		InternalData->TickQueuedGFrameCounter = GFrameCounter;
+	}
+
+	if (TickState == FTickFunction::ETickState::Enabled)
+	{
+		TTS.QueueTickTask(&TaskPrerequisites, this, TickContext);
 	}
 }
 
@@ -258,6 +258,209 @@ struct FTimerHeapOrder
 	int32 NumTimers;
 };
 
+static int32 GTimerManagerUseTimingWheel = 0;
+static FAutoConsoleVariableRef CVarTimerManagerUseTimingWheel(
+	TEXT("TimerManager.UseTimingWheel"),
+	GTimerManagerUseTimingWheel,
+	TEXT("If set, new timer managers keep their active timers in a hierarchical timing wheel instead of a binary heap, making adding and clearing timers constant time.\n")
+	TEXT("Can be changed per timer manager with FTimerManager::SetUseTimingWheel."),
+	ECVF_Default);
+
+static float GTimerManagerTimingWheelTickDuration = 0.01f;
+static FAutoConsoleVariableRef CVarTimerManagerTimingWheelTickDuration(
+	TEXT("TimerManager.TimingWheelTickDuration"),
+	GTimerManagerTimingWheelTickDuration,
+	TEXT("Duration in seconds covered by a slot of the timing wheel's first level. Read when a timing wheel is created."),
+	ECVF_Default);
+
+/**
+ * Hierarchical timing wheel used by FTimerManager for its active timers when TimerManager.UseTimingWheel is set.
+ * The first level has a slot per tick, each slot of a higher level covers a full turn of the level below and is
+ * cascaded down when the level below wraps around. Timers further away than the last level wait in an overflow list.
+ * Entries are never removed when a timer is cleared or paused, the timer manager skips the stale ones when they expire.
+ */
+class FTimingWheel
+{
+public:
+	struct FEntry
+	{
+		FTimerHandle Handle;
+		double ExpireTime;
+	};
+
+	FTimingWheel(double InTickDuration, double CurrentTime)
+		: InvTickDuration(1.0 / FMath::Max(InTickDuration, 0.0001))
+	{
+		CurrentTick = TimeToTick(CurrentTime);
+	}
+
+	void Add(FTimerHandle Handle, double ExpireTime)
+	{
+		AddEntry(FEntry{ Handle, ExpireTime });
+		++NumEntries;
+	}
+
+	/** Number of entries in the wheel, including stale ones */
+	int32 Num() const
+	{
+		return NumEntries;
+	}
+
+	/** Moves every entry with ExpireTime < Time to OutExpired */
+	void CollectExpired(double Time, TArray<FEntry>& OutExpired)
+	{
+		const int64 NowTick = TimeToTick(Time);
+
+		// All entries of the ticks before the current one have expired
+		while (CurrentTick < NowTick)
+		{
+			if (NumEntries == 0)
+			{
+				CurrentTick = NowTick;
+				break;
+			}
+
+			EnterCurrentTick();
+
+			TArray<FEntry>& Slot = Level0[CurrentTick & Level0Mask];
+			NumEntries -= Slot.Num();
+			OutExpired.Append(Slot);
+			Slot.Reset();
+			++CurrentTick;
+		}
+
+		// The current tick has only partially elapsed
+		if (NumEntries > 0)
+		{
+			EnterCurrentTick();
+
+			TArray<FEntry>& Slot = Level0[CurrentTick & Level0Mask];
+			for (int32 Index = Slot.Num() - 1; Index >= 0; --Index)
+			{
+				if (Slot[Index].ExpireTime < Time)
+				{
+					OutExpired.Add(Slot[Index]);
+					Slot.RemoveAtSwap(Index, 1, /*bAllowShrinking=*/ false);
+					--NumEntries;
+				}
+			}
+		}
+	}
+
+	template<typename FunctionType>
+	void ForEachEntry(FunctionType&& Function) const
+	{
+		auto VisitSlots = [&Function](const TArray<FEntry>* Slots, int32 NumSlots)
+		{
+			for (int32 SlotIndex = 0; SlotIndex < NumSlots; ++SlotIndex)
+			{
+				for (const FEntry& Entry : Slots[SlotIndex])
+				{
+					Function(Entry);
+				}
+			}
+		};
+
+		VisitSlots(Level0, Level0Size);
+		for (int32 Level = 0; Level < NumUpperLevels; ++Level)
+		{
+			VisitSlots(UpperLevels[Level], UpperLevelSize);
+		}
+		VisitSlots(&Overflow, 1);
+	}
+
+	/** Batch of expired entries the timer manager is going through in Tick */
+	TArray<FEntry> ExpiredBatch;
+	int32 ExpiredBatchIndex = 0;
+
+private:
+	static constexpr int32 Level0Bits = 8;
+	static constexpr int32 Level0Size = 1 << Level0Bits;
+	static constexpr int64 Level0Mask = Level0Size - 1;
+	static constexpr int32 UpperLevelBits = 6;
+	static constexpr int32 UpperLevelSize = 1 << UpperLevelBits;
+	static constexpr int64 UpperLevelMask = UpperLevelSize - 1;
+	static constexpr int32 NumUpperLevels = 3;
+
+	int64 TimeToTick(double Time) const
+	{
+		return (int64)FMath::FloorToDouble(Time * InvTickDuration);
+	}
+
+	void AddEntry(const FEntry& Entry)
+	{
+		// Entries that are already due go in the current slot
+		const int64 Tick = FMath::Max(TimeToTick(Entry.ExpireTime), CurrentTick);
+		const int64 Delta = Tick - CurrentTick;
+
+		if (Delta < Level0Size)
+		{
+			Level0[Tick & Level0Mask].Add(Entry);
+			return;
+		}
+
+		for (int32 Level = 0; Level < NumUpperLevels; ++Level)
+		{
+			const int32 SlotShift = Level0Bits + Level * UpperLevelBits;
+			if (Delta < (int64(1) << (SlotShift + UpperLevelBits)))
+			{
+				UpperLevels[Level][(Tick >> SlotShift) & UpperLevelMask].Add(Entry);
+				return;
+			}
+		}
+
+		Overflow.Add(Entry);
+	}
+
+	/** Cascades the upper levels down when the current tick starts a new turn of the first level */
+	void EnterCurrentTick()
+	{
+		if ((CurrentTick & Level0Mask) == 0 && CascadedTick != CurrentTick)
+		{
+			CascadedTick = CurrentTick;
+			Cascade(0);
+		}
+	}
+
+	void Cascade(int32 Level)
+	{
+		const int32 SlotShift = Level0Bits + Level * UpperLevelBits;
+		const int32 SlotIndex = (int32)((CurrentTick >> SlotShift) & UpperLevelMask);
+
+		// Higher levels are cascaded first so their entries can land in this level's slot
+		if (SlotIndex == 0)
+		{
+			if (Level + 1 < NumUpperLevels)
+			{
+				Cascade(Level + 1);
+			}
+			else
+			{
+				TArray<FEntry> OverflowEntries = MoveTemp(Overflow);
+				for (const FEntry& Entry : OverflowEntries)
+				{
+					AddEntry(Entry);
+				}
+			}
+		}
+
+		TArray<FEntry> Entries = MoveTemp(UpperLevels[Level][SlotIndex]);
+		for (const FEntry& Entry : Entries)
+		{
+			AddEntry(Entry);
+		}
+	}
+
+	double InvTickDuration;
+	int64 CurrentTick = 0;
+	int64 CascadedTick = -1;
+	int32 NumEntries = 0;
+
+	TArray<FEntry> Level0[Level0Size];
+	TArray<FEntry> UpperLevels[NumUpperLevels][UpperLevelSize];
+	TArray<FEntry> Overflow;
+};
+
 FTimerManager::FTimerManager(UGameInstance* GameInstance)
 	: InternalTime(0.0)
 	, LastTickedFrame(static_cast<uint64>(-1))
@@ -273,6 +476,11 @@ FTimerManager::FTimerManager(UGameInstance* GameInstance)
 	{
 		SetGameInstance(GameInstance);
 	}
+
+	if (GTimerManagerUseTimingWheel)
+	{
+		SetUseTimingWheel(true);
+	}
 }
 
 FTimerManager::~FTimerManager()
@@ -287,9 +495,12 @@ void FTimerManager::OnCrash()
 {
 	UE_LOG(LogEngine, Warning, TEXT("TimerManager %p on crashing delegate called, dumping extra information"), this);
 
-	UE_LOG(LogEngine, Log, TEXT("------- %d Active Timers (including expired) -------"), ActiveTimerHeap.Num());
+	TArray<FTimerHandle> ActiveTimerHandles;
+	GetActiveTimerHandles(ActiveTimerHandles);
+
+	UE_LOG(LogEngine, Log, TEXT("------- %d Active Timers (including expired) -------"), ActiveTimerHandles.Num());
 	int32 ExpiredActiveTimerCount = 0;
-	for (FTimerHandle Handle : ActiveTimerHeap)
+	for (FTimerHandle Handle : ActiveTimerHandles)
 	{
 		const FTimerData& Timer = GetTimer(Handle);
 		if (Timer.Status == ETimerStatus::ActivePendingRemoval)
@@ -317,7 +528,7 @@ void FTimerManager::OnCrash()
 		DescribeFTimerDataSafely(*GLog, Timer);
 	}
 
-	UE_LOG(LogEngine, Log, TEXT("------- %d Total Timers -------"), PendingTimerSet.Num() + PausedTimerSet.Num() + ActiveTimerHeap.Num() - ExpiredActiveTimerCount);
+	UE_LOG(LogEngine, Log, TEXT("------- %d Total Timers -------"), PendingTimerSet.Num() + PausedTimerSet.Num() + ActiveTimerHandles.Num() - ExpiredActiveTimerCount);
 
 	UE_LOG(LogEngine, Warning, TEXT("TimerManager %p dump ended"), this);
 }
@@ -501,7 +712,7 @@ void FTimerManager::InternalSetTimer(FTimerHandle& InOutHandle, FTimerUnifiedDel
 			NewTimerData.ExpireTime = InternalTime + FirstDelay;
 			NewTimerData.Status = ETimerStatus::Active;
 			NewTimerHandle = AddTimer(MoveTemp(NewTimerData));
-			ActiveTimerHeap.HeapPush(NewTimerHandle, FTimerHeapOrder(Timers));
+			AddActiveTimer(NewTimerHandle);
 		}
 		else
 		{
@@ -543,7 +754,7 @@ FTimerHandle FTimerManager::InternalSetTimerForNextTick(FTimerUnifiedDelegate&&
 	}
 
 	FTimerHandle NewTimerHandle = AddTimer(MoveTemp(NewTimerData));
-	ActiveTimerHeap.HeapPush(NewTimerHandle, FTimerHeapOrder(Timers));
+	AddActiveTimer(NewTimerHandle);
 
 	return NewTimerHandle;
 }
@@ -687,6 +898,8 @@ void FTimerManager::PauseTimer(FTimerHandle InHandle)
 			break;
 
 		case ETimerStatus::Active:
+			// Timing wheel entries go stale on their own once the timer is no longer active
+			if (!TimingWheel.IsValid())
 			{
 				int32 IndexIndex = ActiveTimerHeap.Find(InHandle);
 				check(IndexIndex != INDEX_NONE);
@@ -749,7 +962,7 @@ void FTimerManager::UnPauseTimer(FTimerHandle InHandle)
 		// Convert from time remaining back to a valid ExpireTime
 		TimerToUnPause->ExpireTime += InternalTime;
 		TimerToUnPause->Status = ETimerStatus::Active;
-		ActiveTimerHeap.HeapPush(InHandle, FTimerHeapOrder(Timers));
+		AddActiveTimer(InHandle);
 	}
 	else
 	{
@@ -791,7 +1004,7 @@ void FTimerManager::Tick(float DeltaTime)
 	// @todo, might need to handle long-running case
 	// (e.g. every X seconds, renormalize to InternalTime = 0)
 
-	INC_DWORD_STAT_BY(STAT_NumHeapEntries, ActiveTimerHeap.Num());
+	INC_DWORD_STAT_BY(STAT_NumHeapEntries, TimingWheel.IsValid() ? TimingWheel->Num() : ActiveTimerHeap.Num());
 
 	if (HasBeenTickedThisFrame())
 	{
@@ -826,18 +1039,22 @@ void FTimerManager::Tick(float DeltaTime)
 	// Dump timer info to logs if we have way too many timers active.
 	UE_SUPPRESS(LogEngine, Warning,
 	{
-		if (DumpAllTimerLogsThreshold > 0 && ActiveTimerHeap.Num() > DumpAllTimerLogsThreshold)
+		const int32 NumActiveTimerEntries = TimingWheel.IsValid() ? TimingWheel->Num() : ActiveTimerHeap.Num();
+		if (DumpAllTimerLogsThreshold > 0 && NumActiveTimerEntries > DumpAllTimerLogsThreshold)
 		{
 			static bool bAlreadyLogged = false;
 			if(!bAlreadyLogged)
 			{
 				bAlreadyLogged = true;
 			
-				UE_LOG(LogEngine, Warning, TEXT("Number of active Timers (%d) has exceeded DumpAllTimerLogsThreshold (%d)!  Dumping all timer info to log:"), ActiveTimerHeap.Num(), DumpAllTimerLogsThreshold);
+				UE_LOG(LogEngine, Warning, TEXT("Number of active Timers (%d) has exceeded DumpAllTimerLogsThreshold (%d)!  Dumping all timer info to log:"), NumActiveTimerEntries, DumpAllTimerLogsThreshold);
+
+				TArray<FTimerHandle> ActiveTimerHandles;
+				GetActiveTimerHandles(ActiveTimerHandles);
 
 				TArray<const FTimerData*> ValidActiveTimers;
-				ValidActiveTimers.Reserve(ActiveTimerHeap.Num());
-				for (FTimerHandle Handle : ActiveTimerHeap)
+				ValidActiveTimers.Reserve(ActiveTimerHandles.Num());
+				for (FTimerHandle Handle : ActiveTimerHandles)
 				{
 					if (const FTimerData* Data = FindTimer(Handle))
 					{
@@ -854,9 +1071,28 @@ void FTimerManager::Tick(float DeltaTime)
 	});
 #endif // #if UE_ENABLE_DUMPALLTIMERLOGSTHRESHOLD
 
-	while (ActiveTimerHeap.Num() > 0)
+	if (TimingWheel.IsValid())
 	{
-		FTimerHandle TopHandle = ActiveTimerHeap.HeapTop();
+		// Batch every timer expiring this frame, then fire them in expiry order as the heap would
+		check(TimingWheel->ExpiredBatchIndex == 0 && TimingWheel->ExpiredBatch.Num() == 0);
+		TimingWheel->CollectExpired(InternalTime, TimingWheel->ExpiredBatch);
+		TimingWheel->ExpiredBatch.Sort([](const FTimingWheel::FEntry& Lhs, const FTimingWheel::FEntry& Rhs) { return Lhs.ExpireTime < Rhs.ExpireTime; });
+	}
+
+	while (TimingWheel.IsValid() || ActiveTimerHeap.Num() > 0)
+	{
+		FTimerHandle TopHandle;
+		if (TimingWheel.IsValid())
+		{
+			if (!PopExpiredWheelTimer(TopHandle))
+			{
+				break;
+			}
+		}
+		else
+		{
+			TopHandle = ActiveTimerHeap.HeapTop();
+		}
 
 		// Test for expired timers
 		int32 TopIndex = TopHandle.GetIndex();
@@ -864,6 +1100,8 @@ void FTimerManager::Tick(float DeltaTime)
 
 		if (Top->Status == ETimerStatus::ActivePendingRemoval)
 		{
+			// PopExpiredWheelTimer already skips these
+			check(!TimingWheel.IsValid());
 			ActiveTimerHeap.HeapPop(TopHandle, FTimerHeapOrder(Timers), /*bAllowShrinking=*/ false);
 			RemoveTimer(TopHandle);
 			continue;
@@ -888,7 +1126,14 @@ void FTimerManager::Tick(float DeltaTime)
 			FScopedLevelCollectionContextSwitch LevelContext(LevelCollectionIndex, LevelCollectionWorld);
 
 			// Remove it from the heap and store it while we're executing
-			ActiveTimerHeap.HeapPop(CurrentlyExecutingTimer, FTimerHeapOrder(Timers), /*bAllowShrinking=*/ false);
+			if (TimingWheel.IsValid())
+			{
+				CurrentlyExecutingTimer = TopHandle;
+			}
+			else
+			{
+				ActiveTimerHeap.HeapPop(CurrentlyExecutingTimer, FTimerHeapOrder(Timers), /*bAllowShrinking=*/ false);
+			}
 			Top->Status = ETimerStatus::Executing;
 
 			// Determine how many times the timer may have elapsed (e.g. for large DeltaTime on a short looping timer)
@@ -960,7 +1205,7 @@ void FTimerManager::Tick(float DeltaTime)
 					// Put this timer back on the heap
 					Top->ExpireTime += CallCount * Top->Rate;
 					Top->Status = ETimerStatus::Active;
-					ActiveTimerHeap.HeapPush(CurrentlyExecutingTimer, FTimerHeapOrder(Timers));
+					AddActiveTimer(CurrentlyExecutingTimer);
 				}
 				else
 				{
@@ -995,7 +1240,7 @@ void FTimerManager::Tick(float DeltaTime)
 			// Convert from time remaining back to a valid ExpireTime
 			TimerToActivate.ExpireTime += InternalTime;
 			TimerToActivate.Status = ETimerStatus::Active;
-			ActiveTimerHeap.HeapPush( Handle, FTimerHeapOrder(Timers) );
+			AddActiveTimer(Handle);
 		}
 		PendingTimerSet.Reset();
 	}
@@ -1023,9 +1268,12 @@ void FTimerManager::ListTimers() const
 	// not currently threadsafe
 	check(IsInGameThread());
 
+	TArray<FTimerHandle> ActiveTimerHandles;
+	GetActiveTimerHandles(ActiveTimerHandles);
+
 	TArray<const FTimerData*> ValidActiveTimers;
-	ValidActiveTimers.Reserve(ActiveTimerHeap.Num());
-	for (FTimerHandle Handle : ActiveTimerHeap)
+	ValidActiveTimers.Reserve(ActiveTimerHandles.Num());
+	for (FTimerHandle Handle : ActiveTimerHandles)
 	{
 		if (const FTimerData* Data = FindTimer(Handle))
 		{
@@ -1057,6 +1305,115 @@ void FTimerManager::ListTimers() const
 	UE_LOG(LogEngine, Log, TEXT("------- %d Total Timers -------"), PendingTimerSet.Num() + PausedTimerSet.Num() + ValidActiveTimers.Num());
 }
 
+void FTimerManager::SetUseTimingWheel(bool bUseTimingWheel)
+{
+	// not currently threadsafe
+	check(IsInGameThread());
+
+	if (bUseTimingWheel == TimingWheel.IsValid())
+	{
+		return;
+	}
+
+	if (!ensureMsgf(!CurrentlyExecutingTimer.IsValid(), TEXT("FTimerManager::SetUseTimingWheel can't be called from a timer delegate")))
+	{
+		return;
+	}
+
+	if (bUseTimingWheel)
+	{
+		TimingWheel = MakeUnique<FTimingWheel>(GTimerManagerTimingWheelTickDuration, InternalTime);
+		for (FTimerHandle Handle : ActiveTimerHeap)
+		{
+			TimingWheel->Add(Handle, GetTimer(Handle).ExpireTime);
+		}
+		ActiveTimerHeap.Reset();
+	}
+	else
+	{
+		TArray<FTimerHandle> ActiveTimerHandles;
+		GetActiveTimerHandles(ActiveTimerHandles);
+		TimingWheel.Reset();
+
+		for (FTimerHandle Handle : ActiveTimerHandles)
+		{
+			ActiveTimerHeap.HeapPush(Handle, FTimerHeapOrder(Timers));
+		}
+	}
+}
+
+void FTimerManager::AddActiveTimer(FTimerHandle Handle)
+{
+	if (TimingWheel.IsValid())
+	{
+		TimingWheel->Add(Handle, GetTimer(Handle).ExpireTime);
+	}
+	else
+	{
+		ActiveTimerHeap.HeapPush(Handle, FTimerHeapOrder(Timers));
+	}
+}
+
+bool FTimerManager::PopExpiredWheelTimer(FTimerHandle& OutHandle)
+{
+	TArray<FTimingWheel::FEntry>& ExpiredBatch = TimingWheel->ExpiredBatch;
+	while (TimingWheel->ExpiredBatchIndex < ExpiredBatch.Num())
+	{
+		const FTimingWheel::FEntry& Entry = ExpiredBatch[TimingWheel->ExpiredBatchIndex++];
+
+		// Entries are stale if the timer was removed, or paused or fired since, in which case it was added again with a new expire time
+		FTimerData* Data = FindTimer(Entry.Handle);
+		if (!Data || Data->ExpireTime != Entry.ExpireTime)
+		{
+			continue;
+		}
+
+		if (Data->Status == ETimerStatus::ActivePendingRemoval)
+		{
+			RemoveTimer(Entry.Handle);
+			continue;
+		}
+
+		if (Data->Status == ETimerStatus::Active)
+		{
+			OutHandle = Entry.Handle;
+			return true;
+		}
+	}
+
+	ExpiredBatch.Reset();
+	TimingWheel->ExpiredBatchIndex = 0;
+	return false;
+}
+
+void FTimerManager::GetActiveTimerHandles(TArray<FTimerHandle>& OutHandles) const
+{
+	if (TimingWheel.IsValid())
+	{
+		TSet<FTimerHandle> UniqueHandles;
+		auto AddIfActive = [this, &UniqueHandles](const FTimingWheel::FEntry& Entry)
+		{
+			const FTimerData* Data = FindTimer(Entry.Handle);
+			if (Data && Data->ExpireTime == Entry.ExpireTime && (Data->Status == ETimerStatus::Active || Data->Status == ETimerStatus::ActivePendingRemoval))
+			{
+				UniqueHandles.Add(Entry.Handle);
+			}
+		};
+
+		TimingWheel->ForEachEntry(AddIfActive);
+		for (int32 Index = TimingWheel->ExpiredBatchIndex; Index < TimingWheel->ExpiredBatch.Num(); ++Index)
+		{
+			AddIfActive(TimingWheel->ExpiredBatch[Index]);
+		}
+
+		OutHandles = UniqueHandles.Array();
+	}
+	else
+	{
+		OutHandles = ActiveTimerHeap;
+	}
+}
+
 FTimerHandle FTimerManager::AddTimer(FTimerData&& TimerData)
 {
 	const void* TimerIndicesByObjectKey = TimerData.TimerDelegate.GetBoundObject();
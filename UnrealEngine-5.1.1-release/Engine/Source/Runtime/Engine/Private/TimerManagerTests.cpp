@@ -9,6 +9,7 @@
 #include "Engine/Engine.h"
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTimerManagerTest, "System.Engine.TimerManager", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTimerManagerTimingWheelTest, "System.Engine.TimerManager.TimingWheel", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
 
 #define TIMER_TEST_TEXT( Format, ... ) FString::Printf(TEXT("%s - %d: %s"), TEXT(__FILE__) , __LINE__ , *FString::Printf(TEXT(Format), ##__VA_ARGS__) )
 
@@ -266,6 +267,42 @@ bool TimerManagerTest_LoopingTimers_DifferentHandles(UWorld* World, FAutomationT
 	return true;
 }
 
+// Make sure that timers far enough in the future to be stored in the upper levels of the timing wheel, and timers paused or cleared before they expire, are handled correctly
+bool TimerManagerTest_TimingWheel_LongAndClearedTimers(UWorld* World, FAutomationTestBase* Test)
+{
+	FTimerManager& TimerManager = World->GetTimerManager();
+	FDummy Dummy;
+
+	FTimerHandle LongHandle;
+	TimerManager.SetTimer(LongHandle, FTimerDelegate::CreateRaw(&Dummy, &FDummy::Callback), 10.0f, false);
+	TimerTest_TickWorld(World, 9.5f);
+	Test->TestTrue(TIMER_TEST_TEXT("Long timer has not fired before it expired"), Dummy.Count == 0);
+	Test->TestTrue(TIMER_TEST_TEXT("Long timer is still active"), TimerManager.IsTimerActive(LongHandle));
+	TimerTest_TickWorld(World, 1.0f);
+	Test->TestTrue(TIMER_TEST_TEXT("Long timer fired once"), Dummy.Count == 1);
+	Test->TestFalse(TIMER_TEST_TEXT("Long timer no longer exists"), TimerManager.TimerExists(LongHandle));
+
+	Dummy.Reset();
+	FTimerHandle ClearedHandle;
+	TimerManager.SetTimer(ClearedHandle, FTimerDelegate::CreateRaw(&Dummy, &FDummy::Callback), 0.5f, false);
+	TimerTest_TickWorld(World, 0.2f);
+	TimerManager.ClearTimer(ClearedHandle);
+	TimerTest_TickWorld(World, 1.0f);
+	Test->TestTrue(TIMER_TEST_TEXT("Cleared timer did not fire"), Dummy.Count == 0);
+
+	FTimerHandle PausedHandle;
+	TimerManager.SetTimer(PausedHandle, FTimerDelegate::CreateRaw(&Dummy, &FDummy::Callback), 0.5f, false);
+	TimerTest_TickWorld(World, 0.2f);
+	TimerManager.PauseTimer(PausedHandle);
+	TimerTest_TickWorld(World, 1.0f);
+	Test->TestTrue(TIMER_TEST_TEXT("Paused timer did not fire"), Dummy.Count == 0);
+	TimerManager.UnPauseTimer(PausedHandle);
+	TimerTest_TickWorld(World, 0.5f);
+	Test->TestTrue(TIMER_TEST_TEXT("Unpaused timer fired once"), Dummy.Count == 1);
+
+	return true;
+}
+
 bool FTimerManagerTest::RunTest(const FString& Parameters)
 {
 	UWorld *World = UWorld::CreateWorld(EWorldType::Game, false);
@@ -289,3 +326,31 @@ bool FTimerManagerTest::RunTest(const FString& Parameters)
 }
 
 
+
+bool FTimerManagerTimingWheelTest::RunTest(const FString& Parameters)
+{
+	UWorld *World = UWorld::CreateWorld(EWorldType::Game, false);
+	FWorldContext &WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+	
+	FURL URL;
+	World->InitializeActorsForPlay(URL);
+	World->BeginPlay();
+
+	World->GetTimerManager().SetUseTimingWheel(true);
+	TestTrue(TIMER_TEST_TEXT("Timer manager uses a timing wheel"), World->GetTimerManager().IsUsingTimingWheel());
+
+	TimerManagerTest_InvalidTimers(World, this);
+	TimerManagerTest_MissingTimers(World, this);
+	TimerManagerTest_ValidTimer_HandleWithDelegate(World, this);
+	TimerManagerTest_ValidTimer_HandleLoopingSetDuringExecute(World, this);
+	TimerManagerTest_LoopingTimers_DifferentHandles(World, this);
+	TimerManagerTest_TimingWheel_LongAndClearedTimers(World, this);
+
+	World->GetTimerManager().SetUseTimingWheel(false);
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return true;
+}
@@ -1625,6 +1625,14 @@ static FAutoConsoleVariableRef CVarIncrementalGCTimePerFrame(
 	ECVF_Default
 );
 
+static float GIncrementalReachabilityTimePerFrame = 0.002f; // 2ms
+static FAutoConsoleVariableRef CVarIncrementalReachabilityTimePerFrame(
+	TEXT("gc.IncrementalReachabilityTimePerFrame"),
+	GIncrementalReachabilityTimePerFrame,
+	TEXT("How much time is allowed for incremental reachability analysis each frame in seconds (see gc.AllowIncrementalReachability)"),
+	ECVF_Default
+);
+
 void UEngine::SendWorldEndOfFrameUpdates()
 {
 	// Gather worlds that need EOF updates
@@ -1811,6 +1819,12 @@ void UEngine::ConditionalCollectGarbage()
 					{
 						bShouldDelayGarbageCollect = false;
 					}
+					// Resume time sliced reachability analysis, GC can't be started or purged until it has completed.
+					else if (IsIncrementalReachabilityAnalysisPending())
+					{
+						SCOPE_CYCLE_COUNTER(STAT_GCMarkTime);
+						PerformIncrementalReachabilityAnalysis(GIncrementalReachabilityTimePerFrame);
+					}
 					// Perform incremental purge update if it's pending or in progress.
 					else if (!IsIncrementalPurgePending()
 						// Purge reference to pending kill objects every now and so often.
@@ -2772,6 +2772,30 @@ private:
 // Cumulated time passed in UWorld::AddToWorld since last call to UWorld::UpdateLevelStreaming.
 static double GAddToWorldTimeCumul = 0.0;
 
+// Cumulated time doing IncrementalUnregisterComponents in UWorld::RemoveFromWorld since last call to UWorld::UpdateLevelStreaming.
+static double GRemoveFromWorldUnregisterComponentTimeCumul = 0.0;
+
+// Caps a time limit of AddToWorld or RemoveFromWorld to what remains of the budget they share
+static double ApplyLevelStreamingVisibilityTimeLimit(double TimeLimit)
+{
+	if (GLevelStreamingVisibilityTimeLimit > 0.0f)
+	{
+		return FMath::Min(TimeLimit, FMath::Max<double>(0.0, GLevelStreamingVisibilityTimeLimit - GAddToWorldTimeCumul - GRemoveFromWorldUnregisterComponentTimeCumul));
+	}
+	return TimeLimit;
+}
+
+#if CPUPROFILERTRACE_ENABLED
+// Adds a scope named after each level to AddToWorld and RemoveFromWorld, to measure the cost of the streaming
+// of each level (e.g. World Partition cells) across frames. Requires the cpu channel as well.
+UE_TRACE_CHANNEL_DEFINE(LevelStreamingChannel);
+#define LEVEL_STREAMING_TRACE_SCOPE(Level) \
+	const bool bTraceLevelStreaming = UE_TRACE_CHANNELEXPR_IS_ENABLED(LevelStreamingChannel); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_TEXT_CONDITIONAL(bTraceLevelStreaming ? *(Level)->GetOutermost()->GetName() : TEXT(""), bTraceLevelStreaming)
+#else
+#define LEVEL_STREAMING_TRACE_SCOPE(Level)
+#endif
+
 // Only called internally by UWorld::AddToWorld and UWorld::InitializeActorsForPlay
 static void ResetLevelFlagsOnLevelAddedToWorld(ULevel* Level)
 {
@@ -2826,6 +2850,7 @@ void UWorld::AddToWorld( ULevel* Level, const FTransform& LevelTransform, bool b
 	check(!Level->IsUnreachable());
 
 	FScopeCycleCounterUObject ContextScope(Level);
+	LEVEL_STREAMING_TRACE_SCOPE(Level);
 
 	// Set flags to indicate that we are associating a level with the world to e.g. perform slower/ better octree insertion 
 	// and such, as opposed to the fast path taken for run-time/ gameplay objects.
@@ -2890,6 +2915,7 @@ void UWorld::AddToWorld( ULevel* Level, const FTransform& LevelTransform, bool b
 
 		// Remove cumulated time since UpdateLevelStreaming
 		TimeLimit = FMath::Max<double>(0.0, TimeLimit - GAddToWorldTimeCumul);
+		TimeLimit = ApplyLevelStreamingVisibilityTimeLimit(TimeLimit);
 	}
 
 	if( bExecuteNextStep && !Level->bAlreadyMovedActors )
@@ -2993,6 +3019,12 @@ void UWorld::AddToWorld( ULevel* Level, const FTransform& LevelTransform, bool b
 		// Process remaining AddPrimitives
 		Context.Process();
 
+		// Create physics states still deferred by IncrementalUpdateComponents, they must not outlive this step.
+		if (FPhysScene* PhysScene = GetPhysicsScene())
+		{
+			PhysScene->ProcessDeferredCreatePhysicsState();
+		}
+
 		// We are done once all components are attached.
 		Level->bAlreadyUpdatedComponents	= Level->bAreComponentsCurrentlyRegistered;
 		bExecuteNextStep					= Level->bAreComponentsCurrentlyRegistered && (!bConsiderTimeLimit || !IsTimeLimitExceeded(TEXT("updating components"), StartTime, Level, TimeLimit));
@@ -3159,9 +3191,6 @@ void UWorld::BeginTearingDown()
 	FWorldDelegates::OnWorldBeginTearDown.Broadcast(this);
 }
 
-// Cumulated time doing IncrementalUnregisterComponents in UWorld::RemoveFromWorld since last call to UWorld::UpdateLevelStreaming.
-static double GRemoveFromWorldUnregisterComponentTimeCumul = 0.0;
-
 void UWorld::RemoveFromWorld( ULevel* Level, bool bAllowIncrementalRemoval, FNetLevelVisibilityTransactionId TransactionId)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(RemoveFromWorld);
@@ -3171,6 +3200,7 @@ void UWorld::RemoveFromWorld( ULevel* Level, bool bAllowIncrementalRemoval, FNet
 	FScopeCycleCounterUObject Context(Level);
 	check(IsValid(Level));
 	check(!Level->IsUnreachable());
+	LEVEL_STREAMING_TRACE_SCOPE(Level);
 
 	Level->bIsDisassociatingLevel = true;
 
@@ -3209,6 +3239,7 @@ void UWorld::RemoveFromWorld( ULevel* Level, bool bAllowIncrementalRemoval, FNet
 			if (CurrentLevelPendingInvisibility == Level)
 			{
 				double TimeLimit = FMath::Max<double>(0.0, GLevelStreamingUnregisterComponentsTimeLimit - GRemoveFromWorldUnregisterComponentTimeCumul);
+				TimeLimit = ApplyLevelStreamingVisibilityTimeLimit(TimeLimit);
 				if (TimeLimit > 0.0)
 				{
 					// Incrementally unregister actor components. 
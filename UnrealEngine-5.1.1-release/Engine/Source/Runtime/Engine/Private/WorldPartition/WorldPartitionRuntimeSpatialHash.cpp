@@ -1040,6 +1040,18 @@ void UWorldPartitionRuntimeSpatialHash::DumpStateLog(FHierarchicalLogArchive& Ar
 			}
 		}
 
+		if (!IsCellRelevantFor(StreamingGrid.bClientOnlyVisible))
+		{
+			int32 SkippedCellCount = 0;
+			int32 SkippedActorCount = 0;
+			for (const FGridLevelStats& LevelStats : LevelsStats)
+			{
+				SkippedCellCount += LevelStats.CellCount;
+				SkippedActorCount += LevelStats.ActorCount;
+			}
+			Ar.Printf(TEXT("Skipped by this server: %d cells, %d actors never loaded"), SkippedCellCount, SkippedActorCount);
+		}
+
 		{
 			Ar.Printf(TEXT(""));
 			int32 Level = 0;
@@ -25,6 +25,7 @@
 #include "DisplayDebugHelpers.h"
 #include "RenderUtils.h"
 #include "Algo/RemoveIf.h"
+#include "ProfilingDebugging/CsvProfiler.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(WorldPartitionStreamingPolicy)
 
@@ -53,6 +54,20 @@ static FAutoConsoleVariableRef CVarBlockOnSlowStreaming(
 	GBlockOnSlowStreaming,
 	TEXT("Set if streaming needs to block when to slow to catchup."));
 
+static float GPredictedStreamingSourcesLookAheadSeconds = 0.f;
+static FAutoConsoleVariableRef CVarPredictedStreamingSourcesLookAheadSeconds(
+	TEXT("wp.Runtime.PredictedStreamingSources.LookAheadSeconds"),
+	GPredictedStreamingSourcesLookAheadSeconds,
+	TEXT("When greater than 0, each moving local streaming source gets a predicted source extrapolated from its velocity this many seconds ahead, which loads (but does not activate) cells before they are needed."));
+
+static float GPredictedStreamingSourcesMinVelocity = 10.f;
+static FAutoConsoleVariableRef CVarPredictedStreamingSourcesMinVelocity(
+	TEXT("wp.Runtime.PredictedStreamingSources.MinVelocity"),
+	GPredictedStreamingSourcesMinVelocity,
+	TEXT("Minimum velocity (m/s) of a streaming source for a predicted streaming source to be added."));
+
+CSV_DEFINE_CATEGORY(WorldPartition, true);
+
 static void SortStreamingCellsByImportance(const TSet<const UWorldPartitionRuntimeCell*>& InCells, TArray<const UWorldPartitionRuntimeCell*>& OutSortedCells)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(SortStreamingCellsByImportance);
@@ -90,6 +105,7 @@ void UWorldPartitionStreamingPolicy::UpdateStreamingSources()
 	TRACE_CPUPROFILER_EVENT_SCOPE(UWorldPartitionStreamingPolicy::UpdateStreamingSources);
 
 	StreamingSources.Reset();
+	PredictedStreamingSources.Reset();
 
 	if (!WorldPartition->CanStream())
 	{
@@ -149,6 +165,34 @@ void UWorldPartitionStreamingPolicy::UpdateStreamingSources()
 		}
 	}
 
+	// Add predicted streaming sources, where fast sources will be once the cells they need have had time to load.
+	// They only load cells, at a lower priority than their source so cells needed now are processed first.
+	// They are kept apart from StreamingSources so they are not recorded in replays nor waited on by IsStreamingCompleted.
+	if (GPredictedStreamingSourcesLookAheadSeconds > 0.f)
+	{
+		for (const FWorldPartitionStreamingSource& StreamingSource : StreamingSources)
+		{
+			if (StreamingSource.Name.IsNone() || StreamingSource.bRemote || StreamingSource.bReplay || StreamingSource.Velocity < GPredictedStreamingSourcesMinVelocity)
+			{
+				continue;
+			}
+
+			const FVector Velocity = StreamingSourcesVelocity.FindChecked(StreamingSource.Name).GetAverageVelocityVector();
+			if (Velocity.IsNearlyZero())
+			{
+				continue;
+			}
+
+			FWorldPartitionStreamingSource PredictedSource = StreamingSource;
+			PredictedSource.Name = FName(*FString::Printf(TEXT("%s_Predicted"), *StreamingSource.Name.ToString()));
+			PredictedSource.Location += Velocity * GPredictedStreamingSourcesLookAheadSeconds;
+			PredictedSource.TargetState = EStreamingSourceTargetState::Loaded;
+			PredictedSource.bBlockOnSlowLoading = false;
+			PredictedSource.Priority = (EStreamingSourcePriority)FMath::Min<int32>((int32)StreamingSource.Priority + 1, (int32)EStreamingSourcePriority::Lowest);
+			PredictedStreamingSources.Add(MoveTemp(PredictedSource));
+		}
+	}
+
 	// Cleanup StreamingSourcesVelocity
 	for (auto It(StreamingSourcesVelocity.CreateIterator()); It; ++It)
 	{
@@ -231,7 +275,15 @@ void UWorldPartitionStreamingPolicy::UpdateStreamingState()
 		{
 			UWorldPartitionRuntimeCell::DirtyStreamingSourceCacheEpoch();
 
-			WorldPartition->RuntimeHash->ForEachStreamingCellsSources(StreamingSources, [this](const UWorldPartitionRuntimeCell* Cell, EStreamingSourceTargetState TargetState)
+			TArray<FWorldPartitionStreamingSource> StreamingSourcesWithPredicted;
+			if (PredictedStreamingSources.Num() > 0)
+			{
+				StreamingSourcesWithPredicted.Reserve(StreamingSources.Num() + PredictedStreamingSources.Num());
+				StreamingSourcesWithPredicted.Append(StreamingSources);
+				StreamingSourcesWithPredicted.Append(PredictedStreamingSources);
+			}
+
+			WorldPartition->RuntimeHash->ForEachStreamingCellsSources(PredictedStreamingSources.Num() > 0 ? StreamingSourcesWithPredicted : StreamingSources, [this](const UWorldPartitionRuntimeCell* Cell, EStreamingSourceTargetState TargetState)
 			{
 				switch (TargetState)
 				{
@@ -452,6 +504,15 @@ void UWorldPartitionStreamingPolicy::UpdateStreamingState()
 	// Do Activation State first as it is higher prio than Load State (if we have a limited number of loading cells per frame)
 	if (ToActivateCells.Num() > 0)
 	{
+		// Cells that need to be activated without having been loaded ahead of time
+		int32 NumLateCells = 0;
+		for (const UWorldPartitionRuntimeCell* Cell : ToActivateCells)
+		{
+			NumLateCells += LoadedCells.Contains(Cell) ? 0 : 1;
+		}
+		CSV_CUSTOM_STAT(WorldPartition, LateActivatedCells, NumLateCells, ECsvCustomStatOp::Set);
+		UE_CLOG(NumLateCells > 0 && World->bMatchStarted, LogWorldPartition, Verbose, TEXT("UWorldPartitionStreamingPolicy: %d cells to activate were not loaded ahead of time"), NumLateCells);
+
 		SetCellsStateToActivated(ToActivateCells);
 	}
 
@@ -859,6 +920,7 @@ FStreamingSourceVelocity::FStreamingSourceVelocity(const FName& InSourceName)
 , LastIndex(INDEX_NONE)
 , LastUpdateTime(-1.0)
 , VelocitiesHistorySum(0.f)
+, AverageVelocityVector(FVector::ZeroVector)
 {
 	VelocitiesHistory.SetNumZeroed(VELOCITY_HISTORY_SAMPLE_COUNT);
 }
@@ -886,9 +948,13 @@ float FStreamingSourceVelocity::GetAverageVelocity(const FVector& NewPosition, c
 	if (bIsFirstCall || (DeltaSeconds <= 0.f) || (DeltaSeconds > MaxDeltaSeconds) || (Distance > TeleportDistance))
 	{
 		UE_CLOG(Distance > TeleportDistance, LogWorldPartition, Log, TEXT("Detected Streaming Source Teleport: %s -> Last Position: %s -> New Position: %s"), *SourceName.ToString(), *LastPosition.ToString(), *NewPosition.ToString());
+		AverageVelocityVector = FVector::ZeroVector;
 		return 0.f;
 	}
 
+	// Exponential moving average over about as many samples as the velocities history (cm/s)
+	AverageVelocityVector += ((NewPosition - LastPosition) / DeltaSeconds - AverageVelocityVector) / (double)VELOCITY_HISTORY_SAMPLE_COUNT;
+
 	// Compute velocity (m/s)
 	check(Distance < MAX_flt);
 	const float Velocity = (float)Distance / DeltaSeconds;
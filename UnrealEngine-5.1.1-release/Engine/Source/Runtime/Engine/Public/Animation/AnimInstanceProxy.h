@@ -657,6 +657,9 @@ protected:
 	/** Evaluates the anim graph given the specified root if Evaluate() returns false */
 	void EvaluateAnimation_WithRoot(FPoseContext& Output, FAnimNode_Base* InRootNode);
 
+	/** Key of the quantized asset players of this frame for sharing the evaluated pose with matching instances, 0 if it cannot be shared */
+	uint64 GetCrowdPoseKey();
+
 	/** Evaluates the anim graph */
 	void EvaluateAnimationNode(FPoseContext& Output);
 
@@ -1141,4 +1144,7 @@ private:
 	uint8 bInitializeSubsystems : 1;
 
 	uint8 bUseMainInstanceMontageEvaluationData : 1;
+
+	// Copy of UAnimInstance::bShareCrowdPoses
+	uint8 bShareCrowdPoses : 1;
 };
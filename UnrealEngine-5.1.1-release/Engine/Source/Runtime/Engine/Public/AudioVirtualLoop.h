@@ -18,10 +18,18 @@ private:
 
 	FActiveSound* ActiveSound;
 
+	/** Whether the streamed chunks of the sound have already been requested ahead of its realization */
+	bool bIsPrimed;
+
 	/**
 	  * Check if provided active sound is in audible range.
 	  */
-	static bool IsInAudibleRange(const FActiveSound& InActiveSound, const FAudioDevice* InAudioDevice = nullptr);
+	static bool IsInAudibleRange(const FActiveSound& InActiveSound, const FAudioDevice* InAudioDevice = nullptr, float InRangeExtension = 0.0f);
+
+	/**
+	  * Requests the streamed chunks of the sound when the listener is about to enter its audible range, so they are loaded when it realizes.
+	  */
+	void PrimeIfApproachingAudibleRange();
 
 public:
 	FAudioVirtualLoop();
@@ -412,6 +412,21 @@ protected:
 	int32		NumWantingResourcesCounter;
 };
 
+/** GPU pools sized outside of the render asset streamer, that share r.Streaming.GPUMemoryBudget with it */
+enum class EStreamingGPUPool : uint8
+{
+	Nanite,
+	VirtualTexture,
+	Num
+};
+
+/**
+ * Reports the GPU memory currently held by a pool. When r.Streaming.GPUMemoryBudget is set, the texture and mesh streaming pool
+ * gets what remains of the budget once every reported pool is accounted for. Thread safe.
+ */
+ENGINE_API void SetStreamingGPUPoolSize(EStreamingGPUPool Pool, int64 SizeInBytes);
+ENGINE_API int64 GetStreamingGPUPoolSize(EStreamingGPUPool Pool);
+
 /**
  * Lightweight struct used to list the MIP levels of rendered assets.
  */
@@ -270,6 +270,12 @@ public:
 			return CalculateRequiredMemory(NumVertices, WithTangents, UseIntermediateTangents, IntermediateAccumulatedTangentsSize);
 		}
 
+		bool HasSameLayout(uint32 InNumVertices, bool InWithTangents, bool InUseIntermediateTangents, uint32 InIntermediateAccumulatedTangentsSize) const
+		{
+			return NumVertices == InNumVertices && WithTangents == InWithTangents && UseIntermediateTangents == InUseIntermediateTangents
+				&& IntermediateAccumulatedTangentsSize == InIntermediateAccumulatedTangentsSize;
+		}
+
 		FSkinCacheRWBuffer* GetTangentBuffer()
 		{
 			return WithTangents ? &Tangents : nullptr;
@@ -412,6 +418,15 @@ protected:
 	TSet<FGPUSkinCacheEntry*> PendingProcessRTGeometryEntries;
 	TArray<FDispatchEntry> BatchDispatches;
 
+	struct FPooledAllocation
+	{
+		FRWBuffersAllocation* Allocation;
+		uint32 ReleasedFrame;
+	};
+
+	// Allocations of released entries kept for r.SkinCache.PoolReleaseFrames, so meshes leaving view briefly get their buffers back. In release order.
+	TArray<FPooledAllocation> PooledAllocations;
+
 	FRWBuffersAllocation* TryAllocBuffer(uint32 NumVertices, bool WithTangnents, bool UseIntermediateTangents, uint32 NumTriangles, FRHICommandListImmediate& RHICmdList);
 	void DoDispatch(FRHICommandListImmediate& RHICmdList);
 	void DoDispatch(FRHICommandListImmediate& RHICmdList, FGPUSkinCacheEntry* SkinCacheEntry, int32 Section, int32 RevisionNumber);
@@ -433,11 +448,14 @@ protected:
 		);
 
 	void Cleanup();
+	void ReleasePooledAllocation(int32 PoolIndex);
+	void ReleaseUnusedPooledAllocations();
 	static void TransitionAllToReadable(FRHICommandList& RHICmdList, const TSet<FSkinCacheRWBuffer*>& BuffersToTransitionToRead);
 	static void ReleaseSkinCacheEntry(FGPUSkinCacheEntry* SkinCacheEntry);
 	static FGPUSkinBatchElementUserData* InternalGetFactoryUserData(FGPUSkinCacheEntry* Entry, int32 Section);
 	void InvalidateAllEntries();
 	uint64 UsedMemoryInBytes;
+	uint64 PooledMemoryInBytes = 0;
 	uint64 ExtraRequiredMemory;
 	int32 FlushCounter;
 	bool bRequiresMemoryLimit;
@@ -469,3 +487,6 @@ DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Num Triangles for Recompute Tangents"),
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Num Sections Processed"), STAT_GPUSkinCache_NumSectionsProcessed, STATGROUP_GPUSkinCache, );
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Num SetVertexStreams"), STAT_GPUSkinCache_NumSetVertexStreams, STATGROUP_GPUSkinCache, );
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Num PreGDME"), STAT_GPUSkinCache_NumPreGDME, STATGROUP_GPUSkinCache, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Pooled Memory Bytes"), STAT_GPUSkinCache_PooledMemUsed, STATGROUP_GPUSkinCache, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Num Pooled Allocations Reused"), STAT_GPUSkinCache_NumPooledReused, STATGROUP_GPUSkinCache, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Num Allocation Fallbacks"), STAT_GPUSkinCache_NumFallbacks, STATGROUP_GPUSkinCache, );
@@ -229,6 +229,8 @@ struct FMeshBatchElement
 	uint32 bIsInstanceRuns : 1;
 	uint32 bForceInstanceCulling : 1;
 	uint32 bPreserveInstanceOrder : 1;
+	/** If set, GPU instance culling only keeps the instances whose screen size is within [MinScreenSize, MaxScreenSize), each LOD of the mesh being drawn by its own element. */
+	uint32 bGPULODSelection : 1;
 
 #if UE_ENABLE_DEBUG_DRAWING
 	/** Conceptual element index used for debug viewmodes. */
@@ -284,6 +286,7 @@ struct FMeshBatchElement
 	,	bIsInstanceRuns(false)
 	,	bForceInstanceCulling(false)
 	,	bPreserveInstanceOrder(false)
+	,	bGPULODSelection(false)
 #if UE_ENABLE_DEBUG_DRAWING
 	,	VisualizeElementIndex(INDEX_NONE)
 #endif
@@ -248,6 +248,7 @@ struct FRepSerializationSharedInfo
 		if (bIsValid)
 		{
 			SharedPropertyInfo.Reset();
+			SharedPropertyIndices.Reset();
 			SerializedProperties->Reset();
 
 			bIsValid = false;
@@ -295,9 +296,24 @@ struct FRepSerializationSharedInfo
 		const bool bWriteHandle,
 		const bool bDoChecksum);
 
+	/**
+	 * Finds a property that was written with WriteSharedProperty.
+	 *
+	 * @param PropertyKey		The key the property was written with.
+	 * @return The SharedPropertyInfo of the property, or nullptr if it isn't in the shared data.
+	 */
+	const FRepSerializedPropertyInfo* FindSharedProperty(const FRepSharedPropertyKey& PropertyKey) const
+	{
+		const int32* Index = SharedPropertyIndices.Find(PropertyKey);
+		return Index ? &SharedPropertyInfo[*Index] : nullptr;
+	}
+
 	/** Metadata for properties in the shared data blob. */
 	TArray<FRepSerializedPropertyInfo> SharedPropertyInfo;
 
+	/** Index into SharedPropertyInfo of each property key. */
+	TMap<FRepSharedPropertyKey, int32> SharedPropertyIndices;
+
 	/** Binary blob of net serialized data to be shared */
 	TUniquePtr<FNetBitWriter> SerializedProperties;
 
@@ -1567,7 +1583,7 @@ private:
 		UClass* ObjectClass,
 		FNetBitWriter& Writer,
 		TArray<uint16>& Changed,
-		const FRepSerializationSharedInfo& SharedInfo,
+		FRepSerializationSharedInfo& SharedInfo,
 		const ESerializePropertyType SerializePropertyType) const;
 
 	/**
@@ -1626,7 +1642,7 @@ private:
 		FRepHandleIterator& HandleIterator,
 		const FConstRepObjectDataBuffer SourceData,
 		const int32	 ArrayDepth,
-		const FRepSerializationSharedInfo* const RESTRICT SharedInfo,
+		FRepSerializationSharedInfo* const RESTRICT SharedInfo,
 		const ESerializePropertyType SerializePropertyType) const;
 
 	void BuildSharedSerialization(
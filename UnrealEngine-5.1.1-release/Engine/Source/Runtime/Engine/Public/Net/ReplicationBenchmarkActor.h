@@ -0,0 +1,38 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+
+#include "ReplicationBenchmarkActor.generated.h"
+
+/**
+ * The AReplicationBenchmarkActor class is used by the Net.ReplicationBenchmark commands to generate a reproducible replication load.
+ * Each tick the server modifies a configurable share of its replicated properties.
+ */
+UCLASS(transient, notplaceable)
+class AReplicationBenchmarkActor : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AReplicationBenchmarkActor();
+
+	virtual void Tick(float DeltaSeconds) override;
+
+	/** Ratio, from 0 to 1, of the replicated properties modified each tick */
+	float ChurnRatio = 0.0f;
+
+	UPROPERTY(Replicated)
+	int32 IntValue = 0;
+
+	UPROPERTY(Replicated)
+	float FloatValue = 0.0f;
+
+	UPROPERTY(Replicated)
+	FVector VectorValue = FVector::ZeroVector;
+
+	UPROPERTY(Replicated)
+	TArray<int32> ArrayValue;
+};
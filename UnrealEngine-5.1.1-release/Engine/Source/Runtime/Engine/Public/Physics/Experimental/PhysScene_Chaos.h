@@ -229,6 +229,7 @@ public:
 	void DeferPhysicsStateCreation(UPrimitiveComponent* Component);
 	void RemoveDeferredPhysicsStateCreation(UPrimitiveComponent* Component);
 	void ProcessDeferredCreatePhysicsState();
+	int32 GetNumDeferredPhysicsStateCreations() const { return DeferredCreatePhysicsStateComponents.Num(); }
 
 
 	// Storage structure for replication data
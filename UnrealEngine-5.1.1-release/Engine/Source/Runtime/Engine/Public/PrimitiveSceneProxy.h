@@ -318,6 +318,19 @@ public:
 	 */
 	virtual void GetDynamicMeshElements(const TArray<const FSceneView*>& Views, const FSceneViewFamily& ViewFamily, uint32 VisibilityMap, class FMeshElementCollector& Collector) const {}
 
+	/**
+	 * Returns true if the mesh batches gathered by GetDynamicMeshElements only reference resources owned by the proxy, which stay valid and unchanged
+	 * until MarkDynamicMeshElementsDirty is called. The renderer may then reuse the mesh draw commands it built for them on previous frames,
+	 * for as long as the gathered mesh batches match.
+	 */
+	virtual bool CanCacheDynamicMeshDrawCommands() const { return false; }
+
+	/** Invalidates the mesh draw commands cached for the dynamic mesh elements of the proxy. Must be called on the rendering thread when anything they reference changes. */
+	ENGINE_API void MarkDynamicMeshElementsDirty();
+
+	/** Returns the revision of the dynamic mesh elements. Revisions are unique across proxies, so a new proxy allocated at the address of a deleted one never matches its cached commands. */
+	inline uint32 GetDynamicMeshElementsRevision() const { return DynamicMeshElementsRevision; }
+
 	virtual const class FCardRepresentationData* GetMeshCardRepresentation() const { return nullptr; }
 
 	/** 
@@ -1444,6 +1457,9 @@ private:
 	/** The primitive's uniform buffer. */
 	TUniformBufferRef<FPrimitiveUniformShaderParameters> UniformBuffer;
 
+	/** Revision of the dynamic mesh elements, see MarkDynamicMeshElementsDirty. */
+	uint32 DynamicMeshElementsRevision;
+
 	/** 
 	 * The UPrimitiveComponent this proxy is for, useful for quickly inspecting properties on the corresponding component while debugging.
 	 * This should not be dereferenced on the rendering thread.  The game thread can be modifying UObject members at any time.
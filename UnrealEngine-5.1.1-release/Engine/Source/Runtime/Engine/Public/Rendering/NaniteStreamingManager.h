@@ -175,6 +175,8 @@ public:
 	}
 
 	ENGINE_API void		PrefetchResource(const FResources* Resource, uint32 NumFramesUntilRender);
+	/** Request the first streaming pages of a resource predicted to be needed soon. Priority is in the same units as the GPU requests and is scaled by r.Nanite.Streaming.Prediction.PriorityScale. */
+	ENGINE_API void		PredictResource(uint32 RuntimeResourceID, float Priority);
 	ENGINE_API void		RequestNanitePages(TArrayView<uint32> RequestData);
 #if WITH_EDITOR
 	ENGINE_API uint64	GetRequestRecordBuffer(TArray<uint32>& OutRequestData);
@@ -206,6 +208,12 @@ private:
 		uint32 NumFramesUntilRender;
 	};
 
+	struct FResourcePrediction
+	{
+		uint32 RuntimeResourceID;
+		float Priority;
+	};
+
 	FHeapBuffer				ClusterPageData;	// FPackedCluster*, GeometryData { Index, Position, TexCoord, TangentX, TangentZ }*
 	FRDGScatterUploadBuffer ClusterFixupUploadBuffer;
 	FHeapBuffer				Hierarchy;
@@ -273,9 +281,11 @@ private:
 #endif
 	TArray<uint32>							PendingExplicitRequests;
 	TArray<FResourcePrefetch>				PendingResourcePrefetches;
+	TArray<FResourcePrediction>				PendingResourcePredictions;
 
 	void AddPendingExplicitRequests();
 	void AddPendingResourcePrefetchRequests();
+	void AddPendingResourcePredictionRequests();
 
 	void CollectDependencyPages( FResources* Resources, TSet< FPageKey >& DependencyPages, const FPageKey& Key );
 	void SelectStreamingPages( FResources* Resources, TArray< FPageKey >& SelectedPages, TSet<FPageKey>& SelectedPagesSet, uint32 RuntimeResourceID, uint32 PageIndex, uint32 MaxSelectedPages );
@@ -10,6 +10,7 @@
 #include "Net/ReplayResult.h"
 #include "ReplayTypes.h"
 #include "Containers/ArrayView.h"
+#include "Async/Future.h"
 
 class APlayerController;
 class UNetConnection;
@@ -165,6 +166,8 @@ private:
 	void CacheNetGuids(UNetConnection* Connection);
 
 	bool SerializeGuidCache(UNetConnection* Connection, const FRepActorsCheckpointParams& Params, FArchive* CheckpointArchive);
+	void SerializeGuidCacheAsync(FArchive& CheckpointArchive);
+	void WaitForAsyncCheckpointTasks();
 	bool SerializeDeletedStartupActors(UNetConnection* Connection, const FRepActorsCheckpointParams& Params, FArchive* CheckpointArchive);
 	bool SerializeDeltaDynamicDestroyed(UNetConnection* Connection, const FRepActorsCheckpointParams& Params, FArchive* CheckpointArchive);
 	bool SerializeDeltaClosedChannels(UNetConnection* Connection, const FRepActorsCheckpointParams& Params, FArchive* CheckpointArchive);
@@ -375,6 +378,10 @@ private:
 
 		TMap<FName, uint32> NameTableMap;
 
+		/** Background task serializing NetGuidCacheSnapshot into AsyncGuidCacheData, see demo.CheckpointAsyncGuidCache */
+		TFuture<void> AsyncGuidCacheTask;
+		TArray<uint8> AsyncGuidCacheData;
+
 		void CountBytes(FArchive& Ar) const;
 	};
 
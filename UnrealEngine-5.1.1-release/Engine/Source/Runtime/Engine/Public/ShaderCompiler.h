@@ -653,6 +653,9 @@ class FShaderCompileDistributedThreadRunnable_Interface : public FShaderCompileT
 
 	TSparseArray<class FDistributedShaderCompilerTask*> DispatchedTasks;
 
+	/** Tasks of a hung controller whose jobs were given back to the compile queue, their results are discarded when they eventually complete. */
+	TArray<class FDistributedShaderCompilerTask*> AbandonedTasks;
+
 	/** Last time we received a task back. */
 	double LastTimeTaskCompleted;
 
@@ -678,6 +681,8 @@ private:
 
 	TArray<FString> GetDependencyFilesForJobs(TArray<FShaderCommonCompileJobPtr>& Jobs);
 	void DispatchShaderCompileJobsBatch(TArray<FShaderCommonCompileJobPtr>& JobsToSerialize);
+	void ResubmitHungTasks();
+	void DeleteTaskFiles(const class FDistributedShaderCompilerTask& Task, bool bDeleteOutputFile);
 };
 
 /** Results for a single compiled and finalized shader map. */
@@ -725,6 +730,23 @@ public:
 		float AverageCompileTime = 0.0f;	// stored explicitly as an optimization
 	};
 
+	/** How the job cache handled the jobs submitted for a shader type */
+	struct FShaderDeduplication
+	{
+		uint32 NumSubmitted = 0;
+		/** Output found in the job cache, from memory or DDC */
+		uint32 NumCached = 0;
+		/** Waited on a job in flight with the same input hash */
+		uint32 NumInFlightDuplicates = 0;
+	};
+
+	enum class EJobCacheResult
+	{
+		NewJob,
+		Cached,
+		InFlightDuplicate,
+	};
+
 	ENGINE_API void RegisterCookedShaders(uint32 NumCooked, float CompileTime, EShaderPlatform Platform, const FString MaterialPath, FString PermutationString = FString(""));
 	ENGINE_API void RegisterCompiledShaders(uint32 NumPermutations, EShaderPlatform Platform, const FString MaterialPath, FString PermutationString = FString(""));
 	ENGINE_API const TSparseArray<ShaderCompilerStats>& GetShaderCompilerStats() { return CompileStats; }
@@ -759,6 +781,9 @@ public:
 	/** Informs statistics about a new job batch, so we can tally up batches. */
 	void RegisterJobBatch(int32 NumJobs, EExecutionType ExecType);
 
+	/** Tallies how the job cache handled a submitted job, per shader type. */
+	void RegisterJobCacheResult(const FShaderCommonCompileJob& Job, EJobCacheResult Result);
+
 private:
 	FCriticalSection CompileStatsLock;
 	TSparseArray<ShaderCompilerStats> CompileStats;
@@ -814,6 +839,9 @@ private:
 	/** Map of shader names to their compilation timings */
 	TMap<FString, FShaderTimings> ShaderTimings;
 
+	/** Job cache deduplication, per shader or shader pipeline type name. */
+	TMap<FString, FShaderDeduplication> ShaderDeduplication;
+
 	/** Total number of DDC misses on shader maps. */
 	uint32 ShaderMapDDCMisses = 0;
 
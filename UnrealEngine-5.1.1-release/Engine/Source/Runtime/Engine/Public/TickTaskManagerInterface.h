@@ -28,6 +28,9 @@ public:
 	/** Free a ticking structure for a ULevel **/
 	virtual void FreeTickTaskLevel(FTickTaskLevel* TickTaskLevel) = 0;
 
+	/** Reserve room for NumTickFunctions additional enabled tick functions in a level, so registering a batch of spawned actors doesn't grow the lists one by one **/
+	virtual void ReserveTickFunctions(ULevel* InLevel, int32 NumTickFunctions) = 0;
+
 	/**
 	 * Queue all of the ticks for a frame
 	 *
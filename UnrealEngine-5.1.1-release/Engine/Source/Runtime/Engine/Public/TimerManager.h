@@ -13,6 +13,7 @@
 
 class UGameInstance;
 struct FTimerSourceList;
+class FTimingWheel;
 
 DECLARE_DELEGATE(FTimerDelegate);
 
@@ -385,6 +386,16 @@ public:
 	/** Debug command to output info on all timers currently set to the log. */
 	void ListTimers() const;
 
+	/**
+	 * Switches active timers between the binary heap and a hierarchical timing wheel (see TimerManager.UseTimingWheel).
+	 * The timing wheel adds and cancels timers in constant time, which is cheaper when many timers are set and cleared every frame.
+	 * Timers keep firing in expiry order either way. Can't be called while timers are being executed.
+	 */
+	void SetUseTimingWheel(bool bUseTimingWheel);
+
+	/** Returns true if active timers are stored in a timing wheel instead of a heap */
+	bool IsUsingTimingWheel() const { return TimingWheel.IsValid(); }
+
 private:
 	void SetGameInstance(UGameInstance* InGameInstance);
 
@@ -424,10 +435,19 @@ private:
 	void RemoveTimer(FTimerHandle Handle);
 	bool WillRemoveTimerAssert(FTimerHandle Handle) const;
 
+	/** Adds an active timer to the heap or the timing wheel */
+	void AddActiveTimer(FTimerHandle Handle);
+	/** Takes the next timer of the timing wheel's expired batch that is still active, removing cleared timers on the way. Returns false once the batch is done. */
+	bool PopExpiredWheelTimer(FTimerHandle& OutHandle);
+	/** Gathers the handles of active timers, including the ones pending removal */
+	void GetActiveTimerHandles(TArray<FTimerHandle>& OutHandles) const;
+
 	/** The array of timers - all other arrays will index into this */
 	TSparseArray<FTimerData> Timers;
 	/** Heap of actively running timers. */
 	TArray<FTimerHandle> ActiveTimerHeap;
+	/** Actively running timers when using a timing wheel instead of the heap. */
+	TUniquePtr<FTimingWheel> TimingWheel;
 	/** Set of paused timers. */
 	TSet<FTimerHandle> PausedTimerSet;
 	/** Set of timers added this frame, to be added after timer has been ticked */
@@ -197,7 +197,8 @@ struct FSpatialHashRuntimeGrid
 	UPROPERTY(EditAnywhere, Category=Settings, meta = (IgnoreForMemberInitializationTest))
 	FLinearColor DebugColor;
 
-	UPROPERTY()
+	/** Cells of this grid are never loaded by dedicated servers (nor by listen servers without server streaming). Meant for grids of visual-only actors that play no part in the simulation. */
+	UPROPERTY(EditAnywhere, Category=Settings)
 	bool bClientOnlyVisible;
 
 	UPROPERTY()
@@ -26,6 +26,9 @@ struct FStreamingSourceVelocity
 	FStreamingSourceVelocity(const FName& InSourceName);
 	float GetAverageVelocity(const FVector& NewPosition, const float CurrentTime);
 
+	/** Average velocity (cm/s) as of the last call to GetAverageVelocity. */
+	const FVector& GetAverageVelocityVector() const { return AverageVelocityVector; }
+
 private:
 	enum { VELOCITY_HISTORY_SAMPLE_COUNT = 16 };
 	FName SourceName;
@@ -34,6 +37,7 @@ private:
 	FVector LastPosition;
 	float VelocitiesHistorySum;
 	TArray<float, TInlineAllocator<VELOCITY_HISTORY_SAMPLE_COUNT>> VelocitiesHistory;
+	FVector AverageVelocityVector;
 };
 
 UCLASS(Abstract, Within = WorldPartition)
@@ -87,6 +91,7 @@ protected:
 
 	// Streaming Sources
 	TArray<FWorldPartitionStreamingSource> StreamingSources;
+	TArray<FWorldPartitionStreamingSource> PredictedStreamingSources;
 	TMap<FName, FStreamingSourceVelocity> StreamingSourcesVelocity;
 
 	TSet<const UWorldPartitionRuntimeCell*> FrameActivateCells;
@@ -17,6 +17,9 @@ FAutoConsoleVariableRef FAABBTreeDirtyGridCVars::CVarDirtyElementMaxPhysicalSize
 int32 FAABBTreeDirtyGridCVars::DirtyElementMaxCellCapacity = 32;
 FAutoConsoleVariableRef FAABBTreeDirtyGridCVars::CVarDirtyElementMaxCellCapacity(TEXT("p.aabbtree.DirtyElementMaxCellCapacity"), FAABBTreeDirtyGridCVars::DirtyElementMaxCellCapacity, TEXT("The maximum number of dirty elements that can be added to a single grid cell before spilling to slower flat list"));
 
+int32 FAABBTreeDirtyGridCVars::DirtyElementOverflowToTree = 1;
+FAutoConsoleVariableRef FAABBTreeDirtyGridCVars::CVarDirtyElementOverflowToTree(TEXT("p.aabbtree.DirtyElementOverflowToTree"), FAABBTreeDirtyGridCVars::DirtyElementOverflowToTree, TEXT("When a static tree exceeds p.MaxDirtyElements, move its dirty elements to a dynamic tree until the next background rebuild instead of rebuilding the tree on the spot"));
+
 CSV_DEFINE_CATEGORY(ChaosPhysicsTimers, true);
 
 int32 FAABBTreeCVars::SplitAtAverageCenter = 1;
@@ -61,6 +61,10 @@ namespace Chaos
 	FAutoConsoleVariableRef CVarForceOneShotManifoldEdgeEdgeCaseZeroCullDistance(TEXT("p.Chaos.Collision.Manifold.ForceOneShotManifoldEdgeEdgeCaseZeroCullDistance"), ForceOneShotManifoldEdgeEdgeCaseZeroCullDistance,
 	TEXT("If enabled, if one shot manifold hits edge/edge case, we will force a cull distance of zero. That means edge/edge contacts will be thrown out if separated at all. Only applies to Convex/Convex oneshot impl."));
 
+	bool bChaos_Collision_Manifold_BoxBoxSAT = false;
+	FAutoConsoleVariableRef CVarChaos_Collision_Manifold_BoxBoxSAT(TEXT("p.Chaos.Collision.Manifold.BoxBoxSAT"), bChaos_Collision_Manifold_BoxBoxSAT,
+	TEXT("If enabled, box-box manifolds are built from a separating axis test rather than GJK followed by the general convex plane search. Cheaper for piles of boxes."));
+
 	bool bChaos_Collision_EnableManifoldGJKReplace = false;
 	bool bChaos_Collision_EnableManifoldGJKInject = false;
 	FAutoConsoleVariableRef CVarChaos_Collision_EnableManifoldReplace(TEXT("p.Chaos.Collision.EnableManifoldGJKReplace"), bChaos_Collision_EnableManifoldGJKReplace, TEXT(""));
@@ -172,6 +176,304 @@ namespace Chaos
 			return NewClipPointCount;
 		}
 
+		// A box centered on the center of the reference box, in the space of the reference box
+		struct FBoxBoxSATBox
+		{
+			FVec3 Center;
+			FVec3 Axes[3];
+			FVec3 HalfExtents;
+		};
+
+		inline FReal BoxBoxSATProjectedRadius(const FBoxBoxSATBox& Box, const FVec3& Axis)
+		{
+			return Box.HalfExtents.X * FMath::Abs(FVec3::DotProduct(Box.Axes[0], Axis))
+				+ Box.HalfExtents.Y * FMath::Abs(FVec3::DotProduct(Box.Axes[1], Axis))
+				+ Box.HalfExtents.Z * FMath::Abs(FVec3::DotProduct(Box.Axes[2], Axis));
+		}
+
+		// Clip the most opposing face of the incident box against the side planes of the reference face, which is the face of the
+		// reference box along RefAxis facing the incident box. Outputs the contacts as (u, v, Phi) in the plane of the reference face.
+		uint32 BoxBoxSATClipIncidentFace(const FVec3& RefHalfExtents, const FBoxBoxSATBox& IncidentBox, const int32 RefAxis, const FReal RefSign, const FReal CullDistance, FVec3* OutPoints)
+		{
+			const int32 RefAxisU = (RefAxis + 1) % 3;
+			const int32 RefAxisV = (RefAxis + 2) % 3;
+
+			int32 IncidentAxis = 0;
+			FReal IncidentAxisDot = FReal(-1);
+			for (int32 AxisIndex = 0; AxisIndex < 3; ++AxisIndex)
+			{
+				const FReal AxisDot = FMath::Abs(IncidentBox.Axes[AxisIndex][RefAxis]);
+				if (AxisDot > IncidentAxisDot)
+				{
+					IncidentAxis = AxisIndex;
+					IncidentAxisDot = AxisDot;
+				}
+			}
+
+			// The incident face normal points back at the reference face
+			const FReal IncidentSign = (IncidentBox.Axes[IncidentAxis][RefAxis] * RefSign > 0) ? FReal(-1) : FReal(1);
+			const FVec3 IncidentFaceCenter = IncidentBox.Center + (IncidentSign * IncidentBox.HalfExtents[IncidentAxis]) * IncidentBox.Axes[IncidentAxis];
+			const FVec3 IncidentU = IncidentBox.HalfExtents[(IncidentAxis + 1) % 3] * IncidentBox.Axes[(IncidentAxis + 1) % 3];
+			const FVec3 IncidentV = IncidentBox.HalfExtents[(IncidentAxis + 2) % 3] * IncidentBox.Axes[(IncidentAxis + 2) % 3];
+
+			// Double buffered Sutherland-Hodgman, BoxBoxClipVerticesAgainstPlane outputs at most 8 points
+			FVec3 ClipBuffers[2][8];
+			ClipBuffers[0][0] = IncidentFaceCenter + IncidentU + IncidentV;
+			ClipBuffers[0][1] = IncidentFaceCenter - IncidentU + IncidentV;
+			ClipBuffers[0][2] = IncidentFaceCenter - IncidentU - IncidentV;
+			ClipBuffers[0][3] = IncidentFaceCenter + IncidentU - IncidentV;
+			uint32 ClipPointCount = 4;
+			int32 ClipBufferIndex = 0;
+
+			const int32 ClipAxes[4] = { RefAxisU, RefAxisU, RefAxisV, RefAxisV };
+			const FReal ClipDistances[4] = { RefHalfExtents[RefAxisU], -RefHalfExtents[RefAxisU], RefHalfExtents[RefAxisV], -RefHalfExtents[RefAxisV] };
+			for (int32 ClipPlaneIndex = 0; (ClipPlaneIndex < 4) && (ClipPointCount > 0); ++ClipPlaneIndex)
+			{
+				ClipPointCount = BoxBoxClipVerticesAgainstPlane(ClipBuffers[ClipBufferIndex], ClipBuffers[1 - ClipBufferIndex], ClipPointCount, ClipAxes[ClipPlaneIndex], ClipDistances[ClipPlaneIndex]);
+				ClipBufferIndex = 1 - ClipBufferIndex;
+			}
+
+			uint32 PointCount = 0;
+			for (uint32 ClipPointIndex = 0; ClipPointIndex < ClipPointCount; ++ClipPointIndex)
+			{
+				const FVec3& ClipPoint = ClipBuffers[ClipBufferIndex][ClipPointIndex];
+				const FReal Phi = RefSign * ClipPoint[RefAxis] - RefHalfExtents[RefAxis];
+				if (Phi <= CullDistance)
+				{
+					OutPoints[PointCount++] = FVec3(ClipPoint[RefAxisU], ClipPoint[RefAxisV], Phi);
+				}
+			}
+			return PointCount;
+		}
+
+		void ConstructBoxBoxSATOneShotManifold(
+			const FImplicitBox3& Box1,
+			const FRigidTransform3& Box1Transform, //world
+			const FImplicitBox3& Box2,
+			const FRigidTransform3& Box2Transform, //world
+			FPBDCollisionConstraint& Constraint)
+		{
+			SCOPE_CYCLE_COUNTER_MANIFOLD();
+
+			ensure(Box1Transform.GetScale3D() == FVec3(1.0f, 1.0f, 1.0f));
+			ensure(Box2Transform.GetScale3D() == FVec3(1.0f, 1.0f, 1.0f));
+
+			Constraint.ResetActiveManifoldContacts();
+
+			const FReal CullDistance = Constraint.GetCullDistance();
+			const FRigidTransform3 Box2ToBox1Transform = Box2Transform.GetRelativeTransformNoScale(Box1Transform);
+			const FVec3 Center1 = Box1.GetCenter();
+			const FVec3 Center2 = Box2.GetCenter();
+
+			// Everything is in the space of box 1, relative to its center
+			FBoxBoxSATBox SATBox1;
+			FBoxBoxSATBox SATBox2;
+			SATBox1.Center = FVec3(0);
+			SATBox1.HalfExtents = FReal(0.5) * Box1.Extents();
+			SATBox2.Center = Box2ToBox1Transform.TransformPositionNoScale(Center2) - Center1;
+			SATBox2.HalfExtents = FReal(0.5) * Box2.Extents();
+			for (int32 AxisIndex = 0; AxisIndex < 3; ++AxisIndex)
+			{
+				FVec3 Axis(0);
+				Axis[AxisIndex] = FReal(1);
+				SATBox1.Axes[AxisIndex] = Axis;
+				SATBox2.Axes[AxisIndex] = Box2ToBox1Transform.TransformVectorNoScale(Axis);
+			}
+
+			// Separation along an axis, any separation beyond the cull distance means there are no contacts
+			auto AxisSeparation = [&SATBox1, &SATBox2](const FVec3& Axis) -> FReal
+			{
+				return FMath::Abs(FVec3::DotProduct(SATBox2.Center, Axis)) - BoxBoxSATProjectedRadius(SATBox1, Axis) - BoxBoxSATProjectedRadius(SATBox2, Axis);
+			};
+
+			FReal FaceSeparation1 = -TNumericLimits<FReal>::Max();
+			int32 FaceAxis1 = INDEX_NONE;
+			FReal FaceSeparation2 = -TNumericLimits<FReal>::Max();
+			int32 FaceAxis2 = INDEX_NONE;
+			for (int32 AxisIndex = 0; AxisIndex < 3; ++AxisIndex)
+			{
+				const FReal Separation1 = AxisSeparation(SATBox1.Axes[AxisIndex]);
+				const FReal Separation2 = AxisSeparation(SATBox2.Axes[AxisIndex]);
+				if ((Separation1 > CullDistance) || (Separation2 > CullDistance))
+				{
+					return;
+				}
+				if (Separation1 > FaceSeparation1)
+				{
+					FaceSeparation1 = Separation1;
+					FaceAxis1 = AxisIndex;
+				}
+				if (Separation2 > FaceSeparation2)
+				{
+					FaceSeparation2 = Separation2;
+					FaceAxis2 = AxisIndex;
+				}
+			}
+
+			FReal EdgeSeparation = -TNumericLimits<FReal>::Max();
+			int32 EdgeAxis1 = INDEX_NONE;
+			int32 EdgeAxis2 = INDEX_NONE;
+			FVec3 EdgeNormal = FVec3(0);
+			for (int32 AxisIndex1 = 0; AxisIndex1 < 3; ++AxisIndex1)
+			{
+				for (int32 AxisIndex2 = 0; AxisIndex2 < 3; ++AxisIndex2)
+				{
+					// Parallel edges are covered by the face axes
+					FVec3 Axis = FVec3::CrossProduct(SATBox1.Axes[AxisIndex1], SATBox2.Axes[AxisIndex2]);
+					const FReal AxisLenSq = Axis.SizeSquared();
+					if (AxisLenSq < UE_KINDA_SMALL_NUMBER)
+					{
+						continue;
+					}
+					Axis *= FMath::InvSqrt(AxisLenSq);
+
+					const FReal Separation = AxisSeparation(Axis);
+					if (Separation > CullDistance)
+					{
+						return;
+					}
+					if (Separation > EdgeSeparation)
+					{
+						EdgeSeparation = Separation;
+						EdgeAxis1 = AxisIndex1;
+						EdgeAxis2 = AxisIndex2;
+						EdgeNormal = Axis;
+					}
+				}
+			}
+
+			PHYSICS_CSV_CUSTOM_EXPENSIVE(PhysicsCounters, NumManifoldsCreated, 1, ECsvCustomStatOp::Accumulate);
+
+			// Favour face contacts, and box 1 as the reference, to keep the features coherent from frame to frame
+			const FReal SmallBiasToPreventFeatureFlipping = 0.002f;
+			const FReal EdgeContactBias = 0.05f;
+			const bool bReferenceFace1 = (FaceSeparation2 <= FaceSeparation1 + SmallBiasToPreventFeatureFlipping);
+			const FReal FaceSeparation = bReferenceFace1 ? FaceSeparation1 : FaceSeparation2;
+
+			if ((EdgeAxis1 != INDEX_NONE) && (EdgeSeparation > FaceSeparation + EdgeContactBias))
+			{
+				// Normal from box 2 to box 1
+				if (FVec3::DotProduct(SATBox2.Center, EdgeNormal) > 0)
+				{
+					EdgeNormal = -EdgeNormal;
+				}
+
+				// The edge of each box furthest along the normal towards the other box
+				FVec3 EdgePos1 = FVec3(0);
+				FVec3 EdgePos2 = SATBox2.Center;
+				for (int32 AxisIndex = 0; AxisIndex < 3; ++AxisIndex)
+				{
+					if (AxisIndex != EdgeAxis1)
+					{
+						EdgePos1[AxisIndex] = (EdgeNormal[AxisIndex] > 0) ? -SATBox1.HalfExtents[AxisIndex] : SATBox1.HalfExtents[AxisIndex];
+					}
+					if (AxisIndex != EdgeAxis2)
+					{
+						const FReal Sign = (FVec3::DotProduct(SATBox2.Axes[AxisIndex], EdgeNormal) > 0) ? FReal(1) : FReal(-1);
+						EdgePos2 += (Sign * SATBox2.HalfExtents[AxisIndex]) * SATBox2.Axes[AxisIndex];
+					}
+				}
+
+				// Closest points on the two edges
+				const FVec3& EdgeDir1 = SATBox1.Axes[EdgeAxis1];
+				const FVec3& EdgeDir2 = SATBox2.Axes[EdgeAxis2];
+				const FVec3 EdgeDelta = EdgePos1 - EdgePos2;
+				const FReal DirDot = FVec3::DotProduct(EdgeDir1, EdgeDir2);
+				const FReal Delta1 = FVec3::DotProduct(EdgeDir1, EdgeDelta);
+				const FReal Delta2 = FVec3::DotProduct(EdgeDir2, EdgeDelta);
+				const FReal Denominator = FMath::Max(FReal(1) - DirDot * DirDot, UE_KINDA_SMALL_NUMBER);
+				const FReal EdgeT1 = FMath::Clamp((DirDot * Delta2 - Delta1) / Denominator, -SATBox1.HalfExtents[EdgeAxis1], SATBox1.HalfExtents[EdgeAxis1]);
+				const FReal EdgeT2 = FMath::Clamp(DirDot * EdgeT1 + Delta2, -SATBox2.HalfExtents[EdgeAxis2], SATBox2.HalfExtents[EdgeAxis2]);
+				const FVec3 EdgePoint1 = EdgePos1 + EdgeT1 * EdgeDir1;
+				const FVec3 EdgePoint2 = EdgePos2 + EdgeT2 * EdgeDir2;
+				const FReal EdgePhi = FVec3::DotProduct(EdgePoint1 - EdgePoint2, EdgeNormal);
+				if (EdgePhi > CullDistance)
+				{
+					return;
+				}
+
+				// Same as ConstructConvexConvexOneShotManifold, the contact is left on the second shape
+				FContactPoint ContactPoint;
+				ContactPoint.ShapeContactPoints[0] = EdgePoint2 + EdgePhi * EdgeNormal + Center1;
+				ContactPoint.ShapeContactPoints[1] = Box2ToBox1Transform.InverseTransformPositionNoScale(EdgePoint2 + Center1);
+				ContactPoint.ShapeContactNormal = Box2ToBox1Transform.InverseTransformVectorNoScale(EdgeNormal);
+				ContactPoint.Phi = EdgePhi;
+				ContactPoint.ContactType = EContactPointType::EdgeEdge;
+				Constraint.AddOneshotManifoldContact(ContactPoint);
+				return;
+			}
+
+			// Face contact, in the space of the reference box relative to its center
+			FBoxBoxSATBox IncidentBox;
+			FVec3 RefHalfExtents;
+			int32 RefAxis;
+			if (bReferenceFace1)
+			{
+				IncidentBox = SATBox2;
+				RefHalfExtents = SATBox1.HalfExtents;
+				RefAxis = FaceAxis1;
+			}
+			else
+			{
+				IncidentBox.Center = Box2ToBox1Transform.InverseTransformPositionNoScale(Center1) - Center2;
+				IncidentBox.HalfExtents = SATBox1.HalfExtents;
+				for (int32 AxisIndex = 0; AxisIndex < 3; ++AxisIndex)
+				{
+					IncidentBox.Axes[AxisIndex] = Box2ToBox1Transform.InverseTransformVectorNoScale(SATBox1.Axes[AxisIndex]);
+				}
+				RefHalfExtents = SATBox2.HalfExtents;
+				RefAxis = FaceAxis2;
+			}
+			const FReal RefSign = (IncidentBox.Center[RefAxis] >= 0) ? FReal(1) : FReal(-1);
+
+			FVec3 ManifoldPoints[8];
+			uint32 ContactPointCount = BoxBoxSATClipIncidentFace(RefHalfExtents, IncidentBox, RefAxis, RefSign, CullDistance, ManifoldPoints);
+
+			// The points are (u, v, Phi), as ReduceManifoldContactPoints expects the separation along z
+			if (ContactPointCount == 4)
+			{
+				Swap(ManifoldPoints[1], ManifoldPoints[2]);
+			}
+			else if (ContactPointCount > 4)
+			{
+				ContactPointCount = ReduceManifoldContactPoints(ManifoldPoints, ContactPointCount);
+			}
+
+			// Normal from box 2 to box 1, the reference face normal points at the incident box
+			FVec3 RefNormal = FVec3(0);
+			RefNormal[RefAxis] = RefSign;
+			const FVec3 ContactNormal = bReferenceFace1 ? Box2ToBox1Transform.InverseTransformVectorNoScale(-RefNormal) : RefNormal;
+			const EContactPointType ContactType = bReferenceFace1 ? EContactPointType::PlaneVertex : EContactPointType::VertexPlane;
+			const FVec3& RefCenter = bReferenceFace1 ? Center1 : Center2;
+
+			for (uint32 ContactPointIndex = 0; ContactPointIndex < ContactPointCount; ++ContactPointIndex)
+			{
+				const FVec3& ManifoldPoint = ManifoldPoints[ContactPointIndex];
+				FVec3 RefFacePoint;
+				RefFacePoint[(RefAxis + 1) % 3] = ManifoldPoint.X;
+				RefFacePoint[(RefAxis + 2) % 3] = ManifoldPoint.Y;
+				RefFacePoint[RefAxis] = RefSign * RefHalfExtents[RefAxis];
+				const FVec3 IncidentPoint = RefFacePoint + ManifoldPoint.Z * RefNormal;
+
+				FContactPoint ContactPoint;
+				if (bReferenceFace1)
+				{
+					ContactPoint.ShapeContactPoints[0] = RefFacePoint + RefCenter;
+					ContactPoint.ShapeContactPoints[1] = Box2ToBox1Transform.InverseTransformPositionNoScale(IncidentPoint + RefCenter);
+				}
+				else
+				{
+					ContactPoint.ShapeContactPoints[0] = Box2ToBox1Transform.TransformPositionNoScale(IncidentPoint + RefCenter);
+					ContactPoint.ShapeContactPoints[1] = RefFacePoint + RefCenter;
+				}
+				ContactPoint.ShapeContactNormal = ContactNormal;
+				ContactPoint.Phi = ManifoldPoint.Z;
+				ContactPoint.ContactType = ContactType;
+
+				Constraint.AddOneshotManifoldContact(ContactPoint);
+			}
+		}
+
 		void ConstructBoxBoxOneShotManifold(
 			const FImplicitBox3& Box1,
 			const FRigidTransform3& Box1Transform, //world
@@ -180,6 +482,13 @@ namespace Chaos
 			const FReal Dt,
 			FPBDCollisionConstraint& Constraint)
 		{
+			// The SAT path always rebuilds the manifold, it does not support updating it from a new GJK result
+			if (bChaos_Collision_Manifold_BoxBoxSAT && !bChaos_Collision_EnableManifoldGJKReplace)
+			{
+				ConstructBoxBoxSATOneShotManifold(Box1, Box1Transform, Box2, Box2Transform, Constraint);
+				return;
+			}
+
 			ConstructConvexConvexOneShotManifold(Box1, Box1Transform, Box2, Box2Transform, Dt, Constraint);
 		}
 
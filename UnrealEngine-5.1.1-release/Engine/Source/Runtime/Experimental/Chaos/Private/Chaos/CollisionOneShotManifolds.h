@@ -23,6 +23,14 @@ namespace Chaos
 			const FReal Dt,
 			FPBDCollisionConstraint& Constraint);
 
+		// Box-box manifold from a separating axis test, used by ConstructBoxBoxOneShotManifold when p.Chaos.Collision.Manifold.BoxBoxSAT is set
+		void ConstructBoxBoxSATOneShotManifold(
+			const FImplicitBox3& Box1,
+			const FRigidTransform3& Box1Transform, //world
+			const FImplicitBox3& Box2,
+			const FRigidTransform3& Box2Transform, //world
+			FPBDCollisionConstraint& Constraint);
+
 		template <typename ConvexImplicitType1, typename ConvexImplicitType2>
 		void ConstructConvexConvexOneShotManifold(
 			const ConvexImplicitType1& Implicit1,
@@ -51,6 +51,11 @@ namespace Chaos
 		int32 GIslandGroupsMinBodiesPerWorker = 50;
 		FAutoConsoleVariableRef GCVarIslandGroupsMinBodiesPerWorker(TEXT("p.Chaos.Solver.IslandGroups.MinBodiesPerWorker"), GIslandGroupsMinBodiesPerWorker, TEXT("The minimum number of bodies we want per worker thread"));
 
+		// Assign each island (largest first) to the group with the fewest constraints, rather than to the first group with space left.
+		// Keeps the groups balanced when island sizes are skewed. Combine with WorkerMultiplier > 1 to let the task graph balance the groups dynamically.
+		bool bIslandGroupsLeastLoadedAssignment = true;
+		FAutoConsoleVariableRef GCVarIslandGroupsLeastLoadedAssignment(TEXT("p.Chaos.Solver.IslandGroups.LeastLoadedAssignment"), bIslandGroupsLeastLoadedAssignment, TEXT("Assign islands, largest first, to the island group with the fewest constraints [def:true]"));
+
 	}
 
 
@@ -153,6 +158,46 @@ namespace Chaos
 		}
 		NumActiveGroups = 0;
 
+		if (CVars::bIslandGroupsLeastLoadedAssignment)
+		{
+			// Only use as many groups as we can fill with the minimum number of constraints per worker
+			const int32 NumGroupsToUse = FMath::Clamp(FMath::DivideAndRoundUp(NumAllConstraints, FMath::Max(CVars::GIslandGroupsMinConstraintsPerWorker, 1)), 1, MaxGroups);
+
+			// Min-heap of group constraint counts. Ties go to the lowest index so the active groups are contiguous
+			struct FGroupLoad
+			{
+				int32 NumConstraints;
+				int32 GroupIndex;
+
+				bool operator<(const FGroupLoad& R) const
+				{
+					return (NumConstraints < R.NumConstraints) || ((NumConstraints == R.NumConstraints) && (GroupIndex < R.GroupIndex));
+				}
+			};
+			TArray<FGroupLoad> GroupLoads;
+			GroupLoads.Reserve(NumGroupsToUse);
+			for (int32 GroupIndex = 0; GroupIndex < NumGroupsToUse; ++GroupIndex)
+			{
+				GroupLoads.Add({ 0, GroupIndex });
+			}
+			GroupLoads.Heapify();
+
+			for (FPBDIsland* Island : Islands)
+			{
+				FGroupLoad GroupLoad;
+				GroupLoads.HeapPop(GroupLoad, false);
+
+				IslandGroups[GroupLoad.GroupIndex]->AddIsland(Island);
+				NumActiveGroups = FMath::Max(NumActiveGroups, GroupLoad.GroupIndex + 1);
+
+				GroupLoad.NumConstraints += Island->GetNumConstraints();
+				GroupLoads.HeapPush(GroupLoad);
+			}
+
+			ReportGroupStats(Islands);
+			return NumActiveGroups;
+		}
+
 		// Add each Island to the first group with enough space, or the group with the fewest constraint if none have enough space
 		// @todo(chaos): optimize - when a group is full we should move it to the back so we don't keep visiting it
 		for (FPBDIsland* Island : Islands)
@@ -184,9 +229,25 @@ namespace Chaos
 			NumActiveGroups = FMath::Max(NumActiveGroups, InsertGroupIndex + 1);
 		}
 
+		ReportGroupStats(Islands);
 		return NumActiveGroups;
 	}
 
+	void FPBDIslandGroupManager::ReportGroupStats(const TArray<FPBDIsland*>& SortedIslands)
+	{
+#if CSV_PROFILER
+		// The largest island bounds how well the solve can be spread over the workers
+		int32 MaxGroupConstraints = 0;
+		for (int32 GroupIndex = 0; GroupIndex < NumActiveGroups; ++GroupIndex)
+		{
+			MaxGroupConstraints = FMath::Max(MaxGroupConstraints, IslandGroups[GroupIndex]->GetNumConstraints());
+		}
+		PHYSICS_CSV_CUSTOM_EXPENSIVE(PhysicsCounters, NumIslandGroups, NumActiveGroups, ECsvCustomStatOp::Set);
+		PHYSICS_CSV_CUSTOM_EXPENSIVE(PhysicsCounters, IslandGroupsMaxConstraints, MaxGroupConstraints, ECsvCustomStatOp::Set);
+		PHYSICS_CSV_CUSTOM_EXPENSIVE(PhysicsCounters, LargestIslandConstraints, (SortedIslands.Num() > 0) ? SortedIslands[0]->GetNumConstraints() : 0, ECsvCustomStatOp::Set);
+#endif
+	}
+
 	void FPBDIslandGroupManager::BuildGatherBatches(TArray<FIslandGroupRange>& BodyRanges, TArray<FIslandGroupRange>& ConstraintRanges)
 	{
 		BodyRanges.Reset();
@@ -546,6 +607,21 @@ namespace Chaos
 #if CSV_PROFILER
 		FIslandGroupStats FlattenedStats = FIslandGroupStats::Flatten(GroupStats);
 		FlattenedStats.ReportStats();
+
+		// The slowest group is the critical path of the solve phases. Imbalance is the slowest group relative to the average, 1 when perfectly balanced
+		double MaxGroupSolveTime = 0.0;
+		double TotalGroupSolveTime = 0.0;
+		for (const FIslandGroupStats& Stats : GroupStats)
+		{
+			const double GroupSolveTime = Stats.Stats[FIslandGroupStats::PerIslandSolve_ApplyTotalSerialized]
+				+ Stats.Stats[FIslandGroupStats::PerIslandSolve_ApplyPushOutTotalSerialized]
+				+ Stats.Stats[FIslandGroupStats::PerIslandSolve_ApplyProjectionTotalSerialized];
+			MaxGroupSolveTime = FMath::Max(MaxGroupSolveTime, GroupSolveTime);
+			TotalGroupSolveTime += GroupSolveTime;
+		}
+		const double SolveImbalance = ((NumActiveGroups > 0) && (TotalGroupSolveTime > 0.0)) ? (MaxGroupSolveTime * NumActiveGroups / TotalGroupSolveTime) : 1.0;
+		CSV_CUSTOM_STAT(PhysicsVerbose, PerIslandSolve_MaxGroupApply, MaxGroupSolveTime * 1000.0, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(PhysicsVerbose, PerIslandSolve_ApplyImbalance, SolveImbalance, ECsvCustomStatOp::Set);
 #endif
 	}
 }
\ No newline at end of file
@@ -50,6 +50,9 @@ struct CHAOS_API FAABBTreeDirtyGridCVars
 
 	static int32 DirtyElementMaxCellCapacity;
 	static FAutoConsoleVariableRef CVarDirtyElementMaxCellCapacity;
+
+	static int32 DirtyElementOverflowToTree;
+	static FAutoConsoleVariableRef CVarDirtyElementOverflowToTree;
 };
 
 namespace Chaos
@@ -781,10 +784,7 @@ public:
 
 		this->SetAsyncTimeSlicingComplete(true);
 
-		if (DirtyElementTree != nullptr)
-		{
-			DirtyElementTree->Reset();
-		}
+		ResetDirtyElementTree();
 	}
 
 	virtual void ProgressAsyncTimeSlicing(bool ForceBuildCompletion) override
@@ -1830,8 +1830,16 @@ public:
 
 		if(!DirtyElementTree && !bDynamicTree && DirtyElements.Num() > MaxDirtyElements)
 		{
-			UE_LOG(LogChaos, Verbose, TEXT("Bounding volume exceeded maximum dirty elements (%d dirty of max %d) and is forcing a tree rebuild."), DirtyElements.Num(), MaxDirtyElements);
-			ReoptimizeTree();
+			if (FAABBTreeDirtyGridCVars::DirtyElementOverflowToTree != 0)
+			{
+				UE_LOG(LogChaos, Verbose, TEXT("Bounding volume exceeded maximum dirty elements (%d dirty of max %d) and is moving them to a dynamic tree until the next rebuild."), DirtyElements.Num(), MaxDirtyElements);
+				MoveDirtyElementsToTree();
+			}
+			else
+			{
+				UE_LOG(LogChaos, Verbose, TEXT("Bounding volume exceeded maximum dirty elements (%d dirty of max %d) and is forcing a tree rebuild."), DirtyElements.Num(), MaxDirtyElements);
+				ReoptimizeTree();
+			}
 		}
 	}
 
@@ -1901,6 +1909,12 @@ public:
 
 		Reset();
 
+		if (From.DirtyElementTree && !DirtyElementTree)
+		{
+			CreateDirtyElementTree();
+			bDirtyElementTreeFromOverflow = true;
+		}
+
 		// Copy all the small objects first
 
 		ISpatialAcceleration<TPayloadType, T, 3>::operator=(From);
@@ -2367,6 +2381,53 @@ public:
 
 private:
 
+	void CreateDirtyElementTree()
+	{
+		DirtyElementTree = TUniquePtr<TAABBTree<TPayloadType, TLeafType, bMutable, T>>(new TAABBTree<TPayloadType, TLeafType, bMutable, T>());
+		DirtyElementTree->SetTreeToDynamic();
+	}
+
+	/** A dirty tree created on overflow only lives until the next rebuild, the grid is used again after that */
+	void ResetDirtyElementTree()
+	{
+		if (bDirtyElementTreeFromOverflow)
+		{
+			DirtyElementTree.Reset();
+			bDirtyElementTreeFromOverflow = false;
+		}
+		else if (DirtyElementTree != nullptr)
+		{
+			DirtyElementTree->Reset();
+		}
+	}
+
+	/**
+	 * Moves the dirty elements to a dynamic tree in place of rebuilding this tree, which takes a long time on the physics thread for large
+	 * trees. Bulk additions such as streamed in levels then cost one tree insertion per element, and the elements are merged into this tree
+	 * when it is next rebuilt from the acceleration structure cache in the background.
+	 */
+	void MoveDirtyElementsToTree()
+	{
+		check(!DirtyElementTree && !bDynamicTree);
+		TRACE_CPUPROFILER_EVENT_SCOPE(TAABBTree::MoveDirtyElementsToTree);
+
+		CreateDirtyElementTree();
+		bDirtyElementTreeFromOverflow = true;
+
+		for (const FElement& Element : DirtyElements)
+		{
+			FAABBTreePayloadInfo& PayloadInfo = PayloadToInfo.FindChecked(Element.Payload);
+			PayloadInfo.DirtyPayloadIdx = DirtyElementTree->InsertLeaf(Element.Payload, Element.Bounds).NodeIdx;
+			PayloadInfo.DirtyGridOverflowIdx = INDEX_NONE;
+		}
+
+		DirtyElements.Reset();
+		CellHashToFlatArray.Reset();
+		FlattenedCellArrayOfDirtyIndices.Reset();
+		DirtyElementsGridOverflow.Reset();
+		TreeStats.StatNumNonEmptyCellsInGrid = 0;
+	}
+
 	void ReoptimizeTree()
 	{
 		check(!DirtyElementTree && !bDynamicTree);
@@ -2889,10 +2950,7 @@ private:
 		CellHashToFlatArray.Reset(); 
 		FlattenedCellArrayOfDirtyIndices.Reset();
 		DirtyElementsGridOverflow.Reset();
-		if (DirtyElementTree)
-		{
-			DirtyElementTree->Reset();
-		}
+		ResetDirtyElementTree();
 		
 		TreeStats.Reset();
 		TreeExpensiveStats.Reset();
@@ -3406,6 +3464,7 @@ private:
 		, FlattenedCellArrayOfDirtyIndices(Other.FlattenedCellArrayOfDirtyIndices)
 		, DirtyElementsGridOverflow(Other.DirtyElementsGridOverflow)
 		, DirtyElementTree(nullptr)
+		, bDirtyElementTreeFromOverflow(Other.bDirtyElementTreeFromOverflow)
 		, DirtyElementGridCellSize(Other.DirtyElementGridCellSize)
 		, DirtyElementGridCellSizeInv(Other.DirtyElementGridCellSizeInv)
 		, DirtyElementMaxGridCellQueryCount(Other.DirtyElementMaxGridCellQueryCount)
@@ -3480,11 +3539,21 @@ private:
 			MaxNumToProcess = Rhs.MaxNumToProcess;
 			NumProcessedThisSlice = Rhs.NumProcessedThisSlice;
 			bShouldRebuild = Rhs.bShouldRebuild;
+			const bool bHasConfiguredDirtyTree = DirtyElementTree && !bDirtyElementTreeFromOverflow;
 			if (Rhs.DirtyElementTree)
 			{
-				check(DirtyElementTree); // We should have allocated this already
+				if (!DirtyElementTree)
+				{
+					check(Rhs.bDirtyElementTreeFromOverflow); // We should have allocated this already
+					CreateDirtyElementTree();
+				}
 				*DirtyElementTree = *Rhs.DirtyElementTree;
 			}
+			else if (!bHasConfiguredDirtyTree)
+			{
+				DirtyElementTree.Reset();
+			}
+			bDirtyElementTreeFromOverflow = DirtyElementTree && !bHasConfiguredDirtyTree;
 		}
 
 		return *this;
@@ -3508,6 +3577,8 @@ private:
 
 	// Members for using a dynamic tree as a dirty element acceleration structure
 	TUniquePtr<TAABBTree<TPayloadType, TLeafType, bMutable, T>> DirtyElementTree;
+	// Whether DirtyElementTree was created when the dirty elements exceeded MaxDirtyElements, rather than by the constructor
+	bool bDirtyElementTreeFromOverflow = false;
 
 
 	// Copy of CVARS
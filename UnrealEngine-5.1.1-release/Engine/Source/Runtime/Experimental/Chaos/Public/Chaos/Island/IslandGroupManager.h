@@ -146,6 +146,7 @@ namespace Chaos
 		void SolveParallelTasks(const FReal Dt);
 
 		void BuildGatherBatches(TArray<FIslandGroupRange>& BodyRanges, TArray<FIslandGroupRange>& ConstraintRanges);
+		void ReportGroupStats(const TArray<FPBDIsland*>& SortedIslands);
 		void SolveGroupConstraints(const int32 GroupIndex, const FReal Dt);
 
 
@@ -203,6 +203,89 @@ FAutoConsoleVariableRef CVarGeometryCollectionNavigationSizeThreshold(TEXT("p.Ge
 bool bGeometryCollectionSingleThreadedBoundsCalculation = false;
 FAutoConsoleVariableRef CVarGeometryCollectionSingleThreadedBoundsCalculation(TEXT("p.GeometryCollectionSingleThreadedBoundsCalculation"), bGeometryCollectionSingleThreadedBoundsCalculation, TEXT("[Debug Only] Single threaded bounds calculation. [def:false]"));
 
+// Destruction budget
+int32 GGeometryCollectionBudgetMaxActivePieces = 0;
+FAutoConsoleVariableRef CVarGeometryCollectionBudgetMaxActivePieces(TEXT("p.Chaos.GC.Budget.MaxActivePieces"), GGeometryCollectionBudgetMaxActivePieces, TEXT("Maximum number of broken off pieces simulated across all the geometry collections of the world. Over the budget the pieces with the smallest screen size are removed. 0 disables the budget. [def:0]"));
+
+float GGeometryCollectionBudgetMaxScreenSizeToRemove = 0.05f;
+FAutoConsoleVariableRef CVarGeometryCollectionBudgetMaxScreenSizeToRemove(TEXT("p.Chaos.GC.Budget.MaxScreenSizeToRemove"), GGeometryCollectionBudgetMaxScreenSizeToRemove, TEXT("Pieces with a larger screen size, as the ratio of their radius to their distance to the closest view, are never removed by the destruction budget. [def:0.05]"));
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("GC Budget Active Pieces"), STAT_GCBudgetActivePieces, STATGROUP_Chaos);
+DECLARE_DWORD_COUNTER_STAT(TEXT("GC Budget Removed Pieces"), STAT_GCBudgetRemovedPieces, STATGROUP_Chaos);
+
+namespace GeometryCollectionBudget
+{
+	/** Pieces are counted in buckets of half an octave of screen size, the first bucket holds the largest pieces */
+	static constexpr int32 NumBuckets = 32;
+
+	struct FFrameCounts
+	{
+		uint64 FrameCounter = 0;
+		int32 Counts[NumBuckets] = {};
+	};
+
+	/** Screen size cut computed from the counts of the previous frame, the pieces beyond it are removed */
+	struct FCut
+	{
+		int32 Bucket = NumBuckets;
+		/** Fraction of the pieces of the cut bucket to remove */
+		float Fraction = 0.0f;
+	};
+
+	static TMap<TWeakObjectPtr<UWorld>, FFrameCounts> CurrentCounts;
+	static TMap<TWeakObjectPtr<UWorld>, FCut> Cuts;
+
+	static int32 GetBucket(FVector::FReal ScreenSize)
+	{
+		const FVector::FReal Octaves = -FMath::Log2(FMath::Max(ScreenSize, UE_SMALL_NUMBER));
+		return FMath::Clamp((int32)(Octaves * 2.0), 0, NumBuckets - 1);
+	}
+
+	/** On the first piece counted each frame, turns the counts of the previous frame of the world into the cut applied this frame */
+	static FFrameCounts& BeginFrame(const TWeakObjectPtr<UWorld>& World)
+	{
+		FFrameCounts& Counts = CurrentCounts.FindOrAdd(World);
+		if (Counts.FrameCounter != GFrameCounter)
+		{
+			FCut& Cut = Cuts.FindOrAdd(World);
+			Cut = FCut();
+
+			int32 NumPieces = 0;
+			for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+			{
+				NumPieces += Counts.Counts[Bucket];
+				if (NumPieces > GGeometryCollectionBudgetMaxActivePieces)
+				{
+					Cut.Bucket = Bucket;
+					Cut.Fraction = (float)(NumPieces - GGeometryCollectionBudgetMaxActivePieces) / (float)Counts.Counts[Bucket];
+					break;
+				}
+			}
+			SET_DWORD_STAT(STAT_GCBudgetActivePieces, NumPieces);
+
+			Counts = FFrameCounts();
+			Counts.FrameCounter = GFrameCounter;
+
+			// Drop the state of worlds that went away
+			for (auto It = CurrentCounts.CreateIterator(); It; ++It)
+			{
+				if (!It.Key().IsValid())
+				{
+					Cuts.Remove(It.Key());
+					It.RemoveCurrent();
+				}
+			}
+		}
+		return CurrentCounts.FindChecked(World);
+	}
+
+	/** Stable per piece value in [0,1) to pick which pieces of the cut bucket are removed */
+	static float GetPieceRandom(const UObject* Component, int32 TransformIndex)
+	{
+		return (float)(HashCombine(GetTypeHash(Component), GetTypeHash(TransformIndex)) & 0xffff) / 65536.0f;
+	}
+}
+
 
 
 FGeomComponentCacheParameters::FGeomComponentCacheParameters()
@@ -2159,6 +2242,7 @@ void UGeometryCollectionComponent::TickComponent(float DeltaTime, enum ELevelTic
 		{
 			IncrementSleepTimer(DeltaTime);
 			IncrementBreakTimer(DeltaTime);
+			ApplyDestructionBudget();
 
 			// todo(chaos) : find a way to only update that of transform have changed
 			// right now this does not work properly because the dirty flags may not be updated at the right time
@@ -4101,6 +4185,71 @@ void UGeometryCollectionComponent::IncrementSleepTimer(float DeltaTime)
 	}
 }
 
+void UGeometryCollectionComponent::ApplyDestructionBudget()
+{
+	UWorld* World = GetWorld();
+	if (GGeometryCollectionBudgetMaxActivePieces <= 0 || !World || World->ViewLocationsRenderedLastFrame.Num() == 0 || !RestCollection || !DynamicCollection || !PhysicsProxy)
+	{
+		return;
+	}
+
+	FGeometryCollectionDynamicStateFacade DynamicStateFacade(*DynamicCollection);
+	if (!DynamicStateFacade.IsValid())
+	{
+		return;
+	}
+
+	const TWeakObjectPtr<UWorld> WorldKey(World);
+	GeometryCollectionBudget::FFrameCounts& Counts = GeometryCollectionBudget::BeginFrame(WorldKey);
+	const GeometryCollectionBudget::FCut Cut = GeometryCollectionBudget::Cuts.FindChecked(WorldKey);
+
+	const FGeometryCollection* Collection = RestCollection->GetGeometryCollection().Get();
+	const TManagedArray<int32>& OriginalParents = Collection->Parent;
+	const TManagedArray<int32>& TransformToGeometryIndex = Collection->TransformToGeometryIndex;
+	const TManagedArray<FBox>& GeometryBounds = Collection->BoundingBox;
+	const TManagedArray<FTransform>& Transforms = DynamicCollection->Transform;
+	const FTransform& ComponentTransform = GetComponentTransform();
+
+	TArray<int32> ToDisable;
+	for (int32 TransformIdx = 0; TransformIdx < Transforms.Num(); ++TransformIdx)
+	{
+		// Only the broken off leaf pieces count, the root and clusters are left alone
+		const int32 GeometryIdx = TransformToGeometryIndex[TransformIdx];
+		if (GeometryIdx == INDEX_NONE || OriginalParents[TransformIdx] == INDEX_NONE || !DynamicStateFacade.HasBrokenOff(TransformIdx) || DynamicStateFacade.HasChildren(TransformIdx))
+		{
+			continue;
+		}
+
+		const FBox& LocalBounds = GeometryBounds[GeometryIdx];
+		const FVector Center = ComponentTransform.TransformPosition(Transforms[TransformIdx].TransformPosition(LocalBounds.GetCenter()));
+		const FVector::FReal Radius = LocalBounds.GetExtent().Size() * ComponentTransform.GetMaximumAxisScale();
+
+		FVector::FReal MinDistanceSquared = TNumericLimits<FVector::FReal>::Max();
+		for (const FVector& ViewLocation : World->ViewLocationsRenderedLastFrame)
+		{
+			MinDistanceSquared = FMath::Min(MinDistanceSquared, FVector::DistSquared(ViewLocation, Center));
+		}
+		const FVector::FReal ScreenSize = Radius / FMath::Max(FMath::Sqrt(MinDistanceSquared), (FVector::FReal)1.0);
+
+		const int32 Bucket = GeometryCollectionBudget::GetBucket(ScreenSize);
+		const bool bBeyondCut = Bucket > Cut.Bucket || (Bucket == Cut.Bucket && GeometryCollectionBudget::GetPieceRandom(this, TransformIdx) < Cut.Fraction);
+		if (bBeyondCut && ScreenSize <= GGeometryCollectionBudgetMaxScreenSizeToRemove)
+		{
+			ToDisable.Add(TransformIdx);
+		}
+		else
+		{
+			++Counts.Counts[Bucket];
+		}
+	}
+
+	if (ToDisable.Num())
+	{
+		INC_DWORD_STAT_BY(STAT_GCBudgetRemovedPieces, ToDisable.Num());
+		PhysicsProxy->DisableParticles_External(MoveTemp(ToDisable));
+	}
+}
+
 void UGeometryCollectionComponent::IncrementBreakTimer(float DeltaTime)
 {
 	if (DeltaTime <= 0 || !bAllowRemovalOnBreak)
@@ -21,6 +21,7 @@
 #include "Iris/Serialization/InternalNetSerializationContext.h"
 #include "Iris/Serialization/NetBitStreamWriter.h"
 #include "Iris/Serialization/NetSerializer.h"
+#include "Async/ParallelFor.h"
 #include "HAL/IConsoleManager.h"
 #include "ProfilingDebugging/CsvProfiler.h"
 #include "UObject/UObjectGlobals.h"
@@ -31,6 +32,14 @@ namespace ReplicationSystemCVars
 static bool bForcePruneBeforeUpdate = false;
 static FAutoConsoleVariableRef CVarForcePruneBeforeUpdate(TEXT("net.Iris.ForcePruneBeforeUpdate"), bForcePruneBeforeUpdate, TEXT("Verify integrity of all tracked instances at the start of every update."));
 #endif
+
+static int32 PrepareScheduledObjectsMode = 1;
+static FAutoConsoleVariableRef CVarPrepareScheduledObjectsMode(TEXT("net.Iris.PrepareScheduledObjects"), PrepareScheduledObjectsMode,
+	TEXT("Schedule and sort objects to replicate for all connections at the end of PreSendUpdate. 0 = schedule when each connection writes, 1 = in parallel, 2 = on the game thread in connection order, for debugging."));
+
+static int32 PrepareScheduledObjectsMinConnectionCount = 4;
+static FAutoConsoleVariableRef CVarPrepareScheduledObjectsMinConnectionCount(TEXT("net.Iris.PrepareScheduledObjects.MinConnectionCount"), PrepareScheduledObjectsMinConnectionCount,
+	TEXT("Minimum number of replicating connections to schedule objects in parallel."));
 }
 
 namespace UE::Net::Private
@@ -260,6 +269,27 @@ public:
 		Prioritization.Prioritize(ReplicatingConnections, DirtyObjects);
 	}
 
+	void PrepareScheduledObjects(const FNetBitArrayView& ReplicatingConnections)
+	{
+		IRIS_PROFILER_SCOPE(FReplicationSystem_PrepareScheduledObjects);
+
+		FReplicationConnections& Connections = ReplicationSystemInternal.GetConnections();
+
+		TArray<FReplicationWriter*, TInlineAllocator<128>> Writers;
+		auto GatherWriter = [&Connections, &Writers](uint32 ConnectionId)
+		{
+			Writers.Add(Connections.GetConnection(ConnectionId)->ReplicationWriter);
+		};
+		ReplicatingConnections.ForAllSetBits(GatherWriter);
+
+		// Writers only touch their own state when scheduling, so the result does not depend on the order they run in
+		const bool bParallel = ReplicationSystemCVars::PrepareScheduledObjectsMode == 1 && Writers.Num() >= ReplicationSystemCVars::PrepareScheduledObjectsMinConnectionCount;
+		ParallelFor(Writers.Num(), [&Writers](int32 Index)
+		{
+			Writers[Index]->PrepareScheduledObjects();
+		}, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+	}
+
 	void PropagateDirtyChanges()
 	{
 		IRIS_PROFILER_SCOPE(FReplicationSystem_PropagateDirtyChanges);
@@ -554,6 +584,11 @@ void UReplicationSystem::PreSendUpdate(float DeltaSeconds)
 		Impl->UpdateUnresolvableReferenceTracking();
 		InternalSys.GetNetHandleManager().DestroyObjectsPendingDestroy();
 	}
+
+	if (bAllowObjectReplication && ReplicationSystemCVars::PrepareScheduledObjectsMode > 0)
+	{
+		Impl->PrepareScheduledObjects(ReplicatingConnections);
+	}
 }
 
 void UReplicationSystem::SendUpdate()
@@ -279,12 +279,14 @@ static bool s_ValidateReplicationRecord(const FReplicationRecord* ReplicationRec
 
 FReplicationWriter::~FReplicationWriter()
 {
+	DiscardPreparedWrite();
 	DiscardAllRecords();
 	StopAllReplication();
 }
 
 void FReplicationWriter::SetReplicationEnabled(bool bInReplicationEnabled)
 {
+	DiscardPreparedWrite();
 	bReplicationEnabled = bInReplicationEnabled;
 }
 
@@ -297,6 +299,8 @@ bool FReplicationWriter::IsReplicationEnabled() const
 // One may not want to send unless the object is replicated very soon etc.
 void FReplicationWriter::QueueNetObjectAttachments(FInternalNetHandle OwnerInternalIndex, FInternalNetHandle SubObjectInternalIndex, TArrayView<const TRefCountPtr<FNetBlob>> InAttachments)
 {
+	DiscardPreparedWrite();
+
 	if (InAttachments.Num() <= 0)
 	{
 		ensureMsgf(false, TEXT("%s"), TEXT("QueueNetObjectAttachments expects at least one attachment."));
@@ -514,6 +518,8 @@ void FReplicationWriter::UpdateScope(const FNetBitArrayView& UpdatedScope)
 {
 	IRIS_PROFILER_SCOPE(FReplicationWriter_ScopeUpdate);
 
+	DiscardPreparedWrite();
+
 	auto NewObjectFunctor = [this](uint32 Index)
 	{
 		// We can only start replicating an object that is not currently replicated
@@ -655,6 +661,8 @@ void FReplicationWriter::InternalUpdateDirtyChangeMasks(const FChangeMaskCache&
 {
 	IRIS_PROFILER_SCOPE(FReplicationWriter_UpdateDirtyChangeMasks);
 
+	DiscardPreparedWrite();
+
 	const ChangeMaskStorageType* StoragePtr = CachedChangeMasks.Storage.GetData();
 	for (const auto& Entry : CachedChangeMasks.Indices)
 	{
@@ -701,6 +709,8 @@ void FReplicationWriter::InternalUpdateDirtyChangeMasks(const FChangeMaskCache&
 
 void FReplicationWriter::NotifyDestroyedObjectPendingTearOff(FInternalNetHandle ObjectInternalIndex)
 {
+	DiscardPreparedWrite();
+
 	const FReplicationInfo& ReplicationInfo = GetReplicationInfo(ObjectInternalIndex);
 	if (ReplicationInfo.GetState() == EReplicatedObjectState::PendingCreate)
 	{
@@ -717,6 +727,8 @@ const FNetBitArray& FReplicationWriter::GetObjectsRequiringPriorityUpdate() cons
 void FReplicationWriter::UpdatePriorities(const float* UpdatedPriorities)
 {
 	IRIS_PROFILER_SCOPE(FReplicationWriter_UpdatePriorities);
+
+	DiscardPreparedWrite();
 	auto UpdatePriority = [LocalPriorities = SchedulingPriorities.GetData(), UpdatedPriorities](uint32 Index)
 	{
 		LocalPriorities[Index] += UpdatedPriorities[Index];
@@ -759,6 +771,35 @@ uint32 FReplicationWriter::ScheduleObjects(FScheduleObjectInfo* OutScheduledObje
 	return ScheduledObjectCount;
 }
 
+void FReplicationWriter::PrepareScheduledObjects()
+{
+	IRIS_PROFILER_SCOPE(FReplicationWriter_PrepareScheduledObjects);
+
+	DiscardPreparedWrite();
+
+	if (!bReplicationEnabled || WriteContext.bIsValid)
+	{
+		return;
+	}
+
+	// ScheduleObjects clears the OOB attachment bit, BeginWrite needs to know whether it was set
+	PreparedWrite.bHasUpdatedObjectsToSend = ObjectsWithDirtyChanges.IsAnyBitSet();
+	if (!PreparedWrite.bHasUpdatedObjectsToSend)
+	{
+		return;
+	}
+
+	PreparedWrite.ScheduledObjectInfos = reinterpret_cast<FScheduleObjectInfo*>(FMemory::Malloc(sizeof(FScheduleObjectInfo) * Parameters.MaxActiveReplicatedObjectCount));
+	PreparedWrite.ScheduledObjectCount = ScheduleObjects(PreparedWrite.ScheduledObjectInfos);
+	PreparedWrite.SortedObjectCount = PreparedWrite.ScheduledObjectCount > 0 ? SortScheduledObjects(PreparedWrite.ScheduledObjectInfos, PreparedWrite.ScheduledObjectCount, 0U) : 0U;
+}
+
+void FReplicationWriter::DiscardPreparedWrite()
+{
+	FMemory::Free(PreparedWrite.ScheduledObjectInfos);
+	PreparedWrite = FPreparedWrite();
+}
+
 uint32 FReplicationWriter::SortScheduledObjects(FScheduleObjectInfo* ScheduledObjectIndices, uint32 ScheduledObjectCount, uint32 StartIndex)
 {
 	check(ScheduledObjectCount > 0 && StartIndex <= ScheduledObjectCount);
@@ -1234,6 +1275,8 @@ void FReplicationWriter::HandleDroppedRecord(const FReplicationRecord::FRecordIn
 
 void FReplicationWriter::ProcessDeliveryNotification(EPacketDeliveryStatus PacketDeliveryStatus)
 {
+	DiscardPreparedWrite();
+
 #if UE_NET_VALIDATE_REPLICATION_RECORD
 	check(s_ValidateReplicationRecord(&ReplicationRecord, Parameters.MaxActiveReplicatedObjectCount + 1U, true));
 #endif
@@ -2466,7 +2509,8 @@ UDataStream::EWriteResult FReplicationWriter::BeginWrite()
 	}
 
 	// See if we have any work to do
-	const bool bHasUpdatedObjectsToSend = ObjectsWithDirtyChanges.IsAnyBitSet();
+	const bool bHasPreparedWrite = PreparedWrite.ScheduledObjectInfos != nullptr;
+	const bool bHasUpdatedObjectsToSend = bHasPreparedWrite ? PreparedWrite.bHasUpdatedObjectsToSend : ObjectsWithDirtyChanges.IsAnyBitSet();
 	const bool bHasDestroyedObjectsToSend = ObjectsPendingDestroy.IsAnyBitSet();
 	const bool bHasUnsentOOBAttachments = Attachments.HasUnsentAttachments(ENetObjectAttachmentType::OutOfBand, ObjectIndexForOOBAttachment);
 	const bool bHasUnsentHugeObject = Attachments.HasUnsentAttachments(ENetObjectAttachmentType::HugeObject, ObjectIndexForOOBAttachment);
@@ -2474,6 +2518,7 @@ UDataStream::EWriteResult FReplicationWriter::BeginWrite()
 	// Nothing to send
 	if (!(bHasUpdatedObjectsToSend | bHasDestroyedObjectsToSend | bHasUnsentOOBAttachments | bHasUnsentHugeObject))
 	{
+		DiscardPreparedWrite();
 		return UDataStream::EWriteResult::NoData;
 	}
 
@@ -2498,8 +2543,20 @@ UDataStream::EWriteResult FReplicationWriter::BeginWrite()
 	// Allocate space for indices to send
 	// This should be allocated from frame temp allocator and be cleaned up end of frame, we might want this data to persist over multiple write calls but not over multiple frames 
 	// https://jira.it.epicgames.com/browse/UE-127374	
-	WriteContext.ScheduledObjectInfos = reinterpret_cast<FScheduleObjectInfo*>(FMemory::Malloc(sizeof(FScheduleObjectInfo) * Parameters.MaxActiveReplicatedObjectCount));
-	WriteContext.ScheduledObjectCount = ScheduleObjects(WriteContext.ScheduledObjectInfos);
+	if (bHasPreparedWrite)
+	{
+		// Nothing that affects scheduling has changed since PrepareScheduledObjects, take over its result
+		WriteContext.ScheduledObjectInfos = PreparedWrite.ScheduledObjectInfos;
+		WriteContext.ScheduledObjectCount = PreparedWrite.ScheduledObjectCount;
+		WriteContext.SortedObjectCount = PreparedWrite.SortedObjectCount;
+		PreparedWrite = FPreparedWrite();
+	}
+	else
+	{
+		DiscardPreparedWrite();
+		WriteContext.ScheduledObjectInfos = reinterpret_cast<FScheduleObjectInfo*>(FMemory::Malloc(sizeof(FScheduleObjectInfo) * Parameters.MaxActiveReplicatedObjectCount));
+		WriteContext.ScheduledObjectCount = ScheduleObjects(WriteContext.ScheduledObjectInfos);
+	}
 
 	// Init CSV stats
 #if UE_NET_IRIS_CSV_STATS && CSV_PROFILER
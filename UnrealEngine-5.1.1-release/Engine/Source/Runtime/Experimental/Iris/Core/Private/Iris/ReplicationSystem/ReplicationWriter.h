@@ -155,6 +155,10 @@ public:
 	// UpdatedPriorities contains priorities for all objects. Objects in need of a priority update should use the newly calculated priorities.
 	void UpdatePriorities(const float* UpdatedPriorities);
 
+	// Schedules objects ahead of BeginWrite. Only touches state owned by this writer so it can run in parallel for different connections.
+	// The result is discarded if anything affecting scheduling changes before BeginWrite.
+	void PrepareScheduledObjects();
+
 	UDataStream::EWriteResult BeginWrite();
 
 	// WriteData to Packet, returns true for now if data was written
@@ -355,6 +359,8 @@ private:
 	void CommitBatchRecord(const FBatchRecord& BatchRecord);
 
 	uint32 ScheduleObjects(FScheduleObjectInfo* ScheduledObjectIndices);
+
+	void DiscardPreparedWrite();
 	
 	// Partial sort of OutScheduledObjectIndices, will sort at most PartialSortObjectCount objects
 	uint32 SortScheduledObjects(FScheduleObjectInfo* ScheduledObjectIndices, uint32 ScheduledObjectCount, uint32 StartIndex);
@@ -445,6 +451,16 @@ private:
 	// Each replicated object has a scheduling priority that is bumped every time we have a chance to send and zeroed out every time the object is successfully sent
 	TArray<float> SchedulingPriorities;
 
+	// Scheduled objects from PrepareScheduledObjects, owned by the WriteContext once BeginWrite picks them up
+	struct FPreparedWrite
+	{
+		FScheduleObjectInfo* ScheduledObjectInfos = nullptr;
+		uint32 ScheduledObjectCount = 0;
+		uint32 SortedObjectCount = 0;
+		bool bHasUpdatedObjectsToSend = false;
+	};
+	FPreparedWrite PreparedWrite;
+
 	// Track Objects Pending Destroy?
 	FNetBitArray ObjectsPendingDestroy;
 
@@ -55,26 +55,55 @@ void FMeshNormals::CopyToOverlay(FDynamicMeshNormalOverlay* NormalOverlay, bool
 }
 
 
+namespace FMeshNormals_Local
+{
+	// Sums the per-corner weighted triangle normals at each vertex. The corner normals are computed in parallel over the
+	// triangles first, and then gathered in parallel over the vertices, so that no two tasks write to the same normal and
+	// the sums are accumulated in the same order as a serial scatter over the triangles of each vertex would.
+	template<typename CornerNormalFuncType>
+	static void ComputeVertexNormalSums(const FDynamicMesh3* Mesh, TArray<FVector3d>& Normals, CornerNormalFuncType CornerNormalFunc)
+	{
+		const int32 MaxTriangleID = Mesh->MaxTriangleID();
+		TArray<FVector3d> CornerNormals;
+		CornerNormals.SetNumUninitialized(3 * MaxTriangleID);
+		ParallelFor(MaxTriangleID, [&](int32 TriIdx)
+		{
+			if (Mesh->IsTriangle(TriIdx))
+			{
+				CornerNormalFunc(TriIdx, &CornerNormals[3 * TriIdx]);
+			}
+		});
+
+		ParallelFor(Mesh->MaxVertexID(), [&](int32 VertIdx)
+		{
+			if (Mesh->IsVertex(VertIdx))
+			{
+				FVector3d SumNormal = FVector3d::Zero();
+				Mesh->EnumerateVertexTriangles(VertIdx, [&](int32 TriIdx)
+				{
+					const int32 j = IndexUtil::FindTriIndex(VertIdx, Mesh->GetTriangle(TriIdx));
+					SumNormal += CornerNormals[3 * TriIdx + j];
+				});
+				Normals[VertIdx] = Normalized(SumNormal);
+			}
+		});
+	}
+} // namespace FMeshNormals_Local
+
 void FMeshNormals::Compute_FaceAvg_AreaWeighted()
 {
 	SetCount(Mesh->MaxVertexID(), true);
 
-	for (int TriIdx : Mesh->TriangleIndicesItr())
+	FMeshNormals_Local::ComputeVertexNormalSums(Mesh, Normals, [this](int32 TriIdx, FVector3d* CornerNormals)
 	{
 		FVector3d TriNormal, TriCentroid; double TriArea;
 		Mesh->GetTriInfo(TriIdx, TriNormal, TriArea, TriCentroid);
 		TriNormal *= TriArea;
 
-		FIndex3i Triangle = Mesh->GetTriangle(TriIdx);
-		Normals[Triangle.A] += TriNormal;
-		Normals[Triangle.B] += TriNormal;
-		Normals[Triangle.C] += TriNormal;
-	}
-
-	for (int VertIdx : Mesh->VertexIndicesItr())
-	{
-		Normalize(Normals[VertIdx]);
-	}
+		CornerNormals[0] = TriNormal;
+		CornerNormals[1] = TriNormal;
+		CornerNormals[2] = TriNormal;
+	});
 }
 
 void FMeshNormals::Compute_FaceAvg(bool bWeightByArea, bool bWeightByAngle)
@@ -88,22 +117,16 @@ void FMeshNormals::Compute_FaceAvg(bool bWeightByArea, bool bWeightByAngle)
 	// most general case
 	SetCount(Mesh->MaxVertexID(), true);
 
-	for (int TriIdx : Mesh->TriangleIndicesItr())
+	FMeshNormals_Local::ComputeVertexNormalSums(Mesh, Normals, [this, bWeightByArea, bWeightByAngle](int32 TriIdx, FVector3d* CornerNormals)
 	{
 		FVector3d TriNormal, TriCentroid; double TriArea;
 		Mesh->GetTriInfo(TriIdx, TriNormal, TriArea, TriCentroid);
 		FVector3d TriNormalWeights = GetVertexWeightsOnTriangle(Mesh, TriIdx, TriArea, bWeightByArea, bWeightByAngle);
 
-		FIndex3i Triangle = Mesh->GetTriangle(TriIdx);
-		Normals[Triangle.A] += TriNormal * TriNormalWeights[0];
-		Normals[Triangle.B] += TriNormal * TriNormalWeights[1];
-		Normals[Triangle.C] += TriNormal * TriNormalWeights[2];
-	}
-
-	for (int VertIdx : Mesh->VertexIndicesItr())
-	{
-		Normalize(Normals[VertIdx]);
-	}
+		CornerNormals[0] = TriNormal * TriNormalWeights[0];
+		CornerNormals[1] = TriNormal * TriNormalWeights[1];
+		CornerNormals[2] = TriNormal * TriNormalWeights[2];
+	});
 }
 
 void FMeshNormals::Compute_Triangle()
@@ -48,6 +48,13 @@ static FAutoConsoleVariableRef CCvarInterchangeImportEnable(
 	TEXT("Whether Interchange import is enabled."),
 	ECVF_Default);
 
+static bool GInterchangeImportProfileReport = false;
+static FAutoConsoleVariableRef CCvarInterchangeImportProfileReport(
+	TEXT("Interchange.FeatureFlags.Import.ProfileReport"),
+	GInterchangeImportProfileReport,
+	TEXT("Whether to log the time spent translating the sources and creating the assets of each import when it completes."),
+	ECVF_Default);
+
 namespace UE::Interchange::Private
 {
 	const FLogCategoryBase* GetLogInterchangePtr()
@@ -196,6 +203,7 @@ UE::Interchange::FImportAsyncHelper::FImportAsyncHelper()
 	, SceneImportResult(MakeShared<FImportResult>())
 {
 	bCancel = false;
+	ImportStartTime = FPlatformTime::Seconds();
 }
 
 void UE::Interchange::FImportAsyncHelper::AddReferencedObjects(FReferenceCollector& Collector)
@@ -281,6 +289,42 @@ void UE::Interchange::FImportAsyncHelper::SendAnalyticImportEndData()
 	FEngineAnalytics::GetProvider().RecordEvent(EventString, Attribs);
 }
 
+void UE::Interchange::FImportAsyncHelper::AddImportProfileTime(const FString& StepName, double Seconds)
+{
+	FScopeLock Lock(&ImportProfileLock);
+	FImportProfileEntry& Entry = ImportProfile.FindOrAdd(StepName);
+	++Entry.Count;
+	Entry.TotalSeconds += Seconds;
+	Entry.MaxSeconds = FMath::Max(Entry.MaxSeconds, Seconds);
+}
+
+void UE::Interchange::FImportAsyncHelper::LogImportProfileReport()
+{
+	if (!GInterchangeImportProfileReport)
+	{
+		return;
+	}
+
+	FScopeLock Lock(&ImportProfileLock);
+	UE_LOG(LogInterchangeEngine, Display, TEXT("Interchange import profile (id %d), %d source(s), %.2f seconds:"), UniqueId, SourceDatas.Num(), FPlatformTime::Seconds() - ImportStartTime);
+
+	//Report the most expensive steps first, the total time of a step is summed over all the threads it ran on
+	ImportProfile.ValueSort([](const FImportProfileEntry& A, const FImportProfileEntry& B)
+	{
+		return A.TotalSeconds > B.TotalSeconds;
+	});
+	for (const TPair<FString, FImportProfileEntry>& StepAndEntry : ImportProfile)
+	{
+		const FImportProfileEntry& Entry = StepAndEntry.Value;
+		UE_LOG(LogInterchangeEngine, Display, TEXT("    %-48s count %6d  total %9.3f s  average %8.3f ms  max %8.3f ms")
+			, *StepAndEntry.Key
+			, Entry.Count
+			, Entry.TotalSeconds
+			, Entry.TotalSeconds * 1000.0 / Entry.Count
+			, Entry.MaxSeconds * 1000.0);
+	}
+}
+
 void UE::Interchange::FImportAsyncHelper::ReleaseTranslatorsSource()
 {
 	for (UInterchangeTranslatorBase* BaseTranslator : Translators)
@@ -1441,6 +1485,8 @@ void UInterchangeManager::ReleaseAsyncHelper(TWeakPtr<UE::Interchange::FImportAs
 
 		ForEachResult(AsyncHelperPtr->AssetImportResult->GetResults()->GetResults());
 		ForEachResult(AsyncHelperPtr->SceneImportResult->GetResults()->GetResults());
+
+		AsyncHelperPtr->LogImportProfileReport();
 	}
 
 	ImportTasks.RemoveSingle(AsyncHelper.Pin());
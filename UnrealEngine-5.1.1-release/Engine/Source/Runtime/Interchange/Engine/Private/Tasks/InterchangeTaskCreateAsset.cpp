@@ -229,7 +229,9 @@ void UE::Interchange::FTaskCreatePackage::DoTask(ENamedThreads::Type CurrentThre
 		}
 		CreateAssetParams.ReimportObject = ReimportObject;
 		//Make sure the asset UObject is created with the correct type on the main thread
+		const double StartTime = FPlatformTime::Seconds();
 		UObject* NodeAsset = Factory->CreateEmptyAsset(CreateAssetParams);
+		AsyncHelper->AddImportProfileTime(TEXT("CreateEmptyAsset ") + Factory->GetClass()->GetName(), FPlatformTime::Seconds() - StartTime);
 		if (NodeAsset)
 		{
 			if (!NodeAsset->HasAnyInternalFlags(EInternalObjectFlags::Async))
@@ -353,7 +355,9 @@ void UE::Interchange::FTaskCreateAsset::DoTask(ENamedThreads::Type CurrentThread
 		}
 		CreateAssetParams.ReimportObject = ReimportObject;
 
+		const double StartTime = FPlatformTime::Seconds();
 		NodeAsset = Factory->CreateAsset(CreateAssetParams);
+		AsyncHelper->AddImportProfileTime(TEXT("CreateAsset ") + Factory->GetClass()->GetName(), FPlatformTime::Seconds() - StartTime);
 	}
 	if (NodeAsset)
 	{
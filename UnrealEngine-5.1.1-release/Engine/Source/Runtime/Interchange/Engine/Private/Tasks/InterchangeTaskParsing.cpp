@@ -25,6 +25,13 @@
 #include "UObject/UObjectGlobals.h"
 #include "UObject/WeakObjectPtrTemplates.h"
 
+static int32 GInterchangeMaxConcurrentAssetTasks = 0;
+static FAutoConsoleVariableRef CCvarInterchangeMaxConcurrentAssetTasks(
+	TEXT("Interchange.FeatureFlags.Import.MaxConcurrentAssetTasks"),
+	GInterchangeMaxConcurrentAssetTasks,
+	TEXT("Maximum number of asset and scene object creation tasks an import runs at the same time. 0 uses half of the task graph worker threads."),
+	ECVF_Default);
+
 /**
  * For the Dependency sort to work the predicate must be transitive ( A > B > C implying A > C).
  * That means we must take into account the whole dependency chain, not just the immediate dependencies.
@@ -318,37 +325,40 @@ void UE::Interchange::FTaskParsing::DoTask(ENamedThreads::Type CurrentThread, co
 	};
 
 	FGraphEventArray CompletionPrerequistes;
-	const int32 PoolWorkerThreadCount = FTaskGraphInterface::Get().GetNumWorkerThreads() / 2;
+	const int32 PoolWorkerThreadCount = GInterchangeMaxConcurrentAssetTasks > 0 ? GInterchangeMaxConcurrentAssetTasks : FTaskGraphInterface::Get().GetNumWorkerThreads() / 2;
 	const int32 MaxNumWorker = FMath::Max(PoolWorkerThreadCount, 1);
-	FGraphEventArray GroupPrerequistes;
+	//Tasks are sorted so that dependencies come first, map each UniqueID to its task to find the dependencies without searching all the previous tasks
+	TMap<FString, int32> TaskIndexPerUniqueID;
+	TaskIndexPerUniqueID.Reserve(TaskDatas.Num());
 	for (int32 TaskIndex = 0; TaskIndex < TaskDatas.Num(); ++TaskIndex)
 	{
 		FTaskData& TaskData = TaskDatas[TaskIndex];
 
-		if (TaskData.Dependencies.Num() > 0)
+		for (const FString& DependencyID : TaskData.Dependencies)
 		{
-			//Search the previous node to find the dependence
-			for (int32 DepTaskIndex = 0; DepTaskIndex < TaskIndex; ++DepTaskIndex)
+			if (const int32* DepTaskIndex = TaskIndexPerUniqueID.Find(DependencyID))
 			{
-				if (TaskData.Dependencies.Contains(TaskDatas[DepTaskIndex].UniqueID))
-				{
-					//Add has prerequisite
-					TaskData.Prerequisites.Add(TaskDatas[DepTaskIndex].GraphEventRef);
-				}
+				//Add has prerequisite
+				TaskData.Prerequisites.AddUnique(TaskDatas[*DepTaskIndex].GraphEventRef);
 			}
 		}
 
-		//Append the group prerequisite to the task data prerequisite if the group is full
-		//This allow to chain the group dependencies to control the number of task
-		if (GroupPrerequistes.Num() >= MaxNumWorker)
+		//Chain each task to the one started MaxNumWorker tasks before it to control the number of tasks in flight,
+		//a new task can start as soon as any earlier one is done instead of waiting for the slowest task of a whole group
+		if (TaskIndex >= MaxNumWorker)
 		{
-			TaskData.Prerequisites.Append(GroupPrerequistes);
-			GroupPrerequistes.Reset();
+			TaskData.Prerequisites.AddUnique(TaskDatas[TaskIndex - MaxNumWorker].GraphEventRef);
 		}
 		TaskData.GraphEventRef = CreateTasksFromData(TaskData);
-		GroupPrerequistes.Add(TaskData.GraphEventRef);
+		//The tasks of each source are contiguous, keep the latest task so a UniqueID resolves to the task of the same source
+		TaskIndexPerUniqueID.Add(TaskData.UniqueID, TaskIndex);
+	}
+
+	//The tasks of the last window are not a prerequisite of any other task
+	for (int32 TaskIndex = FMath::Max(TaskDatas.Num() - MaxNumWorker, 0); TaskIndex < TaskDatas.Num(); ++TaskIndex)
+	{
+		CompletionPrerequistes.Add(TaskDatas[TaskIndex].GraphEventRef);
 	}
-	CompletionPrerequistes.Append(GroupPrerequistes);
 
 	if (!RenameAssets.IsEmpty())
 	{
@@ -47,7 +47,9 @@ void UE::Interchange::FTaskTranslator::DoTask(ENamedThreads::Type CurrentThread,
 
 	//Translate the source data
 	UInterchangeBaseNodeContainer& BaseNodeContainer = *(AsyncHelper->BaseNodeContainers[SourceIndex].Get());
+	const double StartTime = FPlatformTime::Seconds();
 	Translator->Translate(BaseNodeContainer);
+	AsyncHelper->AddImportProfileTime(TEXT("Translate ") + Translator->GetClass()->GetName(), FPlatformTime::Seconds() - StartTime);
 	//Make sure the base node container cache is computed for all translated node
 	BaseNodeContainer.ComputeChildrenCache();
 }
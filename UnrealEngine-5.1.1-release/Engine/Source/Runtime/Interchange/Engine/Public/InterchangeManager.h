@@ -232,6 +232,21 @@ namespace UE
 			FCriticalSection ImportedSceneObjectsPerSourceIndexLock;
 			TMap<int32, TArray<FImportedObjectInfo>> ImportedSceneObjectsPerSourceIndex;
 
+			//Time spent in each step of the import, Key is the step name, e.g. the translator or factory class name
+			struct FImportProfileEntry
+			{
+				int32 Count = 0;
+				double TotalSeconds = 0.0;
+				double MaxSeconds = 0.0;
+			};
+
+			FCriticalSection ImportProfileLock;
+			TMap<FString, FImportProfileEntry> ImportProfile;
+			double ImportStartTime = 0.0;
+
+			//Thread safe, add the time of one step to the import profile
+			void AddImportProfileTime(const FString& StepName, double Seconds);
+
 			FImportAsyncHelperData TaskData;
 
 			FAssetImportResultRef AssetImportResult;
@@ -241,6 +256,7 @@ namespace UE
 			std::atomic<bool> bCancel;
 
 			void SendAnalyticImportEndData();
+			void LogImportProfileReport();
 			void ReleaseTranslatorsSource();
 			void InitCancel();
 			void CancelAndWaitUntilDoneSynchronously();
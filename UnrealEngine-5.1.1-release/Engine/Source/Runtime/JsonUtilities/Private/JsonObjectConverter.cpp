@@ -9,6 +9,7 @@
 #include "UObject/TextProperty.h"
 #include "UObject/PropertyPortFlags.h"
 #include "UObject/Package.h"
+#include "Misc/ScopeRWLock.h"
 #include "Policies/CondensedJsonPrintPolicy.h"
 #include "JsonObjectWrapper.h"
 
@@ -240,6 +241,111 @@ TSharedPtr<FJsonValue> FJsonObjectConverter::ObjectJsonCallback(FProperty* Prope
 
 PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
+namespace
+{
+	/** The JSON names of the properties of a struct, computed once per native struct instead of on every conversion */
+	struct FJsonStructPlan
+	{
+		struct FPropertyEntry
+		{
+			FProperty* Property;
+
+			/** Name matched against the JSON fields, and its case insensitive hash as used by the FJsonObject values */
+			FString AuthoredName;
+			uint32 AuthoredNameHash;
+
+			/** Name the property is written to JSON with */
+			FString StandardizedName;
+			uint32 StandardizedNameHash;
+		};
+
+		TArray<FPropertyEntry> Properties;
+
+		/** Indices into Properties by authored name, only built for cached plans */
+		TMap<FString, int32> PropertyIndicesByAuthoredName;
+
+		const FPropertyEntry* FindProperty(const FString& FieldName) const
+		{
+			if (PropertyIndicesByAuthoredName.Num() > 0)
+			{
+				const int32* PropertyIndex = PropertyIndicesByAuthoredName.Find(FieldName);
+				return PropertyIndex ? &Properties[*PropertyIndex] : nullptr;
+			}
+			return Properties.FindByPredicate([&FieldName](const FPropertyEntry& Entry) { return Entry.AuthoredName.Equals(FieldName, ESearchCase::IgnoreCase); });
+		}
+	};
+
+	bool IsNativeStruct(const UStruct* StructDefinition)
+	{
+		if (const UScriptStruct* ScriptStruct = Cast<UScriptStruct>(StructDefinition))
+		{
+			return (ScriptStruct->StructFlags & STRUCT_Native) != 0;
+		}
+		if (const UClass* Class = Cast<UClass>(StructDefinition))
+		{
+			return Class->HasAnyClassFlags(CLASS_Native);
+		}
+		return false;
+	}
+
+	TSharedRef<const FJsonStructPlan> BuildStructPlan(const UStruct* StructDefinition, const bool bIndexByName)
+	{
+		TSharedRef<FJsonStructPlan> Plan = MakeShared<FJsonStructPlan>();
+		for (TFieldIterator<FProperty> PropIt(StructDefinition); PropIt; ++PropIt)
+		{
+			FJsonStructPlan::FPropertyEntry& Entry = Plan->Properties.AddDefaulted_GetRef();
+			Entry.Property = *PropIt;
+			Entry.AuthoredName = StructDefinition->GetAuthoredNameForField(*PropIt);
+			Entry.AuthoredNameHash = GetTypeHash(Entry.AuthoredName);
+			Entry.StandardizedName = FJsonObjectConverter::StandardizeCase(PropIt->GetAuthoredName());
+			Entry.StandardizedNameHash = GetTypeHash(Entry.StandardizedName);
+		}
+
+		if (bIndexByName)
+		{
+			Plan->PropertyIndicesByAuthoredName.Reserve(Plan->Properties.Num());
+			for (int32 PropertyIndex = 0; PropertyIndex < Plan->Properties.Num(); ++PropertyIndex)
+			{
+				const FJsonStructPlan::FPropertyEntry& Entry = Plan->Properties[PropertyIndex];
+				// Keep the first match, like the iteration over the properties does
+				if (!Plan->PropertyIndicesByAuthoredName.FindByHash(Entry.AuthoredNameHash, Entry.AuthoredName))
+				{
+					Plan->PropertyIndicesByAuthoredName.AddByHash(Entry.AuthoredNameHash, Entry.AuthoredName, PropertyIndex);
+				}
+			}
+		}
+		return Plan;
+	}
+
+	/**
+	 * Plans of native structs are cached, as their properties can't change. Other structs, such as user defined structs
+	 * which can be recompiled in place, get a new plan for each conversion.
+	 */
+	TSharedRef<const FJsonStructPlan> GetStructPlan(const UStruct* StructDefinition)
+	{
+		if (!IsNativeStruct(StructDefinition))
+		{
+			return BuildStructPlan(StructDefinition, false);
+		}
+
+		static FRWLock StructPlansLock;
+		static TMap<TWeakObjectPtr<const UStruct>, TSharedRef<const FJsonStructPlan>> StructPlans;
+
+		const TWeakObjectPtr<const UStruct> StructKey(StructDefinition);
+		{
+			FReadScopeLock ReadLock(StructPlansLock);
+			if (const TSharedRef<const FJsonStructPlan>* Plan = StructPlans.Find(StructKey))
+			{
+				return *Plan;
+			}
+		}
+
+		TSharedRef<const FJsonStructPlan> NewPlan = BuildStructPlan(StructDefinition, true);
+		FWriteScopeLock WriteLock(StructPlansLock);
+		return StructPlans.FindOrAdd(StructKey, NewPlan);
+	}
+}
+
 TSharedPtr<FJsonValue> FJsonObjectConverter::UPropertyToJsonValue(FProperty* Property, const void* Value, int64 CheckFlags, int64 SkipFlags, const CustomExportCallback* ExportCb, FProperty* OuterProperty)
 {
 	if (Property->ArrayDim == 1)
@@ -280,9 +386,10 @@ bool FJsonObjectConverter::UStructToJsonAttributes(const UStruct* StructDefiniti
 		return true;
 	}
 
-	for (TFieldIterator<FProperty> It(StructDefinition); It; ++It)
+	const TSharedRef<const FJsonStructPlan> StructPlan = GetStructPlan(StructDefinition);
+	for (const FJsonStructPlan::FPropertyEntry& PropertyEntry : StructPlan->Properties)
 	{
-		FProperty* Property = *It;
+		FProperty* Property = PropertyEntry.Property;
 
 		// Check to see if we should ignore this property
 		if (CheckFlags != 0 && !Property->HasAnyPropertyFlags(CheckFlags))
@@ -294,7 +401,6 @@ bool FJsonObjectConverter::UStructToJsonAttributes(const UStruct* StructDefiniti
 			continue;
 		}
 
-		FString VariableName = StandardizeCase(Property->GetAuthoredName());
 		const void* Value = Property->ContainerPtrToValuePtr<uint8>(Struct);
 
 		// convert the property to a FJsonValue
@@ -307,7 +413,7 @@ bool FJsonObjectConverter::UStructToJsonAttributes(const UStruct* StructDefiniti
 		}
 
 		// set the value on the output object
-		OutJsonAttributes.Add(VariableName, JsonValue);
+		OutJsonAttributes.AddByHash(PropertyEntry.StandardizedNameHash, PropertyEntry.StandardizedName, JsonValue);
 	}
 
 	return true;
@@ -945,9 +1051,10 @@ namespace
 		}
 
 		// iterate over the struct properties
-		for (TFieldIterator<FProperty> PropIt(StructDefinition); PropIt; ++PropIt)
+		const TSharedRef<const FJsonStructPlan> StructPlan = GetStructPlan(StructDefinition);
+		for (const FJsonStructPlan::FPropertyEntry& PropertyEntry : StructPlan->Properties)
 		{
-			FProperty* Property = *PropIt;
+			FProperty* Property = PropertyEntry.Property;
 
 			// Check to see if we should ignore this property
 			if (CheckFlags != 0 && !Property->HasAnyPropertyFlags(CheckFlags))
@@ -960,8 +1067,8 @@ namespace
 			}
 
 			// find a JSON value matching this property name
-			FString PropertyName = StructDefinition->GetAuthoredNameForField(Property);
-			const TSharedPtr<FJsonValue>* JsonValue = JsonAttributes.Find(PropertyName);
+			const FString& PropertyName = PropertyEntry.AuthoredName;
+			const TSharedPtr<FJsonValue>* JsonValue = JsonAttributes.FindByHash(PropertyEntry.AuthoredNameHash, PropertyName);
 			
 			if (!JsonValue)
 			{
@@ -1004,6 +1111,196 @@ namespace
 
 		return true;
 	}
+
+	/** Reads the value whose notation the reader just returned, including all of its children for objects and arrays */
+	TSharedPtr<FJsonValue> ReadJsonValue(TJsonReader<TCHAR>& Reader, EJsonNotation Notation)
+	{
+		switch (Notation)
+		{
+		case EJsonNotation::ObjectStart:
+			{
+				TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+				EJsonNotation ChildNotation = EJsonNotation::Error;
+				while (Reader.ReadNext(ChildNotation) && ChildNotation != EJsonNotation::ObjectEnd)
+				{
+					// The identifier is overwritten while reading children
+					FString Identifier = Reader.GetIdentifier();
+					TSharedPtr<FJsonValue> ChildValue = ReadJsonValue(Reader, ChildNotation);
+					if (!ChildValue.IsValid())
+					{
+						return nullptr;
+					}
+					Object->SetField(Identifier, ChildValue);
+				}
+				return ChildNotation == EJsonNotation::ObjectEnd ? MakeShared<FJsonValueObject>(Object) : TSharedPtr<FJsonValue>();
+			}
+
+		case EJsonNotation::ArrayStart:
+			{
+				TArray<TSharedPtr<FJsonValue>> Array;
+				EJsonNotation ChildNotation = EJsonNotation::Error;
+				while (Reader.ReadNext(ChildNotation) && ChildNotation != EJsonNotation::ArrayEnd)
+				{
+					TSharedPtr<FJsonValue> ChildValue = ReadJsonValue(Reader, ChildNotation);
+					if (!ChildValue.IsValid())
+					{
+						return nullptr;
+					}
+					Array.Add(ChildValue);
+				}
+				return ChildNotation == EJsonNotation::ArrayEnd ? MakeShared<FJsonValueArray>(Array) : TSharedPtr<FJsonValue>();
+			}
+
+		case EJsonNotation::Boolean:
+			return MakeShared<FJsonValueBoolean>(Reader.GetValueAsBoolean());
+
+		case EJsonNotation::String:
+			return MakeShared<FJsonValueString>(Reader.GetValueAsString());
+
+		case EJsonNotation::Number:
+			return MakeShared<FJsonValueNumber>(Reader.GetValueAsNumber());
+
+		case EJsonNotation::Null:
+			return MakeShared<FJsonValueNull>();
+
+		default:
+			return nullptr;
+		}
+	}
+
+	/** Finds the property a JSON field is imported into, matching authored names case insensitively like the FJsonObject lookups */
+	FProperty* FindPropertyForJsonField(const FJsonStructPlan& StructPlan, const FString& FieldName, int64 CheckFlags, int64 SkipFlags)
+	{
+		const FJsonStructPlan::FPropertyEntry* PropertyEntry = StructPlan.FindProperty(FieldName);
+		FProperty* Property = PropertyEntry ? PropertyEntry->Property : nullptr;
+		if (!Property || (CheckFlags != 0 && !Property->HasAnyPropertyFlags(CheckFlags)) || Property->HasAnyPropertyFlags(SkipFlags))
+		{
+			return nullptr;
+		}
+		return Property;
+	}
+
+	bool ReportReaderError(const TJsonReader<TCHAR>& Reader, FText* OutFailReason)
+	{
+		UE_LOG(LogJson, Error, TEXT("JsonReaderToUStruct - Unable to parse JSON: %s"), *Reader.GetErrorMessage());
+		if (OutFailReason)
+		{
+			*OutFailReason = FText::Format(LOCTEXT("FailParseJson", "Unable to parse JSON: {0}"), FText::FromString(Reader.GetErrorMessage()));
+		}
+		return false;
+	}
+
+	/** Reads the members of the JSON object whose start the reader just returned into the struct, until the matching end of the object */
+	bool JsonReaderToUStructWithContainer(TJsonReader<TCHAR>& Reader, const UStruct* StructDefinition, void* OutStruct, const UStruct* ContainerStruct, void* Container, int64 CheckFlags, int64 SkipFlags, const bool bStrictMode, FText* OutFailReason)
+	{
+		if (bStrictMode || StructDefinition == FJsonObjectWrapper::StaticStruct())
+		{
+			// Both need the object as a whole, to report missing values or to be stored as is
+			TSharedPtr<FJsonValue> ObjectValue = ReadJsonValue(Reader, EJsonNotation::ObjectStart);
+			if (!ObjectValue.IsValid())
+			{
+				return ReportReaderError(Reader, OutFailReason);
+			}
+			return JsonAttributesToUStructWithContainer(ObjectValue->AsObject()->Values, StructDefinition, OutStruct, ContainerStruct, Container, CheckFlags, SkipFlags, bStrictMode, OutFailReason);
+		}
+
+		const TSharedRef<const FJsonStructPlan> StructPlan = GetStructPlan(StructDefinition);
+		EJsonNotation Notation = EJsonNotation::Error;
+		while (Reader.ReadNext(Notation) && Notation != EJsonNotation::ObjectEnd)
+		{
+			if (Notation == EJsonNotation::Error)
+			{
+				return ReportReaderError(Reader, OutFailReason);
+			}
+
+			FProperty* Property = FindPropertyForJsonField(*StructPlan, Reader.GetIdentifier(), CheckFlags, SkipFlags);
+			if (!Property)
+			{
+				if ((Notation == EJsonNotation::ObjectStart && !Reader.SkipObject()) || (Notation == EJsonNotation::ArrayStart && !Reader.SkipArray()))
+				{
+					return ReportReaderError(Reader, OutFailReason);
+				}
+				continue;
+			}
+
+			if (Notation == EJsonNotation::Null)
+			{
+				continue;
+			}
+
+			void* Value = Property->ContainerPtrToValuePtr<uint8>(OutStruct);
+			FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+			FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property);
+			FStructProperty* InnerStructProperty = ArrayProperty ? CastField<FStructProperty>(ArrayProperty->Inner) : nullptr;
+
+			bool bImported = true;
+			if (Notation == EJsonNotation::ObjectStart && StructProperty && Property->ArrayDim == 1)
+			{
+				bImported = JsonReaderToUStructWithContainer(Reader, StructProperty->Struct, Value, ContainerStruct, Container, CheckFlags & (~CPF_ParmFlags), SkipFlags, bStrictMode, OutFailReason);
+			}
+			else if (Notation == EJsonNotation::ArrayStart && InnerStructProperty)
+			{
+				// Same as the JSON array import, the elements already in the array are imported into and the array is resized to the JSON array
+				FScriptArrayHelper Helper(ArrayProperty, Value);
+				int32 NumElements = 0;
+				EJsonNotation ElementNotation = EJsonNotation::Error;
+				while (bImported && Reader.ReadNext(ElementNotation) && ElementNotation != EJsonNotation::ArrayEnd)
+				{
+					const int32 ElementIndex = NumElements < Helper.Num() ? NumElements : Helper.AddValue();
+					++NumElements;
+
+					if (ElementNotation == EJsonNotation::ObjectStart)
+					{
+						bImported = JsonReaderToUStructWithContainer(Reader, InnerStructProperty->Struct, Helper.GetRawPtr(ElementIndex), ContainerStruct, Container, CheckFlags & (~CPF_ParmFlags), SkipFlags, bStrictMode, OutFailReason);
+					}
+					else if (ElementNotation != EJsonNotation::Null)
+					{
+						const TSharedPtr<FJsonValue> ElementValue = ReadJsonValue(Reader, ElementNotation);
+						if (!ElementValue.IsValid())
+						{
+							return ReportReaderError(Reader, OutFailReason);
+						}
+						bImported = JsonValueToFPropertyWithContainer(ElementValue, InnerStructProperty, Helper.GetRawPtr(ElementIndex), ContainerStruct, Container, CheckFlags & (~CPF_ParmFlags), SkipFlags, bStrictMode, OutFailReason);
+					}
+				}
+
+				if (bImported)
+				{
+					if (ElementNotation != EJsonNotation::ArrayEnd)
+					{
+						return ReportReaderError(Reader, OutFailReason);
+					}
+					Helper.Resize(NumElements);
+				}
+			}
+			else
+			{
+				const TSharedPtr<FJsonValue> JsonValue = ReadJsonValue(Reader, Notation);
+				if (!JsonValue.IsValid())
+				{
+					return ReportReaderError(Reader, OutFailReason);
+				}
+				bImported = JsonValueToFPropertyWithContainer(JsonValue, Property, Value, ContainerStruct, Container, CheckFlags, SkipFlags, bStrictMode, OutFailReason);
+			}
+
+			if (!bImported)
+			{
+				const FString PropertyName = Property->GetAuthoredName();
+				UE_LOG(LogJson, Error, TEXT("JsonReaderToUStruct - Unable to import JSON value into property %s"), *PropertyName);
+				if (OutFailReason)
+				{
+					*OutFailReason = FText::Format(LOCTEXT("FailImportValueToProperty", "Unable to import JSON value into property {0}\n{1}"), FText::FromString(PropertyName), *OutFailReason);
+				}
+				return false;
+			}
+		}
+
+		if (Notation != EJsonNotation::ObjectEnd)
+		{
+			return ReportReaderError(Reader, OutFailReason);
+		}
+		return true;
+	}
 }
 
 bool FJsonObjectConverter::JsonValueToUProperty(const TSharedPtr<FJsonValue>& JsonValue, FProperty* Property, void* OutValue, int64 CheckFlags, int64 SkipFlags, const bool bStrictMode, FText* OutFailReason)
@@ -1021,6 +1318,22 @@ bool FJsonObjectConverter::JsonAttributesToUStruct(const TMap< FString, TSharedP
 	return JsonAttributesToUStructWithContainer(JsonAttributes, StructDefinition, OutStruct, StructDefinition, OutStruct, CheckFlags, SkipFlags, bStrictMode, OutFailReason);
 }
 
+bool FJsonObjectConverter::JsonReaderToUStruct(TJsonReader<TCHAR>& JsonReader, const UStruct* StructDefinition, void* OutStruct, int64 CheckFlags, int64 SkipFlags, const bool bStrictMode, FText* OutFailReason)
+{
+	EJsonNotation Notation = EJsonNotation::Error;
+	if (!JsonReader.ReadNext(Notation) || Notation != EJsonNotation::ObjectStart)
+	{
+		UE_LOG(LogJson, Error, TEXT("JsonReaderToUStruct - Expecting JSON object %s"), *JsonReader.GetErrorMessage());
+		if (OutFailReason)
+		{
+			*OutFailReason = LOCTEXT("ExpectingJsonObject", "Expecting JSON object");
+		}
+		return false;
+	}
+
+	return JsonReaderToUStructWithContainer(JsonReader, StructDefinition, OutStruct, StructDefinition, OutStruct, CheckFlags, SkipFlags, bStrictMode, OutFailReason);
+}
+
 //static 
 bool FJsonObjectConverter::GetTextFromField(const FString& FieldName, const TSharedPtr<FJsonValue>& FieldValue, FText& TextOut)
 {
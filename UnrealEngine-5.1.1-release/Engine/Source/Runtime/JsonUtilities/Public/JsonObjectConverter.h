@@ -227,6 +227,41 @@ public: // JSON -> UStruct
 	 */
 	static bool JsonAttributesToUStruct(const TMap< FString, TSharedPtr<FJsonValue> >& JsonAttributes, const UStruct* StructDefinition, void* OutStruct, int64 CheckFlags = 0, int64 SkipFlags = 0, const bool bStrictMode = false, FText* OutFailReason = nullptr);
 
+	/**
+	 * Converts the JSON object read next from the reader to a UStruct, without building a FJsonObject for the whole payload.
+	 * Nested structs and arrays of structs are filled in as they are read, the values of other properties go through an intermediate
+	 * JsonValue each so the result matches JsonObjectToUStruct. Fields that don't match a property are skipped without being stored.
+	 *
+	 * @param JsonReader Reader positioned before the JSON object to copy data out of
+	 * @param StructDefinition UStruct definition that is looked over for properties
+	 * @param OutStruct The UStruct instance to copy in to
+	 * @param CheckFlags Only convert properties that match at least one of these flags. If 0 check all properties.
+	 * @param SkipFlags Skip properties that match any of these flags
+	 * @param bStrictMode Whether to strictly check the json attributes, which reads the object as a whole to detect missing values
+	 * @param OutFailReason Reason of the failure if any
+	 *
+	 * @return False if the JSON is malformed or any properties matched but failed to deserialize
+	 */
+	static bool JsonReaderToUStruct(TJsonReader<TCHAR>& JsonReader, const UStruct* StructDefinition, void* OutStruct, int64 CheckFlags = 0, int64 SkipFlags = 0, const bool bStrictMode = false, FText* OutFailReason = nullptr);
+
+	/**
+	 * Templated version of JsonReaderToUStruct
+	 *
+	 * @param JsonReader Reader positioned before the JSON object to copy data out of
+	 * @param OutStruct The UStruct instance to copy in to
+	 * @param CheckFlags Only convert properties that match at least one of these flags. If 0 check all properties.
+	 * @param SkipFlags Skip properties that match any of these flags
+	 * @param bStrictMode Whether to strictly check the json attributes
+	 * @param OutFailReason Reason of the failure if any
+	 *
+	 * @return False if the JSON is malformed or any properties matched but failed to deserialize
+	 */
+	template<typename OutStructType>
+	static bool JsonReaderToUStruct(TJsonReader<TCHAR>& JsonReader, OutStructType* OutStruct, int64 CheckFlags = 0, int64 SkipFlags = 0, const bool bStrictMode = false, FText* OutFailReason = nullptr)
+	{
+		return JsonReaderToUStruct(JsonReader, OutStructType::StaticStruct(), OutStruct, CheckFlags, SkipFlags, bStrictMode, OutFailReason);
+	}
+
 	/**
 	 * Converts a single JsonValue to the corresponding FProperty (this may recurse if the property is a UStruct for instance).
 	 *
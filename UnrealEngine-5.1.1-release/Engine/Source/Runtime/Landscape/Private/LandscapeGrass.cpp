@@ -179,6 +179,12 @@ static FAutoConsoleVariableRef CVarGrassMaxCreatePerFrame(
 	GGrassMaxCreatePerFrame,
 	TEXT("Maximum number of Grass components to create per frame"));
 
+static float GGrassMaxUpdateTimePerFrameMs = 0.0f;
+static FAutoConsoleVariableRef CVarGrassMaxUpdateTimePerFrameMs(
+	TEXT("grass.MaxUpdateTimePerFrameMs"),
+	GGrassMaxUpdateTimePerFrameMs,
+	TEXT("When > 0, grass components keep being created and finished async builds keep being accepted on a frame until the grass update of all landscapes took this many milliseconds, instead of the grass.MaxCreatePerFrame count and one build per frame. Lets fast moving cameras catch up with the grass around them."));
+
 static int32 GGrassUpdateAllOnRebuild = 0;
 static FAutoConsoleVariableRef CVarUpdateAllOnRebuild(
 	TEXT("grass.UpdateAllOnRebuild"),
@@ -2363,6 +2369,47 @@ void ALandscapeProxy::GetGrassTypes(const UWorld* World, UMaterialInterface* Lan
 
 static uint32 GGrassExclusionChangeTag = 1;
 static uint32 GFrameNumberLastStaleCheck = 0;
+
+/** Per frame budget of grass.MaxUpdateTimePerFrameMs, shared by the grass updates of all the landscape proxies of the frame */
+struct FGrassUpdateTimeBudget
+{
+	FGrassUpdateTimeBudget()
+		: StartTime(FPlatformTime::Seconds())
+	{
+		if (FrameNumber != GFrameNumber)
+		{
+			FrameNumber = GFrameNumber;
+			TimeThisFrame = 0.0;
+		}
+	}
+
+	~FGrassUpdateTimeBudget()
+	{
+		TimeThisFrame += FPlatformTime::Seconds() - StartTime;
+	}
+
+	bool IsEnabled() const
+	{
+		return GGrassMaxUpdateTimePerFrameMs > 0.0f;
+	}
+
+	bool IsExhausted() const
+	{
+		return (TimeThisFrame + FPlatformTime::Seconds() - StartTime) * 1000.0 >= GGrassMaxUpdateTimePerFrameMs;
+	}
+
+	bool CanCreateComponent(int32 NumCompsCreated) const
+	{
+		return IsEnabled() ? !IsExhausted() : NumCompsCreated < GGrassMaxCreatePerFrame;
+	}
+
+	double StartTime;
+	static uint32 FrameNumber;
+	static double TimeThisFrame;
+};
+
+uint32 FGrassUpdateTimeBudget::FrameNumber = 0;
+double FGrassUpdateTimeBudget::TimeThisFrame = 0.0;
 static TMap<FWeakObjectPtr, FBox> GGrassExclusionBoxes;
 
 void ALandscapeProxy::AddExclusionBox(FWeakObjectPtr Owner, const FBox& BoxToRemove)
@@ -2683,6 +2730,8 @@ void ALandscapeProxy::UpdateGrass(const TArray<FVector>& Cameras, int32& InOutNu
 		return;
 	}
 
+	const FGrassUpdateTimeBudget TimeBudget;
+
 	if (GFrameNumberLastStaleCheck != GFrameNumber && GIgnoreExcludeBoxes == 0)
 	{
 		GFrameNumberLastStaleCheck = GFrameNumber;
@@ -2954,7 +3003,7 @@ void ALandscapeProxy::UpdateGrass(const TArray<FVector>& Cameras, int32& InOutNu
 											}
 										}
 
-										if (!bRebuildForBoxes && !bForceSync && (InOutNumCompsCreated >= GGrassMaxCreatePerFrame || AsyncFoliageTasks.Num() >= MaxTasks))
+										if (!bRebuildForBoxes && !bForceSync && (!TimeBudget.CanCreateComponent(InOutNumCompsCreated) || AsyncFoliageTasks.Num() >= MaxTasks))
 										{
 											continue; // one per frame, but we still want to touch the existing ones and we must do the rebuilds because we changed the tag
 										}
@@ -3343,9 +3392,9 @@ void ALandscapeProxy::UpdateGrass(const TArray<FVector>& Cameras, int32& InOutNu
 					Existing->Touch();
 				}
 				delete Task;
-				if (!bForceSync)
+				if (!bForceSync && (!TimeBudget.IsEnabled() || TimeBudget.IsExhausted()))
 				{
-					break; // one per frame is fine
+					break; // one per frame is fine, unless there is time left in the update budget
 				}
 			}
 		}
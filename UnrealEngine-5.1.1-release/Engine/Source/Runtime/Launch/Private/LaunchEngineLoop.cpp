@@ -5,6 +5,7 @@
 #include "HAL/PlatformStackWalk.h"
 #include "HAL/PlatformOutputDevices.h"
 #include "HAL/LowLevelMemTracker.h"
+#include "HAL/MallocFrameArena.h"
 #include "HAL/MallocFrameProfiler.h"
 #include "Misc/MessageDialog.h"
 #include "Misc/ScopedSlowTask.h"
@@ -248,6 +249,7 @@ class FFeedbackContext;
 	#include "FramePro/FrameProProfiler.h"
 	#include "ProfilingDebugging/CsvProfiler.h"
 	#include "ProfilingDebugging/TracingProfiler.h"
+	#include "ProfilingDebugging/FrameTelemetry.h"
 #endif
 
 #if defined(WITH_LAUNCHERCHECK) && WITH_LAUNCHERCHECK
@@ -2476,6 +2478,9 @@ PRAGMA_DISABLE_DEPRECATION_WARNINGS
 	FTracingProfiler::Get()->Init();
 PRAGMA_ENABLE_DEPRECATION_WARNINGS
 #endif
+#if WITH_ENGINE && WITH_FRAME_TELEMETRY
+	FFrameTelemetry::Get().Init();
+#endif
 #if WITH_ENGINE && FRAMEPRO_ENABLED
 	FFrameProProfiler::Initialize();
 #endif // FRAMEPRO_ENABLED
@@ -5620,6 +5625,9 @@ void FEngineLoop::Tick()
 		}
 #endif
 
+		// Allocations made from the frame arena during the previous frame may be recycled from here on.
+		FFrameArena::EndFrame();
+
 		FCoreDelegates::OnEndFrame.Broadcast();
 
 		// end of RDG resource dump
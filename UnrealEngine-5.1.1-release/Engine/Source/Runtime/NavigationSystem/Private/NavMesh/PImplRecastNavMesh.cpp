@@ -2,6 +2,7 @@
 
 #include "NavMesh/PImplRecastNavMesh.h"
 #include "NavigationSystem.h"
+#include "Misc/ScopeLock.h"
 
 #if WITH_RECAST
 
@@ -37,13 +38,13 @@ static_assert(TIsSame<FVector::FReal, duReal>::Value, "FReal and duReal must be
 
 /// Helper for accessing navigation query from different threads
 #define INITIALIZE_NAVQUERY_SIMPLE(NavQueryVariable, NumNodes)	\
-	dtNavMeshQuery NavQueryVariable##Private;	\
-	dtNavMeshQuery& NavQueryVariable = IsInGameThread() ? SharedNavQuery : NavQueryVariable##Private; \
+	const FScopedNavQuery NavQueryVariable##Scope(*this);	\
+	dtNavMeshQuery& NavQueryVariable = NavQueryVariable##Scope.Get(); \
 	NavQueryVariable.init(DetourNavMesh, NumNodes);
 
 #define INITIALIZE_NAVQUERY(NavQueryVariable, NumNodes, LinkFilter)	\
-	dtNavMeshQuery NavQueryVariable##Private;	\
-	dtNavMeshQuery& NavQueryVariable = IsInGameThread() ? SharedNavQuery : NavQueryVariable##Private; \
+	const FScopedNavQuery NavQueryVariable##Scope(*this);	\
+	dtNavMeshQuery& NavQueryVariable = NavQueryVariable##Scope.Get(); \
 	NavQueryVariable.init(DetourNavMesh, NumNodes, &LinkFilter);
 
 static void* DetourMalloc(int Size, dtAllocHint Hint)
@@ -460,6 +461,39 @@ FPImplRecastNavMesh::~FPImplRecastNavMesh()
 	DEC_DWORD_STAT_BY( STAT_NavigationMemory, sizeof(*this) );
 };
 
+FPImplRecastNavMesh::FScopedNavQuery::FScopedNavQuery(const FPImplRecastNavMesh& InOwner)
+	: Owner(InOwner)
+{
+	if (IsInGameThread())
+	{
+		NavQuery = &Owner.SharedNavQuery;
+		return;
+	}
+
+	{
+		FScopeLock Lock(&Owner.NavQueryPoolLock);
+		if (Owner.NavQueryPool.Num() > 0)
+		{
+			PooledNavQuery = Owner.NavQueryPool.Pop(/*bAllowShrinking=*/false);
+		}
+	}
+
+	if (!PooledNavQuery.IsValid())
+	{
+		PooledNavQuery = MakeUnique<dtNavMeshQuery>();
+	}
+	NavQuery = PooledNavQuery.Get();
+}
+
+FPImplRecastNavMesh::FScopedNavQuery::~FScopedNavQuery()
+{
+	if (PooledNavQuery.IsValid())
+	{
+		FScopeLock Lock(&Owner.NavQueryPoolLock);
+		Owner.NavQueryPool.Push(MoveTemp(PooledNavQuery));
+	}
+}
+
 void FPImplRecastNavMesh::ReleaseDetourNavMesh()
 {
 	// release navmesh only if we own it
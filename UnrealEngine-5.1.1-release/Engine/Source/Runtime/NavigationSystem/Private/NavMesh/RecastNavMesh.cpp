@@ -42,13 +42,13 @@
 #if WITH_RECAST
 /// Helper for accessing navigation query from different threads
 #define INITIALIZE_NAVQUERY(NavQueryVariable, NumNodes)	\
-	dtNavMeshQuery NavQueryVariable##Private;	\
-	dtNavMeshQuery& NavQueryVariable = IsInGameThread() ? RecastNavMeshImpl->SharedNavQuery : NavQueryVariable##Private; \
+	const FPImplRecastNavMesh::FScopedNavQuery NavQueryVariable##Scope(*RecastNavMeshImpl);	\
+	dtNavMeshQuery& NavQueryVariable = NavQueryVariable##Scope.Get(); \
 	NavQueryVariable.init(RecastNavMeshImpl->DetourNavMesh, NumNodes);
 
 #define INITIALIZE_NAVQUERY_WLINKFILTER(NavQueryVariable, NumNodes, LinkFilter)	\
-	dtNavMeshQuery NavQueryVariable##Private;	\
-	dtNavMeshQuery& NavQueryVariable = IsInGameThread() ? RecastNavMeshImpl->SharedNavQuery : NavQueryVariable##Private; \
+	const FPImplRecastNavMesh::FScopedNavQuery NavQueryVariable##Scope(*RecastNavMeshImpl);	\
+	dtNavMeshQuery& NavQueryVariable = NavQueryVariable##Scope.Get(); \
 	NavQueryVariable.init(RecastNavMeshImpl->DetourNavMesh, NumNodes, &LinkFilter);
 
 #endif // WITH_RECAST
@@ -54,6 +54,9 @@
 
 CSV_DEFINE_CATEGORY(NAVREGEN, false);
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pending dirty tiles"), STAT_Navigation_PendingDirtyTiles, STATGROUP_Navigation);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Max tile rebuild latency (ms)"), STAT_Navigation_TileRebuildLatency, STATGROUP_Navigation);
+
 struct dtTileCacheAlloc;
 
 //Experimental debug tools
@@ -67,6 +70,12 @@ static FAutoConsoleVariableRef NavmeshVarDebugTileX(TEXT("n.GNavmeshDebugTileX")
 static FAutoConsoleVariableRef NavmeshVarDebugTileY(TEXT("n.GNavmeshDebugTileY"), GNavmeshDebugTileY, TEXT(""), ECVF_Default);
 #endif //RECAST_INTERNAL_DEBUG_DATA
 
+static float GNavmeshPendingTilesSortInterval = 0.5f;
+static FAutoConsoleVariableRef NavmeshVarPendingTilesSortInterval(TEXT("n.NavmeshPendingTilesSortInterval"), GNavmeshPendingTilesSortInterval, TEXT("Interval in seconds between sorts of the pending dirty tiles by distance to the players, so tiles are rebuilt near the players as they move. 0 only sorts when tiles get dirtied."), ECVF_Default);
+
+static float GNavmeshTileRebuildMaxWaitTime = 10.f;
+static FAutoConsoleVariableRef NavmeshVarTileRebuildMaxWaitTime(TEXT("n.NavmeshTileRebuildMaxWaitTime"), GNavmeshTileRebuildMaxWaitTime, TEXT("Dirty tiles waiting longer than this many seconds are rebuilt first regardless of their distance to the players, so distant tiles are not starved. 0 disables it."), ECVF_Default);
+
 // Hotfixing this flag without rebuilding the data will cause decompression errors, equivalent to not having prebuilt navmesh data at all.
 static bool GNavmeshUseOodleCompression = true;
 static FAutoConsoleVariableRef NavmeshVarOodleCompression(TEXT("n.NavmeshUseOodleCompression"), GNavmeshUseOodleCompression, TEXT("Use Oodle for run-time tile cache compression/decompression. Optimized for size in editor, optimized for speed in standalone."), ECVF_Default);
@@ -4843,7 +4852,16 @@ void FRecastNavMeshGenerator::TickAsyncBuild(float DeltaSeconds)
 	const bool bDoAsyncDataGathering = GatherGeometryOnGameThread() == false;
 
 	const int32 NumTasksToSubmit = (bDoAsyncDataGathering ? 1 : MaxTileGeneratorTasks) - NumRunningTasks;
+
+	// Sort again from time to time as the players move, so the tiles around them keep being rebuilt first
+	if (GNavmeshPendingTilesSortInterval > 0.f && NumTasksToSubmit > 0 && PendingDirtyTiles.Num() > 1
+		&& FPlatformTime::Seconds() - LastPendingTilesSortTime >= GNavmeshPendingTilesSortInterval)
+	{
+		SortPendingBuildTiles();
+	}
+
 	TArray<FNavTileRef> UpdatedTileRefs = ProcessTileTasksAndGetUpdatedTiles(NumTasksToSubmit);
+	SET_DWORD_STAT(STAT_Navigation_PendingDirtyTiles, PendingDirtyTiles.Num());
 			
 	if (UpdatedTileRefs.Num() > 0)
 	{
@@ -5051,6 +5069,7 @@ void FRecastNavMeshGenerator::ReAddTiles(const TArray<FIntPoint>& Tiles)
 		if (ExistingElement)
 		{
 			ExistingElement->bRebuildGeometry |= Element.bRebuildGeometry;
+			ExistingElement->DirtyTime = FMath::Min(ExistingElement->DirtyTime, Element.DirtyTime);
 			// Append area bounds to existing list 
 			if (ExistingElement->bRebuildGeometry == false)
 			{
@@ -5749,6 +5768,7 @@ void FRecastNavMeshGenerator::MarkDirtyTiles(const TArray<FNavigationDirtyArea>&
 			const FPendingTileElement& DirtyElement = DirtyTiles[Id];
 
 			ExistingElement.bRebuildGeometry |= DirtyElement.bRebuildGeometry;
+			ExistingElement.DirtyTime = FMath::Min(ExistingElement.DirtyTime, DirtyElement.DirtyTime);
 			// Append area bounds to existing list 
 			if (ExistingElement.bRebuildGeometry == false)
 			{
@@ -5815,6 +5835,8 @@ void FRecastNavMeshGenerator::SortPendingBuildTiles()
 		return;
 	}
 
+	LastPendingTilesSortTime = FPlatformTime::Seconds();
+
 	TArray<FVector2D> SeedLocations;
 	GetSeedLocations(*CurWorld, SeedLocations);
 
@@ -5831,6 +5853,17 @@ void FRecastNavMeshGenerator::SortPendingBuildTiles()
 		// Calculate shortest distances between tiles and players
 		for (FPendingTileElement& Element : PendingDirtyTiles)
 		{
+			const double WaitTime = LastPendingTilesSortTime - Element.DirtyTime;
+			if (GNavmeshTileRebuildMaxWaitTime > 0.f && WaitTime > GNavmeshTileRebuildMaxWaitTime)
+			{
+				// Tiles waiting for too long go first, the longest waiting ones first
+				Element.SeedDistance = -WaitTime;
+				continue;
+			}
+
+			// Seeds may have moved since the last sort
+			Element.SeedDistance = TNumericLimits<FVector::FReal>::Max();
+
 			const FBox TileBox = FRecastTileGenerator::CalculateTileBounds(Element.Coord.X, Element.Coord.Y, FVector::ZeroVector, TotalNavBounds, TileSizeInWorldUnits);
 			FVector2D TileCenter2D = FVector2D(TileBox.GetCenter());
 			for (FVector2D SeedLocation : SeedLocations)
@@ -5931,6 +5964,7 @@ TArray<FNavTileRef> FRecastNavMeshGenerator::ProcessTileTasksAsyncAndGetUpdatedT
 
 		FPendingTileElement& PendingElement = PendingDirtyTiles[ElementIdx];
 		FRunningTileElement RunningElement(PendingElement.Coord);
+		RunningElement.DirtyTime = PendingElement.DirtyTime;
 		
 		// Make sure that we are not submitting generator for grid cell that is currently being regenerated
 		if (!RunningDirtyTiles.Contains(RunningElement))
@@ -5976,6 +6010,7 @@ TArray<FNavTileRef> FRecastNavMeshGenerator::ProcessTileTasksAsyncAndGetUpdatedT
 	}
 	
 	// Collect completed tasks and apply generated data to navmesh
+	double MaxRebuildLatency = 0.;
 	for (int32 Idx = RunningDirtyTiles.Num() - 1; Idx >=0; --Idx)
 	{
 		QUICK_SCOPE_CYCLE_COUNTER(STAT_RecastNavMeshGenerator_ProcessTileTasks_FinishedTasks);
@@ -5988,6 +6023,8 @@ TArray<FNavTileRef> FRecastNavMeshGenerator::ProcessTileTasksAsyncAndGetUpdatedT
 			// Add generated tiles to navmesh
 			if (!Element.bShouldDiscard)
 			{
+				MaxRebuildLatency = FMath::Max(MaxRebuildLatency, FPlatformTime::Seconds() - Element.DirtyTime);
+
 				FRecastTileGenerator& TileGenerator = *(Element.AsyncTask->GetTask().TileGenerator);
 				TArray<FNavTileRef> UpdatedTileRefs = AddGeneratedTilesAndGetUpdatedTiles(TileGenerator);
 				UpdatedTiles.Append(UpdatedTileRefs);
@@ -6011,6 +6048,12 @@ TArray<FNavTileRef> FRecastNavMeshGenerator::ProcessTileTasksAsyncAndGetUpdatedT
 		}
 	}
 
+	if (MaxRebuildLatency > 0.)
+	{
+		SET_FLOAT_STAT(STAT_Navigation_TileRebuildLatency, float(MaxRebuildLatency * 1000.));
+		CSV_CUSTOM_STAT(NAVREGEN, TileRebuildLatencyMs, float(MaxRebuildLatency * 1000.), ECsvCustomStatOp::Max);
+	}
+
 	return UpdatedTiles;
 }
 #endif
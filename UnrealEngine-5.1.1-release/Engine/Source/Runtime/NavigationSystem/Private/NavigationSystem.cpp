@@ -3,6 +3,7 @@
 #include "NavigationSystem.h"
 #include "NavigationDataHandler.h"
 #include "Misc/ScopeLock.h"
+#include "Async/ParallelFor.h"
 #include "Stats/StatsMisc.h"
 #include "Modules/ModuleManager.h"
 #include "AI/Navigation/NavAgentInterface.h"
@@ -154,6 +155,8 @@ DEFINE_STAT(STAT_DetourTileOffMeshSegsMemory);
 DEFINE_STAT(STAT_DetourTileClustersMemory);
 DEFINE_STAT(STAT_DetourTilePolyClustersMemory);
 
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Async pathfinding queries"), STAT_Navigation_AsyncPathfindingQueries, STATGROUP_Navigation);
+
 CSV_DEFINE_CATEGORY(NavigationSystem, false);
 CSV_DEFINE_CATEGORY(NavTasks, true);
 
@@ -1511,6 +1514,20 @@ FAutoConsoleTaskPriority CPrio_TriggerAsyncQueries(
 	ENamedThreads::NormalTaskPriority // if we don't have background threads, then use normal priority threads at normal task priority instead
 	);
 
+static bool GNavParallelAsyncPathfinding = true;
+static FAutoConsoleVariableRef CVarNavParallelAsyncPathfinding(
+	TEXT("ai.nav.ParallelAsyncPathfinding"),
+	GNavParallelAsyncPathfinding,
+	TEXT("If enabled, the batch of async pathfinding queries of a frame is processed in parallel on the task threads instead of one query after another."),
+	ECVF_Default);
+
+static int32 GNavParallelAsyncPathfindingMinBatchSize = 4;
+static FAutoConsoleVariableRef CVarNavParallelAsyncPathfindingMinBatchSize(
+	TEXT("ai.nav.ParallelAsyncPathfindingMinBatchSize"),
+	GNavParallelAsyncPathfindingMinBatchSize,
+	TEXT("Smallest batch of async pathfinding queries processed in parallel, smaller batches are processed on a single thread."),
+	ECVF_Default);
+
 
 void UNavigationSystemV1::TriggerAsyncQueries(TArray<FAsyncPathFindingQuery>& PathFindingQueries)
 {
@@ -1557,8 +1574,7 @@ void UNavigationSystemV1::PerformAsyncQueries(TArray<FAsyncPathFindingQuery> Pat
 		return;
 	}
 
-	int32 NumProcessed = 0;
-	for (FAsyncPathFindingQuery& Query : PathFindingQueries)
+	auto PerformQuery = [this](FAsyncPathFindingQuery& Query)
 	{
 		// @todo this is not necessarily the safest way to use UObjects outside of main thread. 
 		//	think about something else.
@@ -1580,20 +1596,69 @@ void UNavigationSystemV1::PerformAsyncQueries(TArray<FAsyncPathFindingQuery> Pat
 		{
 			Query.Result = ENavigationQueryResult::Error;
 		}
-		++NumProcessed;
+	};
+
+	const int32 NumQueries = PathFindingQueries.Num();
+	int32 NumProcessed = 0;
+	if (GNavParallelAsyncPathfinding && NumQueries >= FMath::Max(GNavParallelAsyncPathfindingMinBatchSize, 2))
+	{
+		TArray<uint8> ProcessedQueries;
+		ProcessedQueries.SetNumZeroed(NumQueries);
 
-		// Check for abort request from the main tread
-		if (bAbortAsyncQueriesRequested)
+		ParallelFor(NumQueries, [&PathFindingQueries, &ProcessedQueries, &PerformQuery, this](int32 QueryIndex)
 		{
-			break;
+			// Check for abort request from the main tread, queries not started yet are postponed
+			if (bAbortAsyncQueriesRequested)
+			{
+				return;
+			}
+
+			PerformQuery(PathFindingQueries[QueryIndex]);
+			ProcessedQueries[QueryIndex] = 1;
+		});
+
+		// Move the processed queries first, keeping the order of both processed and postponed ones
+		TArray<FAsyncPathFindingQuery> PostponedQueries;
+		for (int32 QueryIndex = 0; QueryIndex < NumQueries; ++QueryIndex)
+		{
+			if (ProcessedQueries[QueryIndex])
+			{
+				if (QueryIndex != NumProcessed)
+				{
+					PathFindingQueries[NumProcessed] = MoveTemp(PathFindingQueries[QueryIndex]);
+				}
+				++NumProcessed;
+			}
+			else
+			{
+				PostponedQueries.Add(MoveTemp(PathFindingQueries[QueryIndex]));
+			}
+		}
+
+		for (int32 PostponedIndex = 0; PostponedIndex < PostponedQueries.Num(); ++PostponedIndex)
+		{
+			PathFindingQueries[NumProcessed + PostponedIndex] = MoveTemp(PostponedQueries[PostponedIndex]);
+		}
+	}
+	else
+	{
+		for (FAsyncPathFindingQuery& Query : PathFindingQueries)
+		{
+			PerformQuery(Query);
+			++NumProcessed;
+
+			// Check for abort request from the main tread
+			if (bAbortAsyncQueriesRequested)
+			{
+				break;
+			}
 		}
 	}
 
-	const int32 NumQueries = PathFindingQueries.Num();
 	const int32 NumPostponed = NumQueries - NumProcessed;
 
 	// Queue remaining queries for next frame
-	if (bAbortAsyncQueriesRequested)
+	if (NumPostponed > 0)
 	{
 		AsyncPathFindingQueries.Append(PathFindingQueries.GetData() + NumProcessed, NumPostponed);
 	}
@@ -1601,6 +1666,9 @@ void UNavigationSystemV1::PerformAsyncQueries(TArray<FAsyncPathFindingQuery> Pat
 	// Append to list of completed queries to dispatch results in main thread
 	AsyncPathFindingCompletedQueries.Append(PathFindingQueries.GetData(), NumProcessed);
 
+	INC_DWORD_STAT_BY(STAT_Navigation_AsyncPathfindingQueries, NumProcessed);
+	CSV_CUSTOM_STAT(NavigationSystem, AsyncPathfindingQueries, NumProcessed, ECsvCustomStatOp::Accumulate);
+
 	UE_LOG(LogNavigation, Log, TEXT("Async pathfinding queries: %d completed, %d postponed to next frame"), NumProcessed, NumPostponed);
 }
 
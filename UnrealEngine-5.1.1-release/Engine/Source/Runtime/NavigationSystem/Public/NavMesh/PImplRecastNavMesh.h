@@ -238,6 +238,21 @@ public:
 	 *	@note no check if segment is on poly is performed. */
 	float CalcSegmentCostOnPoly(NavNodeRef PolyID, const dtQueryFilter* Filter, const FVector& StartLoc, const FVector& EndLoc) const;
 
+	/** Query to use for the scope: SharedNavQuery on the game thread, a pooled query otherwise.
+	 *	Pooled queries keep their node pool between uses, so queries made from worker threads don't allocate it every time. */
+	struct FScopedNavQuery
+	{
+		explicit FScopedNavQuery(const FPImplRecastNavMesh& InOwner);
+		~FScopedNavQuery();
+
+		dtNavMeshQuery& Get() const { return *NavQuery; }
+
+	private:
+		const FPImplRecastNavMesh& Owner;
+		TUniquePtr<dtNavMeshQuery> PooledNavQuery;
+		dtNavMeshQuery* NavQuery;
+	};
+
 	ARecastNavMesh* NavMeshOwner;
 	
 	/** Recast's runtime navmesh data that we can query against */
@@ -253,6 +268,10 @@ public:
 	/** query used for searching data on game thread */
 	mutable dtNavMeshQuery SharedNavQuery;
 
+	/** queries used for searching data outside of the game thread, see FScopedNavQuery */
+	mutable TArray<TUniquePtr<dtNavMeshQuery>> NavQueryPool;
+	mutable FCriticalSection NavQueryPoolLock;
+
 	/** Helper function to serialize a single Recast tile. */
 	static void SerializeRecastMeshTile(FArchive& Ar, int32 NavMeshVersion, unsigned char*& TileData, int32& TileDataSize);
 
@@ -549,6 +549,8 @@ struct FPendingTileElement
 	FIntPoint	Coord;
 	/** distance to seed, used for sorting pending tiles */
 	FVector::FReal SeedDistance;
+	/** time the tile was first marked dirty since its last rebuild, used for rebuild latency and to not starve distant tiles */
+	double		DirtyTime;
 	/** Whether we need a full rebuild for this tile grid cell */
 	bool		bRebuildGeometry;
 	/** We need to store dirty area bounds to check which cached layers needs to be regenerated
@@ -559,6 +561,7 @@ struct FPendingTileElement
 	FPendingTileElement()
 		: Coord(FIntPoint::NoneValue)
 		, SeedDistance(TNumericLimits<FVector::FReal>::Max())
+		, DirtyTime(FPlatformTime::Seconds())
 		, bRebuildGeometry(false)
 	{
 	}
@@ -610,6 +613,8 @@ struct FRunningTileElement
 	/** whether generated results should be discarded */
 	bool						bShouldDiscard; 
 	FRecastTileGeneratorTask*	AsyncTask;
+	/** time the tile was marked dirty, see FPendingTileElement::DirtyTime */
+	double						DirtyTime = 0.;
 };
 
 struct FTileTimestamp
@@ -944,6 +949,9 @@ protected:
 	FVector RcNavMeshOrigin;
 
 	double RebuildAllStartTime = 0;
+
+	/** Last time PendingDirtyTiles got sorted, they are sorted again periodically to follow the moving seed locations */
+	double LastPendingTilesSortTime = 0;
 	
 	uint32 bInitialized:1;
 
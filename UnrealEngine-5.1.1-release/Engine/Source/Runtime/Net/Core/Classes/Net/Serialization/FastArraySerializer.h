@@ -253,6 +253,7 @@ public:
 
 	FNetFastTArrayBaseState()
 	: ArrayReplicationKey(INDEX_NONE)
+	, bHasDeferredChanges(false)
 	{}
 
 	virtual bool IsStateEqual(INetDeltaBaseState* OtherState)
@@ -278,6 +279,9 @@ public:
 	TMap<int32, int32> IDToCLMap;
 
 	int32 ArrayReplicationKey;
+
+	/** True if some changed items were not written because of FFastArraySerializer::MaxChangedItemsPerUpdate, and must be written even if ArrayReplicationKey didn't change. */
+	bool bHasDeferredChanges;
 };
 
 
@@ -406,6 +410,7 @@ struct FFastArraySerializer
 #endif // WITH_PUSH_MODEL
 		, CachedNumItems(INDEX_NONE)
 		, CachedNumItemsToConsiderForWriting(INDEX_NONE)
+		, MaxChangedItemsPerUpdate(0)
 		, DeltaFlags(EFastArraySerializerDeltaFlags::None)
 	{
 		SetDeltaSerializationEnabled(true);
@@ -567,6 +572,23 @@ struct FFastArraySerializer
 		return DeltaFlags;
 	}
 
+	/**
+	 * Limits how many changed or added items are written to a connection in a single update.
+	 * Remaining items are written in the following updates, which spreads the replication of large arrays over several frames
+	 * instead of sending them in a single large bunch. Deletions are never deferred.
+	 *
+	 * @param InMaxChangedItemsPerUpdate	Maximum number of items written per update, 0 to write all of them at once (the default).
+	 */
+	void SetMaxChangedItemsPerUpdate(const int32 InMaxChangedItemsPerUpdate)
+	{
+		MaxChangedItemsPerUpdate = FMath::Max(InMaxChangedItemsPerUpdate, 0);
+	}
+
+	int32 GetMaxChangedItemsPerUpdate() const
+	{
+		return MaxChangedItemsPerUpdate;
+	}
+
 	static const int32 GetMaxNumberOfAllowedChangesPerUpdate()
 	{
 		return MaxNumberOfAllowedChangesPerUpdate;
@@ -661,8 +683,11 @@ private:
 		 * Iterates over the current set of properties, comparing their keys with our old state, to figure
 		 * out which have changed and need to be serialized. Also populates a list of elements that are
 		 * no longer in our list (by ID).
+		 *
+		 * @return	True if some changed elements were left out because of MaxChangedItemsPerUpdate.
+		 *			Those keep their old key in NewIDToKeyMap, so they are considered changed again on the next update.
 		 */
-		void BuildChangedAndDeletedBuffers(
+		bool BuildChangedAndDeletedBuffers(
 			TMap<int32, int32>& NewIDToKeyMap,
 			const TMap<int32, int32>* OldIDToKeyMap,
 			TArray<FFastArraySerializer_FastArrayDeltaSerialize_FIdxIDPair, TInlineAllocator<8>>& ChangedElements,
@@ -736,6 +761,9 @@ private:
 	int32 CachedNumItems;
 	int32 CachedNumItemsToConsiderForWriting;
 
+	// Maximum number of changed items written per update, 0 if unlimited. @see SetMaxChangedItemsPerUpdate
+	int32 MaxChangedItemsPerUpdate;
+
 	UPROPERTY(NotReplicated, Transient)
 	EFastArraySerializerDeltaFlags DeltaFlags;
 };
@@ -814,7 +842,8 @@ void FFastArraySerializer::TFastArraySerializeHelper<Type, SerializerType>::Cond
 template<typename Type, typename SerializerType>
 bool FFastArraySerializer::TFastArraySerializeHelper<Type, SerializerType>::ConditionalCreateNewDeltaState(const TMap<int32, int32>& OldIDToKeyMap, const int32 BaseReplicationKey)
 {
-	if (ArraySerializer.ArrayReplicationKey == BaseReplicationKey)
+	const bool bOldStateHasDeferredChanges = Parms.OldState && ((FNetFastTArrayBaseState*)Parms.OldState)->bHasDeferredChanges;
+	if (ArraySerializer.ArrayReplicationKey == BaseReplicationKey && !bOldStateHasDeferredChanges)
 	{
 		// If the keys didn't change, only update the item count caches if necessary.
 		if (ArraySerializer.CachedNumItems == INDEX_NONE ||
@@ -891,7 +920,7 @@ void FFastArraySerializer::TFastArraySerializeHelper<Type, SerializerType>::Buil
 }
 
 template<typename Type, typename SerializerType>
-void FFastArraySerializer::TFastArraySerializeHelper<Type, SerializerType>::BuildChangedAndDeletedBuffers(
+bool FFastArraySerializer::TFastArraySerializeHelper<Type, SerializerType>::BuildChangedAndDeletedBuffers(
 	TMap<int32, int32>& NewIDToKeyMap,
 	const TMap<int32, int32>* OldIDToKeyMap,
 	TArray<FFastArraySerializer_FastArrayDeltaSerialize_FIdxIDPair, TInlineAllocator<8>>& ChangedElements,
@@ -904,6 +933,10 @@ void FFastArraySerializer::TFastArraySerializeHelper<Type, SerializerType>::Buil
 	int32 DeleteCount = (OldIDToKeyMap ? OldIDToKeyMap->Num() : 0) - NumConsideredItems; // Note: this is incremented when we add new items below.
 	UE_LOG(LogNetFastTArray, Log, TEXT("NetSerializeItemDeltaFast: %s. DeleteCount: %d"), *Parms.DebugName, DeleteCount);
 
+	// Replays record every change at once, they don't go through the bandwidth limited send path
+	const int32 MaxNumChanged = (ArraySerializer.MaxChangedItemsPerUpdate > 0 && !Parms.bInternalAck) ? ArraySerializer.MaxChangedItemsPerUpdate : MAX_int32;
+	bool bDeferredChanges = false;
+
 	//--------------------------------------------
 	// Find out what is new or what has changed
 	//--------------------------------------------
@@ -921,12 +954,33 @@ void FFastArraySerializer::TFastArraySerializeHelper<Type, SerializerType>::Buil
 		{
 			ArraySerializer.MarkItemDirty(Item);
 		}
-		NewIDToKeyMap.Add(Item.ReplicationID, Item.ReplicationKey);
 
 		const int32* OldValuePtr = OldIDToKeyMap ? OldIDToKeyMap->Find(Item.ReplicationID) : NULL;
+		const bool bChanged = !OldValuePtr || *OldValuePtr != Item.ReplicationKey;
+
+		if (bChanged && ChangedElements.Num() >= MaxNumChanged)
+		{
+			UE_LOG(LogNetFastTArray, Log, TEXT("       Deferred to next update. Element ID: %d."), Item.ReplicationID);
+
+			// Keep what the receiver knows about this item, new items are left out until they're written
+			if (OldValuePtr)
+			{
+				NewIDToKeyMap.Add(Item.ReplicationID, *OldValuePtr);
+			}
+			else
+			{
+				++DeleteCount; // Still not in the old map, so it must be accounted for like the new items below.
+			}
+
+			bDeferredChanges = true;
+			continue;
+		}
+
+		NewIDToKeyMap.Add(Item.ReplicationID, Item.ReplicationKey);
+
 		if (OldValuePtr)
 		{
-			if (*OldValuePtr == Item.ReplicationKey)
+			if (!bChanged)
 			{
 				UE_LOG(LogNetFastTArray, Log, TEXT("       Stayed The Same - Skipping"));
 
@@ -970,6 +1024,8 @@ void FFastArraySerializer::TFastArraySerializeHelper<Type, SerializerType>::Buil
 			}
 		}
 	}
+
+	return bDeferredChanges;
 }
 
 template<typename Type, typename SerializerType>
@@ -1163,15 +1219,23 @@ void FFastArraySerializer::TFastArraySerializeHelper<Type, SerializerType>::Post
 			int32 DeleteIndex = Header.DeletedIndices[i];
 			if (Items.IsValidIndex(DeleteIndex))
 			{
+				ArraySerializer.ItemMap.Remove(Items[DeleteIndex].ReplicationID);
+
 				Items.RemoveAtSwap(DeleteIndex, 1, false);
 
+				// Patch the index of the item that was swapped into the deleted slot instead of rebuilding the whole map.
+				// Items without a ReplicationID were added locally and aren't in the map, it gets rebuilt on the next receive if it's out of sync.
+				if (Items.IsValidIndex(DeleteIndex) && Items[DeleteIndex].ReplicationID != INDEX_NONE)
+				{
+					if (int32* SwappedIndexPtr = ArraySerializer.ItemMap.Find(Items[DeleteIndex].ReplicationID))
+					{
+						*SwappedIndexPtr = DeleteIndex;
+					}
+				}
+
 				UE_LOG(LogNetFastTArray, Log, TEXT("   Deleting: %d"), DeleteIndex);
 			}
 		}
-
-		// Clear the map now that the indices are all shifted around. This kind of sucks, we could use slightly better data structures here I think.
-		// This will force the ItemMap to be rebuilt for the current Items array
-		ArraySerializer.ItemMap.Empty();
 	}
 }
 
@@ -1416,7 +1480,7 @@ bool FFastArraySerializer::FastArrayDeltaSerialize(TArray<Type> &Items, FNetDelt
 		}
 		else
 		{
-			Helper.BuildChangedAndDeletedBuffers(NewMap, OldMap, ChangedElements, Header.DeletedIndices);
+			NewState->bHasDeferredChanges = Helper.BuildChangedAndDeletedBuffers(NewMap, OldMap, ChangedElements, Header.DeletedIndices);
 		}
 		
 		// Note: we used to early return false here if nothing had changed, but we still need to send
@@ -1749,7 +1813,7 @@ bool FFastArraySerializer::FastArrayDeltaSerialize_DeltaSerializeStructs(TArray<
 		}
 		else
 		{
-			Helper.BuildChangedAndDeletedBuffers(NewItemMap, OldItemMap, ChangedElements, Header.DeletedIndices);
+			NewState->bHasDeferredChanges = Helper.BuildChangedAndDeletedBuffers(NewItemMap, OldItemMap, ChangedElements, Header.DeletedIndices);
 		}
 
 		// Note: we used to early return false here if nothing had changed, but we still need to send
@@ -1771,7 +1835,16 @@ bool FFastArraySerializer::FastArrayDeltaSerialize_DeltaSerializeStructs(TArray<
 		DeltaSerializeParams.WriteChangedElements = &ChangedElements;
 		DeltaSerializeParams.WriteBaseState = NewState;
 
-		return Parms.NetSerializeCB->NetDeltaSerializeForFastArray(DeltaSerializeParams);
+		const bool bResult = Parms.NetSerializeCB->NetDeltaSerializeForFastArray(DeltaSerializeParams);
+
+		// Deferred items still need the changes of every history since the last complete update once they are written,
+		// so don't let acknowledging this update move the connection's acked history past it.
+		if (NewState->bHasDeferredChanges)
+		{
+			NewState->SetChangelistHistory(OldChangelistHistory);
+		}
+
+		return bResult;
 	}
 	else
 	{
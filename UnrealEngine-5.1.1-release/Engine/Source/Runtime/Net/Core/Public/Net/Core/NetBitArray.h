@@ -361,7 +361,17 @@ private:
 
 	static bool IsAnyBitSet(const StorageWordType* Storage, const uint32 WordCount)
 	{
-		for (uint32 WordIt = 0; WordIt < WordCount; ++WordIt)
+		// Test four words at a time as most arrays polled are mostly zero. The branch free OR lets the compiler vectorize the block.
+		uint32 WordIt = 0;
+		for (const uint32 BlockEndIt = WordCount & ~3U; WordIt < BlockEndIt; WordIt += 4)
+		{
+			if (Storage[WordIt] | Storage[WordIt + 1] | Storage[WordIt + 2] | Storage[WordIt + 3])
+			{
+				return true;
+			}
+		}
+
+		for (; WordIt < WordCount; ++WordIt)
 		{
 			if (Storage[WordIt])
 			{
@@ -630,16 +640,11 @@ private:
 		{
 			StorageWordType CurrentWord = Storage[WordIt] & ((WordIt == LastWordIt) ? LastWordMask : ~0U);
 
-			// Test All bits in the CurrentWord and invoke functor if they are set
-			uint32 LocalBitIndex = CurrentBitIndex;
+			// Visit the set bits in the CurrentWord only, clearing the lowest set bit each iteration
 			while (CurrentWord)
 			{
-				if (CurrentWord & 0x1)
-				{
-					Functor(LocalBitIndex);
-				}
-				CurrentWord >>= 1;
-				++LocalBitIndex;
+				Functor(CurrentBitIndex + FPlatformMath::CountTrailingZeros(CurrentWord));
+				CurrentWord &= CurrentWord - 1U;
 			}
 		}
 	}
@@ -656,16 +661,11 @@ private:
 
 			StorageWordType CurrentWord = WordOpFunctor(CurrentWordA, CurrentWordB) & ((WordIt == LastWordIt) ? LastWordMask : ~0U);
 
-			// Test All bits in the CurrentWord and invoke functor if they are set
-			uint32 LocalBitIndex = CurrentBitIndex;
+			// Visit the set bits in the CurrentWord only, clearing the lowest set bit each iteration
 			while (CurrentWord)
 			{
-				if (CurrentWord & 0x1)
-				{
-					Functor(LocalBitIndex);
-				}
-				CurrentWord >>= 1;
-				++LocalBitIndex;
+				Functor(CurrentBitIndex + FPlatformMath::CountTrailingZeros(CurrentWord));
+				CurrentWord &= CurrentWord - 1U;
 			}
 		}
 	}
@@ -677,30 +677,24 @@ private:
 
 		for (uint32 WordIt = 0, CurrentBitIndex = 0; WordIt < WordCount; ++WordIt, CurrentBitIndex += WordBitCount)
 		{
-			StorageWordType CurrentWordA = StorageA[WordIt];
+			const StorageWordType CurrentWordA = StorageA[WordIt];
 			const StorageWordType CurrentWordB = StorageB[WordIt];
 			StorageWordType CurrentWordXOR = (CurrentWordA ^ CurrentWordB) & ((WordIt == LastWordIt) ? LastWordMask : ~0U);
 
-			// if CurrentWord contains any set bits invoke the correct functor
-			uint32 LocalBitIndex = CurrentBitIndex;
+			// For each bit that differs invoke the functor of the array it is set in
 			while (CurrentWordXOR)
 			{
-				if (CurrentWordXOR & 0x1)
+				const uint32 LocalBitOffset = FPlatformMath::CountTrailingZeros(CurrentWordXOR);
+				if (CurrentWordA & (StorageWordType(1) << LocalBitOffset))
 				{
-					if (CurrentWordA & 0x1)
-					{
-						FunctorA(LocalBitIndex);
-					}
-					else
-					{
-						FunctorB(LocalBitIndex);
-					}
+					FunctorA(CurrentBitIndex + LocalBitOffset);
+				}
+				else
+				{
+					FunctorB(CurrentBitIndex + LocalBitOffset);
 				}
 
-				CurrentWordXOR >>= 1;
-				CurrentWordA >>= 1;
-
-				++LocalBitIndex;
+				CurrentWordXOR &= CurrentWordXOR - 1U;
 			}
 		}
 	}
@@ -219,6 +219,7 @@ namespace DeltaStats
 		virtual void OnDownloadSuccess(const FGuid& ChunkId) override { }
 		virtual void OnDownloadFailed(const FGuid& ChunkId, const FString& Url) override { }
 		virtual void OnDownloadCorrupt(const FGuid& ChunkId, const FString& Url, BuildPatchServices::EChunkLoadResult LoadResult) override { }
+		virtual void OnDownloadLoaded(const FGuid& ChunkId, int64 DataSize, double LoadTime) override { }
 		virtual void OnDownloadAborted(const FGuid& ChunkId, const FString& Url, double DownloadTimeMean, double DownloadTimeStd, double DownloadTime, double BreakingPoint) override { }
 		virtual void OnReceivedDataUpdated(int64 TotalBytes) override { }
 		virtual void OnRequiredDataUpdated(int64 TotalBytes) override { }
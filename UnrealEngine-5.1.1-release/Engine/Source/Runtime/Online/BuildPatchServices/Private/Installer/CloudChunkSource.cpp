@@ -129,6 +129,19 @@ namespace BuildPatchServices
 			double SecondsAtFail;
 		};
 
+		/**
+		 * This struct holds the result of verifying and decompressing a downloaded chunk on the thread pool.
+		 */
+		struct FLoadedChunk
+		{
+		public:
+			FGuid DataId;
+			TUniquePtr<IChunkDataAccess> ChunkDataAccess;
+			EChunkLoadResult LoadResult;
+			int64 DataSize;
+			double LoadTime;
+		};
+
 	public:
 		FCloudChunkSource(FCloudSourceConfig InConfiguration, IPlatform* Platform, IChunkStore* InChunkStore, IDownloadService* InDownloadService, IChunkReferenceTracker* InChunkReferenceTracker, IChunkDataSerialization* InChunkDataSerialization, IMessagePump* InMessagePump, IInstallerError* InInstallerError, IDownloadConnectionCount* InDownloadConnectionCount, ICloudChunkSourceStat* InCloudChunkSourceStat, IBuildManifestSet* ManifestSet, TSet<FGuid> InInitialDownloadSet);
 		~FCloudChunkSource();
@@ -152,6 +165,7 @@ namespace BuildPatchServices
 		EBuildPatchDownloadHealth GetDownloadHealth(bool bIsDisconnected, float ChunkSuccessRate);
 		FGuid GetNextTask(const TMap<FGuid, FTaskInfo>& TaskInfos, const TMap<int32, FGuid>& InFlightDownloads, const TSet<FGuid>& TotalRequiredChunks, const TSet<FGuid>& PriorityRequests, const TSet<FGuid>& FailedDownloads, const TSet<FGuid>& Stored, TArray<FGuid>& DownloadQueue, EBuildPatchDownloadHealth DownloadHealth);
 		void ThreadRun();
+		void LoadChunk(const FGuid& DataId, const FDownloadRef& Download, const FSHAHash* ChunkShaHash);
 		void OnDownloadProgress(int32 RequestId, int32 BytesSoFar);
 		void OnDownloadComplete(int32 RequestId, const FDownloadRef& Download);
 
@@ -183,6 +197,10 @@ namespace BuildPatchServices
 		FCriticalSection CompletedDownloadsCS;
 		TMap<int32, FDownloadRef> CompletedDownloads;
 
+		// Communication from chunk load tasks to processing thread.
+		FCriticalSection LoadedChunksCS;
+		TArray<FLoadedChunk> LoadedChunks;
+
 		// Communication from request threads to processing thread.
 		FCriticalSection RequestedDownloadsCS;
 		TArray<FGuid> RequestedDownloads;
@@ -438,6 +456,10 @@ namespace BuildPatchServices
 		TSet<FGuid> RequestedChunkUris;
 		TMap<FGuid, FChunkUriResponse> ChunkUris;
 
+		// Chunk load processing
+		TArray<TTuple<FGuid, FDownloadRef>> PendingChunkLoads;
+		TArray<TFuture<void>> ChunkLoadFutures;
+
 		// Provide initial stat values.
 		CloudChunkSourceStat->OnRequiredDataUpdated(TotalRequiredChunkSize + RepeatRequirementSize);
 		CloudChunkSourceStat->OnReceivedDataUpdated(TotalReceivedData);
@@ -536,7 +558,24 @@ namespace BuildPatchServices
 				CloudChunkSourceStat->OnRequiredDataUpdated(TotalRequiredChunkSize + RepeatRequirementSize);
 			}
 
-			// Process completed downloads.
+			// Handle failed downloads and chunks.
+			auto HandleFailedDownload = [&](const FGuid& DownloadId, FTaskInfo& TaskInfo)
+			{
+				ChunkSuccessRate.AddFail();
+				FailedDownloads.Add(DownloadId);
+				if (Configuration.MaxRetryCount >= 0 && TaskInfo.RetryNum >= Configuration.MaxRetryCount)
+				{
+					InstallerError->SetError(EBuildPatchInstallError::DownloadError, DownloadErrorCodes::OutOfChunkRetries);
+					bShouldAbort = true;
+				}
+				++TaskInfo.RetryNum;
+				TaskInfo.SecondsAtFail = FStatsCollector::GetSeconds();
+
+				RequestedChunkUris.Remove(DownloadId);
+				ChunkUris.Remove(DownloadId);
+			};
+
+			// Process completed downloads. Successful ones are queued for loading, which frees the request for the next download.
 			TMap<int32, FDownloadRef> FrameCompletedDownloads;
 			CompletedDownloadsCS.Lock();
 			FrameCompletedDownloads = MoveTemp(CompletedDownloads);
@@ -545,67 +584,62 @@ namespace BuildPatchServices
 			{
 				const int32& RequestId = FrameCompletedDownload.Key;
 				const FDownloadRef& Download = FrameCompletedDownload.Value;
-				const FGuid& DownloadId = InFlightDownloads[RequestId];
+				const FGuid DownloadId = InFlightDownloads.FindAndRemoveChecked(RequestId);
 				FTaskInfo& TaskInfo = TaskInfos.FindOrAdd(DownloadId);
-				bool bDownloadSuccess = Download->ResponseSuccessful();
-				if (bDownloadSuccess)
+				if (Download->ResponseSuccessful())
 				{
-					// HTTP module gives const access to downloaded data, and we need to change it.
-					// @TODO: look into refactor serialization it can already know SHA list? Or consider adding SHA params to public API.
-					TArray<uint8> DownloadedData = Download->GetData();
-
-					// If we know the SHA for this chunk, inject to data for verification.
-					FSHAHash ChunkShaHash;
-					if (ManifestSet->GetChunkShaHash(DownloadId, ChunkShaHash))
-					{
-						ChunkDataSerialization->InjectShaToChunkData(DownloadedData, ChunkShaHash);
-					}
-
-					EChunkLoadResult LoadResult;
-					TUniquePtr<IChunkDataAccess> ChunkDataAccess(ChunkDataSerialization->LoadFromMemory(DownloadedData, LoadResult));
-					bDownloadSuccess = LoadResult == EChunkLoadResult::Success;
-					if (bDownloadSuccess)
-					{
-						TotalReceivedData += TaskInfo.ExpectedSize;
-						TaskInfos.Remove(DownloadId);
-						PlacedInStore.Add(DownloadId);
-						ChunkStore->Put(DownloadId, MoveTemp(ChunkDataAccess));
-						CloudChunkSourceStat->OnDownloadSuccess(DownloadId);
-						CloudChunkSourceStat->OnReceivedDataUpdated(TotalReceivedData);
-					}
-					else
-					{
-						CloudChunkSourceStat->OnDownloadCorrupt(DownloadId, TaskInfo.UrlUsed, LoadResult);
-					}
+					const double ChunkTime = FStatsCollector::GetSeconds() - TaskInfo.SecondsAtRequested;
+					MeanChunkTime.AddSample(ChunkTime);
+					PendingChunkLoads.Emplace(DownloadId, Download);
 				}
 				else
 				{
 					CloudChunkSourceStat->OnDownloadFailed(DownloadId, TaskInfo.UrlUsed);
+					HandleFailedDownload(DownloadId, TaskInfo);
 				}
+			}
 
-				// Handle failed
-				if (!bDownloadSuccess)
+			// Kick off chunk loads, the SHA and decompression of each chunk are checked on the thread pool so that they overlap with
+			// the downloads, and with each other.
+			ChunkLoadFutures.RemoveAll([](const TFuture<void>& ChunkLoadFuture) { return ChunkLoadFuture.IsReady(); });
+			while (PendingChunkLoads.Num() > 0 && ChunkLoadFutures.Num() < FMath::Max(Configuration.MaxConcurrentChunkLoads, 1))
+			{
+				TTuple<FGuid, FDownloadRef> PendingChunkLoad = PendingChunkLoads[0];
+				PendingChunkLoads.RemoveAt(0, 1, false);
+				// If we know the SHA for this chunk, it is injected to the data for verification.
+				FSHAHash ChunkShaHash;
+				const bool bHasChunkShaHash = ManifestSet->GetChunkShaHash(PendingChunkLoad.Get<0>(), ChunkShaHash);
+				ChunkLoadFutures.Add(Async(EAsyncExecution::ThreadPool, [this, PendingChunkLoad = MoveTemp(PendingChunkLoad), bHasChunkShaHash, ChunkShaHash]()
 				{
-					ChunkSuccessRate.AddFail();
-					FailedDownloads.Add(DownloadId);
-					if (Configuration.MaxRetryCount >= 0 && TaskInfo.RetryNum >= Configuration.MaxRetryCount)
-					{
-						InstallerError->SetError(EBuildPatchInstallError::DownloadError, DownloadErrorCodes::OutOfChunkRetries);
-						bShouldAbort = true;
-					}
-					++TaskInfo.RetryNum;
-					TaskInfo.SecondsAtFail = FStatsCollector::GetSeconds();
+					LoadChunk(PendingChunkLoad.Get<0>(), PendingChunkLoad.Get<1>(), bHasChunkShaHash ? &ChunkShaHash : nullptr);
+				}));
+			}
 
-					RequestedChunkUris.Remove(DownloadId);
-					ChunkUris.Remove(DownloadId);
+			// Process loaded chunks.
+			TArray<FLoadedChunk> FrameLoadedChunks;
+			LoadedChunksCS.Lock();
+			FrameLoadedChunks = MoveTemp(LoadedChunks);
+			LoadedChunksCS.Unlock();
+			for (FLoadedChunk& LoadedChunk : FrameLoadedChunks)
+			{
+				const FGuid& DownloadId = LoadedChunk.DataId;
+				FTaskInfo& TaskInfo = TaskInfos.FindOrAdd(DownloadId);
+				CloudChunkSourceStat->OnDownloadLoaded(DownloadId, LoadedChunk.DataSize, LoadedChunk.LoadTime);
+				if (LoadedChunk.LoadResult == EChunkLoadResult::Success)
+				{
+					TotalReceivedData += TaskInfo.ExpectedSize;
+					TaskInfos.Remove(DownloadId);
+					PlacedInStore.Add(DownloadId);
+					ChunkStore->Put(DownloadId, MoveTemp(LoadedChunk.ChunkDataAccess));
+					CloudChunkSourceStat->OnDownloadSuccess(DownloadId);
+					CloudChunkSourceStat->OnReceivedDataUpdated(TotalReceivedData);
+					ChunkSuccessRate.AddSuccess();
 				}
 				else
 				{
-					const double ChunkTime = FStatsCollector::GetSeconds() - TaskInfo.SecondsAtRequested;
-					MeanChunkTime.AddSample(ChunkTime);
-					ChunkSuccessRate.AddSuccess();
+					CloudChunkSourceStat->OnDownloadCorrupt(DownloadId, TaskInfo.UrlUsed, LoadedChunk.LoadResult);
+					HandleFailedDownload(DownloadId, TaskInfo);
 				}
-				InFlightDownloads.Remove(RequestId);
 			}
 
 			// Update connection status and health.
@@ -626,14 +660,15 @@ namespace BuildPatchServices
 				TrackedDownloadHealth = OverallDownloadHealth;
 				CloudChunkSourceStat->OnDownloadHealthUpdated(TrackedDownloadHealth);
 			}
-			if (FrameCompletedDownloads.Num() > 0)
+			if (FrameCompletedDownloads.Num() > 0 || FrameLoadedChunks.Num() > 0)
 			{
 				CloudChunkSourceStat->OnSuccessRateUpdated(SuccessRate);
 			}
 			const float ImmediateSuccessRate = ChunkSuccessRate.GetImmediate();
 			EBuildPatchDownloadHealth ImmediateDownloadHealth = GetDownloadHealth(bDisconnect, ImmediateSuccessRate);
-			// Kick off new downloads.
-			if (bDownloadsStarted)
+			// Kick off new downloads, unless loading is falling behind, so that the memory held by downloaded chunks stays bounded.
+			const int32 MaxPendingChunkLoads = FMath::Max(Configuration.MaxConcurrentChunkLoads, 1) * 4;
+			if (bDownloadsStarted && PendingChunkLoads.Num() < MaxPendingChunkLoads)
 			{
 				FGuid NextTask;
 				while ((NextTask = GetNextTask(TaskInfos, InFlightDownloads, TotalRequiredChunks, PriorityRequests, FailedDownloads, PlacedInStore, DownloadQueue, ImmediateDownloadHealth)).IsValid())
@@ -705,12 +740,41 @@ namespace BuildPatchServices
 			Platform->Sleep(0.01f);
 		}
 
+		// Chunk loads refer to this source, so they must finish before we exit.
+		for (const TFuture<void>& ChunkLoadFuture : ChunkLoadFutures)
+		{
+			ChunkLoadFuture.Wait();
+		}
+
 		// Provide final stat values.
 		CloudChunkSourceStat->OnDownloadHealthUpdated(TrackedDownloadHealth);
 		CloudChunkSourceStat->OnSuccessRateUpdated(ChunkSuccessRate.GetOverall());
 		CloudChunkSourceStat->OnActiveRequestCountUpdated(0);
 	}
 
+	void FCloudChunkSource::LoadChunk(const FGuid& DataId, const FDownloadRef& Download, const FSHAHash* ChunkShaHash)
+	{
+		const double SecondsAtStart = FStatsCollector::GetSeconds();
+		FLoadedChunk LoadedChunk;
+		LoadedChunk.DataId = DataId;
+
+		// HTTP module gives const access to downloaded data, and we need to change it.
+		// @TODO: look into refactor serialization it can already know SHA list? Or consider adding SHA params to public API.
+		TArray<uint8> DownloadedData = Download->GetData();
+		LoadedChunk.DataSize = DownloadedData.Num();
+
+		if (ChunkShaHash != nullptr)
+		{
+			ChunkDataSerialization->InjectShaToChunkData(DownloadedData, *ChunkShaHash);
+		}
+
+		LoadedChunk.ChunkDataAccess.Reset(ChunkDataSerialization->LoadFromMemory(DownloadedData, LoadedChunk.LoadResult));
+		LoadedChunk.LoadTime = FStatsCollector::GetSeconds() - SecondsAtStart;
+
+		FScopeLock ScopeLock(&LoadedChunksCS);
+		LoadedChunks.Add(MoveTemp(LoadedChunk));
+	}
+
 	void FCloudChunkSource::OnDownloadProgress(int32 RequestId, int32 BytesSoFar)
 	{
 		FPlatformAtomics::InterlockedExchange(&CyclesAtLastData, FStatsCollector::GetCycles());
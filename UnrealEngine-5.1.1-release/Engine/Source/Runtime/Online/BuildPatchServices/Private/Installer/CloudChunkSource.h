@@ -60,6 +60,8 @@ namespace BuildPatchServices
 		bool bBeginDownloadsOnFirstGet;
 		// The minimum time to allow a http download before assessing it as affected by TCP zero window issue.
 		float TcpZeroWindowMinimumSeconds;
+		// The maximum number of downloaded chunks to verify and decompress at the same time on the thread pool, overlapping with further downloads.
+		int32 MaxConcurrentChunkLoads;
 
 		/**
 		 * Constructor which sets usual defaults, and takes params for values that cannot use a default.
@@ -73,6 +75,7 @@ namespace BuildPatchServices
 			, DisconnectedDelay(5.0f)
 			, bBeginDownloadsOnFirstGet(true)
 			, TcpZeroWindowMinimumSeconds(20.0f)
+			, MaxConcurrentChunkLoads(4)
 		{
 			const float RetryFloats[] = {0.5f, 1.0f, 1.0f, 3.0f, 3.0f, 10.0f, 10.0f, 20.0f, 20.0f, 30.0f};
 			RetryDelayTimes.Empty(UE_ARRAY_COUNT(RetryFloats));
@@ -148,6 +151,14 @@ namespace BuildPatchServices
 		 */
 		virtual void OnDownloadCorrupt(const FGuid& ChunkId, const FString& Url, EChunkLoadResult LoadResult) = 0;
 
+		/**
+		 * Called whenever the data of a successful chunk download request has been verified and decompressed.
+		 * @param ChunkId           The id of the chunk.
+		 * @param DataSize          The size of the downloaded data.
+		 * @param LoadTime          The time in seconds spent verifying and decompressing the data, not including the time queued.
+		 */
+		virtual void OnDownloadLoaded(const FGuid& ChunkId, int64 DataSize, double LoadTime) = 0;
+
 		/**
 		 * Called whenever a chunk was aborted because it was determined as taking too long.
 		 * @param ChunkId           The id of the chunk.
@@ -23,6 +23,7 @@ namespace BuildPatchServices
 		virtual void OnDownloadSuccess(const FGuid& ChunkId) override;
 		virtual void OnDownloadFailed(const FGuid& ChunkId, const FString& Url) override;
 		virtual void OnDownloadCorrupt(const FGuid& ChunkId, const FString& Url, EChunkLoadResult LoadResult) override;
+		virtual void OnDownloadLoaded(const FGuid& ChunkId, int64 DataSize, double LoadTime) override;
 		virtual void OnDownloadAborted(const FGuid& ChunkId, const FString& Url, double DownloadTimeMean, double DownloadTimeStd, double DownloadTime, double BreakingPoint) override;
 		virtual void OnReceivedDataUpdated(int64 TotalBytes) override;
 		virtual void OnRequiredDataUpdated(int64 TotalBytes) override;
@@ -41,6 +42,7 @@ namespace BuildPatchServices
 		virtual TArray<float> GetDownloadHealthTimers() const override;
 		virtual uint32 GetCurrentRequestCount() const override;
 		virtual uint32 GetPeakRequestCount() const override;
+		virtual double GetChunkLoadSpeed() const override;
 		// ICloudChunkSourceStatistics interface end.
 
 	private:
@@ -58,6 +60,8 @@ namespace BuildPatchServices
 		EBuildPatchDownloadHealth CurrentHealth;
 		int64 CyclesAtLastHealthState;
 		TArray<float> HealthStateTimes;
+		int64 TotalBytesLoaded;
+		double TotalLoadTime;
 	};
 
 	FCloudChunkSourceStatistics::FCloudChunkSourceStatistics(IInstallerAnalytics* InInstallerAnalytics, FBuildPatchProgress* InBuildProgress, IFileOperationTracker* InFileOperationTracker)
@@ -74,6 +78,8 @@ namespace BuildPatchServices
 		, ThreadLockCs()
 		, CurrentHealth(EBuildPatchDownloadHealth::Excellent)
 		, CyclesAtLastHealthState(0)
+		, TotalBytesLoaded(0)
+		, TotalLoadTime(0)
 	{
 		// Initialize health states to zero time.
 		HealthStateTimes.AddZeroed((int32)EBuildPatchDownloadHealth::NUM_Values);
@@ -102,6 +108,13 @@ namespace BuildPatchServices
 		NumDownloadsCorrupt.Increment();
 	}
 
+	void FCloudChunkSourceStatistics::OnDownloadLoaded(const FGuid& ChunkId, int64 DataSize, double LoadTime)
+	{
+		FScopeLock Lock(&ThreadLockCs);
+		TotalBytesLoaded += DataSize;
+		TotalLoadTime += LoadTime;
+	}
+
 	void FCloudChunkSourceStatistics::OnDownloadAborted(const FGuid& ChunkId, const FString& Url, double DownloadTimeMean, double DownloadTimeStd, double DownloadTime, double BreakingPoint)
 	{
 		InstallerAnalytics->RecordChunkDownloadAborted(Url, DownloadTime, DownloadTimeMean, DownloadTimeStd, BreakingPoint);
@@ -202,6 +215,12 @@ namespace BuildPatchServices
 		return PeakRequestCount;
 	}
 
+	double FCloudChunkSourceStatistics::GetChunkLoadSpeed() const
+	{
+		FScopeLock Lock(&ThreadLockCs);
+		return TotalLoadTime > 0.0 ? TotalBytesLoaded / TotalLoadTime : 0.0;
+	}
+
 	ICloudChunkSourceStatistics* FCloudChunkSourceStatisticsFactory::Create(IInstallerAnalytics* InstallerAnalytics, FBuildPatchProgress* BuildProgress, IFileOperationTracker* FileOperationTracker)
 	{
 		check(InstallerAnalytics != nullptr);
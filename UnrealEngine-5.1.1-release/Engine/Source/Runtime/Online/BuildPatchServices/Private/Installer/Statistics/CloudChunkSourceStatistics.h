@@ -55,6 +55,11 @@ namespace BuildPatchServices
 		 * @return the peak number of download requests.
 		 */
 		virtual uint32 GetPeakRequestCount() const = 0;
+
+		/**
+		 * @return the average speed in bytes per second at which a single thread verifies and decompresses downloaded chunks.
+		 */
+		virtual double GetChunkLoadSpeed() const = 0;
 	};
 
 	/**
@@ -16,6 +16,7 @@ namespace BuildPatchServices
 		typedef TTuple<double, FGuid> FDownloadSuccess;
 		typedef TTuple<double, FGuid, FString> FDownloadFailed;
 		typedef TTuple<double, FGuid, FString, EChunkLoadResult> FDownloadCorrupt;
+		typedef TTuple<double, FGuid, int64, double> FDownloadLoaded;
 		typedef TTuple<double, FGuid, FString, double, double, double, double> FDownloadAborted;
 		typedef TTuple<double, int64> FReceivedDataUpdated;
 		typedef TTuple<double, int64> FRequiredDataUpdated;
@@ -44,6 +45,11 @@ namespace BuildPatchServices
 			RxDownloadCorrupt.Emplace(FStatsCollector::GetSeconds(), ChunkId, Url, LoadResult);
 		}
 
+		virtual void OnDownloadLoaded(const FGuid& ChunkId, int64 DataSize, double LoadTime) override
+		{
+			RxDownloadLoaded.Emplace(FStatsCollector::GetSeconds(), ChunkId, DataSize, LoadTime);
+		}
+
 		virtual void OnDownloadAborted(const FGuid& ChunkId, const FString& Url, double DownloadTimeMean, double DownloadTimeStd, double DownloadTime, double BreakingPoint) override
 		{
 			RxDownloadAborted.Emplace(FStatsCollector::GetSeconds(), ChunkId, Url, DownloadTimeMean, DownloadTimeStd, DownloadTime, BreakingPoint);
@@ -83,6 +89,7 @@ namespace BuildPatchServices
 		TArray<FDownloadSuccess> RxDownloadSuccess;
 		TArray<FDownloadFailed> RxDownloadFailed;
 		TArray<FDownloadCorrupt> RxDownloadCorrupt;
+		TArray<FDownloadLoaded> RxDownloadLoaded;
 		TArray<FDownloadAborted> RxDownloadAborted;
 		TArray<FReceivedDataUpdated> RxReceivedDataUpdated;
 		TArray<FRequiredDataUpdated> RxRequiredDataUpdated;
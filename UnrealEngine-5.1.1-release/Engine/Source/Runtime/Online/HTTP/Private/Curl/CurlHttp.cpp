@@ -97,7 +97,18 @@ FCurlHttpRequest::FCurlHttpRequest()
 	// that reason we're disabling its use by default in the general purpose curl request wrapper and only
 	// allowing use of HTTP2 from other curl wrappers like the DerivedDataCache one.
 	// Note that CURL_HTTP_VERSION_1_1 was the default for libcurl version before 7.62.0
-	curl_easy_setopt(EasyHandle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_1_1);
+	// It can be opted in with [HTTP.Curl] bEnableHttp2, in which case requests wait for a connection they can be multiplexed on rather than opening new ones.
+#if !WITH_CURL_XCURL && defined(CURLPIPE_MULTIPLEX)
+	if (FCurlHttpManager::CurlRequestOptions.bEnableHttp2)
+	{
+		curl_easy_setopt(EasyHandle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+		curl_easy_setopt(EasyHandle, CURLOPT_PIPEWAIT, 1L);
+	}
+	else
+#endif
+	{
+		curl_easy_setopt(EasyHandle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_1_1);
+	}
 
 	// set certificate verification (disable to allow self-signed certificates)
 	if (FCurlHttpManager::CurlRequestOptions.bVerifyPeer)
@@ -979,6 +990,8 @@ bool FCurlHttpRequest::SetupRequestHttpThread()
 
 	UE_LOG(LogHttp, Log, TEXT("%p: Starting %s request to URL='%s'"), this, *Verb, *URL);
 
+	QueueSeconds = FPlatformTime::Seconds() - QueuedTime;
+
 	// Response object to handle data that comes back after starting this request
 	Response = MakeShared<FCurlHttpResponse, ESPMode::ThreadSafe>(*this);
 
@@ -1036,6 +1049,7 @@ bool FCurlHttpRequest::ProcessRequest()
 		QUICK_SCOPE_CYCLE_COUNTER(STAT_CurlHttpAddThreadedRequest);
 		// Mark as in-flight to prevent overlapped requests using the same object
 		CompletionStatus = EHttpRequestStatus::Processing;
+		QueuedTime = FPlatformTime::Seconds();
 		// Add to global list while being processed so that the ref counted request does not get deleted
 		FHttpModule::Get().GetHttpManager().AddThreadedRequest(SharedThis(this));
 
@@ -1057,6 +1071,18 @@ bool FCurlHttpRequest::StartThreadedRequest()
 	return true;
 }
 
+void FCurlHttpRequest::RecordConnectionMetrics() const
+{
+	long NumConnects = 0;
+	double TotalTime = 0.0;
+	if (curl_easy_getinfo(EasyHandle, CURLINFO_NUM_CONNECTS, &NumConnects) == CURLE_OK &&
+		curl_easy_getinfo(EasyHandle, CURLINFO_TOTAL_TIME, &TotalTime) == CURLE_OK)
+	{
+		// No new connection was made for the transfer, so it went over a pooled one
+		FHttpModule::Get().GetHttpManager().RecordConnectionMetrics(NumConnects == 0, QueueSeconds, TotalTime);
+	}
+}
+
 void FCurlHttpRequest::FinishRequest()
 {
 	FinishedRequest();
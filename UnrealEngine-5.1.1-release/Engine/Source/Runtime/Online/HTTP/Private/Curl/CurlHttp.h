@@ -210,6 +210,11 @@ public:
 		CurlCompletionResult = InCurlCompletionResult;
 		bCurlRequestCompleted = true;
 	}
+
+	/**
+	 * Reports whether the completed transfer reused a connection, and its queue and transfer times, to the http manager
+	 */
+	void RecordConnectionMetrics() const;
 	
 	/** 
 	 * Set the result for adding the easy handle to curl multi
@@ -396,6 +401,10 @@ private:
 	float ElapsedTime;
 	/** Elapsed time since the last received HTTP response. */
 	float TimeSinceLastResponse;
+	/** Time the request was added to the http thread queue */
+	double QueuedTime = 0.0;
+	/** Time the request waited on the http thread queue before being started */
+	double QueueSeconds = 0.0;
 	/** Have we had any HTTP activity with the host? Sending headers, SSL handshake, etc */
 	bool bAnyHttpActivity;
 	/** Number of bytes sent already */
@@ -269,6 +269,31 @@ void FCurlHttpManager::InitCurl()
 
 	GConfig->GetBool(TEXT("HTTP.Curl"), TEXT("bAllowSeekFunction"), CurlRequestOptions.bAllowSeekFunction, GEngineIni);
 
+#if !WITH_CURL_XCURL && defined(CURLPIPE_MULTIPLEX)
+	bool bEnableHttp2 = false;
+	if (GConfig->GetBool(TEXT("HTTP.Curl"), TEXT("bEnableHttp2"), bEnableHttp2, GEngineIni) && bEnableHttp2)
+	{
+		const curl_version_info_data* VersionInfo = curl_version_info(CURLVERSION_NOW);
+		if (VersionInfo && (VersionInfo->features & CURL_VERSION_HTTP2))
+		{
+			const CURLMcode SetOptResult = curl_multi_setopt(GMultiHandle, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+			if (SetOptResult == CURLM_OK)
+			{
+				CurlRequestOptions.bEnableHttp2 = true;
+			}
+			else
+			{
+				UE_LOG(LogInit, Warning, TEXT("Failed to enable libcurl multiplexing, error %d ('%s')"),
+					static_cast<int32>(SetOptResult), StringCast<TCHAR>(curl_multi_strerror(SetOptResult)).Get());
+			}
+		}
+		else
+		{
+			UE_LOG(LogInit, Warning, TEXT("bEnableHttp2 is set but libcurl was built without HTTP/2 support"));
+		}
+	}
+#endif
+
 	CurlRequestOptions.MaxHostConnections = FHttpModule::Get().GetHttpMaxConnectionsPerServer();
 	if (CurlRequestOptions.MaxHostConnections > 0)
 	{
@@ -329,6 +354,11 @@ void FCurlHttpManager::FCurlRequestOptions::Log()
 		(MaxHostConnections == 0) ? TEXT("NOT ") : TEXT("")
 		);
 
+	UE_LOG(LogInit, Log, TEXT(" - bEnableHttp2 = %s  - Libcurl will %smultiplex requests to a host over HTTP/2"),
+		bEnableHttp2 ? TEXT("true") : TEXT("false"),
+		bEnableHttp2 ? TEXT("") : TEXT("NOT ")
+		);
+
 	UE_LOG(LogInit, Log, TEXT(" - LocalHostAddr = %s"), LocalHostAddr.IsEmpty() ? TEXT("Default") : *LocalHostAddr);
 
 	UE_LOG(LogInit, Log, TEXT(" - BufferSize = %d"), CurlRequestOptions.BufferSize);
@@ -58,6 +58,9 @@ public:
 
 		/** Do we allow seeking? */
 		bool bAllowSeekFunction = false;
+
+		/** Whether requests over TLS negotiate HTTP/2, multiplexing concurrent requests to a host over a single connection */
+		bool bEnableHttp2 = false;
 	}
 	CurlRequestOptions;
 
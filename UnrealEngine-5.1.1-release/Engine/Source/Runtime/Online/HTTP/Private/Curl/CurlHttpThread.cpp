@@ -51,6 +51,10 @@ void FCurlHttpThread::HttpThreadTick(float DeltaSeconds)
 					{
 						FCurlHttpRequest* CurlRequest = static_cast<FCurlHttpRequest*>(*Request);
 						CurlRequest->MarkAsCompleted(Message->data.result);
+						if (Message->data.result == CURLE_OK)
+						{
+							CurlRequest->RecordConnectionMetrics();
+						}
 
 						UE_LOG(LogHttp, Verbose, TEXT("Request %p (easy handle:%p) has completed (code:%d) and has been marked as such"), CurlRequest, CompletedHandle, (int32)Message->data.result);
 
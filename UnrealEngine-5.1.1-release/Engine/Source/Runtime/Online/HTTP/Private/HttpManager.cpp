@@ -448,6 +448,29 @@ void FHttpManager::DumpRequests(FOutputDevice& Ar) const
 		Ar.Logf(TEXT("	verb=[%s] url=[%s] status=%s"),
 			*Request->GetVerb(), *Request->GetURL(), EHttpRequestStatus::ToString(Request->GetStatus()));
 	}
+
+	const FHttpConnectionMetrics Metrics = GetConnectionMetrics();
+	if (Metrics.NumRequests > 0)
+	{
+		Ar.Logf(TEXT("------- Connection metrics over %llu completed requests: reuse ratio=%.2f avg queue time=%.3fs avg transfer time=%.3fs"),
+			Metrics.NumRequests, Metrics.GetConnectionReuseRatio(), Metrics.TotalQueueSeconds / Metrics.NumRequests, Metrics.TotalTransferSeconds / Metrics.NumRequests);
+	}
+}
+
+void FHttpManager::RecordConnectionMetrics(bool bReusedConnection, double QueueSeconds, double TransferSeconds)
+{
+	FScopeLock ScopeLock(&ConnectionMetricsLock);
+
+	++ConnectionMetrics.NumRequests;
+	ConnectionMetrics.NumReusedConnections += bReusedConnection ? 1 : 0;
+	ConnectionMetrics.TotalQueueSeconds += QueueSeconds;
+	ConnectionMetrics.TotalTransferSeconds += TransferSeconds;
+}
+
+FHttpConnectionMetrics FHttpManager::GetConnectionMetrics() const
+{
+	FScopeLock ScopeLock(&ConnectionMetricsLock);
+	return ConnectionMetrics;
 }
 
 bool FHttpManager::SupportsDynamicProxy() const
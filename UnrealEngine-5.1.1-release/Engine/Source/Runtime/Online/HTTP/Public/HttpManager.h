@@ -43,6 +43,26 @@ const TCHAR* LexToString(const EHttpFlushReason& FlushReason);
  */
 DECLARE_DELEGATE_OneParam(FHttpManagerRequestAddedDelegate, const FHttpRequestRef& /*Request*/);
 
+/**
+ * Connection metrics accumulated over the completed requests, for the platform implementations that report them
+ */
+struct FHttpConnectionMetrics
+{
+	/** Number of successfully completed requests that reported metrics */
+	uint64 NumRequests = 0;
+	/** Number of those requests sent over an already established connection */
+	uint64 NumReusedConnections = 0;
+	/** Total time the requests waited on the http thread before being started */
+	double TotalQueueSeconds = 0.0;
+	/** Total time from the start of the requests to their completion, including name resolution and connection */
+	double TotalTransferSeconds = 0.0;
+
+	double GetConnectionReuseRatio() const
+	{
+		return NumRequests > 0 ? double(NumReusedConnections) / double(NumRequests) : 0.0;
+	}
+};
+
 /**
  * Manages Http request that are currently being processed
  */
@@ -148,6 +168,20 @@ public:
 	 */
 	void DumpRequests(FOutputDevice& Ar) const;
 
+	/**
+	 * Accumulates the connection metrics of a completed request. Can be called from any thread.
+	 *
+	 * @param bReusedConnection - whether the request was sent over an already established connection
+	 * @param QueueSeconds - time the request waited on the http thread before being started
+	 * @param TransferSeconds - time from the start of the request to its completion
+	 */
+	void RecordConnectionMetrics(bool bReusedConnection, double QueueSeconds, double TransferSeconds);
+
+	/**
+	 * @return the connection metrics accumulated since the manager was created
+	 */
+	FHttpConnectionMetrics GetConnectionMetrics() const;
+
 	/**
 	 * Method to check dynamic proxy setting support.
 	 *
@@ -266,6 +300,11 @@ protected:
 
 	TMap<EHttpFlushReason, FHttpFlushTimeLimit> FlushTimeLimitsMap;
 
+	/** Used to lock access to ConnectionMetrics, recorded from the http thread */
+	mutable FCriticalSection ConnectionMetricsLock;
+
+	FHttpConnectionMetrics ConnectionMetrics;
+
 PACKAGE_SCOPE:
 
 	/** Used to lock access to add/remove/find requests */
@@ -11,7 +11,8 @@
 #include "Modules/ModuleInterface.h"
 
 #ifndef PLATFORM_IMPLEMENTS_IO
-#define PLATFORM_IMPLEMENTS_IO 0
+// Linux implements an io_uring backend that falls back to the generic one if io_uring is not available
+#define PLATFORM_IMPLEMENTS_IO PLATFORM_UNIX
 #endif
 
 #ifndef PLATFORM_IODISPATCHER_MODULE
@@ -145,6 +146,7 @@ struct PAKFILE_API FFileIoStoreCompressedBlock
 	FAES::FAESKey EncryptionKey;
 	TRefCountPtr<FFileIoStoreBlockSignatureTable> BlockSignatureTable;
 	const FSHAHash* SignatureHash = nullptr;
+	int32 Priority = 0; // highest priority of the requests waiting for the block when it's queued for decompression
 	bool bFailed = false;
 	bool bCancelled = false;
 };
@@ -572,10 +574,14 @@ public:
 	FFileIoStoreBuffer* AllocBuffer();
 	void FreeBuffer(FFileIoStoreBuffer* Buffer);
 	uint64 GetBufferSize() const { return BufferSize; }
+	// all buffers are carved out of this memory, platforms can e.g. register it with the kernel once
+	uint8* GetBufferMemory() const { return BufferMemory; }
+	uint64 GetBufferMemorySize() const { return BufferMemorySize; }
 
 private:
 	FFileIoStoreStats& Stats;
 	uint64 BufferSize = 0;
+	uint64 BufferMemorySize = 0;
 	uint8* BufferMemory = nullptr;
 	FCriticalSection BuffersCritical;
 	FFileIoStoreBuffer* FirstFreeBuffer = nullptr;
@@ -641,6 +647,9 @@ public:
 
 	FFileIoStoreReadRequest* Pop(FFileIoStoreReadRequestSortKey LastSortKey);
 	void Push(FFileIoStoreReadRequest* Request);
+	// Find the request with the lowest offset in [BeginOffset, EndOffset] of the file that isn't cancelled or failed
+	FFileIoStoreReadRequest* FindAdjacent(uint64 Handle, uint64 BeginOffset, uint64 EndOffset) const;
+	void Remove(FFileIoStoreReadRequest* Request);
 	int32 HandleContainerUnmounted(const FFileIoStoreContainerFile& ContainerFile);
 
 private:
@@ -664,6 +673,10 @@ class PAKFILE_API FFileIoStoreRequestQueue
 {
 public:
 	FFileIoStoreReadRequest* Pop();
+	// Pops a queued read of any priority that starts at most s.IoDispatcherCoalesceReadsMaxGapKB after Previous in the same file,
+	// so that the backend can read it together with Previous. RunSize is the size of the reads coalesced so far including Previous,
+	// a run is limited to s.IoDispatcherCoalesceReadsMaxSizeKB. Returns nullptr if there's no such read or coalescing is disabled.
+	FFileIoStoreReadRequest* PopAdjacent(const FFileIoStoreReadRequest& Previous, uint64 RunSize, bool bAllowGap);
 	void Push(FFileIoStoreReadRequest& Request);	// Takes ownership of Request and rewrites its intrustive linked list pointers
 	void Push(FFileIoStoreReadRequestList& Requests); // Consumes the request list and overwrites all intrustive linked list pointers
 	void UpdateOrder();
@@ -918,6 +931,7 @@ private:
 	const uint64 ResolvedOffset;
 	const uint64 ResolvedSize;
 	uint32 UnfinishedReadsCount = 0;
+	uint32 PersistentCacheReadsCount = 0;
 	bool bFailed = false;
 	bool bCancelled = false;
 
@@ -940,6 +954,8 @@ public:
 	// Called by the backend when underlying filesystem reads complete, possibly already decompressed on some systems
 	void OnFilesystemReadCompleted(const FFileIoStoreReadRequest* Request);
 	void OnFilesystemReadsCompleted(const FFileIoStoreReadRequestList& CompletedRequests);
+	// Called by the backend when reads were coalesced with the previous read instead of being started separately
+	void OnFilesystemReadsCoalesced(uint32 NumReads);
 
 private:
 	friend class FFileIoStore;
@@ -964,6 +980,8 @@ private:
 	FCountersTrace::FCounterInt BlockCacheMissedSizeCounter;
 	FCountersTrace::FCounterInt ScatteredSizeCounter;
 	FCountersTrace::FCounterInt TocMemoryCounter;
+	FCountersTrace::FCounterInt CoalescedReadsCounter;
+	FCountersTrace::FCounterInt AvoidedReadsCounter;
 	FCountersTrace::TCounter<std::atomic<int64>, TraceCounterType_Int> AvailableBuffersCounter;
 #endif
 
@@ -1005,6 +1023,8 @@ private:
 	void OnBlockCacheStore(uint64 NumBytes);
 	void OnBlockCacheHit(uint64 NumBytes);
 	void OnBlockCacheMiss(uint64 NumBytes);
+	// A block was requested that is already queued or being read
+	void OnReadAvoided();
 
 	// A read was started without seeking
 	void OnSequentialRead();
@@ -1027,6 +1047,7 @@ public:
 	void OnFilesystemReadsStarted(const FFileIoStoreReadRequestList& Requests) {}
 	void OnFilesystemReadCompleted(const FFileIoStoreReadRequest* Request) {}
 	void OnFilesystemReadsCompleted(const FFileIoStoreReadRequestList& CompletedRequests) {}
+	void OnFilesystemReadsCoalesced(uint32 NumReads) {}
 
 private:
 	friend class FFileIoStore;
@@ -1042,6 +1063,7 @@ private:
 	void OnBlockCacheStore(uint64 NumBytes) {}
 	void OnBlockCacheHit(uint64 NumBytes) {}
 	void OnBlockCacheMiss(uint64 NumBytes) {}
+	void OnReadAvoided() {}
 	void OnTocMounted(uint64 AllocatedSize) {}
 	void OnTocUnmounted(uint64 AllocatedSize) {}
 	void OnBufferReleased() {}
@@ -100,46 +100,74 @@ bool FGenericFileIoStoreImpl::StartRequests(FFileIoStoreRequestQueue& RequestQue
 		return true;
 	}
 
-	uint8* Dest;
-	check(!NextRequest->ImmediateScatter.Request);
-	
-	NextRequest->Buffer = AcquiredBuffer;
-	AcquiredBuffer = nullptr;
-	Dest = NextRequest->Buffer->Memory;
-
-	if (!BlockCache->Read(NextRequest))
+	// Adjacent reads are read right after each other from the same handle, without seeking back in between
+	const uint64 RunOffset = NextRequest->Offset;
+	uint32 NumCoalescedReads = 0;
+	while (NextRequest)
 	{
-		IFileHandle* FileHandle = reinterpret_cast<IFileHandle*>(static_cast<UPTRINT>(NextRequest->ContainerFilePartition->FileHandle));
-		 
-		Stats->OnFilesystemReadStarted(NextRequest);
+		uint8* Dest;
+		check(!NextRequest->ImmediateScatter.Request);
+		
+		NextRequest->Buffer = AcquiredBuffer;
+		AcquiredBuffer = nullptr;
+		Dest = NextRequest->Buffer->Memory;
+
+		bool bReadFromFile = false;
+		if (!BlockCache->Read(NextRequest))
 		{
-			TRACE_CPUPROFILER_EVENT_SCOPE(ReadBlockFromFile);
-			NextRequest->bFailed = true;
-			int32 RetryCount = 0;
-			while (RetryCount++ < 10)
+			IFileHandle* FileHandle = reinterpret_cast<IFileHandle*>(static_cast<UPTRINT>(NextRequest->ContainerFilePartition->FileHandle));
+			 
+			Stats->OnFilesystemReadStarted(NextRequest);
 			{
-				if (!FileHandle->Seek(NextRequest->Offset))
+				TRACE_CPUPROFILER_EVENT_SCOPE(ReadBlockFromFile);
+				NextRequest->bFailed = true;
+				int32 RetryCount = 0;
+				while (RetryCount++ < 10)
 				{
-					UE_LOG(LogIoDispatcher, Warning, TEXT("Failed seeking to offset %lld (Retries: %d)"), NextRequest->Offset, (RetryCount - 1));
-					continue;
+					if (!FileHandle->Seek(NextRequest->Offset))
+					{
+						UE_LOG(LogIoDispatcher, Warning, TEXT("Failed seeking to offset %lld (Retries: %d)"), NextRequest->Offset, (RetryCount - 1));
+						continue;
+					}
+					if (!FileHandle->Read(Dest, NextRequest->Size))
+					{
+						UE_LOG(LogIoDispatcher, Warning, TEXT("Failed reading %lld bytes at offset %lld (Retries: %d)"), NextRequest->Size, NextRequest->Offset, (RetryCount - 1));
+						continue;
+					}
+					NextRequest->bFailed = false;
+					Stats->OnFilesystemReadCompleted(NextRequest);
+					BlockCache->Store(NextRequest);
+					bReadFromFile = true;
+					break;
 				}
-				if (!FileHandle->Read(Dest, NextRequest->Size))
-				{
-					UE_LOG(LogIoDispatcher, Warning, TEXT("Failed reading %lld bytes at offset %lld (Retries: %d)"), NextRequest->Size, NextRequest->Offset, (RetryCount - 1));
-					continue;
-				}
-				NextRequest->bFailed = false;
-				Stats->OnFilesystemReadCompleted(NextRequest);
-				BlockCache->Store(NextRequest);
-				break;
 			}
 		}
+
+		// The next read has to be found before this one is completed, the request can be freed by the dispatcher thread after that
+		FFileIoStoreReadRequest* PreviousRequest = NextRequest;
+		NextRequest = nullptr;
+		if (bReadFromFile)
+		{
+			AcquiredBuffer = BufferAllocator->AllocBuffer();
+			if (AcquiredBuffer)
+			{
+				const uint64 RunSize = PreviousRequest->Offset + PreviousRequest->Size - RunOffset;
+				NextRequest = RequestQueue.PopAdjacent(*PreviousRequest, RunSize, true);
+				NumCoalescedReads += NextRequest ? 1 : 0;
+			}
+		}
+
+		{
+			FScopeLock _(&CompletedRequestsCritical);
+			CompletedRequests.Add(PreviousRequest);
+		}
+		WakeUpDispatcherThreadDelegate->Execute();
 	}
+
+	if (NumCoalescedReads > 0)
 	{
-		FScopeLock _(&CompletedRequestsCritical);
-		CompletedRequests.Add(NextRequest);
+		Stats->OnFilesystemReadsCoalesced(NumCoalescedReads);
 	}
-	WakeUpDispatcherThreadDelegate->Execute();
 	return true;
 }
 
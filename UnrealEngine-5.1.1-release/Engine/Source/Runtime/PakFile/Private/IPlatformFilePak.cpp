@@ -5667,6 +5667,9 @@ bool FPakFile::LoadIndexInternal(FArchive& Reader)
 	// Load the Secondary Index(es)
 	TArray<uint8> PathHashIndexData;
 	FMemoryReader PathHashIndexReader(PathHashIndexData);
+	MappedPathHashIndex.Reset();
+	MappedPathHashIndexRegion.Reset();
+	MappedPathHashIndexHandle.Reset();
 	if (bWillUsePathHashIndex)
 	{
 		if (PathHashIndexOffset < 0 || CachedTotalSize < (PathHashIndexOffset + PathHashIndexSize))
@@ -5679,32 +5682,36 @@ bool FPakFile::LoadIndexInternal(FArchive& Reader)
 			UE_LOG(LogPakFile, Log, TEXT(" PathHashIndexSize: %d"), PathHashIndexSize);
 			return false;
 		}
-		Reader.Seek(PathHashIndexOffset);
-		PathHashIndexData.SetNum(PathHashIndexSize);
+		// A mapped PathHashIndex is queried in place, PathHashIndexData only receives the Pruned DirectoryIndex that follows it
+		if (!TryMapPathHashIndex(PathHashIndexOffset, PathHashIndexSize, PathHashIndexHash, PathHashIndexData))
 		{
-			SCOPED_BOOT_TIMING("PakFile_LoadPathHashIndex");
-			Reader.Serialize(PathHashIndexData.GetData(), PathHashIndexSize);
-		}
+			Reader.Seek(PathHashIndexOffset);
+			PathHashIndexData.SetNum(PathHashIndexSize);
+			{
+				SCOPED_BOOT_TIMING("PakFile_LoadPathHashIndex");
+				Reader.Serialize(PathHashIndexData.GetData(), PathHashIndexSize);
+			}
 
-		{
-			SCOPED_BOOT_TIMING("PakFile_HashPathHashIndex");
-			if (!DecryptAndValidateIndex(Reader, PathHashIndexData, PathHashIndexHash, ComputedHash))
 			{
-				UE_LOG(LogPakFile, Log, TEXT("Corrupt pak PathHashIndex detected!"));
-				UE_LOG(LogPakFile, Log, TEXT(" Filename: %s"), *PakFilename);
-				UE_LOG(LogPakFile, Log, TEXT(" Encrypted: %d"), Info.bEncryptedIndex);
-				UE_LOG(LogPakFile, Log, TEXT(" Total Size: %d"), Reader.TotalSize());
-				UE_LOG(LogPakFile, Log, TEXT(" Index Offset: %d"), FullDirectoryIndexOffset);
-				UE_LOG(LogPakFile, Log, TEXT(" Index Size: %d"), FullDirectoryIndexSize);
-				UE_LOG(LogPakFile, Log, TEXT(" Stored Index Hash: %s"), *PathHashIndexHash.ToString());
-				UE_LOG(LogPakFile, Log, TEXT(" Computed Index Hash: %s"), *ComputedHash.ToString());
-				return false;
+				SCOPED_BOOT_TIMING("PakFile_HashPathHashIndex");
+				if (!DecryptAndValidateIndex(Reader, PathHashIndexData, PathHashIndexHash, ComputedHash))
+				{
+					UE_LOG(LogPakFile, Log, TEXT("Corrupt pak PathHashIndex detected!"));
+					UE_LOG(LogPakFile, Log, TEXT(" Filename: %s"), *PakFilename);
+					UE_LOG(LogPakFile, Log, TEXT(" Encrypted: %d"), Info.bEncryptedIndex);
+					UE_LOG(LogPakFile, Log, TEXT(" Total Size: %d"), Reader.TotalSize());
+					UE_LOG(LogPakFile, Log, TEXT(" Index Offset: %d"), FullDirectoryIndexOffset);
+					UE_LOG(LogPakFile, Log, TEXT(" Index Size: %d"), FullDirectoryIndexSize);
+					UE_LOG(LogPakFile, Log, TEXT(" Stored Index Hash: %s"), *PathHashIndexHash.ToString());
+					UE_LOG(LogPakFile, Log, TEXT(" Computed Index Hash: %s"), *ComputedHash.ToString());
+					return false;
+				}
 			}
-		}
 
-		{
-			SCOPED_BOOT_TIMING("PakFile_SerializePathHashIndex");
-			PathHashIndexReader << PathHashIndex;
+			{
+				SCOPED_BOOT_TIMING("PakFile_SerializePathHashIndex");
+				PathHashIndexReader << PathHashIndex;
+			}
 		}
 		bHasPathHashIndex = true;
 	}
@@ -5899,6 +5906,79 @@ bool FPakFile::DecryptAndValidateIndex(FArchive& Reader, TArray<uint8>& IndexDat
 	return InExpectedHash == OutActualHash;
 }
 
+bool FPakFile::TryMapPathHashIndex(int64 PathHashIndexOffset, int64 PathHashIndexSize, const FSHAHash& PathHashIndexHash, TArray<uint8>& OutPrunedDirectoryIndexData)
+{
+	// Encrypted indexes have to be decrypted into memory and signed paks verify all reads through the Decryptor
+	if (!IsPakMapPathHashIndex() || !GMMIO_Enable || Info.Version < FPakInfo::PakFile_Version_SortedPathHashIndex || Info.bEncryptedIndex || bSigned)
+	{
+		return false;
+	}
+
+	SCOPED_BOOT_TIMING("PakFile_MapPathHashIndex");
+	auto UnmapAndFail = [this]()
+	{
+		MappedPathHashIndex.Reset();
+		MappedPathHashIndexRegion.Reset();
+		MappedPathHashIndexHandle.Reset();
+		return false;
+	};
+
+	MappedPathHashIndexHandle.Reset(IPlatformFile::GetPlatformPhysical().OpenMapped(*PakFilename));
+	if (!MappedPathHashIndexHandle)
+	{
+		return UnmapAndFail();
+	}
+	MappedPathHashIndexRegion.Reset(MappedPathHashIndexHandle->MapRegion(PathHashIndexOffset, PathHashIndexSize));
+	if (!MappedPathHashIndexRegion || MappedPathHashIndexRegion->GetMappedSize() < PathHashIndexSize)
+	{
+		return UnmapAndFail();
+	}
+
+	const uint8* Data = MappedPathHashIndexRegion->GetMappedPtr();
+	if (IsPakValidateMappedPathHashIndex())
+	{
+		SCOPED_BOOT_TIMING("PakFile_HashMappedPathHashIndex");
+		FSHAHash ComputedHash;
+		FSHA1::HashBuffer(Data, PathHashIndexSize, ComputedHash.Hash);
+		if (ComputedHash != PathHashIndexHash)
+		{
+			// Loading the index reports the corruption
+			return UnmapAndFail();
+		}
+	}
+
+	if (!MappedPathHashIndex.Initialize(Data, PathHashIndexSize))
+	{
+		UE_LOG(LogPakFile, Verbose, TEXT("PathHashIndex of pak file '%s' can't be queried in place, loading it"), *PakFilename);
+		return UnmapAndFail();
+	}
+
+	PathHashIndex.Empty();
+	const int64 PrunedDirectoryIndexOffset = MappedPathHashIndex.GetSerializedSize();
+	OutPrunedDirectoryIndexData.SetNumUninitialized(PathHashIndexSize - PrunedDirectoryIndexOffset);
+	FMemory::Memcpy(OutPrunedDirectoryIndexData.GetData(), Data + PrunedDirectoryIndexOffset, PathHashIndexSize - PrunedDirectoryIndexOffset);
+
+	UE_LOG(LogPakFile, Verbose, TEXT("Mapped PathHashIndex of pak file '%s' with %d entries"), *PakFilename, MappedPathHashIndex.GetNum());
+	return true;
+}
+
+void FPakFile::UnmapPathHashIndex()
+{
+	if (!MappedPathHashIndex.IsValid())
+	{
+		return;
+	}
+
+	PathHashIndex.Empty(MappedPathHashIndex.GetNum());
+	for (int32 Index = 0; Index < MappedPathHashIndex.GetNum(); ++Index)
+	{
+		PathHashIndex.Add(MappedPathHashIndex.GetHash(Index), MappedPathHashIndex.GetLocation(Index));
+	}
+	MappedPathHashIndex.Reset();
+	MappedPathHashIndexRegion.Reset();
+	MappedPathHashIndexHandle.Reset();
+}
+
 /*** This is a copy of FFnv::MemFnv64 from before the bugfix for swapped Offset and Prime. It is used to decode legacy paks that have hashes created from the prebugfix version of the function */
 static uint64 LegacyMemFnv64(const void* InData, int32 Length, uint64 InOffset)
 {
@@ -6189,6 +6269,8 @@ struct FPakFile::FIndexSettings
 		bDelayPruning = false;
 		bWritePathHashIndex = true;
 		bWriteFullDirectoryIndex = true;
+		bMapPathHashIndex = true;
+		bValidateMappedPathHashIndex = true;
 
 		// Paks are mounted before config files are read, so the licensee needs to hardcode all settings used for runtime index loading rather than specifying them in ini
 		if (FPakPlatformFile::GetPakSetIndexSettingsDelegate().IsBound())
@@ -6217,6 +6299,8 @@ struct FPakFile::FIndexSettings
 #endif
 		FParse::Bool(CommandLine, TEXT("ForcePakWritePathHashIndex="), bWritePathHashIndex);
 		FParse::Bool(CommandLine, TEXT("ForcePakWriteFullDirectoryIndex="), bWriteFullDirectoryIndex);
+		FParse::Bool(CommandLine, TEXT("ForcePakMapPathHashIndex="), bMapPathHashIndex);
+		FParse::Bool(CommandLine, TEXT("ForcePakValidateMappedPathHashIndex="), bValidateMappedPathHashIndex);
 #endif
 	}
 
@@ -6225,6 +6309,8 @@ struct FPakFile::FIndexSettings
 	bool bDelayPruning;
 	bool bWritePathHashIndex;
 	bool bWriteFullDirectoryIndex;
+	bool bMapPathHashIndex;
+	bool bValidateMappedPathHashIndex;
 };
 
 FPakFile::FIndexSettings& FPakFile::GetIndexSettings()
@@ -6267,6 +6353,18 @@ bool FPakFile::IsPakWriteFullDirectoryIndex()
 	return IndexLoadParams.bWriteFullDirectoryIndex;
 }
 
+bool FPakFile::IsPakMapPathHashIndex()
+{
+	FIndexSettings& IndexLoadParams = GetIndexSettings();
+	return IndexLoadParams.bMapPathHashIndex;
+}
+
+bool FPakFile::IsPakValidateMappedPathHashIndex()
+{
+	FIndexSettings& IndexLoadParams = GetIndexSettings();
+	return IndexLoadParams.bValidateMappedPathHashIndex;
+}
+
 bool FPakFile::RequiresDirectoryIndexLock() const
 {
 #if ENABLE_PAKFILE_RUNTIME_PRUNING
@@ -7106,6 +7204,21 @@ const FPakEntryLocation* FPakFile::FindLocationFromIndex(const FString& FullPath
 	return PathHashIndex.Find(PathHash);
 }
 
+const FPakEntryLocation* FPakFile::FindLocationFromPathHashIndex(const FString& FullPath) const
+{
+	if (!MappedPathHashIndex.IsValid())
+	{
+		return FindLocationFromIndex(FullPath, MountPoint, PathHashIndex, PathHashSeed, Info.Version);
+	}
+
+	const TCHAR* RelativePathFromMount = GetRelativeFilePathFromMountPointer(FullPath, MountPoint);
+	if (!RelativePathFromMount)
+	{
+		return nullptr;
+	}
+	return MappedPathHashIndex.Find(HashPath(RelativePathFromMount, PathHashSeed, Info.Version));
+}
+
 const FPakEntryLocation* FPakFile::FindLocationFromIndex(const FString& FullPath, const FString& MountPoint, const FDirectoryIndex& DirectoryIndex)
 {
 	if (!FullPath.StartsWith(MountPoint))
@@ -7137,7 +7250,7 @@ FPakFile::EFindResult FPakFile::Find(const FString& FullPath, FPakEntry* OutEntr
 	if (IsPakValidatePruning() && bHasPathHashIndex && bHasFullDirectoryIndex)
 	{
 		const FPakEntryLocation* PathHashLocation = nullptr;
-		PathHashLocation = FindLocationFromIndex(FullPath, MountPoint, PathHashIndex, PathHashSeed, Info.Version);
+		PathHashLocation = FindLocationFromPathHashIndex(FullPath);
 
 		const FPakEntryLocation* DirectoryLocation = nullptr;
 
@@ -7164,7 +7277,7 @@ FPakFile::EFindResult FPakFile::Find(const FString& FullPath, FPakEntry* OutEntr
 	{
 		if (bHasPathHashIndex)
 		{
-			PakEntryLocation = FindLocationFromIndex(FullPath, MountPoint, PathHashIndex, PathHashSeed, Info.Version);
+			PakEntryLocation = FindLocationFromPathHashIndex(FullPath);
 		}
 		else
 		{
@@ -8384,6 +8497,7 @@ void FPakFile::AddSpecialFile(const FPakEntry& Entry, const FString& Filename)
 		NumEntries++;
 	}
 
+	UnmapPathHashIndex();
 	FPathHashIndex* PathHashToWrite = bHasPathHashIndex ? &PathHashIndex : nullptr;
 	AddEntryToIndex(Filename, EntryLocation, MountPoint, PathHashSeed, &DirectoryIndex, PathHashToWrite, nullptr /* CollisionDetection */, Info.Version);
 }
@@ -52,7 +52,7 @@ int32 GIoDispatcherDecompressionWorkerCount = 4;
 static FAutoConsoleVariableRef CVar_IoDispatcherDecompressionWorkerCount(
 	TEXT("s.IoDispatcherDecompressionWorkerCount"),
 	GIoDispatcherDecompressionWorkerCount,
-	TEXT("IoDispatcher decompression worker count.")
+	TEXT("IoDispatcher decompression worker count, <= 0 to use one per background task thread.")
 );
 
 int32 GIoDispatcherCacheSizeMB = 0;
@@ -90,6 +90,20 @@ static FAutoConsoleVariableRef CVar_IoDispatcherRequestLatencyCircuitBreakerMS(
 	TEXT("If s.IoDispatcherSortRequestsByOffset is enabled and this is >0, if the oldest request has been in the queue for this long, read it instead of the most optimal read")
 );
 
+int32 GIoDispatcherCoalesceReadsMaxSizeKB = 1024;
+static FAutoConsoleVariableRef CVar_IoDispatcherCoalesceReadsMaxSizeKB(
+	TEXT("s.IoDispatcherCoalesceReadsMaxSizeKB"),
+	GIoDispatcherCoalesceReadsMaxSizeKB,
+	TEXT("If > 0, queued reads that are adjacent in the same file are read together, up to this many bytes at a time")
+);
+
+int32 GIoDispatcherCoalesceReadsMaxGapKB = 0;
+static FAutoConsoleVariableRef CVar_IoDispatcherCoalesceReadsMaxGapKB(
+	TEXT("s.IoDispatcherCoalesceReadsMaxGapKB"),
+	GIoDispatcherCoalesceReadsMaxGapKB,
+	TEXT("If s.IoDispatcherCoalesceReadsMaxSizeKB is enabled, reads that start at most this far after the end of the previous read are coalesced with it, on backends that can skip the gap")
+);
+
 int32 GIoDispatcherTocsEnablePerfectHashing = 1;
 static FAutoConsoleVariableRef CVar_IoDispatcherTocsEnablePerfectHashing(
 	TEXT("s.IoDispatcherTocsEnablePerfectHashing"),
@@ -97,6 +111,20 @@ static FAutoConsoleVariableRef CVar_IoDispatcherTocsEnablePerfectHashing(
 	TEXT("Enable perfect hashmap lookups for iostore tocs")
 );
 
+int32 GIoDispatcherMemoryMappedReads = 1;
+static FAutoConsoleVariableRef CVar_IoDispatcherMemoryMappedReads(
+	TEXT("s.IoDispatcherMemoryMappedReads"),
+	GIoDispatcherMemoryMappedReads,
+	TEXT("Complete reads that allow memory mapping with a mapped view of the container file if the chunk is stored uncompressed and unencrypted")
+);
+
+int32 GIoDispatcherMemoryMappedReadMinSizeKB = 64;
+static FAutoConsoleVariableRef CVar_IoDispatcherMemoryMappedReadMinSizeKB(
+	TEXT("s.IoDispatcherMemoryMappedReadMinSizeKB"),
+	GIoDispatcherMemoryMappedReadMinSizeKB,
+	TEXT("Reads smaller than this are read into memory even if they allow memory mapping")
+);
+
 uint32 FFileIoStoreReadRequest::NextSequence = 0;
 #if CHECK_IO_STORE_READ_REQUEST_LIST_MEMBERSHIP
 uint32 FFileIoStoreReadRequestList::NextListCookie = 0;
@@ -129,6 +157,7 @@ void FFileIoStoreBufferAllocator::Initialize(uint64 InMemorySize, uint64 InBuffe
 	uint64 BufferCount = InMemorySize / InBufferSize;
 	uint64 MemorySize = BufferCount * InBufferSize;
 	BufferMemory = reinterpret_cast<uint8*>(FMemory::Malloc(MemorySize, InBufferAlignment));
+	BufferMemorySize = MemorySize;
 	BufferSize = InBufferSize;
 	for (uint64 BufferIndex = 0; BufferIndex < BufferCount; ++BufferIndex)
 	{
@@ -417,6 +446,38 @@ void FFileIoStoreOffsetSortedRequestQueue::Push(FFileIoStoreReadRequest* Request
 	PeekRequestIndex = INDEX_NONE;
 }
 
+FFileIoStoreReadRequest* FFileIoStoreOffsetSortedRequestQueue::FindAdjacent(uint64 Handle, uint64 BeginOffset, uint64 EndOffset) const
+{
+	FFileIoStoreReadRequestSortKey Key;
+	Key.Handle = Handle;
+	Key.Offset = BeginOffset;
+	for (int32 RequestIndex = Algo::LowerBoundBy(Requests, Key, RequestSortProjection, RequestSortPredicate); RequestIndex < Requests.Num(); ++RequestIndex)
+	{
+		FFileIoStoreReadRequest* Request = Requests[RequestIndex];
+		if (Request->ContainerFilePartition->FileHandle != Handle || Request->Offset > EndOffset)
+		{
+			break;
+		}
+		if (!(Request->bCancelled | Request->bFailed))
+		{
+			return Request;
+		}
+	}
+	return nullptr;
+}
+
+void FFileIoStoreOffsetSortedRequestQueue::Remove(FFileIoStoreReadRequest* Request)
+{
+	int32 RequestIndex = Algo::LowerBoundBy(Requests, RequestSortProjection(Request), RequestSortProjection, RequestSortPredicate);
+	while (Requests[RequestIndex] != Request)
+	{
+		++RequestIndex;
+	}
+	Requests.RemoveAt(RequestIndex);
+	RequestsBySequence.Remove(Request);
+	PeekRequestIndex = INDEX_NONE;
+}
+
 int32 HandleContainerUnmounted(const TArrayView<FFileIoStoreReadRequest*> Requests, const FFileIoStoreContainerFile& ContainerFile)
 {
 	static FFileIoStoreContainerFilePartition UnmountedPartition;
@@ -522,6 +583,83 @@ FFileIoStoreReadRequest* FFileIoStoreRequestQueue::Pop()
 	return Result;
 }
 
+FFileIoStoreReadRequest* FFileIoStoreRequestQueue::PopAdjacent(const FFileIoStoreReadRequest& Previous, uint64 RunSize, bool bAllowGap)
+{
+	const uint64 MaxRunSize = uint64(FMath::Max(GIoDispatcherCoalesceReadsMaxSizeKB, 0)) << 10;
+	if (RunSize >= MaxRunSize)
+	{
+		return nullptr;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(RequestQueuePopAdjacent);
+	FScopeLock _(&CriticalSection);
+	UpdateSortRequestsByOffset();
+
+	const uint64 Handle = Previous.ContainerFilePartition->FileHandle;
+	const uint64 BeginOffset = Previous.Offset + Previous.Size;
+	const uint64 EndOffset = BeginOffset + (bAllowGap ? uint64(FMath::Max(GIoDispatcherCoalesceReadsMaxGapKB, 0)) << 10 : 0);
+
+	// The closest read regardless of its priority, it's cheaper to read it now than to seek back to it later
+	FFileIoStoreReadRequest* Result = nullptr;
+	int32 ResultIndex = INDEX_NONE;
+	if (bSortRequestsByOffset)
+	{
+		for (int32 QueueIndex = 0; QueueIndex < SortedPriorityQueues.Num(); ++QueueIndex)
+		{
+			FFileIoStoreReadRequest* Request = SortedPriorityQueues[QueueIndex].FindAdjacent(Handle, BeginOffset, Result ? Result->Offset : EndOffset);
+			if (Request && (!Result || Request->Offset < Result->Offset))
+			{
+				Result = Request;
+				ResultIndex = QueueIndex;
+			}
+		}
+	}
+	else
+	{
+		for (int32 Index = 0; Index < Heap.Num(); ++Index)
+		{
+			FFileIoStoreReadRequest* Request = Heap[Index];
+			if (Request->ContainerFilePartition->FileHandle == Handle &&
+				Request->Offset >= BeginOffset &&
+				Request->Offset <= (Result ? Result->Offset : EndOffset) &&
+				!(Request->bCancelled | Request->bFailed))
+			{
+				Result = Request;
+				ResultIndex = Index;
+			}
+		}
+	}
+
+	if (!Result || RunSize + (Result->Offset - BeginOffset) + Result->Size > MaxRunSize)
+	{
+		return nullptr;
+	}
+
+	if (bSortRequestsByOffset)
+	{
+		FFileIoStoreOffsetSortedRequestQueue& SubQueue = SortedPriorityQueues[ResultIndex];
+		SubQueue.Remove(Result);
+		if (SubQueue.IsEmpty())
+		{
+			SortedPriorityQueues.RemoveAt(ResultIndex);
+			// SubQueue is invalid here
+#if UE_FILEIOSTORE_DETAILED_QUEUE_COUNTERS_ENABLED
+			TRACE_COUNTER_DECREMENT(IoDispatcherNumPriorityQueues);
+#endif
+		}
+		LastSortKey = Result;
+	}
+	else
+	{
+		Heap.HeapRemoveAt(ResultIndex, QueueSortFunc, false);
+	}
+
+	check(Result->QueueStatus == FFileIoStoreReadRequest::QueueStatus_InQueue);
+	Result->QueueStatus = FFileIoStoreReadRequest::QueueStatus_Started;
+	Result->ContainerFilePartition->StartedReadRequestsCount.fetch_add(1, std::memory_order_release);
+	return Result;
+}
+
 void FFileIoStoreRequestQueue::PushToPriorityQueues(FFileIoStoreReadRequest* Request)
 {
 	int32 QueueIndex = Algo::LowerBoundBy(SortedPriorityQueues, Request->Priority, QueuePriorityProjection, TLess<int32>());
@@ -653,6 +791,7 @@ FFileIoStoreReader::~FFileIoStoreReader()
 uint64 FFileIoStoreReader::GetTocAllocatedSize() const
 {
 	return TocImperfectHashMapFallback.GetAllocatedSize() +
+		ReferencedChunks.GetAllocatedSize() +
 		PerfectHashMap.TocOffsetAndLengths.GetAllocatedSize() +
 		PerfectHashMap.TocChunkIds.GetAllocatedSize() +
 		PerfectHashMap.TocChunkHashSeeds.GetAllocatedSize() +
@@ -723,6 +862,12 @@ FIoStatus FFileIoStoreReader::Initialize(const TCHAR* InTocFilePath, int32 InOrd
 		}
 		bHasPerfectHashMap = false;
 	}
+
+	ReferencedChunks.Reserve(TocResource.ReferencedChunks.Num());
+	for (const FIoStoreTocReferencedChunk& ReferencedChunk : TocResource.ReferencedChunks)
+	{
+		ReferencedChunks.Add(ReferencedChunk.ChunkId, ReferencedChunk);
+	}
 	
 	ContainerFile.CompressionMethods	= MoveTemp(TocResource.CompressionMethods);
 	ContainerFile.CompressionBlockSize	= TocResource.Header.CompressionBlockSize;
@@ -760,6 +905,7 @@ FIoStatus FFileIoStoreReader::Close()
 	PerfectHashMap.TocChunkIds.Empty();
 	PerfectHashMap.TocOffsetAndLengths.Empty();
 	TocImperfectHashMapFallback.Empty();
+	ReferencedChunks.Empty();
 	ContainerFile = FFileIoStoreContainerFile();
 	ContainerId = FIoContainerId();
 	Order = INDEX_NONE;
@@ -846,6 +992,8 @@ IMappedFileHandle* FFileIoStoreReader::GetMappedContainerFileHandle(uint64 TocOf
 	check(!bClosed);
 	int32 PartitionIndex = int32(TocOffset / ContainerFile.PartitionSize);
 	FFileIoStoreContainerFilePartition& Partition = ContainerFile.Partitions[PartitionIndex];
+	// called from the IoDispatcher thread for mapped reads and from any thread by OpenMapped
+	FScopeLock _(&MappedFileHandlesCritical);
 	if (!Partition.MappedFileHandle)
 	{
 		IPlatformFile& Ipf = FPlatformFileManager::Get().GetPlatformFile();
@@ -1216,6 +1364,7 @@ FFileIoStore::FFileIoStore(TUniquePtr<IPlatformFileIoStore>&& InPlatformImpl)
 FFileIoStore::~FFileIoStore()
 {
 	delete Thread;
+	PersistentBlockCache.Shutdown();
 }
 
 void FFileIoStore::Initialize(TSharedRef<const FIoDispatcherBackendContext> InContext)
@@ -1234,6 +1383,7 @@ void FFileIoStore::Initialize(TSharedRef<const FIoDispatcherBackendContext> InCo
 
 	uint64 CacheMemorySize = uint64(GIoDispatcherCacheSizeMB) << 20ull;
 	BlockCache.Initialize(CacheMemorySize, BufferSize);
+	PersistentBlockCache.Initialize();
 
 	PlatformImpl->Initialize({
 		&BackendContext->WakeUpDispatcherThreadDelegate,
@@ -1243,7 +1393,22 @@ void FFileIoStore::Initialize(TSharedRef<const FIoDispatcherBackendContext> InCo
 		&Stats
 	});
 
-	uint64 DecompressionContextCount = uint64(GIoDispatcherDecompressionWorkerCount > 0 ? GIoDispatcherDecompressionWorkerCount : 4);
+	uint64 DecompressionContextCount = 4;
+	if (GIoDispatcherDecompressionWorkerCount > 0)
+	{
+		DecompressionContextCount = uint64(GIoDispatcherDecompressionWorkerCount);
+	}
+	else if (FTaskGraphInterface::IsRunning())
+	{
+		// Decompression tasks run on background task threads if there are any, so that many blocks can be decompressed at the same time
+		int32 TaskThreadCount = FTaskGraphInterface::Get().GetNumBackgroundThreads();
+		if (TaskThreadCount <= 0)
+		{
+			TaskThreadCount = FTaskGraphInterface::Get().GetNumWorkerThreads();
+		}
+		DecompressionContextCount = uint64(FMath::Max(TaskThreadCount, 1));
+	}
+	UE_LOG(LogIoDispatcher, Log, TEXT("Using %llu decompression contexts"), DecompressionContextCount);
 	for (uint64 ContextIndex = 0; ContextIndex < DecompressionContextCount; ++ContextIndex)
 	{
 		FFileIoStoreCompressionContext* Context = new FFileIoStoreCompressionContext();
@@ -1287,6 +1452,8 @@ TIoStatusOr<FIoContainerHeader> FFileIoStore::Mount(const TCHAR* InTocPath, int3
 		return ContainerHeaderReadResult;
 	}
 
+	PersistentBlockCache.OnContainerMounted(*Reader->GetContainerFile(), Reader->GetContainerId());
+
 	int32 InsertionIndex;
 	{
 		FWriteScopeLock _(IoStoreReadersLock);
@@ -1298,8 +1465,25 @@ TIoStatusOr<FIoContainerHeader> FFileIoStore::Mount(const TCHAR* InTocPath, int3
 			}
 			return A->GetContainerInstanceId() > B->GetContainerInstanceId();
 		});
+		const FFileIoStoreReader& MountedReader = *Reader;
 		IoStoreReaders.Insert(MoveTemp(Reader), InsertionIndex);
 		UE_LOG(LogIoDispatcher, Display, TEXT("Mounting container '%s' in location slot %d"), InTocPath, InsertionIndex);
+
+		if (MountedReader.GetReferencedChunks().Num())
+		{
+			TSet<FIoContainerId> MissingSourceContainers;
+			for (const TPair<FIoChunkId, FIoStoreTocReferencedChunk>& KV : MountedReader.GetReferencedChunks())
+			{
+				MissingSourceContainers.Add(KV.Value.SourceContainerId);
+			}
+			for (const TUniquePtr<FFileIoStoreReader>& OtherReader : IoStoreReaders)
+			{
+				MissingSourceContainers.Remove(OtherReader->GetContainerId());
+			}
+			// the references are resolved on each request, so the source containers can still be mounted later
+			UE_CLOG(MissingSourceContainers.Num() > 0, LogIoDispatcher, Warning, TEXT("Container '%s' references %d chunks in %d containers that are not mounted"),
+				InTocPath, MountedReader.GetReferencedChunks().Num(), MissingSourceContainers.Num());
+		}
 	}
 
 	return ContainerHeader;
@@ -1325,6 +1509,7 @@ bool FFileIoStore::Unmount(const TCHAR* InTocPath)
 	if (ReaderToUnmount)
 	{
 		UE_LOG(LogIoDispatcher, Display, TEXT("Unmounting container '%s'"), InTocPath);
+		PersistentBlockCache.OnContainerUnmounted(*ReaderToUnmount->GetContainerFile());
 
 		int32 FailedRequestsCount = RequestQueue.HandleContainerUnmounted(*ReaderToUnmount->GetContainerFile());
 
@@ -1352,64 +1537,159 @@ bool FFileIoStore::Unmount(const TCHAR* InTocPath)
 	return false;
 }
 
-bool FFileIoStore::Resolve(FIoRequestImpl* Request)
+FFileIoStoreReader* FFileIoStore::FindChunk(const FIoChunkId& ChunkId, const FIoOffsetAndLength*& OutOffsetAndLength) const
 {
-	FReadScopeLock _(IoStoreReadersLock);
 	for (const TUniquePtr<FFileIoStoreReader>& Reader : IoStoreReaders)
 	{
-		if (const FIoOffsetAndLength* OffsetAndLength = Reader->Resolve(Request->ChunkId))
+		if (const FIoOffsetAndLength* OffsetAndLength = Reader->Resolve(ChunkId))
+		{
+			OutOffsetAndLength = OffsetAndLength;
+			return Reader.Get();
+		}
+		if (const FIoStoreTocReferencedChunk* ReferencedChunk = Reader->FindReferencedChunk(ChunkId))
 		{
-			uint64 RequestedOffset = Request->Options.GetOffset();
-			uint64 ResolvedOffset = OffsetAndLength->GetOffset() + RequestedOffset;
-			uint64 ResolvedSize = 0;
-			if (RequestedOffset <= OffsetAndLength->GetLength())
+			for (const TUniquePtr<FFileIoStoreReader>& SourceReader : IoStoreReaders)
 			{
-				ResolvedSize = FMath::Min(Request->Options.GetSize(), OffsetAndLength->GetLength() - RequestedOffset);
+				if (SourceReader->GetContainerId() == ReferencedChunk->SourceContainerId)
+				{
+					if (const FIoOffsetAndLength* OffsetAndLength = SourceReader->Resolve(ReferencedChunk->SourceChunkId))
+					{
+						OutOffsetAndLength = OffsetAndLength;
+						return SourceReader.Get();
+					}
+				}
 			}
+		}
+	}
+	return nullptr;
+}
 
-			FFileIoStoreResolvedRequest* ResolvedRequest = RequestAllocator.AllocResolvedRequest(
-				*Request,
-				Reader->GetContainerFile(),
-				ResolvedOffset,
-				ResolvedSize);
-			Request->BackendData = ResolvedRequest;
+bool FFileIoStore::Resolve(FIoRequestImpl* Request)
+{
+	FReadScopeLock _(IoStoreReadersLock);
+	const FIoOffsetAndLength* OffsetAndLength = nullptr;
+	if (FFileIoStoreReader* Reader = FindChunk(Request->ChunkId, OffsetAndLength))
+	{
+		uint64 RequestedOffset = Request->Options.GetOffset();
+		uint64 ResolvedOffset = OffsetAndLength->GetOffset() + RequestedOffset;
+		uint64 ResolvedSize = 0;
+		if (RequestedOffset <= OffsetAndLength->GetLength())
+		{
+			ResolvedSize = FMath::Min(Request->Options.GetSize(), OffsetAndLength->GetLength() - RequestedOffset);
+		}
 
-			if (ResolvedSize > 0)
+		if (TryResolveMapped(Request, *Reader, ResolvedOffset, ResolvedSize))
+		{
+			return true;
+		}
+
+		FFileIoStoreResolvedRequest* ResolvedRequest = RequestAllocator.AllocResolvedRequest(
+			*Request,
+			Reader->GetContainerFile(),
+			ResolvedOffset,
+			ResolvedSize);
+		Request->BackendData = ResolvedRequest;
+
+		if (ResolvedSize > 0)
+		{
+			FFileIoStoreReadRequestList CustomRequests;
+			if (PlatformImpl->CreateCustomRequests(*ResolvedRequest, CustomRequests))
 			{
-				FFileIoStoreReadRequestList CustomRequests;
-				if (PlatformImpl->CreateCustomRequests(*ResolvedRequest, CustomRequests))
-				{
-					Stats.OnReadRequestsQueued(CustomRequests);
-					RequestTracker.AddReadRequestsToResolvedRequest(CustomRequests, *ResolvedRequest);
-					RequestQueue.Push(CustomRequests);
-					OnNewPendingRequestsAdded();
-				}
-				else
-				{
-					ReadBlocks(*ResolvedRequest);
-				}
+				Stats.OnReadRequestsQueued(CustomRequests);
+				RequestTracker.AddReadRequestsToResolvedRequest(CustomRequests, *ResolvedRequest);
+				RequestQueue.Push(CustomRequests);
+				OnNewPendingRequestsAdded();
 			}
 			else
 			{
-				// Nothing to read
-				CompleteDispatcherRequest(ResolvedRequest);
-				RequestTracker.ReleaseIoRequestReferences(*ResolvedRequest);
+				ReadBlocks(*ResolvedRequest);
 			}
-
-			return true;
 		}
+		else
+		{
+			// Nothing to read
+			CompleteDispatcherRequest(ResolvedRequest);
+			RequestTracker.ReleaseIoRequestReferences(*ResolvedRequest);
+		}
+
+		return true;
 	}
 
 	return false;
 }
 
+bool FFileIoStore::TryResolveMapped(FIoRequestImpl* Request, FFileIoStoreReader& Reader, uint64 ResolvedOffset, uint64 ResolvedSize)
+{
+	if (!GIoDispatcherMemoryMappedReads ||
+		!EnumHasAnyFlags(Request->Options.GetFlags(), EIoReadOptionsFlags::AllowMemoryMapping) ||
+		Request->Options.GetTargetVa() != nullptr ||
+		ResolvedSize == 0 ||
+		ResolvedSize < uint64(FMath::Max(GIoDispatcherMemoryMappedReadMinSizeKB, 0)) << 10 ||
+		Reader.IsEncrypted() ||
+		Reader.IsSigned() ||
+		!FPlatformProperties::SupportsMemoryMappedFiles())
+	{
+		return false;
+	}
+
+	// The requested range has to be stored as is and without gaps in a single partition
+	const FFileIoStoreContainerFile* ContainerFile = Reader.GetContainerFile();
+	const uint64 CompressionBlockSize = ContainerFile->CompressionBlockSize;
+	const int32 BeginBlockIndex = int32(ResolvedOffset / CompressionBlockSize);
+	const int32 EndBlockIndex = int32((ResolvedOffset + ResolvedSize - 1) / CompressionBlockSize);
+	const FIoStoreTocCompressedBlockEntry& FirstBlock = ContainerFile->CompressionBlocks[BeginBlockIndex];
+	const uint64 FirstBlockOffset = FirstBlock.GetOffset();
+	uint64 ExpectedBlockOffset = FirstBlockOffset;
+	for (int32 BlockIndex = BeginBlockIndex; BlockIndex <= EndBlockIndex; ++BlockIndex)
+	{
+		const FIoStoreTocCompressedBlockEntry& Block = ContainerFile->CompressionBlocks[BlockIndex];
+		if (Block.GetCompressionMethodIndex() != 0 ||
+			Block.GetCompressedSize() != Block.GetUncompressedSize() ||
+			Block.GetOffset() != ExpectedBlockOffset)
+		{
+			return false;
+		}
+		ExpectedBlockOffset += Block.GetUncompressedSize();
+	}
+
+	const uint64 FileOffset = FirstBlockOffset + ResolvedOffset % CompressionBlockSize;
+	if (FileOffset / ContainerFile->PartitionSize != (FileOffset + ResolvedSize - 1) / ContainerFile->PartitionSize)
+	{
+		return false;
+	}
+
+	IMappedFileHandle* MappedFileHandle = Reader.GetMappedContainerFileHandle(FileOffset);
+	IMappedFileRegion* MappedFileRegion = MappedFileHandle->MapRegion(FileOffset % ContainerFile->PartitionSize, ResolvedSize);
+	if (!MappedFileRegion)
+	{
+		// fall back to a regular read
+		delete MappedFileHandle;
+		return false;
+	}
+
+	Request->SetResult(FIoBuffer(FIoBuffer::AssumeOwnership, FIoMappedRegion{ MappedFileHandle, MappedFileRegion }));
+	Request->BackendData = nullptr;
+	if (!CompletedRequestsTail)
+	{
+		CompletedRequestsHead = CompletedRequestsTail = Request;
+	}
+	else
+	{
+		CompletedRequestsTail->NextRequest = Request;
+		CompletedRequestsTail = Request;
+	}
+	CompletedRequestsTail->NextRequest = nullptr;
+	return true;
+}
+
 void FFileIoStore::CancelIoRequest(FIoRequestImpl* Request)
 {
 	if (Request->BackendData)
 	{
 		FFileIoStoreResolvedRequest* ResolvedRequest = static_cast<FFileIoStoreResolvedRequest*>(Request->BackendData);
 		bool bShouldComplete = RequestTracker.CancelIoRequest(*ResolvedRequest);
-		if (bShouldComplete)
+		// reads from the persistent cache can't be cancelled, they write to the request buffer
+		if (bShouldComplete && ResolvedRequest->PersistentCacheReadsCount == 0)
 		{
 			ResolvedRequest->bCancelled = true;
 			CompleteDispatcherRequest(ResolvedRequest);
@@ -1429,26 +1709,17 @@ void FFileIoStore::UpdatePriorityForIoRequest(FIoRequestImpl* Request)
 bool FFileIoStore::DoesChunkExist(const FIoChunkId& ChunkId) const
 {
 	FReadScopeLock _(IoStoreReadersLock);
-	for (const TUniquePtr<FFileIoStoreReader>& Reader : IoStoreReaders)
-	{
-		if (Reader->DoesChunkExist(ChunkId))
-		{
-			return true;
-		}
-	}
-	return false;
+	const FIoOffsetAndLength* OffsetAndLength = nullptr;
+	return FindChunk(ChunkId, OffsetAndLength) != nullptr;
 }
 
 TIoStatusOr<uint64> FFileIoStore::GetSizeForChunk(const FIoChunkId& ChunkId) const
 {
 	FReadScopeLock _(IoStoreReadersLock);
-	for (const TUniquePtr<FFileIoStoreReader>& Reader : IoStoreReaders)
+	const FIoOffsetAndLength* OffsetAndLength = nullptr;
+	if (FindChunk(ChunkId, OffsetAndLength))
 	{
-		TIoStatusOr<uint64> ReaderResult = Reader->GetSizeForChunk(ChunkId);
-		if (ReaderResult.IsOk())
-		{
-			return ReaderResult;
-		}
+		return OffsetAndLength->GetLength();
 	}
 	return FIoStatus(EIoErrorCode::NotFound);
 }
@@ -1546,6 +1817,10 @@ void FFileIoStore::ScatterBlock(FFileIoStoreCompressedBlock* CompressedBlock, bo
 				UE_LOG(LogIoDispatcher, Warning, TEXT("Failed decompressing block"));
 				CompressedBlock->bFailed = true;
 			}
+			else
+			{
+				PersistentBlockCache.Store(CompressedBlock->Key.FileIndex, CompressedBlock->Key.BlockIndex, UncompressedBuffer, CompressedBlock->UncompressedSize);
+			}
 		}
 
 		for (FFileIoStoreBlockScatter& Scatter : CompressedBlock->ScatterList)
@@ -1592,6 +1867,43 @@ void FFileIoStore::CompleteDispatcherRequest(FFileIoStoreResolvedRequest* Resolv
 	CompletedRequestsTail->NextRequest = nullptr;
 }
 
+void FFileIoStore::QueueForDecompression(FFileIoStoreCompressedBlock* CompressedBlock)
+{
+	CompressedBlock->Priority = MIN_int32;
+	for (const FFileIoStoreBlockScatter& Scatter : CompressedBlock->ScatterList)
+	{
+		if (Scatter.Request->DispatcherRequest)
+		{
+			CompressedBlock->Priority = FMath::Max(CompressedBlock->Priority, Scatter.Request->GetPriority());
+		}
+	}
+
+	// Blocks wait here when all decompression contexts are in use, keep them sorted so high priority requests aren't
+	// stuck behind a burst of low priority streaming reads. Blocks with the same priority are decompressed in the order they were read.
+	CompressedBlock->Next = nullptr;
+	if (!ReadyForDecompressionTail || ReadyForDecompressionTail->Priority >= CompressedBlock->Priority)
+	{
+		if (!ReadyForDecompressionTail)
+		{
+			ReadyForDecompressionHead = CompressedBlock;
+		}
+		else
+		{
+			ReadyForDecompressionTail->Next = CompressedBlock;
+		}
+		ReadyForDecompressionTail = CompressedBlock;
+		return;
+	}
+
+	FFileIoStoreCompressedBlock** Link = &ReadyForDecompressionHead;
+	while ((*Link)->Priority >= CompressedBlock->Priority)
+	{
+		Link = &(*Link)->Next;
+	}
+	CompressedBlock->Next = *Link;
+	*Link = CompressedBlock;
+}
+
 void FFileIoStore::FinalizeCompressedBlock(FFileIoStoreCompressedBlock* CompressedBlock)
 {
 	Stats.OnDecompressComplete(CompressedBlock); 
@@ -1721,16 +2033,7 @@ FIoRequestImpl* FFileIoStore::GetCompletedRequests()
 				{
 					Stats.OnDecompressQueued(CompressedBlock);
 					RequestTracker.RemoveCompressedBlock(CompressedBlock);
-					if (!ReadyForDecompressionTail)
-					{
-						ReadyForDecompressionHead = ReadyForDecompressionTail = CompressedBlock;
-					}
-					else
-					{
-						ReadyForDecompressionTail->Next = CompressedBlock;
-						ReadyForDecompressionTail = CompressedBlock;
-					}
-					CompressedBlock->Next = nullptr;
+					QueueForDecompression(CompressedBlock);
 				}
 			}
 		}
@@ -1767,6 +2070,27 @@ FIoRequestImpl* FFileIoStore::GetCompletedRequests()
 		BlockToReap = Next;
 	}
 
+	FPersistentCacheRead* CacheReadToReap;
+	{
+		FScopeLock Lock(&DecompressedBlocksCritical);
+		CacheReadToReap = FirstCompletedPersistentCacheRead;
+		FirstCompletedPersistentCacheRead = nullptr;
+	}
+
+	FFileIoStoreReadRequestList NewBlocks;
+	while (CacheReadToReap)
+	{
+		FPersistentCacheRead* Next = CacheReadToReap->Next;
+		FinalizePersistentCacheRead(CacheReadToReap, NewBlocks);
+		CacheReadToReap = Next;
+	}
+	if (!NewBlocks.IsEmpty())
+	{
+		Stats.OnReadRequestsQueued(NewBlocks);
+		RequestQueue.Push(NewBlocks);
+		OnNewPendingRequestsAdded();
+	}
+
 	FFileIoStoreCompressedBlock* BlockToDecompress = ReadyForDecompressionHead;
 	while (BlockToDecompress)
 	{
@@ -1905,81 +2229,20 @@ void FFileIoStore::ReadBlocks(FFileIoStoreResolvedRequest& ResolvedRequest)
 	uint64 OffsetInRequest = 0;
 	for (int32 CompressedBlockIndex = RequestBeginBlockIndex; CompressedBlockIndex <= RequestEndBlockIndex; ++CompressedBlockIndex)
 	{
-		FFileIoStoreBlockKey CompressedBlockKey;
-		CompressedBlockKey.FileIndex = ContainerFile->ContainerInstanceId;
-		CompressedBlockKey.BlockIndex = CompressedBlockIndex;
-		bool bCompressedBlockWasAdded;
-		FFileIoStoreCompressedBlock* CompressedBlock = RequestTracker.FindOrAddCompressedBlock(CompressedBlockKey, bCompressedBlockWasAdded);
-		check(CompressedBlock);
-		check(!CompressedBlock->bCancelled);
-		if (bCompressedBlockWasAdded)
-		{
-			CompressedBlock->EncryptionKey = ContainerFile->EncryptionKey;
-			const FIoStoreTocCompressedBlockEntry& CompressionBlockEntry = ContainerFile->CompressionBlocks[CompressedBlockIndex];
-			CompressedBlock->UncompressedSize = CompressionBlockEntry.GetUncompressedSize();
-			CompressedBlock->CompressedSize = CompressionBlockEntry.GetCompressedSize();
-			CompressedBlock->CompressionMethod = ContainerFile->CompressionMethods[CompressionBlockEntry.GetCompressionMethodIndex()];
-			if (EnumHasAnyFlags(ContainerFile->ContainerFlags, EIoContainerFlags::Signed))
-			{
-				check(ContainerFile->BlockSignatureTable);
-				CompressedBlock->BlockSignatureTable = ContainerFile->BlockSignatureTable;
-				CompressedBlock->SignatureHash = &ContainerFile->BlockSignatureTable->Hashes[CompressedBlockIndex];
-			}
-			CompressedBlock->RawSize = Align(CompressionBlockEntry.GetCompressedSize(), FAES::AESBlockSize); // The raw blocks size is always aligned to AES blocks size;
-
-			int32 PartitionIndex = int32(CompressionBlockEntry.GetOffset() / ContainerFile->PartitionSize);
-			FFileIoStoreContainerFilePartition& Partition = ContainerFile->Partitions[PartitionIndex];
-			uint64 PartitionRawOffset = CompressionBlockEntry.GetOffset() % ContainerFile->PartitionSize;
-			CompressedBlock->RawOffset = PartitionRawOffset;
-			const uint32 RawBeginBlockIndex = uint32(PartitionRawOffset / ReadBufferSize);
-			const uint32 RawEndBlockIndex = uint32((PartitionRawOffset + CompressedBlock->RawSize - 1) / ReadBufferSize);
-			const uint32 RawBlockCount = RawEndBlockIndex - RawBeginBlockIndex + 1;
-			check(RawBlockCount > 0);
-			for (uint32 RawBlockIndex = RawBeginBlockIndex; RawBlockIndex <= RawEndBlockIndex; ++RawBlockIndex)
-			{
-				FFileIoStoreBlockKey RawBlockKey;
-				RawBlockKey.BlockIndex = RawBlockIndex;
-				RawBlockKey.FileIndex = Partition.ContainerFileIndex;
-
-				bool bRawBlockWasAdded;
-				FFileIoStoreReadRequest* RawBlock = RequestTracker.FindOrAddRawBlock(RawBlockKey, bRawBlockWasAdded);
-				check(RawBlock);
-				check(!RawBlock->bCancelled);
-				if (bRawBlockWasAdded)
-				{
-					RawBlock->Priority = ResolvedRequest.GetPriority();
-					RawBlock->ContainerFilePartition = &Partition;
-					RawBlock->Offset = RawBlockIndex * ReadBufferSize;
-					uint64 ReadSize = FMath::Min(Partition.FileSize, RawBlock->Offset + ReadBufferSize) - RawBlock->Offset;
-					RawBlock->Size = ReadSize;
-					NewBlocks.Add(RawBlock);
-				}
-				RawBlock->BytesUsed += 
-					uint32(FMath::Min(CompressedBlock->RawOffset + CompressedBlock->RawSize, RawBlock->Offset + RawBlock->Size) -
-						   FMath::Max(CompressedBlock->RawOffset, RawBlock->Offset));
-				CompressedBlock->RawBlocks.Add(RawBlock);
-				++CompressedBlock->UnfinishedRawBlocksCount;
-				++CompressedBlock->RefCount;
-				RawBlock->CompressedBlocks.Add(CompressedBlock);
-				++RawBlock->BufferRefCount;
-			}
-		}
-		check(CompressedBlock->UncompressedSize > RequestStartOffsetInBlock);
-		uint64 RequestSizeInBlock = FMath::Min<uint64>(CompressedBlock->UncompressedSize - RequestStartOffsetInBlock, RequestRemainingBytes);
+		const uint64 UncompressedSize = ContainerFile->CompressionBlocks[CompressedBlockIndex].GetUncompressedSize();
+		check(UncompressedSize > RequestStartOffsetInBlock);
+		uint64 RequestSizeInBlock = FMath::Min<uint64>(UncompressedSize - RequestStartOffsetInBlock, RequestRemainingBytes);
 		check(OffsetInRequest + RequestSizeInBlock <= ResolvedRequest.ResolvedSize);
-		check(RequestStartOffsetInBlock + RequestSizeInBlock <= CompressedBlock->UncompressedSize);
+		check(RequestStartOffsetInBlock + RequestSizeInBlock <= UncompressedSize);
 
-		FFileIoStoreBlockScatter& Scatter = CompressedBlock->ScatterList.AddDefaulted_GetRef();
-		Scatter.Request = &ResolvedRequest;
-		Scatter.DstOffset = OffsetInRequest;
-		Scatter.SrcOffset = RequestStartOffsetInBlock;
-		Scatter.Size = RequestSizeInBlock;
+		if (!TryReadFromPersistentCache(ResolvedRequest, CompressedBlockIndex, RequestStartOffsetInBlock, OffsetInRequest, RequestSizeInBlock))
+		{
+			ReadCompressedBlock(ResolvedRequest, CompressedBlockIndex, RequestStartOffsetInBlock, OffsetInRequest, RequestSizeInBlock, NewBlocks);
+		}
 
 		RequestRemainingBytes -= RequestSizeInBlock;
 		OffsetInRequest += RequestSizeInBlock;
 		RequestStartOffsetInBlock = 0;
-
-		RequestTracker.AddReadRequestsToResolvedRequest(CompressedBlock, ResolvedRequest);
 	}
 
 	if (!NewBlocks.IsEmpty())
@@ -1990,6 +2253,197 @@ void FFileIoStore::ReadBlocks(FFileIoStoreResolvedRequest& ResolvedRequest)
 	}
 }
 
+void FFileIoStore::ReadCompressedBlock(FFileIoStoreResolvedRequest& ResolvedRequest, uint32 CompressedBlockIndex, uint64 SrcOffset, uint64 DstOffset, uint64 Size, FFileIoStoreReadRequestList& OutNewBlocks)
+{
+	FFileIoStoreContainerFile* ContainerFile = ResolvedRequest.GetContainerFile();
+	FFileIoStoreBlockKey CompressedBlockKey;
+	CompressedBlockKey.FileIndex = ContainerFile->ContainerInstanceId;
+	CompressedBlockKey.BlockIndex = CompressedBlockIndex;
+	bool bCompressedBlockWasAdded;
+	FFileIoStoreCompressedBlock* CompressedBlock = RequestTracker.FindOrAddCompressedBlock(CompressedBlockKey, bCompressedBlockWasAdded);
+	check(CompressedBlock);
+	check(!CompressedBlock->bCancelled);
+	if (bCompressedBlockWasAdded)
+	{
+		CompressedBlock->EncryptionKey = ContainerFile->EncryptionKey;
+		const FIoStoreTocCompressedBlockEntry& CompressionBlockEntry = ContainerFile->CompressionBlocks[CompressedBlockIndex];
+		CompressedBlock->UncompressedSize = CompressionBlockEntry.GetUncompressedSize();
+		CompressedBlock->CompressedSize = CompressionBlockEntry.GetCompressedSize();
+		CompressedBlock->CompressionMethod = ContainerFile->CompressionMethods[CompressionBlockEntry.GetCompressionMethodIndex()];
+		if (EnumHasAnyFlags(ContainerFile->ContainerFlags, EIoContainerFlags::Signed))
+		{
+			check(ContainerFile->BlockSignatureTable);
+			CompressedBlock->BlockSignatureTable = ContainerFile->BlockSignatureTable;
+			CompressedBlock->SignatureHash = &ContainerFile->BlockSignatureTable->Hashes[CompressedBlockIndex];
+		}
+		CompressedBlock->RawSize = Align(CompressionBlockEntry.GetCompressedSize(), FAES::AESBlockSize); // The raw blocks size is always aligned to AES blocks size;
+
+		int32 PartitionIndex = int32(CompressionBlockEntry.GetOffset() / ContainerFile->PartitionSize);
+		FFileIoStoreContainerFilePartition& Partition = ContainerFile->Partitions[PartitionIndex];
+		uint64 PartitionRawOffset = CompressionBlockEntry.GetOffset() % ContainerFile->PartitionSize;
+		CompressedBlock->RawOffset = PartitionRawOffset;
+		const uint32 RawBeginBlockIndex = uint32(PartitionRawOffset / ReadBufferSize);
+		const uint32 RawEndBlockIndex = uint32((PartitionRawOffset + CompressedBlock->RawSize - 1) / ReadBufferSize);
+		const uint32 RawBlockCount = RawEndBlockIndex - RawBeginBlockIndex + 1;
+		check(RawBlockCount > 0);
+		for (uint32 RawBlockIndex = RawBeginBlockIndex; RawBlockIndex <= RawEndBlockIndex; ++RawBlockIndex)
+		{
+			FFileIoStoreBlockKey RawBlockKey;
+			RawBlockKey.BlockIndex = RawBlockIndex;
+			RawBlockKey.FileIndex = Partition.ContainerFileIndex;
+
+			bool bRawBlockWasAdded;
+			FFileIoStoreReadRequest* RawBlock = RequestTracker.FindOrAddRawBlock(RawBlockKey, bRawBlockWasAdded);
+			check(RawBlock);
+			check(!RawBlock->bCancelled);
+			if (bRawBlockWasAdded)
+			{
+				RawBlock->Priority = ResolvedRequest.GetPriority();
+				RawBlock->ContainerFilePartition = &Partition;
+				RawBlock->Offset = RawBlockIndex * ReadBufferSize;
+				uint64 ReadSize = FMath::Min(Partition.FileSize, RawBlock->Offset + ReadBufferSize) - RawBlock->Offset;
+				RawBlock->Size = ReadSize;
+				OutNewBlocks.Add(RawBlock);
+			}
+			else
+			{
+				Stats.OnReadAvoided();
+			}
+			RawBlock->BytesUsed += 
+				uint32(FMath::Min(CompressedBlock->RawOffset + CompressedBlock->RawSize, RawBlock->Offset + RawBlock->Size) -
+					   FMath::Max(CompressedBlock->RawOffset, RawBlock->Offset));
+			CompressedBlock->RawBlocks.Add(RawBlock);
+			++CompressedBlock->UnfinishedRawBlocksCount;
+			++CompressedBlock->RefCount;
+			RawBlock->CompressedBlocks.Add(CompressedBlock);
+			++RawBlock->BufferRefCount;
+		}
+	}
+	else
+	{
+		Stats.OnReadAvoided();
+	}
+
+	FFileIoStoreBlockScatter& Scatter = CompressedBlock->ScatterList.AddDefaulted_GetRef();
+	Scatter.Request = &ResolvedRequest;
+	Scatter.DstOffset = DstOffset;
+	Scatter.SrcOffset = SrcOffset;
+	Scatter.Size = Size;
+
+	RequestTracker.AddReadRequestsToResolvedRequest(CompressedBlock, ResolvedRequest);
+}
+
+bool FFileIoStore::TryReadFromPersistentCache(FFileIoStoreResolvedRequest& ResolvedRequest, uint32 CompressedBlockIndex, uint64 SrcOffset, uint64 DstOffset, uint64 Size)
+{
+	if (!PersistentBlockCache.IsEnabled())
+	{
+		return false;
+	}
+
+	// only decompressed blocks are stored, the rest is as fast to read from the container
+	const FFileIoStoreContainerFile* ContainerFile = ResolvedRequest.GetContainerFile();
+	const FIoStoreTocCompressedBlockEntry& CompressionBlockEntry = ContainerFile->CompressionBlocks[CompressedBlockIndex];
+	if (ContainerFile->CompressionMethods[CompressionBlockEntry.GetCompressionMethodIndex()].IsNone())
+	{
+		return false;
+	}
+
+	FFileIoStorePersistentBlockCache::FEntry Entry;
+	if (!PersistentBlockCache.Find(ContainerFile->ContainerInstanceId, CompressedBlockIndex, Entry) || Entry.Size != CompressionBlockEntry.GetUncompressedSize())
+	{
+		return false;
+	}
+
+	if (!ResolvedRequest.HasBuffer())
+	{
+		ResolvedRequest.CreateBuffer(ResolvedRequest.ResolvedSize);
+	}
+
+	FPersistentCacheRead* CacheRead = new FPersistentCacheRead();
+	CacheRead->ResolvedRequest = &ResolvedRequest;
+	CacheRead->Entry = Entry;
+	CacheRead->Dst = ResolvedRequest.GetBuffer().Data() + DstOffset;
+	CacheRead->CompressedBlockIndex = CompressedBlockIndex;
+	CacheRead->SrcOffset = SrcOffset;
+	CacheRead->DstOffset = DstOffset;
+	CacheRead->Size = Size;
+	++ResolvedRequest.UnfinishedReadsCount;
+	++ResolvedRequest.PersistentCacheReadsCount;
+
+	if (bIsMultithreaded)
+	{
+		FFunctionGraphTask::CreateAndDispatchWhenReady([this, CacheRead]()
+		{
+			ReadFromPersistentCache(CacheRead, true);
+		}, TStatId(), nullptr, CPrio_IoDispatcherTaskPriority.Get());
+	}
+	else
+	{
+		// completed by GetCompletedRequests as the request must stay alive until all of its blocks are queued
+		ReadFromPersistentCache(CacheRead, false);
+	}
+	return true;
+}
+
+void FFileIoStore::ReadFromPersistentCache(FPersistentCacheRead* CacheRead, bool bIsAsync)
+{
+	LLM_SCOPE(ELLMTag::FileSystem);
+
+	if (CacheRead->SrcOffset == 0 && CacheRead->Size == CacheRead->Entry.Size)
+	{
+		CacheRead->bFailed = !PersistentBlockCache.Read(CacheRead->Entry, CacheRead->Dst);
+	}
+	else
+	{
+		uint8* Block = reinterpret_cast<uint8*>(FMemory::Malloc(CacheRead->Entry.Size));
+		CacheRead->bFailed = !PersistentBlockCache.Read(CacheRead->Entry, Block);
+		if (!CacheRead->bFailed)
+		{
+			FMemory::Memcpy(CacheRead->Dst, Block + CacheRead->SrcOffset, CacheRead->Size);
+		}
+		FMemory::Free(Block);
+	}
+
+	FScopeLock Lock(&DecompressedBlocksCritical);
+	CacheRead->Next = FirstCompletedPersistentCacheRead;
+	FirstCompletedPersistentCacheRead = CacheRead;
+	if (bIsAsync)
+	{
+		BackendContext->WakeUpDispatcherThreadDelegate.Execute();
+	}
+}
+
+void FFileIoStore::FinalizePersistentCacheRead(FPersistentCacheRead* CacheRead, FFileIoStoreReadRequestList& OutNewBlocks)
+{
+	FFileIoStoreResolvedRequest* ResolvedRequest = CacheRead->ResolvedRequest;
+	check(ResolvedRequest->PersistentCacheReadsCount > 0);
+	--ResolvedRequest->PersistentCacheReadsCount;
+	if (!CacheRead->bFailed)
+	{
+		Stats.OnBytesScattered(CacheRead->Size);
+	}
+	else if (ResolvedRequest->DispatcherRequest && !ResolvedRequest->DispatcherRequest->IsCancelled())
+	{
+		// the block was evicted or is invalid, read it from the container instead
+		ReadCompressedBlock(*ResolvedRequest, CacheRead->CompressedBlockIndex, CacheRead->SrcOffset, CacheRead->DstOffset, CacheRead->Size, OutNewBlocks);
+	}
+	else
+	{
+		ResolvedRequest->bFailed = true;
+	}
+
+	check(ResolvedRequest->UnfinishedReadsCount > 0);
+	if (--ResolvedRequest->UnfinishedReadsCount == 0)
+	{
+		if (!ResolvedRequest->bCancelled)
+		{
+			CompleteDispatcherRequest(ResolvedRequest);
+		}
+		RequestTracker.ReleaseIoRequestReferences(*ResolvedRequest);
+	}
+	delete CacheRead;
+}
+
 void FFileIoStore::FreeBuffer(FFileIoStoreBuffer& Buffer)
 {
 	BufferAllocator.FreeBuffer(&Buffer);
@@ -2113,6 +2567,8 @@ CSV_DEFINE_STAT(IoDispatcherFileBackendVerbose,	FrameBlockCacheHits);
 CSV_DEFINE_STAT(IoDispatcherFileBackendVerbose,	FrameBlockCacheHitKB);	
 CSV_DEFINE_STAT(IoDispatcherFileBackendVerbose,	FrameBlockCacheMisses);
 CSV_DEFINE_STAT(IoDispatcherFileBackendVerbose,	FrameBlockCacheMissKB);
+CSV_DEFINE_STAT(IoDispatcherFileBackendVerbose,	FrameCoalescedReads);
+CSV_DEFINE_STAT(IoDispatcherFileBackendVerbose,	FrameAvoidedReads);
 
 #if UE_FILEIOSTORE_STATS_ENABLED
 
@@ -2134,6 +2590,8 @@ FFileIoStoreStats::FFileIoStoreStats()
 	, BlockCacheMissedSizeCounter(TEXT("FileIoStore/BlockCacheMissedSize"), TraceCounterDisplayHint_Memory)
 	, ScatteredSizeCounter(TEXT("FileIoStore/ScatteredSize"), TraceCounterDisplayHint_Memory)
 	, TocMemoryCounter(TEXT("FileIoStore/TocMemory"), TraceCounterDisplayHint_Memory)
+	, CoalescedReadsCounter(TEXT("FileIoStore/CoalescedReads"), TraceCounterDisplayHint_None)
+	, AvoidedReadsCounter(TEXT("FileIoStore/AvoidedReads"), TraceCounterDisplayHint_None)
 	, AvailableBuffersCounter(TEXT("FileIoStore/AvailableBuffers"), TraceCounterDisplayHint_None)
 #endif
 {
@@ -2397,6 +2855,24 @@ void FFileIoStoreStats::OnBlockCacheMiss(uint64 NumBytes)
 #endif
 }
 
+void FFileIoStoreStats::OnFilesystemReadsCoalesced(uint32 NumReads)
+{
+	CSV_CUSTOM_STAT_DEFINED(FrameCoalescedReads, int32(NumReads), ECsvCustomStatOp::Accumulate);
+
+#if COUNTERSTRACE_ENABLED
+	CoalescedReadsCounter.Add(NumReads);
+#endif
+}
+
+void FFileIoStoreStats::OnReadAvoided()
+{
+	CSV_CUSTOM_STAT_DEFINED(FrameAvoidedReads, 1, ECsvCustomStatOp::Accumulate);
+
+#if COUNTERSTRACE_ENABLED
+	AvoidedReadsCounter.Increment();
+#endif
+}
+
 void FFileIoStoreStats::OnTocMounted(uint64 AllocatedSize)
 {
 #if COUNTERSTRACE_ENABLED
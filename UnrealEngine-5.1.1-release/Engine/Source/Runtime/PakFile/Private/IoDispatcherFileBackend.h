@@ -3,6 +3,7 @@
 #pragma once
 
 #include "IoDispatcherFileBackendTypes.h"
+#include "IoDispatcherPersistentBlockCache.h"
 #include "IO/IoDispatcher.h"
 #include "IO/IoStore.h"
 #include "Containers/Array.h"
@@ -36,6 +37,9 @@ public:
 	bool DoesChunkExist(const FIoChunkId& ChunkId) const;
 	TIoStatusOr<uint64> GetSizeForChunk(const FIoChunkId& ChunkId) const;
 	const FIoOffsetAndLength* Resolve(const FIoChunkId& ChunkId) const;
+	// chunks that are stored in another container, see FIoStoreTocReferencedChunk
+	const FIoStoreTocReferencedChunk* FindReferencedChunk(const FIoChunkId& ChunkId) const { return ReferencedChunks.Find(ChunkId); }
+	const TMap<FIoChunkId, FIoStoreTocReferencedChunk>& GetReferencedChunks() const { return ReferencedChunks; }
 	FFileIoStoreContainerFile* GetContainerFile() { return &ContainerFile; }
 	const FFileIoStoreContainerFile* GetContainerFile() const { return &ContainerFile; }
 	IMappedFileHandle* GetMappedContainerFileHandle(uint64 TocOffset);
@@ -64,9 +68,11 @@ private:
 	};
 	FPerfectHashMap PerfectHashMap;
 	TMap<FIoChunkId, FIoOffsetAndLength> TocImperfectHashMapFallback;
+	TMap<FIoChunkId, FIoStoreTocReferencedChunk> ReferencedChunks;
 	FFileIoStoreContainerFile ContainerFile;
 	FIoContainerId ContainerId;
 	int32 Order;
+	FCriticalSection MappedFileHandlesCritical;
 	bool bClosed = false;
 	bool bHasPerfectHashMap = false;
 
@@ -156,19 +162,41 @@ private:
 		FFileIoStoreCompressedBlock* CompressedBlock;
 	};
 
+	struct FPersistentCacheRead
+	{
+		FPersistentCacheRead* Next = nullptr;
+		FFileIoStoreResolvedRequest* ResolvedRequest = nullptr;
+		FFileIoStorePersistentBlockCache::FEntry Entry;
+		uint8* Dst = nullptr;
+		uint32 CompressedBlockIndex = 0;
+		uint64 SrcOffset = 0;
+		uint64 DstOffset = 0;
+		uint64 Size = 0;
+		bool bFailed = false;
+	};
+
 	void OnNewPendingRequestsAdded();
 	void ReadBlocks(FFileIoStoreResolvedRequest& ResolvedRequest);
+	void ReadCompressedBlock(FFileIoStoreResolvedRequest& ResolvedRequest, uint32 CompressedBlockIndex, uint64 SrcOffset, uint64 DstOffset, uint64 Size, FFileIoStoreReadRequestList& OutNewBlocks);
+	bool TryReadFromPersistentCache(FFileIoStoreResolvedRequest& ResolvedRequest, uint32 CompressedBlockIndex, uint64 SrcOffset, uint64 DstOffset, uint64 Size);
+	void ReadFromPersistentCache(FPersistentCacheRead* CacheRead, bool bIsAsync);
+	void FinalizePersistentCacheRead(FPersistentCacheRead* CacheRead, FFileIoStoreReadRequestList& OutNewBlocks);
 	void FreeBuffer(FFileIoStoreBuffer& Buffer);
 	FFileIoStoreCompressionContext* AllocCompressionContext();
 	void FreeCompressionContext(FFileIoStoreCompressionContext* CompressionContext);
 	void ScatterBlock(FFileIoStoreCompressedBlock* CompressedBlock, bool bIsAsync);
+	bool TryResolveMapped(FIoRequestImpl* Request, FFileIoStoreReader& Reader, uint64 ResolvedOffset, uint64 ResolvedSize);
+	// finds the reader that stores the chunk, following references to other containers, IoStoreReadersLock must be held
+	FFileIoStoreReader* FindChunk(const FIoChunkId& ChunkId, const FIoOffsetAndLength*& OutOffsetAndLength) const;
 	void CompleteDispatcherRequest(FFileIoStoreResolvedRequest* ResolvedRequest);
+	void QueueForDecompression(FFileIoStoreCompressedBlock* CompressedBlock);
 	void FinalizeCompressedBlock(FFileIoStoreCompressedBlock* CompressedBlock);
 
 	uint64 ReadBufferSize = 0;
 	TSharedPtr<const FIoDispatcherBackendContext> BackendContext;
 	FFileIoStoreStats Stats;
 	FFileIoStoreBlockCache BlockCache;
+	FFileIoStorePersistentBlockCache PersistentBlockCache;
 	FFileIoStoreBufferAllocator BufferAllocator;
 	FFileIoStoreRequestAllocator RequestAllocator;
 	FFileIoStoreRequestQueue RequestQueue;
@@ -184,6 +212,7 @@ private:
 	FFileIoStoreCompressedBlock* ReadyForDecompressionTail = nullptr;
 	FCriticalSection DecompressedBlocksCritical;
 	FFileIoStoreCompressedBlock* FirstDecompressedBlock = nullptr;
+	FPersistentCacheRead* FirstCompletedPersistentCacheRead = nullptr;
 	FIoRequestImpl* CompletedRequestsHead = nullptr;
 	FIoRequestImpl* CompletedRequestsTail = nullptr;
 };
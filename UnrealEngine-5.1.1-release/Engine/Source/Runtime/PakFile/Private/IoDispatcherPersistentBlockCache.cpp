@@ -0,0 +1,469 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "IoDispatcherPersistentBlockCache.h"
+#include "IoDispatcherFileBackendTypes.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Hash/Blake3.h"
+#include "IO/IoDispatcher.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/Archive.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+int32 GIoDispatcherPersistentCacheSizeMB = 0;
+static FAutoConsoleVariableRef CVar_IoDispatcherPersistentCacheSizeMB(
+	TEXT("s.IoDispatcherPersistentCacheSizeMB"),
+	GIoDispatcherPersistentCacheSizeMB,
+	TEXT("Size of the on-disk cache of decompressed IoStore blocks that persists between sessions (in megabytes), 0 disables it."),
+	ECVF_ReadOnly
+);
+
+int32 GIoDispatcherPersistentCacheSlotSizeKB = 64;
+static FAutoConsoleVariableRef CVar_IoDispatcherPersistentCacheSlotSizeKB(
+	TEXT("s.IoDispatcherPersistentCacheSlotSizeKB"),
+	GIoDispatcherPersistentCacheSlotSizeKB,
+	TEXT("Size of a persistent block cache slot (in kilobytes), bigger blocks are not cached. Changing it invalidates the cache."),
+	ECVF_ReadOnly
+);
+
+float GIoDispatcherPersistentCacheRecordSeconds = 60.0f;
+static FAutoConsoleVariableRef CVar_IoDispatcherPersistentCacheRecordSeconds(
+	TEXT("s.IoDispatcherPersistentCacheRecordSeconds"),
+	GIoDispatcherPersistentCacheRecordSeconds,
+	TEXT("For how long after startup decompressed blocks are stored in the persistent block cache (in seconds)."),
+	ECVF_Default
+);
+
+namespace PersistentBlockCache
+{
+	static const uint32 IndexMagic = 0x49534243; // 'ISBC'
+	static const uint32 IndexVersion = 1;
+}
+
+FFileIoStorePersistentBlockCache::~FFileIoStorePersistentBlockCache()
+{
+	Shutdown();
+}
+
+void FFileIoStorePersistentBlockCache::Initialize()
+{
+	if (GIoDispatcherPersistentCacheSizeMB <= 0 || GIoDispatcherPersistentCacheSlotSizeKB <= 0 || FParse::Param(FCommandLine::Get(), TEXT("nopersistentiocache")))
+	{
+		return;
+	}
+
+	SlotSize = uint64(GIoDispatcherPersistentCacheSlotSizeKB) << 10ull;
+	const uint64 SlotCount = (uint64(GIoDispatcherPersistentCacheSizeMB) << 20ull) / SlotSize;
+	if (SlotCount == 0 || SlotCount > MAX_int32)
+	{
+		UE_LOG(LogIoDispatcher, Warning, TEXT("Invalid persistent block cache size %d MB with %d KB slots"), GIoDispatcherPersistentCacheSizeMB, GIoDispatcherPersistentCacheSlotSizeKB);
+		return;
+	}
+
+	const FString CacheDir = FPaths::ProjectPersistentDownloadDir() / TEXT("IoStoreBlockCache");
+	IndexFilePath = CacheDir / TEXT("blocks.index");
+	DataFilePath = CacheDir / TEXT("blocks.data");
+
+	IPlatformFile& Ipf = FPlatformFileManager::Get().GetPlatformFile();
+	Ipf.CreateDirectoryTree(*CacheDir);
+	// opened in append mode to keep the content, writes seek to their slot
+	FileHandle.Reset(Ipf.OpenWrite(*DataFilePath, /*bAppend*/ true, /*bAllowRead*/ true));
+	if (!FileHandle)
+	{
+		UE_LOG(LogIoDispatcher, Warning, TEXT("Failed to open persistent block cache '%s'"), *DataFilePath);
+		return;
+	}
+
+	Slots.SetNum(int32(SlotCount));
+	if (!LoadIndex())
+	{
+		Reset();
+	}
+
+	RecordEndCycles = FPlatformTime::Cycles64() + uint64(FMath::Max(GIoDispatcherPersistentCacheRecordSeconds, 0.0f) / FPlatformTime::GetSecondsPerCycle64());
+	bEnabled = true;
+
+	UE_LOG(LogIoDispatcher, Display, TEXT("Persistent block cache '%s' initialized, %d of %d blocks cached"), *DataFilePath, SlotsMap.Num(), Slots.Num());
+}
+
+void FFileIoStorePersistentBlockCache::Shutdown()
+{
+	if (!bEnabled)
+	{
+		return;
+	}
+
+	SaveIndex();
+	{
+		FScopeLock _(&IndexCritical);
+		bEnabled = false;
+		UE_LOG(LogIoDispatcher, Display, TEXT("Persistent block cache shut down, %llu hits, %llu misses, %llu blocks stored, %llu invalidated"), HitCount, MissCount, StoreCount, InvalidCount);
+	}
+	FScopeLock _(&FileCritical);
+	FileHandle.Reset();
+}
+
+void FFileIoStorePersistentBlockCache::OnContainerMounted(const FFileIoStoreContainerFile& ContainerFile, FIoContainerId ContainerId)
+{
+	// decrypted data must not be written to the disk, and reads from the cache would bypass the signature checks
+	if (!bEnabled || !ContainerId.IsValid() || EnumHasAnyFlags(ContainerFile.ContainerFlags, EIoContainerFlags::Encrypted | EIoContainerFlags::Signed))
+	{
+		return;
+	}
+
+	// the block table changes whenever the content of the container changes, the time stamps catch blocks that changed but kept their size
+	FBlake3 Hasher;
+	Hasher.Update(ContainerFile.CompressionBlocks.GetData(), ContainerFile.CompressionBlocks.Num() * sizeof(FIoStoreTocCompressedBlockEntry));
+	Hasher.Update(&ContainerFile.CompressionBlockSize, sizeof(ContainerFile.CompressionBlockSize));
+	for (const FName& CompressionMethod : ContainerFile.CompressionMethods)
+	{
+		const FString MethodName = CompressionMethod.ToString();
+		Hasher.Update(*MethodName, MethodName.Len() * sizeof(TCHAR));
+	}
+	IPlatformFile& Ipf = FPlatformFileManager::Get().GetPlatformFile();
+	for (const FFileIoStoreContainerFilePartition& Partition : ContainerFile.Partitions)
+	{
+		const int64 Ticks = Ipf.GetTimeStamp(*Partition.FilePath).GetTicks();
+		Hasher.Update(&Partition.FileSize, sizeof(Partition.FileSize));
+		Hasher.Update(&Ticks, sizeof(Ticks));
+	}
+	const FIoHash BlockTableHash(Hasher.Finalize());
+
+	FScopeLock _(&IndexCritical);
+	MountedContainers.Add(ContainerFile.ContainerInstanceId, { ContainerId, BlockTableHash, ContainerFile.CompressionBlockSize });
+
+	int32 InvalidatedCount = 0;
+	for (int32 SlotIndex = 0; SlotIndex < Slots.Num(); ++SlotIndex)
+	{
+		const FSlot& Slot = Slots[SlotIndex];
+		if (Slot.bUsed && Slot.Key.ContainerId == ContainerId && Slot.Key.BlockTableHash != BlockTableHash)
+		{
+			FreeSlot(SlotIndex);
+			++InvalidatedCount;
+		}
+	}
+	if (InvalidatedCount)
+	{
+		InvalidCount += InvalidatedCount;
+		UE_LOG(LogIoDispatcher, Display, TEXT("Container '%s' changed, dropped %d blocks from the persistent block cache"), *ContainerFile.FilePath, InvalidatedCount);
+	}
+}
+
+void FFileIoStorePersistentBlockCache::OnContainerUnmounted(const FFileIoStoreContainerFile& ContainerFile)
+{
+	FScopeLock _(&IndexCritical);
+	MountedContainers.Remove(ContainerFile.ContainerInstanceId);
+}
+
+bool FFileIoStorePersistentBlockCache::Find(uint32 ContainerInstanceId, uint32 BlockIndex, FEntry& OutEntry)
+{
+	FScopeLock _(&IndexCritical);
+	FKey Key;
+	if (!bEnabled || !MakeKey(ContainerInstanceId, BlockIndex, Key))
+	{
+		return false;
+	}
+
+	const int32* SlotIndex = SlotsMap.Find(Key);
+	if (!SlotIndex)
+	{
+		++MissCount;
+		return false;
+	}
+
+	++HitCount;
+	const FSlot& Slot = Slots[*SlotIndex];
+	OutEntry.SlotIndex = *SlotIndex;
+	OutEntry.Size = Slot.Size;
+	OutEntry.DataHash = Slot.DataHash;
+	Unlink(*SlotIndex);
+	LinkFront(*SlotIndex);
+	bIndexDirty = true;
+	return true;
+}
+
+bool FFileIoStorePersistentBlockCache::Read(const FEntry& Entry, uint8* Dst)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(IoDispatcherPersistentCacheRead);
+
+	bool bRead = false;
+	{
+		FScopeLock _(&FileCritical);
+		bRead = FileHandle && FileHandle->Seek(int64(Entry.SlotIndex * SlotSize)) && FileHandle->Read(Dst, Entry.Size);
+	}
+
+	if (bRead && FIoHash::HashBuffer(Dst, Entry.Size) == Entry.DataHash)
+	{
+		return true;
+	}
+
+	FScopeLock _(&IndexCritical);
+	FSlot& Slot = Slots[Entry.SlotIndex];
+	if (Slot.bUsed && Slot.DataHash == Entry.DataHash)
+	{
+		UE_LOG(LogIoDispatcher, Verbose, TEXT("Dropping invalid block in slot %d from the persistent block cache"), Entry.SlotIndex);
+		FreeSlot(Entry.SlotIndex);
+		++InvalidCount;
+	}
+	return false;
+}
+
+void FFileIoStorePersistentBlockCache::Store(uint32 ContainerInstanceId, uint32 BlockIndex, const uint8* Data, uint32 Size)
+{
+	if (!bEnabled || Size > SlotSize)
+	{
+		return;
+	}
+
+	if (FPlatformTime::Cycles64() > RecordEndCycles)
+	{
+		bool bSave = false;
+		{
+			FScopeLock _(&IndexCritical);
+			bSave = bEnabled && !bSavedAfterRecording;
+			bSavedAfterRecording = true;
+		}
+		if (bSave)
+		{
+			// the startup set is complete, don't wait for the shutdown that might never happen
+			SaveIndex();
+		}
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(IoDispatcherPersistentCacheStore);
+
+	FKey Key;
+	int32 SlotIndex;
+	{
+		FScopeLock _(&IndexCritical);
+		if (!bEnabled || !MakeKey(ContainerInstanceId, BlockIndex, Key) || SlotsMap.Contains(Key))
+		{
+			return;
+		}
+		// the slot is neither free nor findable until it's written
+		SlotIndex = AllocSlot();
+	}
+
+	const FIoHash DataHash = FIoHash::HashBuffer(Data, Size);
+	bool bWritten = false;
+	{
+		FScopeLock _(&FileCritical);
+		bWritten = FileHandle && FileHandle->Seek(int64(SlotIndex * SlotSize)) && FileHandle->Write(Data, Size);
+	}
+
+	FScopeLock _(&IndexCritical);
+	if (!bWritten || SlotsMap.Contains(Key))
+	{
+		FreeSlots.Push(SlotIndex);
+		return;
+	}
+	FSlot& Slot = Slots[SlotIndex];
+	Slot.Key = Key;
+	Slot.DataHash = DataHash;
+	Slot.Size = Size;
+	Slot.bUsed = true;
+	SlotsMap.Add(Key, SlotIndex);
+	LinkFront(SlotIndex);
+	bIndexDirty = true;
+	++StoreCount;
+}
+
+bool FFileIoStorePersistentBlockCache::MakeKey(uint32 ContainerInstanceId, uint32 BlockIndex, FKey& OutKey) const
+{
+	const FMountedContainer* Container = MountedContainers.Find(ContainerInstanceId);
+	if (!Container)
+	{
+		return false;
+	}
+	OutKey.ContainerId = Container->ContainerId;
+	OutKey.BlockOffset = uint64(BlockIndex) * Container->CompressionBlockSize;
+	OutKey.BlockTableHash = Container->BlockTableHash;
+	return true;
+}
+
+void FFileIoStorePersistentBlockCache::LinkFront(int32 SlotIndex)
+{
+	FSlot& Slot = Slots[SlotIndex];
+	Slot.Prev = INDEX_NONE;
+	Slot.Next = MostRecentlyUsed;
+	if (MostRecentlyUsed != INDEX_NONE)
+	{
+		Slots[MostRecentlyUsed].Prev = SlotIndex;
+	}
+	else
+	{
+		LeastRecentlyUsed = SlotIndex;
+	}
+	MostRecentlyUsed = SlotIndex;
+}
+
+void FFileIoStorePersistentBlockCache::Unlink(int32 SlotIndex)
+{
+	FSlot& Slot = Slots[SlotIndex];
+	if (Slot.Prev != INDEX_NONE)
+	{
+		Slots[Slot.Prev].Next = Slot.Next;
+	}
+	else
+	{
+		MostRecentlyUsed = Slot.Next;
+	}
+	if (Slot.Next != INDEX_NONE)
+	{
+		Slots[Slot.Next].Prev = Slot.Prev;
+	}
+	else
+	{
+		LeastRecentlyUsed = Slot.Prev;
+	}
+	Slot.Prev = Slot.Next = INDEX_NONE;
+}
+
+void FFileIoStorePersistentBlockCache::FreeSlot(int32 SlotIndex)
+{
+	FSlot& Slot = Slots[SlotIndex];
+	check(Slot.bUsed);
+	Unlink(SlotIndex);
+	SlotsMap.Remove(Slot.Key);
+	Slot.bUsed = false;
+	FreeSlots.Push(SlotIndex);
+	bIndexDirty = true;
+}
+
+int32 FFileIoStorePersistentBlockCache::AllocSlot()
+{
+	if (FreeSlots.IsEmpty())
+	{
+		check(LeastRecentlyUsed != INDEX_NONE);
+		FreeSlot(LeastRecentlyUsed);
+	}
+	return FreeSlots.Pop(false);
+}
+
+bool FFileIoStorePersistentBlockCache::LoadIndex()
+{
+	TUniquePtr<FArchive> Ar(IFileManager::Get().CreateFileReader(*IndexFilePath, FILEREAD_Silent));
+	if (!Ar)
+	{
+		return false;
+	}
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	uint64 SavedSlotSize = 0;
+	int32 SavedSlotCount = 0;
+	int32 UsedCount = 0;
+	*Ar << Magic << Version << SavedSlotSize << SavedSlotCount << UsedCount;
+	if (Ar->IsError() || Magic != PersistentBlockCache::IndexMagic || Version != PersistentBlockCache::IndexVersion ||
+		SavedSlotSize != SlotSize || SavedSlotCount != Slots.Num() || UsedCount < 0 || UsedCount > Slots.Num())
+	{
+		UE_LOG(LogIoDispatcher, Display, TEXT("Discarding persistent block cache index '%s' with different settings"), *IndexFilePath);
+		return false;
+	}
+
+	// saved from the least to the most recently used block
+	for (int32 EntryIndex = 0; EntryIndex < UsedCount; ++EntryIndex)
+	{
+		int32 SlotIndex = INDEX_NONE;
+		FKey Key;
+		FIoHash DataHash;
+		uint32 Size = 0;
+		*Ar << SlotIndex << Key.ContainerId << Key.BlockOffset << Key.BlockTableHash << DataHash << Size;
+		if (Ar->IsError() || !Slots.IsValidIndex(SlotIndex) || Slots[SlotIndex].bUsed || Size == 0 || Size > SlotSize || SlotsMap.Contains(Key))
+		{
+			UE_LOG(LogIoDispatcher, Warning, TEXT("Discarding corrupt persistent block cache index '%s'"), *IndexFilePath);
+			return false;
+		}
+
+		FSlot& Slot = Slots[SlotIndex];
+		Slot.Key = Key;
+		Slot.DataHash = DataHash;
+		Slot.Size = Size;
+		Slot.bUsed = true;
+		SlotsMap.Add(Key, SlotIndex);
+		LinkFront(SlotIndex);
+	}
+
+	for (int32 SlotIndex = Slots.Num() - 1; SlotIndex >= 0; --SlotIndex)
+	{
+		if (!Slots[SlotIndex].bUsed)
+		{
+			FreeSlots.Push(SlotIndex);
+		}
+	}
+	return true;
+}
+
+void FFileIoStorePersistentBlockCache::SaveIndex()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(IoDispatcherPersistentCacheSaveIndex);
+
+	{
+		// the index must not reference blocks that are not on the disk yet
+		FScopeLock _(&FileCritical);
+		if (FileHandle)
+		{
+			FileHandle->Flush();
+		}
+	}
+
+	FScopeLock _(&IndexCritical);
+	if (!bIndexDirty)
+	{
+		return;
+	}
+
+	const FString TempFilePath = IndexFilePath + TEXT(".tmp");
+	TUniquePtr<FArchive> Ar(IFileManager::Get().CreateFileWriter(*TempFilePath));
+	if (!Ar)
+	{
+		UE_LOG(LogIoDispatcher, Warning, TEXT("Failed to save persistent block cache index '%s'"), *IndexFilePath);
+		return;
+	}
+
+	uint32 Magic = PersistentBlockCache::IndexMagic;
+	uint32 Version = PersistentBlockCache::IndexVersion;
+	int32 SlotCount = Slots.Num();
+	int32 UsedCount = SlotsMap.Num();
+	*Ar << Magic << Version << SlotSize << SlotCount << UsedCount;
+	for (int32 SlotIndex = LeastRecentlyUsed; SlotIndex != INDEX_NONE; SlotIndex = Slots[SlotIndex].Prev)
+	{
+		FSlot& Slot = Slots[SlotIndex];
+		*Ar << SlotIndex << Slot.Key.ContainerId << Slot.Key.BlockOffset << Slot.Key.BlockTableHash << Slot.DataHash << Slot.Size;
+	}
+	const bool bSaved = Ar->Close();
+	Ar.Reset();
+
+	if (bSaved && IFileManager::Get().Move(*IndexFilePath, *TempFilePath, /*bReplace*/ true))
+	{
+		bIndexDirty = false;
+	}
+	else
+	{
+		UE_LOG(LogIoDispatcher, Warning, TEXT("Failed to save persistent block cache index '%s'"), *IndexFilePath);
+	}
+}
+
+void FFileIoStorePersistentBlockCache::Reset()
+{
+	for (FSlot& Slot : Slots)
+	{
+		Slot = FSlot();
+	}
+	SlotsMap.Reset();
+	FreeSlots.Reset();
+	for (int32 SlotIndex = Slots.Num() - 1; SlotIndex >= 0; --SlotIndex)
+	{
+		FreeSlots.Push(SlotIndex);
+	}
+	MostRecentlyUsed = LeastRecentlyUsed = INDEX_NONE;
+	bIndexDirty = true;
+}
@@ -0,0 +1,126 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "Containers/UnrealString.h"
+#include "HAL/CriticalSection.h"
+#include "IO/IoContainerId.h"
+#include "IO/IoHash.h"
+#include "Templates/UniquePtr.h"
+
+#include <atomic>
+
+class IFileHandle;
+struct FFileIoStoreContainerFile;
+
+/**
+ * Optional on-disk cache of decompressed IoStore blocks that persists between sessions, so the blocks that are read during startup
+ * don't have to be decompressed again on the next launch. Blocks are keyed by container id, the offset of the block in the
+ * uncompressed container and a hash of the container block table that is validated when the container is mounted.
+ * The cache has a fixed number of slots of s.IoDispatcherPersistentCacheSlotSizeKB, the least recently used block is evicted when it's full.
+ * The data of every slot is hashed, reads that don't match (e.g. the index wasn't saved after the slot was reused) are treated as misses.
+ * Disabled unless s.IoDispatcherPersistentCacheSizeMB > 0.
+ */
+class FFileIoStorePersistentBlockCache
+{
+public:
+	struct FEntry
+	{
+		int32 SlotIndex = INDEX_NONE;
+		uint32 Size = 0;
+		FIoHash DataHash;
+	};
+
+	FFileIoStorePersistentBlockCache() = default;
+	~FFileIoStorePersistentBlockCache();
+
+	void Initialize();
+	void Shutdown();
+
+	bool IsEnabled() const
+	{
+		return bEnabled;
+	}
+
+	// validates cached blocks of the container and drops them if the container was changed, can be called from any thread
+	void OnContainerMounted(const FFileIoStoreContainerFile& ContainerFile, FIoContainerId ContainerId);
+	void OnContainerUnmounted(const FFileIoStoreContainerFile& ContainerFile);
+
+	// looks up a block and marks it as recently used, called by the IoDispatcher thread
+	bool Find(uint32 ContainerInstanceId, uint32 BlockIndex, FEntry& OutEntry);
+	// reads the whole block into Dst (at least OutEntry.Size bytes) and validates it, can be called from any thread
+	bool Read(const FEntry& Entry, uint8* Dst);
+	// stores a decompressed block if it's recorded in this session, can be called from any thread
+	void Store(uint32 ContainerInstanceId, uint32 BlockIndex, const uint8* Data, uint32 Size);
+
+private:
+	struct FKey
+	{
+		FIoContainerId ContainerId;
+		uint64 BlockOffset = 0;
+		FIoHash BlockTableHash;
+
+		friend bool operator==(const FKey& A, const FKey& B)
+		{
+			return A.ContainerId == B.ContainerId && A.BlockOffset == B.BlockOffset && A.BlockTableHash == B.BlockTableHash;
+		}
+
+		friend uint32 GetTypeHash(const FKey& Key)
+		{
+			return HashCombine(GetTypeHash(Key.ContainerId), GetTypeHash(Key.BlockOffset));
+		}
+	};
+
+	struct FSlot
+	{
+		FKey Key;
+		FIoHash DataHash;
+		uint32 Size = 0;
+		int32 Prev = INDEX_NONE; // towards the most recently used slot
+		int32 Next = INDEX_NONE; // towards the least recently used slot
+		bool bUsed = false;
+	};
+
+	struct FMountedContainer
+	{
+		FIoContainerId ContainerId;
+		FIoHash BlockTableHash;
+		uint64 CompressionBlockSize = 0;
+	};
+
+	bool MakeKey(uint32 ContainerInstanceId, uint32 BlockIndex, FKey& OutKey) const;
+	void LinkFront(int32 SlotIndex);
+	void Unlink(int32 SlotIndex);
+	void FreeSlot(int32 SlotIndex);
+	int32 AllocSlot();
+	bool LoadIndex();
+	void SaveIndex();
+	void Reset();
+
+	FString IndexFilePath;
+	FString DataFilePath;
+	uint64 SlotSize = 0;
+	uint64 RecordEndCycles = 0;
+	std::atomic<bool> bEnabled{ false };
+	bool bIndexDirty = false;
+	bool bSavedAfterRecording = false;
+
+	FCriticalSection IndexCritical;
+	TArray<FSlot> Slots;
+	TMap<FKey, int32> SlotsMap;
+	TMap<uint32, FMountedContainer> MountedContainers;
+	int32 MostRecentlyUsed = INDEX_NONE;
+	int32 LeastRecentlyUsed = INDEX_NONE;
+	TArray<int32> FreeSlots;
+	uint64 HitCount = 0;
+	uint64 MissCount = 0;
+	uint64 StoreCount = 0;
+	uint64 InvalidCount = 0;
+
+	// a single read/write handle, blocks are small and the cache file is local
+	FCriticalSection FileCritical;
+	TUniquePtr<IFileHandle> FileHandle;
+};
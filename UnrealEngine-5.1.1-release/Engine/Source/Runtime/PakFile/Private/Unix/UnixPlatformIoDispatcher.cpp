@@ -0,0 +1,671 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Unix/UnixPlatformIoDispatcher.h"
+
+#if PLATFORM_UNIX
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Misc/ScopeLock.h"
+#include "Templates/AlignmentTemplates.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+int32 GIoDispatcherIoUringQueueDepth = 64;
+static FAutoConsoleVariableRef CVar_IoDispatcherIoUringQueueDepth(
+	TEXT("s.IoDispatcherIoUringQueueDepth"),
+	GIoDispatcherIoUringQueueDepth,
+	TEXT("The maximum number of reads the io_uring IoDispatcher backend keeps in flight, read when the IoDispatcher starts. 0 disables the io_uring backend."),
+	ECVF_ReadOnly
+);
+
+int32 GIoDispatcherIoUringDirectIO = 1;
+static FAutoConsoleVariableRef CVar_IoDispatcherIoUringDirectIO(
+	TEXT("s.IoDispatcherIoUringDirectIO"),
+	GIoDispatcherIoUringDirectIO,
+	TEXT("If > 0, the io_uring IoDispatcher backend opens containers with O_DIRECT, bypassing the page cache, where the file system supports it.")
+);
+
+// The kernel ABI of io_uring (include/uapi/linux/io_uring.h). It's stable, but the headers of the toolchain sysroot predate it.
+namespace UnixIoUring
+{
+	static constexpr long SysSetup = 425;
+	static constexpr long SysEnter = 426;
+	static constexpr long SysRegister = 427;
+
+	static constexpr uint64 OffSqRing = 0;
+	static constexpr uint64 OffCqRing = 0x8000000ull;
+	static constexpr uint64 OffSqes = 0x10000000ull;
+
+	static constexpr uint8 OpReadv = 1;
+	static constexpr uint8 OpReadFixed = 4;
+
+	static constexpr uint32 EnterGetEvents = 1u << 0;
+	static constexpr uint32 FeatSingleMmap = 1u << 0;
+
+	static constexpr uint32 RegisterBuffers = 0;
+	static constexpr uint32 RegisterEventFd = 4;
+
+	// O_DIRECT requires the file offset, the size and the buffer address to be aligned to the logical block size of the device
+	static constexpr uint64 DirectIOAlignment = 4096;
+
+	struct FSqe
+	{
+		uint8 Opcode;
+		uint8 Flags;
+		uint16 IoPrio;
+		int32 Fd;
+		uint64 Offset;
+		uint64 Addr;
+		uint32 Len;
+		uint32 RwFlags;
+		uint64 UserData;
+		uint16 BufIndex;
+		uint16 Personality;
+		int32 SpliceFdIn;
+		uint64 Pad[2];
+	};
+	static_assert(sizeof(FSqe) == 64, "io_uring_sqe layout mismatch");
+
+	struct FCqe
+	{
+		uint64 UserData;
+		int32 Res;
+		uint32 Flags;
+	};
+	static_assert(sizeof(FCqe) == 16, "io_uring_cqe layout mismatch");
+
+	struct FSqRingOffsets
+	{
+		uint32 Head, Tail, RingMask, RingEntries, Flags, Dropped, Array, Resv1;
+		uint64 Resv2;
+	};
+
+	struct FCqRingOffsets
+	{
+		uint32 Head, Tail, RingMask, RingEntries, Overflow, Cqes, Flags, Resv1;
+		uint64 Resv2;
+	};
+
+	struct FParams
+	{
+		uint32 SqEntries, CqEntries, Flags, SqThreadCpu, SqThreadIdle, Features, WqFd, Resv[3];
+		FSqRingOffsets SqOff;
+		FCqRingOffsets CqOff;
+	};
+	static_assert(sizeof(FParams) == 120, "io_uring_params layout mismatch");
+}
+
+struct FUnixIoUringRing
+{
+	int32 RingFd = -1;
+	void* SqRingPtr = MAP_FAILED;
+	size_t SqRingSize = 0;
+	void* CqRingPtr = MAP_FAILED;
+	size_t CqRingSize = 0;
+	UnixIoUring::FSqe* Sqes = (UnixIoUring::FSqe*)MAP_FAILED;
+	size_t SqesSize = 0;
+
+	uint32* SqHead = nullptr;
+	uint32* SqTail = nullptr;
+	uint32* SqArray = nullptr;
+	uint32 SqMask = 0;
+	uint32 SqEntries = 0;
+	uint32* CqHead = nullptr;
+	uint32* CqTail = nullptr;
+	UnixIoUring::FCqe* Cqes = nullptr;
+	uint32 CqMask = 0;
+
+	~FUnixIoUringRing()
+	{
+		if (Sqes != MAP_FAILED)
+		{
+			munmap(Sqes, SqesSize);
+		}
+		if (CqRingPtr != MAP_FAILED && CqRingPtr != SqRingPtr)
+		{
+			munmap(CqRingPtr, CqRingSize);
+		}
+		if (SqRingPtr != MAP_FAILED)
+		{
+			munmap(SqRingPtr, SqRingSize);
+		}
+		if (RingFd >= 0)
+		{
+			close(RingFd);
+		}
+	}
+
+	static TUniquePtr<FUnixIoUringRing> Create(uint32 Entries)
+	{
+		using namespace UnixIoUring;
+
+		FParams Params;
+		FMemory::Memzero(Params);
+		const int32 Fd = int32(syscall(SysSetup, Entries, &Params));
+		if (Fd < 0)
+		{
+			// ENOSYS on kernels before 5.1, EPERM if it's disabled by a sysctl or seccomp profile
+			UE_LOG(LogIoDispatcher, Log, TEXT("io_uring is not available (errno %d), using the generic IoDispatcher backend"), errno);
+			return nullptr;
+		}
+
+		TUniquePtr<FUnixIoUringRing> Ring = MakeUnique<FUnixIoUringRing>();
+		Ring->RingFd = Fd;
+		Ring->SqRingSize = Params.SqOff.Array + Params.SqEntries * sizeof(uint32);
+		Ring->CqRingSize = Params.CqOff.Cqes + Params.CqEntries * sizeof(FCqe);
+		const bool bSingleMmap = (Params.Features & FeatSingleMmap) != 0;
+		if (bSingleMmap)
+		{
+			Ring->SqRingSize = Ring->CqRingSize = FMath::Max(Ring->SqRingSize, Ring->CqRingSize);
+		}
+
+		Ring->SqRingPtr = mmap(nullptr, Ring->SqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, Fd, OffSqRing);
+		if (Ring->SqRingPtr == MAP_FAILED)
+		{
+			return nullptr;
+		}
+		Ring->CqRingPtr = bSingleMmap ? Ring->SqRingPtr : mmap(nullptr, Ring->CqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, Fd, OffCqRing);
+		if (Ring->CqRingPtr == MAP_FAILED)
+		{
+			return nullptr;
+		}
+		Ring->SqesSize = Params.SqEntries * sizeof(FSqe);
+		Ring->Sqes = (FSqe*)mmap(nullptr, Ring->SqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, Fd, OffSqes);
+		if (Ring->Sqes == MAP_FAILED)
+		{
+			return nullptr;
+		}
+
+		uint8* Sq = (uint8*)Ring->SqRingPtr;
+		Ring->SqHead = (uint32*)(Sq + Params.SqOff.Head);
+		Ring->SqTail = (uint32*)(Sq + Params.SqOff.Tail);
+		Ring->SqArray = (uint32*)(Sq + Params.SqOff.Array);
+		Ring->SqMask = *(uint32*)(Sq + Params.SqOff.RingMask);
+		Ring->SqEntries = *(uint32*)(Sq + Params.SqOff.RingEntries);
+
+		uint8* Cq = (uint8*)Ring->CqRingPtr;
+		Ring->CqHead = (uint32*)(Cq + Params.CqOff.Head);
+		Ring->CqTail = (uint32*)(Cq + Params.CqOff.Tail);
+		Ring->Cqes = (FCqe*)(Cq + Params.CqOff.Cqes);
+		Ring->CqMask = *(uint32*)(Cq + Params.CqOff.RingMask);
+		return Ring;
+	}
+
+	// returns nullptr if the submission queue is full
+	UnixIoUring::FSqe* GetSqe()
+	{
+		const uint32 Head = __atomic_load_n(SqHead, __ATOMIC_ACQUIRE);
+		const uint32 Tail = *SqTail;
+		if (Tail - Head >= SqEntries)
+		{
+			return nullptr;
+		}
+		const uint32 Index = Tail & SqMask;
+		UnixIoUring::FSqe* Sqe = &Sqes[Index];
+		FMemory::Memzero(*Sqe);
+		SqArray[Index] = Index;
+		// without SQPOLL the kernel reads entries only in io_uring_enter, the caller fills the entry before that
+		__atomic_store_n(SqTail, Tail + 1, __ATOMIC_RELEASE);
+		return Sqe;
+	}
+
+	// returns the number of consumed submissions or a negative errno
+	int32 Enter(uint32 NumToSubmit, uint32 MinComplete, uint32 Flags)
+	{
+		const int32 Result = int32(syscall(UnixIoUring::SysEnter, RingFd, NumToSubmit, MinComplete, Flags, nullptr, 0));
+		return Result < 0 ? -errno : Result;
+	}
+
+	int32 Register(uint32 Opcode, const void* Args, uint32 NumArgs)
+	{
+		const int32 Result = int32(syscall(UnixIoUring::SysRegister, RingFd, Opcode, Args, NumArgs));
+		return Result < 0 ? -errno : Result;
+	}
+
+	UnixIoUring::FCqe* PeekCqe()
+	{
+		const uint32 Head = *CqHead;
+		if (Head == __atomic_load_n(CqTail, __ATOMIC_ACQUIRE))
+		{
+			return nullptr;
+		}
+		return &Cqes[Head & CqMask];
+	}
+
+	void AdvanceCq()
+	{
+		__atomic_store_n(CqHead, *CqHead + 1, __ATOMIC_RELEASE);
+	}
+};
+
+TUniquePtr<IPlatformFileIoStore> FUnixIoUringFileIoStoreImpl::TryCreate()
+{
+	if (GIoDispatcherIoUringQueueDepth <= 0 || FParse::Param(FCommandLine::Get(), TEXT("noiouring")))
+	{
+		return nullptr;
+	}
+
+	const uint32 QueueDepth = FMath::RoundUpToPowerOfTwo(uint32(FMath::Min(GIoDispatcherIoUringQueueDepth, 4096)));
+	TUniquePtr<FUnixIoUringRing> Ring = FUnixIoUringRing::Create(QueueDepth);
+	if (!Ring)
+	{
+		return nullptr;
+	}
+
+	// completions signal the eventfd so ServiceWait can wait for both completions and new requests
+	const int32 EventFd = eventfd(0, EFD_CLOEXEC);
+	if (EventFd < 0)
+	{
+		return nullptr;
+	}
+	if (Ring->Register(UnixIoUring::RegisterEventFd, &EventFd, 1) < 0)
+	{
+		close(EventFd);
+		return nullptr;
+	}
+
+	UE_LOG(LogIoDispatcher, Display, TEXT("Using the io_uring IoDispatcher backend with a queue depth of %u"), QueueDepth);
+	return TUniquePtr<IPlatformFileIoStore>(new FUnixIoUringFileIoStoreImpl(MoveTemp(Ring), EventFd, QueueDepth));
+}
+
+FUnixIoUringFileIoStoreImpl::FUnixIoUringFileIoStoreImpl(TUniquePtr<FUnixIoUringRing>&& InRing, int32 InEventFd, uint32 InQueueDepth)
+	: Ring(MoveTemp(InRing))
+	, EventFd(InEventFd)
+	, QueueDepth(FMath::Min(InQueueDepth, Ring->SqEntries))
+{
+	InflightReads.SetNum(QueueDepth);
+	for (int32 SlotIndex = InflightReads.Num() - 1; SlotIndex >= 0; --SlotIndex)
+	{
+		InflightReads[SlotIndex].NextFree = FirstFreeInflightRead;
+		FirstFreeInflightRead = SlotIndex;
+	}
+}
+
+FUnixIoUringFileIoStoreImpl::~FUnixIoUringFileIoStoreImpl()
+{
+	// the kernel writes into the read buffers until the reads complete
+	FlushSubmissions();
+	while (NumInflight > 0)
+	{
+		if (Ring->PeekCqe())
+		{
+			Ring->AdvanceCq();
+			--NumInflight;
+		}
+		else
+		{
+			const int32 Result = Ring->Enter(0, 1, UnixIoUring::EnterGetEvents);
+			if (Result < 0 && Result != -EINTR)
+			{
+				break;
+			}
+		}
+	}
+	Ring.Reset();
+	close(EventFd);
+}
+
+void FUnixIoUringFileIoStoreImpl::Initialize(const FInitializePlatformFileIoStoreParams& Params)
+{
+	WakeUpDispatcherThreadDelegate = Params.WakeUpDispatcherThreadDelegate;
+	BufferAllocator = Params.BufferAllocator;
+	BlockCache = Params.BlockCache;
+	Stats = Params.Stats;
+
+	// registered buffers save pinning the pages of every read, it fails if RLIMIT_MEMLOCK is too low
+	struct iovec BufferMemory;
+	BufferMemory.iov_base = BufferAllocator->GetBufferMemory();
+	BufferMemory.iov_len = BufferAllocator->GetBufferMemorySize();
+	const int32 Result = BufferMemory.iov_base ? Ring->Register(UnixIoUring::RegisterBuffers, &BufferMemory, 1) : -EINVAL;
+	bRegisteredBuffers = Result >= 0;
+	UE_CLOG(!bRegisteredBuffers, LogIoDispatcher, Log, TEXT("Failed to register IoDispatcher buffers with io_uring (errno %d), reads use unregistered buffers"), -Result);
+}
+
+bool FUnixIoUringFileIoStoreImpl::OpenContainer(const TCHAR* ContainerFilePath, uint64& ContainerFileHandle, uint64& ContainerFileSize)
+{
+	IPlatformFile& Ipf = IPlatformFile::GetPlatformPhysical();
+	const FString NativePath = Ipf.ConvertToAbsolutePathForExternalAppForRead(ContainerFilePath);
+	const FTCHARToUTF8 NativePathUtf8(*NativePath);
+
+	FContainerFile* File = new FContainerFile();
+	File->Fd = open(NativePathUtf8.Get(), O_RDONLY | O_CLOEXEC);
+	if (File->Fd < 0)
+	{
+		delete File;
+		return false;
+	}
+
+	struct stat FileInfo;
+	if (fstat(File->Fd, &FileInfo) != 0)
+	{
+		close(File->Fd);
+		delete File;
+		return false;
+	}
+
+	if (GIoDispatcherIoUringDirectIO > 0)
+	{
+		// e.g. tmpfs doesn't support O_DIRECT, such containers are read through the page cache
+		File->DirectFd = open(NativePathUtf8.Get(), O_RDONLY | O_CLOEXEC | O_DIRECT);
+	}
+
+	ContainerFileHandle = reinterpret_cast<UPTRINT>(File);
+	ContainerFileSize = uint64(FileInfo.st_size);
+	return true;
+}
+
+void FUnixIoUringFileIoStoreImpl::CloseContainer(uint64 ContainerFileHandle)
+{
+	check(ContainerFileHandle);
+	FContainerFile* File = reinterpret_cast<FContainerFile*>(ContainerFileHandle);
+	if (File->DirectFd >= 0)
+	{
+		close(File->DirectFd);
+	}
+	close(File->Fd);
+	delete File;
+}
+
+bool FUnixIoUringFileIoStoreImpl::SubmitRead(int32 SlotIndex)
+{
+	using namespace UnixIoUring;
+
+	FInflightRead& Read = InflightReads[SlotIndex];
+	const FFileIoStoreReadRequest* FirstRequest = Read.Requests[0];
+	const FContainerFile* File = reinterpret_cast<const FContainerFile*>(static_cast<UPTRINT>(FirstRequest->ContainerFilePartition->FileHandle));
+
+	FSqe* Sqe = Ring->GetSqe();
+	if (!Sqe)
+	{
+		return false;
+	}
+
+	// a short read is continued where it stopped, which can be in the middle of any of the coalesced requests
+	int32 FirstIndex = 0;
+	uint64 OffsetInRequest = Read.BytesRead;
+	while (OffsetInRequest >= Read.Requests[FirstIndex]->Size)
+	{
+		OffsetInRequest -= Read.Requests[FirstIndex]->Size;
+		++FirstIndex;
+	}
+
+	const uint64 Offset = FirstRequest->Offset + Read.BytesRead;
+	bool bDirect = File->DirectFd >= 0 && IsAligned(Offset, DirectIOAlignment);
+	int32 NumVecs = 0;
+	for (int32 Index = FirstIndex; Index < Read.NumRequests; ++Index)
+	{
+		const FFileIoStoreReadRequest* Request = Read.Requests[Index];
+		struct iovec& Vec = Read.Vecs[NumVecs++];
+		Vec.iov_base = Request->Buffer->Memory + OffsetInRequest;
+		Vec.iov_len = Request->Size - OffsetInRequest;
+		OffsetInRequest = 0;
+		bDirect &= IsAligned(Vec.iov_base, DirectIOAlignment) && (Index == Read.NumRequests - 1 || IsAligned(Vec.iov_len, DirectIOAlignment));
+	}
+
+	// reads past the end of the file are short, so the size can be rounded up as long as the last buffer is big enough
+	struct iovec& LastVec = Read.Vecs[NumVecs - 1];
+	const uint64 LastOffsetInBuffer = static_cast<uint8*>(LastVec.iov_base) - Read.Requests[Read.NumRequests - 1]->Buffer->Memory;
+	const uint64 DirectLastSize = Align(LastVec.iov_len, DirectIOAlignment);
+	bDirect &= LastOffsetInBuffer + DirectLastSize <= BufferAllocator->GetBufferSize();
+	if (bDirect)
+	{
+		LastVec.iov_len = DirectLastSize;
+	}
+
+	Sqe->Fd = bDirect ? File->DirectFd : File->Fd;
+	Sqe->Offset = Offset;
+	Sqe->UserData = uint64(SlotIndex);
+	if (bRegisteredBuffers && NumVecs == 1)
+	{
+		Sqe->Opcode = OpReadFixed;
+		Sqe->Addr = reinterpret_cast<UPTRINT>(Read.Vecs[0].iov_base);
+		Sqe->Len = uint32(Read.Vecs[0].iov_len);
+		Sqe->BufIndex = 0;
+	}
+	else
+	{
+		Sqe->Opcode = OpReadv;
+		Sqe->Addr = reinterpret_cast<UPTRINT>(&Read.Vecs[0]);
+		Sqe->Len = uint32(NumVecs);
+	}
+
+	++NumUnsubmitted;
+	return true;
+}
+
+void FUnixIoUringFileIoStoreImpl::FlushSubmissions()
+{
+	while (NumUnsubmitted > 0)
+	{
+		const int32 Result = Ring->Enter(NumUnsubmitted, 0, 0);
+		if (Result == -EINTR)
+		{
+			continue;
+		}
+		if (Result < 0)
+		{
+			// EAGAIN or EBUSY: the kernel is out of resources until some reads complete, the entries stay in the ring and are submitted again later
+			UE_CLOG(Result != -EAGAIN && Result != -EBUSY, LogIoDispatcher, Warning, TEXT("io_uring_enter failed with errno %d"), -Result);
+			break;
+		}
+		NumUnsubmitted -= uint32(FMath::Min(uint32(Result), NumUnsubmitted));
+		if (Result == 0)
+		{
+			break;
+		}
+	}
+}
+
+void FUnixIoUringFileIoStoreImpl::CompleteRequest(FFileIoStoreReadRequest* Request)
+{
+	{
+		FScopeLock _(&CompletedRequestsCritical);
+		CompletedRequests.Add(Request);
+	}
+	WakeUpDispatcherThreadDelegate->Execute();
+}
+
+bool FUnixIoUringFileIoStoreImpl::ReapCompletions()
+{
+	bool bAnyCompleted = false;
+	while (UnixIoUring::FCqe* Cqe = Ring->PeekCqe())
+	{
+		const int32 SlotIndex = int32(Cqe->UserData);
+		const int32 Result = Cqe->Res;
+		Ring->AdvanceCq();
+
+		FInflightRead& Read = InflightReads[SlotIndex];
+		bool bDone;
+		bool bFailed = false;
+		if (Result > 0)
+		{
+			// a short read before the end of the request is continued where it stopped
+			Read.BytesRead += uint64(Result);
+			bDone = Read.BytesRead >= Read.Size;
+		}
+		else if (Result < 0 && Read.RetryCount++ < 10)
+		{
+			bDone = false;
+		}
+		else
+		{
+			// 0 is the end of the file before the end of the request
+			UE_LOG(LogIoDispatcher, Warning, TEXT("Failed reading %llu bytes at offset %llu (errno %d, Retries: %d)"), Read.Size, Read.Requests[0]->Offset, -Result, Read.RetryCount);
+			bDone = true;
+			bFailed = true;
+		}
+
+		if (!bDone)
+		{
+			if (SubmitRead(SlotIndex))
+			{
+				continue;
+			}
+			bFailed = true; // can't happen, the submission queue has an entry for every slot
+		}
+
+		for (int32 Index = 0; Index < Read.NumRequests; ++Index)
+		{
+			FFileIoStoreReadRequest* Request = Read.Requests[Index];
+			Request->bFailed = bFailed;
+			if (!bFailed)
+			{
+				Stats->OnFilesystemReadCompleted(Request);
+				BlockCache->Store(Request);
+			}
+			CompleteRequest(Request);
+		}
+
+		Read.NumRequests = 0;
+		Read.NextFree = FirstFreeInflightRead;
+		FirstFreeInflightRead = SlotIndex;
+		--NumInflight;
+
+		bAnyCompleted = true;
+	}
+	return bAnyCompleted;
+}
+
+void FUnixIoUringFileIoStoreImpl::CoalesceAdjacentReads(FInflightRead& Read, FFileIoStoreRequestQueue& RequestQueue)
+{
+	uint32 NumCoalescedReads = 0;
+	while (Read.NumRequests < MaxCoalescedReads)
+	{
+		if (!AcquiredBuffer)
+		{
+			AcquiredBuffer = BufferAllocator->AllocBuffer();
+			if (!AcquiredBuffer)
+			{
+				break;
+			}
+		}
+
+		// a vectored read can't skip a gap in the file
+		FFileIoStoreReadRequest* Request = RequestQueue.PopAdjacent(*Read.Requests[Read.NumRequests - 1], Read.Size, false);
+		if (!Request)
+		{
+			break;
+		}
+
+		check(!Request->ImmediateScatter.Request);
+		Request->Buffer = AcquiredBuffer;
+		AcquiredBuffer = nullptr;
+
+		if (BlockCache->Read(Request))
+		{
+			CompleteRequest(Request);
+			break;
+		}
+
+		Stats->OnFilesystemReadStarted(Request);
+		Request->bFailed = true;
+		Read.Requests[Read.NumRequests++] = Request;
+		Read.Size += Request->Size;
+		++NumCoalescedReads;
+	}
+
+	if (NumCoalescedReads > 0)
+	{
+		Stats->OnFilesystemReadsCoalesced(NumCoalescedReads);
+	}
+}
+
+bool FUnixIoUringFileIoStoreImpl::StartRequests(FFileIoStoreRequestQueue& RequestQueue)
+{
+	bool bAnyProgress = ReapCompletions();
+
+	while (FirstFreeInflightRead >= 0)
+	{
+		if (!AcquiredBuffer)
+		{
+			AcquiredBuffer = BufferAllocator->AllocBuffer();
+			if (!AcquiredBuffer)
+			{
+				break;
+			}
+		}
+
+		FFileIoStoreReadRequest* NextRequest = RequestQueue.Pop();
+		if (!NextRequest)
+		{
+			break;
+		}
+		bAnyProgress = true;
+
+		if (NextRequest->bCancelled | NextRequest->bFailed)
+		{
+			CompleteRequest(NextRequest);
+			continue;
+		}
+
+		check(!NextRequest->ImmediateScatter.Request);
+		NextRequest->Buffer = AcquiredBuffer;
+		AcquiredBuffer = nullptr;
+
+		if (BlockCache->Read(NextRequest))
+		{
+			CompleteRequest(NextRequest);
+			continue;
+		}
+
+		const int32 SlotIndex = FirstFreeInflightRead;
+		FInflightRead& Read = InflightReads[SlotIndex];
+		FirstFreeInflightRead = Read.NextFree;
+		Read.Requests[0] = NextRequest;
+		Read.NumRequests = 1;
+		Read.Size = NextRequest->Size;
+		Read.BytesRead = 0;
+		Read.RetryCount = 0;
+		++NumInflight;
+
+		Stats->OnFilesystemReadStarted(NextRequest);
+		NextRequest->bFailed = true;
+		CoalesceAdjacentReads(Read, RequestQueue);
+		verify(SubmitRead(SlotIndex)); // the submission queue has at least as many entries as there are slots
+	}
+
+	FlushSubmissions();
+	return bAnyProgress;
+}
+
+void FUnixIoUringFileIoStoreImpl::GetCompletedRequests(FFileIoStoreReadRequestList& OutRequests)
+{
+	FScopeLock _(&CompletedRequestsCritical);
+	OutRequests.AppendSteal(CompletedRequests);
+}
+
+void FUnixIoUringFileIoStoreImpl::ServiceNotify()
+{
+	const uint64 Value = 1;
+	const ssize_t Result = write(EventFd, &Value, sizeof(Value));
+	(void)Result;
+}
+
+void FUnixIoUringFileIoStoreImpl::ServiceWait()
+{
+	if (Ring->PeekCqe())
+	{
+		return;
+	}
+	uint64 Value;
+	while (read(EventFd, &Value, sizeof(Value)) < 0 && errno == EINTR)
+	{
+	}
+}
+
+TUniquePtr<IPlatformFileIoStore> CreatePlatformFileIoStore()
+{
+	return FUnixIoUringFileIoStoreImpl::TryCreate();
+}
+
+#endif // PLATFORM_UNIX
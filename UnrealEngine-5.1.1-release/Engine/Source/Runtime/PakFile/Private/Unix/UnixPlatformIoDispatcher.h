@@ -0,0 +1,90 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+
+#if PLATFORM_UNIX
+
+#include "HAL/CriticalSection.h"
+#include "IoDispatcherFileBackendTypes.h"
+
+#include <sys/uio.h>
+
+struct FUnixIoUringRing;
+
+/**
+ * io_uring implementation of the IoDispatcher file backend. Reads are submitted in batches to a ring that is owned by the
+ * IoDispatcher file thread, so it keeps up to s.IoDispatcherIoUringQueueDepth reads in flight without any worker threads.
+ * The read buffers are registered with the kernel once, and containers are read with O_DIRECT where the kernel allows it.
+ * Completions and ServiceNotify both signal one eventfd that ServiceWait blocks on.
+ */
+class FUnixIoUringFileIoStoreImpl final : public IPlatformFileIoStore
+{
+public:
+	// returns nullptr if io_uring is not supported by the kernel or disabled, callers fall back to the generic implementation then
+	static TUniquePtr<IPlatformFileIoStore> TryCreate();
+
+	~FUnixIoUringFileIoStoreImpl();
+
+	void Initialize(const FInitializePlatformFileIoStoreParams& Params) override;
+	bool OpenContainer(const TCHAR* ContainerFilePath, uint64& ContainerFileHandle, uint64& ContainerFileSize) override;
+	void CloseContainer(uint64 ContainerFileHandle) override;
+	bool CreateCustomRequests(FFileIoStoreResolvedRequest& ResolvedRequest, FFileIoStoreReadRequestList& OutRequests) override
+	{
+		return false;
+	}
+	bool StartRequests(FFileIoStoreRequestQueue& RequestQueue) override;
+	void GetCompletedRequests(FFileIoStoreReadRequestList& OutRequests) override;
+	void ServiceNotify() override;
+	void ServiceWait() override;
+
+private:
+	struct FContainerFile
+	{
+		int32 Fd = -1;
+		int32 DirectFd = -1; // -1 if the file system doesn't support O_DIRECT or it's disabled
+	};
+
+	// adjacent reads from the same file are submitted as one vectored read
+	static constexpr int32 MaxCoalescedReads = 8;
+
+	struct FInflightRead
+	{
+		FFileIoStoreReadRequest* Requests[MaxCoalescedReads];
+		int32 NumRequests = 0;
+		uint64 Size = 0; // of all requests, they are contiguous in the file
+		uint64 BytesRead = 0;
+		int32 RetryCount = 0;
+		int32 NextFree = -1;
+		struct iovec Vecs[MaxCoalescedReads]; // read by the kernel when the read is submitted, unless a single registered buffer is read
+	};
+
+	FUnixIoUringFileIoStoreImpl(TUniquePtr<FUnixIoUringRing>&& InRing, int32 InEventFd, uint32 InQueueDepth);
+
+	bool ReapCompletions();
+	bool SubmitRead(int32 SlotIndex);
+	void FlushSubmissions();
+	void CompleteRequest(FFileIoStoreReadRequest* Request);
+	void CoalesceAdjacentReads(FInflightRead& Read, FFileIoStoreRequestQueue& RequestQueue);
+
+	const FWakeUpIoDispatcherThreadDelegate* WakeUpDispatcherThreadDelegate = nullptr;
+	FFileIoStoreBufferAllocator* BufferAllocator = nullptr;
+	FFileIoStoreBlockCache* BlockCache = nullptr;
+	FFileIoStoreStats* Stats = nullptr;
+	FFileIoStoreBuffer* AcquiredBuffer = nullptr;
+
+	TUniquePtr<FUnixIoUringRing> Ring;
+	int32 EventFd = -1;
+	const uint32 QueueDepth;
+	uint32 NumInflight = 0;
+	uint32 NumUnsubmitted = 0;
+	bool bRegisteredBuffers = false;
+	TArray<FInflightRead> InflightReads;
+	int32 FirstFreeInflightRead = -1;
+
+	FCriticalSection CompletedRequestsCritical;
+	FFileIoStoreReadRequestList CompletedRequests;
+};
+
+#endif // PLATFORM_UNIX
@@ -55,6 +55,7 @@ class FFilePackageStoreBackend;
 class FOutputDevice;
 class IAsyncReadFileHandle;
 class IMappedFileHandle;
+class IMappedFileRegion;
 struct FIoContainerHeader;
 
 PAKFILE_API DECLARE_LOG_CATEGORY_EXTERN(LogPakFile, Log, All);
@@ -146,6 +147,7 @@ struct FPakInfo
 		PakFile_Version_FrozenIndex = 9,
 		PakFile_Version_PathHashIndex = 10,
 		PakFile_Version_Fnv64BugFix = 11,
+		PakFile_Version_SortedPathHashIndex = 12,
 
 
 		PakFile_Version_Last,
@@ -664,6 +666,92 @@ FORCEINLINE FArchive& operator<<(FArchive& Ar, FPakEntryLocation& PakEntryLocati
 }
 
 
+/**
+ * A serialized FPathHashIndex that is sorted by hash and queried in place, e.g. from a memory mapped pak index, so it doesn't have
+ * to be loaded into a TMap. The layout is the one of the serialized TMap: the number of entries followed by (Hash, FPakEntryLocation) pairs,
+ * paks since FPakInfo::PakFile_Version_SortedPathHashIndex write them sorted by hash.
+ */
+struct FPakSortedPathHashIndexView
+{
+	static constexpr int64 EntrySize = sizeof(uint64) + sizeof(FPakEntryLocation);
+
+	/** Returns false if the data is not a valid index, Data must be aligned to FPakEntryLocation and outlive the view */
+	bool Initialize(const uint8* Data, int64 DataSize)
+	{
+		int32 InNum = 0;
+		if (DataSize < int64(sizeof(InNum)) || !IsAligned(Data, alignof(FPakEntryLocation)))
+		{
+			return false;
+		}
+		FMemory::Memcpy(&InNum, Data, sizeof(InNum));
+		if (InNum < 0 || int64(sizeof(InNum)) + InNum * EntrySize > DataSize)
+		{
+			return false;
+		}
+		Entries = Data + sizeof(InNum);
+		Num = InNum;
+		return true;
+	}
+
+	void Reset()
+	{
+		Entries = nullptr;
+		Num = 0;
+	}
+
+	bool IsValid() const
+	{
+		return Entries != nullptr;
+	}
+
+	int32 GetNum() const
+	{
+		return Num;
+	}
+
+	/** Returns the size of the serialized index, the data that follows it in the pak starts at this offset */
+	int64 GetSerializedSize() const
+	{
+		return int64(sizeof(int32)) + Num * EntrySize;
+	}
+
+	uint64 GetHash(int32 Index) const
+	{
+		uint64 Hash;
+		FMemory::Memcpy(&Hash, Entries + Index * EntrySize, sizeof(Hash));
+		return Hash;
+	}
+
+	const FPakEntryLocation& GetLocation(int32 Index) const
+	{
+		return *reinterpret_cast<const FPakEntryLocation*>(Entries + Index * EntrySize + sizeof(uint64));
+	}
+
+	const FPakEntryLocation* Find(uint64 Hash) const
+	{
+		int32 First = 0;
+		int32 Count = Num;
+		while (Count > 0)
+		{
+			const int32 Step = Count / 2;
+			if (GetHash(First + Step) < Hash)
+			{
+				First += Step + 1;
+				Count -= Step + 1;
+			}
+			else
+			{
+				Count = Step;
+			}
+		}
+		return First < Num && GetHash(First) == Hash ? &GetLocation(First) : nullptr;
+	}
+
+private:
+	const uint8* Entries = nullptr;
+	int32 Num = 0;
+};
+
 class FPakFile;
 
 // Wrapper for a pointer to a shared pak reader archive that has been temporarily acquired. 
@@ -792,6 +880,10 @@ private:
 
 	/** Index data that provides a map from the hash of a Filename to an FPakEntryLocation */
 	FPathHashIndex PathHashIndex;
+	/** Used instead of PathHashIndex if the index is memory mapped, see IsPakMapPathHashIndex */
+	FPakSortedPathHashIndexView MappedPathHashIndex;
+	TUniquePtr<IMappedFileHandle> MappedPathHashIndexHandle;
+	TUniquePtr<IMappedFileRegion> MappedPathHashIndexRegion;
 	/* FPakEntries that have been serialized into a compacted format in an array of bytes. */
 	TArray<uint8> EncodedPakEntries;
 	/* The seed passed to the hash function for hashing filenames in this pak.  Differs per pack so that the same filename in different paks has different hashes */
@@ -1133,6 +1225,8 @@ public:
 		FPakDirectory::TConstIterator DirectoryIt;
 		/** Iterator when using the FPathHashIndex. */
 		FPathHashIndex::TConstIterator PathHashIt;
+		/** Index of the current entry when using the memory mapped FPathHashIndex. */
+		int32 MappedPathHashIndex;
 		/** The cached filename for return in Filename(). */
 		mutable FString CachedFilename;
 		/* The PakEntry for return in Info */
@@ -1151,7 +1245,14 @@ public:
 		{
 			if (bUsePathHash)
 			{
-				++PathHashIt;
+				if (PakFile.MappedPathHashIndex.IsValid())
+				{
+					++MappedPathHashIndex;
+				}
+				else
+				{
+					++PathHashIt;
+				}
 			}
 			else
 			{
@@ -1166,7 +1267,7 @@ public:
 		{
 			if (bUsePathHash)
 			{
-				return !!PathHashIt;
+				return PakFile.MappedPathHashIndex.IsValid() ? MappedPathHashIndex < PakFile.MappedPathHashIndex.GetNum() : !!PathHashIt;
 			}
 			else
 			{
@@ -1198,6 +1299,7 @@ public:
 			, DirectoryIndexIt(FDirectoryIndex())
 			, DirectoryIt(FPakDirectory())
 			, PathHashIt(PakFile.PathHashIndex)
+			, MappedPathHashIndex(0)
 			, bUsePathHash(bInUsePathHash)
 			, bIncludeDeleted(bInIncludeDeleted)
 #if ENABLE_PAKFILE_RUNTIME_PRUNING
@@ -1262,7 +1364,7 @@ public:
 		{
 			if (bUsePathHash)
 			{
-				return PathHashIt.Value();
+				return PakFile.MappedPathHashIndex.IsValid() ? PakFile.MappedPathHashIndex.GetLocation(MappedPathHashIndex) : PathHashIt.Value();
 			}
 			else
 			{
@@ -1277,9 +1379,16 @@ public:
 		{
 			if (bUsePathHash)
 			{
-				while (PathHashIt && !bIncludeDeleted && Info().IsDeleteRecord())
+				while (*this && !bIncludeDeleted && Info().IsDeleteRecord())
 				{
-					++PathHashIt;
+					if (PakFile.MappedPathHashIndex.IsValid())
+					{
+						++MappedPathHashIndex;
+					}
+					else
+					{
+						++PathHashIt;
+					}
 				}
 			}
 			else
@@ -1596,6 +1705,12 @@ public:
 	/* Returns the global,const flag for whether UnrealPak should write a copy of the full DirectoryIndex to the PakFile */
 	static bool IsPakWriteFullDirectoryIndex();
 
+	/* Returns the global,const flag for whether unencrypted PathHashIndexes of unsigned paks are memory mapped and queried in place rather than loaded into a TMap */
+	static bool IsPakMapPathHashIndex();
+
+	/* Returns the global,const flag for whether memory mapped PathHashIndexes are hashed and validated when the pak is mounted */
+	static bool IsPakValidateMappedPathHashIndex();
+
 private:
 
 	/**
@@ -1677,6 +1792,15 @@ private:
 	/* Helper function for LoadIndexInternal; each array of Index bytes read from the file needs to be independently decrypted and checked for corruption */
 	bool DecryptAndValidateIndex(FArchive& Reader, TArray<uint8>& IndexData, FSHAHash& InExpectedHash, FSHAHash& OutActualHash);
 
+	/* Helper function for LoadIndexInternal; memory maps the PathHashIndex and copies the bytes of the Pruned DirectoryIndex that follows it. Returns false if the index can't be mapped and has to be loaded */
+	bool TryMapPathHashIndex(int64 PathHashIndexOffset, int64 PathHashIndexSize, const FSHAHash& PathHashIndexHash, TArray<uint8>& OutPrunedDirectoryIndexData);
+
+	/* Copies the memory mapped PathHashIndex into PathHashIndex, so it can be modified */
+	void UnmapPathHashIndex();
+
+	/** Lookup the FPakEntryLocation in the PathHashIndex or the memory mapped PathHashIndex, return nullptr if not found */
+	const FPakEntryLocation* FindLocationFromPathHashIndex(const FString& FullPath) const;
+
 	/* Manually add a file to a pak file */
 	void AddSpecialFile(const FPakEntry& Entry, const FString& Filename);
 
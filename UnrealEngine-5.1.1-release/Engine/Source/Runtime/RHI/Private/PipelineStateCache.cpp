@@ -56,6 +56,19 @@ static TAtomic<uint32> ComputePipelineCacheMisses;
 static TArray<uint32> ComputePipelineCacheMissesHistory;
 static bool	ReportFrameHitchThisFrame;
 
+// Outcome of the PSO precache for the graphics PSOs created at draw time, available in all builds
+static TAtomic<uint32> GraphicsPipelinePrecacheHits;
+static TAtomic<uint32> GraphicsPipelinePrecacheLate;
+static TAtomic<uint32> GraphicsPipelinePrecacheMisses;
+
+static int32 GPSOPrecacheLogDrawMisses = 0;
+static FAutoConsoleVariableRef CVarPSOPrecacheLogDrawMisses(
+	TEXT("r.PSOPrecache.LogDrawMisses"),
+	GPSOPrecacheLogDrawMisses,
+	TEXT("Logs the graphics PSOs which were not precached and had to be compiled at draw time (default 0)."),
+	ECVF_RenderThreadSafe
+);
+
 enum class EPSOCompileAsyncMode
 {
 	None = 0,
@@ -1531,6 +1544,16 @@ void PipelineStateCache::FlushResources()
 	}
 	ReportFrameHitchThisFrame = false;
 
+	if (IsPSOPrecachingEnabled())
+	{
+		CSV_CUSTOM_STAT(PSO, PSOPrecacheHits, int32(GraphicsPipelinePrecacheHits.Load(EMemoryOrder::Relaxed)), ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(PSO, PSOPrecacheLate, int32(GraphicsPipelinePrecacheLate.Load(EMemoryOrder::Relaxed)), ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(PSO, PSOPrecacheMisses, int32(GraphicsPipelinePrecacheMisses.Load(EMemoryOrder::Relaxed)), ECsvCustomStatOp::Set);
+	}
+	GraphicsPipelinePrecacheHits = 0;
+	GraphicsPipelinePrecacheLate = 0;
+	GraphicsPipelinePrecacheMisses = 0;
+
 	GraphicsPipelineCacheMissesHistory.Insert(GraphicsPipelineCacheMisses, 0);
 	GraphicsPipelineCacheMissesHistory.SetNum(PSO_MISS_FRAME_HISTORY_SIZE);
 	ComputePipelineCacheMissesHistory.Insert(ComputePipelineCacheMisses, 0);
@@ -2078,6 +2101,28 @@ FGraphicsPipelineState* PipelineStateCache::GetAndOrCreateGraphicsPipelineState(
 		if (!Initializer.bFromPSOFileCache)
 		{
 			GraphicsPipelineCacheMisses++;
+
+			// Mesh draw commands pass Unknown unless PSO precache validation already resolved it, other draws are untracked
+			if (PSOPrecacheResult != EPSOPrecacheResult::Untracked && IsPSOPrecachingEnabled())
+			{
+				const EPSOPrecacheResult DrawPrecacheResult = PSOPrecacheResult == EPSOPrecacheResult::Unknown ? CheckPipelineStateInCache(Initializer) : PSOPrecacheResult;
+				if (DrawPrecacheResult == EPSOPrecacheResult::Complete)
+				{
+					GraphicsPipelinePrecacheHits++;
+				}
+				else if (DrawPrecacheResult == EPSOPrecacheResult::Active)
+				{
+					GraphicsPipelinePrecacheLate++;
+				}
+				else if (DrawPrecacheResult == EPSOPrecacheResult::Missed)
+				{
+					GraphicsPipelinePrecacheMisses++;
+					UE_CLOG(GPSOPrecacheLogDrawMisses != 0, LogRHI, Log, TEXT("PSO precache miss: graphics PSO %u (VS %s, PS %s) compiled at draw time"),
+						GetTypeHash(Initializer),
+						Initializer.BoundShaderState.GetVertexShader() ? *Initializer.BoundShaderState.GetVertexShader()->GetHash().ToString() : TEXT("none"),
+						Initializer.BoundShaderState.GetPixelShader() ? *Initializer.BoundShaderState.GetPixelShader()->GetHash().ToString() : TEXT("none"));
+				}
+			}
 		}
 
 		bool bPSOPrecache = Initializer.bFromPSOFileCache;
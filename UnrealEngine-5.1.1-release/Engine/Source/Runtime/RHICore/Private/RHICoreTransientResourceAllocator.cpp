@@ -41,6 +41,13 @@ static FAutoConsoleVariableRef CVarRHITransientAllocatorGarbageCollectLatency(
 	TEXT("Amount of update cycles before memory is reclaimed."),
 	ECVF_ReadOnly);
 
+static int32 GRHITransientAllocatorBestFit = 0;
+static FAutoConsoleVariableRef CVarRHITransientAllocatorBestFit(
+	TEXT("RHI.TransientAllocator.BestFit"),
+	GRHITransientAllocatorBestFit,
+	TEXT("Places transient resources in the smallest free range of a heap that fits them instead of the first one, which leaves larger ranges for later allocations and lowers fragmentation."),
+	ECVF_RenderThreadSafe);
+
 TRACE_DECLARE_INT_COUNTER(TransientResourceCreateCount, TEXT("TransientAllocator/ResourceCreateCount"));
 
 TRACE_DECLARE_INT_COUNTER(TransientTextureCreateCount, TEXT("TransientAllocator/TextureCreateCount"));
@@ -61,12 +68,16 @@ TRACE_DECLARE_INT_COUNTER(TransientMemoryRangeCount, TEXT("TransientAllocator/Me
 
 TRACE_DECLARE_MEMORY_COUNTER(TransientMemoryUsed, TEXT("TransientAllocator/MemoryUsed"));
 TRACE_DECLARE_MEMORY_COUNTER(TransientMemoryRequested, TEXT("TransientAllocator/MemoryRequested"));
+TRACE_DECLARE_MEMORY_COUNTER(TransientMemoryWasted, TEXT("TransientAllocator/MemoryWasted"));
+TRACE_DECLARE_FLOAT_COUNTER(TransientAliasingEfficiency, TEXT("TransientAllocator/AliasingEfficiency"));
 
 DECLARE_STATS_GROUP(TEXT("RHI: Transient Memory"), STATGROUP_RHITransientMemory, STATCAT_Advanced);
 
 DECLARE_MEMORY_STAT(TEXT("Memory Used"), STAT_RHITransientMemoryUsed, STATGROUP_RHITransientMemory);
 DECLARE_MEMORY_STAT(TEXT("Memory Aliased"), STAT_RHITransientMemoryAliased, STATGROUP_RHITransientMemory);
 DECLARE_MEMORY_STAT(TEXT("Memory Requested"), STAT_RHITransientMemoryRequested, STATGROUP_RHITransientMemory);
+DECLARE_MEMORY_STAT(TEXT("Memory Wasted"), STAT_RHITransientMemoryWasted, STATGROUP_RHITransientMemory);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Aliasing Efficiency"), STAT_RHITransientAliasingEfficiency, STATGROUP_RHITransientMemory);
 DECLARE_MEMORY_STAT(TEXT("Buffer Memory Requested"), STAT_RHITransientBufferMemoryRequested, STATGROUP_RHITransientMemory);
 DECLARE_MEMORY_STAT(TEXT("Texture Memory Requested"), STAT_RHITransientTextureMemoryRequested, STATGROUP_RHITransientMemory);
 
@@ -86,21 +97,33 @@ void FRHITransientMemoryStats::Submit(uint64 UsedSize)
 	const int64 MemoryRequested = AliasedSize;
 	const float ToMB = 1.0f / (1024.0f * 1024.0f);
 
+	// Heap memory that was never live at the peak, lost to fragmentation and alignment.
+	const int64 MemoryWasted = FMath::Max<int64>(MemoryUsed - MemoryRequested, 0);
+
+	// How many bytes of resources were placed for each byte of heap memory, above 1 when aliasing saves memory.
+	const float AliasingEfficiency = MemoryUsed > 0 ? static_cast<float>(double(Textures.AllocatedSize + Buffers.AllocatedSize) / double(MemoryUsed)) : 0.0f;
+
 	TRACE_COUNTER_SET(TransientResourceCreateCount, CreateResourceCount);
 	TRACE_COUNTER_SET(TransientTextureCreateCount, Textures.CreateCount);
 	TRACE_COUNTER_SET(TransientBufferCreateCount, Buffers.CreateCount);
 	TRACE_COUNTER_SET(TransientMemoryUsed, MemoryUsed);
 	TRACE_COUNTER_SET(TransientMemoryRequested, MemoryRequested);
+	TRACE_COUNTER_SET(TransientMemoryWasted, MemoryWasted);
+	TRACE_COUNTER_SET(TransientAliasingEfficiency, AliasingEfficiency);
 
 	CSV_CUSTOM_STAT_GLOBAL(TransientResourceCreateCount, CreateResourceCount, ECsvCustomStatOp::Set);
 	CSV_CUSTOM_STAT_GLOBAL(TransientMemoryUsedMB, static_cast<float>(MemoryUsed * ToMB) , ECsvCustomStatOp::Set);
 	CSV_CUSTOM_STAT_GLOBAL(TransientMemoryAliasedMB, static_cast<float>(MemoryRequested * ToMB), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT_GLOBAL(TransientMemoryWastedMB, static_cast<float>(MemoryWasted * ToMB), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT_GLOBAL(TransientAliasingEfficiency, AliasingEfficiency, ECsvCustomStatOp::Set);
 
 	SET_MEMORY_STAT(STAT_RHITransientMemoryUsed, UsedSize);
 	SET_MEMORY_STAT(STAT_RHITransientMemoryAliased, AliasedSize);
 	SET_MEMORY_STAT(STAT_RHITransientMemoryRequested, Textures.AllocatedSize + Buffers.AllocatedSize);
 	SET_MEMORY_STAT(STAT_RHITransientBufferMemoryRequested, Buffers.AllocatedSize);
 	SET_MEMORY_STAT(STAT_RHITransientTextureMemoryRequested, Textures.AllocatedSize);
+	SET_MEMORY_STAT(STAT_RHITransientMemoryWasted, MemoryWasted);
+	SET_FLOAT_STAT(STAT_RHITransientAliasingEfficiency, AliasingEfficiency);
 
 	SET_DWORD_STAT(STAT_RHITransientTextures, Textures.AllocationCount);
 	SET_DWORD_STAT(STAT_RHITransientBuffers, Buffers.AllocationCount);
@@ -359,6 +382,7 @@ FRHITransientHeapAllocator::FFindResult FRHITransientHeapAllocator::FindFreeRang
 	FFindResult FindResult;
 	FindResult.PreviousHandle = HeadHandle;
 
+	FRangeHandle PreviousHandle = HeadHandle;
 	FRangeHandle Handle = GetFirstFreeRangeHandle();
 	while (Handle != InvalidRangeHandle)
 	{
@@ -370,16 +394,39 @@ FRHITransientHeapAllocator::FFindResult FRHITransientHeapAllocator::FindFreeRang
 
 		if (RequiredSize <= Range.Size)
 		{
-			FindResult.FoundHandle = Handle;
-			FindResult.LeftoverSize = Range.Size - RequiredSize;
-			return FindResult;
+			const uint64 LeftoverSize = Range.Size - RequiredSize;
+
+			if (!GRHITransientAllocatorBestFit)
+			{
+				FindResult.FoundHandle = Handle;
+				FindResult.LeftoverSize = LeftoverSize;
+				FindResult.PreviousHandle = PreviousHandle;
+				return FindResult;
+			}
+
+			if (FindResult.FoundHandle == InvalidRangeHandle || LeftoverSize < FindResult.LeftoverSize)
+			{
+				FindResult.FoundHandle = Handle;
+				FindResult.LeftoverSize = LeftoverSize;
+				FindResult.PreviousHandle = PreviousHandle;
+
+				if (LeftoverSize == 0)
+				{
+					break;
+				}
+			}
 		}
 
-		FindResult.PreviousHandle = Handle;
+		PreviousHandle = Handle;
 		Handle = Range.NextFreeHandle;
 	}
 
-	return {};
+	if (FindResult.FoundHandle == InvalidRangeHandle)
+	{
+		return {};
+	}
+
+	return FindResult;
 }
 
 void FRHITransientHeapAllocator::Validate()
@@ -0,0 +1,325 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	GPUReadbackPool.cpp: Pooled asynchronous GPU readbacks delivered to callbacks.
+=============================================================================*/
+
+#include "GPUReadbackPool.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Misc/CoreDelegates.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "RenderCore.h"
+#include "RenderGraphBuilder.h"
+#include "RenderingThread.h"
+
+static int32 GGPUReadbackPoolReleaseUnusedFrames = 30;
+static FAutoConsoleVariableRef CVarGPUReadbackPoolReleaseUnusedFrames(
+	TEXT("r.GPUReadbackPool.ReleaseUnusedFrames"),
+	GGPUReadbackPoolReleaseUnusedFrames,
+	TEXT("Number of frames after which an unused staging buffer or texture of the GPU readback pool is released."),
+	ECVF_RenderThreadSafe);
+
+static int32 GGPUReadbackPoolLateFrames = 4;
+static FAutoConsoleVariableRef CVarGPUReadbackPoolLateFrames(
+	TEXT("r.GPUReadbackPool.LateFrames"),
+	GGPUReadbackPoolLateFrames,
+	TEXT("Readbacks delivered more than this many frames after being enqueued are counted as late in the GPU readback pool stats."),
+	ECVF_RenderThreadSafe);
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pending Readbacks"), STAT_GPUReadbackPool_NumPending, STATGROUP_GPUReadbackPool);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pooled Readbacks"), STAT_GPUReadbackPool_NumPooled, STATGROUP_GPUReadbackPool);
+DECLARE_MEMORY_STAT(TEXT("Pooled Staging Memory"), STAT_GPUReadbackPool_PooledMemory, STATGROUP_GPUReadbackPool);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Readbacks Delivered"), STAT_GPUReadbackPool_NumDelivered, STATGROUP_GPUReadbackPool);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Late Readbacks"), STAT_GPUReadbackPool_NumLate, STATGROUP_GPUReadbackPool);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Stalled Readbacks"), STAT_GPUReadbackPool_NumStalled, STATGROUP_GPUReadbackPool);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Max Latency (frames)"), STAT_GPUReadbackPool_MaxLatency, STATGROUP_GPUReadbackPool);
+DECLARE_CYCLE_STAT(TEXT("Poll"), STAT_GPUReadbackPool_Poll, STATGROUP_GPUReadbackPool);
+DECLARE_CYCLE_STAT(TEXT("Flush"), STAT_GPUReadbackPool_Flush, STATGROUP_GPUReadbackPool);
+
+CSV_DEFINE_CATEGORY(GPUReadbackPool, !UE_SERVER);
+
+TGlobalResource<FGPUReadbackPool> GGPUReadbackPool;
+
+BEGIN_SHADER_PARAMETER_STRUCT(FGPUReadbackPoolBufferParameters, )
+	RDG_BUFFER_ACCESS(Buffer, ERHIAccess::CopySrc)
+END_SHADER_PARAMETER_STRUCT()
+
+BEGIN_SHADER_PARAMETER_STRUCT(FGPUReadbackPoolTextureParameters, )
+	RDG_TEXTURE_ACCESS(Texture, ERHIAccess::CopySrc)
+END_SHADER_PARAMETER_STRUCT()
+
+void FGPUReadbackPool::InitRHI()
+{
+	EndFrameHandle = FCoreDelegates::OnEndFrameRT.AddRaw(this, &FGPUReadbackPool::Poll);
+}
+
+void FGPUReadbackPool::ReleaseRHI()
+{
+	FCoreDelegates::OnEndFrameRT.Remove(EndFrameHandle);
+	EndFrameHandle.Reset();
+
+	UE_CLOG(PendingReadbacks.Num() > 0, LogRendererCore, Log, TEXT("Dropping %d pending GPU readbacks"), PendingReadbacks.Num());
+	PendingReadbacks.Empty();
+	FreeReadbacks.Empty();
+}
+
+TUniquePtr<FGPUReadbackPool::FPooledReadback> FGPUReadbackPool::AllocateReadback(uint64 Key, bool bIsTexture)
+{
+	// Most recently used first, the older ones are left to be released
+	for (int32 Index = FreeReadbacks.Num() - 1; Index >= 0; Index--)
+	{
+		if (FreeReadbacks[Index]->Key == Key && FreeReadbacks[Index]->bIsTexture == bIsTexture)
+		{
+			TUniquePtr<FPooledReadback> Pooled = MoveTemp(FreeReadbacks[Index]);
+			FreeReadbacks.RemoveAt(Index, 1, false);
+			return Pooled;
+		}
+	}
+
+	TUniquePtr<FPooledReadback> Pooled = MakeUnique<FPooledReadback>();
+	Pooled->Key = Key;
+	Pooled->bIsTexture = bIsTexture;
+	if (bIsTexture)
+	{
+		Pooled->Readback = MakeUnique<FRHIGPUTextureReadback>(TEXT("GPUReadbackPool.Texture"));
+	}
+	else
+	{
+		Pooled->Readback = MakeUnique<FRHIGPUBufferReadback>(TEXT("GPUReadbackPool.Buffer"));
+	}
+	return Pooled;
+}
+
+void FGPUReadbackPool::EnqueueReadback(FRDGBuilder& GraphBuilder, FRDGBufferRef Buffer, uint32 NumBytes, EGPUReadbackThread CallbackThread, FOnGPUReadbackReady&& OnReady)
+{
+	check(IsInRenderingThread());
+	check(Buffer);
+
+	if (NumBytes == 0)
+	{
+		NumBytes = Buffer->Desc.GetSize();
+	}
+	check(NumBytes > 0);
+
+	// Staging buffers grow to the largest copy, recycle them by power of two size
+	FPendingReadback& PendingReadback = PendingReadbacks.AddDefaulted_GetRef();
+	PendingReadback.Pooled = AllocateReadback(FMath::RoundUpToPowerOfTwo(NumBytes), false);
+	PendingReadback.Pooled->bCopyEnqueued = false;
+	PendingReadback.Name = FName(Buffer->Name);
+	PendingReadback.NumBytes = NumBytes;
+	PendingReadback.EnqueueFrame = GFrameNumberRenderThread;
+	PendingReadback.CallbackThread = CallbackThread;
+	PendingReadback.OnReady = MoveTemp(OnReady);
+
+	FGPUReadbackPoolBufferParameters* PassParameters = GraphBuilder.AllocParameters<FGPUReadbackPoolBufferParameters>();
+	PassParameters->Buffer = Buffer;
+
+	GraphBuilder.AddPass(
+		RDG_EVENT_NAME("GPUReadbackPool(%s)", Buffer->Name),
+		PassParameters,
+		ERDGPassFlags::Readback,
+		[Pooled = PendingReadback.Pooled.Get(), Buffer, NumBytes](FRHICommandList& RHICmdList)
+	{
+		Pooled->Readback->EnqueueCopy(RHICmdList, Buffer->GetRHI(), NumBytes);
+		Pooled->bCopyEnqueued = true;
+	});
+}
+
+void FGPUReadbackPool::EnqueueReadback(FRDGBuilder& GraphBuilder, FRDGTextureRef Texture, FIntRect Rect, EGPUReadbackThread CallbackThread, FOnGPUReadbackReady&& OnReady)
+{
+	check(IsInRenderingThread());
+	check(Texture && Texture->Desc.IsTexture2D() && Texture->Desc.NumSamples == 1);
+	check(GPixelFormats[Texture->Desc.Format].BlockSizeX == 1 && GPixelFormats[Texture->Desc.Format].BlockSizeY == 1);
+
+	const FIntPoint TextureExtent = Texture->Desc.Extent;
+	if (Rect.IsEmpty())
+	{
+		Rect = FIntRect(FIntPoint::ZeroValue, TextureExtent);
+	}
+	Rect.Clip(FIntRect(FIntPoint::ZeroValue, TextureExtent));
+
+	// Staging textures have the size and format of the source texture
+	const uint64 Key = (uint64(Texture->Desc.Format) << 48) | (uint64(TextureExtent.X) << 24) | uint64(TextureExtent.Y);
+
+	FPendingReadback& PendingReadback = PendingReadbacks.AddDefaulted_GetRef();
+	PendingReadback.Pooled = AllocateReadback(Key, true);
+	PendingReadback.Pooled->bCopyEnqueued = false;
+	PendingReadback.Name = FName(Texture->Name);
+	PendingReadback.Rect = Rect;
+	PendingReadback.Format = Texture->Desc.Format;
+	PendingReadback.NumBytes = Rect.Area() * GPixelFormats[Texture->Desc.Format].BlockBytes;
+	PendingReadback.EnqueueFrame = GFrameNumberRenderThread;
+	PendingReadback.CallbackThread = CallbackThread;
+	PendingReadback.OnReady = MoveTemp(OnReady);
+
+	FGPUReadbackPoolTextureParameters* PassParameters = GraphBuilder.AllocParameters<FGPUReadbackPoolTextureParameters>();
+	PassParameters->Texture = Texture;
+
+	const FResolveRect ResolveRect(Rect.Min.X, Rect.Min.Y, Rect.Max.X, Rect.Max.Y);
+
+	GraphBuilder.AddPass(
+		RDG_EVENT_NAME("GPUReadbackPool(%s)", Texture->Name),
+		PassParameters,
+		ERDGPassFlags::Readback,
+		[Pooled = PendingReadback.Pooled.Get(), Texture, ResolveRect](FRHICommandList& RHICmdList)
+	{
+		Pooled->Readback->EnqueueCopy(RHICmdList, Texture->GetRHI(), ResolveRect);
+		Pooled->bCopyEnqueued = true;
+	});
+}
+
+void FGPUReadbackPool::Deliver(FPendingReadback& PendingReadback)
+{
+	FPooledReadback& Pooled = *PendingReadback.Pooled;
+
+	FGPUReadbackResult Result;
+	Result.Name = PendingReadback.Name;
+	Result.LatencyFrames = GFrameNumberRenderThread - PendingReadback.EnqueueFrame;
+
+	// Copy the data out so the staging memory goes back to the pool right away
+	if (Pooled.bIsTexture)
+	{
+		FRHIGPUTextureReadback& TextureReadback = static_cast<FRHIGPUTextureReadback&>(*Pooled.Readback);
+		const FIntRect Rect = PendingReadback.Rect;
+		const uint32 BytesPerPixel = GPixelFormats[PendingReadback.Format].BlockBytes;
+		const uint32 RowBytes = Rect.Width() * BytesPerPixel;
+
+		Result.Extent = Rect.Size();
+		Result.Format = PendingReadback.Format;
+
+		int32 RowPitchInPixels = 0;
+		if (const uint8* StagingData = static_cast<const uint8*>(TextureReadback.Lock(RowPitchInPixels)))
+		{
+			Result.Data.SetNumUninitialized(RowBytes * Rect.Height());
+			for (int32 Row = 0; Row < Rect.Height(); Row++)
+			{
+				const uint8* Src = StagingData + (SIZE_T(Rect.Min.Y + Row) * RowPitchInPixels + Rect.Min.X) * BytesPerPixel;
+				FMemory::Memcpy(Result.Data.GetData() + SIZE_T(Row) * RowBytes, Src, RowBytes);
+			}
+			TextureReadback.Unlock();
+		}
+	}
+	else if (const void* StagingData = Pooled.Readback->Lock(PendingReadback.NumBytes))
+	{
+		Result.Data.SetNumUninitialized(PendingReadback.NumBytes);
+		FMemory::Memcpy(Result.Data.GetData(), StagingData, PendingReadback.NumBytes);
+		Pooled.Readback->Unlock();
+	}
+
+	INC_DWORD_STAT(STAT_GPUReadbackPool_NumDelivered);
+	if (Result.LatencyFrames > uint32(GGPUReadbackPoolLateFrames))
+	{
+		INC_DWORD_STAT(STAT_GPUReadbackPool_NumLate);
+	}
+
+	Pooled.LastUsedFrame = GFrameNumberRenderThread;
+	FreeReadbacks.Add(MoveTemp(PendingReadback.Pooled));
+
+	if (!PendingReadback.OnReady)
+	{
+		return;
+	}
+
+	switch (PendingReadback.CallbackThread)
+	{
+	case EGPUReadbackThread::RenderThread:
+		PendingReadback.OnReady(MoveTemp(Result));
+		break;
+
+	case EGPUReadbackThread::GameThread:
+	case EGPUReadbackThread::AnyThread:
+		FFunctionGraphTask::CreateAndDispatchWhenReady(
+			[OnReady = MoveTemp(PendingReadback.OnReady), Result = MoveTemp(Result)]() mutable
+			{
+				OnReady(MoveTemp(Result));
+			},
+			TStatId(), nullptr,
+			PendingReadback.CallbackThread == EGPUReadbackThread::GameThread ? ENamedThreads::GameThread : ENamedThreads::AnyBackgroundThreadNormalTask);
+		break;
+	}
+}
+
+void FGPUReadbackPool::Poll()
+{
+	check(IsInRenderingThread());
+	SCOPE_CYCLE_COUNTER(STAT_GPUReadbackPool_Poll);
+
+	uint32 MaxLatencyFrames = 0;
+	for (int32 Index = 0; Index < PendingReadbacks.Num(); Index++)
+	{
+		FPendingReadback& PendingReadback = PendingReadbacks[Index];
+		if (PendingReadback.Pooled->bCopyEnqueued && PendingReadback.Pooled->Readback->IsReady())
+		{
+			Deliver(PendingReadback);
+			PendingReadbacks.RemoveAt(Index--, 1, false);
+		}
+		else
+		{
+			MaxLatencyFrames = FMath::Max(MaxLatencyFrames, GFrameNumberRenderThread - PendingReadback.EnqueueFrame);
+		}
+	}
+
+	ReleaseUnusedReadbacks();
+
+	SET_FLOAT_STAT(STAT_GPUReadbackPool_MaxLatency, float(MaxLatencyFrames));
+	CSV_CUSTOM_STAT(GPUReadbackPool, MaxLatencyFrames, int32(MaxLatencyFrames), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(GPUReadbackPool, NumPending, PendingReadbacks.Num(), ECsvCustomStatOp::Set);
+	UpdateStats();
+}
+
+void FGPUReadbackPool::Flush(FRHICommandListImmediate& RHICmdList)
+{
+	check(IsInRenderingThread());
+	SCOPE_CYCLE_COUNTER(STAT_GPUReadbackPool_Flush);
+
+	if (PendingReadbacks.Num() == 0)
+	{
+		return;
+	}
+
+	RHICmdList.SubmitCommandsAndFlushGPU();
+	RHICmdList.BlockUntilGPUIdle();
+
+	for (int32 Index = 0; Index < PendingReadbacks.Num(); Index++)
+	{
+		FPendingReadback& PendingReadback = PendingReadbacks[Index];
+
+		// Readbacks of graphs that have not executed yet stay pending
+		if (PendingReadback.Pooled->bCopyEnqueued && PendingReadback.Pooled->Readback->IsReady())
+		{
+			INC_DWORD_STAT(STAT_GPUReadbackPool_NumStalled);
+			Deliver(PendingReadback);
+			PendingReadbacks.RemoveAt(Index--, 1, false);
+		}
+	}
+
+	UpdateStats();
+}
+
+void FGPUReadbackPool::ReleaseUnusedReadbacks()
+{
+	for (int32 Index = 0; Index < FreeReadbacks.Num(); Index++)
+	{
+		if (GFrameNumberRenderThread - FreeReadbacks[Index]->LastUsedFrame > uint32(GGPUReadbackPoolReleaseUnusedFrames))
+		{
+			FreeReadbacks.RemoveAtSwap(Index--, 1, false);
+		}
+	}
+}
+
+void FGPUReadbackPool::UpdateStats()
+{
+#if STATS
+	uint64 PooledMemory = 0;
+	for (const TUniquePtr<FPooledReadback>& Pooled : FreeReadbacks)
+	{
+		PooledMemory += Pooled->bIsTexture
+			? static_cast<const FRHIGPUTextureReadback&>(*Pooled->Readback).GetGPUSizeBytes()
+			: static_cast<const FRHIGPUBufferReadback&>(*Pooled->Readback).GetGPUSizeBytes();
+	}
+
+	SET_DWORD_STAT(STAT_GPUReadbackPool_NumPending, PendingReadbacks.Num());
+	SET_DWORD_STAT(STAT_GPUReadbackPool_NumPooled, FreeReadbacks.Num());
+	SET_MEMORY_STAT(STAT_GPUReadbackPool_PooledMemory, PooledMemory);
+#endif
+}
@@ -0,0 +1,284 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ProfilingDebugging/FrameTelemetry.h"
+
+#if WITH_FRAME_TELEMETRY
+
+#include "HAL/IConsoleManager.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "RenderCore.h"
+#include "RenderingThread.h"
+#include "RHI.h"
+#include "Tasks/Task.h"
+
+static int32 GFrameTelemetry = 0;
+static FAutoConsoleVariableRef CVarFrameTelemetry(
+	TEXT("r.FrameTelemetry"),
+	GFrameTelemetry,
+	TEXT("Records the frame, thread and GPU times, draw calls and most expensive GPU stats of recent frames, dumped when a hitch is detected."),
+	ECVF_RenderThreadSafe);
+
+static int32 GFrameTelemetryNumFrames = 300;
+static FAutoConsoleVariableRef CVarFrameTelemetryNumFrames(
+	TEXT("r.FrameTelemetry.NumFrames"),
+	GFrameTelemetryNumFrames,
+	TEXT("Number of frames kept in the frame telemetry ring buffer."),
+	ECVF_RenderThreadSafe);
+
+static float GFrameTelemetryHitchThresholdMs = 100.0f;
+static FAutoConsoleVariableRef CVarFrameTelemetryHitchThresholdMs(
+	TEXT("r.FrameTelemetry.HitchThresholdMs"),
+	GFrameTelemetryHitchThresholdMs,
+	TEXT("Frame time in milliseconds above which a frame is a hitch and the frame telemetry is dumped. 0 disables hitch detection."),
+	ECVF_RenderThreadSafe);
+
+static float GFrameTelemetryMinSecondsBetweenDumps = 30.0f;
+static FAutoConsoleVariableRef CVarFrameTelemetryMinSecondsBetweenDumps(
+	TEXT("r.FrameTelemetry.MinSecondsBetweenDumps"),
+	GFrameTelemetryMinSecondsBetweenDumps,
+	TEXT("Hitches happening less than this many seconds after the last dump are not dumped."),
+	ECVF_RenderThreadSafe);
+
+static int32 GFrameTelemetryDumpToFile = 1;
+static FAutoConsoleVariableRef CVarFrameTelemetryDumpToFile(
+	TEXT("r.FrameTelemetry.DumpToFile"),
+	GFrameTelemetryDumpToFile,
+	TEXT("Whether hitches write the frame telemetry to Saved/Profiling/FrameTelemetry, OnHitch is broadcast either way."),
+	ECVF_RenderThreadSafe);
+
+static FAutoConsoleCommand CmdFrameTelemetryDump(
+	TEXT("r.FrameTelemetry.Dump"),
+	TEXT("Writes the recorded frame telemetry to Saved/Profiling/FrameTelemetry."),
+	FConsoleCommandDelegate::CreateStatic([]()
+	{
+		ENQUEUE_RENDER_COMMAND(FrameTelemetryDump)([](FRHICommandListImmediate&)
+		{
+			FFrameTelemetry::Get().Dump(TEXT("Manual"));
+		});
+	}));
+
+// The GPU stats of a frame are read back a few frames later, see FRealtimeGPUProfiler::EndFrame
+static constexpr int32 HitchDumpDelayFrames = 5;
+
+FFrameTelemetry& FFrameTelemetry::Get()
+{
+	static FFrameTelemetry Instance;
+	return Instance;
+}
+
+void FFrameTelemetry::Init()
+{
+	check(IsInGameThread());
+
+	if (!bInitialized)
+	{
+		bInitialized = true;
+		FCoreDelegates::OnEndFrameRT.AddLambda([]() { FFrameTelemetry::Get().EndFrameRT(); });
+	}
+}
+
+bool FFrameTelemetry::IsEnabled()
+{
+	return GFrameTelemetry > 0;
+}
+
+void FFrameTelemetry::EndFrameRT()
+{
+	check(IsInRenderingThread());
+
+	const uint64 EndFrameCycles = FPlatformTime::Cycles64();
+	const uint64 LastCycles = LastEndFrameCycles;
+	LastEndFrameCycles = EndFrameCycles;
+
+	if (!IsEnabled())
+	{
+		Samples.Empty();
+		NumSamples = 0;
+		NextSampleIndex = 0;
+		FramesUntilHitchDump = -1;
+		return;
+	}
+
+	const int32 NumFrames = FMath::Max(GFrameTelemetryNumFrames, HitchDumpDelayFrames + 1);
+	if (Samples.Num() != NumFrames)
+	{
+		Samples.Empty(NumFrames);
+		Samples.SetNum(NumFrames);
+		NumSamples = 0;
+		NextSampleIndex = 0;
+		FramesUntilHitchDump = -1;
+	}
+
+	FFrameTelemetrySample& Sample = Samples[NextSampleIndex];
+	Sample = FFrameTelemetrySample();
+	Sample.FrameNumber = GFrameNumberRenderThread;
+	Sample.FrameTimeMs = LastCycles != 0 ? float(FPlatformTime::ToMilliseconds64(EndFrameCycles - LastCycles)) : 0.0f;
+	Sample.GameThreadTimeMs = FPlatformTime::ToMilliseconds(GGameThreadTime);
+	Sample.RenderThreadTimeMs = FPlatformTime::ToMilliseconds(GRenderThreadTime);
+	Sample.RHIThreadTimeMs = IsRunningRHIInSeparateThread() ? FPlatformTime::ToMilliseconds(GRHIThreadTime) : 0.0f;
+	Sample.GPUTimeMs = FPlatformTime::ToMilliseconds(RHIGetGPUFrameCycles(0));
+	Sample.NumDrawCalls = GNumDrawCallsRHI[0];
+	Sample.NumPrimitivesDrawn = GNumPrimitivesDrawnRHI[0];
+
+	NextSampleIndex = (NextSampleIndex + 1) % Samples.Num();
+	NumSamples = FMath::Min(NumSamples + 1, Samples.Num());
+
+	if (FramesUntilHitchDump >= 0)
+	{
+		if (FramesUntilHitchDump-- == 0)
+		{
+			DumpHitch();
+		}
+	}
+	else if (GFrameTelemetryHitchThresholdMs > 0.0f && Sample.FrameTimeMs > GFrameTelemetryHitchThresholdMs
+		&& FPlatformTime::Seconds() - LastDumpTime > GFrameTelemetryMinSecondsBetweenDumps)
+	{
+		HitchFrameNumber = Sample.FrameNumber;
+		FramesUntilHitchDump = HitchDumpDelayFrames;
+	}
+}
+
+FFrameTelemetrySample* FFrameTelemetry::FindSample(uint32 FrameNumber)
+{
+	const int32 LastSampleIndex = (NextSampleIndex + Samples.Num() - 1) % FMath::Max(Samples.Num(), 1);
+	if (NumSamples == 0 || FrameNumber > Samples[LastSampleIndex].FrameNumber)
+	{
+		return nullptr;
+	}
+
+	const uint32 FramesAgo = Samples[LastSampleIndex].FrameNumber - FrameNumber;
+	if (FramesAgo >= uint32(NumSamples))
+	{
+		return nullptr;
+	}
+
+	FFrameTelemetrySample& Sample = Samples[(LastSampleIndex + Samples.Num() - int32(FramesAgo)) % Samples.Num()];
+	return Sample.FrameNumber == FrameNumber ? &Sample : nullptr;
+}
+
+void FFrameTelemetry::SetGPUPassTimes(uint32 FrameNumber, const TMap<FName, float>& PassTimesMs)
+{
+	check(IsInRenderingThread());
+
+	FFrameTelemetrySample* Sample = FindSample(FrameNumber);
+	if (!Sample)
+	{
+		return;
+	}
+
+	Sample->NumPasses = 0;
+	for (const TPair<FName, float>& PassTime : PassTimesMs)
+	{
+		// Insertion into the few most expensive passes, kept sorted
+		int32 InsertIndex = Sample->NumPasses;
+		while (InsertIndex > 0 && Sample->Passes[InsertIndex - 1].GPUTimeMs < PassTime.Value)
+		{
+			if (InsertIndex < FFrameTelemetrySample::MaxPasses)
+			{
+				Sample->Passes[InsertIndex] = Sample->Passes[InsertIndex - 1];
+			}
+			InsertIndex--;
+		}
+
+		if (InsertIndex < FFrameTelemetrySample::MaxPasses)
+		{
+			Sample->Passes[InsertIndex].Name = PassTime.Key;
+			Sample->Passes[InsertIndex].GPUTimeMs = PassTime.Value;
+			Sample->NumPasses = FMath::Min(Sample->NumPasses + 1, FFrameTelemetrySample::MaxPasses);
+		}
+	}
+}
+
+void FFrameTelemetry::GetSamples(TArray<FFrameTelemetrySample>& OutSamples) const
+{
+	check(IsInRenderingThread());
+
+	OutSamples.Reset(NumSamples);
+	const int32 FirstSampleIndex = (NextSampleIndex + Samples.Num() - NumSamples) % FMath::Max(Samples.Num(), 1);
+	for (int32 Index = 0; Index < NumSamples; Index++)
+	{
+		OutSamples.Add(Samples[(FirstSampleIndex + Index) % Samples.Num()]);
+	}
+}
+
+void FFrameTelemetry::DumpHitch()
+{
+	LastDumpTime = FPlatformTime::Seconds();
+
+	const FFrameTelemetrySample* HitchSample = FindSample(HitchFrameNumber);
+	if (!HitchSample)
+	{
+		return;
+	}
+
+	if (OnHitch.IsBound())
+	{
+		TArray<FFrameTelemetrySample> RecordedSamples;
+		GetSamples(RecordedSamples);
+		OnHitch.Broadcast(*HitchSample, RecordedSamples);
+	}
+
+	if (GFrameTelemetryDumpToFile)
+	{
+		Dump(FString::Printf(TEXT("Hitch of %.1fms on frame %u"), HitchSample->FrameTimeMs, HitchFrameNumber));
+	}
+}
+
+void FFrameTelemetry::Dump(const FString& Reason)
+{
+	check(IsInRenderingThread());
+
+	TArray<FFrameTelemetrySample> RecordedSamples;
+	GetSamples(RecordedSamples);
+	if (RecordedSamples.Num() == 0)
+	{
+		return;
+	}
+
+	const FString Filename = FPaths::ProfilingDir() / TEXT("FrameTelemetry") / FString::Printf(TEXT("FrameTelemetry-%s.csv"), *FDateTime::Now().ToString());
+
+	// Formatting and writing the file stays off the render thread
+	UE::Tasks::Launch(TEXT("FFrameTelemetry::Dump"), [RecordedSamples = MoveTemp(RecordedSamples), Reason, Filename]()
+	{
+		TStringBuilder<1024> Csv;
+		Csv.Appendf(TEXT("# %s\n"), *Reason);
+		Csv.Append(TEXT("Frame,FrameMs,GameThreadMs,RenderThreadMs,RHIThreadMs,GPUMs,DrawCalls,Primitives"));
+		for (int32 PassIndex = 0; PassIndex < FFrameTelemetrySample::MaxPasses; PassIndex++)
+		{
+			Csv.Appendf(TEXT(",Pass%d,Pass%dMs"), PassIndex, PassIndex);
+		}
+		Csv.Append(TEXT("\n"));
+
+		for (const FFrameTelemetrySample& Sample : RecordedSamples)
+		{
+			Csv.Appendf(TEXT("%u,%.2f,%.2f,%.2f,%.2f,%.2f,%d,%d"), Sample.FrameNumber, Sample.FrameTimeMs, Sample.GameThreadTimeMs, Sample.RenderThreadTimeMs,
+				Sample.RHIThreadTimeMs, Sample.GPUTimeMs, Sample.NumDrawCalls, Sample.NumPrimitivesDrawn);
+			for (int32 PassIndex = 0; PassIndex < FFrameTelemetrySample::MaxPasses; PassIndex++)
+			{
+				if (PassIndex < Sample.NumPasses)
+				{
+					Csv.Appendf(TEXT(",%s,%.3f"), *Sample.Passes[PassIndex].Name.ToString(), Sample.Passes[PassIndex].GPUTimeMs);
+				}
+				else
+				{
+					Csv.Append(TEXT(",,"));
+				}
+			}
+			Csv.Append(TEXT("\n"));
+		}
+
+		if (FFileHelper::SaveStringToFile(Csv.ToView(), *Filename))
+		{
+			UE_LOG(LogRendererCore, Log, TEXT("Frame telemetry written to %s (%s)"), *Filename, *Reason);
+		}
+		else
+		{
+			UE_LOG(LogRendererCore, Warning, TEXT("Failed to write frame telemetry to %s"), *Filename);
+		}
+	});
+}
+
+#endif //WITH_FRAME_TELEMETRY
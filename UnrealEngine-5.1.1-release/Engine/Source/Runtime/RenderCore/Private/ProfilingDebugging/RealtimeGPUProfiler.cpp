@@ -586,6 +586,11 @@ public:
 		uint64 TotalUs = 0llu;
 		FNameSet StatSeenSet;
 
+#if WITH_FRAME_TELEMETRY
+		const bool bFrameTelemetryEnabled = FFrameTelemetry::IsEnabled() && NumEventsThisFramePlusOne > 1;
+		TMap<FName, float> FrameTelemetryPassTimes;
+#endif
+
 		for (int32 Idx = 1; Idx < NumEventsThisFramePlusOne; ++Idx)
 		{
 			const FRealtimeGPUProfilerEvent& Event = GpuProfilerEvents[Idx];
@@ -612,6 +617,13 @@ public:
 					CsvProfiler->RecordCustomStat(Event.GetName(), CSV_CATEGORY_INDEX(GPU), EventTimeUs / 1000.f, CsvStatOp);
 				}
 #endif
+
+#if WITH_FRAME_TELEMETRY
+				if (bFrameTelemetryEnabled)
+				{
+					FrameTelemetryPassTimes.FindOrAdd(Event.GetName()) += IncExcTime.ExclusiveTimeUs / 1000.f;
+				}
+#endif
 			}
 
 #if TRACING_PROFILER
@@ -637,6 +649,13 @@ PRAGMA_ENABLE_DEPRECATION_WARNINGS
 		FThreadStats::AddMessage(GET_STATFNAME(Stat_GPU_Total), EStatOperation::Set, TotalUs / 1000.);
 #endif 
 
+#if WITH_FRAME_TELEMETRY
+		if (bFrameTelemetryEnabled)
+		{
+			FFrameTelemetry::Get().SetGPUPassTimes(GpuProfilerEvents[1].GetFrameNumber(), FrameTelemetryPassTimes);
+		}
+#endif
+
 #if CSV_PROFILER
 		if (CsvProfiler)
 		{
@@ -1018,6 +1037,13 @@ bool AreGPUStatsEnabled()
 		return false;
 	}
 
+#if WITH_FRAME_TELEMETRY
+	if (FFrameTelemetry::IsEnabled())
+	{
+		return true;
+	}
+#endif
+
 #if GPUPROFILERTRACE_ENABLED
 	// Force GPU profiler on if Unreal Insights is running
 	if (UE_TRACE_CHANNELEXPR_IS_ENABLED(GpuProfilerTrace::GpuChannel))
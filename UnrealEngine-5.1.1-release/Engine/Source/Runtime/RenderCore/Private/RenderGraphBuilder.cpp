@@ -7,7 +7,9 @@
 #include "RenderGraphResourcePool.h"
 #include "VisualizeTexture.h"
 #include "ProfilingDebugging/CsvProfiler.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 #include "Async/ParallelFor.h"
+#include "Algo/StableSort.h"
 
 #if ENABLE_RHI_VALIDATION
 
@@ -398,6 +400,7 @@ void FRDGBuilder::TickPoolElements()
 	SET_DWORD_STAT(STAT_RDG_PassCount, GRDGStatPassCount);
 	SET_DWORD_STAT(STAT_RDG_PassCullCount, GRDGStatPassCullCount);
 	SET_DWORD_STAT(STAT_RDG_RenderPassMergeCount, GRDGStatRenderPassMergeCount);
+	SET_DWORD_STAT(STAT_RDG_AutoAsyncComputePassCount, GRDGStatAutoAsyncComputePassCount);
 	SET_DWORD_STAT(STAT_RDG_PassDependencyCount, GRDGStatPassDependencyCount);
 	SET_DWORD_STAT(STAT_RDG_TextureCount, GRDGStatTextureCount);
 	SET_DWORD_STAT(STAT_RDG_TextureReferenceCount, GRDGStatTextureReferenceCount);
@@ -415,6 +418,7 @@ void FRDGBuilder::TickPoolElements()
 	GRDGStatPassCount = 0;
 	GRDGStatPassCullCount = 0;
 	GRDGStatRenderPassMergeCount = 0;
+	GRDGStatAutoAsyncComputePassCount = 0;
 	GRDGStatPassDependencyCount = 0;
 	GRDGStatTextureCount = 0;
 	GRDGStatTextureReferenceCount = 0;
@@ -464,6 +468,67 @@ ERDGPassFlags FRDGBuilder::OverridePassFlags(const TCHAR* PassName, ERDGPassFlag
 	return PassFlags;
 }
 
+ERDGPassFlags FRDGBuilder::ScheduleAsyncComputePass(FRDGParameterStruct PassParameters, ERDGPassFlags PassFlags, bool bAsyncComputeSupported) const
+{
+	if (GRDGAsyncCompute != RDG_ASYNC_COMPUTE_AUTO || !bAsyncComputeSupported || !IsAsyncComputeSupported() || !EnumHasAnyFlags(PassFlags, ERDGPassFlags::Compute))
+	{
+		return PassFlags;
+	}
+
+	const FRDGPass* PrevPass = Passes[Passes.Last()];
+
+	// A pass consuming the outputs of the graphics pass right before it would wait on it immediately, leaving nothing to overlap
+	// with but the cost of the fork and join. Passes following another async compute pass extend its interval instead.
+	if (PrevPass->GetPipeline() == ERHIPipeline::Graphics && !PrevPass->bEmptyParameters)
+	{
+		TArray<const FRDGViewableResource*, TInlineAllocator<16, FRDGArrayAllocator>> PrevPassOutputs;
+
+		EnumerateTextureAccess(PrevPass->GetParameters(), PrevPass->GetFlags(), [&](FRDGViewRef, FRDGTextureRef Texture, ERHIAccess Access, ERDGTextureAccessFlags, FRDGTextureSubresourceRange)
+		{
+			if (IsWritableAccess(Access))
+			{
+				PrevPassOutputs.AddUnique(Texture);
+			}
+		});
+
+		EnumerateBufferAccess(PrevPass->GetParameters(), PrevPass->GetFlags(), [&](FRDGViewRef, FRDGBufferRef Buffer, ERHIAccess Access)
+		{
+			if (IsWritableAccess(Access))
+			{
+				PrevPassOutputs.AddUnique(Buffer);
+			}
+		});
+
+		if (PrevPassOutputs.Num())
+		{
+			bool bDependsOnPrevPass = false;
+
+			EnumerateTextureAccess(PassParameters, PassFlags, [&](FRDGViewRef, FRDGTextureRef Texture, ERHIAccess, ERDGTextureAccessFlags, FRDGTextureSubresourceRange)
+			{
+				bDependsOnPrevPass |= PrevPassOutputs.Contains(Texture);
+			});
+
+			EnumerateBufferAccess(PassParameters, PassFlags, [&](FRDGViewRef, FRDGBufferRef Buffer, ERHIAccess)
+			{
+				bDependsOnPrevPass |= PrevPassOutputs.Contains(Buffer);
+			});
+
+			if (bDependsOnPrevPass)
+			{
+				return PassFlags;
+			}
+		}
+	}
+
+#if STATS
+	GRDGStatAutoAsyncComputePassCount++;
+#endif
+
+	PassFlags &= ~ERDGPassFlags::Compute;
+	PassFlags |= ERDGPassFlags::AsyncCompute;
+	return PassFlags;
+}
+
 bool FRDGBuilder::IsTransient(FRDGBufferRef Buffer) const
 {
 	if (!IsTransientInternal(Buffer, EnumHasAnyFlags(Buffer->Desc.Usage, BUF_FastVRAM)))
@@ -1739,6 +1804,7 @@ void FRDGBuilder::Execute()
 				if (!Pass->bCulled)
 				{
 					BeginResourcesRHI(Pass, PassHandle);
+					IF_RDG_ENABLE_TRACE(Pass->TraceTransientLiveBytes = TransientLiveBytes);
 					EndResourcesRHI(Pass, PassHandle);
 				}
 			}
@@ -1874,7 +1940,7 @@ void FRDGBuilder::Execute()
 						while (!FPlatformAtomics::AtomicRead(&ParallelPassSet.bInitialized)) {};
 
 						check(ParallelPassSet.CmdList != nullptr);
-						RHICmdList.QueueAsyncCommandListSubmit(MakeArrayView<FRHICommandListImmediate::FQueuedCommandList>(&ParallelPassSet, 1));
+						RHICmdList.QueueAsyncCommandListSubmit(MakeArrayView<FRHICommandListImmediate::FQueuedCommandList>(&ParallelPassSet, 1), GetParallelTranslatePriority());
 
 						IF_RHI_WANT_BREADCRUMB_EVENTS(RHICmdList.ImportBreadcrumbState(*ParallelPassSet.BreadcrumbStateEnd));
 
@@ -2639,6 +2705,16 @@ void FRDGBuilder::SetupParallelExecute()
 #endif
 }
 
+FRHICommandListImmediate::ETranslatePriority FRDGBuilder::GetParallelTranslatePriority()
+{
+	if (GRDGParallelTranslate <= 0 || GRDGDebugFlushGPU)
+	{
+		return FRHICommandListImmediate::ETranslatePriority::Disabled;
+	}
+
+	return GRDGParallelTranslate > 1 ? FRHICommandListImmediate::ETranslatePriority::High : FRHICommandListImmediate::ETranslatePriority::Normal;
+}
+
 void FRDGBuilder::DispatchParallelExecute()
 {
 	SCOPED_NAMED_EVENT(DispatchParallelExecute, FColor::Emerald);
@@ -2845,6 +2921,18 @@ void FRDGBuilder::ExecutePass(FRDGPass* Pass, FRHIComputeCommandList& RHICmdList
 
 		Pass->GPUScopeOpsPrologue.Execute(RHICmdListPass);
 
+#if CPUPROFILERTRACE_ENABLED
+		// Scopes the replay of the commands of the pass, so the translation time of each pass shows up in Insights on the thread translating it.
+		const bool bTraceTranslate = Pass->bParallelExecute && UE_TRACE_CHANNELEXPR_IS_ENABLED(CpuChannel);
+		if (bTraceTranslate)
+		{
+			RHICmdListPass.EnqueueLambda([PassName = FName(Pass->GetName())](FRHICommandListBase&)
+			{
+				FCpuProfilerTrace::OutputBeginDynamicEvent(PassName);
+			});
+		}
+#endif
+
 		ExecutePassPrologue(RHICmdListPass, Pass);
 
 #if RDG_DUMP_RESOURCES_AT_EACH_DRAW
@@ -2859,6 +2947,16 @@ void FRDGBuilder::ExecutePass(FRDGPass* Pass, FRHIComputeCommandList& RHICmdList
 
 		ExecutePassEpilogue(RHICmdListPass, Pass);
 
+#if CPUPROFILERTRACE_ENABLED
+		if (bTraceTranslate)
+		{
+			RHICmdListPass.EnqueueLambda([](FRHICommandListBase&)
+			{
+				FCpuProfilerTrace::OutputEndEvent();
+			});
+		}
+#endif
+
 		Pass->GPUScopeOpsEpilogue.Execute(RHICmdListPass);
 	}
 
@@ -2884,6 +2982,11 @@ void FRDGBuilder::ExecutePass(FRDGPass* Pass, FRHIComputeCommandList& RHICmdList
 
 void FRDGBuilder::BeginResourcesRHI(FRDGPass* ResourcePass, FRDGPassHandle ExecutePassHandle)
 {
+	if (GRDGTransientAllocatorLifetimeOrder && TransientResourceAllocator)
+	{
+		BeginTransientResourcesByLifetime(ResourcePass, ExecutePassHandle);
+	}
+
 	for (FRDGPass* PassToBegin : ResourcePass->ResourcesToBegin)
 	{
 		for (const auto& PassState : PassToBegin->TextureStates)
@@ -2912,6 +3015,68 @@ void FRDGBuilder::BeginResourcesRHI(FRDGPass* ResourcePass, FRDGPassHandle Execu
 	}
 }
 
+void FRDGBuilder::BeginTransientResourcesByLifetime(FRDGPass* ResourcePass, FRDGPassHandle ExecutePassHandle)
+{
+	struct FTransientResource
+	{
+		FRDGViewableResource* Resource;
+		FRDGPassHandle LastPass;
+	};
+
+	TArray<FTransientResource, FRDGArrayAllocator> TransientResources;
+
+	const FRDGPassHandle EpiloguePassHandle = GetEpiloguePassHandle();
+
+	const auto AddTransientResource = [&](FRDGViewableResource* Resource)
+	{
+		// Extracted resources outlive the graph.
+		TransientResources.Add({ Resource, Resource->bExtracted ? EpiloguePassHandle : Resource->LastPass });
+	};
+
+	for (FRDGPass* PassToBegin : ResourcePass->ResourcesToBegin)
+	{
+		for (const auto& PassState : PassToBegin->TextureStates)
+		{
+			if (!PassState.Texture->HasRHI() && IsTransient(PassState.Texture))
+			{
+				AddTransientResource(PassState.Texture);
+			}
+		}
+
+		for (const auto& PassState : PassToBegin->BufferStates)
+		{
+			if (!PassState.Buffer->HasRHI() && IsTransient(PassState.Buffer))
+			{
+				AddTransientResource(PassState.Buffer);
+			}
+		}
+	}
+
+	if (TransientResources.Num() < 2)
+	{
+		return;
+	}
+
+	// All of them are allocated now, so the resource used the latest lives the longest.
+	Algo::StableSort(TransientResources, [](const FTransientResource& Lhs, const FTransientResource& Rhs)
+	{
+		return Lhs.LastPass.GetIndex() > Rhs.LastPass.GetIndex();
+	});
+
+	// Resources referenced by several passes of a merged render pass are listed more than once, BeginResourceRHI skips the copies.
+	for (const FTransientResource& TransientResource : TransientResources)
+	{
+		if (TransientResource.Resource->Type == ERDGViewableResourceType::Texture)
+		{
+			BeginResourceRHI(ExecutePassHandle, static_cast<FRDGTextureRef>(TransientResource.Resource));
+		}
+		else
+		{
+			BeginResourceRHI(ExecutePassHandle, static_cast<FRDGBufferRef>(TransientResource.Resource));
+		}
+	}
+}
+
 void FRDGBuilder::EndResourcesRHI(FRDGPass* ResourcePass, FRDGPassHandle ExecutePassHandle)
 {
 	for (FRDGPass* PassToEnd : ResourcePass->ResourcesToEnd)
@@ -3522,6 +3687,7 @@ void FRDGBuilder::BeginResourceRHI(FRDGPassHandle PassHandle, FRDGTextureRef Tex
 			else
 			{
 				SetRHI(Texture, TransientTexture, PassHandle);
+				TransientLiveBytes += TransientTexture->GetSize();
 			}
 
 			const FRDGPassHandle MinAcquirePassHandle(TransientTexture->GetAcquirePasses().Min);
@@ -3613,6 +3779,8 @@ void FRDGBuilder::BeginResourceRHI(FRDGPassHandle PassHandle, FRDGBufferRef Buff
 
 			AddAliasingTransition(MinAcquirePassHandle, PassHandle, Buffer, FRHITransientAliasingInfo::Acquire(TransientBuffer->GetRHI(), TransientBuffer->GetAliasingOverlaps()));
 
+			TransientLiveBytes += TransientBuffer->GetSize();
+
 			FRDGSubresourceState* InitialState = Buffer->State;
 			InitialState->SetPass(ERHIPipeline::Graphics, MinAcquirePassHandle);
 			InitialState->Access = ERHIAccess::Discard;
@@ -3731,6 +3899,7 @@ void FRDGBuilder::EndResourceRHI(FRDGPassHandle PassHandle, FRDGTextureRef Textu
 			// Texture is using an internal transient texture.
 			else
 			{
+				TransientLiveBytes -= Texture->TransientTexture->GetSize();
 				TransientResourceAllocator->DeallocateMemory(Texture->TransientTexture, PassHandle.GetIndex());
 			}
 		}
@@ -3760,6 +3929,7 @@ void FRDGBuilder::EndResourceRHI(FRDGPassHandle PassHandle, FRDGBufferRef Buffer
 	{
 		if (Buffer->bTransient)
 		{
+			TransientLiveBytes -= Buffer->TransientBuffer->GetSize();
 			TransientResourceAllocator->DeallocateMemory(Buffer->TransientBuffer, PassHandle.GetIndex());
 		}
 		else
@@ -279,7 +279,9 @@ TAutoConsoleVariable<int32> CVarRDGAsyncCompute(
 	TEXT("Controls the async compute policy.\n")
 	TEXT(" 0:disabled, no async compute is used;\n")
 	TEXT(" 1:enabled for passes tagged for async compute (default);\n")
-	TEXT(" 2:enabled for all compute passes implemented to use the compute command list;\n"),
+	TEXT(" 2:enabled for all compute passes implemented to use the compute command list;\n")
+	TEXT(" 3:enabled for passes tagged for async compute, and for compute passes implemented to use the compute command list\n")
+	TEXT("   which don't depend on the graphics pass added right before them, so they can overlap with graphics work;\n"),
 	ECVF_RenderThreadSafe);
 
 FAutoConsoleVariableSink CVarRDGAsyncComputeSink(FConsoleCommandDelegate::CreateLambda([]()
@@ -373,6 +375,16 @@ FAutoConsoleVariableRef CVarRDGParallelExecutePassMax(
 	TEXT("The maximum span of contiguous passes eligible for parallel execution for the span to be offloaded to a task."),
 	ECVF_RenderThreadSafe);
 
+int32 GRDGParallelTranslate = 1;
+FAutoConsoleVariableRef CVarRDGParallelTranslate(
+	TEXT("r.RDG.ParallelTranslate"), GRDGParallelTranslate,
+	TEXT("Whether the command lists of passes executed in parallel are also translated to platform command lists on task threads, when the RHI supports it.")
+	TEXT(" The translated command lists are still submitted in pass order by the RHI thread.")
+	TEXT(" 0: off, the RHI thread replays them;")
+	TEXT(" 1: on, normal priority tasks (default);")
+	TEXT(" 2: on, high priority tasks;"),
+	ECVF_RenderThreadSafe);
+
 int32 GRDGParallelExecuteStress = 0;
 FAutoConsoleVariableRef CVarRDGDebugParallelExecute(
 	TEXT("r.RDG.ParallelExecuteStress"),
@@ -419,6 +431,14 @@ FAutoConsoleVariableRef CVarRDGIndirectArgBufferTransientAllocated(
 	TEXT("Whether indirect argument buffers should use transient resource allocator. Default: 0"),
 	ECVF_RenderThreadSafe);
 
+int32 GRDGTransientAllocatorLifetimeOrder = 0;
+FAutoConsoleVariableRef CVarRDGTransientAllocatorLifetimeOrder(
+	TEXT("r.RDG.TransientAllocator.LifetimeOrder"), GRDGTransientAllocatorLifetimeOrder,
+	TEXT("Allocates the transient resources first used by a pass from the longest to the shortest lived, instead of in parameter order.\n")
+	TEXT("Long lived resources then take the start of the heaps and short lived ones free up contiguous ranges behind them, which lowers peak memory with fragmented graphs.\n")
+	TEXT("Combine with RHI.TransientAllocator.BestFit for the lowest peak. Default: 0"),
+	ECVF_RenderThreadSafe);
+
 #if CSV_PROFILER
 int32 GRDGVerboseCSVStats = 0;
 FAutoConsoleVariableRef CVarRDGVerboseCSVStats(
@@ -436,6 +456,7 @@ int32 GRDGStatPassWithParameterCount = 0;
 int32 GRDGStatPassCullCount = 0;
 int32 GRDGStatPassDependencyCount = 0;
 int32 GRDGStatRenderPassMergeCount = 0;
+int32 GRDGStatAutoAsyncComputePassCount = 0;
 int32 GRDGStatTextureCount = 0;
 int32 GRDGStatTextureReferenceCount = 0;
 int32 GRDGStatBufferCount = 0;
@@ -452,6 +473,7 @@ DEFINE_STAT(STAT_RDG_PassCount);
 DEFINE_STAT(STAT_RDG_PassWithParameterCount);
 DEFINE_STAT(STAT_RDG_PassCullCount);
 DEFINE_STAT(STAT_RDG_RenderPassMergeCount);
+DEFINE_STAT(STAT_RDG_AutoAsyncComputePassCount);
 DEFINE_STAT(STAT_RDG_PassDependencyCount);
 DEFINE_STAT(STAT_RDG_TextureCount);
 DEFINE_STAT(STAT_RDG_TextureReferenceCount);
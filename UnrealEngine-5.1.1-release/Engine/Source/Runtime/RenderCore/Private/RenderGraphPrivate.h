@@ -15,6 +15,7 @@ DEFINE_LOG_CATEGORY_STATIC(LogRDG, Log, All);
 #define RDG_ASYNC_COMPUTE_DISABLED 0
 #define RDG_ASYNC_COMPUTE_ENABLED 1
 #define RDG_ASYNC_COMPUTE_FORCE_ENABLED 2
+#define RDG_ASYNC_COMPUTE_AUTO 3
 
 #define RDG_BREAKPOINT_WARNINGS 1
 #define RDG_BREAKPOINT_PASS_COMPILE 2
@@ -115,6 +116,7 @@ extern int32 GRDGMergeRenderPasses;
 extern int32 GRDGTransientAllocator;
 extern int32 GRDGTransientExtractedResources;
 extern int32 GRDGTransientIndirectArgBuffers;
+extern int32 GRDGTransientAllocatorLifetimeOrder;
 
 #if RDG_ENABLE_PARALLEL_TASKS
 
@@ -122,6 +124,7 @@ extern int32 GRDGParallelSetup;
 extern int32 GRDGParallelExecute;
 extern int32 GRDGParallelExecutePassMin;
 extern int32 GRDGParallelExecutePassMax;
+extern int32 GRDGParallelTranslate;
 
 #else
 
@@ -129,6 +132,7 @@ const int32 GRDGParallelSetup = 0;
 const int32 GRDGParallelExecute = 0;
 const int32 GRDGParallelExecutePassMin = 0;
 const int32 GRDGParallelExecutePassMax = 0;
+const int32 GRDGParallelTranslate = 0;
 
 #endif
 
@@ -142,6 +146,7 @@ const int32 GRDGVerboseCSVStats = 0;
 extern int32 GRDGStatPassCount;
 extern int32 GRDGStatPassCullCount;
 extern int32 GRDGStatRenderPassMergeCount;
+extern int32 GRDGStatAutoAsyncComputePassCount;
 extern int32 GRDGStatPassDependencyCount;
 extern int32 GRDGStatTextureCount;
 extern int32 GRDGStatTextureReferenceCount;
@@ -159,6 +164,7 @@ DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Passes"), STAT_RDG_PassCount, STATGROUP_
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Passes With Parameters"), STAT_RDG_PassWithParameterCount, STATGROUP_RDG, RENDERCORE_API);
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Passes Culled"), STAT_RDG_PassCullCount, STATGROUP_RDG, RENDERCORE_API);
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Render Passes Merged"), STAT_RDG_RenderPassMergeCount, STATGROUP_RDG, RENDERCORE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Passes Moved To Async Compute"), STAT_RDG_AutoAsyncComputePassCount, STATGROUP_RDG, RENDERCORE_API);
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Pass Dependencies"), STAT_RDG_PassDependencyCount, STATGROUP_RDG, RENDERCORE_API);
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Textures"), STAT_RDG_TextureCount, STATGROUP_RDG, RENDERCORE_API);
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Texture References"), STAT_RDG_TextureReferenceCount, STATGROUP_RDG, RENDERCORE_API);
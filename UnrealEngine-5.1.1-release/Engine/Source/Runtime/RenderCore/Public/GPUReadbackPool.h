@@ -0,0 +1,113 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	GPUReadbackPool.h: Pooled asynchronous GPU readbacks delivered to callbacks.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RenderResource.h"
+#include "RenderGraphDefinitions.h"
+#include "RHIGPUReadback.h"
+#include "Stats/Stats.h"
+#include <atomic>
+
+DECLARE_STATS_GROUP(TEXT("GPU Readback Pool"), STATGROUP_GPUReadbackPool, STATCAT_Advanced);
+
+/** Thread the callback of a readback is called on */
+enum class EGPUReadbackThread : uint8
+{
+	/** Called from FGPUReadbackPool::Poll, at the end of the render thread frame */
+	RenderThread,
+	GameThread,
+	/** Called from a background task */
+	AnyThread,
+};
+
+struct FGPUReadbackResult
+{
+	FName Name;
+
+	/** Copy of the read back data. Texture rows are tightly packed. */
+	TArray<uint8> Data;
+
+	/** Size of the copied rect and format of texture readbacks */
+	FIntPoint Extent = FIntPoint::ZeroValue;
+	EPixelFormat Format = PF_Unknown;
+
+	/** Render thread frames between the readback being enqueued and delivered */
+	uint32 LatencyFrames = 0;
+};
+
+using FOnGPUReadbackReady = TUniqueFunction<void(FGPUReadbackResult&& Result)>;
+
+/**
+ * Shared pool of staging buffers and textures for asynchronous readbacks, in place of each system managing its own FRHIGPUBufferReadback.
+ * Pending readbacks are polled at the end of every render thread frame and their staging memory is only locked once the GPU fence
+ * passed, so polling never waits on the GPU. The data is copied out to recycle the staging memory right away, then handed to the callback
+ * on the requested thread. Staging buffers are recycled by power of two size and staging textures by size and format, and are released after
+ * being unused for r.GPUReadbackPool.ReleaseUnusedFrames frames.
+ */
+class RENDERCORE_API FGPUReadbackPool : public FRenderResource
+{
+public:
+
+	/** Reads back the first NumBytes of the buffer, or the whole buffer if 0. Render thread only. */
+	void EnqueueReadback(FRDGBuilder& GraphBuilder, FRDGBufferRef Buffer, uint32 NumBytes, EGPUReadbackThread CallbackThread, FOnGPUReadbackReady&& OnReady);
+
+	/** Reads back a rect of a 2D texture, or the whole texture if the rect is empty. Render thread only. */
+	void EnqueueReadback(FRDGBuilder& GraphBuilder, FRDGTextureRef Texture, FIntRect Rect, EGPUReadbackThread CallbackThread, FOnGPUReadbackReady&& OnReady);
+
+	/** Delivers the readbacks whose copy completed on the GPU. Called at the end of the render thread frame, can be called earlier. */
+	void Poll();
+
+	/** Waits for every pending readback and delivers them. Stalls the render thread, meant for shutdown and captures. */
+	void Flush(FRHICommandListImmediate& RHICmdList);
+
+	int32 GetNumPending() const { return PendingReadbacks.Num(); }
+
+	// FRenderResource interface
+	virtual void InitRHI() override;
+	virtual void ReleaseRHI() override;
+
+private:
+
+	struct FPooledReadback
+	{
+		TUniquePtr<FRHIGPUMemoryReadback> Readback;
+
+		/** Size bucket of buffers, size and format of textures */
+		uint64 Key = 0;
+		bool bIsTexture = false;
+		uint32 LastUsedFrame = 0;
+
+		/** Set by the RDG pass once the copy is recorded, as the fence of a recycled readback still holds its previous state until then */
+		std::atomic<bool> bCopyEnqueued{ false };
+	};
+
+	struct FPendingReadback
+	{
+		TUniquePtr<FPooledReadback> Pooled;
+		FName Name;
+		FIntRect Rect;
+		EPixelFormat Format = PF_Unknown;
+		uint32 NumBytes = 0;
+		uint32 EnqueueFrame = 0;
+		EGPUReadbackThread CallbackThread = EGPUReadbackThread::RenderThread;
+		FOnGPUReadbackReady OnReady;
+	};
+
+	TUniquePtr<FPooledReadback> AllocateReadback(uint64 Key, bool bIsTexture);
+	void Deliver(FPendingReadback& PendingReadback);
+	void ReleaseUnusedReadbacks();
+	void UpdateStats();
+
+	/** In enqueue order */
+	TArray<FPendingReadback> PendingReadbacks;
+	TArray<TUniquePtr<FPooledReadback>> FreeReadbacks;
+
+	FDelegateHandle EndFrameHandle;
+};
+
+extern RENDERCORE_API TGlobalResource<FGPUReadbackPool> GGPUReadbackPool;
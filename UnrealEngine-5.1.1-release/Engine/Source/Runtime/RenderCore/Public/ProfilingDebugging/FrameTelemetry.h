@@ -0,0 +1,102 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+/**
+*
+* Low overhead frame timing telemetry, available in shipping builds.
+* The render thread records one compact sample per frame in a fixed size ring buffer: frame time, game, render and RHI thread
+* times, GPU time from the RHI timestamp queries, draw calls and the most expensive GPU stat scopes of the frame.
+* When a frame goes over the hitch threshold the ring buffer is written to a csv file and broadcast to OnHitch, which an
+* analytics provider can bind to.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
+#include "Delegates/Delegate.h"
+#include "UObject/NameTypes.h"
+
+#ifndef WITH_FRAME_TELEMETRY
+#define WITH_FRAME_TELEMETRY WITH_ENGINE
+#endif
+
+// GPU stat scopes are compiled out of shipping builds. Setting this to 1 keeps them in shipping so the telemetry can report the most expensive ones,
+// for the cost of the timestamp queries of every scope while r.FrameTelemetry is enabled.
+#ifndef FRAME_TELEMETRY_GPU_STATS_IN_SHIPPING
+#define FRAME_TELEMETRY_GPU_STATS_IN_SHIPPING 0
+#endif
+
+#if WITH_FRAME_TELEMETRY
+
+struct FFrameTelemetryPass
+{
+	FName Name;
+	float GPUTimeMs = 0.0f;
+};
+
+struct FFrameTelemetrySample
+{
+	static constexpr int32 MaxPasses = 8;
+
+	uint32 FrameNumber = 0;
+	float FrameTimeMs = 0.0f;
+	float GameThreadTimeMs = 0.0f;
+	float RenderThreadTimeMs = 0.0f;
+	float RHIThreadTimeMs = 0.0f;
+	float GPUTimeMs = 0.0f;
+	int32 NumDrawCalls = 0;
+	int32 NumPrimitivesDrawn = 0;
+
+	/** Most expensive GPU stat scopes, by exclusive time. Filled a few frames after the sample is recorded, once the GPU timestamps are read back. */
+	int32 NumPasses = 0;
+	FFrameTelemetryPass Passes[MaxPasses];
+};
+
+/** Broadcast on the render thread with the sample of the hitch and the recorded samples, oldest first */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnFrameTelemetryHitch, const FFrameTelemetrySample& /*HitchSample*/, TConstArrayView<FFrameTelemetrySample> /*Samples*/);
+
+class FFrameTelemetry
+{
+public:
+
+	static RENDERCORE_API FFrameTelemetry& Get();
+
+	/** Hooks the end of the render thread frame, called once at startup */
+	RENDERCORE_API void Init();
+
+	/** Returns true if samples are recorded, see r.FrameTelemetry */
+	static RENDERCORE_API bool IsEnabled();
+
+	/** Called on the render thread by the realtime GPU profiler with the exclusive time of each GPU stat of a frame, once it is read back */
+	void SetGPUPassTimes(uint32 FrameNumber, const TMap<FName, float>& PassTimesMs);
+
+	/** Copies the recorded samples, oldest first. Render thread only. */
+	RENDERCORE_API void GetSamples(TArray<FFrameTelemetrySample>& OutSamples) const;
+
+	/** Writes the recorded samples to Saved/Profiling/FrameTelemetry from a background task. Render thread only. */
+	RENDERCORE_API void Dump(const FString& Reason);
+
+	FOnFrameTelemetryHitch OnHitch;
+
+private:
+
+	void EndFrameRT();
+	FFrameTelemetrySample* FindSample(uint32 FrameNumber);
+	void DumpHitch();
+
+	/** Fixed size ring buffer */
+	TArray<FFrameTelemetrySample> Samples;
+	int32 NextSampleIndex = 0;
+	int32 NumSamples = 0;
+
+	uint64 LastEndFrameCycles = 0;
+	double LastDumpTime = 0.0;
+
+	/** Frame of the last hitch and frames left before it is dumped, waiting for its GPU stats to be read back */
+	uint32 HitchFrameNumber = 0;
+	int32 FramesUntilHitchDump = -1;
+
+	bool bInitialized = false;
+};
+
+#endif //WITH_FRAME_TELEMETRY
@@ -20,6 +20,7 @@
 #include "HAL/CriticalSection.h"
 #include "MultiGPU.h"
 #include "ProfilingDebugging/CsvProfiler.h"
+#include "ProfilingDebugging/FrameTelemetry.h"
 #include "ProfilingDebugging/CsvProfilerConfig.h"
 #include "RHI.h"
 #include "RHICommandList.h"
@@ -271,6 +272,8 @@ struct RENDERCORE_API FBreadcrumbEvent
 #ifndef HAS_GPU_STATS
 	#if ( STATS || CSV_PROFILER || GPUPROFILERTRACE_ENABLED ) && (!UE_BUILD_SHIPPING)
 	#define HAS_GPU_STATS 1
+	#elif WITH_FRAME_TELEMETRY && FRAME_TELEMETRY_GPU_STATS_IN_SHIPPING
+	#define HAS_GPU_STATS 1
 	#else
 	#define HAS_GPU_STATS 0
 	#endif
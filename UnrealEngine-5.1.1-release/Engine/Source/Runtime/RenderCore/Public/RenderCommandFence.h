@@ -33,6 +33,12 @@ public:
 	// return true if the fence is complete
 	bool IsFenceComplete() const;
 
+	// return the graph event that is completed once the fence retired, null if there is no pending fence
+	FGraphEventRef GetCompletionEvent() const
+	{
+		return CompletionEvent;
+	}
+
 private:
 	/** Graph event that represents completion of this fence **/
 	mutable FGraphEventRef CompletionEvent;
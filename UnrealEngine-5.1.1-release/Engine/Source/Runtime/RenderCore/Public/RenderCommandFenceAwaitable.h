@@ -0,0 +1,28 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RenderCommandFence.h"
+#include "Experimental/Coroutine/CoroAwaitables.h"
+
+#if WITH_CPP_COROUTINES
+
+/**
+ * Suspends a Coroutine until the rendering thread retired the fence, e.g.
+ *	Fence.BeginFence();
+ *	co_await Fence;
+ * only the completion event is captured, the fence may be reused once the Coroutine suspended.
+ */
+inline FCoroGraphEventAwaitable operator co_await(const FRenderCommandFence& Fence)
+{
+	return FCoroGraphEventAwaitable(Fence.GetCompletionEvent());
+}
+
+// same as above but continues on the given thread or worker priority, e.g. co_await CoroAwaitFence(Fence, FCoroResumeOn::Thread(ENamedThreads::GameThread));
+inline FCoroGraphEventAwaitable CoroAwaitFence(const FRenderCommandFence& Fence, FCoroResumeOn ResumeOn)
+{
+	return FCoroGraphEventAwaitable(Fence.GetCompletionEvent(), ResumeOn);
+}
+
+#endif
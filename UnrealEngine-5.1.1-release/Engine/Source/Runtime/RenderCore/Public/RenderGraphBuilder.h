@@ -470,6 +470,9 @@ private:
 
 	static ERDGPassFlags OverridePassFlags(const TCHAR* PassName, ERDGPassFlags Flags, bool bAsyncComputeSupported);
 
+	/** Moves a compute pass to async compute when r.RDG.AsyncCompute is 3 and it doesn't depend on the previous graphics pass. */
+	ERDGPassFlags ScheduleAsyncComputePass(FRDGParameterStruct PassParameters, ERDGPassFlags Flags, bool bAsyncComputeSupported) const;
+
 	void AddProloguePass();
 
 	FORCEINLINE FRDGPass* GetProloguePass() const
@@ -779,6 +782,9 @@ private:
 #endif
 
 	uint32 AsyncComputePassCount = 0;
+
+	/** Bytes of memory currently allocated from the transient allocator by the graph, excluding textures converted to external or extracted. */
+	uint64 TransientLiveBytes = 0;
 	uint32 RasterPassCount = 0;
 
 	IF_RDG_CMDLIST_STATS(TStatId CommandListStatScope);
@@ -798,6 +804,7 @@ private:
 	void SetRHI(FRDGBuffer* Buffer, FRHITransientBuffer* TransientBuffer, FRDGPassHandle PassHandle);
 
 	void BeginResourcesRHI(FRDGPass* ResourcePass, FRDGPassHandle ExecutePassHandle);
+	void BeginTransientResourcesByLifetime(FRDGPass* ResourcePass, FRDGPassHandle ExecutePassHandle);
 	void BeginResourceRHI(FRDGPassHandle, FRDGTexture* Texture);
 	void BeginResourceRHI(FRDGPassHandle, FRDGBuffer* Buffer);
 
@@ -813,6 +820,7 @@ private:
 
 	void SetupParallelExecute();
 	void DispatchParallelExecute();
+	static FRHICommandListImmediate::ETranslatePriority GetParallelTranslatePriority();
 
 	void PrepareBufferUploads();
 	UE::Tasks::FTask SubmitBufferUploads();
@@ -256,11 +256,16 @@ FRDGPassRef FRDGBuilder::AddPassInternal(
 
 	FlushAccessModeQueue();
 
+	const ERDGPassFlags OverriddenFlags = ScheduleAsyncComputePass(
+		FRDGParameterStruct(ParameterStruct, ParametersMetadata),
+		OverridePassFlags(Name.GetTCHAR(), Flags, LambdaPassType::kSupportsAsyncCompute),
+		LambdaPassType::kSupportsAsyncCompute);
+
 	FRDGPass* Pass = Allocator.AllocNoDestruct<LambdaPassType>(
 		MoveTemp(Name),
 		ParametersMetadata,
 		ParameterStruct,
-		OverridePassFlags(Name.GetTCHAR(), Flags, LambdaPassType::kSupportsAsyncCompute),
+		OverriddenFlags,
 		MoveTemp(ExecuteLambda));
 
 	IF_RDG_ENABLE_DEBUG(ClobberPassOutputs(Pass));
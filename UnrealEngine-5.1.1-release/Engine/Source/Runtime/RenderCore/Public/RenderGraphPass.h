@@ -538,6 +538,9 @@ protected:
 #if RDG_ENABLE_TRACE
 	TArray<FRDGTextureHandle, FRDGArrayAllocator> TraceTextures;
 	TArray<FRDGBufferHandle, FRDGArrayAllocator> TraceBuffers;
+
+	/** Bytes of transient memory allocated to resources which are live while the pass executes. */
+	uint64 TraceTransientLiveBytes = 0;
 #endif
 
 	friend FRDGBuilder;
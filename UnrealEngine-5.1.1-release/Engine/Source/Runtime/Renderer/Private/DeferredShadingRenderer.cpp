@@ -2226,6 +2226,11 @@ void FDeferredShadingSceneRenderer::Render(FRDGBuilder& GraphBuilder)
 		bUpdateNaniteStreaming =  !ViewFamily.bIsMultipleViewFamily || ViewFamily.bIsFirstViewInMultipleViewFamily;
 		if (bUpdateNaniteStreaming)
 		{
+			if (Views.Num() > 0)
+			{
+				Nanite::AddPredictedStreamingRequests(*Scene, Views[0], ViewFamily.Time.GetDeltaWorldTimeSeconds(), NaniteStreamingPredictionOrigins);
+			}
+
 			Nanite::GStreamingManager.BeginAsyncUpdate(GraphBuilder);
 		}
 
@@ -2502,7 +2507,7 @@ void FDeferredShadingSceneRenderer::Render(FRDGBuilder& GraphBuilder)
 			GraphBuilder.SetFlushResourcesRHI();
 		}
 
-		Scene->GPUScene.Update(GraphBuilder, *Scene, ExternalAccessQueue);
+		Scene->GPUScene.Update(GraphBuilder, *Scene, ExternalAccessQueue, Views);
 
 		for (int32 ViewIndex = 0; ViewIndex < Views.Num(); ViewIndex++)
 		{
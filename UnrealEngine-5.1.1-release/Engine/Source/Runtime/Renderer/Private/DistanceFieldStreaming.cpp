@@ -8,6 +8,7 @@
 #include "Stats/Stats.h"
 #include "HAL/IConsoleManager.h"
 #include "Async/ParallelFor.h"
+#include "Misc/App.h"
 #include "RHI.h"
 #include "RenderResource.h"
 #include "ShaderParameters.h"
@@ -96,6 +97,22 @@ static FAutoConsoleVariableRef CVarDistanceFieldBlockAllocatorSizeInBricks(
 	TEXT("Allocation granularity of the distance field block allocator. Higher number may cause more memory wasted on padding but allocation may be faster."),
 	ECVF_RenderThreadSafe | ECVF_ReadOnly);
 
+static int32 GDistanceFieldParallelBrickUpload = 1;
+static FAutoConsoleVariableRef CVarDistanceFieldParallelBrickUpload(
+	TEXT("r.DistanceFields.ParallelBrickUpload"),
+	GDistanceFieldParallelBrickUpload,
+	TEXT("Whether the bricks and indirection entries of completed mesh SDF read requests are written to the upload buffers from parallel tasks."),
+	ECVF_RenderThreadSafe
+);
+
+static float GDistanceFieldStreamingPredictionTime = 0.5f;
+static FAutoConsoleVariableRef CVarDistanceFieldStreamingPredictionTime(
+	TEXT("r.DistanceFields.StreamingPredictionTime"),
+	GDistanceFieldStreamingPredictionTime,
+	TEXT("Mesh SDF mips are also requested around where the camera will be in this many seconds at its current velocity, so they are resident by the time Lumen and DFAO trace them. 0 disables prediction."),
+	ECVF_RenderThreadSafe
+);
+
 static const int32 MaxStreamingRequests = 4095;
 static const float IndirectionAtlasGrowMult = 2.0f;
 
@@ -461,26 +478,72 @@ void FDistanceFieldSceneData::AsyncUpdate(FDistanceFieldAsyncUpdateParameters Up
 	const FIntVector IndirectionTextureSize = IndirectionAtlas ? IndirectionAtlas->GetDesc().GetSize() : FIntVector::ZeroValue;
 	const float InvMaxIndirectionDimensionMinusOne = 1.f / (DistanceField::MaxIndirectionDimension - 1);
 
+	// Where each request writes in the upload buffers. Assigned serially, the scatter upload buffer is not thread safe.
+	struct FRequestUpload
+	{
+		const uint8* BulkDataReadPtr = nullptr;
+		uint32* DestIndirectionTable = nullptr;
+		FVector4f* DestIndirection2Table = nullptr;
+		int32 BrickUploadIndex = 0;
+		int32 IndirectionUploadIndex = 0;
+	};
+
+	TArray<FRequestUpload, SceneRenderingAllocator> RequestUploads;
+	RequestUploads.SetNum(UpdateParameters.ReadRequestsToUpload.Num());
+
 	int32 BrickUploadIndex = 0;
 	int32 IndirectionUploadIndex = 0;
 
-	for (FDistanceFieldReadRequest ReadRequest : UpdateParameters.ReadRequestsToUpload)
+	for (int32 RequestIndex = 0; RequestIndex < UpdateParameters.ReadRequestsToUpload.Num(); RequestIndex++)
 	{
+		const FDistanceFieldReadRequest& ReadRequest = UpdateParameters.ReadRequestsToUpload[RequestIndex];
 		const FDistanceFieldAssetState& AssetState = AssetStateArray[ReadRequest.AssetSetId];
-		const int32 ReversedMipIndex = ReadRequest.ReversedMipIndex;
-		const FDistanceFieldAssetMipState& MipState = AssetState.ReversedMips[ReversedMipIndex];
-		const int32 MipIndex = AssetState.BuiltData->Mips.Num() - ReversedMipIndex - 1;
-		const FSparseDistanceFieldMip& MipBuiltData = AssetState.BuiltData->Mips[MipIndex];
+		const FDistanceFieldAssetMipState& MipState = AssetState.ReversedMips[ReadRequest.ReversedMipIndex];
+		const int32 NumIndirectionEntries = MipState.IndirectionDimensions.X * MipState.IndirectionDimensions.Y * MipState.IndirectionDimensions.Z;
 
-		const uint8* BulkDataReadPtr = ReadRequest.BulkData ? ReadRequest.ReadOutputDataPtr : ReadRequest.AlwaysLoadedDataPtr;
+		FRequestUpload& RequestUpload = RequestUploads[RequestIndex];
+		RequestUpload.BulkDataReadPtr = ReadRequest.BulkData ? ReadRequest.ReadOutputDataPtr : ReadRequest.AlwaysLoadedDataPtr;
 
 #if WITH_EDITOR
 		if (ReadRequest.BulkData)
 		{	
 			check((ReadRequest.BulkData->IsBulkDataLoaded() ||ReadRequest.BulkData->CanLoadFromDisk()) && ReadRequest.BulkData->GetBulkDataSize() > 0);
-			BulkDataReadPtr = (const uint8*)ReadRequest.BulkData->LockReadOnly() + ReadRequest.BulkOffset;
+			RequestUpload.BulkDataReadPtr = (const uint8*)ReadRequest.BulkData->LockReadOnly() + ReadRequest.BulkOffset;
 		}
 #endif
+
+		if (GDistanceFieldOffsetDataStructure == 0)
+		{
+			RequestUpload.DestIndirectionTable = (uint32*)IndirectionTableUploadBuffer.Add_GetRef(MipState.IndirectionTableOffset, NumIndirectionEntries);
+		}
+		else if (GDistanceFieldOffsetDataStructure == 1)
+		{
+			RequestUpload.DestIndirection2Table = (FVector4f*)IndirectionTableUploadBuffer.Add_GetRef(MipState.IndirectionTableOffset, NumIndirectionEntries);
+		}
+		else if (GDistanceFieldOffsetDataStructure == 2)
+		{
+			RequestUpload.IndirectionUploadIndex = IndirectionUploadIndex;
+			IndirectionUploadIndex += NumIndirectionEntries;
+		}
+
+		RequestUpload.BrickUploadIndex = BrickUploadIndex;
+		BrickUploadIndex += MipState.NumBricks;
+	}
+
+	// Mostly memory bound copies of every brick, spread over the task threads
+	const EParallelForFlags ParallelForFlags = GDistanceFieldParallelBrickUpload && FApp::ShouldUseThreadingForPerformance() ? EParallelForFlags::Unbalanced : EParallelForFlags::ForceSingleThread;
+
+	ParallelFor(TEXT("DistanceFieldBrickUpload"), UpdateParameters.ReadRequestsToUpload.Num(), 1, [&](int32 RequestIndex)
+	{
+		const FDistanceFieldReadRequest& ReadRequest = UpdateParameters.ReadRequestsToUpload[RequestIndex];
+		const FRequestUpload& RequestUpload = RequestUploads[RequestIndex];
+		const FDistanceFieldAssetState& AssetState = AssetStateArray[ReadRequest.AssetSetId];
+		const int32 ReversedMipIndex = ReadRequest.ReversedMipIndex;
+		const FDistanceFieldAssetMipState& MipState = AssetState.ReversedMips[ReversedMipIndex];
+		const int32 MipIndex = AssetState.BuiltData->Mips.Num() - ReversedMipIndex - 1;
+		const FSparseDistanceFieldMip& MipBuiltData = AssetState.BuiltData->Mips[MipIndex];
+
+		const uint8* BulkDataReadPtr = RequestUpload.BulkDataReadPtr;
 		const int32 NumIndirectionEntries = MipBuiltData.IndirectionDimensions.X * MipBuiltData.IndirectionDimensions.Y * MipBuiltData.IndirectionDimensions.Z;
 		const uint32 ExpectedBulkSize = NumIndirectionEntries * sizeof(uint32) + ReadRequest.NumDistanceFieldBricks * BrickSizeBytes;
 
@@ -496,16 +559,9 @@ void FDistanceFieldSceneData::AsyncUpdate(FDistanceFieldAsyncUpdateParameters Up
 		const uint32* SourceIndirectionTable = (const uint32*)BulkDataReadPtr;
 		const int32* RESTRICT GlobalBlockOffsets = MipState.AllocatedBlocks.GetData();
 
-		uint32* DestIndirectionTable = nullptr;
-		FVector4f* DestIndirection2Table = nullptr;
-		if (GDistanceFieldOffsetDataStructure == 0)
-		{
-			DestIndirectionTable = (uint32*)IndirectionTableUploadBuffer.Add_GetRef(MipState.IndirectionTableOffset, NumIndirectionEntries);
-		}
-		else if (GDistanceFieldOffsetDataStructure == 1)
-		{
-			DestIndirection2Table = (FVector4f*)IndirectionTableUploadBuffer.Add_GetRef(MipState.IndirectionTableOffset, NumIndirectionEntries);
-		}
+		uint32* DestIndirectionTable = RequestUpload.DestIndirectionTable;
+		FVector4f* DestIndirection2Table = RequestUpload.DestIndirection2Table;
+		int32 RequestIndirectionUploadIndex = RequestUpload.IndirectionUploadIndex;
 
 		// Add global allocated brick offset to indirection table entries as we upload them
 		for (int32 i = 0; i < NumIndirectionEntries; i++)
@@ -551,34 +607,35 @@ void FDistanceFieldSceneData::AsyncUpdate(FDistanceFieldAsyncUpdateParameters Up
 				const FIntVector IndirectionAtlasPosition = MipState.IndirectionAtlasOffset + IndirectionCoord;
 				const uint32 IndirectionIndex = IndirectionAtlasPosition.X + IndirectionTextureSize.X * (IndirectionAtlasPosition.Y + IndirectionTextureSize.Y * IndirectionAtlasPosition.Z);
 
-				UpdateParameters.IndirectionIndicesUploadPtr[IndirectionUploadIndex] = IndirectionIndex;
-				UpdateParameters.IndirectionDataUploadPtr[IndirectionUploadIndex] = BrickOffset;
+				UpdateParameters.IndirectionIndicesUploadPtr[RequestIndirectionUploadIndex] = IndirectionIndex;
+				UpdateParameters.IndirectionDataUploadPtr[RequestIndirectionUploadIndex] = BrickOffset;
 
-				++IndirectionUploadIndex;
+				++RequestIndirectionUploadIndex;
 			}
 		}
 
 		check(MipState.NumBricks == ReadRequest.NumDistanceFieldBricks);
 		const uint8* DistanceFieldBrickDataPtr = BulkDataReadPtr + NumIndirectionEntries * sizeof(uint32);
 		const SIZE_T DistanceFieldBrickDataSizeBytes = ReadRequest.NumDistanceFieldBricks * BrickSizeBytes;
-		FMemory::Memcpy(UpdateParameters.BrickUploadDataPtr + BrickUploadIndex * BrickSizeBytes, DistanceFieldBrickDataPtr, DistanceFieldBrickDataSizeBytes);
+		FMemory::Memcpy(UpdateParameters.BrickUploadDataPtr + RequestUpload.BrickUploadIndex * BrickSizeBytes, DistanceFieldBrickDataPtr, DistanceFieldBrickDataSizeBytes);
 
 		for (int32 BrickIndex = 0; BrickIndex < MipState.NumBricks; BrickIndex++)
 		{
 			const int32 GlobalBrickIndex = BrickIndex % GDistanceFieldBlockAllocatorSizeInBricks + GlobalBlockOffsets[BrickIndex / GDistanceFieldBlockAllocatorSizeInBricks] * GDistanceFieldBlockAllocatorSizeInBricks;
 			const FIntVector BrickTextureCoordinate = GetBrickCoordinate(GlobalBrickIndex, BrickTextureDimensionsInBricks);
-			UpdateParameters.BrickUploadCoordinatesPtr[BrickUploadIndex + BrickIndex] = FIntVector4(BrickTextureCoordinate.X, BrickTextureCoordinate.Y, BrickTextureCoordinate.Z, 0);
+			UpdateParameters.BrickUploadCoordinatesPtr[RequestUpload.BrickUploadIndex + BrickIndex] = FIntVector4(BrickTextureCoordinate.X, BrickTextureCoordinate.Y, BrickTextureCoordinate.Z, 0);
 		}
+	}, ParallelForFlags);
 
 #if WITH_EDITOR
+	for (const FDistanceFieldReadRequest& ReadRequest : UpdateParameters.ReadRequestsToUpload)
+	{
 		if (ReadRequest.BulkData)
 		{
 			ReadRequest.BulkData->Unlock();
 		}
-#endif
-
-		BrickUploadIndex += MipState.NumBricks;
 	}
+#endif
 
 #if !WITH_EDITOR
 
@@ -1106,11 +1163,26 @@ void FDistanceFieldSceneData::GenerateStreamingRequests(
 			PassParameters->DistanceFieldObjectBuffers = DistanceField::SetupObjectBufferParameters(GraphBuilder, *this);
 			PassParameters->DebugForceNumMips = FMath::Clamp(CVarDebugForceNumMips.GetValueOnRenderThread(), 0, DistanceField::NumMips);
 			extern int32 GAOGlobalDistanceFieldNumClipmaps;
-			// Request Mesh SDF mips based off of the Global SDF clipmaps
-			PassParameters->Mip1WorldTranslatedCenter = FVector3f(View.ViewMatrices.GetViewOrigin() + View.ViewMatrices.GetPreViewTranslation());
-			PassParameters->Mip1WorldExtent = FVector3f(GlobalDistanceField::GetClipmapExtent(GAOGlobalDistanceFieldNumClipmaps - 1, Scene, bLumenEnabled));
-			PassParameters->Mip2WorldTranslatedCenter = FVector3f(View.ViewMatrices.GetViewOrigin() + View.ViewMatrices.GetPreViewTranslation());
-			PassParameters->Mip2WorldExtent = FVector3f(GlobalDistanceField::GetClipmapExtent(FMath::Max<int32>(GAOGlobalDistanceFieldNumClipmaps / 2 - 1, 0), Scene, bLumenEnabled));
+			const float Mip1Extent = GlobalDistanceField::GetClipmapExtent(GAOGlobalDistanceFieldNumClipmaps - 1, Scene, bLumenEnabled);
+			const float Mip2Extent = GlobalDistanceField::GetClipmapExtent(FMath::Max<int32>(GAOGlobalDistanceFieldNumClipmaps / 2 - 1, 0), Scene, bLumenEnabled);
+
+			// Offset to where the camera is heading, so mips are requested before the camera gets there
+			FVector PredictionOffset = FVector::ZeroVector;
+			const float DeltaWorldTime = View.Family->Time.GetDeltaWorldTimeSeconds();
+			if (GDistanceFieldStreamingPredictionTime > 0.0f && !View.bCameraCut && DeltaWorldTime > 0.0f)
+			{
+				const FVector CameraVelocity = (View.ViewMatrices.GetViewOrigin() - View.PrevViewInfo.ViewMatrices.GetViewOrigin()) / DeltaWorldTime;
+				// Teleports without a camera cut would otherwise request a whole other area
+				PredictionOffset = (CameraVelocity * GDistanceFieldStreamingPredictionTime).GetClampedToMaxSize(Mip2Extent);
+			}
+
+			// Request Mesh SDF mips based off of the Global SDF clipmaps, grown to cover both the current and the predicted camera position
+			const FVector3f PredictionCenterOffset = FVector3f(PredictionOffset * 0.5f);
+			const FVector3f PredictionExtentOffset = PredictionCenterOffset.GetAbs();
+			PassParameters->Mip1WorldTranslatedCenter = FVector3f(View.ViewMatrices.GetViewOrigin() + View.ViewMatrices.GetPreViewTranslation()) + PredictionCenterOffset;
+			PassParameters->Mip1WorldExtent = FVector3f(Mip1Extent) + PredictionExtentOffset;
+			PassParameters->Mip2WorldTranslatedCenter = FVector3f(View.ViewMatrices.GetViewOrigin() + View.ViewMatrices.GetPreViewTranslation()) + PredictionCenterOffset;
+			PassParameters->Mip2WorldExtent = FVector3f(Mip2Extent) + PredictionExtentOffset;
 
 			auto ComputeShader = GlobalShaderMap->GetShader<FComputeDistanceFieldAssetWantedMipsCS>();
 
@@ -1466,6 +1538,7 @@ void FDistanceFieldSceneData::UpdateDistanceFieldAtlas(
 			UpdateParameters.ReadRequestsToCleanUp = MoveTemp(ReadRequestsToCleanUp);
 
 			// TODO: We actually run this synchronously now after the RDG conversion, as it would otherwise immediately sync.
+			// The brick copies within it are spread over the task threads, see r.DistanceFields.ParallelBrickUpload.
 			AsyncUpdate(UpdateParameters);
 		}
 
@@ -100,6 +100,16 @@ FAutoConsoleVariableRef CVarGPUSceneAllowDeferredAllocatorMerges(
 	ECVF_RenderThreadSafe
 );
 
+static int32 GGPUSceneUploadBudgetKB = 0;
+FAutoConsoleVariableRef CVarGPUSceneUploadBudgetKB(
+	TEXT("r.GPUScene.UploadBudgetKB"),
+	GGPUSceneUploadBudgetKB,
+	TEXT("Budget in KB of primitive and instance data uploaded to GPU-Scene per frame, 0 means unlimited.\n")
+	TEXT("Once it is spent, uploads of primitives that are not visible in the rendered views, don't cast dynamic shadows and are not Nanite are deferred to later frames.\n")
+	TEXT("Visible primitives are always uploaded. Disabled while ray tracing is enabled, as ray tracing instances may read any primitive."),
+	ECVF_RenderThreadSafe
+);
+
 int32 GGPUSceneInstanceUploadViaCreate = 1;
 FAutoConsoleVariableRef CVarGPUSceneInstanceUploadViaCreate(
 	TEXT("r.GPUScene.InstanceUploadViaCreate"),
@@ -109,6 +119,8 @@ FAutoConsoleVariableRef CVarGPUSceneInstanceUploadViaCreate(
 );
 
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("GPUScene Deferred Primitive Uploads"), STAT_GPUSceneDeferredPrimitiveUploads, STATGROUP_SceneRendering);
+
 LLM_DECLARE_TAG_API(GPUScene, RENDERER_API);
 DECLARE_LLM_MEMORY_STAT(TEXT("GPUScene"), STAT_GPUSceneLLM, STATGROUP_LLMFULL);
 DECLARE_LLM_MEMORY_STAT(TEXT("GPUScene"), STAT_GPUSceneSummaryLLM, STATGROUP_LLM);
@@ -596,7 +608,7 @@ void FGPUScene::EndRender()
 }
 
 
-void FGPUScene::UpdateInternal(FRDGBuilder& GraphBuilder, FScene& Scene, FRDGExternalAccessQueue& ExternalAccessQueue)
+void FGPUScene::UpdateInternal(FRDGBuilder& GraphBuilder, FScene& Scene, FRDGExternalAccessQueue& ExternalAccessQueue, TConstArrayView<FViewInfo> Views)
 {
 	LLM_SCOPE_BYTAG(GPUScene);
 
@@ -609,7 +621,8 @@ void FGPUScene::UpdateInternal(FRDGBuilder& GraphBuilder, FScene& Scene, FRDGExt
 
 	LastDeferredGPUWritePass = EGPUSceneGPUWritePass::None;
 
-	if (GGPUSceneUploadEveryFrame || bUpdateAllPrimitives)
+	const bool bUploadAllPrimitives = GGPUSceneUploadEveryFrame || bUpdateAllPrimitives;
+	if (bUploadAllPrimitives)
 	{
 		PrimitivesToUpdate.Reset();
 
@@ -642,6 +655,12 @@ void FGPUScene::UpdateInternal(FRDGBuilder& GraphBuilder, FScene& Scene, FRDGExt
 		}
 	}
 
+	TArray<TPair<int32, EPrimitiveDirtyState>> DeferredPrimitives;
+	if (!bUploadAllPrimitives && Views.Num() > 0)
+	{
+		DeferPrimitiveUploadsOverBudget(Scene, Views, DeferredPrimitives);
+	}
+
 	check(!BufferState.IsValid());
 
 	FUploadDataSourceAdapterScenePrimitives& Adapter = *GraphBuilder.AllocObject<FUploadDataSourceAdapterScenePrimitives>(Scene, SceneFrameNumber, MoveTemp(PrimitivesToUpdate), MoveTemp(PrimitiveDirtyState));
@@ -672,6 +691,14 @@ void FGPUScene::UpdateInternal(FRDGBuilder& GraphBuilder, FScene& Scene, FRDGExt
 	PrimitivesToUpdate.Reset();
 	PrimitiveDirtyState.Init(EPrimitiveDirtyState::None, PrimitiveDirtyState.Num());
 
+	// Deferred primitives go first next time, keeping their accumulated dirty state
+	for (const TPair<int32, EPrimitiveDirtyState>& DeferredPrimitive : DeferredPrimitives)
+	{
+		ResizeDirtyState(DeferredPrimitive.Key + 1);
+		PrimitivesToUpdate.Add(DeferredPrimitive.Key);
+		PrimitiveDirtyState[DeferredPrimitive.Key] = DeferredPrimitive.Value;
+	}
+
 	{
 		SCOPED_NAMED_EVENT(STAT_UpdateGPUScene, FColor::Green);
 		QUICK_SCOPE_CYCLE_COUNTER(STAT_UpdateGPUScene);
@@ -683,6 +710,56 @@ void FGPUScene::UpdateInternal(FRDGBuilder& GraphBuilder, FScene& Scene, FRDGExt
 	UseExternalAccessMode(ExternalAccessQueue, ERHIAccess::SRVMask, ERHIPipeline::All);
 }
 
+void FGPUScene::DeferPrimitiveUploadsOverBudget(const FScene& Scene, TConstArrayView<FViewInfo> Views, TArray<TPair<int32, EPrimitiveDirtyState>>& OutDeferredPrimitives)
+{
+	if (GGPUSceneUploadBudgetKB <= 0 || GGPUSceneValidatePrimitiveBuffer || GGPUSceneValidateInstanceBuffer || IsRayTracingEnabled())
+	{
+		return;
+	}
+
+	// The budget is shared by all the scene renderers of a frame
+	if (UploadBudgetFrameNumber != Scene.GetFrameNumber())
+	{
+		UploadBudgetFrameNumber = Scene.GetFrameNumber();
+		UploadBudgetBytesUsed = 0;
+	}
+
+	const int64 BudgetBytes = int64(GGPUSceneUploadBudgetKB) * 1024;
+	const int64 PrimitiveBytes = FPrimitiveSceneShaderData::DataStrideInFloat4s * sizeof(FVector4f);
+	const int64 InstanceBytes = FInstanceSceneShaderData::GetDataStrideInFloat4s() * sizeof(FVector4f);
+
+	int32 NumPrimitivesToUpdate = 0;
+	for (int32 Index = 0; Index < PrimitivesToUpdate.Num(); ++Index)
+	{
+		const int32 PrimitiveId = PrimitivesToUpdate[Index];
+		const FPrimitiveSceneInfo* PrimitiveSceneInfo = Scene.Primitives[PrimitiveId];
+		const int64 UploadBytes = PrimitiveBytes + int64(PrimitiveSceneInfo->GetNumInstanceSceneDataEntries()) * InstanceBytes;
+
+		if (UploadBudgetBytesUsed + UploadBytes > BudgetBytes)
+		{
+			// Anything that may read the primitive's data this frame still needs it: the views' draws, shadow depth passes and Nanite's GPU instance culling
+			const FPrimitiveFlagsCompact& PrimitiveFlags = Scene.PrimitiveFlagsCompact[PrimitiveId];
+			bool bCanDefer = !PrimitiveFlags.bIsNaniteMesh && !PrimitiveFlags.bCastDynamicShadow;
+			for (int32 ViewIndex = 0; bCanDefer && ViewIndex < Views.Num(); ++ViewIndex)
+			{
+				bCanDefer = !Views[ViewIndex].PrimitiveVisibilityMap[PrimitiveId];
+			}
+
+			if (bCanDefer)
+			{
+				OutDeferredPrimitives.Emplace(PrimitiveId, PrimitiveDirtyState[PrimitiveId]);
+				continue;
+			}
+		}
+
+		UploadBudgetBytesUsed += UploadBytes;
+		PrimitivesToUpdate[NumPrimitivesToUpdate++] = PrimitiveId;
+	}
+	PrimitivesToUpdate.SetNum(NumPrimitivesToUpdate, false);
+
+	SET_DWORD_STAT(STAT_GPUSceneDeferredPrimitiveUploads, OutDeferredPrimitives.Num());
+}
+
 template<typename FUploadDataSourceAdapter>
 void FGPUScene::UpdateBufferState(FRDGBuilder& GraphBuilder, FScene& Scene, const FUploadDataSourceAdapter& UploadDataSourceAdapter)
 {
@@ -1596,7 +1673,7 @@ void FGPUScene::AddPrimitiveToUpdate(int32 PrimitiveId, EPrimitiveDirtyState Dir
 }
 
 
-void FGPUScene::Update(FRDGBuilder& GraphBuilder, FScene& Scene, FRDGExternalAccessQueue& ExternalAccessQueue)
+void FGPUScene::Update(FRDGBuilder& GraphBuilder, FScene& Scene, FRDGExternalAccessQueue& ExternalAccessQueue, TConstArrayView<FViewInfo> Views)
 {
 	if (bIsEnabled)
 	{
@@ -1604,7 +1681,7 @@ void FGPUScene::Update(FRDGBuilder& GraphBuilder, FScene& Scene, FRDGExternalAcc
 
 		ensure(bInBeginEndBlock);
 		
-		UpdateInternal(GraphBuilder, Scene, ExternalAccessQueue);
+		UpdateInternal(GraphBuilder, Scene, ExternalAccessQueue, Views);
 	}
 }
 
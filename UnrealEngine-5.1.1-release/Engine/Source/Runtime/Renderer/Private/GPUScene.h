@@ -222,8 +222,9 @@ public:
 
 	/**
 	 * Pull all pending updates from Scene and upload primitive & instance data.
+	 * When Views are given and r.GPUScene.UploadBudgetKB is set, uploads of primitives that can't be drawn in these views are deferred once the budget is spent.
 	 */
-	void Update(FRDGBuilder& GraphBuilder, FScene& Scene, FRDGExternalAccessQueue& ExternalAccessQueue);
+	void Update(FRDGBuilder& GraphBuilder, FScene& Scene, FRDGExternalAccessQueue& ExternalAccessQueue, TConstArrayView<FViewInfo> Views = {});
 
 	/**
 	 * Queue the given primitive for upload to GPU at next call to Update.
@@ -360,6 +361,10 @@ private:
 
 	TArray<FInstanceRange> InstanceRangesToClear;
 
+	/** Bytes of primitive and instance data uploaded during UploadBudgetFrameNumber, counted against r.GPUScene.UploadBudgetKB */
+	uint32 UploadBudgetFrameNumber = ~0U;
+	int64 UploadBudgetBytesUsed = 0;
+
 	struct FDeferredGPUWrite
 	{
 		FGPUSceneWriteDelegate DataWriterGPU;
@@ -405,7 +410,10 @@ private:
 
 	void UploadDynamicPrimitiveShaderDataForViewInternal(FRDGBuilder& GraphBuilder, FScene& Scene, FViewInfo& View, FRDGExternalAccessQueue& ExternalAccessQueue, bool bIsShadowView);
 
-	void UpdateInternal(FRDGBuilder& GraphBuilder, FScene& Scene, FRDGExternalAccessQueue& ExternalAccessQueue);
+	void UpdateInternal(FRDGBuilder& GraphBuilder, FScene& Scene, FRDGExternalAccessQueue& ExternalAccessQueue, TConstArrayView<FViewInfo> Views);
+
+	/** Moves the primitives that are over the upload budget and can't be drawn in any of the views from PrimitivesToUpdate to OutDeferredPrimitives */
+	void DeferPrimitiveUploadsOverBudget(const FScene& Scene, TConstArrayView<FViewInfo> Views, TArray<TPair<int32, EPrimitiveDirtyState>>& OutDeferredPrimitives);
 
 	void AddUpdatePrimitiveIdsPass(FRDGBuilder& GraphBuilder, FInstanceGPULoadBalancer& IdOnlyUpdateItems);
 
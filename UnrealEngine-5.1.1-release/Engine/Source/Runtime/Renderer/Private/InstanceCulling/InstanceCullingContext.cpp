@@ -34,6 +34,14 @@ static FAutoConsoleVariableRef CVarInstanceCullingAllowOrderPreservation(
 	TEXT("Whether or not to allow instances to preserve instance draw order using GPU compaction."),
 	ECVF_RenderThreadSafe);
 
+static int32 GInstanceCullingSortTranslucentInstances = 1;
+static FAutoConsoleVariableRef CVarInstanceCullingSortTranslucentInstances(
+	TEXT("r.InstanceCulling.SortTranslucentInstances"),
+	GInstanceCullingSortTranslucentInstances,
+	TEXT("Whether instanced draws that preserve their instance order (translucent instanced static meshes) have their visible instances sorted back to front on the GPU after compaction.\n")
+	TEXT("Only single view draws with up to 1024 visible instances are sorted, others keep the instance order."),
+	ECVF_RenderThreadSafe);
+
 IMPLEMENT_STATIC_UNIFORM_BUFFER_SLOT(InstanceCullingUbSlot);
 IMPLEMENT_STATIC_UNIFORM_BUFFER_STRUCT(FInstanceCullingGlobalUniforms, "InstanceCulling", InstanceCullingUbSlot);
 
@@ -51,10 +59,12 @@ static bool IsInstanceOrderPreservationAllowed(ERHIFeatureLevel::Type FeatureLev
 	return GInstanceCullingAllowOrderPreservation && FeatureLevel > ERHIFeatureLevel::ES3_1;
 }
 
-static uint32 PackDrawCommandDesc(bool bMaterialUsesWorldPositionOffset, uint32 MeshLODIndex)
+static uint32 PackDrawCommandDesc(bool bMaterialUsesWorldPositionOffset, uint32 MeshLODIndex, bool bGPULODSelection)
 {
 	uint32 PackedData = bMaterialUsesWorldPositionOffset ? 1U : 0U;
 	PackedData |= ((MeshLODIndex & 0x000000FFU) << 1U);
+	// Bit 9 tells the culling shader to test the instance screen size against DrawCommandLODScreenSizes, see InstanceCullingLOD.ush
+	PackedData |= bGPULODSelection ? (1U << 9U) : 0U;
 	return PackedData;
 }
 
@@ -127,11 +137,13 @@ void FInstanceCullingContext::ResetCommands(int32 MaxNumCommands)
 	IndirectArgs.Empty(MaxNumCommands);
 	MeshDrawCommandInfos.Empty(MaxNumCommands);
 	DrawCommandDescs.Empty(MaxNumCommands);
+	DrawCommandLODScreenSizes.Empty(MaxNumCommands);
 	InstanceIdOffsets.Empty(MaxNumCommands);
 	PayloadData.Empty(MaxNumCommands);
 	TotalInstances = 0U;
 
 	DrawCommandCompactionData.Empty(MaxNumCommands);
+	DrawCommandCompactionSortViewIds.Empty(MaxNumCommands);
 	CompactionBlockDataIndices.Reset();
 	NumCompactionInstances = 0U;
 }
@@ -308,6 +320,75 @@ public:
 };
 IMPLEMENT_GLOBAL_SHADER(FCompactVisibleInstancesCs, "/Engine/Private/InstanceCulling/CompactVisibleInstances.usf", "CompactVisibleInstances", SF_Compute);
 
+// Sorts the compacted instances of each order preserving draw back to front from its view, one group per draw
+class FSortCompactedInstancesCs final : public FCompactVisibleInstancesBaseCs
+{
+	DECLARE_GLOBAL_SHADER(FSortCompactedInstancesCs);
+	SHADER_USE_PARAMETER_STRUCT(FSortCompactedInstancesCs, FCompactVisibleInstancesBaseCs)
+
+public:
+	static constexpr int32 NumThreadsPerGroup = 512;
+	/** Instances sorted in group shared memory, draws with more visible instances keep their instance order */
+	static constexpr int32 MaxSortedInstances = NumThreadsPerGroup * 2;
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FCompactVisibleInstancesBaseCs::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+
+		OutEnvironment.SetDefine(TEXT("NUM_THREADS_PER_GROUP"), NumThreadsPerGroup);
+		OutEnvironment.SetDefine(TEXT("MAX_SORTED_INSTANCES"), MaxSortedInstances);
+		OutEnvironment.SetDefine(TEXT("VF_SUPPORTS_PRIMITIVE_SCENE_DATA"), 1);
+		OutEnvironment.SetDefine(TEXT("USE_GLOBAL_GPU_SCENE_DATA"), 1);
+		OutEnvironment.SetDefine(TEXT("NANITE_MULTI_VIEW"), 1);
+	}
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float4>, GPUSceneInstanceSceneData)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float4>, GPUSceneInstancePayloadData)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float4>, GPUScenePrimitiveSceneData)
+		SHADER_PARAMETER(uint32, InstanceSceneDataSOAStride)
+		SHADER_PARAMETER(uint32, GPUSceneNumInstances)
+
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FInstanceCullingContext::FCompactionData>, DrawCommandCompactionData)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint32>, DrawCommandCompactionSortViewIds)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<Nanite::FPackedView>, InViews)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint>, DrawIndirectArgsBuffer)
+
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint32>, InstanceIdsBufferOut)
+		SHADER_PARAMETER(uint32, NumCompactionDrawCommands)
+	END_SHADER_PARAMETER_STRUCT()
+};
+IMPLEMENT_GLOBAL_SHADER(FSortCompactedInstancesCs, "/Engine/Private/InstanceCulling/SortCompactedInstances.usf", "SortCompactedInstancesCS", SF_Compute);
+
+static bool ShouldSortCompactedInstances()
+{
+	return GInstanceCullingSortTranslucentInstances != 0;
+}
+
+static void AddSortCompactedInstancesPass(
+	FRDGBuilder& GraphBuilder,
+	FGlobalShaderMap* ShaderMap,
+	const FGPUScene& GPUScene,
+	FSortCompactedInstancesCs::FParameters* PassParameters,
+	FRDGDispatchGroupCountCallback&& GroupCountCallback)
+{
+	const FGPUSceneResourceParameters GPUSceneParameters = GPUScene.GetShaderParameters();
+	PassParameters->GPUSceneInstanceSceneData = GPUSceneParameters.GPUSceneInstanceSceneData;
+	PassParameters->GPUSceneInstancePayloadData = GPUSceneParameters.GPUSceneInstancePayloadData;
+	PassParameters->GPUScenePrimitiveSceneData = GPUSceneParameters.GPUScenePrimitiveSceneData;
+	PassParameters->InstanceSceneDataSOAStride = GPUScene.InstanceSceneDataSOAStride;
+	PassParameters->GPUSceneNumInstances = GPUSceneParameters.NumInstances;
+
+	auto ComputeShader = ShaderMap->GetShader<FSortCompactedInstancesCs>();
+
+	FComputeShaderUtils::AddPass(
+		GraphBuilder,
+		RDG_EVENT_NAME("Instance Compaction Depth Sort"),
+		ComputeShader,
+		PassParameters,
+		MoveTemp(GroupCountCallback));
+}
+
 class FBuildInstanceIdBufferAndCommandsFromPrimitiveIdsCs : public FGlobalShader
 {
 	DECLARE_GLOBAL_SHADER(FBuildInstanceIdBufferAndCommandsFromPrimitiveIdsCs);
@@ -381,6 +462,7 @@ public:
 		SHADER_PARAMETER_STRUCT_INCLUDE(FInstanceProcessingGPULoadBalancer::FShaderParameters, LoadBalancerParameters)
 
 		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer< uint32 >, DrawCommandDescs)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer< uint32 >, DrawCommandLODScreenSizes)
 		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer< FInstanceCullingContext::FPayloadData >, InstanceCullingPayloads)
 		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer< uint32 >, ViewIds)
 		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer< Nanite::FPackedView >, InViews)
@@ -548,6 +630,7 @@ void FInstanceCullingContext::BuildRenderingCommands(
 	FBuildInstanceIdBufferAndCommandsFromPrimitiveIdsCs::FParameters PassParametersTmp;
 
 	PassParametersTmp.DrawCommandDescs = GraphBuilder.CreateSRV(CreateStructuredBuffer(GraphBuilder, TEXT("InstanceCulling.DrawCommandDescs"), DrawCommandDescs));
+	PassParametersTmp.DrawCommandLODScreenSizes = GraphBuilder.CreateSRV(CreateStructuredBuffer(GraphBuilder, TEXT("InstanceCulling.DrawCommandLODScreenSizes"), DrawCommandLODScreenSizes));
 
 	PassParametersTmp.InstanceCullingPayloads = GraphBuilder.CreateSRV(CreateStructuredBuffer(GraphBuilder, TEXT("InstanceCulling.PayloadData"), PayloadData));
 
@@ -698,6 +781,21 @@ void FInstanceCullingContext::BuildRenderingCommands(
 				FComputeShaderUtils::GetGroupCountWrapped(NumCompactionBlocks)
 			);
 		}
+
+		if (ShouldSortCompactedInstances() && bCullInstances && FeatureLevel > ERHIFeatureLevel::ES3_1)
+		{
+			auto PassParameters = GraphBuilder.AllocParameters<FSortCompactedInstancesCs::FParameters>();
+			PassParameters->DrawCommandCompactionData = DrawCommandCompactionDataSRV;
+			PassParameters->DrawCommandCompactionSortViewIds = GraphBuilder.CreateSRV(CreateStructuredBuffer(GraphBuilder, TEXT("InstanceCulling.Compaction.SortViewIds"), DrawCommandCompactionSortViewIds));
+			PassParameters->InViews = PassParametersTmp.InViews;
+			// Fresh views, the culling ones skip barriers and the sort reads what the compaction wrote
+			PassParameters->DrawIndirectArgsBuffer = GraphBuilder.CreateUAV(DrawIndirectArgsRDG, PF_R32_UINT);
+			PassParameters->InstanceIdsBufferOut = GraphBuilder.CreateUAV(InstanceIdsBuffer);
+			PassParameters->NumCompactionDrawCommands = DrawCommandCompactionData.Num();
+
+			const FIntVector GroupCount = FComputeShaderUtils::GetGroupCountWrapped(DrawCommandCompactionData.Num());
+			AddSortCompactedInstancesPass(GraphBuilder, ShaderMap, GPUScene, PassParameters, [GroupCount]() { return GroupCount; });
+		}
 	}
 
 	Results.DrawIndirectArgsBuffer = DrawIndirectArgsRDG;
@@ -843,6 +941,7 @@ FInstanceCullingDeferredContext *FInstanceCullingContext::CreateDeferredContext(
 	FBuildInstanceIdBufferAndCommandsFromPrimitiveIdsCs::FParameters PassParametersTmp;
 
 	FRDGBufferRef DrawCommandDescsRDG = CreateStructuredBuffer(INST_CULL_CREATE_STRUCT_BUFF_ARGS(DrawCommandDescs));
+	FRDGBufferRef DrawCommandLODScreenSizesRDG = CreateStructuredBuffer(INST_CULL_CREATE_STRUCT_BUFF_ARGS(DrawCommandLODScreenSizes));
 	FRDGBufferRef InstanceCullingPayloadsRDG = CreateStructuredBuffer(INST_CULL_CREATE_STRUCT_BUFF_ARGS(PayloadData));
 	FRDGBufferRef ViewIdsRDG = CreateStructuredBuffer(INST_CULL_CREATE_STRUCT_BUFF_ARGS(ViewIds));
 	FRDGBufferRef BatchInfosRDG = CreateStructuredBuffer(INST_CULL_CREATE_STRUCT_BUFF_ARGS(BatchInfos));
@@ -886,6 +985,7 @@ FInstanceCullingDeferredContext *FInstanceCullingContext::CreateDeferredContext(
 	PassParametersTmp.GPUSceneNumLightmapDataItems = GPUScene.GetNumLightmapDataItems();
 
 	PassParametersTmp.DrawCommandDescs = GraphBuilder.CreateSRV(DrawCommandDescsRDG);
+	PassParametersTmp.DrawCommandLODScreenSizes = GraphBuilder.CreateSRV(DrawCommandLODScreenSizesRDG);
 	PassParametersTmp.InstanceCullingPayloads = GraphBuilder.CreateSRV(InstanceCullingPayloadsRDG);
 	PassParametersTmp.BatchInfos = GraphBuilder.CreateSRV(BatchInfosRDG);
 	PassParametersTmp.ViewIds = GraphBuilder.CreateSRV(ViewIdsRDG);
@@ -1021,6 +1121,24 @@ FInstanceCullingDeferredContext *FInstanceCullingContext::CreateDeferredContext(
 				return FComputeShaderUtils::GetGroupCountWrapped(DeferredContext->TotalCompactionBlocks);
 			});
 		}
+
+		if (ShouldSortCompactedInstances() && bCullInstances && FeatureLevel > ERHIFeatureLevel::ES3_1)
+		{
+			FRDGBufferRef SortViewIds = CreateStructuredBuffer(INST_CULL_CREATE_STRUCT_BUFF_ARGS(DrawCommandCompactionSortViewIds));
+
+			auto PassParameters2 = GraphBuilder.AllocParameters<FSortCompactedInstancesCs::FParameters>();
+			PassParameters2->DrawCommandCompactionData = DrawCommandCompactionDataSRV;
+			PassParameters2->DrawCommandCompactionSortViewIds = GraphBuilder.CreateSRV(SortViewIds);
+			PassParameters2->InViews = PassParametersTmp.InViews;
+			PassParameters2->DrawIndirectArgsBuffer = GraphBuilder.CreateUAV(DeferredContext->DrawIndirectArgsBuffer, PF_R32_UINT);
+			PassParameters2->InstanceIdsBufferOut = GraphBuilder.CreateUAV(InstanceIdsBuffer);
+
+			AddSortCompactedInstancesPass(GraphBuilder, ShaderMap, GPUScene, PassParameters2, [PassParameters2, DeferredContext]()
+			{
+				PassParameters2->NumCompactionDrawCommands = DeferredContext->TotalCompactionDrawCommands;
+				return FComputeShaderUtils::GetGroupCountWrapped(DeferredContext->TotalCompactionDrawCommands);
+			});
+		}
 	}
 
 	if (FeatureLevel > ERHIFeatureLevel::ES3_1)
@@ -1200,6 +1318,7 @@ void FInstanceCullingContext::SetupDrawCommands(
 		const bool bMaterialUsesWorldPositionOffset = EnumHasAnyFlags(VisibleMeshDrawCommand.Flags, EFVisibleMeshDrawCommandFlags::MaterialUsesWorldPositionOffset);
 		const bool bForceInstanceCulling = EnumHasAnyFlags(VisibleMeshDrawCommand.Flags, EFVisibleMeshDrawCommandFlags::ForceInstanceCulling);
 		const bool bPreserveInstanceOrder = bOrderPreservationEnabled && EnumHasAnyFlags(VisibleMeshDrawCommand.Flags, EFVisibleMeshDrawCommandFlags::PreserveInstanceOrder);
+		const bool bGPULODSelection = EnumHasAnyFlags(VisibleMeshDrawCommand.Flags, EFVisibleMeshDrawCommandFlags::GPULODSelection);
 		const bool bUseIndirectDraw = bAlwaysUseIndirectDraws || bForceInstanceCulling || (VisibleMeshDrawCommand.NumRuns > 0 || MeshDrawCommand->NumInstances > 1);
 
 		if (bCompactIdenticalCommands && CurrentStateBucketId != -1 && VisibleMeshDrawCommand.StateBucketId == CurrentStateBucketId)
@@ -1238,7 +1357,8 @@ void FInstanceCullingContext::SetupDrawCommands(
 				{
 					MeshLODIndex = StateBucketsAuxData[VisibleMeshDrawCommand.StateBucketId].MeshLODIndex;
 				}
-				DrawCommandDescs.Add(PackDrawCommandDesc(bMaterialUsesWorldPositionOffset, MeshLODIndex));
+				DrawCommandDescs.Add(PackDrawCommandDesc(bMaterialUsesWorldPositionOffset, MeshLODIndex, bGPULODSelection));
+				DrawCommandLODScreenSizes.Add(bGPULODSelection ? VisibleMeshDrawCommand.LODScreenSizeRange : 0U);
 				
 				if (bUseIndirectDraw)
 				{
@@ -1312,6 +1432,9 @@ void FInstanceCullingContext::SetupDrawCommands(
 					NumCompactionInstances,
 					InstanceIdOffsets.Last());
 
+				// The visible instances are sorted back to front from the view after compaction, see FSortCompactedInstancesCs
+				DrawCommandCompactionSortViewIds.Add((NumViews == 1 && ShouldSortCompactedInstances()) ? uint32(ViewIds[0]) : ~0U);
+
 				const int32 FirstBlock = CompactionBlockDataIndices.Num();
 				const uint32 NumCompactionBlocksThisCommand = FMath::DivideAndRoundUp(NumInstancesAdded, CompactionBlockNumInstances);
 				CompactionBlockDataIndices.AddUninitialized(NumCompactionBlocksThisCommand);
@@ -12,10 +12,12 @@ void FInstanceCullingMergedContext::MergeBatches()
 	// Pre-size all arrays
 	IndirectArgs.Empty(TotalIndirectArgs);
 	DrawCommandDescs.Empty(TotalIndirectArgs);
+	DrawCommandLODScreenSizes.Empty(TotalIndirectArgs);
 	InstanceIdOffsets.Empty(TotalIndirectArgs);
 	PayloadData.Empty(TotalPayloads);
 	ViewIds.Empty(TotalViewIds);
 	DrawCommandCompactionData.Empty(TotalCompactionDrawCommands);
+	DrawCommandCompactionSortViewIds.Empty(TotalCompactionDrawCommands);
 	CompactionBlockDataIndices.Empty(TotalCompactionBlocks);
 
 	BatchInfos.AddDefaulted(Batches.Num());
@@ -38,6 +40,8 @@ void FInstanceCullingMergedContext::MergeBatches()
 
 		check(InstanceCullingContext.DrawCommandDescs.Num() == InstanceCullingContext.IndirectArgs.Num());
 		DrawCommandDescs.Append(InstanceCullingContext.DrawCommandDescs);
+		check(InstanceCullingContext.DrawCommandLODScreenSizes.Num() == InstanceCullingContext.DrawCommandDescs.Num());
+		DrawCommandLODScreenSizes.Append(InstanceCullingContext.DrawCommandLODScreenSizes);
 
 		BatchInfo.PayloadDataOffset = PayloadData.Num();
 		PayloadData.Append(InstanceCullingContext.PayloadData);
@@ -98,6 +102,9 @@ void FInstanceCullingMergedContext::MergeBatches()
 			CompactionData.DestInstanceIdOffset += InstanceIdBufferOffset;
 			DrawCommandCompactionData.Add(CompactionData);
 		}
+		// Culling view ids are global to the manager and need no fix up
+		check(InstanceCullingContext.DrawCommandCompactionSortViewIds.Num() == InstanceCullingContext.DrawCommandCompactionData.Num());
+		DrawCommandCompactionSortViewIds.Append(InstanceCullingContext.DrawCommandCompactionSortViewIds);
 		for (uint32 CompactionDataIndex : InstanceCullingContext.CompactionBlockDataIndices)
 		{
 			CompactionBlockDataIndices.Add(CompactionDataIndex + BatchInfo.CompactionDataOffset);
@@ -47,9 +47,11 @@ public:
 	//TArray<FMeshDrawCommandInfo, SceneRenderingAllocator> MeshDrawCommandInfos;
 	TArray<FRHIDrawIndexedIndirectParameters, SceneRenderingAllocator> IndirectArgs;
 	TArray<uint32, SceneRenderingAllocator> DrawCommandDescs;
+	TArray<uint32, SceneRenderingAllocator> DrawCommandLODScreenSizes;
 	TArray<FInstanceCullingContext::FPayloadData, SceneRenderingAllocator> PayloadData;
 	TArray<uint32, SceneRenderingAllocator> InstanceIdOffsets;
 	TArray<FInstanceCullingContext::FCompactionData, SceneRenderingAllocator> DrawCommandCompactionData;
+	TArray<uint32, SceneRenderingAllocator> DrawCommandCompactionSortViewIds;
 	TArray<uint32, SceneRenderingAllocator> CompactionBlockDataIndices;	
 
 	TStaticArray<TInstanceCullingLoadBalancer<SceneRenderingAllocator>, static_cast<uint32>(EBatchProcessingMode::Num)> LoadBalancers;
@@ -495,6 +495,12 @@ public:
 	int32 NumLockedCardsToUpdate = 0;
 	int32 NumHiResPagesToAdd = 0;
 
+	// Fraction of the card capture and lighting update budgets allowed this frame by r.LumenScene.DynamicRes.TimeBudget
+	float UpdateBudgetFraction = 1.0f;
+
+	// Scale of r.LumenScene.SurfaceCache.CardCaptureRefreshFraction from the camera speed this frame
+	float CardCaptureRefreshCameraSpeedScale = 1.0f;
+
 	bool bTrackAllPrimitives;
 	TSet<FPrimitiveSceneInfo*> PendingAddOperations;
 	TSet<FPrimitiveSceneInfo*> PendingUpdateOperations;
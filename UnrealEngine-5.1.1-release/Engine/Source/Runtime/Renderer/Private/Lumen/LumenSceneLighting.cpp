@@ -48,6 +48,8 @@ FAutoConsoleVariableRef CVarLumenSceneRadiosityUpdateFactor(
 	ECVF_Scalability | ECVF_RenderThreadSafe
 );
 
+extern DynamicRenderScaling::FBudget GDynamicLumenSceneUpdate;
+
 int32 GLumenLightingStats = 0;
 FAutoConsoleVariableRef CVarLumenSceneLightingStats(
 	TEXT("r.LumenScene.Lighting.Stats"),
@@ -235,6 +237,7 @@ void FDeferredShadingSceneRenderer::RenderLumenSceneLighting(
 		QUICK_SCOPE_CYCLE_COUNTER(RenderLumenSceneLighting);
 		RDG_EVENT_SCOPE(GraphBuilder, "LumenSceneLighting%s", LumenCardRenderer.bPropagateGlobalLightingChange ? TEXT(" PROPAGATE GLOBAL CHANGE!") : TEXT(""));
 		RDG_GPU_STAT_SCOPE(GraphBuilder, LumenSceneLighting);
+		DynamicRenderScaling::FRDGScope DynamicLumenSceneUpdateScope(GraphBuilder, GDynamicLumenSceneUpdate);
 
 		const ERDGPassFlags ComputePassFlags = Lumen::GetLumenSceneLightingComputePassFlags(ViewFamily.EngineShowFlags);
 
@@ -541,6 +544,9 @@ void Lumen::BuildCardUpdateContext(
 	const uint32 FreezeUpdateFrame = Lumen::IsSurfaceCacheUpdateFrameFrozen() ? 1 : 0;
 	const float FirstClipmapWorldExtentRcp = 1.0f / Lumen::GetGlobalDFClipmapExtent(0);
 
+	// Lower the update budgets when the Lumen scene update goes over r.LumenScene.DynamicRes.TimeBudget
+	LumenSceneLightingUpdateSpeed *= FMath::Max(LumenSceneData.UpdateBudgetFraction, 0.01f);
+
 	SetLightingUpdateAtlasSize(LumenSceneData.GetPhysicalAtlasSize(), FMath::RoundToInt(GLumenDirectLightingUpdateFactor / LumenSceneLightingUpdateSpeed), DirectLightingCardUpdateContext);
 	SetLightingUpdateAtlasSize(LumenSceneData.GetPhysicalAtlasSize(), FMath::RoundToInt(GLumenRadiosityUpdateFactor / LumenSceneLightingUpdateSpeed), IndirectLightingCardUpdateContext);
 
@@ -134,6 +134,62 @@ TAutoConsoleVariable<int32> CVarLumenSceneCardCaptureEnableInvalidation(
 	ECVF_Scalability | ECVF_RenderThreadSafe
 );
 
+float GLumenSceneCardCaptureRefreshFastCameraSpeed = 0.0f;
+FAutoConsoleVariableRef CVarLumenSceneCardCaptureRefreshFastCameraSpeed(
+	TEXT("r.LumenScene.SurfaceCache.CardCaptureRefreshFastCameraSpeed"),
+	GLumenSceneCardCaptureRefreshFastCameraSpeed,
+	TEXT("Camera speed in units per second above which the card refresh budget is reduced in proportion to the speed, leaving more of the capture budget to newly visible pages.\n")
+	TEXT("0 disables the camera speed based reduction."),
+	ECVF_Scalability | ECVF_RenderThreadSafe
+);
+
+static TAutoConsoleVariable<float> CVarLumenSceneUpdateMinPercentage(
+	TEXT("r.LumenScene.DynamicRes.MinPercentage"),
+	25.0f,
+	TEXT("Minimal percentage of the surface cache capture and lighting update budgets when r.LumenScene.DynamicRes.TimeBudget is set."),
+	ECVF_RenderThreadSafe | ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarLumenSceneUpdateMaxPercentage(
+	TEXT("r.LumenScene.DynamicRes.MaxPercentage"),
+	100.0f,
+	TEXT("Maximal percentage of the surface cache capture and lighting update budgets when r.LumenScene.DynamicRes.TimeBudget is set."),
+	ECVF_RenderThreadSafe | ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarLumenSceneUpdateTimeBudget(
+	TEXT("r.LumenScene.DynamicRes.TimeBudget"),
+	DynamicRenderScaling::FHeuristicSettings::kBudgetMsDisabled,
+	TEXT("Frame's time budget in milliseconds for the Lumen scene update and lighting. Card captures and radiosity updates per frame are scaled to fit in it.\n")
+	TEXT("Requires dynamic resolution to be active. 0 disables it."),
+	ECVF_RenderThreadSafe | ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarLumenSceneUpdateTargetedHeadRoomPercentage(
+	TEXT("r.LumenScene.DynamicRes.TargetedHeadRoomPercentage"),
+	DynamicRenderScaling::FractionToPercentage(DynamicRenderScaling::FHeuristicSettings::kDefaultTargetedHeadRoom),
+	TEXT("Targeted GPU headroom for the Lumen scene update (in percent from r.LumenScene.DynamicRes.TimeBudget)."),
+	ECVF_RenderThreadSafe | ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarLumenSceneUpdateChangeThreshold(
+	TEXT("r.LumenScene.DynamicRes.ChangePercentageThreshold"),
+	DynamicRenderScaling::FractionToPercentage(DynamicRenderScaling::FHeuristicSettings::kDefaultChangeThreshold),
+	TEXT("Minimal increase percentage threshold to allow when changing the Lumen scene update budgets."),
+	ECVF_RenderThreadSafe | ECVF_Default);
+
+DynamicRenderScaling::FHeuristicSettings GetDynamicLumenSceneUpdateSettings()
+{
+	DynamicRenderScaling::FHeuristicSettings BucketSetting;
+	BucketSetting.Model = DynamicRenderScaling::EHeuristicModel::Linear;
+	BucketSetting.bModelScalesWithPrimaryScreenPercentage = false;
+	BucketSetting.MinResolutionFraction = DynamicRenderScaling::GetPercentageCVarToFraction(CVarLumenSceneUpdateMinPercentage);
+	BucketSetting.MaxResolutionFraction = DynamicRenderScaling::GetPercentageCVarToFraction(CVarLumenSceneUpdateMaxPercentage);
+	BucketSetting.BudgetMs              = CVarLumenSceneUpdateTimeBudget.GetValueOnAnyThread();
+	BucketSetting.ChangeThreshold       = DynamicRenderScaling::GetPercentageCVarToFraction(CVarLumenSceneUpdateChangeThreshold);
+	BucketSetting.TargetedHeadRoom      = DynamicRenderScaling::GetPercentageCVarToFraction(CVarLumenSceneUpdateTargetedHeadRoomPercentage);
+	return BucketSetting;
+}
+
+// Scales card captures and surface cache lighting updates to the GPU time spent in LumenSceneUpdate and LumenSceneLighting
+DynamicRenderScaling::FBudget GDynamicLumenSceneUpdate(TEXT("DynamicLumenSceneUpdate"), &GetDynamicLumenSceneUpdateSettings);
+
 float GLumenSceneCardCaptureMargin = 0.0f;
 FAutoConsoleVariableRef CVarLumenSceneCardCaptureMargin(
 	TEXT("r.LumenScene.SurfaceCache.CardCaptureMargin"),
@@ -478,7 +534,7 @@ int32 GetMaxMeshCardsToAddPerFrame()
 	return 2 * GetMaxLumenSceneCardCapturesPerFrame();
 }
 
-int32 GetMaxTileCapturesPerFrame()
+int32 GetMaxTileCapturesPerFrame(float UpdateBudgetFraction)
 {
 	if (Lumen::IsSurfaceCacheFrozen())
 	{
@@ -490,6 +546,11 @@ int32 GetMaxTileCapturesPerFrame()
 		return INT32_MAX;
 	}
 
+	if (UpdateBudgetFraction < 1.0f)
+	{
+		return FMath::Max(FMath::RoundToInt(GetMaxLumenSceneCardCapturesPerFrame() * UpdateBudgetFraction), 1);
+	}
+
 	return GetMaxLumenSceneCardCapturesPerFrame();
 }
 
@@ -2235,6 +2296,25 @@ void FDeferredShadingSceneRenderer::BeginUpdateLumenSceneTasks(FRDGBuilder& Grap
 		LumenSceneData.NumLockedCardsToUpdate = 0;
 		LumenSceneData.NumHiResPagesToAdd = 0;
 
+		// Scale the surface cache update to the GPU time budget, measured in UpdateLumenScene and RenderLumenSceneLighting
+		LumenSceneData.UpdateBudgetFraction = 1.0f;
+		if (GDynamicLumenSceneUpdate.GetSettings().IsEnabled())
+		{
+			LumenSceneData.UpdateBudgetFraction = FMath::Clamp(DynamicResolutionFractions[GDynamicLumenSceneUpdate], 0.0f, 1.0f);
+		}
+
+		// A fast moving camera reveals many new pages, spend less of the capture budget on refreshing existing ones
+		LumenSceneData.CardCaptureRefreshCameraSpeedScale = 1.0f;
+		const float DeltaWorldTime = ViewFamily.Time.GetDeltaWorldTimeSeconds();
+		if (GLumenSceneCardCaptureRefreshFastCameraSpeed > 0.0f && DeltaWorldTime > 0.0f && !Views[0].bCameraCut)
+		{
+			const float CameraSpeed = (Views[0].ViewMatrices.GetViewOrigin() - Views[0].PrevViewInfo.ViewMatrices.GetViewOrigin()).Size() / DeltaWorldTime;
+			if (CameraSpeed > GLumenSceneCardCaptureRefreshFastCameraSpeed)
+			{
+				LumenSceneData.CardCaptureRefreshCameraSpeedScale = GLumenSceneCardCaptureRefreshFastCameraSpeed / CameraSpeed;
+			}
+		}
+
 		UpdateLumenScenePrimitives(GraphBuilder.RHICmdList.GetGPUMask(), Scene);
 		UpdateDistantScene(Scene, Views[0]);
 
@@ -2254,7 +2334,7 @@ void FDeferredShadingSceneRenderer::BeginUpdateLumenSceneTasks(FRDGBuilder& Grap
 			LumenSceneDetail = FMath::Max(LumenSceneDetail, FMath::Clamp<float>(View.FinalPostProcessSettings.LumenSceneDetail, .125f, 8.0f));
 		}
 
-		const int32 MaxTileCapturesPerFrame = GetMaxTileCapturesPerFrame();
+		const int32 MaxTileCapturesPerFrame = GetMaxTileCapturesPerFrame(LumenSceneData.UpdateBudgetFraction);
 
 		if (MaxTileCapturesPerFrame > 0)
 		{
@@ -2514,7 +2594,7 @@ FIntPoint FLumenSceneData::GetCardCaptureAtlasSize() const
 
 uint32 FLumenSceneData::GetCardCaptureRefreshNumTexels() const
 {
-	const float CardCaptureRefreshFraction = FMath::Clamp(CVarLumenSceneCardCaptureRefreshFraction.GetValueOnRenderThread(), 0.0f, 1.0f);
+	const float CardCaptureRefreshFraction = FMath::Clamp(CVarLumenSceneCardCaptureRefreshFraction.GetValueOnRenderThread() * CardCaptureRefreshCameraSpeedScale, 0.0f, 1.0f);
 	if (CardCaptureRefreshFraction > 0.0f)
 	{
 		// Allow to capture at least 1 full physical page
@@ -2527,11 +2607,12 @@ uint32 FLumenSceneData::GetCardCaptureRefreshNumTexels() const
 
 uint32 FLumenSceneData::GetCardCaptureRefreshNumPages() const
 {
-	const float CardCaptureRefreshFraction = FMath::Clamp(CVarLumenSceneCardCaptureRefreshFraction.GetValueOnRenderThread(), 0.0f, 1.0f);
+	const float CardCaptureRefreshFraction = FMath::Clamp(CVarLumenSceneCardCaptureRefreshFraction.GetValueOnRenderThread() * CardCaptureRefreshCameraSpeedScale, 0.0f, 1.0f);
 	if (CardCaptureRefreshFraction > 0.0f)
 	{
 		// Allow to capture at least 1 full physical page
-		return FMath::Clamp(GetMaxTileCapturesPerFrame() * CardCaptureRefreshFraction, 1, GetMaxTileCapturesPerFrame());
+		const int32 MaxTileCapturesPerFrame = GetMaxTileCapturesPerFrame(UpdateBudgetFraction);
+		return FMath::Clamp(MaxTileCapturesPerFrame * CardCaptureRefreshFraction, 1, MaxTileCapturesPerFrame);
 	}
 
 	return 0;
@@ -2705,6 +2786,7 @@ void FDeferredShadingSceneRenderer::UpdateLumenScene(FRDGBuilder& GraphBuilder,
 		QUICK_SCOPE_CYCLE_COUNTER(UpdateLumenScene);
 		RDG_RHI_GPU_STAT_SCOPE(GraphBuilder, UpdateLumenSceneBuffers);
 		RDG_GPU_STAT_SCOPE(GraphBuilder, LumenSceneUpdate);
+		DynamicRenderScaling::FRDGScope DynamicLumenSceneUpdateScope(GraphBuilder, GDynamicLumenSceneUpdate);
 		RDG_EVENT_SCOPE(GraphBuilder, "LumenSceneUpdate: %u card captures %.3fM texels", CardPagesToRender.Num(), LumenCardRenderer.NumCardTexelsToCapture / (1024.0f * 1024.0f));
 
 		LumenCardRenderer.bPropagateGlobalLightingChange = UpdateGlobalLightingState(Scene, Views[0], LumenSceneData);
@@ -26,6 +26,9 @@ static TAutoConsoleVariable<int32> CVarMobileMeshSortingMethod(
 	TEXT("\t1: Strict front to back sorting.\n"),
 	ECVF_RenderThreadSafe);
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Dynamic mesh draw commands reused"), STAT_DynamicMeshDrawCommandsReused, STATGROUP_SceneRendering);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Dynamic mesh draw commands cached"), STAT_DynamicMeshDrawCommandsCached, STATGROUP_SceneRendering);
+
 static int32 GAllowOnDemandShaderCreation = 1;
 static FAutoConsoleVariableRef CVarAllowOnDemandShaderCreation(
 	TEXT("r.MeshDrawCommands.AllowOnDemandShaderCreation"),
@@ -564,6 +567,231 @@ static void BuildMeshDrawCommandPrimitiveIdBuffer(
 	}
 }
 
+FDynamicMeshDrawCommandCache::~FDynamicMeshDrawCommandCache()
+{
+	Empty();
+}
+
+void FDynamicMeshDrawCommandCache::ReleaseEntry(FEntry& Entry)
+{
+	if (Entry.bRegistered)
+	{
+		for (const FMeshDrawCommand& MeshDrawCommand : Entry.MeshDrawCommands)
+		{
+			FGraphicsMinimalPipelineStateId::RemovePersistentId(MeshDrawCommand.CachedPipelineId);
+		}
+		Entry.bRegistered = false;
+	}
+}
+
+void FDynamicMeshDrawCommandCache::Empty()
+{
+	check(IsInRenderingThread());
+
+	for (TPair<FMeshBatchKey, FEntry>& Pair : Entries)
+	{
+		ReleaseEntry(Pair.Value);
+	}
+	for (FEntry& Entry : StaleEntries)
+	{
+		ReleaseEntry(Entry);
+	}
+
+	Entries.Empty();
+	StaleEntries.Empty();
+}
+
+void FDynamicMeshDrawCommandCache::BeginFrame()
+{
+	check(IsInRenderingThread());
+	SCOPED_NAMED_EVENT(FDynamicMeshDrawCommandCache_BeginFrame, FColor::Emerald);
+
+	for (FEntry& Entry : StaleEntries)
+	{
+		ReleaseEntry(Entry);
+	}
+	StaleEntries.Reset();
+
+	bool bRegisteredPipelineStates = false;
+	for (TMap<FMeshBatchKey, FEntry>::TIterator It = Entries.CreateIterator(); It; ++It)
+	{
+		FEntry& Entry = It.Value();
+
+		// Drop the commands that were not drawn last frame, their proxy may have been deleted
+		if (Entry.LastUsedFrame != Frame)
+		{
+			ReleaseEntry(Entry);
+			It.RemoveCurrent();
+		}
+		else if (!Entry.bRegistered)
+		{
+			// Commands captured last frame reference the pipeline state set of their pass, which doesn't outlive the frame
+			for (int32 CommandIndex = 0; CommandIndex < Entry.MeshDrawCommands.Num(); ++CommandIndex)
+			{
+				Entry.MeshDrawCommands[CommandIndex].CachedPipelineId = FGraphicsMinimalPipelineStateId::GetPersistentId(Entry.PipelineStates[CommandIndex]);
+			}
+			Entry.PipelineStates.Empty();
+			Entry.bRegistered = true;
+			bRegisteredPipelineStates = true;
+		}
+	}
+
+	if (bRegisteredPipelineStates && !FParallelMeshDrawCommandPass::IsOnDemandShaderCreationEnabled())
+	{
+		FGraphicsMinimalPipelineStateId::InitializePersistentIds();
+	}
+
+	++Frame;
+}
+
+bool FDynamicMeshDrawCommandCache::GetMeshBatchKey(const FMeshBatchAndRelevance& MeshAndRelevance, bool bUseGPUScene, FMeshBatchKey& OutKey)
+{
+	const FPrimitiveSceneProxy* PrimitiveSceneProxy = MeshAndRelevance.PrimitiveSceneProxy;
+	if (!PrimitiveSceneProxy || !PrimitiveSceneProxy->GetPrimitiveSceneInfo() || !PrimitiveSceneProxy->CanCacheDynamicMeshDrawCommands()
+		// Volumetric self shadow mesh commands depend on single frame uniform buffers, same as for static meshes
+		|| PrimitiveSceneProxy->CastsVolumetricTranslucentShadow())
+	{
+		return false;
+	}
+
+	const FMeshBatch& Mesh = *MeshAndRelevance.Mesh;
+	if (!SupportsCachingMeshDrawCommands(Mesh))
+	{
+		return false;
+	}
+
+	// Anything allocated for the frame or drawn with per frame primitive data can't be reused
+	const FMeshBatchElement& Element = Mesh.Elements[0];
+	if (Element.DynamicIndexBuffer.IsValid()
+		|| Element.bIsInstanceRuns
+		|| Element.bIsSplineProxy
+		|| Element.IndirectArgsBuffer
+		|| Element.PrimitiveUniformBufferResource
+		|| Element.DynamicPrimitiveData
+		|| (bUseGPUScene && Element.PrimitiveIdMode != PrimID_FromPrimitiveSceneInfo))
+	{
+		return false;
+	}
+
+	OutKey.PrimitiveSceneProxy = PrimitiveSceneProxy;
+	OutKey.VertexFactory = Mesh.VertexFactory;
+	OutKey.MaterialRenderProxy = Mesh.MaterialRenderProxy;
+	OutKey.LCI = Mesh.LCI;
+	OutKey.IndexBuffer = Element.IndexBuffer;
+	OutKey.PrimitiveUniformBuffer = Element.PrimitiveUniformBuffer;
+	OutKey.UserData = Element.UserData;
+	OutKey.VertexFactoryUserData = Element.VertexFactoryUserData;
+	OutKey.FirstIndex = Element.FirstIndex;
+	OutKey.NumPrimitives = Element.NumPrimitives;
+	OutKey.NumInstances = Element.NumInstances;
+	OutKey.BaseVertexIndex = Element.BaseVertexIndex;
+	OutKey.MinVertexIndex = Element.MinVertexIndex;
+	OutKey.MaxVertexIndex = Element.MaxVertexIndex;
+	OutKey.LODAndSegmentIndex = uint32(uint8(Mesh.LODIndex)) | (uint32(Mesh.SegmentIndex) << 8) | (uint32(Element.PrimitiveIdMode) << 16);
+	OutKey.MeshFlags =
+		(Mesh.ReverseCulling << 0) |
+		(Mesh.bDisableBackfaceCulling << 1) |
+		(Mesh.CastShadow << 2) |
+		(Mesh.bUseForMaterial << 3) |
+		(Mesh.bUseForDepthPass << 4) |
+		(Mesh.bUseAsOccluder << 5) |
+		(Mesh.bWireframe << 6) |
+		(Mesh.bDitheredLODTransition << 7) |
+		(Mesh.bRenderToVirtualTexture << 8) |
+		(Mesh.bOverlayMaterial << 9) |
+		(Mesh.CastRayTracedShadow << 10) |
+		(Mesh.Type << 16) |
+		(Mesh.DepthPriorityGroup << 24);
+	OutKey.UserIndex = Element.UserIndex;
+	return true;
+}
+
+bool FDynamicMeshDrawCommandCache::AddCachedCommands(const FMeshBatchAndRelevance& MeshAndRelevance, bool bUseGPUScene, FMeshCommandOneFrameArray& VisibleCommands)
+{
+	FMeshBatchKey Key;
+	if (!GetMeshBatchKey(MeshAndRelevance, bUseGPUScene, Key))
+	{
+		return false;
+	}
+
+	FEntry* Entry = Entries.Find(Key);
+	if (!Entry || !Entry->bRegistered || Entry->Revision != MeshAndRelevance.PrimitiveSceneProxy->GetDynamicMeshElementsRevision())
+	{
+		return false;
+	}
+
+	// The primitive may have moved in the scene arrays and GPU scene since the commands were built
+	const FPrimitiveSceneInfo* PrimitiveSceneInfo = MeshAndRelevance.PrimitiveSceneProxy->GetPrimitiveSceneInfo();
+	const int32 PrimitiveIndex = PrimitiveSceneInfo->GetIndex();
+
+	for (int32 CommandIndex = 0; CommandIndex < Entry->VisibleMeshDrawCommands.Num(); ++CommandIndex)
+	{
+		FVisibleMeshDrawCommand VisibleMeshDrawCommand = Entry->VisibleMeshDrawCommands[CommandIndex];
+		VisibleMeshDrawCommand.MeshDrawCommand = &Entry->MeshDrawCommands[CommandIndex];
+		VisibleMeshDrawCommand.PrimitiveIdInfo.ScenePrimitiveId = PrimitiveIndex;
+		if (bUseGPUScene)
+		{
+			VisibleMeshDrawCommand.PrimitiveIdInfo.DrawPrimitiveId = PrimitiveIndex;
+			VisibleMeshDrawCommand.PrimitiveIdInfo.InstanceSceneDataOffset = PrimitiveSceneInfo->GetInstanceSceneDataOffset();
+		}
+		VisibleCommands.Add(VisibleMeshDrawCommand);
+	}
+
+	Entry->LastUsedFrame = Frame;
+	INC_DWORD_STAT_BY(STAT_DynamicMeshDrawCommandsReused, Entry->VisibleMeshDrawCommands.Num());
+	return true;
+}
+
+void FDynamicMeshDrawCommandCache::CaptureCommands(const FMeshBatchAndRelevance& MeshAndRelevance, bool bUseGPUScene, const FMeshCommandOneFrameArray& VisibleCommands, int32 FirstCommandIndex, const FGraphicsMinimalPipelineStateSet& PipelineStatePassSet)
+{
+	FMeshBatchKey Key;
+	if (!GetMeshBatchKey(MeshAndRelevance, bUseGPUScene, Key))
+	{
+		return;
+	}
+
+	for (int32 CommandIndex = FirstCommandIndex; CommandIndex < VisibleCommands.Num(); ++CommandIndex)
+	{
+		if (VisibleCommands[CommandIndex].PrimitiveIdInfo.bIsDynamicPrimitive || VisibleCommands[CommandIndex].RunArray)
+		{
+			return;
+		}
+	}
+
+	const uint32 Revision = MeshAndRelevance.PrimitiveSceneProxy->GetDynamicMeshElementsRevision();
+	if (FEntry* ExistingEntry = Entries.Find(Key))
+	{
+		if (ExistingEntry->Revision == Revision && ExistingEntry->LastUsedFrame == Frame)
+		{
+			// Same mesh batch gathered twice this frame
+			return;
+		}
+
+		// The pipeline state ids can only be released on the rendering thread
+		StaleEntries.Add(MoveTemp(*ExistingEntry));
+		Entries.Remove(Key);
+	}
+
+	FEntry& Entry = Entries.Add(Key);
+	Entry.Revision = Revision;
+	Entry.LastUsedFrame = Frame;
+
+	const int32 NumCommands = VisibleCommands.Num() - FirstCommandIndex;
+	Entry.MeshDrawCommands.Reserve(NumCommands);
+	Entry.VisibleMeshDrawCommands.Reserve(NumCommands);
+	Entry.PipelineStates.Reserve(NumCommands);
+
+	for (int32 CommandIndex = FirstCommandIndex; CommandIndex < VisibleCommands.Num(); ++CommandIndex)
+	{
+		const FVisibleMeshDrawCommand& VisibleMeshDrawCommand = VisibleCommands[CommandIndex];
+		Entry.MeshDrawCommands.Add(*VisibleMeshDrawCommand.MeshDrawCommand);
+		Entry.VisibleMeshDrawCommands.Add(VisibleMeshDrawCommand);
+		Entry.PipelineStates.Add(VisibleMeshDrawCommand.MeshDrawCommand->CachedPipelineId.GetPipelineState(PipelineStatePassSet));
+	}
+
+	INC_DWORD_STAT_BY(STAT_DynamicMeshDrawCommandsCached, NumCommands);
+}
+
 /**
  * Converts each FMeshBatch into a set of FMeshDrawCommands for a specific mesh pass type.
  */
@@ -580,7 +808,9 @@ void GenerateDynamicMeshDrawCommands(
 	FMeshCommandOneFrameArray& VisibleCommands,
 	FDynamicMeshDrawCommandStorage& MeshDrawCommandStorage,
 	FGraphicsMinimalPipelineStateSet& MinimalPipelineStatePassSet,
-	bool& NeedsShaderInitialisation
+	bool& NeedsShaderInitialisation,
+	FDynamicMeshDrawCommandCache* DynamicMeshDrawCommandCache,
+	bool bUseGPUScene
 )
 {
 	QUICK_SCOPE_CYCLE_COUNTER(STAT_GenerateDynamicMeshDrawCommands);
@@ -606,7 +836,18 @@ void GenerateDynamicMeshDrawCommands(
 				const FMeshBatchAndRelevance& MeshAndRelevance = DynamicMeshElements[MeshIndex];
 				const uint64 BatchElementMask = ~0ull;
 
+				if (DynamicMeshDrawCommandCache && DynamicMeshDrawCommandCache->AddCachedCommands(MeshAndRelevance, bUseGPUScene, VisibleCommands))
+				{
+					continue;
+				}
+
+				const int32 FirstCommandIndex = VisibleCommands.Num();
 				PassMeshProcessor->AddMeshBatch(*MeshAndRelevance.Mesh, BatchElementMask, MeshAndRelevance.PrimitiveSceneProxy);
+
+				if (DynamicMeshDrawCommandCache)
+				{
+					DynamicMeshDrawCommandCache->CaptureCommands(MeshAndRelevance, bUseGPUScene, VisibleCommands, FirstCommandIndex, MinimalPipelineStatePassSet);
+				}
 			}
 		}
 
@@ -883,7 +1124,9 @@ public:
 				Context.MeshDrawCommands,
 				Context.MeshDrawCommandStorage,
 				Context.MinimalPipelineStatePassSet,
-				Context.NeedsShaderInitialisation
+				Context.NeedsShaderInitialisation,
+				Context.DynamicMeshDrawCommandCache,
+				Context.bUseGPUScene
 			);
 		}
 
@@ -1149,7 +1392,8 @@ void FParallelMeshDrawCommandPass::DispatchPassSetup(
 	int32 NumDynamicMeshCommandBuildRequestElements,
 	FMeshCommandOneFrameArray& InOutMeshDrawCommands,
 	FMeshPassProcessor* MobileBasePassCSMMeshPassProcessor,
-	FMeshCommandOneFrameArray* InOutMobileBasePassCSMMeshDrawCommands
+	FMeshCommandOneFrameArray* InOutMobileBasePassCSMMeshDrawCommands,
+	FDynamicMeshDrawCommandCache* DynamicMeshDrawCommandCache
 )
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(ParallelMdcDispatchPassSetup);
@@ -1176,6 +1420,7 @@ void FParallelMeshDrawCommandPass::DispatchPassSetup(
 	TaskContext.DefaultBasePassDepthStencilAccess = Scene->DefaultBasePassDepthStencilAccess;
 	TaskContext.NumDynamicMeshElements = NumDynamicMeshElements;
 	TaskContext.NumDynamicMeshCommandBuildRequestElements = NumDynamicMeshCommandBuildRequestElements;
+	TaskContext.DynamicMeshDrawCommandCache = DynamicMeshDrawCommandCache;
 
 	// Only apply instancing for ISR to main view passes
 
@@ -47,6 +47,99 @@ private:
 
 extern RENDERER_API TGlobalResource<FPrimitiveIdVertexBufferPool> GPrimitiveIdVertexBufferPool;
 
+/**
+ * Keeps the mesh draw commands built for the dynamic mesh elements of one mesh pass of a view across frames.
+ * Only mesh batches of proxies returning true from CanCacheDynamicMeshDrawCommands are cached, and only for passes supporting
+ * cached mesh draw commands as their commands don't depend on the view. Commands are reused as long as the revision of the
+ * proxy's dynamic mesh elements and the gathered mesh batch are unchanged, and dropped when they were not used the previous frame.
+ */
+class FDynamicMeshDrawCommandCache
+{
+public:
+	FDynamicMeshDrawCommandCache() = default;
+	FDynamicMeshDrawCommandCache(const FDynamicMeshDrawCommandCache&) = delete;
+	FDynamicMeshDrawCommandCache& operator=(const FDynamicMeshDrawCommandCache&) = delete;
+	~FDynamicMeshDrawCommandCache();
+
+	/** Called on the rendering thread before dispatching the pass setup. Registers the pipeline states of the commands captured last frame and drops the stale ones. */
+	void BeginFrame();
+
+	/** Drops all the cached commands, rendering thread only. */
+	void Empty();
+
+	/** Adds the cached commands of a mesh batch to the visible commands. Returns false if the commands need to be built. */
+	bool AddCachedCommands(const FMeshBatchAndRelevance& MeshAndRelevance, bool bUseGPUScene, FMeshCommandOneFrameArray& VisibleCommands);
+
+	/** Copies the commands built for a mesh batch, from FirstCommandIndex to the end of the visible commands, so they can be reused on the next frames. */
+	void CaptureCommands(const FMeshBatchAndRelevance& MeshAndRelevance, bool bUseGPUScene, const FMeshCommandOneFrameArray& VisibleCommands, int32 FirstCommandIndex, const FGraphicsMinimalPipelineStateSet& PipelineStatePassSet);
+
+	int32 Num() const { return Entries.Num(); }
+
+private:
+	/** Identifies a mesh batch of a proxy, the cached commands are only reused if neither the proxy nor the batch changed */
+	struct FMeshBatchKey
+	{
+		const FPrimitiveSceneProxy* PrimitiveSceneProxy = nullptr;
+		const FVertexFactory* VertexFactory = nullptr;
+		const FMaterialRenderProxy* MaterialRenderProxy = nullptr;
+		const FLightCacheInterface* LCI = nullptr;
+		const FIndexBuffer* IndexBuffer = nullptr;
+		FRHIUniformBuffer* PrimitiveUniformBuffer = nullptr;
+		const void* UserData = nullptr;
+		const void* VertexFactoryUserData = nullptr;
+		uint32 FirstIndex = 0;
+		uint32 NumPrimitives = 0;
+		uint32 NumInstances = 0;
+		uint32 BaseVertexIndex = 0;
+		uint32 MinVertexIndex = 0;
+		uint32 MaxVertexIndex = 0;
+		uint32 LODAndSegmentIndex = 0;
+		uint32 MeshFlags = 0;
+		int32 UserIndex = 0;
+
+		// Explicit so the key has no uninitialized padding, keys are compared and hashed as memory
+		uint32 Padding = 0;
+
+		bool operator==(const FMeshBatchKey& Other) const
+		{
+			return FMemory::Memcmp(this, &Other, sizeof(FMeshBatchKey)) == 0;
+		}
+
+		friend uint32 GetTypeHash(const FMeshBatchKey& Key)
+		{
+			return FCrc::MemCrc32(&Key, sizeof(FMeshBatchKey));
+		}
+	};
+
+	struct FEntry
+	{
+		/** Revision of the proxy's dynamic mesh elements the commands were built for */
+		uint32 Revision = 0;
+		uint32 LastUsedFrame = 0;
+
+		/** Whether the commands use persistent pipeline state ids, which happens in BeginFrame after they are captured */
+		bool bRegistered = false;
+
+		TArray<FMeshDrawCommand> MeshDrawCommands;
+		TArray<FVisibleMeshDrawCommand> VisibleMeshDrawCommands;
+
+		/** Pipeline states of the captured commands, until they are registered */
+		TArray<FGraphicsMinimalPipelineStateInitializer> PipelineStates;
+	};
+
+	/** Returns false if the batch can't be cached */
+	static bool GetMeshBatchKey(const FMeshBatchAndRelevance& MeshAndRelevance, bool bUseGPUScene, FMeshBatchKey& OutKey);
+
+	static void ReleaseEntry(FEntry& Entry);
+
+	TMap<FMeshBatchKey, FEntry> Entries;
+
+	/** Entries replaced by the pass setup task, released on the rendering thread in the next BeginFrame */
+	TArray<FEntry> StaleEntries;
+
+	uint32 Frame = 0;
+};
+
 /**	
  * Parallel mesh draw command pass setup task context.
  */
@@ -76,6 +169,7 @@ public:
 		, VisibleMeshDrawCommandsNum(0)
 		, NewPassVisibleMeshDrawCommandsNum(0)
 		, MaxInstances(1)
+		, DynamicMeshDrawCommandCache(nullptr)
 	{
 	}
 
@@ -129,6 +223,9 @@ public:
 
 	FInstanceCullingContext InstanceCullingContext;
 	FInstanceCullingResult InstanceCullingResult;
+
+	// Reuses the commands of the dynamic mesh elements built on previous frames, may be null.
+	FDynamicMeshDrawCommandCache* DynamicMeshDrawCommandCache;
 };
 
 /**
@@ -171,7 +268,8 @@ public:
 		int32 NumDynamicMeshCommandBuildRequestElements,
 		FMeshCommandOneFrameArray& InOutMeshDrawCommands,
 		FMeshPassProcessor* MobileBasePassCSMMeshPassProcessor = nullptr, // Required only for the mobile base pass.
-		FMeshCommandOneFrameArray* InOutMobileBasePassCSMMeshDrawCommands = nullptr // Required only for the mobile base pass.
+		FMeshCommandOneFrameArray* InOutMobileBasePassCSMMeshDrawCommands = nullptr, // Required only for the mobile base pass.
+		FDynamicMeshDrawCommandCache* DynamicMeshDrawCommandCache = nullptr // Optional, must have been prepared with BeginFrame.
 	);
 
 	/**
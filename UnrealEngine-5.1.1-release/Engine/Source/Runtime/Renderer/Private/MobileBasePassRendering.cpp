@@ -21,6 +21,8 @@
 #include "LocalLightSceneProxy.h"
 #include "ReflectionEnvironment.h"
 
+DECLARE_CYCLE_STAT(TEXT("MobileBasePass"), STAT_CLP_MobileBasePass, STATGROUP_ParallelCommandListMarkers);
+
 // Changing this causes a full shader recompile
 static TAutoConsoleVariable<int32> CVarMobileDisableVertexFog(
 	TEXT("r.Mobile.DisableVertexFog"),
@@ -330,7 +332,30 @@ void FMobileSceneRenderer::RenderMobileBasePass(FRHICommandListImmediate& RHICmd
 		View.ParallelMeshDrawCommandPasses[EMeshPass::SkyPass].DispatchDraw(nullptr, RHICmdList, &MeshPassInstanceCullingDrawParams[EMeshPass::SkyPass]);
 	}
 
-	// editor primitives
+	RenderMobileBasePassEditorPrimitives(RHICmdList, View);
+}
+
+void FMobileSceneRenderer::RenderMobileBasePassParallel(const FRDGPass* InPass, FRHICommandListImmediate& RHICmdList, const FViewInfo& View, const FParallelCommandListBindings& Bindings)
+{
+	CSV_SCOPED_TIMING_STAT_EXCLUSIVE(RenderBasePass);
+	SCOPED_DRAW_EVENT(RHICmdList, MobileBasePassParallel);
+	SCOPE_CYCLE_COUNTER(STAT_BasePassDrawTime);
+	SCOPED_GPU_STAT(RHICmdList, Basepass);
+
+	{
+		FRDGParallelCommandListSet ParallelCommandListSet(InPass, RHICmdList, GET_STATID(STAT_CLP_MobileBasePass), *this, View, Bindings);
+		View.ParallelMeshDrawCommandPasses[EMeshPass::BasePass].DispatchDraw(&ParallelCommandListSet, RHICmdList, &MeshPassInstanceCullingDrawParams[EMeshPass::BasePass]);
+	}
+
+	if (View.Family->EngineShowFlags.Atmosphere)
+	{
+		FRDGParallelCommandListSet ParallelCommandListSet(InPass, RHICmdList, GET_STATID(STAT_CLP_MobileBasePass), *this, View, Bindings);
+		View.ParallelMeshDrawCommandPasses[EMeshPass::SkyPass].DispatchDraw(&ParallelCommandListSet, RHICmdList, &MeshPassInstanceCullingDrawParams[EMeshPass::SkyPass]);
+	}
+}
+
+void FMobileSceneRenderer::RenderMobileBasePassEditorPrimitives(FRHICommandList& RHICmdList, const FViewInfo& View)
+{
 	FMeshPassProcessorRenderState DrawRenderState;
 	DrawRenderState.SetBlendState(TStaticBlendStateWriteMask<CW_RGBA>::GetRHI());
 	DrawRenderState.SetDepthStencilAccess(Scene->DefaultBasePassDepthStencilAccess);
@@ -84,6 +84,14 @@ static TAutoConsoleVariable<int32> CVarMobileCustomDepthForTranslucency(
 	TEXT(" 1 = On [default]"),
 	ECVF_Scalability | ECVF_RenderThreadSafe);
 
+static TAutoConsoleVariable<int32> CVarMobileParallelBasePass(
+	TEXT("r.Mobile.ParallelBasePass"),
+	0,
+	TEXT("Toggles parallel recording of the mobile opaque base pass and sky pass when scene color is rendered in multiple render passes.\n")
+	TEXT("The base pass then gets a render pass of its own, which costs an extra render target store and load on tiled GPUs. Only worth it when the render thread is the bottleneck and the RHI records command lists in parallel (Vulkan, Metal).\n")
+	TEXT("Parallel rendering must be enabled for this to have an effect. The single render pass path is always recorded serially, its subpasses can't be split across command lists."),
+	ECVF_RenderThreadSafe);
+
 DECLARE_GPU_STAT_NAMED(MobileSceneRender, TEXT("Mobile Scene Render"));
 
 DECLARE_CYCLE_STAT(TEXT("SceneStart"), STAT_CLMM_SceneStart, STATGROUP_CommandListMarkers);
@@ -1258,29 +1266,36 @@ void FMobileSceneRenderer::RenderForwardSinglePass(FRDGBuilder& GraphBuilder, FM
 
 void FMobileSceneRenderer::RenderForwardMultiPass(FRDGBuilder& GraphBuilder, FMobileRenderPassParameters* PassParameters, FRenderTargetBindingSlots& BasePassRenderTargets, FRenderViewContext& ViewContext, FSceneTextures& SceneTextures)
 {
-	GraphBuilder.AddPass(
-		RDG_EVENT_NAME("SceneColorRendering"),
-		PassParameters,
-		ERDGPassFlags::Raster,
-		[this, PassParameters, ViewContext, &SceneTextures](FRHICommandListImmediate& RHICmdList)
+	if (GRHICommandList.UseParallelAlgorithms() && CVarMobileParallelBasePass.GetValueOnRenderThread())
 	{
-		FViewInfo& View = *ViewContext.ViewInfo;
-			
-		if (GIsEditor && !View.bIsSceneCapture && ViewContext.bIsFirstView)
+		RenderForwardMultiPassParallel(GraphBuilder, PassParameters, ViewContext);
+	}
+	else
+	{
+		GraphBuilder.AddPass(
+			RDG_EVENT_NAME("SceneColorRendering"),
+			PassParameters,
+			ERDGPassFlags::Raster,
+			[this, PassParameters, ViewContext, &SceneTextures](FRHICommandListImmediate& RHICmdList)
 		{
-			DrawClearQuad(RHICmdList, View.BackgroundColor);
-		}
+			FViewInfo& View = *ViewContext.ViewInfo;
+			
+			if (GIsEditor && !View.bIsSceneCapture && ViewContext.bIsFirstView)
+			{
+				DrawClearQuad(RHICmdList, View.BackgroundColor);
+			}
 
-		// Depth pre-pass
-		RHICmdList.SetCurrentStat(GET_STATID(STAT_CLM_MobilePrePass));
-		RenderMaskedPrePass(RHICmdList, View);
-		// Opaque and masked
-		RHICmdList.SetCurrentStat(GET_STATID(STAT_CLMM_Opaque));
-		RenderMobileBasePass(RHICmdList, View);
-		RenderMobileDebugView(RHICmdList, View);
-		RHICmdList.PollOcclusionQueries();
-		PostRenderBasePass(RHICmdList, View);
-	});
+			// Depth pre-pass
+			RHICmdList.SetCurrentStat(GET_STATID(STAT_CLM_MobilePrePass));
+			RenderMaskedPrePass(RHICmdList, View);
+			// Opaque and masked
+			RHICmdList.SetCurrentStat(GET_STATID(STAT_CLMM_Opaque));
+			RenderMobileBasePass(RHICmdList, View);
+			RenderMobileDebugView(RHICmdList, View);
+			RHICmdList.PollOcclusionQueries();
+			PostRenderBasePass(RHICmdList, View);
+		});
+	}
 
 	FViewInfo& View = *ViewContext.ViewInfo;
 
@@ -1350,6 +1365,69 @@ void FMobileSceneRenderer::RenderForwardMultiPass(FRDGBuilder& GraphBuilder, FMo
 	AddResolveSceneColorPass(GraphBuilder, View, SceneTextures.Color);
 }
 
+void FMobileSceneRenderer::RenderForwardMultiPassParallel(FRDGBuilder& GraphBuilder, FMobileRenderPassParameters* PassParameters, FRenderViewContext& ViewContext)
+{
+	GraphBuilder.AddPass(
+		RDG_EVENT_NAME("SceneColorRendering"),
+		PassParameters,
+		ERDGPassFlags::Raster,
+		[this, PassParameters, ViewContext](FRHICommandListImmediate& RHICmdList)
+	{
+		FViewInfo& View = *ViewContext.ViewInfo;
+
+		if (GIsEditor && !View.bIsSceneCapture && ViewContext.bIsFirstView)
+		{
+			DrawClearQuad(RHICmdList, View.BackgroundColor);
+		}
+
+		// Depth pre-pass
+		RHICmdList.SetCurrentStat(GET_STATID(STAT_CLM_MobilePrePass));
+		RenderMaskedPrePass(RHICmdList, View);
+	});
+
+	// The following passes continue rendering to the targets of the first one
+	FMobileRenderPassParameters* LoadPassParameters = GraphBuilder.AllocParameters<FMobileRenderPassParameters>();
+	*LoadPassParameters = *PassParameters;
+	for (int32 Index = 0; Index < MaxSimultaneousRenderTargets; ++Index)
+	{
+		if (LoadPassParameters->RenderTargets[Index].GetTexture())
+		{
+			LoadPassParameters->RenderTargets[Index].SetLoadAction(ERenderTargetLoadAction::ELoad);
+		}
+	}
+	LoadPassParameters->RenderTargets.DepthStencil.SetDepthLoadAction(ERenderTargetLoadAction::ELoad);
+	LoadPassParameters->RenderTargets.DepthStencil.SetStencilLoadAction(ERenderTargetLoadAction::ELoad);
+	LoadPassParameters->RenderTargets.NumOcclusionQueries = 0;
+
+	GraphBuilder.AddPass(
+		RDG_EVENT_NAME("MobileBasePassParallel"),
+		LoadPassParameters,
+		ERDGPassFlags::Raster | ERDGPassFlags::SkipRenderPass,
+		[this, LoadPassParameters, ViewContext](const FRDGPass* InPass, FRHICommandListImmediate& RHICmdList)
+	{
+		FViewInfo& View = *ViewContext.ViewInfo;
+
+		// Opaque and masked
+		RHICmdList.SetCurrentStat(GET_STATID(STAT_CLMM_Opaque));
+		RenderMobileBasePassParallel(InPass, RHICmdList, View, FParallelCommandListBindings(LoadPassParameters));
+	});
+
+	GraphBuilder.AddPass(
+		RDG_EVENT_NAME("SceneColorRenderingEnd"),
+		LoadPassParameters,
+		ERDGPassFlags::Raster,
+		[this, ViewContext](FRHICommandListImmediate& RHICmdList)
+	{
+		FViewInfo& View = *ViewContext.ViewInfo;
+
+		RHICmdList.SetViewport(View.ViewRect.Min.X, View.ViewRect.Min.Y, 0, View.ViewRect.Max.X, View.ViewRect.Max.Y, 1);
+		RenderMobileBasePassEditorPrimitives(RHICmdList, View);
+		RenderMobileDebugView(RHICmdList, View);
+		RHICmdList.PollOcclusionQueries();
+		PostRenderBasePass(RHICmdList, View);
+	});
+}
+
 class FMobileDeferredCopyPLSPS : public FGlobalShader
 {
 	DECLARE_SHADER_TYPE(FMobileDeferredCopyPLSPS, Global);
@@ -7,6 +7,7 @@
 #include "PixelShaderUtils.h"
 #include "ShaderPrintParameters.h"
 #include "Rendering/NaniteStreamingManager.h"
+#include "ContentStreaming.h"
 #include "VirtualShadowMaps/VirtualShadowMapCacheManager.h"
 
 #define NUM_PRINT_STATS_PASSES 4
@@ -26,6 +27,38 @@ FAutoConsoleVariableRef CVarNaniteStatsFilter(
 	ECVF_RenderThreadSafe
 );
 
+int32 GNaniteStreamingPrediction = 0;
+FAutoConsoleVariableRef CVarNaniteStreamingPrediction(
+	TEXT("r.Nanite.Streaming.Prediction"),
+	GNaniteStreamingPrediction,
+	TEXT("Request streaming pages for Nanite meshes the camera is predicted to get closer to, from its velocity and from the streaming view locations (sequencer camera cuts, AddViewLocation)."),
+	ECVF_RenderThreadSafe
+);
+
+float GNaniteStreamingPredictionLookAheadTime = 0.3f;
+FAutoConsoleVariableRef CVarNaniteStreamingPredictionLookAheadTime(
+	TEXT("r.Nanite.Streaming.Prediction.LookAheadTime"),
+	GNaniteStreamingPredictionLookAheadTime,
+	TEXT("How far ahead in seconds the camera position is extrapolated from its velocity."),
+	ECVF_RenderThreadSafe
+);
+
+float GNaniteStreamingPredictionMinSpeed = 500.0f;
+FAutoConsoleVariableRef CVarNaniteStreamingPredictionMinSpeed(
+	TEXT("r.Nanite.Streaming.Prediction.MinSpeed"),
+	GNaniteStreamingPredictionMinSpeed,
+	TEXT("Camera speed in units per second below which no velocity prediction is made."),
+	ECVF_RenderThreadSafe
+);
+
+float GNaniteStreamingPredictionMinScreenSize = 0.05f;
+FAutoConsoleVariableRef CVarNaniteStreamingPredictionMinScreenSize(
+	TEXT("r.Nanite.Streaming.Prediction.MinScreenSize"),
+	GNaniteStreamingPredictionMinScreenSize,
+	TEXT("Minimum ratio of bounds radius to distance from a predicted location for a mesh to be requested."),
+	ECVF_RenderThreadSafe
+);
+
 extern TAutoConsoleVariable<int32> CVarNaniteShadows;
 
 bool bNaniteListStatFilters = false;
@@ -774,4 +807,90 @@ void EmitCubemapShadow(
 	);
 }
 
+void GatherStreamingPredictionOrigins(TArray<FVector, TInlineAllocator<2>>& OutOrigins)
+{
+	check(IsInGameThread());
+
+	OutOrigins.Reset();
+	if (GNaniteStreamingPrediction)
+	{
+		// View locations added for upcoming camera cuts and prestreaming, the ones at the current camera don't predict anything and are skipped later
+		const IStreamingManager& StreamingManager = IStreamingManager::Get();
+		for (int32 ViewIndex = 0; ViewIndex < StreamingManager.GetNumViews(); ViewIndex++)
+		{
+			OutOrigins.Add(StreamingManager.GetViewInformation(ViewIndex).ViewOrigin);
+		}
+	}
+}
+
+void AddPredictedStreamingRequests(const FScene& Scene, const FViewInfo& View, float DeltaWorldTime, TConstArrayView<FVector> HintOrigins)
+{
+	if (!GNaniteStreamingPrediction || View.bIsSceneCapture || View.bIsReflectionCapture)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(Nanite::AddPredictedStreamingRequests);
+
+	const FVector ViewOrigin = View.ViewMatrices.GetViewOrigin();
+
+	TArray<FVector, TInlineAllocator<4>> PredictedOrigins;
+	if (View.ViewState && !View.bCameraCut && DeltaWorldTime > 0.0f)
+	{
+		// ViewState still holds last frame's view as InitViews has not run yet
+		const FVector CameraVelocity = (ViewOrigin - View.ViewState->PrevFrameViewInfo.ViewMatrices.GetViewOrigin()) / DeltaWorldTime;
+		if (CameraVelocity.SizeSquared() > FMath::Square(GNaniteStreamingPredictionMinSpeed))
+		{
+			PredictedOrigins.Add(ViewOrigin + CameraVelocity * GNaniteStreamingPredictionLookAheadTime);
+		}
+	}
+	PredictedOrigins.Append(HintOrigins.GetData(), HintOrigins.Num());
+
+	if (PredictedOrigins.Num() == 0)
+	{
+		return;
+	}
+
+	TMap<uint32, float, SceneRenderingSetAllocator> ResourcePriorities;
+	for (int32 PrimitiveIndex = 0; PrimitiveIndex < Scene.PrimitiveSceneProxies.Num(); PrimitiveIndex++)
+	{
+		const FPrimitiveSceneProxy* Proxy = Scene.PrimitiveSceneProxies[PrimitiveIndex];
+		if (!Proxy->IsNaniteMesh())
+		{
+			continue;
+		}
+
+		const FBoxSphereBounds& Bounds = Scene.PrimitiveBounds[PrimitiveIndex].BoxSphereBounds;
+		const float Radius = FMath::Max<float>(Bounds.SphereRadius, UE_KINDA_SMALL_NUMBER);
+		const float CurrentScreenSize = Radius / FMath::Max<float>(FVector::Dist(ViewOrigin, Bounds.Origin), Radius);
+
+		// Only meshes getting larger on screen need more pages than what the GPU feedback asks for this frame
+		float Priority = 0.0f;
+		for (const FVector& PredictedOrigin : PredictedOrigins)
+		{
+			const float PredictedScreenSize = Radius / FMath::Max<float>(FVector::Dist(PredictedOrigin, Bounds.Origin), Radius);
+			if (PredictedScreenSize > CurrentScreenSize && PredictedScreenSize >= GNaniteStreamingPredictionMinScreenSize)
+			{
+				Priority = FMath::Max(Priority, PredictedScreenSize);
+			}
+		}
+
+		if (Priority > 0.0f)
+		{
+			uint32 ResourceID = 0;
+			uint32 HierarchyOffset = 0;
+			uint32 ImposterIndex = 0;
+			Proxy->GetNaniteResourceInfo(ResourceID, HierarchyOffset, ImposterIndex);
+
+			float& ResourcePriority = ResourcePriorities.FindOrAdd(ResourceID, 0.0f);
+			ResourcePriority = FMath::Max(ResourcePriority, Priority);
+		}
+	}
+
+	for (const TPair<uint32, float>& ResourcePriority : ResourcePriorities)
+	{
+		GStreamingManager.PredictResource(ResourcePriority.Key, ResourcePriority.Value);
+	}
+}
+
 } // namespace Nanite
@@ -35,6 +35,17 @@ void PrintStats(
 	const FViewInfo& View
 );
 
+/** Collects the streaming view locations on the game thread, used as predicted camera locations by AddPredictedStreamingRequests. */
+void GatherStreamingPredictionOrigins(TArray<FVector, TInlineAllocator<2>>& OutOrigins);
+
+/** Requests streaming pages for the meshes the view is predicted to get closer to, from its velocity and the given hint locations. */
+void AddPredictedStreamingRequests(
+	const FScene& Scene,
+	const FViewInfo& View,
+	float DeltaWorldTime,
+	TConstArrayView<FVector> HintOrigins
+);
+
 void ExtractResults(
 	FRDGBuilder& GraphBuilder,
 	const FCullingContext& CullingContext,
@@ -27,6 +27,7 @@ TAutoConsoleVariable<int32> CVarPathTracing(
 #include "Modules/ModuleManager.h"
 #include <limits>
 #include "PathTracingSpatialTemporalDenoising.h"
+#include "RHIGPUReadback.h"
 
 TAutoConsoleVariable<int32> CVarPathTracingCompaction(
 	TEXT("r.PathTracing.Compaction"),
@@ -285,6 +286,38 @@ TAutoConsoleVariable<int32> CVarPathTracingLightFunctionColor(
 	ECVF_RenderThreadSafe
 );
 
+TAutoConsoleVariable<int32> CVarPathTracingAdaptiveSampling(
+	TEXT("r.PathTracing.AdaptiveSampling"),
+	0,
+	TEXT("Enables adaptive sampling, tiles stop accumulating samples once their noise estimate is below r.PathTracing.AdaptiveSampling.ErrorThreshold (default = 0)\n")
+	TEXT("Only used when rendering with a single GPU."),
+	ECVF_RenderThreadSafe
+);
+
+TAutoConsoleVariable<float> CVarPathTracingAdaptiveSamplingErrorThreshold(
+	TEXT("r.PathTracing.AdaptiveSampling.ErrorThreshold"),
+	0.01f,
+	TEXT("Average per pixel error of a tile under which it is considered converged, estimated from the difference with the accumulation of half of the samples (default = 0.01)"),
+	ECVF_RenderThreadSafe
+);
+
+TAutoConsoleVariable<int32> CVarPathTracingAdaptiveSamplingMinSamples(
+	TEXT("r.PathTracing.AdaptiveSampling.MinSamples"),
+	32,
+	TEXT("Samples each tile accumulates before it can be considered converged (default = 32)"),
+	ECVF_RenderThreadSafe
+);
+
+TAutoConsoleVariable<int32> CVarPathTracingAdaptiveSamplingTileSize(
+	TEXT("r.PathTracing.AdaptiveSampling.TileSize"),
+	128,
+	TEXT("Size in pixels of the tiles traced and converged independently when adaptive sampling is enabled (default = 128)"),
+	ECVF_RenderThreadSafe
+);
+
+CSV_DEFINE_CATEGORY(PathTracing, true);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Path Tracing MSamples/s"), STAT_PathTracingMSamplesPerSecond, STATGROUP_SceneRendering);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Path Tracing Converged Tiles"), STAT_PathTracingConvergedTiles, STATGROUP_SceneRendering);
 
 BEGIN_SHADER_PARAMETER_STRUCT(FPathTracingData, )
 	SHADER_PARAMETER(float, BlendFactor)
@@ -327,6 +360,8 @@ struct FPathTracingConfig
 	bool UseMISCompensation;
 	bool LockedSamplingPattern;
 	bool UseMultiGPU; // NOTE: Requires invalidation because the buffer layout changes
+	bool UseAdaptiveSampling;
+	int AdaptiveSamplingTileSize;
 	int DenoiserMode; // NOTE: does not require path tracing invalidation
 
 	bool IsDifferent(const FPathTracingConfig& Other) const
@@ -359,7 +394,9 @@ struct FPathTracingConfig
 			VisibleLights != Other.VisibleLights ||
 			UseMISCompensation != Other.UseMISCompensation ||
 			LockedSamplingPattern != Other.LockedSamplingPattern ||
-			UseMultiGPU != Other.UseMultiGPU;
+			UseMultiGPU != Other.UseMultiGPU ||
+			UseAdaptiveSampling != Other.UseAdaptiveSampling ||
+			AdaptiveSamplingTileSize != Other.AdaptiveSamplingTileSize;
 	}
 
 	bool IsDOFDifferent(const FPathTracingConfig& Other) const
@@ -408,6 +445,100 @@ struct FAtmosphereConfig
 	uint32 Resolution;
 };
 
+// Per tile sample counts and convergence of the adaptive sampling
+struct FPathTracingAdaptiveSampling
+{
+	static constexpr float ErrorFixedPointScale = 1000000.0f;
+
+	struct FPendingReadback
+	{
+		TUniquePtr<FRHIGPUBufferReadback> Readback;
+		TArray<uint32> TileIndices;
+		uint32 Epoch = 0;
+	};
+
+	FIntPoint TileCount = FIntPoint::ZeroValue;
+	int32 TileSize = 0;
+	TArray<uint32> TileSampleCounts;
+	TBitArray<> TileConverged;
+	int32 NumConvergedTiles = 0;
+
+	// Luminance of the accumulated radiance and of the accumulation of every other sample
+	TRefCountPtr<IPooledRenderTarget> LuminanceRT;
+
+	// Tile errors read back to the CPU, a few frames late. Readbacks from before the last reset are ignored.
+	TArray<FPendingReadback> PendingReadbacks;
+	uint32 Epoch = 0;
+
+	int32 GetNumTiles() const { return TileCount.X * TileCount.Y; }
+
+	void Reset()
+	{
+		TileSampleCounts.Reset();
+		TileConverged.Reset();
+		NumConvergedTiles = 0;
+		LuminanceRT.SafeRelease();
+		++Epoch;
+	}
+
+	void Init(FIntPoint Resolution, int32 InTileSize)
+	{
+		const FIntPoint NewTileCount = FIntPoint::DivideAndRoundUp(Resolution, InTileSize);
+		if (NewTileCount != TileCount || InTileSize != TileSize || TileSampleCounts.Num() != GetNumTiles())
+		{
+			Reset();
+			TileCount = NewTileCount;
+			TileSize = InTileSize;
+		}
+		if (TileSampleCounts.Num() != GetNumTiles())
+		{
+			TileSampleCounts.SetNumZeroed(GetNumTiles());
+			TileConverged.Init(false, GetNumTiles());
+		}
+	}
+
+	bool NeedsSamples(int32 TileIndex, uint32 MaxSPP) const
+	{
+		return !TileConverged[TileIndex] && TileSampleCounts[TileIndex] < MaxSPP;
+	}
+
+	bool IsComplete(uint32 MaxSPP) const
+	{
+		for (int32 TileIndex = 0; TileIndex < GetNumTiles(); TileIndex++)
+		{
+			if (NeedsSamples(TileIndex, MaxSPP))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void ProcessReadbacks(uint32 MinSamples, float ErrorThreshold)
+	{
+		while (PendingReadbacks.Num() > 0 && PendingReadbacks[0].Readback->IsReady())
+		{
+			FPendingReadback& Pending = PendingReadbacks[0];
+			if (Pending.Epoch == Epoch)
+			{
+				const uint32* TileErrors = static_cast<const uint32*>(Pending.Readback->Lock(GetNumTiles() * sizeof(uint32)));
+				for (uint32 TileIndex : Pending.TileIndices)
+				{
+					// Sample counts only grow until the next reset, so the count is at least the one the error was measured with
+					const float TileError = float(TileErrors[TileIndex]) / ErrorFixedPointScale;
+					if (!TileConverged[TileIndex] && TileSampleCounts[TileIndex] >= MinSamples && TileError < ErrorThreshold)
+					{
+						TileConverged[TileIndex] = true;
+						NumConvergedTiles++;
+					}
+				}
+				Pending.Readback->Unlock();
+			}
+			PendingReadbacks.RemoveAt(0);
+		}
+	}
+};
+
 struct FPathTracingState {
 	FPathTracingConfig LastConfig;
 	// Textures holding onto the accumulated frame data
@@ -416,6 +547,8 @@ struct FPathTracingState {
 	TRefCountPtr<IPooledRenderTarget> NormalRT;
 	TRefCountPtr<FRDGPooledBuffer> VarianceBuffer;
 
+	FPathTracingAdaptiveSampling AdaptiveSampling;
+
 	// Cache to improve the stability when frame denoising (SPP=r.pathtracing.SamplesPerPixel) is used in animation rendering
 	TRefCountPtr<IPooledRenderTarget> LastDenoisedRadianceRT;
 	TRefCountPtr<IPooledRenderTarget> LastRadianceRT;
@@ -433,6 +566,10 @@ struct FPathTracingState {
 	// Path tracer frame index, not reset on invalidation unlike SampleIndex to avoid
 	// the "screen door" effect and reduce temporal aliasing
 	uint32_t FrameIndex = 0;
+
+	// Throughput of the current accumulation
+	double AccumulationStartTime = 0.0;
+	uint64 NumPixelSamplesTraced = 0;
 };
 
 namespace PathTracing
@@ -837,6 +974,36 @@ class FPathTracingSwizzleScanlinesCS : public FGlobalShader
 };
 IMPLEMENT_SHADER_TYPE(, FPathTracingSwizzleScanlinesCS, TEXT("/Engine/Private/PathTracing/PathTracingSwizzleScanlines.usf"), TEXT("PathTracingSwizzleScanlinesCS"), SF_Compute);
 
+class FPathTracingAdaptiveSamplingCS : public FGlobalShader
+{
+	DECLARE_GLOBAL_SHADER(FPathTracingAdaptiveSamplingCS)
+	SHADER_USE_PARAMETER_STRUCT(FPathTracingAdaptiveSamplingCS, FGlobalShader)
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return ShouldCompileRayTracingShadersForProject(Parameters.Platform);
+	}
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		OutEnvironment.CompilerFlags.Add(CFLAG_WarningsAsErrors);
+		OutEnvironment.SetDefine(TEXT("THREADGROUPSIZE_X"), FComputeShaderUtils::kGolden2DGroupSize);
+		OutEnvironment.SetDefine(TEXT("THREADGROUPSIZE_Y"), FComputeShaderUtils::kGolden2DGroupSize);
+	}
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER(FIntPoint, TileOffset)
+		SHADER_PARAMETER(FIntPoint, TileSize)
+		SHADER_PARAMETER(uint32, TileIndex)
+		SHADER_PARAMETER(uint32, TileSampleIndex)
+		SHADER_PARAMETER(float, ErrorScale)
+		SHADER_PARAMETER_RDG_TEXTURE_SRV(Texture2D, RadianceTexture)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D, RWLuminanceTexture)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint>, RWTileErrors)
+	END_SHADER_PARAMETER_STRUCT()
+};
+IMPLEMENT_SHADER_TYPE(, FPathTracingAdaptiveSamplingCS, TEXT("/Engine/Private/PathTracing/PathTracingAdaptiveSampling.usf"), TEXT("PathTracingAdaptiveSamplingCS"), SF_Compute);
+
 
 class FPathTracingBuildAtmosphereOpticalDepthLUTCS : public FGlobalShader
 {
@@ -1960,6 +2127,7 @@ void FSceneViewState::PathTracingInvalidate(bool InvalidateAnimationStates)
 		State->AlbedoRT.SafeRelease();
 		State->NormalRT.SafeRelease();
 		State->VarianceBuffer.SafeRelease();
+		State->AdaptiveSampling.Reset();
 		State->SampleIndex = 0;
 	}
 }
@@ -2173,6 +2341,8 @@ void FDeferredShadingSceneRenderer::RenderPathTracing(
 #else
 	Config.UseMultiGPU = false;
 #endif
+	Config.UseAdaptiveSampling = CVarPathTracingAdaptiveSampling.GetValueOnRenderThread() != 0;
+	Config.AdaptiveSamplingTileSize = Config.UseAdaptiveSampling ? FMath::Max(CVarPathTracingAdaptiveSamplingTileSize.GetValueOnRenderThread(), 16) : 0;
 
 	// If the scene has changed in some way (camera move, object movement, etc ...)
 	// we must invalidate the ViewState to start over from scratch
@@ -2227,6 +2397,41 @@ void FDeferredShadingSceneRenderer::RenderPathTracing(
 	const int32 FramePassCount = 1;
 #endif
 
+	// Adaptive sampling traces and converges each tile independently. With several GPUs the tiles are split in scanlines, so it only applies to a single GPU.
+	const bool bAdaptiveSampling = Config.UseAdaptiveSampling && NumGPUs == 1;
+	const int32 TraceTileSize = bAdaptiveSampling ? Config.AdaptiveSamplingTileSize : DispatchSize;
+	FPathTracingAdaptiveSampling& AdaptiveSampling = PathTracingState->AdaptiveSampling;
+	FRDGTexture* AdaptiveLuminanceTexture = nullptr;
+	if (bAdaptiveSampling)
+	{
+		AdaptiveSampling.Init(View.ViewRect.Size(), TraceTileSize);
+		AdaptiveSampling.ProcessReadbacks(FMath::Max(CVarPathTracingAdaptiveSamplingMinSamples.GetValueOnRenderThread(), 2), CVarPathTracingAdaptiveSamplingErrorThreshold.GetValueOnRenderThread());
+
+		if (AdaptiveSampling.LuminanceRT)
+		{
+			AdaptiveLuminanceTexture = GraphBuilder.RegisterExternalTexture(AdaptiveSampling.LuminanceRT, TEXT("PathTracer.AdaptiveLuminance"));
+		}
+		else
+		{
+			FRDGTextureDesc Desc = FRDGTextureDesc::Create2D(View.ViewRect.Size(), PF_G32R32F, FClearValueBinding::None, TexCreate_ShaderResource | TexCreate_UAV);
+			AdaptiveLuminanceTexture = GraphBuilder.CreateTexture(Desc, TEXT("PathTracer.AdaptiveLuminance"), ERDGTextureFlags::MultiFrame);
+		}
+
+		if (PathTracingState->SampleIndex + 1 < MaxSPP && AdaptiveSampling.IsComplete(MaxSPP))
+		{
+			// Every tile converged: skip to the last sample so the render completes (and gets denoised) as if all samples were taken
+			PathTracingState->SampleIndex = MaxSPP - 1;
+		}
+		SET_DWORD_STAT(STAT_PathTracingConvergedTiles, AdaptiveSampling.NumConvergedTiles);
+		CSV_CUSTOM_STAT(PathTracing, ConvergedTiles, AdaptiveSampling.NumConvergedTiles, ECsvCustomStatOp::Set);
+	}
+
+	if (PathTracingState->SampleIndex == 0)
+	{
+		PathTracingState->AccumulationStartTime = FPlatformTime::Seconds();
+		PathTracingState->NumPixelSamplesTraced = 0;
+	}
+
 	bool bNeedsMoreRays = false;
 	bool bNeedsTextureExtract = false;
 
@@ -2284,6 +2489,15 @@ void FDeferredShadingSceneRenderer::RenderPathTracing(
 			PermutationVector.Set<FPathTracingRG::FCompactionType>(CompactionType);
 			TShaderMapRef<FPathTracingRG> RayGenShader(View.ShaderMap, PermutationVector);
 			FPathTracingRG::FParameters* PreviousPassParameters = nullptr;
+
+			FRDGBuffer* AdaptiveTileErrors = nullptr;
+			TArray<uint32> AdaptiveTracedTiles;
+			if (bAdaptiveSampling)
+			{
+				AdaptiveTileErrors = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32), AdaptiveSampling.GetNumTiles()), TEXT("PathTracer.AdaptiveTileErrors"));
+				AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(AdaptiveTileErrors, PF_R32_UINT), 0);
+			}
+
 			// Divide each tile among all the active GPUs (interleaving scanlines)
 			// The assumption is that the tiles are as big as possible, hopefully covering the entire screen
 			// so rather than dividing tiles among GPUs, we divide each tile among all GPUs
@@ -2295,17 +2509,24 @@ void FDeferredShadingSceneRenderer::RenderPathTracing(
 				RDG_EVENT_SCOPE(GraphBuilder, "Path Tracing GPU%d", GPUIndex);
 				RDG_GPU_STAT_SCOPE(GraphBuilder, Stat_GPU_PathTracing);
 #endif
-				for (int32 TileY = 0; TileY < DispatchResY; TileY += DispatchSize)
+				for (int32 TileY = 0; TileY < DispatchResY; TileY += TraceTileSize)
 				{
-					for (int32 TileX = 0; TileX < DispatchResX; TileX += DispatchSize)
+					for (int32 TileX = 0; TileX < DispatchResX; TileX += TraceTileSize)
 					{
-						const int32 DispatchSizeX = FMath::Min(DispatchSize, DispatchResX - TileX);
-						const int32 DispatchSizeY = FMath::Min(DispatchSize, DispatchResY - TileY);
+						const int32 DispatchSizeX = FMath::Min(TraceTileSize, DispatchResX - TileX);
+						const int32 DispatchSizeY = FMath::Min(TraceTileSize, DispatchResY - TileY);
 
 						const int32 DispatchSizeYSplit = FMath::DivideAndRoundUp(DispatchSizeY, NumGPUs);
 
 						// Compute the dispatch size for just this set of scanlines
 						const int32 DispatchSizeYLocal = FMath::Min(DispatchSizeYSplit, DispatchSizeY - CurrentGPU * DispatchSizeYSplit);
+
+						const int32 AdaptiveTileIndex = bAdaptiveSampling ? (TileY / TraceTileSize) * AdaptiveSampling.TileCount.X + TileX / TraceTileSize : INDEX_NONE;
+						if (bAdaptiveSampling && !AdaptiveSampling.NeedsSamples(AdaptiveTileIndex, MaxSPP))
+						{
+							continue;
+						}
+
 						if (CompactionType == 1)
 						{
 							AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(ActivePaths[0], PF_R32_UINT), 0);
@@ -2318,6 +2539,17 @@ void FDeferredShadingSceneRenderer::RenderPathTracing(
 							PassParameters->TLAS = Scene->RayTracingScene.GetLayerSRVChecked(ERayTracingSceneLayer::Base);
 							PassParameters->ViewUniformBuffer = View.ViewUniformBuffer;
 							PassParameters->PathTracingData = Config.PathTracingData;
+							if (bAdaptiveSampling)
+							{
+								// Each tile accumulates its own number of samples
+								const uint32 TileSampleIndex = AdaptiveSampling.TileSampleCounts[AdaptiveTileIndex];
+								PassParameters->PathTracingData.Iteration = TileSampleIndex;
+								PassParameters->PathTracingData.BlendFactor = 1.0f / (TileSampleIndex + 1);
+								if (Config.LockedSamplingPattern)
+								{
+									PassParameters->PathTracingData.TemporalSeed = TileSampleIndex;
+								}
+							}
 							PassParameters->StartingExtinctionCoefficient = GraphBuilder.CreateSRV(StartingExtinctionCoefficient, PF_R32_FLOAT);
 							if (PreviousPassParameters == nullptr)
 							{
@@ -2448,17 +2680,69 @@ void FDeferredShadingSceneRenderer::RenderPathTracing(
 								PreviousPassParameters = PassParameters;
 							}
 						}
+
+						PathTracingState->NumPixelSamplesTraced += uint64(DispatchSizeX) * uint64(DispatchSizeYLocal);
+
+						if (bAdaptiveSampling)
+						{
+							// Update the noise estimate of the tile from the sample just accumulated
+							FPathTracingAdaptiveSamplingCS::FParameters* AdaptiveParameters = GraphBuilder.AllocParameters<FPathTracingAdaptiveSamplingCS::FParameters>();
+							AdaptiveParameters->TileOffset = FIntPoint(TileX, TileY);
+							AdaptiveParameters->TileSize = FIntPoint(DispatchSizeX, DispatchSizeY);
+							AdaptiveParameters->TileIndex = AdaptiveTileIndex;
+							AdaptiveParameters->TileSampleIndex = AdaptiveSampling.TileSampleCounts[AdaptiveTileIndex];
+							AdaptiveParameters->ErrorScale = FPathTracingAdaptiveSampling::ErrorFixedPointScale / float(DispatchSizeX * DispatchSizeY);
+							AdaptiveParameters->RadianceTexture = GraphBuilder.CreateSRV(FRDGTextureSRVDesc::Create(RadianceTexture));
+							AdaptiveParameters->RWLuminanceTexture = GraphBuilder.CreateUAV(AdaptiveLuminanceTexture);
+							AdaptiveParameters->RWTileErrors = GraphBuilder.CreateUAV(AdaptiveTileErrors, PF_R32_UINT);
+
+							TShaderMapRef<FPathTracingAdaptiveSamplingCS> AdaptiveShader(View.ShaderMap);
+							FComputeShaderUtils::AddPass(
+								GraphBuilder,
+								RDG_EVENT_NAME("Path Tracer Adaptive Sampling Tile=(%d,%d - %dx%d) Sample=%u", TileX, TileY, DispatchSizeX, DispatchSizeY, AdaptiveParameters->TileSampleIndex),
+								AdaptiveShader,
+								AdaptiveParameters,
+								FComputeShaderUtils::GetGroupCount(FIntPoint(DispatchSizeX, DispatchSizeY), FComputeShaderUtils::kGolden2DGroupSize));
+
+							AdaptiveSampling.TileSampleCounts[AdaptiveTileIndex]++;
+							AdaptiveTracedTiles.Add(AdaptiveTileIndex);
+						}
 					}
 				}
 				++CurrentGPU;
 			}
 
+			if (AdaptiveTracedTiles.Num() > 0)
+			{
+				FPathTracingAdaptiveSampling::FPendingReadback& Pending = AdaptiveSampling.PendingReadbacks.AddDefaulted_GetRef();
+				Pending.Readback = MakeUnique<FRHIGPUBufferReadback>(TEXT("PathTracer.AdaptiveTileErrorsReadback"));
+				Pending.TileIndices = MoveTemp(AdaptiveTracedTiles);
+				Pending.Epoch = AdaptiveSampling.Epoch;
+				AddEnqueueCopyPass(GraphBuilder, Pending.Readback.Get(), AdaptiveTileErrors, AdaptiveSampling.GetNumTiles() * sizeof(uint32));
+			}
+
 			// Bump counters for next frame pass
 			++PathTracingState->SampleIndex;
 			++PathTracingState->FrameIndex;
 		}
 	}
 
+	if (bNeedsTextureExtract)
+	{
+		const double AccumulationTime = FPlatformTime::Seconds() - PathTracingState->AccumulationStartTime;
+		const float MSamplesPerSecond = AccumulationTime > 0.0 ? float(double(PathTracingState->NumPixelSamplesTraced) / AccumulationTime * 1e-6) : 0.0f;
+		SET_FLOAT_STAT(STAT_PathTracingMSamplesPerSecond, MSamplesPerSecond);
+		CSV_CUSTOM_STAT(PathTracing, MSamplesPerSecond, MSamplesPerSecond, ECsvCustomStatOp::Set);
+
+		UE_CLOG(View.bIsOfflineRender && PathTracingState->SampleIndex == MaxSPP, LogRenderer, Log, TEXT("Path tracing accumulated %u samples per pixel (%.1f MSamples in total) in %.2fs, %.2f MSamples/s"),
+			MaxSPP, double(PathTracingState->NumPixelSamplesTraced) * 1e-6, AccumulationTime, MSamplesPerSecond);
+	}
+
+	if (AdaptiveLuminanceTexture)
+	{
+		GraphBuilder.QueueTextureExtraction(AdaptiveLuminanceTexture, &AdaptiveSampling.LuminanceRT);
+	}
+
 	if (bNeedsTextureExtract)
 	{
 #if WITH_MGPU
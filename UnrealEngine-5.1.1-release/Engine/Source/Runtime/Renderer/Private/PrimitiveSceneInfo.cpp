@@ -36,6 +36,13 @@ static FAutoConsoleVariableRef CVarDrawCommandsCacheMultithreaded(
 	TEXT("Enable multithreading of draw command caching for static meshes. 0=disabled, 1=enabled (default)"),
 	ECVF_RenderThreadSafe);
 
+static int32 GMeshDrawCommandsCacheBatchSize = 64;
+static FAutoConsoleVariableRef CVarMeshDrawCommandsCacheBatchSize(
+	TEXT("r.MeshDrawCommands.CacheBatchSize"),
+	GMeshDrawCommandsCacheBatchSize,
+	TEXT("Number of primitives processed by each task when caching static mesh draw commands. Smaller batches spread small groups of added primitives over more task threads."),
+	ECVF_RenderThreadSafe);
+
 static int32 GNaniteDrawCommandCacheMultithreaded = 1;
 static FAutoConsoleVariableRef CVarNaniteDrawCommandCacheMultithreaded(
 	TEXT("r.Nanite.MeshDrawCommands.CacheMultithreaded"),
@@ -142,6 +149,7 @@ FPrimitiveFlagsCompact::FPrimitiveFlagsCompact(const FPrimitiveSceneProxy* Proxy
 	, bCastStaticShadow(Proxy->CastsStaticShadow())
 	, bIsNaniteMesh(Proxy->IsNaniteMesh())
 	, bSupportsGPUScene(Proxy->SupportsGPUScene())
+	, bSupportsGPUDrivenVisibility(Proxy->SupportsGPUScene() && !Proxy->IsNaniteMesh() && Proxy->IsStatic())
 {}
 
 FPrimitiveSceneInfoCompact::FPrimitiveSceneInfoCompact(FPrimitiveSceneInfo* InPrimitiveSceneInfo) :
@@ -282,12 +290,13 @@ void FPrimitiveSceneInfo::CacheMeshDrawCommands(FRHICommandListImmediate& RHICmd
 
 	QUICK_SCOPE_CYCLE_COUNTER(STAT_CacheMeshDrawCommands);
 
-	static constexpr int BATCH_SIZE = 64;
-	const int NumBatches = (SceneInfos.Num() + BATCH_SIZE - 1) / BATCH_SIZE;
+	const int BatchSize = FMath::Max(GMeshDrawCommandsCacheBatchSize, 1);
+	const int NumBatches = (SceneInfos.Num() + BatchSize - 1) / BatchSize;
 
-	auto DoWorkLambda = [Scene, SceneInfos](FCachedPassMeshDrawListContext& DrawListContext, int32 Index)
+	auto DoWorkLambda = [Scene, SceneInfos, BatchSize, NumBatches](FCachedPassMeshDrawListContext& DrawListContext, int32 Index)
 	{
 		SCOPED_NAMED_EVENT(FPrimitiveSceneInfo_CacheMeshDrawCommand, FColor::Green);
+		TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*FString::Printf(TEXT("CacheMeshDrawCommands Batch %d/%d (%d primitives)"), Index + 1, NumBatches, FMath::Min(BatchSize, SceneInfos.Num() - Index * BatchSize)));
 
 		struct FMeshInfoAndIndex
 		{
@@ -296,10 +305,10 @@ void FPrimitiveSceneInfo::CacheMeshDrawCommands(FRHICommandListImmediate& RHICmd
 		};
 
 		TArray<FMeshInfoAndIndex, SceneRenderingAllocator> MeshBatches;
-		MeshBatches.Reserve(3 * BATCH_SIZE);
+		MeshBatches.Reserve(3 * BatchSize);
 
-		int LocalNum = FMath::Min((Index * BATCH_SIZE) + BATCH_SIZE, SceneInfos.Num());
-		for (int LocalIndex = (Index * BATCH_SIZE); LocalIndex < LocalNum; LocalIndex++)
+		int LocalNum = FMath::Min((Index * BatchSize) + BatchSize, SceneInfos.Num());
+		for (int LocalIndex = (Index * BatchSize); LocalIndex < LocalNum; LocalIndex++)
 		{
 			FPrimitiveSceneInfo* SceneInfo = SceneInfos[LocalIndex];
 			check(SceneInfo->StaticMeshCommandInfos.Num() == 0);
@@ -367,7 +376,7 @@ void FPrimitiveSceneInfo::CacheMeshDrawCommands(FRHICommandListImmediate& RHICmd
 			}
 		}
 
-		for (int LocalIndex = (Index * BATCH_SIZE); LocalIndex < LocalNum; LocalIndex++)
+		for (int LocalIndex = (Index * BatchSize); LocalIndex < LocalNum; LocalIndex++)
 		{
 			FPrimitiveSceneInfo* SceneInfo = SceneInfos[LocalIndex];
 			int PrefixSum = 0;
@@ -439,8 +448,9 @@ void FPrimitiveSceneInfo::CacheMeshDrawCommands(FRHICommandListImmediate& RHICmd
 			for (int32 Index = 0; Index < NumBatches; ++Index)
 			{
 				FCachedPassMeshDrawListContextDeferred& DrawListContext = DrawListContexts[Index];
-				const int32 Start = Index * BATCH_SIZE;
-				const int32 End = FMath::Min((Index * BATCH_SIZE) + BATCH_SIZE, SceneInfos.Num());
+				const int32 Start = Index * BatchSize;
+				const int32 End = FMath::Min((Index * BatchSize) + BatchSize, SceneInfos.Num());
+				TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*FString::Printf(TEXT("DeferredFinalizeMeshDrawCommands Batch %d/%d (%d primitives)"), Index + 1, NumBatches, End - Start));
 				DrawListContext.DeferredFinalizeMeshDrawCommands(SceneInfos, Start, End);
 				bAnyLooseParameterBuffers |= DrawListContext.HasAnyLooseParameterBuffers();
 			}
@@ -825,7 +825,9 @@ static uint64 GetBufferReadbackGPUSizeBytes(const FRHIGPUBufferReadback* BufferR
 
 uint64 FHZBOcclusionTester::GetGPUSizeBytes(bool bLogSizes) const
 {
-	return ResultsReadback.IsValid() ? GetTextureReadbackGPUSizeBytes(ResultsReadback.Get(), bLogSizes) : 0;
+	uint64 TotalSize = ResultsReadback.IsValid() ? GetTextureReadbackGPUSizeBytes(ResultsReadback.Get(), bLogSizes) : 0;
+	TotalSize += ResultsBitsReadback.IsValid() ? GetBufferReadbackGPUSizeBytes(ResultsBitsReadback.Get(), bLogSizes) : 0;
+	return TotalSize;
 }
 
 uint64 FPersistentSkyAtmosphereData::GetGPUSizeBytes(bool bLogSizes) const
@@ -1488,6 +1490,13 @@ static TAutoConsoleVariable<int32> CVarDoLazyStaticMeshUpdate(
 	0,
 	TEXT("If true, then do not add meshes to the static mesh draw lists until they are visible. Experiemental option."));
 
+static TAutoConsoleVariable<int32> CVarBatchAddedPrimitiveMeshDrawCommands(
+	TEXT("r.MeshDrawCommands.BatchAddedPrimitives"),
+	1,
+	TEXT("If true, mesh draw commands of the primitives added in a frame are cached in a single parallel pass once all of them are in the scene,\n")
+	TEXT("instead of once per group of primitives sharing a proxy type, which is mostly serial when many small groups are streamed in."),
+	ECVF_RenderThreadSafe);
+
 static void DoLazyStaticMeshUpdateCVarSinkFunction()
 {
 	if (!GIsRunning || GIsEditor || !FApp::CanEverRender())
@@ -5448,6 +5457,31 @@ void FScene::UpdateAllPrimitiveSceneInfos(FRDGBuilder& GraphBuilder, bool bAsync
 			}
 		}
 
+		const bool bBatchMeshDrawCommandCaching = CVarBatchAddedPrimitiveMeshDrawCommands.GetValueOnRenderThread() != 0;
+		TArray<FPrimitiveSceneInfo*, SceneRenderingAllocator> PrimitivesToCacheMeshDrawCommands;
+		if (bBatchMeshDrawCommandCaching)
+		{
+			PrimitivesToCacheMeshDrawCommands.Reserve(AddedLocalPrimitiveSceneInfos.Num());
+		}
+
+		auto AddToSceneWithStaticDrawLists = [this, &GraphBuilder, bBatchMeshDrawCommandCaching, &PrimitivesToCacheMeshDrawCommands](const TArrayView<FPrimitiveSceneInfo*>& SceneInfos, bool bInAsyncCreateLPIs)
+		{
+			if (bBatchMeshDrawCommandCaching)
+			{
+				// Gather the static meshes and their relevance now, the mesh draw commands are cached for all added primitives once they are in the scene
+				FPrimitiveSceneInfo::AddToScene(GraphBuilder.RHICmdList, this, SceneInfos, true, false, bInAsyncCreateLPIs);
+				FPrimitiveSceneInfo::CacheNaniteDrawCommands(GraphBuilder.RHICmdList, this, SceneInfos);
+#if RHI_RAYTRACING
+				FPrimitiveSceneInfo::CacheRayTracingPrimitives(this, SceneInfos);
+#endif
+				PrimitivesToCacheMeshDrawCommands.Append(SceneInfos.GetData(), SceneInfos.Num());
+			}
+			else
+			{
+				FPrimitiveSceneInfo::AddToScene(GraphBuilder.RHICmdList, this, SceneInfos, true, true, bInAsyncCreateLPIs);
+			}
+		};
+
 		while (AddedLocalPrimitiveSceneInfos.Num())
 		{
 			int32 StartIndex = AddedLocalPrimitiveSceneInfos.Num() - 1;
@@ -5648,14 +5682,14 @@ void FScene::UpdateAllPrimitiveSceneInfos(FRDGBuilder& GraphBuilder, bool bAsync
 				SCOPED_NAMED_EVENT(FScene_AddPrimitiveSceneInfoToScene, FColor::Turquoise);
 				if (GIsEditor)
 				{
-					FPrimitiveSceneInfo::AddToScene(GraphBuilder.RHICmdList, this, TArrayView<FPrimitiveSceneInfo*>(&AddedLocalPrimitiveSceneInfos[StartIndex], AddedLocalPrimitiveSceneInfos.Num() - StartIndex), true);
+					AddToSceneWithStaticDrawLists(TArrayView<FPrimitiveSceneInfo*>(&AddedLocalPrimitiveSceneInfos[StartIndex], AddedLocalPrimitiveSceneInfos.Num() - StartIndex), false);
 				}
 				else
 				{
 					const bool bAddToDrawLists = !(CVarDoLazyStaticMeshUpdate.GetValueOnRenderThread());
 					if (bAddToDrawLists)
 					{
-						FPrimitiveSceneInfo::AddToScene(GraphBuilder.RHICmdList, this, TArrayView<FPrimitiveSceneInfo*>(&AddedLocalPrimitiveSceneInfos[StartIndex], AddedLocalPrimitiveSceneInfos.Num() - StartIndex), true, true, bAsyncCreateLPIs);
+						AddToSceneWithStaticDrawLists(TArrayView<FPrimitiveSceneInfo*>(&AddedLocalPrimitiveSceneInfos[StartIndex], AddedLocalPrimitiveSceneInfos.Num() - StartIndex), bAsyncCreateLPIs);
 					}
 					else
 					{
@@ -5707,6 +5741,12 @@ void FScene::UpdateAllPrimitiveSceneInfos(FRDGBuilder& GraphBuilder, bool bAsync
 			}
 			AddedLocalPrimitiveSceneInfos.RemoveAt(StartIndex, AddedLocalPrimitiveSceneInfos.Num() - StartIndex, false);
 		}
+
+		if (PrimitivesToCacheMeshDrawCommands.Num() > 0)
+		{
+			SCOPED_NAMED_EVENT(FScene_CacheAddedPrimitiveMeshDrawCommands, FColor::Emerald);
+			FPrimitiveSceneInfo::CacheMeshDrawCommands(GraphBuilder.RHICmdList, this, PrimitivesToCacheMeshDrawCommands);
+		}
 	}
 	{
 		CSV_SCOPED_TIMING_STAT_EXCLUSIVE(UpdatePrimitiveTransform);
@@ -64,6 +64,15 @@ static TAutoConsoleVariable<bool> CVarMobileEnableOcclusionExtraFrame(
 	ECVF_RenderThreadSafe
 	);
 
+int32 GHZBOcclusionCompute = 0;
+static FAutoConsoleVariableRef CVarHZBOcclusionCompute(
+	TEXT("r.HZBOcclusion.Compute"),
+	GHZBOcclusionCompute,
+	TEXT("If not zero, the HZB occlusion system tests all primitive bounds in a single compute dispatch and reads back one visibility bit per primitive,\n")
+	TEXT("instead of uploading the bounds to textures in blocks and reading back a results texture. r.HZBOcclusion must be enabled for this to have an effect."),
+	ECVF_RenderThreadSafe
+	);
+
 int32 GEnableComputeBuildHZB = 1;
 static FAutoConsoleVariableRef CVarEnableComputeBuildHZB(
 	TEXT("r.EnableComputeBuildHZB"),
@@ -797,6 +806,7 @@ void FHZBOcclusionTester::InitDynamicRHI()
 	if (GetFeatureLevel() >= ERHIFeatureLevel::SM5)
 	{
 		ResultsReadback.Reset(new FRHIGPUTextureReadback(TEXT("HZBGPUReadback")));
+		ResultsBitsReadback.Reset(new FRHIGPUBufferReadback(TEXT("HZBGPUBitsReadback")));
 	}
 }
 
@@ -805,6 +815,7 @@ void FHZBOcclusionTester::ReleaseDynamicRHI()
 	if (GetFeatureLevel() >= ERHIFeatureLevel::SM5)
 	{
 		ResultsReadback.Reset();
+		ResultsBitsReadback.Reset();
 	}
 }
 
@@ -825,15 +836,25 @@ void FHZBOcclusionTester::MapResults(FRHICommandListImmediate& RHICmdList)
 	{
 		uint32 IdleStart = FPlatformTime::Cycles();
 
-		SCOPED_GPU_MASK(RHICmdList, ResultsReadback->GetLastCopyGPUMask());
+		if (bResultsInBits)
+		{
+			SCOPED_GPU_MASK(RHICmdList, ResultsBitsReadback->GetLastCopyGPUMask());
 
-		int32 ResultBufferHeight = 0;
-		ResultsBufferRowPitch = 0;
-		ResultsBuffer = reinterpret_cast<const uint8*>(ResultsReadback->Lock(ResultsBufferRowPitch, &ResultBufferHeight));
-		if (ResultsBuffer)
+			ResultsBufferRowPitch = 0;
+			ResultsBuffer = reinterpret_cast<const uint8*>(ResultsBitsReadback->Lock(NumResultWords * sizeof(uint32)));
+		}
+		else
 		{
-			check(ResultsBufferRowPitch >= SizeX);
-			check(ResultBufferHeight >= SizeY);
+			SCOPED_GPU_MASK(RHICmdList, ResultsReadback->GetLastCopyGPUMask());
+
+			int32 ResultBufferHeight = 0;
+			ResultsBufferRowPitch = 0;
+			ResultsBuffer = reinterpret_cast<const uint8*>(ResultsReadback->Lock(ResultsBufferRowPitch, &ResultBufferHeight));
+			if (ResultsBuffer)
+			{
+				check(ResultsBufferRowPitch >= SizeX);
+				check(ResultBufferHeight >= SizeY);
+			}
 		}
 
 		// RHIMapStagingSurface will block until the results are ready (from the previous frame) so we need to consider this RT idle time
@@ -856,8 +877,9 @@ void FHZBOcclusionTester::UnmapResults(FRHICommandListImmediate& RHICmdList)
 	check( ResultsBuffer );
 	if(!IsInvalidFrame())
 	{
-		SCOPED_GPU_MASK(RHICmdList, ResultsReadback->GetLastCopyGPUMask());
-		ResultsReadback->Unlock();
+		FRHIGPUReadback* Readback = bResultsInBits ? static_cast<FRHIGPUReadback*>(ResultsBitsReadback.Get()) : ResultsReadback.Get();
+		SCOPED_GPU_MASK(RHICmdList, Readback->GetLastCopyGPUMask());
+		Readback->Unlock();
 	}
 	ResultsBuffer = nullptr;
 }
@@ -866,8 +888,12 @@ bool FHZBOcclusionTester::IsVisible( uint32 Index ) const
 {
 	checkSlow( ResultsBuffer );
 	checkSlow( Index < SizeX * SizeY );
-	
-	// TODO shader compress to bits
+
+	if (bResultsInBits)
+	{
+		const uint32* ResultsBits = reinterpret_cast<const uint32*>(ResultsBuffer);
+		return (ResultsBits[Index / 32] & (1u << (Index % 32))) != 0;
+	}
 
 #if 0
 	return ResultsBuffer[ 4 * Index ] != 0;
@@ -926,6 +952,40 @@ class FHZBTestPS : public FGlobalShader
 
 IMPLEMENT_GLOBAL_SHADER(FHZBTestPS, "/Engine/Private/HZBOcclusion.usf", "HZBTestPS", SF_Pixel);
 
+class FHZBTestCS : public FGlobalShader
+{
+	DECLARE_GLOBAL_SHADER(FHZBTestCS);
+	SHADER_USE_PARAMETER_STRUCT(FHZBTestCS, FGlobalShader)
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_STRUCT_REF(FViewUniformShaderParameters, View)
+
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, HZBTexture)
+		SHADER_PARAMETER_SAMPLER(SamplerState, HZBSampler)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float4>, BoundsBuffer)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint>, RWResultsBits)
+
+		SHADER_PARAMETER(FVector2f, HZBSize)
+		SHADER_PARAMETER(FVector2f, HZBViewSize)
+		SHADER_PARAMETER(uint32, NumBounds)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static constexpr uint32 ThreadGroupSize = 64;
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZE"), ThreadGroupSize);
+	}
+};
+
+IMPLEMENT_GLOBAL_SHADER(FHZBTestCS, "/Engine/Private/HZBOcclusionCompute.usf", "HZBTestCS", SF_Compute);
+
 BEGIN_SHADER_PARAMETER_STRUCT(FHZBOcclusionUpdateTexturesParameters, )
 	RDG_TEXTURE_ACCESS(BoundsCenterTexture, ERHIAccess::CopyDest)
 	RDG_TEXTURE_ACCESS(BoundsExtentTexture, ERHIAccess::CopyDest)
@@ -941,6 +1001,14 @@ void FHZBOcclusionTester::Submit(FRDGBuilder& GraphBuilder, const FViewInfo& Vie
 		return;
 	}
 
+	if (GHZBOcclusionCompute)
+	{
+		SubmitCompute(GraphBuilder, View);
+		return;
+	}
+
+	bResultsInBits = false;
+
 	FRDGTextureRef BoundsCenterTexture = nullptr;
 	FRDGTextureRef BoundsExtentTexture = nullptr;
 
@@ -1049,6 +1117,52 @@ void FHZBOcclusionTester::Submit(FRDGBuilder& GraphBuilder, const FViewInfo& Vie
 	AddEnqueueCopyPass(GraphBuilder, ResultsReadback.Get(), ResultsTextureGPU);
 }
 
+void FHZBOcclusionTester::SubmitCompute(FRDGBuilder& GraphBuilder, const FViewInfo& View)
+{
+	bResultsInBits = true;
+
+	const uint32 NumBounds = Primitives.Num();
+	const FVector PreViewTranslation = View.ViewMatrices.GetPreViewTranslation();
+
+	// Center and extent of each primitive, centers are made relative to the view on the CPU to keep their precision
+	FVector4f* BoundsData = GraphBuilder.AllocPODArray<FVector4f>(NumBounds * 2);
+	for (uint32 Index = 0; Index < NumBounds; Index++)
+	{
+		const FOcclusionPrimitive& Primitive = Primitives[Index];
+		BoundsData[Index * 2 + 0] = FVector4f(FVector3f(Primitive.Center + PreViewTranslation), 0.0f);
+		BoundsData[Index * 2 + 1] = FVector4f(FVector3f(Primitive.Extent), 0.0f);
+	}
+	Primitives.Empty();
+
+	FRDGBufferRef BoundsBuffer = CreateStructuredBuffer(GraphBuilder, TEXT("HZBBounds"), sizeof(FVector4f), NumBounds * 2, BoundsData, sizeof(FVector4f) * NumBounds * 2, ERDGInitialDataFlags::NoCopy);
+
+	FRDGBufferRef ResultsBitsGPU = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32), NumResultWords), TEXT("HZBResultsBits"));
+	FRDGBufferUAVRef ResultsBitsUAV = GraphBuilder.CreateUAV(ResultsBitsGPU, PF_R32_UINT);
+	AddClearUAVPass(GraphBuilder, ResultsBitsUAV, 0u);
+
+	FHZBTestCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FHZBTestCS::FParameters>();
+	PassParameters->View = View.ViewUniformBuffer;
+	PassParameters->HZBTexture = View.HZB;
+	PassParameters->HZBSampler = TStaticSamplerState<SF_Point, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+	PassParameters->BoundsBuffer = GraphBuilder.CreateSRV(BoundsBuffer);
+	PassParameters->RWResultsBits = ResultsBitsUAV;
+	PassParameters->HZBSize = FVector2f(View.HZBMipmap0Size);
+	PassParameters->HZBViewSize = FVector2f(View.ViewRect.Size());
+	PassParameters->NumBounds = NumBounds;
+
+	TShaderMapRef<FHZBTestCS> ComputeShader(View.ShaderMap);
+
+	FComputeShaderUtils::AddPass(
+		GraphBuilder,
+		RDG_EVENT_NAME("TestHZB(Compute) %u", NumBounds),
+		ComputeShader,
+		PassParameters,
+		FComputeShaderUtils::GetGroupCount(NumBounds, FHZBTestCS::ThreadGroupSize));
+
+	// Transfer memory GPU -> CPU
+	AddEnqueueCopyPass(GraphBuilder, ResultsBitsReadback.Get(), ResultsBitsGPU, NumResultWords * sizeof(uint32));
+}
+
 static FViewOcclusionQueriesPerView AllocateOcclusionTests(const FScene* Scene, TArrayView<const FVisibleLightInfo> VisibleLightInfos, TArrayView<FViewInfo> Views)
 {
 	SCOPED_NAMED_EVENT(FSceneRenderer_AllocateOcclusionTestsOcclusionTests, FColor::Emerald);
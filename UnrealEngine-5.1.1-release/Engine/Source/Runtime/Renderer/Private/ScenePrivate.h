@@ -744,6 +744,9 @@ public:
 	/** For this view, the set of primitives that are currently fading, either in or out. */
 	FPrimitiveFadingStateMap PrimitiveFadingStates;
 
+	/** Mesh draw commands of the dynamic mesh elements kept across frames, for each mesh pass. */
+	FDynamicMeshDrawCommandCache DynamicMeshDrawCommandCaches[EMeshPass::Num];
+
 	FIndirectLightingCacheAllocation* TranslucencyLightingCacheAllocations[TVC_MAX];
 
 	TMap<int32, FIndividualOcclusionHistory> PlanarReflectionOcclusionHistories;
@@ -102,6 +102,13 @@ bool UseCachedMeshDrawCommands_AnyThread()
 	return CVarCachedMeshDrawCommands.GetValueOnAnyThread() > 0;
 }
 
+static TAutoConsoleVariable<int32> CVarCacheDynamicMeshDrawCommands(
+	TEXT("r.MeshDrawCommands.CacheDynamicCommands"),
+	1,
+	TEXT("Whether to reuse the mesh draw commands built for the dynamic mesh elements of proxies that support it on previous frames, until the proxy marks them dirty.\n")
+	TEXT("Only applies to main view passes that support cached mesh draw commands, and is disabled in the editor."),
+	ECVF_RenderThreadSafe);
+
 static TAutoConsoleVariable<int32> CVarMeshDrawCommandsDynamicInstancing(
 	TEXT("r.MeshDrawCommands.DynamicInstancing"),
 	1,
@@ -2638,6 +2645,8 @@ FSceneRenderer::FSceneRenderer(const FSceneViewFamily* InViewFamily, FHitProxyCo
 
 	bDumpMeshDrawCommandInstancingStats = !!GDumpInstancingStats;
 	GDumpInstancingStats = 0;
+
+	Nanite::GatherStreamingPredictionOrigins(NaniteStreamingPredictionOrigins);
 }
 
 // static
@@ -3800,6 +3809,25 @@ void FSceneRenderer::SetupMeshPass(FViewInfo& View, FExclusiveDepthStencil::Type
 				EnumAddFlags(CullingFlags, EInstanceCullingFlags::DrawOnlyVSMInvalidatingGeometry);
 			}
 
+			FDynamicMeshDrawCommandCache* DynamicMeshDrawCommandCache = nullptr;
+			if (View.ViewState)
+			{
+				FDynamicMeshDrawCommandCache& ViewDynamicMeshDrawCommandCache = View.ViewState->DynamicMeshDrawCommandCaches[PassIndex];
+				const bool bCacheDynamicMeshDrawCommands = CVarCacheDynamicMeshDrawCommands.GetValueOnRenderThread() != 0
+					&& !GIsEditor
+					&& (FPassProcessorManager::GetPassFlags(ShadingPath, PassType) & EMeshPassFlags::CachedMeshCommands) != EMeshPassFlags::None;
+
+				if (bCacheDynamicMeshDrawCommands)
+				{
+					ViewDynamicMeshDrawCommandCache.BeginFrame();
+					DynamicMeshDrawCommandCache = &ViewDynamicMeshDrawCommandCache;
+				}
+				else if (ViewDynamicMeshDrawCommandCache.Num() > 0)
+				{
+					ViewDynamicMeshDrawCommandCache.Empty();
+				}
+			}
+
 			Pass.DispatchPassSetup(
 				Scene,
 				View,
@@ -3812,7 +3840,10 @@ void FSceneRenderer::SetupMeshPass(FViewInfo& View, FExclusiveDepthStencil::Type
 				View.NumVisibleDynamicMeshElements[PassType],
 				ViewCommands.DynamicMeshCommandBuildRequests[PassType],
 				ViewCommands.NumDynamicMeshCommandBuildRequestElements[PassType],
-				ViewCommands.MeshCommands[PassIndex]);
+				ViewCommands.MeshCommands[PassIndex],
+				nullptr,
+				nullptr,
+				DynamicMeshDrawCommandCache);
 		}
 	}
 }
@@ -468,6 +468,9 @@ public:
 	uint32 AddBounds( const FVector& BoundsOrigin, const FVector& BoundsExtent );
 	void Submit(FRDGBuilder& GraphBuilder, const FViewInfo& View);
 
+	/** Tests the bounds in a single compute dispatch and reads back one visibility bit per primitive, r.HZBOcclusion.Compute. */
+	void SubmitCompute(FRDGBuilder& GraphBuilder, const FViewInfo& View);
+
 	void MapResults(FRHICommandListImmediate& RHICmdList);
 	void UnmapResults(FRHICommandListImmediate& RHICmdList);
 	bool IsVisible( uint32 Index ) const;
@@ -483,12 +486,17 @@ private:
 	enum { SizeY = 256 };
 	enum { FrameNumberMask = 0x7fffffff };
 	enum { InvalidFrameNumber = 0xffffffff };
+	enum { NumResultWords = SizeX * SizeY / 32 };
 
 	TArray< FOcclusionPrimitive, SceneRenderingAllocator >	Primitives;
 
 	const uint8*						ResultsBuffer;
 	int32								ResultsBufferRowPitch;
 	TUniquePtr<FRHIGPUTextureReadback>	ResultsReadback;
+	TUniquePtr<FRHIGPUBufferReadback>	ResultsBitsReadback;
+
+	/** Whether the last submitted results are visibility bits from SubmitCompute rather than the results texture */
+	bool								bResultsInBits = false;
 
 	bool IsInvalidFrame() const;
 
@@ -1954,6 +1962,9 @@ public:
 	DynamicRenderScaling::TMap<float> DynamicResolutionFractions;
 	DynamicRenderScaling::TMap<float> DynamicResolutionUpperBounds;
 
+	/** Streaming view locations captured on the game thread for Nanite streaming prediction. */
+	TArray<FVector, TInlineAllocator<2>> NaniteStreamingPredictionOrigins;
+
 	FMeshElementCollector MeshCollector;
 
 	FMeshElementCollector RayTracingCollector;
@@ -2471,6 +2482,12 @@ protected:
 	/** Renders the opaque base pass for mobile. */
 	void RenderMobileBasePass(FRHICommandListImmediate& RHICmdList, const FViewInfo& View);
 
+	/** Records the opaque base pass and sky pass for mobile in parallel command lists, each of them begins its own render pass with Bindings. Editor primitives are not drawn. */
+	void RenderMobileBasePassParallel(const FRDGPass* InPass, FRHICommandListImmediate& RHICmdList, const FViewInfo& View, const FParallelCommandListBindings& Bindings);
+
+	/** Draws the opaque editor primitives of the mobile base pass. */
+	void RenderMobileBasePassEditorPrimitives(FRHICommandList& RHICmdList, const FViewInfo& View);
+
 	void PostRenderBasePass(FRHICommandListImmediate& RHICmdList, FViewInfo& View);
 
 	void RenderMobileEditorPrimitives(FRHICommandList& RHICmdList, const FViewInfo& View, const FMeshPassProcessorRenderState& DrawRenderState);
@@ -2520,6 +2537,8 @@ protected:
 	void RenderForward(FRDGBuilder& GraphBuilder, FRDGTextureRef ViewFamilyTexture, FSceneTextures& SceneTextures);
 	void RenderForwardSinglePass(FRDGBuilder& GraphBuilder, class FMobileRenderPassParameters* PassParameters, struct FRenderViewContext& ViewContext, FSceneTextures& SceneTextures);
 	void RenderForwardMultiPass(FRDGBuilder& GraphBuilder, class FMobileRenderPassParameters* PassParameters, FRenderTargetBindingSlots& BasePassRenderTargets, struct FRenderViewContext& ViewContext, FSceneTextures& SceneTextures);
+	/** Renders the opaque scene color passes of RenderForwardMultiPass with the base pass and sky pass recorded in parallel, in a render pass of their own. */
+	void RenderForwardMultiPassParallel(FRDGBuilder& GraphBuilder, class FMobileRenderPassParameters* PassParameters, struct FRenderViewContext& ViewContext);
 	
 	void RenderDeferred(FRDGBuilder& GraphBuilder, const FSortedLightSetSceneInfo& SortedLightSet, FRDGTextureRef ViewFamilyTexture, FSceneTextures& SceneTextures);
 	void RenderDeferredSinglePass(FRDGBuilder& GraphBuilder, class FMobileRenderPassParameters* PassParameters, struct FRenderViewContext& ViewContext, FSceneTextures& SceneTextures, const FSortedLightSetSceneInfo& SortedLightSet, bool bUsingPixelLocalStorage);
@@ -545,6 +545,36 @@ static FAutoConsoleVariableRef CVarFrustumCullNumWordsPerTask(
 	ECVF_Default
 	);
 
+static TAutoConsoleVariable<int32> CVarGPUDrivenStaticMeshVisibility(
+	TEXT("r.InstanceCulling.GPUDrivenStaticMeshes"),
+	0,
+	TEXT("If true, static non-Nanite GPU-Scene primitives skip the CPU frustum cull and rely on GPU instance culling (r.CullInstances, r.InstanceCulling.OcclusionCull) instead.\n")
+	TEXT("Distance culling stays on the CPU."),
+	ECVF_RenderThreadSafe
+);
+
+static TAutoConsoleVariable<int32> CVarShareFrustumCullBetweenViews(
+	TEXT("r.Visibility.ShareFrustumCullBetweenViews"),
+	1,
+	TEXT("If true, views whose frustums are close, e.g. several views of the same camera, first cull primitives once against a cone enclosing all their frustums.\n")
+	TEXT("Each view then only tests the primitives inside that cone against its own frustum. Instanced stereo views already share a culling frustum and are not grouped."),
+	ECVF_RenderThreadSafe
+);
+
+static TAutoConsoleVariable<float> CVarShareFrustumCullMaxOriginDistance(
+	TEXT("r.Visibility.ShareFrustumCullBetweenViews.MaxOriginDistance"),
+	100.0f,
+	TEXT("Maximum distance in world units between the origins of views sharing frustum culling."),
+	ECVF_RenderThreadSafe
+);
+
+static TAutoConsoleVariable<float> CVarShareFrustumCullMaxAngle(
+	TEXT("r.Visibility.ShareFrustumCullBetweenViews.MaxAngle"),
+	15.0f,
+	TEXT("Maximum angle in degrees between the directions of views sharing frustum culling."),
+	ECVF_RenderThreadSafe
+);
+
 static TAutoConsoleVariable CVarNaniteMeshsAlwaysVisible(
 	TEXT("r.Nanite.PrimitivesAlwaysVisible"),
 	0,
@@ -577,6 +607,7 @@ struct FPrimitiveCullingFlags
 	bool bUseFastIntersect;
 	bool bUseVisibilityOctree;
 	bool bNaniteAlwaysVisible;
+	bool bGPUDrivenStaticMeshes;
 	bool bHasHiddenPrimitives;
 	bool bHasShowOnlyPrimitives;
 };
@@ -697,7 +728,7 @@ static FORCEINLINE void CullOctree(const FScene* RESTRICT Scene, FViewInfo& View
 		});
 }
 
-static void PrimitiveCullTask(FThreadSafeCounter& NumCulledPrimitives, const FScene* RESTRICT Scene, FViewInfo& View, FPrimitiveCullingFlags Flags, float MaxDrawDistanceScale, const FHLODVisibilityState* const HLODState, const FSceneBitArray& VisibleNodes, int32 TaskIndex)
+static void PrimitiveCullTask(FThreadSafeCounter& NumCulledPrimitives, const FScene* RESTRICT Scene, FViewInfo& View, FPrimitiveCullingFlags Flags, float MaxDrawDistanceScale, const FHLODVisibilityState* const HLODState, const FSceneBitArray& VisibleNodes, const FSceneBitArray* SharedFrustumVisibility, int32 TaskIndex)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(SceneVisibility_PrimitiveCull);
 	SCOPED_NAMED_EVENT(SceneVisibility_PrimitiveCull, FColor::Red);
@@ -725,6 +756,9 @@ static void PrimitiveCullTask(FThreadSafeCounter& NumCulledPrimitives, const FSc
 		uint32 VisBits = 0;
 		uint32 FadingBits = 0;
 
+		// Primitives outside the cone shared with other views are outside this view's frustum as well
+		const uint32 SharedFrustumBits = SharedFrustumVisibility ? SharedFrustumVisibility->GetData()[WordIndex] : ~0u;
+
 		// If visibility culling is disabled, make sure to use the existing visibility state
 		if (!Flags.bShouldVisibilityCull)
 		{
@@ -774,11 +808,21 @@ static void PrimitiveCullTask(FThreadSafeCounter& NumCulledPrimitives, const FSc
 					}
 				}
 
+				// The GPU culls the instances of these against the frustum when building their draw commands
+				if (Flags.bGPUDrivenStaticMeshes && Scene->PrimitiveFlagsCompact[Index].bSupportsGPUDrivenVisibility)
+				{
+					bShouldFrustumCull = false;
+				}
+
 				// Frustum first
 				bShouldFrustumCull = bShouldFrustumCull && bIsVisible;
 				if (bShouldFrustumCull)
 				{
-					if (Flags.bUseVisibilityOctree)
+					if ((SharedFrustumBits & Mask) == 0)
+					{
+						bIsVisible = false;
+					}
+					else if (Flags.bUseVisibilityOctree)
 					{
 						// If the parent octree node was completely contained by the frustum, there is no need do an additional frustum test on the primitive bounds
 						// If the parent octree node is partially in the frustum, perform an additional test on the primitive bounds
@@ -900,7 +944,13 @@ static void PrimitiveCullTask(FThreadSafeCounter& NumCulledPrimitives, const FSc
 	STAT(NumCulledPrimitives.Add(NumPrimitivesCulledForTask));
 }
 
-static int32 PrimitiveCull(const FScene* RESTRICT Scene, FViewInfo& View, bool bShouldVisibilityCull)
+static bool IsGPUInstanceCullingEnabled()
+{
+	static const auto CVarCullInstances = IConsoleManager::Get().FindTConsoleVariableDataInt(TEXT("r.CullInstances"));
+	return CVarCullInstances && CVarCullInstances->GetValueOnRenderThread() != 0;
+}
+
+static int32 PrimitiveCull(const FScene* RESTRICT Scene, FViewInfo& View, bool bShouldVisibilityCull, const FSceneBitArray* SharedFrustumVisibility)
 {
 	FPrimitiveCullingFlags Flags;
 	Flags.bShouldVisibilityCull = bShouldVisibilityCull;
@@ -909,6 +959,8 @@ static int32 PrimitiveCull(const FScene* RESTRICT Scene, FViewInfo& View, bool b
 	Flags.bUseFastIntersect = (View.ViewFrustum.PermutedPlanes.Num() == 8) && CVarUseFastIntersect.GetValueOnRenderThread();
 	Flags.bUseVisibilityOctree = CVarUseVisibilityOctree.GetValueOnRenderThread() > 0;
 	Flags.bNaniteAlwaysVisible = CVarNaniteMeshsAlwaysVisible.GetValueOnRenderThread() > 0;
+	Flags.bGPUDrivenStaticMeshes = CVarGPUDrivenStaticMeshVisibility.GetValueOnRenderThread() > 0 && !Flags.bUseCustomCulling
+		&& UseGPUScene(View.GetShaderPlatform(), View.GetFeatureLevel()) && IsGPUInstanceCullingEnabled();
 	Flags.bHasHiddenPrimitives = View.HiddenPrimitives.Num() > 0;
 	Flags.bHasShowOnlyPrimitives = View.ShowOnlyPrimitives.IsSet();
 
@@ -941,9 +993,9 @@ static int32 PrimitiveCull(const FScene* RESTRICT Scene, FViewInfo& View, bool b
 	const int32 NumTasks = FMath::DivideAndRoundUp(BitArrayWords, FrustumCullNumWordsPerTask);
 
 	ParallelFor(NumTasks,
-		[&NumCulledPrimitives, Scene, &View, MaxDrawDistanceScale, HLODState, &VisibleNodes, &Flags](int32 TaskIndex)
+		[&NumCulledPrimitives, Scene, &View, MaxDrawDistanceScale, HLODState, &VisibleNodes, SharedFrustumVisibility, &Flags](int32 TaskIndex)
 		{
-			PrimitiveCullTask(NumCulledPrimitives, Scene, View, Flags, MaxDrawDistanceScale, HLODState, VisibleNodes, TaskIndex);
+			PrimitiveCullTask(NumCulledPrimitives, Scene, View, Flags, MaxDrawDistanceScale, HLODState, VisibleNodes, SharedFrustumVisibility, TaskIndex);
 		},
 		!FApp::ShouldUseThreadingForPerformance() || (Flags.bUseCustomCulling && !View.CustomVisibilityQuery->IsThreadsafe()) || CVarParallelInitViews.GetValueOnRenderThread() == 0 || !IsInActualRenderingThread()
 		);
@@ -952,6 +1004,188 @@ static int32 PrimitiveCull(const FScene* RESTRICT Scene, FViewInfo& View, bool b
 	return NumCulledPrimitives.GetValue();
 }
 
+/** Cone enclosing the frustums of a group of close views, primitives outside of it are culled once for all of them. */
+struct FSharedViewCullingCone
+{
+	FVector Apex;
+	FVector Axis;
+	float SinAngle = 0.0f;
+	float CosAngle = 0.0f;
+	TArray<int32, TInlineAllocator<4>> ViewIndices;
+
+	/** One bit per primitive, set if the primitive bounds intersect the cone */
+	FSceneBitArray VisibilityMap;
+};
+
+/** Returns the origin, direction and half angle of the cone enclosing the frustum of a view, if the view can share culling */
+static bool GetViewCullingCone(const FViewInfo& View, FVector& OutOrigin, FVector& OutDirection, float& OutHalfAngle)
+{
+	// Instanced stereo views already cull against a single frustum enclosing both eyes
+	if (!View.IsPerspectiveProjection() || View.bIsInstancedStereoEnabled || View.bIsMobileMultiViewEnabled || View.CustomVisibilityQuery)
+	{
+		return false;
+	}
+
+	// Off center projections and jitter move the frustum edges by the Z row offsets
+	const FMatrix& ProjectionMatrix = View.ViewMatrices.GetProjectionMatrix();
+	const float TanHalfX = (1.0f + FMath::Abs(ProjectionMatrix.M[2][0])) / ProjectionMatrix.M[0][0];
+	const float TanHalfY = (1.0f + FMath::Abs(ProjectionMatrix.M[2][1])) / ProjectionMatrix.M[1][1];
+
+	OutOrigin = View.ViewMatrices.GetViewOrigin();
+	OutDirection = View.GetViewDirection();
+	OutHalfAngle = FMath::Atan(FMath::Sqrt(TanHalfX * TanHalfX + TanHalfY * TanHalfY));
+	return true;
+}
+
+/**
+ * Groups the views whose frustums are close and computes the cone enclosing each group.
+ * A view that can't share its culling, or is alone in its group, maps to INDEX_NONE.
+ */
+static void SetupSharedViewCullingCones(const FScene* Scene, TArrayView<const FViewInfo> Views, TArray<FSharedViewCullingCone>& OutCones, TArray<int32>& OutViewToCone)
+{
+	SCOPED_NAMED_EVENT(SceneVisibility_SetupSharedViewCullingCones, FColor::Red);
+
+	OutViewToCone.Init(INDEX_NONE, Views.Num());
+
+	const float MaxOriginDistanceSq = FMath::Square(CVarShareFrustumCullMaxOriginDistance.GetValueOnRenderThread());
+	const float MinDirectionDot = FMath::Cos(FMath::DegreesToRadians(CVarShareFrustumCullMaxAngle.GetValueOnRenderThread()));
+	const float MaxConeHalfAngle = FMath::DegreesToRadians(85.0f);
+
+	TArray<FVector, TInlineAllocator<4>> Origins;
+	TArray<FVector, TInlineAllocator<4>> Directions;
+	TArray<float, TInlineAllocator<4>> HalfAngles;
+	TBitArray<TInlineAllocator<1>> bCanShare;
+	Origins.SetNumUninitialized(Views.Num());
+	Directions.SetNumUninitialized(Views.Num());
+	HalfAngles.SetNumUninitialized(Views.Num());
+	bCanShare.Init(false, Views.Num());
+
+	for (int32 ViewIndex = 0; ViewIndex < Views.Num(); ++ViewIndex)
+	{
+		bCanShare[ViewIndex] = GetViewCullingCone(Views[ViewIndex], Origins[ViewIndex], Directions[ViewIndex], HalfAngles[ViewIndex]);
+	}
+
+	for (int32 FirstViewIndex = 0; FirstViewIndex < Views.Num(); ++FirstViewIndex)
+	{
+		if (!bCanShare[FirstViewIndex])
+		{
+			continue;
+		}
+
+		FSharedViewCullingCone Cone;
+		Cone.ViewIndices.Add(FirstViewIndex);
+		bCanShare[FirstViewIndex] = false;
+
+		for (int32 ViewIndex = FirstViewIndex + 1; ViewIndex < Views.Num(); ++ViewIndex)
+		{
+			if (bCanShare[ViewIndex]
+				&& FVector::DistSquared(Origins[ViewIndex], Origins[FirstViewIndex]) <= MaxOriginDistanceSq
+				&& FVector::DotProduct(Directions[ViewIndex], Directions[FirstViewIndex]) >= MinDirectionDot)
+			{
+				Cone.ViewIndices.Add(ViewIndex);
+				bCanShare[ViewIndex] = false;
+			}
+		}
+
+		if (Cone.ViewIndices.Num() < 2)
+		{
+			continue;
+		}
+
+		FVector Centroid = FVector::ZeroVector;
+		FVector AxisSum = FVector::ZeroVector;
+		for (int32 ViewIndex : Cone.ViewIndices)
+		{
+			Centroid += Origins[ViewIndex];
+			AxisSum += Directions[ViewIndex];
+		}
+		Centroid /= Cone.ViewIndices.Num();
+		Cone.Axis = AxisSum.GetSafeNormal();
+
+		float HalfAngle = 0.0f;
+		float OriginsRadius = 0.0f;
+		for (int32 ViewIndex : Cone.ViewIndices)
+		{
+			const float AngleToAxis = FMath::Acos(FMath::Clamp(FVector::DotProduct(Cone.Axis, Directions[ViewIndex]), -1.0f, 1.0f));
+			HalfAngle = FMath::Max(HalfAngle, AngleToAxis + HalfAngles[ViewIndex]);
+			OriginsRadius = FMath::Max(OriginsRadius, FVector::Dist(Centroid, Origins[ViewIndex]));
+		}
+
+		// Too wide to cull anything useful
+		if (Cone.Axis.IsZero() || HalfAngle >= MaxConeHalfAngle)
+		{
+			continue;
+		}
+
+		// Move the apex back until the sphere around all view origins is inside the cone. The cones of the views start inside it
+		// and none of their directions are further from the axis than the half angle, so their frustums are all enclosed.
+		Cone.SinAngle = FMath::Sin(HalfAngle);
+		Cone.CosAngle = FMath::Cos(HalfAngle);
+		Cone.Apex = Centroid - Cone.Axis * (OriginsRadius / Cone.SinAngle);
+
+		const int32 ConeIndex = OutCones.Add(MoveTemp(Cone));
+		for (int32 ViewIndex : OutCones[ConeIndex].ViewIndices)
+		{
+			OutViewToCone[ViewIndex] = ConeIndex;
+		}
+	}
+
+	const int32 NumPrimitives = Scene->Primitives.Num();
+	const int32 NumWords = FMath::DivideAndRoundUp(NumPrimitives, (int32)NumBitsPerDWORD);
+	const int32 NumTasks = FMath::DivideAndRoundUp(NumWords, FrustumCullNumWordsPerTask);
+
+	for (FSharedViewCullingCone& Cone : OutCones)
+	{
+		Cone.VisibilityMap.Init(false, NumPrimitives);
+
+		ParallelFor(NumTasks,
+			[Scene, &Cone, NumPrimitives, NumWords](int32 TaskIndex)
+			{
+				FTaskTagScope TaskTagScope(ETaskTag::EParallelRenderingThread);
+
+				const FVector TipOffset = Cone.Axis / Cone.SinAngle;
+				const float SinSq = Cone.SinAngle * Cone.SinAngle;
+				const float CosSq = Cone.CosAngle * Cone.CosAngle;
+				uint32* RESTRICT VisibilityWords = Cone.VisibilityMap.GetData();
+
+				const int32 FirstWordIndex = TaskIndex * FrustumCullNumWordsPerTask;
+				const int32 LastWordIndex = FMath::Min(FirstWordIndex + FrustumCullNumWordsPerTask, NumWords);
+				for (int32 WordIndex = FirstWordIndex; WordIndex < LastWordIndex; ++WordIndex)
+				{
+					uint32 VisBits = 0;
+					uint32 Mask = 0x1;
+					for (int32 Index = WordIndex * NumBitsPerDWORD; Index < FMath::Min((WordIndex + 1) * (int32)NumBitsPerDWORD, NumPrimitives); ++Index, Mask <<= 1)
+					{
+						const FBoxSphereBounds& Bounds = Scene->PrimitiveBounds[Index].BoxSphereBounds;
+						const FVector Center = Bounds.Origin;
+						const float Radius = Bounds.SphereRadius;
+
+						// Sphere against cone, with the cone moved back by the sphere radius first
+						bool bIntersects = false;
+						FVector ToCenter = Center - (Cone.Apex - TipOffset * Radius);
+						float AxisDistance = FVector::DotProduct(Cone.Axis, ToCenter);
+						if (AxisDistance > 0.0f && AxisDistance * AxisDistance >= ToCenter.SizeSquared() * CosSq)
+						{
+							// Behind the apex, the sphere must contain it
+							ToCenter = Center - Cone.Apex;
+							AxisDistance = -FVector::DotProduct(Cone.Axis, ToCenter);
+							const float DistanceSq = ToCenter.SizeSquared();
+							bIntersects = !(AxisDistance > 0.0f && AxisDistance * AxisDistance >= DistanceSq * SinSq) || DistanceSq <= Radius * Radius;
+						}
+
+						if (bIntersects)
+						{
+							VisBits |= Mask;
+						}
+					}
+					VisibilityWords[WordIndex] = VisBits;
+				}
+			},
+			!FApp::ShouldUseThreadingForPerformance() || CVarParallelInitViews.GetValueOnRenderThread() == 0 || !IsInActualRenderingThread()
+			);
+	}
+}
+
 /**
  * Updated primitive fading states for the view.
  */
@@ -4602,6 +4836,14 @@ void FSceneRenderer::ComputeViewVisibility(
 		Scene->PrimitivesNeedingStaticMeshUpdateWithoutVisibilityCheck.Reset();
 	}
 
+	// Cull once against the cones enclosing groups of close views, each view then refines against its own frustum
+	TArray<FSharedViewCullingCone> SharedViewCullingCones;
+	TArray<int32> ViewToSharedCullingCone;
+	if (Views.Num() > 1 && CVarShareFrustumCullBetweenViews.GetValueOnRenderThread() != 0 && CVarEnableFrustumCull.GetValueOnRenderThread())
+	{
+		SetupSharedViewCullingCones(Scene, Views, SharedViewCullingCones, ViewToSharedCullingCone);
+	}
+
 	uint8 ViewBit = 0x1;
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FSceneRenderer_Views);
@@ -4718,7 +4960,9 @@ void FSceneRenderer::ComputeViewVisibility(
 
 			{
 				TRACE_CPUPROFILER_EVENT_SCOPE(FSceneRenderer_Cull);
-				int32 NumCulledPrimitivesForView = PrimitiveCull(Scene, View, bNeedsFrustumCulling);
+				const int32 SharedCullingConeIndex = ViewToSharedCullingCone.IsValidIndex(ViewIndex) ? ViewToSharedCullingCone[ViewIndex] : INDEX_NONE;
+				const FSceneBitArray* SharedFrustumVisibility = SharedCullingConeIndex != INDEX_NONE ? &SharedViewCullingCones[SharedCullingConeIndex].VisibilityMap : nullptr;
+				int32 NumCulledPrimitivesForView = PrimitiveCull(Scene, View, bNeedsFrustumCulling, SharedFrustumVisibility);
 				STAT(NumCulledPrimitives += NumCulledPrimitivesForView);
 			}
 
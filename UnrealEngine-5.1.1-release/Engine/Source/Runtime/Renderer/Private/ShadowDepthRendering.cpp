@@ -699,6 +699,12 @@ static TAutoConsoleVariable<int32> CVarParallelShadowsNonWholeScene(
 	TEXT("Toggles parallel shadow rendering for non whole-scene shadows. r.ParallelShadows must be enabled for this to have an effect."),
 	ECVF_RenderThreadSafe
 );
+static TAutoConsoleVariable<int32> CVarMobileParallelShadows(
+	TEXT("r.Mobile.ParallelShadows"),
+	0,
+	TEXT("Toggles parallel shadow rendering on mobile platforms, for RHIs that record command lists in parallel (Vulkan, Metal). r.ParallelShadows must be enabled for this to have an effect."),
+	ECVF_RenderThreadSafe
+);
 
 static TAutoConsoleVariable<int32> CVarRHICmdFlushRenderThreadTasksShadowPass(
 	TEXT("r.RHICmdFlushRenderThreadTasksShadowPass"),
@@ -1491,8 +1497,8 @@ bool IsParallelDispatchEnabled(const FProjectedShadowInfo* ProjectedShadowInfo,
 {
 	return GRHICommandList.UseParallelAlgorithms() && CVarParallelShadows.GetValueOnRenderThread()
 		&& (ProjectedShadowInfo->IsWholeSceneDirectionalShadow() || CVarParallelShadowsNonWholeScene.GetValueOnRenderThread())
-		// Parallel dispatch is not supported on mobile platform
-		&& !IsMobilePlatform(ShaderPlatform);
+		// Parallel dispatch is opt-in on mobile platforms
+		&& (!IsMobilePlatform(ShaderPlatform) || CVarMobileParallelShadows.GetValueOnRenderThread());
 }
 
 void FSceneRenderer::RenderShadowDepthMapAtlases(FRDGBuilder& GraphBuilder)
@@ -24,6 +24,7 @@
 #include "VT/VirtualTexturePoolConfig.h"
 #include "VT/VirtualTextureScalability.h"
 #include "VT/VirtualTextureSpace.h"
+#include "ContentStreaming.h"
 
 #define LOCTEXT_NAMESPACE "VirtualTexture"
 
@@ -373,6 +374,7 @@ FVirtualTextureSystem::~FVirtualTextureSystem()
 			BeginReleaseResource(PhysicalSpace);
 		}
 	}
+	SetStreamingGPUPoolSize(EStreamingGPUPool::VirtualTexture, 0);
 }
 
 void FVirtualTextureSystem::FlushCachesFromConsole()
@@ -1035,6 +1037,7 @@ FVirtualTexturePhysicalSpace* FVirtualTextureSystem::AcquirePhysicalSpace(const
 
 	INC_MEMORY_STAT_BY(STAT_TotalPhysicalMemory, PhysicalSpace->GetSizeInBytes());
 	BeginInitResource(PhysicalSpace);
+	UpdateStreamingGPUPoolSize();
 
 	return PhysicalSpace;
 }
@@ -1042,6 +1045,7 @@ FVirtualTexturePhysicalSpace* FVirtualTextureSystem::AcquirePhysicalSpace(const
 void FVirtualTextureSystem::ReleasePendingSpaces()
 {
 	check(IsInRenderingThread());
+	bool bReleasedSpaces = false;
 	for (int32 Id = 0; Id < PhysicalSpaces.Num(); ++Id)
 	{
 		// Physical space is released when ref count hits 0
@@ -1058,8 +1062,27 @@ void FVirtualTextureSystem::ReleasePendingSpaces()
 			PhysicalSpace->ReleaseResource();
 			delete PhysicalSpace;
 			PhysicalSpaces[Id] = nullptr;
+			bReleasedSpaces = true;
 		}
 	}
+
+	if (bReleasedSpaces)
+	{
+		UpdateStreamingGPUPoolSize();
+	}
+}
+
+void FVirtualTextureSystem::UpdateStreamingGPUPoolSize()
+{
+	int64 TotalPhysicalMemory = 0;
+	for (const FVirtualTexturePhysicalSpace* PhysicalSpace : PhysicalSpaces)
+	{
+		if (PhysicalSpace)
+		{
+			TotalPhysicalMemory += PhysicalSpace->GetSizeInBytes();
+		}
+	}
+	SetStreamingGPUPoolSize(EStreamingGPUPool::VirtualTexture, TotalPhysicalMemory);
 }
 
 void FVirtualTextureSystem::LockTile(const FVirtualTextureLocalTile& Tile)
@@ -14,6 +14,7 @@
 #include "IHeadMountedDisplay.h"
 #include "IXRTrackingSystem.h"
 #include "Engine/Engine.h"
+#include "SceneRendering.h"
 
 const int32 kComputeGroupSize = FComputeShaderUtils::kGolden2DGroupSize;
 
@@ -49,6 +50,25 @@ static TAutoConsoleVariable<int32> CVarHMDFixedFoveationDynamic(
 	TEXT(" 1: Enabled\n"),
 	ECVF_RenderThreadSafe);
 
+static TAutoConsoleVariable<int32> CVarContrastAdaptiveShading(
+	TEXT("r.VRS.ContrastAdaptiveShading"),
+	0,
+	TEXT("Lowers the shading rate of the base pass and translucency where last frame's image has low luminance contrast or fast motion (when image based Variable Rate Shading is available)\n")
+	TEXT(" 0: Disabled (default);\n")
+	TEXT(" 1: Performance, coarsest shading rates;\n")
+	TEXT(" 2: Balanced;\n")
+	TEXT(" 3: Quality, only very flat or fast moving areas are coarsened.\n")
+	TEXT("Compare the GPU time of the BasePass and Translucency stats with VRSContrastAdaptive added, against this disabled."),
+	ECVF_RenderThreadSafe | ECVF_Scalability);
+
+static TAutoConsoleVariable<int32> CVarContrastAdaptiveShadingUseMotion(
+	TEXT("r.VRS.ContrastAdaptiveShading.UseMotion"),
+	1,
+	TEXT("Whether fast motion in last frame's TSR velocity lowers the shading rate, where motion blur and temporal upscaling hide the loss of detail."),
+	ECVF_RenderThreadSafe);
+
+DECLARE_GPU_STAT_NAMED(VRSContrastAdaptive, TEXT("VRS Contrast Adaptive"));
+
 TGlobalResource<FVariableRateShadingImageManager> GVRSImageManager;
 
 class FComputeVariableRateShadingImageGeneration : public FGlobalShader
@@ -103,6 +123,75 @@ public:
 
 IMPLEMENT_GLOBAL_SHADER(FComputeVariableRateShadingImageGeneration, "/Engine/Private/VariableRateShading.usf", "GenerateShadingRateTexture", SF_Compute);
 
+class FComputeContrastAdaptiveShadingImage : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FComputeContrastAdaptiveShadingImage);
+	SHADER_USE_PARAMETER_STRUCT(FComputeContrastAdaptiveShadingImage, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<uint>, RWOutputTexture)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, HistoryColorTexture)
+		SHADER_PARAMETER_SAMPLER(SamplerState, HistoryColorSampler)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, VelocityTexture)
+		SHADER_PARAMETER_SAMPLER(SamplerState, VelocitySampler)
+		SHADER_PARAMETER(FVector4f, HistoryColorUVScaleBias)
+		SHADER_PARAMETER(FVector4f, VelocityUVScaleBias)
+		SHADER_PARAMETER(FIntPoint, ViewRectMin)
+		SHADER_PARAMETER(FIntPoint, ViewSize)
+		SHADER_PARAMETER(FIntPoint, TileOffset)
+		SHADER_PARAMETER(FIntPoint, TileCount)
+		SHADER_PARAMETER(float, FullRateContrastThreshold)
+		SHADER_PARAMETER(float, QuarterRateContrastThreshold)
+		SHADER_PARAMETER(float, HalfRateMotionPixels)
+		SHADER_PARAMETER(float, QuarterRateMotionPixels)
+		SHADER_PARAMETER(uint32, bUseVelocity)
+		SHADER_PARAMETER(uint32, bAllowQuarterRate)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return FDataDrivenShaderPlatformInfo::GetSupportsVariableRateShading(Parameters.Platform);
+	}
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+
+		OutEnvironment.SetDefine(TEXT("SHADING_RATE_1x1"), VRSSR_1x1);
+		OutEnvironment.SetDefine(TEXT("SHADING_RATE_1x2"), VRSSR_1x2);
+		OutEnvironment.SetDefine(TEXT("SHADING_RATE_2x1"), VRSSR_2x1);
+		OutEnvironment.SetDefine(TEXT("SHADING_RATE_2x2"), VRSSR_2x2);
+		OutEnvironment.SetDefine(TEXT("SHADING_RATE_4x4"), VRSSR_4x4);
+
+		OutEnvironment.SetDefine(TEXT("SHADING_RATE_TILE_WIDTH"), GRHIVariableRateShadingImageTileMinWidth);
+		OutEnvironment.SetDefine(TEXT("SHADING_RATE_TILE_HEIGHT"), GRHIVariableRateShadingImageTileMinHeight);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZEX"), kComputeGroupSize);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZEY"), kComputeGroupSize);
+	}
+};
+
+IMPLEMENT_GLOBAL_SHADER(FComputeContrastAdaptiveShadingImage, "/Engine/Private/VariableRateShadingContrastAdaptive.usf", "GenerateContrastAdaptiveShadingRate", SF_Compute);
+
+/**
+ * Contrast adaptive shading quality presets, indexed by r.VRS.ContrastAdaptiveShading - 1.
+ * Contrast is the normalized luminance difference between neighboring pixels, motion is in pixels per frame.
+ */
+struct FContrastAdaptiveShadingPreset
+{
+	float FullRateContrastThreshold;
+	float QuarterRateContrastThreshold;
+	float HalfRateMotionPixels;
+	float QuarterRateMotionPixels;
+};
+
+static const FContrastAdaptiveShadingPreset kContrastAdaptiveShadingPresets[] =
+{
+	{ 0.25f, 0.10f,  8.0f, 24.0f },	// Performance
+	{ 0.15f, 0.05f, 12.0f, 32.0f },	// Balanced
+	{ 0.08f, 0.02f, 24.0f, 64.0f },	// Quality
+};
+
 /**
  * Struct containing parameters used to build a VRS image.
  */
@@ -166,6 +255,7 @@ void FVariableRateShadingImageManager::ReleaseDynamicRHI()
 	}
 
 	ActiveVRSImages.Empty();
+	ContrastAdaptiveImage.SafeRelease();
 
 	GRenderTargetPool.FreeUnusedResources();
 }
@@ -228,6 +318,19 @@ FRDGTextureRef FVariableRateShadingImageManager::GetVariableRateShadingImage(FRD
 
 	// @todo: Other VRS generation flags here.
 
+	// Built from last frame's image every frame, so never cached with the static images
+	FRDGTextureRef ContrastAdaptiveTexture = nullptr;
+	const int32 ContrastAdaptiveQuality = FMath::Clamp(CVarContrastAdaptiveShading.GetValueOnRenderThread(), 0, int32(UE_ARRAY_COUNT(kContrastAdaptiveShadingPresets)));
+	if (ContrastAdaptiveQuality > 0 && !EnumHasAnyFlags(VRSTypesToExclude, EVRSType::ContrastAdaptive))
+	{
+		ContrastAdaptiveTexture = GetContrastAdaptiveShadingImage(GraphBuilder, ViewFamily, VRSImageParams.Size, ContrastAdaptiveQuality);
+	}
+
+	if (GenFlags == EVRSGenerationFlags::None && ContrastAdaptiveTexture)
+	{
+		return ContrastAdaptiveTexture;
+	}
+
 	if (GenFlags == EVRSGenerationFlags::None)
 	{
 		if (ExternalVRSSources == nullptr || ExternalVRSSources->Num() == 0)
@@ -256,6 +359,13 @@ FRDGTextureRef FVariableRateShadingImageManager::GetVariableRateShadingImage(FRD
 	}
 
 	const uint64 Key = CalculateVRSImageHash(VRSImageParams, GenFlags);
+
+	if (ContrastAdaptiveTexture)
+	{
+		// Combine with the foveation image, which makes the result change every frame too
+		return GraphBuilder.RegisterExternalTexture(RenderShadingRateImage(GraphBuilder, Key, VRSImageParams, GenFlags, ContrastAdaptiveTexture));
+	}
+
 	FActiveTarget* ActiveTarget = ActiveVRSImages.Find(Key);
 	if (ActiveTarget == nullptr)
 	{
@@ -268,7 +378,7 @@ FRDGTextureRef FVariableRateShadingImageManager::GetVariableRateShadingImage(FRD
 	return GraphBuilder.RegisterExternalTexture(ActiveTarget->Target);
 }
 
-TRefCountPtr<IPooledRenderTarget> FVariableRateShadingImageManager::RenderShadingRateImage(FRDGBuilder& GraphBuilder, uint64 Key, const FVRSImageGenerationParameters& VRSImageGenParamsIn, EVRSGenerationFlags GenFlags)
+TRefCountPtr<IPooledRenderTarget> FVariableRateShadingImageManager::RenderShadingRateImage(FRDGBuilder& GraphBuilder, uint64 Key, const FVRSImageGenerationParameters& VRSImageGenParamsIn, EVRSGenerationFlags GenFlags, FRDGTextureRef CombineSource)
 {
 	// Sanity check VRS tile size.
 	check(GRHIVariableRateShadingImageTileMinWidth >= 8 && GRHIVariableRateShadingImageTileMinWidth <= 64 && GRHIVariableRateShadingImageTileMinHeight >= 8 && GRHIVariableRateShadingImageTileMaxHeight <= 64);
@@ -322,6 +432,12 @@ TRefCountPtr<IPooledRenderTarget> FVariableRateShadingImageManager::RenderShadin
 		PassParameters->CombineSourceIn[i] = GraphBuilder.RegisterExternalTexture(GSystemTextures.WhiteDummy, TEXT("CombineSourceDummy"));
 	}
 
+	if (CombineSource)
+	{
+		PassParameters->CombineSourceIn[0] = CombineSource;
+		PassParameters->CombineSourceCount = 1;
+	}
+
 	TShaderMapRef<FComputeVariableRateShadingImageGeneration> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
 
 	FIntVector GroupCount = FComputeShaderUtils::GetGroupCount(AttachmentSize, FComputeShaderUtils::kGolden2DGroupSize);
@@ -335,11 +451,145 @@ TRefCountPtr<IPooledRenderTarget> FVariableRateShadingImageManager::RenderShadin
 		FComputeShaderUtils::Dispatch(RHICmdList, ComputeShader, *PassParameters, GroupCount);
 	});
 
-	ActiveVRSImages.Add(Key, FActiveTarget(Attachment));
+	// Images combined with a per frame source are rebuilt every frame
+	if (!CombineSource)
+	{
+		ActiveVRSImages.Add(Key, FActiveTarget(Attachment));
+	}
 
 	return Attachment;
 }
 
+FRDGTextureRef FVariableRateShadingImageManager::GetContrastAdaptiveShadingImage(FRDGBuilder& GraphBuilder, const FSceneViewFamily& ViewFamily, FIntPoint Size, int32 Quality)
+{
+	const FIntPoint TileSize(GRHIVariableRateShadingImageTileMinWidth, GRHIVariableRateShadingImageTileMinHeight);
+	const FIntPoint AttachmentSize(Size.X / TileSize.X, Size.Y / TileSize.Y);
+
+	// The base pass and translucency share the image of the frame
+	if (ContrastAdaptiveImage.IsValid() && ContrastAdaptiveImageFrame == GFrameNumberRenderThread && ContrastAdaptiveImageFamily == &ViewFamily
+		&& ContrastAdaptiveImage->GetDesc().Extent == AttachmentSize)
+	{
+		return GraphBuilder.RegisterExternalTexture(ContrastAdaptiveImage);
+	}
+
+	ContrastAdaptiveImage.SafeRelease();
+	ContrastAdaptiveImageFamily = &ViewFamily;
+	ContrastAdaptiveImageFrame = GFrameNumberRenderThread;
+
+	const FContrastAdaptiveShadingPreset& Preset = kContrastAdaptiveShadingPresets[Quality - 1];
+	const bool bUseMotion = CVarContrastAdaptiveShadingUseMotion.GetValueOnRenderThread() > 0;
+
+	RDG_EVENT_SCOPE(GraphBuilder, "VRSContrastAdaptive");
+	RDG_GPU_STAT_SCOPE(GraphBuilder, VRSContrastAdaptive);
+
+	FRDGTextureRef Texture = nullptr;
+	TShaderMapRef<FComputeContrastAdaptiveShadingImage> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+
+	for (const FSceneView* SceneView : ViewFamily.Views)
+	{
+		if (!SceneView->bIsViewInfo)
+		{
+			continue;
+		}
+
+		const FViewInfo& View = static_cast<const FViewInfo&>(*SceneView);
+		const FTSRHistory& TSRHistory = View.PrevViewInfo.TSRHistory;
+		const FTemporalAAHistory& TAAHistory = View.PrevViewInfo.TemporalAAHistory;
+
+		// Last frame's output is the closest thing to what will be shaded this frame
+		TRefCountPtr<IPooledRenderTarget> HistoryColor;
+		FIntRect HistoryColorRect;
+		if (TSRHistory.IsValid() && TSRHistory.Output.IsValid())
+		{
+			HistoryColor = TSRHistory.Output;
+			HistoryColorRect = TSRHistory.OutputViewportRect;
+		}
+		else if (TAAHistory.IsValid())
+		{
+			HistoryColor = TAAHistory.RT[0];
+			HistoryColorRect = TAAHistory.ViewportRect;
+		}
+
+		if (!HistoryColor.IsValid() || View.bCameraCut || HistoryColorRect.IsEmpty())
+		{
+			continue;
+		}
+
+		if (!Texture)
+		{
+			const FRDGTextureDesc Desc = FRDGTextureDesc::Create2D(AttachmentSize, GRHIVariableRateShadingImageFormat, FClearValueBinding::None, TexCreate_Foveation | TexCreate_UAV);
+			Texture = GraphBuilder.CreateTexture(Desc, TEXT("VariableRateShadingContrastAdaptive"));
+
+			// Full rate outside of the views
+			AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(Texture), uint32(VRSSR_1x1));
+		}
+
+		const FIntPoint HistoryColorExtent = HistoryColor->GetDesc().Extent;
+		const bool bUseVelocity = bUseMotion && TSRHistory.IsValid() && TSRHistory.Velocity.IsValid() && !TSRHistory.InputViewportRect.IsEmpty();
+
+		FComputeContrastAdaptiveShadingImage::FParameters* PassParameters = GraphBuilder.AllocParameters<FComputeContrastAdaptiveShadingImage::FParameters>();
+		PassParameters->RWOutputTexture = GraphBuilder.CreateUAV(Texture);
+		PassParameters->HistoryColorTexture = GraphBuilder.RegisterExternalTexture(HistoryColor);
+		PassParameters->HistoryColorSampler = TStaticSamplerState<SF_Bilinear>::GetRHI();
+		PassParameters->HistoryColorUVScaleBias = FVector4f(
+			float(HistoryColorRect.Width()) / HistoryColorExtent.X,
+			float(HistoryColorRect.Height()) / HistoryColorExtent.Y,
+			float(HistoryColorRect.Min.X) / HistoryColorExtent.X,
+			float(HistoryColorRect.Min.Y) / HistoryColorExtent.Y);
+
+		if (bUseVelocity)
+		{
+			const FIntPoint VelocityExtent = TSRHistory.Velocity->GetDesc().Extent;
+			const FIntRect& VelocityRect = TSRHistory.InputViewportRect;
+			PassParameters->VelocityTexture = GraphBuilder.RegisterExternalTexture(TSRHistory.Velocity);
+			PassParameters->VelocityUVScaleBias = FVector4f(
+				float(VelocityRect.Width()) / VelocityExtent.X,
+				float(VelocityRect.Height()) / VelocityExtent.Y,
+				float(VelocityRect.Min.X) / VelocityExtent.X,
+				float(VelocityRect.Min.Y) / VelocityExtent.Y);
+		}
+		else
+		{
+			PassParameters->VelocityTexture = GSystemTextures.GetBlackDummy(GraphBuilder);
+			PassParameters->VelocityUVScaleBias = FVector4f(1.0f, 1.0f, 0.0f, 0.0f);
+		}
+		PassParameters->VelocitySampler = TStaticSamplerState<SF_Point>::GetRHI();
+
+		const FIntPoint TileMin(View.ViewRect.Min.X / TileSize.X, View.ViewRect.Min.Y / TileSize.Y);
+		const FIntPoint TileMax(FMath::DivideAndRoundUp(View.ViewRect.Max.X, TileSize.X), FMath::DivideAndRoundUp(View.ViewRect.Max.Y, TileSize.Y));
+
+		PassParameters->ViewRectMin = View.ViewRect.Min;
+		PassParameters->ViewSize = View.ViewRect.Size();
+		PassParameters->TileOffset = TileMin;
+		PassParameters->TileCount = FIntPoint(FMath::Min(TileMax.X, AttachmentSize.X) - TileMin.X, FMath::Min(TileMax.Y, AttachmentSize.Y) - TileMin.Y);
+		PassParameters->FullRateContrastThreshold = Preset.FullRateContrastThreshold;
+		PassParameters->QuarterRateContrastThreshold = Preset.QuarterRateContrastThreshold;
+		PassParameters->HalfRateMotionPixels = Preset.HalfRateMotionPixels;
+		PassParameters->QuarterRateMotionPixels = Preset.QuarterRateMotionPixels;
+		PassParameters->bUseVelocity = bUseVelocity ? 1 : 0;
+		PassParameters->bAllowQuarterRate = GRHISupportsLargerVariableRateShadingSizes ? 1 : 0;
+
+		if (PassParameters->TileCount.X <= 0 || PassParameters->TileCount.Y <= 0)
+		{
+			continue;
+		}
+
+		FComputeShaderUtils::AddPass(
+			GraphBuilder,
+			RDG_EVENT_NAME("GenerateContrastAdaptiveShadingRate %dx%d", PassParameters->TileCount.X, PassParameters->TileCount.Y),
+			ComputeShader,
+			PassParameters,
+			FComputeShaderUtils::GetGroupCount(PassParameters->TileCount, kComputeGroupSize));
+	}
+
+	if (Texture)
+	{
+		ContrastAdaptiveImage = GraphBuilder.ConvertToExternalTexture(Texture);
+	}
+
+	return Texture;
+}
+
 TRefCountPtr<IPooledRenderTarget> FVariableRateShadingImageManager::GetMobileVariableRateShadingImage(const FSceneViewFamily& ViewFamily)
 {
 	if (!(IStereoRendering::IsStereoEyeView(*ViewFamily.Views[0]) && GEngine->XRSystem.IsValid()))
@@ -69,6 +69,38 @@ static FAutoConsoleVariableRef  CVarForceInvalidateDirectionalVSM(
 	TEXT("Forces the clipmap to always invalidate, useful to emulate a moving sun to avoid misrepresenting cache performance."),
 	ECVF_RenderThreadSafe);
 
+static TAutoConsoleVariable<int32> CVarShowInvalidationReasons(
+	TEXT("r.Shadow.Virtual.Cache.ShowInvalidationReasons"),
+	0,
+	TEXT("Show on screen why cached virtual shadow map pages were invalidated last frame, per reason.\n")
+	TEXT("Whole shadow map invalidations are counted in shadow maps, the others in instances. The same counts are published in stat ShadowRendering."),
+	ECVF_RenderThreadSafe);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("VSM Invalidated Maps: Not Cached"), STAT_VSMInvalidationNotCached, STATGROUP_ShadowRendering);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VSM Invalidated Maps: Light Moved"), STAT_VSMInvalidationLightMoved, STATGROUP_ShadowRendering);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VSM Invalidated Maps: Clipmap Moved"), STAT_VSMInvalidationClipmapMoved, STATGROUP_ShadowRendering);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VSM Invalidated Maps: Distant Light Update"), STAT_VSMInvalidationDistantLightUpdate, STATGROUP_ShadowRendering);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VSM Invalidated Maps: Forced"), STAT_VSMInvalidationForced, STATGROUP_ShadowRendering);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VSM Invalidating Instances: Removed"), STAT_VSMInvalidationPrimitiveRemoved, STATGROUP_ShadowRendering);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VSM Invalidating Instances: Updated"), STAT_VSMInvalidationPrimitiveUpdated, STATGROUP_ShadowRendering);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VSM Invalidating Instances: Deformable Mesh"), STAT_VSMInvalidationDeformableMesh, STATGROUP_ShadowRendering);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VSM Invalidating Instances: Dynamic Primitive"), STAT_VSMInvalidationDynamicPrimitive, STATGROUP_ShadowRendering);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VSM Invalidating Instances: Static To Dynamic"), STAT_VSMInvalidationStaticToDynamic, STATGROUP_ShadowRendering);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VSM Invalidating Instances: Static Pages"), STAT_VSMInvalidationStaticPages, STATGROUP_ShadowRendering);
+
+// Invalidations recorded since the stats were last published, only touched from the rendering thread
+static uint32 GVSMInvalidationCounts[(int32)EVirtualShadowMapInvalidationReason::Num] = {};
+static uint32 GVSMStaticPageInvalidationCount = 0;
+
+void FVirtualShadowMapArrayCacheManager::RecordInvalidation(EVirtualShadowMapInvalidationReason Reason, uint32 Count, bool bStaticPages)
+{
+	GVSMInvalidationCounts[(int32)Reason] += Count;
+	if (bStaticPages)
+	{
+		GVSMStaticPageInvalidationCount += Count;
+	}
+}
+
 
 void FVirtualShadowMapCacheEntry::UpdateClipmap(
 	int32 VirtualShadowMapId,
@@ -82,10 +114,12 @@ void FVirtualShadowMapCacheEntry::UpdateClipmap(
 	const FVirtualShadowMapPerLightCacheEntry& PerLightEntry)
 {
 	bool bCacheValid = (CurrentVirtualShadowMapId != INDEX_NONE) && GForceInvalidateDirectionalVSM == 0;
+	EVirtualShadowMapInvalidationReason InvalidationReason = CurrentVirtualShadowMapId == INDEX_NONE ? EVirtualShadowMapInvalidationReason::NotCached : EVirtualShadowMapInvalidationReason::Forced;
 	
 	if (bCacheValid && WorldToLight != Clipmap.WorldToLight)
 	{
 		bCacheValid = false;
+		InvalidationReason = EVirtualShadowMapInvalidationReason::LightMoved;
 		//UE_LOG(LogRenderer, Display, TEXT("Invalidated clipmap level (VSM %d) due to light movement"), VirtualShadowMapId);
 	}
 
@@ -95,6 +129,7 @@ void FVirtualShadowMapCacheEntry::UpdateClipmap(
 			PageSpaceLocation.Y != PrevPageSpaceLocation.Y)
 		{
 			bCacheValid = false;
+			InvalidationReason = EVirtualShadowMapInvalidationReason::ClipmapMoved;
 			//UE_LOG(LogRenderer, Display, TEXT("Invalidated clipmap level (VSM %d) with page space location %d,%d (Prev %d, %d)"),
 			//	VirtualShadowMapId, PageSpaceLocation.X, PageSpaceLocation.Y, PrevPageSpaceLocation.X, PrevPageSpaceLocation.Y);
 		}
@@ -107,6 +142,7 @@ void FVirtualShadowMapCacheEntry::UpdateClipmap(
 		if ((DeltaZ + LevelRadius) > 0.9 * Clipmap.ViewRadiusZ)
 		{
 			bCacheValid = false;
+			InvalidationReason = EVirtualShadowMapInvalidationReason::ClipmapMoved;
 			//UE_LOG(LogRenderer, Display, TEXT("Invalidated clipmap level (VSM %d) due to depth range movement"), VirtualShadowMapId);
 		}
 	}
@@ -114,6 +150,10 @@ void FVirtualShadowMapCacheEntry::UpdateClipmap(
 	// Not valid if it was never rendered
 	if (PerLightEntry.PrevRenderedFrameNumber < 0)
 	{
+		if (bCacheValid)
+		{
+			InvalidationReason = EVirtualShadowMapInvalidationReason::NotCached;
+		}
 		bCacheValid = false;
 	}
 
@@ -129,7 +169,9 @@ void FVirtualShadowMapCacheEntry::UpdateClipmap(
 		{
 			// These really should be exact by construction currently
 			UE_LOG(LogRenderer, Warning, TEXT("Invalidated clipmap level (VSM %d) due to Z radius mismatch"), VirtualShadowMapId);
+			InvalidationReason = EVirtualShadowMapInvalidationReason::ClipmapMoved;
 		}
+		FVirtualShadowMapArrayCacheManager::RecordInvalidation(InvalidationReason);
 
 		// New cached level
 		PrevVirtualShadowMapId = INDEX_NONE;
@@ -153,16 +195,21 @@ void FVirtualShadowMapCacheEntry::UpdateLocal(int32 VirtualShadowMapId, const FV
 	PrevPageSpaceLocation = FInt64Point(0, 0);		// Not used for local lights
 	PrevVirtualShadowMapId = CurrentVirtualShadowMapId;
 
+	if (PrevVirtualShadowMapId == INDEX_NONE)
+	{
+		FVirtualShadowMapArrayCacheManager::RecordInvalidation(EVirtualShadowMapInvalidationReason::NotCached);
+	}
 	// Not valid if it was never rendered
-	if (PerLightEntry.PrevRenderedFrameNumber < 0)
+	else if (PerLightEntry.PrevRenderedFrameNumber < 0)
 	{
 		PrevVirtualShadowMapId = INDEX_NONE;
+		FVirtualShadowMapArrayCacheManager::RecordInvalidation(PerLightEntry.InvalidationReason);
 	}
-
 	// Invalidate on transition from distant to full
-	if (!PerLightEntry.bCurrentIsDistantLight && PerLightEntry.bPrevIsDistantLight)
+	else if (!PerLightEntry.bCurrentIsDistantLight && PerLightEntry.bPrevIsDistantLight)
 	{
 		PrevVirtualShadowMapId = INDEX_NONE;
+		FVirtualShadowMapArrayCacheManager::RecordInvalidation(EVirtualShadowMapInvalidationReason::DistantLightUpdate);
 	}
 
 	CurrentVirtualShadowMapId = VirtualShadowMapId;
@@ -194,6 +241,7 @@ void FVirtualShadowMapPerLightCacheEntry::UpdateLocal(const FProjectedShadowInit
 		if (!bIsDistantLight)
 		{
 			PrevRenderedFrameNumber = -1;
+			InvalidationReason = EVirtualShadowMapInvalidationReason::LightMoved;
 		}
 		//UE_LOG(LogRenderer, Display, TEXT("Invalidated!"));
 	}
@@ -207,6 +255,9 @@ void FVirtualShadowMapPerLightCacheEntry::UpdateLocal(const FProjectedShadowInit
 void FVirtualShadowMapPerLightCacheEntry::Invalidate()
 {
 	PrevRenderedFrameNumber = -1;
+	// Only the distant light update queue invalidates a light explicitly
+	InvalidationReason = EVirtualShadowMapInvalidationReason::DistantLightUpdate;
+	FVirtualShadowMapArrayCacheManager::RecordInvalidation(InvalidationReason, ShadowMapEntries.Num());
 
 	for (TSharedPtr<FVirtualShadowMapCacheEntry>& Entry : ShadowMapEntries)
 	{
@@ -244,6 +295,7 @@ FVirtualShadowMapArrayCacheManager::FInvalidatingPrimitiveCollector::FInvalidati
 	{
 		// Dynamic primitives are never cached as static; see  FUploadDataSourceAdapterDynamicPrimitives::GetPrimitiveInfo
 		LoadBalancer.Add(Range.InstanceSceneDataOffset, Range.NumInstanceSceneDataEntries, EncodeInstanceInvalidationPayload(false));
+		FVirtualShadowMapArrayCacheManager::RecordInvalidation(EVirtualShadowMapInvalidationReason::DynamicPrimitive, Range.NumInstanceSceneDataEntries);
 #if VSM_LOG_INVALIDATIONS
 		RangesStr.Appendf(TEXT("[%6d, %6d), "), Range.InstanceSceneDataOffset, Range.InstanceSceneDataOffset + Range.NumInstanceSceneDataEntries);
 #endif
@@ -266,6 +318,7 @@ FVirtualShadowMapArrayCacheManager::FInvalidatingPrimitiveCollector::FInvalidati
 						EncodeInstanceInvalidationPayload(Range.bInvalidateStaticPage, SmCacheEntry->CurrentVirtualShadowMapId));
 				}
 			}
+			FVirtualShadowMapArrayCacheManager::RecordInvalidation(EVirtualShadowMapInvalidationReason::DeformableMesh, Range.NumInstanceSceneDataEntries, Range.bInvalidateStaticPage);
 
 #if VSM_LOG_INVALIDATIONS
 			RangesStr.Appendf(TEXT("[%6d, %6d), "), Range.InstanceSceneDataOffset, Range.InstanceSceneDataOffset + Range.NumInstanceSceneDataEntries);
@@ -311,7 +364,7 @@ FVirtualShadowMapArrayCacheManager::FInvalidatingPrimitiveCollector::FInvalidati
 #if VSM_LOG_STATIC_CACHING
 						UE_LOG(LogRenderer, Warning, TEXT("Transitioning GPU invalidation to dynamic caching: %u"), PersistentPrimitiveIndex.Index);
 #endif
-						AddInvalidation(PrimitiveSceneInfo, false);
+						AddInvalidation(PrimitiveSceneInfo, false, EVirtualShadowMapInvalidationReason::StaticToDynamic);
 					}
 				}
 			}
@@ -319,7 +372,7 @@ FVirtualShadowMapArrayCacheManager::FInvalidatingPrimitiveCollector::FInvalidati
 	}
 }
 
-void FVirtualShadowMapArrayCacheManager::FInvalidatingPrimitiveCollector::AddInvalidation(FPrimitiveSceneInfo * PrimitiveSceneInfo, bool bRemovedPrimitive)
+void FVirtualShadowMapArrayCacheManager::FInvalidatingPrimitiveCollector::AddInvalidation(FPrimitiveSceneInfo * PrimitiveSceneInfo, bool bRemovedPrimitive, EVirtualShadowMapInvalidationReason InvalidationReason)
 {
 	int32 PrimitiveID = PrimitiveSceneInfo->GetIndex();
 	if (PrimitiveID >= 0
@@ -383,6 +436,7 @@ void FVirtualShadowMapArrayCacheManager::FInvalidatingPrimitiveCollector::AddInv
 #if VSM_LOG_INVALIDATIONS
 		RangesStr.Appendf(TEXT("[%6d, %6d), "), PrimitiveSceneInfo->GetInstanceSceneDataOffset(), PrimitiveSceneInfo->GetInstanceSceneDataOffset() + NumInstanceSceneDataEntries);
 #endif
+		FVirtualShadowMapArrayCacheManager::RecordInvalidation(InvalidationReason, NumInstanceSceneDataEntries, bPreviouslyCachedAsStatic);
 		TotalInstanceCount += NumInstanceSceneDataEntries;
 	}
 }
@@ -519,6 +573,36 @@ FVirtualShadowMapArrayCacheManager::FVirtualShadowMapArrayCacheManager(FScene* I
 		{
 			OutMessages.Add(FCoreDelegates::EOnScreenMessageSeverity::Warning, FText::FromString(FString::Printf(TEXT("Virtual Shadow Map Page Pool overflow detected (%d frames ago)"), CurrentFrameNumber - LastOverflowFrame)));
 		}
+
+		if (CVarShowInvalidationReasons.GetValueOnAnyThread() != 0)
+		{
+			static const TCHAR* ReasonNames[] =
+			{
+				TEXT("Not Cached"),
+				TEXT("Light Moved"),
+				TEXT("Clipmap Moved"),
+				TEXT("Distant Light Update"),
+				TEXT("Forced"),
+				TEXT("Primitive Removed"),
+				TEXT("Primitive Updated"),
+				TEXT("Deformable Mesh"),
+				TEXT("Dynamic Primitive"),
+				TEXT("Static To Dynamic"),
+			};
+			static_assert(UE_ARRAY_COUNT(ReasonNames) == (int32)EVirtualShadowMapInvalidationReason::Num, "Missing invalidation reason name");
+
+			FString Message = TEXT("VSM invalidations, shadow maps:");
+			for (int32 Reason = 0; Reason < (int32)EVirtualShadowMapInvalidationReason::Num; ++Reason)
+			{
+				if (Reason == (int32)EVirtualShadowMapInvalidationReason::PrimitiveRemoved)
+				{
+					Message += TEXT(" | instances:");
+				}
+				Message += FString::Printf(TEXT(" %s %u"), ReasonNames[Reason], LastInvalidationCounts[Reason]);
+			}
+			Message += FString::Printf(TEXT(" (static pages %u)"), LastStaticPageInvalidationCount);
+			OutMessages.Add(FCoreDelegates::EOnScreenMessageSeverity::Info, FText::FromString(Message));
+		}
 	});
 #endif
 }
@@ -593,6 +677,11 @@ void FVirtualShadowMapArrayCacheManager::FreeHZBPhysicalPool()
 
 void FVirtualShadowMapArrayCacheManager::Invalidate()
 {
+	for (const auto& CacheEntry : PrevCacheEntries)
+	{
+		RecordInvalidation(EVirtualShadowMapInvalidationReason::Forced, CacheEntry.Value->ShadowMapEntries.Num());
+	}
+
 	// Clear the cache
 	PrevCacheEntries.Empty();
 	CacheEntries.Reset();
@@ -796,6 +885,31 @@ void FVirtualShadowMapArrayCacheManager::ExtractFrameData(
 		RecentlyRemovedReadIndex = 1 - RecentlyRemovedReadIndex;
 		RecentlyRemovedFrameCounter = 0;
 	}
+
+	PublishInvalidationStats();
+}
+
+void FVirtualShadowMapArrayCacheManager::PublishInvalidationStats()
+{
+	SET_DWORD_STAT(STAT_VSMInvalidationNotCached, GVSMInvalidationCounts[(int32)EVirtualShadowMapInvalidationReason::NotCached]);
+	SET_DWORD_STAT(STAT_VSMInvalidationLightMoved, GVSMInvalidationCounts[(int32)EVirtualShadowMapInvalidationReason::LightMoved]);
+	SET_DWORD_STAT(STAT_VSMInvalidationClipmapMoved, GVSMInvalidationCounts[(int32)EVirtualShadowMapInvalidationReason::ClipmapMoved]);
+	SET_DWORD_STAT(STAT_VSMInvalidationDistantLightUpdate, GVSMInvalidationCounts[(int32)EVirtualShadowMapInvalidationReason::DistantLightUpdate]);
+	SET_DWORD_STAT(STAT_VSMInvalidationForced, GVSMInvalidationCounts[(int32)EVirtualShadowMapInvalidationReason::Forced]);
+	SET_DWORD_STAT(STAT_VSMInvalidationPrimitiveRemoved, GVSMInvalidationCounts[(int32)EVirtualShadowMapInvalidationReason::PrimitiveRemoved]);
+	SET_DWORD_STAT(STAT_VSMInvalidationPrimitiveUpdated, GVSMInvalidationCounts[(int32)EVirtualShadowMapInvalidationReason::PrimitiveUpdated]);
+	SET_DWORD_STAT(STAT_VSMInvalidationDeformableMesh, GVSMInvalidationCounts[(int32)EVirtualShadowMapInvalidationReason::DeformableMesh]);
+	SET_DWORD_STAT(STAT_VSMInvalidationDynamicPrimitive, GVSMInvalidationCounts[(int32)EVirtualShadowMapInvalidationReason::DynamicPrimitive]);
+	SET_DWORD_STAT(STAT_VSMInvalidationStaticToDynamic, GVSMInvalidationCounts[(int32)EVirtualShadowMapInvalidationReason::StaticToDynamic]);
+	SET_DWORD_STAT(STAT_VSMInvalidationStaticPages, GVSMStaticPageInvalidationCount);
+
+#if !UE_BUILD_SHIPPING
+	FMemory::Memcpy(LastInvalidationCounts, GVSMInvalidationCounts, sizeof(LastInvalidationCounts));
+	LastStaticPageInvalidationCount = GVSMStaticPageInvalidationCount;
+#endif
+
+	FMemory::Memzero(GVSMInvalidationCounts, sizeof(GVSMInvalidationCounts));
+	GVSMStaticPageInvalidationCount = 0;
 }
 
 void FVirtualShadowMapArrayCacheManager::ExtractStats(FRDGBuilder& GraphBuilder, FVirtualShadowMapArray &VirtualShadowMapArray)
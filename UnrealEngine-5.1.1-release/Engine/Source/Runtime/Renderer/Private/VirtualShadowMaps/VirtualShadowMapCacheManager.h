@@ -18,6 +18,26 @@ class FVirtualShadowMapPerLightCacheEntry;
 
 #define VSM_LOG_INVALIDATIONS 0
 
+/** Why cached pages had to be rendered again, reported by the virtual shadow map invalidation stats. */
+enum class EVirtualShadowMapInvalidationReason : uint8
+{
+	// Whole shadow maps
+	NotCached,
+	LightMoved,
+	ClipmapMoved,
+	DistantLightUpdate,
+	Forced,
+
+	// Instances, only the pages overlapping their bounds are invalidated
+	PrimitiveRemoved,
+	PrimitiveUpdated,
+	DeformableMesh,
+	DynamicPrimitive,
+	StaticToDynamic,
+
+	Num
+};
+
 class FVirtualShadowMapCacheEntry
 {
 public:
@@ -94,6 +114,9 @@ public:
 	bool bCurrentIsDistantLight = false;
 	int32 CurrentRenderedFrameNumber = -1;
 	int32 CurrenScheduledFrameNumber = -1;
+
+	// Why the shadow maps of the light were last invalidated as a whole, reported when they are rendered again
+	EVirtualShadowMapInvalidationReason InvalidationReason = EVirtualShadowMapInvalidationReason::NotCached;
 	// Primitives that have been rendered (not culled) the previous frame, when a primitive transitions from being culled to not it must be rendered into the VSM
 	// Key culling reasons are small size or distance cutoff.
 	TBitArray<> RenderedPrimitives;
@@ -217,19 +240,19 @@ public:
 		// Primitive was removed from the scene
 		void Removed(FPrimitiveSceneInfo* PrimitiveSceneInfo)
 		{
-			AddInvalidation(PrimitiveSceneInfo, true);
+			AddInvalidation(PrimitiveSceneInfo, true, EVirtualShadowMapInvalidationReason::PrimitiveRemoved);
 		}
 
 		// Primitive instances updated
 		void UpdatedInstances(FPrimitiveSceneInfo* PrimitiveSceneInfo)
 		{
-			AddInvalidation(PrimitiveSceneInfo, false);
+			AddInvalidation(PrimitiveSceneInfo, false, EVirtualShadowMapInvalidationReason::PrimitiveUpdated);
 		}
 
 		// Primitive moved/transform was updated
 		void UpdatedTransform(FPrimitiveSceneInfo* PrimitiveSceneInfo)
 		{
-			AddInvalidation(PrimitiveSceneInfo, false);
+			AddInvalidation(PrimitiveSceneInfo, false, EVirtualShadowMapInvalidationReason::PrimitiveUpdated);
 		}
 
 		bool IsEmpty() const { return LoadBalancer.IsEmpty(); }
@@ -246,7 +269,7 @@ public:
 #endif
 
 	private:
-		void AddInvalidation(FPrimitiveSceneInfo* PrimitiveSceneInfo, bool bRemovedPrimitive);
+		void AddInvalidation(FPrimitiveSceneInfo* PrimitiveSceneInfo, bool bRemovedPrimitive, EVirtualShadowMapInvalidationReason InvalidationReason);
 
 		FScene& Scene;
 		FGPUScene& GPUScene;
@@ -273,6 +296,12 @@ public:
 	 */
 	void OnLightRemoved(int32 LightId);
 
+	/**
+	 * Records why cached pages have to be rendered again, published as stats once per frame.
+	 * Count is in shadow maps for whole shadow map invalidations and in instances for the others.
+	 */
+	static void RecordInvalidation(EVirtualShadowMapInvalidationReason Reason, uint32 Count = 1, bool bStaticPages = false);
+
 	TRDGUniformBufferRef<FVirtualShadowMapUniformParameters> GetPreviousUniformBuffer(FRDGBuilder& GraphBuilder) const;
 
 	FVirtualShadowMapArrayFrameData PrevBuffers;
@@ -295,6 +324,8 @@ private:
 
 	void ExtractStats(FRDGBuilder& GraphBuilder, FVirtualShadowMapArray &VirtualShadowMapArray);
 
+	void PublishInvalidationStats();
+
 	template<typename Allocator>
 	void UpdateRecentlyRemoved(const TBitArray<Allocator>& Removed)
 	{
@@ -336,6 +367,10 @@ private:
 	FDelegateHandle ScreenMessageDelegate;
 	int32 LastOverflowFrame = -1;
 	bool bLoggedPageOverflow = false;
+
+	// Invalidations published by the last frame, shown on screen by r.Shadow.Virtual.Cache.ShowInvalidationReasons
+	uint32 LastInvalidationCounts[(int32)EVirtualShadowMapInvalidationReason::Num] = {};
+	uint32 LastStaticPageInvalidationCount = 0;
 #endif
 #if WITH_MGPU
 	FRHIGPUMask LastGPUMask;
@@ -229,6 +229,10 @@ public:
 	void SetLODScreenSizes(const TArray<float>& ScreenSizes) { LODScreenSizes = ScreenSizes; }
 	const TArray<float>& GetLODScreenSizes() const { return LODScreenSizes;  }
 
+	// Fraction of the control points kept by each LOD, used for estimating the cost of a LOD against the hair strands budget
+	void SetLODVertexRatios(const TArray<float>& InRatios) { LODVertexRatios = InRatios; }
+	const TArray<float>& GetLODVertexRatios() const { return LODVertexRatios; }
+
 	void SetLODBias(float InLODBias) { LODBias = InLODBias; }
 	float GetLODBias() const { return LODBias; }
 
@@ -347,6 +351,7 @@ public:
 	   bounding box, which might not be as accurate as the GPU ones*/
 	TArray<bool> LODVisibilities;
 	TArray<float>LODScreenSizes;
+	TArray<float>LODVertexRatios;
 	TArray<bool> LODSimulations;
 	TArray<bool> LODGlobalInterpolations;
 	bool bIsDeformationEnable;
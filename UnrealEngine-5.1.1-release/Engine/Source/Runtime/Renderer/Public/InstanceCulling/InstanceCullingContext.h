@@ -262,10 +262,14 @@ public:
 	TArray<FMeshDrawCommandInfo, SceneRenderingAllocator> MeshDrawCommandInfos;
 	TArray<FRHIDrawIndexedIndirectParameters, SceneRenderingAllocator> IndirectArgs;
 	TArray<uint32, SceneRenderingAllocator> DrawCommandDescs;
+	/** Min and max instance screen size as two halves, per draw command, used by draws with GPU LOD selection. */
+	TArray<uint32, SceneRenderingAllocator> DrawCommandLODScreenSizes;
 	TArray<FPayloadData, SceneRenderingAllocator> PayloadData;
 	TArray<uint32, SceneRenderingAllocator> InstanceIdOffsets;
 
 	TArray<FCompactionData, SceneRenderingAllocator> DrawCommandCompactionData;
+	/** Culling view each compaction draw sorts its visible instances against, ~0u to keep the instance order. */
+	TArray<uint32, SceneRenderingAllocator> DrawCommandCompactionSortViewIds;
 	TArray<uint32, SceneRenderingAllocator> CompactionBlockDataIndices;
 	uint32 NumCompactionInstances = 0U;
 
@@ -1316,8 +1316,11 @@ enum class EFVisibleMeshDrawCommandFlags : uint8
 	/** If set, requires that instances preserve their original draw order in the draw command */
 	PreserveInstanceOrder = 1U << 3U,
 
-	All = MaterialUsesWorldPositionOffset | HasPrimitiveIdStreamIndex | ForceInstanceCulling | PreserveInstanceOrder,
-	NumBits = 4U
+	/** If set, instances outside of the LOD screen size range of the draw command are culled on the GPU */
+	GPULODSelection = 1U << 4U,
+
+	All = MaterialUsesWorldPositionOffset | HasPrimitiveIdStreamIndex | ForceInstanceCulling | PreserveInstanceOrder | GPULODSelection,
+	NumBits = 5U
 };
 ENUM_CLASS_FLAGS(EFVisibleMeshDrawCommandFlags);
 static_assert(uint32(EFVisibleMeshDrawCommandFlags::All) < (1U << uint32(EFVisibleMeshDrawCommandFlags::NumBits)), "EFVisibleMeshDrawCommandFlags::NumBits too small to represent all flags in EFVisibleMeshDrawCommandFlags.");
@@ -1411,7 +1414,8 @@ public:
 		EFVisibleMeshDrawCommandFlags InFlags,
 		FMeshDrawCommandSortKey InSortKey,
 		const uint32* InRunArray = nullptr,
-		int32 InNumRuns = 0)
+		int32 InNumRuns = 0,
+		uint32 InLODScreenSizeRange = 0)
 	{
 		MeshDrawCommand = InMeshDrawCommand;
 		PrimitiveIdInfo = InPrimitiveIdInfo;
@@ -1423,6 +1427,7 @@ public:
 		Flags = InFlags;
 		RunArray = InRunArray;
 		NumRuns = InNumRuns;
+		LODScreenSizeRange = InLODScreenSizeRange;
 	}
 
 	// Mesh Draw Command stored separately to avoid fetching its data during sorting
@@ -1445,6 +1450,9 @@ public:
 	const uint32* RunArray;
 	int32 NumRuns;
 
+	// Min and max instance screen size as two halves, used by the culling when Flags has GPULODSelection
+	uint32 LODScreenSizeRange;
+
 	// Needed for view overrides
 	ERasterizerFillMode MeshFillMode : ERasterizerFillMode_NumBits + 1;
 	ERasterizerCullMode MeshCullMode : ERasterizerCullMode_NumBits + 1;
@@ -1526,9 +1534,13 @@ public:
 		//@todo MeshCommandPipeline - assign usable state ID for dynamic path draws
 		// Currently dynamic path draws will not get dynamic instancing, but they will be roughly sorted by state
 		const FMeshBatchElement& MeshBatchElement = MeshBatch.Elements[BatchElementIndex];
+		const uint32 LODScreenSizeRange = MeshBatchElement.bGPULODSelection
+			? (uint32(FFloat16(MeshBatchElement.MinScreenSize).Encoded) | (uint32(FFloat16(MeshBatchElement.MaxScreenSize).Encoded) << 16U))
+			: 0U;
 		NewVisibleMeshDrawCommand.Setup(&MeshDrawCommand, IdInfo, -1, MeshFillMode, MeshCullMode, Flags, SortKey,
 			MeshBatchElement.bIsInstanceRuns ? MeshBatchElement.InstanceRuns : nullptr,
-			MeshBatchElement.bIsInstanceRuns ? MeshBatchElement.NumInstances : 0
+			MeshBatchElement.bIsInstanceRuns ? MeshBatchElement.NumInstances : 0,
+			LODScreenSizeRange
 			);
 		DrawList.Add(NewVisibleMeshDrawCommand);
 	}
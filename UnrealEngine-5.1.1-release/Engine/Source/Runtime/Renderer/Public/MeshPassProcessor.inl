@@ -149,6 +149,10 @@ void FMeshPassProcessor::BuildMeshDrawCommands(
 			{
 				Flags |= EFVisibleMeshDrawCommandFlags::ForceInstanceCulling;
 			}
+			if (BatchElement.bGPULODSelection)
+			{
+				Flags |= EFVisibleMeshDrawCommandFlags::GPULODSelection | EFVisibleMeshDrawCommandFlags::ForceInstanceCulling;
+			}
 			if (BatchElement.bPreserveInstanceOrder)
 			{
 				// TODO: add support for bPreserveInstanceOrder on mobile
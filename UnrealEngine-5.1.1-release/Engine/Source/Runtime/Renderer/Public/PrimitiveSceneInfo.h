@@ -173,6 +173,9 @@ struct FPrimitiveFlagsCompact
 	/** True if the primitive draws only meshes that support GPU-Scene. */
 	uint8 bSupportsGPUScene : 1;
 
+	/** True if the primitive is a static, non-Nanite GPU-Scene primitive whose instances can be frustum culled by GPU instance culling. */
+	uint8 bSupportsGPUDrivenVisibility : 1;
+
 	FPrimitiveFlagsCompact(const FPrimitiveSceneProxy* Proxy);
 };
 
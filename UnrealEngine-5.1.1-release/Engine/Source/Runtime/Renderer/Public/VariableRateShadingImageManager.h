@@ -25,10 +25,13 @@ enum class EVRSType : uint32
 	/** VRS Image to be applied during post-processing. */
 	EyeTrackedFoveation = 0x2,
 
+	/** VRS Image built every frame from last frame's motion and luminance contrast. */
+	ContrastAdaptive = 0x4,
+
 	// @todo: Add more types here as they're implemented.
 
 	/** Mask of all available VRS source types. */
-	All = FixedFoveation | EyeTrackedFoveation,
+	All = FixedFoveation | EyeTrackedFoveation | ContrastAdaptive,
 
 	/** Mask of XR fixed-foveation VRS gen only. */
 	XRFoveation = FixedFoveation | EyeTrackedFoveation,
@@ -68,7 +71,11 @@ public:
 	TRefCountPtr<IPooledRenderTarget> GetMobileVariableRateShadingImage(const FSceneViewFamily& ViewFamily);
 
 protected:
-	TRefCountPtr<IPooledRenderTarget> RenderShadingRateImage(FRDGBuilder& GraphBuilder, uint64 Key, const FVRSImageGenerationParameters& VRSImageGenParamsIn, EVRSGenerationFlags GenFlags);
+	TRefCountPtr<IPooledRenderTarget> RenderShadingRateImage(FRDGBuilder& GraphBuilder, uint64 Key, const FVRSImageGenerationParameters& VRSImageGenParamsIn, EVRSGenerationFlags GenFlags, FRDGTextureRef CombineSource = nullptr);
+
+	/** Builds the contrast adaptive shading rate image of the family from last frame's TSR or TAA history, once per frame. Returns nullptr if no view has a history yet. */
+	FRDGTextureRef GetContrastAdaptiveShadingImage(FRDGBuilder& GraphBuilder, const FSceneViewFamily& ViewFamily, FIntPoint Size, int32 Quality);
+
 	uint64 CalculateVRSImageHash(const FVRSImageGenerationParameters& VRSImageGenParamsIn, EVRSGenerationFlags ViewFlags) const;
 	void UpdateFixedFoveationParameters(FVRSImageGenerationParameters& VRSImageGenParamsInOut);
 	void UpdateEyeTrackedFoveationParameters(FVRSImageGenerationParameters& VRSImageGenParamsInOut, const FSceneViewFamily& ViewFamily);
@@ -99,6 +106,11 @@ private:
 
 	uint64 LastFrameTick;
 	FDynamicVRSData DynamicVRSData;
+
+	/** Contrast adaptive image of the current frame, shared by the passes of the family */
+	TRefCountPtr<IPooledRenderTarget> ContrastAdaptiveImage;
+	const FSceneViewFamily* ContrastAdaptiveImageFamily = nullptr;
+	uint32 ContrastAdaptiveImageFrame = 0;
 };
 
 RENDERER_API extern TGlobalResource<FVariableRateShadingImageManager> GVRSImageManager;
@@ -2,6 +2,9 @@
 
 #include "Fonts/FontCache.h"
 #include "Misc/ScopeLock.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Internationalization/Culture.h"
+#include "Styling/CoreStyle.h"
 #include "HAL/IConsoleManager.h"
 #include "Application/SlateApplicationBase.h"
 #include "Fonts/FontCacheFreeType.h"
@@ -48,6 +51,12 @@ FAutoConsoleVariableRef CVarUnloadFreeTypeDataOnFlush(
 	UnloadFreeTypeDataOnFlush,
 	TEXT("Releases the free type data when the font cache is flushed"));
 
+static int32 PrewarmGlyphsPerFrame = 32;
+FAutoConsoleVariableRef CVarPrewarmGlyphsPerFrame(
+	TEXT("Slate.Font.PrewarmGlyphsPerFrame"),
+	PrewarmGlyphsPerFrame,
+	TEXT("The maximum number of queued glyphs added to the font atlas per frame ahead of being drawn, such as the glyphs listed for the current culture in [SlateFontCache.PrewarmGlyphs]. 0 disables prewarming."));
+
 static TAutoConsoleVariable<int32> CVarDefaultTextShapingMethod(
 	TEXT("Slate.DefaultTextShapingMethod"),
 	static_cast<int32>(ETextShapingMethod::Auto),
@@ -809,6 +818,7 @@ FSlateFontCache::FSlateFontCache( TSharedRef<ISlateFontAtlasFactory> InFontAtlas
 	, TextShaper( new FSlateTextShaper( FTCacheDirectory.Get(), CompositeFontCache.Get(), FontRenderer.Get(), this ) )
 	, FontAtlasFactory( InFontAtlasFactory )
 	, bFlushRequested( false )
+	, bCulturePrewarmRequested( InOwningThread == ESlateTextureAtlasThreadId::Game )
 	, OwningThread(InOwningThread)
 	, EllipsisText(NSLOCTEXT("FontCache", "TextOverflowIndicator", "\u2026"))
 {
@@ -1189,6 +1199,18 @@ void FSlateFontCache::UpdateCache()
 		}
 	};
 
+	// Prewarm first so the new glyphs are uploaded with the rest of this frame's atlas update
+	if (!bFlushRequested)
+	{
+		if (bCulturePrewarmRequested)
+		{
+			bCulturePrewarmRequested = false;
+			QueueCulturePrewarmGlyphs();
+		}
+
+		ProcessPrewarmGlyphs();
+	}
+
 	UpdateFontAtlasTextures(GrayscaleFontAtlasIndices);
 	UpdateFontAtlasTextures(ColorFontAtlasIndices);
 
@@ -1251,6 +1273,13 @@ void FSlateFontCache::FlushData()
 	FontToCharacterListCache.Empty();
 
 	ShapedGlyphToAtlasData.Empty();
+
+	// The glyphs already prewarmed were flushed along with the atlas, and the shaped glyphs may reference unloaded font faces
+	for (FPrewarmGlyphsRequest& Request : PendingPrewarmGlyphs)
+	{
+		Request.ShapedGlyphs.Reset();
+		Request.NextGlyphIndex = 0;
+	}
 }
 
 SIZE_T FSlateFontCache::GetFontDataAssetResidentMemory(const UObject* FontDataAsset) const
@@ -1277,6 +1306,11 @@ void FSlateFontCache::FlushFontObjects()
 				}
 			}
 
+			PendingPrewarmGlyphs.RemoveAll([this](const FPrewarmGlyphsRequest& Request)
+			{
+				return FontObjectsToFlush.Contains(Request.FontInfo.FontObject);
+			});
+
 			FontObjectsToFlush.Empty();
 		}
 	}
@@ -1292,5 +1326,100 @@ void FSlateFontCache::HandleCultureChanged()
 	// The culture has changed, so request the font cache be flushed once it is safe to do so
 	// We don't flush immediately as the request may come in from a different thread than the one that owns the font cache
 	RequestFlushCache(TEXT("Culture for localization was changed"));
+
+	if (OwningThread == ESlateTextureAtlasThreadId::Game)
+	{
+		bCulturePrewarmRequested = true;
+	}
+}
+
+void FSlateFontCache::PrewarmGlyphs(const FString& InText, const FSlateFontInfo& InFontInfo, const float InFontScale, const FFontOutlineSettings& InOutlineSettings)
+{
+	if (PrewarmGlyphsPerFrame <= 0 || InText.IsEmpty() || !InFontInfo.HasValidFont())
+	{
+		return;
+	}
+
+	FPrewarmGlyphsRequest& Request = PendingPrewarmGlyphs.AddDefaulted_GetRef();
+	Request.Text = InText;
+	Request.FontInfo = InFontInfo;
+	Request.FontScale = InFontScale;
+	Request.OutlineSettings = InOutlineSettings;
+}
+
+void FSlateFontCache::QueueCulturePrewarmGlyphs()
+{
+	if (!GConfig || PrewarmGlyphsPerFrame <= 0)
+	{
+		return;
+	}
+
+	static const TCHAR* PrewarmSection = TEXT("SlateFontCache.PrewarmGlyphs");
+
+	TArray<FString> FontSizes;
+	GConfig->GetArray(PrewarmSection, TEXT("FontSizes"), FontSizes, GEngineIni);
+	if (FontSizes.Num() == 0)
+	{
+		return;
+	}
+
+	// Use the glyphs listed for the most specific culture, eg) "zh-Hans" before "zh"
+	const TArray<FString> CultureNames = FInternationalization::Get().GetCurrentLanguage()->GetPrioritizedParentCultureNames();
+	for (const FString& CultureName : CultureNames)
+	{
+		TArray<FString> CultureGlyphs;
+		GConfig->GetArray(PrewarmSection, *CultureName, CultureGlyphs, GEngineIni);
+		if (CultureGlyphs.Num() > 0)
+		{
+			for (const FString& FontSize : FontSizes)
+			{
+				const FSlateFontInfo FontInfo = FCoreStyle::GetDefaultFontStyle(TEXT("Regular"), FCString::Atoi(*FontSize));
+				for (const FString& Glyphs : CultureGlyphs)
+				{
+					PrewarmGlyphs(Glyphs, FontInfo);
+				}
+			}
+			break;
+		}
+	}
+}
+
+void FSlateFontCache::ProcessPrewarmGlyphs()
+{
+	if (PendingPrewarmGlyphs.Num() == 0)
+	{
+		return;
+	}
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_SlateFontCachePrewarmGlyphs);
+
+	int32 GlyphBudget = PrewarmGlyphsPerFrame;
+	int32 NumCompletedRequests = 0;
+	while (GlyphBudget > 0 && NumCompletedRequests < PendingPrewarmGlyphs.Num())
+	{
+		FPrewarmGlyphsRequest& Request = PendingPrewarmGlyphs[NumCompletedRequests];
+		if (!Request.ShapedGlyphs.IsValid())
+		{
+			Request.ShapedGlyphs = ShapeBidirectionalText(Request.Text, Request.FontInfo, Request.FontScale, TextBiDi::ComputeBaseDirection(Request.Text), GetDefaultTextShapingMethod());
+		}
+
+		const TArray<FShapedGlyphEntry>& GlyphsToRender = Request.ShapedGlyphs->GetGlyphsToRender();
+		for (; Request.NextGlyphIndex < GlyphsToRender.Num() && GlyphBudget > 0; ++Request.NextGlyphIndex)
+		{
+			const FShapedGlyphEntry& GlyphToRender = GlyphsToRender[Request.NextGlyphIndex];
+			if (GlyphToRender.bIsVisible)
+			{
+				GetShapedGlyphFontAtlasData(GlyphToRender, Request.OutlineSettings);
+				--GlyphBudget;
+			}
+		}
+
+		if (Request.NextGlyphIndex >= GlyphsToRender.Num())
+		{
+			++NumCompletedRequests;
+		}
+	}
+
+	PendingPrewarmGlyphs.RemoveAt(0, NumCompletedRequests, false);
 }
 
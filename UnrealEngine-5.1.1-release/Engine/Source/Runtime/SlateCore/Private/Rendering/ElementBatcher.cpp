@@ -179,6 +179,78 @@ void FSlateBatchData::MergeRenderBatches()
 		}
 
 
+		// Group the batches that can be merged together, so each batch is only tested against the distinct batch keys of its layer
+		// rather than against every following batch of the layer. A mergeable batch absorbs all the following batches of the layer
+		// batchable with it, so the merged batch list stays the same and in the same order as testing them one by one.
+		TArray<int32, TInlineAllocator<100, FConcurrentLinearArrayAllocator>> MergeHeads;
+		TArray<int32, TInlineAllocator<100, FConcurrentLinearArrayAllocator>> NextMergedBatches;
+		TArray<int32, TInlineAllocator<100, FConcurrentLinearArrayAllocator>> LastMergedBatches;
+		{
+			SCOPED_NAMED_EVENT_TEXT("Slate::GroupRenderBatches", FColor::Magenta);
+
+			MergeHeads.Init(INDEX_NONE, BatchIndices.Num());
+			NextMergedBatches.Init(INDEX_NONE, BatchIndices.Num());
+			LastMergedBatches.Init(INDEX_NONE, BatchIndices.Num());
+
+			auto GetBatchKeyHash = [](const FSlateRenderBatch& Batch)
+			{
+				uint32 Hash = HashCombine(PointerHash(Batch.ShaderResource), PointerHash(Batch.ClippingState));
+				Hash = HashCombine(Hash, PointerHash(Batch.CustomDrawer));
+				Hash = HashCombine(Hash, PointerHash(Batch.InstanceData));
+				Hash = HashCombine(Hash, static_cast<uint32>(Batch.ShaderType) | (static_cast<uint32>(Batch.DrawPrimitiveType) << 8) | (static_cast<uint32>(Batch.SceneIndex) << 16));
+				return HashCombine(Hash, static_cast<uint32>(Batch.DrawFlags) ^ (static_cast<uint32>(Batch.DrawEffects) << 16));
+			};
+
+			TMultiMap<uint32, int32> LayerMergeHeads;
+			int32 CurrentLayer = INDEX_NONE;
+			for (int32 BatchIndex = 0; BatchIndex < BatchIndices.Num(); ++BatchIndex)
+			{
+				const FSlateRenderBatch& CurBatch = RenderBatches[BatchIndices[BatchIndex].Key];
+				if (CurBatch.GetLayer() != CurrentLayer)
+				{
+					// none of the batches will be compatible across layers
+					LayerMergeHeads.Reset();
+					CurrentLayer = CurBatch.GetLayer();
+				}
+
+				if (CurBatch.bIsMerged)
+				{
+					continue;
+				}
+
+				const uint32 KeyHash = GetBatchKeyHash(CurBatch);
+				int32 HeadIndex = INDEX_NONE;
+				for (auto It = LayerMergeHeads.CreateConstKeyIterator(KeyHash); It; ++It)
+				{
+					if (RenderBatches[BatchIndices[It.Value()].Key].IsBatchableWith(CurBatch))
+					{
+						HeadIndex = It.Value();
+						break;
+					}
+				}
+
+				if (HeadIndex != INDEX_NONE)
+				{
+					MergeHeads[BatchIndex] = HeadIndex;
+					if (LastMergedBatches[HeadIndex] == INDEX_NONE)
+					{
+						NextMergedBatches[HeadIndex] = BatchIndex;
+					}
+					else
+					{
+						NextMergedBatches[LastMergedBatches[HeadIndex]] = BatchIndex;
+					}
+					LastMergedBatches[HeadIndex] = BatchIndex;
+				}
+#if 1  // Do batching at all?
+				else if (CurBatch.bIsMergable && CurBatch.IsValidForRendering())
+				{
+					LayerMergeHeads.Add(KeyHash, BatchIndex);
+				}
+#endif
+			}
+		}
+
 		NumBatches = 0;
 		NumLayers = 0;
 
@@ -197,7 +269,7 @@ void FSlateBatchData::MergeRenderBatches()
 			FSlateRenderBatch& CurBatch = RenderBatches[BatchIndexPair.Key];
 
 
-			if (CurBatch.bIsMerged || !CurBatch.IsValidForRendering())
+			if (CurBatch.bIsMerged || MergeHeads[BatchIndex] != INDEX_NONE || !CurBatch.IsValidForRendering())
 			{
 				// skip already merged batches or batches with invalid data (e.g text with pure whitespace)
 				continue;
@@ -226,29 +298,14 @@ void FSlateBatchData::MergeRenderBatches()
 				bIsStencilBufferRequired |= CurBatch.ClippingState->GetClippingMethod() == EClippingMethod::Stencil;
 			}
 
-#if 1  // Do batching at all?
-
-			if (CurBatch.bIsMergable)
+			for (int32 MergedIndex = NextMergedBatches[BatchIndex]; MergedIndex != INDEX_NONE; MergedIndex = NextMergedBatches[MergedIndex])
 			{
-				for (int32 TestIndex = BatchIndex + 1; TestIndex < BatchIndices.Num(); ++TestIndex)
-				{
-					const TPair<int32, int32>& NextBatchIndexPair = BatchIndices[TestIndex];
-					FSlateRenderBatch& TestBatch = RenderBatches[NextBatchIndexPair.Key];
-					if (TestBatch.GetLayer() != CurBatch.GetLayer())
-					{
-						// none of the batches will be compatible since we encountered an incompatible layer
-						break;
-					}
-					else if (!TestBatch.bIsMerged && CurBatch.IsBatchableWith(TestBatch))
-					{
-						CombineBatches(CurBatch, TestBatch, FinalVertexData, FinalIndexData);
+				FSlateRenderBatch& TestBatch = RenderBatches[BatchIndices[MergedIndex].Key];
+				CombineBatches(CurBatch, TestBatch, FinalVertexData, FinalIndexData);
 
-						check(TestBatch.NextBatchIndex == INDEX_NONE);
-
-					}
-				}
+				check(TestBatch.NextBatchIndex == INDEX_NONE);
 			}
-#endif
+
 			PrevBatch = &CurBatch;
 		}
 	}
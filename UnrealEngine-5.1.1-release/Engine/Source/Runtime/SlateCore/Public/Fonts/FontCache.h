@@ -668,6 +668,17 @@ public:
 	 */
 	FShapedGlyphFontAtlasData GetShapedGlyphFontAtlasData( const FShapedGlyphEntry& InShapedGlyph, const FFontOutlineSettings& InOutlineSettings);
 
+	/**
+	 * Queues the glyphs of the given text to be added to the font atlas before they are first drawn, to avoid rasterizing them on the frame they appear.
+	 * The glyphs are added by UpdateCache over several frames, at most Slate.Font.PrewarmGlyphsPerFrame per frame. Must be called from the thread owning the font cache.
+	 *
+	 * @param InText				The text containing the glyphs to prewarm
+	 * @param InFontInfo			Information about the font that the text will be drawn with
+	 * @param InFontScale			The scale that the text will be drawn with
+	 * @param InOutlineSettings		The outline that the text will be drawn with
+	 */
+	void PrewarmGlyphs( const FString& InText, const FSlateFontInfo& InFontInfo, const float InFontScale = 1.0f, const FFontOutlineSettings& InOutlineSettings = FFontOutlineSettings::NoOutline);
+
 	/**
 	 * Gets the overflow glyph sequence for a given font. The overflow sequence is used to replace characters that are clipped
 	 */
@@ -849,6 +860,12 @@ private:
 	/** Called after the active culture has changed */
 	void HandleCultureChanged();
 
+	/** Queues the glyphs listed in the [SlateFontCache.PrewarmGlyphs] section of the engine config for the current culture, drawn with the default font */
+	void QueueCulturePrewarmGlyphs();
+
+	/** Adds the next queued prewarm glyphs to the font atlas, within the per frame budget */
+	void ProcessPrewarmGlyphs();
+
 	/**
 	 * Add a new entries into a cache atlas
 	 *
@@ -901,6 +918,24 @@ private:
 	/** Whether or not we have a pending request to flush the cache when it is safe to do so */
 	volatile bool bFlushRequested;
 
+	/** Whether or not the glyphs of the current culture should be queued for prewarming once the cache is no longer pending a flush */
+	volatile bool bCulturePrewarmRequested;
+
+	struct FPrewarmGlyphsRequest
+	{
+		FString Text;
+		FSlateFontInfo FontInfo;
+		float FontScale = 1.0f;
+		FFontOutlineSettings OutlineSettings;
+
+		/** Shaped when first processed, and reset when the cache is flushed */
+		FShapedGlyphSequencePtr ShapedGlyphs;
+		int32 NextGlyphIndex = 0;
+	};
+
+	/** Text whose glyphs are still to be added to the font atlas, in request order */
+	TArray<FPrewarmGlyphsRequest> PendingPrewarmGlyphs;
+
 	/** Critical section preventing concurrent access to FontObjectsToFlush */
 	mutable FCriticalSection FontObjectsToFlushCS;
 
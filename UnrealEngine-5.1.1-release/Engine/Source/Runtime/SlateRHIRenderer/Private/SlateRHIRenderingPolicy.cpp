@@ -37,6 +37,7 @@ DECLARE_CYCLE_STAT(TEXT("Update Buffers RT"), STAT_SlateUpdateBufferRTTimeLambda
 DECLARE_DWORD_COUNTER_STAT(TEXT("Num Layers"), STAT_SlateNumLayers, STATGROUP_Slate);
 DECLARE_DWORD_COUNTER_STAT(TEXT("Num Batches"), STAT_SlateNumBatches, STATGROUP_Slate);
 DECLARE_DWORD_COUNTER_STAT(TEXT("Num Vertices"), STAT_SlateVertexCount, STATGROUP_Slate);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Skipped Buffer Uploads"), STAT_SlateSkippedBufferUploads, STATGROUP_Slate);
 
 DECLARE_DWORD_COUNTER_STAT(TEXT("Clips (Scissor)"), STAT_SlateScissorClips, STATGROUP_Slate);
 DECLARE_DWORD_COUNTER_STAT(TEXT("Clips (Stencil)"), STAT_SlateStencilClips, STATGROUP_Slate);
@@ -59,6 +60,13 @@ static FAutoConsoleVariableRef CVarSlateDrawBatchNum(TEXT("Slate.DrawBatchNum"),
 	#define SLATE_DRAW_EVENT(RHICmdList, EventName)
 #endif
 
+TAutoConsoleVariable<int32> CVarSlateSkipUnchangedBufferUploads(
+	TEXT("Slate.SkipUnchangedBufferUploads"),
+	1,
+	TEXT("0: Upload the batched vertices and indices on every draw, 1: Skip the upload when they are identical to the data already in the buffers, e.g. static HUDs drawn in a single window (default)"),
+	ECVF_Default
+);
+
 TAutoConsoleVariable<int32> CVarSlateAbsoluteIndices(
 	TEXT("Slate.AbsoluteIndices"),
 	0,
@@ -115,6 +123,9 @@ void FSlateRHIRenderingPolicy::ReleaseResources()
 	SourceVertexBuffer.Destroy();
 	SourceIndexBuffer.Destroy();
 
+	UploadedVertexBufferRHI.SafeRelease();
+	UploadedIndexBufferRHI.SafeRelease();
+
 	BeginReleaseResource(&StencilVertexBuffer);
 }
 
@@ -152,6 +163,34 @@ void FSlateRHIRenderingPolicy::BuildRenderingBuffers(FRHICommandListImmediate& R
 		SourceVertexBuffer.PreFillBuffer(NumVertices, bShouldShrinkResources);
 		SourceIndexBuffer.PreFillBuffer(NumIndices, bShouldShrinkResources);
 
+		if (CVarSlateSkipUnchangedBufferUploads.GetValueOnRenderThread() != 0)
+		{
+			// Hashing reads the data once, which is cheaper than writing it to the locked buffers
+			const FXxHash64 VertexDataHash = FXxHash64::HashBuffer(FinalVertexData.GetData(), NumVertices * sizeof(FSlateVertex));
+			const FXxHash64 IndexDataHash = FXxHash64::HashBuffer(FinalIndexData.GetData(), NumIndices * sizeof(SlateIndex));
+			const bool bIsUploaded = UploadedVertexBufferRHI == SourceVertexBuffer.VertexBufferRHI && UploadedIndexBufferRHI == SourceIndexBuffer.IndexBufferRHI
+				&& UploadedVertexDataHash == VertexDataHash && UploadedIndexDataHash == IndexDataHash;
+
+			if (bIsUploaded)
+			{
+				INC_DWORD_STAT(STAT_SlateSkippedBufferUploads);
+				SET_DWORD_STAT(STAT_SlateNumLayers, InBatchData.GetNumLayers());
+				SET_DWORD_STAT(STAT_SlateNumBatches, InBatchData.GetNumFinalBatches());
+				SET_DWORD_STAT(STAT_SlateVertexCount, NumVertices);
+				return;
+			}
+
+			UploadedVertexBufferRHI = SourceVertexBuffer.VertexBufferRHI;
+			UploadedIndexBufferRHI = SourceIndexBuffer.IndexBufferRHI;
+			UploadedVertexDataHash = VertexDataHash;
+			UploadedIndexDataHash = IndexDataHash;
+		}
+		else
+		{
+			UploadedVertexBufferRHI.SafeRelease();
+			UploadedIndexBufferRHI.SafeRelease();
+		}
+
 		RHICmdList.EnqueueLambda([
 			VertexBuffer = SourceVertexBuffer.VertexBufferRHI.GetReference(),
 			IndexBuffer = SourceIndexBuffer.IndexBufferRHI.GetReference(),
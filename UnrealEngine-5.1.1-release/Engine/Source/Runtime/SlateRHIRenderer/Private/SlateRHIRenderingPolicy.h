@@ -15,6 +15,7 @@
 #include "Shader.h"
 #include "GlobalShader.h"
 #include "Engine/TextureLODSettings.h"
+#include "Hash/xxhash.h"
 
 class FSlateFontServices;
 class FSlateRHIResourceManager;
@@ -95,6 +96,13 @@ private:
 	TSlateElementVertexBuffer<FSlateVertex> SourceVertexBuffer;
 	FSlateElementIndexBuffer SourceIndexBuffer;
 
+	/** Contents last uploaded to the source buffers, to skip uploading the batches of a window that did not change since the previous draw.
+	 *  The buffer references keep the uploaded buffers alive so a reallocated buffer can't be mistaken for them. */
+	FBufferRHIRef UploadedVertexBufferRHI;
+	FBufferRHIRef UploadedIndexBufferRHI;
+	FXxHash64 UploadedVertexDataHash;
+	FXxHash64 UploadedIndexDataHash;
+
 	FSlateStencilClipVertexBuffer StencilVertexBuffer;
 
 	/** Handles post process effects for slate */
@@ -37,6 +37,23 @@ bool FSocket::SendTo(const uint8* Data, int32 Count, int32& BytesSent, const FIn
 }
 
 
+bool FSocket::SendToMulti(TArrayView<const FSendToMultiPacket> Packets, int32& NumPacketsSent)
+{
+	for (NumPacketsSent = 0; NumPacketsSent < Packets.Num(); ++NumPacketsSent)
+	{
+		const FSendToMultiPacket& Packet = Packets[NumPacketsSent];
+		int32 BytesSent = 0;
+
+		if (!SendTo(Packet.Data, Packet.Count, BytesSent, *Packet.Destination))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
 bool FSocket::Send(const uint8* Data, int32 Count, int32& BytesSent)
 {
 //	NETWORK_PROFILER(GNetworkProfiler.TrackSocketSend(this,Data,BytesSent));
@@ -120,6 +120,75 @@ void FUnixRecvMulti::CountBytes(FArchive& Ar) const
  */
 
 // NOTE: Does not support TCP at the moment.
+bool FSocketUnix::SendToMulti(TArrayView<const FSendToMultiPacket> Packets, int32& NumPacketsSent)
+{
+#if PLATFORM_HAS_BSD_SOCKET_FEATURE_RECVMMSG
+	// sendmmsg is available wherever recvmmsg is
+	constexpr int32 MaxPacketsPerCall = 64;
+	mmsghdr Headers[MaxPacketsPerCall];
+	iovec BufferMaps[MaxPacketsPerCall];
+
+	NumPacketsSent = 0;
+
+	while (NumPacketsSent < Packets.Num())
+	{
+		const int32 MaxBatchSize = FMath::Min(Packets.Num() - NumPacketsSent, MaxPacketsPerCall);
+		int32 BatchSize = 0;
+
+		for (; BatchSize < MaxBatchSize; ++BatchSize)
+		{
+			const FSendToMultiPacket& Packet = Packets[NumPacketsSent + BatchSize];
+
+			// Leave mismatched destinations to SendTo, which reports them
+			if (Packet.Destination->GetProtocolType() != GetProtocol())
+			{
+				break;
+			}
+
+			FInternetAddrBSD& BSDAddr = const_cast<FInternetAddrBSD&>(static_cast<const FInternetAddrBSD&>(*Packet.Destination));
+
+			BufferMaps[BatchSize].iov_base = const_cast<uint8*>(Packet.Data);
+			BufferMaps[BatchSize].iov_len = Packet.Count;
+
+			FMemory::Memzero(Headers[BatchSize]);
+			Headers[BatchSize].msg_hdr.msg_name = BSDAddr.GetRawAddr();
+			Headers[BatchSize].msg_hdr.msg_namelen = BSDAddr.GetStorageSize();
+			Headers[BatchSize].msg_hdr.msg_iov = &BufferMaps[BatchSize];
+			Headers[BatchSize].msg_hdr.msg_iovlen = 1;
+		}
+
+		if (BatchSize == 0)
+		{
+			const FSendToMultiPacket& Packet = Packets[NumPacketsSent];
+			int32 BytesSent = 0;
+
+			if (!SendTo(Packet.Data, Packet.Count, BytesSent, *Packet.Destination))
+			{
+				return false;
+			}
+
+			++NumPacketsSent;
+			continue;
+		}
+
+		// Returns the number of packets sent, a packet that failed after the first is reported by the next call
+		const int NumSent = sendmmsg(Socket, Headers, BatchSize, 0);
+
+		if (NumSent <= 0)
+		{
+			return false;
+		}
+
+		LastActivityTime = FPlatformTime::Seconds();
+		NumPacketsSent += NumSent;
+	}
+
+	return true;
+#else
+	return FSocketBSD::SendToMulti(Packets, NumPacketsSent);
+#endif
+}
+
 bool FSocketUnix::RecvMulti(FRecvMulti& MultiData, ESocketReceiveFlags::Type Flags)
 {
 	bool bSuccess = false;
@@ -40,7 +40,7 @@ public:
 
 
 /**
- * Unix specific socket implementation - primarily, adds support for recvmmsg
+ * Unix specific socket implementation - primarily, adds support for recvmmsg and sendmmsg
  */
 class FSocketUnix : public FSocketBSD
 {
@@ -54,6 +54,7 @@ public:
 	{
 	}
 
+	virtual bool SendToMulti(TArrayView<const FSendToMultiPacket> Packets, int32& NumPacketsSent) override;
 	virtual bool RecvMulti(FRecvMulti& MultiData, ESocketReceiveFlags::Type Flags) override;
 	virtual bool SetRetrieveTimestamp(bool bRetrieveTimestamp) override;
 };
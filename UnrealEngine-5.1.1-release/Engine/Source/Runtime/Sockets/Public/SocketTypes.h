@@ -264,3 +264,18 @@ public:
 	 */
 	virtual void CountBytes(FArchive& Ar) const;
 };
+
+/**
+ * A packet to be sent with FSocket::SendToMulti
+ */
+struct FSendToMultiPacket
+{
+	/** The buffer to send */
+	const uint8* Data = nullptr;
+
+	/** The size of the data to send */
+	int32 Count = 0;
+
+	/** The network byte ordered address to send to */
+	const FInternetAddr* Destination = nullptr;
+};
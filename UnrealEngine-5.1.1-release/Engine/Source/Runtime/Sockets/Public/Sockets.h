@@ -181,6 +181,16 @@ public:
 	 */
 	virtual bool SendTo(const uint8* Data, int32 Count, int32& BytesSent, const FInternetAddr& Destination);
 
+	/**
+	 * Sends multiple buffers, each to its own network byte ordered address, using as few system calls as the platform allows.
+	 * Packets are sent in order and sending stops at the first packet that fails, ISocketSubsystem::GetLastErrorCode returns its error.
+	 *
+	 * @param Packets The packets to send.
+	 * @param NumPacketsSent Will indicate how many packets, from the start of Packets, were sent.
+	 * @return true if all packets were sent, false if Packets[NumPacketsSent] failed.
+	 */
+	virtual bool SendToMulti(TArrayView<const FSendToMultiPacket> Packets, int32& NumPacketsSent);
+
 	/**
 	 * Sends a buffer on a connected socket.
 	 *
@@ -1,6 +1,8 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Blueprint/UserWidgetPool.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(UserWidgetPool)
 
@@ -37,6 +39,50 @@ void FUserWidgetPool::AddReferencedObjects(FReferenceCollector& Collector)
 	Collector.AddReferencedObjects<UUserWidget>(InactiveWidgets, OwningWidget.Get());
 }
 
+void FUserWidgetPool::PreconstructInstances(TSubclassOf<UUserWidget> WidgetClass, int32 NumInstances)
+{
+	if (!ensure(IsInitialized()) || !WidgetClass)
+	{
+		return;
+	}
+
+	int32 NumExistingInstances = 0;
+	for (const UUserWidget* InactiveWidget : InactiveWidgets)
+	{
+		if (InactiveWidget->GetClass() == WidgetClass)
+		{
+			++NumExistingInstances;
+		}
+	}
+
+	if (NumExistingInstances < NumInstances)
+	{
+		InactiveWidgets.Reserve(InactiveWidgets.Num() + NumInstances - NumExistingInstances);
+		for (int32 InstanceIdx = NumExistingInstances; InstanceIdx < NumInstances; ++InstanceIdx)
+		{
+			UUserWidget* WidgetInstance = CreateInstanceInternal(WidgetClass);
+			if (!WidgetInstance)
+			{
+				break;
+			}
+			InactiveWidgets.Push(WidgetInstance);
+		}
+	}
+}
+
+UUserWidget* FUserWidgetPool::CreateInstanceInternal(TSubclassOf<UUserWidget> WidgetClass)
+{
+	if (UWidget* OwningWidgetPtr = OwningWidget.Get())
+	{
+		return CreateWidget(OwningWidgetPtr, WidgetClass);
+	}
+	else if (APlayerController* PlayerControllerPtr = DefaultPlayerController.Get())
+	{
+		return CreateWidget(PlayerControllerPtr, WidgetClass);
+	}
+	return CreateWidget(OwningWorld.Get(), WidgetClass);
+}
+
 void FUserWidgetPool::Release(UUserWidget* Widget, bool bReleaseSlate)
 {
 	if (Widget != nullptr)
@@ -75,6 +75,13 @@ public:
 		return AddActiveWidgetInternal(WidgetClass, ConstructWidgetFunc);
 	}
 
+	/**
+	 * Creates inactive instances of the given class until the pool holds at least NumInstances of them, so they can be made active later without
+	 * constructing their widget tree. Meant to be called ahead of time, such as while loading, for pools about to hand out many entries at once.
+	 * Only the UUserWidget objects are created, their Slate is built with the construct function given to GetOrCreateInstance.
+	 */
+	void PreconstructInstances(TSubclassOf<UUserWidget> WidgetClass, int32 NumInstances);
+
 	/** Return a widget object to the pool, allowing it to be reused in the future */
 	void Release(UUserWidget* Widget, bool bReleaseSlate = false);
 
@@ -105,33 +112,32 @@ private:
 			return nullptr;
 		}
 
-		UUserWidget* WidgetInstance = nullptr;
-		for (UUserWidget* InactiveWidget : InactiveWidgets)
+		// Prefer the most recently released instance that still has its Slate cached, to skip rebuilding it
+		int32 InactiveWidgetIdx = INDEX_NONE;
+		for (int32 Idx = InactiveWidgets.Num() - 1; Idx >= 0; --Idx)
 		{
-			if (InactiveWidget->GetClass() == WidgetClass)
+			if (InactiveWidgets[Idx]->GetClass() == WidgetClass)
 			{
-				WidgetInstance = InactiveWidget;
-				InactiveWidgets.RemoveSingleSwap(InactiveWidget);
-				break;
+				InactiveWidgetIdx = Idx;
+				if (CachedSlateByWidgetObject.Contains(InactiveWidgets[Idx]))
+				{
+					break;
+				}
 			}
 		}
 
-		UWidget* OwningWidgetPtr = OwningWidget.Get();
-		if (!WidgetInstance)
+		UUserWidget* WidgetInstance = nullptr;
+		if (InactiveWidgetIdx != INDEX_NONE)
 		{
-			if (OwningWidgetPtr)
-			{
-				WidgetInstance = CreateWidget(OwningWidgetPtr, WidgetClass);
-			}
-			else if (APlayerController* PlayerControllerPtr = DefaultPlayerController.Get())
-			{
-				WidgetInstance = CreateWidget(PlayerControllerPtr, WidgetClass);
-			}
-			else
-			{
-				WidgetInstance = CreateWidget(OwningWorld.Get(), WidgetClass);
-			}
+			WidgetInstance = InactiveWidgets[InactiveWidgetIdx];
+			InactiveWidgets.RemoveAtSwap(InactiveWidgetIdx);
 		}
+		else
+		{
+			WidgetInstance = CreateInstanceInternal(WidgetClass);
+		}
+
+		UWidget* OwningWidgetPtr = OwningWidget.Get();
 
 		if (WidgetInstance)
 		{
@@ -151,6 +157,9 @@ private:
 		return Cast<UserWidgetT>(WidgetInstance);
 	}
 
+	/** Creates a new instance owned by the owning widget, default player controller or world, in that order */
+	UUserWidget* CreateInstanceInternal(TSubclassOf<UUserWidget> WidgetClass);
+
 	UPROPERTY(Transient)
 	TArray<TObjectPtr<UUserWidget>> ActiveWidgets;
 	
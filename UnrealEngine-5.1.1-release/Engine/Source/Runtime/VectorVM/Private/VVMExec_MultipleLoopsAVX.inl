@@ -40,7 +40,7 @@
 						uint32 Inc1 = (uint32)BatchState->RegIncTable[((uint16 *)InsPtr)[1]]; \
 						uint32 Inc2 = (uint32)BatchState->RegIncTable[((uint16 *)InsPtr)[2]]; \
 						uint32 Inc3 = (uint32)BatchState->RegIncTable[((uint16 *)InsPtr)[3]]; \
-						uint32 Inc3 = (uint32)BatchState->RegIncTable[((uint16 *)InsPtr)[4]];
+						uint32 Inc4 = (uint32)BatchState->RegIncTable[((uint16 *)InsPtr)[4]];
 #define VVM_execCoreSetupIncVars
 #define VVM_execCoreSetupPtrVars
 
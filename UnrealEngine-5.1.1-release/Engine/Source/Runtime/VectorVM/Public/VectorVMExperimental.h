@@ -2,7 +2,16 @@
 #pragma once
 
 #define VECTORVM_SUPPORTS_AVX 0
-#define VECTORVM_SUPPORTS_COMPUTED_GOTO 0
+
+// Threaded dispatch through a table of label addresses, each instruction jumps straight to the next handler instead of going back through
+// the switch, which saves a bounds check and gives the branch predictor one indirect branch per handler. Only GCC and Clang support it.
+#ifndef VECTORVM_SUPPORTS_COMPUTED_GOTO
+	#if defined(__clang__) || defined(__GNUC__)
+		#define VECTORVM_SUPPORTS_COMPUTED_GOTO 1
+	#else
+		#define VECTORVM_SUPPORTS_COMPUTED_GOTO 0
+	#endif
+#endif
 
 //only to be included by VectorVM.h
 
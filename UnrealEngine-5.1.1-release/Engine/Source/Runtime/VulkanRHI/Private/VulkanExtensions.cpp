@@ -43,6 +43,15 @@ TAutoConsoleVariable<int32> GVulkanRayTracingCVar(
 	ECVF_ReadOnly
 );
 
+TAutoConsoleVariable<int32> GVulkanGraphicsPipelineLibraryCVar(
+	TEXT("r.Vulkan.GraphicsPipelineLibrary"),
+	0,
+	TEXT("0: Graphics pipelines are compiled as a whole (default)\n")
+	TEXT("1: Enable VK_EXT_graphics_pipeline_library when supported. The vertex input, pre-rasterization, fragment shader and fragment output\n")
+	TEXT("   parts of graphics pipelines are compiled once and shared, and pipelines are linked from them. Not used with the PSO LRU cache."),
+	ECVF_ReadOnly
+);
+
 TAutoConsoleVariable<int32> GVulkanAllowHostQueryResetCVar(
 	TEXT("r.Vulkan.AllowHostQueryReset"),
 	1,
@@ -909,6 +918,44 @@ private:
 };
 
 
+#if VULKAN_SUPPORTS_GRAPHICS_PIPELINE_LIBRARY
+// ***** VK_EXT_graphics_pipeline_library
+class FVulkanEXTGraphicsPipelineLibraryExtension : public FVulkanDeviceExtension
+{
+public:
+
+	FVulkanEXTGraphicsPipelineLibraryExtension(FVulkanDevice* InDevice)
+		: FVulkanDeviceExtension(InDevice, VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME, VULKAN_SUPPORTS_GRAPHICS_PIPELINE_LIBRARY)
+	{
+		bEnabledInCode = bEnabledInCode && (GVulkanGraphicsPipelineLibraryCVar.GetValueOnAnyThread() != 0);
+	}
+
+	virtual void PrePhysicalDeviceFeatures(VkPhysicalDeviceFeatures2KHR& PhysicalDeviceFeatures2) override final
+	{
+		ZeroVulkanStruct(GraphicsPipelineLibraryFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT);
+		AddToPNext(PhysicalDeviceFeatures2, GraphicsPipelineLibraryFeatures);
+	}
+
+	virtual void PostPhysicalDeviceFeatures(FOptionalVulkanDeviceExtensions& ExtensionFlags) override final
+	{
+		ExtensionFlags.HasEXTGraphicsPipelineLibrary = (GraphicsPipelineLibraryFeatures.graphicsPipelineLibrary == VK_TRUE) ? 1 : 0;
+	}
+
+	virtual void PreCreateDevice(VkDeviceCreateInfo& DeviceCreateInfo) override final
+	{
+		if (GraphicsPipelineLibraryFeatures.graphicsPipelineLibrary == VK_TRUE)
+		{
+			AddToPNext(DeviceCreateInfo, GraphicsPipelineLibraryFeatures);
+		}
+	}
+
+private:
+	VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT GraphicsPipelineLibraryFeatures;
+};
+#endif // VULKAN_SUPPORTS_GRAPHICS_PIPELINE_LIBRARY
+
+
+
 // ***** VK_EXT_subgroup_size_control
 class FVulkanEXTSubgroupSizeControlExtension : public FVulkanDeviceExtension
 {
@@ -1027,6 +1074,12 @@ FVulkanDeviceExtensionArray FVulkanDeviceExtension::GetUESupportedDeviceExtensio
 	ADD_CUSTOM_EXTENSION(FVulkanEXTDescriptorIndexingExtension);
 	ADD_CUSTOM_EXTENSION(FVulkanEXTHostQueryResetExtension);
 	ADD_CUSTOM_EXTENSION(FVulkanEXTSubgroupSizeControlExtension);
+#if VULKAN_SUPPORTS_GRAPHICS_PIPELINE_LIBRARY
+	// Required by VK_EXT_graphics_pipeline_library
+	const int32 PipelineLibraryEnabled = (GVulkanGraphicsPipelineLibraryCVar.GetValueOnAnyThread() != 0) ? VULKAN_EXTENSION_ENABLED : VULKAN_EXTENSION_DISABLED;
+	ADD_SIMPLE_EXTENSION(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME,         PipelineLibraryEnabled,               VULKAN_EXTENSION_NOT_PROMOTED, nullptr);
+	ADD_CUSTOM_EXTENSION(FVulkanEXTGraphicsPipelineLibraryExtension);
+#endif
 
 	// Needed for Raytracing
 	ADD_CUSTOM_EXTENSION(FVulkanKHRBufferDeviceAddressExtension);
@@ -221,6 +221,24 @@ static FAutoConsoleVariableRef CVarVulkanFreeAllPages(
 	ECVF_ReadOnly
 );
 
+static float GVulkanEvictableMemoryPriority = VULKAN_MEMORY_MEDIUM_PRIORITY;
+static FAutoConsoleVariableRef CVarVulkanEvictableMemoryPriority(
+	TEXT("r.Vulkan.EvictableMemoryPriority"),
+	GVulkanEvictableMemoryPriority,
+	TEXT("Priority from 0 to 1 given with VK_EXT_memory_priority to the pages of evictable images, such as streamed textures, so the driver pages them out\n")
+	TEXT("before render targets and buffers when video memory is over committed. Applies to pages allocated after it is changed. Default 0.5"),
+	ECVF_RenderThreadSafe
+);
+
+static int32 GVulkanUploadRingBudgetKB = 2048;
+static FAutoConsoleVariableRef CVarVulkanUploadRingBudgetKB(
+	TEXT("r.Vulkan.UploadRingBudgetKB"),
+	GVulkanUploadRingBudgetKB,
+	TEXT("Per frame budget in KB of texture updates staged in the persistently mapped frame temp buffer instead of a staging buffer of their own.\n")
+	TEXT("Updates beyond the budget, or that do not fit the frame buffer, fall back to the staging manager. 0 disables. Default 2048"),
+	ECVF_RenderThreadSafe
+);
+
 static int32 GVulkanLogEvictStatus = 0;
 static FAutoConsoleVariableRef GVarVulkanLogEvictStatus(
 	TEXT("r.Vulkan.LogEvictStatus"),
@@ -818,9 +836,14 @@ namespace VulkanRHI
 		SCOPED_NAMED_EVENT(FDeviceMemoryManager_Alloc, FColor::Cyan);
 		FScopeLock Lock(&DeviceMemLock);
 
+		if (!Device->GetOptionalExtensions().HasMemoryPriority)
+		{
+			Priority = VULKAN_MEMORY_HIGHEST_PRIORITY;
+		}
+
 		if(!DedicatedAllocateInfo)
 		{
-			FDeviceMemoryBlockKey Key = {MemoryTypeIndex, AllocationSize};
+			FDeviceMemoryBlockKey Key = {MemoryTypeIndex, AllocationSize, Priority};
 			FDeviceMemoryBlock& Block = Allocations.FindOrAdd(Key);
 			if(Block.Allocations.Num() > 0)
 			{
@@ -971,6 +994,7 @@ namespace VulkanRHI
 		NewAllocation->Handle = Handle;
 		NewAllocation->Size = AllocationSize;
 		NewAllocation->MemoryTypeIndex = MemoryTypeIndex;
+		NewAllocation->Priority = Priority;
 		NewAllocation->bCanBeMapped = VKHasAllFlags(MemoryProperties.memoryTypes[MemoryTypeIndex].propertyFlags, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
 		NewAllocation->bIsCoherent = VKHasAllFlags(MemoryProperties.memoryTypes[MemoryTypeIndex].propertyFlags, VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
 		NewAllocation->bIsCached = VKHasAllFlags(MemoryProperties.memoryTypes[MemoryTypeIndex].propertyFlags, VK_MEMORY_PROPERTY_HOST_CACHED_BIT);
@@ -1041,7 +1065,7 @@ namespace VulkanRHI
 		if(!Allocation->bDedicatedMemory)
 		{
 			VkDeviceSize AllocationSize = Allocation->Size;
-			FDeviceMemoryBlockKey Key = { Allocation->MemoryTypeIndex, AllocationSize };
+			FDeviceMemoryBlockKey Key = { Allocation->MemoryTypeIndex, AllocationSize, Allocation->Priority };
 			FDeviceMemoryBlock& Block = Allocations.FindOrAdd(Key);
 			FDeviceMemoryBlock::FFreeBlock FreeBlock = {Allocation, GFrameNumberRenderThread};
 			Block.Allocations.Add(FreeBlock);
@@ -2010,11 +2034,12 @@ namespace VulkanRHI
 			AllocationSize = Size;
 		}
 
-		FDeviceMemoryAllocation* DeviceMemoryAllocation = DeviceMemoryManager.Alloc(true, AllocationSize, MemoryTypeIndex, nullptr, VULKAN_MEMORY_HIGHEST_PRIORITY, bExternal, File, Line);
+		const float Priority = (AllocationFlags & VulkanAllocationFlagsCanEvict) ? FMath::Clamp(GVulkanEvictableMemoryPriority, 0.0f, 1.0f) : VULKAN_MEMORY_HIGHEST_PRIORITY;
+		FDeviceMemoryAllocation* DeviceMemoryAllocation = DeviceMemoryManager.Alloc(true, AllocationSize, MemoryTypeIndex, nullptr, Priority, bExternal, File, Line);
 		if (!DeviceMemoryAllocation && Size != AllocationSize)
 		{
 			// Retry with a smaller size
-			DeviceMemoryAllocation = DeviceMemoryManager.Alloc(true, Size, MemoryTypeIndex, nullptr, VULKAN_MEMORY_HIGHEST_PRIORITY, bExternal, File, Line);
+			DeviceMemoryAllocation = DeviceMemoryManager.Alloc(true, Size, MemoryTypeIndex, nullptr, Priority, bExternal, File, Line);
 			if(!DeviceMemoryAllocation)
 			{
 				return false;
@@ -4887,9 +4912,26 @@ namespace VulkanRHI
 		}
 	}
 
+	bool FTempFrameAllocationBuffer::TryAllocUpload(uint32 InSize, uint32 InAlignment, FTempAllocInfo& OutInfo)
+	{
+		FScopeLock ScopeLock(&CS);
+
+		const uint64 BudgetBytes = (uint64)FMath::Max(GVulkanUploadRingBudgetKB, 0) * 1024;
+		if (UploadBytesThisFrame + InSize > BudgetBytes || !Entries[BufferIndex].TryAlloc(InSize, InAlignment, OutInfo))
+		{
+			INC_DWORD_STAT(STAT_VulkanUploadRingFallbacks);
+			return false;
+		}
+
+		UploadBytesThisFrame += InSize;
+		return true;
+	}
+
 	void FTempFrameAllocationBuffer::Reset()
 	{
 		FScopeLock ScopeLock(&CS);
+		SET_MEMORY_STAT(STAT_VulkanUploadRingBytes, UploadBytesThisFrame);
+		UploadBytesThisFrame = 0;
 		BufferIndex = (BufferIndex + 1) % NUM_BUFFERS;
 		Entries[BufferIndex].Reset(Device);
 	}
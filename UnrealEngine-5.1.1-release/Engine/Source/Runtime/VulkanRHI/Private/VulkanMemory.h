@@ -249,6 +249,7 @@ namespace VulkanRHI
 			, Handle(VK_NULL_HANDLE)
 			, MappedPointer(nullptr)
 			, MemoryTypeIndex(0)
+			, Priority(VULKAN_MEMORY_HIGHEST_PRIORITY)
 			, bCanBeMapped(0)
 			, bIsCoherent(0)
 			, bIsCached(0)
@@ -304,6 +305,8 @@ namespace VulkanRHI
 		VkDevice DeviceHandle;
 		VkDeviceMemory Handle;
 		void* MappedPointer;
+		// Priority given to VK_EXT_memory_priority, freed allocations are only reused for the same priority
+		float Priority;
 		uint32 MemoryTypeIndex : 8;
 		uint32 bCanBeMapped : 1;
 		uint32 bIsCoherent : 1;
@@ -325,16 +328,17 @@ namespace VulkanRHI
 	{
 		uint32 MemoryTypeIndex;
 		VkDeviceSize BlockSize;
+		float Priority;
 
 		bool operator==(const FDeviceMemoryBlockKey& Other) const
 		{
-			return MemoryTypeIndex == Other.MemoryTypeIndex &&  BlockSize == Other.BlockSize;
+			return MemoryTypeIndex == Other.MemoryTypeIndex &&  BlockSize == Other.BlockSize && Priority == Other.Priority;
 		}
 	};
 
 	FORCEINLINE uint32 GetTypeHash(const FDeviceMemoryBlockKey& BlockKey)
 	{
-		return HashCombine(FCrc::TypeCrc32(BlockKey.MemoryTypeIndex), FCrc::TypeCrc32(BlockKey.BlockSize));
+		return HashCombine(HashCombine(FCrc::TypeCrc32(BlockKey.MemoryTypeIndex), FCrc::TypeCrc32(BlockKey.BlockSize)), FCrc::TypeCrc32(BlockKey.Priority));
 	}
 
 	struct FDeviceMemoryBlock
@@ -1144,10 +1148,15 @@ namespace VulkanRHI
 		};
 
 		void Alloc(uint32 InSize, uint32 InAlignment, FTempAllocInfo& OutInfo);
+
+		/** Upload memory for texture updates, fails instead of growing the buffer or once the frame budget of r.Vulkan.UploadRingBudgetKB is used */
+		bool TryAllocUpload(uint32 InSize, uint32 InAlignment, FTempAllocInfo& OutInfo);
+
 		void Reset();
 
 	protected:
 		uint32 BufferIndex;
+		uint32 UploadBytesThisFrame = 0;
 
 		enum
 		{
@@ -17,6 +17,7 @@
 #include "GlobalShader.h"
 #include "VulkanLLM.h"
 #include "Misc/ScopeRWLock.h"
+#include "Hash/CityHash.h"
 
 #define LRU_DEBUG 0
 #if !UE_BUILD_SHIPPING
@@ -292,6 +293,12 @@ FVulkanPipelineStateCacheManager::FVulkanPipelineStateCacheManager(FVulkanDevice
 {
 	bUseLRU = (int32)CVarEnableLRU.GetValueOnAnyThread() != 0;
 	LRUUsedPipelineMax = CVarLRUPipelineCapacity.GetValueOnAnyThread();
+
+#if VULKAN_SUPPORTS_GRAPHICS_PIPELINE_LIBRARY
+	// The LRU accounts for the size of each pipeline in the pipeline cache, which linked pipelines share with their libraries
+	bUseGraphicsPipelineLibrary = !bUseLRU && Device->GetOptionalExtensions().HasEXTGraphicsPipelineLibrary;
+	UE_CLOG(bUseGraphicsPipelineLibrary, LogVulkanRHI, Display, TEXT("Graphics pipelines are linked from pipeline libraries (VK_EXT_graphics_pipeline_library)"));
+#endif
 }
 
 
@@ -308,6 +315,10 @@ FVulkanPipelineStateCacheManager::~FVulkanPipelineStateCacheManager()
 	}
 	DestroyCache();
 
+#if VULKAN_SUPPORTS_GRAPHICS_PIPELINE_LIBRARY
+	DestroyGraphicsPipelineLibraries();
+#endif
+
 	// Only destroy layouts when quitting
 	for (auto& Pair : LayoutMap)
 	{
@@ -1314,7 +1325,16 @@ bool FVulkanPipelineStateCacheManager::CreateGfxPipelineFromEntry(FVulkanRHIGrap
 
 	double BeginTime = FPlatformTime::Seconds();
 
-	Result = CreateVKPipeline(PSO, Shaders, PipelineInfo, bPrecompile);
+#if VULKAN_SUPPORTS_GRAPHICS_PIPELINE_LIBRARY
+	if (bUseGraphicsPipelineLibrary)
+	{
+		Result = CreateVKPipelineFromLibraries(PSO, Shaders, PipelineInfo, bPrecompile);
+	}
+	else
+#endif
+	{
+		Result = CreateVKPipeline(PSO, Shaders, PipelineInfo, bPrecompile);
+	}
 
 	if (Result != VK_SUCCESS)
 	{
@@ -1486,6 +1506,279 @@ VkResult FVulkanPipelineStateCacheManager::CreateVKPipeline(FVulkanRHIGraphicsPi
  	return Result;
 }
 
+#if VULKAN_SUPPORTS_GRAPHICS_PIPELINE_LIBRARY
+namespace VulkanGraphicsPipelineLibrary
+{
+	/** Hash of the state a pipeline library is created from */
+	struct FKeyBuilder
+	{
+		uint64 Hash = 0;
+
+		void AddData(const void* Data, SIZE_T Size)
+		{
+			Hash = CityHash64WithSeed((const char*)Data, Size, Hash);
+		}
+
+		template<typename T>
+		void Add(const T& Value)
+		{
+			AddData(&Value, sizeof(T));
+		}
+
+		/** Hashes the members from First to Last included, which must be contiguous without padding */
+		template<typename TFirst, typename TLast>
+		void AddRange(const TFirst& First, const TLast& Last)
+		{
+			AddData(&First, (const uint8*)(&Last + 1) - (const uint8*)&First);
+		}
+
+		void AddRenderPass(const VkGraphicsPipelineCreateInfo& PipelineInfo)
+		{
+			Add((uint64)PipelineInfo.renderPass);
+			Add(PipelineInfo.subpass);
+		}
+
+		void AddMultisample(const VkPipelineMultisampleStateCreateInfo& MSInfo)
+		{
+			AddRange(MSInfo.rasterizationSamples, MSInfo.minSampleShading);
+			AddRange(MSInfo.alphaToCoverageEnable, MSInfo.alphaToOneEnable);
+		}
+
+		void AddShadingRate(const void* ShadingRateInfo)
+		{
+#if VULKAN_SUPPORTS_FRAGMENT_SHADING_RATE
+			if (ShadingRateInfo)
+			{
+				const VkPipelineFragmentShadingRateStateCreateInfoKHR& FragmentShadingRate = *(const VkPipelineFragmentShadingRateStateCreateInfoKHR*)ShadingRateInfo;
+				AddRange(FragmentShadingRate.fragmentSize, FragmentShadingRate.combinerOps);
+			}
+#endif
+		}
+	};
+}
+
+VkResult FVulkanPipelineStateCacheManager::CreateVKPipelineFromLibraries(FVulkanRHIGraphicsPipelineState* PSO, FVulkanShader* Shaders[ShaderStage::NumStages], const VkGraphicsPipelineCreateInfo& PipelineInfo, bool bIsPrecompileJob)
+{
+	using namespace VulkanGraphicsPipelineLibrary;
+
+	// The only extension of the pipeline create info is the fragment shading rate, which is state of both shader libraries
+	const void* ShadingRateInfo = PipelineInfo.pNext;
+
+	VkPipeline Libraries[(int32)EGraphicsPipelineLibrary::Num];
+
+	// Vertex input interface
+	{
+		const VkPipelineVertexInputStateCreateInfo& VBInfo = *PipelineInfo.pVertexInputState;
+
+		FKeyBuilder Key;
+		Key.AddData(VBInfo.pVertexBindingDescriptions, VBInfo.vertexBindingDescriptionCount * sizeof(VkVertexInputBindingDescription));
+		Key.AddData(VBInfo.pVertexAttributeDescriptions, VBInfo.vertexAttributeDescriptionCount * sizeof(VkVertexInputAttributeDescription));
+		Key.AddRange(PipelineInfo.pInputAssemblyState->topology, PipelineInfo.pInputAssemblyState->primitiveRestartEnable);
+
+		VkGraphicsPipelineCreateInfo LibraryInfo;
+		ZeroVulkanStruct(LibraryInfo, VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO);
+		LibraryInfo.pVertexInputState = PipelineInfo.pVertexInputState;
+		LibraryInfo.pInputAssemblyState = PipelineInfo.pInputAssemblyState;
+		LibraryInfo.pDynamicState = PipelineInfo.pDynamicState;
+
+		Libraries[(int32)EGraphicsPipelineLibrary::VertexInput] = FindOrCreateGraphicsPipelineLibrary(EGraphicsPipelineLibrary::VertexInput, Key.Hash, LibraryInfo, bIsPrecompileJob);
+	}
+
+	VkPipelineShaderStageCreateInfo PreRasterizationStages[ShaderStage::NumStages];
+	uint32 NumPreRasterizationStages = 0;
+	const VkPipelineShaderStageCreateInfo* FragmentStage = nullptr;
+	for (uint32 StageIndex = 0; StageIndex < PipelineInfo.stageCount; ++StageIndex)
+	{
+		if (PipelineInfo.pStages[StageIndex].stage == VK_SHADER_STAGE_FRAGMENT_BIT)
+		{
+			FragmentStage = &PipelineInfo.pStages[StageIndex];
+		}
+		else
+		{
+			PreRasterizationStages[NumPreRasterizationStages++] = PipelineInfo.pStages[StageIndex];
+		}
+	}
+
+	// Pre-rasterization shaders
+	{
+		const VkPipelineRasterizationStateCreateInfo& RasterizerState = *PipelineInfo.pRasterizationState;
+
+		FKeyBuilder Key;
+		Key.Add((uint64)PipelineInfo.layout);
+		Key.AddRenderPass(PipelineInfo);
+		for (int32 Stage = 0; Stage < ShaderStage::NumStages; ++Stage)
+		{
+			// Shader keys are hashes of the SPIR-V, the modules are patched for the pipeline layout which is part of the key
+			Key.Add((Stage != ShaderStage::Pixel && Shaders[Stage]) ? Shaders[Stage]->GetShaderKey() : 0);
+		}
+		Key.AddRange(RasterizerState.depthClampEnable, RasterizerState.lineWidth);
+		Key.AddShadingRate(ShadingRateInfo);
+
+		VkGraphicsPipelineCreateInfo LibraryInfo;
+		ZeroVulkanStruct(LibraryInfo, VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO);
+		LibraryInfo.pNext = ShadingRateInfo;
+		LibraryInfo.stageCount = NumPreRasterizationStages;
+		LibraryInfo.pStages = PreRasterizationStages;
+		LibraryInfo.pViewportState = PipelineInfo.pViewportState;
+		LibraryInfo.pRasterizationState = PipelineInfo.pRasterizationState;
+		LibraryInfo.pDynamicState = PipelineInfo.pDynamicState;
+		LibraryInfo.layout = PipelineInfo.layout;
+		LibraryInfo.renderPass = PipelineInfo.renderPass;
+		LibraryInfo.subpass = PipelineInfo.subpass;
+
+		Libraries[(int32)EGraphicsPipelineLibrary::PreRasterization] = FindOrCreateGraphicsPipelineLibrary(EGraphicsPipelineLibrary::PreRasterization, Key.Hash, LibraryInfo, bIsPrecompileJob);
+	}
+
+	// Fragment shader
+	{
+		const VkPipelineDepthStencilStateCreateInfo& DepthStencilState = *PipelineInfo.pDepthStencilState;
+
+		FKeyBuilder Key;
+		Key.Add((uint64)PipelineInfo.layout);
+		Key.AddRenderPass(PipelineInfo);
+		Key.Add(Shaders[ShaderStage::Pixel] ? Shaders[ShaderStage::Pixel]->GetShaderKey() : 0);
+		Key.AddRange(DepthStencilState.depthTestEnable, DepthStencilState.maxDepthBounds);
+		Key.AddMultisample(*PipelineInfo.pMultisampleState);
+		Key.AddShadingRate(ShadingRateInfo);
+
+		VkGraphicsPipelineCreateInfo LibraryInfo;
+		ZeroVulkanStruct(LibraryInfo, VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO);
+		LibraryInfo.pNext = ShadingRateInfo;
+		LibraryInfo.stageCount = FragmentStage ? 1 : 0;
+		LibraryInfo.pStages = FragmentStage;
+		LibraryInfo.pMultisampleState = PipelineInfo.pMultisampleState;
+		LibraryInfo.pDepthStencilState = PipelineInfo.pDepthStencilState;
+		LibraryInfo.pDynamicState = PipelineInfo.pDynamicState;
+		LibraryInfo.layout = PipelineInfo.layout;
+		LibraryInfo.renderPass = PipelineInfo.renderPass;
+		LibraryInfo.subpass = PipelineInfo.subpass;
+
+		Libraries[(int32)EGraphicsPipelineLibrary::FragmentShader] = FindOrCreateGraphicsPipelineLibrary(EGraphicsPipelineLibrary::FragmentShader, Key.Hash, LibraryInfo, bIsPrecompileJob);
+	}
+
+	// Fragment output interface
+	{
+		const VkPipelineColorBlendStateCreateInfo& CBInfo = *PipelineInfo.pColorBlendState;
+
+		FKeyBuilder Key;
+		Key.AddRenderPass(PipelineInfo);
+		Key.AddRange(CBInfo.logicOpEnable, CBInfo.attachmentCount);
+		Key.AddData(CBInfo.pAttachments, CBInfo.attachmentCount * sizeof(VkPipelineColorBlendAttachmentState));
+		Key.Add(CBInfo.blendConstants);
+		Key.AddMultisample(*PipelineInfo.pMultisampleState);
+
+		VkGraphicsPipelineCreateInfo LibraryInfo;
+		ZeroVulkanStruct(LibraryInfo, VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO);
+		LibraryInfo.pColorBlendState = PipelineInfo.pColorBlendState;
+		LibraryInfo.pMultisampleState = PipelineInfo.pMultisampleState;
+		LibraryInfo.pDynamicState = PipelineInfo.pDynamicState;
+		LibraryInfo.renderPass = PipelineInfo.renderPass;
+		LibraryInfo.subpass = PipelineInfo.subpass;
+
+		Libraries[(int32)EGraphicsPipelineLibrary::FragmentOutput] = FindOrCreateGraphicsPipelineLibrary(EGraphicsPipelineLibrary::FragmentOutput, Key.Hash, LibraryInfo, bIsPrecompileJob);
+	}
+
+	for (VkPipeline Library : Libraries)
+	{
+		if (Library == VK_NULL_HANDLE)
+		{
+			return VK_ERROR_INITIALIZATION_FAILED;
+		}
+	}
+
+	VkPipelineLibraryCreateInfoKHR LibrariesInfo;
+	ZeroVulkanStruct(LibrariesInfo, VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR);
+	LibrariesInfo.libraryCount = UE_ARRAY_COUNT(Libraries);
+	LibrariesInfo.pLibraries = Libraries;
+
+	VkGraphicsPipelineCreateInfo LinkInfo;
+	ZeroVulkanStruct(LinkInfo, VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO);
+	LinkInfo.pNext = &LibrariesInfo;
+	LinkInfo.layout = PipelineInfo.layout;
+	// Precompiled pipelines are built during loading and can afford the optimization, the others are linked quickly on first use
+	LinkInfo.flags = bIsPrecompileJob ? VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT : 0;
+
+	VkResult Result = VK_ERROR_INITIALIZATION_FAILED;
+	{
+		SCOPE_CYCLE_COUNTER(STAT_VulkanPSOVulkanCreationTime);
+		FPipelineCache& Cache = bIsPrecompileJob ? CurrentPrecompilingPSOCache : GlobalPSOCache;
+		FScopedPipelineCache PipelineCacheShared = Cache.Get(EPipelineCacheAccess::Shared);
+		Result = VulkanRHI::vkCreateGraphicsPipelines(Device->GetInstanceHandle(), PipelineCacheShared.Get(), 1, &LinkInfo, VULKAN_CPU_ALLOCATOR, &PSO->VulkanPipeline);
+	}
+
+	PSO->PipelineCacheSize = 0;
+	return Result;
+}
+
+VkPipeline FVulkanPipelineStateCacheManager::FindOrCreateGraphicsPipelineLibrary(EGraphicsPipelineLibrary Library, uint64 Key, VkGraphicsPipelineCreateInfo LibraryInfo, bool bIsPrecompileJob)
+{
+	TMap<uint64, VkPipeline>& LibraryMap = GraphicsPipelineLibraries[(int32)Library];
+	{
+		FRWScopeLock ScopeLock(GraphicsPipelineLibrariesLock, SLT_ReadOnly);
+		if (const VkPipeline* Found = LibraryMap.Find(Key))
+		{
+			return *Found;
+		}
+	}
+
+	static const VkGraphicsPipelineLibraryFlagsEXT LibraryFlags[(int32)EGraphicsPipelineLibrary::Num] =
+	{
+		VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT,
+		VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT,
+		VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT,
+		VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT,
+	};
+
+	VkGraphicsPipelineLibraryCreateInfoEXT LibraryTypeInfo;
+	ZeroVulkanStruct(LibraryTypeInfo, VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT);
+	LibraryTypeInfo.flags = LibraryFlags[(int32)Library];
+	LibraryTypeInfo.pNext = LibraryInfo.pNext;
+	LibraryInfo.pNext = &LibraryTypeInfo;
+	LibraryInfo.flags |= VK_PIPELINE_CREATE_LIBRARY_BIT_KHR | VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
+
+	VkPipeline NewLibrary = VK_NULL_HANDLE;
+	VkResult Result = VK_ERROR_INITIALIZATION_FAILED;
+	{
+		SCOPE_CYCLE_COUNTER(STAT_VulkanPSOVulkanCreationTime);
+		FPipelineCache& Cache = bIsPrecompileJob ? CurrentPrecompilingPSOCache : GlobalPSOCache;
+		FScopedPipelineCache PipelineCacheShared = Cache.Get(EPipelineCacheAccess::Shared);
+		Result = VulkanRHI::vkCreateGraphicsPipelines(Device->GetInstanceHandle(), PipelineCacheShared.Get(), 1, &LibraryInfo, VULKAN_CPU_ALLOCATOR, &NewLibrary);
+	}
+
+	if (Result != VK_SUCCESS)
+	{
+		UE_LOG(LogVulkanRHI, Error, TEXT("Failed to create graphics pipeline library %d (%d)"), (int32)Library, (int32)Result);
+		return VK_NULL_HANDLE;
+	}
+
+	FRWScopeLock ScopeLock(GraphicsPipelineLibrariesLock, SLT_Write);
+	VkPipeline& MapLibrary = LibraryMap.FindOrAdd(Key, VK_NULL_HANDLE);
+	if (MapLibrary != VK_NULL_HANDLE)
+	{
+		// Created by another thread in the meantime
+		VulkanRHI::vkDestroyPipeline(Device->GetInstanceHandle(), NewLibrary, VULKAN_CPU_ALLOCATOR);
+	}
+	else
+	{
+		MapLibrary = NewLibrary;
+	}
+	return MapLibrary;
+}
+
+void FVulkanPipelineStateCacheManager::DestroyGraphicsPipelineLibraries()
+{
+	FRWScopeLock ScopeLock(GraphicsPipelineLibrariesLock, SLT_Write);
+	for (TMap<uint64, VkPipeline>& LibraryMap : GraphicsPipelineLibraries)
+	{
+		for (const TPair<uint64, VkPipeline>& Pair : LibraryMap)
+		{
+			VulkanRHI::vkDestroyPipeline(Device->GetInstanceHandle(), Pair.Value, VULKAN_CPU_ALLOCATOR);
+		}
+		LibraryMap.Empty();
+	}
+}
+#endif // VULKAN_SUPPORTS_GRAPHICS_PIPELINE_LIBRARY
+
 void FVulkanPipelineStateCacheManager::DestroyCache()
 {
 	VkDevice DeviceHandle = Device->GetInstanceHandle();
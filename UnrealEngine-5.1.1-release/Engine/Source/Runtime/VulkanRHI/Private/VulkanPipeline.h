@@ -493,6 +493,23 @@ private:
 	bool CreateGfxPipelineFromEntry(FVulkanRHIGraphicsPipelineState* PSO, FVulkanShader* Shaders[ShaderStage::NumStages], bool bPrecompile);
 
 	VkResult CreateVKPipeline(FVulkanRHIGraphicsPipelineState* PSO, FVulkanShader* Shaders[ShaderStage::NumStages], VkGraphicsPipelineCreateInfo PipelineInfo, bool bIsPrecompileJob);
+
+#if VULKAN_SUPPORTS_GRAPHICS_PIPELINE_LIBRARY
+	/** Parts of a graphics pipeline compiled separately with VK_EXT_graphics_pipeline_library */
+	enum class EGraphicsPipelineLibrary : uint8
+	{
+		VertexInput,
+		PreRasterization,
+		FragmentShader,
+		FragmentOutput,
+		Num
+	};
+
+	/** Links the pipeline of the PSO from its libraries, creating the ones not already shared with another pipeline. Precompiled pipelines are link time optimized. */
+	VkResult CreateVKPipelineFromLibraries(FVulkanRHIGraphicsPipelineState* PSO, FVulkanShader* Shaders[ShaderStage::NumStages], const VkGraphicsPipelineCreateInfo& PipelineInfo, bool bIsPrecompileJob);
+	VkPipeline FindOrCreateGraphicsPipelineLibrary(EGraphicsPipelineLibrary Library, uint64 Key, VkGraphicsPipelineCreateInfo LibraryInfo, bool bIsPrecompileJob);
+	void DestroyGraphicsPipelineLibraries();
+#endif
 	static FString ShaderHashesToString(FVulkanShader* Shaders[ShaderStage::NumStages]);
 
 	FVulkanLayout* FindOrAddLayout(const FVulkanDescriptorSetsLayoutInfo& DescriptorSetLayoutInfo, bool bGfxLayout);
@@ -574,6 +591,13 @@ private:
 	uint32 LRUUsedPipelineMax = 0;
 	TMap<uint64, FVulkanPipelineSize> LRU2SizeList;	// key: Shader hash (FShaderHash), value: pipeline size
 	bool bUseLRU = true;
+
+#if VULKAN_SUPPORTS_GRAPHICS_PIPELINE_LIBRARY
+	// Pipeline libraries by hash of the state they are created from, kept until shutdown
+	FRWLock GraphicsPipelineLibrariesLock;
+	TMap<uint64, VkPipeline> GraphicsPipelineLibraries[(int32)EGraphicsPipelineLibrary::Num];
+	bool bUseGraphicsPipelineLibrary = false;
+#endif
 	friend class FVulkanDynamicRHI;
 	friend class FVulkanCommandListContext;
 	friend class FVulkanRHIGraphicsPipelineState;
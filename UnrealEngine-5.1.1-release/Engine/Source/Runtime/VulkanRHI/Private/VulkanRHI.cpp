@@ -90,6 +90,17 @@ static FAutoConsoleVariableRef GCVarEnableTransientResourceAllocator(
 	ECVF_ReadOnly
 );
 
+int32 GVulkanUseDescriptorSetCacheOnDesktop = 0;
+static FAutoConsoleVariableRef GCVarUseDescriptorSetCacheOnDesktop(
+	TEXT("r.Vulkan.DescriptorSetCache"),
+	GVulkanUseDescriptorSetCacheOnDesktop,
+	TEXT("Whether graphics pipelines reuse descriptor sets looked up by the hash of their resources instead of writing new ones when their bindings change.\n")
+	TEXT("Always used on mobile. Not compatible with ray tracing or the transient resource allocator, which is disabled when using it.\n")
+	TEXT("0 only on mobile (default)\n")
+	TEXT("1 on desktop as well, unless the shader platform supports ray tracing\n"),
+	ECVF_ReadOnly
+);
+
 bool GGPUCrashDebuggingEnabled = false;
 
 
@@ -428,6 +428,8 @@ DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Num Buffer Views"), STAT_VulkanNumBu
 DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Num Image Views"), STAT_VulkanNumImageViews, STATGROUP_VulkanRHI, );
 DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Num Physical Mem Allocations"), STAT_VulkanNumPhysicalMemAllocations, STATGROUP_VulkanRHI, );
 DECLARE_MEMORY_STAT_EXTERN(TEXT("Frame Temp Memory"), STAT_VulkanTempFrameAllocationBuffer, STATGROUP_VulkanRHI, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Upload Ring Bytes Last Frame"), STAT_VulkanUploadRingBytes, STATGROUP_VulkanRHI, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Upload Ring Fallbacks"), STAT_VulkanUploadRingFallbacks, STATGROUP_VulkanRHI, );
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Dynamic VB Size"), STAT_VulkanDynamicVBSize, STATGROUP_VulkanRHI, );
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Dynamic IB Size"), STAT_VulkanDynamicIBSize, STATGROUP_VulkanRHI, );
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Dynamic VB Lock/Unlock time"), STAT_VulkanDynamicVBLockTime, STATGROUP_VulkanRHI, );
@@ -874,9 +876,13 @@ namespace VulkanRHI
 	}
 }
 
+extern int32 GVulkanUseDescriptorSetCacheOnDesktop;
+
 inline bool UseVulkanDescriptorCache()
 {
-	return (PLATFORM_ANDROID)|| GMaxRHIFeatureLevel <= ERHIFeatureLevel::ES3_1;
+	// Ray tracing descriptors are not hashable yet, see FVulkanDescriptorSetWriter::WriteAccelerationStructure()
+	return (PLATFORM_ANDROID) || GMaxRHIFeatureLevel <= ERHIFeatureLevel::ES3_1
+		|| (GVulkanUseDescriptorSetCacheOnDesktop != 0 && !RHISupportsRayTracing(GMaxRHIShaderPlatform));
 }
 
 inline bool ValidateShadingRateDataType()
@@ -529,6 +529,9 @@ public:
 
 	static void InternalLockWrite(FVulkanCommandListContext& Context, FVulkanTexture* Surface, const VkBufferImageCopy& Region, VulkanRHI::FStagingBuffer* StagingBuffer);
 
+	/** Copies from SourceBuffer, the StagingBuffer is released after the copy if not null */
+	static void InternalLockWrite(FVulkanCommandListContext& Context, FVulkanTexture* Surface, const VkBufferImageCopy& Region, VkBuffer SourceBuffer, VulkanRHI::FStagingBuffer* StagingBuffer);
+
 	const FVulkanCpuReadbackBuffer* GetCpuReadbackBuffer() const { return CpuReadbackBuffer; }
 
 	FVulkanDevice* Device;
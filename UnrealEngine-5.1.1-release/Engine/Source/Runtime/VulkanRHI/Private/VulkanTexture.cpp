@@ -153,6 +153,11 @@ static void VulkanTextureDestroyed(uint64 Size, VkImageViewType ImageType, bool
 }
 
 inline void FVulkanTexture::InternalLockWrite(FVulkanCommandListContext& Context, FVulkanTexture* Surface, const VkBufferImageCopy& Region, VulkanRHI::FStagingBuffer* StagingBuffer)
+{
+	InternalLockWrite(Context, Surface, Region, StagingBuffer->GetHandle(), StagingBuffer);
+}
+
+void FVulkanTexture::InternalLockWrite(FVulkanCommandListContext& Context, FVulkanTexture* Surface, const VkBufferImageCopy& Region, VkBuffer SourceBuffer, VulkanRHI::FStagingBuffer* StagingBuffer)
 {
 	FVulkanCmdBuffer* CmdBuffer = Context.GetCommandBufferManager()->GetUploadCmdBuffer();
 	ensure(CmdBuffer->IsOutsideRenderPass());
@@ -172,7 +177,7 @@ inline void FVulkanTexture::InternalLockWrite(FVulkanCommandListContext& Context
 		Barrier.Execute(StagingCommandBuffer);
 	}
 
-	VulkanRHI::vkCmdCopyBufferToImage(StagingCommandBuffer, StagingBuffer->GetHandle(), Surface->Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &Region);
+	VulkanRHI::vkCmdCopyBufferToImage(StagingCommandBuffer, SourceBuffer, Surface->Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &Region);
 
 	// Transition the subresource layouts from the copy state to a regular read state if it was undefined, otherwise return it how it was
 	for (uint32 LayerIndex = ImageSubresource.baseArrayLayer; LayerIndex < ImageSubresource.baseArrayLayer + ImageSubresource.layerCount; ++LayerIndex)
@@ -190,7 +195,10 @@ inline void FVulkanTexture::InternalLockWrite(FVulkanCommandListContext& Context
 		Barrier.Execute(StagingCommandBuffer);
 	}
 
-	Surface->Device->GetStagingManager().ReleaseBuffer(CmdBuffer, StagingBuffer);
+	if (StagingBuffer)
+	{
+		Surface->Device->GetStagingManager().ReleaseBuffer(CmdBuffer, StagingBuffer);
+	}
 
 	if (GVulkanSubmitOnTextureUnlock != 0)
 	{
@@ -208,21 +216,56 @@ struct FRHICommandLockWriteTexture final : public FRHICommand<FRHICommandLockWri
 {
 	FVulkanTexture* Surface;
 	VkBufferImageCopy Region;
+	VkBuffer SourceBuffer;
 	VulkanRHI::FStagingBuffer* StagingBuffer;
 
 	FRHICommandLockWriteTexture(FVulkanTexture* InSurface, const VkBufferImageCopy& InRegion, VulkanRHI::FStagingBuffer* InStagingBuffer)
+		: FRHICommandLockWriteTexture(InSurface, InRegion, InStagingBuffer->GetHandle(), InStagingBuffer)
+	{
+	}
+
+	FRHICommandLockWriteTexture(FVulkanTexture* InSurface, const VkBufferImageCopy& InRegion, VkBuffer InSourceBuffer, VulkanRHI::FStagingBuffer* InStagingBuffer)
 		: Surface(InSurface)
 		, Region(InRegion)
+		, SourceBuffer(InSourceBuffer)
 		, StagingBuffer(InStagingBuffer)
 	{
 	}
 
 	void Execute(FRHICommandListBase& RHICmdList)
 	{
-		FVulkanTexture::InternalLockWrite(FVulkanCommandListContext::GetVulkanContext(RHICmdList.GetContext()), Surface, Region, StagingBuffer);
+		FVulkanTexture::InternalLockWrite(FVulkanCommandListContext::GetVulkanContext(RHICmdList.GetContext()), Surface, Region, SourceBuffer, StagingBuffer);
 	}
 };
 
+/**
+ * Upload memory of a texture update. Taken from the persistently mapped frame temp buffer while the frame upload budget lasts,
+ * which avoids creating and releasing a staging buffer per update, otherwise from the staging manager.
+ */
+static void* AllocateTextureUpload(FVulkanDevice& Device, uint32 BufferSize, EPixelFormat Format, VkBuffer& OutSourceBuffer, VkDeviceSize& OutSourceOffset, VulkanRHI::FStagingBuffer*& OutStagingBuffer)
+{
+	// Copy offsets have to be a multiple of the block size
+	const uint32 BlockBytes = GPixelFormats[Format].BlockBytes;
+	if (FMath::IsPowerOfTwo(BlockBytes))
+	{
+		const uint32 Alignment = FMath::Max3<uint32>(BlockBytes, 16, (uint32)Device.GetLimits().optimalBufferCopyOffsetAlignment);
+
+		VulkanRHI::FTempFrameAllocationBuffer::FTempAllocInfo UploadAlloc;
+		if (Device.GetImmediateContext().GetTempFrameAllocationBuffer().TryAllocUpload(BufferSize, Alignment, UploadAlloc))
+		{
+			OutSourceBuffer = UploadAlloc.Allocation.GetBufferHandle();
+			OutSourceOffset = UploadAlloc.Allocation.Offset + UploadAlloc.CurrentOffset;
+			OutStagingBuffer = nullptr;
+			return UploadAlloc.Data;
+		}
+	}
+
+	OutStagingBuffer = Device.GetStagingManager().AcquireBuffer(BufferSize);
+	OutSourceBuffer = OutStagingBuffer->GetHandle();
+	OutSourceOffset = 0;
+	return OutStagingBuffer->GetMappedPointer();
+}
+
 void FVulkanTexture::GenerateImageCreateInfo(
 	FImageCreateInfo& OutImageCreateInfo,
 	FVulkanDevice& InDevice,
@@ -1289,8 +1332,8 @@ void FVulkanDynamicRHI::InternalUpdateTexture2D(bool bFromRenderingThread, FRHIT
 	const uint32 DestSlicePitch = DestRowPitch * NumBlocksY;
 
 	const uint32 BufferSize = Align(DestSlicePitch, Limits.minMemoryMapAlignment);
-	StagingBuffer = Device->GetStagingManager().AcquireBuffer(BufferSize);
-	void* RESTRICT Memory = StagingBuffer->GetMappedPointer();
+	VkBuffer SourceBuffer = VK_NULL_HANDLE;
+	void* RESTRICT Memory = AllocateTextureUpload(*Device, BufferSize, PixelFormat, SourceBuffer, Region.bufferOffset, StagingBuffer);
 
 	uint8* RESTRICT DestData = (uint8*)Memory;
 	uint8* RESTRICT SourceRowData = (uint8*)SourceData;
@@ -1319,12 +1362,12 @@ void FVulkanDynamicRHI::InternalUpdateTexture2D(bool bFromRenderingThread, FRHIT
 	FRHICommandList& RHICmdList = FRHICommandListExecutor::GetImmediateCommandList();
 	if (!bFromRenderingThread || (RHICmdList.Bypass() || !IsRunningRHIInSeparateThread()))
 	{
-		FVulkanTexture::InternalLockWrite(Device->GetImmediateContext(), Texture, Region, StagingBuffer);
+		FVulkanTexture::InternalLockWrite(Device->GetImmediateContext(), Texture, Region, SourceBuffer, StagingBuffer);
 	}
 	else
 	{
 		check(IsInRenderingThread());
-		ALLOC_COMMAND_CL(RHICmdList, FRHICommandLockWriteTexture)(Texture, Region, StagingBuffer);
+		ALLOC_COMMAND_CL(RHICmdList, FRHICommandLockWriteTexture)(Texture, Region, SourceBuffer, StagingBuffer);
 	}
 }
 
@@ -1380,8 +1423,8 @@ void FVulkanDynamicRHI::InternalUpdateTexture3D(bool bFromRenderingThread, FRHIT
 	const uint32 DestSlicePitch = DestRowPitch * NumBlocksY;
 
 	const uint32 BufferSize = Align(DestSlicePitch * UpdateRegion.Depth, Limits.minMemoryMapAlignment);
-	StagingBuffer = Device->GetStagingManager().AcquireBuffer(BufferSize);
-	void* RESTRICT Memory = StagingBuffer->GetMappedPointer();
+	VkBuffer SourceBuffer = VK_NULL_HANDLE;
+	void* RESTRICT Memory = AllocateTextureUpload(*Device, BufferSize, PixelFormat, SourceBuffer, Region.bufferOffset, StagingBuffer);
 
 	ensure(UpdateRegion.SrcX == 0);
 	ensure(UpdateRegion.SrcY == 0);
@@ -1419,12 +1462,12 @@ void FVulkanDynamicRHI::InternalUpdateTexture3D(bool bFromRenderingThread, FRHIT
 	FRHICommandList& RHICmdList = FRHICommandListExecutor::GetImmediateCommandList();
 	if (!bFromRenderingThread || (RHICmdList.Bypass() || !IsRunningRHIInSeparateThread()))
 	{
-		FVulkanTexture::InternalLockWrite(Device->GetImmediateContext(), Texture, Region, StagingBuffer);
+		FVulkanTexture::InternalLockWrite(Device->GetImmediateContext(), Texture, Region, SourceBuffer, StagingBuffer);
 	}
 	else
 	{
 		check(IsInRenderingThread());
-		ALLOC_COMMAND_CL(RHICmdList, FRHICommandLockWriteTexture)(Texture, Region, StagingBuffer);
+		ALLOC_COMMAND_CL(RHICmdList, FRHICommandLockWriteTexture)(Texture, Region, SourceBuffer, StagingBuffer);
 	}
 }
 
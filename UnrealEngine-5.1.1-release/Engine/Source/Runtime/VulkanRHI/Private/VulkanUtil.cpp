@@ -960,6 +960,8 @@ DEFINE_STAT(STAT_VulkanNumBufferViews);
 DEFINE_STAT(STAT_VulkanNumImageViews);
 DEFINE_STAT(STAT_VulkanNumPhysicalMemAllocations);
 DEFINE_STAT(STAT_VulkanTempFrameAllocationBuffer);
+DEFINE_STAT(STAT_VulkanUploadRingBytes);
+DEFINE_STAT(STAT_VulkanUploadRingFallbacks);
 DEFINE_STAT(STAT_VulkanDynamicVBSize);
 DEFINE_STAT(STAT_VulkanDynamicIBSize);
 DEFINE_STAT(STAT_VulkanDynamicVBLockTime);
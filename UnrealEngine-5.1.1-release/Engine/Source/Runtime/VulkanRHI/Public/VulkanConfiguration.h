@@ -271,6 +271,14 @@
 	#endif
 #endif
 
+#ifndef VULKAN_SUPPORTS_GRAPHICS_PIPELINE_LIBRARY
+	#if defined(VK_EXT_graphics_pipeline_library) && defined(VK_KHR_pipeline_library)
+		#define VULKAN_SUPPORTS_GRAPHICS_PIPELINE_LIBRARY		1
+	#else
+		#define VULKAN_SUPPORTS_GRAPHICS_PIPELINE_LIBRARY		0
+	#endif
+#endif
+
 #ifndef VULKAN_SUPPORTS_RENDERPASS2
 	#ifdef VK_KHR_create_renderpass2
 		#define VULKAN_SUPPORTS_RENDERPASS2 1